@@ -14,6 +14,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/optional.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -37,6 +38,12 @@ namespace AZ::Data
         "Number of milliseconds to artifically delay an asset load.");
     AZ_CVAR(bool, cl_assetLoadError, false, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Enable failure of all asset loads.");
+    AZ_CVAR(uint32_t, cl_assetLoadMaxInFlightMegabytes, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of megabytes of streamed asset data that can be processed by load jobs at once, 0 for no limit. "
+        "Further load jobs wait until enough of the ones in flight finish. Loads that are being blocked on are never held back.");
+    AZ_CVAR(bool, cl_assetDeferRelease, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Defer destroying the assets that are no longer referenced to the next AssetManager::DispatchEvents, where they are "
+        "removed from the asset map in a single batch. Assets acquired again in the meantime are kept instead of being reloaded.");
 
     static constexpr char kAssetDBInstanceVarName[] = "AssetDatabaseInstance";
 
@@ -136,6 +143,16 @@ namespace AZ::Data
 
         ~LoadAssetJob() override
         {
+            if (m_throttledBytes)
+            {
+                m_owner->FinishLoadJob(*m_throttledBytes);
+            }
+        }
+
+        //! Records the data size the job was started with by AssetManager::StartLoadJob, to release it once finished.
+        void SetThrottledBytes(AZ::u64 loadBytes)
+        {
+            m_throttledBytes = loadBytes;
         }
 
         void Process() override
@@ -219,6 +236,7 @@ namespace AZ::Data
         AZ::IO::IStreamerTypes::RequestStatus m_requestState{ AZ::IO::IStreamerTypes::RequestStatus::Pending};
         bool m_isReload{ false };
         bool m_signalLoaded{ false };
+        AZStd::optional<AZ::u64> m_throttledBytes;
     };
 
 
@@ -567,6 +585,8 @@ namespace AZ::Data
     void AssetManager::DispatchEvents()
     {
         AZ_PROFILE_FUNCTION(AzCore);
+        ProcessDeferredReleases();
+
         AssetManagerNotificationBus::Broadcast(&AssetManagerNotificationBus::Events::OnAssetEventsDispatchBegin);
         while (AssetBus::QueuedEventCount())
         {
@@ -1203,6 +1223,14 @@ namespace AZ::Data
         bool wasInAssetsHash = false; // We do support assets that are not registered in the asset manager (with the same ID too).
         bool destroyAsset = false;
 
+        if (removeAssetFromHash && cl_assetDeferRelease && !m_cancelAllActiveJobs)
+        {
+            // The asset stays in the map until ProcessDeferredReleases, which checks its use count again
+            AZStd::scoped_lock lock(m_deferredReleaseMutex);
+            m_deferredReleases.push_back({ asset, assetId, assetType, creationToken });
+            return;
+        }
+
         if (removeAssetFromHash)
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
@@ -1232,31 +1260,80 @@ namespace AZ::Data
         // while the lock is not held since destroying the asset while holding the lock can cause a deadlock.
         if (destroyAsset)
         {
-            if(m_debugAssetEvents)
-            {
-                m_debugAssetEvents->ReleaseAsset(assetId);
-            }
+            DestroyReleasedAsset(asset, assetId, assetType, wasInAssetsHash);
+        }
+    }
 
-            // find the asset type handler
-            AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
-            if (handlerIt != m_handlers.end())
+    void AssetManager::ProcessDeferredReleases()
+    {
+        if (m_suspendAssetRelease)
+        {
+            return;
+        }
+
+        AZStd::vector<DeferredRelease> deferredReleases;
+        {
+            AZStd::scoped_lock lock(m_deferredReleaseMutex);
+            deferredReleases.swap(m_deferredReleases);
+        }
+
+        if (deferredReleases.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // Remove all the released assets from the map under a single lock, destroying them once it is released as in ReleaseAsset
+        size_t releasedCount = 0;
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+            for (const DeferredRelease& release : deferredReleases)
             {
-                AssetHandler* handler = handlerIt->second;
-                if (asset)
+                // The asset may have been acquired again since it was queued, or already destroyed by an earlier release of it
+                AssetMap::iterator it = m_assets.find(release.m_assetId);
+                int expectedRefCount = 0;
+                if (it != m_assets.end() && it->second->m_creationToken == release.m_creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
                 {
-                    handler->DestroyAsset(asset);
-
-                    if (wasInAssetsHash)
-                    {
-                        AssetBus::QueueEvent(assetId, &AssetBus::Events::OnAssetUnloaded, assetId, assetType);
-                    }
+                    m_assets.erase(it);
+                    deferredReleases[releasedCount++] = release;
                 }
             }
-            else
+        }
+
+        for (size_t releaseIndex = 0; releaseIndex < releasedCount; ++releaseIndex)
+        {
+            const DeferredRelease& release = deferredReleases[releaseIndex];
+            DestroyReleasedAsset(release.m_asset, release.m_assetId, release.m_assetType, true);
+        }
+    }
+
+    void AssetManager::DestroyReleasedAsset(AssetData* asset, const AssetId& assetId, const AssetType& assetType, bool wasInAssetsHash)
+    {
+        if(m_debugAssetEvents)
+        {
+            m_debugAssetEvents->ReleaseAsset(assetId);
+        }
+
+        // find the asset type handler
+        AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
+        if (handlerIt != m_handlers.end())
+        {
+            AssetHandler* handler = handlerIt->second;
+            if (asset)
             {
-                AZ_Assert(false, "No handler was registered for asset of type %s but it was still in the AssetManager as %s", assetType.ToString<AZ::OSString>().c_str(), asset->GetId().ToString<AZ::OSString>().c_str());
+                handler->DestroyAsset(asset);
+
+                if (wasInAssetsHash)
+                {
+                    AssetBus::QueueEvent(assetId, &AssetBus::Events::OnAssetUnloaded, assetId, assetType);
+                }
             }
         }
+        else
+        {
+            AZ_Assert(false, "No handler was registered for asset of type %s but it was still in the AssetManager as %s", assetType.ToString<AZ::OSString>().c_str(), asset->GetId().ToString<AZ::OSString>().c_str());
+        }
     }
 
     void AssetManager::OnAssetUnused(AssetData* asset)
@@ -1635,12 +1712,14 @@ namespace AZ::Data
                     dataStream, isReload, status, handler, loadParams, signalLoaded);
 
                 bool jobQueued = false;
+                bool isBlockedOn = false;
 
                 // If there's already an active blocking request waiting for this load to complete, let that thread handle
                 // the load itself instead of consuming a second thread.
                 {
                     AZStd::scoped_lock<AZStd::recursive_mutex> requestLock(m_activeBlockingRequestMutex);
                     auto range = m_activeBlockingRequests.equal_range(assetId);
+                    isBlockedOn = range.first != range.second;
                     for(auto blockingRequest = range.first; blockingRequest != range.second; ++blockingRequest)
                     {
                         if(blockingRequest->second->QueueAssetLoadJob(loadJob))
@@ -1653,7 +1732,15 @@ namespace AZ::Data
 
                 if (!jobQueued)
                 {
-                    loadJob->Start();
+                    if (isBlockedOn || cl_assetLoadMaxInFlightMegabytes == 0)
+                    {
+                        // holding back a load that a thread is blocked on could deadlock, should the loads in flight block on that thread.
+                        loadJob->Start();
+                    }
+                    else
+                    {
+                        StartLoadJob(loadJob, dataStream->GetLength());
+                    }
                 }
             }
             else
@@ -1824,6 +1911,59 @@ namespace AZ::Data
         m_activeJobs.erase(*job);
     }
 
+    //=========================================================================
+    // StartLoadJob
+    //=========================================================================
+    void AssetManager::StartLoadJob(LoadAssetJob* loadJob, AZ::u64 loadBytes)
+    {
+        loadJob->SetThrottledBytes(loadBytes);
+        {
+            AZStd::scoped_lock<AZStd::mutex> throttleLock(m_loadThrottleMutex);
+            const AZ::u64 maxInFlightBytes = aznumeric_cast<AZ::u64>(static_cast<uint32_t>(cl_assetLoadMaxInFlightMegabytes)) * 1024 * 1024;
+
+            // a load always starts when nothing else is in flight, so larger loads than the limit still go through
+            if (!m_heldBackLoadJobs.empty() || (m_inFlightLoadBytes > 0 && m_inFlightLoadBytes + loadBytes > maxInFlightBytes))
+            {
+                m_heldBackLoadJobs.emplace_back(loadJob, loadBytes);
+                return;
+            }
+            m_inFlightLoadBytes += loadBytes;
+        }
+
+        loadJob->Start();
+    }
+
+    //=========================================================================
+    // FinishLoadJob
+    //=========================================================================
+    void AssetManager::FinishLoadJob(AZ::u64 loadBytes)
+    {
+        AZStd::vector<LoadAssetJob*> jobsToStart;
+        {
+            AZStd::scoped_lock<AZStd::mutex> throttleLock(m_loadThrottleMutex);
+            m_inFlightLoadBytes -= loadBytes;
+
+            // the limit is read again, so that raising it or turning it off lets the held back loads go
+            const AZ::u64 maxInFlightBytes = aznumeric_cast<AZ::u64>(static_cast<uint32_t>(cl_assetLoadMaxInFlightMegabytes)) * 1024 * 1024;
+            while (!m_heldBackLoadJobs.empty())
+            {
+                const AZ::u64 heldBackBytes = m_heldBackLoadJobs.front().second;
+                if (maxInFlightBytes > 0 && m_inFlightLoadBytes > 0 && m_inFlightLoadBytes + heldBackBytes > maxInFlightBytes)
+                {
+                    break;
+                }
+                m_inFlightLoadBytes += heldBackBytes;
+                jobsToStart.push_back(m_heldBackLoadJobs.front().first);
+                m_heldBackLoadJobs.pop_front();
+            }
+        }
+
+        for (LoadAssetJob* loadJob : jobsToStart)
+        {
+            loadJob->Start();
+        }
+    }
+
     //=========================================================================
     // AddActiveStreamerRequest
     //=========================================================================
@@ -17,6 +17,7 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -55,6 +56,7 @@ namespace AZ
         class AssetCatalog;
         class AssetDatabaseJob;
         class WaitForAsset;
+        class LoadAssetJob;
 
         struct IDebugAssetEvent
         {
@@ -338,6 +340,10 @@ namespace AZ
             void NotifyAssetCanceled(AssetId assetId);
             void NotifyAssetContainerReady(Asset<AssetData> asset);
             void ReleaseAsset(AssetData* asset, AssetId assetId, AssetType assetType, bool removeAssetFromHash, int creationToken);
+            //! Releases the assets queued by ReleaseAsset with cl_assetDeferRelease that are still unused, removing them from the asset map under a single lock.
+            void ProcessDeferredReleases();
+            //! Destroys a released asset, after it was removed from the asset map when it was registered in it.
+            void DestroyReleasedAsset(AssetData* asset, const AssetId& assetId, const AssetType& assetType, bool wasInAssetsHash);
             void OnAssetUnused(AssetData* asset);
 
             void AddJob(AssetDatabaseJob* job);
@@ -348,6 +354,12 @@ namespace AZ
             void AddBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest);
             void RemoveBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest);
 
+            //! Starts a load job, or holds it back until enough of the data of the load jobs in flight has been processed
+            //! to stay within cl_assetLoadMaxInFlightMegabytes.
+            void StartLoadJob(LoadAssetJob* loadJob, AZ::u64 loadBytes);
+            //! Called by each finished load job started through StartLoadJob, starting the held back load jobs that fit.
+            void FinishLoadJob(AZ::u64 loadBytes);
+
             void ValidateAndPostLoad(AZ::Data::Asset < AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
             void PostLoad(AZ::Data::Asset < AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
 
@@ -437,6 +449,13 @@ namespace AZ
             // Mutex lock when accessing the list of active blocking requests
             AZStd::recursive_mutex  m_activeBlockingRequestMutex;
 
+            //! The load jobs held back to bound the memory used by the loads in flight, along with their data size.
+            AZStd::deque<AZStd::pair<LoadAssetJob*, AZ::u64>> m_heldBackLoadJobs;
+            //! The data size of the load jobs started and not finished yet.
+            AZ::u64 m_inFlightLoadBytes = 0;
+            // Mutex lock when accessing the held back load jobs or the in flight load bytes
+            AZStd::mutex m_loadThrottleMutex;
+
             //! Enable or disable parallel loading of dependent assets via the use of Asset Containers.
             //! default = true, but Asset Builders and other tools using real-time in-progress dependency information need
             //! to set it to false.
@@ -461,6 +480,17 @@ namespace AZ
             bool m_cancelAllActiveJobs = false;
 
             AZStd::atomic_int m_suspendAssetRelease{ 0 };
+
+            // Asset released with cl_assetDeferRelease, destroyed by ProcessDeferredReleases if it is still unused
+            struct DeferredRelease
+            {
+                AssetData* m_asset = nullptr;
+                AssetId m_assetId;
+                AssetType m_assetType;
+                int m_creationToken = 0;
+            };
+            AZStd::vector<DeferredRelease> m_deferredReleases;
+            AZStd::mutex m_deferredReleaseMutex; // lock when accessing the deferred releases
         };
 
         /**
@@ -404,6 +404,14 @@ namespace AZ
          */
         virtual void GetWarnings([[maybe_unused]] StringWarningArray& warnings, [[maybe_unused]] const Component* instance) const { }
 
+        /**
+         * Specifies whether the component can be activated on a worker thread, concurrently with the components of other entities.
+         * This requires that Activate() only touches the component itself, and buses and systems that are safe to use from any thread.
+         * Components are activated on the main thread by default.
+         * @return True if the component may be activated in parallel by Entity::ActivateEntities.
+         */
+        virtual bool IsActivationThreadSafe() const { return false; }
+
         /**
          * Gets the current descriptor.
          * @param instance The current descriptor.
@@ -497,6 +505,7 @@ namespace AZ
     AZ_HAS_STATIC_MEMBER(ComponentDependentServices, GetDependentServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentRequiredServices, GetRequiredServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentIncompatibleServices, GetIncompatibleServices, void, (ComponentDescriptor::DependencyArrayType &));
+    AZ_HAS_STATIC_MEMBER(ComponentActivationThreadSafe, IsActivationThreadSafe, bool, ());
     /// @endcond
 
     /**
@@ -569,6 +578,15 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * Calls the static function AZ::ComponentDescriptor::IsActivationThreadSafe, if the user provided it.
+         * @return True if the component may be activated on a worker thread.
+         */
+        bool IsActivationThreadSafe() const override
+        {
+            return CallActivationThreadSafe(typename HasComponentActivationThreadSafe<ComponentClass>::type());
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
@@ -615,5 +633,15 @@ namespace AZ
         void CallIncompatibleServices(ComponentDescriptor::DependencyArrayType&, const AZStd::false_type&) const
         {
         }
+
+        bool CallActivationThreadSafe(const AZStd::true_type&) const
+        {
+            return ComponentClass::IsActivationThreadSafe();
+        }
+
+        bool CallActivationThreadSafe(const AZStd::false_type&) const
+        {
+            return false;
+        }
     };
 }
@@ -23,6 +23,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -152,6 +153,7 @@ namespace AZ
         m_memoryBlocksByteSize = 0;
         m_reservedOS = 0;
         m_reservedDebug = 0;
+        m_frameArenaByteSize = FrameArenaAllocator::Descriptor().m_frameByteSize;
         m_recordingMode = Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE;
         m_stackRecordLevels = 5;
     }
@@ -323,6 +325,7 @@ namespace AZ
                 ->Field("blockSize", &Descriptor::m_memoryBlocksByteSize)
                 ->Field("reservedOS", &Descriptor::m_reservedOS)
                 ->Field("reservedDebug", &Descriptor::m_reservedDebug)
+                ->Field("frameArenaSize", &Descriptor::m_frameArenaByteSize)
                 ->Field("modules", &Descriptor::m_modules)
                 ;
 
@@ -358,6 +361,7 @@ namespace AZ
                         ->Attribute(Edit::Attributes::Step, &Descriptor::m_pageSize)
                     ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_reservedOS, "OS reserved memory", "System memory reserved for OS (used only when 'Allocate all memory at startup' is true)")
                     ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_reservedDebug, "Memory reserved for debugger", "System memory reserved for Debug allocator, like memory tracking (used only when 'Allocate all memory at startup' is true)")
+                    ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_frameArenaByteSize, "Frame arena size", "Memory of each frame of the FrameArenaAllocator, released every tick (0 disables the frame arena)")
                     ;
             }
         }
@@ -654,6 +658,15 @@ namespace AZ
 
         NameDictionary::Create();
 
+        if (m_descriptor.m_frameArenaByteSize > 0 && !AllocatorInstance<FrameArenaAllocator>::IsReady())
+        {
+            FrameArenaAllocator::Descriptor frameArenaDesc;
+            frameArenaDesc.m_frameByteSize = aznumeric_cast<size_t>(m_descriptor.m_frameArenaByteSize);
+            frameArenaDesc.m_threadBlockByteSize = AZStd::min(frameArenaDesc.m_threadBlockByteSize, frameArenaDesc.m_frameByteSize);
+            AllocatorInstance<FrameArenaAllocator>::Create(frameArenaDesc);
+            m_isFrameArenaAllocatorOwner = true;
+        }
+
         // Call this and child class's reflects
         ReflectionEnvironment::GetReflectionManager()->Reflect(azrtti_typeid(this), [this](ReflectContext* context) {Reflect(context); });
 
@@ -761,6 +774,12 @@ namespace AZ
 
         NameDictionary::Destroy();
 
+        if (m_isFrameArenaAllocatorOwner)
+        {
+            AllocatorInstance<FrameArenaAllocator>::Destroy();
+            m_isFrameArenaAllocatorOwner = false;
+        }
+
         m_systemEntity.reset();
 
         Sfmt::Destroy();
@@ -925,12 +944,17 @@ namespace AZ
         //!    2. <cache_root>/Registry
         //!    3. <project_build_path>/bin/$<CONFIG>/Registry
         //! 3. MergeSettingsToRegistry_GemRegistries - Merges the settings registry files from each gem's <GemRoot>/Registry directory
+        //! 4. MergeSettingsToRegistry_RegistrySnapshot - Merges the snapshot of the Engine, Gem and Project registry folders
+        //!    compiled by the Asset Processor instead of the individual folders, as long as the snapshot is up to date
 
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
             AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        if (!SettingsRegistryMergeUtils::MergeSettingsToRegistry_RegistrySnapshot(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer))
+        {
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        }
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_O3deUserRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, false);
@@ -1333,11 +1357,23 @@ namespace AZ
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        if (m_isFrameArenaAllocatorOwner)
+        {
+            // Memory allocated from the frame arena during the previous ticks is released here
+            static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).NextFrame();
+        }
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
         }
 
+        if (m_console)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:DispatchCvarChanges");
+            m_console->DispatchCvarChanges();
+        }
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:OnTick");
             const AZ::TimeUs deltaTimeUs = m_timeSystem->AdvanceTickDeltaTimes();
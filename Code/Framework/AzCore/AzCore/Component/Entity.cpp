@@ -14,7 +14,10 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/NamedEntityId.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Casting/lossy_cast.h>
 
@@ -27,6 +30,9 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Platform.h>
@@ -35,6 +41,11 @@
 
 namespace AZ
 {
+    AZ_CVAR(bool, az_componentDependencySortCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Reuses the activation order of the components of entities that have the same components, like the entities spawned from the same prefab");
+    AZ_CVAR(uint32_t, az_componentDependencySortCacheMaxEntries, 4096, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of component sets whose activation order is cached, the cache is emptied when exceeding it");
+
     class SerializeEntityFactory
         : public SerializeContext::IObjectFactory
     {
@@ -191,22 +202,108 @@ namespace AZ
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
+        if (!BeginActivation())
+        {
+            return;
+        }
+
+        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
+        {
+            ActivateComponent(**it);
+        }
+
+        EndActivation();
+    }
+
+    void Entity::ActivateEntities(const AZStd::vector<Entity*>& entities)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        struct EntityActivation
+        {
+            Entity* m_entity = nullptr;
+            size_t m_firstMainThreadComponent = 0; //!< The components before it in activation order are activated in parallel
+        };
+        AZStd::vector<EntityActivation> activations;
+        AZStd::vector<Component*> parallelComponents;
+        activations.reserve(entities.size());
+
+        for (Entity* entity : entities)
+        {
+            // Entity types that customize their activation are activated on their own
+            if (azrtti_typeid(entity) != azrtti_typeid<Entity>())
+            {
+                entity->Activate();
+                continue;
+            }
+
+            if (!entity->BeginActivation())
+            {
+                continue;
+            }
+
+            // Only the leading components in activation order can run early on a worker thread, since everything the
+            // components after a main thread component depend on must be active before them
+            EntityActivation& activation = activations.emplace_back();
+            activation.m_entity = entity;
+            for (Component* component : entity->m_components)
+            {
+                ComponentDescriptor* descriptor = nullptr;
+                ComponentDescriptorBus::EventResult(descriptor, azrtti_typeid(component), &ComponentDescriptorBus::Events::GetDescriptor);
+                if (!descriptor || !descriptor->IsActivationThreadSafe())
+                {
+                    break;
+                }
+                parallelComponents.push_back(component);
+                ++activation.m_firstMainThreadComponent;
+            }
+        }
+
+        if (parallelComponents.size() > 1 && JobContext::GetGlobalContext())
+        {
+            AZ::parallel_for(size_t{ 0 }, parallelComponents.size(),
+                [&parallelComponents](size_t index)
+                {
+                    ActivateComponent(*parallelComponents[index]);
+                });
+        }
+        else
+        {
+            for (Component* component : parallelComponents)
+            {
+                ActivateComponent(*component);
+            }
+        }
+
+        for (const EntityActivation& activation : activations)
+        {
+            ComponentArrayType& components = activation.m_entity->m_components;
+            for (size_t index = activation.m_firstMainThreadComponent; index < components.size(); ++index)
+            {
+                ActivateComponent(*components[index]);
+            }
+
+            activation.m_entity->EndActivation();
+        }
+    }
+
+    bool Entity::BeginActivation()
+    {
         AZ_Assert(m_state == State::Init, "Entity should be in Init state to be Activated!");
 
         const DependencySortOutcome sortOutcome = EvaluateDependenciesGetDetails();
         if (!sortOutcome.IsSuccess())
         {
             AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", m_name.c_str(), m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
-            return;
+            return false;
         }
 
         SetState(State::Activating);
+        return true;
+    }
 
-        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
-        {
-            ActivateComponent(**it);
-        }
-
+    void Entity::EndActivation()
+    {
         SetState(State::Active);
 
         EBUS_EVENT_ID(m_id, EntityBus, OnEntityActivated, m_id);
@@ -248,14 +345,134 @@ namespace AZ
         return outcome.IsSuccess() ? DependencySortResult::Success : outcome.GetError().m_code;
     }
 
+    namespace DependencySortCache
+    {
+        //! The order of a set of components that got successfully sorted.
+        //! The set is identified by the type and the id of its components in their unsorted order, which entities cloned
+        //! from the same prototype share, so that only the first of them pays for DependencySort.
+        struct Entry
+        {
+            AZStd::vector<AZStd::pair<TypeId, ComponentId>> m_components;
+            AZStd::vector<u32> m_sortedIndices; //!< Index in m_components of each component in the sorted order
+        };
+
+        struct Cache
+        {
+            AZStd::mutex m_mutex;
+            AZStd::flat_hash_map<size_t, Entry> m_entries;
+        };
+
+        static Cache& GetCache()
+        {
+            static Cache cache;
+            return cache;
+        }
+
+        //! Returns false when a component is null, since DependencySort drops those.
+        static bool MakeKey(const Entity::ComponentArrayType& components, size_t& outHash)
+        {
+            outHash = components.size();
+            for (const Component* component : components)
+            {
+                if (!component)
+                {
+                    return false;
+                }
+                AZStd::hash_combine(outHash, azrtti_typeid(component), component->GetId());
+            }
+            return true;
+        }
+
+        static bool Matches(const Entry& entry, const Entity::ComponentArrayType& components)
+        {
+            if (entry.m_components.size() != components.size())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                if (entry.m_components[i].first != azrtti_typeid(components[i]) || entry.m_components[i].second != components[i]->GetId())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //! Reorders the components with the cached order of their set, returns false if the set isn't cached.
+        static bool Apply(size_t hash, Entity::ComponentArrayType& inOutComponents)
+        {
+            Cache& cache = GetCache();
+            AZStd::scoped_lock lock(cache.m_mutex);
+            auto entryIt = cache.m_entries.find(hash);
+            if (entryIt == cache.m_entries.end() || !Matches(entryIt->second, inOutComponents))
+            {
+                return false;
+            }
+
+            Entity::ComponentArrayType unsortedComponents = inOutComponents;
+            for (size_t i = 0; i < unsortedComponents.size(); ++i)
+            {
+                inOutComponents[i] = unsortedComponents[entryIt->second.m_sortedIndices[i]];
+            }
+            return true;
+        }
+
+        static void Store(size_t hash, const Entity::ComponentArrayType& unsortedComponents, const Entity::ComponentArrayType& sortedComponents)
+        {
+            Entry entry;
+            entry.m_components.reserve(unsortedComponents.size());
+            for (const Component* component : unsortedComponents)
+            {
+                entry.m_components.emplace_back(azrtti_typeid(component), component->GetId());
+            }
+            entry.m_sortedIndices.reserve(sortedComponents.size());
+            for (const Component* component : sortedComponents)
+            {
+                auto it = AZStd::find(unsortedComponents.begin(), unsortedComponents.end(), component);
+                entry.m_sortedIndices.push_back(aznumeric_cast<u32>(it - unsortedComponents.begin()));
+            }
+
+            Cache& cache = GetCache();
+            AZStd::scoped_lock lock(cache.m_mutex);
+            if (cache.m_entries.size() >= static_cast<uint32_t>(az_componentDependencySortCacheMaxEntries))
+            {
+                cache.m_entries.clear();
+            }
+            cache.m_entries[hash] = AZStd::move(entry);
+        }
+
+        static void Remove(size_t hash)
+        {
+            Cache& cache = GetCache();
+            AZStd::scoped_lock lock(cache.m_mutex);
+            cache.m_entries.erase(hash);
+        }
+    } // namespace DependencySortCache
+
     Entity::DependencySortOutcome Entity::EvaluateDependenciesGetDetails()
     {
         DependencySortOutcome outcome = AZ::Success();
 
         if (!m_isDependencyReady)
         {
+            size_t hash = 0;
+            const bool useCache = az_componentDependencySortCache && DependencySortCache::MakeKey(m_components, hash);
+            if (useCache && DependencySortCache::Apply(hash, m_components))
+            {
+                m_isDependencyReady = true;
+                return outcome;
+            }
+
+            const ComponentArrayType unsortedComponents = useCache ? m_components : ComponentArrayType();
             outcome = DependencySort(m_components);
             m_isDependencyReady = outcome.IsSuccess();
+
+            // The sort only fails in setups that need to be fixed, so only the successful orders are worth caching
+            if (useCache && m_isDependencyReady && m_components.size() == unsortedComponents.size())
+            {
+                DependencySortCache::Store(hash, unsortedComponents, m_components);
+            }
         }
 
         return outcome;
@@ -264,6 +481,13 @@ namespace AZ
     void Entity::InvalidateDependencies()
     {
         m_isDependencyReady = false;
+
+        // An explicit invalidation means that the services of the components may have changed, so their cached order is stale
+        size_t hash = 0;
+        if (DependencySortCache::MakeKey(m_components, hash))
+        {
+            DependencySortCache::Remove(hash);
+        }
     }
 
     void Entity::SetRuntimeActiveByDefault(bool activeByDefault)
@@ -341,7 +565,7 @@ namespace AZ
             component->Init();
         }
 
-        InvalidateDependencies(); // We need to re-evaluate dependencies
+        m_isDependencyReady = false; // We need to re-evaluate dependencies
         return true;
     }
 
@@ -482,7 +706,7 @@ namespace AZ
         m_components.erase(it);
         component->SetEntity(nullptr);
 
-        InvalidateDependencies(); // We need to re-evaluate dependencies.
+        m_isDependencyReady = false; // We need to re-evaluate dependencies
         return true;
     }
 
@@ -520,7 +744,7 @@ namespace AZ
             componentToAdd->Init();
         }
 
-        InvalidateDependencies(); // We need to re-evaluate dependencies
+        m_isDependencyReady = false; // We need to re-evaluate dependencies
         return true;
     }
 
@@ -1059,10 +1283,10 @@ namespace AZ
         AZStd::vector<ComponentInfo> componentInfos;
 
         // All incompatible services
-        AZStd::unordered_map<ComponentServiceType, IncompatibleServiceInfo> incompatibleServiceInfos;
+        AZStd::flat_hash_map<ComponentServiceType, IncompatibleServiceInfo> incompatibleServiceInfos;
 
         // Info about each provided services
-        AZStd::unordered_map<ComponentServiceType, ProvidedServiceInfo> providedServiceInfos;
+        AZStd::flat_hash_map<ComponentServiceType, ProvidedServiceInfo> providedServiceInfos;
 
         // Buffer to hold nodes for multiple linked lists.
         // These lists represent the components that depend upon particular services.
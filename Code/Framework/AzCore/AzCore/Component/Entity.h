@@ -168,6 +168,13 @@ namespace AZ
         //! of each component.
         virtual void Activate();
 
+        //! Activates a batch of entities in the Init state.
+        //! The components whose descriptors report them safe to activate on any thread (see ComponentDescriptor::IsActivationThreadSafe)
+        //! and that precede all the main thread components of their entity in activation order are activated in parallel first.
+        //! The remaining components are then activated on the calling thread, entity by entity in the order of the batch.
+        //! @param entities The entities to activate, they must not depend on one another during activation.
+        static void ActivateEntities(const AZStd::vector<Entity*>& entities);
+
         //! Deactivates the entity and its components.
         //! This function can be called multiple times throughout the lifetime of an
         //! entity. This function calls the Deactivate function of each component.
@@ -317,6 +324,8 @@ namespace AZ
         //! Indicates to the entity that dependencies among its components need
         //! to be evaluated.
         //! Dependencies will be evaluated the next time the entity is activated.
+        //! Call it when the services of a component changed, so that the cached order of the
+        //! components of the entity is discarded as well.
         void InvalidateDependencies();
 
         //! Contains a failed DependencySortResult code and a detailed message that can be presented to users.
@@ -333,6 +342,8 @@ namespace AZ
         //! among components. If all dependencies are met, the required services can be
         //! activated before the components that depend on them. An entity will not be
         //! activated unless the sort succeeds.
+        //! Entities with the same components, identified by their types and ids, reuse the
+        //! order of the first of them that got sorted (see az_componentDependencySortCache).
         //! @return A successful outcome is returned if the entity can
         //! determine an order in which to activate its components.
         //! Otherwise the failed outcome contains details on why the sort failed.
@@ -383,6 +394,13 @@ namespace AZ
         bool IsComponentReadyToAdd(const Uuid& componentTypeId, const Component* instance, ComponentDescriptor::DependencyArrayType* servicesNeededToBeAdded, ComponentArrayType* incompatibleComponents);
         /// @endcond
 
+        //! Sorts the components and moves the entity to the Activating state.
+        //! @return False if the components can't be activated.
+        bool BeginActivation();
+
+        //! Moves the entity to the Active state once its components are active, and signals its activation.
+        void EndActivation();
+
         //! Sets the entities internal state to the provided value.
         //! @param state the new state for the entity.
         void SetState(State state);
@@ -358,6 +358,7 @@ namespace AZ
                 m_commands.erase(iter);
             }
         }
+        DequeueCvarChange(functor);
         functor->Unlink(m_head);
         functor->m_console = nullptr;
     }
@@ -378,10 +379,79 @@ namespace AZ
         deferredHead = nullptr;
     }
 
+    bool Console::QueueCvarChange(ConsoleFunctorBase* functor)
+    {
+        if (functor->m_console != this)
+        {
+            return false;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_cvarChangesMutex);
+        if (!functor->m_isValueChangeQueued)
+        {
+            functor->m_isValueChangeQueued = true;
+            m_queuedCvarChanges.emplace_back(functor);
+        }
+        return true;
+    }
+
+    void Console::DispatchCvarChanges()
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_cvarChangesMutex);
+            if (m_queuedCvarChanges.empty())
+            {
+                return;
+            }
+
+            // Changes made from now on, including by the callbacks below, are dispatched by the next call
+            m_dispatchedCvarChanges.swap(m_queuedCvarChanges);
+            for (ConsoleFunctorBase* functor : m_dispatchedCvarChanges)
+            {
+                functor->m_isValueChangeQueued = false;
+            }
+        }
+
+        // A callback can destroy a functor, which removes it from the dispatched changes
+        for (size_t index = 0; index < m_dispatchedCvarChanges.size(); ++index)
+        {
+            if (ConsoleFunctorBase* functor = m_dispatchedCvarChanges[index])
+            {
+                functor->DispatchValueChange();
+            }
+        }
+        m_dispatchedCvarChanges.erase(
+            AZStd::remove(m_dispatchedCvarChanges.begin(), m_dispatchedCvarChanges.end(), nullptr), m_dispatchedCvarChanges.end());
+
+        m_cvarsChangedEvent.Signal(AZStd::span<ConsoleFunctorBase* const>(m_dispatchedCvarChanges.data(), m_dispatchedCvarChanges.size()));
+        m_dispatchedCvarChanges.clear();
+    }
+
+    void Console::DequeueCvarChange(ConsoleFunctorBase* functor)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_cvarChangesMutex);
+        if (functor->m_isValueChangeQueued)
+        {
+            functor->m_isValueChangeQueued = false;
+            m_queuedCvarChanges.erase(AZStd::remove(m_queuedCvarChanges.begin(), m_queuedCvarChanges.end(), functor), m_queuedCvarChanges.end());
+        }
+        AZStd::replace(m_dispatchedCvarChanges.begin(), m_dispatchedCvarChanges.end(), functor, static_cast<ConsoleFunctorBase*>(nullptr));
+    }
+
     void Console::MoveFunctorsToDeferredHead(ConsoleFunctorBase*& deferredHead)
     {
         m_commands.clear();
 
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_cvarChangesMutex);
+            for (ConsoleFunctorBase* functor : m_queuedCvarChanges)
+            {
+                functor->m_isValueChangeQueued = false;
+            }
+            m_queuedCvarChanges.clear();
+            m_dispatchedCvarChanges.clear();
+        }
+
         // Re-initialize all of the current functors to a deferred state
         for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
         {
@@ -13,6 +13,7 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -71,6 +72,8 @@ namespace AZ
         void RegisterFunctor(ConsoleFunctorBase* functor) override;
         void UnregisterFunctor(ConsoleFunctorBase* functor) override;
         void LinkDeferredFunctors(ConsoleFunctorBase*& deferredHead) override;
+        bool QueueCvarChange(ConsoleFunctorBase* functor) override;
+        void DispatchCvarChanges() override;
         void RegisterCommandInvokerWithSettingsRegistry(AZ::SettingsRegistryInterface& settingsRegistry) override;
         //! @}
 
@@ -78,6 +81,9 @@ namespace AZ
 
         void MoveFunctorsToDeferredHead(ConsoleFunctorBase*& deferredHead);
 
+        //! Removes a functor from the queued and the dispatching cvar changes.
+        void DequeueCvarChange(ConsoleFunctorBase* functor);
+
         //! Invokes a single console command, optionally returning the command output.
         //! @param command       the function to invoke
         //! @param inputs        the set of inputs to provide the function
@@ -115,6 +121,10 @@ namespace AZ
         using DeferredCommandQueue = AZStd::deque<DeferredCommand>;
         DeferredCommandQueue m_deferredCommands;
 
+        AZStd::mutex m_cvarChangesMutex;
+        AZStd::vector<ConsoleFunctorBase*> m_queuedCvarChanges;
+        AZStd::vector<ConsoleFunctorBase*> m_dispatchedCvarChanges;
+
         friend struct ConsoleCommandKeyNotificationHandler;
         friend class ConsoleFunctorBase;
     };
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <AzCore/Console/ConsoleFunctor.h>
 #include <AzCore/Threading/ThreadSafeObject.h>
+#include <AzCore/Threading/ThreadSafeSnapshot.h>
 
 namespace AZ
 {
@@ -18,6 +19,7 @@ namespace AZ
     {
         RequiresLock
     ,   UseStdAtomic
+    ,   LockFreeSnapshot
     };
 
     //! @class ConsoleDataContainer
@@ -29,6 +31,11 @@ namespace AZ
     class ConsoleDataContainer<BASE_TYPE, ThreadSafety::RequiresLock>
     {
     protected:
+        explicit ConsoleDataContainer(const BASE_TYPE& value)
+        {
+            m_value = value;
+        }
+
         ThreadSafeObject<BASE_TYPE> m_value;
     };
 
@@ -36,9 +43,37 @@ namespace AZ
     class ConsoleDataContainer<BASE_TYPE, ThreadSafety::UseStdAtomic>
     {
     protected:
+        explicit ConsoleDataContainer(const BASE_TYPE& value)
+        {
+            m_value = value;
+        }
+
         std::atomic<BASE_TYPE> m_value;
     };
 
+    //! Lock-free reads of an immutable snapshot of the value, the snapshots replaced by a change are released
+    //! once the console has dispatched the changes twice, see IConsole::DispatchCvarChanges.
+    template <typename BASE_TYPE>
+    class ConsoleDataContainer<BASE_TYPE, ThreadSafety::LockFreeSnapshot>
+    {
+    public:
+        //! Returns the current value without copying it, for hot loops.
+        //! The reference must not be kept beyond the current frame.
+        //! @return reference to the current snapshot of the value
+        const BASE_TYPE& GetSnapshot() const
+        {
+            return m_value.Get();
+        }
+
+    protected:
+        explicit ConsoleDataContainer(const BASE_TYPE& value)
+            : m_value(value)
+        {
+        }
+
+        ThreadSafeSnapshot<BASE_TYPE> m_value;
+    };
+
     //! @class ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>
     //! Data wrapper class for console variables.
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
@@ -115,6 +150,9 @@ namespace AZ
         //! Invokes bound callback on the wrapped BaseType value.
         void InvokeCallback() const;
 
+        //! Invoked by the console when it dispatches the changes of this frame, see IConsole::DispatchCvarChanges.
+        void DispatchValueChange();
+
         //! Cvar functor, reads data contained in arguments to set the console variable value.
         //! @param arguments StringSet instance to read new values from
         void CvarFunctor(const ConsoleCommandContainer& arguments);
@@ -123,6 +161,9 @@ namespace AZ
 
         ConsoleDataWrapper& operator =(const ConsoleDataWrapper&) = delete;
 
+        //! Queues the change for the next dispatch of the console, and invokes the callback now unless it is deferred.
+        void OnValueChanged();
+
         CallbackFunc m_callback;
         ConsoleFunctor<SelfType, true> m_functor;
     };
@@ -23,10 +23,11 @@ namespace AZ
         const char* desc,
         ConsoleFunctorFlags flags
     )
-        : m_callback(callback)
+        : ConsoleDataContainer<BASE_TYPE, THREAD_SAFETY>(value)
+        , m_callback(callback)
         , m_functor(name, desc, flags, AzTypeInfo<BASE_TYPE>::Uuid(), *this, &ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::CvarFunctor)
     {
-        this->m_value = value;
+        ;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
@@ -40,7 +41,7 @@ namespace AZ
         this->m_value = rhs;
         if (currentValue != rhs)
         {
-            InvokeCallback();
+            OnValueChanged();
         }
     }
 
@@ -104,7 +105,7 @@ namespace AZ
             if (newValue != currentValue)
             {
                 this->m_value = newValue;
-                InvokeCallback();
+                OnValueChanged();
             }
 
             return true;
@@ -130,6 +131,31 @@ namespace AZ
         }
     }
 
+    template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
+    inline void ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::DispatchValueChange()
+    {
+        if constexpr (THREAD_SAFETY == ThreadSafety::LockFreeSnapshot)
+        {
+            this->m_value.ReclaimRetired();
+        }
+
+        if ((m_functor.GetFlags() & ConsoleFunctorFlags::DeferCallback) != ConsoleFunctorFlags::Null)
+        {
+            InvokeCallback();
+        }
+    }
+
+    template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
+    inline void ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::OnValueChanged()
+    {
+        // Without a console to dispatch the change, a deferred callback is invoked right away
+        const bool queued = m_functor.QueueValueChange();
+        if (!queued || (m_functor.GetFlags() & ConsoleFunctorFlags::DeferCallback) == ConsoleFunctorFlags::Null)
+        {
+            InvokeCallback();
+        }
+    }
+
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline void ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::CvarFunctor(const ConsoleCommandContainer& arguments)
     {
@@ -168,6 +168,15 @@ namespace AZ
         }
     }
 
+    bool ConsoleFunctorBase::QueueValueChange()
+    {
+        return (m_console != nullptr) && m_console->QueueCvarChange(this);
+    }
+
+    void ConsoleFunctorBase::DispatchValueChange()
+    {
+    }
+
     GetValueResult ConsoleFunctorBase::GetValueAsString(CVarFixedString&) const
     {
         return GetValueResult::NotImplemented;
@@ -91,6 +91,13 @@ namespace AZ
         template <typename RETURN_TYPE>
         GetValueResult GetValue(RETURN_TYPE& outResult) const;
 
+        //! Queues a change of the value of this functor for the next IConsole::DispatchCvarChanges call.
+        //! @return boolean true if the change was queued, false if the functor is not registered with a console
+        bool QueueValueChange();
+
+        //! Invoked by the console for the functors with a queued value change, see IConsole::DispatchCvarChanges.
+        virtual void DispatchValueChange();
+
         //! Used internally to link cvars and functors from various modules to the console as they are loaded.
         static ConsoleFunctorBase*& GetDeferredHead();
 
@@ -112,6 +119,7 @@ namespace AZ
         ConsoleFunctorBase* m_next = nullptr;
 
         bool m_isDeferred = true;
+        bool m_isValueChangeQueued = false;
 
         static ConsoleFunctorBase* s_deferredHead;
         static bool s_deferredHeadInvoked;
@@ -150,6 +158,7 @@ namespace AZ
         //! @{
         void operator()(const ConsoleCommandContainer& arguments) override;
         bool GetReplicationString(CVarFixedString& outString) const override;
+        void DispatchValueChange() override;
         //! @}
 
         //! Returns reference typed stored type wrapped stored by ConsoleFunctor.
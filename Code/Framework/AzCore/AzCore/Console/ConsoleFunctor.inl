@@ -121,6 +121,10 @@ namespace AZ
         {
             return false;
         }
+
+        static void DispatchValueChange(_TYPE&)
+        {
+        }
     };
 
     template <typename _TYPE>
@@ -143,6 +147,11 @@ namespace AZ
         {
             instance.ValueToString(outString);
         }
+
+        static void DispatchValueChange(_TYPE& instance)
+        {
+            instance.DispatchValueChange();
+        }
     };
 
     template <typename _TYPE, bool _REPLICATES_VALUE>
@@ -151,6 +160,12 @@ namespace AZ
         return ConsoleReplicateHelper<_TYPE, _REPLICATES_VALUE>::GetReplicationString(*m_object, GetName(), outString);
     }
 
+    template <typename _TYPE, bool _REPLICATES_VALUE>
+    inline void ConsoleFunctor<_TYPE, _REPLICATES_VALUE>::DispatchValueChange()
+    {
+        ConsoleReplicateHelper<_TYPE, _REPLICATES_VALUE>::DispatchValueChange(*m_object);
+    }
+
     template <typename _TYPE, bool _REPLICATES_VALUE>
     inline _TYPE& ConsoleFunctor<_TYPE, _REPLICATES_VALUE>::GetValue()
     {
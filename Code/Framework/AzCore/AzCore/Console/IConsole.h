@@ -13,6 +13,7 @@
 #include <AzCore/Console/IConsoleTypes.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 
@@ -144,6 +145,18 @@ namespace AZ
         //! @param pointer to the modules set of ConsoleFunctors to register
         virtual void LinkDeferredFunctors(ConsoleFunctorBase*& deferredHead) = 0;
 
+        //! Queues a change of value of a registered cvar until the next DispatchCvarChanges call, this is thread safe.
+        //! A cvar changed several times is only queued once.
+        //! @param functor pointer to the ConsoleFunctor of the changed cvar
+        //! @return boolean true if the change was queued, false if the functor is not registered with this console
+        virtual bool QueueCvarChange(ConsoleFunctorBase* functor) = 0;
+
+        //! Dispatches the cvar changes queued since the previous call, should be invoked once per frame
+        //! from the main thread. This invokes the callbacks of the cvars using ConsoleFunctorFlags::DeferCallback,
+        //! releases the values replaced by the changes before the previous call, then signals the CvarsChangedEvent
+        //! once with all the changed cvars.
+        virtual void DispatchCvarChanges() = 0;
+
         //! Returns the AZ::Event<> invoked whenever a console command is registered.
         using ConsoleCommandRegisteredEvent = AZ::Event<ConsoleFunctorBase*>;
         ConsoleCommandRegisteredEvent& GetConsoleCommandRegisteredEvent();
@@ -154,6 +167,11 @@ namespace AZ
         //! Returns the AZ::Event<> invoked whenever a console command could not be found.
         DispatchCommandNotFoundEvent& GetDispatchCommandNotFoundEvent();
 
+        //! Returns the AZ::Event<> invoked once per DispatchCvarChanges call with all the cvars changed since the previous call.
+        //! The functor pointers are only valid during the event.
+        using CvarsChangedEvent = AZ::Event<AZStd::span<ConsoleFunctorBase* const>>;
+        CvarsChangedEvent& GetCvarsChangedEvent();
+
         //! Register a notification event handler with the Settings Registry
         //! That is responsible for updating console commands whenever
         //! a key is found underneath the "/Amazon/AzCore/Runtime/ConsoleCommands" JSON entry
@@ -167,6 +185,7 @@ namespace AZ
         ConsoleCommandRegisteredEvent m_consoleCommandRegisteredEvent;
         ConsoleCommandInvokedEvent m_consoleCommandInvokedEvent;
         DispatchCommandNotFoundEvent m_dispatchCommandNotFoundEvent;
+        CvarsChangedEvent m_cvarsChangedEvent;
     };
 
     inline auto IConsole::GetConsoleCommandRegisteredEvent() -> ConsoleCommandRegisteredEvent&
@@ -184,6 +203,11 @@ namespace AZ
         return m_dispatchCommandNotFoundEvent;
     }
 
+    inline auto IConsole::GetCvarsChangedEvent() -> CvarsChangedEvent&
+    {
+        return m_cvarsChangedEvent;
+    }
+
     template<typename RETURN_TYPE>
     inline GetValueResult IConsole::GetCvarValue(AZStd::string_view command, RETURN_TYPE& outValue)
     {
@@ -197,7 +221,7 @@ namespace AZ
 }
 
 template <typename _TYPE, typename = void>
-static constexpr AZ::ThreadSafety ConsoleThreadSafety = AZ::ThreadSafety::RequiresLock;
+static constexpr AZ::ThreadSafety ConsoleThreadSafety = AZ::ThreadSafety::LockFreeSnapshot;
 
 template <typename _TYPE>
 static constexpr AZ::ThreadSafety ConsoleThreadSafety<_TYPE, std::enable_if_t<std::is_arithmetic_v<_TYPE>>> = AZ::ThreadSafety::UseStdAtomic;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
+#include <AzCore/DOM/Backends/JSON/JsonStructuralParser.h>
 #include <AzCore/DOM/DomBackend.h>
 #include <AzCore/IO/ByteContainerStream.h>
 
@@ -17,20 +18,37 @@ namespace AZ::Dom
     //! A DOM backend for serializing and deserializing JSON <=> UTF-8 text
     //! \param ParseFlags Controls how deserialized JSON is parsed.
     //! \param WriteFormat Controls how serialized JSON is formatted.
+    //! \param Parser Controls which parser is used to read deserialized JSON.
     template<
         Json::ParseFlags ParseFlags = Json::ParseFlags::ParseComments,
-        Json::OutputFormatting WriteFormat = Json::OutputFormatting::PrettyPrintedJson>
+        Json::OutputFormatting WriteFormat = Json::OutputFormatting::PrettyPrintedJson,
+        Json::ParserType Parser = Json::ParserType::RapidJson>
     class JsonBackend final : public Backend
     {
     public:
         Visitor::Result ReadFromBuffer(const char* buffer, size_t size, AZ::Dom::Lifetime lifetime, Visitor& visitor) override
         {
-            return Json::VisitSerializedJson<ParseFlags>({ buffer, size }, lifetime, visitor);
+            if constexpr (Parser == Json::ParserType::StructuralIndex)
+            {
+                return Json::VisitSerializedJsonStructural({ buffer, size }, lifetime, visitor, ParseFlags);
+            }
+            else
+            {
+                return Json::VisitSerializedJson<ParseFlags>({ buffer, size }, lifetime, visitor);
+            }
         }
 
         Visitor::Result ReadFromBufferInPlace(char* buffer, [[maybe_unused]] AZStd::optional<size_t> size, Visitor& visitor) override
         {
-            return Json::VisitSerializedJsonInPlace<ParseFlags>(buffer, visitor);
+            if constexpr (Parser == Json::ParserType::StructuralIndex)
+            {
+                return Json::VisitSerializedJsonStructuralInPlace(
+                    buffer, size.has_value() ? size.value() : strlen(buffer), visitor, ParseFlags);
+            }
+            else
+            {
+                return Json::VisitSerializedJsonInPlace<ParseFlags>(buffer, visitor);
+            }
         }
 
         Visitor::Result WriteToBuffer(AZStd::string& buffer, WriteCallback callback)
@@ -0,0 +1,854 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/DOM/Backends/JSON/JsonStructuralParser.h>
+
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace AZ::Dom::Json
+{
+    namespace StructuralInternal
+    {
+        constexpr size_t BlockSize = 16;
+
+        //! Character classes used to build the structural index.
+        enum CharClass : AZ::u8
+        {
+            ClassNone = 0,
+            ClassStructural = 1 << 0, //!< One of {}[]:,
+            ClassQuote = 1 << 1,
+            ClassBackslash = 1 << 2,
+            ClassComment = 1 << 3, //!< One of /*\n, only relevant if comments are allowed.
+        };
+
+        constexpr AZStd::array<AZ::u8, 256> CreateCharClassTable()
+        {
+            AZStd::array<AZ::u8, 256> table{};
+            table['{'] = ClassStructural;
+            table['}'] = ClassStructural;
+            table['['] = ClassStructural;
+            table[']'] = ClassStructural;
+            table[':'] = ClassStructural;
+            table[','] = ClassStructural;
+            table['"'] = ClassQuote;
+            table['\\'] = ClassBackslash;
+            table['/'] = ClassComment;
+            table['*'] = ClassComment;
+            table['\n'] = ClassComment;
+            return table;
+        }
+
+        constexpr AZStd::array<AZ::u8, 256> CharClassTable = CreateCharClassTable();
+
+        //! Returns a bit mask with a bit set for every character in the block that's relevant for building the index.
+        AZ_FORCE_INLINE AZ::u32 ClassifyBlock(const char* block, bool allowComments)
+        {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+            __m128i matches = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('{')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('}'))),
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('[')), _mm_cmpeq_epi8(chars, _mm_set1_epi8(']'))));
+            matches = _mm_or_si128(
+                matches,
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(':')), _mm_cmpeq_epi8(chars, _mm_set1_epi8(','))));
+            matches = _mm_or_si128(
+                matches,
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))));
+            if (allowComments)
+            {
+                matches = _mm_or_si128(
+                    matches,
+                    _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('/')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('*'))),
+                        _mm_cmpeq_epi8(chars, _mm_set1_epi8('\n'))));
+            }
+            return static_cast<AZ::u32>(_mm_movemask_epi8(matches));
+#else
+            const AZ::u8 relevantClasses = ClassStructural | ClassQuote | ClassBackslash | (allowComments ? ClassComment : ClassNone);
+            AZ::u32 mask = 0;
+            for (size_t i = 0; i < BlockSize; ++i)
+            {
+                if (CharClassTable[static_cast<AZ::u8>(block[i])] & relevantClasses)
+                {
+                    mask |= 1u << i;
+                }
+            }
+            return mask;
+#endif
+        }
+
+        //! Walks the structural index and calls the visitor for every value in the document.
+        class StructuralParser
+        {
+        public:
+            StructuralParser(
+                const char* buffer, size_t size, char* mutableBuffer, Lifetime lifetime, Visitor& visitor, ParseFlags parseFlags,
+                const AZStd::vector<AZ::u32>& positions)
+                : m_buffer(buffer)
+                , m_size(size)
+                , m_mutableBuffer(mutableBuffer)
+                , m_lifetime(lifetime)
+                , m_visitor(visitor)
+                , m_positions(positions)
+                , m_allowComments((parseFlags & ParseFlags::ParseComments) != ParseFlags::Null)
+                , m_allowTrailingCommas((parseFlags & ParseFlags::ParseTrailingCommas) != ParseFlags::Null)
+                , m_allowNanAndInfinity((parseFlags & ParseFlags::ParseNanAndInfinity) != ParseFlags::Null)
+                , m_allowEscapedApostrophes((parseFlags & ParseFlags::ParseEscapedApostrophies) != ParseFlags::Null)
+                , m_stopWhenDone((parseFlags & ParseFlags::StopWhenDone) != ParseFlags::Null)
+            {
+            }
+
+            Visitor::Result Parse();
+
+        private:
+            struct Frame
+            {
+                AZ::u64 m_entryCount;
+                bool m_isObject;
+            };
+
+            Visitor::Result ParseMemberKey(size_t& pos);
+            Visitor::Result ParseString(size_t& pos, AZStd::string_view& result, Lifetime& lifetime);
+            Visitor::Result ParseScalar(size_t& pos);
+            Visitor::Result ParseNumber(AZStd::string_view token);
+            Visitor::Result OpenContainer(size_t& pos, bool isObject, bool& isEmpty);
+            Visitor::Result CloseContainer();
+            bool DecodeEscapes(const char* begin, const char* end, char* output, size_t& outputSize) const;
+
+            size_t SkipWhitespace(size_t pos) const;
+            //! Consumes the next structural character in the index if it's located at pos.
+            bool TakeStructural(size_t pos);
+            bool IsStructuralAt(size_t pos, char structural) const;
+            void CompleteValue();
+
+            Visitor::Result Error(size_t pos, const char* message) const;
+
+            const char* m_buffer;
+            size_t m_size;
+            char* m_mutableBuffer;
+            Lifetime m_lifetime;
+            Visitor& m_visitor;
+            const AZStd::vector<AZ::u32>& m_positions;
+            size_t m_nextPosition = 0;
+            AZStd::vector<Frame> m_stack;
+            AZStd::string m_scratch;
+            bool m_allowComments;
+            bool m_allowTrailingCommas;
+            bool m_allowNanAndInfinity;
+            bool m_allowEscapedApostrophes;
+            bool m_stopWhenDone;
+        };
+
+        Visitor::Result StructuralParser::Parse()
+        {
+            size_t pos = SkipWhitespace(0);
+            bool expectingValue = true;
+            while (true)
+            {
+                if (expectingValue)
+                {
+                    if (pos >= m_size)
+                    {
+                        return Error(pos, "Unexpected end of document, expected a value");
+                    }
+
+                    Visitor::Result result = AZ::Success();
+                    const char c = m_buffer[pos];
+                    if ((c == '{' || c == '[') && TakeStructural(pos))
+                    {
+                        const bool isObject = c == '{';
+                        bool isEmpty = false;
+                        result = OpenContainer(pos, isObject, isEmpty);
+                        // Non-empty objects start with a key, arrays directly with the first value.
+                        expectingValue = !isEmpty;
+                        if (result.IsSuccess() && isObject && !isEmpty)
+                        {
+                            result = ParseMemberKey(pos);
+                        }
+                    }
+                    else if (c == '"' && TakeStructural(pos))
+                    {
+                        AZStd::string_view value;
+                        Lifetime lifetime;
+                        result = ParseString(pos, value, lifetime);
+                        if (result.IsSuccess())
+                        {
+                            result = m_visitor.String(value, lifetime);
+                        }
+                        CompleteValue();
+                        expectingValue = false;
+                    }
+                    else
+                    {
+                        result = ParseScalar(pos);
+                        CompleteValue();
+                        expectingValue = false;
+                    }
+
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+                    continue;
+                }
+
+                // A value was completed, so this is either the end of the document, a separator or the end of a container.
+                if (m_stack.empty())
+                {
+                    break;
+                }
+
+                pos = SkipWhitespace(pos);
+                const Frame& frame = m_stack.back();
+                const char closingCharacter = frame.m_isObject ? '}' : ']';
+                if (IsStructuralAt(pos, ','))
+                {
+                    TakeStructural(pos);
+                    pos = SkipWhitespace(pos + 1);
+                    if (m_allowTrailingCommas && IsStructuralAt(pos, closingCharacter))
+                    {
+                        continue;
+                    }
+
+                    if (frame.m_isObject)
+                    {
+                        Visitor::Result result = ParseMemberKey(pos);
+                        if (!result.IsSuccess())
+                        {
+                            return result;
+                        }
+                    }
+                    expectingValue = true;
+                }
+                else if (IsStructuralAt(pos, closingCharacter))
+                {
+                    TakeStructural(pos);
+                    ++pos;
+                    Visitor::Result result = CloseContainer();
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+                }
+                else
+                {
+                    return Error(pos, frame.m_isObject ? "Expected ',' or '}'" : "Expected ',' or ']'");
+                }
+            }
+
+            if (!m_stopWhenDone)
+            {
+                pos = SkipWhitespace(pos);
+                if (pos < m_size)
+                {
+                    return Error(pos, "The document root must not be followed by other values");
+                }
+            }
+            return AZ::Success();
+        }
+
+        Visitor::Result StructuralParser::OpenContainer(size_t& pos, bool isObject, bool& isEmpty)
+        {
+            Visitor::Result result = isObject ? m_visitor.StartObject() : m_visitor.StartArray();
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+
+            m_stack.push_back({ 0, isObject });
+            pos = SkipWhitespace(pos + 1);
+            isEmpty = IsStructuralAt(pos, isObject ? '}' : ']');
+            if (isEmpty)
+            {
+                TakeStructural(pos);
+                ++pos;
+                return CloseContainer();
+            }
+            return AZ::Success();
+        }
+
+        Visitor::Result StructuralParser::CloseContainer()
+        {
+            const Frame frame = m_stack.back();
+            m_stack.pop_back();
+            Visitor::Result result = frame.m_isObject ? m_visitor.EndObject(frame.m_entryCount) : m_visitor.EndArray(frame.m_entryCount);
+            CompleteValue();
+            return result;
+        }
+
+        Visitor::Result StructuralParser::ParseMemberKey(size_t& pos)
+        {
+            if (!IsStructuralAt(pos, '"'))
+            {
+                return Error(pos, "Expected a string as object key");
+            }
+            TakeStructural(pos);
+
+            AZStd::string_view key;
+            Lifetime lifetime;
+            Visitor::Result result = ParseString(pos, key, lifetime);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+
+            result = m_visitor.SupportsRawKeys() ? m_visitor.RawKey(key, lifetime) : m_visitor.Key(AZ::Name(key));
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+
+            pos = SkipWhitespace(pos);
+            if (!IsStructuralAt(pos, ':'))
+            {
+                return Error(pos, "Expected ':' after object key");
+            }
+            TakeStructural(pos);
+            pos = SkipWhitespace(pos + 1);
+            return AZ::Success();
+        }
+
+        Visitor::Result StructuralParser::ParseString(size_t& pos, AZStd::string_view& result, Lifetime& lifetime)
+        {
+            // The opening quote has been taken, so the next position in the index is the closing quote.
+            if (m_nextPosition >= m_positions.size() || m_buffer[m_positions[m_nextPosition]] != '"')
+            {
+                return Error(pos, "Unterminated string");
+            }
+            const size_t begin = pos + 1;
+            const size_t end = m_positions[m_nextPosition++];
+            pos = end + 1;
+
+            const char* stringBegin = m_buffer + begin;
+            const size_t length = end - begin;
+            if (memchr(stringBegin, '\\', length) == nullptr)
+            {
+                result = AZStd::string_view(stringBegin, length);
+                lifetime = m_lifetime;
+                return AZ::Success();
+            }
+
+            // Decoded strings are never longer than their escaped form, so they can be decoded in place.
+            size_t decodedLength = 0;
+            if (m_mutableBuffer)
+            {
+                if (!DecodeEscapes(stringBegin, stringBegin + length, m_mutableBuffer + begin, decodedLength))
+                {
+                    return Error(begin, "Invalid escape sequence in string");
+                }
+                result = AZStd::string_view(m_mutableBuffer + begin, decodedLength);
+                lifetime = Lifetime::Persistent;
+            }
+            else
+            {
+                m_scratch.resize_no_construct(length);
+                if (!DecodeEscapes(stringBegin, stringBegin + length, m_scratch.data(), decodedLength))
+                {
+                    return Error(begin, "Invalid escape sequence in string");
+                }
+                result = AZStd::string_view(m_scratch.data(), decodedLength);
+                lifetime = Lifetime::Temporary;
+            }
+            return AZ::Success();
+        }
+
+        bool StructuralParser::DecodeEscapes(const char* begin, const char* end, char* output, size_t& outputSize) const
+        {
+            auto parseHex = [](const char* hex, AZ::u32& value) -> bool
+            {
+                value = 0;
+                for (int i = 0; i < 4; ++i)
+                {
+                    const char c = hex[i];
+                    value <<= 4;
+                    if (c >= '0' && c <= '9')
+                    {
+                        value |= c - '0';
+                    }
+                    else if (c >= 'a' && c <= 'f')
+                    {
+                        value |= c - 'a' + 10;
+                    }
+                    else if (c >= 'A' && c <= 'F')
+                    {
+                        value |= c - 'A' + 10;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            char* out = output;
+            const char* in = begin;
+            while (in < end)
+            {
+                if (*in != '\\')
+                {
+                    *out++ = *in++;
+                    continue;
+                }
+
+                if (in + 1 >= end)
+                {
+                    return false;
+                }
+                const char escaped = in[1];
+                in += 2;
+                switch (escaped)
+                {
+                case '"':
+                    *out++ = '"';
+                    break;
+                case '\\':
+                    *out++ = '\\';
+                    break;
+                case '/':
+                    *out++ = '/';
+                    break;
+                case 'b':
+                    *out++ = '\b';
+                    break;
+                case 'f':
+                    *out++ = '\f';
+                    break;
+                case 'n':
+                    *out++ = '\n';
+                    break;
+                case 'r':
+                    *out++ = '\r';
+                    break;
+                case 't':
+                    *out++ = '\t';
+                    break;
+                case '\'':
+                    if (!m_allowEscapedApostrophes)
+                    {
+                        return false;
+                    }
+                    *out++ = '\'';
+                    break;
+                case 'u':
+                {
+                    AZ::u32 codePoint;
+                    if (end - in < 4 || !parseHex(in, codePoint))
+                    {
+                        return false;
+                    }
+                    in += 4;
+
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        // A high surrogate needs to be followed by an escaped low surrogate.
+                        AZ::u32 lowSurrogate;
+                        if (end - in < 6 || in[0] != '\\' || in[1] != 'u' || !parseHex(in + 2, lowSurrogate) ||
+                            lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                        {
+                            return false;
+                        }
+                        in += 6;
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                    }
+
+                    // Encode as UTF-8. The encoded form is never longer than the 6 or 12 character escape sequence.
+                    if (codePoint < 0x80)
+                    {
+                        *out++ = static_cast<char>(codePoint);
+                    }
+                    else if (codePoint < 0x800)
+                    {
+                        *out++ = static_cast<char>(0xC0 | (codePoint >> 6));
+                        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+                    }
+                    else if (codePoint < 0x10000)
+                    {
+                        *out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+                        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+                    }
+                    else
+                    {
+                        *out++ = static_cast<char>(0xF0 | (codePoint >> 18));
+                        *out++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+                    }
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+            outputSize = static_cast<size_t>(out - output);
+            return true;
+        }
+
+        Visitor::Result StructuralParser::ParseScalar(size_t& pos)
+        {
+            // Scalars aren't in the index, they run until the next whitespace, structural character or comment.
+            const size_t begin = pos;
+            while (pos < m_size)
+            {
+                const char c = m_buffer[pos];
+                if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || (CharClassTable[static_cast<AZ::u8>(c)] & ClassStructural) ||
+                    c == '/' || c == '"')
+                {
+                    break;
+                }
+                ++pos;
+            }
+
+            const AZStd::string_view token(m_buffer + begin, pos - begin);
+            if (token == "true")
+            {
+                return m_visitor.Bool(true);
+            }
+            else if (token == "false")
+            {
+                return m_visitor.Bool(false);
+            }
+            else if (token == "null")
+            {
+                return m_visitor.Null();
+            }
+            else if (m_allowNanAndInfinity && token == "NaN")
+            {
+                return m_visitor.Double(AZStd::numeric_limits<double>::quiet_NaN());
+            }
+            else if (m_allowNanAndInfinity && (token == "Infinity" || token == "Inf"))
+            {
+                return m_visitor.Double(AZStd::numeric_limits<double>::infinity());
+            }
+            else if (m_allowNanAndInfinity && (token == "-Infinity" || token == "-Inf"))
+            {
+                return m_visitor.Double(-AZStd::numeric_limits<double>::infinity());
+            }
+            return ParseNumber(token);
+        }
+
+        Visitor::Result StructuralParser::ParseNumber(AZStd::string_view token)
+        {
+            const size_t tokenOffset = static_cast<size_t>(token.data() - m_buffer);
+
+            // Validate the number against the JSON grammar and accumulate the integer part along the way.
+            size_t i = 0;
+            const bool isNegative = i < token.size() && token[i] == '-';
+            if (isNegative)
+            {
+                ++i;
+            }
+
+            const size_t integerBegin = i;
+            AZ::u64 integerValue = 0;
+            bool overflow = false;
+            while (i < token.size() && token[i] >= '0' && token[i] <= '9')
+            {
+                const AZ::u64 digit = static_cast<AZ::u64>(token[i] - '0');
+                if (integerValue > (AZStd::numeric_limits<AZ::u64>::max() - digit) / 10)
+                {
+                    overflow = true;
+                }
+                integerValue = integerValue * 10 + digit;
+                ++i;
+            }
+            const size_t integerDigits = i - integerBegin;
+            if (integerDigits == 0 || (integerDigits > 1 && token[integerBegin] == '0'))
+            {
+                return Error(tokenOffset, "Invalid value");
+            }
+
+            bool isInteger = true;
+            if (i < token.size() && token[i] == '.')
+            {
+                isInteger = false;
+                const size_t fractionBegin = ++i;
+                while (i < token.size() && token[i] >= '0' && token[i] <= '9')
+                {
+                    ++i;
+                }
+                if (i == fractionBegin)
+                {
+                    return Error(tokenOffset, "Missing fraction digits in number");
+                }
+            }
+            if (i < token.size() && (token[i] == 'e' || token[i] == 'E'))
+            {
+                isInteger = false;
+                ++i;
+                if (i < token.size() && (token[i] == '+' || token[i] == '-'))
+                {
+                    ++i;
+                }
+                const size_t exponentBegin = i;
+                while (i < token.size() && token[i] >= '0' && token[i] <= '9')
+                {
+                    ++i;
+                }
+                if (i == exponentBegin)
+                {
+                    return Error(tokenOffset, "Missing exponent digits in number");
+                }
+            }
+            if (i != token.size())
+            {
+                return Error(tokenOffset, "Invalid value");
+            }
+
+            // Match rapidjson: non-negative integers are unsigned, negative integers signed and anything else a double.
+            if (isInteger && !overflow)
+            {
+                if (!isNegative)
+                {
+                    return m_visitor.Uint64(integerValue);
+                }
+                if (integerValue <= static_cast<AZ::u64>(AZStd::numeric_limits<AZ::s64>::max()) + 1)
+                {
+                    return m_visitor.Int64(static_cast<AZ::s64>(~integerValue + 1));
+                }
+            }
+
+            // strtod needs a null terminated string and the buffer isn't guaranteed to have one after the number.
+            constexpr size_t MaxLocalNumberLength = 64;
+            char localNumber[MaxLocalNumberLength + 1];
+            const char* number = localNumber;
+            AZStd::string longNumber;
+            if (token.size() <= MaxLocalNumberLength)
+            {
+                memcpy(localNumber, token.data(), token.size());
+                localNumber[token.size()] = '\0';
+            }
+            else
+            {
+                longNumber = token;
+                number = longNumber.c_str();
+            }
+            return m_visitor.Double(strtod(number, nullptr));
+        }
+
+        size_t StructuralParser::SkipWhitespace(size_t pos) const
+        {
+            while (pos < m_size)
+            {
+                const char c = m_buffer[pos];
+                if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+                {
+                    ++pos;
+                }
+                else if (m_allowComments && c == '/' && pos + 1 < m_size && m_buffer[pos + 1] == '/')
+                {
+                    pos += 2;
+                    while (pos < m_size && m_buffer[pos] != '\n')
+                    {
+                        ++pos;
+                    }
+                }
+                else if (m_allowComments && c == '/' && pos + 1 < m_size && m_buffer[pos + 1] == '*')
+                {
+                    pos += 2;
+                    while (pos + 1 < m_size && !(m_buffer[pos] == '*' && m_buffer[pos + 1] == '/'))
+                    {
+                        ++pos;
+                    }
+                    pos += 2;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            return pos;
+        }
+
+        bool StructuralParser::TakeStructural(size_t pos)
+        {
+            if (m_nextPosition < m_positions.size() && m_positions[m_nextPosition] == pos)
+            {
+                ++m_nextPosition;
+                return true;
+            }
+            return false;
+        }
+
+        bool StructuralParser::IsStructuralAt(size_t pos, char structural) const
+        {
+            return m_nextPosition < m_positions.size() && m_positions[m_nextPosition] == pos && m_buffer[pos] == structural;
+        }
+
+        void StructuralParser::CompleteValue()
+        {
+            if (!m_stack.empty())
+            {
+                ++m_stack.back().m_entryCount;
+            }
+        }
+
+        Visitor::Result StructuralParser::Error(size_t pos, const char* message) const
+        {
+            return AZ::Failure(VisitorError(
+                VisitorErrorCode::InvalidData, AZStd::string::format("JSON parse error at offset %zu: %s", pos, message)));
+        }
+
+        Visitor::Result VisitSerializedJsonStructural(
+            const char* buffer, size_t size, char* mutableBuffer, Lifetime lifetime, Visitor& visitor, ParseFlags parseFlags)
+        {
+            if (size > AZStd::numeric_limits<AZ::u32>::max())
+            {
+                return AZ::Failure(VisitorError(VisitorErrorCode::UnsupportedOperation, "JSON documents larger than 4GB aren't supported"));
+            }
+
+            StructuralIndex index;
+            if (!index.Build({ buffer, size }, (parseFlags & ParseFlags::ParseComments) != ParseFlags::Null))
+            {
+                return AZ::Failure(VisitorError(VisitorErrorCode::InvalidData, "JSON parse error: unterminated string or comment"));
+            }
+
+            StructuralParser parser(buffer, size, mutableBuffer, lifetime, visitor, parseFlags, index.GetPositions());
+            return parser.Parse();
+        }
+    } // namespace StructuralInternal
+
+    //
+    // class StructuralIndex
+    //
+    bool StructuralIndex::Build(AZStd::string_view buffer, bool allowComments)
+    {
+        using namespace StructuralInternal;
+
+        enum class State
+        {
+            Value,
+            String,
+            LineComment,
+            BlockComment,
+        };
+
+        m_positions.clear();
+        // Pretty printed documents have roughly one indexed character per eight characters.
+        m_positions.reserve(buffer.size() / 8);
+
+        const char* data = buffer.data();
+        const size_t size = buffer.size();
+        State state = State::Value;
+        size_t skipUntil = 0; // Used to skip characters that have been consumed as part of an escape sequence or comment marker.
+
+        auto processBlock = [&](size_t blockOffset, AZ::u32 mask)
+        {
+            while (mask != 0)
+            {
+                const size_t pos = blockOffset + az_ctz_u32(mask);
+                mask &= mask - 1;
+                if (pos < skipUntil)
+                {
+                    continue;
+                }
+
+                const char c = data[pos];
+                switch (state)
+                {
+                case State::Value:
+                    if (c == '"')
+                    {
+                        m_positions.push_back(static_cast<AZ::u32>(pos));
+                        state = State::String;
+                    }
+                    else if (CharClassTable[static_cast<AZ::u8>(c)] & ClassStructural)
+                    {
+                        m_positions.push_back(static_cast<AZ::u32>(pos));
+                    }
+                    else if (c == '/' && pos + 1 < size)
+                    {
+                        if (data[pos + 1] == '/')
+                        {
+                            state = State::LineComment;
+                            skipUntil = pos + 2;
+                        }
+                        else if (data[pos + 1] == '*')
+                        {
+                            state = State::BlockComment;
+                            skipUntil = pos + 2;
+                        }
+                    }
+                    break;
+                case State::String:
+                    if (c == '\\')
+                    {
+                        skipUntil = pos + 2;
+                    }
+                    else if (c == '"')
+                    {
+                        m_positions.push_back(static_cast<AZ::u32>(pos));
+                        state = State::Value;
+                    }
+                    break;
+                case State::LineComment:
+                    if (c == '\n')
+                    {
+                        state = State::Value;
+                    }
+                    break;
+                case State::BlockComment:
+                    if (c == '*' && pos + 1 < size && data[pos + 1] == '/')
+                    {
+                        state = State::Value;
+                        skipUntil = pos + 2;
+                    }
+                    break;
+                }
+            }
+        };
+
+        size_t blockOffset = 0;
+        for (; blockOffset + BlockSize <= size; blockOffset += BlockSize)
+        {
+            processBlock(blockOffset, ClassifyBlock(data + blockOffset, allowComments));
+        }
+
+        if (blockOffset < size)
+        {
+            // Pad the last partial block with spaces so it can be classified like the others.
+            char lastBlock[BlockSize];
+            memset(lastBlock, ' ', BlockSize);
+            memcpy(lastBlock, data + blockOffset, size - blockOffset);
+            processBlock(blockOffset, ClassifyBlock(lastBlock, allowComments));
+        }
+
+        // A line comment may end the document, anything else needs to be terminated.
+        return state == State::Value || state == State::LineComment;
+    }
+
+    const AZStd::vector<AZ::u32>& StructuralIndex::GetPositions() const
+    {
+        return m_positions;
+    }
+
+    //
+    // Structural index parser functions
+    //
+    Visitor::Result VisitSerializedJsonStructural(AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor, ParseFlags parseFlags)
+    {
+        return StructuralInternal::VisitSerializedJsonStructural(buffer.data(), buffer.size(), nullptr, lifetime, visitor, parseFlags);
+    }
+
+    Visitor::Result VisitSerializedJsonStructuralInPlace(char* buffer, size_t size, Visitor& visitor, ParseFlags parseFlags)
+    {
+        return StructuralInternal::VisitSerializedJsonStructural(buffer, size, buffer, Lifetime::Persistent, visitor, parseFlags);
+    }
+} // namespace AZ::Dom::Json
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
+#include <AzCore/DOM/DomVisitor.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::Dom::Json
+{
+    //! Specifies the parser used to read serialized JSON.
+    enum class ParserType
+    {
+        RapidJson, //!< Reads JSON with rapidjson's character-by-character reader.
+        StructuralIndex, //!< Reads JSON with the two-stage StructuralIndex parser, which is faster for large documents.
+    };
+
+    //! Index of the positions of all structural characters ({}[]:,) and string quotes in a JSON document.
+    //! Building the index is the first stage of the structural index parser. It classifies the document a block of
+    //! characters at a time using SIMD instructions where available, so runs of string content, whitespace and numbers
+    //! are skipped without looking at each character individually. Characters inside strings and comments aren't indexed.
+    class StructuralIndex
+    {
+    public:
+        //! Builds the index for buffer. Returns false if the document contains an unterminated string or comment.
+        bool Build(AZStd::string_view buffer, bool allowComments);
+
+        const AZStd::vector<AZ::u32>& GetPositions() const;
+
+    private:
+        AZStd::vector<AZ::u32> m_positions;
+    };
+
+    //! Reads serialized JSON with the structural index parser and applies it to a visitor.
+    //! The parser first builds a StructuralIndex of the document and then walks the index to call the visitor.
+    //! Strings without escape sequences are passed to the visitor as views into buffer, without copying them.
+    //! \param buffer The UTF-8 serialized JSON to read. Documents larger than 4GB aren't supported.
+    //! \param lifetime Specifies the lifetime of the specified buffer. If the string specified by buffer might be deallocated,
+    //! ensure Lifetime::Temporary is specified.
+    //! \param visitor The visitor to visit with the JSON buffer's contents.
+    //! \param parseFlags Settings for adjusting parser behavior. ParseNumbersAsStrings isn't supported and numbers are
+    //! always parsed with full floating point precision.
+    //! \return The aggregate result specifying whether the parse and the visitor operations were successful.
+    Visitor::Result VisitSerializedJsonStructural(
+        AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor, ParseFlags parseFlags = ParseFlags::ParseComments);
+
+    //! Reads serialized JSON in-place with the structural index parser and applies it to a visitor.
+    //! \param buffer The UTF-8 serialized JSON to read. Strings with escape sequences are decoded in place, so this buffer
+    //! will be modified as part of the deserialization process.
+    //! \param size The size of the buffer.
+    //! \param visitor The visitor to visit with the JSON buffer's contents. The strings provided to the visitor will only
+    //! be valid for the lifetime of buffer.
+    //! \param parseFlags Settings for adjusting parser behavior.
+    //! \return The aggregate result specifying whether the parse and the visitor operations were successful.
+    Visitor::Result VisitSerializedJsonStructuralInPlace(
+        char* buffer, size_t size, Visitor& visitor, ParseFlags parseFlags = ParseFlags::ParseComments);
+} // namespace AZ::Dom::Json
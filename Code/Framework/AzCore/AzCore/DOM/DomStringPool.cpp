@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/DOM/DomStringPool.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::Dom
+{
+    Value::SharedStringType StringPool::Intern(AZStd::string_view value)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (auto it = m_strings.find(value); it != m_strings.end())
+        {
+            return it->second;
+        }
+
+        if (m_strings.size() >= m_collectSize)
+        {
+            CollectInternal();
+            m_collectSize = AZStd::max(MinCollectSize, m_strings.size() * 2);
+        }
+
+        Value::SharedStringType sharedString =
+            AZStd::allocate_shared<Value::SharedStringContainer>(StdValueAllocator(), value.begin(), value.end());
+        m_strings.emplace(AZStd::string_view(sharedString->data(), sharedString->size()), sharedString);
+        return sharedString;
+    }
+
+    size_t StringPool::Collect()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return CollectInternal();
+    }
+
+    size_t StringPool::CollectInternal()
+    {
+        size_t releasedCount = 0;
+        for (auto it = m_strings.begin(); it != m_strings.end();)
+        {
+            if (it->second.use_count() == 1)
+            {
+                it = m_strings.erase(it);
+                ++releasedCount;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return releasedCount;
+    }
+
+    size_t StringPool::GetSize() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_strings.size();
+    }
+} // namespace AZ::Dom
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/DOM/DomValue.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ::Dom
+{
+    //! Thread safe pool of immutable, reference counted strings.
+    //! Interning the same contents twice returns the same shared string, so documents written with the same pool
+    //! share the storage of their strings and comparing them can stop as soon as both sides point to the same string.
+    //! The pool holds a reference to every string it returns, strings no longer referenced by any Value are released
+    //! by Collect, which also runs whenever the pool has doubled in size since the last collection.
+    class StringPool final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(StringPool, ValueAllocator, 0);
+
+        StringPool() = default;
+        ~StringPool() = default;
+
+        //! Returns the shared string holding the contents of value, adding it to the pool if needed.
+        Value::SharedStringType Intern(AZStd::string_view value);
+
+        //! Releases the strings referenced by the pool only.
+        //! @return the number of strings released
+        size_t Collect();
+
+        //! Returns the number of strings in the pool.
+        size_t GetSize() const;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(StringPool);
+
+        size_t CollectInternal();
+
+        static constexpr size_t MinCollectSize = 1024;
+
+        // The keys view the contents of the shared string they map to
+        AZStd::unordered_map<AZStd::string_view, Value::SharedStringType, AZStd::hash<AZStd::string_view>, AZStd::equal_to<AZStd::string_view>, StdValueAllocator> m_strings;
+        size_t m_collectSize = MinCollectSize;
+        mutable AZStd::mutex m_mutex;
+    };
+} // namespace AZ::Dom
@@ -22,10 +22,10 @@ namespace AZ::Dom::Utils
         return backend.ReadFromBufferInPlace(string.data(), string.size(), visitor);
     }
 
-    AZ::Outcome<Value, AZStd::string> WriteToValue(const Backend::WriteCallback& writeCallback)
+    AZ::Outcome<Value, AZStd::string> WriteToValue(const Backend::WriteCallback& writeCallback, StringPool* stringPool)
     {
         Value value;
-        AZStd::unique_ptr<Visitor> writer = value.GetWriteHandler();
+        AZStd::unique_ptr<Visitor> writer = value.GetWriteHandler(stringPool);
         Visitor::Result result = writeCallback(*writer);
         if (!result.IsSuccess())
         {
@@ -16,7 +16,8 @@ namespace AZ::Dom::Utils
     Visitor::Result ReadFromString(Backend& backend, AZStd::string_view string, AZ::Dom::Lifetime lifetime, Visitor& visitor);
     Visitor::Result ReadFromStringInPlace(Backend& backend, AZStd::string& string, Visitor& visitor);
 
-    AZ::Outcome<Value, AZStd::string> WriteToValue(const Backend::WriteCallback& writeCallback);
+    //! Writes to a new Value, interning its copied strings in stringPool if provided.
+    AZ::Outcome<Value, AZStd::string> WriteToValue(const Backend::WriteCallback& writeCallback, StringPool* stringPool = nullptr);
 
     bool DeepCompareIsEqual(const Value& lhs, const Value& rhs);
     Value DeepCopy(const Value& value, bool copyStrings = true);
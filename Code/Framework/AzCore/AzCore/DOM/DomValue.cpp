@@ -273,6 +273,12 @@ namespace AZ::Dom
     {
         if (IsString() && rhs.IsString())
         {
+            // Strings interned in the same pool share their storage
+            if (m_value.index() == GetTypeIndex<SharedStringType>() && rhs.m_value.index() == GetTypeIndex<SharedStringType>() &&
+                AZStd::get<SharedStringType>(m_value) == AZStd::get<SharedStringType>(rhs.m_value))
+            {
+                return true;
+            }
             return GetString() == rhs.GetString();
         }
         else
@@ -1181,9 +1187,9 @@ namespace AZ::Dom
         return result;
     }
 
-    AZStd::unique_ptr<Visitor> Value::GetWriteHandler()
+    AZStd::unique_ptr<Visitor> Value::GetWriteHandler(StringPool* stringPool)
     {
-        return AZStd::make_unique<ValueWriter>(*this);
+        return AZStd::make_unique<ValueWriter>(*this, stringPool);
     }
 
     const Value::ValueType& Value::GetInternalValue() const
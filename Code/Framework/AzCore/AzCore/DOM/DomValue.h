@@ -59,6 +59,7 @@ namespace AZ::Dom
     using StdValueAllocator = AZStdAlloc<ValueAllocator>;
 
     class Value;
+    class StringPool;
 
     //! Internal storage for a Value array: an ordered list of Values.
     class Array
@@ -381,7 +382,8 @@ namespace AZ::Dom
 
         // Visitor API...
         Visitor::Result Accept(Visitor& visitor, bool copyStrings) const;
-        AZStd::unique_ptr<Visitor> GetWriteHandler();
+        //! Returns a visitor writing to this value, interning the copied strings in stringPool if provided.
+        AZStd::unique_ptr<Visitor> GetWriteHandler(StringPool* stringPool = nullptr);
 
         // Path API...
         Value& operator[](const PathEntry& entry);
@@ -6,12 +6,14 @@
  *
  */
 
+#include <AzCore/DOM/DomStringPool.h>
 #include <AzCore/DOM/DomValueWriter.h>
 
 namespace AZ::Dom
 {
-    ValueWriter::ValueWriter(Value& outputValue)
+    ValueWriter::ValueWriter(Value& outputValue, StringPool* stringPool)
         : m_result(outputValue)
+        , m_stringPool(stringPool)
     {
     }
 
@@ -61,6 +63,10 @@ namespace AZ::Dom
         {
             CurrentValue().SetString(value);
         }
+        else if (m_stringPool && value.size() > Value::ShortStringSize)
+        {
+            CurrentValue().SetString(m_stringPool->Intern(value));
+        }
         else
         {
             CurrentValue().CopyFromString(value);
@@ -15,10 +15,11 @@ namespace AZ::Dom
 {
     //! Visitor that writes to a Value.
     //! Supports all Visitor operations.
+    //! Strings that need to be copied are interned in stringPool when one is provided.
     class ValueWriter : public Visitor
     {
     public:
-        ValueWriter(Value& outputValue);
+        ValueWriter(Value& outputValue, StringPool* stringPool = nullptr);
 
         VisitorFlags GetVisitorFlags() const override;
         Result Null() override;
@@ -63,6 +64,7 @@ namespace AZ::Dom
         ValueBuffer& GetValueBuffer();
 
         Value& m_result;
+        StringPool* m_stringPool = nullptr;
         // Stores info about the current value being processed
         AZStd::stack<ValueInfo, AZStd::deque<ValueInfo, AZStdAlloc<ValueAllocator>>> m_entryStack;
         // Provides temporary storage for elements and attributes to prevent extra heap allocations
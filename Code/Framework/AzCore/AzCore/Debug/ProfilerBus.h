@@ -36,6 +36,12 @@ namespace AZ
             //! @param result Set to true if it's finished successfully
             //! @param info The output file path or error information which depends on the return.
             virtual void OnCaptureFinished(bool result, const AZStd::string& info) = 0;
+
+            //! Notify when the exclusive time spent in a budget during a frame goes over the limit configured for that budget
+            //! @param budgetName The name of the budget
+            //! @param frameMs The exclusive time spent in the budget during the frame, in milliseconds
+            //! @param limitMs The configured limit of the budget, in milliseconds
+            virtual void OnBudgetExceeded([[maybe_unused]] const AZStd::string& budgetName, [[maybe_unused]] float frameMs, [[maybe_unused]] float limitMs) {}
         };
         using ProfilerNotificationBus = AZ::EBus<ProfilerNotifications>;
 
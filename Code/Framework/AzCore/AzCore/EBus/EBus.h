@@ -19,6 +19,7 @@
 #pragma once
 
 #include <AzCore/EBus/BusImpl.h>
+#include <AzCore/EBus/EBusEpochMutex.h>
 #include <AzCore/EBus/Environment.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/EBus/Internal/Debug.h>
@@ -33,6 +34,7 @@
 #include <AzCore/std/utils.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/lock.h>
 
 namespace AZStd
 {
@@ -146,6 +148,8 @@ namespace AZ
          * - For simple multithreaded cases, use AZStd::mutex.
          * - For multithreaded cases where an event handler sends a new event on the same bus
          *   or connects/disconnects while handling an event on the same bus, use AZStd::recursive_mutex.
+         * - For single address buses that are dispatched from many threads and rarely connected to,
+         *   use AZ::EBusEpochMutex so that dispatches don't serialize on the mutex.
          */
         using MutexType = NullMutex;
 
@@ -247,13 +251,15 @@ namespace AZ
         /**
         * Template Lock Guard class that wraps around the Mutex
         * The EBus Context uses the LockGuard when dispatching
-        * (either AZStd::scoped_lock<MutexType> or NullLockGuard<MutexType>)
+        * (either AZStd::scoped_lock<MutexType> or NullLockGuard<MutexType>, or AZStd::shared_lock<MutexType>
+        * with AZ::EBusEpochMutex so that dispatches on different threads run concurrently)
         * The IsLocklessDispatch bool is there to defer evaluation of the LocklessDispatch constant
         * Otherwise the value above in EBusTraits.h is always used and not the value
         * that the derived trait class sets.
         */
         template <typename DispatchMutex, bool IsLocklessDispatch>
-        using DispatchLockGuard = AZStd::conditional_t<IsLocklessDispatch, AZ::Internal::NullLockGuard<DispatchMutex>, AZStd::scoped_lock<DispatchMutex>>;
+        using DispatchLockGuard = AZStd::conditional_t<IsLocklessDispatch, AZ::Internal::NullLockGuard<DispatchMutex>,
+            AZStd::conditional_t<AZStd::is_same_v<DispatchMutex, AZ::EBusEpochMutex>, AZStd::shared_lock<DispatchMutex>, AZStd::scoped_lock<DispatchMutex>>>;
     };
 
     namespace Internal
@@ -320,6 +326,8 @@ namespace AZ
      *    only to handlers connected at the specified ID. For performance-critical
      *    code, you can avoid an address lookup by using Event() variants that
      *    take a pointer instead of an ID.
+     *  - To send the same event to many IDs, use EventBatch(). It sorts the IDs, locks the
+     *    %EBus once and visits the addresses in that order.
      *  - If an event returns a value, use BroadcastResult() or EventResult() to get the result.
      *  - If you want handlers to receive the events in reverse order, use
      *    BroadcastReverse() or EventReverse().
@@ -655,6 +663,11 @@ namespace AZ
              */
             using ContextMutexType = AZStd::conditional_t<BusTraits::LocklessDispatch && AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::shared_mutex, MutexType>;
 
+            // Dispatching under a shared lock is only safe when dispatch never modifies the bus. Buses with multiple
+            // addresses release (and may erase) the address they dispatch to, so they need an exclusive dispatch lock.
+            static_assert(!AZStd::is_same_v<ContextMutexType, AZ::EBusEpochMutex> || BusTraits::AddressPolicy == EBusAddressPolicy::Single,
+                "AZ::EBusEpochMutex can only be used as the MutexType of buses with EBusAddressPolicy::Single");
+
             /**
              * The scoped lock guard to use
              * during broadcast/event dispatch.
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBusEpochMutex.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/typetraits/is_pointer.h>
+
+namespace AZ
+{
+    namespace
+    {
+        AZStd::native_thread_id_type CurrentThreadId()
+        {
+            return AZStd::this_thread::get_id().m_id;
+        }
+
+        size_t FirstSlotIndex(AZStd::native_thread_id_type threadId)
+        {
+            // Thread ids are often pointers or small sequential integers, mix them before picking a slot
+            uint64_t bits;
+            if constexpr (AZStd::is_pointer_v<AZStd::native_thread_id_type>)
+            {
+                bits = reinterpret_cast<uintptr_t>(threadId);
+            }
+            else
+            {
+                bits = static_cast<uint64_t>(threadId);
+            }
+            const uint64_t hash = bits * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(hash >> 32) % EBusEpochMutex::MaxConcurrentThreads;
+        }
+
+        void Backoff(uint32_t& spinCount)
+        {
+            if (++spinCount < 64)
+            {
+                AZStd::this_thread::pause(1);
+            }
+            else
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+    }
+
+    EBusEpochMutex::ReaderSlot* EBusEpochMutex::FindSlot(AZStd::native_thread_id_type threadId)
+    {
+        // Slots are never released, so a thread's slot always comes before the first free slot in its probe order
+        const size_t first = FirstSlotIndex(threadId);
+        for (size_t i = 0; i < MaxConcurrentThreads; ++i)
+        {
+            ReaderSlot& slot = m_slots[(first + i) % MaxConcurrentThreads];
+            const AZStd::native_thread_id_type owner = slot.m_owner.load(AZStd::memory_order_acquire);
+            if (owner == threadId)
+            {
+                return &slot;
+            }
+            if (owner == AZStd::native_thread_invalid_id)
+            {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    EBusEpochMutex::ReaderSlot* EBusEpochMutex::AcquireSlot(AZStd::native_thread_id_type threadId)
+    {
+        const size_t first = FirstSlotIndex(threadId);
+        for (size_t i = 0; i < MaxConcurrentThreads; ++i)
+        {
+            ReaderSlot& slot = m_slots[(first + i) % MaxConcurrentThreads];
+            AZStd::native_thread_id_type owner = slot.m_owner.load(AZStd::memory_order_acquire);
+            if (owner == AZStd::native_thread_invalid_id &&
+                slot.m_owner.compare_exchange_strong(owner, threadId, AZStd::memory_order_acq_rel))
+            {
+                return &slot;
+            }
+            if (owner == threadId)
+            {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    void EBusEpochMutex::lock_shared()
+    {
+        const AZStd::native_thread_id_type threadId = CurrentThreadId();
+        ReaderSlot* slot = AcquireSlot(threadId);
+        if (!slot)
+        {
+            lock();
+            return;
+        }
+
+        const uint32_t depth = slot->m_depth.load(AZStd::memory_order_relaxed);
+        if (depth > 0)
+        {
+            // Nested dispatch, any writer is already waiting for this thread
+            slot->m_depth.store(depth + 1, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        uint32_t spinCount = 0;
+        for (;;)
+        {
+            // Publish the read before looking for a writer, the writer does the opposite (seq_cst on both sides)
+            slot->m_depth.store(1, AZStd::memory_order_seq_cst);
+            const AZStd::native_thread_id_type writer = m_writer.load(AZStd::memory_order_seq_cst);
+            if (writer == AZStd::native_thread_invalid_id || writer == threadId)
+            {
+                return;
+            }
+
+            // A writer is modifying the bus or waiting to, step back until it is done
+            slot->m_depth.store(0, AZStd::memory_order_release);
+            while (m_writer.load(AZStd::memory_order_acquire) != AZStd::native_thread_invalid_id)
+            {
+                Backoff(spinCount);
+            }
+        }
+    }
+
+    bool EBusEpochMutex::try_lock_shared()
+    {
+        const AZStd::native_thread_id_type threadId = CurrentThreadId();
+        ReaderSlot* slot = AcquireSlot(threadId);
+        if (!slot)
+        {
+            return try_lock();
+        }
+
+        const uint32_t depth = slot->m_depth.load(AZStd::memory_order_relaxed);
+        if (depth > 0)
+        {
+            slot->m_depth.store(depth + 1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        slot->m_depth.store(1, AZStd::memory_order_seq_cst);
+        const AZStd::native_thread_id_type writer = m_writer.load(AZStd::memory_order_seq_cst);
+        if (writer == AZStd::native_thread_invalid_id || writer == threadId)
+        {
+            return true;
+        }
+        slot->m_depth.store(0, AZStd::memory_order_release);
+        return false;
+    }
+
+    void EBusEpochMutex::unlock_shared()
+    {
+        ReaderSlot* slot = FindSlot(CurrentThreadId());
+        if (!slot)
+        {
+            unlock();
+            return;
+        }
+        const uint32_t depth = slot->m_depth.load(AZStd::memory_order_relaxed);
+        AZ_Assert(depth > 0, "EBusEpochMutex::unlock_shared called without a matching lock_shared");
+        slot->m_depth.store(depth - 1, AZStd::memory_order_release);
+    }
+
+    bool EBusEpochMutex::WaitForReaders(AZStd::native_thread_id_type threadId, bool holdsShared)
+    {
+        uint32_t spinCount = 0;
+        bool reportedDeadlock = false;
+        for (ReaderSlot& slot : m_slots)
+        {
+            if (slot.m_owner.load(AZStd::memory_order_acquire) == threadId)
+            {
+                // The writer's own dispatch in progress, if any, is the one modifying the bus
+                continue;
+            }
+            while (slot.m_depth.load(AZStd::memory_order_seq_cst) > 0)
+            {
+                if (slot.m_upgrading.load(AZStd::memory_order_acquire))
+                {
+                    // That thread is modifying the bus from inside a dispatch and can not finish its dispatch
+                    // before it gets exclusive access. Let it go first unless this thread is in the same situation.
+                    if (!holdsShared)
+                    {
+                        return false;
+                    }
+                    AZ_Error("EBus", reportedDeadlock, "Deadlock: two threads are connecting or disconnecting handlers from inside a dispatch "
+                        "on the same bus using EBusEpochMutex. Use AZStd::recursive_mutex as the MutexType of this bus instead.");
+                    reportedDeadlock = true;
+                }
+                Backoff(spinCount);
+            }
+        }
+        return true;
+    }
+
+    void EBusEpochMutex::lock()
+    {
+        const AZStd::native_thread_id_type threadId = CurrentThreadId();
+        if (m_writer.load(AZStd::memory_order_relaxed) == threadId)
+        {
+            ++m_writerDepth;
+            return;
+        }
+
+        ReaderSlot* slot = FindSlot(threadId);
+        const bool holdsShared = slot && slot->m_depth.load(AZStd::memory_order_relaxed) > 0;
+        if (holdsShared)
+        {
+            slot->m_upgrading.store(true, AZStd::memory_order_release);
+            m_pendingUpgrades.fetch_add(1, AZStd::memory_order_acq_rel);
+        }
+
+        uint32_t spinCount = 0;
+        for (;;)
+        {
+            if (!holdsShared && m_pendingUpgrades.load(AZStd::memory_order_acquire) > 0)
+            {
+                Backoff(spinCount);
+                continue;
+            }
+            AZStd::native_thread_id_type expected = AZStd::native_thread_invalid_id;
+            if (m_writer.compare_exchange_weak(expected, threadId, AZStd::memory_order_seq_cst))
+            {
+                if (WaitForReaders(threadId, holdsShared))
+                {
+                    break;
+                }
+                // Back off in favor of a dispatching thread that wants exclusive access
+                m_writer.store(AZStd::native_thread_invalid_id, AZStd::memory_order_release);
+            }
+            Backoff(spinCount);
+        }
+
+        if (holdsShared)
+        {
+            slot->m_upgrading.store(false, AZStd::memory_order_release);
+            m_pendingUpgrades.fetch_sub(1, AZStd::memory_order_acq_rel);
+        }
+        m_writerDepth = 1;
+    }
+
+    bool EBusEpochMutex::try_lock()
+    {
+        const AZStd::native_thread_id_type threadId = CurrentThreadId();
+        if (m_writer.load(AZStd::memory_order_relaxed) == threadId)
+        {
+            ++m_writerDepth;
+            return true;
+        }
+
+        AZStd::native_thread_id_type expected = AZStd::native_thread_invalid_id;
+        if (!m_writer.compare_exchange_strong(expected, threadId, AZStd::memory_order_seq_cst))
+        {
+            return false;
+        }
+        for (ReaderSlot& slot : m_slots)
+        {
+            if (slot.m_owner.load(AZStd::memory_order_acquire) != threadId &&
+                slot.m_depth.load(AZStd::memory_order_seq_cst) > 0)
+            {
+                m_writer.store(AZStd::native_thread_invalid_id, AZStd::memory_order_release);
+                return false;
+            }
+        }
+        m_writerDepth = 1;
+        return true;
+    }
+
+    void EBusEpochMutex::unlock()
+    {
+        AZ_Assert(m_writer.load(AZStd::memory_order_relaxed) == CurrentThreadId(), "EBusEpochMutex::unlock called from a thread that doesn't own it");
+        if (--m_writerDepth == 0)
+        {
+            m_writer.store(AZStd::native_thread_invalid_id, AZStd::memory_order_release);
+        }
+    }
+} // namespace AZ
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/config.h>
+
+namespace AZ
+{
+    /**
+     * Mutex for multi-handler EBuses that are dispatched from many threads far more often than handlers
+     * connect or disconnect (tick and notification buses).
+     * Use it as the MutexType of the bus; the EBus then takes it in shared mode while dispatching and in
+     * exclusive mode when connecting, disconnecting or queueing.
+     *
+     * Dispatches only touch a cache line owned by the dispatching thread, so dispatches on several threads
+     * run concurrently without contending on the mutex. Exclusive access is epoch based: the writer announces
+     * itself, waits out the dispatches already in flight on other threads (the grace period) and holds back
+     * new ones until it is done.
+     *
+     * The mutex is recursive in both modes, like the AZStd::recursive_mutex buses use by default:
+     * dispatches nest, and handlers may connect or disconnect during a dispatch.
+     * Constraints:
+     * - handlers of the bus run concurrently on different threads, so they must be thread safe themselves;
+     * - two threads that both change connections from inside a dispatch on this bus at the same time can
+     *   not both make progress (each waits for the other's dispatch to finish); this is reported as an error;
+     * - the first MaxConcurrentThreads threads to dispatch get a reader slot for the life of the mutex,
+     *   dispatches from any further thread fall back to taking the mutex exclusively.
+     */
+    class EBusEpochMutex
+    {
+    public:
+        static constexpr size_t MaxConcurrentThreads = 64;
+
+        EBusEpochMutex() = default;
+        EBusEpochMutex(const EBusEpochMutex&) = delete;
+        EBusEpochMutex& operator=(const EBusEpochMutex&) = delete;
+
+        //! Exclusive access, used to modify the bus (connect, disconnect, queue).
+        void lock();
+        bool try_lock();
+        void unlock();
+
+        //! Shared access, used to dispatch.
+        void lock_shared();
+        bool try_lock_shared();
+        void unlock_shared();
+
+    private:
+        struct alignas(64) ReaderSlot
+        {
+            AZStd::atomic<AZStd::native_thread_id_type> m_owner{ AZStd::native_thread_invalid_id };
+            //! Number of shared locks held by the owner, only written by the owner.
+            AZStd::atomic<uint32_t> m_depth{ 0 };
+            //! Set by the owner while it waits for exclusive access with shared locks held.
+            AZStd::atomic<bool> m_upgrading{ false };
+        };
+
+        //! Returns the slot owned by the thread, claiming a free one if needed. nullptr if all slots are taken.
+        ReaderSlot* AcquireSlot(AZStd::native_thread_id_type threadId);
+        //! Returns the slot owned by the thread without claiming one.
+        ReaderSlot* FindSlot(AZStd::native_thread_id_type threadId);
+        //! Waits until no other thread holds a shared lock. Returns false if the writer has to back off
+        //! to let a dispatching thread upgrade first.
+        bool WaitForReaders(AZStd::native_thread_id_type threadId, bool holdsShared);
+
+        ReaderSlot m_slots[MaxConcurrentThreads];
+        alignas(64) AZStd::atomic<AZStd::native_thread_id_type> m_writer{ AZStd::native_thread_invalid_id };
+        //! Number of dispatching threads waiting for exclusive access, other writers let them go first.
+        AZStd::atomic<uint32_t> m_pendingUpgrades{ 0 };
+        //! Recursion count of the exclusive owner, only accessed by it.
+        uint32_t m_writerDepth = 0;
+    };
+} // namespace AZ
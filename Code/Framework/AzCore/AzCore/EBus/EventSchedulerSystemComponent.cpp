@@ -63,16 +63,12 @@ namespace AZ
         TimeMs startTime = AZ::GetElapsedTimeMs();
         bool usingTimeslice = bg_maxScheduledEventProcessTimeMs != TimeMs{ 0 };
 
-        while (!m_queue.empty())
+        m_timerWheel.Advance(startTime, m_expiredHandles);
+        for (ScheduledEventHandle* handle : m_expiredHandles)
         {
-            ScheduledEventHandle* handle = m_queue.top();
-            if (handle->GetExecuteTimeMs() > startTime)
-            {
-                break;
-            }
-            m_queue.pop();
             m_pendingQueue.push(handle);
         }
+        m_expiredHandles.clear();
 
         while (!m_pendingQueue.empty())
         {
@@ -83,7 +79,9 @@ namespace AZ
             }
             ScheduledEventHandle* handle = m_pendingQueue.top();
             m_pendingQueue.pop();
-            if (!handle->Notify()) // if Notify return false, the event has been deleted and we should delete its handle.
+            // if Notify return false, the event has been deleted and we should delete its handle,
+            // unless the callback queued the handle again.
+            if (!handle->Notify() && !ScheduledEventTimerWheel::Contains(handle))
             {
                 FreeHandle(handle);
             }
@@ -108,13 +106,32 @@ namespace AZ
         {
             timedEvent->m_handle = AllocateHandle();
         }
+        else if (ScheduledEventTimerWheel::Contains(timedEvent->m_handle))
+        {
+            // Requeued before triggering, reschedule the same handle
+            m_timerWheel.Remove(timedEvent->m_handle);
+        }
         const bool ownsScheduledEvent = false;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        m_timerWheel.Insert(timedEvent->m_handle, currentMilliseconds);
         return timedEvent->m_handle;
     }
 
+    void EventSchedulerSystemComponent::RemoveEvent(ScheduledEventHandle* handle)
+    {
+        if (ScheduledEventTimerWheel::Contains(handle))
+        {
+            m_timerWheel.Remove(handle);
+            FreeHandle(handle);
+        }
+        else if (!handle->GetOwnsScheduledEvent())
+        {
+            // The handle is on the pending queue or triggering, it is released once processed
+            handle->ClearScheduledEvent();
+        }
+    }
+
     void EventSchedulerSystemComponent::AddCallback(const AZStd::function<void()>& callback, const Name& eventName, TimeMs durationMs)
     {
         if (durationMs < TimeMs{ 0 })
@@ -127,7 +144,7 @@ namespace AZ
         const bool ownsScheduledEvent = true;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        m_timerWheel.Insert(timedEvent->m_handle, currentMilliseconds);
     }
 
     AZStd::size_t EventSchedulerSystemComponent::GetHandleCount() const
@@ -142,7 +159,7 @@ namespace AZ
 
     AZStd::size_t EventSchedulerSystemComponent::GetQueueSize() const
     {
-        return m_queue.size();
+        return m_timerWheel.GetSize();
     }
 
     void EventSchedulerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
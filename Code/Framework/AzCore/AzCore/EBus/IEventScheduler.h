@@ -41,6 +41,10 @@ namespace AZ
         //! @return pointer to the handle for this scheduled event, IEventScheduler maintains ownership
         virtual ScheduledEventHandle* AddEvent(ScheduledEvent* scheduledEvent, TimeMs durationMs) = 0;
 
+        //! Cancels a scheduled event, the event will not trigger from this handle.
+        //! @param handle the handle returned by AddEvent for the scheduled event to cancel
+        virtual void RemoveEvent(ScheduledEventHandle* handle) = 0;
+
         //! Schedules a callback to run in durationMs.
         //! Actual duration is not guaranteed but will not be less than the value provided.
         //! @param callback a callback to invoke after durationMs
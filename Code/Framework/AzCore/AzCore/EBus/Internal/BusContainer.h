@@ -7,9 +7,11 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/EBus/Internal/CallstackEntry.h>
 #include <AzCore/EBus/Internal/Handlers.h>
@@ -80,6 +82,16 @@ namespace AZ
         }                                                                                       \
     } while(false)
 
+        // Orders the ids of an EventBatch: in address order on ordered buses, otherwise by AZStd::less so that
+        // the visiting order is deterministic and repeated ids are adjacent
+        template <typename Traits>
+        void SortBatchIds(AZStd::span<typename Traits::BusIdType> ids)
+        {
+            using Compare = AZStd::conditional_t<Traits::AddressPolicy == EBusAddressPolicy::ByIdAndOrdered,
+                typename Traits::BusIdOrderCompare, AZStd::less<typename Traits::BusIdType>>;
+            AZStd::sort(ids.begin(), ids.end(), Compare());
+        }
+
         // Default impl, used when there are multiple addresses and multiple handlers
         template <typename Interface, typename Traits, EBusAddressPolicy addressPolicy = Traits::AddressPolicy, EBusHandlerPolicy handlerPolicy = Traits::HandlerPolicy>
         struct EBusContainer
@@ -254,6 +266,22 @@ namespace AZ
                         }
                     }
                 }
+                // Sends the event to each id in turn, taking the context lock once for the whole batch.
+                // The ids are sorted in place.
+                template <typename Function, typename... ArgsT>
+                static void EventBatch(AZStd::span<IdType> ids, Function&& func, ArgsT&&... args)
+                {
+                    auto* context = Bus::GetContext();
+                    if (context && !ids.empty())
+                    {
+                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        SortBatchIds<Traits>(ids);
+                        for (const IdType& id : ids)
+                        {
+                            EventLocked(context, id, func, args...);
+                        }
+                    }
+                }
                 template <typename Function, typename... ArgsT>
                 static void Event(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
@@ -629,6 +657,46 @@ namespace AZ
                         }
                     }
                 }
+            private:
+                template <typename Context, typename Function, typename... ArgsT>
+                static void EventLocked(Context* context, const IdType& id, Function& func, ArgsT&... args)
+                {
+                    EBUS_DO_ROUTING(*context, &id, false, false);
+
+                    auto& addresses = context->m_buses.m_addresses;
+                    auto addressIt = addresses.find(id);
+                    if (addressIt != addresses.end())
+                    {
+                        HandlerHolder& holder = *addressIt;
+                        holder.add_ref();
+
+                        auto& handlers = holder.m_handlers;
+                        auto handlerIt = handlers.begin();
+                        auto handlersEnd = handlers.end();
+
+                        auto fixer = MakeDisconnectFixer<Bus>(context, &id,
+                            [&handlerIt, &handlersEnd](Interface* handler)
+                            {
+                                if (handlerIt != handlersEnd && handlerIt->m_interface == handler)
+                                {
+                                    ++handlerIt;
+                                }
+                            },
+                            [&handlers, &handlersEnd]()
+                            {
+                                handlersEnd = handlers.end();
+                            }
+                        );
+
+                        while (handlerIt != handlersEnd)
+                        {
+                            auto itr = handlerIt++;
+                            Traits::EventProcessingPolicy::Call(func, *itr, args...);
+                        }
+
+                        holder.release();
+                    }
+                }
             };
 
             // All enumerate functions do basically the same thing once they have a holder, so implement it here
@@ -858,6 +926,22 @@ namespace AZ
                         }
                     }
                 }
+                // Sends the event to each id in turn, taking the context lock once for the whole batch.
+                // The ids are sorted in place.
+                template <typename Function, typename... ArgsT>
+                static void EventBatch(AZStd::span<IdType> ids, Function&& func, ArgsT&&... args)
+                {
+                    auto* context = Bus::GetContext();
+                    if (context && !ids.empty())
+                    {
+                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        SortBatchIds<Traits>(ids);
+                        for (const IdType& id : ids)
+                        {
+                            EventLocked(context, id, func, args...);
+                        }
+                    }
+                }
                 template <typename Function, typename... ArgsT>
                 static void Event(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
@@ -1208,6 +1292,20 @@ namespace AZ
                         }
                     }
                 }
+            private:
+                template <typename Context, typename Function, typename... ArgsT>
+                static void EventLocked(Context* context, const IdType& id, Function& func, ArgsT&... args)
+                {
+                    EBUS_DO_ROUTING(*context, &id, false, false);
+
+                    auto& addresses = context->m_buses.m_addresses;
+                    auto addressIt = addresses.find(id);
+                    if (addressIt != addresses.end() && addressIt->m_interface)
+                    {
+                        CallstackEntry entry(context, &addressIt->m_busId);
+                        Traits::EventProcessingPolicy::Call(func, addressIt->m_interface, args...);
+                    }
+                }
             };
 
             void Bind(BusPtr& busPtr, const IdType& id)
@@ -60,6 +60,14 @@ namespace AZ
 
     void ScheduledEvent::RemoveFromQueue()
     {
+        if (m_handle != nullptr)
+        {
+            // The scheduler owns the handles, if it is already gone there is nothing left to cancel
+            if (IEventScheduler* eventScheduler = Interface<IEventScheduler>::Get())
+            {
+                eventScheduler->RemoveEvent(m_handle);
+            }
+        }
         ClearHandle();
         m_autoRequeue = false; // In the case that someone is removing an event that's auto queued inside a notify we don't want to re-queue that event.
     }
@@ -75,4 +75,9 @@ namespace AZ
     {
         return m_event;
     }
+
+    void ScheduledEventHandle::ClearScheduledEvent()
+    {
+        m_event = nullptr;
+    }
 }
@@ -55,12 +55,21 @@ namespace AZ
         //! @return the scheduled event instance bound to this event handle
         ScheduledEvent* GetScheduledEvent() const;
 
+        //! Unbinds the scheduled event from this handle, so that the handle gets released without triggering.
+        void ClearScheduledEvent();
+
     private:
 
         TimeMs m_executeTimeMs = TimeMs{ 0 }; //< execution time of the scheduled event
         TimeMs m_durationMs = TimeMs{ 0 };    //< interval time of the scheduled event
         ScheduledEvent* m_event = nullptr;    //< pointer to the scheduled event
         bool m_ownsScheduledEvent = false;    //< if the handle manages the memory of its own event
+
+        ScheduledEventHandle** m_slot = nullptr; //< timer wheel slot holding the handle while it waits to trigger
+        ScheduledEventHandle* m_prev = nullptr;  //< previous handle of the timer wheel slot
+        ScheduledEventHandle* m_next = nullptr;  //< next handle of the timer wheel slot
+
+        friend class ScheduledEventTimerWheel;
     };
 }
 
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/ScheduledEventTimerWheel.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace
+    {
+        constexpr uint32_t SlotMask = ScheduledEventTimerWheel::SlotCount - 1;
+        constexpr int64_t MaxDelayMs = (int64_t(1) << (ScheduledEventTimerWheel::SlotBits * ScheduledEventTimerWheel::LevelCount)) - 1;
+    }
+
+    void ScheduledEventTimerWheel::Insert(ScheduledEventHandle* handle, TimeMs currentTime)
+    {
+        AZ_Assert(!Contains(handle), "The scheduled event handle is already in a timer wheel");
+        if (m_size == 0)
+        {
+            // Nothing to expire in between, skip ahead instead of stepping through the elapsed time on the next advance
+            m_currentTimeMs = AZStd::max(m_currentTimeMs, static_cast<int64_t>(currentTime));
+        }
+        Link(handle);
+        ++m_size;
+    }
+
+    void ScheduledEventTimerWheel::Remove(ScheduledEventHandle* handle)
+    {
+        AZ_Assert(Contains(handle), "The scheduled event handle is not in a timer wheel");
+        Unlink(handle);
+        --m_size;
+    }
+
+    bool ScheduledEventTimerWheel::Contains(const ScheduledEventHandle* handle)
+    {
+        return handle->m_slot != nullptr;
+    }
+
+    void ScheduledEventTimerWheel::Advance(TimeMs currentTime, AZStd::vector<ScheduledEventHandle*>& expiredHandles)
+    {
+        Expire(m_expired, expiredHandles);
+
+        const int64_t targetTimeMs = static_cast<int64_t>(currentTime);
+        while (m_currentTimeMs < targetTimeMs)
+        {
+            if (m_size == 0)
+            {
+                m_currentTimeMs = targetTimeMs;
+                break;
+            }
+
+            // Nothing expires before the next block of the lowest level holding handles, skip to it
+            uint32_t emptyLevels = 0;
+            while ((emptyLevels < LevelCount - 1) && (m_levelSizes[emptyLevels] == 0))
+            {
+                ++emptyLevels;
+            }
+            const uint32_t blockShift = SlotBits * emptyLevels;
+            const int64_t timeMs = ((m_currentTimeMs >> blockShift) + 1) << blockShift;
+            if (timeMs > targetTimeMs)
+            {
+                m_currentTimeMs = targetTimeMs;
+                break;
+            }
+            m_currentTimeMs = timeMs;
+
+            const uint32_t slot = static_cast<uint32_t>(timeMs) & SlotMask;
+            if (slot == 0)
+            {
+                // Move the handles of the next block of the upper levels down, a level is only reached when all the lower ones wrapped
+                for (uint32_t level = 1; level < LevelCount; ++level)
+                {
+                    const uint32_t levelSlot = static_cast<uint32_t>(timeMs >> (SlotBits * level)) & SlotMask;
+                    Cascade(level, levelSlot);
+                    if (levelSlot != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            Expire(m_expired, expiredHandles);
+            Expire(m_slots[0][slot], expiredHandles);
+        }
+    }
+
+    AZStd::size_t ScheduledEventTimerWheel::GetSize() const
+    {
+        return m_size;
+    }
+
+    void ScheduledEventTimerWheel::Link(ScheduledEventHandle* handle)
+    {
+        const int64_t delayMs = static_cast<int64_t>(handle->GetExecuteTimeMs()) - m_currentTimeMs;
+        ScheduledEventHandle** slot = &m_expired;
+        if (delayMs > 0)
+        {
+            const int64_t clampedDelayMs = AZStd::min(delayMs, MaxDelayMs);
+            const uint64_t executeTimeMs = static_cast<uint64_t>(m_currentTimeMs + clampedDelayMs);
+            uint32_t level = 0;
+            while (clampedDelayMs >= (int64_t(1) << (SlotBits * (level + 1))))
+            {
+                ++level;
+            }
+            slot = &m_slots[level][(executeTimeMs >> (SlotBits * level)) & SlotMask];
+            ++m_levelSizes[level];
+        }
+
+        handle->m_slot = slot;
+        handle->m_prev = nullptr;
+        handle->m_next = *slot;
+        if (*slot != nullptr)
+        {
+            (*slot)->m_prev = handle;
+        }
+        *slot = handle;
+    }
+
+    void ScheduledEventTimerWheel::Unlink(ScheduledEventHandle* handle)
+    {
+        if (handle->m_slot != &m_expired)
+        {
+            --m_levelSizes[(handle->m_slot - &m_slots[0][0]) / SlotCount];
+        }
+        if (handle->m_prev != nullptr)
+        {
+            handle->m_prev->m_next = handle->m_next;
+        }
+        else
+        {
+            *(handle->m_slot) = handle->m_next;
+        }
+        if (handle->m_next != nullptr)
+        {
+            handle->m_next->m_prev = handle->m_prev;
+        }
+        handle->m_slot = nullptr;
+        handle->m_prev = nullptr;
+        handle->m_next = nullptr;
+    }
+
+    void ScheduledEventTimerWheel::Cascade(uint32_t level, uint32_t slot)
+    {
+        ScheduledEventHandle* handle = m_slots[level][slot];
+        m_slots[level][slot] = nullptr;
+        while (handle != nullptr)
+        {
+            ScheduledEventHandle* next = handle->m_next;
+            --m_levelSizes[level];
+            Link(handle);
+            handle = next;
+        }
+    }
+
+    void ScheduledEventTimerWheel::Expire(ScheduledEventHandle*& slot, AZStd::vector<ScheduledEventHandle*>& expiredHandles)
+    {
+        ScheduledEventHandle* handle = slot;
+        slot = nullptr;
+        while (handle != nullptr)
+        {
+            ScheduledEventHandle* next = handle->m_next;
+            if (handle->m_slot != &m_expired)
+            {
+                --m_levelSizes[0];
+            }
+            handle->m_slot = nullptr;
+            handle->m_prev = nullptr;
+            handle->m_next = nullptr;
+            expiredHandles.push_back(handle);
+            --m_size;
+            handle = next;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/ScheduledEventHandle.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! @class ScheduledEventTimerWheel
+    //! Hierarchical timing wheel of scheduled event handles with a resolution of 1 ms.
+    //! Each level splits its range in 256 slots, a handle is stored in the slot of the lowest level whose range covers
+    //! its remaining time and moves down the levels as the wheel advances, so inserting and removing a handle are O(1)
+    //! and advancing skips the blocks of time without any handle.
+    //! Execution times further than 2^32 ms are wrapped to the end of the highest level and placed again from there.
+    class ScheduledEventTimerWheel
+    {
+    public:
+        static constexpr uint32_t LevelCount = 4;
+        static constexpr uint32_t SlotBits = 8;
+        static constexpr uint32_t SlotCount = 1 << SlotBits;
+
+        ScheduledEventTimerWheel() = default;
+
+        //! Inserts a handle so that it expires at its execute time.
+        //! @param handle      the handle to insert, it must not already be in the wheel
+        //! @param currentTime the current time, used to align an empty wheel
+        void Insert(ScheduledEventHandle* handle, TimeMs currentTime);
+
+        //! Removes a handle that is in the wheel.
+        //! @param handle the handle to remove
+        void Remove(ScheduledEventHandle* handle);
+
+        //! Returns whether a handle is in a wheel.
+        //! @param handle the handle to check
+        //! @return true if the handle is waiting in a wheel
+        static bool Contains(const ScheduledEventHandle* handle);
+
+        //! Advances the wheel to a time and appends all the handles expiring until then, in batch.
+        //! @param currentTime the time to advance to
+        //! @param expiredHandles the vector to append the expired handles to
+        void Advance(TimeMs currentTime, AZStd::vector<ScheduledEventHandle*>& expiredHandles);
+
+        //! Returns the number of handles in the wheel.
+        //! @return the number of handles in the wheel
+        AZStd::size_t GetSize() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(ScheduledEventTimerWheel);
+
+        void Link(ScheduledEventHandle* handle);
+        void Unlink(ScheduledEventHandle* handle);
+        void Cascade(uint32_t level, uint32_t slot);
+        void Expire(ScheduledEventHandle*& slot, AZStd::vector<ScheduledEventHandle*>& expiredHandles);
+
+        ScheduledEventHandle* m_slots[LevelCount][SlotCount] = {};
+        ScheduledEventHandle* m_expired = nullptr; //< handles inserted with an execute time already reached
+        AZStd::size_t m_levelSizes[LevelCount] = {};
+        int64_t m_currentTimeMs = 0;
+        AZStd::size_t m_size = 0;
+    };
+}
@@ -26,6 +26,7 @@ namespace AZ::IO
         m_conflictResolution = rhs.m_conflictResolution;
         m_isCompressed = rhs.m_isCompressed;
         m_isSharedPak = rhs.m_isSharedPak;
+        m_frames = AZStd::move(rhs.m_frames);
 
         return *this;
     }
@@ -11,6 +11,8 @@
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -31,6 +33,16 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Start of a frame of compressed data that can be decompressed independently of the data before it.
+        struct CompressionFrame
+        {
+            //! Offset of the frame from the start of the compressed data.
+            size_t m_compressedOffset = 0;
+            //! Offset of the decompressed frame from the start of the decompressed data.
+            size_t m_uncompressedOffset = 0;
+        };
+        using CompressionFrames = AZStd::vector<CompressionFrame>;
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -61,6 +73,9 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Frames of the compressed data in order, starting with the one at offset 0. If provided, reads of part of the file only
+            //! need to decompress the frames overlapping the read and the decompressor has to accept any consecutive run of frames.
+            AZStd::shared_ptr<const CompressionFrames> m_frames;
         };
 
         class Compression
@@ -264,6 +264,14 @@ namespace AZ::IO
         //! @return A reference to the provided request.
         virtual FileRequestPtr& SetRequestCompleteCallback(FileRequestPtr& request, OnCompleteCallback callback) = 0;
 
+        //! Sets the category of the data a read request is loading. The category is used to apply bandwidth budgets
+        //! when the scheduler runs in earliest-deadline-first mode and to collect statistics per type of data. Read
+        //! requests that don't have a category assigned use IStreamerTypes::RequestCategory::General.
+        //! @param request The read request that will get the category assigned.
+        //! @param category The category of the data the request reads.
+        //! @return A reference to the provided request.
+        virtual FileRequestPtr& SetRequestCategory(FileRequestPtr& request, IStreamerTypes::RequestCategory category) = 0;
+
         //
         // Streamer request management.
         //
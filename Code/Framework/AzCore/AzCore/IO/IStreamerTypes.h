@@ -34,6 +34,19 @@ namespace AZ::IO::IStreamerTypes
     inline constexpr static Priority s_priorityLow = 63;
     inline constexpr static Priority s_priorityLowest = 0;
 
+    //! The kind of data a read request is loading. The category is used by the scheduler to apply bandwidth budgets
+    //! and to report statistics, such as the number of missed deadlines, per type of data.
+    enum class RequestCategory : u8
+    {
+        General, //!< Data that doesn't belong to any of the other categories.
+        Audio,
+        Textures,
+        Meshes,
+        Script,
+        Count //!< The number of categories. This is not a valid category for requests.
+    };
+    inline constexpr static size_t s_requestCategoryCount = static_cast<size_t>(RequestCategory::Count);
+
     //! Provides configuration recommendations for using the file streaming system.
     struct Recommendations
     {
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/AccessTrace.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+namespace AZ::IO::AccessTrace
+{
+    namespace
+    {
+        constexpr char TraceHeader[] = "# O3DE streamer access trace v1";
+
+        struct State
+        {
+            AZ_CLASS_ALLOCATOR(State, AZ::SystemAllocator, 0);
+
+            AZStd::chrono::system_clock::time_point m_startTime;
+            AZStd::unordered_set<AZStd::string> m_recordedPaths;
+            AZStd::vector<Entry> m_entries;
+        };
+
+        // The state is only allocated while recording, so nothing outlives the allocators when the trace isn't used
+        AZStd::atomic_bool s_recording{ false };
+        AZStd::mutex s_stateMutex;
+        State* s_state = nullptr;
+    }
+
+    void Start()
+    {
+        AZStd::scoped_lock lock(s_stateMutex);
+        delete s_state;
+        s_state = new State;
+        s_state->m_startTime = AZStd::chrono::system_clock::now();
+        s_recording = true;
+    }
+
+    AZStd::vector<Entry> Stop()
+    {
+        AZStd::vector<Entry> entries;
+        AZStd::scoped_lock lock(s_stateMutex);
+        s_recording = false;
+        if (s_state)
+        {
+            entries = AZStd::move(s_state->m_entries);
+            delete s_state;
+            s_state = nullptr;
+        }
+        return entries;
+    }
+
+    bool IsRecording()
+    {
+        return s_recording.load(AZStd::memory_order_relaxed);
+    }
+
+    void Record(AZStd::string_view path)
+    {
+        if (!IsRecording() || path.empty())
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(s_stateMutex);
+        if (s_state && s_state->m_recordedPaths.emplace(path).second)
+        {
+            auto elapsed = AZStd::chrono::system_clock::now() - s_state->m_startTime;
+            Entry& entry = s_state->m_entries.emplace_back();
+            entry.m_path = path;
+            entry.m_firstAccessMs = aznumeric_cast<u64>(AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(elapsed).count());
+        }
+    }
+
+    bool Save(const char* filePath, const AZStd::vector<Entry>& entries)
+    {
+        AZStd::string trace = TraceHeader;
+        trace += '\n';
+        for (const Entry& entry : entries)
+        {
+            trace += AZStd::string::format("%llu %s\n", static_cast<unsigned long long>(entry.m_firstAccessMs), entry.m_path.c_str());
+        }
+
+        SystemFile file;
+        if (!file.Open(filePath, SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Failed to open the access trace file '%s'.", filePath);
+            return false;
+        }
+        const bool written = file.Write(trace.data(), trace.size()) == trace.size();
+        file.Close();
+        return written;
+    }
+
+    bool Load(const char* filePath, AZStd::vector<Entry>& entries)
+    {
+        SystemFile file;
+        if (!file.Open(filePath, SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Failed to open the access trace file '%s'.", filePath);
+            return false;
+        }
+        AZStd::string trace;
+        trace.resize_no_construct(file.Length());
+        const bool read = file.Read(trace.size(), trace.data()) == trace.size();
+        file.Close();
+        if (!read)
+        {
+            AZ_Warning("Streamer", false, "Failed to read the access trace file '%s'.", filePath);
+            return false;
+        }
+
+        bool isHeader = true;
+        bool isValid = true;
+        AZ::StringFunc::TokenizeVisitor(trace, [&](AZStd::string_view line)
+            {
+                line = AZ::StringFunc::StripEnds(line, " \t\r");
+                if (isHeader)
+                {
+                    isHeader = false;
+                    isValid = line == TraceHeader;
+                    return;
+                }
+                if (!isValid || line.empty())
+                {
+                    return;
+                }
+
+                const size_t separator = line.find(' ');
+                if (separator == AZStd::string_view::npos)
+                {
+                    return;
+                }
+                Entry& entry = entries.emplace_back();
+                entry.m_firstAccessMs = AZStd::stoull(AZStd::string(line.substr(0, separator)));
+                entry.m_path = AZ::StringFunc::StripEnds(line.substr(separator + 1));
+            }, "\n");
+
+        AZ_Warning("Streamer", isValid, "The file '%s' isn't a streamer access trace.", filePath);
+        return isValid;
+    }
+} // namespace AZ::IO::AccessTrace
+
+namespace AZ::IO
+{
+    static void streamer_StartAccessTrace([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AccessTrace::Start();
+        AZ_Printf("Streamer", "Recording the file access trace.\n");
+    }
+    AZ_CONSOLEFREEFUNC(streamer_StartAccessTrace, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Starts recording the order in which files are first read, stop with streamer_StopAccessTrace <file>.");
+
+    static void streamer_StopAccessTrace(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("Streamer", false, "streamer_StopAccessTrace expects the path of the file to write.");
+            return;
+        }
+        if (!AccessTrace::IsRecording())
+        {
+            AZ_Warning("Streamer", false, "No file access trace is being recorded, start one with streamer_StartAccessTrace.");
+            return;
+        }
+
+        const AZStd::string filePath(arguments.front());
+        AZStd::vector<AccessTrace::Entry> entries = AccessTrace::Stop();
+        if (AccessTrace::Save(filePath.c_str(), entries))
+        {
+            AZ_Printf("Streamer", "Wrote the access trace of %zu files to %s.\n", entries.size(), filePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(streamer_StopAccessTrace, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Stops recording the file access trace and writes it to <file>, for the AssetBundler to order archives with.");
+} // namespace AZ::IO
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::IO
+{
+    //! Records the order in which files are first read through the streamer, so tools such as the AssetBundler can lay out
+    //! archives in the order the files are loaded at runtime. Recording is started with streamer_StartAccessTrace and written
+    //! to a file with streamer_StopAccessTrace <file>.
+    //! The trace is a text file starting with a header line, followed by one "<milliseconds since start> <path>" line per file.
+    namespace AccessTrace
+    {
+        struct Entry
+        {
+            AZStd::string m_path;
+            u64 m_firstAccessMs = 0;
+        };
+
+        //! Starts recording, dropping any previously recorded accesses.
+        void Start();
+        //! Stops recording and returns the recorded files in order of first access.
+        AZStd::vector<Entry> Stop();
+        bool IsRecording();
+
+        //! Called by the scheduler for every read request, only the first access to a path is kept.
+        void Record(AZStd::string_view path);
+
+        bool Save(const char* filePath, const AZStd::vector<Entry>& entries);
+        bool Load(const char* filePath, AZStd::vector<Entry>& entries);
+    } // namespace AccessTrace
+} // namespace AZ::IO
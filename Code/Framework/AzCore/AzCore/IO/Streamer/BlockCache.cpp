@@ -46,7 +46,8 @@ namespace AZ::IO
         }
 
         auto stackEntry = AZStd::make_shared<BlockCache>(
-            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false);
+            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false,
+            m_adaptive, m_maxReadAheadBlocks);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -62,15 +63,30 @@ namespace AZ::IO
                 ->Value("SizeAlignment", BlockSize::SizeAlignment);
 
             serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                ->Field("Adaptive", &BlockCacheConfig::m_adaptive)
+                ->Field("MaxReadAheadBlocks", &BlockCacheConfig::m_maxReadAheadBlocks);
         }
     }
 
     static constexpr char CacheHitRateName[] = "Cache hit rate";
     static constexpr char CacheableName[] = "Cacheable";
 
+    BlockCache::AccessPattern BlockCache::FileAccessHistory::GetPattern() const
+    {
+        if (m_sequentialScore >= s_sequentialThreshold)
+        {
+            return AccessPattern::Sequential;
+        }
+        else if (m_sequentialScore <= s_randomThreshold)
+        {
+            return AccessPattern::Random;
+        }
+        return AccessPattern::Unknown;
+    }
+
     void BlockCache::Section::Prefix(const Section& section)
     {
         AZ_Assert(section.m_used, "Trying to prefix an unused section");
@@ -99,10 +115,11 @@ namespace AZ::IO
         m_blockOffset = 0; // Two merged sections do not support caching.
     }
 
-    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, bool adaptive, u32 maxReadAheadBlocks)
         : StreamStackEntry("Block cache")
         , m_alignment(alignment)
         , m_onlyEpilogWrites(onlyEpilogWrites)
+        , m_adaptive(adaptive)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
         AZ_Assert(IStreamerTypes::IsAlignedTo(blockSize, alignment), "Block size needs to be a multiple of the alignment.");
@@ -121,6 +138,14 @@ namespace AZ::IO
         m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
         m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
         m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+        m_isReadAhead = AZStd::unique_ptr<bool[]>(new bool[m_numBlocks]);
+
+        if (m_adaptive)
+        {
+            m_accessHistory = AZStd::unique_ptr<FileAccessHistory[]>(new FileAccessHistory[s_maxTrackedFiles]);
+            // Keep at least half the blocks available for the requests themselves.
+            m_maxReadAheadBlocks = AZStd::min(maxReadAheadBlocks, m_numBlocks / 2);
+        }
 
         ResetCache();
     }
@@ -152,6 +177,10 @@ namespace AZ::IO
                 {
                     FlushEntireCache();
                 }
+                else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+                {
+                    Report(args);
+                }
                 StreamStackEntry::QueueRequest(request);
             }
         }, request->GetCommand());
@@ -281,7 +310,24 @@ namespace AZ::IO
             return;
         }
 
-        if (prolog.m_used || epilog.m_used)
+        u32 readAheadDepth = 0;
+        if (m_adaptive)
+        {
+            FileAccessHistory& history = UpdateAccessHistory(data.m_path, data.m_offset, data.m_size);
+            if (ShouldBypassCache(history))
+            {
+                // Mostly random reads that rarely hit the cache so read directly and leave the cache to files that benefit from it.
+                m_bypassCount++;
+                m_cacheableStat.PushSample(0.0);
+                Statistic::PlotImmediate(m_name, CacheableName, m_cacheableStat.GetMostRecentSample());
+                m_next->QueueRequest(request);
+                return;
+            }
+            readAheadDepth = CalculateReadAheadDepth(history);
+            m_activeHistory = &history;
+        }
+
+        if (prolog.m_used || epilog.m_used || readAheadDepth > 0)
         {
             m_cacheableStat.PushSample(1.0);
             Statistic::PlotImmediate(m_name, CacheableName, m_cacheableStat.GetMostRecentSample());
@@ -292,6 +338,7 @@ namespace AZ::IO
             m_cacheableStat.PushSample(0.0);
             Statistic::PlotImmediate(m_name, CacheableName, m_cacheableStat.GetMostRecentSample());
             m_next->QueueRequest(request);
+            m_activeHistory = nullptr;
             return;
         }
 
@@ -309,13 +356,11 @@ namespace AZ::IO
                     // so it's read in one read request. If main wasn't used, prefixing the prolog
                     // will cause it to be filled in and used.
                     main.Prefix(prolog);
-                    m_hitRateStat.PushSample(0.0);
-                    Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                    RecordCacheAccess(false);
                 }
                 else
                 {
-                    m_hitRateStat.PushSample(1.0);
-                    Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                    RecordCacheAccess(true);
                 }
             }
             else
@@ -332,6 +377,12 @@ namespace AZ::IO
             }
         }
 
+        if (main.m_used && m_adaptive)
+        {
+            // Blocks that were read ahead can be in the middle of a request, so use them instead of reading the data again.
+            fullyCached = ReadMainFromCache(request, main, data.m_path) && fullyCached;
+        }
+
         if (main.m_used)
         {
             FileRequest* mainRequest = m_context->GetNewInternalRequest();
@@ -351,6 +402,13 @@ namespace AZ::IO
             Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
         }
 
+        if (readAheadDepth > 0)
+        {
+            u64 readAheadOffset = AZ_SIZE_ALIGN_UP(data.m_offset + data.m_size, aznumeric_cast<u64>(m_blockSize));
+            ReadAhead(data.m_path, fileLength, readAheadOffset, readAheadDepth, data.m_sharedRead);
+        }
+        m_activeHistory = nullptr;
+
         if (fullyCached)
         {
             request->SetStatus(IStreamerTypes::RequestStatus::Completed);
@@ -379,6 +437,15 @@ namespace AZ::IO
         statistics.push_back(Statistic::CreatePercentage(m_name, CacheHitRateName, CalculateHitRatePercentage()));
         statistics.push_back(Statistic::CreatePercentage(m_name, CacheableName, CalculateCacheableRatePercentage()));
         statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateAvailableRequestSlots()));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Hits", aznumeric_cast<s64>(m_hitCount)));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Misses", aznumeric_cast<s64>(m_missCount)));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Evictions", aznumeric_cast<s64>(m_evictionCount)));
+        if (m_adaptive)
+        {
+            statistics.push_back(Statistic::CreateInteger(m_name, "Read-ahead blocks", aznumeric_cast<s64>(m_readAheadCount)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Read-ahead hits", aznumeric_cast<s64>(m_readAheadHitCount)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Bypassed reads", aznumeric_cast<s64>(m_bypassCount)));
+        }
 
         StreamStackEntry::CollectStatistics(statistics);
     }
@@ -414,6 +481,12 @@ namespace AZ::IO
 
     BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, u32 cacheBlock)
     {
+        if (m_isReadAhead[cacheBlock])
+        {
+            m_readAheadHitCount++;
+            m_isReadAhead[cacheBlock] = false;
+        }
+
         if (!IsCacheBlockInFlight(cacheBlock))
         {
             TouchBlock(cacheBlock);
@@ -441,8 +514,7 @@ namespace AZ::IO
         u32 cacheLocation = FindInCache(filePath, section.m_readOffset);
         if (cacheLocation == s_fileNotCached)
         {
-            m_hitRateStat.PushSample(0.0);
-            Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+            RecordCacheAccess(false);
 
             section.m_parent = request;
             cacheLocation = RecycleOldestBlock(filePath, section.m_readOffset);
@@ -494,8 +566,7 @@ namespace AZ::IO
                 section.m_wait = nullptr;
             }
 
-            m_hitRateStat.PushSample(1.0);
-            Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+            RecordCacheAccess(true);
 
             return ReadFromCache(request, section, cacheLocation);
         }
@@ -522,7 +593,8 @@ namespace AZ::IO
                 section.m_wait = nullptr;
             }
 
-            if (requestWasSuccessful)
+            // Sections for blocks that are read ahead don't have an output.
+            if (requestWasSuccessful && section.m_output)
             {
                 memcpy(section.m_output, GetCacheBlockData(cacheBlockIndex) + section.m_blockOffset, section.m_copySize);
             }
@@ -542,6 +614,185 @@ namespace AZ::IO
         m_pendingRequests.erase(&request);
     }
 
+    bool BlockCache::ReadMainFromCache(FileRequest* request, Section& main, const RequestPath& filePath)
+    {
+        bool fullyCached = true;
+        // Only the front of the main section is checked as that's where blocks read ahead by a previous request will be.
+        while (main.m_used && IStreamerTypes::IsAlignedTo(main.m_readOffset, m_blockSize))
+        {
+            u32 cacheLocation = FindInCache(filePath, main.m_readOffset);
+            if (cacheLocation == s_fileNotCached)
+            {
+                break;
+            }
+
+            Section cached;
+            cached.m_output = main.m_output;
+            cached.m_readOffset = main.m_readOffset;
+            cached.m_readSize = m_blockSize;
+            cached.m_copySize = AZStd::min(aznumeric_cast<u64>(m_blockSize), main.m_readSize);
+            cached.m_used = true;
+            RecordCacheAccess(true);
+            fullyCached = (ReadFromCache(request, cached, cacheLocation) == CacheResult::ReadFromCache) && fullyCached;
+
+            main.m_readOffset += cached.m_copySize;
+            main.m_readSize -= cached.m_copySize;
+            main.m_output += cached.m_copySize;
+            main.m_used = main.m_readSize > 0;
+        }
+        return fullyCached;
+    }
+
+    void BlockCache::ReadAhead(const RequestPath& filePath, u64 fileLength, u64 offset, u32 blockCount, bool sharedRead)
+    {
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            u64 blockOffset = offset + (aznumeric_cast<u64>(i) * m_blockSize);
+            // Don't let reading ahead take away the slots needed for the requests themselves.
+            if (blockOffset >= fileLength || CalculateAvailableRequestSlots() <= aznumeric_cast<s32>(m_numBlocks / 2))
+            {
+                return;
+            }
+            if (FindInCache(filePath, blockOffset) != s_fileNotCached)
+            {
+                continue;
+            }
+
+            u32 cacheLocation = RecycleOldestBlock(filePath, blockOffset);
+            if (cacheLocation == s_fileNotCached)
+            {
+                return;
+            }
+
+            Section section;
+            section.m_readOffset = blockOffset;
+            section.m_readSize = AZStd::min(aznumeric_cast<u64>(m_blockSize), fileLength - blockOffset);
+            section.m_cacheBlockIndex = cacheLocation;
+            section.m_used = true;
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(nullptr, GetCacheBlockData(cacheLocation), m_blockSize, filePath, section.m_readOffset,
+                section.m_readSize, sharedRead);
+            readRequest->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    CompleteRead(request);
+                });
+            m_inFlightRequests[cacheLocation] = readRequest;
+            m_isReadAhead[cacheLocation] = true;
+            m_numInFlightRequests++;
+            m_readAheadCount++;
+
+            m_pendingRequests.emplace(readRequest, section);
+            m_next->QueueRequest(readRequest);
+        }
+    }
+
+    void BlockCache::RecordCacheAccess(bool hit)
+    {
+        m_hitRateStat.PushSample(hit ? 1.0 : 0.0);
+        Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+
+        if (hit)
+        {
+            m_hitCount++;
+        }
+        else
+        {
+            m_missCount++;
+        }
+
+        if (m_activeHistory)
+        {
+            // Halve the counters once in a while so the hit rate follows changes in how the file is used.
+            if (m_activeHistory->m_cacheHits + m_activeHistory->m_cacheMisses >= 64)
+            {
+                m_activeHistory->m_cacheHits >>= 1;
+                m_activeHistory->m_cacheMisses >>= 1;
+            }
+            (hit ? m_activeHistory->m_cacheHits : m_activeHistory->m_cacheMisses)++;
+        }
+    }
+
+    BlockCache::FileAccessHistory& BlockCache::UpdateAccessHistory(const RequestPath& filePath, u64 offset, u64 size)
+    {
+        AZ_Assert(m_accessHistory, "Access history for the BlockCache is only available in adaptive mode.");
+
+        // Find the history for the file or otherwise recycle the history of the file that was least recently read.
+        FileAccessHistory* history = &m_accessHistory[0];
+        for (u32 i = 0; i < s_maxTrackedFiles; ++i)
+        {
+            if (m_accessHistory[i].m_path == filePath)
+            {
+                history = &m_accessHistory[i];
+                break;
+            }
+            if (m_accessHistory[i].m_lastAccess < history->m_lastAccess)
+            {
+                history = &m_accessHistory[i];
+            }
+        }
+        if (history->m_path != filePath)
+        {
+            *history = FileAccessHistory{};
+            history->m_path = filePath;
+        }
+
+        // Reads that start inside the block the previous read ended in, are considered sequential. This allows for small gaps
+        // between reads, such as padding.
+        bool isSequential = offset >= history->m_nextSequentialOffset && offset - history->m_nextSequentialOffset < m_blockSize;
+        history->m_sequentialScore = AZStd::clamp(history->m_sequentialScore + (isSequential ? 1 : -1),
+            s_minSequentialScore, s_maxSequentialScore);
+        history->m_nextSequentialOffset = offset + size;
+        history->m_bytesRequested += size;
+        history->m_readCount++;
+        history->m_lastAccess = AZStd::chrono::system_clock::now();
+        return *history;
+    }
+
+    u32 BlockCache::CalculateReadAheadDepth(const FileAccessHistory& history) const
+    {
+        // Read further ahead the longer the file has been read sequentially.
+        return history.GetPattern() == AccessPattern::Sequential
+            ? AZStd::min(aznumeric_cast<u32>(history.m_sequentialScore - s_sequentialThreshold + 1), m_maxReadAheadBlocks)
+            : 0;
+    }
+
+    bool BlockCache::ShouldBypassCache(const FileAccessHistory& history) const
+    {
+        // Random reads that hit the cache less than 20% of the time.
+        return
+            history.GetPattern() == AccessPattern::Random &&
+            history.m_cacheMisses > history.m_cacheHits * 4 &&
+            (history.m_readCount % s_bypassProbeInterval) != 0;
+    }
+
+    void BlockCache::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case Requests::ReportType::CacheHeat:
+            if (m_accessHistory)
+            {
+                constexpr const char* patternNames[] = { "unknown", "sequential", "random" };
+                for (u32 i = 0; i < s_maxTrackedFiles; ++i)
+                {
+                    const FileAccessHistory& history = m_accessHistory[i];
+                    if (history.m_readCount > 0)
+                    {
+                        AZ_Printf("Streamer", "Cache heat in %s : '%s' - %s, %u reads, %llu bytes, %u hits, %u misses, %u blocks read ahead.\n",
+                            m_name.c_str(), history.m_path.GetRelativePath(), patternNames[static_cast<u8>(history.GetPattern())],
+                            history.m_readCount, history.m_bytesRequested, history.m_cacheHits, history.m_cacheMisses,
+                            CalculateReadAheadDepth(history));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
     bool BlockCache::SplitRequest(Section& prolog, Section& main, Section& epilog,
         [[maybe_unused]] const RequestPath& filePath, u64 fileLength,
         u64 offset, u64 size, u8* buffer) const
@@ -695,6 +946,12 @@ namespace AZ::IO
         if (!IsCacheBlockInFlight(oldestIndex))
         {
             // Recycle the block.
+            if (m_blockLastTouched[oldestIndex] != TimePoint::min())
+            {
+                // The block held data, as opposed to having been reset, so it's evicted.
+                m_evictionCount++;
+            }
+            m_isReadAhead[oldestIndex] = false;
             m_cachedPaths[oldestIndex] = filePath;
             m_cachedOffsets[oldestIndex] = offset;
             TouchBlock(oldestIndex);
@@ -734,6 +991,7 @@ namespace AZ::IO
         m_cachedOffsets[index] = 0;
         m_blockLastTouched[index] = TimePoint::min();
         m_inFlightRequests[index] = nullptr;
+        m_isReadAhead[index] = false;
     }
 
     void BlockCache::ResetCache()
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -21,10 +22,10 @@
 
 namespace AZ::IO
 {
-    class RequestPath;
     namespace Requests
     {
         struct ReadData;
+        struct ReportData;
     }
 
     struct BlockCacheConfig final :
@@ -54,13 +55,19 @@ namespace AZ::IO
         u32 m_cacheSizeMib{ 8 };
         //! The size of the individual blocks inside the cache.
         BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+        //! If true, the cache keeps track of how files are accessed and adapts per file. Files that are read sequentially
+        //! have blocks read ahead of the requests, while files that are read at random and rarely hit the cache bypass it so
+        //! they don't evict blocks that are reused.
+        bool m_adaptive{ false };
+        //! The maximum number of blocks that are read ahead for files that are read sequentially. Only used in adaptive mode.
+        u32 m_maxReadAheadBlocks{ 4 };
     };
 
     class BlockCache
         : public StreamStackEntry
     {
     public:
-        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, bool adaptive = false, u32 maxReadAheadBlocks = 0);
         BlockCache(BlockCache&& rhs) = delete;
         BlockCache(const BlockCache& rhs) = delete;
         ~BlockCache() override;
@@ -88,6 +95,24 @@ namespace AZ::IO
 
     protected:
         static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
+        //! The number of files for which the access history is kept in adaptive mode.
+        static constexpr u32 s_maxTrackedFiles = 64;
+        //! The sequential score at which a file is considered to be read sequentially.
+        static constexpr s32 s_sequentialThreshold = 2;
+        static constexpr s32 s_maxSequentialScore = 8;
+        //! The sequential score at which a file is considered to be read at random.
+        static constexpr s32 s_randomThreshold = -2;
+        static constexpr s32 s_minSequentialScore = -4;
+        //! Reads of files that bypass the cache are still sent through the cache once every this many reads so a change in the
+        //! hit rate can be detected.
+        static constexpr u32 s_bypassProbeInterval = 16;
+
+        enum class AccessPattern : u8
+        {
+            Unknown,
+            Sequential,
+            Random
+        };
 
         enum class CacheResult
         {
@@ -115,12 +140,35 @@ namespace AZ::IO
 
         using TimePoint = AZStd::chrono::system_clock::time_point;
 
+        //! The recent access history of a single file, used in adaptive mode.
+        struct FileAccessHistory
+        {
+            AccessPattern GetPattern() const;
+
+            RequestPath m_path;
+            TimePoint m_lastAccess{ TimePoint::min() };
+            u64 m_nextSequentialOffset{ 0 }; //!< The offset the next read starts at if the file is read sequentially.
+            u64 m_bytesRequested{ 0 };
+            u32 m_readCount{ 0 };
+            u32 m_cacheHits{ 0 };
+            u32 m_cacheMisses{ 0 };
+            s32 m_sequentialScore{ 0 }; //!< Goes up for every sequential read and down for every random read.
+        };
+
         void ReadFile(FileRequest* request, Requests::ReadData& data);
         void ContinueReadFile(FileRequest* request, u64 fileLength);
         CacheResult ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath);
         CacheResult ReadFromCache(FileRequest* request, Section& section, u32 cacheBlock);
         CacheResult ServiceFromCache(FileRequest* request, Section& section, const RequestPath& filePath, bool sharedRead);
         void CompleteRead(FileRequest& request);
+        bool ReadMainFromCache(FileRequest* request, Section& main, const RequestPath& filePath);
+        void ReadAhead(const RequestPath& filePath, u64 fileLength, u64 offset, u32 blockCount, bool sharedRead);
+        void RecordCacheAccess(bool hit);
+        void Report(const Requests::ReportData& data) const;
+
+        FileAccessHistory& UpdateAccessHistory(const RequestPath& filePath, u64 offset, u64 size);
+        u32 CalculateReadAheadDepth(const FileAccessHistory& history) const;
+        bool ShouldBypassCache(const FileAccessHistory& history) const;
         bool SplitRequest(Section& prolog, Section& main, Section& epilog, const RequestPath& filePath, u64 fileLength,
             u64 offset, u64 size, u8* buffer) const;
 
@@ -140,6 +188,13 @@ namespace AZ::IO
         AZ::Statistics::RunningStatistic m_hitRateStat;
         AZ::Statistics::RunningStatistic m_cacheableStat;
 
+        u64 m_hitCount{ 0 };
+        u64 m_missCount{ 0 };
+        u64 m_evictionCount{ 0 };
+        u64 m_readAheadCount{ 0 };
+        u64 m_readAheadHitCount{ 0 };
+        u64 m_bypassCount{ 0 };
+
         u8* m_cache;
         u64 m_cacheSize;
         u32 m_blockSize;
@@ -154,11 +209,21 @@ namespace AZ::IO
         AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
         //! The file request that's currently read data into the cache block. If null, the block has been read.
         AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+        //! Whether or not the cache block was read ahead of a request and hasn't been used yet.
+        AZStd::unique_ptr<bool[]> m_isReadAhead; // Array of m_numBlocks size.
+        //! The access history of the most recently read files. Only allocated in adaptive mode.
+        AZStd::unique_ptr<FileAccessHistory[]> m_accessHistory; // Array of s_maxTrackedFiles size.
+        //! The history of the file that's currently being processed, if any.
+        FileAccessHistory* m_activeHistory{ nullptr };
 
         //! The number of requests waiting for meta data to be retrieved.
         s32 m_numMetaDataRetrievalInProgress{ 0 };
+        //! The maximum number of blocks read ahead for sequentially read files in adaptive mode.
+        u32 m_maxReadAheadBlocks{ 0 };
         //! Whether or not only the epilog ever writes to the cache.
         bool m_onlyEpilogWrites;
+        //! Whether or not the cache adapts to the access patterns of individual files.
+        bool m_adaptive{ false };
     };
 } // namespace AZ::IO
 
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/ExternalDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> ExternalDecompressorConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<ExternalDecompressor>(
+            m_maxNumReads, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void ExternalDecompressorConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<ExternalDecompressorConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxNumReads", &ExternalDecompressorConfig::m_maxNumReads);
+        }
+    }
+
+    ExternalDecompressor::ExternalDecompressor(u32 maxNumReads, u32 alignment)
+        : StreamStackEntry("External decompressor")
+        , m_maxNumReads(AZStd::max(maxNumReads, 1u))
+        , m_alignment(AZStd::max(alignment, 1u))
+    {
+        m_readSlots.resize(m_maxNumReads);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_decompressionTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+        m_bytesHandedOver.PushEntry(1);
+    }
+
+    void ExternalDecompressor::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (auto data = AZStd::get_if<Requests::CompressedReadData>(&request->GetCommand()); data != nullptr && m_next)
+        {
+            if (ExternalDecompression* handler = FindHandler(*data); handler != nullptr)
+            {
+                m_pendingReads.push_back(PendingRead{ request, handler });
+                return;
+            }
+        }
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    bool ExternalDecompressor::ExecuteRequests()
+    {
+        bool result = false;
+        while (!m_pendingReads.empty() && m_numActiveSlots < m_maxNumReads)
+        {
+            if (!StartRead(m_pendingReads.front()))
+            {
+                if (m_numActiveSlots > 0)
+                {
+                    // Wait for the in-flight decompressions to return staging memory to the handler.
+                    break;
+                }
+                // Nothing is in flight which could free up staging memory, so let the next entry decompress on the CPU.
+                StreamStackEntry::QueueRequest(m_pendingReads.front().m_request);
+                m_numFallbacks++;
+            }
+            m_pendingReads.pop_front();
+            result = true;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || result;
+    }
+
+    void ExternalDecompressor::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        s32 numAvailableSlots = aznumeric_cast<s32>(m_maxNumReads - m_numActiveSlots);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, numAvailableSlots);
+        status.m_isIdle = status.m_isIdle && IsIdle();
+    }
+
+    void ExternalDecompressor::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        double totalDecompressionTimeUs = aznumeric_caster(m_decompressionTimeAverage.GetTotal().count());
+        double totalBytes = aznumeric_caster(m_bytesHandedOver.GetTotal());
+        auto estimateDecompression = [totalDecompressionTimeUs, totalBytes](const FileRequest* compressedRequest)
+        {
+            auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Compressed request in the ExternalDecompressor didn't contain compression read data.");
+            return AZStd::chrono::microseconds(aznumeric_cast<u64>(
+                (data->m_compressionInfo.m_compressedSize * totalDecompressionTimeUs) / totalBytes));
+        };
+
+        // Reads into staging buffers are estimated by the next entries, so only the decompression needs to be added.
+        AZStd::chrono::system_clock::time_point latest = now;
+        for (const ReadSlot& slot : m_readSlots)
+        {
+            if (!slot.m_request)
+            {
+                continue;
+            }
+
+            AZStd::chrono::system_clock::time_point estimate;
+            if (AZStd::holds_alternative<Requests::WaitData>(slot.m_request->GetCommand()))
+            {
+                estimate = AZStd::max(now, slot.m_startTime + estimateDecompression(slot.m_request->GetParent()));
+            }
+            else
+            {
+                estimate = slot.m_request->GetEstimatedCompletion();
+                if (estimate == AZStd::chrono::system_clock::time_point())
+                {
+                    estimate = now;
+                }
+                estimate += estimateDecompression(slot.m_request->GetParent());
+            }
+            slot.m_request->SetEstimatedCompletion(estimate);
+            latest = AZStd::max(latest, estimate);
+        }
+
+        for (const PendingRead& pending : m_pendingReads)
+        {
+            latest += estimateDecompression(pending.m_request);
+            pending.m_request->SetEstimatedCompletion(latest);
+        }
+    }
+
+    void ExternalDecompressor::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+        constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+
+        if (m_bytesHandedOver.GetNumRecorded() > 1) // There's always a default added.
+        {
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", m_maxNumReads - m_numActiveSlots));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Decompressing", m_numDecompressing));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Pending", aznumeric_cast<s64>(m_pendingReads.size())));
+            statistics.push_back(Statistic::CreateInteger(m_name, "CPU fallbacks", aznumeric_cast<s64>(m_numFallbacks)));
+
+            double totalBytesMB = m_bytesHandedOver.GetTotal() * bytesToMB;
+            double totalTimeSec = m_decompressionTimeAverage.GetTotal().count() * usToSec;
+            statistics.push_back(Statistic::CreateFloat(m_name, "Decompression speed (avg. mbps)", totalBytesMB / totalTimeSec));
+        }
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool ExternalDecompressor::IsIdle() const
+    {
+        return m_pendingReads.empty() && m_numActiveSlots == 0;
+    }
+
+    ExternalDecompression* ExternalDecompressor::FindHandler(const Requests::CompressedReadData& data) const
+    {
+        ExternalDecompression* result = nullptr;
+        if (ExternalDecompressionBus::HasHandlers())
+        {
+            ExternalDecompressionBus::EnumerateHandlers([&result, &data](ExternalDecompression* handler)
+                {
+                    if (handler->CanDecompress(data.m_compressionInfo, data.m_readOffset, data.m_readSize))
+                    {
+                        result = handler;
+                        return false;
+                    }
+                    return true;
+                });
+        }
+        return result;
+    }
+
+    u32 ExternalDecompressor::FindFreeSlot() const
+    {
+        for (u32 i = 0; i < m_maxNumReads; ++i)
+        {
+            if (!m_readSlots[i].m_request)
+            {
+                return i;
+            }
+        }
+        AZ_Assert(false, "%u of %u read slots are use in the ExternalDecompressor, but no empty slot was found.",
+            m_numActiveSlots, m_maxNumReads);
+        return m_maxNumReads;
+    }
+
+    bool ExternalDecompressor::StartRead(const PendingRead& pending)
+    {
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&pending.m_request->GetCommand());
+        AZ_Assert(data, "Compressed request that's starting a read in ExternalDecompressor didn't contain compression read data.");
+        const CompressionInfo& info = data->m_compressionInfo;
+
+        // Same as the FullFileDecompressor, the buffer is aligned down but the offset is not corrected so the
+        // caches further down the stack can still detect reads to the same data.
+        size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
+        size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        void* stagingBuffer = pending.m_handler->AcquireStagingBuffer(bufferSize, m_alignment);
+        if (!stagingBuffer)
+        {
+            return false;
+        }
+
+        u32 readSlot = FindFreeSlot();
+        ReadSlot& slot = m_readSlots[readSlot];
+        slot.m_handler = pending.m_handler;
+        slot.m_stagingBuffer = stagingBuffer;
+        slot.m_alignmentOffset = aznumeric_caster(offsetAdjustment);
+
+        FileRequest* readRequest = m_context->GetNewInternalRequest();
+        readRequest->CreateRead(pending.m_request, reinterpret_cast<u8*>(stagingBuffer) + offsetAdjustment, bufferSize - offsetAdjustment,
+            info.m_archiveFilename, info.m_offset, info.m_compressedSize, info.m_isSharedPak);
+        readRequest->SetCompletionCallback([this, readSlot](FileRequest& request)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                FinishRead(&request, readSlot);
+            });
+        slot.m_request = readRequest;
+        m_numActiveSlots++;
+
+        m_next->QueueRequest(readRequest);
+        return true;
+    }
+
+    void ExternalDecompressor::FinishRead(FileRequest* readRequest, u32 readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+        AZ_Assert(slot.m_request == readRequest, "Request in the external decompressor read slot isn't the same as request that's being completed.");
+
+        FileRequest* compressedRequest = readRequest->GetParent();
+        AZ_Assert(compressedRequest, "Read requests started by ExternalDecompressor is missing a parent request.");
+
+        if (readRequest->GetStatus() != IStreamerTypes::RequestStatus::Completed)
+        {
+            slot.m_handler->ReleaseStagingBuffer(slot.m_stagingBuffer);
+            slot = ReadSlot{};
+            AZ_Assert(m_numActiveSlots > 0, "Trying to release a read slot in the ExternalDecompressor, but no slots are in use.");
+            m_numActiveSlots--;
+            return;
+        }
+
+        // Add a wait so the compressed request isn't completed until the handler reports the decompression has finished.
+        FileRequest* waitRequest = m_context->GetNewInternalRequest();
+        waitRequest->CreateWait(compressedRequest);
+        waitRequest->SetCompletionCallback([this, readSlot](FileRequest&)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                FinishDecompression(readSlot);
+            });
+        slot.m_request = waitRequest;
+        slot.m_startTime = AZStd::chrono::system_clock::now();
+        m_numDecompressing++;
+
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(data, "Compressed request in ExternalDecompressor that finished reading didn't contain compression read data.");
+        m_bytesHandedOver.PushEntry(data->m_compressionInfo.m_compressedSize);
+
+        void* stagingBuffer = slot.m_stagingBuffer;
+        slot.m_stagingBuffer = nullptr; // Ownership is transferred to the handler.
+        slot.m_handler->Decompress(data->m_compressionInfo, stagingBuffer, slot.m_alignmentOffset,
+            data->m_output, data->m_readOffset, data->m_readSize,
+            [context = m_context, waitRequest](bool success)
+            {
+                waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+                context->MarkRequestAsCompleted(waitRequest);
+                context->WakeUpSchedulingThread();
+            });
+    }
+
+    void ExternalDecompressor::FinishDecompression(u32 readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+        m_decompressionTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            AZStd::chrono::system_clock::now() - slot.m_startTime));
+        slot = ReadSlot{};
+
+        AZ_Assert(m_numDecompressing > 0, "About to complete an external decompression, but the internal count doesn't see a running one.");
+        m_numDecompressing--;
+        AZ_Assert(m_numActiveSlots > 0, "Trying to release a read slot in the ExternalDecompressor, but no slots are in use.");
+        m_numActiveSlots--;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct CompressedReadData;
+    }
+
+    //! Interface for decompressors that live outside of the streaming stack, such as a renderer that decompresses blocks
+    //! with a compute shader or a hardware decompression api. Instead of the Streamer reading compressed data into a
+    //! temporary buffer and inflating it on a CPU worker thread, the compressed data is read directly into staging memory
+    //! provided by the handler, for instance an upload heap, after which the handler takes over the decompression.
+    //! Handlers are called from the Streamer's scheduler thread and need to stay connected while they have staging
+    //! buffers or decompressions in flight.
+    class ExternalDecompression
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        using MutexType = AZStd::recursive_mutex;
+
+        //! Callback the handler calls exactly once when a decompression has completed. This can be called from any thread.
+        using CompletionCallback = AZStd::function<void(bool success)>;
+
+        virtual ~ExternalDecompression() = default;
+
+        //! Whether or not this handler can decompress the given (part of a) file. Handlers can for instance decline
+        //! partial reads or files that are too small for the overhead of a gpu dispatch to pay off.
+        virtual bool CanDecompress(const CompressionInfo& info, u64 readOffset, u64 readSize) const = 0;
+        //! Returns memory the compressed data will be read into. The memory needs to remain valid and be CPU writable until
+        //! it's either given back with ReleaseStagingBuffer or handed over with Decompress. If no memory is available at the
+        //! moment nullptr can be returned, in which case the request is retried later or decompressed by the next entry
+        //! in the stack.
+        virtual void* AcquireStagingBuffer(size_t size, size_t alignment) = 0;
+        //! Returns a staging buffer that went unused because the read failed or was canceled.
+        virtual void ReleaseStagingBuffer(void* stagingBuffer) = 0;
+        //! Starts decompressing the compressed data found at compressedOffset in the staging buffer. The handler owns the
+        //! staging buffer from this point on. The output and read range are passed as provided by the original read request.
+        virtual void Decompress(const CompressionInfo& info, void* stagingBuffer, size_t compressedOffset,
+            void* output, u64 readOffset, u64 readSize, CompletionCallback onCompleted) = 0;
+    };
+
+    using ExternalDecompressionBus = AZ::EBus<ExternalDecompression>;
+
+    struct ExternalDecompressorConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::ExternalDecompressorConfig, "{5B0D6E6A-33F4-4E8F-9B0B-97C4D2A1E0F3}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(ExternalDecompressorConfig, AZ::SystemAllocator, 0);
+
+        ~ExternalDecompressorConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Maximum number of reads into staging buffers that are kept in flight.
+        u32 m_maxNumReads{ 4 };
+    };
+
+    //! Entry in the streaming stack that hands compressed reads over to an external decompressor, such as the renderer.
+    //! This entry needs to be placed above the FullFileDecompressor so it receives the compressed reads the
+    //! decompressor creates. Compressed reads that no handler on the ExternalDecompressionBus accepts are forwarded
+    //! to the next entry so they're decompressed on the CPU as usual.
+    class ExternalDecompressor
+        : public StreamStackEntry
+    {
+    public:
+        ExternalDecompressor(u32 maxNumReads, u32 alignment);
+        ~ExternalDecompressor() override = default;
+
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    private:
+        struct PendingRead
+        {
+            FileRequest* m_request{ nullptr };
+            ExternalDecompression* m_handler{ nullptr };
+        };
+
+        struct ReadSlot
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            ExternalDecompression* m_handler{ nullptr };
+            FileRequest* m_request{ nullptr }; //!< The read into the staging buffer or the wait for the decompression to complete.
+            void* m_stagingBuffer{ nullptr };
+            u32 m_alignmentOffset{ 0 };
+        };
+
+        bool IsIdle() const;
+
+        ExternalDecompression* FindHandler(const Requests::CompressedReadData& data) const;
+        //! Starts the read for the oldest pending request. Returns false if the handler has no staging memory available.
+        bool StartRead(const PendingRead& pending);
+        void FinishRead(FileRequest* readRequest, u32 readSlot);
+        void FinishDecompression(u32 readSlot);
+        u32 FindFreeSlot() const;
+
+        AZStd::deque<PendingRead> m_pendingReads;
+        AZStd::vector<ReadSlot> m_readSlots;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_decompressionTimeAverage;
+        AverageWindow<u64, double, s_statisticsWindowSize> m_bytesHandedOver;
+
+        u32 m_maxNumReads{ 4 };
+        u32 m_numActiveSlots{ 0 };
+        u32 m_numDecompressing{ 0 };
+        u32 m_alignment{ 0 };
+        size_t m_numFallbacks{ 0 };
+    };
+} // namespace AZ::IO
@@ -45,6 +45,7 @@ namespace AZ::IO::Requests
         , m_size(size)
         , m_priority(priority)
         , m_memoryType(IStreamerTypes::MemoryType::ReadWrite) // Only generic memory can be assigned externally.
+        , m_category(IStreamerTypes::RequestCategory::General)
     {
     }
 
@@ -64,6 +65,7 @@ namespace AZ::IO::Requests
         , m_size(size)
         , m_priority(priority)
         , m_memoryType(IStreamerTypes::MemoryType::ReadWrite) // Only generic memory can be assigned externally.
+        , m_category(IStreamerTypes::RequestCategory::General)
     {
     }
 
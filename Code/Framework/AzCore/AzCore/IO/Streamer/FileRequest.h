@@ -75,12 +75,14 @@ namespace AZ::IO::Requests
         RequestPath m_path; //!< Relative path to the target file.
         IStreamerTypes::RequestMemoryAllocator* m_allocator; //!< Allocator used to manage the memory for this request.
         AZStd::chrono::system_clock::time_point m_deadline; //!< Time by which this request should have been completed.
+        AZStd::chrono::system_clock::time_point m_queuedTime; //!< Time the scheduler picked up the request.
         void* m_output; //!< The memory address assigned (during processing) to store the read data to.
         u64 m_outputSize; //!< The memory size of the addressed used to store the read data.
         u64 m_offset; //!< The offset in bytes into the file.
         u64 m_size; //!< The number of bytes to read from the file.
         IStreamerTypes::Priority m_priority; //!< Priority used for ordering requests. This is used when requests have the same deadline.
         IStreamerTypes::MemoryType m_memoryType; //!< The type of memory provided by the allocator if used.
+        IStreamerTypes::RequestCategory m_category; //!< The kind of data that's being read. Used for budgets and statistics.
     };
 
     //! Creates a cache dedicated to a single file. This is best used for files where blocks are read from
@@ -110,7 +112,8 @@ namespace AZ::IO::Requests
 
     enum class ReportType : int8_t
     {
-        FileLocks
+        FileLocks,
+        CacheHeat
     };
 
     struct ReportData
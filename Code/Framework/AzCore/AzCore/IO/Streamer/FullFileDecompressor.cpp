@@ -17,12 +17,58 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/typetraits/decay.h>
 
 namespace AZ::IO
 {
+    namespace FullFileDecompressorInternal
+    {
+        //! Limits the compressed data to the frames overlapping the read so only those are read and decompressed.
+        //! The read offset is updated to be relative to the first of these frames.
+        static void RestrictToReadFrames(CompressionInfo& info, u64& readOffset, u64 readSize)
+        {
+            const CompressionFrames& frames = *info.m_frames;
+            if (frames.empty() || readSize == 0)
+            {
+                return;
+            }
+
+            const u64 readEnd = readOffset + readSize;
+            // The last frame starting at or before the start of the read.
+            auto first = AZStd::upper_bound(frames.begin(), frames.end(), readOffset,
+                [](u64 offset, const CompressionFrame& frame)
+                {
+                    return offset < frame.m_uncompressedOffset;
+                });
+            AZ_Assert(first != frames.begin(), "The first compression frame doesn't start at the beginning of the decompressed data.");
+            --first;
+            // The first frame starting at or after the end of the read.
+            auto last = AZStd::lower_bound(first, frames.end(), readEnd,
+                [](const CompressionFrame& frame, u64 offset)
+                {
+                    return frame.m_uncompressedOffset < offset;
+                });
+            if (first == frames.begin() && last == frames.end())
+            {
+                return;
+            }
+
+            const size_t compressedBegin = first->m_compressedOffset;
+            const size_t uncompressedBegin = first->m_uncompressedOffset;
+            const size_t compressedEnd = (last != frames.end()) ? last->m_compressedOffset : info.m_compressedSize;
+            const size_t uncompressedEnd = (last != frames.end()) ? last->m_uncompressedOffset : info.m_uncompressedSize;
+
+            info.m_offset += compressedBegin;
+            info.m_compressedSize = compressedEnd - compressedBegin;
+            info.m_uncompressedSize = uncompressedEnd - uncompressedBegin;
+            info.m_frames.reset();
+            readOffset -= uncompressedBegin;
+        }
+    } // namespace FullFileDecompressorInternal
+
     AZStd::shared_ptr<StreamStackEntry> FullFileDecompressorConfig::AddStreamStackEntry(
         const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
     {
@@ -353,7 +399,12 @@ namespace AZ::IO
             {
                 AZ_Assert(info.m_decompressor,
                     "FullFileDecompressor::PrepareRequest found a compressed file, but no decompressor to decompress with.");
-                nextRequest->CreateCompressedRead(request, AZStd::move(info), data.m_output, data.m_offset, data.m_size);
+                u64 readOffset = data.m_offset;
+                if (info.m_frames)
+                {
+                    FullFileDecompressorInternal::RestrictToReadFrames(info, readOffset, data.m_size);
+                }
+                nextRequest->CreateCompressedRead(request, AZStd::move(info), data.m_output, readOffset, data.m_size);
             }
             else
             {
@@ -10,18 +10,21 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/AccessTrace.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::IO
 {
-#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr char SchedulerName[] = "Scheduler";
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr char ImmediateReadsName[] = "Immediate reads";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
-    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity)
+    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity,
+        const SchedulerConfig& config)
+        : m_config(config)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment provided to AZ::IO::Scheduler isn't a power of two.");
         AZ_Assert(IStreamerTypes::IsPowerOf2(sizeAlignment), "Size alignment provided to AZ::IO::Scheduler isn't a power of two.");
@@ -34,6 +37,12 @@ namespace AZ::IO
         m_recommendations.m_maxConcurrentRequests = aznumeric_caster(status.m_numAvailableSlots);
         m_recommendations.m_granularity = granularity;
 
+        AZ_Assert(m_config.m_numUrgentSlots >= 0, "The number of slots reserved for urgent requests can't be negative.");
+        for (size_t i = 0; i < IStreamerTypes::s_requestCategoryCount; ++i)
+        {
+            m_threadData.m_availableBandwidth[i] = aznumeric_cast<double>(m_config.m_bandwidthBudgets[i]);
+        }
+
         m_threadData.m_streamStack = AZStd::move(streamStack);
     }
 
@@ -130,6 +139,11 @@ namespace AZ::IO
         statistics.push_back(Statistic::CreateFloat(SchedulerName, "Processing speed (avg. mbps)", m_processingSpeedStat.CalculateAverage()));
         statistics.push_back(Statistic::CreatePercentage(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetAverage()));
 #endif
+        if (m_config.m_mode == SchedulingMode::EarliestDeadlineFirst)
+        {
+            statistics.push_back(Statistic::CreateInteger(
+                SchedulerName, "Deferred large reads", aznumeric_caster(m_threadData.m_numDeferredLargeReads)));
+        }
         m_context.CollectStatistics(statistics);
         m_threadData.m_streamStack->CollectStatistics(statistics);
     }
@@ -169,7 +183,7 @@ namespace AZ::IO
                         {
                             m_stackStatus = StreamStackEntry::Status{};
                             m_threadData.m_streamStack->UpdateStatus(m_stackStatus);
-                            if (m_stackStatus.m_numAvailableSlots > 0)
+                            if (m_stackStatus.m_numAvailableSlots > 0 && Thread_CanQueueNextRequest())
                             {
                                 Thread_QueueNextRequest();
                             }
@@ -264,6 +278,12 @@ namespace AZ::IO
                     }
                 }
 
+                size_t category = static_cast<size_t>(parentReadRequest->m_category);
+                if (m_config.m_bandwidthBudgets[category] > 0)
+                {
+                    m_threadData.m_availableBandwidth[category] -= aznumeric_cast<double>(size);
+                }
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 if (m_processingSize == 0)
                 {
@@ -341,16 +361,18 @@ namespace AZ::IO
             }
         }
 
-#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         auto visitor = [this, now](auto&& args) -> void
 #else
-        auto visitor = [](auto&& args) -> void
+        auto visitor = [now](auto&& args) -> void
 #endif
         {
             using Command = AZStd::decay_t<decltype(args)>;
             if constexpr (AZStd::is_same_v<Command, Requests::ReadRequestData>)
             {
+                args.m_queuedTime = now;
+                AccessTrace::Record(args.m_path.GetRelativePath());
                 if (args.m_output == nullptr && args.m_allocator != nullptr)
                 {
                     args.m_allocator->LockAllocator();
@@ -477,6 +499,11 @@ namespace AZ::IO
             return Order::Equal;
         }
 
+        if (m_config.m_mode == SchedulingMode::EarliestDeadlineFirst)
+        {
+            return Thread_PrioritizeRequestsByDeadline(first, *firstRead, second, *secondRead);
+        }
+
         bool firstInPanic = first->GetEstimatedCompletion() > firstRead->m_deadline;
         bool secondInPanic = second->GetEstimatedCompletion() > secondRead->m_deadline;
         // Both request are at risk of not completing before their deadline.
@@ -550,6 +577,99 @@ namespace AZ::IO
         return Order::Equal;
     }
 
+    auto Scheduler::Thread_PrioritizeRequestsByDeadline(const FileRequest* first, const Requests::ReadRequestData& firstRead,
+        const FileRequest* second, const Requests::ReadRequestData& secondRead) const -> Order
+    {
+        // Requests that are at risk of missing their deadline go first, regardless of budget. After that requests are
+        // processed if their category is within budget, followed by the categories that have used up their budget.
+        auto rank = [this](const FileRequest* request, const Requests::ReadRequestData& read) -> int
+        {
+            if (IsUrgent(request, read))
+            {
+                return 0;
+            }
+            size_t category = static_cast<size_t>(read.m_category);
+            bool isOverBudget = m_config.m_bandwidthBudgets[category] > 0 && m_threadData.m_availableBandwidth[category] <= 0.0;
+            return isOverBudget ? 2 : 1;
+        };
+        int firstRank = rank(first, firstRead);
+        int secondRank = rank(second, secondRead);
+        if (firstRank != secondRank)
+        {
+            return firstRank < secondRank ? Order::FirstRequest : Order::SecondRequest;
+        }
+
+        AZStd::chrono::system_clock::time_point firstDeadline = GetEffectiveDeadline(firstRead);
+        AZStd::chrono::system_clock::time_point secondDeadline = GetEffectiveDeadline(secondRead);
+        if (firstDeadline != secondDeadline)
+        {
+            return firstDeadline < secondDeadline ? Order::FirstRequest : Order::SecondRequest;
+        }
+
+        if (firstRead.m_priority != secondRead.m_priority)
+        {
+            return firstRead.m_priority > secondRead.m_priority ? Order::FirstRequest : Order::SecondRequest;
+        }
+        return Order::Equal;
+    }
+
+    AZStd::chrono::system_clock::time_point Scheduler::GetEffectiveDeadline(const Requests::ReadRequestData& read) const
+    {
+        if (read.m_queuedTime == AZStd::chrono::system_clock::time_point())
+        {
+            return read.m_deadline;
+        }
+        AZStd::chrono::system_clock::time_point maxWaitDeadline =
+            read.m_queuedTime + AZStd::chrono::duration_cast<AZStd::chrono::system_clock::duration>(m_config.m_maxWaitTime);
+        return AZStd::min(read.m_deadline, maxWaitDeadline);
+    }
+
+    bool Scheduler::IsUrgent(const FileRequest* request, const Requests::ReadRequestData& read) const
+    {
+        AZStd::chrono::system_clock::time_point deadline = GetEffectiveDeadline(read);
+        return deadline <= m_threadData.m_lastSchedulingPass || request->GetEstimatedCompletion() > deadline;
+    }
+
+    bool Scheduler::Thread_CanQueueNextRequest()
+    {
+        if (m_config.m_mode != SchedulingMode::EarliestDeadlineFirst || m_stackStatus.m_isIdle ||
+            m_stackStatus.m_numAvailableSlots > m_config.m_numUrgentSlots)
+        {
+            return true;
+        }
+
+        // Only the slots reserved for urgent requests are left. Keep them free unless the next request is small or can't wait.
+        // An urgent request that arrives later will then be sorted in front of the large reads and can start immediately.
+        const FileRequest* next = m_context.GetPreparedRequests().front();
+        const Requests::ReadRequestData* read = next->GetCommandFromChain<Requests::ReadRequestData>();
+        if (read == nullptr || read->m_size < m_config.m_largeReadSize || IsUrgent(next, *read))
+        {
+            return true;
+        }
+        m_threadData.m_numDeferredLargeReads++;
+        return false;
+    }
+
+    void Scheduler::Thread_UpdateBandwidthBudgets(AZStd::chrono::system_clock::time_point now)
+    {
+        if (m_threadData.m_lastSchedulingPass == AZStd::chrono::system_clock::time_point() || now <= m_threadData.m_lastSchedulingPass)
+        {
+            return;
+        }
+
+        double elapsedSeconds = AZStd::chrono::duration<double>(now - m_threadData.m_lastSchedulingPass).count();
+        for (size_t i = 0; i < IStreamerTypes::s_requestCategoryCount; ++i)
+        {
+            if (m_config.m_bandwidthBudgets[i] > 0)
+            {
+                // Allow at most one second worth of reads to build up so a category that has been idle for a while
+                // can't flood the stack.
+                double budget = aznumeric_cast<double>(m_config.m_bandwidthBudgets[i]);
+                m_threadData.m_availableBandwidth[i] = AZStd::min(m_threadData.m_availableBandwidth[i] + budget * elapsedSeconds, budget);
+            }
+        }
+    }
+
     void Scheduler::Thread_ScheduleRequests()
     {
         AZ_PROFILE_FUNCTION(AzCore);
@@ -557,6 +677,9 @@ namespace AZ::IO
         AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
         auto& pendingQueue = m_context.GetPreparedRequests();
 
+        Thread_UpdateBandwidthBudgets(now);
+        m_threadData.m_lastSchedulingPass = now;
+
         m_threadData.m_streamStack->UpdateCompletionEstimates(now, m_threadData.m_internalPendingRequests,
             pendingQueue.begin(), pendingQueue.end());
         m_threadData.m_internalPendingRequests.clear();
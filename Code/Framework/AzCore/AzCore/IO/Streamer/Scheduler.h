@@ -14,6 +14,8 @@
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -29,13 +31,40 @@ namespace AZ::IO
     {
         struct CancelData;
         struct RescheduleData;
+        struct ReadRequestData;
     } // namespace Requests
 
+    enum class SchedulingMode : u8
+    {
+        //! Balances deadlines against the cost of seeking and opening files. Requests are only ordered by deadline once
+        //! they're at risk of missing it.
+        Balanced,
+        //! Always processes the request with the earliest deadline first, with bandwidth budgets per request category
+        //! and a maximum time any request has to wait before it's processed.
+        EarliestDeadlineFirst
+    };
+
+    struct SchedulerConfig
+    {
+        SchedulingMode m_mode{ SchedulingMode::Balanced };
+        //! The number of bytes per second that can be read for each request category. Categories that have used up their
+        //! budget are processed after other requests unless they're about to miss their deadline. Zero means no budget.
+        AZStd::array<u64, IStreamerTypes::s_requestCategoryCount> m_bandwidthBudgets{};
+        //! The longest time a request will be waiting before it's treated as if its deadline has arrived. This prevents
+        //! requests without a deadline from being starved by a continuous stream of requests with a deadline.
+        AZStd::chrono::microseconds m_maxWaitTime{ AZStd::chrono::milliseconds(500) };
+        //! Reads of this size or larger that are not urgent don't take up the last available slots in the stack so
+        //! urgent requests that arrive later can be started immediately instead of waiting for large reads to complete.
+        u64 m_largeReadSize{ 1_mib };
+        //! The number of slots in the stack that are kept available for urgent requests.
+        s32 m_numUrgentSlots{ 1 };
+    };
+
     class Scheduler final
     {
     public:
         explicit Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment = AZCORE_GLOBAL_NEW_ALIGNMENT,
-            u64 sizeAlignment = 1, u64 granularity = 1_mib);
+            u64 sizeAlignment = 1, u64 granularity = 1_mib, const SchedulerConfig& config = {});
         ~Scheduler();
 
         void Start(const AZStd::thread_desc& threadDesc);
@@ -81,7 +110,20 @@ namespace AZ::IO
         };
         //! Determine which of the two provided requests is more important to process next.
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
+        //! Determine which of the two provided read requests is more important to process next, using earliest-deadline-first.
+        Order Thread_PrioritizeRequestsByDeadline(const FileRequest* first, const Requests::ReadRequestData& firstRead,
+            const FileRequest* second, const Requests::ReadRequestData& secondRead) const;
         void Thread_ScheduleRequests();
+        void Thread_UpdateBandwidthBudgets(AZStd::chrono::system_clock::time_point now);
+        //! Checks if the next prepared request can be queued in the stack. Large reads that can wait are held back
+        //! if only the slots reserved for urgent requests are available.
+        bool Thread_CanQueueNextRequest();
+
+        //! The deadline used for scheduling. This is the earlier of the requested deadline and the time at which
+        //! the request has been waiting for the maximum allowed time.
+        AZStd::chrono::system_clock::time_point GetEffectiveDeadline(const Requests::ReadRequestData& read) const;
+        //! Whether or not the request is at risk of missing its (effective) deadline.
+        bool IsUrgent(const FileRequest* request, const Requests::ReadRequestData& read) const;
 
         // Stores data that's unguarded and should only be changed by the scheduling thread.
         struct ThreadData final
@@ -92,9 +134,15 @@ namespace AZ::IO
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
+            //! The number of bytes that can still be read per category. Categories that have gone over budget will have
+            //! a negative value until enough time has passed to refill the budget.
+            AZStd::array<double, IStreamerTypes::s_requestCategoryCount> m_availableBandwidth{};
+            AZStd::chrono::system_clock::time_point m_lastSchedulingPass; //!< The time of the last time requests were scheduled.
+            size_t m_numDeferredLargeReads{ 0 }; //!< The number of times a large read was held back to keep slots for urgent requests.
         };
         ThreadData m_threadData;
         StreamerContext m_context;
+        SchedulerConfig m_config;
 
         IStreamerTypes::Recommendations m_recommendations;
 
@@ -165,6 +165,21 @@ namespace AZ::IO
         return request;
     }
 
+    FileRequestPtr& Streamer::SetRequestCategory(FileRequestPtr& request, IStreamerTypes::RequestCategory category)
+    {
+        AZ_Assert(category < IStreamerTypes::RequestCategory::Count, "Invalid category provided for read request.");
+        auto readRequest = AZStd::get_if<Requests::ReadRequestData>(&request->m_request.GetCommand());
+        if (readRequest)
+        {
+            readRequest->m_category = category;
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "A category can only be assigned to read requests.");
+        }
+        return request;
+    }
+
     FileRequestPtr Streamer::CreateRequest()
     {
         return m_streamStack->CreateRequest();
@@ -127,6 +127,8 @@ namespace AZ::IO
 
         //! Sets a callback function that will trigger when the provided request completes.
         FileRequestPtr& SetRequestCompleteCallback(FileRequestPtr& request, OnCompleteCallback callback) override;
+        //! Sets the category of the data a read request is loading.
+        FileRequestPtr& SetRequestCategory(FileRequestPtr& request, IStreamerTypes::RequestCategory category) override;
 
         //
         // Streamer request management.
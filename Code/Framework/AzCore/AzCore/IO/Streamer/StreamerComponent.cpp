@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
@@ -13,6 +14,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
+#include <AzCore/IO/Streamer/ExternalDecompressor.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
@@ -48,6 +50,65 @@ namespace AZ
 #endif
     }
 
+    static AZ::IO::SchedulerConfig LoadSchedulerConfig(const AZ::SettingsRegistryInterface& settingsRegistry)
+    {
+        constexpr AZStd::string_view SchedulerPath = "/Amazon/AzCore/Streamer/Scheduler";
+        constexpr const char* CategoryNames[] = { "General", "Audio", "Textures", "Meshes", "Script" };
+        static_assert(AZ_ARRAY_SIZE(CategoryNames) == AZ::IO::IStreamerTypes::s_requestCategoryCount,
+            "The number of category names for bandwidth budgets doesn't match the number of request categories.");
+
+        AZ::IO::SchedulerConfig config;
+        AZ::SettingsRegistryInterface::FixedValueString path;
+
+        AZ::SettingsRegistryInterface::FixedValueString mode;
+        path = AZ::SettingsRegistryInterface::FixedValueString::format("%.*s/Mode", AZ_STRING_ARG(SchedulerPath));
+        if (settingsRegistry.Get(mode, path))
+        {
+            if (mode == "EarliestDeadlineFirst")
+            {
+                config.m_mode = AZ::IO::SchedulingMode::EarliestDeadlineFirst;
+            }
+            else if (mode != "Balanced")
+            {
+                AZ_Warning("Streamer", false, "Unknown scheduling mode '%s'. Falling back to 'Balanced'.", mode.c_str());
+            }
+        }
+
+        s64 maxWaitTimeMs = 0;
+        path = AZ::SettingsRegistryInterface::FixedValueString::format("%.*s/MaxWaitTimeMs", AZ_STRING_ARG(SchedulerPath));
+        if (settingsRegistry.Get(maxWaitTimeMs, path) && maxWaitTimeMs >= 0)
+        {
+            config.m_maxWaitTime = AZStd::chrono::milliseconds(maxWaitTimeMs);
+        }
+
+        u64 largeReadSizeKib = 0;
+        path = AZ::SettingsRegistryInterface::FixedValueString::format("%.*s/LargeReadSizeKib", AZ_STRING_ARG(SchedulerPath));
+        if (settingsRegistry.Get(largeReadSizeKib, path))
+        {
+            config.m_largeReadSize = largeReadSizeKib * 1_kib;
+        }
+
+        s64 numUrgentSlots = 0;
+        path = AZ::SettingsRegistryInterface::FixedValueString::format("%.*s/UrgentSlots", AZ_STRING_ARG(SchedulerPath));
+        if (settingsRegistry.Get(numUrgentSlots, path) && numUrgentSlots >= 0)
+        {
+            config.m_numUrgentSlots = aznumeric_caster(numUrgentSlots);
+        }
+
+        for (size_t i = 0; i < AZ::IO::IStreamerTypes::s_requestCategoryCount; ++i)
+        {
+            double budgetMib = 0.0;
+            path = AZ::SettingsRegistryInterface::FixedValueString::format(
+                "%.*s/BandwidthBudgetsMib/%s", AZ_STRING_ARG(SchedulerPath), CategoryNames[i]);
+            if (settingsRegistry.Get(budgetMib, path) && budgetMib > 0.0)
+            {
+                config.m_bandwidthBudgets[i] = aznumeric_cast<u64>(budgetMib * 1_mib);
+            }
+        }
+
+        return config;
+    }
+
     AZStd::unique_ptr<AZ::IO::Scheduler> StreamerComponent::CreateSimpleStreamerStack()
     {
         return AZStd::make_unique<AZ::IO::Scheduler>(AZStd::make_shared<AZ::IO::StorageDrive>(1024));
@@ -103,7 +164,7 @@ namespace AZ
         if (stack)
         {
             return AZStd::make_unique<AZ::IO::Scheduler>(AZStd::move(stack), hardwareInfo.m_maxPhysicalSectorSize,
-                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer);
+                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer, LoadSchedulerConfig(*settingsRegistry));
         }
         else
         {
@@ -196,6 +257,7 @@ namespace AZ
 
         BlockCacheConfig::Reflect(context);
         DedicatedCacheConfig::Reflect(context);
+        ExternalDecompressorConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
@@ -212,6 +274,14 @@ namespace AZ
         }
     }
 
+    void StreamerComponent::ReportCacheHeat(const AZ::ConsoleCommandContainer&)
+    {
+        if (m_streamer)
+        {
+            m_streamer->QueueRequest(m_streamer->Report(AZ::IO::Requests::ReportType::CacheHeat));
+        }
+    }
+
     void StreamerComponent::FlushCaches(const AZ::ConsoleCommandContainer&)
     {
         if (m_streamer)
@@ -46,10 +46,13 @@ namespace AZ
         static AZStd::unique_ptr<AZ::IO::Scheduler> CreateSimpleStreamerStack();
 
         void ReportFileLocks(const AZ::ConsoleCommandContainer& someStrings);
+        void ReportCacheHeat(const AZ::ConsoleCommandContainer& someStrings);
         void FlushCaches(const AZ::ConsoleCommandContainer& someStrings);
 
         AZ_CONSOLEFUNC(StreamerComponent, ReportFileLocks, AZ::ConsoleFunctorFlags::Null,
             "Reports the files currently locked by AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, ReportCacheHeat, AZ::ConsoleFunctorFlags::Null,
+            "Reports how the files recently read through the adaptive caches in AZ::IO::Streamer are accessed");
         AZ_CONSOLEFUNC(StreamerComponent, FlushCaches, AZ::ConsoleFunctorFlags::Null,
             "Flushes all caches used inside AZ::IO::Streamer");
         
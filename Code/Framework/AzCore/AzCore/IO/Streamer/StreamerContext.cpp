@@ -22,6 +22,16 @@ namespace AZ
         static constexpr char LatePredictionName[] = "Early completions";
         static constexpr char MissedDeadlinesName[] = "Missed deadlines";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        static constexpr const char* MissedDeadlinesPerCategoryNames[] =
+        {
+            "Missed deadlines (general)",
+            "Missed deadlines (audio)",
+            "Missed deadlines (textures)",
+            "Missed deadlines (meshes)",
+            "Missed deadlines (script)"
+        };
+        static_assert(AZ_ARRAY_SIZE(MissedDeadlinesPerCategoryNames) == IStreamerTypes::s_requestCategoryCount,
+            "The number of names for missed deadlines doesn't match the number of request categories.");
 
         StreamerContext::StreamerContext() = default;
 
@@ -159,9 +169,7 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(AzCore);
 
-#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             auto now = AZStd::chrono::system_clock::now();
-#endif
             bool hasCompletedRequests = false;
             while (true)
             {
@@ -207,13 +215,19 @@ namespace AZ
                                 m_latePredictionsPercentageStat.GetMostRecentSample());
                         }
                     }
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                     auto readRequest = AZStd::get_if<Requests::ReadRequestData>(&top->GetCommand());
                     if (readRequest != nullptr)
                     {
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                         m_missedDeadlinePercentageStat.PushSample(now < readRequest->m_deadline ? 0.0 : 1.0);
                         Statistic::PlotImmediate(ContextName, MissedDeadlinesName, m_missedDeadlinePercentageStat.GetMostRecentSample());
-                    }
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+                        if (now >= readRequest->m_deadline && top->GetStatus() != IStreamerTypes::RequestStatus::Canceled)
+                        {
+                            m_missedDeadlinesPerCategory[static_cast<size_t>(readRequest->m_category)]++;
+                        }
+                    }
 
                     // Get all information before calling the completion routine as it's technically possible that an external
                     // request is recycled during the callback.
@@ -276,6 +290,11 @@ namespace AZ
             statistics.push_back(Statistic::CreatePercentage(ContextName, LatePredictionName, m_latePredictionsPercentageStat.GetAverage()));
             statistics.push_back(Statistic::CreatePercentage(ContextName, MissedDeadlinesName, m_missedDeadlinePercentageStat.GetAverage()));
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILNG_INFO
+            for (size_t i = 0; i < IStreamerTypes::s_requestCategoryCount; ++i)
+            {
+                statistics.push_back(Statistic::CreateInteger(
+                    ContextName, MissedDeadlinesPerCategoryNames[i], aznumeric_caster(m_missedDeadlinesPerCategory[i])));
+            }
             statistics.push_back(Statistic::CreateInteger(ContextName, "Total requests", aznumeric_caster(m_pendingIdCounter)));
             statistics.push_back(Statistic::CreateInteger(ContextName, "Internal bucket size", aznumeric_caster(m_internalRecycleBin.size())));
             statistics.push_back(Statistic::CreateInteger(ContextName, "External bucket size", aznumeric_caster(m_externalRecycleBin.size())));
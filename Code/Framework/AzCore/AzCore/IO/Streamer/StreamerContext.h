@@ -8,10 +8,12 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/IStreamerTypes.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext_Platform.h>
 #include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/vector.h>
@@ -112,6 +114,9 @@ namespace AZ::IO
         // The prepared request queue is not guarded and should only be called from the main Streamer thread.
         PreparedQueue m_preparedRequests;
 
+        //! The number of read requests per category that completed after their deadline.
+        AZStd::array<size_t, IStreamerTypes::s_requestCategoryCount> m_missedDeadlinesPerCategory{};
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         //! By how much time the prediction was off. This mostly covers the latter part of scheduling, which
         //! gets more precise the closer the request gets to completion.
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        //! Opaque platform execution context with its own stack.
+        struct JobFiber;
+
+        //! Minimal fiber abstraction used by the job manager to park jobs that wait for their children, so the
+        //! worker thread running them can keep processing other jobs. Fibers are only ever switched on the thread
+        //! that created them.
+        namespace JobFibers
+        {
+            //! Entry point of a fiber, must never return.
+            using EntryPoint = void (*)(void* userData);
+
+            //! Returns false on platforms without fiber support, in which case none of the other functions may be used.
+            bool IsSupported();
+
+            //! Create a fiber representing the calling thread. This must be done before the thread switches to any
+            //! other fiber, the returned fiber is what the thread switches back to before exiting.
+            JobFiber* ConvertThreadToFiber();
+
+            //! Release the fiber created by ConvertThreadToFiber, the calling thread must be running on it.
+            void ConvertFiberToThread(JobFiber* threadFiber);
+
+            //! Create a fiber that runs entryPoint(userData) the first time it is switched to.
+            JobFiber* CreateFiber(size_t stackSize, EntryPoint entryPoint, void* userData);
+
+            //! Destroy a fiber that is not currently running. Objects living on its stack are not destructed.
+            void DestroyFiber(JobFiber* fiber);
+
+            //! Suspend the fiber running on the calling thread (from) and resume another one (to).
+            void SwitchToFiber(JobFiber* from, JobFiber* to);
+        } // namespace JobFibers
+    } // namespace Internal
+} // namespace AZ
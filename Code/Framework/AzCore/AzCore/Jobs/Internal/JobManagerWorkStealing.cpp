@@ -10,6 +10,7 @@
 
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/Internal/JobNotify.h>
+#include <AzCore/Jobs/Internal/JobFiber.h>
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
@@ -84,6 +85,8 @@ AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_cu
 
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
+    , m_useFibers(desc.m_enableFibers && !desc.m_workerThreads.empty() && JobFibers::IsSupported())
+    , m_fiberStackSize(desc.m_fiberStackSize)
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc)))
 {
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
@@ -195,7 +198,15 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
 
     info->m_currentJob = nullptr; //clear current job
 
-    if (IsAsynchronous())
+    if (info->m_currentFiber)
+    {
+        //running on a worker fiber, park this fiber and let the worker carry on with other jobs on another one,
+        //the worker switches back to this fiber once the job's children have completed
+        info->m_suspendedFibers.push_back({ info->m_currentFiber, job });
+        SwitchFiber(info, AcquireFiber(info));
+        AZ_Assert(job->GetDependentCount() == 0, "Suspended job fiber was resumed before the job was ready");
+    }
+    else if (IsAsynchronous())
     {
         ProcessJobsAssist(info, job, nullptr);
     }
@@ -307,11 +318,118 @@ void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
     //setup thread-local storage
     m_currentThreadInfo = info;
 
-    ProcessJobsInternal(info, nullptr, nullptr);
+    if (m_useFibers)
+    {
+        //run the worker loop on a fiber, so jobs that wait for their children can park the stack they are running on
+        info->m_threadFiber = JobFibers::ConvertThreadToFiber();
+        info->m_currentFiber = info->m_threadFiber;
+        SwitchFiber(info, AcquireFiber(info));
+
+        //back on the thread's own context, the worker loop has quit
+        DestroyFibers(info);
+    }
+    else
+    {
+        ProcessJobsInternal(info, nullptr, nullptr);
+    }
 
     m_currentThreadInfo = nullptr;
 }
 
+void JobManagerWorkStealing::ProcessJobsFiber(void* threadInfo)
+{
+    ThreadInfo* info = static_cast<ThreadInfo*>(threadInfo);
+    //fibers are only created for worker threads, whose owning manager is always a JobManagerWorkStealing
+    JobManagerWorkStealing* jobManager = static_cast<JobManagerWorkStealing*>(info->m_owningManager);
+
+    //the fiber we were switched from may need to be returned to the pool
+    if (info->m_fiberToRecycle)
+    {
+        info->m_freeFibers.push_back(info->m_fiberToRecycle);
+        info->m_fiberToRecycle = nullptr;
+    }
+
+    jobManager->ProcessJobsInternal(info, nullptr, nullptr);
+
+    //quit was requested, return to the thread context for good, which destroys this fiber along with the pooled ones
+    JobFiber* currentFiber = info->m_currentFiber;
+    info->m_fiberToRecycle = currentFiber;
+    info->m_currentFiber = info->m_threadFiber;
+    JobFibers::SwitchToFiber(currentFiber, info->m_threadFiber);
+}
+
+JobFiber* JobManagerWorkStealing::AcquireFiber(ThreadInfo* info)
+{
+    if (!info->m_freeFibers.empty())
+    {
+        JobFiber* fiber = info->m_freeFibers.back();
+        info->m_freeFibers.pop_back();
+        return fiber;
+    }
+
+    JobFiber* fiber = JobFibers::CreateFiber(m_fiberStackSize, &ProcessJobsFiber, info);
+    AZ_Assert(fiber, "Failed to create a job fiber");
+    return fiber;
+}
+
+void JobManagerWorkStealing::SwitchFiber(ThreadInfo* info, JobFiber* fiber)
+{
+    JobFiber* currentFiber = info->m_currentFiber;
+    info->m_currentFiber = fiber;
+    JobFibers::SwitchToFiber(currentFiber, fiber);
+
+    //resumed, the fiber we were switched from may need to be returned to the pool
+    if (info->m_fiberToRecycle)
+    {
+        info->m_freeFibers.push_back(info->m_fiberToRecycle);
+        info->m_fiberToRecycle = nullptr;
+    }
+}
+
+bool JobManagerWorkStealing::ResumeReadyFiber(ThreadInfo* info)
+{
+    for (size_t i = 0; i < info->m_suspendedFibers.size(); ++i)
+    {
+        if (info->m_suspendedFibers[i].m_job->GetDependentCount() == 0)
+        {
+            JobFiber* fiber = info->m_suspendedFibers[i].m_fiber;
+            info->m_suspendedFibers.erase(info->m_suspendedFibers.begin() + i);
+
+            //the current fiber is only running the worker loop, so it can go back to the pool and be resumed later
+            //by AcquireFiber, at which point it simply carries on with the loop
+            info->m_fiberToRecycle = info->m_currentFiber;
+            SwitchFiber(info, fiber);
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobManagerWorkStealing::DestroyFibers(ThreadInfo* info)
+{
+    AZ_Assert(info->m_suspendedFibers.empty(), "Job manager is shutting down while jobs are still waiting for their children");
+    for (const ThreadInfo::SuspendedFiber& suspendedFiber : info->m_suspendedFibers)
+    {
+        JobFibers::DestroyFiber(suspendedFiber.m_fiber);
+    }
+    info->m_suspendedFibers.clear();
+
+    if (info->m_fiberToRecycle)
+    {
+        info->m_freeFibers.push_back(info->m_fiberToRecycle);
+        info->m_fiberToRecycle = nullptr;
+    }
+    for (JobFiber* fiber : info->m_freeFibers)
+    {
+        JobFibers::DestroyFiber(fiber);
+    }
+    info->m_freeFibers.clear();
+
+    JobFibers::ConvertFiberToThread(info->m_threadFiber);
+    info->m_threadFiber = nullptr;
+    info->m_currentFiber = nullptr;
+}
+
 void JobManagerWorkStealing::ProcessJobsAssist(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag)
 {
     ThreadInfo* oldInfo = m_currentThreadInfo;
@@ -330,6 +448,10 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
     unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
 
+    //when running on a worker fiber, jobs whose fibers were parked waiting for their children are resumed as soon as
+    //they are ready, rather than only when the job that replaced them on this thread has finished
+    const bool resumeFibers = info->m_currentFiber != nullptr;
+
     while (true)
     {
         //check if suspended job is ready, before we try to get a new job
@@ -338,6 +460,10 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
         {
             return;
         }
+        if (resumeFibers && !info->m_suspendedFibers.empty())
+        {
+            ResumeReadyFiber(info);
+        }
 
         //Try to get an initial job.
         Job* job = nullptr;
@@ -350,7 +476,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
+                //a worker with parked fibers keeps polling them instead of sleeping, like a worker assisting with a suspended job
                 bool shouldSleep = false;
+                if (info->m_suspendedFibers.empty())
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
                     AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
@@ -430,6 +558,11 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 {
                     return;
                 }
+                //resume any parked job that became ready while that job was running
+                if (resumeFibers && !info->m_suspendedFibers.empty())
+                {
+                    ResumeReadyFiber(info);
+                }
 
                 //pop a new job from the local queue
                 if (pendingJobs)
@@ -468,6 +601,12 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     {
                         return;
                     }
+                    if (resumeFibers && !info->m_suspendedFibers.empty() && ResumeReadyFiber(info))
+                    {
+                        //this fiber was recycled and is running the loop again, recheck the global queue first
+                        isTerminated = true;
+                        break;
+                    }
 
                     //select a victim thread, using the same victim as the previous successful steal if possible
                     WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
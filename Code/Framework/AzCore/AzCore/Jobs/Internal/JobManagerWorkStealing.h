@@ -27,6 +27,8 @@ namespace AZ
 
     namespace Internal
     {
+        struct JobFiber;
+
         class WorkQueue final
         {
         public:
@@ -100,6 +102,18 @@ namespace AZ
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
 
+                // valid only on workers when fibers are enabled, and only accessed from the worker thread itself
+                struct SuspendedFiber
+                {
+                    JobFiber* m_fiber;
+                    Job* m_job;
+                };
+                JobFiber* m_threadFiber = nullptr; // the worker thread's own context, returned to on shutdown
+                JobFiber* m_currentFiber = nullptr;
+                JobFiber* m_fiberToRecycle = nullptr; // fiber that was switched away from for good, returned to the pool by the next fiber
+                AZStd::vector<JobFiber*> m_freeFibers;
+                AZStd::vector<SuspendedFiber> m_suspendedFibers; // fibers of jobs waiting for their children to complete
+
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
                 unsigned int m_jobsForked = 0;
@@ -116,6 +130,12 @@ namespace AZ
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             ThreadList CreateWorkerThreads(const JobManagerDesc& jmDesc);
+
+            static void ProcessJobsFiber(void* threadInfo);
+            JobFiber* AcquireFiber(ThreadInfo* info);
+            void SwitchFiber(ThreadInfo* info, JobFiber* fiber);
+            bool ResumeReadyFiber(ThreadInfo* info);
+            void DestroyFibers(ThreadInfo* info);
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
@@ -123,6 +143,8 @@ namespace AZ
             ThreadInfo* GetCurrentOrCreateThreadInfo();
 
             bool m_isAsynchronous;
+            bool m_useFibers;
+            unsigned int m_fiberStackSize;
 
             ThreadList m_threads;
             mutable AZStd::mutex m_threadsMutex;
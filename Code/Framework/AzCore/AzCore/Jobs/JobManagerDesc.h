@@ -55,5 +55,19 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         *  When enabled, a job running on a worker thread that waits for its children (e.g. StartAndWaitForChildren)
+         *  parks its stack on a fiber instead of blocking the worker. The worker carries on processing other jobs on a
+         *  new fiber and resumes the parked job, on the same thread, once its children have completed.
+         *  Ignored on platforms without fiber support.
+         */
+        bool m_enableFibers = false;
+
+        /**
+         *  Stack size of each fiber created when m_enableFibers is set. Jobs run on fibers rather than on the worker
+         *  thread stack, so this must be large enough for the deepest job.
+         */
+        unsigned int m_fiberStackSize = 256 * 1024;
     };
 }
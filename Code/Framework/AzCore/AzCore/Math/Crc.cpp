@@ -7,20 +7,150 @@
  */
 
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Internal/Crc_Pclmul.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/CpuFeatures.h>
 
 #include <string.h>
 
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 namespace AZ
 {
+    namespace Internal
+    {
+        namespace
+        {
+            using Crc32UpdateFunction = u32 (*)(u32 crc, const uint8_t* data, size_t size);
+
+#if !defined(__ARM_FEATURE_CRC32)
+            // Tables of the slicing-by-8 algorithm: table[n][byte] is the crc of the byte followed by n zero bytes.
+            struct Crc32SlicingTables
+            {
+                u32 m_tables[8][256];
+            };
+
+            constexpr Crc32SlicingTables CreateCrc32SlicingTables()
+            {
+                Crc32SlicingTables slicing{};
+                for (u32 byte = 0; byte < 256; ++byte)
+                {
+                    slicing.m_tables[0][byte] = crc_table[byte];
+                }
+                for (u32 byte = 0; byte < 256; ++byte)
+                {
+                    for (size_t table = 1; table < 8; ++table)
+                    {
+                        const u32 previous = slicing.m_tables[table - 1][byte];
+                        slicing.m_tables[table][byte] = (previous >> 8) ^ crc_table[previous & 0xff];
+                    }
+                }
+                return slicing;
+            }
+
+            constexpr Crc32SlicingTables Crc32Slicing = CreateCrc32SlicingTables();
+#endif
+
+            AZ_FORCE_INLINE u64 LoadU64(const uint8_t* data)
+            {
+                u64 value;
+                memcpy(&value, data, sizeof(value));
+                return value;
+            }
+
+            //! Converts the ASCII upper case letters of the 8 bytes to lower case, like Crc32Set does byte per byte.
+            AZ_FORCE_INLINE u64 ToLowerU64(u64 value)
+            {
+                constexpr u64 Ones = 0x0101010101010101ull;
+                constexpr u64 HighBits = 0x8080808080808080ull;
+                const u64 heptets = value & ~HighBits;
+                const u64 atLeastA = heptets + (0x80 - 'A') * Ones;
+                const u64 aboveZ = heptets + (0x80 - 'Z' - 1) * Ones;
+                const u64 upperCase = (atLeastA ^ aboveZ) & ~value & HighBits;
+                return value | (upperCase >> 2);
+            }
+
+            AZ_FORCE_INLINE uint8_t ToLower(uint8_t byte)
+            {
+                return (byte >= 'A' && byte <= 'Z') ? static_cast<uint8_t>(byte + 'a' - 'A') : byte;
+            }
+
+            template<bool ForceLowerCase>
+            u32 Crc32UpdateSliced(u32 crc, const uint8_t* data, size_t size)
+            {
+                for (; size >= 8; size -= 8, data += 8)
+                {
+                    u64 value = LoadU64(data);
+                    if constexpr (ForceLowerCase)
+                    {
+                        value = ToLowerU64(value);
+                    }
+#if defined(__ARM_FEATURE_CRC32)
+                    // The ARMv8 crc32 instructions use the same polynomial as AZ::Crc32.
+                    crc = __crc32d(crc, value);
+#else
+                    const auto& tables = Crc32Slicing.m_tables;
+                    value ^= crc;
+                    crc = tables[7][value & 0xff] ^ tables[6][(value >> 8) & 0xff] ^ tables[5][(value >> 16) & 0xff] ^
+                        tables[4][(value >> 24) & 0xff] ^ tables[3][(value >> 32) & 0xff] ^ tables[2][(value >> 40) & 0xff] ^
+                        tables[1][(value >> 48) & 0xff] ^ tables[0][value >> 56];
+#endif
+                }
+                for (; size > 0; --size, ++data)
+                {
+                    crc = ComputeCrc32Octet(crc, ForceLowerCase ? ToLower(*data) : *data);
+                }
+                return crc;
+            }
+
+            u32 Crc32UpdateTable(u32 crc, const uint8_t* data, size_t size)
+            {
+                return Crc32UpdateSliced<false>(crc, data, size);
+            }
+
+            u32 Crc32UpdateFolded(u32 crc, const uint8_t* data, size_t size)
+            {
+                if (size < Crc32PclmulMinSize)
+                {
+                    return Crc32UpdateTable(crc, data, size);
+                }
+                const size_t foldedSize = size & ~(Crc32PclmulBlockSize - 1);
+                crc = Crc32UpdatePclmul(crc, data, foldedSize);
+                return Crc32UpdateTable(crc, data + foldedSize, size - foldedSize);
+            }
+
+            Crc32UpdateFunction GetCrc32Update()
+            {
+                static const CpuKernel<Crc32UpdateFunction> kernels[] = {
+                    { CpuFeatureBit(CpuFeature::Pclmul), &Crc32UpdateFolded },
+                    { 0, &Crc32UpdateTable },
+                };
+                static const Crc32UpdateFunction update = IsCrc32PclmulCompiled() ? SelectCpuKernel(kernels) : &Crc32UpdateTable;
+                return update;
+            }
+        } // namespace
+
+        u32 Crc32SetRuntime(const uint8_t* data, size_t size, bool forceLowerCase)
+        {
+            // The lower case crcs are computed on names and tags, which are too short for the folding kernels.
+            if (forceLowerCase)
+            {
+                return Crc32UpdateSliced<true>(0xffffffff, data, size) ^ 0xffffffff;
+            }
+            return GetCrc32Update()(0xffffffff, data, size) ^ 0xffffffff;
+        }
+    } // namespace Internal
+
     //=========================================================================
     //
     // Crc32 constructor
     //
     //=========================================================================
     Crc32::Crc32(const void* data, size_t size, bool forceLowerCase)
-        : Crc32{ reinterpret_cast<const uint8_t*>(data), size, forceLowerCase }
     {
+        Set(data, size, forceLowerCase);
     }
 
     void Crc32::Set(const void* data, size_t size, bool forceLowerCase)
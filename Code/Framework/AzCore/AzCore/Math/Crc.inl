@@ -115,9 +115,18 @@ namespace AZ
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
         }
 
+        //! Runtime version of Crc32Set, which processes several bytes at a time with the fastest kernel of the cpu.
+        u32 Crc32SetRuntime(const uint8_t* data, size_t size, bool forceLowerCase);
+
         template<typename CharType>
         constexpr void Crc32Set(const CharType* data, size_t size, bool forceLowerCase, AZ::u32& value)
         {
+            if (!az_builtin_is_constant_evaluated())
+            {
+                value = data ? Crc32SetRuntime(reinterpret_cast<const uint8_t*>(data), size, forceLowerCase) : 0;
+                return;
+            }
+
             const CharType* buf = data;
             if (!buf)
             {
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// Only the raw intrinsics can be used here, see Crc_Pclmul.h.
+#include <AzCore/Math/Internal/Crc_Pclmul.h>
+
+#if defined(__PCLMUL__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define AZ_CRC32_PCLMUL_COMPILED 1
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+namespace AZ::Internal
+{
+#if defined(AZ_CRC32_PCLMUL_COMPILED)
+    bool IsCrc32PclmulCompiled()
+    {
+        return true;
+    }
+
+    // Folding of the data 128 bits at a time with carry-less multiplications, then Barrett reduction of the last 64 bits, from
+    // "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).
+    // The constants are the bit reflected ones for the CRC-32 polynomial 0x04C11DB7 used by AZ::Crc32.
+    uint32_t Crc32UpdatePclmul(uint32_t crc, const uint8_t* data, size_t size)
+    {
+        alignas(16) static const uint64_t k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+        alignas(16) static const uint64_t k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+        alignas(16) static const uint64_t k5k0[] = { 0x0163cd6124, 0x0000000000 };
+        alignas(16) static const uint64_t poly[] = { 0x01db710641, 0x01f7011641 };
+
+        __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+        __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+        __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+        __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+        data += 64;
+        size -= 64;
+
+        // Fold 4 blocks of 128 bits in parallel.
+        __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+        while (size >= 64)
+        {
+            const __m128i x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+            const __m128i x6 = _mm_clmulepi64_si128(x2, k, 0x00);
+            const __m128i x7 = _mm_clmulepi64_si128(x3, k, 0x00);
+            const __m128i x8 = _mm_clmulepi64_si128(x4, k, 0x00);
+            x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+            x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+            x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+            x4 = _mm_clmulepi64_si128(x4, k, 0x11);
+
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+            x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+            x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+            x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+            data += 64;
+            size -= 64;
+        }
+
+        // Fold the 4 blocks into one, then the remaining blocks of 128 bits one at a time.
+        k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+        auto fold = [k](__m128i value, __m128i next)
+        {
+            const __m128i low = _mm_clmulepi64_si128(value, k, 0x00);
+            const __m128i high = _mm_clmulepi64_si128(value, k, 0x11);
+            return _mm_xor_si128(_mm_xor_si128(high, next), low);
+        };
+        x1 = fold(x1, x2);
+        x1 = fold(x1, x3);
+        x1 = fold(x1, x4);
+        while (size >= 16)
+        {
+            x1 = fold(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            data += 16;
+            size -= 16;
+        }
+
+        // Fold 128 bits to 64 bits.
+        const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+        x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+        k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        // Barrett reduction to 32 bits.
+        k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x10);
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), k, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+        return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+    }
+#else
+    bool IsCrc32PclmulCompiled()
+    {
+        return false;
+    }
+
+    uint32_t Crc32UpdatePclmul(uint32_t crc, const uint8_t*, size_t)
+    {
+        return crc;
+    }
+#endif
+} // namespace AZ::Internal
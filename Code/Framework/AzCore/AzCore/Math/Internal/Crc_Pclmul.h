@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Crc_Pclmul.cpp is compiled with the carry-less multiplication instructions enabled, so like SimdMathBatch_Avx2.h
+// this header must not include the engine headers whose inline functions could be compiled with them.
+namespace AZ::Internal
+{
+    //! True if Crc_Pclmul.cpp was compiled with PCLMUL enabled.
+    bool IsCrc32PclmulCompiled();
+
+    //! Minimum size, and granularity of the sizes, accepted by Crc32UpdatePclmul.
+    constexpr size_t Crc32PclmulMinSize = 64;
+    constexpr size_t Crc32PclmulBlockSize = 16;
+
+    //! Updates the crc register, before its final inversion, with size bytes of data, folding 64 bytes per iteration.
+    //! size must be at least Crc32PclmulMinSize and a multiple of Crc32PclmulBlockSize.
+    uint32_t Crc32UpdatePclmul(uint32_t crc, const uint8_t* data, size_t size);
+} // namespace AZ::Internal
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+// The AVX2 kernels are compiled in their own translation unit with the AVX2 code generation enabled, so they only use raw floats
+// and this header must not include any of the math headers: their inline functions would also be compiled with AVX2 instructions
+// and the linker could pick those copies for the cpus without AVX2.
+namespace AZ::Simd::Batch::Avx2
+{
+    //! True if SimdMathBatch_Avx2.cpp was compiled with AVX2 enabled.
+    bool IsCompiled();
+
+    //! All the kernels process the blocks of 8 values and return the number of values processed, the caller handles the rest.
+    //! Points and aabbs are read with the layout of Vector3 and Aabb on the SSE platforms, 4 and 8 floats per value.
+
+    //! matrix is the 3x4 row major matrix.
+    size_t TransformPoints(const float* matrix, const float* points, float* outPoints, size_t count);
+
+    //! planes are the 6 frustum planes as nx, ny, nz, d.
+    size_t OverlapsFrustum(const float* planes, const float* aabbs, bool* outOverlaps, size_t count, size_t& overlapCount);
+} // namespace AZ::Simd::Batch::Avx2
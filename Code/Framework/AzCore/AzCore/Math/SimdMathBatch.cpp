@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMathBatch.h>
+#include <AzCore/Math/Internal/SimdMathBatch_Avx2.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Utils/CpuFeatures.h>
+
+namespace AZ::Simd::Batch
+{
+    namespace
+    {
+        constexpr uint32_t PortableLanes = 4;
+
+        bool UseAvx2()
+        {
+            static const bool useAvx2 = Avx2::IsCompiled() && Platform::HasCpuFeature(CpuFeature::Avx2);
+            return useAvx2;
+        }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        // The AVX2 kernels read the points and aabbs in place.
+        static_assert(sizeof(Vector3) == 4 * sizeof(float), "The AVX2 kernels expect Vector3 to be stored as 4 floats");
+        static_assert(sizeof(Aabb) == 8 * sizeof(float), "The AVX2 kernels expect Aabb to be stored as 8 floats");
+#endif
+    } // namespace
+
+    uint32_t GetLaneCount()
+    {
+        return UseAvx2() ? 8 : PortableLanes;
+    }
+
+    bool IsUsingAvx2()
+    {
+        return UseAvx2();
+    }
+
+    void TransformPoints(const Matrix3x4& matrix, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints)
+    {
+        AZ_Assert(points.size() == outPoints.size(), "The output points must have the size of the input points");
+
+        size_t index = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        if (UseAvx2())
+        {
+            float rows[12];
+            matrix.StoreToRowMajorFloat12(rows);
+            index = Avx2::TransformPoints(
+                rows, reinterpret_cast<const float*>(points.data()), reinterpret_cast<float*>(outPoints.data()), points.size());
+        }
+#endif
+
+        const Vec4::FloatType m00 = Vec4::Splat(matrix.GetElement(0, 0));
+        const Vec4::FloatType m01 = Vec4::Splat(matrix.GetElement(0, 1));
+        const Vec4::FloatType m02 = Vec4::Splat(matrix.GetElement(0, 2));
+        const Vec4::FloatType m03 = Vec4::Splat(matrix.GetElement(0, 3));
+        const Vec4::FloatType m10 = Vec4::Splat(matrix.GetElement(1, 0));
+        const Vec4::FloatType m11 = Vec4::Splat(matrix.GetElement(1, 1));
+        const Vec4::FloatType m12 = Vec4::Splat(matrix.GetElement(1, 2));
+        const Vec4::FloatType m13 = Vec4::Splat(matrix.GetElement(1, 3));
+        const Vec4::FloatType m20 = Vec4::Splat(matrix.GetElement(2, 0));
+        const Vec4::FloatType m21 = Vec4::Splat(matrix.GetElement(2, 1));
+        const Vec4::FloatType m22 = Vec4::Splat(matrix.GetElement(2, 2));
+        const Vec4::FloatType m23 = Vec4::Splat(matrix.GetElement(2, 3));
+
+        Float3Batch<PortableLanes> batch;
+        for (; index + PortableLanes <= points.size(); index += PortableLanes)
+        {
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                batch.Set(lane, points[index + lane]);
+            }
+            const Vec4::FloatType x = Vec4::LoadAligned(batch.m_x);
+            const Vec4::FloatType y = Vec4::LoadAligned(batch.m_y);
+            const Vec4::FloatType z = Vec4::LoadAligned(batch.m_z);
+            Vec4::StoreAligned(batch.m_x, Vec4::Madd(m02, z, Vec4::Madd(m01, y, Vec4::Madd(m00, x, m03))));
+            Vec4::StoreAligned(batch.m_y, Vec4::Madd(m12, z, Vec4::Madd(m11, y, Vec4::Madd(m10, x, m13))));
+            Vec4::StoreAligned(batch.m_z, Vec4::Madd(m22, z, Vec4::Madd(m21, y, Vec4::Madd(m20, x, m23))));
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                outPoints[index + lane] = batch.Get(lane);
+            }
+        }
+
+        for (; index < points.size(); ++index)
+        {
+            outPoints[index] = matrix * points[index];
+        }
+    }
+
+    void TransformPoints(const Transform& transform, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints)
+    {
+        TransformPoints(Matrix3x4::CreateFromTransform(transform), points, outPoints);
+    }
+
+    void TransformPoints(AZStd::span<const Transform> transforms, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints)
+    {
+        AZ_Assert(transforms.size() == points.size(), "There must be one transform per point");
+        AZ_Assert(points.size() == outPoints.size(), "The output points must have the size of the input points");
+
+        const Vec4::FloatType two = Vec4::Splat(2.0f);
+
+        TransformBatch<PortableLanes> transformBatch;
+        Float3Batch<PortableLanes> pointBatch;
+        size_t index = 0;
+        for (; index + PortableLanes <= points.size(); index += PortableLanes)
+        {
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                transformBatch.Set(lane, transforms[index + lane]);
+                pointBatch.Set(lane, points[index + lane]);
+            }
+
+            const Vec4::FloatType scale = Vec4::LoadAligned(transformBatch.m_scale);
+            const Vec4::FloatType x = Vec4::Mul(scale, Vec4::LoadAligned(pointBatch.m_x));
+            const Vec4::FloatType y = Vec4::Mul(scale, Vec4::LoadAligned(pointBatch.m_y));
+            const Vec4::FloatType z = Vec4::Mul(scale, Vec4::LoadAligned(pointBatch.m_z));
+            const Vec4::FloatType qx = Vec4::LoadAligned(transformBatch.m_rotation.m_x);
+            const Vec4::FloatType qy = Vec4::LoadAligned(transformBatch.m_rotation.m_y);
+            const Vec4::FloatType qz = Vec4::LoadAligned(transformBatch.m_rotation.m_z);
+            const Vec4::FloatType qw = Vec4::LoadAligned(transformBatch.m_rotation.m_w);
+
+            // v + 2w(q x v) + 2q x (q x v), with q the vector part of the rotation.
+            const Vec4::FloatType tx = Vec4::Mul(two, Vec4::Sub(Vec4::Mul(qy, z), Vec4::Mul(qz, y)));
+            const Vec4::FloatType ty = Vec4::Mul(two, Vec4::Sub(Vec4::Mul(qz, x), Vec4::Mul(qx, z)));
+            const Vec4::FloatType tz = Vec4::Mul(two, Vec4::Sub(Vec4::Mul(qx, y), Vec4::Mul(qy, x)));
+            const Vec4::FloatType rx = Vec4::Add(Vec4::Madd(qw, tx, x), Vec4::Sub(Vec4::Mul(qy, tz), Vec4::Mul(qz, ty)));
+            const Vec4::FloatType ry = Vec4::Add(Vec4::Madd(qw, ty, y), Vec4::Sub(Vec4::Mul(qz, tx), Vec4::Mul(qx, tz)));
+            const Vec4::FloatType rz = Vec4::Add(Vec4::Madd(qw, tz, z), Vec4::Sub(Vec4::Mul(qx, ty), Vec4::Mul(qy, tx)));
+
+            Vec4::StoreAligned(pointBatch.m_x, Vec4::Add(rx, Vec4::LoadAligned(transformBatch.m_translation.m_x)));
+            Vec4::StoreAligned(pointBatch.m_y, Vec4::Add(ry, Vec4::LoadAligned(transformBatch.m_translation.m_y)));
+            Vec4::StoreAligned(pointBatch.m_z, Vec4::Add(rz, Vec4::LoadAligned(transformBatch.m_translation.m_z)));
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                outPoints[index + lane] = pointBatch.Get(lane);
+            }
+        }
+
+        for (; index < points.size(); ++index)
+        {
+            outPoints[index] = transforms[index].TransformPoint(points[index]);
+        }
+    }
+
+    size_t OverlapsFrustum(const Frustum& frustum, AZStd::span<const Aabb> aabbs, AZStd::span<bool> outOverlaps)
+    {
+        AZ_Assert(aabbs.size() == outOverlaps.size(), "The output overlaps must have the size of the aabbs");
+
+        size_t overlapCount = 0;
+        size_t index = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        if (UseAvx2())
+        {
+            float planes[Frustum::PlaneId::MAX * 4];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Plane plane = frustum.GetPlane(planeId);
+                plane.GetNormal().StoreToFloat3(planes + planeId * 4);
+                planes[planeId * 4 + 3] = plane.GetDistance();
+            }
+            index = Avx2::OverlapsFrustum(
+                planes, reinterpret_cast<const float*>(aabbs.data()), outOverlaps.data(), aabbs.size(), overlapCount);
+        }
+#endif
+
+        Vec4::FloatType normalX[Frustum::PlaneId::MAX];
+        Vec4::FloatType normalY[Frustum::PlaneId::MAX];
+        Vec4::FloatType normalZ[Frustum::PlaneId::MAX];
+        Vec4::FloatType distance[Frustum::PlaneId::MAX];
+        for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+        {
+            const Plane plane = frustum.GetPlane(planeId);
+            normalX[planeId] = Vec4::Splat(plane.GetNormal().GetX());
+            normalY[planeId] = Vec4::Splat(plane.GetNormal().GetY());
+            normalZ[planeId] = Vec4::Splat(plane.GetNormal().GetZ());
+            distance[planeId] = Vec4::Splat(plane.GetDistance());
+        }
+
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        Float3Batch<PortableLanes> minBatch;
+        Float3Batch<PortableLanes> maxBatch;
+        for (; index + PortableLanes <= aabbs.size(); index += PortableLanes)
+        {
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                minBatch.Set(lane, aabbs[index + lane].GetMin());
+                maxBatch.Set(lane, aabbs[index + lane].GetMax());
+            }
+            const Vec4::FloatType minX = Vec4::LoadAligned(minBatch.m_x);
+            const Vec4::FloatType minY = Vec4::LoadAligned(minBatch.m_y);
+            const Vec4::FloatType minZ = Vec4::LoadAligned(minBatch.m_z);
+            const Vec4::FloatType maxX = Vec4::LoadAligned(maxBatch.m_x);
+            const Vec4::FloatType maxY = Vec4::LoadAligned(maxBatch.m_y);
+            const Vec4::FloatType maxZ = Vec4::LoadAligned(maxBatch.m_z);
+
+            // Same as ShapeIntersection::Overlaps, the extents are halved before the subtraction to not overflow with FLT_MAX bounds.
+            const Vec4::FloatType centerX = Vec4::Mul(half, Vec4::Add(minX, maxX));
+            const Vec4::FloatType centerY = Vec4::Mul(half, Vec4::Add(minY, maxY));
+            const Vec4::FloatType centerZ = Vec4::Mul(half, Vec4::Add(minZ, maxZ));
+            const Vec4::FloatType extentsX = Vec4::Sub(Vec4::Mul(half, maxX), Vec4::Mul(half, minX));
+            const Vec4::FloatType extentsY = Vec4::Sub(Vec4::Mul(half, maxY), Vec4::Mul(half, minY));
+            const Vec4::FloatType extentsZ = Vec4::Sub(Vec4::Mul(half, maxZ), Vec4::Mul(half, minZ));
+
+            Vec4::FloatType outside = zero;
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vec4::FloatType centerDistance = Vec4::Madd(normalZ[planeId], centerZ,
+                    Vec4::Madd(normalY[planeId], centerY, Vec4::Madd(normalX[planeId], centerX, distance[planeId])));
+                const Vec4::FloatType radius = Vec4::Madd(Vec4::Abs(normalZ[planeId]), extentsZ,
+                    Vec4::Madd(Vec4::Abs(normalY[planeId]), extentsY, Vec4::Mul(Vec4::Abs(normalX[planeId]), extentsX)));
+                outside = Vec4::Or(outside, Vec4::CmpLtEq(Vec4::Add(centerDistance, radius), zero));
+            }
+
+            alignas(16) int32_t outsideLanes[PortableLanes];
+            Vec4::StoreAligned(outsideLanes, Vec4::CastToInt(outside));
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                const bool overlaps = outsideLanes[lane] == 0;
+                outOverlaps[index + lane] = overlaps;
+                overlapCount += overlaps ? 1 : 0;
+            }
+        }
+
+        for (; index < aabbs.size(); ++index)
+        {
+            outOverlaps[index] = ShapeIntersection::Overlaps(frustum, aabbs[index]);
+            overlapCount += outOverlaps[index] ? 1 : 0;
+        }
+        return overlapCount;
+    }
+
+    void Slerp(AZStd::span<const Quaternion> from, AZStd::span<const Quaternion> to, float t, AZStd::span<Quaternion> outRotations)
+    {
+        AZ_Assert(from.size() == to.size(), "There must be as many destination rotations as source rotations");
+        AZ_Assert(from.size() == outRotations.size(), "The output rotations must have the size of the input rotations");
+
+        const Vec4::FloatType splatT = Vec4::Splat(t);
+        const Vec4::FloatType oneMinusT = Vec4::Splat(1.0f - t);
+        const Vec4::FloatType lerpThreshold = Vec4::Splat(0.9999f);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        QuaternionBatch<PortableLanes> fromBatch;
+        QuaternionBatch<PortableLanes> toBatch;
+        size_t index = 0;
+        for (; index + PortableLanes <= from.size(); index += PortableLanes)
+        {
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                fromBatch.Set(lane, from[index + lane]);
+                toBatch.Set(lane, to[index + lane]);
+            }
+            const Vec4::FloatType fromX = Vec4::LoadAligned(fromBatch.m_x);
+            const Vec4::FloatType fromY = Vec4::LoadAligned(fromBatch.m_y);
+            const Vec4::FloatType fromZ = Vec4::LoadAligned(fromBatch.m_z);
+            const Vec4::FloatType fromW = Vec4::LoadAligned(fromBatch.m_w);
+            const Vec4::FloatType toX = Vec4::LoadAligned(toBatch.m_x);
+            const Vec4::FloatType toY = Vec4::LoadAligned(toBatch.m_y);
+            const Vec4::FloatType toZ = Vec4::LoadAligned(toBatch.m_z);
+            const Vec4::FloatType toW = Vec4::LoadAligned(toBatch.m_w);
+
+            // Same as Quaternion::Slerp, the lanes too close to each other are linearly interpolated.
+            const Vec4::FloatType dot =
+                Vec4::Madd(fromW, toW, Vec4::Madd(fromZ, toZ, Vec4::Madd(fromY, toY, Vec4::Mul(fromX, toX))));
+            const Vec4::FloatType cosom = Vec4::Abs(dot);
+            const Vec4::FloatType omega = Vec4::Acos(Vec4::Min(cosom, lerpThreshold));
+            const Vec4::FloatType sinom = Vec4::Reciprocal(Vec4::Sin(omega));
+            const Vec4::FloatType isLerp = Vec4::CmpGtEq(cosom, lerpThreshold);
+            Vec4::FloatType sclA = Vec4::Select(oneMinusT, Vec4::Mul(Vec4::Sin(Vec4::Mul(oneMinusT, omega)), sinom), isLerp);
+            const Vec4::FloatType sclB = Vec4::Select(splatT, Vec4::Mul(Vec4::Sin(Vec4::Mul(splatT, omega)), sinom), isLerp);
+            sclA = Vec4::Select(Vec4::Sub(zero, sclA), sclA, Vec4::CmpLt(dot, zero));
+
+            Vec4::StoreAligned(fromBatch.m_x, Vec4::Madd(fromX, sclA, Vec4::Mul(toX, sclB)));
+            Vec4::StoreAligned(fromBatch.m_y, Vec4::Madd(fromY, sclA, Vec4::Mul(toY, sclB)));
+            Vec4::StoreAligned(fromBatch.m_z, Vec4::Madd(fromZ, sclA, Vec4::Mul(toZ, sclB)));
+            Vec4::StoreAligned(fromBatch.m_w, Vec4::Madd(fromW, sclA, Vec4::Mul(toW, sclB)));
+            for (uint32_t lane = 0; lane < PortableLanes; ++lane)
+            {
+                outRotations[index + lane] = fromBatch.Get(lane);
+            }
+        }
+
+        for (; index < from.size(); ++index)
+        {
+            outRotations[index] = from[index].Slerp(to[index], t);
+        }
+    }
+} // namespace AZ::Simd::Batch
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        //! Math over arrays of values, processed several values at a time with one value per SIMD lane.
+        //! Unlike Simd::Vec3 and Simd::Vec4, which use the lanes for the components of one value, this keeps all the lanes busy
+        //! for the data stored as arrays of structures, like the vertices of a mesh or the bounds of the visible entries.
+        //! The kernels use 8 lanes on cpus supporting AVX2, which is checked once at runtime, and 4 lanes otherwise.
+        namespace Batch
+        {
+            //! Number of values processed at once by the kernels on this cpu.
+            uint32_t GetLaneCount();
+
+            //! Returns true when the 8 lane AVX2 kernels are compiled in and supported by this cpu.
+            bool IsUsingAvx2();
+
+            //! Structure of arrays of Lanes Vector3, the layout the kernels compute with.
+            template<uint32_t Lanes>
+            struct Float3Batch
+            {
+                alignas(32) float m_x[Lanes];
+                alignas(32) float m_y[Lanes];
+                alignas(32) float m_z[Lanes];
+
+                void Set(uint32_t lane, const Vector3& value);
+                Vector3 Get(uint32_t lane) const;
+            };
+
+            //! Structure of arrays of Lanes Quaternion.
+            template<uint32_t Lanes>
+            struct QuaternionBatch
+            {
+                alignas(32) float m_x[Lanes];
+                alignas(32) float m_y[Lanes];
+                alignas(32) float m_z[Lanes];
+                alignas(32) float m_w[Lanes];
+
+                void Set(uint32_t lane, const Quaternion& value);
+                Quaternion Get(uint32_t lane) const;
+            };
+
+            //! Structure of arrays of Lanes Transform.
+            template<uint32_t Lanes>
+            struct TransformBatch
+            {
+                QuaternionBatch<Lanes> m_rotation;
+                Float3Batch<Lanes> m_translation;
+                alignas(32) float m_scale[Lanes];
+
+                void Set(uint32_t lane, const Transform& value);
+                Transform Get(uint32_t lane) const;
+            };
+
+            //! Transforms each point by the matrix. outPoints must have the size of points, and can be the same span.
+            void TransformPoints(const Matrix3x4& matrix, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints);
+            void TransformPoints(const Transform& transform, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints);
+
+            //! Transforms each point by the transform with the same index, like for the local offsets of many bodies.
+            void TransformPoints(
+                AZStd::span<const Transform> transforms, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints);
+
+            //! Tests each aabb against the frustum like ShapeIntersection::Overlaps(frustum, aabb).
+            //! outOverlaps must have the size of aabbs, returns the number of overlapping aabbs.
+            size_t OverlapsFrustum(const Frustum& frustum, AZStd::span<const Aabb> aabbs, AZStd::span<bool> outOverlaps);
+
+            //! Spherical interpolation of each pair of quaternions like Quaternion::Slerp, with the same t for all of them.
+            void Slerp(
+                AZStd::span<const Quaternion> from, AZStd::span<const Quaternion> to, float t, AZStd::span<Quaternion> outRotations);
+        } // namespace Batch
+    } // namespace Simd
+} // namespace AZ
+
+#include <AzCore/Math/SimdMathBatch.inl>
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Batch
+        {
+            template<uint32_t Lanes>
+            AZ_MATH_INLINE void Float3Batch<Lanes>::Set(uint32_t lane, const Vector3& value)
+            {
+                m_x[lane] = value.GetX();
+                m_y[lane] = value.GetY();
+                m_z[lane] = value.GetZ();
+            }
+
+            template<uint32_t Lanes>
+            AZ_MATH_INLINE Vector3 Float3Batch<Lanes>::Get(uint32_t lane) const
+            {
+                return Vector3(m_x[lane], m_y[lane], m_z[lane]);
+            }
+
+            template<uint32_t Lanes>
+            AZ_MATH_INLINE void QuaternionBatch<Lanes>::Set(uint32_t lane, const Quaternion& value)
+            {
+                m_x[lane] = value.GetX();
+                m_y[lane] = value.GetY();
+                m_z[lane] = value.GetZ();
+                m_w[lane] = value.GetW();
+            }
+
+            template<uint32_t Lanes>
+            AZ_MATH_INLINE Quaternion QuaternionBatch<Lanes>::Get(uint32_t lane) const
+            {
+                return Quaternion(m_x[lane], m_y[lane], m_z[lane], m_w[lane]);
+            }
+
+            template<uint32_t Lanes>
+            AZ_MATH_INLINE void TransformBatch<Lanes>::Set(uint32_t lane, const Transform& value)
+            {
+                m_rotation.Set(lane, value.GetRotation());
+                m_translation.Set(lane, value.GetTranslation());
+                m_scale[lane] = value.GetUniformScale();
+            }
+
+            template<uint32_t Lanes>
+            AZ_MATH_INLINE Transform TransformBatch<Lanes>::Get(uint32_t lane) const
+            {
+                Transform transform = Transform::CreateFromQuaternionAndTranslation(m_rotation.Get(lane), m_translation.Get(lane));
+                transform.SetUniformScale(m_scale[lane]);
+                return transform;
+            }
+        } // namespace Batch
+    } // namespace Simd
+} // namespace AZ
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// Only the raw intrinsics can be used here, see SimdMathBatch_Avx2.h.
+#include <AzCore/Math/Internal/SimdMathBatch_Avx2.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace AZ::Simd::Batch::Avx2
+{
+#if defined(__AVX2__)
+    namespace
+    {
+        // Loads 8 values of 4 floats each, stored every stride floats, as 4 registers with one component of the 8 values each.
+        inline void LoadTransposed(const float* values, size_t stride, __m256& x, __m256& y, __m256& z, __m256& w)
+        {
+            const __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values)), _mm_loadu_ps(values + 4 * stride), 1);
+            const __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + stride)), _mm_loadu_ps(values + 5 * stride), 1);
+            const __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + 2 * stride)), _mm_loadu_ps(values + 6 * stride), 1);
+            const __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + 3 * stride)), _mm_loadu_ps(values + 7 * stride), 1);
+
+            const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+            const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+            const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+            x = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            y = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            z = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            w = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // Reverse of LoadTransposed for 8 values of 4 floats stored contiguously.
+        inline void StoreTransposed(float* values, __m256 x, __m256 y, __m256 z, __m256 w)
+        {
+            const __m256 t0 = _mm256_unpacklo_ps(x, y);
+            const __m256 t1 = _mm256_unpackhi_ps(x, y);
+            const __m256 t2 = _mm256_unpacklo_ps(z, w);
+            const __m256 t3 = _mm256_unpackhi_ps(z, w);
+            const __m256 r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m256 r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+            _mm_storeu_ps(values, _mm256_castps256_ps128(r0));
+            _mm_storeu_ps(values + 4, _mm256_castps256_ps128(r1));
+            _mm_storeu_ps(values + 8, _mm256_castps256_ps128(r2));
+            _mm_storeu_ps(values + 12, _mm256_castps256_ps128(r3));
+            _mm_storeu_ps(values + 16, _mm256_extractf128_ps(r0, 1));
+            _mm_storeu_ps(values + 20, _mm256_extractf128_ps(r1, 1));
+            _mm_storeu_ps(values + 24, _mm256_extractf128_ps(r2, 1));
+            _mm_storeu_ps(values + 28, _mm256_extractf128_ps(r3, 1));
+        }
+
+        inline __m256 Dot3(__m256 ax, __m256 ay, __m256 az, __m256 bx, __m256 by, __m256 bz)
+        {
+            return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz));
+        }
+    } // namespace
+
+    bool IsCompiled()
+    {
+        return true;
+    }
+
+    size_t TransformPoints(const float* matrix, const float* points, float* outPoints, size_t count)
+    {
+        const __m256 m00 = _mm256_broadcast_ss(matrix + 0);
+        const __m256 m01 = _mm256_broadcast_ss(matrix + 1);
+        const __m256 m02 = _mm256_broadcast_ss(matrix + 2);
+        const __m256 m03 = _mm256_broadcast_ss(matrix + 3);
+        const __m256 m10 = _mm256_broadcast_ss(matrix + 4);
+        const __m256 m11 = _mm256_broadcast_ss(matrix + 5);
+        const __m256 m12 = _mm256_broadcast_ss(matrix + 6);
+        const __m256 m13 = _mm256_broadcast_ss(matrix + 7);
+        const __m256 m20 = _mm256_broadcast_ss(matrix + 8);
+        const __m256 m21 = _mm256_broadcast_ss(matrix + 9);
+        const __m256 m22 = _mm256_broadcast_ss(matrix + 10);
+        const __m256 m23 = _mm256_broadcast_ss(matrix + 11);
+
+        const size_t blockCount = count & ~size_t(7);
+        for (size_t i = 0; i < blockCount; i += 8)
+        {
+            __m256 x, y, z, w;
+            LoadTransposed(points + i * 4, 4, x, y, z, w);
+
+            const __m256 outX = _mm256_add_ps(Dot3(m00, m01, m02, x, y, z), m03);
+            const __m256 outY = _mm256_add_ps(Dot3(m10, m11, m12, x, y, z), m13);
+            const __m256 outZ = _mm256_add_ps(Dot3(m20, m21, m22, x, y, z), m23);
+            StoreTransposed(outPoints + i * 4, outX, outY, outZ, w);
+        }
+        return blockCount;
+    }
+
+    size_t OverlapsFrustum(const float* planes, const float* aabbs, bool* outOverlaps, size_t count, size_t& overlapCount)
+    {
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+        const __m256 zero = _mm256_setzero_ps();
+
+        const size_t blockCount = count & ~size_t(7);
+        for (size_t i = 0; i < blockCount; i += 8)
+        {
+            __m256 minX, minY, minZ, minW;
+            __m256 maxX, maxY, maxZ, maxW;
+            LoadTransposed(aabbs + i * 8, 8, minX, minY, minZ, minW);
+            LoadTransposed(aabbs + i * 8 + 4, 8, maxX, maxY, maxZ, maxW);
+
+            // Same as ShapeIntersection::Overlaps, the extents are halved before the subtraction to not overflow with FLT_MAX bounds.
+            const __m256 centerX = _mm256_mul_ps(half, _mm256_add_ps(minX, maxX));
+            const __m256 centerY = _mm256_mul_ps(half, _mm256_add_ps(minY, maxY));
+            const __m256 centerZ = _mm256_mul_ps(half, _mm256_add_ps(minZ, maxZ));
+            const __m256 extentsX = _mm256_sub_ps(_mm256_mul_ps(half, maxX), _mm256_mul_ps(half, minX));
+            const __m256 extentsY = _mm256_sub_ps(_mm256_mul_ps(half, maxY), _mm256_mul_ps(half, minY));
+            const __m256 extentsZ = _mm256_sub_ps(_mm256_mul_ps(half, maxZ), _mm256_mul_ps(half, minZ));
+
+            __m256 outside = zero;
+            for (size_t planeIndex = 0; planeIndex < 6; ++planeIndex)
+            {
+                const float* plane = planes + planeIndex * 4;
+                const __m256 normalX = _mm256_broadcast_ss(plane + 0);
+                const __m256 normalY = _mm256_broadcast_ss(plane + 1);
+                const __m256 normalZ = _mm256_broadcast_ss(plane + 2);
+                const __m256 distance = _mm256_broadcast_ss(plane + 3);
+
+                const __m256 centerDistance = _mm256_add_ps(Dot3(normalX, normalY, normalZ, centerX, centerY, centerZ), distance);
+                const __m256 radius = Dot3(
+                    _mm256_and_ps(normalX, absMask), _mm256_and_ps(normalY, absMask), _mm256_and_ps(normalZ, absMask),
+                    extentsX, extentsY, extentsZ);
+                outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(centerDistance, radius), zero, _CMP_LE_OQ));
+            }
+
+            const int outsideBits = _mm256_movemask_ps(outside);
+            for (size_t lane = 0; lane < 8; ++lane)
+            {
+                const bool overlaps = (outsideBits & (1 << lane)) == 0;
+                outOverlaps[i + lane] = overlaps;
+                overlapCount += overlaps ? 1 : 0;
+            }
+        }
+        return blockCount;
+    }
+#else
+    bool IsCompiled()
+    {
+        return false;
+    }
+
+    size_t TransformPoints(const float*, const float*, float*, size_t)
+    {
+        return 0;
+    }
+
+    size_t OverlapsFrustum(const float*, const float*, bool*, size_t, size_t&)
+    {
+        return 0;
+    }
+#endif
+} // namespace AZ::Simd::Batch::Avx2
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/IAllocator.h>
+#include <AzCore/Memory/OSAllocator_Platform.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/string/string.h>
+
+#include <stdio.h>
+
+namespace AZ::Debug
+{
+    namespace
+    {
+        // Bytes left to allocate on this thread before the next sample is taken
+        thread_local size_t t_bytesUntilSample = 0;
+        // State of the random generator that spreads the samples around the sampling interval
+        thread_local uint32_t t_randomState = 0;
+        // Guards against sampling the allocations made while a sample is recorded
+        thread_local bool t_isSampling = false;
+
+        size_t NextSampleDistance(size_t samplingInterval)
+        {
+            if (t_randomState == 0)
+            {
+                t_randomState = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&t_randomState)) | 1;
+            }
+
+            // xorshift32, the distance to the next sample is uniform between half and one and a half times the interval
+            t_randomState ^= t_randomState << 13;
+            t_randomState ^= t_randomState >> 17;
+            t_randomState ^= t_randomState << 5;
+            return samplingInterval / 2 + (t_randomState % (samplingInterval + 1));
+        }
+    } // namespace
+
+    AllocationSampler::SampleAllocator::pointer_type AllocationSampler::SampleAllocator::allocate(size_type byteSize, size_type alignment, int)
+    {
+        return AZ_OS_MALLOC(byteSize, alignment);
+    }
+
+    AllocationSampler::SampleAllocator::size_type AllocationSampler::SampleAllocator::resize(pointer_type, size_type)
+    {
+        return 0;
+    }
+
+    void AllocationSampler::SampleAllocator::deallocate(pointer_type ptr, size_type, size_type)
+    {
+        AZ_OS_FREE(ptr);
+    }
+
+    size_t AllocationSampler::GetAddressBucket(void* ptr)
+    {
+        // Allocations are at least 8 byte aligned, so the low bits carry no information
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr) >> 3;
+        return (address ^ (address >> 12)) & (AddressBucketCount - 1);
+    }
+
+    void AllocationSampler::SetSamplingInterval(size_t samplingInterval)
+    {
+        m_samplingInterval.store(samplingInterval, AZStd::memory_order_relaxed);
+        if (samplingInterval == 0)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_samplesMutex);
+            m_samples.clear();
+            for (AZStd::atomic<uint32_t>& count : m_sampledAddressCounts)
+            {
+                count.store(0, AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t AllocationSampler::GetSamplingInterval() const
+    {
+        return m_samplingInterval.load(AZStd::memory_order_relaxed);
+    }
+
+    void AllocationSampler::OnAllocation(IAllocator* allocator, void* ptr, size_t byteSize, const char* name)
+    {
+        const size_t samplingInterval = m_samplingInterval.load(AZStd::memory_order_relaxed);
+        if (samplingInterval == 0 || ptr == nullptr || t_isSampling)
+        {
+            return;
+        }
+
+        if (byteSize < t_bytesUntilSample)
+        {
+            t_bytesUntilSample -= byteSize;
+            return;
+        }
+        t_bytesUntilSample = NextSampleDistance(samplingInterval);
+
+        t_isSampling = true;
+
+        Sample sample;
+        sample.m_allocator = allocator;
+        sample.m_name = name;
+        sample.m_byteSize = byteSize;
+        sample.m_numFrames = StackRecorder::Record(sample.m_frames, MaxStackFrames, 2);
+        for (unsigned int frame = 0; frame < sample.m_numFrames; ++frame)
+        {
+            AZStd::hash_combine(sample.m_stackHash, sample.m_frames[frame].m_programCounter);
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_samplesMutex);
+            if (m_samples.insert_or_assign(ptr, sample).second)
+            {
+                m_sampledAddressCounts[GetAddressBucket(ptr)].fetch_add(1, AZStd::memory_order_relaxed);
+            }
+        }
+
+        t_isSampling = false;
+    }
+
+    void AllocationSampler::OnDeallocation(void* ptr)
+    {
+        if (ptr == nullptr || m_sampledAddressCounts[GetAddressBucket(ptr)].load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_samplesMutex);
+        if (m_samples.erase(ptr) != 0)
+        {
+            m_sampledAddressCounts[GetAddressBucket(ptr)].fetch_sub(1, AZStd::memory_order_relaxed);
+        }
+    }
+
+    void AllocationSampler::GetSnapshot(AZStd::vector<SnapshotEntry>& outEntries) const
+    {
+        outEntries.clear();
+        const size_t samplingInterval = GetSamplingInterval();
+
+        // Copy the samples with the OS allocator, so that no sampled allocation is made while the lock is held
+        AZStd::vector<Sample, SampleAllocator> samples;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_samplesMutex);
+            samples.reserve(m_samples.size());
+            for (const auto& [ptr, sample] : m_samples)
+            {
+                samples.push_back(sample);
+            }
+        }
+
+        for (const Sample& sample : samples)
+        {
+            const char* allocatorName = sample.m_allocator ? sample.m_allocator->GetName() : nullptr;
+            auto entryIter = AZStd::find_if(outEntries.begin(), outEntries.end(), [allocatorName, &sample](const SnapshotEntry& entry)
+            {
+                return entry.m_allocatorName == allocatorName && entry.m_allocationName == sample.m_name;
+            });
+            if (entryIter == outEntries.end())
+            {
+                SnapshotEntry& entry = outEntries.emplace_back();
+                entry.m_allocatorName = allocatorName;
+                entry.m_allocationName = sample.m_name;
+                entryIter = outEntries.end() - 1;
+            }
+
+            entryIter->m_sampleCount++;
+            entryIter->m_sampledBytes += sample.m_byteSize;
+            entryIter->m_estimatedBytes += AZStd::max(sample.m_byteSize, samplingInterval);
+        }
+    }
+
+    bool AllocationSampler::WriteHeapProfile(const char* filePath) const
+    {
+        struct StackEntry
+        {
+            const Sample* m_sample = nullptr;
+            size_t m_count = 0;
+            size_t m_bytes = 0;
+        };
+
+        AZStd::vector<Sample, SampleAllocator> samples;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_samplesMutex);
+            samples.reserve(m_samples.size());
+            for (const auto& [ptr, sample] : m_samples)
+            {
+                samples.push_back(sample);
+            }
+        }
+
+        // Group the samples by call stack
+        AZStd::unordered_map<size_t, StackEntry> stacks;
+        size_t totalCount = 0;
+        size_t totalBytes = 0;
+        for (const Sample& sample : samples)
+        {
+            StackEntry& stack = stacks[sample.m_stackHash];
+            stack.m_sample = &sample;
+            stack.m_count++;
+            stack.m_bytes += sample.m_byteSize;
+            totalCount++;
+            totalBytes += sample.m_byteSize;
+        }
+
+        // pprof's legacy heap profile format, the sampling interval lets pprof scale the samples back up
+        AZStd::string profile = AZStd::string::format(
+            "heap profile: %zu: %zu [%zu: %zu] @ heap_v2/%zu\n", totalCount, totalBytes, totalCount, totalBytes, GetSamplingInterval());
+        for (const auto& [stackHash, stack] : stacks)
+        {
+            profile += AZStd::string::format("%zu: %zu [%zu: %zu] @", stack.m_count, stack.m_bytes, stack.m_count, stack.m_bytes);
+            for (unsigned int frame = 0; frame < stack.m_sample->m_numFrames; ++frame)
+            {
+                profile += AZStd::string::format(" 0x%llx", static_cast<unsigned long long>(stack.m_sample->m_frames[frame].m_programCounter));
+            }
+            profile += '\n';
+        }
+
+#if defined(AZ_PLATFORM_LINUX)
+        // The memory map lets pprof symbolize the addresses
+        if (FILE* maps = fopen("/proc/self/maps", "r"))
+        {
+            profile += "\nMAPPED_LIBRARIES:\n";
+            char buffer[4096];
+            size_t bytesRead = 0;
+            while ((bytesRead = fread(buffer, 1, sizeof(buffer), maps)) > 0)
+            {
+                profile.append(buffer, bytesRead);
+            }
+            fclose(maps);
+        }
+#endif
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Memory", false, "Failed to open the heap profile file '%s'", filePath);
+            return false;
+        }
+        const bool written = file.Write(profile.data(), profile.size()) == profile.size();
+        file.Close();
+        return written;
+    }
+} // namespace AZ::Debug
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    class IAllocator;
+
+    namespace Debug
+    {
+        /**
+         * Low overhead sampling of the live allocations of all allocators, meant to stay enabled on long running processes.
+         * On average one allocation is sampled every sampling interval bytes, by counting down the allocated bytes per thread.
+         * Only the sampled allocations get their short call stack recorded, all other allocations just decrement the counter.
+         * The live samples can be aggregated per allocator and allocation name, or written as a pprof compatible heap profile.
+         * The sampler is owned by the AllocatorManager, see AllocatorManager::SetAllocationSamplingInterval.
+         */
+        class AllocationSampler
+        {
+        public:
+            //! Number of call stack frames recorded per sample.
+            static constexpr unsigned int MaxStackFrames = 8;
+
+            struct SnapshotEntry
+            {
+                const char* m_allocatorName = nullptr;
+                const char* m_allocationName = nullptr; //!< The name passed to the allocation, or nullptr when there was none.
+                size_t m_sampleCount = 0;
+                size_t m_sampledBytes = 0;
+                size_t m_estimatedBytes = 0; //!< The live bytes the samples stand for, every sample counts for at least the sampling interval.
+            };
+
+            AllocationSampler() = default;
+            AZ_DISABLE_COPY_MOVE(AllocationSampler);
+
+            //! Sets the average number of bytes between two samples, 0 disables the sampling and forgets the samples.
+            void SetSamplingInterval(size_t samplingInterval);
+            size_t GetSamplingInterval() const;
+
+            AZ_FORCE_INLINE bool IsEnabled() const
+            {
+                return m_samplingInterval.load(AZStd::memory_order_relaxed) != 0;
+            }
+
+            //! Called by the allocators for every allocation and deallocation while sampling is enabled.
+            //! @{
+            void OnAllocation(IAllocator* allocator, void* ptr, size_t byteSize, const char* name);
+            void OnDeallocation(void* ptr);
+            //! @}
+
+            //! Returns the live samples, aggregated per allocator and allocation name.
+            void GetSnapshot(AZStd::vector<SnapshotEntry>& outEntries) const;
+
+            //! Writes the live samples grouped by call stack, in the legacy heap profile format that pprof reads.
+            bool WriteHeapProfile(const char* filePath) const;
+
+        private:
+            struct Sample
+            {
+                IAllocator* m_allocator = nullptr;
+                const char* m_name = nullptr;
+                size_t m_byteSize = 0;
+                size_t m_stackHash = 0;
+                StackFrame m_frames[MaxStackFrames];
+                unsigned int m_numFrames = 0;
+            };
+
+            // Counts of the sampled addresses per bucket, so that deallocations of unsampled addresses skip the lock
+            static constexpr size_t AddressBucketCount = 4096;
+            static size_t GetAddressBucket(void* ptr);
+
+            // The samples are stored with the OS allocator directly, so that storing them doesn't get sampled itself
+            class SampleAllocator
+            {
+            public:
+                using pointer_type = void*;
+                using size_type = AZStd::size_t;
+                using difference_type = AZStd::ptrdiff_t;
+                using allow_memory_leaks = AZStd::false_type;
+
+                pointer_type allocate(size_type byteSize, size_type alignment, int flags = 0);
+                size_type resize(pointer_type ptr, size_type newSize);
+                void deallocate(pointer_type ptr, size_type byteSize, size_type alignment);
+
+                bool operator==(const SampleAllocator&) const { return true; }
+                bool operator!=(const SampleAllocator&) const { return false; }
+            };
+
+            using SampleMap = AZStd::unordered_map<void*, Sample, AZStd::hash<void*>, AZStd::equal_to<void*>, SampleAllocator>;
+
+            AZStd::atomic<size_t> m_samplingInterval{ 0 };
+            AZStd::array<AZStd::atomic<uint32_t>, AddressBucketCount> m_sampledAddressCounts = {};
+            mutable AZStd::mutex m_samplesMutex;
+            SampleMap m_samples;
+        };
+    } // namespace Debug
+} // namespace AZ
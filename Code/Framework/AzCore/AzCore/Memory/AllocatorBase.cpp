@@ -8,6 +8,7 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationSampler.h>
 
 // Only used to create recordings of memory operations to use for memory benchmarks
 #define O3DE_RECORDING_ENABLED 0
@@ -264,6 +265,11 @@ namespace AZ
         return m_isProfilingActive;
     }
 
+    void AllocatorBase::SetAllocationSampler(Debug::AllocationSampler* sampler)
+    {
+        m_allocationSampler = sampler;
+    }
+
     void AllocatorBase::DisableRegistration()
     {
         m_registrationEnabled = false;
@@ -281,6 +287,11 @@ namespace AZ
             }
         }
 
+        if (m_allocationSampler && m_allocationSampler->IsEnabled())
+        {
+            m_allocationSampler->OnAllocation(this, ptr, byteSize, name);
+        }
+
 #if O3DE_RECORDING_ENABLED
         RecordAllocatorOperation(AllocatorOperation::ALLOCATE, ptr, byteSize, alignment);
 #endif
@@ -296,6 +307,11 @@ namespace AZ
                 records->UnregisterAllocation(ptr, byteSize, alignment, info);
             }
         }
+
+        if (m_allocationSampler && m_allocationSampler->IsEnabled())
+        {
+            m_allocationSampler->OnDeallocation(ptr);
+        }
 #if O3DE_RECORDING_ENABLED
         RecordAllocatorOperation(AllocatorOperation::DEALLOCATE, ptr, byteSize, alignment);
 #endif
@@ -313,6 +329,11 @@ namespace AZ
             ProfileDeallocation(ptr, 0, 0, &info);
             ProfileAllocation(newPtr, newSize, newAlignment, info.m_name, info.m_fileName, info.m_lineNum, 0);
         }
+        else if (m_allocationSampler && m_allocationSampler->IsEnabled())
+        {
+            m_allocationSampler->OnDeallocation(ptr);
+            m_allocationSampler->OnAllocation(this, newPtr, newSize, nullptr);
+        }
 #if O3DE_RECORDING_ENABLED
         RecordAllocatorOperation(AllocatorOperation::DEALLOCATE, ptr);
         RecordAllocatorOperation(AllocatorOperation::ALLOCATE, newPtr, newSize, newAlignment);
@@ -41,6 +41,7 @@ namespace AZ
         bool IsLazilyCreated() const final;
         void SetProfilingActive(bool active) final;
         bool IsProfilingActive() const final;
+        void SetAllocationSampler(Debug::AllocationSampler* sampler) final;
         //---------------------------------------------------------------------
 
     protected:
@@ -97,6 +98,7 @@ namespace AZ
         const char* m_name = nullptr;
         const char* m_desc = nullptr;
         Debug::AllocationRecords* m_records = nullptr;  // Cached pointer to allocation records
+        Debug::AllocationSampler* m_allocationSampler = nullptr;
         size_t m_memoryGuardSize = 0;
         bool m_isLazilyCreated = false;
         bool m_isProfilingActive = false;
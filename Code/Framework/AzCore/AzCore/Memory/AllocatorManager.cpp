@@ -14,8 +14,11 @@
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/MallocSchema.h>
 
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/containers/array.h>
 
 namespace AZ::Internal
@@ -178,6 +181,7 @@ AllocatorManager::RegisterAllocator(class IAllocator* alloc)
     }
 
     alloc->SetProfilingActive(m_profilingRefcount.load() > 0);
+    alloc->SetAllocationSampler(m_allocationSampler.IsEnabled() ? &m_allocationSampler : nullptr);
 
     m_allocators[m_numAllocators++] = alloc;
 }
@@ -343,6 +347,18 @@ AllocatorManager::ExitProfilingMode()
     AZ_Assert(m_profilingRefcount.load() >= 0, "ExitProfilingMode called without matching EnterProfilingMode");
 }
 
+void
+AllocatorManager::SetAllocationSamplingInterval(size_t samplingInterval)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+
+    m_allocationSampler.SetSamplingInterval(samplingInterval);
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        m_allocators[i]->SetAllocationSampler(samplingInterval > 0 ? &m_allocationSampler : nullptr);
+    }
+}
+
 void
 AllocatorManager::DumpAllocators()
 {
@@ -377,6 +393,20 @@ AllocatorManager::DumpAllocators()
     }
 
     AZ_Printf(TAG, "-,Totals,%.2f,%.2f,%.2f\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
+
+    AZ_Printf(TAG, "Allocator,Thread,Cached kb,Hits,Refills,Trims\n");
+    for (int i = 0; i < m_numAllocators; i++)
+    {
+        IAllocator* allocator = GetAllocator(i);
+        AllocatorThreadCacheStats threadStats[MaxThreadCacheStats];
+        const size_t numThreadStats = AZStd::GetMin(allocator->GetThreadCacheStats(threadStats, MaxThreadCacheStats), MaxThreadCacheStats);
+        for (size_t threadIndex = 0; threadIndex < numThreadStats; ++threadIndex)
+        {
+            const AllocatorThreadCacheStats& stats = threadStats[threadIndex];
+            AZ_Printf(TAG, "%s,%llu,%.2f,%zu,%zu,%zu\n", allocator->GetName(), (unsigned long long)(stats.m_threadId),
+                stats.m_cachedBytes / 1024.0f, stats.m_hitCount, stats.m_refillCount, stats.m_trimCount);
+        }
+    }
 }
 void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
 {
@@ -404,6 +434,23 @@ void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacit
     }
 }
 
+void AllocatorManager::GetThreadCacheStats(AZStd::vector<ThreadCacheStats>& outStats)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    const int allocatorCount = GetNumAllocators();
+    for (int i = 0; i < allocatorCount; ++i)
+    {
+        IAllocator* allocator = GetAllocator(i);
+        // Copy the stats first, the allocator can't be used while it reports them
+        AllocatorThreadCacheStats threadStats[MaxThreadCacheStats];
+        const size_t numThreadStats = AZStd::GetMin(allocator->GetThreadCacheStats(threadStats, MaxThreadCacheStats), MaxThreadCacheStats);
+        for (size_t threadIndex = 0; threadIndex < numThreadStats; ++threadIndex)
+        {
+            outStats.emplace_back(allocator->GetName(), threadStats[threadIndex]);
+        }
+    }
+}
+
 //=========================================================================
 // MemoryBreak
 // [2/24/2011]
@@ -493,4 +540,59 @@ AllocatorManager::DebugBreak(void* address, const Debug::AllocationInfo& info)
     }
 }
 
+static void MemorySetSamplingInterval(const AZ::ConsoleCommandContainer& arguments)
+{
+    size_t samplingInterval = 0;
+    if (arguments.empty() || !AZ::ConsoleTypeHelpers::StringToValue(samplingInterval, arguments.front()))
+    {
+        AZ_Warning("Memory", false, "MemorySetSamplingInterval expects the average number of bytes between samples, 0 disables the sampling");
+        return;
+    }
+    AllocatorManager::Instance().SetAllocationSamplingInterval(samplingInterval);
+}
+AZ_CONSOLEFREEFUNC(MemorySetSamplingInterval, AZ::ConsoleFunctorFlags::DontReplicate, "Samples the allocations of all allocators, on average one allocation every <interval> bytes, 0 disables the sampling");
+
+static void MemoryDumpSamples([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+{
+    const Debug::AllocationSampler& sampler = AllocatorManager::Instance().GetAllocationSampler();
+    if (!sampler.IsEnabled())
+    {
+        AZ_Printf("Memory", "Allocation sampling is disabled, enable it with MemorySetSamplingInterval\n");
+        return;
+    }
+
+    AZStd::vector<Debug::AllocationSampler::SnapshotEntry> entries;
+    sampler.GetSnapshot(entries);
+    AZStd::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs)
+    {
+        return lhs.m_estimatedBytes > rhs.m_estimatedBytes;
+    });
+
+    AZ_Printf("Memory", "%-32s %-48s %10s %16s\n", "Allocator", "Allocation", "Samples", "Estimated KB");
+    for (const Debug::AllocationSampler::SnapshotEntry& entry : entries)
+    {
+        AZ_Printf("Memory", "%-32s %-48s %10zu %16.2f\n",
+            entry.m_allocatorName ? entry.m_allocatorName : "<unknown>",
+            entry.m_allocationName ? entry.m_allocationName : "<unnamed>",
+            entry.m_sampleCount, static_cast<double>(entry.m_estimatedBytes) / 1024.0);
+    }
+}
+AZ_CONSOLEFREEFUNC(MemoryDumpSamples, AZ::ConsoleFunctorFlags::DontReplicate, "Prints the estimated live memory per allocator and allocation name from the sampled allocations");
+
+static void MemoryWriteHeapProfile(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.empty())
+    {
+        AZ_Warning("Memory", false, "MemoryWriteHeapProfile expects the path of the file to write");
+        return;
+    }
+
+    const AZStd::string filePath(arguments.front());
+    if (AllocatorManager::Instance().GetAllocationSampler().WriteHeapProfile(filePath.c_str()))
+    {
+        AZ_Printf("Memory", "Wrote the heap profile to %s\n", filePath.c_str());
+    }
+}
+AZ_CONSOLEFREEFUNC(MemoryWriteHeapProfile, AZ::ConsoleFunctorFlags::DontReplicate, "Writes the sampled allocations to <file> as a heap profile that pprof reads");
+
 } // namespace AZ
@@ -9,6 +9,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -91,6 +92,11 @@ namespace AZ
         void EnterProfilingMode();
         void ExitProfilingMode();
 
+        /// Samples the live allocations of all allocators, on average one allocation every samplingInterval bytes. 0 disables the sampling.
+        /// Unlike the allocation records this is cheap enough to stay enabled, see Debug::AllocationSampler.
+        void SetAllocationSamplingInterval(size_t samplingInterval);
+        const Debug::AllocationSampler& GetAllocationSampler() const { return m_allocationSampler; }
+
         /// Outputs allocator useage to the console, and also stores the values in m_dumpInfo for viewing in the crash dump
         void DumpAllocators();
 
@@ -120,6 +126,20 @@ namespace AZ
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
 
+        struct ThreadCacheStats
+        {
+            ThreadCacheStats(const char* allocatorName, const AllocatorThreadCacheStats& stats)
+                : m_allocatorName(allocatorName)
+                , m_stats(stats)
+            {}
+
+            AZStd::string m_allocatorName;
+            AllocatorThreadCacheStats m_stats;
+        };
+
+        /// Returns the stats of the per thread caches of all allocators, one entry per allocator and thread.
+        void GetThreadCacheStats(AZStd::vector<ThreadCacheStats>& outStats);
+
         //////////////////////////////////////////////////////////////////////////
         // Debug support
         static const int MaxNumMemoryBreaks = 5;
@@ -154,6 +174,7 @@ namespace AZ
         AllocatorManager& operator=(const AllocatorManager&);
 
         static const int m_maxNumAllocators = 100;
+        static constexpr size_t MaxThreadCacheStats = 64; ///< Max number of thread caches reported per allocator.
         IAllocator*         m_allocators[m_maxNumAllocators];
         volatile int        m_numAllocators;
         OutOfMemoryCBType   m_outOfMemoryListener;
@@ -166,6 +187,8 @@ namespace AZ
 
         AZStd::atomic<int>  m_profilingRefcount;
 
+        Debug::AllocationSampler m_allocationSampler;
+
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
         AZStd::unique_ptr<AZ::MallocSchema, void(*)(AZ::MallocSchema*)> m_mallocSchema;
 
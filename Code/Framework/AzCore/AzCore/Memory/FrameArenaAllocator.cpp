@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    namespace
+    {
+        //! Block of the current frame arena the thread allocates from.
+        struct ThreadBlock
+        {
+            AZ::u64 m_frameSerial = 0;
+            char* m_cursor = nullptr;
+            char* m_end = nullptr;
+        };
+
+        thread_local ThreadBlock s_threadBlock;
+
+        //! Shared by all the frame arena allocators so a serial never matches the block of another allocator.
+        AZStd::atomic<AZ::u64> s_frameSerialCounter{ 0 };
+
+        constexpr size_t FrameMemoryAlignment = 64;
+
+        AZ_FORCE_INLINE char* AllocateFromBlock(ThreadBlock& block, size_t byteSize, size_t alignment)
+        {
+            char* address = AZ::PointerAlignUp(block.m_cursor, alignment);
+            if (address + byteSize <= block.m_end)
+            {
+                block.m_cursor = address + byteSize;
+                return address;
+            }
+            return nullptr;
+        }
+    } // namespace
+
+    FrameArenaAllocator::FrameArenaAllocator()
+        : AllocatorBase(this, "FrameArenaAllocator", "Linear allocator for memory released at the end of the frame")
+    {
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator() = default;
+
+    bool FrameArenaAllocator::Create(const Descriptor& desc)
+    {
+        AZ_Assert(AllocatorInstance<SystemAllocator>::IsReady(), "FrameArenaAllocator requires the SystemAllocator");
+        AZ_Assert(desc.m_frameCount >= 2 && desc.m_frameCount <= MaxFrameCount, "Frame count must be 2 or 3, it is %u", desc.m_frameCount);
+        AZ_Assert(desc.m_threadBlockByteSize > 0 && desc.m_threadBlockByteSize <= desc.m_frameByteSize,
+            "Thread block size (%zu) must fit in the frame (%zu)", desc.m_threadBlockByteSize, desc.m_frameByteSize);
+
+        m_desc = desc;
+        m_desc.m_frameCount = AZStd::clamp(desc.m_frameCount, 2u, MaxFrameCount);
+        m_currentFrame.store(0, AZStd::memory_order_relaxed);
+        m_frameSerial.store(++s_frameSerialCounter, AZStd::memory_order_release);
+        m_lastFrameOverflowBytes = 0;
+        m_lastFrameOverflowCount = 0;
+        m_isReady = true;
+        return true;
+    }
+
+    void FrameArenaAllocator::Destroy()
+    {
+        for (Frame& frame : m_frames)
+        {
+            ReleaseFrame(frame);
+            frame.m_overflowAllocations.set_capacity(0);
+            if (char* memory = frame.m_memory.exchange(nullptr))
+            {
+                AllocatorInstance<SystemAllocator>::Get().DeAllocate(memory, m_desc.m_frameByteSize, FrameMemoryAlignment);
+            }
+        }
+        // Invalidates the thread blocks pointing into the freed memory
+        m_frameSerial.store(++s_frameSerialCounter, AZStd::memory_order_release);
+        m_isReady = false;
+    }
+
+    void FrameArenaAllocator::NextFrame()
+    {
+        const unsigned int currentFrame = m_currentFrame.load(AZStd::memory_order_relaxed);
+        Frame& closingFrame = m_frames[currentFrame];
+        m_lastFrameOverflowBytes = closingFrame.m_overflowBytes.load(AZStd::memory_order_relaxed);
+        m_lastFrameOverflowCount = closingFrame.m_overflowAllocations.size();
+        AZ_Warning("FrameArenaAllocator", m_lastFrameOverflowCount == 0,
+            "%zu bytes in %zu allocations did not fit in the %zu bytes frame arena and were allocated from the SystemAllocator. "
+            "Consider increasing the frame arena size.",
+            m_lastFrameOverflowBytes, m_lastFrameOverflowCount, m_desc.m_frameByteSize);
+
+        const unsigned int nextFrame = (currentFrame + 1) % m_desc.m_frameCount;
+        ReleaseFrame(m_frames[nextFrame]);
+        m_currentFrame.store(nextFrame, AZStd::memory_order_release);
+        m_frameSerial.store(++s_frameSerialCounter, AZStd::memory_order_release);
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Allocations are never freed individually, tracking them would report every one as a leak
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    FrameArenaAllocator::pointer_type FrameArenaAllocator::Allocate(
+        size_type byteSize,
+        size_type alignment,
+        [[maybe_unused]] int flags,
+        [[maybe_unused]] const char* name,
+        [[maybe_unused]] const char* fileName,
+        [[maybe_unused]] int lineNum,
+        [[maybe_unused]] unsigned int suppressStackRecord)
+    {
+        AZ_Assert(m_isReady, "FrameArenaAllocator is not created");
+        alignment = AZStd::max<size_type>(alignment, 1);
+
+        const AZ::u64 frameSerial = m_frameSerial.load(AZStd::memory_order_acquire);
+        ThreadBlock& block = s_threadBlock;
+        if (block.m_frameSerial == frameSerial)
+        {
+            if (char* address = AllocateFromBlock(block, byteSize, alignment))
+            {
+                return address;
+            }
+        }
+
+        Frame& frame = m_frames[m_currentFrame.load(AZStd::memory_order_acquire)];
+        const size_t requiredSize = byteSize + alignment - 1;
+        if (requiredSize > m_desc.m_threadBlockByteSize / 4)
+        {
+            // Large allocations are claimed on their own, so they don't waste the rest of the thread block
+            size_t claimedSize = requiredSize;
+            if (char* memory = ClaimFromFrame(frame, requiredSize, claimedSize))
+            {
+                return AZ::PointerAlignUp(memory, alignment);
+            }
+        }
+        else
+        {
+            // Near the end of the arena the thread takes what is left
+            size_t claimedSize = m_desc.m_threadBlockByteSize;
+            if (char* memory = ClaimFromFrame(frame, requiredSize, claimedSize))
+            {
+                block.m_frameSerial = frameSerial;
+                block.m_cursor = memory;
+                block.m_end = memory + claimedSize;
+                return AllocateFromBlock(block, byteSize, alignment);
+            }
+        }
+
+        return AllocateOverflow(frame, byteSize, alignment);
+    }
+
+    void FrameArenaAllocator::DeAllocate(
+        [[maybe_unused]] pointer_type ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] size_type alignment)
+    {
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::Resize([[maybe_unused]] pointer_type ptr, [[maybe_unused]] size_type newSize)
+    {
+        return 0;
+    }
+
+    FrameArenaAllocator::pointer_type FrameArenaAllocator::ReAllocate(
+        [[maybe_unused]] pointer_type ptr, [[maybe_unused]] size_type newSize, [[maybe_unused]] size_type newAlignment)
+    {
+        AZ_Assert(false, "FrameArenaAllocator doesn't support reallocation");
+        return nullptr;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::AllocationSize([[maybe_unused]] pointer_type ptr)
+    {
+        return 0;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::NumAllocatedBytes() const
+    {
+        size_type allocatedBytes = 0;
+        for (unsigned int i = 0; i < m_desc.m_frameCount; ++i)
+        {
+            allocatedBytes += m_frames[i].m_offset.load(AZStd::memory_order_relaxed);
+            allocatedBytes += m_frames[i].m_overflowBytes.load(AZStd::memory_order_relaxed);
+        }
+        return allocatedBytes;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::Capacity() const
+    {
+        return m_desc.m_frameCount * m_desc.m_frameByteSize;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetMaxAllocationSize() const
+    {
+        return m_desc.m_frameByteSize;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetMaxContiguousAllocationSize() const
+    {
+        return m_desc.m_frameByteSize;
+    }
+
+    char* FrameArenaAllocator::ClaimFromFrame(Frame& frame, size_t minByteSize, size_t& byteSize)
+    {
+        char* memory = frame.m_memory.load(AZStd::memory_order_acquire);
+        if (!memory)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_frameMemoryMutex);
+            memory = frame.m_memory.load(AZStd::memory_order_relaxed);
+            if (!memory)
+            {
+                memory = reinterpret_cast<char*>(AllocatorInstance<SystemAllocator>::Get().Allocate(
+                    m_desc.m_frameByteSize, FrameMemoryAlignment, 0, "FrameArenaAllocator frame", __FILE__, __LINE__));
+                frame.m_memory.store(memory, AZStd::memory_order_release);
+            }
+        }
+
+        size_t offset = frame.m_offset.load(AZStd::memory_order_relaxed);
+        size_t claimedSize;
+        do
+        {
+            const size_t available = m_desc.m_frameByteSize - offset;
+            if (available < minByteSize)
+            {
+                return nullptr;
+            }
+            claimedSize = AZStd::min(byteSize, available);
+        } while (!frame.m_offset.compare_exchange_weak(offset, offset + claimedSize, AZStd::memory_order_relaxed));
+
+        byteSize = claimedSize;
+        return memory + offset;
+    }
+
+    void* FrameArenaAllocator::AllocateOverflow(Frame& frame, size_t byteSize, size_t alignment)
+    {
+        void* address = AllocatorInstance<SystemAllocator>::Get().Allocate(
+            byteSize, alignment, 0, "FrameArenaAllocator overflow", __FILE__, __LINE__);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(frame.m_overflowMutex);
+            frame.m_overflowAllocations.push_back(address);
+        }
+        frame.m_overflowBytes.fetch_add(byteSize, AZStd::memory_order_relaxed);
+        return address;
+    }
+
+    void FrameArenaAllocator::ReleaseFrame(Frame& frame)
+    {
+        for (void* address : frame.m_overflowAllocations)
+        {
+            AllocatorInstance<SystemAllocator>::Get().DeAllocate(address);
+        }
+        frame.m_overflowAllocations.clear();
+        frame.m_overflowBytes.store(0, AZStd::memory_order_relaxed);
+        frame.m_offset.store(0, AZStd::memory_order_relaxed);
+    }
+} // namespace AZ
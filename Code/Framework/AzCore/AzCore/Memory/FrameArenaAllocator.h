@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Linear allocator for memory that only lives for the current frame, like culling results, draw lists or
+     * physics query results. Allocations are bumped from a per frame arena and never freed individually,
+     * all the memory of a frame is released at once when its arena is reused.
+     *
+     * The arenas are double or triple buffered: memory allocated during a frame stays valid until
+     * NextFrame has been called m_frameCount times, so data can be handed to the next frame.
+     * ComponentApplication creates the allocator and calls NextFrame at the start of every Tick.
+     *
+     * Each thread claims blocks of m_threadBlockByteSize bytes from the frame arena and allocates from its
+     * block without synchronization. Allocations that don't fit in the frame arena fall back to the
+     * SystemAllocator (they are released with the frame as well) and are reported when the frame ends.
+     *
+     * Use FrameArena as the allocator of AZStd containers: AZStd::vector<T, AZ::FrameArena>.
+     * Constraints:
+     * - deallocating is a no-op, reallocating is not supported;
+     * - NextFrame must not run while allocations are made on other threads.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{5E3F0D41-8A0C-4E57-B44E-2A2E6F1B9C73}");
+
+        static constexpr unsigned int MaxFrameCount = 3;
+
+        struct Descriptor
+        {
+            unsigned int m_frameCount = 2;                      ///< Number of frames an allocation stays valid, 2 (double buffered) or 3 (triple buffered).
+            size_t m_frameByteSize = 4 * 1024 * 1024;           ///< Size of the arena of each frame, reserved from the SystemAllocator when the frame first allocates.
+            size_t m_threadBlockByteSize = 64 * 1024;           ///< Size of the blocks threads claim from the frame arena. Larger allocations are claimed on their own.
+        };
+
+        FrameArenaAllocator();
+        ~FrameArenaAllocator() override;
+
+        bool Create(const Descriptor& desc);
+        void Destroy() override;
+
+        //! Starts a new frame, releasing the memory allocated m_frameCount frames ago.
+        void NextFrame();
+
+        //! Memory of the last completed frame that did not fit in its arena and was allocated from the SystemAllocator.
+        size_type GetLastFrameOverflowBytes() const { return m_lastFrameOverflowBytes; }
+        size_type GetLastFrameOverflowCount() const { return m_lastFrameOverflowCount; }
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocatorSchema
+        pointer_type    Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        /// Memory is released with its frame, deallocating does nothing.
+        void            DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        size_type       Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type    ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type       AllocationSize(pointer_type ptr) override;
+
+        size_type       NumAllocatedBytes() const override;
+        size_type       Capacity() const override;
+        size_type       GetMaxAllocationSize() const override;
+        size_type       GetMaxContiguousAllocationSize() const override;
+
+    private:
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+
+        struct Frame
+        {
+            AZStd::atomic<char*> m_memory{ nullptr };
+            AZStd::atomic<size_t> m_offset{ 0 };
+            AZStd::mutex m_overflowMutex;
+            AZStd::vector<void*, OSStdAllocator> m_overflowAllocations;
+            AZStd::atomic<size_t> m_overflowBytes{ 0 };
+        };
+
+        //! Claims up to byteSize bytes and at least minByteSize bytes from the arena of the frame, byteSize is set to the claimed size.
+        //! Returns nullptr when the arena is full.
+        char* ClaimFromFrame(Frame& frame, size_t minByteSize, size_t& byteSize);
+        void* AllocateOverflow(Frame& frame, size_t byteSize, size_t alignment);
+        void ReleaseFrame(Frame& frame);
+
+        Descriptor m_desc;
+        Frame m_frames[MaxFrameCount];
+        AZStd::atomic<unsigned int> m_currentFrame{ 0 };
+        //! Unique per frame and allocator, tells the threads their block belongs to a previous frame.
+        AZStd::atomic<AZ::u64> m_frameSerial{ 0 };
+        AZStd::mutex m_frameMemoryMutex;
+        size_type m_lastFrameOverflowBytes = 0;
+        size_type m_lastFrameOverflowCount = 0;
+        bool m_isReady = false;
+    };
+
+    //! AZStd allocator for containers that only live for the current frame.
+    using FrameArena = AZStdAlloc<FrameArenaAllocator>;
+} // namespace AZ
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
@@ -57,6 +58,9 @@ namespace AZ
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+// Enables per thread caches of free small blocks in front of the buckets
+#define USE_THREAD_CACHE
+
     namespace HphaInternal
     {
         //! Rounds up a value to next power of 2.
@@ -157,6 +161,15 @@ namespace AZ
 
         static const size_t NUM_BUCKETS  = (MAX_SMALL_ALLOCATION / MIN_ALLOCATION);
 
+        // buckets with elements up to this size are served from the per thread caches
+        static const size_t THREAD_CACHE_MAX_SIZE = 256;
+        static const size_t THREAD_CACHE_NUM_BUCKETS = (THREAD_CACHE_MAX_SIZE / MIN_ALLOCATION);
+        // number of allocators a thread can keep a cache for at the same time
+        static const size_t THREAD_CACHE_MAX_ALLOCATORS = 4;
+        // amount of memory moved from a bucket to an empty thread cache bin in one go
+        static const size_t THREAD_CACHE_REFILL_SIZE = 1024;
+        static const size_t THREAD_CACHE_MAX_REFILL_COUNT = 32;
+
         static inline bool is_small_allocation(size_t s)
         {
             return s + MEMORY_GUARD_SIZE <= MAX_SMALL_ALLOCATION;
@@ -334,6 +347,84 @@ namespace AZ
         size_t bucket_get_max_allocation() const;
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
+        /// allocate up to count elements from a bucket under a single lock, they are pushed to the head list. Returns the number allocated.
+        size_t bucket_alloc_batch(unsigned bi, free_link*& head, size_t count);
+        /// free a list of count elements to a bucket under a single lock
+        void bucket_free_batch(unsigned bi, free_link* head, size_t count);
+
+#if defined(USE_THREAD_CACHE)
+        // Free bucket elements kept by a thread, so small allocations and frees do not lock the bucket or update the
+        // shared counters. Elements in a cache are still allocated from the bucket point of view. An empty bin is refilled
+        // with several elements under one bucket lock, and the cache is trimmed back to the buckets when the thread exits,
+        // when it goes over the high-watermark and when the thread calls purge
+        struct thread_cache
+        {
+            struct bin
+            {
+                free_link* mHead = nullptr;
+                size_t mCount = 0;
+            };
+
+            AZStd::atomic<HpAllocator*> mOwner{ nullptr }; // allocator the cache belongs to, nullptr if the cache is unused
+            thread_cache* mNext = nullptr; // next cache registered with mOwner, guarded by the registry mutex
+            AZStd::native_thread_id_type mThreadId = AZStd::native_thread_invalid_id;
+            bin mBins[THREAD_CACHE_NUM_BUCKETS];
+            // only written by the thread owning the cache, read when reporting
+            AZStd::atomic<size_t> mCachedBytes{ 0 };
+            AZStd::atomic<size_t> mHitCount{ 0 };
+            AZStd::atomic<size_t> mRefillCount{ 0 };
+            AZStd::atomic<size_t> mTrimCount{ 0 };
+        };
+
+        // caches of one thread, one per allocator the thread uses
+        struct thread_cache_table
+        {
+            ~thread_cache_table();
+            thread_cache mCaches[THREAD_CACHE_MAX_ALLOCATORS];
+        };
+
+        static thread_cache_table& thread_cache_get_table();
+        // guards the registration of caches with their allocator
+        static AZStd::mutex& thread_cache_registry_mutex();
+        // returns the calling thread cache for this allocator, nullptr if caching is disabled or the thread has no free cache slot
+        thread_cache* thread_cache_get(bool create);
+        thread_cache* thread_cache_register(thread_cache_table& table);
+        // returns all the elements of the cache to the buckets and unregisters it, the registry mutex must be held
+        void thread_cache_release(thread_cache& cache);
+        void* thread_cache_alloc(unsigned bi);
+        void thread_cache_free(void* ptr, unsigned bi);
+        // returns the elements of a bin past keepCount to the bucket
+        void thread_cache_trim_bin(thread_cache& cache, unsigned bi, size_t keepCount);
+        // halves every bin, or empties them when keepHalf is false
+        void thread_cache_trim(thread_cache& cache, bool keepHalf);
+        size_t thread_cache_cached_bytes() const;
+        size_t thread_cache_get_stats(AZ::AllocatorThreadCacheStats* outStats, size_t maxStats) const;
+
+        thread_cache* mThreadCaches = nullptr; // guarded by the registry mutex
+        size_t m_threadCacheHighWatermark = 0;
+#endif
+
+        void* bucket_alloc_small(unsigned bi)
+        {
+#if defined(USE_THREAD_CACHE)
+            if (bi < THREAD_CACHE_NUM_BUCKETS && m_threadCacheHighWatermark)
+            {
+                return thread_cache_alloc(bi);
+            }
+#endif
+            return bucket_alloc_direct(bi);
+        }
+
+        void bucket_free_small(void* ptr, unsigned bi)
+        {
+#if defined(USE_THREAD_CACHE)
+            if (bi < THREAD_CACHE_NUM_BUCKETS && m_threadCacheHighWatermark)
+            {
+                return thread_cache_free(ptr, bi);
+            }
+#endif
+            bucket_free_direct(ptr, bi);
+        }
 
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
@@ -609,7 +700,7 @@ namespace AZ
             if (m_isPoolAllocations && is_small_allocation(size))
             {
                 size = clamp_small_allocation(size);
-                void* ptr = bucket_alloc_direct(bucket_spacing_function(size + MEMORY_GUARD_SIZE));
+                void* ptr = bucket_alloc_small(bucket_spacing_function(size + MEMORY_GUARD_SIZE));
                 debug_add(ptr, size, DEBUG_SOURCE_BUCKETS);
                 return ptr;
             }
@@ -638,7 +729,7 @@ namespace AZ
             if (m_isPoolAllocations && is_small_allocation(size) && alignment <= MAX_SMALL_ALLOCATION)
             {
                 size = clamp_small_allocation(size);
-                void* ptr = bucket_alloc_direct(bucket_spacing_function(AZ::SizeAlignUp(size + MEMORY_GUARD_SIZE, alignment)));
+                void* ptr = bucket_alloc_small(bucket_spacing_function(AZ::SizeAlignUp(size + MEMORY_GUARD_SIZE, alignment)));
                 debug_add(ptr, size, DEBUG_SOURCE_BUCKETS);
                 return ptr;
             }
@@ -871,7 +962,7 @@ namespace AZ
             if (ptr_in_bucket(ptr))
             {
                 debug_remove(ptr, DEBUG_UNKNOWN_SIZE, DEBUG_SOURCE_BUCKETS);
-                return bucket_free(ptr);
+                return bucket_free_small(ptr, ptr_get_page(ptr)->bucket_index());
             }
             debug_remove(ptr, DEBUG_UNKNOWN_SIZE, DEBUG_SOURCE_TREE);
             tree_free(ptr);
@@ -889,7 +980,7 @@ namespace AZ
                 // if this asserts probably the original alloc used alignment
                 HPPA_ASSERT(ptr_in_bucket(ptr));
                 debug_remove(ptr, origSize, DEBUG_SOURCE_BUCKETS);
-                return bucket_free_direct(ptr, bucket_spacing_function(origSize + MEMORY_GUARD_SIZE));
+                return bucket_free_small(ptr, bucket_spacing_function(origSize + MEMORY_GUARD_SIZE));
             }
             debug_remove(ptr, origSize, DEBUG_SOURCE_TREE);
             tree_free(ptr);
@@ -906,7 +997,7 @@ namespace AZ
             {
                 HPPA_ASSERT(ptr_in_bucket(ptr), "small object ptr not in a bucket");
                 debug_remove(ptr, origSize, DEBUG_SOURCE_BUCKETS);
-                return bucket_free_direct(ptr, bucket_spacing_function(AZ::SizeAlignUp(origSize + MEMORY_GUARD_SIZE, oldAlignment)));
+                return bucket_free_small(ptr, bucket_spacing_function(AZ::SizeAlignUp(origSize + MEMORY_GUARD_SIZE, oldAlignment)));
             }
             debug_remove(ptr, origSize, DEBUG_SOURCE_TREE);
             tree_free(ptr);
@@ -918,6 +1009,13 @@ namespace AZ
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#if defined(USE_THREAD_CACHE)
+            // Only the calling thread cache can be returned, the other threads own theirs
+            if (thread_cache* cache = thread_cache_get(false))
+            {
+                thread_cache_trim(*cache, false);
+            }
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -934,9 +1032,27 @@ namespace AZ
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
+#if defined(USE_THREAD_CACHE)
+            if (m_threadCacheHighWatermark)
+            {
+                return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_cached_bytes();
+            }
+#endif
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
         }
 
+        /// fills outStats with the stats of the per thread caches, returns the number of caches
+        size_t  GetThreadCacheStats(AZ::AllocatorThreadCacheStats* outStats, size_t maxStats) const
+        {
+#if defined(USE_THREAD_CACHE)
+            return thread_cache_get_stats(outStats, maxStats);
+#else
+            (void)outStats;
+            (void)maxStats;
+            return 0;
+#endif
+        }
+
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
         size_t  AllocationSize(void* ptr);
         size_t  GetMaxAllocationSize() const;
@@ -1012,6 +1128,9 @@ namespace AZ
         , m_poolPageSize(desc.m_fixedMemoryBlock != nullptr ? desc.m_poolPageSize : OS_VIRTUAL_PAGE_SIZE)
         , m_subAllocator(desc.m_subAllocator)
     {
+#if defined(USE_THREAD_CACHE)
+        m_threadCacheHighWatermark = desc.m_isPoolAllocations ? desc.m_threadCacheHighWatermark : 0;
+#endif
 #ifdef DEBUG_ALLOCATOR
         mTotalDebugRequestedSize[DEBUG_SOURCE_BUCKETS] = 0;
         mTotalDebugRequestedSize[DEBUG_SOURCE_TREE] = 0;
@@ -1047,6 +1166,16 @@ namespace AZ
 
     HpAllocator::~HpAllocator()
     {
+#if defined(USE_THREAD_CACHE)
+        {
+            // The allocator is no longer used by any thread, return the elements of all caches so the pages can be released
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+            while (mThreadCaches)
+            {
+                thread_cache_release(*mThreadCaches);
+            }
+        }
+#endif
 #ifdef DEBUG_ALLOCATOR
         // Check if there are not-freed allocations
         report();
@@ -1445,6 +1574,273 @@ namespace AZ
         }
     }
 
+    size_t HpAllocator::bucket_alloc_batch(unsigned bi, free_link*& head, size_t count)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        size_t allocatedCount = 0;
+        for (; allocatedCount < count; ++allocatedCount)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                size_t bsize = bucket_spacing_function_inverse(bi);
+                p = bucket_grow(bsize, mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            free_link* lnk = (free_link*)mBuckets[bi].alloc(p);
+            lnk->mNext = head;
+            head = lnk;
+        }
+        mTotalAllocatedSizeBuckets += allocatedCount * bucket_spacing_function_inverse(bi);
+        return allocatedCount;
+    }
+
+    void HpAllocator::bucket_free_batch(unsigned bi, free_link* head, size_t count)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        for (size_t i = 0; i < count; ++i)
+        {
+            HPPA_ASSERT(head);
+            free_link* next = head->mNext;
+            page* p = ptr_get_page(head);
+            HPPA_ASSERT(bi == p->bucket_index());
+            mBuckets[bi].free(p, head);
+            head = next;
+        }
+        mTotalAllocatedSizeBuckets -= count * bucket_spacing_function_inverse(bi);
+    }
+
+#if defined(USE_THREAD_CACHE)
+    // Set once the thread cache table of the thread is destroyed, frees done later during the thread exit go to the buckets
+    static thread_local bool s_threadCacheTableDestroyed = false;
+
+    HpAllocator::thread_cache_table::~thread_cache_table()
+    {
+        s_threadCacheTableDestroyed = true;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (thread_cache& cache : mCaches)
+        {
+            if (HpAllocator* owner = cache.mOwner.load(AZStd::memory_order_relaxed))
+            {
+                owner->thread_cache_release(cache);
+            }
+        }
+    }
+
+    HpAllocator::thread_cache_table& HpAllocator::thread_cache_get_table()
+    {
+        thread_local thread_cache_table s_table;
+        return s_table;
+    }
+
+    AZStd::mutex& HpAllocator::thread_cache_registry_mutex()
+    {
+        static AZStd::mutex s_mutex;
+        return s_mutex;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_get(bool create)
+    {
+        if (!m_threadCacheHighWatermark || s_threadCacheTableDestroyed)
+        {
+            return nullptr;
+        }
+        thread_cache_table& table = thread_cache_get_table();
+        for (thread_cache& cache : table.mCaches)
+        {
+            if (cache.mOwner.load(AZStd::memory_order_relaxed) == this)
+            {
+                return &cache;
+            }
+        }
+        return create ? thread_cache_register(table) : nullptr;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_register(thread_cache_table& table)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (thread_cache& cache : table.mCaches)
+        {
+            if (cache.mOwner.load(AZStd::memory_order_relaxed) == nullptr)
+            {
+                cache.mThreadId = AZStd::this_thread::get_id().m_id;
+                cache.mCachedBytes.store(0, AZStd::memory_order_relaxed);
+                cache.mHitCount.store(0, AZStd::memory_order_relaxed);
+                cache.mRefillCount.store(0, AZStd::memory_order_relaxed);
+                cache.mTrimCount.store(0, AZStd::memory_order_relaxed);
+                cache.mNext = mThreadCaches;
+                mThreadCaches = &cache;
+                cache.mOwner.store(this, AZStd::memory_order_relaxed);
+                return &cache;
+            }
+        }
+        // the thread uses too many allocators at once, this one goes to the buckets directly
+        return nullptr;
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache& cache)
+    {
+        HPPA_ASSERT(cache.mOwner.load(AZStd::memory_order_relaxed) == this);
+        thread_cache_trim(cache, false);
+        for (thread_cache** link = &mThreadCaches; *link; link = &(*link)->mNext)
+        {
+            if (*link == &cache)
+            {
+                *link = cache.mNext;
+                break;
+            }
+        }
+        cache.mNext = nullptr;
+        cache.mOwner.store(nullptr, AZStd::memory_order_relaxed);
+    }
+
+    void* HpAllocator::thread_cache_alloc(unsigned bi)
+    {
+        thread_cache* cache = thread_cache_get(true);
+        if (!cache)
+        {
+            return bucket_alloc_direct(bi);
+        }
+
+        thread_cache::bin& b = cache->mBins[bi];
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        free_link* lnk = b.mHead;
+        if (lnk)
+        {
+            b.mHead = lnk->mNext;
+            --b.mCount;
+            cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) - elemSize, AZStd::memory_order_relaxed);
+            cache->mHitCount.store(cache->mHitCount.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+            return lnk;
+        }
+
+        // the bin is empty, take a few elements from the bucket at once, one is returned and the rest kept in the bin
+        const size_t refillCount = AZStd::GetMin(AZStd::GetMax(THREAD_CACHE_REFILL_SIZE / elemSize, size_t(1)), THREAD_CACHE_MAX_REFILL_COUNT);
+        const size_t count = bucket_alloc_batch(bi, lnk, refillCount);
+        if (count == 0)
+        {
+            return nullptr;
+        }
+        b.mHead = lnk->mNext;
+        b.mCount = count - 1;
+        cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) + b.mCount * elemSize, AZStd::memory_order_relaxed);
+        cache->mRefillCount.store(cache->mRefillCount.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+        return lnk;
+    }
+
+    void HpAllocator::thread_cache_free(void* ptr, unsigned bi)
+    {
+        thread_cache* cache = thread_cache_get(true);
+        if (!cache)
+        {
+            return bucket_free_direct(ptr, bi);
+        }
+        // if this asserts, the free size doesn't match the allocated size
+        HPPA_ASSERT(bi == ptr_get_page(ptr)->bucket_index());
+
+        // elements freed by another thread than the one that allocated them simply move to this thread cache
+        thread_cache::bin& b = cache->mBins[bi];
+        free_link* lnk = (free_link*)ptr;
+        lnk->mNext = b.mHead;
+        b.mHead = lnk;
+        ++b.mCount;
+        const size_t cachedBytes = cache->mCachedBytes.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi);
+        cache->mCachedBytes.store(cachedBytes, AZStd::memory_order_relaxed);
+        if (cachedBytes > m_threadCacheHighWatermark)
+        {
+            thread_cache_trim(*cache, true);
+        }
+    }
+
+    void HpAllocator::thread_cache_trim_bin(thread_cache& cache, unsigned bi, size_t keepCount)
+    {
+        thread_cache::bin& b = cache.mBins[bi];
+        if (b.mCount <= keepCount)
+        {
+            return;
+        }
+
+        // the most recently freed elements are at the head of the bin, keep those and return the tail
+        free_link* trimmed = b.mHead;
+        if (keepCount > 0)
+        {
+            free_link* last = b.mHead;
+            for (size_t i = 1; i < keepCount; ++i)
+            {
+                last = last->mNext;
+            }
+            trimmed = last->mNext;
+            last->mNext = nullptr;
+        }
+        else
+        {
+            b.mHead = nullptr;
+        }
+        const size_t trimmedCount = b.mCount - keepCount;
+        b.mCount = keepCount;
+        bucket_free_batch(bi, trimmed, trimmedCount);
+        cache.mCachedBytes.store(
+            cache.mCachedBytes.load(AZStd::memory_order_relaxed) - trimmedCount * bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_trim(thread_cache& cache, bool keepHalf)
+    {
+        for (unsigned bi = 0; bi < THREAD_CACHE_NUM_BUCKETS; ++bi)
+        {
+            thread_cache_trim_bin(cache, bi, keepHalf ? cache.mBins[bi].mCount / 2 : 0);
+        }
+        cache.mTrimCount.store(cache.mTrimCount.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+    }
+
+    size_t HpAllocator::thread_cache_cached_bytes() const
+    {
+        size_t cachedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            cachedBytes += cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return cachedBytes;
+    }
+
+    size_t HpAllocator::thread_cache_get_stats(AZ::AllocatorThreadCacheStats* outStats, size_t maxStats) const
+    {
+        size_t numCaches = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext, ++numCaches)
+        {
+            if (numCaches < maxStats)
+            {
+                AZ::AllocatorThreadCacheStats& stats = outStats[numCaches];
+                stats.m_threadId = cache->mThreadId;
+                stats.m_cachedBytes = cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+                stats.m_hitCount = cache->mHitCount.load(AZStd::memory_order_relaxed);
+                stats.m_refillCount = cache->mRefillCount.load(AZStd::memory_order_relaxed);
+                stats.m_trimCount = cache->mTrimCount.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return numCaches;
+    }
+#endif // USE_THREAD_CACHE
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
@@ -2167,6 +2563,12 @@ namespace AZ
         return size(ptr);
     }
 
+    HphaSchema::size_type
+    HphaSchema::GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_type maxStats) const
+    {
+        return m_allocator->GetThreadCacheStats(outStats, maxStats);
+    }
+
     //=========================================================================
     // GetMaxAllocationSize
     // [2/22/2011]
@@ -8,12 +8,14 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/parallel/config.h>
 
 namespace AZ
 {
     namespace Debug
     {
         class AllocationRecords;
+        class AllocationSampler;
     }
 
     namespace AllocatorStorage
@@ -27,6 +29,18 @@ namespace AZ
 
     class AllocatorManager;
 
+    /**
+     * Stats of the cache an allocator keeps for one thread, see IAllocatorSchema::GetThreadCacheStats.
+     */
+    struct AllocatorThreadCacheStats
+    {
+        AZStd::native_thread_id_type m_threadId = AZStd::native_thread_invalid_id;
+        size_t m_cachedBytes = 0;   ///< Free memory held by the thread cache.
+        size_t m_hitCount = 0;      ///< Allocations served by the thread cache.
+        size_t m_refillCount = 0;   ///< Times the thread cache had to take memory from the shared pools.
+        size_t m_trimCount = 0;     ///< Times the thread cache returned memory to the shared pools.
+    };
+
     /**
      * Allocator schema interface
      */
@@ -69,6 +83,11 @@ namespace AZ
          * that will be reported.
          */
         virtual size_type               GetUnAllocatedMemory(bool isPrint = false) const { (void)isPrint; return 0; }
+        /**
+         * Fills outStats with up to maxStats entries, one per thread that keeps a cache of free memory in front of the allocator.
+         * Returns the number of thread caches, 0 if the allocator doesn't use thread caches.
+         */
+        virtual size_type               GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_type maxStats) const { (void)outStats; (void)maxStats; return 0; }
     };
 
     /**
@@ -140,6 +159,9 @@ namespace AZ
         /// Returns true if profiling calls will be made.
         virtual bool IsProfilingActive() const = 0;
 
+        /// Sets the sampler the allocations are reported to, nullptr stops reporting them.
+        virtual void SetAllocationSampler(Debug::AllocationSampler* sampler) = 0;
+
         /// All conforming allocators must call PostCreate() after their custom Create() method in order to be properly registered.
         virtual void PostCreate() = 0;
 
@@ -182,6 +182,11 @@ namespace AZ
             return m_schema->GetUnAllocatedMemory(isPrint);
         }
 
+        size_type GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_type maxStats) const override
+        {
+            return m_schema->GetThreadCacheStats(outStats, maxStats);
+        }
+
     private:
         typename AZStd::aligned_storage<sizeof(Schema), AZStd::alignment_of<Schema>::value>::type m_schemaStorage;
     };
@@ -110,6 +110,7 @@ namespace AZ
             heapDesc.m_isPoolAllocations = desc.m_heap.m_isPoolAllocations;
             // Fix SystemAllocator from growing in small chunks
             heapDesc.m_systemChunkSize = desc.m_heap.m_systemChunkSize;
+            heapDesc.m_threadCacheHighWatermark = desc.m_heap.m_threadCacheHighWatermark;
 #elif AZCORE_SYSTEM_ALLOCATOR == AZCORE_SYSTEM_ALLOCATOR_MALLOC
             MallocSchema::Descriptor heapDesc;
 #endif
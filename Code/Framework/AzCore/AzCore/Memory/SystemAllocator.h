@@ -60,11 +60,13 @@ namespace AZ
                     , m_numFixedMemoryBlocks(0)
                     , m_subAllocator(nullptr)
                     , m_systemChunkSize(0)
+                    , m_threadCacheHighWatermark(m_defaultThreadCacheHighWatermark)
                 {}
                 static const int        m_defaultPageSize = AZ_TRAIT_OS_DEFAULT_PAGE_SIZE;
                 static const int        m_defaultPoolPageSize = 4 * 1024;
                 static const int        m_memoryBlockAlignment = m_defaultPageSize;
                 static const int        m_maxNumFixedBlocks = 3;
+                static const size_t     m_defaultThreadCacheHighWatermark = 32 * 1024;
                 unsigned int            m_pageSize;                                 ///< Page allocation size must be 1024 bytes aligned. (default m_defaultPageSize)
                 unsigned int            m_poolPageSize;                             ///< Page size used to small memory allocations. Must be less or equal to m_pageSize and a multiple of it. (default m_defaultPoolPageSize)
                 bool                    m_isPoolAllocations;                        ///< True (default) if we use pool for small allocations (< 256 bytes), otherwise false. IMPORTANT: Changing this to false will degrade performance!
@@ -73,6 +75,7 @@ namespace AZ
                 size_t                  m_fixedMemoryBlocksByteSize[m_maxNumFixedBlocks]; ///< Sizes of different memory blocks (MUST be multiple of m_pageSize), if m_memoryBlock is 0 the block will be allocated for you with the System Allocator.
                 IAllocatorSchema*       m_subAllocator;                             ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
                 size_t                  m_systemChunkSize;                          ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
+                size_t                  m_threadCacheHighWatermark;                 ///< Free memory each thread can cache for allocations up to 256 bytes, avoiding the pool locks. 0 disables the thread caches. (default m_defaultThreadCacheHighWatermark)
             }                           m_heap;
             bool                        m_allocationRecords;    ///< True if we want to track memory allocations, otherwise false.
             unsigned char               m_stackRecordLevels;    ///< If stack recording is enabled, how many stack levels to record.
@@ -102,6 +105,7 @@ namespace AZ
         size_type       GetMaxAllocationSize() const override    { return GetSchema()->GetMaxAllocationSize(); }
         size_type       GetMaxContiguousAllocationSize() const override { return GetSchema()->GetMaxContiguousAllocationSize(); }
         size_type       GetUnAllocatedMemory(bool isPrint = false) const override    { return GetSchema()->GetUnAllocatedMemory(isPrint); }
+        size_type       GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_type maxStats) const override { return GetSchema()->GetThreadCacheStats(outStats, maxStats); }
 
         //////////////////////////////////////////////////////////////////////////
 
@@ -16,14 +16,30 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Debug/Profiler.h>
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace
 {
     static const char* s_moduleLoggingScope = "Module Manager";
+
+    //! Settings registry key to turn off reading the module files on worker threads before loading them
+    static constexpr const char* s_prefetchModuleFilesKey = "/O3DE/AzCore/ModuleManager/PrefetchModuleFiles";
+    //! The most worker threads reading module files
+    static constexpr AZ::u32 s_maxPrefetchThreads = 8;
+
+    static double ToMilliseconds(AZStd::chrono::microseconds duration)
+    {
+        return duration.count() / 1000.0;
+    }
 }
 
 namespace AZ
@@ -483,7 +499,10 @@ namespace AZ
                 continue;
             }
 
+            const auto phaseStart = AZStd::chrono::high_resolution_clock::now();
             PhaseOutcome phaseResult = phasePair.second();
+            m_stepDurations[static_cast<size_t>(phasePair.first)] +=
+                AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - phaseStart);
             if (!phaseResult.IsSuccess())
             {
                 // Remove all references to the module from the owned and unowned list
@@ -515,8 +534,24 @@ namespace AZ
     //=========================================================================
     ModuleManager::LoadModulesResult ModuleManager::LoadDynamicModules(const ModuleDescriptorList& modules, ModuleInitializationSteps lastStepToPerform, bool maintainReferences)
     {
+        AZ_PROFILE_FUNCTION(AzCore);
+
         LoadModulesResult results;
 
+        const auto loadStart = AZStd::chrono::high_resolution_clock::now();
+        AZStd::chrono::microseconds prefetchDuration{ 0 };
+        bool prefetchModuleFiles = true;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(prefetchModuleFiles, s_prefetchModuleFilesKey);
+        }
+        if (prefetchModuleFiles && lastStepToPerform >= ModuleInitializationSteps::Load && modules.size() > 1)
+        {
+            PrefetchModuleFiles(modules);
+            prefetchDuration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - loadStart);
+        }
+        m_stepDurations = {};
+
         Internal::ModuleManagerSearchPathTool moduleSearchPathHelper;
 
         // Load DLLs specified in the application descriptor
@@ -529,9 +564,67 @@ namespace AZ
             results.emplace_back(AZStd::move(result));
         }
 
+        AZ_TracePrintf(s_moduleLoggingScope, "Loaded %zu dynamic modules in %.1f ms (prefetch %.1f ms, load %.1f ms, create %.1f ms, "
+            "register descriptors %.1f ms)\n",
+            modules.size(),
+            ToMilliseconds(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - loadStart)),
+            ToMilliseconds(prefetchDuration),
+            ToMilliseconds(m_stepDurations[static_cast<size_t>(ModuleInitializationSteps::Load)]),
+            ToMilliseconds(m_stepDurations[static_cast<size_t>(ModuleInitializationSteps::CreateClass)]),
+            ToMilliseconds(m_stepDurations[static_cast<size_t>(ModuleInitializationSteps::RegisterComponentDescriptors)]));
+
         return results;
     }
 
+    //=========================================================================
+    // PrefetchModuleFiles
+    //=========================================================================
+    void ModuleManager::PrefetchModuleFiles(const ModuleDescriptorList& modules)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // The job system isn't available while the modules load, so plain threads are used
+        const AZ::u32 threadCount =
+            AZStd::min(AZStd::min(AZStd::thread::hardware_concurrency(), s_maxPrefetchThreads), aznumeric_cast<AZ::u32>(modules.size()));
+        if (threadCount < 2)
+        {
+            return;
+        }
+
+        AZStd::atomic<size_t> nextModule{ 0 };
+        auto prefetch = [&modules, &nextModule]()
+        {
+            constexpr size_t bufferSize = 1024 * 1024;
+            AZStd::unique_ptr<char[]> buffer(new char[bufferSize]);
+            for (size_t index = nextModule++; index < modules.size(); index = nextModule++)
+            {
+                // The handle resolves the path of the library like the load does, without loading it
+                AZStd::unique_ptr<DynamicModuleHandle> handle =
+                    DynamicModuleHandle::Create(PreProcessModule(modules[index].m_dynamicLibraryPath).c_str());
+                AZ::IO::SystemFile file;
+                if (handle && file.Open(handle->GetFilename().c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    while (file.Read(bufferSize, buffer.get()) == bufferSize)
+                    {
+                    }
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> threads;
+        threads.reserve(threadCount);
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Module Prefetch";
+        for (AZ::u32 i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(threadDesc, prefetch);
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
     //=========================================================================
     // LoadStaticModules
     //=========================================================================
@@ -752,16 +845,44 @@ namespace AZ
 
         AZStd::string componentNamesArray = R"({ "SystemComponents":[)";
         const char* comma = "";
+        // Time each activation to report the slowest components of the startup
+        AZStd::vector<AZStd::pair<AZStd::chrono::microseconds, Component*>> activationDurations;
+        activationDurations.reserve(componentsToActivate.size());
+        const auto activationStart = AZStd::chrono::high_resolution_clock::now();
         // Activate the entities in the appropriate order
         for (Component* component : componentsToActivate)
         {
+            const auto componentStart = AZStd::chrono::high_resolution_clock::now();
             ModuleEntity::ActivateComponent(*component);
+            activationDurations.emplace_back(
+                AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - componentStart), component);
 
             componentNamesArray += AZStd::string::format(R"(%s"%s")", comma, component->RTTI_GetTypeName());
             comma = ", ";
         }
         componentNamesArray += R"(]})";
 
+        if (!activationDurations.empty())
+        {
+            constexpr size_t reportedComponentCount = 5;
+            const size_t slowestCount = AZStd::min(reportedComponentCount, activationDurations.size());
+            AZStd::sort(activationDurations.begin(), activationDurations.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first > rhs.first;
+                });
+            AZStd::string slowestComponents;
+            for (size_t i = 0; i < slowestCount; ++i)
+            {
+                slowestComponents += AZStd::string::format("%s%s %.1f ms", i > 0 ? ", " : "",
+                    activationDurations[i].second->RTTI_GetTypeName(), ToMilliseconds(activationDurations[i].first));
+            }
+            AZ_TracePrintf(s_moduleLoggingScope, "Activated %zu system components in %.1f ms, the slowest: %s\n",
+                activationDurations.size(),
+                ToMilliseconds(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - activationStart)),
+                slowestComponents.c_str());
+        }
+
         // Done activating; set state to active
         for (auto& moduleData : modulesToInit)
         {
@@ -12,6 +12,8 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Module/ModuleManagerBus.h>
 
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
@@ -163,6 +165,10 @@ namespace AZ
         // Helper function to preprocess the module names to handle any special processing
         static AZ::OSString PreProcessModule(AZStd::string_view moduleName);
 
+        //! Reads the files of the modules on worker threads, so that the loads, which must run one after another,
+        //! map the libraries from the file cache instead of waiting on the disk.
+        static void PrefetchModuleFiles(const ModuleDescriptorList& modules);
+
         // Tags to look for when activating system components
         AZStd::vector<Crc32> m_systemComponentTags;
 
@@ -175,5 +181,8 @@ namespace AZ
         using ModuleNameNameToModuleDataMap = AZStd::unordered_map<AZ::OSString, AZStd::weak_ptr<ModuleDataImpl>>;
         //! Map from modules names to loaded ModuleData
         ModuleNameNameToModuleDataMap m_nameToModuleMap;
+
+        //! Time spent in each initialization step by the modules loaded since the last startup report
+        AZStd::array<AZStd::chrono::microseconds, static_cast<size_t>(ModuleInitializationSteps::ActivateEntity) + 1> m_stepDurations{};
     };
 } // namespace AZ
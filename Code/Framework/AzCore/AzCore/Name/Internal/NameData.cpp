@@ -32,6 +32,19 @@ namespace AZ::Internal
         ++m_useCount;
     }
 
+    bool NameData::TryAddRef()
+    {
+        int32_t useCount = m_useCount.load(AZStd::memory_order_relaxed);
+        while (useCount >= 0)
+        {
+            if (m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acquire, AZStd::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void NameData::release()
     {
         // this could be released after we decrement the counter, therefore we will
@@ -34,12 +34,24 @@ namespace AZ
             //! Returns the hash part of the name data.
             Hash GetHash() const;
 
+            //! Calculates the hash of a name string, before the dictionary resolves hash collisions.
+            //! AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            //! of network synchronization. So just take the low 32 bits.
+            static constexpr Hash CalcHash(AZStd::string_view name)
+            {
+                return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+            }
+
         private:
             NameData(AZStd::string&& name, Hash hash);
 
             void add_ref();
             void release();
 
+            //! Adds a reference unless the dictionary is releasing or has released this entry.
+            //! Used by the lock-free dictionary lookups, which can find entries that are being removed.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
@@ -49,6 +61,8 @@ namespace AZ
 
             // TODO: We should be able to change this to a normal bool after introducing name dictionary garbage collection
             AZStd::atomic<bool> m_hashCollision = false; // Tracks whether the hash has been involved in a collision
+
+            int m_literalCount = 0; // References held by AZ_NAME_LITERAL call sites until the dictionary is destroyed
         };
     }
 }
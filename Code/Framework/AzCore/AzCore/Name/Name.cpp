@@ -139,6 +139,16 @@ namespace AZ
         return m_view.empty();
     }
 
+    const Name& Internal::NameLiteral::Get()
+    {
+        NameDictionary& dictionary = NameDictionary::Instance();
+        if (m_generation.load(AZStd::memory_order_acquire) != dictionary.GetGeneration())
+        {
+            dictionary.ResolveLiteral(*this);
+        }
+        return *reinterpret_cast<const Name*>(m_storage);
+    }
+
     void Name::ScriptConstructor(Name* thisPtr, ScriptDataContext& dc)
     {
         int numArgs = dc.GetNumArguments();
@@ -30,7 +30,7 @@ namespace AZ
     //! Equality-comparison of two Name objects is very fast.
     //!
     //! The dictionary must be initialized before Name objects are created.
-    //! A Name instance must not be statically declared.
+    //! A Name instance must not be statically declared, use AZ_NAME_LITERAL for names known at compile time.
     class Name
     {
         friend NameDictionary;
@@ -122,8 +122,40 @@ namespace AZ
         AZStd::intrusive_ptr<Internal::NameData> m_data;
     };
 
+    namespace Internal
+    {
+        //! Storage of an AZ_NAME_LITERAL call site. The hash of the string is calculated at compile time and the
+        //! name is resolved against the dictionary the first time the call site runs, then returned without
+        //! hashing or locking. It is resolved again if the dictionary is recreated.
+        //! Trivially destructible so it can be statically declared, the dictionary releases the name when it is destroyed.
+        class NameLiteral final
+        {
+            friend NameDictionary;
+        public:
+            constexpr explicit NameLiteral(AZStd::string_view name)
+                : m_name(name)
+                , m_hash(NameData::CalcHash(name))
+            {}
+
+            const Name& Get();
+
+        private:
+            AZStd::string_view m_name;
+            Name::Hash m_hash;
+            //! Generation of the dictionary the name was resolved against, 0 when unresolved.
+            AZStd::atomic<uint32_t> m_generation{ 0 };
+            alignas(Name) unsigned char m_storage[sizeof(Name)]{};
+        };
+    } // namespace Internal
+
 } // namespace AZ
 
+//! Returns a const AZ::Name& for a string literal, resolved against the dictionary once per call site.
+//! Use it for names created in hot code, instead of constructing a Name from a string every time.
+//! Example: if (materialProperty.GetName() == AZ_NAME_LITERAL("baseColor.factor")) { ... }
+#define AZ_NAME_LITERAL(str) \
+    ([]() -> const ::AZ::Name& { static ::AZ::Internal::NameLiteral nameLiteral{ AZStd::string_view(str) }; return nameLiteral.Get(); }())
+
 namespace AZStd
 {
     template <typename T>
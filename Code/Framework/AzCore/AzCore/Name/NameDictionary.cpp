@@ -80,29 +80,56 @@ namespace AZ
         return *s_instance;
     }
     
+    namespace NameDictionaryInternal
+    {
+        // Marks the slot of a released entry, lookups continue probing past it
+        static Internal::NameData* const s_tombstone = reinterpret_cast<Internal::NameData*>(uintptr_t(1));
+
+        // Incremented by every dictionary, so name literals resolved against a destroyed dictionary are resolved again
+        static AZStd::atomic<uint32_t> s_generationCounter{ 0 };
+    }
+
     NameDictionary::NameDictionary()
+        : m_generation(++NameDictionaryInternal::s_generationCounter)
     {}
 
     NameDictionary::~NameDictionary()
     {
         [[maybe_unused]] bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (Internal::NameData* nameData : GetEntries())
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
+            // References held by name literals are released with the dictionary
+            const int useCount = nameData->m_useCount - nameData->m_literalCount;
+            [[maybe_unused]] const bool hadCollision = nameData->m_hashCollision;
 
             if (useCount == 0)
             {
                 // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                AZ_Assert(hadCollision || nameData->m_literalCount > 0, "Only colliding names are allowed to remain in the dictionary");
                 delete nameData;
             }
             else
             {
                 leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
+            }
+        }
+
+        for (Shard& shard : m_shards)
+        {
+            for (Internal::NameData* nameData : shard.m_freeNameData)
+            {
+                delete nameData;
+            }
+
+            shard.m_retiredTables.push_back(shard.m_table.load(AZStd::memory_order_relaxed));
+            for (Table* table : shard.m_retiredTables)
+            {
+                if (table)
+                {
+                    AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(table);
+                }
             }
         }
 
@@ -111,11 +138,18 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        Name name = TryFindName(hash);
+        if (!name.IsEmpty())
+        {
+            return name;
+        }
+
+        // The lock-free lookup can miss entries while the shard is rehashed or the entry is replaced, so confirm under the lock
+        Shard& shard = m_shards[GetShardIndex(hash)];
+        AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+        if (Slot* slot = FindSlotLocked(shard, hash))
         {
-            return Name(iter->second);
+            return Name(slot->m_nameData.load(AZStd::memory_order_relaxed));
         }
         return Name();
     }
@@ -128,45 +162,45 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        // If we find the same name with the same hash, just return it.
+        // This path is faster than the loop below because TryFindName() doesn't lock whereas the
+        // loop locks the shards to modify the dictionary.
+        Name name = TryFindName(hash);
         if (name.GetStringView() == nameString)
         {
-            return AZStd::move(name);
+            return name;
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
+            Shard& shard = m_shards[GetShardIndex(hash)];
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+
+            Slot* slot = FindSlotLocked(shard, hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (!slot)
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
-                nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
-                return Name(nameData);
+                return Name(InsertLocked(shard, nameString, hash, collisionDetected));
             }
+
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
-            {
-                return Name(iter->second);
-            }
-            // Hash collision, try a new hash
-            else
+            Internal::NameData* nameData = slot->m_nameData.load(AZStd::memory_order_relaxed);
+            if (nameData->GetName() == nameString)
             {
-                collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
-                ++hash;
-                iter = m_dictionary.find(hash);
+                return Name(nameData);
             }
+
+            // Hash collision, try a new hash. The next hash can be in another shard, which is locked in the next iteration.
+            collisionDetected = true;
+            nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+            ++hash;
         }
     }
 
@@ -183,11 +217,11 @@ namespace AZ
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
+        Shard& shard = m_shards[GetShardIndex(hash)];
+        AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        Slot* slot = FindSlotLocked(shard, hash);
+        if (!slot)
         {
             // This check is to safeguard around the following scenario
             // T1, gets into TryReleaseName
@@ -198,9 +232,9 @@ namespace AZ
             return;
         }
 
-        Internal::NameData* nameData = dictIt->second;
+        Internal::NameData* nameData = slot->m_nameData.load(AZStd::memory_order_relaxed);
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
+        // Check m_hashCollision inside the shard lock because a new collision could have happened
         // on another thread before taking the lock.
         if (nameData->m_hashCollision)
         {
@@ -210,17 +244,260 @@ namespace AZ
         // We need to check the count again in here in case
         // someone was trying to get the name on another thread.
         // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
+        // dictionary and recycle the name. Lock-free lookups that still see the
+        // entry fail to add a reference from then on.
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            slot->m_nameData.store(NameDictionaryInternal::s_tombstone, AZStd::memory_order_release);
+            --shard.m_entryCount;
+            nameData->m_name = AZStd::string();
+            shard.m_freeNameData.push_back(nameData);
         }
 
         ReportStats();
     }
 
+    void NameDictionary::ResolveLiteral(Internal::NameLiteral& literal)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_literalMutex);
+
+        // Another thread may have resolved it while this one was waiting
+        if (literal.m_generation.load(AZStd::memory_order_relaxed) == m_generation)
+        {
+            return;
+        }
+
+        Name name = literal.m_name.empty() ? Name() : MakeName(literal.m_name, literal.m_hash);
+        if (name.m_data)
+        {
+            ++name.m_data->m_literalCount;
+        }
+
+        // A name resolved against a previous dictionary references memory that dictionary freed, it is overwritten without being destroyed
+        new (literal.m_storage) Name(AZStd::move(name));
+        literal.m_generation.store(m_generation, AZStd::memory_order_release);
+    }
+
+    Name NameDictionary::TryFindName(Name::Hash hash) const
+    {
+        const Shard& shard = m_shards[GetShardIndex(hash)];
+        const Table* table = shard.m_table.load(AZStd::memory_order_acquire);
+        if (!table)
+        {
+            return Name();
+        }
+
+        const uint32_t mask = table->m_capacity - 1;
+        for (uint32_t index = hash & mask, probeCount = 0; probeCount < table->m_capacity; index = (index + 1) & mask, ++probeCount)
+        {
+            const Slot& slot = table->m_slots[index];
+            Internal::NameData* nameData = slot.m_nameData.load(AZStd::memory_order_acquire);
+            if (!nameData)
+            {
+                break;
+            }
+
+            if (nameData != NameDictionaryInternal::s_tombstone && slot.m_hash.load(AZStd::memory_order_relaxed) == hash)
+            {
+                // The entry can be released and recycled for another name at any time, so take a reference before reading it.
+                // NameData are never freed while the dictionary exists.
+                if (nameData->TryAddRef())
+                {
+                    Name name;
+                    if (nameData->m_hash == hash)
+                    {
+                        name = Name(nameData);
+                    }
+                    nameData->release();
+                    return name;
+                }
+                break;
+            }
+        }
+        return Name();
+    }
+
+    NameDictionary::Slot* NameDictionary::FindSlotLocked(Shard& shard, Name::Hash hash) const
+    {
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        if (!table)
+        {
+            return nullptr;
+        }
+
+        const uint32_t mask = table->m_capacity - 1;
+        for (uint32_t index = hash & mask, probeCount = 0; probeCount < table->m_capacity; index = (index + 1) & mask, ++probeCount)
+        {
+            Slot& slot = table->m_slots[index];
+            Internal::NameData* nameData = slot.m_nameData.load(AZStd::memory_order_relaxed);
+            if (!nameData)
+            {
+                break;
+            }
+
+            if (nameData != NameDictionaryInternal::s_tombstone && slot.m_hash.load(AZStd::memory_order_relaxed) == hash)
+            {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    Internal::NameData* NameDictionary::InsertLocked(Shard& shard, AZStd::string_view name, Name::Hash hash, bool hadCollision)
+    {
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        if (!table || (shard.m_usedSlotCount + 1) * 4 > table->m_capacity * 3)
+        {
+            // Grow when the entries fill half of the table, otherwise the rehash only drops the tombstones
+            uint32_t capacity = table ? table->m_capacity : MinShardCapacity;
+            while ((shard.m_entryCount + 1) * 2 > capacity)
+            {
+                capacity *= 2;
+            }
+            RehashLocked(shard, capacity);
+            table = shard.m_table.load(AZStd::memory_order_relaxed);
+        }
+
+        // The caller checked the hash is not in the table, reuse the first tombstone of the probe sequence
+        const uint32_t mask = table->m_capacity - 1;
+        uint32_t index = hash & mask;
+        Slot* target = nullptr;
+        while (true)
+        {
+            Internal::NameData* slotNameData = table->m_slots[index].m_nameData.load(AZStd::memory_order_relaxed);
+            if (slotNameData == NameDictionaryInternal::s_tombstone)
+            {
+                target = &table->m_slots[index];
+                break;
+            }
+            if (!slotNameData)
+            {
+                target = &table->m_slots[index];
+                ++shard.m_usedSlotCount;
+                break;
+            }
+            index = (index + 1) & mask;
+        }
+
+        Internal::NameData* nameData;
+        if (!shard.m_freeNameData.empty())
+        {
+            nameData = shard.m_freeNameData.back();
+            shard.m_freeNameData.pop_back();
+            nameData->m_name = name;
+            nameData->m_hash = hash;
+            nameData->m_literalCount = 0;
+            nameData->m_hashCollision = hadCollision;
+            // Publishes the new name and hash to the lookups that still reference the recycled entry
+            nameData->m_useCount.store(0, AZStd::memory_order_release);
+        }
+        else
+        {
+            nameData = aznew Internal::NameData(name, hash);
+            nameData->m_hashCollision = hadCollision;
+        }
+
+        target->m_hash.store(hash, AZStd::memory_order_relaxed);
+        target->m_nameData.store(nameData, AZStd::memory_order_release);
+        ++shard.m_entryCount;
+        return nameData;
+    }
+
+    void NameDictionary::RehashLocked(Shard& shard, uint32_t capacity)
+    {
+        Table* oldTable = shard.m_table.load(AZStd::memory_order_relaxed);
+
+        AZStd::vector<AZStd::pair<Name::Hash, Internal::NameData*>, OSStdAllocator> entries;
+        entries.reserve(shard.m_entryCount);
+        if (oldTable)
+        {
+            for (uint32_t index = 0; index < oldTable->m_capacity; ++index)
+            {
+                Internal::NameData* nameData = oldTable->m_slots[index].m_nameData.load(AZStd::memory_order_relaxed);
+                if (nameData && nameData != NameDictionaryInternal::s_tombstone)
+                {
+                    entries.emplace_back(oldTable->m_slots[index].m_hash.load(AZStd::memory_order_relaxed), nameData);
+                }
+            }
+        }
+
+        Table* table = oldTable;
+        if (oldTable && oldTable->m_capacity == capacity)
+        {
+            // Rebuilt in place, lookups that run meanwhile miss and fall back to the locked lookup
+            for (uint32_t index = 0; index < capacity; ++index)
+            {
+                table->m_slots[index].m_nameData.store(nullptr, AZStd::memory_order_release);
+            }
+        }
+        else
+        {
+            void* memory = AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(
+                sizeof(Table) + sizeof(Slot) * capacity, alignof(Slot), 0, "NameDictionary", __FILE__, __LINE__);
+            table = new (memory) Table;
+            table->m_capacity = capacity;
+            table->m_slots = reinterpret_cast<Slot*>(table + 1);
+            for (uint32_t index = 0; index < capacity; ++index)
+            {
+                new (&table->m_slots[index]) Slot;
+            }
+        }
+
+        const uint32_t mask = capacity - 1;
+        for (const auto& [hash, nameData] : entries)
+        {
+            uint32_t index = hash & mask;
+            while (table->m_slots[index].m_nameData.load(AZStd::memory_order_relaxed))
+            {
+                index = (index + 1) & mask;
+            }
+            table->m_slots[index].m_hash.store(hash, AZStd::memory_order_relaxed);
+            table->m_slots[index].m_nameData.store(nameData, AZStd::memory_order_release);
+        }
+        shard.m_usedSlotCount = aznumeric_cast<uint32_t>(entries.size());
+
+        if (table != oldTable)
+        {
+            shard.m_table.store(table, AZStd::memory_order_release);
+            if (oldTable)
+            {
+                shard.m_retiredTables.push_back(oldTable);
+            }
+        }
+    }
+
+    AZStd::vector<Internal::NameData*, OSStdAllocator> NameDictionary::GetEntries() const
+    {
+        AZStd::vector<Internal::NameData*, OSStdAllocator> entries;
+        entries.reserve(GetEntryCount());
+        for (const Shard& shard : m_shards)
+        {
+            if (const Table* table = shard.m_table.load(AZStd::memory_order_acquire))
+            {
+                for (uint32_t index = 0; index < table->m_capacity; ++index)
+                {
+                    Internal::NameData* nameData = table->m_slots[index].m_nameData.load(AZStd::memory_order_acquire);
+                    if (nameData && nameData != NameDictionaryInternal::s_tombstone)
+                    {
+                        entries.push_back(nameData);
+                    }
+                }
+            }
+        }
+        return entries;
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t entryCount = 0;
+        for (const Shard& shard : m_shards)
+        {
+            entryCount += shard.m_entryCount;
+        }
+        return entryCount;
+    }
+
     void NameDictionary::ReportStats() const
     {
 #ifdef AZ_DEBUG_BUILD
@@ -236,34 +513,35 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            const auto entries = GetEntries();
+            for (Internal::NameData* nameData : entries)
             {
-                const size_t nameLength = iter.second->m_name.size();
+                const size_t nameLength = nameData->m_name.size();
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", entries.size());
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -285,12 +563,4 @@ namespace AZ
 
 #endif // AZ_DEBUG_BUILD
     }
-
-    Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
-    {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
-    }
 }
@@ -8,10 +8,11 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -28,6 +29,7 @@ namespace AZ
     namespace Internal
     {
         class NameData;
+        class NameLiteral;
     };
 
     //! Maintains a list of unique strings for Name objects.
@@ -38,6 +40,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! Entries are split in shards by hash, each shard is an open addressing table. Looking up an existing
+    //! name doesn't lock, lookups that miss and insertions lock the shard of the hash. Released NameData are
+    //! recycled rather than freed while the dictionary exists, so a lookup racing with a release never reads
+    //! freed memory.
     class NameDictionary final
     {
     public:
@@ -47,6 +54,7 @@ namespace AZ
         friend Module;
         friend Name;
         friend Internal::NameData;
+        friend Internal::NameLiteral;
         friend UnitTest::NameDictionaryTester;
         template<typename T, typename... Args> friend constexpr auto AZStd::construct_at(T*, Args&&... args)
             -> AZStd::enable_if_t<AZStd::is_void_v<AZStd::void_t<decltype(new (AZStd::declval<void*>()) T(AZStd::forward<Args>(args)...))>>, T*>;
@@ -85,13 +93,70 @@ namespace AZ
         // a reference wasn't taken by another thread.
         void TryReleaseName(Name::Hash hash);
 
+        //////////////////////////////////////////////////////////////////////////
+        // Private API for NameLiteral
+
+        // Resolves the literal against this dictionary. The reference held by the literal is
+        // dropped when the dictionary is destroyed.
+        void ResolveLiteral(Internal::NameLiteral& literal);
+
+        uint32_t GetGeneration() const { return m_generation; }
+
         //////////////////////////////////////////////////////////////////////////
 
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
-        Name::Hash CalcHash(AZStd::string_view name);
-
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        static constexpr Name::Hash CalcHash(AZStd::string_view name)
+        {
+            return Internal::NameData::CalcHash(name);
+        }
+
+        // MakeName with the hash of the string already calculated.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
+        static constexpr uint32_t ShardCount = 16;
+        static constexpr uint32_t MinShardCapacity = 64;
+
+        struct Slot
+        {
+            AZStd::atomic<Name::Hash> m_hash{ 0 };
+            AZStd::atomic<Internal::NameData*> m_nameData{ nullptr };
+        };
+
+        struct Table
+        {
+            uint32_t m_capacity = 0; // Power of two
+            Slot* m_slots = nullptr;
+        };
+
+        struct Shard
+        {
+            // Replaced when the table grows. Lookups can still be reading the old tables so they are
+            // kept until the dictionary is destroyed; they add up to less than the current table.
+            AZStd::atomic<Table*> m_table{ nullptr };
+            AZStd::vector<Table*, OSStdAllocator> m_retiredTables;
+            AZStd::vector<Internal::NameData*, OSStdAllocator> m_freeNameData;
+            uint32_t m_entryCount = 0;
+            uint32_t m_usedSlotCount = 0; // Entries and tombstones
+            AZStd::mutex m_mutex;
+        };
+
+        static uint32_t GetShardIndex(Name::Hash hash) { return hash >> 28; }
+
+        // Lock-free lookup, returns an empty Name if the hash is not found or if the entry is being released.
+        Name TryFindName(Name::Hash hash) const;
+        // Lookup in a shard whose mutex is held; returns the slot of the hash or nullptr.
+        Slot* FindSlotLocked(Shard& shard, Name::Hash hash) const;
+        // Inserts a new entry in a shard whose mutex is held.
+        Internal::NameData* InsertLocked(Shard& shard, AZStd::string_view name, Name::Hash hash, bool hadCollision);
+        void RehashLocked(Shard& shard, uint32_t capacity);
+
+        // Lists the entries of all shards, the shards must not be modified until the call returns.
+        AZStd::vector<Internal::NameData*, OSStdAllocator> GetEntries() const;
+        size_t GetEntryCount() const;
+
+        mutable Shard m_shards[ShardCount];
+        uint32_t m_generation = 0;
+        AZStd::mutex m_literalMutex;
     };
 }
@@ -12,6 +12,7 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -3472,20 +3473,21 @@ LUA_API const Node* lua_getDummyNode()
 
                 // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
                 // this limit of 40 is however implicit, for now.
-                BehaviorValueParameter arguments[40];
+                // only the passed arguments get constructed, as each one carries its own temp buffer and result callback
+                AZStd::fixed_vector<BehaviorValueParameter, 40> arguments;
                 BehaviorValueParameter result;
                 ScriptContext::StackVariableAllocator tempData;
                 AZStd::allocator backupAllocator;
                 bool usedBackupAlloc  = false;
 
                 int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
-                AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
+                AZ_Assert(static_cast<int>(arguments.capacity()) >= numArguments, "Increase the argument array size!");
 
                 // for each argument read a variable from the stack to a BehaviorValueParameter
                 for (int i = 0; i < numArguments; ++i)
                 {
                     const AZ::BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
-                    arguments[i].Set(*parameter); // store the type of result we expect (pointer, const, etc.)
+                    arguments.emplace_back().Set(*parameter); // store the type of result we expect (pointer, const, etc.)
                     if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
                     {
                         ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call method: cannot convert parameter %d from %s to %s",
@@ -3503,6 +3505,15 @@ LUA_API const Node* lua_getDummyNode()
                 }
                 int numResults = 0;
 
+                auto pushResult = [&]()
+                {
+                    if (result.m_value)
+                    {
+                        thisPtr->m_resultToLua(lua, result);
+                        ++numResults;
+                    }
+                };
+
                 if (thisPtr->m_resultToLua)
                 {
                     result.Set(*thisPtr->m_method->GetResult()); 
@@ -3513,17 +3524,14 @@ LUA_API const Node* lua_getDummyNode()
                     }
 
                     // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    // only the callback is captured, so that it fits into the small object buffer of AZStd::function and the call doesn't allocate
+                    result.m_onAssignedResult = AZStd::function<void()>([&pushResult]()
                     {
-                        if (result.m_value)
-                        {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
-                        }
+                        pushResult();
                     });
                 }
 
-                bool isCalled = thisPtr->m_method->Call(arguments, numArguments, thisPtr->m_resultToLua ? &result : nullptr);
+                bool isCalled = thisPtr->m_method->Call(arguments.data(), numArguments, thisPtr->m_resultToLua ? &result : nullptr);
 
                 if (!isCalled)
                 {
@@ -5881,6 +5889,20 @@ LUA_API const Node* lua_getDummyNode()
         lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::GarbageCollectStepForDuration(int numberOfSteps, AZStd::chrono::microseconds budget)
+    {
+        const auto start = AZStd::chrono::system_clock::now();
+        // a step returns 1 when it completes a collection cycle, which leaves nothing more to collect for now
+        while (lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps) == 0)
+        {
+            if (AZStd::chrono::system_clock::now() - start >= budget)
+            {
+                break;
+            }
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     size_t ScriptContext::GetMemoryUsage() const
     {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/function/function_fwd.h>
 #include <AzCore/std/typetraits/remove_pointer.h>
 #include <AzCore/std/typetraits/remove_reference.h>
@@ -867,6 +868,14 @@ namespace AZ
          */ 
         void GarbageCollectStep(int numberOfSteps = 2);
 
+        /**
+         * Step the garbage collector until the time budget is spent or a collection cycle completes, at least one step is always performed.
+         * This bounds the time spent on garbage collection per call, while collecting as much as the budget allows.
+         * \param numberOfSteps    the size of each step, as for GarbageCollectStep.
+         * \param budget           the time to spend on garbage collection.
+         */
+        void GarbageCollectStepForDuration(int numberOfSteps, AZStd::chrono::microseconds budget);
+
         lua_State* NativeContext();
 
         //////////////////////////////////////////////////////////////////////////
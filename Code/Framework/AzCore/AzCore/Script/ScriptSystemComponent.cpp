@@ -14,6 +14,8 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Debug/ProfilerReflection.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
@@ -45,6 +47,10 @@ namespace AZ
  *      If the script was loaded by a ScriptComponent, Load will be called once reload is complete.
  */
 
+AZ_CVAR(uint32_t, script_garbageCollectorBudgetMicroseconds, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "The time in microseconds each script context may spend on garbage collection per system tick, it steps the collector until the budget is spent. "
+    "0 performs the configured number of garbage collector steps per tick instead.");
+
 namespace LocalTU_ScriptSystemComponent {
     // Called when a module has already been loaded
     static int LuaRequireLoadedModule(lua_State* l)
@@ -308,7 +314,21 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ScriptSystemComponent::GarbageCollectStep");
+            const uint32_t budget = script_garbageCollectorBudgetMicroseconds;
+            if (budget > 0)
+            {
+                contextContainer.m_context->GarbageCollectStepForDuration(contextContainer.m_garbageCollectorSteps, AZStd::chrono::microseconds(budget));
+            }
+            else
+            {
+                contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+            }
+        }
+
+        AZ_PROFILE_DATAPOINT(AzCore, aznumeric_cast<double>(contextContainer.m_context->GetMemoryUsage()) / 1024.0,
+            "Script/Context %zu/Heap (KB)", i);
     }
 }
 
@@ -13,6 +13,8 @@
 #include <AzCore/std/functional.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 
 namespace AZ
 {
@@ -215,6 +217,121 @@ namespace AZ
 
                 return clonedObject;
             }
+
+            /**
+            * Clones a batch of objects and generates new ids of IdType for all clones. Cloning and remapping run in parallel on the job system
+            * if a job context is available. Each clone first collects its newly generated ids in a map of its own. These maps are merged into
+            * newIdMap after which the id references of all clones are fixed up, so references between objects in the batch are remapped as well.
+            * The objects in a batch are expected to have unique ids.
+            * \param objects - the objects to clone
+            * \param count - the number of objects
+            * \param clones - output array with room for count pointers that receives the clones in the same order as objects
+            * \param newIdMap - An input/output map container for storing mappings of old IdType values to new IdType values.
+            * \param context - The serialize context for enumerating the @classPtr elements
+            * \param jobContext - The job context to run on. If null the global job context is used if there is one.
+            */
+            template<class T, class MapType>
+            static void CloneObjectsAndGenerateNewIdsAndFixRefs(const T* const* objects, size_t count, T** clones, MapType& newIdMap,
+                AZ::SerializeContext* context = nullptr, AZ::JobContext* jobContext = nullptr)
+            {
+                if (!context)
+                {
+                    AZ::ComponentApplicationBus::BroadcastResult(context, &AZ::ComponentApplicationRequests::GetSerializeContext);
+                    if (!context)
+                    {
+                        AZ_Error("Serialization", false, "No serialize context provided! Failed to get component application default serialize context! ComponentApp is not started or input serialize context should not be null!");
+                        return;
+                    }
+                }
+
+                if (!jobContext)
+                {
+                    AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+                }
+
+                auto forEachClone = [count, jobContext](const auto& function)
+                {
+                    if (jobContext && count > 1)
+                    {
+                        AZ::parallel_for(size_t{ 0 }, count, function, jobContext);
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            function(i);
+                        }
+                    }
+                };
+
+                context->CloneObjects(objects, count, clones, jobContext);
+
+                // newIdMap is only read while the new ids are generated, so the clones can be processed independently.
+                AZStd::vector<MapType> generatedIdMaps(count);
+                forEachClone([&](size_t index)
+                {
+                    if (!clones[index])
+                    {
+                        return;
+                    }
+
+                    MapType& generatedIdMap = generatedIdMaps[index];
+                    auto idMapper = [&newIdMap, &generatedIdMap](const IdType& originalId, bool, const IdGenerator& idGenerator) -> IdType
+                    {
+                        if (!idGenerator)
+                        {
+                            return originalId;
+                        }
+
+                        if constexpr (AllowDuplicates)
+                        {
+                            auto it = generatedIdMap.insert_or_assign(originalId, idGenerator());
+                            return it.first->second;
+                        }
+                        else
+                        {
+                            auto findIt = newIdMap.find(originalId);
+                            if (findIt != newIdMap.end())
+                            {
+                                return findIt->second;
+                            }
+                            auto it = generatedIdMap.emplace(originalId, idGenerator());
+                            return it.first->second;
+                        }
+                    };
+                    RemapIds(clones[index], idMapper, context, true);
+                });
+
+                for (MapType& generatedIdMap : generatedIdMaps)
+                {
+                    for (auto& idPair : generatedIdMap)
+                    {
+                        if constexpr (AllowDuplicates)
+                        {
+                            newIdMap.insert_or_assign(idPair.first, idPair.second);
+                        }
+                        else
+                        {
+                            newIdMap.emplace(idPair.first, idPair.second);
+                        }
+                    }
+                }
+
+                forEachClone([&](size_t index)
+                {
+                    if (!clones[index])
+                    {
+                        return;
+                    }
+
+                    auto idMapper = [&newIdMap](const IdType& originalId, bool, const IdGenerator&) -> IdType
+                    {
+                        auto findIt = newIdMap.find(originalId);
+                        return findIt != newIdMap.end() ? findIt->second : originalId;
+                    };
+                    RemapIds(clones[index], idMapper, context, false);
+                });
+            }
         };
 
         template<typename IdType>
@@ -12,6 +12,7 @@
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/error/error.h>
@@ -234,38 +235,163 @@ namespace AZ::JsonSerializationUtils
         }
     }
 
-    AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream)
+    namespace
     {
-        IO::SizeType length = stream.GetLength();
+        //! rapidjson input stream reading a GenericStream in chunks, so documents can be parsed without holding the
+        //! whole text in memory. It also counts the lines read for the error messages.
+        class GenericStreamReadStream
+        {
+        public:
+            using Ch = char; //<! Denotes the string character storage type for rapidjson
+
+            static constexpr size_t ChunkSize = 64 * 1024;
+
+            explicit GenericStreamReadStream(IO::GenericStream& stream)
+                : m_stream(stream)
+            {
+                m_chunk.resize_no_construct(ChunkSize);
+                m_cursor = m_chunk.data();
+                m_chunkEnd = m_chunk.data();
+                ReadChunk();
+            }
+
+            char Peek() const
+            {
+                return m_cursor < m_chunkEnd ? *m_cursor : '\0';
+            }
+
+            char Take()
+            {
+                if (m_cursor == m_chunkEnd)
+                {
+                    return '\0';
+                }
+
+                const char c = *m_cursor++;
+                m_lineCount += (c == '\n') ? 1 : 0;
+                if (m_cursor == m_chunkEnd)
+                {
+                    ReadChunk();
+                }
+                return c;
+            }
+
+            size_t Tell() const
+            {
+                return m_chunkOffset + static_cast<size_t>(m_cursor - m_chunk.data());
+            }
+
+            char* PutBegin()
+            {
+                AZ_Assert(false, "Not implemented, the stream can't be parsed in-situ");
+                return nullptr;
+            }
+
+            void Put(char)
+            {
+                AZ_Assert(false, "Not implemented, the stream can't be parsed in-situ");
+            }
+
+            void Flush()
+            {
+            }
+
+            size_t PutEnd(char*)
+            {
+                AZ_Assert(false, "Not implemented, the stream can't be parsed in-situ");
+                return 0;
+            }
+
+            const char* Peek4() const
+            {
+                AZ_Assert(false, "Not implemented, encoding is hard-coded to UTF-8");
+                return m_cursor;
+            }
+
+            //! Returns whether reading from the stream failed, rather than reaching its end.
+            bool HasReadError() const
+            {
+                return m_readError;
+            }
 
-        AZStd::vector<char> memoryBuffer;
-        memoryBuffer.resize_no_construct(static_cast<AZStd::vector<char>::size_type>(static_cast<AZStd::vector<char>::size_type>(length) + 1));
+            //! Returns the number of the line being read, starting at 1.
+            size_t GetLineNumber() const
+            {
+                return m_lineCount + 1;
+            }
+
+        private:
+            void ReadChunk()
+            {
+                m_chunkOffset += static_cast<size_t>(m_chunkEnd - m_chunk.data());
+                m_cursor = m_chunk.data();
+                m_chunkEnd = m_chunk.data();
 
-        IO::SizeType bytesRead = stream.Read(length, memoryBuffer.data());
-        if (bytesRead != length)
+                const IO::SizeType remaining = m_stream.GetLength() - m_stream.GetCurPos();
+                if (m_readError || remaining == 0)
+                {
+                    return;
+                }
+
+                const IO::SizeType bytesToRead = AZStd::min<IO::SizeType>(remaining, ChunkSize);
+                const IO::SizeType bytesRead = m_stream.Read(bytesToRead, m_chunk.data());
+                m_readError = bytesRead != bytesToRead;
+                m_chunkEnd = m_chunk.data() + bytesRead;
+            }
+
+            IO::GenericStream& m_stream;
+            AZStd::vector<char> m_chunk;
+            const char* m_cursor = nullptr;
+            const char* m_chunkEnd = nullptr;
+            size_t m_chunkOffset = 0;
+            size_t m_lineCount = 0;
+            bool m_readError = false;
+        };
+    } // namespace
+
+    AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream)
+    {
+        // Parse the stream as it's read, rather than reading the whole text first, so only the document is held in memory
+        GenericStreamReadStream readStream(stream);
+
+        rapidjson::Document jsonDocument;
+        jsonDocument.ParseStream<rapidjson::kParseCommentsFlag>(readStream);
+        if (readStream.HasReadError())
         {
             return AZ::Failure(AZStd::string{"Cannot to read input stream."});
         }
-
-        memoryBuffer.back() = 0;
-
-        return ReadJsonString(AZStd::string_view{memoryBuffer.data(), memoryBuffer.size()});
+        else if (jsonDocument.HasParseError())
+        {
+            return AZ::Failure(AZStd::string::format("JSON parse error at line %zu: %s", readStream.GetLineNumber(),
+                rapidjson::GetParseError_En(jsonDocument.GetParseError())));
+        }
+        else
+        {
+            return AZ::Success(AZStd::move(jsonDocument));
+        }
     }
 
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonFile(AZStd::string_view filePath, size_t maxFileSize)
     {
-        // Read into memory first and then parse the json, rather than passing a file stream to rapidjson.
-        // This should avoid creating a large number of micro-reads from the file.
-
-        auto readResult = AZ::Utils::ReadFile<AZStd::string>(filePath, maxFileSize);
-        if(!readResult.IsSuccess())
+        // The file is parsed in large chunks, which avoids both a large number of micro-reads from the file
+        // and holding the whole text in memory next to the document.
+        IO::FileIOStream file;
+        if (!file.Open(AZ::IO::FixedMaxPath(filePath).c_str(), IO::OpenMode::ModeRead))
         {
-            return AZ::Failure(readResult.GetError());
+            return AZ::Failure(AZStd::string::format("Failed to open '%.*s'.", AZ_STRING_ARG(filePath)));
         }
 
-        AZStd::string jsonContent = readResult.TakeValue();
+        const IO::SizeType length = file.GetLength();
+        if (length > maxFileSize)
+        {
+            return AZ::Failure(AZStd::string{ "Data is too large." });
+        }
+        else if (length == 0)
+        {
+            return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. File is empty.", AZ_STRING_ARG(filePath)));
+        }
 
-        auto result = ReadJsonString(jsonContent);
+        auto result = ReadJsonStream(file);
         if (!result.IsSuccess())
         {
             return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. %s", AZ_STRING_ARG(filePath), result.GetError().c_str()));
@@ -180,6 +180,51 @@ namespace AZ
             bool ConvertOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
             void PreparseOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
 
+            /// Key to look up the class data of a child element by its type id and name.
+            struct ChildElementKey
+            {
+                bool operator==(const ChildElementKey& rhs) const
+                {
+                    return m_typeId == rhs.m_typeId && m_nameCrc == rhs.m_nameCrc;
+                }
+
+                Uuid m_typeId;
+                u32 m_nameCrc;
+            };
+
+            struct ChildElementKeyHash
+            {
+                size_t operator()(const ChildElementKey& key) const
+                {
+                    size_t hash = AZStd::hash<Uuid>{}(key.m_typeId);
+                    AZStd::hash_combine(hash, key.m_nameCrc);
+                    return hash;
+                }
+            };
+
+            /// Resolved class data of a child element, including the specialized type id if the class has generic class info.
+            struct ChildElementClass
+            {
+                const SerializeContext::ClassData* m_classData;
+                Uuid m_typeId;
+            };
+
+            /// Load plan that's compiled the first time a class is encountered in a stream. It replaces the searches through
+            /// the reflected elements and registered types that would otherwise be repeated for every instance of the class.
+            struct LoadPlan
+            {
+                AZStd::unordered_map<u32, const SerializeContext::ClassElement*> m_elementsByNameCrc;
+                AZStd::unordered_map<ChildElementKey, ChildElementClass, ChildElementKeyHash> m_childClasses;
+                bool m_isCompiled = false;
+            };
+
+            LoadPlan& GetLoadPlan(const SerializeContext::ClassData* classData);
+            /// Returns the reflected element of classData with the given name or null if there's no such element.
+            const SerializeContext::ClassElement* FindLoadPlanElement(const SerializeContext::ClassData* classData, u32 nameCrc);
+            /// Returns the class data for an element with the given type and name stored in a parent class. The type id is updated
+            /// to the specialized type id if the class has generic class info.
+            const SerializeContext::ClassData* FindLoadPlanChildClass(const SerializeContext::ClassData* parent, u32 nameCrc, Uuid& typeId);
+
             int                                 m_flags;
             FilterDescriptor                    m_filterDesc;
             IO::GenericStream*              m_stream;
@@ -226,8 +271,67 @@ namespace AZ
             // completed successfully to make sure the equivalent amount
             // of CloseElements are called
             AZStd::vector<bool>                           m_writeElementResultStack;
+
+            // load plans per parent class, the root elements are stored under null.
+            AZStd::unordered_map<const SerializeContext::ClassData*, LoadPlan> m_loadPlans;
         };
 
+        //=========================================================================
+        // GetLoadPlan
+        //=========================================================================
+        ObjectStreamImpl::LoadPlan& ObjectStreamImpl::GetLoadPlan(const SerializeContext::ClassData* classData)
+        {
+            LoadPlan& plan = m_loadPlans[classData];
+            if (!plan.m_isCompiled)
+            {
+                if (classData)
+                {
+                    plan.m_elementsByNameCrc.reserve(classData->m_elements.size());
+                    for (const SerializeContext::ClassElement& classElement : classData->m_elements)
+                    {
+                        // emplace keeps the first element with a name, which matches a linear search through the elements.
+                        plan.m_elementsByNameCrc.emplace(classElement.m_nameCrc, &classElement);
+                    }
+                }
+                plan.m_isCompiled = true;
+            }
+            return plan;
+        }
+
+        //=========================================================================
+        // FindLoadPlanElement
+        //=========================================================================
+        const SerializeContext::ClassElement* ObjectStreamImpl::FindLoadPlanElement(const SerializeContext::ClassData* classData, u32 nameCrc)
+        {
+            const LoadPlan& plan = GetLoadPlan(classData);
+            auto elementIt = plan.m_elementsByNameCrc.find(nameCrc);
+            return elementIt != plan.m_elementsByNameCrc.end() ? elementIt->second : nullptr;
+        }
+
+        //=========================================================================
+        // FindLoadPlanChildClass
+        //=========================================================================
+        const SerializeContext::ClassData* ObjectStreamImpl::FindLoadPlanChildClass(const SerializeContext::ClassData* parent, u32 nameCrc, Uuid& typeId)
+        {
+            LoadPlan& plan = GetLoadPlan(parent);
+            auto childIt = plan.m_childClasses.find(ChildElementKey{ typeId, nameCrc });
+            if (childIt == plan.m_childClasses.end())
+            {
+                ChildElementClass childClass{ m_sc->FindClassData(typeId, parent, nameCrc), typeId };
+                if (childClass.m_classData)
+                {
+                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                    if (GenericClassInfo* genericClassInfo = m_sc->FindGenericClassInfo(childClass.m_classData->m_typeId))
+                    {
+                        childClass.m_typeId = genericClassInfo->GetSpecializedTypeId();
+                    }
+                }
+                childIt = plan.m_childClasses.emplace(ChildElementKey{ typeId, nameCrc }, childClass).first;
+            }
+            typeId = childIt->second.m_typeId;
+            return childIt->second.m_classData;
+        }
+
         //=========================================================================
         // PreparseOldVersion
         // [4/25/2012]
@@ -598,65 +702,61 @@ namespace AZ
                     }
                     else
                     {
-                        for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                        const SerializeContext::ClassElement* childElement = FindLoadPlanElement(parentClassInfo, element.m_nameCrc);
+                        if (childElement)
                         {
-                            const SerializeContext::ClassElement* childElement = &parentClassInfo->m_elements[i];
-                            if (childElement->m_nameCrc == element.m_nameCrc)
+                            // if the member is a pointer type, then the pointer could be a derived type,
+                            // otherwise we need the uuids to be exactly the same.
+                            if (childElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)
                             {
-                                // if the member is a pointer type, then the pointer could be a derived type,
-                                // otherwise we need the uuids to be exactly the same.
-                                if (childElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                                bool isCastableToClassElement = m_sc->CanDowncast(element.m_id, childElement->m_typeId, classData->m_azRtti, childElement->m_azRtti);
+                                bool isConvertableToClassElement = false;
+                                if(!isCastableToClassElement)
                                 {
-                                    bool isCastableToClassElement = m_sc->CanDowncast(element.m_id, childElement->m_typeId, classData->m_azRtti, childElement->m_azRtti);
-                                    bool isConvertableToClassElement = false;
-                                    if(!isCastableToClassElement)
-                                    {
-                                        const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
-                                        isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
-                                    }
-                                    if (isCastableToClassElement || isConvertableToClassElement)
-                                    {
-                                        classElement = childElement;
-                                    }
-                                    else
-                                    {
-                                        // Name matched but wrong type, this is an error when conversion function is not supplied.
-                                        AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s and cannot be downcasted to type %s.  File %s",
-                                            element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
-                                            element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
-                                            GetStreamFilename());
-
-                                        result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
-                                        m_errorLogger.ReportError(error.c_str());
-                                    }
+                                    const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
+                                    isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
+                                }
+                                if (isCastableToClassElement || isConvertableToClassElement)
+                                {
+                                    classElement = childElement;
                                 }
                                 else
                                 {
-                                    bool isCastableToClassElement = element.m_id == childElement->m_typeId;
-                                    bool isConvertableToClassElement = false;
-                                    if (!isCastableToClassElement)
-                                    {
-                                        const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
-                                        isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
-                                    }
-
-                                    if (element.m_id == childElement->m_typeId || isConvertableToClassElement)
-                                    {
-                                        classElement = childElement;
-                                    }
-                                    else
-                                    {
-                                        // Name matched but wrong type, this is an error when conversion function is not supplied.
-                                        AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s but needs to be type %s.  File %s",
-                                            element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
-                                            element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
-                                            GetStreamFilename());
-
-                                        result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
-                                        m_errorLogger.ReportError(error.c_str());
-                                    }
+                                    // Name matched but wrong type, this is an error when conversion function is not supplied.
+                                    AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s and cannot be downcasted to type %s.  File %s",
+                                        element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
+                                        element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
+                                        GetStreamFilename());
+
+                                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                                    m_errorLogger.ReportError(error.c_str());
+                                }
+                            }
+                            else
+                            {
+                                bool isCastableToClassElement = element.m_id == childElement->m_typeId;
+                                bool isConvertableToClassElement = false;
+                                if (!isCastableToClassElement)
+                                {
+                                    const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
+                                    isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
+                                }
+
+                                if (element.m_id == childElement->m_typeId || isConvertableToClassElement)
+                                {
+                                    classElement = childElement;
+                                }
+                                else
+                                {
+                                    // Name matched but wrong type, this is an error when conversion function is not supplied.
+                                    AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s but needs to be type %s.  File %s",
+                                        element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
+                                        element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
+                                        GetStreamFilename());
+
+                                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                                    m_errorLogger.ReportError(error.c_str());
                                 }
-                                break;
                             }
                         }
 
@@ -1343,13 +1443,21 @@ namespace AZ
 
 
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
+                if (&sc == m_sc)
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    // Binary streams contain many instances of the same classes, so the lookup results are kept in the load plan of the parent.
+                    cd = FindLoadPlanChildClass(parent, element.m_nameCrc, element.m_id);
+                }
+                else
+                {
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd)
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
                     }
                 }
 
@@ -28,6 +28,8 @@
 #include <AzCore/Math/MathUtils.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 
 #if defined(AZ_ENABLE_TRACING) && !defined(AZ_DISABLE_SERIALIZER_DEBUG)
 #   define AZ_ENABLE_SERIALIZER_DEBUG
@@ -2116,6 +2118,124 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // CloneObjects
+    //=========================================================================
+    void SerializeContext::CloneObjects(const void* const* ptrs, const Uuid* classIds, size_t count, void** clones, JobContext* jobContext)
+    {
+        if (!jobContext)
+        {
+            JobManagerBus::BroadcastResult(jobContext, &JobManagerEvents::GetGlobalContext);
+        }
+
+        auto cloneObject = [this, ptrs, classIds, clones](size_t index)
+        {
+            clones[index] = CloneObject(ptrs[index], classIds[index]);
+        };
+
+        if (jobContext && count > 1)
+        {
+            parallel_for(size_t{ 0 }, count, cloneObject, jobContext);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                cloneObject(i);
+            }
+        }
+    }
+
+    //=========================================================================
+    // FindClonePlan
+    //=========================================================================
+    const SerializeContext::ClonePlan* SerializeContext::FindClonePlan(const ClassData* classData)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_clonePlansMutex);
+            auto planIt = m_clonePlans.find(classData->m_typeId);
+            if (planIt != m_clonePlans.end())
+            {
+                return planIt->second.m_isValid ? &planIt->second : nullptr;
+            }
+        }
+
+        ClonePlan plan;
+        plan.m_isValid = BuildClonePlan(plan, classData, 0);
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_clonePlansMutex);
+        // Another thread may have built the same plan in the meantime, in which case that one is kept.
+        auto planIt = m_clonePlans.emplace(classData->m_typeId, AZStd::move(plan)).first;
+        return planIt->second.m_isValid ? &planIt->second : nullptr;
+    }
+
+    //=========================================================================
+    // BuildClonePlan
+    //=========================================================================
+    bool SerializeContext::BuildClonePlan(ClonePlan& plan, const ClassData* classData, size_t baseOffset) const
+    {
+        if (classData->m_serializer || classData->m_container || classData->m_eventHandler ||
+            classData->m_version == VersionClassDeprecated || classData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid())
+        {
+            return false;
+        }
+
+        // Only the integral types registered by the SerializeContext itself are known to serialize to an exact copy of their memory.
+        static const Uuid trivialTypeIds[] = {
+            AzTypeInfo<char>::Uuid(), AzTypeInfo<AZ::s8>::Uuid(), AzTypeInfo<short>::Uuid(), AzTypeInfo<int>::Uuid(),
+            AzTypeInfo<long>::Uuid(), AzTypeInfo<AZ::s64>::Uuid(), AzTypeInfo<unsigned char>::Uuid(), AzTypeInfo<unsigned short>::Uuid(),
+            AzTypeInfo<unsigned int>::Uuid(), AzTypeInfo<unsigned long>::Uuid(), AzTypeInfo<AZ::u64>::Uuid(), AzTypeInfo<float>::Uuid(),
+            AzTypeInfo<double>::Uuid(), AzTypeInfo<bool>::Uuid() };
+
+        for (const ClassElement& element : classData->m_elements)
+        {
+            if (element.m_flags & (ClassElement::FLG_POINTER | ClassElement::FLG_DYNAMIC_FIELD | ClassElement::FLG_UI_ELEMENT))
+            {
+                return false;
+            }
+
+            const ClassData* elementClassData = element.m_genericClassInfo ?
+                element.m_genericClassInfo->GetClassData() : FindClassData(element.m_typeId, classData, element.m_nameCrc);
+            if (!elementClassData)
+            {
+                return false;
+            }
+
+            const size_t offset = baseOffset + element.m_offset;
+            if (elementClassData->m_serializer)
+            {
+                if (elementClassData->m_eventHandler ||
+                    AZStd::find(AZStd::begin(trivialTypeIds), AZStd::end(trivialTypeIds), elementClassData->m_typeId) == AZStd::end(trivialTypeIds))
+                {
+                    return false;
+                }
+
+                if (!plan.m_copyOps.empty() && plan.m_copyOps.back().m_offset + plan.m_copyOps.back().m_size == offset)
+                {
+                    plan.m_copyOps.back().m_size += element.m_dataSize;
+                }
+                else
+                {
+                    plan.m_copyOps.push_back({ offset, element.m_dataSize });
+                }
+            }
+            else if (!BuildClonePlan(plan, elementClassData, offset))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //=========================================================================
+    // ResetClonePlans
+    //=========================================================================
+    void SerializeContext::ResetClonePlans()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_clonePlansMutex);
+        m_clonePlans.clear();
+    }
+
     AZ::SerializeContext::DataPatchUpgrade::DataPatchUpgrade(AZStd::string_view fieldName, unsigned int fromVersion, unsigned int toVersion)
         : m_targetFieldName(fieldName)
         , m_targetFieldCRC(m_targetFieldName.data(), m_targetFieldName.size(), true)
@@ -2388,6 +2508,26 @@ namespace AZ
             }
         }
 
+        if (!classData->m_serializer && !classData->m_container && !classData->m_eventHandler)
+        {
+            // Classes that only hold trivially copyable fields are copied with their clone plan, so their fields don't need to be enumerated.
+            if (const ClonePlan* clonePlan = FindClonePlan(classData))
+            {
+                for (const ClonePlan::CopyOp& copyOp : clonePlan->m_copyOps)
+                {
+                    memcpy(reinterpret_cast<char*>(destPtr) + copyOp.m_offset, reinterpret_cast<const char*>(srcPtr) + copyOp.m_offset, copyOp.m_size);
+                }
+
+                cloneData->m_parentStack.push_back();
+                ObjectCloneData::ParentInfo& parentInfo = cloneData->m_parentStack.back();
+                parentInfo.m_ptr = destPtr;
+                parentInfo.m_reservePtr = reservePtr;
+                parentInfo.m_classData = classData;
+                parentInfo.m_containerIndexCounter = 0;
+                return false; // the plan already copied all the child elements.
+            }
+        }
+
         if (classData->m_eventHandler)
         {
             classData->m_eventHandler->OnWriteBegin(destPtr);
@@ -28,6 +28,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -52,6 +53,7 @@ namespace AZ
 
     class ObjectStream;
     class GenericClassInfo;
+    class JobContext;
 
     struct DataPatchNodeInfo;
 
@@ -320,6 +322,14 @@ namespace AZ
         void CloneObjectInplace(T& dest, const T* obj);
         void CloneObjectInplace(void* dest, const void* ptr, const Uuid& classId);
 
+        /// Makes copies of a batch of objects. The objects are cloned in parallel on the job system if a job context is provided or a global
+        /// job context is available, otherwise they're cloned one after the other. Reflection can't change while cloning and event handlers
+        /// of the cloned classes need to be thread safe. The clones are stored in the same order as the objects in the clones array, which
+        /// needs to have room for count pointers.
+        template<class T>
+        void CloneObjects(const T* const* objs, size_t count, T** clones, JobContext* jobContext = nullptr);
+        void CloneObjects(const void* const* ptrs, const Uuid* classIds, size_t count, void** clones, JobContext* jobContext = nullptr);
+
         // Types listed earlier here will have higher priority
         enum DataPatchUpgradeType
         {
@@ -1124,6 +1134,25 @@ namespace AZ
         bool BeginCloneElementInplace(void* rootDestPtr, void* ptr, const ClassData* classData, const ClassElement* elementData, void* stackData, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer);
         bool EndCloneElement(void* stackData);
 
+        /// Precompiled clone instructions for classes that only consist of trivially copyable fields, such as integers, floats and structs
+        /// of those. Cloning such a class copies the fields directly instead of enumerating and serializing every field individually.
+        struct ClonePlan
+        {
+            struct CopyOp
+            {
+                size_t m_offset;
+                size_t m_size;
+            };
+            AZStd::vector<CopyOp> m_copyOps; ///< Byte ranges to copy, relative to the start of the object. Adjacent fields are merged.
+            bool m_isValid = false; ///< False if the class can't be cloned with a plan and needs to go through reflection.
+        };
+
+        /// Returns the clone plan for a class, building and caching it on first use. Returns null if the class has no valid plan.
+        const ClonePlan* FindClonePlan(const ClassData* classData);
+        bool BuildClonePlan(ClonePlan& plan, const ClassData* classData, size_t baseOffset) const;
+        /// Drops all cached clone plans. Called whenever reflection changes as plans embed the layout of nested classes.
+        void ResetClonePlans();
+
         /**
          * Internal structure to maintain class information while we are describing a class.
          * User should call variety of functions to describe class features and data.
@@ -1345,6 +1374,8 @@ namespace AZ
         AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        AZStd::unordered_map<Uuid, ClonePlan> m_clonePlans; ///< Cached clone plans per class, see FindClonePlan.
+        AZStd::shared_mutex m_clonePlansMutex; ///< Guards m_clonePlans as objects can be cloned from multiple threads.
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
@@ -1821,6 +1852,27 @@ namespace AZ
         CloneObjectInplace(&dest, classPtr, classId);
     }
 
+    // CloneObjects
+    template<class T>
+    void SerializeContext::CloneObjects(const T* const* objs, size_t count, T** clones, JobContext* jobContext)
+    {
+        AZStd::vector<const void*> classPtrs(count);
+        AZStd::vector<Uuid> classIds(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            classPtrs[i] = SerializeTypeInfo<T>::RttiCast(objs[i], SerializeTypeInfo<T>::GetRttiTypeId(objs[i]));
+            classIds[i] = SerializeTypeInfo<T>::GetUuid(objs[i]);
+        }
+
+        AZStd::vector<void*> clonedObjs(count, nullptr);
+        CloneObjects(classPtrs.data(), classIds.data(), count, clonedObjs.data(), jobContext);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            clones[i] = Cast<T*>(clonedObjs[i], classIds[i]);
+        }
+    }
+
     //=========================================================================
     // EnumerateDerived
     // [11/13/2012]
@@ -1897,6 +1949,8 @@ namespace AZ
         const Uuid& typeUuid = AzTypeInfo<T>::Uuid();
         const char* name = AzTypeInfo<T>::Name();
 
+        ResetClonePlans();
+
         if (IsRemovingReflection())
         {
             auto mapIt = m_uuidMap.find(typeUuid);
@@ -23,6 +23,7 @@
 namespace AZ
 {
     struct JsonApplyPatchSettings;
+    class SettingsRegistrySnapshot;
     //! The Settings Registry is the central storage for global settings. Having application-wide settings
     //! stored in a central location allows different tools such as command lines, consoles, configuration
     //! files, etc. to work in a universal way.
@@ -373,6 +374,12 @@ namespace AZ
         //! @return True if the registry folder was successfully merged, otherwise false.
         virtual bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform = {}, AZStd::string_view anchorKey = "", AZStd::vector<char>* scratchBuffer = nullptr) = 0;
+        //! Merges the values stored in a compiled snapshot of a Settings Registry into the registry.
+        //! The values are merged as a JSON Merge Patch, without the need to parse any JSON data.
+        //! @param snapshot The snapshot to merge. \see SettingsRegistrySnapshot
+        //! @param anchorKey The registry path location where the settings will be anchored
+        //! @return True if the snapshot was successfully merged, otherwise false.
+        virtual bool MergeSettingsSnapshot(const SettingsRegistrySnapshot& snapshot, AZStd::string_view anchorKey = "") = 0;
 
         //! Stores the settings structure which is used when merging settings to the Settings Registry
         //! using JSON Merge Patch or JSON Merge Patch.
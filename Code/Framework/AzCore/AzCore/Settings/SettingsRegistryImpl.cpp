@@ -17,6 +17,7 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -47,6 +48,99 @@ namespace AZ::SettingsRegistryImplInternal
 
         return Type::NoType;
     }
+
+    //! Recreates the JSON values stored in a Settings Registry snapshot.
+    class SnapshotToRapidjsonVisitor
+        : public AZ::SettingsRegistryInterface::Visitor
+    {
+    public:
+        using Type = AZ::SettingsRegistryInterface::Type;
+        using VisitAction = AZ::SettingsRegistryInterface::VisitAction;
+        using VisitResponse = AZ::SettingsRegistryInterface::VisitResponse;
+
+        SnapshotToRapidjsonVisitor(rapidjson::Value& root, rapidjson::Document::AllocatorType& allocator)
+            : m_root(root)
+            , m_allocator(allocator)
+        {
+        }
+
+        VisitResponse Traverse(AZStd::string_view, AZStd::string_view valueName, VisitAction action, Type type) override
+        {
+            if (action == VisitAction::End)
+            {
+                m_containers.pop_back();
+                return VisitResponse::Continue;
+            }
+
+            rapidjson::Value value;
+            if (type == Type::Object)
+            {
+                value.SetObject();
+            }
+            else if (type == Type::Array)
+            {
+                value.SetArray();
+            }
+            m_current = &AddValue(valueName, AZStd::move(value));
+            if (action == VisitAction::Begin)
+            {
+                m_containers.push_back(m_current);
+            }
+            return VisitResponse::Continue;
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, bool value) override
+        {
+            m_current->SetBool(value);
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, AZ::s64 value) override
+        {
+            m_current->SetInt64(value);
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, AZ::u64 value) override
+        {
+            m_current->SetUint64(value);
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, double value) override
+        {
+            m_current->SetDouble(value);
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, AZStd::string_view value) override
+        {
+            m_current->SetString(value.data(), aznumeric_caster(value.size()), m_allocator);
+        }
+
+    private:
+        // Values are visited before their siblings are added, so the returned reference remains valid
+        // until all the children of the value have been added.
+        rapidjson::Value& AddValue(AZStd::string_view valueName, rapidjson::Value&& value)
+        {
+            if (m_containers.empty())
+            {
+                m_root = AZStd::move(value);
+                return m_root;
+            }
+
+            rapidjson::Value& container = *m_containers.back();
+            if (container.IsObject())
+            {
+                container.AddMember(
+                    rapidjson::Value(valueName.data(), aznumeric_caster(valueName.size()), m_allocator), AZStd::move(value), m_allocator);
+                return (container.MemberEnd() - 1)->value;
+            }
+            container.PushBack(AZStd::move(value), m_allocator);
+            return container[container.Size() - 1];
+        }
+
+        rapidjson::Value& m_root;
+        rapidjson::Document::AllocatorType& m_allocator;
+        AZStd::vector<rapidjson::Value*> m_containers;
+        rapidjson::Value* m_current{};
+    };
 }
 
 namespace AZ
@@ -914,6 +1008,55 @@ namespace AZ
         return true;
     }
 
+    bool SettingsRegistryImpl::MergeSettingsSnapshot(const SettingsRegistrySnapshot& snapshot, AZStd::string_view anchorKey)
+    {
+        using namespace rapidjson;
+
+        if (!snapshot.IsValid())
+        {
+            AZ_Error("Settings Registry", false, "Unable to merge a Settings Registry snapshot that hasn't been loaded.");
+            return false;
+        }
+
+        Pointer anchorPath;
+        if (!anchorKey.empty())
+        {
+            anchorPath = Pointer(anchorKey.data(), anchorKey.size());
+            if (!anchorPath.IsValid())
+            {
+                AZ_Error("Settings Registry", false, R"(Anchor path "%.*s" is invalid.)", AZ_STRING_ARG(anchorKey));
+                return false;
+            }
+        }
+
+        // Recreate the values directly from the snapshot. This replaces the reading and parsing of the original files.
+        Document jsonPatch;
+        SettingsRegistryImplInternal::SnapshotToRapidjsonVisitor visitor(jsonPatch, jsonPatch.GetAllocator());
+        if (!snapshot.Visit(visitor, "") || !jsonPatch.IsObject())
+        {
+            AZ_Error("Settings Registry", false, "Unable to merge a Settings Registry snapshot where the root element is not a JSON Object.");
+            return false;
+        }
+
+        auto anchorType = Type::NoType;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            Value& anchorRoot = anchorPath.IsValid() ? anchorPath.Create(m_settings, m_settings.GetAllocator()) : m_settings;
+            JsonSerializationResult::ResultCode mergeResult = JsonSerialization::ApplyPatch(
+                anchorRoot, m_settings.GetAllocator(), jsonPatch, JsonMergeApproach::JsonMergePatch, m_applyPatchSettings);
+            if (mergeResult.GetProcessing() != JsonSerializationResult::Processing::Completed)
+            {
+                AZ_Error("Settings Registry", false, "Failed to fully merge the Settings Registry snapshot.");
+                return false;
+            }
+            anchorType = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(anchorRoot);
+        }
+
+        SignalNotifier(anchorKey, anchorType);
+
+        return true;
+    }
+
     SettingsRegistryInterface::VisitResponse SettingsRegistryImpl::Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
         const rapidjson::Value& value) const
     {
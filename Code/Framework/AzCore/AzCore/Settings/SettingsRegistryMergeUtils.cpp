@@ -20,7 +20,9 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 #include <AzCore/Settings/CommandLine.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <cinttypes>
@@ -1014,6 +1016,141 @@ namespace AZ::SettingsRegistryMergeUtils
         }
     }
 
+    AZStd::string GetRegistrySnapshotConfiguration(AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations)
+    {
+        // The order in which specializations are added can differ between applications, so they're sorted.
+        AZStd::vector<AZStd::string_view> names;
+        for (size_t i = 0; i < specializations.GetCount(); ++i)
+        {
+            names.push_back(specializations.GetSpecialization(i));
+        }
+        AZStd::sort(names.begin(), names.end());
+
+        AZStd::string configuration = AZStd::string::format("platform=%.*s;specializations=", AZ_STRING_ARG(platform));
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            configuration += i == 0 ? "" : ",";
+            configuration += names[i];
+        }
+        return configuration;
+    }
+
+    void CollectRegistrySnapshotInputs(SettingsRegistryInterface& registry, AZStd::string_view platform,
+        AZStd::vector<SettingsRegistrySnapshot::Input>& inputs, AZStd::vector<char>* scratchBuffer)
+    {
+        AZStd::vector<char> buffer;
+        if (!scratchBuffer)
+        {
+            scratchBuffer = &buffer;
+        }
+
+        auto AddRegistryFolder = [&inputs, &platform, &scratchBuffer](AZ::IO::FixedMaxPath registryFolder)
+        {
+            // Gather the names of the registry files in the folder and platform folder, which are all the files that
+            // MergeSettingsFolder can merge. The files are sorted for a stable hash across file systems.
+            AZStd::vector<AZ::IO::FixedMaxPath> registryFiles;
+            auto GatherRegistryFiles = [&registryFiles](const AZ::IO::FixedMaxPath& folder)
+            {
+                AZ::IO::SystemFile::FindFiles((folder / "*").c_str(), [&registryFiles, &folder](const char* fileName, bool isFile)
+                {
+                    AZ::IO::PathView filePath(fileName);
+                    if (isFile && (filePath.Extension() == ".setreg" || filePath.Extension() == ".setregpatch"))
+                    {
+                        registryFiles.emplace_back(folder / filePath.Filename());
+                    }
+                    return true;
+                });
+            };
+            GatherRegistryFiles(registryFolder);
+            if (!platform.empty())
+            {
+                GatherRegistryFiles(registryFolder / SettingsRegistryInterface::PlatformFolder / platform);
+            }
+            AZStd::sort(registryFiles.begin(), registryFiles.end());
+
+            AZ::HashValue64 hash{ 0 };
+            for (const AZ::IO::FixedMaxPath& registryFile : registryFiles)
+            {
+                AZStd::string_view relativePath = registryFile.Native();
+                relativePath.remove_prefix(registryFolder.Native().size());
+                hash = AZ::TypeHash64(reinterpret_cast<const uint8_t*>(relativePath.data()), relativePath.size(), hash);
+
+                scratchBuffer->resize_no_construct(AZ::IO::SystemFile::Length(registryFile.c_str()));
+                if (!scratchBuffer->empty() &&
+                    AZ::IO::SystemFile::Read(registryFile.c_str(), scratchBuffer->data(), scratchBuffer->size()) == scratchBuffer->size())
+                {
+                    hash = AZ::TypeHash64(reinterpret_cast<const uint8_t*>(scratchBuffer->data()), scratchBuffer->size(), hash);
+                }
+            }
+            scratchBuffer->clear();
+
+            inputs.push_back({ AZStd::string(registryFolder.Native()), static_cast<AZ::u64>(hash) });
+        };
+
+        if (AZ::IO::FixedMaxPath engineRootPath; registry.Get(engineRootPath.Native(), FilePathKey_EngineRootFolder))
+        {
+            AddRegistryFolder(engineRootPath / SettingsRegistryInterface::RegistryFolder);
+        }
+        VisitActiveGems(registry, [&AddRegistryFolder](AZStd::string_view, AZ::IO::FixedMaxPath gemPath)
+        {
+            AddRegistryFolder(gemPath / SettingsRegistryInterface::RegistryFolder);
+        });
+        if (AZ::IO::FixedMaxPath projectPath; registry.Get(projectPath.Native(), FilePathKey_ProjectPath))
+        {
+            AddRegistryFolder(projectPath / SettingsRegistryInterface::RegistryFolder);
+        }
+    }
+
+    bool MergeSettingsToRegistry_RegistrySnapshot(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer)
+    {
+        AZ::IO::FixedMaxPath snapshotPath;
+        if (!registry.Get(snapshotPath.Native(), FilePathKey_CacheRootFolder))
+        {
+            return false;
+        }
+
+        AZStd::fixed_string<32> registryFolderLower(SettingsRegistryInterface::RegistryFolder);
+        AZStd::to_lower(registryFolderLower.begin(), registryFolderLower.end());
+        snapshotPath /= registryFolderLower;
+        snapshotPath /= AZ::IO::FixedMaxPathString::format("%s%.*s%s", RegistrySnapshotFilePrefix,
+            AZ_STRING_ARG(specializations.GetSpecialization(0)), SettingsRegistrySnapshot::Extension);
+        if (!AZ::IO::SystemFile::Exists(snapshotPath.c_str()))
+        {
+            return false;
+        }
+
+        SettingsRegistrySnapshot snapshot;
+        if (!snapshot.Load(snapshotPath.c_str()))
+        {
+            return false;
+        }
+
+        if (snapshot.GetConfiguration() != GetRegistrySnapshotConfiguration(platform, specializations))
+        {
+            return false;
+        }
+
+        AZStd::vector<SettingsRegistrySnapshot::Input> inputs;
+        CollectRegistrySnapshotInputs(registry, platform, inputs, scratchBuffer);
+        if (inputs.size() != snapshot.GetInputCount())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            if (inputs[i].m_path != snapshot.GetInputPath(i) || inputs[i].m_hash != snapshot.GetInputHash(i))
+            {
+                AZ_TracePrintf("SettingsRegistryMergeUtils", R"(Registry snapshot "%s" is out of date because of changes in "%s".)" "\n",
+                    snapshotPath.c_str(), inputs[i].m_path.c_str());
+                return false;
+            }
+        }
+
+        return registry.MergeSettingsSnapshot(snapshot);
+    }
+
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer)
     {
@@ -11,6 +11,7 @@
 #include <AzCore/IO/Path/Path_fwd.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/Settings/CommandLine.h>
 
 namespace AZ::IO
@@ -231,6 +232,31 @@ namespace AZ::SettingsRegistryMergeUtils
     void MergeSettingsToRegistry_ProjectRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer = nullptr);
 
+    //! Name of the snapshot of the Engine, Gem and Project registries in the "registry" folder of the cache root.
+    //! The full file name is "<RegistrySnapshotFilePrefix><configuration>.setregsnapshot", for instance
+    //! "bootstrap.game.profile.setregsnapshot".
+    inline constexpr const char* RegistrySnapshotFilePrefix = "bootstrap.game.";
+
+    //! Returns the string that identifies the platform and specializations a registry snapshot was created for.
+    //! A snapshot is only used if the configuration it was created for matches the configuration it's loaded with.
+    AZStd::string GetRegistrySnapshotConfiguration(AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations);
+
+    //! Gathers the Engine, Gem and Project registry folders in the order they're merged by MergeSettingsToRegistry_EngineRegistry,
+    //! MergeSettingsToRegistry_GemRegistries and MergeSettingsToRegistry_ProjectRegistry. The hash of every folder
+    //! includes the names and contents of all registry files in the folder and its platform folder.
+    //! These are the inputs stored in a registry snapshot that are used to detect if the snapshot is out of date.
+    void CollectRegistrySnapshotInputs(SettingsRegistryInterface& registry, AZStd::string_view platform,
+        AZStd::vector<SettingsRegistrySnapshot::Input>& inputs, AZStd::vector<char>* scratchBuffer = nullptr);
+
+    //! Merges the snapshot of the Engine, Gem and Project registries from the "registry" folder of the cache root if
+    //! the snapshot exists and is up to date with the registry folders it was created from.
+    //! @return True if the snapshot was merged, in which case there's no need to call MergeSettingsToRegistry_EngineRegistry,
+    //!     MergeSettingsToRegistry_GemRegistries and MergeSettingsToRegistry_ProjectRegistry.
+    //!     False if the snapshot isn't available or out of date and the registry folders need to be merged individually.
+    bool MergeSettingsToRegistry_RegistrySnapshot(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer = nullptr);
+
     //! Adds the development settings added by individual users of the project to the Settings Registry.
     //! Note that this function is only called in development builds and is compiled out in release builds.
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
@@ -0,0 +1,739 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::SettingsRegistrySnapshotInternal
+{
+    static constexpr AZ::u32 Magic = 0x53535253; // "SRSS"
+    static constexpr AZ::u32 Version = 1;
+    //! Maximum number of seeds that are tried to find a collision free placement for a bucket in the perfect hash index.
+    static constexpr AZ::u32 MaxSeedAttempts = 1 << 20;
+
+    enum EntryFlags : AZ::u8
+    {
+        EntryFlag_None = 0,
+        EntryFlag_Signed = 1 << 0 //!< The integer was stored as a signed value.
+    };
+
+    AZ::u64 HashPath(AZStd::string_view path, AZ::u64 seed)
+    {
+        return static_cast<AZ::u64>(
+            AZ::TypeHash64(reinterpret_cast<const uint8_t*>(path.data()), path.size(), AZ::HashValue64{ seed }));
+    }
+
+    //! Value collected while creating the snapshot, before it's written in the binary layout.
+    struct CollectedEntry
+    {
+        AZStd::string m_path;
+        AZStd::string m_name;
+        AZStd::string m_string;
+        AZ::u64 m_value{ 0 };
+        AZ::u32 m_subtreeEnd{ 0 };
+        AZ::SettingsRegistryInterface::Type m_type{ AZ::SettingsRegistryInterface::Type::NoType };
+        AZ::u8 m_flags{ EntryFlag_None };
+    };
+
+    class EntryCollector
+        : public AZ::SettingsRegistryInterface::Visitor
+    {
+    public:
+        using Type = AZ::SettingsRegistryInterface::Type;
+        using VisitAction = AZ::SettingsRegistryInterface::VisitAction;
+        using VisitResponse = AZ::SettingsRegistryInterface::VisitResponse;
+
+        explicit EntryCollector(AZStd::vector<CollectedEntry>& entries)
+            : m_entries(entries)
+        {
+        }
+
+        VisitResponse Traverse(AZStd::string_view path, AZStd::string_view valueName, VisitAction action, Type type) override
+        {
+            if (action == VisitAction::End)
+            {
+                m_entries[m_openContainers.back()].m_subtreeEnd = aznumeric_caster(m_entries.size());
+                m_openContainers.pop_back();
+                return VisitResponse::Continue;
+            }
+
+            if (action == VisitAction::Begin)
+            {
+                m_openContainers.push_back(aznumeric_caster(m_entries.size()));
+            }
+
+            CollectedEntry& entry = m_entries.emplace_back();
+            entry.m_path = path;
+            entry.m_name = valueName;
+            entry.m_type = type;
+            entry.m_subtreeEnd = aznumeric_caster(m_entries.size());
+            return VisitResponse::Continue;
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, bool value) override
+        {
+            m_entries.back().m_value = value ? 1 : 0;
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, AZ::s64 value) override
+        {
+            m_entries.back().m_value = static_cast<AZ::u64>(value);
+            m_entries.back().m_flags = EntryFlag_Signed;
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, AZ::u64 value) override
+        {
+            m_entries.back().m_value = value;
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, double value) override
+        {
+            memcpy(&m_entries.back().m_value, &value, sizeof(value));
+        }
+
+        void Visit(AZStd::string_view, AZStd::string_view, Type, AZStd::string_view value) override
+        {
+            m_entries.back().m_string = value;
+        }
+
+    private:
+        AZStd::vector<CollectedEntry>& m_entries;
+        AZStd::vector<AZ::u32> m_openContainers;
+    };
+
+    //! Builds the tables of a perfect hash using the "hash, displace and compress" approach. Every key is first hashed
+    //! to a bucket. The buckets are then placed from largest to smallest by searching for a seed that hashes all the keys
+    //! in the bucket to free slots. A lookup then only needs two hashes and a single key comparison.
+    bool BuildPerfectHash(const AZStd::vector<CollectedEntry>& entries, AZStd::vector<AZ::u32>& seeds, AZStd::vector<AZ::u32>& slots)
+    {
+        const size_t entryCount = entries.size();
+        const size_t bucketCount = AZStd::max<size_t>(1, entryCount / 4);
+        const size_t slotCount = AZStd::max<size_t>(1, entryCount + entryCount / 4);
+
+        AZStd::vector<AZStd::vector<AZ::u32>> buckets(bucketCount);
+        for (size_t i = 0; i < entryCount; ++i)
+        {
+            buckets[HashPath(entries[i].m_path, 0) % bucketCount].push_back(aznumeric_caster(i));
+        }
+
+        AZStd::vector<AZ::u32> bucketOrder(bucketCount);
+        for (size_t i = 0; i < bucketCount; ++i)
+        {
+            bucketOrder[i] = aznumeric_caster(i);
+        }
+        AZStd::sort(bucketOrder.begin(), bucketOrder.end(),
+            [&buckets](AZ::u32 lhs, AZ::u32 rhs)
+            {
+                return buckets[lhs].size() > buckets[rhs].size();
+            });
+
+        seeds.assign(bucketCount, 0);
+        slots.assign(slotCount, AZStd::numeric_limits<AZ::u32>::max());
+        AZStd::vector<size_t> placement;
+        for (AZ::u32 bucketIndex : bucketOrder)
+        {
+            const AZStd::vector<AZ::u32>& bucket = buckets[bucketIndex];
+            if (bucket.empty())
+            {
+                break;
+            }
+
+            bool placed = false;
+            for (AZ::u32 seed = 1; seed < MaxSeedAttempts && !placed; ++seed)
+            {
+                placed = true;
+                placement.clear();
+                for (AZ::u32 entryIndex : bucket)
+                {
+                    const size_t slot = HashPath(entries[entryIndex].m_path, seed) % slotCount;
+                    if (slots[slot] != AZStd::numeric_limits<AZ::u32>::max() ||
+                        AZStd::find(placement.begin(), placement.end(), slot) != placement.end())
+                    {
+                        placed = false;
+                        break;
+                    }
+                    placement.push_back(slot);
+                }
+
+                if (placed)
+                {
+                    seeds[bucketIndex] = seed;
+                    for (size_t i = 0; i < bucket.size(); ++i)
+                    {
+                        slots[placement[i]] = bucket[i];
+                    }
+                }
+            }
+
+            if (!placed)
+            {
+                AZ_Error("Settings Registry Snapshot", false, "Unable to build the lookup table for the snapshot.");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Appends a string to the string table and returns its offset.
+    AZ::u32 AppendString(AZStd::string& strings, AZStd::string_view value)
+    {
+        const AZ::u32 offset = aznumeric_caster(strings.size());
+        strings += value;
+        return offset;
+    }
+
+    AZ::u32 AlignOffset(size_t offset)
+    {
+        return aznumeric_caster((offset + alignof(AZ::u64) - 1) & ~(alignof(AZ::u64) - 1));
+    }
+} // namespace AZ::SettingsRegistrySnapshotInternal
+
+namespace AZ
+{
+    // The binary layout of the snapshot is:
+    //   Header
+    //   Entry[entryCount]        Values in the order they're visited, so every object and array is followed by its children.
+    //   InputRecord[inputCount]
+    //   u32[bucketCount]         Seeds of the perfect hash.
+    //   u32[slotCount]           Entry index per slot of the perfect hash.
+    //   char[stringsSize]        String table with all paths, names, string values, inputs and the configuration.
+    struct SettingsRegistrySnapshot::Header
+    {
+        AZ::u32 m_magic;
+        AZ::u32 m_version;
+        AZ::u64 m_size;
+        AZ::u32 m_entryCount;
+        AZ::u32 m_inputCount;
+        AZ::u32 m_bucketCount;
+        AZ::u32 m_slotCount;
+        AZ::u32 m_entriesOffset;
+        AZ::u32 m_inputsOffset;
+        AZ::u32 m_bucketsOffset;
+        AZ::u32 m_slotsOffset;
+        AZ::u32 m_stringsOffset;
+        AZ::u32 m_stringsSize;
+        AZ::u32 m_configurationOffset;
+        AZ::u32 m_configurationLength;
+    };
+
+    struct SettingsRegistrySnapshot::Entry
+    {
+        AZ::u32 m_pathOffset;
+        AZ::u32 m_pathLength;
+        AZ::u32 m_nameOffset;
+        AZ::u32 m_nameLength;
+        //! Index of the first entry after the children of this entry.
+        AZ::u32 m_subtreeEnd;
+        AZ::u8 m_type;
+        AZ::u8 m_flags;
+        AZ::u16 m_padding;
+        //! Booleans, integers and the bits of floating point values are stored directly. Strings store the offset
+        //! in the string table in the lower 32 bits and the length in the upper 32 bits.
+        AZ::u64 m_value;
+    };
+
+    struct SettingsRegistrySnapshot::InputRecord
+    {
+        AZ::u32 m_pathOffset;
+        AZ::u32 m_pathLength;
+        AZ::u64 m_hash;
+    };
+
+    bool SettingsRegistrySnapshot::Create(
+        const SettingsRegistryInterface& registry, AZStd::string_view configuration, AZStd::span<const Input> inputs)
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        Reset();
+
+        AZStd::vector<CollectedEntry> collectedEntries;
+        EntryCollector collector(collectedEntries);
+        if (!registry.Visit(collector, ""))
+        {
+            AZ_Error("Settings Registry Snapshot", false, "Unable to collect the values from the Settings Registry.");
+            return false;
+        }
+
+        AZStd::vector<AZ::u32> seeds;
+        AZStd::vector<AZ::u32> slots;
+        if (!BuildPerfectHash(collectedEntries, seeds, slots))
+        {
+            return false;
+        }
+
+        AZStd::string strings;
+        AZStd::vector<Entry> entries;
+        entries.reserve(collectedEntries.size());
+        for (const CollectedEntry& collected : collectedEntries)
+        {
+            Entry& entry = entries.emplace_back();
+            entry.m_pathOffset = AppendString(strings, collected.m_path);
+            entry.m_pathLength = aznumeric_caster(collected.m_path.size());
+            entry.m_nameOffset = AppendString(strings, collected.m_name);
+            entry.m_nameLength = aznumeric_caster(collected.m_name.size());
+            entry.m_subtreeEnd = collected.m_subtreeEnd;
+            entry.m_type = static_cast<AZ::u8>(collected.m_type);
+            entry.m_flags = collected.m_flags;
+            entry.m_padding = 0;
+            if (collected.m_type == Type::String)
+            {
+                const AZ::u64 stringOffset = AppendString(strings, collected.m_string);
+                entry.m_value = stringOffset | (static_cast<AZ::u64>(collected.m_string.size()) << 32);
+            }
+            else
+            {
+                entry.m_value = collected.m_value;
+            }
+        }
+
+        AZStd::vector<InputRecord> inputRecords;
+        inputRecords.reserve(inputs.size());
+        for (const Input& input : inputs)
+        {
+            inputRecords.push_back({ AppendString(strings, input.m_path), aznumeric_caster(input.m_path.size()), input.m_hash });
+        }
+
+        Header header{};
+        header.m_magic = Magic;
+        header.m_version = Version;
+        header.m_entryCount = aznumeric_caster(entries.size());
+        header.m_inputCount = aznumeric_caster(inputRecords.size());
+        header.m_bucketCount = aznumeric_caster(seeds.size());
+        header.m_slotCount = aznumeric_caster(slots.size());
+        header.m_configurationOffset = AppendString(strings, configuration);
+        header.m_configurationLength = aznumeric_caster(configuration.size());
+
+        const size_t size = sizeof(Header) + entries.size() * sizeof(Entry) + inputRecords.size() * sizeof(InputRecord) +
+            seeds.size() * sizeof(AZ::u32) + slots.size() * sizeof(AZ::u32) + strings.size();
+        if (size > AZStd::numeric_limits<AZ::u32>::max())
+        {
+            AZ_Error("Settings Registry Snapshot", false, "The Settings Registry is too large to store in a snapshot.");
+            return false;
+        }
+
+        header.m_entriesOffset = sizeof(Header);
+        header.m_inputsOffset = aznumeric_caster(header.m_entriesOffset + entries.size() * sizeof(Entry));
+        header.m_bucketsOffset = aznumeric_caster(header.m_inputsOffset + inputRecords.size() * sizeof(InputRecord));
+        header.m_slotsOffset = aznumeric_caster(header.m_bucketsOffset + seeds.size() * sizeof(AZ::u32));
+        header.m_stringsOffset = aznumeric_caster(header.m_slotsOffset + slots.size() * sizeof(AZ::u32));
+        header.m_stringsSize = aznumeric_caster(strings.size());
+        header.m_size = AlignOffset(header.m_stringsOffset + strings.size());
+
+        m_storage.resize(header.m_size / sizeof(AZ::u64), 0);
+        char* data = reinterpret_cast<char*>(m_storage.data());
+        memcpy(data, &header, sizeof(Header));
+        memcpy(data + header.m_entriesOffset, entries.data(), entries.size() * sizeof(Entry));
+        memcpy(data + header.m_inputsOffset, inputRecords.data(), inputRecords.size() * sizeof(InputRecord));
+        memcpy(data + header.m_bucketsOffset, seeds.data(), seeds.size() * sizeof(AZ::u32));
+        memcpy(data + header.m_slotsOffset, slots.data(), slots.size() * sizeof(AZ::u32));
+        memcpy(data + header.m_stringsOffset, strings.data(), strings.size());
+        return true;
+    }
+
+    bool SettingsRegistrySnapshot::Save(AZ::IO::GenericStream& stream) const
+    {
+        if (!IsValid())
+        {
+            return false;
+        }
+
+        const AZ::IO::SizeType size = GetHeader().m_size;
+        return stream.Write(size, m_storage.data()) == size;
+    }
+
+    bool SettingsRegistrySnapshot::Save(const char* filePath) const
+    {
+        if (!IsValid())
+        {
+            return false;
+        }
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Error("Settings Registry Snapshot", false, R"(Unable to open file "%s" for writing.)", filePath);
+            return false;
+        }
+
+        const AZ::IO::SizeType size = GetHeader().m_size;
+        if (file.Write(m_storage.data(), size) != size)
+        {
+            AZ_Error("Settings Registry Snapshot", false, R"(Unable to write the snapshot to file "%s".)", filePath);
+            return false;
+        }
+        return true;
+    }
+
+    bool SettingsRegistrySnapshot::Load(const char* filePath)
+    {
+        Reset();
+
+        const AZ::IO::SizeType size = AZ::IO::SystemFile::Length(filePath);
+        if (size < sizeof(Header) || size > AZStd::numeric_limits<AZ::u32>::max() || (size % sizeof(AZ::u64)) != 0)
+        {
+            return false;
+        }
+
+        m_storage.resize_no_construct(size / sizeof(AZ::u64));
+        if (AZ::IO::SystemFile::Read(filePath, m_storage.data(), size) != size || !Validate())
+        {
+            AZ_Warning("Settings Registry Snapshot", false, R"(Unable to read snapshot "%s".)", filePath);
+            Reset();
+            return false;
+        }
+        return true;
+    }
+
+    bool SettingsRegistrySnapshot::Load(AZStd::span<const char> data)
+    {
+        Reset();
+
+        if (data.size() < sizeof(Header) || data.size() > AZStd::numeric_limits<AZ::u32>::max() || (data.size() % sizeof(AZ::u64)) != 0)
+        {
+            return false;
+        }
+
+        m_storage.resize_no_construct(data.size() / sizeof(AZ::u64));
+        memcpy(m_storage.data(), data.data(), data.size());
+        if (!Validate())
+        {
+            Reset();
+            return false;
+        }
+        return true;
+    }
+
+    void SettingsRegistrySnapshot::Reset()
+    {
+        m_storage = {};
+    }
+
+    bool SettingsRegistrySnapshot::IsValid() const
+    {
+        return !m_storage.empty();
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetConfiguration() const
+    {
+        if (!IsValid())
+        {
+            return {};
+        }
+        const Header& header = GetHeader();
+        return GetString(header.m_configurationOffset, header.m_configurationLength);
+    }
+
+    size_t SettingsRegistrySnapshot::GetInputCount() const
+    {
+        return IsValid() ? GetHeader().m_inputCount : 0;
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetInputPath(size_t index) const
+    {
+        AZ_Assert(index < GetInputCount(), "Snapshot input index %zu out of bounds.", index);
+        const InputRecord* inputs =
+            reinterpret_cast<const InputRecord*>(reinterpret_cast<const char*>(m_storage.data()) + GetHeader().m_inputsOffset);
+        return GetString(inputs[index].m_pathOffset, inputs[index].m_pathLength);
+    }
+
+    AZ::u64 SettingsRegistrySnapshot::GetInputHash(size_t index) const
+    {
+        AZ_Assert(index < GetInputCount(), "Snapshot input index %zu out of bounds.", index);
+        const InputRecord* inputs =
+            reinterpret_cast<const InputRecord*>(reinterpret_cast<const char*>(m_storage.data()) + GetHeader().m_inputsOffset);
+        return inputs[index].m_hash;
+    }
+
+    size_t SettingsRegistrySnapshot::GetValueCount() const
+    {
+        return IsValid() ? GetHeader().m_entryCount : 0;
+    }
+
+    auto SettingsRegistrySnapshot::GetType(AZStd::string_view path) const -> Type
+    {
+        const AZ::u32 index = FindEntry(path);
+        return index != InvalidIndex ? static_cast<Type>(GetEntries()[index].m_type) : Type::NoType;
+    }
+
+    bool SettingsRegistrySnapshot::Get(bool& result, AZStd::string_view path) const
+    {
+        const AZ::u32 index = FindEntry(path);
+        if (index != InvalidIndex && GetEntries()[index].m_type == static_cast<AZ::u8>(Type::Boolean))
+        {
+            result = GetEntries()[index].m_value != 0;
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(s64& result, AZStd::string_view path) const
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        const AZ::u32 index = FindEntry(path);
+        if (index != InvalidIndex && GetEntries()[index].m_type == static_cast<AZ::u8>(Type::Integer))
+        {
+            // Match the Settings Registry, which allows unsigned values to be read as signed if they fit.
+            const Entry& entry = GetEntries()[index];
+            if ((entry.m_flags & EntryFlag_Signed) || entry.m_value <= static_cast<AZ::u64>(AZStd::numeric_limits<s64>::max()))
+            {
+                result = static_cast<s64>(entry.m_value);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(u64& result, AZStd::string_view path) const
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        const AZ::u32 index = FindEntry(path);
+        if (index != InvalidIndex && GetEntries()[index].m_type == static_cast<AZ::u8>(Type::Integer))
+        {
+            // Match the Settings Registry, which allows signed values to be read as unsigned if they're not negative.
+            const Entry& entry = GetEntries()[index];
+            if (!(entry.m_flags & EntryFlag_Signed) || static_cast<s64>(entry.m_value) >= 0)
+            {
+                result = entry.m_value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(double& result, AZStd::string_view path) const
+    {
+        const AZ::u32 index = FindEntry(path);
+        if (index != InvalidIndex && GetEntries()[index].m_type == static_cast<AZ::u8>(Type::FloatingPoint))
+        {
+            memcpy(&result, &GetEntries()[index].m_value, sizeof(result));
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(AZStd::string_view& result, AZStd::string_view path) const
+    {
+        const AZ::u32 index = FindEntry(path);
+        if (index != InvalidIndex && GetEntries()[index].m_type == static_cast<AZ::u8>(Type::String))
+        {
+            const AZ::u64 value = GetEntries()[index].m_value;
+            result = GetString(static_cast<AZ::u32>(value), static_cast<AZ::u32>(value >> 32));
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Visit(SettingsRegistryInterface::Visitor& visitor, AZStd::string_view path) const
+    {
+        using VisitAction = SettingsRegistryInterface::VisitAction;
+        using VisitResponse = SettingsRegistryInterface::VisitResponse;
+
+        const AZ::u32 first = FindEntry(path);
+        if (first == InvalidIndex)
+        {
+            return false;
+        }
+
+        const Entry* entries = GetEntries();
+        // Stack of the objects and arrays that are currently being visited.
+        AZStd::vector<AZ::u32> openContainers;
+        AZ::u32 index = first;
+        const AZ::u32 end = entries[first].m_subtreeEnd;
+        while (true)
+        {
+            // Close all containers whose children have been visited.
+            while (!openContainers.empty() && index == entries[openContainers.back()].m_subtreeEnd)
+            {
+                const Entry& container = entries[openContainers.back()];
+                openContainers.pop_back();
+                if (visitor.Traverse(GetString(container.m_pathOffset, container.m_pathLength),
+                    GetString(container.m_nameOffset, container.m_nameLength), VisitAction::End,
+                    static_cast<Type>(container.m_type)) == VisitResponse::Done)
+                {
+                    return true;
+                }
+            }
+            if (index >= end)
+            {
+                break;
+            }
+
+            const Entry& entry = entries[index];
+            const AZStd::string_view entryPath = GetString(entry.m_pathOffset, entry.m_pathLength);
+            const AZStd::string_view entryName = GetString(entry.m_nameOffset, entry.m_nameLength);
+            const Type type = static_cast<Type>(entry.m_type);
+            const bool isContainer = type == Type::Object || type == Type::Array;
+
+            const VisitResponse response =
+                visitor.Traverse(entryPath, entryName, isContainer ? VisitAction::Begin : VisitAction::Value, type);
+            if (response == VisitResponse::Done)
+            {
+                return true;
+            }
+
+            if (isContainer)
+            {
+                if (response == VisitResponse::Continue)
+                {
+                    openContainers.push_back(index);
+                    ++index;
+                }
+                else
+                {
+                    index = entry.m_subtreeEnd;
+                }
+                continue;
+            }
+
+            if (response == VisitResponse::Continue)
+            {
+                switch (type)
+                {
+                case Type::Boolean:
+                    visitor.Visit(entryPath, entryName, type, entry.m_value != 0);
+                    break;
+                case Type::Integer:
+                    if (entry.m_flags & SettingsRegistrySnapshotInternal::EntryFlag_Signed)
+                    {
+                        visitor.Visit(entryPath, entryName, type, static_cast<s64>(entry.m_value));
+                    }
+                    else
+                    {
+                        visitor.Visit(entryPath, entryName, type, entry.m_value);
+                    }
+                    break;
+                case Type::FloatingPoint:
+                {
+                    double value;
+                    memcpy(&value, &entry.m_value, sizeof(value));
+                    visitor.Visit(entryPath, entryName, type, value);
+                    break;
+                }
+                case Type::String:
+                    visitor.Visit(entryPath, entryName, type,
+                        GetString(static_cast<AZ::u32>(entry.m_value), static_cast<AZ::u32>(entry.m_value >> 32)));
+                    break;
+                default:
+                    break;
+                }
+            }
+            ++index;
+        }
+        return true;
+    }
+
+    auto SettingsRegistrySnapshot::GetHeader() const -> const Header&
+    {
+        return *reinterpret_cast<const Header*>(m_storage.data());
+    }
+
+    auto SettingsRegistrySnapshot::GetEntries() const -> const Entry*
+    {
+        return reinterpret_cast<const Entry*>(reinterpret_cast<const char*>(m_storage.data()) + GetHeader().m_entriesOffset);
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetString(AZ::u32 offset, AZ::u32 length) const
+    {
+        return AZStd::string_view(reinterpret_cast<const char*>(m_storage.data()) + GetHeader().m_stringsOffset + offset, length);
+    }
+
+    AZ::u32 SettingsRegistrySnapshot::FindEntry(AZStd::string_view path) const
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        if (!IsValid())
+        {
+            return InvalidIndex;
+        }
+
+        const Header& header = GetHeader();
+        const char* data = reinterpret_cast<const char*>(m_storage.data());
+        const AZ::u32* seeds = reinterpret_cast<const AZ::u32*>(data + header.m_bucketsOffset);
+        const AZ::u32* slots = reinterpret_cast<const AZ::u32*>(data + header.m_slotsOffset);
+
+        const AZ::u32 seed = seeds[HashPath(path, 0) % header.m_bucketCount];
+        const AZ::u32 index = slots[HashPath(path, seed) % header.m_slotCount];
+        if (index < header.m_entryCount)
+        {
+            const Entry& entry = GetEntries()[index];
+            if (GetString(entry.m_pathOffset, entry.m_pathLength) == path)
+            {
+                return index;
+            }
+        }
+        return InvalidIndex;
+    }
+
+    bool SettingsRegistrySnapshot::Validate() const
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        const size_t size = m_storage.size() * sizeof(AZ::u64);
+        const Header& header = GetHeader();
+        if (header.m_magic != Magic || header.m_version != Version || header.m_size != size)
+        {
+            return false;
+        }
+
+        // Check that all tables are in bounds, so they can be safely accessed in place.
+        auto isInBounds = [size](AZ::u64 offset, AZ::u64 tableSize)
+        {
+            return offset <= size && tableSize <= size - offset;
+        };
+        if (!isInBounds(header.m_entriesOffset, AZ::u64{ header.m_entryCount } * sizeof(Entry)) ||
+            !isInBounds(header.m_inputsOffset, AZ::u64{ header.m_inputCount } * sizeof(InputRecord)) ||
+            !isInBounds(header.m_bucketsOffset, AZ::u64{ header.m_bucketCount } * sizeof(AZ::u32)) ||
+            !isInBounds(header.m_slotsOffset, AZ::u64{ header.m_slotCount } * sizeof(AZ::u32)) ||
+            !isInBounds(header.m_stringsOffset, header.m_stringsSize) ||
+            (header.m_entriesOffset % alignof(Entry)) != 0 || (header.m_inputsOffset % alignof(InputRecord)) != 0 ||
+            header.m_entryCount == 0 || header.m_bucketCount == 0 || header.m_slotCount == 0 ||
+            !isInBounds(header.m_configurationOffset, header.m_configurationLength) ||
+            AZ::u64{ header.m_configurationOffset } + header.m_configurationLength > header.m_stringsSize)
+        {
+            return false;
+        }
+
+        auto isStringInBounds = [&header](AZ::u64 offset, AZ::u64 length)
+        {
+            return offset <= header.m_stringsSize && length <= header.m_stringsSize - offset;
+        };
+        const Entry* entries = GetEntries();
+        for (AZ::u32 i = 0; i < header.m_entryCount; ++i)
+        {
+            const Entry& entry = entries[i];
+            if (!isStringInBounds(entry.m_pathOffset, entry.m_pathLength) || !isStringInBounds(entry.m_nameOffset, entry.m_nameLength) ||
+                entry.m_subtreeEnd <= i || entry.m_subtreeEnd > header.m_entryCount || entry.m_type > static_cast<AZ::u8>(Type::Object))
+            {
+                return false;
+            }
+            if (entry.m_type == static_cast<AZ::u8>(Type::String) &&
+                !isStringInBounds(static_cast<AZ::u32>(entry.m_value), static_cast<AZ::u32>(entry.m_value >> 32)))
+            {
+                return false;
+            }
+        }
+
+        const InputRecord* inputs = reinterpret_cast<const InputRecord*>(reinterpret_cast<const char*>(m_storage.data()) + header.m_inputsOffset);
+        for (AZ::u32 i = 0; i < header.m_inputCount; ++i)
+        {
+            if (!isStringInBounds(inputs[i].m_pathOffset, inputs[i].m_pathLength))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace AZ
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AZ
+{
+    //! Compiled binary form of the values stored in a Settings Registry.
+    //! Merging a snapshot avoids the reading, parsing and patching of the individual Settings Registry files the snapshot
+    //! was created from. The snapshot is read with a single file read and used as is, so no parsing is needed to
+    //! access the values. Values can be looked up by JSON pointer through a perfect hash index directly in the snapshot,
+    //! or merged into a Settings Registry through SettingsRegistryInterface::MergeSettingsSnapshot.
+    //! To detect if the snapshot is out of date, it stores a list of inputs and their hashes, as well as a configuration
+    //! string describing the settings (such as the platform and specializations) the snapshot was created with.
+    class SettingsRegistrySnapshot
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SettingsRegistrySnapshot, AZ::OSAllocator, 0);
+
+        using Type = SettingsRegistryInterface::Type;
+
+        static constexpr char Extension[] = ".setregsnapshot";
+
+        //! A file or folder the snapshot was created from.
+        struct Input
+        {
+            AZStd::string m_path;
+            AZ::u64 m_hash{ 0 };
+        };
+
+        SettingsRegistrySnapshot() = default;
+        AZ_DISABLE_COPY(SettingsRegistrySnapshot);
+
+        //! Creates the snapshot from all the values in the Settings Registry.
+        //! @param registry The Settings Registry to create the snapshot from.
+        //! @param configuration Description of the settings used to create the snapshot, used to validate the snapshot before use.
+        //! @param inputs The files or folders the values in the registry were merged from.
+        //! @return True if the snapshot was created, otherwise false.
+        bool Create(const SettingsRegistryInterface& registry, AZStd::string_view configuration, AZStd::span<const Input> inputs);
+        //! Writes the snapshot to the provided stream.
+        bool Save(AZ::IO::GenericStream& stream) const;
+        //! Writes the snapshot to the file at the provided path.
+        bool Save(const char* filePath) const;
+
+        //! Loads a snapshot from the file at the provided path. Returns false if the file couldn't be read or isn't valid.
+        bool Load(const char* filePath);
+        //! Loads a snapshot from memory. The data is copied. Returns false if the data isn't a valid snapshot.
+        bool Load(AZStd::span<const char> data);
+        //! Releases the snapshot.
+        void Reset();
+        //! Whether or not a snapshot has been created or loaded.
+        bool IsValid() const;
+
+        //! Returns the configuration the snapshot was created with.
+        AZStd::string_view GetConfiguration() const;
+        //! Returns the number of inputs the snapshot was created from.
+        size_t GetInputCount() const;
+        //! Returns the path of the input at the given index.
+        AZStd::string_view GetInputPath(size_t index) const;
+        //! Returns the hash of the input at the given index.
+        AZ::u64 GetInputHash(size_t index) const;
+        //! Returns the number of values, including objects and arrays, stored in the snapshot.
+        size_t GetValueCount() const;
+
+        //! Returns the type of the value at the JSON pointer or Type::NoType if there's no value stored.
+        Type GetType(AZStd::string_view path) const;
+        //! Gets the value at the JSON pointer. Returns false if there's no value at the path or it's of a different type.
+        bool Get(bool& result, AZStd::string_view path) const;
+        bool Get(s64& result, AZStd::string_view path) const;
+        bool Get(u64& result, AZStd::string_view path) const;
+        bool Get(double& result, AZStd::string_view path) const;
+        //! The returned string points into the snapshot and remains valid for as long as the snapshot is loaded.
+        bool Get(AZStd::string_view& result, AZStd::string_view path) const;
+        //! Traverses the values at and below the JSON pointer in the same order as SettingsRegistryInterface::Visit.
+        bool Visit(SettingsRegistryInterface::Visitor& visitor, AZStd::string_view path = "") const;
+
+    private:
+        struct Header;
+        struct Entry;
+        struct InputRecord;
+
+        const Header& GetHeader() const;
+        const Entry* GetEntries() const;
+        AZStd::string_view GetString(AZ::u32 offset, AZ::u32 length) const;
+        //! Returns the index of the entry for the JSON pointer or InvalidIndex if there's no entry.
+        AZ::u32 FindEntry(AZStd::string_view path) const;
+        bool Validate() const;
+
+        static constexpr AZ::u32 InvalidIndex = static_cast<AZ::u32>(-1);
+
+        //! Storage for the entire snapshot. Stored as 64-bit values to guarantee alignment of the records in the snapshot.
+        AZStd::vector<AZ::u64> m_storage;
+    };
+} // namespace AZ
@@ -23,6 +23,13 @@ namespace AZ::Internal
 
     class CompiledTaskGraph;
 
+    // A dependency between two tasks of a graph, stored as indices into the graph's task list
+    struct TaskLink
+    {
+        uint32_t m_predecessor;
+        uint32_t m_successor;
+    };
+
     // Lambdas are opaque types and we cannot extract any member function pointers. In order to store lambdas in a
     // type erased fashion, we instead use a single function call indirection, invoking the lambda function in a
     // static class function which has a stable address in memory. The Erased* methods return addresses to the
@@ -145,6 +152,8 @@ namespace AZ::Internal
 
         uint8_t GetPriorityNumber() const noexcept;
 
+        uint32_t GetCpuMask() const noexcept;
+
     private:
         friend class CompiledTaskGraph;
         friend class TaskWorker;
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskDescriptor.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+
+    // Settings shared by the parallel algorithms below.
+    //
+    // The range of an algorithm is split into blocks of at least m_grainSize elements, and at most m_blocksPerThread
+    // blocks per thread of the executor. The calling thread and the executor workers claim blocks one at a time until
+    // none are left, so uneven per-element costs balance out while short ranges run inline without any task overhead.
+    // Algorithms invoked from a task running on the executor also run inline, as a task cannot wait on other tasks.
+    struct TaskAlgorithmDesc
+    {
+        // Executor running the tasks, nullptr for the system executor. Without any executor the algorithms run on the calling thread
+        TaskExecutor* m_executor = nullptr;
+
+        // Descriptor of the tasks spawned by the algorithm
+        TaskDescriptor m_taskDescriptor{ "ParallelAlgorithm", "AzCore" };
+
+        // Minimum number of elements a block processes, 0 for a default suited to inexpensive per-element work
+        uint32_t m_grainSize = 0;
+
+        // Maximum number of blocks per thread of the executor, more blocks balance better at the cost of more claims
+        uint32_t m_blocksPerThread = 4;
+    };
+
+    namespace TaskAlgorithms
+    {
+        // Invokes function(index) for every index in [first, last).
+        template<typename IndexType, typename Function>
+        void parallel_for(IndexType first, IndexType last, const Function& function, const TaskAlgorithmDesc& desc = {});
+
+        // Invokes function(rangeFirst, rangeLast) once per block, with the blocks covering [first, last). Preferred
+        // over parallel_for when the loop body benefits from being compiled as a tight loop over contiguous indices.
+        template<typename IndexType, typename Function>
+        void parallel_for_range(IndexType first, IndexType last, const Function& function, const TaskAlgorithmDesc& desc = {});
+
+        // Invokes function(element) for every element in [first, last).
+        template<typename RandomAccessIterator, typename Function>
+        void parallel_for_each(RandomAccessIterator first, RandomAccessIterator last, const Function& function, const TaskAlgorithmDesc& desc = {});
+
+        // Returns init combined with every element in [first, last) using op, which must be associative.
+        // Partial results are combined in the order of the blocks, so the result is deterministic for a given block count.
+        template<typename RandomAccessIterator, typename T, typename BinaryOp>
+        T parallel_reduce(RandomAccessIterator first, RandomAccessIterator last, T init, const BinaryOp& op, const TaskAlgorithmDesc& desc = {});
+
+        // Same as parallel_reduce, combining transform(element) instead of the elements themselves.
+        template<typename RandomAccessIterator, typename T, typename BinaryOp, typename UnaryOp>
+        T parallel_transform_reduce(
+            RandomAccessIterator first, RandomAccessIterator last, T init, const BinaryOp& op, const UnaryOp& transform, const TaskAlgorithmDesc& desc = {});
+
+        // Sorts [first, last) with comp, sorting the blocks in parallel and then merging them pairwise, each merge being
+        // split in pieces along its merge path so that every round stays parallel. The sort is stable.
+        template<typename RandomAccessIterator, typename Compare>
+        void parallel_sort(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp, const TaskAlgorithmDesc& desc = {});
+
+        // Sorts [first, last) in ascending order, using parallel_radix_sort for integer elements.
+        template<typename RandomAccessIterator>
+        void parallel_sort(RandomAccessIterator first, RandomAccessIterator last);
+
+        // Sorts [first, last) in ascending order of keyFunction(element), which must return an unsigned integer.
+        // It is a stable least significant digit radix sort handling 8 bits per pass, where a pass whose digit is
+        // the same for every key is skipped.
+        template<typename RandomAccessIterator, typename KeyFunction>
+        void parallel_radix_sort(RandomAccessIterator first, RandomAccessIterator last, const KeyFunction& keyFunction, const TaskAlgorithmDesc& desc = {});
+
+        // Writes to [output, output + (last - first)) the combination using op of every element up to and including
+        // the one at the same position. The output may be the input range itself.
+        template<typename RandomAccessIterator, typename OutputIterator, typename BinaryOp>
+        void parallel_inclusive_scan(
+            RandomAccessIterator first, RandomAccessIterator last, OutputIterator output, const BinaryOp& op, const TaskAlgorithmDesc& desc = {});
+
+        // Writes to [output, output + (last - first)) the combination using op of init and every element before the one
+        // at the same position. The output may be the input range itself.
+        template<typename RandomAccessIterator, typename OutputIterator, typename T, typename BinaryOp>
+        void parallel_exclusive_scan(
+            RandomAccessIterator first, RandomAccessIterator last, OutputIterator output, T init, const BinaryOp& op, const TaskAlgorithmDesc& desc = {});
+
+        // Reorders [first, last) so that the elements satisfying pred precede the others, preserving the relative order
+        // within both groups. Returns an iterator to the first element of the second group.
+        template<typename RandomAccessIterator, typename Predicate>
+        RandomAccessIterator parallel_stable_partition(
+            RandomAccessIterator first, RandomAccessIterator last, const Predicate& pred, const TaskAlgorithmDesc& desc = {});
+    } // namespace TaskAlgorithms
+} // namespace AZ
+
+#include <AzCore/Task/TaskAlgorithms.inl>
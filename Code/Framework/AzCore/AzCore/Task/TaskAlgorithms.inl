@@ -0,0 +1,574 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::TaskAlgorithms
+{
+    namespace Internal
+    {
+        constexpr uint32_t DefaultGrainSize = 1024;
+        constexpr uint32_t RadixBits = 8;
+        constexpr uint32_t RadixSize = 1 << RadixBits;
+        constexpr size_t RadixSortMinCount = 256; // Below this count the histogram passes cost more than a comparison sort
+
+        // Invokes function(index) for every index in [0, workCount), with the calling thread and up to one task per
+        // executor worker claiming indices until none are left
+        template<typename Function>
+        void Dispatch(TaskExecutor* executor, const TaskAlgorithmDesc& desc, uint32_t workCount, const Function& function)
+        {
+            const uint32_t taskCount = executor ? AZStd::min(workCount, executor->GetThreadCount() + 1) : 1;
+            if ((taskCount <= 1) || executor->IsTaskWorkerThread())
+            {
+                for (uint32_t index = 0; index < workCount; ++index)
+                {
+                    function(index);
+                }
+                return;
+            }
+
+            AZStd::atomic<uint32_t> nextIndex{ 0 };
+            auto claimWork = [&nextIndex, &function, workCount]()
+            {
+                for (uint32_t index = nextIndex.fetch_add(1, AZStd::memory_order_relaxed); index < workCount;
+                     index = nextIndex.fetch_add(1, AZStd::memory_order_relaxed))
+                {
+                    function(index);
+                }
+            };
+
+            // The calling thread is one of the claimers, so one task fewer than the number of claimers is spawned
+            TaskGraph graph;
+            for (uint32_t taskIndex = 1; taskIndex < taskCount; ++taskIndex)
+            {
+                graph.AddTask(desc.m_taskDescriptor, [&claimWork]() { claimWork(); });
+            }
+            graph.Detach();
+
+            TaskGraphEvent finishedEvent;
+            graph.SubmitOnExecutor(*executor, &finishedEvent);
+            claimWork();
+            finishedEvent.Wait();
+        }
+
+        // Splits a range of elements into contiguous blocks of nearly equal size
+        class BlockPartition
+        {
+        public:
+            BlockPartition(size_t count, const TaskAlgorithmDesc& desc)
+                : m_desc(desc)
+                , m_executor(desc.m_executor ? desc.m_executor : TaskExecutor::TryGetInstance())
+                , m_count(count)
+            {
+                const size_t grainSize = (desc.m_grainSize > 0) ? desc.m_grainSize : DefaultGrainSize;
+                const size_t threadCount = m_executor ? m_executor->GetThreadCount() + 1 : 1;
+                const size_t maxBlockCount = threadCount * AZStd::max(desc.m_blocksPerThread, 1u);
+                m_blockCount = static_cast<uint32_t>(AZStd::clamp((count + grainSize - 1) / grainSize, size_t(1), maxBlockCount));
+            }
+
+            uint32_t GetBlockCount() const
+            {
+                return m_blockCount;
+            }
+
+            size_t GetBlockBegin(uint32_t block) const
+            {
+                return m_count * block / m_blockCount;
+            }
+
+            // Invokes function(block, begin, end) for every block
+            template<typename Function>
+            void ForEachBlock(const Function& function) const
+            {
+                Dispatch(m_blockCount, [this, &function](uint32_t block)
+                {
+                    function(block, GetBlockBegin(block), GetBlockBegin(block + 1));
+                });
+            }
+
+            // Invokes function(index) for every index in [0, workCount) using the executor of the partition
+            template<typename Function>
+            void Dispatch(uint32_t workCount, const Function& function) const
+            {
+                Internal::Dispatch(m_executor, m_desc, workCount, function);
+            }
+
+        private:
+            const TaskAlgorithmDesc& m_desc;
+            TaskExecutor* m_executor;
+            size_t m_count;
+            uint32_t m_blockCount;
+        };
+
+        // Returns the number of elements of a that are among the first k elements of the stable merge of a and b
+        template<typename SourceIterator, typename Compare>
+        size_t MergeCoRank(size_t k, SourceIterator a, size_t aCount, SourceIterator b, size_t bCount, const Compare& comp)
+        {
+            size_t low = (k > bCount) ? k - bCount : 0;
+            size_t high = AZStd::min(k, aCount);
+            while (low < high)
+            {
+                const size_t i = low + (high - low) / 2;
+                if (!comp(b[k - i - 1], a[i]))
+                {
+                    // a[i] precedes b[k - i - 1] in the merge, more elements of a are needed
+                    low = i + 1;
+                }
+                else
+                {
+                    high = i;
+                }
+            }
+            return low;
+        }
+
+        template<typename SourceIterator, typename DestIterator, typename Compare>
+        void MergeMove(SourceIterator a, SourceIterator aEnd, SourceIterator b, SourceIterator bEnd, DestIterator output, const Compare& comp)
+        {
+            while ((a != aEnd) && (b != bEnd))
+            {
+                if (comp(*b, *a))
+                {
+                    *output++ = AZStd::move(*b++);
+                }
+                else
+                {
+                    *output++ = AZStd::move(*a++);
+                }
+            }
+            output = AZStd::move(a, aEnd, output);
+            AZStd::move(b, bEnd, output);
+        }
+
+        // Merges pairs of adjacent runs of width blocks from source to dest, splitting each merge into pieces along its merge path
+        template<typename SourceIterator, typename DestIterator, typename Compare>
+        void MergeRound(const BlockPartition& partition, uint32_t width, SourceIterator source, DestIterator dest, const Compare& comp)
+        {
+            const uint32_t blockCount = partition.GetBlockCount();
+            const uint32_t pairCount = (blockCount + 2 * width - 1) / (2 * width);
+            const uint32_t piecesPerPair = AZStd::max(blockCount / pairCount, 1u);
+            partition.Dispatch(pairCount * piecesPerPair, [&](uint32_t workIndex)
+            {
+                const uint32_t pair = workIndex / piecesPerPair;
+                const uint32_t piece = workIndex % piecesPerPair;
+                const size_t begin = partition.GetBlockBegin(pair * 2 * width);
+                const size_t middle = partition.GetBlockBegin(AZStd::min(pair * 2 * width + width, blockCount));
+                const size_t end = partition.GetBlockBegin(AZStd::min(pair * 2 * width + 2 * width, blockCount));
+
+                const size_t mergeCount = end - begin;
+                const size_t pieceBegin = mergeCount * piece / piecesPerPair;
+                const size_t pieceEnd = mergeCount * (piece + 1) / piecesPerPair;
+                const SourceIterator left = source + begin;
+                const SourceIterator right = source + middle;
+                const size_t leftBegin = MergeCoRank(pieceBegin, left, middle - begin, right, end - middle, comp);
+                const size_t leftEnd = MergeCoRank(pieceEnd, left, middle - begin, right, end - middle, comp);
+                MergeMove(left + leftBegin, left + leftEnd, right + (pieceBegin - leftBegin), right + (pieceEnd - leftEnd), dest + (begin + pieceBegin), comp);
+            });
+        }
+
+        // Moves every block of source to dest in parallel
+        template<typename SourceIterator, typename DestIterator>
+        void MoveBlocks(const BlockPartition& partition, SourceIterator source, DestIterator dest)
+        {
+            partition.ForEachBlock([source, dest](uint32_t, size_t begin, size_t end)
+            {
+                AZStd::move(source + begin, source + end, dest + begin);
+            });
+        }
+
+        // Stable scatter of source into dest by the digit of the keys at digitShift, returns false if every key has the same digit
+        template<typename SourceIterator, typename DestIterator, typename KeyFunction>
+        bool RadixPass(const BlockPartition& partition, AZStd::vector<size_t>& histograms, uint32_t digitShift,
+            SourceIterator source, DestIterator dest, const KeyFunction& keyFunction)
+        {
+            partition.ForEachBlock([&](uint32_t block, size_t begin, size_t end)
+            {
+                size_t* counts = histograms.data() + size_t(block) * RadixSize;
+                AZStd::fill(counts, counts + RadixSize, size_t(0));
+                for (size_t index = begin; index < end; ++index)
+                {
+                    ++counts[(keyFunction(source[index]) >> digitShift) & (RadixSize - 1)];
+                }
+            });
+
+            // Turn the counts into the first destination of each digit in each block, digits first then blocks to keep the scatter stable
+            const uint32_t blockCount = partition.GetBlockCount();
+            const size_t count = partition.GetBlockBegin(blockCount);
+            size_t offset = 0;
+            for (uint32_t digit = 0; digit < RadixSize; ++digit)
+            {
+                const size_t digitBegin = offset;
+                for (uint32_t block = 0; block < blockCount; ++block)
+                {
+                    size_t& digitOffset = histograms[size_t(block) * RadixSize + digit];
+                    const size_t digitCount = digitOffset;
+                    digitOffset = offset;
+                    offset += digitCount;
+                }
+                if (offset - digitBegin == count)
+                {
+                    // Every key has this digit, the pass would not reorder anything
+                    return false;
+                }
+            }
+
+            partition.ForEachBlock([&](uint32_t block, size_t begin, size_t end)
+            {
+                size_t* offsets = histograms.data() + size_t(block) * RadixSize;
+                for (size_t index = begin; index < end; ++index)
+                {
+                    dest[offsets[(keyFunction(source[index]) >> digitShift) & (RadixSize - 1)]++] = AZStd::move(source[index]);
+                }
+            });
+            return true;
+        }
+
+        template<typename T>
+        constexpr bool IsRadixSortable = AZStd::is_integral_v<T> && !AZStd::is_same_v<T, bool>;
+
+        // Maps an integer to an unsigned key of the same order
+        template<typename T>
+        struct IntegerRadixKey
+        {
+            using KeyType = AZStd::make_unsigned_t<T>;
+
+            KeyType operator()(T value) const
+            {
+                if constexpr (AZStd::is_signed_v<T>)
+                {
+                    return static_cast<KeyType>(value) ^ (KeyType(1) << (sizeof(T) * 8 - 1));
+                }
+                else
+                {
+                    return value;
+                }
+            }
+        };
+    } // namespace Internal
+
+    template<typename IndexType, typename Function>
+    void parallel_for(IndexType first, IndexType last, const Function& function, const TaskAlgorithmDesc& desc)
+    {
+        parallel_for_range(first, last, [&function](IndexType rangeFirst, IndexType rangeLast)
+        {
+            for (IndexType index = rangeFirst; index < rangeLast; ++index)
+            {
+                function(index);
+            }
+        }, desc);
+    }
+
+    template<typename IndexType, typename Function>
+    void parallel_for_range(IndexType first, IndexType last, const Function& function, const TaskAlgorithmDesc& desc)
+    {
+        if (!(first < last))
+        {
+            return;
+        }
+
+        const Internal::BlockPartition partition(static_cast<size_t>(last - first), desc);
+        partition.ForEachBlock([first, &function](uint32_t, size_t begin, size_t end)
+        {
+            function(static_cast<IndexType>(first + begin), static_cast<IndexType>(first + end));
+        });
+    }
+
+    template<typename RandomAccessIterator, typename Function>
+    void parallel_for_each(RandomAccessIterator first, RandomAccessIterator last, const Function& function, const TaskAlgorithmDesc& desc)
+    {
+        const Internal::BlockPartition partition(static_cast<size_t>(last - first), desc);
+        partition.ForEachBlock([first, &function](uint32_t, size_t begin, size_t end)
+        {
+            for (RandomAccessIterator element = first + begin, blockLast = first + end; element != blockLast; ++element)
+            {
+                function(*element);
+            }
+        });
+    }
+
+    template<typename RandomAccessIterator, typename T, typename BinaryOp>
+    T parallel_reduce(RandomAccessIterator first, RandomAccessIterator last, T init, const BinaryOp& op, const TaskAlgorithmDesc& desc)
+    {
+        return parallel_transform_reduce(first, last, AZStd::move(init), op, [](const auto& element) -> decltype(auto) { return element; }, desc);
+    }
+
+    template<typename RandomAccessIterator, typename T, typename BinaryOp, typename UnaryOp>
+    T parallel_transform_reduce(
+        RandomAccessIterator first, RandomAccessIterator last, T init, const BinaryOp& op, const UnaryOp& transform, const TaskAlgorithmDesc& desc)
+    {
+        if (first == last)
+        {
+            return init;
+        }
+
+        const Internal::BlockPartition partition(static_cast<size_t>(last - first), desc);
+        AZStd::vector<T> partials(partition.GetBlockCount(), init);
+        partition.ForEachBlock([first, &op, &transform, &partials](uint32_t block, size_t begin, size_t end)
+        {
+            T partial = transform(first[begin]);
+            for (size_t index = begin + 1; index < end; ++index)
+            {
+                partial = op(AZStd::move(partial), transform(first[index]));
+            }
+            partials[block] = AZStd::move(partial);
+        });
+
+        for (T& partial : partials)
+        {
+            init = op(AZStd::move(init), AZStd::move(partial));
+        }
+        return init;
+    }
+
+    template<typename RandomAccessIterator, typename Compare>
+    void parallel_sort(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp, const TaskAlgorithmDesc& desc)
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomAccessIterator>::value_type;
+
+        const Internal::BlockPartition partition(static_cast<size_t>(last - first), desc);
+        partition.ForEachBlock([first, &comp](uint32_t, size_t begin, size_t end)
+        {
+            AZStd::stable_sort(first + begin, first + end, comp);
+        });
+
+        const uint32_t blockCount = partition.GetBlockCount();
+        if (blockCount <= 1)
+        {
+            return;
+        }
+
+        // Merge rounds alternate between the buffer and the range
+        AZStd::vector<ValueType> buffer(AZStd::make_move_iterator(first), AZStd::make_move_iterator(last));
+        bool sortedInBuffer = true;
+        for (uint32_t width = 1; width < blockCount; width *= 2)
+        {
+            if (sortedInBuffer)
+            {
+                Internal::MergeRound(partition, width, buffer.begin(), first, comp);
+            }
+            else
+            {
+                Internal::MergeRound(partition, width, first, buffer.begin(), comp);
+            }
+            sortedInBuffer = !sortedInBuffer;
+        }
+
+        if (sortedInBuffer)
+        {
+            Internal::MoveBlocks(partition, buffer.begin(), first);
+        }
+    }
+
+    template<typename RandomAccessIterator>
+    void parallel_sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomAccessIterator>::value_type;
+        if constexpr (Internal::IsRadixSortable<ValueType>)
+        {
+            parallel_radix_sort(first, last, Internal::IntegerRadixKey<ValueType>{});
+        }
+        else
+        {
+            parallel_sort(first, last, AZStd::less<ValueType>{});
+        }
+    }
+
+    template<typename RandomAccessIterator, typename KeyFunction>
+    void parallel_radix_sort(RandomAccessIterator first, RandomAccessIterator last, const KeyFunction& keyFunction, const TaskAlgorithmDesc& desc)
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomAccessIterator>::value_type;
+        using KeyType = AZStd::decay_t<decltype(keyFunction(*first))>;
+        static_assert(AZStd::is_integral_v<KeyType> && AZStd::is_unsigned_v<KeyType>, "Radix sort keys must be unsigned integers");
+
+        const size_t count = static_cast<size_t>(last - first);
+        if (count <= Internal::RadixSortMinCount)
+        {
+            AZStd::stable_sort(first, last, [&keyFunction](const ValueType& lhs, const ValueType& rhs)
+            {
+                return keyFunction(lhs) < keyFunction(rhs);
+            });
+            return;
+        }
+
+        // Digits that are the same for every key don't need a pass, which is common for keys much narrower than their type
+        const KeyType firstKey = keyFunction(*first);
+        const KeyType varyingBits = parallel_transform_reduce(first, last, KeyType(0),
+            [](KeyType lhs, KeyType rhs) { return static_cast<KeyType>(lhs | rhs); },
+            [&keyFunction, firstKey](const ValueType& value) { return static_cast<KeyType>(keyFunction(value) ^ firstKey); }, desc);
+        if (varyingBits == 0)
+        {
+            return;
+        }
+
+        // Passes alternate between the buffer and the range
+        const Internal::BlockPartition partition(count, desc);
+        AZStd::vector<size_t> histograms(size_t(partition.GetBlockCount()) * Internal::RadixSize);
+        AZStd::vector<ValueType> buffer(AZStd::make_move_iterator(first), AZStd::make_move_iterator(last));
+        bool sortedInBuffer = true;
+        for (uint32_t digitShift = 0; digitShift < sizeof(KeyType) * 8; digitShift += Internal::RadixBits)
+        {
+            if (((varyingBits >> digitShift) & (Internal::RadixSize - 1)) == 0)
+            {
+                continue;
+            }
+            const bool isReordered = sortedInBuffer
+                ? Internal::RadixPass(partition, histograms, digitShift, buffer.begin(), first, keyFunction)
+                : Internal::RadixPass(partition, histograms, digitShift, first, buffer.begin(), keyFunction);
+            if (isReordered)
+            {
+                sortedInBuffer = !sortedInBuffer;
+            }
+        }
+
+        if (sortedInBuffer)
+        {
+            Internal::MoveBlocks(partition, buffer.begin(), first);
+        }
+    }
+
+    template<typename RandomAccessIterator, typename OutputIterator, typename BinaryOp>
+    void parallel_inclusive_scan(
+        RandomAccessIterator first, RandomAccessIterator last, OutputIterator output, const BinaryOp& op, const TaskAlgorithmDesc& desc)
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomAccessIterator>::value_type;
+        if (first == last)
+        {
+            return;
+        }
+
+        // Reduce every block but the last, prefix the block sums, then scan every block from its prefix
+        const Internal::BlockPartition partition(static_cast<size_t>(last - first), desc);
+        const uint32_t blockCount = partition.GetBlockCount();
+        AZStd::vector<ValueType> blockPrefixes(blockCount, *first);
+        if (blockCount > 1)
+        {
+            partition.Dispatch(blockCount - 1, [&](uint32_t block)
+            {
+                const size_t end = partition.GetBlockBegin(block + 1);
+                ValueType sum = first[partition.GetBlockBegin(block)];
+                for (size_t index = partition.GetBlockBegin(block) + 1; index < end; ++index)
+                {
+                    sum = op(AZStd::move(sum), first[index]);
+                }
+                blockPrefixes[block + 1] = AZStd::move(sum);
+            });
+            for (uint32_t block = 2; block < blockCount; ++block)
+            {
+                blockPrefixes[block] = op(blockPrefixes[block - 1], blockPrefixes[block]);
+            }
+        }
+
+        partition.ForEachBlock([&](uint32_t block, size_t begin, size_t end)
+        {
+            ValueType sum = (block == 0) ? ValueType(first[begin]) : op(blockPrefixes[block], first[begin]);
+            output[begin] = sum;
+            for (size_t index = begin + 1; index < end; ++index)
+            {
+                sum = op(AZStd::move(sum), first[index]);
+                output[index] = sum;
+            }
+        });
+    }
+
+    template<typename RandomAccessIterator, typename OutputIterator, typename T, typename BinaryOp>
+    void parallel_exclusive_scan(
+        RandomAccessIterator first, RandomAccessIterator last, OutputIterator output, T init, const BinaryOp& op, const TaskAlgorithmDesc& desc)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        // Reduce every block but the last, prefix the block sums, then scan every block from its prefix
+        const Internal::BlockPartition partition(static_cast<size_t>(last - first), desc);
+        const uint32_t blockCount = partition.GetBlockCount();
+        AZStd::vector<T> blockPrefixes(blockCount, init);
+        if (blockCount > 1)
+        {
+            partition.Dispatch(blockCount - 1, [&](uint32_t block)
+            {
+                const size_t end = partition.GetBlockBegin(block + 1);
+                T sum = first[partition.GetBlockBegin(block)];
+                for (size_t index = partition.GetBlockBegin(block) + 1; index < end; ++index)
+                {
+                    sum = op(AZStd::move(sum), first[index]);
+                }
+                blockPrefixes[block + 1] = AZStd::move(sum);
+            });
+            for (uint32_t block = 1; block < blockCount; ++block)
+            {
+                blockPrefixes[block] = op(blockPrefixes[block - 1], blockPrefixes[block]);
+            }
+        }
+
+        partition.ForEachBlock([&](uint32_t block, size_t begin, size_t end)
+        {
+            T sum = blockPrefixes[block];
+            for (size_t index = begin; index < end; ++index)
+            {
+                // Read the input before writing the output, they may be the same element
+                T next = op(sum, first[index]);
+                output[index] = AZStd::move(sum);
+                sum = AZStd::move(next);
+            }
+        });
+    }
+
+    template<typename RandomAccessIterator, typename Predicate>
+    RandomAccessIterator parallel_stable_partition(
+        RandomAccessIterator first, RandomAccessIterator last, const Predicate& pred, const TaskAlgorithmDesc& desc)
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomAccessIterator>::value_type;
+        const size_t count = static_cast<size_t>(last - first);
+
+        // Evaluate the predicate once per element while counting the matches of every block
+        const Internal::BlockPartition partition(count, desc);
+        const uint32_t blockCount = partition.GetBlockCount();
+        AZStd::vector<uint8_t> matches(count);
+        AZStd::vector<size_t> matchOffsets(blockCount + 1, 0);
+        partition.ForEachBlock([&](uint32_t block, size_t begin, size_t end)
+        {
+            size_t matchCount = 0;
+            for (size_t index = begin; index < end; ++index)
+            {
+                matches[index] = pred(first[index]) ? 1 : 0;
+                matchCount += matches[index];
+            }
+            matchOffsets[block + 1] = matchCount;
+        });
+
+        for (uint32_t block = 1; block <= blockCount; ++block)
+        {
+            matchOffsets[block] += matchOffsets[block - 1];
+        }
+        const size_t totalMatchCount = matchOffsets[blockCount];
+        if ((totalMatchCount == 0) || (totalMatchCount == count))
+        {
+            return first + totalMatchCount;
+        }
+
+        AZStd::vector<ValueType> buffer(AZStd::make_move_iterator(first), AZStd::make_move_iterator(last));
+        partition.ForEachBlock([&](uint32_t block, size_t begin, size_t end)
+        {
+            // The elements that don't match before this block are those that precede it minus those that match
+            size_t matchIndex = matchOffsets[block];
+            size_t mismatchIndex = totalMatchCount + (begin - matchOffsets[block]);
+            for (size_t index = begin; index < end; ++index)
+            {
+                first[matches[index] ? matchIndex++ : mismatchIndex++] = AZStd::move(buffer[index]);
+            }
+        });
+        return first + totalMatchCount;
+    }
+} // namespace AZ::TaskAlgorithms
@@ -42,8 +42,9 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
-        // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
-        // corresponding to a set bit. 0 is synonymous with all bits set
+        // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on the workers of the
+        // TaskExecutor corresponding to a set bit, which are the cores of the same index when the workers
+        // are affinitized. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
     };
 }
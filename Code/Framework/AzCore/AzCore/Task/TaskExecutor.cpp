@@ -27,29 +27,33 @@ namespace AZ
     {
         CompiledTaskGraph::CompiledTaskGraph(
             AZStd::vector<Task>&& tasks,
-            AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>>& links,
-            size_t linkCount,
+            const AZStd::vector<TaskLink>& links,
             TaskGraph* parent)
             : m_parent{ parent }
         {
-            m_tasks = AZStd::move(tasks);
-            m_successors.resize(linkCount);
+            Compile(AZStd::move(tasks), links);
+        }
 
-            Task** cursor = m_successors.data();
+        void CompiledTaskGraph::Compile(AZStd::vector<Task>&& tasks, const AZStd::vector<TaskLink>& links)
+        {
+            m_tasks = AZStd::move(tasks);
+            m_successors.resize(links.size());
 
-            for (uint32_t i = 0; i != m_tasks.size(); ++i)
+            // Point each successor offset at the end of the task's range in the successor buffer, then fill the
+            // ranges back to front so that successors keep the order in which the links were recorded
+            uint32_t offset = 0;
+            for (Task& task : m_tasks)
             {
-                Task& task = m_tasks[i];
                 task.m_graph = this;
-                task.m_successorOffset = static_cast<uint32_t>(cursor - m_successors.data());
-                cursor += task.m_outboundLinkCount;
-
-                AZ_Assert(task.m_outboundLinkCount == links[i].size(), "Task outbound link information mismatch");
+                offset += task.m_outboundLinkCount;
+                task.m_successorOffset = offset;
+            }
+            AZ_Assert(offset == links.size(), "Task outbound link information mismatch");
 
-                for (uint32_t j = 0; j != task.m_outboundLinkCount; ++j)
-                {
-                    m_successors[static_cast<size_t>(task.m_successorOffset) + j] = &m_tasks[links[i][j]];
-                }
+            for (auto it = links.rbegin(); it != links.rend(); ++it)
+            {
+                Task& task = m_tasks[it->m_predecessor];
+                m_successors[--task.m_successorOffset] = &m_tasks[it->m_successor];
             }
 
             // TODO: Check for dependency cycles
@@ -112,7 +116,9 @@ namespace AZ
             TaskQueue& operator=(const TaskQueue&) = delete;
 
             void Enqueue(Task* task);
+            // Dequeue the highest priority task available
             Task* TryDequeue();
+            Task* TryDequeue(uint8_t priority);
 
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
@@ -161,29 +167,125 @@ namespace AZ
 
         Task* TaskQueue::TryDequeue()
         {
-            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                if (Task* task = TryDequeue(priority))
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
-                    {
-                        // Queue empty
-                        break;
-                    }
-                    else
+                    return task;
+                }
+            }
+
+            return nullptr;
+        }
+
+        Task* TaskQueue::TryDequeue(uint8_t priority)
+        {
+            QueueStatus& status = m_status[priority];
+            while (true)
+            {
+                uint16_t head = status.head.load();
+                uint16_t tail = status.tail.load();
+                if (head == tail)
+                {
+                    // Queue empty
+                    return nullptr;
+                }
+                else
+                {
+                    Task* task = m_queues[priority][head];
+                    if (status.head.compare_exchange_weak(head, head + 1))
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
-                        {
-                            return task;
-                        }
+                        return task;
                     }
                 }
             }
+        }
+
+        // Fixed capacity Chase-Lev work-stealing deque (see "Dynamic Circular Work-Stealing Deque", Chase and Lev 2005,
+        // and "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al. 2013). The owning worker pushes and
+        // pops at the bottom without contention, while other workers steal from the top. A push fails if the deque is
+        // full, in which case the caller is expected to fall back to the shared queues.
+        class TaskDeque final
+        {
+        public:
+            constexpr static int64_t Capacity = 1 << 12;
+
+            TaskDeque() = default;
+            TaskDeque(const TaskDeque&) = delete;
+            TaskDeque& operator=(const TaskDeque&) = delete;
+
+            // Owner only
+            bool Push(Task* task);
+            // Owner only
+            Task* Pop();
+            // Any thread
+            Task* Steal();
+
+        private:
+            constexpr static int64_t Mask = Capacity - 1;
 
+            // Top and bottom are kept on separate cache lines to avoid false sharing between the owner and thieves
+            alignas(64) AZStd::atomic<int64_t> m_top = 0;
+            alignas(64) AZStd::atomic<int64_t> m_bottom = 0;
+            AZStd::atomic<Task*> m_buffer[Capacity] = {};
+        };
+
+        bool TaskDeque::Push(Task* task)
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            if (bottom - top >= Capacity)
+            {
+                return false;
+            }
+
+            m_buffer[bottom & Mask].store(task, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        Task* TaskDeque::Pop()
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Deque empty, restore the bottom index
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                return nullptr;
+            }
+
+            Task* task = m_buffer[bottom & Mask].load(AZStd::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // Last element, race against any thieves for it
+                if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    task = nullptr;
+                }
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        Task* TaskDeque::Steal()
+        {
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+            if (top < bottom)
+            {
+                Task* task = m_buffer[top & Mask].load(AZStd::memory_order_relaxed);
+                if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    return task;
+                }
+            }
             return nullptr;
         }
 
@@ -195,11 +297,12 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 AZStd::string threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
                 desc.m_name = threadName.c_str();
-                if (affinitize)
+                if (affinitize && id < sizeof(desc.m_cpuId) * 8 - 1)
                 {
                     desc.m_cpuId = 1 << id;
                 }
@@ -244,50 +347,136 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Push a task onto the deque owned by this worker. Must be called from this worker's thread.
+            bool TryEnqueueLocal(Task* task)
+            {
+                return Accepts(*task) && m_deques[task->GetPriorityNumber()].Push(task);
+            }
+
+            // Returns false if the cpu mask of the task excludes this worker
+            bool Accepts(const Task& task) const
+            {
+                const uint32_t workerMask = m_executor->GetWorkerMask(task);
+                return workerMask == 0 || (m_id < 32 && (workerMask & (1u << m_id)) != 0);
+            }
+
+            // Wake this worker if it is waiting for work, returns false if the worker was already awake
+            bool TryWake()
+            {
+                bool idle = true;
+                if (m_idle.compare_exchange_strong(idle, false))
+                {
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
+
         private:
             void Run()
             {
                 while (m_active)
                 {
+                    m_idle.store(true, AZStd::memory_order_release);
                     m_semaphore.acquire();
+                    m_idle.store(false, AZStd::memory_order_release);
 
                     if (!m_active)
                     {
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
+                    Task* task = TryAcquireTask();
                     while (task)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        Execute(task);
+                        task = TryAcquireTask();
+                    }
+                }
+            }
+
+            Task* TryAcquireTask()
+            {
+                if (!m_executor->m_workStealing)
+                {
+                    return m_queue.TryDequeue();
+                }
+
+                // Local work first, in priority order
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_deques[priority].Pop())
+                    {
+                        return task;
+                    }
+                    if (Task* task = m_queue.TryDequeue(priority))
+                    {
+                        return task;
+                    }
+                }
+
+                // Steal from the other workers, starting with our neighbor to spread thieves across victims
+                const uint32_t threadCount = m_executor->m_threadCount;
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    for (uint32_t i = 1; i < threadCount; ++i)
+                    {
+                        TaskWorker& victim = m_executor->m_workers[(m_id + i) % threadCount];
+                        if (Task* task = victim.m_deques[priority].Steal())
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
+                            if (Accepts(*task))
                             {
-                                m_executor->Submit(*successor);
+                                return task;
                             }
+                            // Tasks restricted to other workers go back to the worker they were taken from
+                            victim.Enqueue(task);
                         }
-
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+                        else if (Task* queuedTask = victim.m_queue.TryDequeue(priority))
                         {
-                            m_executor->ReleaseGraph();
+                            if (Accepts(*queuedTask))
+                            {
+                                return queuedTask;
+                            }
+                            victim.Enqueue(queuedTask);
                         }
+                    }
+                }
 
-                        task = m_queue.TryDequeue();
+                return nullptr;
+            }
+
+            void Execute(Task* task)
+            {
+                task->Invoke();
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
+                    {
+                        m_executor->Submit(*successor);
                     }
                 }
+
+                bool isRetained = task->m_graph->m_parent != nullptr;
+                if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+                }
             }
 
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            // Set while the worker is blocked on its semaphore waiting for work
+            AZStd::atomic<bool> m_idle = false;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
+            uint32_t m_id = 0;
             TaskQueue m_queue;
+            // Only used in work-stealing mode
+            TaskDeque m_deques[TaskQueue::PriorityLevelCount];
             friend class ::AZ::TaskExecutor;
         };
 
@@ -306,6 +495,16 @@ namespace AZ
         return **s_executor;
     }
 
+    TaskExecutor* TaskExecutor::TryGetInstance()
+    {
+        if (!s_executor)
+        {
+            s_executor = AZ::Environment::FindVariable<TaskExecutor*>(s_executorName);
+        }
+
+        return s_executor ? *s_executor : nullptr;
+    }
+
     void TaskExecutor::SetInstance(TaskExecutor* executor)
     {
         if (!executor) // allow unsetting the executor
@@ -319,18 +518,24 @@ namespace AZ
     }
 
     TaskExecutor::TaskExecutor(uint32_t threadCount)
+        : TaskExecutor(TaskExecutorDesc{ threadCount })
     {
-        // TODO: Configure thread count + affinity based on configuration
-        m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
+    }
 
-        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
+    TaskExecutor::TaskExecutor(const TaskExecutorDesc& desc)
+    {
+        // TODO: Configure affinity based on core topology
+        m_threadCount = desc.m_threadCount == 0 ? AZStd::thread::hardware_concurrency() : desc.m_threadCount;
+        m_workStealing = desc.m_workStealing;
+
+        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker), alignof(Internal::TaskWorker)));
 
         AZStd::semaphore initSemaphore;
 
         for (uint32_t i = 0; i != m_threadCount; ++i)
         {
             new (m_workers + i) Internal::TaskWorker{};
-            m_workers[i].Spawn(*this, i, initSemaphore, false);
+            m_workers[i].Spawn(*this, i, initSemaphore, desc.m_affinitizeWorkers);
         }
 
         for (size_t i = 0; i != m_threadCount; ++i)
@@ -381,9 +586,35 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
+        if (m_workStealing)
+        {
+            // Tasks made ready on a worker thread stay on that worker (they likely touch the same data as their
+            // predecessor), other workers are woken so they can steal if there is more work than one worker can handle
+            if (Internal::TaskWorker* worker = GetTaskWorker(); worker && worker->TryEnqueueLocal(&task))
+            {
+                WakeIdleWorker(worker);
+                return;
+            }
+        }
+
         // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
+        // Some heuristics on core availability will help distribute work more effectively
+        if (const uint32_t workerMask = GetWorkerMask(task); workerMask != 0)
+        {
+            // Only the workers of the mask can take the task. If all of them are waiting on a graph, the task
+            // goes to any other worker rather than waiting for one of them.
+            const uint32_t start = ++m_lastSubmission;
+            for (uint32_t i = 0; i != m_threadCount; ++i)
+            {
+                const uint32_t nextWorker = (start + i) % m_threadCount;
+                if (nextWorker < 32 && (workerMask & (1u << nextWorker)) != 0 && m_workers[nextWorker].Enabled())
+                {
+                    m_workers[nextWorker].Enqueue(&task);
+                    return;
+                }
+            }
+        }
+
         uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
         while (!m_workers[nextWorker].Enabled())
         {
@@ -395,6 +626,36 @@ namespace AZ
         m_workers[nextWorker].Enqueue(&task);
     }
 
+    uint32_t TaskExecutor::GetThreadCount() const
+    {
+        return m_threadCount;
+    }
+
+    bool TaskExecutor::IsTaskWorkerThread()
+    {
+        return GetTaskWorker() != nullptr;
+    }
+
+    uint32_t TaskExecutor::GetWorkerMask(const Internal::Task& task) const
+    {
+        // Workers past the bits of the mask can only take unrestricted tasks
+        const uint32_t allWorkers = m_threadCount < 32 ? (1u << m_threadCount) - 1 : 0xffffffffu;
+        return task.GetCpuMask() & allWorkers;
+    }
+
+    void TaskExecutor::WakeIdleWorker(Internal::TaskWorker* submitter)
+    {
+        uint32_t start = m_lastSubmission.load(AZStd::memory_order_relaxed);
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            Internal::TaskWorker& worker = m_workers[(start + i) % m_threadCount];
+            if (&worker != submitter && worker.Enabled() && worker.TryWake())
+            {
+                return;
+            }
+        }
+    }
+
     void TaskExecutor::ReleaseGraph()
     {
         --m_graphsRemaining;
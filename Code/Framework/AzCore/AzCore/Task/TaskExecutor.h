@@ -10,7 +10,6 @@
 
 #include <AzCore/Task/Internal/Task.h>
 #include <AzCore/Task/TaskDescriptor.h>
-#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -30,10 +29,14 @@ namespace AZ
 
             CompiledTaskGraph(
                 AZStd::vector<Task>&& tasks,
-                AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>>& links,
-                size_t linkCount,
+                const AZStd::vector<TaskLink>& links,
                 TaskGraph* parent);
 
+            // Rebuild the graph in place from a new set of tasks and links. Storage of the previous compilation
+            // is reused, so recompiling a retained graph of similar shape does not allocate.
+            // NOTE: The graph must not be in flight
+            void Compile(AZStd::vector<Task>&& tasks, const AZStd::vector<TaskLink>& links);
+
             AZStd::vector<Task>& Tasks() noexcept
             {
                 return m_tasks;
@@ -58,6 +61,20 @@ namespace AZ
         class TaskWorker;
     } // namespace Internal
 
+    struct TaskExecutorDesc
+    {
+        // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
+        uint32_t m_threadCount = 0;
+
+        // When enabled, tasks made ready by a worker thread (e.g. graph successors) are pushed to a deque
+        // owned by that worker instead of being distributed round-robin, and workers that run out of work
+        // steal from the deques and queues of other workers, highest priority first.
+        bool m_workStealing = false;
+
+        // Pin each worker thread to a single logical core
+        bool m_affinitizeWorkers = false;
+    };
+
     class TaskExecutor final
     {
     public:
@@ -65,11 +82,15 @@ namespace AZ
 
         static TaskExecutor& Instance();
 
+        // Returns the executor set by SetInstance, or nullptr if there is none
+        static TaskExecutor* TryGetInstance();
+
         // Invoked by a system component on program launch
         static void SetInstance(TaskExecutor* executor);
 
         // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
         explicit TaskExecutor(uint32_t threadCount = 0);
+        explicit TaskExecutor(const TaskExecutorDesc& desc);
         ~TaskExecutor();
 
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
@@ -78,6 +99,11 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        uint32_t GetThreadCount() const;
+
+        // Returns true if called from one of the worker threads of this executor, where waiting on a TaskGraphEvent is unsupported
+        bool IsTaskWorkerThread();
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -85,9 +111,13 @@ namespace AZ
         Internal::TaskWorker* GetTaskWorker();
         void ReleaseGraph();
         void ReactivateTaskWorker();
+        void WakeIdleWorker(Internal::TaskWorker* submitter);
+        // Restricts a task cpu mask to the workers of this executor, 0 if the task can run on any of them
+        uint32_t GetWorkerMask(const Internal::Task& task) const;
 
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
+        bool m_workStealing = false;
         AZStd::atomic<uint32_t> m_lastSubmission;
         AZStd::atomic<uint64_t> m_graphsRemaining;
     };
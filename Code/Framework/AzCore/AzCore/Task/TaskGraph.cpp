@@ -67,9 +67,7 @@ namespace AZ
         // Increment inbound/outbound edge counts
         m_parent.m_tasks[m_index].Link(m_parent.m_tasks[comesAfter.m_index]);
 
-        m_parent.m_links[m_index].emplace_back(comesAfter.m_index);
-
-        ++m_parent.m_linkCount;
+        m_parent.m_links.push_back({ m_index, comesAfter.m_index });
     }
 
     TaskGraph::~TaskGraph()
@@ -82,6 +80,11 @@ namespace AZ
                 azdestroy(m_compiledTaskGraph);
             }
         }
+
+        if (m_recycledTaskGraph)
+        {
+            azdestroy(m_recycledTaskGraph);
+        }
     }
 
     void TaskGraph::Reset()
@@ -89,12 +92,20 @@ namespace AZ
         AZ_Assert(!m_submitted, "Cannot reset a job graph while it is in flight");
         if (m_compiledTaskGraph)
         {
-            azdestroy(m_compiledTaskGraph);
+            if (m_retained)
+            {
+                // Take back the task storage and keep the compiled graph around to be recompiled in place
+                m_tasks = AZStd::move(m_compiledTaskGraph->m_tasks);
+                m_recycledTaskGraph = m_compiledTaskGraph;
+            }
+            else
+            {
+                azdestroy(m_compiledTaskGraph);
+            }
             m_compiledTaskGraph = nullptr;
         }
         m_tasks.clear();
         m_links.clear();
-        m_linkCount = 0;
     }
 
     void TaskGraph::Submit(TaskGraphEvent* waitEvent)
@@ -106,7 +117,22 @@ namespace AZ
     {
         if (!m_compiledTaskGraph)
         {
-            m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr);
+            if (m_recycledTaskGraph && m_retained)
+            {
+                m_recycledTaskGraph->Compile(AZStd::move(m_tasks), m_links);
+                m_compiledTaskGraph = m_recycledTaskGraph;
+                m_recycledTaskGraph = nullptr;
+            }
+            else
+            {
+                if (m_recycledTaskGraph)
+                {
+                    // The graph was detached after being reset, its previous compiled graph can't be reused
+                    azdestroy(m_recycledTaskGraph);
+                    m_recycledTaskGraph = nullptr;
+                }
+                m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_retained ? this : nullptr);
+            }
         }
 
         m_compiledTaskGraph->m_waitEvent = waitEvent;
@@ -117,13 +143,15 @@ namespace AZ
             m_compiledTaskGraph->m_tasks[i].Init();
         }
 
-        executor.Submit(*m_compiledTaskGraph, waitEvent);
-
         if (m_retained)
         {
+            // Flag the graph as in flight before any of its tasks can run, the last task to finish clears it
             m_submitted = true;
         }
-        else
+
+        executor.Submit(*m_compiledTaskGraph, waitEvent);
+
+        if (!m_retained)
         {
             m_compiledTaskGraph = nullptr;
             Reset();
@@ -14,7 +14,6 @@
 #include <AzCore/Task/TaskDescriptor.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
-#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/RTTI/RTTI.h>
 
@@ -101,13 +100,18 @@ namespace AZ
     public:
         ~TaskGraph();
 
-        // Reset the state of the task graph to begin recording tasks and edges again
+        // Reset the state of the task graph to begin recording tasks and edges again. A retained graph keeps
+        // the storage of its compiled form, so a graph rebuilt every frame with a similar shape does not need
+        // to allocate or re-link from scratch when it is submitted again.
         // NOTE: Graph must be in a "settled" state (cannot be in-flight)
         void Reset();
         
         // Returns false if 1 or more tasks have been added to the graph
         bool IsEmpty();
 
+        // Returns true if a retained graph was submitted and has not yet finished executing
+        bool IsInFlight() const;
+
         // Add a task to the graph, retrieiving a token that can be used to express dependencies
         // between tasks. The first argument specifies the TaskKind, used for tracking the task.
         // NOTE: This operation is invalid if the graph is in-flight
@@ -155,12 +159,14 @@ namespace AZ
 
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
+        // Compiled graph of a retained TaskGraph that was reset, recompiled in place on the next submission
+        Internal::CompiledTaskGraph* m_recycledTaskGraph = nullptr;
+
         AZStd::vector<Internal::Task> m_tasks;
 
-        // Task index |-> Dependent task indices
-        AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>> m_links;
+        // Links in the order they were recorded
+        AZStd::vector<Internal::TaskLink> m_links;
 
-        uint32_t m_linkCount = 0;
         bool m_retained = true;
         AZStd::atomic<bool> m_submitted = false;
     };
@@ -54,6 +54,11 @@ namespace AZ
         return m_tasks.empty();
     }
 
+    inline bool TaskGraph::IsInFlight() const
+    {
+        return m_submitted;
+    }
+
     inline void TaskGraph::Detach()
     {
         m_retained = false;
@@ -19,6 +19,8 @@ AZ_CVAR(bool, cl_activateTaskGraph, false, nullptr, AZ::ConsoleFunctorFlags::Nul
 AZ_CVAR(float, cl_taskGraphThreadsConcurrencyRatio, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph calculate the number of worker threads to spawn by scaling the number of hw threads, value is clamped between 0.0f and 1.0f");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph number of hardware threads that are reserved for O3DE system threads. Value is clamped between 0 and the number of logical cores in the system");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsMinNumber, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph minimum number of worker threads to create after scaling the number of hw threads");
+AZ_CVAR(bool, cl_taskGraphWorkStealing, false, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph workers keep tasks they make ready in a local deque and steal work from other workers when idle (read on activation)");
+AZ_CVAR(bool, cl_taskGraphAffinitizeWorkers, false, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph pins each worker thread to a single logical core (read on activation)");
 
 static constexpr uint32_t TaskExecutorServiceCrc = AZ_CRC_CE("TaskExecutorService");
 
@@ -36,7 +38,11 @@ namespace AZ
             const uint32_t numberOfWorkerThreads = Threading::CalcNumWorkerThreads(cl_taskGraphThreadsConcurrencyRatio, cl_taskGraphThreadsMinNumber, cl_taskGraphThreadsNumReserved);
         #endif // (AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS)
             Interface<TaskGraphActiveInterface>::Register(this); // small window that another thread can try to use taskgraph between this line and the set instance.
-            m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
+            TaskExecutorDesc executorDesc;
+            executorDesc.m_threadCount = numberOfWorkerThreads;
+            executorDesc.m_workStealing = cl_taskGraphWorkStealing;
+            executorDesc.m_affinitizeWorkers = cl_taskGraphAffinitizeWorkers;
+            m_taskExecutor = aznew TaskExecutor(executorDesc);
             TaskExecutor::SetInstance(m_taskExecutor);
         }
     }
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/OSAllocator_Platform.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ
+{
+    //! @class ThreadSafeSnapshot
+    //! Wraps an object in a thread-safe interface where the reads don't take any lock.
+    //! The object is stored as immutable snapshots, a read loads the pointer to the current snapshot and an assignment
+    //! publishes a new snapshot under a writer lock. The replaced snapshots are retired and only released by ReclaimRetired,
+    //! which must be called from a point where no reader still uses a snapshot retired before the previous call,
+    //! like once per frame for readers that don't keep references across frames.
+    template <typename _TYPE>
+    class ThreadSafeSnapshot
+    {
+    public:
+
+        ThreadSafeSnapshot();
+        ThreadSafeSnapshot(const _TYPE& rhs);
+        ~ThreadSafeSnapshot();
+
+        //! Publishes a new snapshot of the object under the writer lock.
+        //! @param value the new value to set the object instance to
+        void operator =(const _TYPE& value);
+
+        //! Implicit conversion to underlying type.
+        //! @return a copy of the current snapshot of the object
+        operator _TYPE() const;
+
+        //! Returns the current snapshot without copying it, this costs a single atomic load.
+        //! @return a reference to the current snapshot, valid until the second ReclaimRetired call that follows an assignment
+        const _TYPE& Get() const;
+
+        //! Releases the snapshots retired before the previous call and keeps the ones retired since for the next call.
+        void ReclaimRetired();
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(ThreadSafeSnapshot);
+
+        struct Snapshot
+        {
+            Snapshot() = default;
+            Snapshot(const _TYPE& value);
+
+            _TYPE m_object{};
+            Snapshot* m_nextRetired = nullptr;
+        };
+
+        void ReleaseSnapshots(Snapshot* head);
+
+        // The initial snapshot is stored inline as cvars are constructed before the allocators exist,
+        // the following snapshots are allocated from the OS heap for the same reason.
+        Snapshot m_initial;
+        AZStd::atomic<const Snapshot*> m_current;
+        AZStd::mutex m_writeMutex;
+        Snapshot* m_retired = nullptr;
+        Snapshot* m_retiredPreviously = nullptr;
+    };
+}
+
+#include <AzCore/Threading/ThreadSafeSnapshot.inl>
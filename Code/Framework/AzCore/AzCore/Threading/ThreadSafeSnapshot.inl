@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <new>
+
+namespace AZ
+{
+    template <typename _TYPE>
+    inline ThreadSafeSnapshot<_TYPE>::Snapshot::Snapshot(const _TYPE& value)
+        : m_object(value)
+    {
+        ;
+    }
+
+    template <typename _TYPE>
+    inline ThreadSafeSnapshot<_TYPE>::ThreadSafeSnapshot()
+        : m_current(&m_initial)
+    {
+        ;
+    }
+
+    template <typename _TYPE>
+    inline ThreadSafeSnapshot<_TYPE>::ThreadSafeSnapshot(const _TYPE& rhs)
+        : m_initial(rhs)
+        , m_current(&m_initial)
+    {
+        ;
+    }
+
+    template <typename _TYPE>
+    inline ThreadSafeSnapshot<_TYPE>::~ThreadSafeSnapshot()
+    {
+        const Snapshot* current = m_current.load(AZStd::memory_order_relaxed);
+        if (current != &m_initial)
+        {
+            ReleaseSnapshots(const_cast<Snapshot*>(current));
+        }
+        ReleaseSnapshots(m_retired);
+        ReleaseSnapshots(m_retiredPreviously);
+    }
+
+    template <typename _TYPE>
+    inline void ThreadSafeSnapshot<_TYPE>::operator =(const _TYPE& value)
+    {
+        Snapshot* snapshot = new (AZ_OS_MALLOC(sizeof(Snapshot), alignof(Snapshot))) Snapshot(value);
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_writeMutex);
+        const Snapshot* previous = m_current.exchange(snapshot, AZStd::memory_order_acq_rel);
+        if (previous != &m_initial)
+        {
+            Snapshot* retired = const_cast<Snapshot*>(previous);
+            retired->m_nextRetired = m_retired;
+            m_retired = retired;
+        }
+    }
+
+    template <typename _TYPE>
+    inline ThreadSafeSnapshot<_TYPE>::operator _TYPE() const
+    {
+        return Get();
+    }
+
+    template <typename _TYPE>
+    inline const _TYPE& ThreadSafeSnapshot<_TYPE>::Get() const
+    {
+        return m_current.load(AZStd::memory_order_acquire)->m_object;
+    }
+
+    template <typename _TYPE>
+    inline void ThreadSafeSnapshot<_TYPE>::ReclaimRetired()
+    {
+        Snapshot* released = nullptr;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_writeMutex);
+            released = m_retiredPreviously;
+            m_retiredPreviously = m_retired;
+            m_retired = nullptr;
+        }
+        ReleaseSnapshots(released);
+    }
+
+    template <typename _TYPE>
+    inline void ThreadSafeSnapshot<_TYPE>::ReleaseSnapshots(Snapshot* head)
+    {
+        while (head != nullptr)
+        {
+            Snapshot* next = head->m_nextRetired;
+            head->~Snapshot();
+            AZ_OS_FREE(head);
+            head = next;
+        }
+    }
+}
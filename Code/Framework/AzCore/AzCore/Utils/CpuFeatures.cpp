@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Utils/CpuFeatures.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#if defined(AZ_COMPILER_MSVC)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace AZ::Platform
+{
+    namespace
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        struct CpuidRegisters
+        {
+            u32 m_eax = 0;
+            u32 m_ebx = 0;
+            u32 m_ecx = 0;
+            u32 m_edx = 0;
+        };
+
+        CpuidRegisters Cpuid(u32 leaf, u32 subleaf)
+        {
+            CpuidRegisters registers;
+#if defined(AZ_COMPILER_MSVC)
+            int values[4];
+            __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+            registers = { static_cast<u32>(values[0]), static_cast<u32>(values[1]), static_cast<u32>(values[2]),
+                          static_cast<u32>(values[3]) };
+#else
+            __cpuid_count(leaf, subleaf, registers.m_eax, registers.m_ebx, registers.m_ecx, registers.m_edx);
+#endif
+            return registers;
+        }
+
+        // Returns the register states that the operating system saves on the context switches.
+        u64 GetEnabledRegisterStates()
+        {
+#if defined(AZ_COMPILER_MSVC)
+            return _xgetbv(0);
+#else
+            u32 eax, edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<u64>(edx) << 32) | eax;
+#endif
+        }
+
+        CpuFeatureMask DetectCpuFeatures()
+        {
+            CpuFeatureMask features = 0;
+            const u32 maxLeaf = Cpuid(0, 0).m_eax;
+            if (maxLeaf < 1)
+            {
+                return features;
+            }
+
+            const CpuidRegisters leaf1 = Cpuid(1, 0);
+            features |= (leaf1.m_ecx & (1 << 20)) ? CpuFeatureBit(CpuFeature::Sse42) : 0;
+            features |= (leaf1.m_ecx & (1 << 1)) ? CpuFeatureBit(CpuFeature::Pclmul) : 0;
+
+            // The ymm and zmm registers can only be used if the operating system saves them.
+            constexpr u32 OsXSaveBit = 1 << 27;
+            const u64 registerStates = (leaf1.m_ecx & OsXSaveBit) ? GetEnabledRegisterStates() : 0;
+            constexpr u64 AvxStates = 0x6; // xmm and ymm
+            constexpr u64 Avx512States = 0xe6; // xmm, ymm, opmask and zmm
+            const bool avxEnabled = (registerStates & AvxStates) == AvxStates;
+            const bool avx512Enabled = (registerStates & Avx512States) == Avx512States;
+
+            if (avxEnabled)
+            {
+                features |= (leaf1.m_ecx & (1 << 28)) ? CpuFeatureBit(CpuFeature::Avx) : 0;
+                features |= (leaf1.m_ecx & (1 << 12)) ? CpuFeatureBit(CpuFeature::Fma) : 0;
+            }
+
+            if (maxLeaf >= 7)
+            {
+                const CpuidRegisters leaf7 = Cpuid(7, 0);
+                features |= (leaf7.m_ebx & (1 << 8)) ? CpuFeatureBit(CpuFeature::Bmi2) : 0;
+                if (avxEnabled)
+                {
+                    features |= (leaf7.m_ebx & (1 << 5)) ? CpuFeatureBit(CpuFeature::Avx2) : 0;
+                }
+                if (avx512Enabled)
+                {
+                    features |= (leaf7.m_ebx & (1 << 16)) ? CpuFeatureBit(CpuFeature::Avx512F) : 0;
+                    features |= (leaf7.m_ebx & (1u << 30)) ? CpuFeatureBit(CpuFeature::Avx512Bw) : 0;
+                    features |= (leaf7.m_ebx & (1u << 31)) ? CpuFeatureBit(CpuFeature::Avx512Vl) : 0;
+                }
+            }
+            return features;
+        }
+#else
+        CpuFeatureMask DetectCpuFeatures()
+        {
+#if defined(__aarch64__) || defined(_M_ARM64)
+            // Neon is part of the arm64 baseline.
+            return CpuFeatureBit(CpuFeature::Neon);
+#else
+            return 0;
+#endif
+        }
+#endif
+    } // namespace
+
+    CpuFeatureMask GetCpuFeatures()
+    {
+        static const CpuFeatureMask features = DetectCpuFeatures();
+        return features;
+    }
+
+    bool HasCpuFeature(CpuFeature feature)
+    {
+        return (GetCpuFeatures() & CpuFeatureBit(feature)) != 0;
+    }
+
+    bool HasCpuFeatures(CpuFeatureMask features)
+    {
+        return (GetCpuFeatures() & features) == features;
+    }
+
+    const char* GetCpuFeatureName(CpuFeature feature)
+    {
+        switch (feature)
+        {
+        case CpuFeature::Sse42:
+            return "SSE4.2";
+        case CpuFeature::Pclmul:
+            return "PCLMUL";
+        case CpuFeature::Avx:
+            return "AVX";
+        case CpuFeature::Avx2:
+            return "AVX2";
+        case CpuFeature::Fma:
+            return "FMA";
+        case CpuFeature::Bmi2:
+            return "BMI2";
+        case CpuFeature::Avx512F:
+            return "AVX512F";
+        case CpuFeature::Avx512Bw:
+            return "AVX512BW";
+        case CpuFeature::Avx512Vl:
+            return "AVX512VL";
+        case CpuFeature::Neon:
+            return "NEON";
+        default:
+            return "Unknown";
+        }
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    //! Instruction set extensions that the engine can use when the cpu running it supports them,
+    //! on top of the baseline the engine is compiled for (SSE4.1 on x64, Neon on arm64).
+    enum class CpuFeature : u32
+    {
+        Sse42,
+        Pclmul,
+        Avx,
+        Avx2,
+        Fma,
+        Bmi2,
+        Avx512F,
+        Avx512Bw,
+        Avx512Vl,
+        Neon,
+        Count
+    };
+
+    //! Bit mask of CpuFeature values.
+    using CpuFeatureMask = u32;
+
+    constexpr CpuFeatureMask CpuFeatureBit(CpuFeature feature)
+    {
+        return CpuFeatureMask(1) << static_cast<u32>(feature);
+    }
+
+    namespace Platform
+    {
+        //! Returns the mask of the features supported by the cpu and the operating system, detected once.
+        CpuFeatureMask GetCpuFeatures();
+
+        bool HasCpuFeature(CpuFeature feature);
+
+        //! Returns true if all the features of the mask are supported.
+        bool HasCpuFeatures(CpuFeatureMask features);
+
+        const char* GetCpuFeatureName(CpuFeature feature);
+    } // namespace Platform
+
+    //! Version of a kernel compiled for some cpu features, see SelectCpuKernel.
+    template<typename Function>
+    struct CpuKernel
+    {
+        CpuFeatureMask m_requiredFeatures;
+        Function m_function;
+    };
+
+    //! Returns the first kernel of the table whose required features are supported by this cpu.
+    //! The tables are sorted from the most to the least demanding kernel and end with a kernel requiring no feature, like:
+    //!     static const CpuKernel<UpdateFunction> kernels[] = { { CpuFeatureBit(CpuFeature::Avx2), &UpdateAvx2 }, { 0, &Update } };
+    //!     static const UpdateFunction update = SelectCpuKernel(kernels);
+    template<typename Function, size_t Count>
+    Function SelectCpuKernel(const CpuKernel<Function> (&kernels)[Count])
+    {
+        static_assert(Count > 0, "The kernel table is empty");
+        for (const CpuKernel<Function>& kernel : kernels)
+        {
+            if (Platform::HasCpuFeatures(kernel.m_requiredFeatures))
+            {
+                return kernel.m_function;
+            }
+        }
+        AZ_Assert(false, "The last kernel of the table must not require any cpu feature");
+        return kernels[Count - 1].m_function;
+    }
+} // namespace AZ
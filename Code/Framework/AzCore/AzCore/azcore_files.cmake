@@ -120,6 +120,8 @@ set(FILES
     DOM/DomPatch.h
     DOM/DomPath.cpp
     DOM/DomPath.h
+    DOM/DomStringPool.cpp
+    DOM/DomStringPool.h
     DOM/DomUtils.cpp
     DOM/DomUtils.h
     DOM/DomValue.cpp
@@ -135,9 +137,13 @@ set(FILES
     DOM/Backends/JSON/JsonBackend.h
     DOM/Backends/JSON/JsonSerializationUtils.cpp
     DOM/Backends/JSON/JsonSerializationUtils.h
+    DOM/Backends/JSON/JsonStructuralParser.cpp
+    DOM/Backends/JSON/JsonStructuralParser.h
     EBus/BusImpl.h
     EBus/EBus.h
     EBus/EBusEnvironment.cpp
+    EBus/EBusEpochMutex.cpp
+    EBus/EBusEpochMutex.h
     EBus/Environment.h
     EBus/Event.h
     EBus/Event.inl
@@ -152,6 +158,8 @@ set(FILES
     EBus/ScheduledEvent.h
     EBus/ScheduledEventHandle.cpp
     EBus/ScheduledEventHandle.h
+    EBus/ScheduledEventTimerWheel.cpp
+    EBus/ScheduledEventTimerWheel.h
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
@@ -192,10 +200,14 @@ set(FILES
     IO/SystemFile.cpp
     IO/SystemFile.h
     IO/TextStreamWriters.h
+    IO/Streamer/AccessTrace.h
+    IO/Streamer/AccessTrace.cpp
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
+    IO/Streamer/ExternalDecompressor.h
+    IO/Streamer/ExternalDecompressor.cpp
     IO/Streamer/FileRange.h
     IO/Streamer/FileRange.cpp
     IO/Streamer/FileRequest.h
@@ -226,6 +238,7 @@ set(FILES
     IPC/SharedMemory.cpp
     IPC/SharedMemory.h
     Jobs/Algorithms.h
+    Jobs/Internal/JobFiber.h
     Jobs/Internal/JobManagerBase.cpp
     Jobs/Internal/JobManagerBase.h
     Jobs/Internal/JobManagerWorkStealing.cpp
@@ -259,6 +272,7 @@ set(FILES
     Math/Crc.cpp
     Math/Crc.inl
     Math/Crc.h
+    Math/Crc_Pclmul.cpp
     Math/DocsMath.h
     Math/Frustum.cpp
     Math/Frustum.h
@@ -266,7 +280,9 @@ set(FILES
     Math/Geometry2DUtils.cpp
     Math/Geometry2DUtils.h
     Math/Guid.h
+    Math/Internal/Crc_Pclmul.h
     Math/Internal/MathTypes.h
+    Math/Internal/SimdMathBatch_Avx2.h
     Math/Internal/SimdMathVec1_neon.inl
     Math/Internal/SimdMathVec1_scalar.inl
     Math/Internal/SimdMathVec1_sse.inl
@@ -332,6 +348,10 @@ set(FILES
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
     Math/SimdMath.h
+    Math/SimdMathBatch.cpp
+    Math/SimdMathBatch.h
+    Math/SimdMathBatch.inl
+    Math/SimdMathBatch_Avx2.cpp
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
@@ -370,6 +390,8 @@ set(FILES
     Math/ColorSerializer.cpp
     Memory/AllocationRecords.cpp
     Memory/AllocationRecords.h
+    Memory/AllocationSampler.cpp
+    Memory/AllocationSampler.h
     Memory/AllocatorBase.cpp
     Memory/AllocatorBase.h
     Memory/AllocatorManager.cpp
@@ -380,6 +402,8 @@ set(FILES
     Memory/BestFitExternalMapAllocator.h
     Memory/BestFitExternalMapSchema.cpp
     Memory/BestFitExternalMapSchema.h
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/Config.h
     Memory/dlmalloc.inl
     Memory/HeapSchema.h
@@ -575,6 +599,8 @@ set(FILES
     Settings/SettingsRegistryMergeUtils.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistrySnapshot.cpp
+    Settings/SettingsRegistrySnapshot.h
     Settings/SettingsRegistryVisitorUtils.cpp
     Settings/SettingsRegistryVisitorUtils.h
     State/HSM.cpp
@@ -621,6 +647,8 @@ set(FILES
     JSON/writer.h
     JSON/error/en.h
     JSON/error/error.h
+    Utils/CpuFeatures.cpp
+    Utils/CpuFeatures.h
     Utils/TypeHash.cpp
     Utils/TypeHash.h
     Utils/Utils.cpp
@@ -638,6 +666,8 @@ set(FILES
     Task/Internal/Task.inl
     Task/Internal/Task.h
     Task/Internal/TaskConfig.h
+    Task/TaskAlgorithms.h
+    Task/TaskAlgorithms.inl
     Task/TaskDescriptor.h
     Task/TaskExecutor.cpp
     Task/TaskExecutor.h
@@ -650,6 +680,8 @@ set(FILES
     Threading/ThreadSafeDeque.inl
     Threading/ThreadSafeObject.h
     Threading/ThreadSafeObject.inl
+    Threading/ThreadSafeSnapshot.h
+    Threading/ThreadSafeSnapshot.inl
     Threading/ThreadUtils.h
     Threading/ThreadUtils.cpp
     Time/ITime.h
@@ -27,6 +27,7 @@ set(FILES
     createdestroy.h
     docs.h
     exceptions.h
+    flat_hash_table.h
     functional.h
     functional_basic.h
     hash.cpp
@@ -77,6 +78,8 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -133,7 +136,9 @@ set(FILES
     function/function_fwd.h
     function/function_template.h
     function/identity.h
+    function/inplace_function.h
     function/invoke.h
+    function/move_only_function.h
     smart_ptr/checked_delete.h
     smart_ptr/enable_shared_from_this.h
     smart_ptr/enable_shared_from_this2.h
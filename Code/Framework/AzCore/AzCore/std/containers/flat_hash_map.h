@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            typedef Key                             key_type;
+            typedef EqualKey                        key_eq;
+            typedef Hasher                          hasher;
+            typedef AZStd::pair<Key, MappedType>    value_type;
+            typedef Allocator                       allocator_type;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value)  { return value.first; }
+        };
+    }
+
+    /**
+     * Open addressing hash map, with the same interface as \ref unordered_map minus the buckets and the node handles.
+     * The elements are stored inline in one array with a control byte each, and a lookup probes 16 control bytes at a time
+     * with SSE2 (8 with a portable fallback), which makes it a lot faster than unordered_map for small keys and values
+     * and doesn't allocate per element.
+     * Unlike unordered_map, inserting an element can move the other elements, so the references, pointers and iterators
+     * to the elements are invalidated when the map grows. Erasing an element doesn't move the other ones.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        typedef flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator> this_type;
+        typedef Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>> base_type;
+    public:
+        typedef typename base_type::traits_type traits_type;
+
+        typedef typename base_type::key_type    key_type;
+        typedef typename base_type::key_eq      key_eq;
+        typedef typename base_type::hasher      hasher;
+        typedef MappedType                      mapped_type;
+
+        typedef typename base_type::allocator_type              allocator_type;
+        typedef typename base_type::size_type                   size_type;
+        typedef typename base_type::difference_type             difference_type;
+        typedef typename base_type::pointer                     pointer;
+        typedef typename base_type::const_pointer               const_pointer;
+        typedef typename base_type::reference                   reference;
+        typedef typename base_type::const_reference             const_reference;
+
+        typedef typename base_type::iterator                    iterator;
+        typedef typename base_type::const_iterator              const_iterator;
+
+        typedef typename base_type::value_type                  value_type;
+        typedef typename base_type::pair_iter_bool              pair_iter_bool;
+
+        AZ_FORCE_INLINE flat_hash_map()
+            : base_type(hasher(), key_eq(), allocator_type()) {}
+        explicit flat_hash_map(const allocator_type& alloc)
+            : base_type(hasher(), key_eq(), alloc) {}
+        AZ_FORCE_INLINE flat_hash_map(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+            : base_type(hash, keyEqual, allocator) {}
+        explicit flat_hash_map(size_type numSlotsHint, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numSlotsHint);
+        }
+        template<class Iterator>
+        flat_hash_map(Iterator first, Iterator last)
+            : base_type(hasher(), key_eq(), allocator_type())
+        {
+            base_type::insert(first, last);
+        }
+        flat_hash_map(std::initializer_list<value_type> list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(list.size());
+            base_type::insert(list);
+        }
+        flat_hash_map(const this_type& rhs) = default;
+        flat_hash_map(this_type&& rhs) = default;
+
+        this_type& operator=(const this_type& rhs) = default;
+        this_type& operator=(this_type&& rhs) = default;
+        this_type& operator=(std::initializer_list<value_type> list)
+        {
+            base_type::clear();
+            base_type::insert(list);
+            return *this;
+        }
+
+        AZ_FORCE_INLINE mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        AZ_FORCE_INLINE mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        //! Constructs the mapped value from the arguments only when the key isn't in the map.
+        template<class... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... args)
+        {
+            return base_type::insert_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key), AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+        template<class... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... args)
+        {
+            return base_type::insert_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... args)
+        {
+            return try_emplace(key, AZStd::forward<Args>(args)...).first;
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... args)
+        {
+            return try_emplace(AZStd::move(key), AZStd::forward<Args>(args)...).first;
+        }
+
+        //! Assigns the value to the mapped value when the key is in the map, inserts it otherwise.
+        template<class M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<class M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return insert_or_assign(key, AZStd::forward<M>(value)).first;
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return insert_or_assign(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end(); )
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+}
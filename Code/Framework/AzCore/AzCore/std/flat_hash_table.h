@@ -0,0 +1,847 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/typetraits/is_destructible.h>
+#include <AzCore/std/utils.h>
+
+#include <initializer_list>
+#include <string.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <emmintrin.h>
+#endif
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        /**
+         * Building blocks of the open addressing hash table.
+         * Every slot of the table has a control byte: the 7 low bits of the hash of the element when the slot is full,
+         * or one of the special values below. The control bytes are probed a group at a time, with SSE2 when available
+         * and 8 bytes in a 64 bit word otherwise, so that a lookup usually only compares the key of the element it finds.
+         */
+        namespace FlatHashTable
+        {
+            using ctrl_t = AZ::s8;
+            using h2_t = AZ::u8;
+
+            constexpr ctrl_t CtrlEmpty = -128;
+            constexpr ctrl_t CtrlDeleted = -2;
+            constexpr ctrl_t CtrlSentinel = -1;
+
+            AZ_FORCE_INLINE bool IsFull(ctrl_t ctrl) { return ctrl >= 0; }
+            AZ_FORCE_INLINE bool IsEmpty(ctrl_t ctrl) { return ctrl == CtrlEmpty; }
+            AZ_FORCE_INLINE bool IsDeleted(ctrl_t ctrl) { return ctrl == CtrlDeleted; }
+            AZ_FORCE_INLINE bool IsEmptyOrDeleted(ctrl_t ctrl) { return ctrl < CtrlSentinel; }
+
+            /// Set of the matching slots of a group, one bit per slot (or one bit out of every 8 for the portable group).
+            template<class T, AZ::u32 SignificantBits, AZ::u32 Shift = 0>
+            class BitMask
+            {
+            public:
+                AZ_FORCE_INLINE explicit BitMask(T mask)
+                    : m_mask(mask) {}
+
+                AZ_FORCE_INLINE explicit operator bool() const { return m_mask != 0; }
+                AZ_FORCE_INLINE void ClearLowestBit() { m_mask &= (m_mask - 1); }
+
+                AZ_FORCE_INLINE AZ::u32 LowestBitSet() const { return CountTrailingZeros(m_mask) >> Shift; }
+                AZ_FORCE_INLINE AZ::u32 TrailingZeros() const { return m_mask ? LowestBitSet() : SignificantBits; }
+                AZ_FORCE_INLINE AZ::u32 LeadingZeros() const
+                {
+                    constexpr AZ::u32 extraBits = sizeof(T) * 8 - (SignificantBits << Shift);
+                    return m_mask ? (CountLeadingZeros(static_cast<T>(m_mask << extraBits)) >> Shift) : SignificantBits;
+                }
+
+            private:
+                static AZ_FORCE_INLINE AZ::u32 CountTrailingZeros(AZ::u32 value) { return az_ctz_u32(value); }
+                static AZ_FORCE_INLINE AZ::u32 CountTrailingZeros(AZ::u64 value) { return az_ctz_u64(value); }
+                static AZ_FORCE_INLINE AZ::u32 CountLeadingZeros(AZ::u32 value) { return az_clz_u32(value); }
+                static AZ_FORCE_INLINE AZ::u32 CountLeadingZeros(AZ::u64 value) { return az_clz_u64(value); }
+
+                T m_mask;
+            };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            struct Group
+            {
+                static constexpr size_t Width = 16;
+
+                AZ_FORCE_INLINE explicit Group(const ctrl_t* pos)
+                    : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+                /// Slots with the hash bits, the keys of the slots still have to be compared.
+                AZ_FORCE_INLINE BitMask<AZ::u32, Width> Match(h2_t hash) const
+                {
+                    return BitMask<AZ::u32, Width>(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(hash)), m_ctrl))));
+                }
+                AZ_FORCE_INLINE BitMask<AZ::u32, Width> MatchEmpty() const
+                {
+                    return BitMask<AZ::u32, Width>(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(CtrlEmpty), m_ctrl))));
+                }
+                AZ_FORCE_INLINE BitMask<AZ::u32, Width> MatchEmptyOrDeleted() const
+                {
+                    return BitMask<AZ::u32, Width>(static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(CtrlSentinel), m_ctrl))));
+                }
+                /// Number of empty or deleted slots at the start of the group.
+                AZ_FORCE_INLINE AZ::u32 CountLeadingEmptyOrDeleted() const
+                {
+                    const AZ::u32 mask = static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(CtrlSentinel), m_ctrl)));
+                    return az_ctz_u32(mask + 1);
+                }
+
+                __m128i m_ctrl;
+            };
+#else
+            struct Group
+            {
+                static constexpr size_t Width = 8;
+                static constexpr AZ::u64 Lsbs = 0x0101010101010101ull;
+                static constexpr AZ::u64 Msbs = 0x8080808080808080ull;
+
+                AZ_FORCE_INLINE explicit Group(const ctrl_t* pos)
+                {
+                    memcpy(&m_ctrl, pos, sizeof(m_ctrl));
+                }
+
+                /// Slots with the hash bits, the keys of the slots still have to be compared.
+                /// This can report a full slot right after a real match that doesn't have the hash bits, which the key comparison rejects.
+                AZ_FORCE_INLINE BitMask<AZ::u64, Width, 3> Match(h2_t hash) const
+                {
+                    const AZ::u64 x = m_ctrl ^ (Lsbs * hash);
+                    return BitMask<AZ::u64, Width, 3>((x - Lsbs) & ~x & Msbs);
+                }
+                AZ_FORCE_INLINE BitMask<AZ::u64, Width, 3> MatchEmpty() const
+                {
+                    return BitMask<AZ::u64, Width, 3>((m_ctrl & (~m_ctrl << 6)) & Msbs);
+                }
+                AZ_FORCE_INLINE BitMask<AZ::u64, Width, 3> MatchEmptyOrDeleted() const
+                {
+                    return BitMask<AZ::u64, Width, 3>((m_ctrl & (~m_ctrl << 7)) & Msbs);
+                }
+                /// Number of empty or deleted slots at the start of the group.
+                AZ_FORCE_INLINE AZ::u32 CountLeadingEmptyOrDeleted() const
+                {
+                    // Bit 7 of every empty or deleted byte, or'ed with the bits that make the carry of +1 run through them.
+                    constexpr AZ::u64 gaps = 0x00FEFEFEFEFEFEFEull;
+                    return (az_ctz_u64(((~m_ctrl & (m_ctrl >> 7)) | gaps) + 1) + 7) >> 3;
+                }
+
+                AZ::u64 m_ctrl;
+            };
+#endif
+
+            /// Number of control bytes copied after the sentinel, so that a group can be loaded from any slot without wrapping around.
+            constexpr size_t NumClonedBytes = Group::Width - 1;
+
+            /// Control bytes of a table without slots. No hash matches them and an insert always grows the table first.
+            inline const ctrl_t* EmptyGroup()
+            {
+                alignas(16) static constexpr ctrl_t emptyGroup[16] = {
+                    CtrlSentinel, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty,
+                    CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty };
+                return emptyGroup;
+            }
+
+            /// Capacities are always 2^n-1, so that the probe position wraps with a mask.
+            AZ_FORCE_INLINE bool IsValidCapacity(size_t capacity) { return ((capacity + 1) & capacity) == 0 && capacity > 0; }
+            AZ_FORCE_INLINE size_t NormalizeCapacity(size_t capacity)
+            {
+                return capacity ? (~size_t{} >> az_clz_u64(static_cast<AZ::u64>(capacity))) : 1;
+            }
+            /// The table is kept at most 7/8 full (a single group of 8 slots holds at most 6 elements, so a probe always ends).
+            AZ_FORCE_INLINE size_t CapacityToGrowth(size_t capacity)
+            {
+                if (Group::Width == 8 && capacity == 7)
+                {
+                    return 6;
+                }
+                return capacity - capacity / 8;
+            }
+            AZ_FORCE_INLINE size_t GrowthToLowerboundCapacity(size_t growth)
+            {
+                if (Group::Width == 8 && growth == 7)
+                {
+                    return 8;
+                }
+                return growth + static_cast<size_t>((static_cast<AZ::s64>(growth) - 1) / 7);
+            }
+
+            /// Spreads the bits of the hash, the AZStd hashes of integers and pointers are the identity.
+            AZ_FORCE_INLINE size_t MixHash(size_t hash)
+            {
+                AZ::u64 mixed = static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull;
+                mixed ^= mixed >> 32;
+                return static_cast<size_t>(mixed);
+            }
+            AZ_FORCE_INLINE size_t H1(size_t hash) { return hash >> 7; }
+            AZ_FORCE_INLINE h2_t H2(size_t hash) { return static_cast<h2_t>(hash & 0x7F); }
+
+            /// Triangular probing over the groups, which visits every group once when the capacity is 2^n-1.
+            class ProbeSequence
+            {
+            public:
+                AZ_FORCE_INLINE ProbeSequence(size_t hash, size_t mask)
+                    : m_mask(mask)
+                    , m_offset(hash & mask) {}
+
+                AZ_FORCE_INLINE size_t Offset() const { return m_offset; }
+                AZ_FORCE_INLINE size_t Offset(size_t i) const { return (m_offset + i) & m_mask; }
+                AZ_FORCE_INLINE void Next()
+                {
+                    m_index += Group::Width;
+                    m_offset = (m_offset + m_index) & m_mask;
+                }
+
+            private:
+                size_t m_mask;
+                size_t m_offset;
+                size_t m_index = 0;
+            };
+        } // namespace FlatHashTable
+
+        /**
+         * Open addressing hash table with the elements stored inline in a single allocation, see \ref flat_hash_map and \ref flat_hash_set.
+         * The traits are the same as the ones of \ref hash_table:
+         * \code
+         * typedef xxx  key_type;
+         * typedef xxx  key_eq;
+         * typedef xxx  hasher;
+         * typedef xxx  value_type;
+         * typedef xxx  allocator_type;
+         * static const key_type& key_from_value(const value_type& value);
+         * \endcode
+         */
+        template<class Traits>
+        class flat_hash_table
+        {
+            typedef flat_hash_table<Traits> this_type;
+            using ctrl_t = FlatHashTable::ctrl_t;
+            using Group = FlatHashTable::Group;
+
+        public:
+            typedef Traits traits_type;
+
+            typedef typename Traits::key_type       key_type;
+            typedef typename Traits::key_eq         key_eq;
+            typedef typename Traits::hasher         hasher;
+            typedef typename Traits::allocator_type allocator_type;
+            typedef typename Traits::value_type     value_type;
+
+            typedef AZStd::size_t                   size_type;
+            typedef AZStd::ptrdiff_t                difference_type;
+            typedef value_type*                     pointer;
+            typedef const value_type*               const_pointer;
+            typedef value_type&                     reference;
+            typedef const value_type&               const_reference;
+
+            class iterator;
+
+            class const_iterator
+            {
+                friend class flat_hash_table;
+                friend class iterator;
+            public:
+                typedef AZStd::forward_iterator_tag iterator_category;
+                typedef typename flat_hash_table::value_type value_type;
+                typedef AZStd::ptrdiff_t difference_type;
+                typedef const value_type* pointer;
+                typedef const value_type& reference;
+
+                AZ_FORCE_INLINE const_iterator() = default;
+
+                AZ_FORCE_INLINE reference operator*() const { return *m_slot; }
+                AZ_FORCE_INLINE pointer operator->() const { return m_slot; }
+                AZ_FORCE_INLINE const_iterator& operator++()
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                    SkipEmptyOrDeleted();
+                    return *this;
+                }
+                AZ_FORCE_INLINE const_iterator operator++(int)
+                {
+                    const_iterator temp = *this;
+                    ++*this;
+                    return temp;
+                }
+                AZ_FORCE_INLINE bool operator==(const const_iterator& rhs) const { return m_ctrl == rhs.m_ctrl; }
+                AZ_FORCE_INLINE bool operator!=(const const_iterator& rhs) const { return m_ctrl != rhs.m_ctrl; }
+
+            protected:
+                AZ_FORCE_INLINE const_iterator(const ctrl_t* ctrl, value_type* slot)
+                    : m_ctrl(ctrl)
+                    , m_slot(slot) {}
+
+                /// Moves to the next full slot, or to the sentinel which is the end.
+                AZ_FORCE_INLINE void SkipEmptyOrDeleted()
+                {
+                    while (FlatHashTable::IsEmptyOrDeleted(*m_ctrl))
+                    {
+                        const AZ::u32 shift = Group(m_ctrl).CountLeadingEmptyOrDeleted();
+                        m_ctrl += shift;
+                        m_slot += shift;
+                    }
+                }
+
+                const ctrl_t* m_ctrl = nullptr;
+                value_type* m_slot = nullptr;
+            };
+
+            class iterator
+                : public const_iterator
+            {
+                friend class flat_hash_table;
+            public:
+                typedef AZStd::forward_iterator_tag iterator_category;
+                typedef typename flat_hash_table::value_type value_type;
+                typedef AZStd::ptrdiff_t difference_type;
+                typedef value_type* pointer;
+                typedef value_type& reference;
+
+                AZ_FORCE_INLINE iterator() = default;
+
+                AZ_FORCE_INLINE reference operator*() const { return *this->m_slot; }
+                AZ_FORCE_INLINE pointer operator->() const { return this->m_slot; }
+                AZ_FORCE_INLINE iterator& operator++()
+                {
+                    const_iterator::operator++();
+                    return *this;
+                }
+                AZ_FORCE_INLINE iterator operator++(int)
+                {
+                    iterator temp = *this;
+                    ++*this;
+                    return temp;
+                }
+
+            protected:
+                AZ_FORCE_INLINE iterator(const ctrl_t* ctrl, value_type* slot)
+                    : const_iterator(ctrl, slot) {}
+                AZ_FORCE_INLINE explicit iterator(const const_iterator& rhs)
+                    : const_iterator(rhs) {}
+            };
+
+            typedef AZStd::pair<iterator, bool> pair_iter_bool;
+
+            explicit flat_hash_table(const hasher& hash, const key_eq& keyEqual, const allocator_type& alloc)
+                : m_hasher(hash)
+                , m_keyEqual(keyEqual)
+                , m_allocator(alloc)
+            {
+            }
+
+            flat_hash_table(const this_type& rhs)
+                : m_hasher(rhs.m_hasher)
+                , m_keyEqual(rhs.m_keyEqual)
+                , m_allocator(rhs.m_allocator)
+            {
+                reserve(rhs.size());
+                for (const value_type& value : rhs)
+                {
+                    insert_unique_no_check(value);
+                }
+            }
+
+            flat_hash_table(this_type&& rhs)
+                : m_hasher(AZStd::move(rhs.m_hasher))
+                , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+                , m_allocator(rhs.m_allocator)
+            {
+                steal(rhs);
+            }
+
+            ~flat_hash_table()
+            {
+                destroy_slots();
+                deallocate_slots();
+            }
+
+            this_type& operator=(const this_type& rhs)
+            {
+                if (this != &rhs)
+                {
+                    clear();
+                    m_hasher = rhs.m_hasher;
+                    m_keyEqual = rhs.m_keyEqual;
+                    reserve(rhs.size());
+                    for (const value_type& value : rhs)
+                    {
+                        insert_unique_no_check(value);
+                    }
+                }
+                return *this;
+            }
+
+            this_type& operator=(this_type&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    if (m_allocator == rhs.m_allocator)
+                    {
+                        destroy_slots();
+                        deallocate_slots();
+                        m_hasher = AZStd::move(rhs.m_hasher);
+                        m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                        steal(rhs);
+                    }
+                    else
+                    {
+                        // The memory of rhs can't be released with our allocator, move the elements one by one.
+                        clear();
+                        m_hasher = rhs.m_hasher;
+                        m_keyEqual = rhs.m_keyEqual;
+                        reserve(rhs.size());
+                        for (value_type& value : rhs)
+                        {
+                            insert_unique_no_check(AZStd::move(value));
+                        }
+                        rhs.clear();
+                    }
+                }
+                return *this;
+            }
+
+            AZ_FORCE_INLINE iterator begin()
+            {
+                iterator it(m_ctrl, m_slots);
+                it.SkipEmptyOrDeleted();
+                return it;
+            }
+            AZ_FORCE_INLINE const_iterator begin() const
+            {
+                const_iterator it(m_ctrl, m_slots);
+                it.SkipEmptyOrDeleted();
+                return it;
+            }
+            AZ_FORCE_INLINE iterator end() { return iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+            AZ_FORCE_INLINE const_iterator end() const { return const_iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+            AZ_FORCE_INLINE const_iterator cbegin() const { return begin(); }
+            AZ_FORCE_INLINE const_iterator cend() const { return end(); }
+
+            AZ_FORCE_INLINE bool empty() const { return m_size == 0; }
+            AZ_FORCE_INLINE size_type size() const { return m_size; }
+            AZ_FORCE_INLINE size_type max_size() const { return AZStd::numeric_limits<difference_type>::max() / sizeof(value_type); }
+            /// Number of slots, the table grows before it is 7/8 full.
+            AZ_FORCE_INLINE size_type capacity() const { return m_capacity; }
+            AZ_FORCE_INLINE size_type bucket_count() const { return m_capacity; }
+            AZ_FORCE_INLINE float load_factor() const { return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f; }
+            AZ_FORCE_INLINE float max_load_factor() const { return 7.0f / 8.0f; }
+
+            AZ_FORCE_INLINE hasher hash_function() const { return m_hasher; }
+            AZ_FORCE_INLINE key_eq key_equal() const { return m_keyEqual; }
+            AZ_FORCE_INLINE allocator_type& get_allocator() { return m_allocator; }
+            AZ_FORCE_INLINE const allocator_type& get_allocator() const { return m_allocator; }
+
+            AZ_FORCE_INLINE iterator find(const key_type& key)
+            {
+                const size_type index = find_index(key, hash_key(key));
+                return index == npos ? end() : iterator_at(index);
+            }
+            AZ_FORCE_INLINE const_iterator find(const key_type& key) const
+            {
+                const size_type index = find_index(key, hash_key(key));
+                return index == npos ? end() : const_iterator(m_ctrl + index, m_slots + index);
+            }
+            AZ_FORCE_INLINE bool contains(const key_type& key) const { return find_index(key, hash_key(key)) != npos; }
+            AZ_FORCE_INLINE size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+            AZ_FORCE_INLINE pair_iter_bool insert(const value_type& value)
+            {
+                return insert_key(Traits::key_from_value(value), value);
+            }
+            AZ_FORCE_INLINE pair_iter_bool insert(value_type&& value)
+            {
+                const key_type& key = Traits::key_from_value(value);
+                return insert_key(key, AZStd::move(value));
+            }
+            AZ_FORCE_INLINE iterator insert(const_iterator, const value_type& value) { return insert(value).first; }
+            AZ_FORCE_INLINE iterator insert(const_iterator, value_type&& value) { return insert(AZStd::move(value)).first; }
+            template<class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                {
+                    insert(*first);
+                }
+            }
+            void insert(std::initializer_list<value_type> list)
+            {
+                insert(list.begin(), list.end());
+            }
+
+            /// Constructs the element first to get its key, prefer the insert functions that take the key like try_emplace when it is known.
+            template<class... Args>
+            pair_iter_bool emplace(Args&&... args)
+            {
+                value_type value(AZStd::forward<Args>(args)...);
+                return insert(AZStd::move(value));
+            }
+            template<class... Args>
+            AZ_FORCE_INLINE iterator emplace_hint(const_iterator, Args&&... args)
+            {
+                return emplace(AZStd::forward<Args>(args)...).first;
+            }
+
+            /// Erasing doesn't move the other elements, so the iterators of the remaining elements stay valid.
+            iterator erase(const_iterator pos)
+            {
+                AZSTD_CONTAINER_ASSERT(pos.m_ctrl >= m_ctrl && pos.m_ctrl < m_ctrl + m_capacity && FlatHashTable::IsFull(*pos.m_ctrl), "Invalid iterator!");
+                iterator next(pos);
+                ++next;
+                erase_at(static_cast<size_type>(pos.m_ctrl - m_ctrl));
+                return next;
+            }
+            AZ_FORCE_INLINE iterator erase(iterator pos) { return erase(static_cast<const_iterator>(pos)); }
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                while (first != last)
+                {
+                    first = erase(first);
+                }
+                return iterator(last);
+            }
+            size_type erase(const key_type& key)
+            {
+                const size_type index = find_index(key, hash_key(key));
+                if (index == npos)
+                {
+                    return 0;
+                }
+                erase_at(index);
+                return 1;
+            }
+
+            /// Destroys the elements and keeps the memory.
+            void clear()
+            {
+                if (m_capacity)
+                {
+                    destroy_slots();
+                    m_size = 0;
+                    reset_ctrl();
+                }
+            }
+
+            /// Makes room for count elements without growing again.
+            void reserve(size_type count)
+            {
+                if (count > m_size + m_growthLeft)
+                {
+                    resize(FlatHashTable::NormalizeCapacity(FlatHashTable::GrowthToLowerboundCapacity(count)));
+                }
+            }
+
+            /// Resizes the table to at least numSlots slots, or to the smallest capacity that holds the elements.
+            /// rehash(0) releases the memory of an empty table.
+            void rehash(size_type numSlots)
+            {
+                if (numSlots == 0 && m_size == 0)
+                {
+                    deallocate_slots();
+                    return;
+                }
+                const size_type minCapacity = m_size ? FlatHashTable::NormalizeCapacity(FlatHashTable::GrowthToLowerboundCapacity(m_size)) : 0;
+                size_type newCapacity = numSlots ? FlatHashTable::NormalizeCapacity(numSlots) : 0;
+                newCapacity = newCapacity > minCapacity ? newCapacity : minCapacity;
+                if (newCapacity != m_capacity)
+                {
+                    resize(newCapacity);
+                }
+            }
+
+            void swap(this_type& rhs)
+            {
+                if (this == &rhs)
+                {
+                    return;
+                }
+                if (m_allocator == rhs.m_allocator)
+                {
+                    AZStd::swap(m_hasher, rhs.m_hasher);
+                    AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+                    AZStd::swap(m_ctrl, rhs.m_ctrl);
+                    AZStd::swap(m_slots, rhs.m_slots);
+                    AZStd::swap(m_size, rhs.m_size);
+                    AZStd::swap(m_capacity, rhs.m_capacity);
+                    AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+                }
+                else
+                {
+                    this_type temp(AZStd::move(*this));
+                    *this = AZStd::move(rhs);
+                    rhs = AZStd::move(temp);
+                }
+            }
+
+            friend bool operator==(const this_type& lhs, const this_type& rhs)
+            {
+                if (lhs.size() != rhs.size())
+                {
+                    return false;
+                }
+                for (const value_type& value : lhs)
+                {
+                    const_iterator it = rhs.find(Traits::key_from_value(value));
+                    if (it == rhs.end() || !(*it == value))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            friend bool operator!=(const this_type& lhs, const this_type& rhs)
+            {
+                return !(lhs == rhs);
+            }
+
+        protected:
+            static constexpr size_type npos = static_cast<size_type>(-1);
+
+            AZ_FORCE_INLINE size_type hash_key(const key_type& key) const
+            {
+                return FlatHashTable::MixHash(m_hasher(key));
+            }
+
+            AZ_FORCE_INLINE iterator iterator_at(size_type index)
+            {
+                return iterator(m_ctrl + index, m_slots + index);
+            }
+
+            /// Index of the slot with the key, or npos.
+            size_type find_index(const key_type& key, size_type hash) const
+            {
+                FlatHashTable::ProbeSequence seq(FlatHashTable::H1(hash), m_capacity);
+                while (true)
+                {
+                    const Group group(m_ctrl + seq.Offset());
+                    for (auto mask = group.Match(FlatHashTable::H2(hash)); mask; mask.ClearLowestBit())
+                    {
+                        const size_type index = seq.Offset(mask.LowestBitSet());
+                        if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                        {
+                            return index;
+                        }
+                    }
+                    if (group.MatchEmpty())
+                    {
+                        return npos;
+                    }
+                    seq.Next();
+                }
+            }
+
+            /// The first empty or deleted slot on the probe sequence of the hash.
+            size_type find_first_non_full(size_type hash) const
+            {
+                FlatHashTable::ProbeSequence seq(FlatHashTable::H1(hash), m_capacity);
+                while (true)
+                {
+                    const auto mask = Group(m_ctrl + seq.Offset()).MatchEmptyOrDeleted();
+                    if (mask)
+                    {
+                        return seq.Offset(mask.LowestBitSet());
+                    }
+                    seq.Next();
+                }
+            }
+
+            /// Claims a slot for a key that isn't in the table, growing it when needed. The caller constructs the element in it.
+            size_type prepare_insert(size_type hash)
+            {
+                size_type target = find_first_non_full(hash);
+                if (m_growthLeft == 0 && !FlatHashTable::IsDeleted(m_ctrl[target]))
+                {
+                    rehash_and_grow();
+                    target = find_first_non_full(hash);
+                }
+                ++m_size;
+                m_growthLeft -= FlatHashTable::IsEmpty(m_ctrl[target]) ? 1 : 0;
+                set_ctrl(target, static_cast<ctrl_t>(FlatHashTable::H2(hash)));
+                return target;
+            }
+
+            template<class... Args>
+            pair_iter_bool insert_key(const key_type& key, Args&&... args)
+            {
+                const size_type hash = hash_key(key);
+                size_type index = find_index(key, hash);
+                if (index != npos)
+                {
+                    return pair_iter_bool(iterator_at(index), false);
+                }
+                index = prepare_insert(hash);
+                new (m_slots + index) value_type(AZStd::forward<Args>(args)...);
+                return pair_iter_bool(iterator_at(index), true);
+            }
+
+            template<class Value>
+            void insert_unique_no_check(Value&& value)
+            {
+                const size_type index = prepare_insert(hash_key(Traits::key_from_value(value)));
+                new (m_slots + index) value_type(AZStd::forward<Value>(value));
+            }
+
+            void erase_at(size_type index)
+            {
+                m_slots[index].~value_type();
+                --m_size;
+                // When there was an empty slot within a group width on both sides, no probe sequence went past this slot
+                // while it was full, and it can become empty again instead of a tombstone.
+                const size_type indexBefore = (index - Group::Width) & m_capacity;
+                const auto emptyAfter = Group(m_ctrl + index).MatchEmpty();
+                const auto emptyBefore = Group(m_ctrl + indexBefore).MatchEmpty();
+                const bool wasNeverFull = emptyBefore && emptyAfter && (emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros()) < Group::Width;
+                set_ctrl(index, wasNeverFull ? FlatHashTable::CtrlEmpty : FlatHashTable::CtrlDeleted);
+                m_growthLeft += wasNeverFull ? 1 : 0;
+            }
+
+            /// Sets the control byte of the slot and its copy after the sentinel.
+            AZ_FORCE_INLINE void set_ctrl(size_type index, ctrl_t value)
+            {
+                m_ctrl[index] = value;
+                m_ctrl[((index - FlatHashTable::NumClonedBytes) & m_capacity) + (FlatHashTable::NumClonedBytes & m_capacity)] = value;
+            }
+
+            void rehash_and_grow()
+            {
+                if (m_capacity == 0)
+                {
+                    resize(1);
+                }
+                else if (m_capacity > Group::Width && m_size * 32 <= m_capacity * 25)
+                {
+                    // Mostly tombstones, rehash in place of growing.
+                    resize(m_capacity);
+                }
+                else
+                {
+                    resize(m_capacity * 2 + 1);
+                }
+            }
+
+            void resize(size_type newCapacity)
+            {
+                AZSTD_CONTAINER_ASSERT(FlatHashTable::IsValidCapacity(newCapacity), "Invalid flat hash table capacity!");
+                ctrl_t* oldCtrl = m_ctrl;
+                value_type* oldSlots = m_slots;
+                const size_type oldCapacity = m_capacity;
+
+                initialize_slots(newCapacity);
+
+                for (size_type i = 0; i != oldCapacity; ++i)
+                {
+                    if (FlatHashTable::IsFull(oldCtrl[i]))
+                    {
+                        const size_type hash = hash_key(Traits::key_from_value(oldSlots[i]));
+                        const size_type target = find_first_non_full(hash);
+                        set_ctrl(target, static_cast<ctrl_t>(FlatHashTable::H2(hash)));
+                        new (m_slots + target) value_type(AZStd::move(oldSlots[i]));
+                        oldSlots[i].~value_type();
+                    }
+                }
+
+                if (oldCapacity)
+                {
+                    m_allocator.deallocate(oldCtrl, allocation_size(oldCapacity), allocation_alignment());
+                }
+            }
+
+            void initialize_slots(size_type capacity)
+            {
+                char* memory = reinterpret_cast<char*>(m_allocator.allocate(allocation_size(capacity), allocation_alignment()));
+                m_ctrl = reinterpret_cast<ctrl_t*>(memory);
+                m_slots = reinterpret_cast<value_type*>(memory + slot_offset(capacity));
+                m_capacity = capacity;
+                reset_ctrl();
+            }
+
+            void reset_ctrl()
+            {
+                memset(m_ctrl, FlatHashTable::CtrlEmpty, m_capacity + 1 + FlatHashTable::NumClonedBytes);
+                m_ctrl[m_capacity] = FlatHashTable::CtrlSentinel;
+                m_growthLeft = FlatHashTable::CapacityToGrowth(m_capacity) - m_size;
+            }
+
+            void destroy_slots()
+            {
+                if constexpr (!AZStd::is_trivially_destructible_v<value_type>)
+                {
+                    for (size_type i = 0; i != m_capacity; ++i)
+                    {
+                        if (FlatHashTable::IsFull(m_ctrl[i]))
+                        {
+                            m_slots[i].~value_type();
+                        }
+                    }
+                }
+            }
+
+            void deallocate_slots()
+            {
+                if (m_capacity)
+                {
+                    m_allocator.deallocate(m_ctrl, allocation_size(m_capacity), allocation_alignment());
+                }
+                m_ctrl = const_cast<ctrl_t*>(FlatHashTable::EmptyGroup());
+                m_slots = nullptr;
+                m_size = 0;
+                m_capacity = 0;
+                m_growthLeft = 0;
+            }
+
+            void steal(this_type& rhs)
+            {
+                m_ctrl = rhs.m_ctrl;
+                m_slots = rhs.m_slots;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                m_growthLeft = rhs.m_growthLeft;
+                rhs.m_ctrl = const_cast<ctrl_t*>(FlatHashTable::EmptyGroup());
+                rhs.m_slots = nullptr;
+                rhs.m_size = 0;
+                rhs.m_capacity = 0;
+                rhs.m_growthLeft = 0;
+            }
+
+            /// The control bytes and the slots are in one allocation, the control bytes first.
+            static constexpr size_type allocation_alignment()
+            {
+                return alignof(value_type) > 16 ? alignof(value_type) : 16;
+            }
+            static size_type slot_offset(size_type capacity)
+            {
+                const size_type ctrlBytes = capacity + 1 + FlatHashTable::NumClonedBytes;
+                return (ctrlBytes + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+            }
+            static size_type allocation_size(size_type capacity)
+            {
+                return slot_offset(capacity) + capacity * sizeof(value_type);
+            }
+
+            ctrl_t* m_ctrl = const_cast<ctrl_t*>(FlatHashTable::EmptyGroup());
+            value_type* m_slots = nullptr;
+            size_type m_size = 0;
+            size_type m_capacity = 0;
+            size_type m_growthLeft = 0;
+            hasher m_hasher;
+            key_eq m_keyEqual;
+            allocator_type m_allocator;
+        };
+    } // namespace Internal
+} // namespace AZStd
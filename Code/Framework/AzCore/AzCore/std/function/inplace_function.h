@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/base.h>
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_constructible.h>
+#include <AzCore/std/typetraits/is_member_pointer.h>
+#include <AzCore/std/typetraits/is_pointer.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/utils.h>
+
+#include <stddef.h>
+
+namespace AZStd
+{
+    //! Capacity in bytes of an inplace_function if none is specified, 8 pointers or references on a 64-bit machine.
+    constexpr size_t InplaceFunctionDefaultCapacity = 64;
+
+    template<typename Signature, size_t Capacity = InplaceFunctionDefaultCapacity, size_t Alignment = alignof(max_align_t)>
+    class inplace_function;
+
+    //! A copyable function wrapper like AZStd::function, which always stores the callable inside of itself and never allocates.
+    //! Constructing it from a callable bigger than Capacity, or with a stricter alignment, fails to compile.
+    //! Use it for the callbacks that are created often, for instance every frame, and capture a few pointers or references.
+    template<typename R, typename... Args, size_t Capacity, size_t Alignment>
+    class inplace_function<R(Args...), Capacity, Alignment>
+    {
+        struct VTable
+        {
+            R (*m_invoke)(void* storage, Args&&... args);
+            void (*m_copy)(void* destination, const void* source);
+            //! Move constructs the destination from the source and destroys the source.
+            void (*m_relocate)(void* destination, void* source);
+            void (*m_destroy)(void* storage);
+        };
+
+        template<typename Functor>
+        static constexpr VTable s_vtable = {
+            [](void* storage, Args&&... args) -> R
+            {
+                return AZStd::invoke(*static_cast<Functor*>(storage), AZStd::forward<Args>(args)...);
+            },
+            [](void* destination, const void* source)
+            {
+                new (destination) Functor(*static_cast<const Functor*>(source));
+            },
+            [](void* destination, void* source)
+            {
+                new (destination) Functor(AZStd::move(*static_cast<Functor*>(source)));
+                static_cast<Functor*>(source)->~Functor();
+            },
+            [](void* storage)
+            {
+                static_cast<Functor*>(storage)->~Functor();
+            }
+        };
+
+    public:
+        using result_type = R;
+        static constexpr size_t capacity = Capacity;
+
+        inplace_function() = default;
+        inplace_function(AZStd::nullptr_t) {}
+
+        template<typename F, typename Functor = AZStd::decay_t<F>,
+            typename = AZStd::enable_if_t<!AZStd::is_same_v<Functor, inplace_function> && AZStd::is_invocable_r_v<R, Functor&, Args...>>>
+        inplace_function(F&& f)
+        {
+            static_assert(sizeof(Functor) <= Capacity,
+                "The callable is bigger than the capacity of the inplace_function, capture less data or increase the capacity");
+            static_assert(Alignment % alignof(Functor) == 0, "The callable has a stricter alignment than the inplace_function");
+            static_assert(AZStd::is_copy_constructible_v<Functor>,
+                "inplace_function requires a copyable callable, use AZStd::move_only_function for the move only ones");
+
+            if constexpr (AZStd::is_pointer_v<Functor> || AZStd::is_member_pointer_v<Functor>)
+            {
+                if (f == nullptr)
+                {
+                    return;
+                }
+            }
+            new (m_storage) Functor(AZStd::forward<F>(f));
+            m_vtable = &s_vtable<Functor>;
+        }
+
+        inplace_function(const inplace_function& rhs)
+            : m_vtable(rhs.m_vtable)
+        {
+            if (m_vtable)
+            {
+                m_vtable->m_copy(m_storage, rhs.m_storage);
+            }
+        }
+
+        inplace_function(inplace_function&& rhs)
+            : m_vtable(rhs.m_vtable)
+        {
+            if (m_vtable)
+            {
+                m_vtable->m_relocate(m_storage, rhs.m_storage);
+                rhs.m_vtable = nullptr;
+            }
+        }
+
+        ~inplace_function()
+        {
+            reset();
+        }
+
+        inplace_function& operator=(const inplace_function& rhs)
+        {
+            if (this != &rhs)
+            {
+                reset();
+                if (rhs.m_vtable)
+                {
+                    rhs.m_vtable->m_copy(m_storage, rhs.m_storage);
+                    m_vtable = rhs.m_vtable;
+                }
+            }
+            return *this;
+        }
+
+        inplace_function& operator=(inplace_function&& rhs)
+        {
+            if (this != &rhs)
+            {
+                reset();
+                if (rhs.m_vtable)
+                {
+                    rhs.m_vtable->m_relocate(m_storage, rhs.m_storage);
+                    m_vtable = rhs.m_vtable;
+                    rhs.m_vtable = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        inplace_function& operator=(AZStd::nullptr_t)
+        {
+            reset();
+            return *this;
+        }
+
+        template<typename F, typename = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::decay_t<F>, inplace_function>>>
+        inplace_function& operator=(F&& f)
+        {
+            inplace_function(AZStd::forward<F>(f)).swap(*this);
+            return *this;
+        }
+
+        R operator()(Args... args) const
+        {
+            AZ_Assert(m_vtable, "Bad function call!");
+            return m_vtable->m_invoke(m_storage, AZStd::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const
+        {
+            return m_vtable != nullptr;
+        }
+
+        void swap(inplace_function& rhs)
+        {
+            if (this == &rhs)
+            {
+                return;
+            }
+            inplace_function temp(AZStd::move(rhs));
+            rhs = AZStd::move(*this);
+            *this = AZStd::move(temp);
+        }
+
+    private:
+        void reset()
+        {
+            if (m_vtable)
+            {
+                m_vtable->m_destroy(m_storage);
+                m_vtable = nullptr;
+            }
+        }
+
+        const VTable* m_vtable = nullptr;
+        alignas(Alignment) mutable unsigned char m_storage[Capacity];
+    };
+
+    template<typename Signature, size_t Capacity, size_t Alignment>
+    void swap(inplace_function<Signature, Capacity, Alignment>& lhs, inplace_function<Signature, Capacity, Alignment>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<typename Signature, size_t Capacity, size_t Alignment>
+    bool operator==(const inplace_function<Signature, Capacity, Alignment>& f, AZStd::nullptr_t)
+    {
+        return !f;
+    }
+
+    template<typename Signature, size_t Capacity, size_t Alignment>
+    bool operator!=(const inplace_function<Signature, Capacity, Alignment>& f, AZStd::nullptr_t)
+    {
+        return static_cast<bool>(f);
+    }
+} // namespace AZStd
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/base.h>
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_constructible.h>
+#include <AzCore/std/typetraits/is_member_pointer.h>
+#include <AzCore/std/typetraits/is_pointer.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/utils.h>
+
+#include <stddef.h>
+
+namespace AZStd
+{
+    template<typename Signature>
+    class move_only_function;
+
+    //! A function wrapper like AZStd::function for callables that can't be copied, like lambdas capturing a unique_ptr.
+    //! The callables up to 4 pointers in size that can be moved without throwing are stored inside of the wrapper,
+    //! the bigger ones are allocated with AZStd::allocator.
+    template<typename R, typename... Args>
+    class move_only_function<R(Args...)>
+    {
+        static constexpr size_t BufferSize = sizeof(void*) * 4;
+        static constexpr size_t BufferAlignment = alignof(max_align_t);
+
+        template<typename Functor>
+        static constexpr bool IsStoredInline =
+            sizeof(Functor) <= BufferSize && BufferAlignment % alignof(Functor) == 0 && AZStd::is_nothrow_move_constructible_v<Functor>;
+
+        struct VTable
+        {
+            R (*m_invoke)(void* storage, Args&&... args);
+            //! Moves the callable of the source storage to the destination storage, the source is left empty.
+            void (*m_relocate)(void* destination, void* source);
+            void (*m_destroy)(void* storage);
+        };
+
+        template<typename Functor>
+        static Functor* GetFunctor(void* storage)
+        {
+            if constexpr (IsStoredInline<Functor>)
+            {
+                return static_cast<Functor*>(storage);
+            }
+            else
+            {
+                return *static_cast<Functor**>(storage);
+            }
+        }
+
+        template<typename Functor>
+        static constexpr VTable s_vtable = {
+            [](void* storage, Args&&... args) -> R
+            {
+                return AZStd::invoke(*GetFunctor<Functor>(storage), AZStd::forward<Args>(args)...);
+            },
+            [](void* destination, void* source)
+            {
+                if constexpr (IsStoredInline<Functor>)
+                {
+                    new (destination) Functor(AZStd::move(*static_cast<Functor*>(source)));
+                    static_cast<Functor*>(source)->~Functor();
+                }
+                else
+                {
+                    *static_cast<Functor**>(destination) = *static_cast<Functor**>(source);
+                }
+            },
+            [](void* storage)
+            {
+                Functor* functor = GetFunctor<Functor>(storage);
+                functor->~Functor();
+                if constexpr (!IsStoredInline<Functor>)
+                {
+                    AZStd::allocator().deallocate(functor, sizeof(Functor), alignof(Functor));
+                }
+            }
+        };
+
+    public:
+        using result_type = R;
+
+        move_only_function() = default;
+        move_only_function(AZStd::nullptr_t) {}
+
+        template<typename F, typename Functor = AZStd::decay_t<F>,
+            typename = AZStd::enable_if_t<!AZStd::is_same_v<Functor, move_only_function> && AZStd::is_invocable_r_v<R, Functor&, Args...>>>
+        move_only_function(F&& f)
+        {
+            if constexpr (AZStd::is_pointer_v<Functor> || AZStd::is_member_pointer_v<Functor>)
+            {
+                if (f == nullptr)
+                {
+                    return;
+                }
+            }
+            if constexpr (IsStoredInline<Functor>)
+            {
+                new (m_storage) Functor(AZStd::forward<F>(f));
+            }
+            else
+            {
+                void* memory = AZStd::allocator().allocate(sizeof(Functor), alignof(Functor));
+                *reinterpret_cast<Functor**>(m_storage) = new (memory) Functor(AZStd::forward<F>(f));
+            }
+            m_vtable = &s_vtable<Functor>;
+        }
+
+        move_only_function(const move_only_function&) = delete;
+        move_only_function& operator=(const move_only_function&) = delete;
+
+        move_only_function(move_only_function&& rhs)
+            : m_vtable(rhs.m_vtable)
+        {
+            if (m_vtable)
+            {
+                m_vtable->m_relocate(m_storage, rhs.m_storage);
+                rhs.m_vtable = nullptr;
+            }
+        }
+
+        ~move_only_function()
+        {
+            reset();
+        }
+
+        move_only_function& operator=(move_only_function&& rhs)
+        {
+            if (this != &rhs)
+            {
+                reset();
+                if (rhs.m_vtable)
+                {
+                    rhs.m_vtable->m_relocate(m_storage, rhs.m_storage);
+                    m_vtable = rhs.m_vtable;
+                    rhs.m_vtable = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        move_only_function& operator=(AZStd::nullptr_t)
+        {
+            reset();
+            return *this;
+        }
+
+        template<typename F, typename = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::decay_t<F>, move_only_function>>>
+        move_only_function& operator=(F&& f)
+        {
+            move_only_function(AZStd::forward<F>(f)).swap(*this);
+            return *this;
+        }
+
+        R operator()(Args... args)
+        {
+            AZ_Assert(m_vtable, "Bad function call!");
+            return m_vtable->m_invoke(m_storage, AZStd::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const
+        {
+            return m_vtable != nullptr;
+        }
+
+        void swap(move_only_function& rhs)
+        {
+            if (this == &rhs)
+            {
+                return;
+            }
+            move_only_function temp(AZStd::move(rhs));
+            rhs = AZStd::move(*this);
+            *this = AZStd::move(temp);
+        }
+
+    private:
+        void reset()
+        {
+            if (m_vtable)
+            {
+                m_vtable->m_destroy(m_storage);
+                m_vtable = nullptr;
+            }
+        }
+
+        const VTable* m_vtable = nullptr;
+        alignas(BufferAlignment) unsigned char m_storage[BufferSize];
+    };
+
+    template<typename Signature>
+    void swap(move_only_function<Signature>& lhs, move_only_function<Signature>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<typename Signature>
+    bool operator==(const move_only_function<Signature>& f, AZStd::nullptr_t)
+    {
+        return !f;
+    }
+
+    template<typename Signature>
+    bool operator!=(const move_only_function<Signature>& f, AZStd::nullptr_t)
+    {
+        return static_cast<bool>(f);
+    }
+} // namespace AZStd
@@ -9,6 +9,8 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/std/algorithm.h>
 
+#include <string.h>
+
 namespace AZStd
 {
     static constexpr AZStd::size_t prime_list[] = {
@@ -29,4 +31,109 @@ namespace AZStd
         const AZStd::size_t* pos = AZStd::lower_bound(first, last, n);
         return (pos == last ? *(last - 1) : *pos);
     }
+
+    namespace Internal
+    {
+        constexpr AZ::u64 XXH64Prime1 = 0x9E3779B185EBCA87ull;
+        constexpr AZ::u64 XXH64Prime2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr AZ::u64 XXH64Prime3 = 0x165667B19E3779F9ull;
+        constexpr AZ::u64 XXH64Prime4 = 0x85EBCA77C2B2AE63ull;
+        constexpr AZ::u64 XXH64Prime5 = 0x27D4EB2F165667C5ull;
+
+        AZ_FORCE_INLINE AZ::u64 RotateLeft(AZ::u64 value, int bits)
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        AZ_FORCE_INLINE AZ::u64 Load64(const unsigned char* data)
+        {
+            AZ::u64 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        AZ_FORCE_INLINE AZ::u32 Load32(const unsigned char* data)
+        {
+            AZ::u32 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        AZ_FORCE_INLINE AZ::u64 XXH64Round(AZ::u64 accumulator, AZ::u64 input)
+        {
+            accumulator += input * XXH64Prime2;
+            accumulator = RotateLeft(accumulator, 31);
+            return accumulator * XXH64Prime1;
+        }
+
+        AZ_FORCE_INLINE AZ::u64 XXH64MergeRound(AZ::u64 accumulator, AZ::u64 value)
+        {
+            accumulator ^= XXH64Round(0, value);
+            return accumulator * XXH64Prime1 + XXH64Prime4;
+        }
+    }
+
+    AZ::u64 hash_bytes(const void* data, AZStd::size_t size, AZ::u64 seed)
+    {
+        using namespace Internal;
+
+        const unsigned char* input = static_cast<const unsigned char*>(data);
+        const unsigned char* const end = input + size;
+        AZ::u64 hash;
+
+        if (size >= 32)
+        {
+            // 4 independent accumulators, 32 bytes per iteration.
+            AZ::u64 v1 = seed + XXH64Prime1 + XXH64Prime2;
+            AZ::u64 v2 = seed + XXH64Prime2;
+            AZ::u64 v3 = seed;
+            AZ::u64 v4 = seed - XXH64Prime1;
+            const unsigned char* const limit = end - 32;
+            do
+            {
+                v1 = XXH64Round(v1, Load64(input));
+                v2 = XXH64Round(v2, Load64(input + 8));
+                v3 = XXH64Round(v3, Load64(input + 16));
+                v4 = XXH64Round(v4, Load64(input + 24));
+                input += 32;
+            } while (input <= limit);
+
+            hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+            hash = XXH64MergeRound(hash, v1);
+            hash = XXH64MergeRound(hash, v2);
+            hash = XXH64MergeRound(hash, v3);
+            hash = XXH64MergeRound(hash, v4);
+        }
+        else
+        {
+            hash = seed + XXH64Prime5;
+        }
+
+        hash += static_cast<AZ::u64>(size);
+
+        for (; input + 8 <= end; input += 8)
+        {
+            hash ^= XXH64Round(0, Load64(input));
+            hash = RotateLeft(hash, 27) * XXH64Prime1 + XXH64Prime4;
+        }
+        if (input + 4 <= end)
+        {
+            hash ^= static_cast<AZ::u64>(Load32(input)) * XXH64Prime1;
+            hash = RotateLeft(hash, 23) * XXH64Prime2 + XXH64Prime3;
+            input += 4;
+        }
+        for (; input < end; ++input)
+        {
+            hash ^= (*input) * XXH64Prime5;
+            hash = RotateLeft(hash, 11) * XXH64Prime1;
+        }
+
+        // Final avalanche.
+        hash ^= hash >> 33;
+        hash *= XXH64Prime2;
+        hash ^= hash >> 29;
+        hash *= XXH64Prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
 }
@@ -213,6 +213,29 @@ namespace AZStd
 
     // Bucket size suitable to hold n elements.
     AZStd::size_t hash_next_bucket_size(AZStd::size_t n);
+
+    /**
+     * Fast non cryptographic 64 bit hash of a buffer (the XXH64 algorithm), several times faster than the byte per byte
+     * FNV-1a hash of hash<basic_string> for the strings longer than a few characters.
+     * It is not constexpr and its values are not stable across versions, don't store them.
+     */
+    AZ::u64 hash_bytes(const void* data, AZStd::size_t size, AZ::u64 seed = 0);
+
+    /**
+     * Hasher of the string types with hash_bytes, for the hash containers keyed by strings whose hashes are not stored,
+     * like AZStd::flat_hash_map<AZStd::string, T, AZStd::fast_string_hash>.
+     * It is transparent, the strings and the string views of the same characters have the same hash.
+     */
+    struct fast_string_hash
+    {
+        using is_transparent = void;
+
+        template<class String>
+        AZStd::size_t operator()(const String& value) const
+        {
+            return static_cast<AZStd::size_t>(hash_bytes(value.data(), value.size() * sizeof(*value.data())));
+        }
+    };
 }
 
 #endif // AZSTD_HASH_H
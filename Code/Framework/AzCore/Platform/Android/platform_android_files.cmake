@@ -42,6 +42,7 @@ set(FILES
     AzCore/IO/SystemFile_Platform.h
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/Unimplemented/AzCore/Memory/OverrunDetectionAllocator_Unimplemented.h
+    ../Common/Unimplemented/AzCore/Jobs/Internal/JobFiber_Unimplemented.cpp
     ../Common/UnixLike/AzCore/Memory/OSAllocator_UnixLike.h
     AzCore/Memory/HeapSchema_Android.cpp
     AzCore/Memory/OSAllocator_Platform.h
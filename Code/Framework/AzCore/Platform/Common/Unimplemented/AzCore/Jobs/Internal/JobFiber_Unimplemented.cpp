@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+
+namespace AZ::Internal::JobFibers
+{
+    bool IsSupported()
+    {
+        return false;
+    }
+
+    JobFiber* ConvertThreadToFiber()
+    {
+        AZ_Assert(false, "Fibers are not supported on this platform");
+        return nullptr;
+    }
+
+    void ConvertFiberToThread([[maybe_unused]] JobFiber* threadFiber)
+    {
+        AZ_Assert(false, "Fibers are not supported on this platform");
+    }
+
+    JobFiber* CreateFiber([[maybe_unused]] size_t stackSize, [[maybe_unused]] EntryPoint entryPoint, [[maybe_unused]] void* userData)
+    {
+        AZ_Assert(false, "Fibers are not supported on this platform");
+        return nullptr;
+    }
+
+    void DestroyFiber([[maybe_unused]] JobFiber* fiber)
+    {
+        AZ_Assert(false, "Fibers are not supported on this platform");
+    }
+
+    void SwitchToFiber([[maybe_unused]] JobFiber* from, [[maybe_unused]] JobFiber* to)
+    {
+        AZ_Assert(false, "Fibers are not supported on this platform");
+    }
+} // namespace AZ::Internal::JobFibers
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::Internal
+{
+    struct JobFiber
+    {
+        AZ_CLASS_ALLOCATOR(JobFiber, SystemAllocator, 0);
+
+        LPVOID m_fiber = nullptr;
+        JobFibers::EntryPoint m_entryPoint = nullptr;
+        void* m_userData = nullptr;
+        // False if the thread was already running as a fiber before ConvertThreadToFiber was called
+        bool m_convertedThread = false;
+    };
+
+    namespace JobFibers
+    {
+        static VOID WINAPI FiberProc(LPVOID parameter)
+        {
+            JobFiber* fiber = static_cast<JobFiber*>(parameter);
+            fiber->m_entryPoint(fiber->m_userData);
+            AZ_Assert(false, "Job fiber entry points must never return");
+        }
+
+        bool IsSupported()
+        {
+            return true;
+        }
+
+        JobFiber* ConvertThreadToFiber()
+        {
+            JobFiber* fiber = aznew JobFiber;
+            fiber->m_fiber = ::ConvertThreadToFiber(nullptr);
+            if (fiber->m_fiber)
+            {
+                fiber->m_convertedThread = true;
+            }
+            else
+            {
+                AZ_Assert(GetLastError() == ERROR_ALREADY_FIBER, "Failed to convert thread to a fiber");
+                fiber->m_fiber = ::GetCurrentFiber();
+            }
+            return fiber;
+        }
+
+        void ConvertFiberToThread(JobFiber* threadFiber)
+        {
+            if (threadFiber->m_convertedThread)
+            {
+                ::ConvertFiberToThread();
+            }
+            delete threadFiber;
+        }
+
+        JobFiber* CreateFiber(size_t stackSize, EntryPoint entryPoint, void* userData)
+        {
+            JobFiber* fiber = aznew JobFiber;
+            fiber->m_entryPoint = entryPoint;
+            fiber->m_userData = userData;
+            fiber->m_fiber = ::CreateFiber(stackSize, &FiberProc, fiber);
+            if (!fiber->m_fiber)
+            {
+                AZ_Error("JobFiber", false, "Failed to create a fiber with a %zu byte stack", stackSize);
+                delete fiber;
+                return nullptr;
+            }
+            return fiber;
+        }
+
+        void DestroyFiber(JobFiber* fiber)
+        {
+            ::DeleteFiber(fiber->m_fiber);
+            delete fiber;
+        }
+
+        void SwitchToFiber([[maybe_unused]] JobFiber* from, JobFiber* to)
+        {
+            ::SwitchToFiber(to->m_fiber);
+        }
+    } // namespace JobFibers
+} // namespace AZ::Internal
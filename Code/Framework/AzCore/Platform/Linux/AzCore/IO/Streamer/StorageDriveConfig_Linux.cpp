@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!StorageDriveLinux::IsSupported())
+        {
+            AZ_Printf("Streamer", "io_uring isn't supported by the kernel, reads will be serviced by the next storage drive.\n");
+            return parent;
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableDirectReads = m_enableDirectReads;
+        options.m_enableRegisteredFiles = m_enableRegisteredFiles;
+        options.m_minimalReporting = m_minimalReporting;
+
+        // The hardware information is a generic estimate on Linux, so use the largest sector size for all alignments
+        // to be sure direct reads meet the requirements of the underlying device.
+        const size_t sectorSize = AZStd::max(hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize);
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+            m_maxFileHandles, m_maxMetaDataCache, sectorSize, sectorSize, m_ioChannelCount, m_overcommit, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("IoChannelCount", &LinuxStorageDriveConfig::m_ioChannelCount)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableDirectReads", &LinuxStorageDriveConfig::m_enableDirectReads)
+                ->Field("EnableRegisteredFiles", &LinuxStorageDriveConfig::m_enableRegisteredFiles)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    //! Adds a StorageDriveLinux in front of the provided stack if the kernel supports io_uring. If io_uring isn't
+    //! supported the stack is returned unchanged, so this should be added after a catch-all drive such as the
+    //! one created by StorageDriveConfig.
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{6C5F6D0A-3E0B-4C3E-9E2B-8F0B4C1A7D52}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator, 0);
+
+        ~LinuxStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::u32 m_ioChannelCount{ 32 };
+        AZ::s32 m_overcommit{ 8 };
+        bool m_enableDirectReads{ true };
+        bool m_enableRegisteredFiles{ true };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
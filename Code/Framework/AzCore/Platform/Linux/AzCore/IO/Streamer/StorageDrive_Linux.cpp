@@ -0,0 +1,1191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    // glibc doesn't provide wrappers for the io_uring system calls.
+    static int IoUringSetup(u32 entryCount, io_uring_params* params)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entryCount, params));
+    }
+
+    static int IoUringEnter(int ringFd, u32 submitCount, u32 minCompleteCount, u32 flags)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ringFd, submitCount, minCompleteCount, flags, nullptr, 0));
+    }
+
+    static int IoUringRegister(int ringFd, u32 opcode, const void* arg, u32 argCount)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ringFd, opcode, arg, argCount));
+    }
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_enableDirectReads(true)
+        , m_enableRegisteredFiles(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 ioChannelCount, s32 overCommit, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(AZ::GetMax(maxFileHandles, 1u))
+        , m_ioChannelCount(ioChannelCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        // Cap the IO channels to the maximum
+        if (m_ioChannelCount == 0)
+        {
+            m_ioChannelCount = MaxIoChannelCount;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received io channel count of 0 for %s. Picking a count of %u instead.\n", m_name.c_str(), MaxIoChannelCount);
+        }
+        else
+        {
+            m_ioChannelCount = AZ::GetMin(m_ioChannelCount, MaxIoChannelCount);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_ioChannelCount) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the number of IO channels (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_ioChannelCount);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_ioChannelCount);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, -1);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+        m_fileCache_isDirect.resize(m_maxFileHandles, false);
+        m_fileCache_isRegistered.resize(m_maxFileHandles, false);
+
+        m_readSlots_readInfo.resize(m_ioChannelCount);
+        m_readSlots_active.resize(m_ioChannelCount, false);
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        // Closing the ring also releases the registered files.
+        DestroyRing();
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsSupported()
+    {
+        static const bool isSupported = []()
+        {
+            io_uring_params params{};
+            int ringFd = IoUringSetup(1, &params);
+            if (ringFd < 0)
+            {
+                // Either the kernel is too old or io_uring has been disabled, for instance by a container's seccomp profile.
+                return false;
+            }
+
+            // Opcode probing was added in the same kernel version (5.6) as IORING_OP_READ, so a failing probe means the
+            // required opcodes aren't available either.
+            alignas(io_uring_probe) u8 probeBuffer[sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op)]{};
+            auto probe = reinterpret_cast<io_uring_probe*>(probeBuffer);
+            bool result = false;
+            if (IoUringRegister(ringFd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) == 0)
+            {
+                auto isOpSupported = [probe](u8 op)
+                {
+                    return op < probe->ops_len && (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+                };
+                result = isOpSupported(IORING_OP_READ) && isOpSupported(IORING_OP_ASYNC_CANCEL);
+            }
+            ::close(ringFd);
+            return result;
+        }();
+        return isSupported;
+    }
+
+    bool StorageDriveLinux::InitializeRing()
+    {
+        AZ_Assert(m_context, "The io_uring instance is created when the context is set, but no context was provided.");
+
+        if (!m_context->GetStreamerThreadSynchronizer().AreIoEventsAvailable())
+        {
+            AZ_Warning("StorageDriveLinux", false, "No IO events available to wake up the scheduler for %s.\n", m_name.c_str());
+            return false;
+        }
+
+        // Room for a cancel for every active read.
+        io_uring_params params{};
+        m_ring.m_ringFd = IoUringSetup(m_ioChannelCount * 2, &params);
+        if (m_ring.m_ringFd < 0)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Failed to create io_uring instance for %s (Error: %i).\n", m_name.c_str(), errno);
+            return false;
+        }
+
+        m_ring.m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_ring.m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_ring.m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+        auto mapRing = [this](size_t size, off_t offset) -> void*
+        {
+            void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring.m_ringFd, offset);
+            return memory != MAP_FAILED ? memory : nullptr;
+        };
+        m_ring.m_submissionRingMemory = mapRing(m_ring.m_submissionRingSize, IORING_OFF_SQ_RING);
+        m_ring.m_completionRingMemory = mapRing(m_ring.m_completionRingSize, IORING_OFF_CQ_RING);
+        m_ring.m_submissionEntries = reinterpret_cast<io_uring_sqe*>(mapRing(m_ring.m_submissionEntriesSize, IORING_OFF_SQES));
+        if (!m_ring.m_submissionRingMemory || !m_ring.m_completionRingMemory || !m_ring.m_submissionEntries)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Failed to map the io_uring memory for %s (Error: %i).\n", m_name.c_str(), errno);
+            DestroyRing();
+            return false;
+        }
+
+        auto submissionRing = reinterpret_cast<u8*>(m_ring.m_submissionRingMemory);
+        m_ring.m_submissionHead = reinterpret_cast<u32*>(submissionRing + params.sq_off.head);
+        m_ring.m_submissionTail = reinterpret_cast<u32*>(submissionRing + params.sq_off.tail);
+        m_ring.m_submissionArray = reinterpret_cast<u32*>(submissionRing + params.sq_off.array);
+        m_ring.m_submissionMask = *reinterpret_cast<u32*>(submissionRing + params.sq_off.ring_mask);
+        m_ring.m_submissionEntryCount = *reinterpret_cast<u32*>(submissionRing + params.sq_off.ring_entries);
+        m_ring.m_localSubmissionTail = *m_ring.m_submissionTail;
+
+        auto completionRing = reinterpret_cast<u8*>(m_ring.m_completionRingMemory);
+        m_ring.m_completionHead = reinterpret_cast<u32*>(completionRing + params.cq_off.head);
+        m_ring.m_completionTail = reinterpret_cast<u32*>(completionRing + params.cq_off.tail);
+        m_ring.m_completionMask = *reinterpret_cast<u32*>(completionRing + params.cq_off.ring_mask);
+        m_ring.m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRing + params.cq_off.cqes);
+
+        // The kernel signals the eventfd whenever a completion is posted, which wakes up the scheduler thread.
+        m_ring.m_eventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (m_ring.m_eventFd < 0 || IoUringRegister(m_ring.m_ringFd, IORING_REGISTER_EVENTFD, &m_ring.m_eventFd, 1) != 0)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Failed to register a completion event with io_uring for %s (Error: %i).\n",
+                m_name.c_str(), errno);
+            DestroyRing();
+            return false;
+        }
+        m_context->GetStreamerThreadSynchronizer().AddIoEvent(m_ring.m_eventFd);
+
+        if (m_constructionOptions.m_enableRegisteredFiles)
+        {
+            // Reserve a sparse table with a slot for every entry in the file handle cache.
+            AZStd::vector<int> files(m_maxFileHandles, -1);
+            m_useRegisteredFiles = IoUringRegister(m_ring.m_ringFd, IORING_REGISTER_FILES, files.data(), m_maxFileHandles) == 0;
+            AZ_Warning("StorageDriveLinux", m_useRegisteredFiles,
+                "Failed to register files with io_uring for %s, falling back to unregistered files (Error: %i).\n", m_name.c_str(), errno);
+        }
+
+        return true;
+    }
+
+    void StorageDriveLinux::DestroyRing()
+    {
+        if (m_ring.m_submissionEntries)
+        {
+            ::munmap(m_ring.m_submissionEntries, m_ring.m_submissionEntriesSize);
+        }
+        if (m_ring.m_completionRingMemory)
+        {
+            ::munmap(m_ring.m_completionRingMemory, m_ring.m_completionRingSize);
+        }
+        if (m_ring.m_submissionRingMemory)
+        {
+            ::munmap(m_ring.m_submissionRingMemory, m_ring.m_submissionRingSize);
+        }
+        if (m_ring.m_ringFd >= 0)
+        {
+            ::close(m_ring.m_ringFd);
+        }
+        if (m_ring.m_eventFd >= 0)
+        {
+            // The synchronizer is owned by the context which is destroyed before the stack, so the event isn't removed from it.
+            ::close(m_ring.m_eventFd);
+        }
+        m_ring = Ring{};
+        m_useRegisteredFiles = false;
+    }
+
+    io_uring_sqe* StorageDriveLinux::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_ring.m_submissionHead, __ATOMIC_ACQUIRE);
+        const u32 tail = m_ring.m_localSubmissionTail;
+        if (tail - head >= m_ring.m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = tail & m_ring.m_submissionMask;
+        io_uring_sqe* entry = &m_ring.m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_ring.m_submissionArray[index] = index;
+        m_ring.m_localSubmissionTail = tail + 1;
+        m_unsubmittedEntryCount++;
+        return entry;
+    }
+
+    void StorageDriveLinux::SubmitEntries()
+    {
+        if (m_unsubmittedEntryCount == 0)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::SubmitEntries %s", m_name.c_str());
+
+        // Publish the new entries to the kernel and submit all of them with a single system call.
+        __atomic_store_n(m_ring.m_submissionTail, m_ring.m_localSubmissionTail, __ATOMIC_RELEASE);
+        int result = IoUringEnter(m_ring.m_ringFd, m_unsubmittedEntryCount, 0, 0);
+        if (result >= 0)
+        {
+            m_submissionBatchSizeAverage.PushEntry(aznumeric_cast<u64>(result));
+            m_unsubmittedEntryCount -= aznumeric_cast<u32>(result);
+        }
+        else
+        {
+            // On EAGAIN or EBUSY the kernel is temporarily out of resources. The entries stay in the ring and will be
+            // submitted again during the next call.
+            AZ_Error("StorageDriveLinux", errno == EAGAIN || errno == EBUSY || errno == EINTR,
+                "io_uring_enter failed with error: %i\n", errno);
+        }
+    }
+
+    void StorageDriveLinux::SetContext(StreamerContext& context)
+    {
+        StreamStackEntry::SetContext(context);
+        if (!m_ringInitialized)
+        {
+            // The ring is created here as this is called from the scheduler thread, which is the thread that will wait for completions.
+            m_ringAvailable = InitializeRing();
+            m_ringInitialized = true;
+            AZ_Warning("StorageDriveLinux", m_ringAvailable, "%s is unavailable. All requests will be forwarded.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (m_ringAvailable && AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (!m_ringAvailable)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        if (!m_ringAvailable)
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        if (!m_pendingReadRequests.empty())
+        {
+            // Queue as many reads as there are channels available so they can be submitted together.
+            while (!m_pendingReadRequests.empty() && ReadRequest(m_pendingReadRequests.front()))
+            {
+                m_pendingReadRequests.pop_front();
+                hasWorked = true;
+            }
+        }
+        else if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand());
+        }
+
+        // This also submits the reads that were queued when finalizing reads and any pending cancellations.
+        SubmitEntries();
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        if (m_ringAvailable || !m_ringInitialized)
+        {
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+            status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+        }
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        if (!m_ringAvailable)
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime + AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData> ||
+                          AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                          AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_ioChannelCount)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - aznumeric_cast<s32>(m_activeReads_Count);
+    }
+
+    auto StorageDriveLinux::OpenFile(size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data) -> OpenFileResult
+    {
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex == InvalidFileCacheIndex)
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+            TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+            // Direct reads bypass the page cache and transfer straight into the output buffer. Not every file system
+            // supports O_DIRECT, in which case the file is opened for buffered reads.
+            constexpr int openFlags = O_RDONLY | O_CLOEXEC;
+            bool isDirect = m_constructionOptions.m_enableDirectReads;
+            int file = isDirect ? ::open(data.m_path.GetAbsolutePath(), openFlags | O_DIRECT) : -1;
+            if (file < 0 && (!isDirect || errno == EINVAL))
+            {
+                isDirect = false;
+                file = ::open(data.m_path.GetAbsolutePath(), openFlags);
+            }
+
+            if (file < 0)
+            {
+                // Failed to open the file, so let the next entry in the stack try.
+                StreamStackEntry::QueueRequest(request);
+                return OpenFileResult::RequestForwarded;
+            }
+
+            CloseFile(cacheIndex);
+
+            bool isRegistered = false;
+            if (m_useRegisteredFiles)
+            {
+                io_uring_files_update update{};
+                update.offset = aznumeric_cast<u32>(cacheIndex);
+                update.fds = reinterpret_cast<u64>(&file);
+                isRegistered = IoUringRegister(m_ring.m_ringFd, IORING_REGISTER_FILES_UPDATE, &update, 1) == 1;
+                AZ_Warning("StorageDriveLinux", isRegistered, "Failed to register '%s' with io_uring (Error: %i).\n",
+                    data.m_path.GetRelativePath(), errno);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+            m_fileCache_isRegistered[cacheIndex] = isRegistered;
+        }
+
+        AZ_Assert(m_fileCache_handles[cacheIndex] >= 0, "While searching for file '%s' in StorageDriveLinux::OpenFile failed to detect a problem.",
+            data.m_path.GetRelativePath());
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    void StorageDriveLinux::CloseFile(size_t cacheSlot)
+    {
+        if (m_fileCache_handles[cacheSlot] >= 0)
+        {
+            if (m_fileCache_isRegistered[cacheSlot])
+            {
+                int noFile = -1;
+                io_uring_files_update update{};
+                update.offset = aznumeric_cast<u32>(cacheSlot);
+                update.fds = reinterpret_cast<u64>(&noFile);
+                IoUringRegister(m_ring.m_ringFd, IORING_REGISTER_FILES_UPDATE, &update, 1);
+                m_fileCache_isRegistered[cacheSlot] = false;
+            }
+            ::close(m_fileCache_handles[cacheSlot]);
+            m_fileCache_handles[cacheSlot] = -1;
+        }
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        if (m_activeReads_Count >= m_ioChannelCount)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        io_uring_sqe* entry = GetSubmissionEntry();
+        if (!entry)
+        {
+            // The ring is full with cancellations that haven't been submitted yet, so try again after the next submit.
+            return false;
+        }
+
+        u32 readSize = aznumeric_cast<u32>(data->m_size);
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (m_fileCache_isDirect[fileCacheSlot])
+        {
+            // Direct reads require the size, offset, and address to be aligned to the sector sizes. If any are unaligned
+            // the read is widened to the surrounding sectors and done into an internally allocated buffer, the same as
+            // the unbuffered reads in StorageDriveWin.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            // Align the offset down to the next lowest sector and store the adjustment in copyBackOffset so only the
+            // requested data is copied back once the read completes.
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = aznumeric_cast<u32>(data->m_size + offsetCorrection);
+            }
+
+            // If the output buffer has room for it, round the size up so the read can still go directly into the output.
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u32 alignedReadSize = aznumeric_caster(AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize));
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = aznumeric_cast<u32>(AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize));
+                readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                output = readInfo.m_sectorAlignedOutput;
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        entry->opcode = IORING_OP_READ;
+        if (m_fileCache_isRegistered[fileCacheSlot])
+        {
+            entry->fd = aznumeric_cast<s32>(fileCacheSlot);
+            entry->flags = IOSQE_FIXED_FILE;
+        }
+        else
+        {
+            entry->fd = m_fileCache_handles[fileCacheSlot];
+        }
+        entry->off = readOffs;
+        entry->addr = reinterpret_cast<u64>(output);
+        entry->len = readSize;
+        entry->user_data = readSlot;
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        m_fileSwitchPercentageStat.PushSample(m_activeCacheSlot == fileCacheSlot ? 0.0 : 1.0);
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now ask the kernel to cancel any active reads. The cancellations are
+        // submitted together with the next batch of reads. Reads that can't be canceled will complete as usual.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (io_uring_sqe* entry = GetSubmissionEntry(); entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = NoReadSlotUserData;
+                }
+            }
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        if (FindInFileHandleCache(fileExists.m_path) != InvalidFileCacheIndex ||
+            FindInMetaDataCache(fileExists.m_path) != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &attributes) == 0)
+        {
+            if (S_ISREG(attributes.st_mode))
+            {
+                size_t cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+                fileExists.m_found = true;
+
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        int result = cacheIndex != InvalidFileCacheIndex
+            ? ::fstat(m_fileCache_handles[cacheIndex], &attributes)
+            : ::stat(command.m_path.GetAbsolutePath(), &attributes);
+        if (result != 0 || !S_ISREG(attributes.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(attributes.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        size_t cacheIndex = FindInFileHandleCache(filePath);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            CloseFile(cacheIndex);
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+            m_fileCache_paths[cacheIndex].Clear();
+        }
+
+        cacheIndex = FindInMetaDataCache(filePath);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            m_metaDataCache_paths[cacheIndex].Clear();
+            m_metaDataCache_fileSize[cacheIndex] = 0;
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        // Clear file handle cache
+        for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            CloseFile(cacheIndex);
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+            m_fileCache_paths[cacheIndex].Clear();
+        }
+
+        // Clear meta data cache
+        auto metaDataCacheSize = m_metaDataCache_paths.size();
+        m_metaDataCache_paths.clear();
+        m_metaDataCache_fileSize.clear();
+        m_metaDataCache_front = 0;
+        m_metaDataCache_paths.resize(metaDataCacheSize);
+        m_metaDataCache_fileSize.resize(metaDataCacheSize);
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // Completions are read straight from the ring that's shared with the kernel, which doesn't need a system call.
+        u32 head = *m_ring.m_completionHead;
+        const u32 tail = __atomic_load_n(m_ring.m_completionTail, __ATOMIC_ACQUIRE);
+        if (head == tail)
+        {
+            return false;
+        }
+
+        for (; head != tail; ++head)
+        {
+            const io_uring_cqe& completion = m_ring.m_completionEntries[head & m_ring.m_completionMask];
+            const u64 userData = completion.user_data;
+            const s32 result = completion.res;
+            // Release the entry before finalizing as that can queue up new reads.
+            __atomic_store_n(m_ring.m_completionHead, head + 1, __ATOMIC_RELEASE);
+
+            if (userData != NoReadSlotUserData)
+            {
+                FinalizeSingleRequest(aznumeric_cast<size_t>(userData), result);
+            }
+        }
+        return true;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        const bool isCanceled = result == -ECANCELED || result == -EINTR;
+        const bool encounteredError = result < 0 && !isCanceled;
+        const size_t numBytesTransferred = result > 0 ? aznumeric_cast<size_t>(result) : 0;
+        AZ_Error("StorageDriveLinux", !encounteredError, "Async file read operation completed with error code %i\n", -result);
+
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isSuccess = !encounteredError && !isCanceled && (readCommand->m_size + fileReadInfo.m_copyBackOffset <= numBytesTransferred);
+        if (fileReadInfo.m_sectorAlignedOutput && isSuccess)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(fileReadInfo.m_sectorAlignedOutput) + fileReadInfo.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+
+        // There's now a slot available to queue the next request, if there is one.
+        if (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request, readSlot))
+            {
+                m_pendingReadRequests.pop_front();
+            }
+        }
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_ringAvailable)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Entries per submit (avg.)", m_submissionBatchSizeAverage.CalculateAverage()));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case Requests::ReportType::FileLocks:
+            {
+                bool hasOpenFiles = false;
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                        hasOpenFiles = true;
+                    }
+                }
+                if (!hasOpenFiles)
+                {
+                    AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
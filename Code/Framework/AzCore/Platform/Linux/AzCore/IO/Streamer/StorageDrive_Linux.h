@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <linux/io_uring.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct ReadData;
+        struct ReportData;
+    }
+
+    //! Storage drive that reads files through io_uring. Reads are queued in a submission ring and all reads that were
+    //! queued during a single call to ExecuteRequests are submitted to the kernel with one system call. Completions are
+    //! picked up from the completion ring without system calls and the scheduler thread is woken up through an eventfd
+    //! that's registered with the ring. Files can be opened with O_DIRECT to bypass the page cache and registered with
+    //! the ring so the kernel doesn't need to look up the file for every read.
+    //! Requests this drive can't handle, such as files it fails to open, are forwarded to the next entry in the stack.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        static constexpr u32 MaxIoChannelCount = 256;
+
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+            //! Open files with O_DIRECT for reads that bypass the page cache. Files on file systems that don't support this
+            //! will be opened with regular buffered IO instead.
+            u8 m_enableDirectReads : 1;
+            //! Register the open file descriptors with the io_uring instance.
+            u8 m_enableRegisteredFiles : 1;
+            //! If true, only information that's explicitly requested or issues are reported.
+            u8 m_minimalReporting : 1;
+        };
+
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 ioChannelCount, s32 overCommit, ConstructionOptions options);
+        StorageDriveLinux(const StorageDriveLinux&) = delete;
+        StorageDriveLinux& operator=(const StorageDriveLinux&) = delete;
+        ~StorageDriveLinux() override;
+
+        //! Checks if the running kernel supports the io_uring features used by this drive.
+        static bool IsSupported();
+
+        void SetContext(StreamerContext& context) override;
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        //! User data for submissions that don't have a read slot associated with them, such as cancellations.
+        static constexpr u64 NoReadSlotUserData = std::numeric_limits<u64>::max();
+
+        struct FileReadInformation
+        {
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr }; // Internally allocated buffer that is sector aligned.
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u64 m_copyBackOffset{ 0 };
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        //! The memory shared with the kernel for an io_uring instance.
+        struct Ring
+        {
+            u32* m_submissionHead{ nullptr };
+            u32* m_submissionTail{ nullptr };
+            u32* m_submissionArray{ nullptr };
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            u32 m_submissionMask{ 0 };
+            u32 m_submissionEntryCount{ 0 };
+            //! Tail of the entries that have been filled in, which is published to the kernel when they're submitted.
+            u32 m_localSubmissionTail{ 0 };
+
+            u32* m_completionHead{ nullptr };
+            u32* m_completionTail{ nullptr };
+            io_uring_cqe* m_completionEntries{ nullptr };
+            u32 m_completionMask{ 0 };
+
+            void* m_submissionRingMemory{ nullptr };
+            size_t m_submissionRingSize{ 0 };
+            void* m_completionRingMemory{ nullptr };
+            size_t m_completionRingSize{ 0 };
+            size_t m_submissionEntriesSize{ 0 };
+
+            int m_ringFd{ -1 };
+            int m_eventFd{ -1 };
+        };
+
+        bool InitializeRing();
+        void DestroyRing();
+        //! Returns the next free submission entry or null if the submission ring is full.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Submits all queued submission entries to the kernel in a single call.
+        void SubmitEntries();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request, AZStd::chrono::system_clock::time_point startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        OpenFileResult OpenFile(size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        void CloseFile(size_t cacheSlot);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_submissionBatchSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+
+        Ring m_ring;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+        AZStd::vector<bool> m_fileCache_isRegistered;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_ioChannelCount{ 1 };
+        u32 m_activeReads_Count{ 0 };
+        //! Number of entries that have been added to the submission ring but not yet submitted to the kernel.
+        u32 m_unsubmittedEntryCount{ 0 };
+        s32 m_overCommit{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_ringInitialized{ false };
+        bool m_ringAvailable{ false };
+        bool m_useRegisteredFiles{ false };
+    };
+} // namespace AZ::IO
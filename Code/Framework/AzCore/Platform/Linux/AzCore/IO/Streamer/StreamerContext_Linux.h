@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <poll.h>
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    class StreamerContextThreadSync
+    {
+    public:
+        //! The maximum number of file descriptors, such as the eventfd of an io_uring instance, that can wake up the scheduler thread.
+        static constexpr size_t MaxIoEvents = 15;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds a file descriptor that wakes up the scheduler thread when it becomes readable. The descriptor has to be
+        //! an eventfd as its counter is reset when the scheduler thread wakes up. Ownership stays with the caller.
+        bool AddIoEvent(int eventFd);
+        void RemoveIoEvent(int eventFd);
+        size_t GetIoEventCount() const;
+        bool AreIoEventsAvailable() const;
+
+    private:
+        // Note: The first event is reserved for the synchronization of the scheduler thread with
+        // the rest of the engine. The remaining events can be freely used by Streamer's internals.
+        pollfd m_events[MaxIoEvents + 1]{};
+        size_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+    };
+} // namespace AZ::Platform
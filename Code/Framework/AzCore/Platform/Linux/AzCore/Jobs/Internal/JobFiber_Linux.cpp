@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+namespace AZ::Internal
+{
+    struct JobFiber
+    {
+        AZ_CLASS_ALLOCATOR(JobFiber, SystemAllocator, 0);
+
+        ucontext_t m_context;
+        // Base of the mapping holding the stack, including the guard page. Null for fibers converted from a thread.
+        void* m_mapping = nullptr;
+        size_t m_mappingSize = 0;
+        JobFibers::EntryPoint m_entryPoint = nullptr;
+        void* m_userData = nullptr;
+    };
+
+    namespace JobFibers
+    {
+        // makecontext only forwards int arguments, so the fiber pointer is split in two halves
+        static void FiberTrampoline(unsigned int high, unsigned int low)
+        {
+            JobFiber* fiber = reinterpret_cast<JobFiber*>((static_cast<uintptr_t>(high) << 32) | static_cast<uintptr_t>(low));
+            fiber->m_entryPoint(fiber->m_userData);
+            AZ_Assert(false, "Job fiber entry points must never return");
+        }
+
+        bool IsSupported()
+        {
+            return true;
+        }
+
+        JobFiber* ConvertThreadToFiber()
+        {
+            // The context is filled in the first time the thread switches away
+            return aznew JobFiber;
+        }
+
+        void ConvertFiberToThread(JobFiber* threadFiber)
+        {
+            AZ_Assert(threadFiber->m_mapping == nullptr, "Fiber was not created from a thread");
+            delete threadFiber;
+        }
+
+        JobFiber* CreateFiber(size_t stackSize, EntryPoint entryPoint, void* userData)
+        {
+            const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            const size_t mappingSize = AZ::SizeAlignUp(stackSize, pageSize) + pageSize;
+
+            void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+            if (mapping == MAP_FAILED)
+            {
+                AZ_Error("JobFiber", false, "Failed to allocate a %zu byte fiber stack", stackSize);
+                return nullptr;
+            }
+            // Stacks grow down, protect the lowest page to turn an overflow into a fault instead of silent corruption
+            mprotect(mapping, pageSize, PROT_NONE);
+
+            JobFiber* fiber = aznew JobFiber;
+            fiber->m_mapping = mapping;
+            fiber->m_mappingSize = mappingSize;
+            fiber->m_entryPoint = entryPoint;
+            fiber->m_userData = userData;
+
+            getcontext(&fiber->m_context);
+            fiber->m_context.uc_stack.ss_sp = static_cast<char*>(mapping) + pageSize;
+            fiber->m_context.uc_stack.ss_size = mappingSize - pageSize;
+            fiber->m_context.uc_link = nullptr;
+
+            const uintptr_t address = reinterpret_cast<uintptr_t>(fiber);
+            makecontext(
+                &fiber->m_context, reinterpret_cast<void (*)()>(&FiberTrampoline), 2,
+                static_cast<unsigned int>(address >> 32), static_cast<unsigned int>(address & 0xffffffff));
+            return fiber;
+        }
+
+        void DestroyFiber(JobFiber* fiber)
+        {
+            if (fiber->m_mapping)
+            {
+                munmap(fiber->m_mapping, fiber->m_mappingSize);
+            }
+            delete fiber;
+        }
+
+        void SwitchToFiber(JobFiber* from, JobFiber* to)
+        {
+            swapcontext(&from->m_context, &to->m_context);
+        }
+    } // namespace JobFibers
+} // namespace AZ::Internal
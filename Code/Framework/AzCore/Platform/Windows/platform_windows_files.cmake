@@ -36,6 +36,7 @@ set(FILES
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
+    ../Common/WinAPI/AzCore/Jobs/Internal/JobFiber_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.h
     AzCore/IO/SystemFile_Platform.h
     AzCore/IO/Streamer/StorageDrive_Windows.h
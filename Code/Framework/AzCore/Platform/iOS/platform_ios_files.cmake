@@ -44,6 +44,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/Apple/AzCore/Memory/OSAllocator_Apple.h
     ../Common/Unimplemented/AzCore/Memory/OverrunDetectionAllocator_Unimplemented.h
+    ../Common/Unimplemented/AzCore/Jobs/Internal/JobFiber_Unimplemented.cpp
     AzCore/Memory/HeapSchema_iOS.cpp
     AzCore/Memory/OSAllocator_Platform.h
     AzCore/Memory/OverrunDetectionAllocator_Platform.h
@@ -9,8 +9,12 @@
 #include "UserTypes.h"
 
 #include <AzCore/std/functional.h>
+#include <AzCore/std/function/inplace_function.h>
+#include <AzCore/std/function/move_only_function.h>
 #include <AzCore/std/delegate/delegate.h>
 #include <AzCore/std/delegate/delegate_bind.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
@@ -1078,6 +1082,68 @@ namespace UnitTest
         EXPECT_EQ(0, s_functorCopyAssignmentCount);
     }
 
+    TEST_F(Function, InplaceFunction_StoresCapturesInline)
+    {
+        int sum = 0;
+        AZStd::array<int, 8> values = { { 1, 2, 3, 4, 5, 6, 7, 8 } };
+        AZStd::inplace_function<void(int), 64> addValues = [&sum, values](int multiplier)
+        {
+            for (int value : values)
+            {
+                sum += value * multiplier;
+            }
+        };
+        static_assert(sizeof(addValues) <= 64 + alignof(max_align_t), "inplace_function should only add a pointer to its capacity");
+
+        addValues(2);
+        EXPECT_EQ(72, sum);
+
+        AZStd::inplace_function<void(int), 64> copy = addValues;
+        copy(1);
+        EXPECT_EQ(108, sum);
+
+        AZStd::inplace_function<void(int), 64> moved = AZStd::move(copy);
+        EXPECT_FALSE(copy);
+        EXPECT_TRUE(moved);
+        moved = nullptr;
+        EXPECT_FALSE(moved);
+
+        AZStd::inplace_function<int(int, int)> functionPointer = [](int lhs, int rhs) { return lhs - rhs; };
+        EXPECT_EQ(3, functionPointer(5, 2));
+    }
+
+    TEST_F(Function, InplaceFunction_DestroysCapturedValues)
+    {
+        AZStd::shared_ptr<int> value = AZStd::make_shared<int>(5);
+        {
+            AZStd::inplace_function<int()> getValue = [value]() { return *value; };
+            AZStd::inplace_function<int()> copy = getValue;
+            EXPECT_EQ(3, value.use_count());
+            EXPECT_EQ(5, copy());
+        }
+        EXPECT_EQ(1, value.use_count());
+    }
+
+    TEST_F(Function, MoveOnlyFunction_AcceptsMoveOnlyCallables)
+    {
+        AZStd::move_only_function<int()> getValue = [value = AZStd::make_unique<int>(7)]() { return *value; };
+        EXPECT_EQ(7, getValue());
+
+        AZStd::move_only_function<int()> moved = AZStd::move(getValue);
+        EXPECT_FALSE(getValue);
+        EXPECT_EQ(7, moved());
+
+        // Too big for the inline buffer, stored on the heap
+        AZStd::array<int, 32> values{};
+        values[31] = 3;
+        AZStd::move_only_function<int(int)> big = [values, unique = AZStd::make_unique<int>(2)](int offset) { return values[31] + *unique + offset; };
+        EXPECT_EQ(6, big(1));
+        AZStd::move_only_function<int(int)> other;
+        AZStd::swap(big, other);
+        EXPECT_FALSE(big);
+        EXPECT_EQ(6, other(1));
+    }
+
     /**
     * Bind
     * We use tuned version of the boost::bind (which is in TR1), so we use the boost::bind tests too
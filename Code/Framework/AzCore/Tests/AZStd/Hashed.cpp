@@ -12,6 +12,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
 #include <AzCore/std/string/string.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -1157,6 +1159,167 @@ namespace UnitTest
         EXPECT_EQ(idx, map.size());
     }
 
+    TEST_F(HashedContainers, FlatHashMapBasic)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_EQ(map.end(), map.find(1));
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_TRUE(map.insert(AZStd::make_pair(i, i * 2)).second);
+        }
+        EXPECT_EQ(1000, map.size());
+        EXPECT_FALSE(map.insert(AZStd::make_pair(5, 0)).second);
+        EXPECT_EQ(10, map[5]);
+        EXPECT_EQ(10, map.at(5));
+        EXPECT_TRUE(map.contains(999));
+        EXPECT_FALSE(map.contains(1000));
+
+        size_t count = 0;
+        for (const auto& item : map)
+        {
+            EXPECT_EQ(item.first * 2, item.second);
+            ++count;
+        }
+        EXPECT_EQ(map.size(), count);
+
+        // Erase every other element while iterating, the other iterators stay valid when erasing
+        for (auto it = map.begin(); it != map.end();)
+        {
+            it = (it->first % 2) ? map.erase(it) : AZStd::next(it);
+        }
+        EXPECT_EQ(500, map.size());
+        EXPECT_EQ(0, map.erase(1));
+        EXPECT_EQ(1, map.erase(2));
+        EXPECT_EQ(499, map.size());
+
+        AZStd::flat_hash_map<int, int> copy = map;
+        EXPECT_EQ(map, copy);
+        copy[2] = 4;
+        EXPECT_NE(map, copy);
+
+        AZStd::flat_hash_map<int, int> moved = AZStd::move(copy);
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(500, moved.size());
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+        map.rehash(0);
+        EXPECT_EQ(0, map.capacity());
+        map.reserve(100);
+        const size_t capacity = map.capacity();
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, i);
+        }
+        EXPECT_EQ(capacity, map.capacity());
+    }
+
+    TEST_F(HashedContainers, FlatHashMapMatchesUnorderedMap)
+    {
+        // A hash with many collisions so that the probing, the tombstones and the rehash in place get exercised
+        struct CollidingHash
+        {
+            size_t operator()(int key) const { return static_cast<size_t>(key % 13); }
+        };
+        AZStd::flat_hash_map<int, int, CollidingHash> map;
+        AZStd::unordered_map<int, int> reference;
+        unsigned int seed = 1;
+        for (int i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int key = static_cast<int>((seed >> 8) % 300);
+            switch ((seed >> 4) % 3)
+            {
+            case 0:
+                map[key] = i;
+                reference[key] = i;
+                break;
+            case 1:
+                EXPECT_EQ(reference.erase(key), map.erase(key));
+                break;
+            default:
+            {
+                auto it = map.find(key);
+                auto referenceIt = reference.find(key);
+                ASSERT_EQ(referenceIt == reference.end(), it == map.end());
+                if (it != map.end())
+                {
+                    EXPECT_EQ(referenceIt->second, it->second);
+                }
+                break;
+            }
+            }
+            ASSERT_EQ(reference.size(), map.size());
+        }
+        for (const auto& item : map)
+        {
+            EXPECT_EQ(reference[item.first], item.second);
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashMapNonTrivialValue)
+    {
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.try_emplace(AZStd::string::format("key%d", i), "value");
+        }
+        EXPECT_FALSE(map.try_emplace(AZStd::string("key1"), "other").second);
+        EXPECT_EQ("value", map.at("key1"));
+        EXPECT_FALSE(map.insert_or_assign(AZStd::string("key1"), AZStd::string("other")).second);
+        EXPECT_EQ("other", map.at("key1"));
+        EXPECT_EQ(1, AZStd::erase_if(map, [](const auto& item) { return item.second == "other"; }));
+        EXPECT_EQ(99, map.size());
+    }
+
+    TEST_F(HashedContainers, FlatHashSetBasic)
+    {
+        AZStd::flat_hash_set<int> set{ 1, 2, 3, 3 };
+        EXPECT_EQ(3, set.size());
+        EXPECT_TRUE(set.contains(2));
+        EXPECT_EQ(1, set.count(3));
+        EXPECT_FALSE(set.insert(1).second);
+        EXPECT_TRUE(set.emplace(4).second);
+        EXPECT_EQ(1, set.erase(1));
+        EXPECT_EQ(set.end(), set.find(1));
+
+        AZStd::flat_hash_set<int> other{ 2, 3, 4 };
+        EXPECT_EQ(set, other);
+        other.swap(set);
+        EXPECT_EQ(3, set.size());
+    }
+
+    TEST_F(HashedContainers, HashBytes_MatchesReferenceValues)
+    {
+        // XXH64 reference values.
+        EXPECT_EQ(0xEF46DB3751D8E999ull, AZStd::hash_bytes("", 0));
+        EXPECT_EQ(0xD24EC4F1A98C6E5Bull, AZStd::hash_bytes("a", 1));
+        EXPECT_EQ(0x44BC2CF5AD770999ull, AZStd::hash_bytes("abc", 3));
+
+        // Every size up to 2 blocks of 32 bytes hashes differently, and the seed changes the hash.
+        const char text[] = "The quick brown fox jumps over the lazy dog, again and again.";
+        AZStd::flat_hash_set<AZ::u64> hashes;
+        for (size_t size = 0; size < sizeof(text); ++size)
+        {
+            EXPECT_TRUE(hashes.insert(AZStd::hash_bytes(text, size)).second);
+        }
+        EXPECT_NE(AZStd::hash_bytes(text, sizeof(text), 1), AZStd::hash_bytes(text, sizeof(text)));
+    }
+
+    TEST_F(HashedContainers, FastStringHash_IsTransparent)
+    {
+        AZStd::flat_hash_map<AZStd::string, int, AZStd::fast_string_hash> map;
+        map.emplace("first", 1);
+        map.emplace("second", 2);
+        EXPECT_EQ(AZStd::fast_string_hash{}(AZStd::string("first")), AZStd::fast_string_hash{}(AZStd::string_view("first")));
+        EXPECT_EQ(2, map.at("second"));
+        EXPECT_EQ(map.end(), map.find("third"));
+    }
+
     template<typename ContainerType>
     class HashedSetContainers
         : public AllocatorsFixture
@@ -2222,6 +2385,30 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
 #endif
 } // namespace UnitTest
 
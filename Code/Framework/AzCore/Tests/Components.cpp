@@ -599,6 +599,25 @@ namespace UnitTest
     };
     //////////////////////////////////////////////////////////////////////////
 
+    //////////////////////////////////////////////////////////////////////////
+    // Component Q - provides a service and can be activated on any thread
+    class ComponentQ
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(ComponentQ, "{6F3B0D55-5C2A-4E0B-9F1D-2B7C4E8A9D13}");
+
+        void Activate() override { m_isActive = true; }
+        void Deactivate() override { m_isActive = false; }
+
+        static void GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided) { provided.push_back(AZ_CRC("ServiceQ")); }
+        static bool IsActivationThreadSafe() { return true; }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+
+        AZStd::atomic_bool m_isActive{ false };
+    };
+    //////////////////////////////////////////////////////////////////////////
+
     class ComponentDependency
         : public Components
     {
@@ -625,6 +644,7 @@ namespace UnitTest
             aznew ComponentN::DescriptorType;
             aznew ComponentO::DescriptorType;
             aznew ComponentP::DescriptorType;
+            aznew ComponentQ::DescriptorType;
 
             m_componentApp = aznew ComponentApplication();
 
@@ -778,6 +798,65 @@ namespace UnitTest
         EXPECT_TRUE(components[4]->RTTI_IsTypeOf(AzTypeInfo<ComponentC>::Uuid()));
     }
 
+    TEST_F(ComponentDependency, EntityWithSameComponents_ReusesCachedSortOrder)
+    {
+        CreateComponents_ABCDE();
+        Entity::ComponentArrayType unsortedComponents = m_entity->GetComponents();
+
+        // a clone has components of the same types and ids in the same order
+        Entity clone;
+        clone.CreateComponent<ComponentA>();
+        clone.CreateComponent<ComponentB>();
+        clone.CreateComponent<ComponentC>();
+        clone.CreateComponent<ComponentD>();
+        clone.CreateComponent<ComponentE>();
+        for (size_t i = 0; i < unsortedComponents.size(); ++i)
+        {
+            clone.GetComponents()[i]->SetId(unsortedComponents[i]->GetId());
+        }
+
+        EXPECT_EQ(Entity::DependencySortResult::Success, m_entity->EvaluateDependencies());
+
+        m_descriptorComponentA->m_isDependent = true; // now A should depend on D, which the cached order doesn't know about
+
+        EXPECT_EQ(Entity::DependencySortResult::Success, clone.EvaluateDependencies());
+        for (size_t i = 0; i < unsortedComponents.size(); ++i)
+        {
+            EXPECT_EQ(m_entity->GetComponents()[i]->GetId(), clone.GetComponents()[i]->GetId());
+        }
+
+        // invalidating discards the cached order
+        clone.InvalidateDependencies();
+        EXPECT_EQ(Entity::DependencySortResult::Success, clone.EvaluateDependencies());
+        EXPECT_TRUE(clone.GetComponents()[0]->RTTI_IsTypeOf(AzTypeInfo<ComponentD>::Uuid()));
+        EXPECT_TRUE(clone.GetComponents()[1]->RTTI_IsTypeOf(AzTypeInfo<ComponentA>::Uuid()));
+    }
+
+    TEST_F(ComponentDependency, ActivateEntities_ActivatesAllEntitiesAndComponents)
+    {
+        CreateComponents_ABCDE();
+        ComponentQ* componentQ = m_entity->CreateComponent<ComponentQ>();
+        m_entity->Init();
+
+        Entity otherEntity;
+        ComponentQ* otherComponentQ = otherEntity.CreateComponent<ComponentQ>();
+        otherEntity.CreateComponent<ComponentP>();
+        otherEntity.Init();
+
+        Entity::ActivateEntities({ m_entity, &otherEntity });
+
+        EXPECT_EQ(Entity::State::Active, m_entity->GetState());
+        EXPECT_EQ(Entity::State::Active, otherEntity.GetState());
+        EXPECT_TRUE(componentQ->m_isActive);
+        EXPECT_TRUE(otherComponentQ->m_isActive);
+
+        EXPECT_EQ(6, m_entity->GetComponents().size());
+
+        otherEntity.Deactivate();
+        m_entity->Deactivate();
+        EXPECT_FALSE(componentQ->m_isActive);
+    }
+
     TEST_F(ComponentDependency, IsComponentReadyToRemove_ExaminesRequiredServices)
     {
         ComponentB* componentB = m_entity->CreateComponent<ComponentB>();
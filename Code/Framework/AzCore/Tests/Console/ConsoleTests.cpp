@@ -255,6 +255,63 @@ namespace AZ
         AZ_TEST_ASSERT(console->GetCvarValue("testString", testValue) != GetValueResult::Success); // Console can't convert an arbitrary string to a float
     }
 
+    TEST_F(ConsoleTests, CVar_DispatchCvarChanges_DefersCallbacksAndBatchesChanges)
+    {
+        static int32_t callbackCount = 0;
+        static int32_t callbackValue = 0;
+        callbackCount = 0;
+        auto callback = [](const int32_t& value)
+        {
+            ++callbackCount;
+            callbackValue = value;
+        };
+        AZ_CVAR_SCOPED(int32_t, testDeferred, 0, callback, ConsoleFunctorFlags::DeferCallback, "");
+
+        AZStd::vector<AZStd::string> changedCvars;
+        IConsole::CvarsChangedEvent::Handler handler([&changedCvars](AZStd::span<ConsoleFunctorBase* const> functors)
+        {
+            for (ConsoleFunctorBase* functor : functors)
+            {
+                changedCvars.emplace_back(functor->GetName());
+            }
+        });
+        handler.Connect(m_console->GetCvarsChangedEvent());
+
+        m_console->PerformCommand("testDeferred 1");
+        m_console->PerformCommand("testDeferred 2");
+        testDeferred = 3;
+        EXPECT_EQ(3, int32_t(testDeferred));
+        EXPECT_EQ(0, callbackCount);
+        EXPECT_TRUE(changedCvars.empty());
+
+        // The changes are coalesced into one callback and one event
+        m_console->DispatchCvarChanges();
+        EXPECT_EQ(1, callbackCount);
+        EXPECT_EQ(3, callbackValue);
+        ASSERT_EQ(1, changedCvars.size());
+        EXPECT_EQ("testDeferred", changedCvars[0]);
+
+        m_console->DispatchCvarChanges();
+        EXPECT_EQ(1, callbackCount);
+        EXPECT_EQ(1, changedCvars.size());
+    }
+
+    TEST_F(ConsoleTests, CVar_GetSnapshot_KeepsPreviousValueUntilDispatched)
+    {
+        AZ_CVAR_SCOPED(AZ::CVarFixedString, testSnapshot, "first", nullptr, ConsoleFunctorFlags::Null, "");
+
+        const AZ::CVarFixedString& firstSnapshot = testSnapshot.GetSnapshot();
+        testSnapshot = AZ::CVarFixedString("second");
+        EXPECT_EQ("first", firstSnapshot);
+        EXPECT_EQ("second", testSnapshot.GetSnapshot());
+        EXPECT_EQ("second", static_cast<AZ::CVarFixedString>(testSnapshot));
+
+        m_console->PerformCommand("testSnapshot third");
+        m_console->DispatchCvarChanges();
+        m_console->DispatchCvarChanges();
+        EXPECT_EQ("third", testSnapshot.GetSnapshot());
+    }
+
     TEST_F(ConsoleTests, CVar_Autocomplete)
     {
         AZ::IConsole* console = m_console.get();
@@ -87,6 +87,18 @@ namespace AZ::Dom::Tests
                 EXPECT_EQ(AZ::JsonSerialization::Compare(*m_document, result.GetValue()), JsonSerializerCompareResult::Equal);
             }
 
+            // string -> Document, using the structural index parser
+            {
+                auto result = Json::WriteToRapidJsonDocument(
+                    [&canonicalSerializedDocument](AZ::Dom::Visitor& visitor)
+                    {
+                        StructuralJsonBackend backend;
+                        return Dom::Utils::ReadFromString(backend, canonicalSerializedDocument, Lifetime::Temporary, visitor);
+                    });
+                EXPECT_TRUE(result.IsSuccess());
+                EXPECT_EQ(AZ::JsonSerialization::Compare(*m_document, result.GetValue()), JsonSerializerCompareResult::Equal);
+            }
+
             // string -> string
             {
                 AZStd::string serializedDocument;
@@ -102,6 +114,50 @@ namespace AZ::Dom::Tests
             }
         }
 
+        // Validate that the structural index parser produces the same document as rapidjson for the given text
+        void PerformStructuralParserChecks(AZStd::string_view serializedDocument)
+        {
+            using RapidJsonBackend = JsonBackend<TestParseFlags>;
+
+            auto expected = Json::WriteToRapidJsonDocument(
+                [serializedDocument](AZ::Dom::Visitor& visitor)
+                {
+                    RapidJsonBackend backend;
+                    return Dom::Utils::ReadFromString(backend, serializedDocument, Lifetime::Temporary, visitor);
+                });
+            ASSERT_TRUE(expected.IsSuccess());
+
+            // Parse from a buffer
+            {
+                auto result = Json::WriteToRapidJsonDocument(
+                    [serializedDocument](AZ::Dom::Visitor& visitor)
+                    {
+                        StructuralJsonBackend backend;
+                        return Dom::Utils::ReadFromString(backend, serializedDocument, Lifetime::Temporary, visitor);
+                    });
+                EXPECT_TRUE(result.IsSuccess());
+                EXPECT_EQ(AZ::JsonSerialization::Compare(expected.GetValue(), result.GetValue()), JsonSerializerCompareResult::Equal);
+            }
+
+            // Parse in place
+            {
+                AZStd::string buffer(serializedDocument);
+                auto result = Json::WriteToRapidJsonDocument(
+                    [&buffer](AZ::Dom::Visitor& visitor)
+                    {
+                        StructuralJsonBackend backend;
+                        return Dom::Utils::ReadFromStringInPlace(backend, buffer, visitor);
+                    });
+                EXPECT_TRUE(result.IsSuccess());
+                EXPECT_EQ(AZ::JsonSerialization::Compare(expected.GetValue(), result.GetValue()), JsonSerializerCompareResult::Equal);
+            }
+        }
+
+        static constexpr Json::ParseFlags TestParseFlags =
+            Json::ParseFlags::ParseComments | Json::ParseFlags::ParseTrailingCommas | Json::ParseFlags::ParseEscapedApostrophies;
+        using StructuralJsonBackend =
+            JsonBackend<TestParseFlags, Json::OutputFormatting::PrettyPrintedJson, Json::ParserType::StructuralIndex>;
+
         AZStd::unique_ptr<rapidjson::Document> m_document;
     };
 
@@ -215,4 +271,54 @@ namespace AZ::Dom::Tests
             CreateString("long_string"), CreateString("abcdefghijklmnopqrstuvwxyz0123456789"), m_document->GetAllocator());
         PerformSerializationChecks();
     }
+
+    TEST_F(DomJsonTests, StructuralParser_EscapedStrings_MatchesRapidJson)
+    {
+        PerformStructuralParserChecks(R"({ "quote\"d": "a\\b\/c\n\t\r\b\f", "unicode": "\u00e9\u4e2d\ud83d\ude00", "apostrophe": "\'",
+            "structural": "{[:,]}" })");
+    }
+
+    TEST_F(DomJsonTests, StructuralParser_CommentsAndTrailingCommas_MatchesRapidJson)
+    {
+        PerformStructuralParserChecks(R"(// leading comment
+            {
+                /* block comment with "quotes" and {braces} */
+                "array": [1, -2, 3.5, 1e10, true, false, null, ], // trailing comment
+                "nested": { "empty": {}, "emptyArray": [], },
+            })");
+    }
+
+    TEST_F(DomJsonTests, StructuralParser_Numbers_MatchesRapidJson)
+    {
+        PerformStructuralParserChecks(
+            R"([0, -0, 18446744073709551615, 18446744073709551616, -9223372036854775808, -9223372036854775809, 0.1, -1.5e-7, 2E+3])");
+    }
+
+    TEST_F(DomJsonTests, StructuralParser_LargeDocument_MatchesRapidJson)
+    {
+        AZStd::string serializedDocument = "[";
+        for (int i = 0; i < 1000; ++i)
+        {
+            serializedDocument += AZStd::string::format(
+                R"({ "id": %i, "name": "entity_%i", "position": [%i.5, -%i, 0], "tags": ["a", "b\tc"] },)", i, i, i, i);
+        }
+        serializedDocument += "{}]";
+        PerformStructuralParserChecks(serializedDocument);
+    }
+
+    TEST_F(DomJsonTests, StructuralParser_InvalidDocuments_Fail)
+    {
+        const char* invalidDocuments[] = { "", "[", "{", "[1 2]", R"({"a" 1})", R"({"a":})", "[01]", "[1.]", "[,1]",
+                                           R"("unterminated)", "/* unterminated", "[1] x", "[tru]", R"(["\x"])" };
+        for (const char* invalidDocument : invalidDocuments)
+        {
+            auto result = Json::WriteToRapidJsonDocument(
+                [invalidDocument](AZ::Dom::Visitor& visitor)
+                {
+                    StructuralJsonBackend backend;
+                    return Dom::Utils::ReadFromString(backend, invalidDocument, Lifetime::Temporary, visitor);
+                });
+            EXPECT_FALSE(result.IsSuccess()) << invalidDocument;
+        }
+    }
 } // namespace AZ::Dom::Tests
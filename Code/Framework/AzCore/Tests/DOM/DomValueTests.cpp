@@ -8,6 +8,7 @@
 
 #include <AzCore/DOM/Backends/JSON/JsonBackend.h>
 #include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
+#include <AzCore/DOM/DomStringPool.h>
 #include <AzCore/DOM/DomUtils.h>
 #include <AzCore/DOM/DomValue.h>
 #include <AzCore/Name/NameDictionary.h>
@@ -381,4 +382,34 @@ namespace AZ::Dom::Tests
         EXPECT_EQ(&v1.GetNode(), &v2.GetNode());
         EXPECT_EQ(&v1["obj"].GetNode(), &v2["obj"].GetNode());
     }
+
+    TEST_F(DomValueTests, StringPool_SharesCopiedStrings)
+    {
+        StringPool stringPool;
+        const AZStd::string longString(64, 'a');
+
+        auto writeString = [&](Value& value)
+        {
+            AZStd::unique_ptr<Visitor> writer = value.GetWriteHandler(&stringPool);
+            AZStd::string temporaryString = longString;
+            EXPECT_TRUE(writer->String(temporaryString, Lifetime::Temporary).IsSuccess());
+        };
+
+        {
+            Value v1;
+            Value v2;
+            writeString(v1);
+            writeString(v2);
+
+            EXPECT_EQ(v1.GetString(), longString);
+            EXPECT_EQ(v1, v2);
+            EXPECT_EQ(
+                AZStd::get<Value::SharedStringType>(v1.GetInternalValue()), AZStd::get<Value::SharedStringType>(v2.GetInternalValue()));
+            EXPECT_EQ(stringPool.GetSize(), 1);
+            EXPECT_EQ(stringPool.Collect(), 0);
+        }
+
+        EXPECT_EQ(stringPool.Collect(), 1);
+        EXPECT_EQ(stringPool.GetSize(), 0);
+    }
 } // namespace AZ::Dom::Tests
@@ -762,6 +762,46 @@ namespace UnitTest
         this->ClearHandlers();
     }
 
+    // Test sending events on several addresses with a single lock
+    TYPED_TEST(EBusTestId, EventBatch)
+    {
+        using Bus = TypeParam;
+
+        this->CreateHandlers();
+
+        // Address 3 has no handlers, address 2 is listed twice
+        int ids[] = { 2, 3, 0, 2 };
+        Bus::EventBatch(ids, &Bus::Events::OnEvent);
+
+        // The ids are sorted in place
+        EXPECT_EQ(0, ids[0]);
+        EXPECT_EQ(2, ids[1]);
+        EXPECT_EQ(2, ids[2]);
+        EXPECT_EQ(3, ids[3]);
+
+        this->ValidateCalls(1, 0);
+        this->ValidateCalls(0, 1);
+        this->ValidateCalls(2, 2);
+    }
+
+    // Test sending events (that delete this) on several addresses with a single lock
+    TYPED_TEST(EBusTestId, EventBatch_Release)
+    {
+        using Bus = TypeParam;
+
+        this->CreateHandlers();
+
+        AZStd::vector<int> ids;
+        for (const auto& handlerPair : this->m_handlers)
+        {
+            ids.push_back(handlerPair.first);
+        }
+        Bus::EventBatch(ids, &Bus::Events::Release);
+        EXPECT_FALSE(Bus::HasHandlers());
+
+        this->ClearHandlers();
+    }
+
     // Test sending events on an address
     TYPED_TEST(EBusTestId, EventReverse)
     {
@@ -3023,6 +3063,89 @@ namespace UnitTest
         ThrashLocklessDispatchNullMutex();
     }
 
+    struct EpochMutexEvents
+        : public AZ::EBusTraits
+    {
+        using MutexType = AZ::EBusEpochMutex;
+
+        virtual ~EpochMutexEvents() = default;
+        virtual void AtomicIncrement() = 0;
+    };
+
+    using EpochMutexBus = AZ::EBus<EpochMutexEvents>;
+
+    struct EpochMutexImpl
+        : public EpochMutexBus::Handler
+    {
+        AZStd::atomic<uint64_t> m_val{};
+        EpochMutexImpl* m_connectOnDispatch = nullptr;
+
+        void AtomicIncrement() override
+        {
+            ++m_val;
+            if (m_connectOnDispatch)
+            {
+                // Connection changes from inside a dispatch upgrade to exclusive access
+                m_connectOnDispatch->BusConnect();
+                m_connectOnDispatch->BusDisconnect();
+            }
+        }
+    };
+
+    TEST_F(EBus, EpochMutex_Multithread_DispatchesWhileConnecting)
+    {
+        constexpr size_t threadCount = 8;
+        enum : size_t { cycleCount = 1000 };
+        constexpr uint64_t expectedAtomicCount = threadCount * cycleCount;
+        AZStd::thread threads[threadCount];
+
+        EpochMutexImpl handler;
+        handler.BusConnect();
+
+        auto work = []()
+        {
+            for (int i = 0; i < cycleCount; ++i)
+            {
+                EpochMutexBus::Broadcast(&EpochMutexBus::Events::AtomicIncrement);
+            }
+        };
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread(work);
+        }
+
+        // Keep changing connections while the other threads dispatch
+        for (int i = 0; i < cycleCount; ++i)
+        {
+            EpochMutexImpl transientHandler;
+            transientHandler.BusConnect();
+            transientHandler.BusDisconnect();
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        handler.BusDisconnect();
+        EXPECT_EQ(expectedAtomicCount, static_cast<uint64_t>(handler.m_val));
+    }
+
+    TEST_F(EBus, EpochMutex_ConnectDuringDispatch_Succeeds)
+    {
+        EpochMutexImpl handler;
+        EpochMutexImpl nestedHandler;
+        handler.m_connectOnDispatch = &nestedHandler;
+        handler.BusConnect();
+
+        EpochMutexBus::Broadcast(&EpochMutexBus::Events::AtomicIncrement);
+
+        handler.BusDisconnect();
+        EXPECT_EQ(1, static_cast<uint64_t>(handler.m_val));
+        EXPECT_FALSE(nestedHandler.BusIsConnected());
+    }
+
     namespace EBusResultsTest
     {
         class ResultClass
@@ -9,6 +9,7 @@
 #include <AzCore/EBus/IEventScheduler.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/EBus/ScheduledEventTimerWheel.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystem.h>
@@ -102,4 +103,59 @@ namespace UnitTest
         // Use EXPECT_GT in case the OS oversleeps long enough to cause unexpected extra timer pops
         EXPECT_GT(m_requeuedEventTriggerCount, 1);
     }
+
+    TEST_F(ScheduledEventTests, TestRemoveFromQueue)
+    {
+        m_testEvent->Enqueue(AZ::TimeMs(50));
+        EXPECT_EQ(m_eventSchedulerComponent->GetQueueSize(), 1);
+        m_testEvent->RemoveFromQueue();
+        EXPECT_FALSE(m_testEvent->IsScheduled());
+        EXPECT_EQ(m_eventSchedulerComponent->GetQueueSize(), 0);
+
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(100));
+        m_eventSchedulerComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+        EXPECT_EQ(m_basicEventTriggerCount, 0);
+    }
+
+    TEST(ScheduledEventTimerWheelTests, Advance_ExpiresHandlesAtTheirExecuteTime)
+    {
+        // Execute times in each level of the wheel and beyond its range
+        const int64_t startTimeMs = 1000;
+        const int64_t delaysMs[] = { 0, 1, 2, 255, 256, 257, 1000, 65535, 65536, 70000, 16777215, 16777216, 20000000, int64_t(1) << 33 };
+        constexpr size_t HandleCount = AZ_ARRAY_SIZE(delaysMs);
+        AZ::ScheduledEventHandle handles[HandleCount];
+        AZ::ScheduledEventTimerWheel timerWheel;
+        for (size_t i = 0; i < HandleCount; ++i)
+        {
+            handles[i] = AZ::ScheduledEventHandle(AZ::TimeMs(startTimeMs + delaysMs[i]), AZ::TimeMs(delaysMs[i]), nullptr);
+            timerWheel.Insert(&handles[i], AZ::TimeMs(startTimeMs));
+        }
+
+        // Cancel one handle
+        timerWheel.Remove(&handles[5]);
+        EXPECT_FALSE(AZ::ScheduledEventTimerWheel::Contains(&handles[5]));
+        EXPECT_EQ(timerWheel.GetSize(), HandleCount - 1);
+
+        AZStd::vector<AZ::ScheduledEventHandle*> expiredHandles;
+        for (size_t i = 0; i < HandleCount; ++i)
+        {
+            if (i == 5)
+            {
+                continue;
+            }
+            const int64_t executeTimeMs = startTimeMs + delaysMs[i];
+            if (delaysMs[i] > 0)
+            {
+                // Advance in irregular steps up to just before the execute time
+                timerWheel.Advance(AZ::TimeMs(executeTimeMs - 1), expiredHandles);
+                EXPECT_TRUE(expiredHandles.empty());
+            }
+            timerWheel.Advance(AZ::TimeMs(executeTimeMs), expiredHandles);
+            ASSERT_EQ(expiredHandles.size(), 1);
+            EXPECT_EQ(expiredHandles[0], &handles[i]);
+            EXPECT_FALSE(AZ::ScheduledEventTimerWheel::Contains(&handles[i]));
+            expiredHandles.clear();
+        }
+        EXPECT_EQ(timerWheel.GetSize(), 0);
+    }
 }
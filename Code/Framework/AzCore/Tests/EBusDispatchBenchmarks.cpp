@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/EBus/EBusEpochMutex.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Compares the cost of broadcasting on a single address, multi-handler bus (the TickBus layout)
+    // with the different dispatch locking policies, from one thread and from several threads at once.
+    static constexpr int32_t NumDispatchHandlers = 100;
+
+    template<typename Mutex>
+    class EBusDispatchPerf
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using MutexType = Mutex;
+
+        virtual void OnSignal(int32_t) = 0;
+    };
+
+    template<typename Mutex>
+    using EBusDispatchPerfBus = AZ::EBus<EBusDispatchPerf<Mutex>>;
+
+    template<typename Mutex>
+    class EBusDispatchPerfHandler
+        : public EBusDispatchPerfBus<Mutex>::Handler
+    {
+    public:
+        void OnSignal(int32_t value) override { m_sum.fetch_add(value, AZStd::memory_order_relaxed); }
+        AZStd::atomic<int64_t> m_sum{ 0 };
+    };
+
+    template<typename Mutex>
+    class EBusDispatchPerfFixture
+    {
+    public:
+        static void SetUp()
+        {
+            s_handlers = AZStd::make_unique<EBusDispatchPerfHandler<Mutex>[]>(NumDispatchHandlers);
+            for (int32_t i = 0; i < NumDispatchHandlers; ++i)
+            {
+                s_handlers[i].BusConnect();
+            }
+        }
+
+        static void TearDown()
+        {
+            for (int32_t i = 0; i < NumDispatchHandlers; ++i)
+            {
+                s_handlers[i].BusDisconnect();
+            }
+            s_handlers.reset();
+        }
+
+        static AZStd::unique_ptr<EBusDispatchPerfHandler<Mutex>[]> s_handlers;
+    };
+
+    template<typename Mutex>
+    AZStd::unique_ptr<EBusDispatchPerfHandler<Mutex>[]> EBusDispatchPerfFixture<Mutex>::s_handlers;
+
+    template<typename Mutex>
+    static void BM_EBusDispatch_Broadcast(benchmark::State& state)
+    {
+        if (state.thread_index == 0) // Only setup in the first thread
+        {
+            EBusDispatchPerfFixture<Mutex>::SetUp();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EBusDispatchPerfBus<Mutex>::Broadcast(&EBusDispatchPerf<Mutex>::OnSignal, 1);
+        }
+
+        if (state.thread_index == 0)
+        {
+            EBusDispatchPerfFixture<Mutex>::TearDown();
+        }
+    }
+
+    // Broadcasts while the first thread keeps connecting and disconnecting a handler, one change every 64 broadcasts
+    template<typename Mutex>
+    static void BM_EBusDispatch_BroadcastWithConnects(benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            EBusDispatchPerfFixture<Mutex>::SetUp();
+        }
+
+        EBusDispatchPerfHandler<Mutex> extraHandler;
+        uint32_t iteration = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (state.thread_index == 0 && (++iteration % 64) == 0)
+            {
+                if (extraHandler.BusIsConnected())
+                {
+                    extraHandler.BusDisconnect();
+                }
+                else
+                {
+                    extraHandler.BusConnect();
+                }
+            }
+            EBusDispatchPerfBus<Mutex>::Broadcast(&EBusDispatchPerf<Mutex>::OnSignal, 1);
+        }
+        extraHandler.BusDisconnect();
+
+        if (state.thread_index == 0)
+        {
+            EBusDispatchPerfFixture<Mutex>::TearDown();
+        }
+    }
+
+    BENCHMARK_TEMPLATE(BM_EBusDispatch_Broadcast, AZ::NullMutex);
+    BENCHMARK_TEMPLATE(BM_EBusDispatch_Broadcast, AZStd::mutex)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBusDispatch_Broadcast, AZStd::recursive_mutex)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBusDispatch_Broadcast, AZ::EBusEpochMutex)->ThreadRange(1, 8)->UseRealTime();
+
+    BENCHMARK_TEMPLATE(BM_EBusDispatch_BroadcastWithConnects, AZStd::recursive_mutex)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBusDispatch_BroadcastWithConnects, AZ::EBusEpochMutex)->ThreadRange(1, 8)->UseRealTime();
+}
+#endif // HAVE_BENCHMARK
@@ -68,6 +68,7 @@ namespace UnitTest
         JobManager* m_jobManager = nullptr;
         JobContext* m_jobContext = nullptr;
         unsigned int m_numWorkerThreads;
+        bool m_enableFibers = false;
     public:
         DefaultJobManagerSetupFixture(unsigned int numWorkerThreads = 0)
             : m_numWorkerThreads(numWorkerThreads)
@@ -100,6 +101,8 @@ namespace UnitTest
 #endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
             }
 
+            desc.m_enableFibers = m_enableFibers;
+
             m_jobManager = aznew JobManager(desc);
             m_jobContext = aznew JobContext(*m_jobManager);
 
@@ -431,6 +434,22 @@ namespace UnitTest
     {
         run();
     }
+
+    // Same as above, but jobs waiting for their children park on fibers instead of processing other jobs on top of their stack
+    class JobFibonacci2FibersTest
+        : public JobFibonacci2Test
+    {
+    public:
+        JobFibonacci2FibersTest()
+        {
+            m_enableFibers = true;
+        }
+    };
+
+    TEST_F(JobFibonacci2FibersTest, Test)
+    {
+        run();
+    }
     // FibonacciJob2Example-End
 
     // MergeSortJobExample-Begin
@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 
@@ -116,4 +117,26 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x4727dc92), constEvalIntValue);
     }
 
+    TEST_F(Crc32Fixture, RuntimeCrc_MatchesConstexprCrc)
+    {
+        // The runtime crcs process several bytes at a time with the fastest kernel of the cpu, test the sizes around its block sizes.
+        constexpr AZ::Crc32 compileTimeLowerCase("Material.BaseColor.TextureMap_UV0");
+        const AZStd::string runtimeString("Material.BaseColor.TextureMap_UV0");
+        EXPECT_EQ(compileTimeLowerCase, AZ::Crc32(runtimeString));
+        EXPECT_EQ(compileTimeLowerCase, AZ::Crc32("material.basecolor.texturemap_uv0"));
+
+        AZStd::array<uint8_t, 1031> data;
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 131 + 7);
+        }
+
+        for (size_t size : { 0, 1, 15, 63, 64, 65, 80, 127, 128, 1000, 1031 })
+        {
+            const AZ::Crc32 expected(data.data(), size);
+            EXPECT_EQ(expected, AZ::Crc32(static_cast<const void*>(data.data()), size)) << "size " << size;
+            EXPECT_EQ(AZ::Crc32(data.data() + 1, size - (size > 0 ? 1 : 0)),
+                AZ::Crc32(static_cast<const void*>(data.data() + 1), size - (size > 0 ? 1 : 0))) << "unaligned size " << size;
+        }
+    }
 }
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMathBatch.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    class MATH_SimdMathBatch : public AllocatorsTestFixture
+    {
+    protected:
+        // Not a multiple of the lane count, so that both the batched kernels and the remainder are tested.
+        static constexpr size_t Count = 67;
+
+        float GetRandomFloat(float min, float max)
+        {
+            return min + (max - min) * m_random.GetRandomFloat();
+        }
+
+        AZ::Vector3 GetRandomVector3(float min, float max)
+        {
+            return AZ::Vector3(GetRandomFloat(min, max), GetRandomFloat(min, max), GetRandomFloat(min, max));
+        }
+
+        AZ::Quaternion GetRandomRotation()
+        {
+            return AZ::Quaternion::CreateFromAxisAngle(GetRandomVector3(-1.0f, 1.0f).GetNormalizedSafe(), GetRandomFloat(-3.0f, 3.0f));
+        }
+
+        AZ::SimpleLcgRandom m_random{ 1234 };
+    };
+
+    TEST_F(MATH_SimdMathBatch, TransformPoints_MatchesTransformPoint)
+    {
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(GetRandomRotation(), GetRandomVector3(-5.0f, 5.0f));
+        transform.SetUniformScale(1.5f);
+
+        AZStd::vector<AZ::Vector3> points(Count);
+        AZStd::vector<AZ::Transform> transforms(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            points[i] = GetRandomVector3(-10.0f, 10.0f);
+            transforms[i] = AZ::Transform::CreateFromQuaternionAndTranslation(GetRandomRotation(), GetRandomVector3(-5.0f, 5.0f));
+            transforms[i].SetUniformScale(GetRandomFloat(0.5f, 2.0f));
+        }
+
+        AZStd::vector<AZ::Vector3> outPoints(Count);
+        AZ::Simd::Batch::TransformPoints(transform, points, outPoints);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(outPoints[i], IsCloseTolerance(transform.TransformPoint(points[i]), 1e-4f));
+        }
+
+        AZ::Simd::Batch::TransformPoints(transforms, points, outPoints);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(outPoints[i], IsCloseTolerance(transforms[i].TransformPoint(points[i]), 1e-4f));
+        }
+
+        // The points can be transformed in place.
+        AZStd::vector<AZ::Vector3> inPlacePoints = points;
+        AZ::Simd::Batch::TransformPoints(transform, inPlacePoints, inPlacePoints);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(inPlacePoints[i], IsCloseTolerance(transform.TransformPoint(points[i]), 1e-4f));
+        }
+    }
+
+    TEST_F(MATH_SimdMathBatch, OverlapsFrustum_MatchesShapeIntersection)
+    {
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.5f, 1.0f, 0.1f, 60.0f));
+
+        AZStd::vector<AZ::Aabb> aabbs(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            aabbs[i] = AZ::Aabb::CreateCenterHalfExtents(GetRandomVector3(-30.0f, 30.0f), GetRandomVector3(0.0f, 3.0f));
+        }
+        // The infinite bounds must not overflow.
+        aabbs[0] = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-AZ::Constants::FloatMax), AZ::Vector3(AZ::Constants::FloatMax));
+
+        bool overlaps[Count];
+        const size_t overlapCount = AZ::Simd::Batch::OverlapsFrustum(frustum, aabbs, overlaps);
+
+        size_t expectedOverlapCount = 0;
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const bool expectedOverlaps = AZ::ShapeIntersection::Overlaps(frustum, aabbs[i]);
+            EXPECT_EQ(overlaps[i], expectedOverlaps);
+            expectedOverlapCount += expectedOverlaps ? 1 : 0;
+        }
+        EXPECT_EQ(overlapCount, expectedOverlapCount);
+        EXPECT_TRUE(overlaps[0]);
+    }
+
+    TEST_F(MATH_SimdMathBatch, Slerp_MatchesQuaternionSlerp)
+    {
+        AZStd::vector<AZ::Quaternion> from(Count);
+        AZStd::vector<AZ::Quaternion> to(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            from[i] = GetRandomRotation();
+            to[i] = GetRandomRotation();
+        }
+        // Also test the nearly identical rotations, which are linearly interpolated, and the opposite hemispheres.
+        to[1] = from[1];
+        to[2] = -to[2];
+
+        AZStd::vector<AZ::Quaternion> outRotations(Count);
+        AZ::Simd::Batch::Slerp(from, to, 0.3f, outRotations);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_THAT(outRotations[i], IsCloseTolerance(from[i].Slerp(to[i], 0.3f), 1e-4f));
+        }
+    }
+} // namespace UnitTest
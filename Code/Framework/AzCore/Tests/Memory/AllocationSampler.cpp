@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class AllocationSamplerTests
+        : public AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(AllocationSamplerTests, Disabled_OnAllocation_NoSamples)
+    {
+        AZ::Debug::AllocationSampler sampler;
+        int value = 0;
+        sampler.OnAllocation(nullptr, &value, sizeof(value), "Test");
+
+        AZStd::vector<AZ::Debug::AllocationSampler::SnapshotEntry> entries;
+        sampler.GetSnapshot(entries);
+        EXPECT_FALSE(sampler.IsEnabled());
+        EXPECT_TRUE(entries.empty());
+    }
+
+    TEST_F(AllocationSamplerTests, IntervalOfOneByte_SamplesEveryAllocationUntilFreed)
+    {
+        AZ::Debug::AllocationSampler sampler;
+        sampler.SetSamplingInterval(1);
+
+        int values[3] = {};
+        sampler.OnAllocation(nullptr, &values[0], 64, "First");
+        sampler.OnAllocation(nullptr, &values[1], 32, "First");
+        sampler.OnAllocation(nullptr, &values[2], 16, "Second");
+
+        AZStd::vector<AZ::Debug::AllocationSampler::SnapshotEntry> entries;
+        sampler.GetSnapshot(entries);
+        ASSERT_EQ(entries.size(), 2);
+        for (const auto& entry : entries)
+        {
+            if (strcmp(entry.m_allocationName, "First") == 0)
+            {
+                EXPECT_EQ(entry.m_sampleCount, 2);
+                EXPECT_EQ(entry.m_sampledBytes, 96);
+            }
+            else
+            {
+                EXPECT_STREQ(entry.m_allocationName, "Second");
+                EXPECT_EQ(entry.m_sampleCount, 1);
+                EXPECT_EQ(entry.m_sampledBytes, 16);
+            }
+        }
+
+        sampler.OnDeallocation(&values[0]);
+        sampler.OnDeallocation(&values[2]);
+        sampler.GetSnapshot(entries);
+        ASSERT_EQ(entries.size(), 1);
+        EXPECT_EQ(entries[0].m_sampleCount, 1);
+        EXPECT_EQ(entries[0].m_sampledBytes, 32);
+
+        sampler.SetSamplingInterval(0);
+        sampler.GetSnapshot(entries);
+        EXPECT_TRUE(entries.empty());
+    }
+} // namespace UnitTest
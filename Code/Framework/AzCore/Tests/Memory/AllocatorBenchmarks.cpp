@@ -195,6 +195,25 @@ namespace Benchmark
         }
     };
 
+    // SystemAllocator without the per thread caches in front of the pools, to measure what the caches save
+    class TestSystemAllocatorNoThreadCache : public AZ::SystemAllocator
+    {
+    public:
+        AZ_TYPE_INFO(TestSystemAllocatorNoThreadCache, "{8C3B1F7E-52D4-4B9A-9E61-0F4C2D7A93B5}");
+
+        TestSystemAllocatorNoThreadCache()
+            : AZ::SystemAllocator()
+        {
+        }
+
+        bool Create(const Descriptor& desc)
+        {
+            Descriptor noThreadCacheDesc = desc;
+            noThreadCacheDesc.m_heap.m_threadCacheHighWatermark = 0;
+            return AZ::SystemAllocator::Create(noThreadCacheDesc);
+        }
+    };
+
     // Allocated bytes reported by the allocator
     static const char* s_counterAllocatorMemory = "Allocator_Memory";
 
@@ -556,11 +575,13 @@ namespace Benchmark
         BENCHMARK_REGISTER_F(FIXTURE, TESTNAME)
 
     // We test small/big/mixed allocations in single-threaded environments. For multi-threaded environments, we test mixed since
-    // the multi threaded fixture will run multiple passes (1, 2, 4, ... until 2*hardware_concurrency)
+    // the multi threaded fixture will run multiple passes (1, 2, 4, ... until 2*hardware_concurrency), and small since that is
+    // where the per thread caches of the allocators avoid the locks
 #define BM_REGISTER_SIZE_FIXTURES(FIXTURE, TESTNAME, ALLOCATORTYPE) \
     BM_REGISTER_TEMPLATE(FIXTURE, TESTNAME##_SMALL, ALLOCATORTYPE, SMALL)->Apply(RunRanges); \
     BM_REGISTER_TEMPLATE(FIXTURE, TESTNAME##_BIG, ALLOCATORTYPE, BIG)->Apply(RunRanges); \
     BM_REGISTER_TEMPLATE(FIXTURE, TESTNAME##_MIXED, ALLOCATORTYPE, MIXED)->Apply(RunRanges); \
+    BM_REGISTER_TEMPLATE(FIXTURE, TESTNAME##_SMALL_THREADED, ALLOCATORTYPE, SMALL)->ThreadRange(2, MaxThreadRange)->Apply(ThreadedRunRanges); \
     BM_REGISTER_TEMPLATE(FIXTURE, TESTNAME##_MIXED_THREADED, ALLOCATORTYPE, MIXED)->ThreadRange(2, MaxThreadRange)->Apply(ThreadedRunRanges);
 
 #define BM_REGISTER_ALLOCATOR(TESTNAME, ALLOCATORTYPE) \
@@ -580,6 +601,7 @@ namespace Benchmark
     BM_REGISTER_ALLOCATOR(MallocSchemaAllocator, MallocSchemaAllocator);
     BM_REGISTER_ALLOCATOR(HphaSchemaAllocator, HphaSchemaAllocator);
     BM_REGISTER_ALLOCATOR(SystemAllocator, TestSystemAllocator);
+    BM_REGISTER_ALLOCATOR(SystemAllocatorNoThreadCache, TestSystemAllocatorNoThreadCache);
     
     //BM_REGISTER_ALLOCATOR(BestFitExternalMapAllocator, BestFitExternalMapAllocator); // Requires to pre-allocate blocks and cannot work as a general-purpose allocator
     //BM_REGISTER_ALLOCATOR(HeapSchemaAllocator, TestHeapSchemaAllocator); // Requires to pre-allocate blocks and cannot work as a general-purpose allocator
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTests
+        : public AllocatorsFixture
+    {
+    protected:
+        static constexpr size_t FrameByteSize = 64 * 1024;
+        static constexpr size_t ThreadBlockByteSize = 4 * 1024;
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            CreateArena(2);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            AllocatorsFixture::TearDown();
+        }
+
+        void CreateArena(unsigned int frameCount)
+        {
+            if (AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            }
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_frameCount = frameCount;
+            desc.m_frameByteSize = FrameByteSize;
+            desc.m_threadBlockByteSize = ThreadBlockByteSize;
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create(desc);
+        }
+
+        static AZ::FrameArenaAllocator& GetArena()
+        {
+            return static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTests, Allocate_VariousAlignments_ReturnsAlignedDistinctMemory)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        char* previous = nullptr;
+        for (size_t alignment : { 1, 4, 16, 64, 256 })
+        {
+            char* address = static_cast<char*>(arena.Allocate(24, alignment));
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<uintptr_t>(address) % alignment);
+            memset(address, 0xcd, 24);
+            if (previous)
+            {
+                EXPECT_GE(address, previous + 24);
+            }
+            previous = address;
+        }
+        EXPECT_EQ(0, arena.GetLastFrameOverflowCount());
+        EXPECT_LE(ThreadBlockByteSize, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTests, Vector_WithFrameArena_HoldsElements)
+    {
+        AZStd::vector<int, AZ::FrameArena> values;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTests, NextFrame_AfterFrameCountFrames_ReusesMemory)
+    {
+        for (unsigned int frameCount : { 2u, 3u })
+        {
+            CreateArena(frameCount);
+            AZ::FrameArenaAllocator& arena = GetArena();
+            void* firstFrame = arena.Allocate(16, 16);
+
+            // The memory of a frame stays valid until the arena comes back to it
+            for (unsigned int frame = 1; frame < frameCount; ++frame)
+            {
+                arena.NextFrame();
+                EXPECT_NE(firstFrame, arena.Allocate(16, 16));
+            }
+            arena.NextFrame();
+            EXPECT_EQ(firstFrame, arena.Allocate(16, 16));
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTests, Allocate_FrameFull_FallsBackToHeapAndReportsOverflow)
+    {
+        AZ::FrameArenaAllocator& arena = GetArena();
+        // Large allocations are claimed directly from the frame
+        void* inArena = arena.Allocate(FrameByteSize / 2, 16);
+        ASSERT_NE(nullptr, inArena);
+        void* overflow = arena.Allocate(FrameByteSize, 16);
+        ASSERT_NE(nullptr, overflow);
+        memset(overflow, 0xcd, FrameByteSize);
+        EXPECT_LE(FrameByteSize / 2 + FrameByteSize, arena.NumAllocatedBytes());
+
+        arena.NextFrame();
+        EXPECT_EQ(FrameByteSize, arena.GetLastFrameOverflowBytes());
+        EXPECT_EQ(1, arena.GetLastFrameOverflowCount());
+
+        // Releasing the frame frees the overflow allocations
+        arena.NextFrame();
+        EXPECT_EQ(0, arena.GetLastFrameOverflowCount());
+        arena.NextFrame();
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTests, Allocate_MultipleThreads_UsesSeparateBlocks)
+    {
+        constexpr int threadCount = 4;
+        constexpr int allocationCount = 256;
+        constexpr size_t allocationSize = 32;
+        AZStd::vector<char*> allocations[threadCount];
+        AZStd::vector<AZStd::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&allocations, t]()
+                {
+                    AZ::FrameArenaAllocator& arena = GetArena();
+                    for (int i = 0; i < allocationCount; ++i)
+                    {
+                        char* address = static_cast<char*>(arena.Allocate(allocationSize, 8));
+                        memset(address, t, allocationSize);
+                        allocations[t].push_back(address);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // No thread overwrote the memory of another
+        for (int t = 0; t < threadCount; ++t)
+        {
+            for (char* address : allocations[t])
+            {
+                for (size_t i = 0; i < allocationSize; ++i)
+                {
+                    ASSERT_EQ(t, address[i]);
+                }
+            }
+        }
+        EXPECT_LE(threadCount * allocationCount * allocationSize, GetArena().NumAllocatedBytes());
+    }
+} // namespace UnitTest
@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 class HphaSchema_TestAllocator
     : public AZ::SimpleSchemaAllocator<AZ::HphaSchema>
@@ -107,4 +108,102 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            HphaSchema_TestAllocator::Descriptor desc;
+            desc.m_threadCacheHighWatermark = 4 * s_kiloByte;
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, SmallAllocations_ReusedFromThreadCache)
+    {
+        AZ::IAllocator& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        void* first = allocator.Allocate(32, 0);
+        allocator.DeAllocate(first, 32);
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        // The freed element stays in the thread cache and is handed out again
+        void* second = allocator.Allocate(32, 0);
+        EXPECT_EQ(first, second);
+        EXPECT_LE(32, allocator.NumAllocatedBytes());
+        allocator.DeAllocate(second);
+
+        AZ::AllocatorThreadCacheStats stats[4];
+        ASSERT_EQ(1, allocator.GetThreadCacheStats(stats, 4));
+        EXPECT_EQ(AZStd::this_thread::get_id().m_id, stats[0].m_threadId);
+        EXPECT_EQ(1, stats[0].m_hitCount);
+        EXPECT_EQ(1, stats[0].m_refillCount);
+        EXPECT_GT(stats[0].m_cachedBytes, 0);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, HighWatermark_TrimsThreadCache)
+    {
+        AZ::IAllocator& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        for (size_t i = 0; i < 256; ++i)
+        {
+            allocations.push_back(allocator.Allocate(128, 0));
+        }
+        for (void* allocation : allocations)
+        {
+            allocator.DeAllocate(allocation, 128);
+        }
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        AZ::AllocatorThreadCacheStats stats[4];
+        ASSERT_EQ(1, allocator.GetThreadCacheStats(stats, 4));
+        EXPECT_GT(stats[0].m_trimCount, 0);
+        EXPECT_LE(stats[0].m_cachedBytes, 4 * s_kiloByte);
+
+        // Garbage collecting returns the calling thread cache to the pools
+        allocator.GarbageCollect();
+        ASSERT_EQ(1, allocator.GetThreadCacheStats(stats, 4));
+        EXPECT_EQ(0, stats[0].m_cachedBytes);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ThreadExit_DrainsThreadCache)
+    {
+        AZ::IAllocator& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        constexpr size_t numThreads = 4;
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> crossThreadAllocations(numThreads, nullptr);
+        AZStd::vector<AZStd::thread, AZ::AZStdAlloc<AZ::OSAllocator>> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &crossThreadAllocations, threadIndex]()
+                {
+                    for (size_t i = 0; i < 1000; ++i)
+                    {
+                        const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                        allocator.DeAllocate(allocator.Allocate(allocationSize, 0), allocationSize);
+                    }
+                    // Freed by the main thread
+                    crossThreadAllocations[threadIndex] = allocator.Allocate(64, 0);
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZ::AllocatorThreadCacheStats stats[numThreads + 1];
+        EXPECT_EQ(0, allocator.GetThreadCacheStats(stats, numThreads + 1));
+        EXPECT_LE(numThreads * 64, allocator.NumAllocatedBytes());
+
+        for (void* allocation : crossThreadAllocations)
+        {
+            allocator.DeAllocate(allocation, 64);
+        }
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+    }
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Measures the cost of creating names, for names that are new to the dictionary and for names that are already in it
+    class NameBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr size_t NameCount = 1024;
+
+        void SetUp(const ::benchmark::State&) override
+        {
+            InternalSetUp();
+        }
+        void SetUp(::benchmark::State&) override
+        {
+            InternalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+    protected:
+        void InternalSetUp()
+        {
+            AZ::NameDictionary::Create();
+            m_strings.reserve(NameCount);
+            for (size_t i = 0; i < NameCount; ++i)
+            {
+                m_strings.push_back(AZStd::string::format("BenchmarkName_%zu_WithATypicalLength", i));
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_strings = {};
+            AZ::NameDictionary::Destroy();
+        }
+
+        AZStd::vector<AZStd::string> m_strings;
+    };
+
+    BENCHMARK_F(NameBenchmarkFixture, BM_NameCreateNew)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Name> names;
+        names.reserve(NameCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::string& string : m_strings)
+            {
+                names.emplace_back(string);
+            }
+
+            // Releasing the names removes them from the dictionary, so the next iteration creates them again
+            state.PauseTiming();
+            names.clear();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * NameCount);
+    }
+
+    BENCHMARK_F(NameBenchmarkFixture, BM_NameCreateExisting)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Name> existingNames(m_strings.begin(), m_strings.end());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::string& string : m_strings)
+            {
+                AZ::Name name(string);
+                benchmark::DoNotOptimize(name);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NameCount);
+    }
+
+    BENCHMARK_F(NameBenchmarkFixture, BM_NameCompare)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Name> names(m_strings.begin(), m_strings.end());
+        AZStd::vector<AZ::Name> otherNames(m_strings.rbegin(), m_strings.rend());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t equalCount = 0;
+            for (size_t i = 0; i < NameCount; ++i)
+            {
+                equalCount += (names[i] == otherNames[i]) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(equalCount);
+        }
+        state.SetItemsProcessed(state.iterations() * NameCount);
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
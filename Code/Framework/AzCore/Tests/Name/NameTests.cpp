@@ -48,14 +48,14 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static AZStd::vector<AZ::Internal::NameData*, AZ::OSStdAllocator> GetEntries()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return AZ::NameDictionary::Instance().GetEntries();
         }
         
         static size_t GetEntryCount()
         {
-            return GetDictionary().size();
+            return AZ::NameDictionary::Instance().GetEntryCount();
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -280,9 +280,9 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
+            const auto globalDictionary = NameDictionaryTester::GetEntries();
+            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](const AZ::Internal::NameData* entry) {
+                return entry->GetName() == nameString;
             });
             EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
@@ -420,6 +420,70 @@ namespace UnitTest
         }
     }
 
+    TEST_F(NameTest, ManyNames_GrowAndRelease_AllNamesFound)
+    {
+        // Enough names to grow the tables of every shard several times
+        constexpr size_t nameCount = 10000;
+        AZStd::vector<AZ::Name> names;
+        names.reserve(nameCount);
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name %zu", i));
+        }
+        EXPECT_EQ(nameCount, NameDictionaryTester::GetEntryCount());
+
+        // Releasing every other name leaves tombstones the remaining lookups have to probe past
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            names[i] = AZ::Name();
+        }
+        EXPECT_EQ(nameCount / 2, NameDictionaryTester::GetEntryCount());
+
+        for (size_t i = 1; i < nameCount; i += 2)
+        {
+            AZ::Name nameFromHash{ names[i].GetHash() };
+            EXPECT_EQ(names[i], nameFromHash);
+            EXPECT_EQ(names[i], AZ::Name(AZStd::string::format("name %zu", i)));
+        }
+
+        // Released entries are recycled for new names
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            names[i] = AZ::Name(AZStd::string::format("other name %zu", i));
+            EXPECT_EQ(AZStd::string::format("other name %zu", i), names[i].GetStringView());
+        }
+        EXPECT_EQ(nameCount, NameDictionaryTester::GetEntryCount());
+    }
+
+    TEST_F(NameTest, NameLiteral_SameCallSite_ReturnsDictionaryName)
+    {
+        auto getLiteral = []() -> const AZ::Name&
+        {
+            return AZ_NAME_LITERAL("literal");
+        };
+
+        const AZ::Name& literal = getLiteral();
+        EXPECT_EQ(&literal, &getLiteral());
+        EXPECT_EQ(AZ::Name("literal"), literal);
+        EXPECT_EQ(AZ::Name("literal"), AZ_NAME_LITERAL("literal"));
+        EXPECT_STREQ("literal", literal.GetCStr());
+        EXPECT_TRUE(AZ_NAME_LITERAL("").IsEmpty());
+
+        // The hash is calculated at compile time
+        static_assert(AZ::Internal::NameData::CalcHash("literal") == (AZStd::hash<AZStd::string_view>()("literal") & 0xFFFFFFFF));
+        EXPECT_EQ(NameDictionaryTester::CalcDirectHashValue("literal"), literal.GetHash());
+
+        // The literal keeps the name in the dictionary
+        EXPECT_EQ(1, NameDictionaryTester::GetEntryCount());
+
+        // A recreated dictionary resolves the literal again, the reference of the literal doesn't count as a leak
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+        EXPECT_EQ(AZ::Name("literal"), getLiteral());
+        EXPECT_EQ(1, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, NameComparisonTest)
     {
         AZ::Name a{"a"};
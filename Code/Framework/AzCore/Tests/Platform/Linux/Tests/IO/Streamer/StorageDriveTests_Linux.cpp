@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestSectorSize = 4_kib;
+    constexpr AZ::u32 TestMaxIOChannels = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestSectorSize, TestSectorSize,
+                TestMaxIOChannels, TestOverCommit, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDrive{};
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        StorageDriveLinux::ConstructionOptions m_configurationOptions;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            m_configurationOptions.m_minimalReporting = true;
+            SetupStorageDrive(TestMaxIOChannels);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            m_context.reset();
+            AZ::IO::SystemFile::Delete(m_dummyFilepath.c_str());
+        }
+
+        void SetupStorageDrive(AZ::u32 ioChannelCount)
+        {
+            m_storageDrive = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestSectorSize, TestSectorSize, ioChannelCount, TestOverCommit, m_configurationOptions);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        // Create a file filled with a single character and a marker character every chunkOffset bytes.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0)
+        {
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            ASSERT_EQ(fileSize, file.Write(buffer.get(), fileSize));
+            file.Close();
+        }
+
+        FileRequest* QueueRead(void* output, u64 outputSize, u64 offset, u64 size)
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output, outputSize, m_dummyRequestPath, offset, size);
+            request->SetCompletionCallback([](const FileRequest& request)
+                {
+                    EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                });
+            m_storageDrive->QueueRequest(request);
+            return request;
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        bool IsIoUringAvailable() const
+        {
+            return StorageDriveLinux::IsSupported();
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()) && !AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+            {
+                return;
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+#define AZ_SKIP_WITHOUT_IO_URING() \
+    if (!IsIoUringAvailable()) \
+    { \
+        return; \
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0,
+            TestMaxIOChannels, TestOverCommit, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, TestSectorSize,
+            TestSectorSize, TestMaxIOChannels, -(aznumeric_cast<s32>(TestMaxIOChannels) + 2), m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        AZ_SKIP_WITHOUT_IO_URING();
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        AZ_SKIP_WITHOUT_IO_URING();
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(AZStd::get<Requests::FileExistsCheckData>(request.GetCommand()).m_found);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_AlignedRead_ReadsDirectlyIntoBuffer)
+    {
+        AZ_SKIP_WITHOUT_IO_URING();
+        constexpr size_t fileSize = 16_kib;
+        CreateDummyFile(fileSize, TestSectorSize);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestSectorSize));
+        QueueRead(buffer, fileSize, 0, fileSize);
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < fileSize; ++i)
+        {
+            ASSERT_EQ((i % TestSectorSize) == 0 ? s_chunkCharacter : s_fileCharacter, buffer[i]);
+        }
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetAndSize_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        AZ_SKIP_WITHOUT_IO_URING();
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr char unexpectedChar = 'Z';
+        CreateDummyFile(16_kib, unalignedOffset);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(unalignedSize + 4, TestSectorSize));
+        buffer[unalignedSize] = unexpectedChar;
+        QueueRead(buffer, unalignedSize + 4, unalignedOffset, unalignedSize);
+        WaitTillCompleted();
+
+        EXPECT_EQ(s_chunkCharacter, buffer[0]);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(s_fileCharacter, buffer[(offset * unalignedOffset) - 1]);
+            EXPECT_EQ(s_chunkCharacter, buffer[offset * unalignedOffset]);
+        }
+        EXPECT_EQ(unexpectedChar, buffer[unalignedSize]);
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanChannels_AllReadsComplete)
+    {
+        AZ_SKIP_WITHOUT_IO_URING();
+        constexpr size_t numReads = TestMaxIOChannels * 3;
+        constexpr size_t fileSize = numReads * TestSectorSize;
+        CreateDummyFile(fileSize, TestSectorSize);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestSectorSize));
+        ::memset(buffer, 0, fileSize);
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            QueueRead(buffer + i * TestSectorSize, TestSectorSize, i * TestSectorSize, TestSectorSize);
+        }
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            EXPECT_EQ(s_chunkCharacter, buffer[i * TestSectorSize]);
+            EXPECT_EQ(s_fileCharacter, buffer[(i + 1) * TestSectorSize - 1]);
+        }
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_FileDoesNotExist_RequestIsForwarded)
+    {
+        AZ_SKIP_WITHOUT_IO_URING();
+        char buffer[16];
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), m_dummyRequestPath, 0, sizeof(buffer));
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                // There's no next entry to forward to, so the request fails.
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+#undef AZ_SKIP_WITHOUT_IO_URING
+} // namespace AZ::IO
@@ -10,4 +10,5 @@ set(FILES
     Tests/UtilsTests_Linux.cpp
     ../Common/UnixLike/Tests/UtilsTests_UnixLike.cpp
     Tests/Memory/AllocatorBenchmarks_Linux.cpp
+    Tests/IO/Streamer/StorageDriveTests_Linux.cpp
 )
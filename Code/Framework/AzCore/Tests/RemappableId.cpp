@@ -8,6 +8,9 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Serialization/IdUtils.h>
 
 namespace UnitTest
@@ -399,4 +402,56 @@ namespace UnitTest
         EXPECT_EQ(1, rootWrapper.m_parentEntityContainer->m_beginWriteCount);
     }
 
+    TEST_F(RemappableIdTest, CloneObjectsAndRemapUuid_ReferencesBetweenObjects_AreRemapped)
+    {
+        AllocatorInstance<PoolAllocator>::Create();
+        AllocatorInstance<ThreadPoolAllocator>::Create();
+        {
+            JobManagerDesc jobDesc;
+            JobManagerThreadDesc threadDesc;
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            JobManager jobManager(jobDesc);
+            JobContext jobContext(jobManager);
+
+            constexpr size_t objectCount = 16;
+            AZStd::vector<RemapIdData> testData(objectCount);
+            AZStd::vector<const RemapIdData*> testDataPtrs;
+            for (size_t i = 0; i < objectCount; ++i)
+            {
+                testData[i].m_remappableUuid = AZ::Uuid::CreateRandom();
+                testData[i].m_uuid2 = AZ::Uuid::CreateRandom();
+                testDataPtrs.push_back(&testData[i]);
+            }
+            // Every object references the id of the next one.
+            for (size_t i = 0; i < objectCount; ++i)
+            {
+                testData[i].m_uuid1 = testData[(i + 1) % objectCount].m_remappableUuid;
+            }
+
+            AZStd::unordered_map<Uuid, Uuid> remapUuids;
+            AZStd::vector<RemapIdData*> clones(objectCount, nullptr);
+            IdUtils::Remapper<Uuid>::CloneObjectsAndGenerateNewIdsAndFixRefs(
+                testDataPtrs.data(), objectCount, clones.data(), remapUuids, m_serializeContext.get(), &jobContext);
+
+            EXPECT_EQ(objectCount, remapUuids.size());
+            for (size_t i = 0; i < objectCount; ++i)
+            {
+                ASSERT_NE(nullptr, clones[i]);
+                EXPECT_NE(testData[i].m_remappableUuid, clones[i]->m_remappableUuid);
+                EXPECT_EQ(remapUuids[testData[i].m_remappableUuid], clones[i]->m_remappableUuid);
+                EXPECT_EQ(clones[(i + 1) % objectCount]->m_remappableUuid, clones[i]->m_uuid1);
+                // Uuid2 isn't referencing any of the objects so it stays the same.
+                EXPECT_EQ(testData[i].m_uuid2, clones[i]->m_uuid2);
+            }
+
+            for (RemapIdData* clone : clones)
+            {
+                delete clone;
+            }
+        }
+        AllocatorInstance<ThreadPoolAllocator>::Destroy();
+        AllocatorInstance<PoolAllocator>::Destroy();
+    }
+
 } // namespace UnitTest
@@ -10,6 +10,7 @@
 
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
@@ -58,6 +59,8 @@
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Path/PathReflect.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
@@ -3153,6 +3156,68 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
             AZStd::unordered_map<int, float*> m_mapOfFloatPointers;
             AZStd::shared_ptr<AZ::Entity> m_sharedEntityPointer;
         };
+
+        struct ClonablePlainPoint
+        {
+            AZ_TYPE_INFO(ClonablePlainPoint, "{7E0F3B7C-2E55-4C8D-9A61-0B7D9E1A4C32}");
+
+            ClonablePlainPoint() = default;
+            ClonablePlainPoint(float x, float y)
+                : m_x(x)
+                , m_y(y)
+            {
+            }
+
+            static void Reflect(SerializeContext& serializeContext)
+            {
+                serializeContext.Class<ClonablePlainPoint>()
+                    ->Field("x", &ClonablePlainPoint::m_x)
+                    ->Field("y", &ClonablePlainPoint::m_y)
+                    ;
+            }
+
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+        };
+
+        struct ClonablePlainData
+        {
+            AZ_TYPE_INFO(ClonablePlainData, "{2C4B8D51-6F0A-4E7B-8C3D-95A1E6F2B047}");
+            AZ_CLASS_ALLOCATOR(ClonablePlainData, AZ::SystemAllocator, 0);
+
+            static void Reflect(SerializeContext& serializeContext)
+            {
+                serializeContext.Class<ClonablePlainData>()
+                    ->Field("int", &ClonablePlainData::m_int)
+                    ->Field("bool", &ClonablePlainData::m_bool)
+                    ->Field("point", &ClonablePlainData::m_point)
+                    ->Field("u64", &ClonablePlainData::m_u64)
+                    ;
+            }
+
+            int m_int = 0;
+            bool m_bool = false;
+            ClonablePlainPoint m_point;
+            AZ::u64 m_u64 = 0;
+            int m_notReflected = 0;
+        };
+
+        struct ClonableMixedData
+        {
+            AZ_TYPE_INFO(ClonableMixedData, "{A8E5C1F4-3B9D-4F06-B27A-6D0C8E4F1935}");
+            AZ_CLASS_ALLOCATOR(ClonableMixedData, AZ::SystemAllocator, 0);
+
+            static void Reflect(SerializeContext& serializeContext)
+            {
+                serializeContext.Class<ClonableMixedData>()
+                    ->Field("plain", &ClonableMixedData::m_plain)
+                    ->Field("values", &ClonableMixedData::m_values)
+                    ;
+            }
+
+            ClonablePlainData m_plain;
+            AZStd::vector<ClonablePlainPoint> m_values;
+        };
     }
     TEST_F(Serialization, CloneTest)
     {
@@ -3295,6 +3360,121 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
         delete cloneObj;
     }
 
+    TEST_F(Serialization, CloneObject_PlainDataClass_CopiesReflectedFieldsOnly)
+    {
+        using namespace Clone;
+
+        ClonablePlainPoint::Reflect(*m_serializeContext);
+        ClonablePlainData::Reflect(*m_serializeContext);
+        ClonableMixedData::Reflect(*m_serializeContext);
+
+        ClonableMixedData testObj;
+        testObj.m_plain.m_int = 42;
+        testObj.m_plain.m_bool = true;
+        testObj.m_plain.m_point.m_x = 1.5f;
+        testObj.m_plain.m_point.m_y = -2.5f;
+        testObj.m_plain.m_u64 = 0x123456789ull;
+        testObj.m_plain.m_notReflected = 7;
+        testObj.m_values.emplace_back(3.0f, 4.0f);
+        testObj.m_values.emplace_back(5.0f, 6.0f);
+
+        // The plain data is copied using a clone plan while the vector goes through reflection.
+        ClonableMixedData* cloneObj = m_serializeContext->CloneObject(&testObj);
+        ASSERT_NE(nullptr, cloneObj);
+        EXPECT_EQ(testObj.m_plain.m_int, cloneObj->m_plain.m_int);
+        EXPECT_EQ(testObj.m_plain.m_bool, cloneObj->m_plain.m_bool);
+        EXPECT_EQ(testObj.m_plain.m_point.m_x, cloneObj->m_plain.m_point.m_x);
+        EXPECT_EQ(testObj.m_plain.m_point.m_y, cloneObj->m_plain.m_point.m_y);
+        EXPECT_EQ(testObj.m_plain.m_u64, cloneObj->m_plain.m_u64);
+        EXPECT_EQ(0, cloneObj->m_plain.m_notReflected);
+        ASSERT_EQ(testObj.m_values.size(), cloneObj->m_values.size());
+        for (size_t i = 0; i < testObj.m_values.size(); ++i)
+        {
+            EXPECT_EQ(testObj.m_values[i].m_x, cloneObj->m_values[i].m_x);
+            EXPECT_EQ(testObj.m_values[i].m_y, cloneObj->m_values[i].m_y);
+        }
+        delete cloneObj;
+    }
+
+    TEST_F(Serialization, CloneObjects_WithJobContext_ClonesAllObjectsInOrder)
+    {
+        using namespace Clone;
+
+        ClonablePlainPoint::Reflect(*m_serializeContext);
+        ClonablePlainData::Reflect(*m_serializeContext);
+        ClonableMixedData::Reflect(*m_serializeContext);
+
+        JobManagerDesc jobDesc;
+        JobManagerThreadDesc threadDesc;
+        jobDesc.m_workerThreads.push_back(threadDesc);
+        jobDesc.m_workerThreads.push_back(threadDesc);
+        AZStd::unique_ptr<JobManager> jobManager = AZStd::make_unique<JobManager>(jobDesc);
+        AZStd::unique_ptr<JobContext> jobContext = AZStd::make_unique<JobContext>(*jobManager);
+
+        constexpr size_t objectCount = 64;
+        AZStd::vector<ClonableMixedData> testObjs(objectCount);
+        AZStd::vector<const ClonableMixedData*> testObjPtrs;
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            testObjs[i].m_plain.m_int = aznumeric_cast<int>(i);
+            testObjs[i].m_values.resize(i % 4, ClonablePlainPoint(aznumeric_cast<float>(i), 1.0f));
+            testObjPtrs.push_back(&testObjs[i]);
+        }
+
+        AZStd::vector<ClonableMixedData*> clones(objectCount, nullptr);
+        m_serializeContext->CloneObjects(testObjPtrs.data(), objectCount, clones.data(), jobContext.get());
+
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            ASSERT_NE(nullptr, clones[i]);
+            EXPECT_NE(&testObjs[i], clones[i]);
+            EXPECT_EQ(testObjs[i].m_plain.m_int, clones[i]->m_plain.m_int);
+            ASSERT_EQ(testObjs[i].m_values.size(), clones[i]->m_values.size());
+            for (const ClonablePlainPoint& point : clones[i]->m_values)
+            {
+                EXPECT_EQ(aznumeric_cast<float>(i), point.m_x);
+            }
+            delete clones[i];
+        }
+
+        jobContext.reset();
+        jobManager.reset();
+    }
+
+    TEST_F(Serialization, ObjectStream_BinaryStreamWithManyInstancesOfClass_LoadsAllInstances)
+    {
+        using namespace Clone;
+
+        ClonablePlainPoint::Reflect(*m_serializeContext);
+        ClonablePlainData::Reflect(*m_serializeContext);
+        ClonableMixedData::Reflect(*m_serializeContext);
+
+        ClonableMixedData testObj;
+        testObj.m_plain.m_int = 11;
+        testObj.m_plain.m_point.m_x = 2.0f;
+        for (int i = 0; i < 100; ++i)
+        {
+            testObj.m_values.emplace_back(aznumeric_cast<float>(i), aznumeric_cast<float>(-i));
+        }
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(Utils::SaveObjectToStream(stream, DataStream::ST_BINARY, &testObj, m_serializeContext.get()));
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+        // The load plans created for the first point are reused for all following points.
+        ClonableMixedData loadedObj;
+        ASSERT_TRUE(Utils::LoadObjectFromStreamInPlace(stream, loadedObj, m_serializeContext.get()));
+        EXPECT_EQ(testObj.m_plain.m_int, loadedObj.m_plain.m_int);
+        EXPECT_EQ(testObj.m_plain.m_point.m_x, loadedObj.m_plain.m_point.m_x);
+        ASSERT_EQ(testObj.m_values.size(), loadedObj.m_values.size());
+        for (size_t i = 0; i < testObj.m_values.size(); ++i)
+        {
+            EXPECT_EQ(testObj.m_values[i].m_x, loadedObj.m_values[i].m_x);
+            EXPECT_EQ(testObj.m_values[i].m_y, loadedObj.m_values[i].m_y);
+        }
+    }
+
     struct TestCloneAssetData
         : public AZ::Data::AssetData
     {
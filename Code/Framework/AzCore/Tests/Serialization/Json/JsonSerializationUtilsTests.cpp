@@ -293,6 +293,40 @@ namespace UnitTest
         EXPECT_FALSE(result.IsSuccess());
         EXPECT_TRUE(result.GetError().find("JSON parse error at line 5:") == 0);
     }
+
+    TEST_F(JsonSerializationUtilsTests, LoadJsonStream_LargerThanReadChunk)
+    {
+        // The stream is parsed as it's read, make sure values straddling the read chunks are intact
+        constexpr size_t ElementCount = 40000;
+        AZStd::string jsonText = "[\n";
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            jsonText += AZStd::string::format("%zu,\n", i);
+        }
+        jsonText += "\"last\"]";
+
+        IO::MemoryStream stream(jsonText.data(), jsonText.size());
+
+        AZ::Outcome<rapidjson::Document, AZStd::string> result = JsonSerializationUtils::ReadJsonStream(stream);
+
+        ASSERT_TRUE(result.IsSuccess());
+        const rapidjson::Document& document = result.GetValue();
+        ASSERT_TRUE(document.IsArray());
+        ASSERT_EQ(document.Size(), ElementCount + 1);
+        for (rapidjson::SizeType i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_EQ(document[i].GetUint64(), i);
+        }
+        EXPECT_STREQ(document[static_cast<rapidjson::SizeType>(ElementCount)].GetString(), "last");
+
+        // A missing comma after the last number reports the line past all the chunks read
+        jsonText.erase(jsonText.rfind(','), 1);
+        IO::MemoryStream invalidStream(jsonText.data(), jsonText.size());
+        result = JsonSerializationUtils::ReadJsonStream(invalidStream);
+
+        EXPECT_FALSE(result.IsSuccess());
+        EXPECT_TRUE(result.GetError().find(AZStd::string::format("JSON parse error at line %zu:", ElementCount + 2)) == 0);
+    }
     
     TEST_F(JsonSerializationUtilsTests, LoadObjectFromStream_Failed_ParseError)
     {
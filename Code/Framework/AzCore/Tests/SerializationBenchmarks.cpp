@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // A component-like class, with the mix of plain data, math types, strings and containers that prefabs and slices clone
+    struct CloneBenchmarkElement
+    {
+        AZ_TYPE_INFO(CloneBenchmarkElement, "{5B0B5B6C-5D8F-4C38-9C8A-2FB0E0E1A1C7}");
+        AZ_CLASS_ALLOCATOR(CloneBenchmarkElement, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<CloneBenchmarkElement>()
+                ->Field("name", &CloneBenchmarkElement::m_name)
+                ->Field("transform", &CloneBenchmarkElement::m_transform)
+                ->Field("values", &CloneBenchmarkElement::m_values)
+                ->Field("enabled", &CloneBenchmarkElement::m_enabled);
+        }
+
+        AZStd::string m_name;
+        AZ::Transform m_transform = AZ::Transform::CreateIdentity();
+        AZStd::vector<float> m_values;
+        bool m_enabled = true;
+    };
+
+    struct CloneBenchmarkContainer
+    {
+        AZ_TYPE_INFO(CloneBenchmarkContainer, "{0A3C1E2D-7A43-4E9B-8E7E-1E1F5C0E6B2A}");
+        AZ_CLASS_ALLOCATOR(CloneBenchmarkContainer, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<CloneBenchmarkContainer>()
+                ->Field("elements", &CloneBenchmarkContainer::m_elements)
+                ->Field("lookup", &CloneBenchmarkContainer::m_lookup);
+        }
+
+        AZStd::vector<CloneBenchmarkElement> m_elements;
+        AZStd::unordered_map<AZStd::string, int> m_lookup;
+    };
+
+    class SerializeContextCloneBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+    protected:
+        void InternalSetUp(const ::benchmark::State& state)
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::MathReflect(m_serializeContext.get());
+            CloneBenchmarkElement::Reflect(*m_serializeContext);
+            CloneBenchmarkContainer::Reflect(*m_serializeContext);
+
+            const int64_t elementCount = state.range(0);
+            m_source.m_elements.resize(elementCount);
+            for (int64_t i = 0; i < elementCount; ++i)
+            {
+                CloneBenchmarkElement& element = m_source.m_elements[i];
+                element.m_name = AZStd::string::format("Element_%lld", static_cast<long long>(i));
+                element.m_values.resize(16, static_cast<float>(i));
+                m_source.m_lookup.emplace(element.m_name, static_cast<int>(i));
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_source = {};
+            m_serializeContext.reset();
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        CloneBenchmarkContainer m_source;
+    };
+
+    BENCHMARK_DEFINE_F(SerializeContextCloneBenchmarkFixture, BM_SerializeContextCloneObject)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            CloneBenchmarkContainer* clone = m_serializeContext->CloneObject(&m_source);
+
+            state.PauseTiming();
+            delete clone;
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializeContextCloneBenchmarkFixture, BM_SerializeContextCloneObject)->Arg(10)->Arg(100)->Arg(1000);
+
+    BENCHMARK_DEFINE_F(SerializeContextCloneBenchmarkFixture, BM_SerializeContextCloneObjectInplace)(benchmark::State& state)
+    {
+        CloneBenchmarkContainer clone;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            clone = {};
+            state.ResumeTiming();
+
+            m_serializeContext->CloneObjectInplace(clone, &m_source);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializeContextCloneBenchmarkFixture, BM_SerializeContextCloneObjectInplace)->Arg(10)->Arg(100)->Arg(1000);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
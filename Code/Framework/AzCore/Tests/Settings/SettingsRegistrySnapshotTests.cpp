@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace SettingsRegistrySnapshotTests
+{
+    class SettingsRegistrySnapshotFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            ASSERT_TRUE(m_registry->MergeSettings(R"(
+                {
+                    "Test":
+                    {
+                        "Bool": true,
+                        "Signed": -42,
+                        "Unsigned": 18446744073709551615,
+                        "Double": 3.5,
+                        "String": "hello",
+                        "Null": null,
+                        "Array": [ 1, "two", { "three": 3 }, [] ],
+                        "Escaped~/Name": "escaped",
+                        "Empty": {}
+                    }
+                })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        }
+
+        void TearDown() override
+        {
+            m_registry.reset();
+        }
+
+        static AZStd::string Dump(const AZ::SettingsRegistryInterface& registry)
+        {
+            AZStd::string output;
+            AZ::IO::ByteContainerStream<AZStd::string> stream(&output);
+            AZ::SettingsRegistryMergeUtils::DumperSettings dumperSettings;
+            AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(
+                const_cast<AZ::SettingsRegistryInterface&>(registry), "", stream, dumperSettings);
+            return output;
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_registry;
+    };
+
+    TEST_F(SettingsRegistrySnapshotFixture, Create_ValuesFromRegistry_CanBeLookedUp)
+    {
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Create(*m_registry, "config", {}));
+
+        bool boolValue = false;
+        EXPECT_TRUE(snapshot.Get(boolValue, "/Test/Bool"));
+        EXPECT_TRUE(boolValue);
+
+        AZ::s64 signedValue = 0;
+        EXPECT_TRUE(snapshot.Get(signedValue, "/Test/Signed"));
+        EXPECT_EQ(-42, signedValue);
+
+        AZ::u64 unsignedValue = 0;
+        EXPECT_TRUE(snapshot.Get(unsignedValue, "/Test/Unsigned"));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), unsignedValue);
+        EXPECT_FALSE(snapshot.Get(signedValue, "/Test/Unsigned"));
+        EXPECT_FALSE(snapshot.Get(unsignedValue, "/Test/Signed"));
+
+        double doubleValue = 0.0;
+        EXPECT_TRUE(snapshot.Get(doubleValue, "/Test/Double"));
+        EXPECT_DOUBLE_EQ(3.5, doubleValue);
+
+        AZStd::string_view stringValue;
+        EXPECT_TRUE(snapshot.Get(stringValue, "/Test/String"));
+        EXPECT_EQ("hello", stringValue);
+        EXPECT_TRUE(snapshot.Get(stringValue, "/Test/Array/1"));
+        EXPECT_EQ("two", stringValue);
+        EXPECT_TRUE(snapshot.Get(stringValue, "/Test/Escaped~0~1Name"));
+        EXPECT_EQ("escaped", stringValue);
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, snapshot.GetType(""));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, snapshot.GetType("/Test/Null"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, snapshot.GetType("/Test/Array"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Integer, snapshot.GetType("/Test/Array/2/three"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, snapshot.GetType("/Test/Empty"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshot.GetType("/Test/Missing"));
+        EXPECT_FALSE(snapshot.Get(stringValue, "/Test/Bool"));
+    }
+
+    TEST_F(SettingsRegistrySnapshotFixture, Load_SavedSnapshot_RestoresValuesAndInputs)
+    {
+        AZ::SettingsRegistrySnapshot::Input inputs[] = { { "Engine/Registry", 1234 }, { "Project/Registry", 5678 } };
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Create(*m_registry, "platform=Test", inputs));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(snapshot.Save(stream));
+
+        AZ::SettingsRegistrySnapshot loaded;
+        ASSERT_TRUE(loaded.Load(buffer));
+        EXPECT_EQ("platform=Test", loaded.GetConfiguration());
+        ASSERT_EQ(2, loaded.GetInputCount());
+        EXPECT_EQ("Engine/Registry", loaded.GetInputPath(0));
+        EXPECT_EQ(1234, loaded.GetInputHash(0));
+        EXPECT_EQ("Project/Registry", loaded.GetInputPath(1));
+        EXPECT_EQ(5678, loaded.GetInputHash(1));
+        EXPECT_EQ(snapshot.GetValueCount(), loaded.GetValueCount());
+
+        AZStd::string_view stringValue;
+        EXPECT_TRUE(loaded.Get(stringValue, "/Test/String"));
+        EXPECT_EQ("hello", stringValue);
+    }
+
+    TEST_F(SettingsRegistrySnapshotFixture, Load_CorruptedData_Fails)
+    {
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Create(*m_registry, "config", {}));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(snapshot.Save(stream));
+
+        AZ::SettingsRegistrySnapshot loaded;
+        EXPECT_FALSE(loaded.Load(AZStd::span<const char>(buffer.data(), buffer.size() - sizeof(AZ::u64))));
+        buffer[0] = 'X';
+        EXPECT_FALSE(loaded.Load(buffer));
+        EXPECT_FALSE(loaded.IsValid());
+    }
+
+    TEST_F(SettingsRegistrySnapshotFixture, MergeSettingsSnapshot_IntoEmptyRegistry_MatchesOriginalRegistry)
+    {
+        // Null values are removed when merged as a JSON Merge Patch, the same as when merging the original files.
+        m_registry->Remove("/Test/Null");
+
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Create(*m_registry, "config", {}));
+
+        AZ::SettingsRegistryImpl mergedRegistry;
+        ASSERT_TRUE(mergedRegistry.MergeSettingsSnapshot(snapshot));
+        EXPECT_EQ(Dump(*m_registry), Dump(mergedRegistry));
+    }
+
+    TEST_F(SettingsRegistrySnapshotFixture, MergeSettingsSnapshot_WithAnchorKey_MergesUnderAnchor)
+    {
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Create(*m_registry, "config", {}));
+
+        AZ::SettingsRegistryImpl mergedRegistry;
+        ASSERT_TRUE(mergedRegistry.Set("/Anchor/Existing", true));
+        ASSERT_TRUE(mergedRegistry.MergeSettingsSnapshot(snapshot, "/Anchor"));
+
+        bool existingValue = false;
+        EXPECT_TRUE(mergedRegistry.Get(existingValue, "/Anchor/Existing"));
+        AZ::s64 signedValue = 0;
+        EXPECT_TRUE(mergedRegistry.Get(signedValue, "/Anchor/Test/Signed"));
+        EXPECT_EQ(-42, signedValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, mergedRegistry.GetType("/Anchor/Test/Array/3"));
+    }
+
+    TEST_F(SettingsRegistrySnapshotFixture, Create_ManyValues_AllValuesCanBeLookedUp)
+    {
+        constexpr AZ::s64 ValueCount = 5000;
+        for (AZ::s64 i = 0; i < ValueCount; ++i)
+        {
+            ASSERT_TRUE(m_registry->Set(AZStd::string::format("/Many/Value%lld", static_cast<long long>(i)), i));
+        }
+
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Create(*m_registry, "config", {}));
+        for (AZ::s64 i = 0; i < ValueCount; ++i)
+        {
+            AZ::s64 value = -1;
+            ASSERT_TRUE(snapshot.Get(value, AZStd::string::format("/Many/Value%lld", static_cast<long long>(i))));
+            EXPECT_EQ(i, value);
+        }
+        AZ::s64 value = -1;
+        EXPECT_FALSE(snapshot.Get(value, AZStd::string::format("/Many/Value%lld", static_cast<long long>(ValueCount))));
+    }
+
+    TEST_F(SettingsRegistrySnapshotFixture, GetRegistrySnapshotConfiguration_SpecializationOrderDiffers_ConfigurationIsEqual)
+    {
+        AZ::SettingsRegistryInterface::Specializations lhs{ "profile", "game", "Project" };
+        AZ::SettingsRegistryInterface::Specializations rhs{ "profile", "Project", "game" };
+        EXPECT_EQ(AZ::SettingsRegistryMergeUtils::GetRegistrySnapshotConfiguration("Test", lhs),
+            AZ::SettingsRegistryMergeUtils::GetRegistrySnapshotConfiguration("Test", rhs));
+        EXPECT_NE(AZ::SettingsRegistryMergeUtils::GetRegistrySnapshotConfiguration("Test", lhs),
+            AZ::SettingsRegistryMergeUtils::GetRegistrySnapshotConfiguration("Other", lhs));
+    }
+} // namespace SettingsRegistrySnapshotTests
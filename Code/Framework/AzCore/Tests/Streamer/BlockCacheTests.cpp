@@ -71,11 +71,12 @@ namespace AZ::IO
             TeardownAllocator();
         }
 
-        void CreateTestEnvironmentImplementation(bool onlyEpilogWrites)
+        void CreateTestEnvironmentImplementation(bool onlyEpilogWrites, bool adaptive = false)
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites,
+                adaptive, m_maxReadAheadBlocks);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -244,6 +245,7 @@ namespace AZ::IO
         u32 m_blockSize{ 64 * 1024 };
         u64 m_fakeFileLength{ 5 * m_blockSize };
         u64 m_readBufferLength{ 10 * 1024 * 1024 };
+        u32 m_maxReadAheadBlocks{ 4 };
         bool m_fakeFileFound{ true };
     };
 
@@ -1177,4 +1179,110 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+    /////////////////////////////////////////////////////////////
+    // Adaptive
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCacheAdaptiveTest
+        : public BlockCacheTest
+    {
+    public:
+        void CreateTestEnvironment()
+        {
+            CreateTestEnvironmentImplementation(false, true);
+        }
+
+        s64 GetStatistic(AZStd::string_view name) const
+        {
+            AZStd::vector<Statistic> statistics;
+            m_cache->CollectStatistics(statistics);
+            for (const Statistic& statistic : statistics)
+            {
+                if (statistic.GetName() == name)
+                {
+                    return statistic.GetIntegerValue();
+                }
+            }
+            ADD_FAILURE() << "Statistic '" << name.data() << "' not found.";
+            return 0;
+        }
+    };
+
+    // File    |------------------------------------------------|
+    // Request |--------||--------||--------||--------|
+    // Cache   [   x    ][    x   ][   v    ][   v    ][   v    ]
+    TEST_F(Streamer_BlockCacheAdaptiveTest, ReadFile_SequentialReads_FollowingBlocksAreReadAheadAndReused)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        m_fakeFileLength = 16 * m_blockSize;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(AnyNumber());
+        // The third and fourth block are only read once, ahead of the requests for them.
+        EXPECT_CALL(*this, ReadFile(_, _, 2 * m_blockSize, _)).Times(1);
+        EXPECT_CALL(*this, ReadFile(_, _, 3 * m_blockSize, _)).Times(1);
+
+        for (u64 i = 0; i < 4; ++i)
+        {
+            ProcessRead(m_buffer, m_path, i * m_blockSize, m_blockSize, IStreamerTypes::RequestStatus::Completed);
+            VerifyReadBuffer(i * m_blockSize, m_blockSize);
+        }
+
+        EXPECT_LT(0, GetStatistic("Read-ahead blocks"));
+        EXPECT_EQ(2, GetStatistic("Read-ahead hits"));
+        EXPECT_EQ(0, GetStatistic("Bypassed reads"));
+    }
+
+    // File    |------------------------------------------------|
+    // Request        |-|  |-|             |-|       |-|
+    // Cache   [   x    ][    x   ][   x    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheAdaptiveTest, ReadFile_RandomReadsWithLowHitRate_CacheIsBypassed)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        constexpr u64 readSize = 1024;
+        m_fakeFileLength = 64 * m_blockSize;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(AnyNumber());
+        // The first read isn't known to be random yet so reads an entire block. Once the cache is bypassed, only the
+        // requested data is read by the next entry.
+        EXPECT_CALL(*this, ReadFile(_, _, _, readSize)).Times(3);
+
+        const u64 offsets[] = { 37, 5, 50, 12 };
+        for (u64 block : offsets)
+        {
+            u64 offset = block * m_blockSize + 256;
+            ProcessRead(m_buffer, m_path, offset, readSize, IStreamerTypes::RequestStatus::Completed);
+            VerifyReadBuffer(offset, readSize);
+        }
+
+        EXPECT_EQ(3, GetStatistic("Bypassed reads"));
+        EXPECT_EQ(0, GetStatistic("Read-ahead blocks"));
+        EXPECT_EQ(1, GetStatistic("Misses"));
+    }
+
+    TEST_F(Streamer_BlockCacheAdaptiveTest, ReadFile_CacheFullOfBlocks_EvictionsAreCounted)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        m_cacheSize = 2 * m_blockSize;
+        m_fakeFileLength = 16 * m_blockSize;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(AnyNumber());
+
+        // Each read only touches the prolog of a different block, so the third read has to evict one of the blocks.
+        ProcessRead(m_buffer, m_path, 256, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 8 * m_blockSize + 256, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 4 * m_blockSize + 256, 1024, IStreamerTypes::RequestStatus::Completed);
+
+        EXPECT_EQ(1, GetStatistic("Evictions"));
+    }
 } // namespace AZ::IO
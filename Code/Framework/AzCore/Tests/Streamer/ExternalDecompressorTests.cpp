@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/Streamer/ExternalDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ExternalDecompressorTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ExternalDecompressor>
+    {
+    public:
+        ExternalDecompressor CreateInstance() override
+        {
+            return ExternalDecompressor(2, 4096);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_ExternalDecompressorConformityTests, StreamStackEntryConformityTests, ExternalDecompressorTestDescription);
+
+    class Streamer_ExternalDecompressorTest
+        : public UnitTest::AllocatorsFixture
+        , public ExternalDecompressionBus::Handler
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            m_buffer = AZStd::make_unique<u32[]>(m_fakeFileLength >> 2);
+            m_context = AZStd::make_unique<StreamerContext>();
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_decompressor = AZStd::make_shared<ExternalDecompressor>(2, 64);
+            m_decompressor->SetContext(*m_context);
+            m_decompressor->SetNext(m_mock);
+
+            ExternalDecompressionBus::Handler::BusConnect();
+        }
+
+        void TearDown() override
+        {
+            ExternalDecompressionBus::Handler::BusDisconnect();
+
+            m_decompressor.reset();
+            m_mock.reset();
+            m_context.reset();
+            m_buffer.reset();
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        // ExternalDecompression
+        bool CanDecompress(const CompressionInfo&, u64, u64) const override
+        {
+            return m_acceptRequests;
+        }
+
+        void* AcquireStagingBuffer(size_t size, size_t alignment) override
+        {
+            if (!m_provideStagingMemory)
+            {
+                return nullptr;
+            }
+            m_numStagingBuffers++;
+            return azmalloc(size, alignment);
+        }
+
+        void ReleaseStagingBuffer(void* stagingBuffer) override
+        {
+            m_numStagingBuffers--;
+            azfree(stagingBuffer);
+        }
+
+        void Decompress(const CompressionInfo&, void* stagingBuffer, size_t compressedOffset,
+            void* output, u64 readOffset, u64 readSize, CompletionCallback onCompleted) override
+        {
+            // The fake compression algorithm stores the data as is.
+            memcpy(output, reinterpret_cast<u8*>(stagingBuffer) + compressedOffset + readOffset, readSize);
+            m_numDecompressions++;
+            ReleaseStagingBuffer(stagingBuffer);
+            onCompleted(true);
+        }
+
+        void MockReads(IStreamerTypes::RequestStatus readResult)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Invoke;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, QueueRequest(_))
+                .WillOnce(Invoke([this, readResult](FileRequest* request)
+                    {
+                        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+                        ASSERT_NE(nullptr, data);
+                        if (readResult == IStreamerTypes::RequestStatus::Completed)
+                        {
+                            u32* buffer = reinterpret_cast<u32*>(data->m_output);
+                            for (u64 i = 0; i < (data->m_size >> 2); ++i)
+                            {
+                                buffer[i] = aznumeric_caster(data->m_offset + (i << 2));
+                            }
+                        }
+                        request->SetStatus(readResult);
+                        m_context->MarkRequestAsCompleted(request);
+                    }));
+        }
+
+        FileRequest* CreateCompressedRead(u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult)
+        {
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_fakeFileLength;
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_decompressor = [](const CompressionInfo&, const void*, size_t, void*, size_t) { return false; };
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer.get(), offset, size);
+            request->SetCompletionCallback([this, expectedResult](const FileRequest& request)
+                {
+                    m_completed = true;
+                    EXPECT_EQ(expectedResult, request.GetStatus());
+                });
+            return request;
+        }
+
+        void ProcessRequests()
+        {
+            bool isIdle = false;
+            while (m_decompressor->ExecuteRequests() || !isIdle)
+            {
+                m_context->FinalizeCompletedRequests();
+
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                isIdle = status.m_isIdle;
+            }
+        }
+
+        AZStd::unique_ptr<u32[]> m_buffer;
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<ExternalDecompressor> m_decompressor;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        u64 m_fakeFileLength{ 64 * 1024 };
+        u32 m_numDecompressions{ 0 };
+        s32 m_numStagingBuffers{ 0 };
+        bool m_acceptRequests{ true };
+        bool m_provideStagingMemory{ true };
+        bool m_completed{ false };
+    };
+
+    TEST_F(Streamer_ExternalDecompressorTest, QueueRequest_AcceptedCompressedRead_ReadsIntoStagingAndHandsOverDecompression)
+    {
+        MockReads(IStreamerTypes::RequestStatus::Completed);
+
+        m_decompressor->QueueRequest(CreateCompressedRead(256, m_fakeFileLength - 512, IStreamerTypes::RequestStatus::Completed));
+        ProcessRequests();
+
+        EXPECT_TRUE(m_completed);
+        EXPECT_EQ(1, m_numDecompressions);
+        EXPECT_EQ(0, m_numStagingBuffers);
+        for (u64 i = 0; i < ((m_fakeFileLength - 512) >> 2); ++i)
+        {
+            ASSERT_EQ(256 + (i << 2), m_buffer[i]);
+        }
+    }
+
+    TEST_F(Streamer_ExternalDecompressorTest, QueueRequest_DeclinedCompressedRead_RequestIsForwarded)
+    {
+        using ::testing::_;
+
+        m_acceptRequests = false;
+        FileRequest* request = CreateCompressedRead(0, m_fakeFileLength, IStreamerTypes::RequestStatus::Completed);
+        EXPECT_CALL(*m_mock, QueueRequest(request));
+
+        m_decompressor->QueueRequest(request);
+        EXPECT_EQ(0, m_numDecompressions);
+    }
+
+    TEST_F(Streamer_ExternalDecompressorTest, ExecuteRequests_NoStagingMemoryAvailable_RequestIsForwarded)
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        m_provideStagingMemory = false;
+        FileRequest* request = CreateCompressedRead(0, m_fakeFileLength, IStreamerTypes::RequestStatus::Completed);
+        EXPECT_CALL(*m_mock, QueueRequest(request));
+        EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+
+        m_decompressor->QueueRequest(request);
+        EXPECT_TRUE(m_decompressor->ExecuteRequests());
+        EXPECT_EQ(0, m_numDecompressions);
+    }
+
+    TEST_F(Streamer_ExternalDecompressorTest, ExecuteRequests_FailedRead_StagingMemoryIsReleasedAndFailureReported)
+    {
+        MockReads(IStreamerTypes::RequestStatus::Failed);
+
+        m_decompressor->QueueRequest(CreateCompressedRead(0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed));
+        ProcessRequests();
+
+        EXPECT_TRUE(m_completed);
+        EXPECT_EQ(0, m_numDecompressions);
+        EXPECT_EQ(0, m_numStagingBuffers);
+    }
+} // namespace AZ::IO
@@ -26,6 +26,11 @@ namespace AZ::IO
     protected:
         StreamerContext* m_streamerContext{ nullptr };
 
+        virtual SchedulerConfig CreateSchedulerConfig() const
+        {
+            return SchedulerConfig{};
+        }
+
     public:
         void SetUp() override
         {
@@ -56,7 +61,8 @@ namespace AZ::IO
 
             auto isIdle = m_isStackIdle.load();
             m_isStackIdle = true;
-            m_streamer = aznew IO::Streamer(AZStd::thread_desc{}, AZStd::make_unique<Scheduler>(m_mock));
+            m_streamer = aznew IO::Streamer(AZStd::thread_desc{},
+                AZStd::make_unique<Scheduler>(m_mock, AZCORE_GLOBAL_NEW_ALIGNMENT, 1, 1_mib, CreateSchedulerConfig()));
             m_isStackIdle = isIdle;
             Interface<IO::IStreamer>::Register(m_streamer);
         }
@@ -378,4 +384,132 @@ namespace AZ::IO
 
         EXPECT_EQ(Iterations + 1, counter);
     }
+
+    class Streamer_SchedulerEarliestDeadlineFirstTest
+        : public Streamer_SchedulerTest
+    {
+    protected:
+        SchedulerConfig CreateSchedulerConfig() const override
+        {
+            SchedulerConfig config;
+            config.m_mode = SchedulingMode::EarliestDeadlineFirst;
+            config.m_maxWaitTime = m_maxWaitTime;
+            return config;
+        }
+
+        //! Mocks the stack to complete reads immediately and records the size of the reads in the order they arrive.
+        void MockForReadOrder(int numReads)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+
+            EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, PrepareRequest(_))
+                .Times(numReads)
+                .WillRepeatedly([this](FileRequest* request)
+                    {
+                        auto readData = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand());
+                        AZ_Assert(readData, "Test didn't pass in the correct request.");
+                        FileRequest* read = m_streamerContext->GetNewInternalRequest();
+                        read->CreateRead(request, readData->m_output, readData->m_outputSize, readData->m_path,
+                            readData->m_offset, readData->m_size);
+                        m_streamerContext->PushPreparedRequest(read);
+                    });
+            EXPECT_CALL(*m_mock, QueueRequest(_))
+                .Times(numReads)
+                .WillRepeatedly([this](FileRequest* request)
+                    {
+                        auto readData = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+                        AZ_Assert(readData, "Test didn't pass in the correct request.");
+                        m_readOrder.push_back(readData->m_size);
+                        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                        m_streamerContext->MarkRequestAsCompleted(request);
+                    });
+        }
+
+        AZStd::vector<u64> m_readOrder;
+        AZStd::chrono::microseconds m_maxWaitTime{ AZStd::chrono::seconds(60) };
+    };
+
+    TEST_F(Streamer_SchedulerEarliestDeadlineFirstTest, ScheduleRequests_ReadWithDeadlineQueuedLast_ReadWithDeadlineIsProcessedFirst)
+    {
+        MockForReadOrder(2);
+
+        AZStd::atomic_int counter = 2;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        char fakeBuffer[8];
+        FileRequestPtr background = m_streamer->Read("TestPath", fakeBuffer, sizeof(fakeBuffer), 8,
+            IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityHighest);
+        FileRequestPtr urgent = m_streamer->Read("TestPath", fakeBuffer, sizeof(fakeBuffer), 4,
+            AZStd::chrono::seconds(10), IStreamerTypes::s_priorityLowest);
+        m_streamer->SetRequestCategory(urgent, IStreamerTypes::RequestCategory::Audio);
+
+        m_streamer->SetRequestCompleteCallback(background, wait);
+        m_streamer->SetRequestCompleteCallback(urgent, wait);
+
+        m_streamer->SuspendProcessing();
+        m_streamer->QueueRequest(background);
+        m_streamer->QueueRequest(urgent);
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        ASSERT_EQ(2, m_readOrder.size());
+        EXPECT_EQ(4, m_readOrder[0]);
+        EXPECT_EQ(8, m_readOrder[1]);
+    }
+
+    class Streamer_SchedulerEarliestDeadlineFirstNoWaitTest
+        : public Streamer_SchedulerEarliestDeadlineFirstTest
+    {
+    public:
+        Streamer_SchedulerEarliestDeadlineFirstNoWaitTest()
+        {
+            m_maxWaitTime = AZStd::chrono::microseconds(0);
+        }
+    };
+
+    TEST_F(Streamer_SchedulerEarliestDeadlineFirstNoWaitTest, ScheduleRequests_MaxWaitTimeExceeded_ReadWithoutDeadlineIsNotStarved)
+    {
+        MockForReadOrder(2);
+
+        AZStd::atomic_int counter = 2;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        // Both requests have waited longer than the maximum wait time when they're scheduled, so they're both treated as
+        // being at their deadline and the priority decides the order.
+        char fakeBuffer[8];
+        FileRequestPtr background = m_streamer->Read("TestPath", fakeBuffer, sizeof(fakeBuffer), 8,
+            IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityHighest);
+        FileRequestPtr deadline = m_streamer->Read("TestPath", fakeBuffer, sizeof(fakeBuffer), 4,
+            AZStd::chrono::seconds(10), IStreamerTypes::s_priorityLowest);
+
+        m_streamer->SetRequestCompleteCallback(background, wait);
+        m_streamer->SetRequestCompleteCallback(deadline, wait);
+
+        m_streamer->SuspendProcessing();
+        m_streamer->QueueRequest(background);
+        m_streamer->QueueRequest(deadline);
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        ASSERT_EQ(2, m_readOrder.size());
+        EXPECT_EQ(8, m_readOrder[0]);
+        EXPECT_EQ(4, m_readOrder[1]);
+    }
 } // namespace AZ::IO
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskAlgorithms.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace UnitTest
+{
+    using namespace AZ::TaskAlgorithms;
+
+    class TaskAlgorithmsTestFixture : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_executor = aznew AZ::TaskExecutor(4);
+            m_desc.m_executor = m_executor;
+            m_desc.m_grainSize = 64;
+
+            std::mt19937 generator(7);
+            m_values.resize(100003);
+            for (int& value : m_values)
+            {
+                value = static_cast<int>(generator() % 20000) - 10000;
+            }
+        }
+
+        void TearDown() override
+        {
+            m_values = {};
+            azdestroy(m_executor);
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        AZ::TaskExecutor* m_executor = nullptr;
+        AZ::TaskAlgorithmDesc m_desc;
+        AZStd::vector<int> m_values;
+    };
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelForVisitsEveryIndexOnce)
+    {
+        AZStd::vector<AZStd::atomic<int>> visits(m_values.size());
+        parallel_for(size_t(0), m_values.size(), [&visits](size_t index) { ++visits[index]; }, m_desc);
+        for (const AZStd::atomic<int>& visitCount : visits)
+        {
+            EXPECT_EQ(visitCount, 1);
+        }
+
+        AZStd::atomic<int64_t> sum = 0;
+        parallel_for_each(m_values.begin(), m_values.end(), [&sum](int value) { sum += value; }, m_desc);
+        EXPECT_EQ(sum, std::accumulate(m_values.begin(), m_values.end(), int64_t(0)));
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelForRangeCoversRange)
+    {
+        AZStd::atomic<int64_t> count = 0;
+        parallel_for_range(-500, 500, [&count](int first, int last)
+        {
+            EXPECT_LT(first, last);
+            count += last - first;
+        }, m_desc);
+        EXPECT_EQ(count, 1000);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelReduce)
+    {
+        const auto add = [](int64_t lhs, int64_t rhs) { return lhs + rhs; };
+        EXPECT_EQ(parallel_reduce(m_values.begin(), m_values.end(), int64_t(5), add, m_desc), std::accumulate(m_values.begin(), m_values.end(), int64_t(5)));
+        EXPECT_EQ(parallel_reduce(m_values.begin(), m_values.begin(), int64_t(5), add, m_desc), 5);
+
+        const int64_t sumOfSquares = parallel_transform_reduce(m_values.begin(), m_values.end(), int64_t(0), add,
+            [](int value) { return int64_t(value) * value; }, m_desc);
+        EXPECT_EQ(sumOfSquares, std::inner_product(m_values.begin(), m_values.end(), m_values.begin(), int64_t(0)));
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelScans)
+    {
+        const auto add = [](int64_t lhs, int64_t rhs) { return lhs + rhs; };
+        AZStd::vector<int64_t> inclusive(m_values.size());
+        AZStd::vector<int64_t> exclusive(m_values.size());
+        parallel_inclusive_scan(m_values.begin(), m_values.end(), inclusive.begin(), add, m_desc);
+        parallel_exclusive_scan(m_values.begin(), m_values.end(), exclusive.begin(), int64_t(10), add, m_desc);
+
+        int64_t sum = 0;
+        for (size_t index = 0; index < m_values.size(); ++index)
+        {
+            EXPECT_EQ(exclusive[index], sum + 10);
+            sum += m_values[index];
+            EXPECT_EQ(inclusive[index], sum);
+        }
+
+        // In place
+        AZStd::vector<int64_t> values;
+        for (int value : m_values)
+        {
+            values.push_back(value);
+        }
+        parallel_inclusive_scan(values.begin(), values.end(), values.begin(), add, m_desc);
+        EXPECT_EQ(values, inclusive);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelSortIntegers)
+    {
+        AZStd::vector<int> expected = m_values;
+        std::sort(expected.begin(), expected.end());
+
+        AZStd::vector<int> values = m_values;
+        parallel_sort(values.begin(), values.end());
+        EXPECT_EQ(values, expected);
+
+        values = m_values;
+        parallel_sort(values.begin(), values.end(), AZStd::less<int>(), m_desc);
+        EXPECT_EQ(values, expected);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelSortsAreStable)
+    {
+        using Element = AZStd::pair<uint32_t, size_t>;
+        AZStd::vector<Element> elements(m_values.size());
+        for (size_t index = 0; index < m_values.size(); ++index)
+        {
+            elements[index] = { static_cast<uint32_t>(m_values[index] + 10000) % 97, index };
+        }
+
+        const auto compareKeys = [](const Element& lhs, const Element& rhs) { return lhs.first < rhs.first; };
+        AZStd::vector<Element> expected = elements;
+        std::stable_sort(expected.begin(), expected.end(), compareKeys);
+
+        AZStd::vector<Element> sorted = elements;
+        parallel_sort(sorted.begin(), sorted.end(), compareKeys, m_desc);
+        EXPECT_EQ(sorted, expected);
+
+        sorted = elements;
+        parallel_radix_sort(sorted.begin(), sorted.end(), [](const Element& element) { return element.first; }, m_desc);
+        EXPECT_EQ(sorted, expected);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelSortStrings)
+    {
+        AZStd::vector<AZStd::string> strings;
+        for (size_t index = 0; index < 5000; ++index)
+        {
+            strings.push_back(AZStd::string::format("%d", m_values[index]));
+        }
+
+        AZStd::vector<AZStd::string> expected = strings;
+        std::sort(expected.begin(), expected.end());
+        parallel_sort(strings.begin(), strings.end(), AZStd::less<AZStd::string>(), m_desc);
+        EXPECT_EQ(strings, expected);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelStablePartition)
+    {
+        const auto isEven = [](int value) { return (value % 2) == 0; };
+        AZStd::vector<int> expected = m_values;
+        const auto expectedPartitionPoint = std::stable_partition(expected.begin(), expected.end(), isEven);
+
+        AZStd::vector<int> values = m_values;
+        const auto partitionPoint = parallel_stable_partition(values.begin(), values.end(), isEven, m_desc);
+        EXPECT_EQ(values, expected);
+        EXPECT_EQ(partitionPoint - values.begin(), expectedPartitionPoint - expected.begin());
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, RunsInlineInsideTask)
+    {
+        // Waiting is unsupported on the executor workers, nested algorithms run on the calling task instead
+        int64_t sum = 0;
+        AZ::TaskGraph graph;
+        graph.AddTask({ "NestedParallelReduce", "TaskAlgorithmsTests" }, [this, &sum]()
+        {
+            sum = parallel_reduce(m_values.begin(), m_values.end(), int64_t(0), AZStd::plus<int64_t>(), m_desc);
+        });
+        AZ::TaskGraphEvent finishedEvent;
+        graph.SubmitOnExecutor(*m_executor, &finishedEvent);
+        finishedEvent.Wait();
+        EXPECT_EQ(sum, std::accumulate(m_values.begin(), m_values.end(), int64_t(0)));
+    }
+}
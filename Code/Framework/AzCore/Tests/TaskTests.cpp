@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -49,6 +50,20 @@ namespace UnitTest
         TaskExecutor* m_executor;
     };
 
+    class WorkStealingTaskGraphTestFixture : public TaskGraphTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            TaskGraphTestFixture::SetUp();
+
+            azdestroy(m_executor);
+            AZ::TaskExecutorDesc desc;
+            desc.m_workStealing = true;
+            m_executor = aznew TaskExecutor(desc);
+        }
+    };
+
     TEST(TaskGraphTests, TrivialTaskLambda)
     {
         int x = 0;
@@ -623,6 +638,185 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, RetainedGraphResetAndRebuild)
+    {
+        AZStd::atomic<int> x = 0;
+        int input = 0;
+
+        TaskGraph graph;
+        for (int frame = 1; frame != 4; ++frame)
+        {
+            // Rebuild a graph with a different shape every frame, the retained graph recompiles in place
+            input = frame;
+            auto root = graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    x = input;
+                });
+            auto join = graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    x += 100;
+                });
+            for (int i = 0; i != frame; ++i)
+            {
+                auto task = graph.AddTask(
+                    defaultTD,
+                    [&]
+                    {
+                        x += 10;
+                    });
+                root.Precedes(task);
+                task.Precedes(join);
+            }
+
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_FALSE(graph.IsInFlight());
+            EXPECT_EQ(frame + frame * 10 + 100, x);
+
+            graph.Reset();
+            EXPECT_TRUE(graph.IsEmpty());
+        }
+    }
+
+    TEST_F(WorkStealingTaskGraphTestFixture, ForkJoin)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0b111;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 1;
+            });
+        auto c = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 2;
+            });
+        auto d = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x -= 1;
+            });
+        a.Precedes(b, c);
+        d.Follows(b, c);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(3, x);
+    }
+
+    TEST_F(WorkStealingTaskGraphTestFixture, WideFanOutAllPriorities)
+    {
+        // A single root making many tasks ready at once ends up on one worker's deques from where the other
+        // workers must steal them. More tasks than a deque can hold also exercises the shared queue fallback.
+        constexpr int fanOut = 20000;
+        AZStd::atomic<int> x = 0;
+
+        const TaskDescriptor descriptors[] = { { "critical", "TaskGraphTests", TaskPriority::CRITICAL },
+                                               { "high", "TaskGraphTests", TaskPriority::HIGH },
+                                               { "medium", "TaskGraphTests", TaskPriority::MEDIUM },
+                                               { "low", "TaskGraphTests", TaskPriority::LOW } };
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        auto join = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = x * 2;
+            });
+        for (int i = 0; i != fanOut; ++i)
+        {
+            auto task = graph.AddTask(
+                descriptors[i % AZ_ARRAY_SIZE(descriptors)],
+                [&]
+                {
+                    ++x;
+                });
+            root.Precedes(task);
+            task.Precedes(join);
+        }
+
+        for (int i = 0; i != 2; ++i)
+        {
+            x = 0;
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(fanOut * 2, x);
+        }
+    }
+
+    TEST_F(WorkStealingTaskGraphTestFixture, CpuMaskRestrictsWorkers)
+    {
+        // Tasks restricted to the first worker must never be stolen by the others, even when they are made ready
+        // on another worker
+        constexpr int taskCount = 256;
+        AZStd::atomic<int> x = 0;
+        AZStd::atomic<int> mismatches = 0;
+        AZStd::thread_id firstWorker;
+
+        const TaskDescriptor pinnedTD{ "pinned", "TaskGraphTests", TaskPriority::CRITICAL, 1 };
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            pinnedTD,
+            [&]
+            {
+                firstWorker = AZStd::this_thread::get_id();
+            });
+        auto fork = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        root.Precedes(fork);
+        for (int i = 0; i != taskCount; ++i)
+        {
+            auto task = graph.AddTask(
+                pinnedTD,
+                [&]
+                {
+                    if (AZStd::this_thread::get_id() != firstWorker)
+                    {
+                        ++mismatches;
+                    }
+                    ++x;
+                });
+            fork.Precedes(task);
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(taskCount, x);
+        EXPECT_EQ(0, mismatches);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
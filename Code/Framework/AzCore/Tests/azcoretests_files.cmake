@@ -30,6 +30,7 @@ set(FILES
     Debug.cpp
     DLL.cpp
     EBus.cpp
+    EBusDispatchBenchmarks.cpp
     EntityIdTests.cpp
     EntityTests.cpp
     EnumTests.cpp
@@ -57,6 +58,7 @@ set(FILES
     Script.cpp
     ScriptMath.cpp
     Serialization.cpp
+    SerializationBenchmarks.cpp
     SerializeContextFixture.h
     Slice.cpp
     State.cpp
@@ -65,6 +67,7 @@ set(FILES
     StreamerTests.cpp
     StringFunc.cpp
     SystemFile.cpp
+    TaskAlgorithmsTests.cpp
     TaskTests.cpp
     TickBusTest.cpp
     UUIDTests.cpp
@@ -73,6 +76,7 @@ set(FILES
     Debug/Trace.cpp
     Debug/UnhandledExceptions.cpp
     Name/NameJsonSerializerTests.cpp
+    Name/NameBenchmarks.cpp
     Name/NameTests.cpp
     RTTI/TypeSafeIntegralTests.cpp
     Settings/CommandLineTests.cpp
@@ -81,9 +85,11 @@ set(FILES
     Settings/SettingsRegistryConsoleUtilsTests.cpp
     Settings/SettingsRegistryMergeUtilsTests.cpp
     Settings/SettingsRegistryScriptUtilsTests.cpp
+    Settings/SettingsRegistrySnapshotTests.cpp
     Settings/SettingsRegistryVisitorUtilsTests.cpp
     Streamer/BlockCacheTests.cpp
     Streamer/DedicatedCacheTests.cpp
+    Streamer/ExternalDecompressorTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
@@ -162,6 +168,7 @@ set(FILES
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
+    Math/SimdMathBatchTests.cpp
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/SplineTests.cpp
@@ -173,8 +180,10 @@ set(FILES
     Math/Vector3Tests.cpp
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
+    Memory/AllocationSampler.cpp
     Memory/AllocatorBenchmarks.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
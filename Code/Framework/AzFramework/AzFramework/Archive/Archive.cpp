@@ -18,6 +18,8 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -51,6 +53,8 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, az_archive_parallel_open, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When opening multiple archives at once, read their central directories in parallel on the job system");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -973,6 +977,31 @@ namespace AZ::IO
         return pCachedData;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    bool Archive::MapFile(AZStd::string_view pName, MappedFileView& view)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        view.Reset();
+        auto szFullPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(pName);
+        if (!szFullPath)
+        {
+            AZ_Assert(false, "Unable to resolve path for filepath %.*s", aznumeric_cast<int>(pName.size()), pName.data());
+            return false;
+        }
+
+        uint32_t archiveFlags = 0;
+        ZipDir::CachePtr archive;
+        ZipDir::FileEntry* pFileEntry = FindPakFileEntry(szFullPath->Native(), archiveFlags, &archive);
+        if (!pFileEntry || !archive)
+        {
+            return false;
+        }
+
+        SAutoCollectFileAccessTime accessTime(this);
+        return archive->MapFile(pFileEntry, view) == ZipDir::ZD_ERROR_SUCCESS;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     int Archive::FClose(AZ::IO::HandleType fileHandle)
     {
@@ -1391,6 +1420,7 @@ namespace AZ::IO
 
             // Open files in alphabetical order.
             AZStd::sort(files.begin(), files.end());
+            AZStd::vector<AZStd::string> preparedCaches = PrepareArchiveCaches(files);
             bool bAllOk = true;
             for (const AZ::IO::FixedMaxPath& file : files)
             {
@@ -1401,6 +1431,7 @@ namespace AZ::IO
                     pFullPaths->emplace_back(AZStd::move(file.Native()));
                 }
             }
+            ReleasePreparedArchiveCaches(preparedCaches);
 
             FindClose(fileIterator);
             return bAllOk;
@@ -1677,9 +1708,19 @@ namespace AZ::IO
             }
         }
 
-        ZipDir::CacheFactory factory(initType, nFactoryFlags);
+        // Archives opened in bulk may already have been read in parallel with the same settings.
+        ZipDir::CachePtr cache;
+        if (initType == ZipDir::InitMethod::Default && nFactoryFlags == ZipDir::CacheFactory::FLAGS_READ_ONLY)
+        {
+            cache = TakePreparedArchiveCache(szFullPath->Native());
+        }
+
+        if (!cache)
+        {
+            ZipDir::CacheFactory factory(initType, nFactoryFlags);
+            cache = factory.New(szFullPath->c_str());
+        }
 
-        ZipDir::CachePtr cache = factory.New(szFullPath->c_str());
         if (cache)
         {
             return new NestedArchive(this, strBindRoot, cache, nFlags);
@@ -1688,6 +1729,76 @@ namespace AZ::IO
         return nullptr;
     }
 
+    AZStd::vector<AZStd::string> Archive::PrepareArchiveCaches(const AZStd::vector<AZ::IO::FixedMaxPath>& files)
+    {
+        AZStd::vector<AZStd::string> fullPaths;
+        if (!az_archive_parallel_open || files.size() < 2)
+        {
+            return fullPaths;
+        }
+
+        // Archives can be opened before the job manager is available, in which case they're read one by one.
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        if (!jobContext)
+        {
+            return fullPaths;
+        }
+
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        fullPaths.reserve(files.size());
+        for (const AZ::IO::FixedMaxPath& file : files)
+        {
+            // skip archives that are already open as they won't be read again
+            auto szFullPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(file);
+            if (szFullPath && !FindArchive(szFullPath->Native()))
+            {
+                fullPaths.emplace_back(szFullPath->Native());
+            }
+        }
+
+        AZStd::vector<ZipDir::CachePtr> caches(fullPaths.size());
+        AZ::parallel_for(size_t{ 0 }, fullPaths.size(), [&fullPaths, &caches](size_t index)
+            {
+                // use the same settings OpenPackCommon opens archives with
+                ZipDir::CacheFactory factory(ZipDir::InitMethod::Default, ZipDir::CacheFactory::FLAGS_READ_ONLY);
+                caches[index] = factory.New(fullPaths[index].c_str());
+            }, jobContext);
+
+        AZStd::scoped_lock lock(m_preparedCachesMutex);
+        for (size_t i = 0; i < fullPaths.size(); ++i)
+        {
+            if (caches[i])
+            {
+                m_preparedCaches[fullPaths[i]] = AZStd::move(caches[i]);
+            }
+        }
+        return fullPaths;
+    }
+
+    ZipDir::CachePtr Archive::TakePreparedArchiveCache(AZStd::string_view szFullPath)
+    {
+        AZStd::scoped_lock lock(m_preparedCachesMutex);
+        if (auto it = m_preparedCaches.find(AZStd::string(szFullPath)); it != m_preparedCaches.end())
+        {
+            ZipDir::CachePtr cache = AZStd::move(it->second);
+            m_preparedCaches.erase(it);
+            return cache;
+        }
+        return {};
+    }
+
+    void Archive::ReleasePreparedArchiveCaches(const AZStd::vector<AZStd::string>& fullPaths)
+    {
+        // Caches that weren't used, e.g. because the archive was already mounted at the same bind root, are closed here.
+        AZStd::scoped_lock lock(m_preparedCachesMutex);
+        for (const AZStd::string& fullPath : fullPaths)
+        {
+            m_preparedCaches.erase(fullPath);
+        }
+    }
+
     void Archive::Register(INestedArchive* pArchive)
     {
         AZStd::unique_lock lock(m_archiveMutex);
@@ -2026,6 +2137,10 @@ namespace AZ::IO
                 info.m_uncompressedSize = entry->desc.lSizeUncompressed;
                 info.m_isCompressed = entry->IsCompressed();
                 info.m_isSharedPak = true;
+                if (info.m_isCompressed)
+                {
+                    info.m_frames = archive->GetCompressionFrames(entry);
+                }
 
                 switch (GetPakPriority())
                 {
@@ -21,6 +21,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -202,6 +203,7 @@ namespace AZ::IO
         AZ::IO::HandleType FOpen(AZStd::string_view pName, const char* mode) override;
         size_t FRead(void* data, size_t bytesToRead, AZ::IO::HandleType handle) override;
         void* FGetCachedFileData(AZ::IO::HandleType handle, size_t& nFileSize) override;
+        bool MapFile(AZStd::string_view pName, MappedFileView& view) override;
         size_t FWrite(const void* data, size_t bytesToWrite, AZ::IO::HandleType handle) override;
         size_t FSeek(AZ::IO::HandleType handle, uint64_t seek, int mode) override;
         uint64_t FTell(AZ::IO::HandleType handle) override;
@@ -282,6 +284,14 @@ namespace AZ::IO
 
         ZipDir::FileEntry* FindPakFileEntry(AZStd::string_view szPath) const;
 
+        // Reads the central directories of the given archives in parallel on the job system. The resulting caches are
+        // picked up by OpenArchive, so the archives can still be mounted one after another in a deterministic order.
+        // Returns the full paths of the caches that were prepared so the unused ones can be released afterwards.
+        AZStd::vector<AZStd::string> PrepareArchiveCaches(const AZStd::vector<AZ::IO::FixedMaxPath>& files);
+        // Returns and removes the cache prepared for the archive at the given path, if there is one.
+        ZipDir::CachePtr TakePreparedArchiveCache(AZStd::string_view szFullPath);
+        void ReleasePreparedArchiveCaches(const AZStd::vector<AZStd::string>& fullPaths);
+
         void CheckFileAccess(AZStd::string_view szFilename);
 
         // this function gets the file data for the given file, if found.
@@ -319,6 +329,10 @@ namespace AZ::IO
         mutable AZStd::shared_mutex m_csZips;
         ZipArray m_arrZips;
 
+        // Caches of archives that have been read ahead of being opened, keyed by the full path of the archive
+        AZStd::mutex m_preparedCachesMutex;
+        AZStd::unordered_map<AZStd::string, ZipDir::CachePtr> m_preparedCaches;
+
         AZ::SettingsRegistryInterface::NotifyEventHandler m_componentApplicationLifecycleHandler;
 
         //////////////////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
 
 #include <AzFramework/Archive/ArchiveFindData.h>
 #include <AzFramework/Archive/ArchiveVars.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
 
 enum EStreamSourceMediaType : int32_t;
 
@@ -169,6 +170,12 @@ namespace AZ::IO
         // WARNING! The returned pointer is only valid while the fileHandle has not been closed.
         virtual void* FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize) = 0;
 
+        // Get a read-only view that points directly into the memory mapped archive containing the file.
+        // This avoids copying the file data, but is only available for files inside an archive that are stored uncompressed.
+        // Returns false if the file can't be mapped, in which case the file needs to be read through FOpen/FRead instead.
+        // The data remains valid for as long as the view, or a copy of it, exists, even if the archive is closed.
+        virtual bool MapFile(AZStd::string_view pName, MappedFileView& view) = 0;
+
         // Read raw data from file, no endian conversion.
         virtual size_t FRead(void* data, size_t bytesToRead, AZ::IO::HandleType fileHandle) = 0;
 
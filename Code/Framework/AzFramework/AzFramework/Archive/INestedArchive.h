@@ -15,6 +15,7 @@
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/string/string.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
 
 namespace AZ::IO
 {
@@ -156,6 +157,13 @@ namespace AZ::IO
         // Note:
         //    Must be at least the size returned by GetFileSize.
         virtual int ReadFile(Handle, void* pBuffer) = 0;
+        // Summary:
+        //   Provides a read-only view directly into the memory mapped archive
+        // Note:
+        //    This is only available for files that are stored uncompressed in a read-only archive. For all other files
+        //    ZD_ERROR_UNSUPPORTED is returned and ReadFile needs to be used instead. The data remains valid for as long
+        //    as the view exists, even if the archive is closed.
+        virtual int MapFile(Handle, MappedFileView& view) = 0;
 
         // Summary:
         //   Get the full path to the archive file.
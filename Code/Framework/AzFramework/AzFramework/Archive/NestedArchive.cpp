@@ -214,6 +214,12 @@ namespace AZ::IO
         return m_pCache->ReadFile(reinterpret_cast<ZipDir::FileEntry*>(fileHandle), nullptr, pBuffer);
     }
 
+    int NestedArchive::MapFile(Handle fileHandle, MappedFileView& view)
+    {
+        AZ_Assert(m_pCache->IsOwnerOf(reinterpret_cast<ZipDir::FileEntry*>(fileHandle)), "File Handle is not owned by archive");
+        return m_pCache->MapFile(reinterpret_cast<ZipDir::FileEntry*>(fileHandle), view);
+    }
+
     AZ::IO::PathView NestedArchive::GetFullPath() const
     {
         return m_pCache->GetFilePath();
@@ -80,6 +80,9 @@ namespace AZ::IO
         // reads the file into the preallocated buffer (must be at least the size of GetFileSize())
         int ReadFile(Handle fileHandle, void* pBuffer) override;
 
+        // provides a view directly into the memory mapped archive for files that are stored uncompressed
+        int MapFile(Handle fileHandle, MappedFileView& view) override;
+
         // returns the full path to the archive file
         AZ::IO::PathView GetFullPath() const override;
 
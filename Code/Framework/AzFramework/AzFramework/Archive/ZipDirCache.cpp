@@ -9,6 +9,7 @@
 
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -178,6 +179,14 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        {
+            AZStd::scoped_lock lock(m_mappedFileLock);
+            m_mappedFile.reset();
+        }
+        {
+            AZStd::scoped_lock lock(m_compressionFramesLock);
+            m_compressionFrames.clear();
+        }
         m_allocator = nullptr;
         m_treeDir.Clear();
     }
@@ -242,7 +251,7 @@ namespace AZ::IO::ZipDir
         case CompressionCodec::Codec::ZLIB:
             return (uncompressedSize + (uncompressedSize >> 3) + 32);
         case CompressionCodec::Codec::ZSTD:
-            return ZSTD_compressBound(uncompressedSize);
+            return uncompressedSize > ZstdSeekableFrameSize ? ZipRawCompressZSTDSeekableBound(uncompressedSize) : ZSTD_compressBound(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
         default:
@@ -279,7 +288,15 @@ namespace AZ::IO::ZipDir
             switch (codec)
             {
             case CompressionCodec::Codec::ZSTD:
-                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                // Large files are split in frames so that reads of part of the file only decompress the frames they need
+                if (nSize > ZstdSeekableFrameSize)
+                {
+                    nError = ZipRawCompressZSTDSeekable(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                }
+                else
+                {
+                    nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                }
                 break;
 
             case CompressionCodec::Codec::ZLIB:
@@ -758,6 +775,133 @@ namespace AZ::IO::ZipDir
     }
 
 
+    ErrorEnum Cache::MapFile(FileEntry* pFileEntry, MappedFileView& view)
+    {
+        view.Reset();
+        if (!pFileEntry)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        // Only data that's stored as is can be used straight from the mapping. Writable archives are excluded as
+        // updates could move or overwrite the data while it's being used.
+        if (!(m_nFlags & FLAGS_READ_ONLY) || pFileEntry->nMethod != ZipFile::METHOD_STORE)
+        {
+            return ZD_ERROR_UNSUPPORTED;
+        }
+
+        ErrorEnum nError = Refresh(pFileEntry);
+        if (nError != ZD_ERROR_SUCCESS)
+        {
+            return nError;
+        }
+
+        AZStd::intrusive_ptr<MappedFile> mappedFile = GetMappedFile();
+        if (!mappedFile)
+        {
+            return ZD_ERROR_UNSUPPORTED;
+        }
+
+        const uint64_t offset = pFileEntry->nFileDataOffset;
+        const uint64_t size = pFileEntry->desc.lSizeUncompressed;
+        if (offset + size > mappedFile->GetSize())
+        {
+            AZ_Warning("Archive", false, "ZD_ERROR_DATA_IS_CORRUPT: File data extends past the end of archive %s", m_strFilePath.c_str());
+            return ZD_ERROR_DATA_IS_CORRUPT;
+        }
+
+        AZStd::span<const AZStd::byte> data(mappedFile->GetData() + offset, static_cast<size_t>(size));
+        view = MappedFileView(AZStd::move(mappedFile), data);
+        return ZD_ERROR_SUCCESS;
+    }
+
+    AZStd::shared_ptr<const AZ::IO::CompressionFrames> Cache::GetCompressionFrames(FileEntry* pFileEntry)
+    {
+        // Only files larger than a frame are split in frames. Files in writable archives can move, so aren't tracked.
+        if (!pFileEntry || !(m_nFlags & FLAGS_READ_ONLY) || pFileEntry->nMethod != ZipFile::METHOD_DEFLATE ||
+            pFileEntry->desc.lSizeUncompressed <= ZstdSeekableFrameSize || pFileEntry->desc.lSizeCompressed < ZstdSeekTableFooterSize)
+        {
+            return {};
+        }
+
+        AZStd::scoped_lock lock(m_compressionFramesLock);
+        auto framesIt = m_compressionFrames.find(pFileEntry);
+        if (framesIt != m_compressionFrames.end())
+        {
+            return framesIt->second;
+        }
+
+        AZStd::shared_ptr<const AZ::IO::CompressionFrames>& result = m_compressionFrames[pFileEntry];
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return result;
+        }
+
+        // The seek table is at the end of the compressed data, read it from the mapping when possible as that doesn't
+        // move the file position the other reads of the archive rely on.
+        const uint64_t dataEnd = pFileEntry->nFileDataOffset + pFileEntry->desc.lSizeCompressed;
+        AZStd::intrusive_ptr<MappedFile> mappedFile = GetMappedFile();
+        auto readTail = [this, &mappedFile, dataEnd](void* buffer, size_t size) -> bool
+        {
+            if (mappedFile)
+            {
+                if (dataEnd > mappedFile->GetSize())
+                {
+                    return false;
+                }
+                memcpy(buffer, mappedFile->GetData() + dataEnd - size, size);
+                return true;
+            }
+            auto fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+            return fileIO->Seek(m_fileHandle, dataEnd - size, AZ::IO::SeekType::SeekFromStart) && fileIO->Read(m_fileHandle, buffer, size, true);
+        };
+
+        uint8_t footer[ZstdSeekTableFooterSize];
+        if (!readTail(footer, sizeof(footer)))
+        {
+            return result;
+        }
+        const size_t seekTableSize = ZipGetZSTDSeekTableSize(footer);
+        if (seekTableSize == 0 || seekTableSize > pFileEntry->desc.lSizeCompressed)
+        {
+            return result;
+        }
+
+        AZStd::vector<uint8_t> seekTable(seekTableSize);
+        auto frames = AZStd::make_shared<AZ::IO::CompressionFrames>();
+        if (readTail(seekTable.data(), seekTableSize) &&
+            ZipReadZSTDSeekTable(seekTable.data(), seekTableSize, pFileEntry->desc.lSizeCompressed, pFileEntry->desc.lSizeUncompressed, *frames))
+        {
+            result = AZStd::move(frames);
+        }
+        else
+        {
+            AZ_Warning("Archive", false, "Invalid seek table for a file in archive %s, the file is decompressed as a whole", m_strFilePath.c_str());
+        }
+        return result;
+    }
+
+    AZStd::intrusive_ptr<MappedFile> Cache::GetMappedFile()
+    {
+        AZStd::scoped_lock lock(m_mappedFileLock);
+        if (!m_mappedFile && !m_mappingFailed && m_fileHandle != AZ::IO::InvalidHandle)
+        {
+            char nativePath[AZ_MAX_PATH_LEN];
+            if (AZ::IO::FileIOBase::GetDirectInstance()->GetFilename(m_fileHandle, nativePath, AZ_ARRAY_SIZE(nativePath)))
+            {
+                m_mappedFile = MappedFile::Create(nativePath);
+            }
+
+            // Don't keep trying to map an archive that can't be mapped. Reading the file normally is the fallback.
+            m_mappingFailed = !m_mappedFile;
+            if (m_mappingFailed && az_archive_zip_directory_cache_verbosity)
+            {
+                AZ_TracePrintf("Archive", "Unable to memory map archive %s", m_strFilePath.c_str());
+            }
+        }
+        return m_mappedFile;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
     FileEntry* Cache::FindFile(AZStd::string_view szPathSrc, [[maybe_unused]] bool bFullInfo)
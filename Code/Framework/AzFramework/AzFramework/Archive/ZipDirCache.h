@@ -18,9 +18,13 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
@@ -83,6 +87,16 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // Provides a view that points directly into the memory mapped archive, avoiding any copies of the file data.
+        // This is only possible for files that are stored uncompressed and unencrypted in a read-only archive. In all
+        // other cases ZD_ERROR_UNSUPPORTED is returned and the file needs to be read with ReadFile instead.
+        ErrorEnum MapFile(FileEntry* pFileEntry, MappedFileView& view);
+
+        // Returns the frames of a file that was compressed in independent frames, so that parts of it can be decompressed
+        // without decompressing the file from the start. Returns nullptr for any other file, or if the archive isn't read-only.
+        // The frames are read from the archive the first time they're requested for a file.
+        AZStd::shared_ptr<const AZ::IO::CompressionFrames> GetCompressionFrames(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -128,6 +142,9 @@ namespace AZ::IO::ZipDir
 
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
+        // Returns the memory mapping of the archive, creating it on first use. Returns nullptr if the archive can't be mapped.
+        AZStd::intrusive_ptr<MappedFile> GetMappedFile();
+
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
@@ -167,6 +184,16 @@ namespace AZ::IO::ZipDir
         ZipFile::CryCustomEncryptionHeader m_headerEncryption;
         ZipFile::CrySignedCDRHeader m_headerSignature;
         ZipFile::CryCustomExtendedHeader m_headerExtended;
+
+        // Memory mapping of the archive used to provide views on uncompressed files. Views keep their own reference
+        // to the mapping, so it remains valid even if this cache is closed.
+        AZStd::mutex m_mappedFileLock;
+        AZStd::intrusive_ptr<MappedFile> m_mappedFile;
+        bool m_mappingFailed{};
+
+        // Compression frames of the files of a read-only archive, or nullptr for the files that aren't compressed in frames
+        AZStd::mutex m_compressionFramesLock;
+        AZStd::unordered_map<const FileEntry*, AZStd::shared_ptr<const AZ::IO::CompressionFrames>> m_compressionFrames;
     };
 
     using CachePtr = AZStd::intrusive_ptr<Cache>;
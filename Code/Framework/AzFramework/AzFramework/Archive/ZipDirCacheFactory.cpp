@@ -29,6 +29,15 @@ namespace AZ::IO::ZipDir
     // this sets the window size of the blocks of data read from the end of the file to find the Central Directory Record
     // since normally there are no
     static constexpr size_t CDRSearchWindowSize = 0x100;
+    // extension appended to the archive path for the persistent index
+    static constexpr const char* IndexExtension = ".index";
+
+    AZ_CVAR(int32_t, az_archive_pak_index, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Keeps a persistent index next to read-only archives that avoids reading the local file header of every file on open\n"
+        "0 - Disabled\n"
+        "1 - Use the index if it matches the archive, otherwise create it\n"
+        ">=2 - Additionally log when an index is used or (re)created");
+
     CacheFactory::CacheFactory(InitMethod nInitMethod, uint32_t nFlags)
     {
         m_nCDREndPos = 0;
@@ -292,7 +301,31 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
-        BuildFileEntryMap();
+        // the index can only be trusted if the local file headers aren't validated and the archive can't change while it's open
+        m_bUseIndex = az_archive_pak_index
+            && (m_nFlags & FLAGS_READ_ONLY) && !(m_nFlags & FLAGS_READ_INSIDE_PAK)
+            && m_nInitMethod == ZipDir::InitMethod::Default
+            && m_encryptedHeaders == ZipFile::HEADERS_NOT_ENCRYPTED;
+        if (m_bUseIndex)
+        {
+            m_nZipModificationTime = m_fileExt.m_fileIOBase->ModificationTime(m_fileExt.m_fileHandle);
+            LoadIndex();
+        }
+
+        bool bFileEntriesBuilt = BuildFileEntryMap();
+
+        if (m_bUseIndex)
+        {
+            bool bIndexUpToDate = m_pIndexEntries && m_nNextIndexEntry == m_nNumIndexEntries;
+            // release the mapping first, as some platforms don't allow writing to a file that's mapped
+            m_pIndexEntries = nullptr;
+            m_index.reset();
+            if (bFileEntriesBuilt && !bIndexUpToDate)
+            {
+                SaveIndex();
+            }
+            m_newIndexEntries.clear();
+        }
 
         return true;
     }
@@ -314,6 +347,9 @@ namespace AZ::IO::ZipDir
         m_mapFileEntries.clear();
         m_treeFileEntries.Clear();
         m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
+        m_pIndexEntries = nullptr;
+        m_index.reset();
+        m_newIndexEntries.clear();
     }
 
 
@@ -589,6 +625,13 @@ namespace AZ::IO::ZipDir
             // use CDR instead of local header
             fileEntry.nFileDataOffset = pFileHeader->lLocalHeaderOffset + sizeof(ZipFile::LocalFileHeader) + pFileHeader->nFileNameLength + pFileHeader->nExtraFieldLength;
         }
+        else if (const IndexEntry* pIndexEntry = GetNextIndexEntry(pFileHeader->lLocalHeaderOffset))
+        {
+            // the index already knows where the data starts, so there's no need to read the local file header
+            fileEntry.nFileDataOffset = pIndexEntry->nFileDataOffset;
+            fileEntry.nEOFOffset = fileEntry.nFileDataOffset + fileEntry.desc.lSizeCompressed;
+            m_newIndexEntries.push_back(*pIndexEntry);
+        }
         else
         {
             Seek(pFileHeader->lLocalHeaderOffset);
@@ -607,6 +650,11 @@ namespace AZ::IO::ZipDir
 
             fileEntry.nEOFOffset = fileEntry.nFileDataOffset + fileEntry.desc.lSizeCompressed;
 
+            if (m_bUseIndex)
+            {
+                m_newIndexEntries.push_back({ pFileHeader->lLocalHeaderOffset, fileEntry.nFileDataOffset });
+            }
+
             if (m_nInitMethod != ZipDir::InitMethod::Default)
             {
                 if (m_nInitMethod == ZipDir::InitMethod::FullValidation)
@@ -670,6 +718,118 @@ namespace AZ::IO::ZipDir
         }
     }
 
+    AZStd::string CacheFactory::GetIndexPath() const
+    {
+        return m_szFilename + IndexExtension;
+    }
+
+    bool CacheFactory::LoadIndex()
+    {
+        AZStd::string indexPath = GetIndexPath();
+        if (!AZ::IO::FileIOBase::GetDirectInstance()->Exists(indexPath.c_str()))
+        {
+            return false;
+        }
+
+        m_index = MappedFile::Create(indexPath.c_str());
+        if (!m_index || m_index->GetSize() < sizeof(IndexHeader))
+        {
+            m_index.reset();
+            return false;
+        }
+
+        // the index is only valid for the exact archive it was created from
+        const auto* pHeader = reinterpret_cast<const IndexHeader*>(m_index->GetData());
+        if (pHeader->nSignature != IndexHeader::SIGNATURE
+            || pHeader->nVersion != IndexHeader::VERSION
+            || pHeader->nArchiveSize != m_nZipFileSize
+            || pHeader->nArchiveModificationTime != m_nZipModificationTime
+            || pHeader->lCDROffset != m_CDREnd.lCDROffset
+            || pHeader->lCDRSize != m_CDREnd.lCDRSize
+            || m_index->GetSize() != sizeof(IndexHeader) + uint64_t{ pHeader->nNumEntries } * sizeof(IndexEntry))
+        {
+            if (az_archive_pak_index >= 2)
+            {
+                AZ_TracePrintf("Archive", "Index %s is out of date and will be recreated\n", indexPath.c_str());
+            }
+            m_index.reset();
+            return false;
+        }
+
+        m_pIndexEntries = reinterpret_cast<const IndexEntry*>(pHeader + 1);
+        m_nNumIndexEntries = pHeader->nNumEntries;
+        m_nNextIndexEntry = 0;
+        if (az_archive_pak_index >= 2)
+        {
+            AZ_TracePrintf("Archive", "Using index %s with %u entries\n", indexPath.c_str(), m_nNumIndexEntries);
+        }
+        return true;
+    }
+
+    void CacheFactory::SaveIndex()
+    {
+        IndexHeader header;
+        header.nSignature = IndexHeader::SIGNATURE;
+        header.nVersion = IndexHeader::VERSION;
+        header.nArchiveSize = m_nZipFileSize;
+        header.nArchiveModificationTime = m_nZipModificationTime;
+        header.lCDROffset = m_CDREnd.lCDROffset;
+        header.lCDRSize = m_CDREnd.lCDRSize;
+        header.nNumEntries = aznumeric_cast<uint32_t>(m_newIndexEntries.size());
+        header.nReserved = 0;
+
+        AZStd::string indexPath = GetIndexPath();
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+        AZ::IO::HandleType indexHandle = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(indexPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, indexHandle))
+        {
+            // archives are frequently installed in locations that can't be written to, in which case there simply is no index
+            if (az_archive_pak_index >= 2)
+            {
+                AZ_TracePrintf("Archive", "Unable to create index %s\n", indexPath.c_str());
+            }
+            return;
+        }
+
+        bool bWritten = fileIO->Write(indexHandle, &header, sizeof(header))
+            && fileIO->Write(indexHandle, m_newIndexEntries.data(), m_newIndexEntries.size() * sizeof(IndexEntry));
+        fileIO->Close(indexHandle);
+        if (!bWritten)
+        {
+            // don't leave a partial index behind, even though it would be rejected because of its size
+            fileIO->Remove(indexPath.c_str());
+        }
+        else if (az_archive_pak_index >= 2)
+        {
+            AZ_TracePrintf("Archive", "Created index %s with %zu entries\n", indexPath.c_str(), m_newIndexEntries.size());
+        }
+    }
+
+    const CacheFactory::IndexEntry* CacheFactory::GetNextIndexEntry(uint32_t nFileHeaderOffset)
+    {
+        if (!m_pIndexEntries)
+        {
+            return nullptr;
+        }
+
+        // entries are stored in the order they appear in the central directory
+        if (m_nNextIndexEntry < m_nNumIndexEntries)
+        {
+            const IndexEntry& entry = m_pIndexEntries[m_nNextIndexEntry];
+            if (entry.nFileHeaderOffset == nFileHeaderOffset
+                && entry.nFileDataOffset >= nFileHeaderOffset + sizeof(ZipFile::LocalFileHeader)
+                && entry.nFileDataOffset <= m_nCDREndPos)
+            {
+                ++m_nNextIndexEntry;
+                return &entry;
+            }
+        }
+
+        // the index doesn't match the archive, so stop using it. It'll be recreated from the local file headers.
+        m_pIndexEntries = nullptr;
+        return nullptr;
+    }
+
     // seeks in the file relative to the starting position
     void CacheFactory::Seek(uint32_t nPos, int nOrigin) // throw
     {
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
 
 namespace AZ::IO::ZipDir
 {
@@ -76,6 +77,37 @@ namespace AZ::IO::ZipDir
         bool Read(void* pDest, uint32_t nSize); // throw
         bool ReadHeaderData(void* pDest, uint32_t nSize); // throw
 
+        // The persistent index is stored next to the archive and holds the file data offsets that would otherwise be
+        // found by reading the local file header of every file in the archive.
+        struct IndexHeader
+        {
+            static constexpr uint32_t SIGNATURE = 0x58444950; // "PIDX"
+            static constexpr uint32_t VERSION = 1;
+
+            uint32_t nSignature;
+            uint32_t nVersion;
+            uint64_t nArchiveSize;
+            uint64_t nArchiveModificationTime;
+            uint32_t lCDROffset;
+            uint32_t lCDRSize;
+            uint32_t nNumEntries;
+            uint32_t nReserved;
+        };
+
+        struct IndexEntry
+        {
+            uint32_t nFileHeaderOffset;
+            uint32_t nFileDataOffset;
+        };
+
+        // maps the index of the archive, if there is one and it still matches the archive
+        bool LoadIndex();
+        // writes the data offsets collected while reading the archive to the index
+        void SaveIndex();
+        // returns the index entry for the next file, or nullptr if there's no index or it doesn't match the file
+        const IndexEntry* GetNextIndexEntry(uint32_t nFileHeaderOffset);
+        AZStd::string GetIndexPath() const;
+
 
     protected:
 
@@ -107,6 +139,14 @@ namespace AZ::IO::ZipDir
         ZipFile::CryCustomEncryptionHeader m_headerEncryption;
         ZipFile::CrySignedCDRHeader m_headerSignature;
         ZipFile::CryCustomExtendedHeader m_headerExtended;
+
+        uint64_t m_nZipModificationTime{};
+        bool m_bUseIndex{};
+        AZStd::intrusive_ptr<MappedFile> m_index;
+        const IndexEntry* m_pIndexEntries{};
+        uint32_t m_nNumIndexEntries{};
+        uint32_t m_nNextIndexEntry{};
+        AZStd::vector<IndexEntry> m_newIndexEntries;
     };
 
 }
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+namespace AZ::IO::ZipDir
+{
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    AZStd::intrusive_ptr<MappedFile> MappedFile::Create(const char* nativePath)
+    {
+        AZStd::intrusive_ptr<MappedFile> mappedFile{ aznew MappedFile() };
+        if (!mappedFile->Map(nativePath))
+        {
+            return {};
+        }
+        return mappedFile;
+    }
+}
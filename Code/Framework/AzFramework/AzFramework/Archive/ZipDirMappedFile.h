@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AZ::IO::ZipDir
+{
+    // Read-only memory mapping of an entire archive file.
+    // The mapping stays alive for as long as there are references to it, even after the archive itself has been closed.
+    class MappedFile
+        : public AZStd::intrusive_base
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedFile, AZ::SystemAllocator, 0);
+
+        ~MappedFile() override;
+
+        // Maps the file at the given native path into memory.
+        // Returns nullptr if the file couldn't be mapped, e.g. because the platform doesn't support it.
+        static AZStd::intrusive_ptr<MappedFile> Create(const char* nativePath);
+
+        const AZStd::byte* GetData() const
+        {
+            return m_data;
+        }
+
+        uint64_t GetSize() const
+        {
+            return m_size;
+        }
+
+    private:
+        MappedFile() = default;
+
+        // Platform specific functions to create and release the mapping.
+        bool Map(const char* nativePath);
+        void Unmap();
+
+        const AZStd::byte* m_data{};
+        uint64_t m_size{};
+    };
+}
+
+namespace AZ::IO
+{
+    // Read-only view on the data of an uncompressed file inside an archive.
+    // The view points directly into the memory mapping of the archive, so no data is copied. The data remains valid for
+    // as long as the view, or a copy of it, exists.
+    class MappedFileView
+    {
+    public:
+        MappedFileView() = default;
+        MappedFileView(AZStd::intrusive_ptr<ZipDir::MappedFile> mappedFile, AZStd::span<const AZStd::byte> data)
+            : m_mappedFile(AZStd::move(mappedFile))
+            , m_data(data)
+        {
+        }
+
+        AZStd::span<const AZStd::byte> GetData() const
+        {
+            return m_data;
+        }
+
+        bool IsValid() const
+        {
+            return m_mappedFile != nullptr;
+        }
+
+        void Reset()
+        {
+            m_data = {};
+            m_mappedFile.reset();
+        }
+
+    private:
+        AZStd::intrusive_ptr<ZipDir::MappedFile> m_mappedFile;
+        AZStd::span<const AZStd::byte> m_data;
+    };
+}
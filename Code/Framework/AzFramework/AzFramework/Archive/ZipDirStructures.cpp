@@ -15,6 +15,8 @@
 #include <AzFramework/Archive/IArchive.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
 #include <time.h>
 #include <stdlib.h>
 #include <zstd.h>
@@ -632,6 +634,139 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
+    namespace ZipDirStructuresInternal
+    {
+        // Values of the zstd seekable format
+        static constexpr uint32_t ZstdSeekTableSkippableMagic = 0x184D2A5E;
+        static constexpr uint32_t ZstdSeekableMagic = 0x8F92EAB1;
+        static constexpr size_t ZstdSkippableHeaderSize = 8;
+        static constexpr size_t ZstdSeekTableEntrySize = 8;
+        static constexpr uint8_t ZstdSeekTableChecksumFlag = 0x80;
+
+        static void WriteUInt32LE(uint8_t* pDest, uint32_t value)
+        {
+            pDest[0] = static_cast<uint8_t>(value);
+            pDest[1] = static_cast<uint8_t>(value >> 8);
+            pDest[2] = static_cast<uint8_t>(value >> 16);
+            pDest[3] = static_cast<uint8_t>(value >> 24);
+        }
+
+        static uint32_t ReadUInt32LE(const uint8_t* pSrc)
+        {
+            return static_cast<uint32_t>(pSrc[0]) | (static_cast<uint32_t>(pSrc[1]) << 8) |
+                (static_cast<uint32_t>(pSrc[2]) << 16) | (static_cast<uint32_t>(pSrc[3]) << 24);
+        }
+
+        static size_t GetZSTDSeekTableSize(size_t nFrameCount)
+        {
+            return ZstdSkippableHeaderSize + nFrameCount * ZstdSeekTableEntrySize + ZstdSeekTableFooterSize;
+        }
+    }
+
+    size_t ZipRawCompressZSTDSeekableBound(size_t nSrcSize, size_t nFrameSize)
+    {
+        const size_t nFrameCount = AZStd::max<size_t>((nSrcSize + nFrameSize - 1) / nFrameSize, 1);
+        return nFrameCount * ZSTD_compressBound(nFrameSize) + ZipDirStructuresInternal::GetZSTDSeekTableSize(nFrameCount);
+    }
+
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel, size_t nFrameSize)
+    {
+        using namespace ZipDirStructuresInternal;
+        const size_t nFrameCount = AZStd::max<size_t>((nSrcSize + nFrameSize - 1) / nFrameSize, 1);
+        const size_t nSeekTableSize = GetZSTDSeekTableSize(nFrameCount);
+        if (nFrameCount > AZStd::numeric_limits<uint32_t>::max() || nSeekTableSize > *pDestSize)
+        {
+            return Z_BUF_ERROR;
+        }
+
+        ZSTD_CCtx* cctx = ZSTD_createCCtx();
+        if (!cctx)
+        {
+            return Z_MEM_ERROR;
+        }
+
+        const uint8_t* pSrc = static_cast<const uint8_t*>(pUncompressed);
+        uint8_t* pDest = static_cast<uint8_t*>(pCompressed);
+        const size_t nFramesCapacity = *pDestSize - nSeekTableSize;
+        AZStd::vector<uint32_t> frameSizes(nFrameCount * 2);
+        size_t nCompressedSize = 0;
+        int err = Z_OK;
+        for (size_t frame = 0; frame < nFrameCount; ++frame)
+        {
+            const size_t nOffset = frame * nFrameSize;
+            const size_t nSize = AZStd::min(nFrameSize, nSrcSize - nOffset);
+            size_t result = ZSTD_compressCCtx(cctx, pDest + nCompressedSize, nFramesCapacity - nCompressedSize, pSrc + nOffset, nSize, 1);
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error compressing using zstd: %s", ZSTD_getErrorName(result));
+                err = Z_BUF_ERROR;
+                break;
+            }
+            frameSizes[frame * 2] = static_cast<uint32_t>(result);
+            frameSizes[frame * 2 + 1] = static_cast<uint32_t>(nSize);
+            nCompressedSize += result;
+        }
+        ZSTD_freeCCtx(cctx);
+        if (err != Z_OK)
+        {
+            return err;
+        }
+
+        // The seek table is stored in a skippable frame, which decompression ignores
+        uint8_t* pSeekTable = pDest + nCompressedSize;
+        WriteUInt32LE(pSeekTable, ZstdSeekTableSkippableMagic);
+        WriteUInt32LE(pSeekTable + 4, static_cast<uint32_t>(nSeekTableSize - ZstdSkippableHeaderSize));
+        uint8_t* pEntries = pSeekTable + ZstdSkippableHeaderSize;
+        for (size_t frame = 0; frame < nFrameCount; ++frame)
+        {
+            WriteUInt32LE(pEntries + frame * ZstdSeekTableEntrySize, frameSizes[frame * 2]);
+            WriteUInt32LE(pEntries + frame * ZstdSeekTableEntrySize + 4, frameSizes[frame * 2 + 1]);
+        }
+        uint8_t* pFooter = pEntries + nFrameCount * ZstdSeekTableEntrySize;
+        WriteUInt32LE(pFooter, static_cast<uint32_t>(nFrameCount));
+        pFooter[4] = 0; // no checksums
+        WriteUInt32LE(pFooter + 5, ZstdSeekableMagic);
+
+        *pDestSize = nCompressedSize + nSeekTableSize;
+        return Z_OK;
+    }
+
+    size_t ZipGetZSTDSeekTableSize(const void* pFooter)
+    {
+        using namespace ZipDirStructuresInternal;
+        const uint8_t* pBytes = static_cast<const uint8_t*>(pFooter);
+        if (ReadUInt32LE(pBytes + 5) != ZstdSeekableMagic || (pBytes[4] & ZstdSeekTableChecksumFlag) != 0)
+        {
+            return 0;
+        }
+        return GetZSTDSeekTableSize(ReadUInt32LE(pBytes));
+    }
+
+    bool ZipReadZSTDSeekTable(const void* pSeekTable, size_t nSeekTableSize, size_t nCompressedSize, size_t nUncompressedSize, AZ::IO::CompressionFrames& frames)
+    {
+        using namespace ZipDirStructuresInternal;
+        const uint8_t* pBytes = static_cast<const uint8_t*>(pSeekTable);
+        if (nSeekTableSize < GetZSTDSeekTableSize(0) || nSeekTableSize > nCompressedSize ||
+            ReadUInt32LE(pBytes) != ZstdSeekTableSkippableMagic || ReadUInt32LE(pBytes + 4) != nSeekTableSize - ZstdSkippableHeaderSize)
+        {
+            return false;
+        }
+
+        const size_t nFrameCount = (nSeekTableSize - GetZSTDSeekTableSize(0)) / ZstdSeekTableEntrySize;
+        frames.clear();
+        frames.reserve(nFrameCount);
+        size_t nCompressedOffset = 0;
+        size_t nUncompressedOffset = 0;
+        const uint8_t* pEntries = pBytes + ZstdSkippableHeaderSize;
+        for (size_t frame = 0; frame < nFrameCount; ++frame)
+        {
+            frames.push_back({ nCompressedOffset, nUncompressedOffset });
+            nCompressedOffset += ReadUInt32LE(pEntries + frame * ZstdSeekTableEntrySize);
+            nUncompressedOffset += ReadUInt32LE(pEntries + frame * ZstdSeekTableEntrySize + 4);
+        }
+        return nCompressedOffset + nSeekTableSize == nCompressedSize && nUncompressedOffset == nUncompressedSize;
+    }
+
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
     {
         int returnCode = Z_OK;
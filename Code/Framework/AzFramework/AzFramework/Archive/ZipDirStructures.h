@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -153,6 +154,27 @@ namespace AZ::IO::ZipDir
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
+    // Decompressed size of the frames of files compressed with ZipRawCompressZSTDSeekable
+    inline constexpr size_t ZstdSeekableFrameSize = 256 * 1024;
+    // Size of the footer ending the seek table of files compressed with ZipRawCompressZSTDSeekable
+    inline constexpr size_t ZstdSeekTableFooterSize = 9;
+
+    // compresses the raw data as a sequence of independent zstd frames of nFrameSize decompressed bytes, followed by a
+    // seek table in the zstd seekable format. The result remains a regular zstd stream that ZipRawUncompress decompresses,
+    // as is any run of consecutive frames from it.
+    // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least
+    // ZipRawCompressZSTDSeekableBound(nSrcSize, nFrameSize) bytes
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel, size_t nFrameSize = ZstdSeekableFrameSize);
+    size_t ZipRawCompressZSTDSeekableBound(size_t nSrcSize, size_t nFrameSize = ZstdSeekableFrameSize);
+
+    // returns the size of the seek table ending with the given footer, the last ZstdSeekTableFooterSize bytes of a
+    // compressed file, or 0 if the file isn't compressed with ZipRawCompressZSTDSeekable
+    size_t ZipGetZSTDSeekTableSize(const void* pFooter);
+
+    // reads the frames from the seek table at the end of a file compressed with ZipRawCompressZSTDSeekable
+    // returns false if the seek table doesn't match the sizes of the file
+    bool ZipReadZSTDSeekTable(const void* pSeekTable, size_t nSeekTableSize, size_t nCompressedSize, size_t nUncompressedSize, AZ::IO::CompressionFrames& frames);
+
     // fseek wrapper with memory in file support.
     int64_t FSeek(CZipFile* zipFile, int64_t origin, int command);
 
@@ -600,18 +600,26 @@ namespace AzFramework
                     m_registry.reset(aznew AssetRegistry());
                 }
                 AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
+                if (AssetRegistry::IsPacked(bytes.data(), bytes.size()))
+                {
+                    // the packed catalog the Asset Processor writes out loads fast enough not to need pumping the system events.
+                    m_registry->LoadPacked(bytes.data(), bytes.size());
+                }
+                else
+                {
 #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
-                    AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
-                    [this, &catalogStream, &serializeContext]
-                    {
-                        AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
-                    },
-                        "Asset Catalog Loading Thread"
-                        );
+                    ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
+                        AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
+                        [this, &catalogStream, &serializeContext]
+                        {
+                            AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                        },
+                            "Asset Catalog Loading Thread"
+                            );
 #else
-                AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                    AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
 #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+                }
 
                 AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
 
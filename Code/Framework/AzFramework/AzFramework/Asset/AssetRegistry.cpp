@@ -51,6 +51,82 @@ namespace AssetRegistryInternal
 
         return AZ::Uuid::CreateName(tempBuffer);
     }
+
+    // the packed catalog starts with this tag, followed by the format version.
+    constexpr char PackedCatalogTag[8] = { 'A', 'Z', 'C', 'A', 'T', 'P', 'K', 'D' };
+    constexpr AZ::u32 PackedCatalogVersion = 1;
+
+    template<typename T>
+    void WritePacked(AZ::IO::GenericStream& stream, const T& value)
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be packed");
+        stream.Write(sizeof(T), &value);
+    }
+
+    void WritePacked(AZ::IO::GenericStream& stream, const AZ::Data::AssetId& assetId)
+    {
+        WritePacked(stream, assetId.m_guid);
+        WritePacked(stream, assetId.m_subId);
+    }
+
+    void WritePacked(AZ::IO::GenericStream& stream, const AZStd::string& value)
+    {
+        WritePacked(stream, aznumeric_cast<AZ::u32>(value.size()));
+        stream.Write(value.size(), value.data());
+    }
+
+    // reads the packed values back, failing on the first read past the end of the buffer.
+    class PackedReader
+    {
+    public:
+        PackedReader(const char* buffer, size_t bufferSize)
+            : m_current(buffer)
+            , m_end(buffer + bufferSize)
+        {
+        }
+
+        template<typename T>
+        bool Read(T& value)
+        {
+            static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be packed");
+            if (aznumeric_cast<size_t>(m_end - m_current) < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, m_current, sizeof(T));
+            m_current += sizeof(T);
+            return true;
+        }
+
+        bool Read(AZ::Data::AssetId& assetId)
+        {
+            return Read(assetId.m_guid) && Read(assetId.m_subId);
+        }
+
+        bool Read(AZStd::string& value)
+        {
+            AZ::u32 size = 0;
+            if (!Read(size) || aznumeric_cast<size_t>(m_end - m_current) < size)
+            {
+                return false;
+            }
+            value.assign(m_current, size);
+            m_current += size;
+            return true;
+        }
+
+        // reads a count, checking that the buffer can hold that many records of at least recordSize bytes.
+        bool ReadCount(AZ::u32& count, size_t recordSize)
+        {
+            return Read(count) && aznumeric_cast<size_t>(m_end - m_current) / recordSize >= count;
+        }
+
+    private:
+        const char* m_current;
+        const char* m_end;
+    };
+
+    constexpr size_t PackedAssetIdSize = sizeof(AZ::Uuid) + sizeof(AZ::u32);
 }
 
 namespace AzFramework
@@ -96,6 +172,171 @@ namespace AzFramework
         }
     }
 
+    //=========================================================================
+    // AssetRegistry::SavePacked
+    //=========================================================================
+    bool AssetRegistry::SavePacked(AZ::IO::GenericStream& stream) const
+    {
+        stream.Write(sizeof(PackedCatalogTag), PackedCatalogTag);
+        WritePacked(stream, PackedCatalogVersion);
+
+        WritePacked(stream, aznumeric_cast<AZ::u32>(m_assetIdToInfo.size()));
+        for (const auto& element : m_assetIdToInfo)
+        {
+            WritePacked(stream, element.first);
+            WritePacked(stream, element.second.m_assetId);
+            WritePacked(stream, element.second.m_assetType);
+            WritePacked(stream, element.second.m_sizeBytes);
+            WritePacked(stream, element.second.m_relativePath);
+        }
+
+        WritePacked(stream, aznumeric_cast<AZ::u32>(m_assetPathToId.size()));
+        for (const auto& element : m_assetPathToId)
+        {
+            WritePacked(stream, element.first);
+            WritePacked(stream, element.second);
+        }
+
+        WritePacked(stream, aznumeric_cast<AZ::u32>(m_legacyAssetIdToRealAssetId.size()));
+        for (const auto& element : m_legacyAssetIdToRealAssetId)
+        {
+            WritePacked(stream, element.first);
+            WritePacked(stream, element.second);
+        }
+
+        // the dependencies of each asset are stored as one flat list
+        WritePacked(stream, aznumeric_cast<AZ::u32>(m_assetDependencies.size()));
+        for (const auto& element : m_assetDependencies)
+        {
+            WritePacked(stream, element.first);
+            WritePacked(stream, aznumeric_cast<AZ::u32>(element.second.size()));
+            for (const AZ::Data::ProductDependency& dependency : element.second)
+            {
+                WritePacked(stream, dependency.m_assetId);
+                WritePacked(stream, dependency.m_flags.to_ullong());
+            }
+        }
+
+        return stream.IsOpen();
+    }
+
+    //=========================================================================
+    // AssetRegistry::IsPacked
+    //=========================================================================
+    bool AssetRegistry::IsPacked(const void* buffer, size_t bufferSize)
+    {
+        return buffer && bufferSize >= sizeof(PackedCatalogTag) && memcmp(buffer, PackedCatalogTag, sizeof(PackedCatalogTag)) == 0;
+    }
+
+    //=========================================================================
+    // AssetRegistry::LoadPacked
+    //=========================================================================
+    bool AssetRegistry::LoadPacked(const void* buffer, size_t bufferSize)
+    {
+        Clear();
+        m_legacyAssetIdToRealAssetId = LegacyAssetIdToRealAssetIdMap();
+
+        if (!IsPacked(buffer, bufferSize))
+        {
+            return false;
+        }
+
+        PackedReader reader(static_cast<const char*>(buffer) + sizeof(PackedCatalogTag), bufferSize - sizeof(PackedCatalogTag));
+        AZ::u32 version = 0;
+        if (!reader.Read(version) || version != PackedCatalogVersion)
+        {
+            AZ_Error("AssetRegistry", false, "Unsupported packed asset catalog version %u.", version);
+            return false;
+        }
+
+        // the maps get sized up front, so loading never rehashes them
+        bool succeeded = true;
+        AZ::u32 count = 0;
+        if (reader.ReadCount(count, 2 * PackedAssetIdSize + sizeof(AZ::Uuid) + sizeof(AZ::u64) + sizeof(AZ::u32)))
+        {
+            m_assetIdToInfo.reserve(count);
+            for (AZ::u32 index = 0; index < count && succeeded; ++index)
+            {
+                AZ::Data::AssetId assetId;
+                AZ::Data::AssetInfo assetInfo;
+                succeeded = reader.Read(assetId) && reader.Read(assetInfo.m_assetId) && reader.Read(assetInfo.m_assetType) &&
+                    reader.Read(assetInfo.m_sizeBytes) && reader.Read(assetInfo.m_relativePath);
+                m_assetIdToInfo.emplace(assetId, AZStd::move(assetInfo));
+            }
+        }
+        else
+        {
+            succeeded = false;
+        }
+
+        if (succeeded && reader.ReadCount(count, sizeof(AZ::Uuid) + PackedAssetIdSize))
+        {
+            m_assetPathToId.reserve(count);
+            for (AZ::u32 index = 0; index < count && succeeded; ++index)
+            {
+                AZ::Uuid pathId;
+                AZ::Data::AssetId assetId;
+                succeeded = reader.Read(pathId) && reader.Read(assetId);
+                m_assetPathToId.emplace(pathId, assetId);
+            }
+        }
+        else
+        {
+            succeeded = false;
+        }
+
+        if (succeeded && reader.ReadCount(count, 2 * PackedAssetIdSize))
+        {
+            m_legacyAssetIdToRealAssetId.reserve(count);
+            for (AZ::u32 index = 0; index < count && succeeded; ++index)
+            {
+                AZ::Data::AssetId legacyAssetId;
+                AZ::Data::AssetId assetId;
+                succeeded = reader.Read(legacyAssetId) && reader.Read(assetId);
+                m_legacyAssetIdToRealAssetId.emplace(legacyAssetId, assetId);
+            }
+        }
+        else
+        {
+            succeeded = false;
+        }
+
+        if (succeeded && reader.ReadCount(count, PackedAssetIdSize + sizeof(AZ::u32)))
+        {
+            m_assetDependencies.reserve(count);
+            for (AZ::u32 index = 0; index < count && succeeded; ++index)
+            {
+                AZ::Data::AssetId assetId;
+                AZ::u32 dependencyCount = 0;
+                succeeded = reader.Read(assetId) && reader.ReadCount(dependencyCount, PackedAssetIdSize + sizeof(AZ::u64));
+                if (succeeded)
+                {
+                    AZStd::vector<AZ::Data::ProductDependency>& dependencies = m_assetDependencies[assetId];
+                    dependencies.reserve(dependencyCount);
+                    for (AZ::u32 dependencyIndex = 0; dependencyIndex < dependencyCount && succeeded; ++dependencyIndex)
+                    {
+                        AZ::Data::ProductDependency& dependency = dependencies.emplace_back();
+                        AZ::u64 flags = 0;
+                        succeeded = reader.Read(dependency.m_assetId) && reader.Read(flags);
+                        dependency.m_flags = AZStd::bitset<64>(flags);
+                    }
+                }
+            }
+        }
+        else
+        {
+            succeeded = false;
+        }
+
+        if (!succeeded)
+        {
+            AZ_Error("AssetRegistry", false, "The packed asset catalog is truncated and could not be loaded.");
+            Clear();
+            m_legacyAssetIdToRealAssetId = LegacyAssetIdToRealAssetIdMap();
+        }
+        return succeeded;
+    }
+
     //=========================================================================
     // AssetRegistry::RegisterAsset
     //=========================================================================
@@ -11,6 +11,7 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
@@ -59,6 +60,17 @@ namespace AzFramework
 
         static void ReflectSerialize(AZ::SerializeContext* serializeContext);
 
+        //! Writes the registry out in the packed catalog format. It stores the same data as the serialized registry as flat
+        //! arrays of fixed size records, which load many times faster than an ObjectStream, without any per element overhead.
+        bool SavePacked(AZ::IO::GenericStream& stream) const;
+
+        //! Returns true if the buffer starts with the tag of the packed catalog format.
+        static bool IsPacked(const void* buffer, size_t bufferSize);
+
+        //! Replaces the content of the registry with the packed catalog held by the buffer.
+        //! Returns false, leaving the registry empty, if the buffer is not a valid packed catalog.
+        bool LoadPacked(const void* buffer, size_t bufferSize);
+
     private:
         // Add another registry to our existing registry data.  Intended to be called by AssetCatalog::AddDeltaCatalog
         void AddRegistry(AZStd::shared_ptr<AssetRegistry> assetRegistry);
@@ -19,6 +19,7 @@
 #include <AzFramework/Input/Contexts/InputContextComponent.h>
 #include <AzFramework/Input/System/InputSystemComponent.h>
 #include <AzFramework/Render/GameIntersectorComponent.h>
+#include <AzFramework/Replay/FrameReplaySystemComponent.h>
 #include <AzFramework/Scene/SceneSystemComponent.h>
 #include <AzFramework/Script/ScriptComponent.h>
 #include <AzFramework/Script/ScriptRemoteDebugging.h>
@@ -59,6 +60,7 @@ namespace AzFramework
 
             AzFramework::OctreeSystemComponent::CreateDescriptor(),
             AzFramework::SpawnableSystemComponent::CreateDescriptor(),
+            AzFramework::FrameReplaySystemComponent::CreateDescriptor(),
         });
     }
 
@@ -67,6 +69,7 @@ namespace AzFramework
         return AZ::ComponentTypeList
         {
             azrtti_typeid<AzFramework::OctreeSystemComponent>(),
+            azrtti_typeid<AzFramework::FrameReplaySystemComponent>(),
         };
     }
 }
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformStorage.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -80,6 +81,22 @@ namespace AZ
 
 namespace AzFramework
 {
+    namespace
+    {
+        // Appends the descendants of the entities at and after levelStart, one hierarchy level at a time so that
+        // each level is gathered with a single batched dispatch
+        void GatherDescendants(AZStd::vector<AZ::EntityId>& descendants, size_t levelStart)
+        {
+            AZStd::vector<AZ::EntityId> level;
+            while (levelStart < descendants.size())
+            {
+                level.assign(descendants.begin() + levelStart, descendants.end());
+                levelStart = descendants.size();
+                AZ::TransformHierarchyInformationBus::EventBatch(level, &AZ::TransformHierarchyInformationBus::Events::GatherChildren, descendants);
+            }
+        }
+    }
+
     bool TransformComponentVersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
     {
         if (classElement.GetVersion() < 3)
@@ -152,6 +169,12 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        if (TransformStorage* transformStorage = AZ::Interface<TransformStorage>::Get())
+        {
+            m_transformStorage = transformStorage;
+            m_transformStorageIndex = transformStorage->Add(GetEntityId(), m_localTM, m_parentId);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
@@ -173,6 +196,19 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
         }
         AZ::TransformBus::Handler::BusDisconnect();
+
+        if (TransformStorage* transformStorage = GetTransformStorage())
+        {
+            transformStorage->Remove(m_transformStorageIndex);
+        }
+        m_transformStorage = nullptr;
+        m_transformStorageIndex = TransformStorage::InvalidIndex;
+    }
+
+    TransformStorage* TransformComponent::GetTransformStorage() const
+    {
+        // The storage lives with its entity context, ignore it if it went away while this entity was active
+        return (m_transformStorage && m_transformStorage == AZ::Interface<TransformStorage>::Get()) ? m_transformStorage : nullptr;
     }
 
     void TransformComponent::BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler& handler)
@@ -442,20 +478,14 @@ namespace AzFramework
     AZStd::vector<AZ::EntityId> TransformComponent::GetAllDescendants()
     {
         AZStd::vector<AZ::EntityId> descendants = GetChildren();
-        for (size_t i = 0; i < descendants.size(); ++i)
-        {
-            EBUS_EVENT_ID(descendants[i], AZ::TransformHierarchyInformationBus, GatherChildren, descendants);
-        }
+        GatherDescendants(descendants, 0);
         return descendants;
     }
 
     AZStd::vector<AZ::EntityId> TransformComponent::GetEntityAndAllDescendants()
     {
         AZStd::vector<AZ::EntityId> descendants = { GetEntityId() };
-        for (size_t i = 0; i < descendants.size(); ++i)
-        {
-            EBUS_EVENT_ID(descendants[i], AZ::TransformHierarchyInformationBus, GatherChildren, descendants);
-        }
+        GatherDescendants(descendants, 0);
         return descendants;
     }
 
@@ -550,6 +580,11 @@ namespace AzFramework
         }
 
         m_parentId = parentId;
+        if (TransformStorage* transformStorage = GetTransformStorage())
+        {
+            transformStorage->SetParent(m_transformStorageIndex, m_parentId);
+        }
+
         if (m_parentId.IsValid())
         {
             AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get();
@@ -606,6 +641,10 @@ namespace AzFramework
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
         m_localTM = tm;
+        if (TransformStorage* transformStorage = GetTransformStorage())
+        {
+            transformStorage->SetLocalTM(m_transformStorageIndex, m_localTM);
+        }
         ComputeWorldTM();  // We can user dirty flags and compute it later on demand
     }
 
@@ -638,6 +677,11 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
+        if (TransformStorage* transformStorage = GetTransformStorage())
+        {
+            transformStorage->SetLocalTM(m_transformStorageIndex, m_localTM);
+        }
+
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
 
@@ -25,6 +25,7 @@ namespace AzToolsFramework
 namespace AzFramework
 {
     class GameEntityContextComponent;
+    class TransformStorage;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -163,6 +164,8 @@ namespace AzFramework
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
+        TransformStorage* GetTransformStorage() const;
+
         // TransformHierarchyInformationBus
         void GatherChildren(AZStd::vector<AZ::EntityId>& children) override;
 
@@ -186,5 +189,8 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+
+        TransformStorage* m_transformStorage = nullptr; ///< Storage this transform is mirrored into while active, if any.
+        uint32_t m_transformStorageIndex = AZStd::numeric_limits<uint32_t>::max(); ///< Index of this transform in m_transformStorage.
     };
 }   // namespace AZ
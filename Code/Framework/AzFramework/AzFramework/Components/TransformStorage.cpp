@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformStorage.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    AZ_CVAR(bool, az_transformStorage, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Mirror game entity transforms into a structure of arrays storage that recomputes world transforms once per tick. "
+        "Takes effect the next time the game entity context is activated.");
+
+    AZ_CVAR(uint32_t, az_transformStorageBatchSize, 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of transforms updated per task when the transform storage updates world transforms in parallel.");
+
+    TransformStorage::TransformStorage() = default;
+
+    TransformStorage::~TransformStorage()
+    {
+        if (AZ::Interface<TransformStorage>::Get() == this)
+        {
+            Disconnect();
+        }
+    }
+
+    void TransformStorage::Connect()
+    {
+        AZ::Interface<TransformStorage>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformStorage::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<TransformStorage>::Unregister(this);
+    }
+
+    TransformStorage::Index TransformStorage::Add(AZ::EntityId entityId, const AZ::Transform& localTM, AZ::EntityId parentId)
+    {
+        AZ_Assert(m_indices.find(entityId) == m_indices.end(), "Entity %s is already in the transform storage", entityId.ToString().c_str());
+
+        Index index;
+        if (!m_freeIndices.empty())
+        {
+            index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        }
+        else
+        {
+            index = aznumeric_cast<Index>(m_entityIds.size());
+            if (index % ChunkSize == 0)
+            {
+                m_chunks.emplace_back(AZStd::make_unique<Chunk>());
+            }
+            m_entityIds.emplace_back();
+            m_parentIds.emplace_back();
+        }
+
+        m_entityIds[index] = entityId;
+        m_parentIds[index] = parentId;
+        m_indices.emplace(entityId, index);
+
+        Chunk& chunk = GetChunk(index);
+        const Index slot = index % ChunkSize;
+        chunk.m_parent[slot] = InvalidIndex;
+        // Until the next update the world transform is the local one
+        chunk.m_localTranslation[slot] = chunk.m_worldTranslation[slot] = localTM.GetTranslation();
+        chunk.m_localRotation[slot] = chunk.m_worldRotation[slot] = localTM.GetRotation();
+        chunk.m_localScale[slot] = chunk.m_worldScale[slot] = localTM.GetUniformScale();
+
+        m_hierarchyDirty = true;
+        return index;
+    }
+
+    void TransformStorage::Remove(Index index)
+    {
+        AZ_Assert(index < m_entityIds.size() && m_entityIds[index].IsValid(), "Invalid transform storage index %u", index);
+
+        m_indices.erase(m_entityIds[index]);
+        m_entityIds[index] = AZ::EntityId();
+        m_parentIds[index] = AZ::EntityId();
+        m_freeIndices.push_back(index);
+        m_hierarchyDirty = true;
+    }
+
+    void TransformStorage::SetLocalTM(Index index, const AZ::Transform& localTM)
+    {
+        Chunk& chunk = GetChunk(index);
+        const Index slot = index % ChunkSize;
+        chunk.m_localTranslation[slot] = localTM.GetTranslation();
+        chunk.m_localRotation[slot] = localTM.GetRotation();
+        chunk.m_localScale[slot] = localTM.GetUniformScale();
+    }
+
+    void TransformStorage::SetParent(Index index, AZ::EntityId parentId)
+    {
+        if (m_parentIds[index] != parentId)
+        {
+            m_parentIds[index] = parentId;
+            m_hierarchyDirty = true;
+        }
+    }
+
+    AZ::Transform TransformStorage::GetLocalTM(Index index) const
+    {
+        const Chunk& chunk = GetChunk(index);
+        const Index slot = index % ChunkSize;
+        return AZ::Transform(chunk.m_localTranslation[slot], chunk.m_localRotation[slot], chunk.m_localScale[slot]);
+    }
+
+    AZ::Transform TransformStorage::GetWorldTM(Index index) const
+    {
+        const Chunk& chunk = GetChunk(index);
+        const Index slot = index % ChunkSize;
+        return AZ::Transform(chunk.m_worldTranslation[slot], chunk.m_worldRotation[slot], chunk.m_worldScale[slot]);
+    }
+
+    TransformStorage::Index TransformStorage::FindIndex(AZ::EntityId entityId) const
+    {
+        auto it = m_indices.find(entityId);
+        return it != m_indices.end() ? it->second : InvalidIndex;
+    }
+
+    size_t TransformStorage::GetCount() const
+    {
+        return m_indices.size();
+    }
+
+    void TransformStorage::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        UpdateWorldTransforms();
+    }
+
+    int TransformStorage::GetTickOrder()
+    {
+        // After gameplay, animation and physics moved entities, before render data is gathered
+        return AZ::TICK_PRE_RENDER - 1;
+    }
+
+    void TransformStorage::RebuildUpdateOrder()
+    {
+        AZ_PROFILE_SCOPE(AzFramework, "TransformStorage::RebuildUpdateOrder");
+
+        const Index indexCount = aznumeric_cast<Index>(m_entityIds.size());
+        for (Index index = 0; index < indexCount; ++index)
+        {
+            if (m_entityIds[index].IsValid())
+            {
+                GetChunk(index).m_parent[index % ChunkSize] = FindIndex(m_parentIds[index]);
+            }
+        }
+
+        // Depth of each live entry, resolved walking up to the first entry with a known depth
+        constexpr uint32_t UnknownDepth = AZStd::numeric_limits<uint32_t>::max();
+        AZStd::vector<uint32_t> depths(indexCount, UnknownDepth);
+        AZStd::vector<Index> chain;
+        uint32_t maxDepth = 0;
+        for (Index index = 0; index < indexCount; ++index)
+        {
+            if (!m_entityIds[index].IsValid() || depths[index] != UnknownDepth)
+            {
+                continue;
+            }
+
+            chain.clear();
+            Index current = index;
+            while (current != InvalidIndex && depths[current] == UnknownDepth && chain.size() <= indexCount)
+            {
+                chain.push_back(current);
+                current = GetChunk(current).m_parent[current % ChunkSize];
+            }
+            AZ_Assert(chain.size() <= indexCount, "Cycle in the transform hierarchy of entity %s", m_entityIds[index].ToString().c_str());
+
+            uint32_t depth = current == InvalidIndex ? 0 : depths[current] + 1;
+            for (auto it = chain.rbegin(); it != chain.rend(); ++it, ++depth)
+            {
+                depths[*it] = depth;
+                maxDepth = AZStd::max(maxDepth, depth);
+            }
+        }
+
+        // Counting sort of the live entries by depth
+        m_levelOffsets.assign(m_indices.empty() ? 1 : maxDepth + 2, 0);
+        for (Index index = 0; index < indexCount; ++index)
+        {
+            if (m_entityIds[index].IsValid())
+            {
+                ++m_levelOffsets[depths[index] + 1];
+            }
+        }
+        for (size_t level = 1; level < m_levelOffsets.size(); ++level)
+        {
+            m_levelOffsets[level] += m_levelOffsets[level - 1];
+        }
+
+        m_updateOrder.resize_no_construct(m_indices.size());
+        AZStd::vector<size_t> cursors(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+        for (Index index = 0; index < indexCount; ++index)
+        {
+            if (m_entityIds[index].IsValid())
+            {
+                m_updateOrder[cursors[depths[index]]++] = index;
+            }
+        }
+
+        m_hierarchyDirty = false;
+        m_updateGraphDirty = true;
+    }
+
+    void TransformStorage::RebuildUpdateGraph()
+    {
+        static const AZ::TaskDescriptor updateTransformsDesc{ "AzFramework::TransformStorage::UpdateWorldTransforms", "AzFramework" };
+        static const AZ::TaskDescriptor levelBarrierDesc{ "AzFramework::TransformStorage::LevelBarrier", "AzFramework" };
+
+        m_updateGraph.Reset();
+
+        // Each level is split in batches that run concurrently, a barrier task separates consecutive levels
+        const size_t batchSize = AZStd::max<size_t>(static_cast<uint32_t>(az_transformStorageBatchSize), 1);
+        AZStd::vector<AZ::TaskToken> previousLevel;
+        AZStd::vector<AZ::TaskToken> currentLevel;
+        for (size_t level = 0; level + 1 < m_levelOffsets.size(); ++level)
+        {
+            currentLevel.clear();
+            for (size_t begin = m_levelOffsets[level]; begin < m_levelOffsets[level + 1]; begin += batchSize)
+            {
+                const size_t end = AZStd::min(begin + batchSize, m_levelOffsets[level + 1]);
+                currentLevel.push_back(m_updateGraph.AddTask(updateTransformsDesc, [this, begin, end]()
+                    {
+                        UpdateRange(begin, end);
+                    }));
+            }
+
+            if (!previousLevel.empty())
+            {
+                AZ::TaskToken barrier = m_updateGraph.AddTask(levelBarrierDesc, []() {});
+                for (AZ::TaskToken& token : previousLevel)
+                {
+                    token.Precedes(barrier);
+                }
+                for (AZ::TaskToken& token : currentLevel)
+                {
+                    barrier.Precedes(token);
+                }
+            }
+            previousLevel.swap(currentLevel);
+        }
+
+        m_updateGraphDirty = false;
+    }
+
+    void TransformStorage::UpdateWorldTransforms()
+    {
+        AZ_PROFILE_SCOPE(AzFramework, "TransformStorage::UpdateWorldTransforms");
+
+        if (m_hierarchyDirty)
+        {
+            RebuildUpdateOrder();
+        }
+
+        const size_t batchSize = AZStd::max<size_t>(static_cast<uint32_t>(az_transformStorageBatchSize), 1);
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (m_updateOrder.size() <= batchSize || !taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            UpdateRange(0, m_updateOrder.size());
+            return;
+        }
+
+        if (m_updateGraphDirty)
+        {
+            RebuildUpdateGraph();
+        }
+        AZ::TaskGraphEvent finishedEvent;
+        m_updateGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+    void TransformStorage::UpdateRange(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const Index index = m_updateOrder[i];
+            Chunk& chunk = GetChunk(index);
+            const Index slot = index % ChunkSize;
+            const Index parent = chunk.m_parent[slot];
+            if (parent == InvalidIndex)
+            {
+                chunk.m_worldTranslation[slot] = chunk.m_localTranslation[slot];
+                chunk.m_worldRotation[slot] = chunk.m_localRotation[slot];
+                chunk.m_worldScale[slot] = chunk.m_localScale[slot];
+            }
+            else
+            {
+                // Same composition as AZ::Transform::operator*, parentWorld * local
+                const Chunk& parentChunk = GetChunk(parent);
+                const Index parentSlot = parent % ChunkSize;
+                const AZ::Quaternion& parentRotation = parentChunk.m_worldRotation[parentSlot];
+                const float parentScale = parentChunk.m_worldScale[parentSlot];
+                chunk.m_worldTranslation[slot] = parentRotation.TransformVector(parentScale * chunk.m_localTranslation[slot]) +
+                    parentChunk.m_worldTranslation[parentSlot];
+                chunk.m_worldRotation[slot] = parentRotation * chunk.m_localRotation[slot];
+                chunk.m_worldScale[slot] = parentScale * chunk.m_localScale[slot];
+            }
+        }
+    }
+} // namespace AzFramework
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace AzFramework
+{
+    AZ_CVAR_EXTERNED(bool, az_transformStorage);
+
+    //! Transforms of all the entities of an entity context, stored as structure of arrays in fixed size chunks.
+    //! TransformComponent mirrors its local transform and parent into the storage when one is registered with
+    //! AZ::Interface<TransformStorage> (see the az_transformStorage cvar), and the world transforms of every entry
+    //! are recomputed once per tick in a single pass, level by level from the roots down, and in parallel within
+    //! a level. TransformBus remains the public API; the storage lets systems that need many transforms at once
+    //! (culling, rendering, networking) read them from contiguous memory.
+    //! Entries whose parent is not in the storage are treated as roots.
+    //! The storage is not thread safe, entries must be modified from the main thread.
+    class TransformStorage
+        : private AZ::TickBus::Handler
+    {
+    public:
+        AZ_RTTI(TransformStorage, "{082233E2-2AA8-4A17-B0B8-4B4E7DD14D86}");
+        AZ_CLASS_ALLOCATOR(TransformStorage, AZ::SystemAllocator, 0);
+
+        using Index = uint32_t;
+        static constexpr Index InvalidIndex = AZStd::numeric_limits<Index>::max();
+        static constexpr uint32_t ChunkSize = 256;
+
+        TransformStorage();
+        virtual ~TransformStorage();
+
+        //! Registers the storage with AZ::Interface and starts updating world transforms every tick.
+        void Connect();
+        void Disconnect();
+
+        //! Adds an entity to the storage and returns its index. The parent is resolved by entity id.
+        Index Add(AZ::EntityId entityId, const AZ::Transform& localTM, AZ::EntityId parentId);
+        void Remove(Index index);
+
+        void SetLocalTM(Index index, const AZ::Transform& localTM);
+        void SetParent(Index index, AZ::EntityId parentId);
+
+        AZ::Transform GetLocalTM(Index index) const;
+        //! World transform computed by the last UpdateWorldTransforms.
+        AZ::Transform GetWorldTM(Index index) const;
+        Index FindIndex(AZ::EntityId entityId) const;
+        size_t GetCount() const;
+
+        //! Recomputes the world transforms of all entries.
+        void UpdateWorldTransforms();
+
+    private:
+        struct Chunk
+        {
+            AZ::Vector3 m_localTranslation[ChunkSize];
+            AZ::Quaternion m_localRotation[ChunkSize];
+            float m_localScale[ChunkSize];
+            AZ::Vector3 m_worldTranslation[ChunkSize];
+            AZ::Quaternion m_worldRotation[ChunkSize];
+            float m_worldScale[ChunkSize];
+            Index m_parent[ChunkSize];
+        };
+
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        //! Resolves parents and sorts the entries by hierarchy depth.
+        void RebuildUpdateOrder();
+        //! Recreates the retained task graph that processes m_updateOrder.
+        void RebuildUpdateGraph();
+        void UpdateRange(size_t begin, size_t end);
+
+        Chunk& GetChunk(Index index) { return *m_chunks[index / ChunkSize]; }
+        const Chunk& GetChunk(Index index) const { return *m_chunks[index / ChunkSize]; }
+
+        AZStd::vector<AZStd::unique_ptr<Chunk>> m_chunks;
+        AZStd::vector<AZ::EntityId> m_entityIds; //!< Entity of each index, invalid for free indices.
+        AZStd::vector<AZ::EntityId> m_parentIds; //!< Parent entity of each index.
+        AZStd::vector<Index> m_freeIndices;
+        AZStd::unordered_map<AZ::EntityId, Index> m_indices;
+
+        AZStd::vector<Index> m_updateOrder; //!< Live indices, parents before children.
+        AZStd::vector<size_t> m_levelOffsets; //!< Start of each hierarchy level in m_updateOrder, plus the end.
+        AZ::TaskGraph m_updateGraph;
+        bool m_hierarchyDirty = false;
+        bool m_updateGraphDirty = false;
+    };
+} // namespace AzFramework
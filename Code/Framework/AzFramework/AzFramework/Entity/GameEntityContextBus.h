@@ -84,6 +84,12 @@ namespace AzFramework
          */
         virtual void AddGameEntity(AZ::Entity* /*entity*/) = 0;
 
+        /**
+         * Adds existing entities to the game context, activating them as one batch.
+         * @param entities The entities to add to the game context.
+         */
+        virtual void AddGameEntities(const AZStd::vector<AZ::Entity*>& /*entities*/) = 0;
+
         /**
          * Destroys an entity. 
          * The entity is immediately deactivated and will be destroyed on the next tick.
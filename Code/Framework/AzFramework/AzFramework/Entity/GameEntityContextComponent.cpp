@@ -8,6 +8,7 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -20,6 +21,9 @@
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, bg_parallelEntityActivation, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Activates the entities added together to the game context as one batch, activating the components that are safe to activate on any thread in parallel");
+
     //=========================================================================
     // Reflect
     //=========================================================================
@@ -88,6 +92,12 @@ namespace AzFramework
     {
         m_entityOwnershipService = AZStd::make_unique<SliceGameEntityOwnershipService>(GetContextId(), GetSerializeContext());
 
+        if (az_transformStorage)
+        {
+            m_transformStorage = AZStd::make_unique<TransformStorage>();
+            m_transformStorage->Connect();
+        }
+
         InitContext();
 
         GameEntityContextRequestBus::Handler::BusConnect();
@@ -106,6 +116,12 @@ namespace AzFramework
 
         DestroyContext();
 
+        if (m_transformStorage)
+        {
+            m_transformStorage->Disconnect();
+            m_transformStorage.reset();
+        }
+
         m_entityOwnershipService.reset();
     }
 
@@ -145,6 +161,14 @@ namespace AzFramework
         AddEntity(entity);
     }
 
+    //=========================================================================
+    // GameEntityContextRequestBus::AddGameEntities
+    //=========================================================================
+    void GameEntityContextComponent::AddGameEntities(const EntityList& entities)
+    {
+        m_entityOwnershipService->AddEntities(entities);
+    }
+
 
     //=========================================================================
     // CreateEntity
@@ -227,6 +251,23 @@ namespace AzFramework
             }
         }
 
+    #if !(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+        if (bg_parallelEntityActivation && entities.size() > 1)
+        {
+            EntityList entitiesToActivate;
+            entitiesToActivate.reserve(entities.size());
+            for (AZ::Entity* entity : entities)
+            {
+                if (entity->GetState() == AZ::Entity::State::Init && entity->IsRuntimeActiveByDefault())
+                {
+                    entitiesToActivate.push_back(entity);
+                }
+            }
+            AZ::Entity::ActivateEntities(entitiesToActivate);
+            return;
+        }
+    #endif // !(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+
         for (AZ::Entity* entity : entities)
         {
             if (entity->GetState() == AZ::Entity::State::Init)
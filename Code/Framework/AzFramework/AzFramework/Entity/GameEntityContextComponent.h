@@ -15,6 +15,7 @@
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
+#include <AzFramework/Components/TransformStorage.h>
 
 #include "EntityContext.h"
 
@@ -53,6 +54,7 @@ namespace AzFramework
         AZ::Entity* CreateGameEntity(const char* name) override;
         BehaviorEntity CreateGameEntityForBehaviorContext(const char* name) override;
         void AddGameEntity(AZ::Entity* entity) override;
+        void AddGameEntities(const EntityList& entities) override;
         void DestroyGameEntity(const AZ::EntityId&) override;
         void DestroyGameEntityAndDescendants(const AZ::EntityId&) override;
         void ActivateGameEntity(const AZ::EntityId&) override;
@@ -92,6 +94,7 @@ namespace AzFramework
     private:
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AZStd::unique_ptr<AzFramework::TransformStorage> m_transformStorage; ///< Only created when az_transformStorage is set.
     };
 } // namespace AzFramework
 
@@ -127,6 +127,7 @@ namespace AzPhysics
                 ->Field("Direction", &RayCastRequest::m_direction)
                 ->Field("HitFlags", &RayCastRequest::m_hitFlags)
                 ->Field("ReportMultipleHits", &RayCastRequest::m_reportMultipleHits)
+                ->Field("AllowCachedResults", &RayCastRequest::m_allowCachedResults)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -152,6 +153,7 @@ namespace AzPhysics
                 ->Property("Start", BehaviorValueProperty(&RayCastRequest::m_start))
                 ->Property("Direction", BehaviorValueProperty(&RayCastRequest::m_direction))
                 ->Property("ReportMultipleHits", BehaviorValueProperty(&RayCastRequest::m_reportMultipleHits))
+                ->Property("AllowCachedResults", BehaviorValueProperty(&RayCastRequest::m_allowCachedResults))
                 ;
 
             behaviorContext->Class<SceneQueries>("SceneQueries")
@@ -183,6 +185,7 @@ namespace AzPhysics
                 ->Field("ShapeConfiguration", &ShapeCastRequest::m_shapeConfiguration)
                 ->Field("HitFlags", &ShapeCastRequest::m_hitFlags)
                 ->Field("ReportMultipleHits", &ShapeCastRequest::m_reportMultipleHits)
+                ->Field("AllowCachedResults", &ShapeCastRequest::m_allowCachedResults)
                 ;
         }
 
@@ -196,6 +199,7 @@ namespace AzPhysics
                 ->Property("Distance", BehaviorValueProperty(&ShapeCastRequest::m_distance))
                 ->Property("Start", BehaviorValueProperty(&ShapeCastRequest::m_start))
                 ->Property("Direction", BehaviorValueProperty(&ShapeCastRequest::m_direction))
+                ->Property("AllowCachedResults", BehaviorValueProperty(&ShapeCastRequest::m_allowCachedResults))
                 ;
 
             behaviorContext->Method(
@@ -176,6 +176,10 @@ namespace AzPhysics
         SceneQuery::HitFlags m_hitFlags = SceneQuery::HitFlags::Default; //!< Query behavior flags
         SceneQuery::FilterCallback m_filterCallback = nullptr; //!< Hit filtering function
         bool m_reportMultipleHits = false; //!< flag to have the cast stop after the first hit or return all hits along the query.
+        //! Allows the scene to return the hits of a previous near-identical cast, as long as no simulated body moved in the region
+        //! of the cast since. The start, direction and distance are quantized to match the previous casts, so the hits are those
+        //! of a cast that may differ slightly from this one. Ignored when a filter callback is set.
+        bool m_allowCachedResults = false;
     };
 
     //! Sweeps a shape from a starting pose along a direction returning objects that intersected with the shape.
@@ -193,6 +197,9 @@ namespace AzPhysics
         SceneQuery::HitFlags m_hitFlags = SceneQuery::HitFlags::Default | SceneQuery::HitFlags::MTD; //!< Query behavior flags. MTD Is On by default to correctly report objects that are initially in contact with the start pose.
         SceneQuery::FilterCallback m_filterCallback = nullptr; //!< Hit filtering function
         bool m_reportMultipleHits = false; //!< flag to have the cast stop after the first hit or return all hits along the query.
+        //! Allows the scene to return the hits of a previous near-identical cast, see RayCastRequest::m_allowCachedResults.
+        //! Only sphere, box and capsule casts can be cached.
+        bool m_allowCachedResults = false;
     };
 
     namespace ShapeCastRequestHelpers
@@ -104,6 +104,16 @@ namespace Physics
         //! Returns the list of heights and materials used by the height field.
         //! @return the rows*columns vector of the heights and materials.
         virtual AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const = 0;
+
+        //! Returns the heights and materials of a rectangle of the height field samples.
+        //! Used to refresh the part of the heightfield covered by the dirty region of OnHeightfieldDataChanged.
+        //! @param startColumn the first column of the rectangle.
+        //! @param startRow the first row of the rectangle.
+        //! @param numColumns the number of columns of the rectangle.
+        //! @param numRows the number of rows of the rectangle.
+        //! @return the numRows*numColumns vector of the heights and materials, row by row.
+        virtual AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterialsInRegion(
+            int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows) const = 0;
     };
 
     using HeightfieldProviderRequestsBus = AZ::EBus<HeightfieldProviderRequests>;
@@ -135,5 +135,10 @@ namespace Physics
 
         /// Returns the number of ragdoll nodes in the ragdoll.
         virtual size_t GetNumNodes() const = 0;
+
+        /// Tells whether the character using the ragdoll is visible, so the physics backend can lower the simulation
+        /// fidelity of the ragdolls nobody sees.
+        /// @param visible True if the character is visible, which ragdolls are by default.
+        virtual void SetVisible([[maybe_unused]] bool visible) {}
     };
 }
@@ -418,6 +418,14 @@ namespace Physics
         m_samples = samples;
     }
 
+    void HeightfieldShapeConfiguration::ModifySample(int32_t column, int32_t row, const Physics::HeightMaterialPoint& sample)
+    {
+        AZ_Assert(column >= 0 && column < m_numColumns && row >= 0 && row < m_numRows,
+            "Heightfield sample (%d, %d) is outside of the %dx%d grid", column, row, m_numColumns, m_numRows);
+        AZ_Assert(m_samples.size() == m_numColumns * m_numRows, "Heightfield samples don't match the grid size");
+        m_samples[(row * m_numColumns) + column] = sample;
+    }
+
     float HeightfieldShapeConfiguration::GetMinHeightBounds() const
     {
         return m_minHeightBounds;
@@ -229,6 +229,8 @@ namespace Physics
         void SetNumRows(int32_t numRows);
         const AZStd::vector<Physics::HeightMaterialPoint>& GetSamples() const;
         void SetSamples(const AZStd::vector<Physics::HeightMaterialPoint>& samples);
+        //! Replaces a single sample of the grid, without reallocating the samples.
+        void ModifySample(int32_t column, int32_t row, const Physics::HeightMaterialPoint& sample);
         float GetMinHeightBounds() const;
         void SetMinHeightBounds(float minBounds);
         float GetMaxHeightBounds() const;
@@ -0,0 +1,528 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Replay/FrameReplaySystemComponent.h>
+
+#include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Input/Buses/Requests/InputChannelRequestBus.h>
+#include <AzFramework/Input/Channels/InputChannel.h>
+#include <AzFramework/Input/Devices/InputDevice.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(bool, replay_quitOnEnd, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Exits the application once a replay started by ReplayPlay ended and its report got written.");
+    AZ_CVAR(uint32_t, replay_warmupFrames, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of replayed frames left out of the frame time report, to leave out the frames still streaming assets in.");
+
+    namespace
+    {
+        constexpr uint32_t RecordingMagic = 0x5246334F; // "O3FR"
+        constexpr uint32_t RecordingVersion = 1;
+
+        // The GPU pass profiler writes its trace on the next rendered frame, so the exit waits a few ticks for it
+        constexpr uint32_t QuitDelayFrames = 3;
+
+        uint64_t GetChannelKey(uint32_t channelIndex, uint32_t deviceIndex)
+        {
+            return (static_cast<uint64_t>(channelIndex) << 32) | deviceIndex;
+        }
+
+        // Minimal binary reader and writer over a byte buffer, the recordings are only read by the same engine version
+        template<typename T>
+        void Append(AZStd::vector<uint8_t>& buffer, const T& value)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        bool Extract(const AZStd::vector<uint8_t>& buffer, size_t& offset, T& value)
+        {
+            if (offset + sizeof(T) > buffer.size())
+            {
+                return false;
+            }
+            memcpy(&value, buffer.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+        float GetPercentile(const AZStd::vector<float>& sortedValues, float percentile)
+        {
+            const size_t index = static_cast<size_t>(percentile * static_cast<float>(sortedValues.size() - 1) + 0.5f);
+            return sortedValues[AZStd::min(index, sortedValues.size() - 1)];
+        }
+
+    } // namespace
+
+    void FrameReplaySystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<FrameReplaySystemComponent, AZ::Component>()
+                ->Version(0);
+        }
+    }
+
+    void FrameReplaySystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+    {
+        services.push_back(AZ_CRC_CE("FrameReplayService"));
+    }
+
+    void FrameReplaySystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+    {
+        services.push_back(AZ_CRC_CE("FrameReplayService"));
+    }
+
+    FrameReplaySystemComponent::FrameReplaySystemComponent()
+        : InputChannelEventListener(InputChannelEventListener::GetPriorityFirst(), false)
+    {
+    }
+
+    void FrameReplaySystemComponent::Activate()
+    {
+        InputChannelEventListener::Connect();
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void FrameReplaySystemComponent::Deactivate()
+    {
+        Stop();
+        AZ::TickBus::Handler::BusDisconnect();
+        InputChannelEventListener::Disconnect();
+    }
+
+    int FrameReplaySystemComponent::GetTickOrder()
+    {
+        // Before the input devices are ticked, so a frame holds the input events raised while it is ticked
+        return AZ::ComponentTickBus::TICK_FIRST;
+    }
+
+    bool FrameReplaySystemComponent::IsRecording() const
+    {
+        return m_mode == Mode::Recording;
+    }
+
+    bool FrameReplaySystemComponent::IsReplaying() const
+    {
+        return m_mode == Mode::Replaying;
+    }
+
+    bool FrameReplaySystemComponent::StartRecording(const char* filePath)
+    {
+        if (m_mode != Mode::Idle)
+        {
+            AZ_Warning("FrameReplay", false, "Stop the recording or the replay in progress before starting a new recording");
+            return false;
+        }
+
+        m_filePath = filePath;
+        m_channels.clear();
+        m_channelIndices.clear();
+        m_events.clear();
+        m_frames.clear();
+        m_mode = Mode::Recording;
+        AZ_Printf("FrameReplay", "Recording to %s\n", filePath);
+        return true;
+    }
+
+    void FrameReplaySystemComponent::Stop()
+    {
+        if (m_mode == Mode::Recording)
+        {
+            m_mode = Mode::Idle;
+            if (WriteRecording(m_filePath.c_str()))
+            {
+                AZ_Printf("FrameReplay", "Wrote %zu frames and %zu input events to %s\n", m_frames.size(), m_events.size(), m_filePath.c_str());
+            }
+        }
+        else if (m_mode == Mode::Replaying)
+        {
+            EndReplay();
+        }
+    }
+
+    bool FrameReplaySystemComponent::StartReplay(const char* filePath)
+    {
+        if (m_mode != Mode::Idle)
+        {
+            AZ_Warning("FrameReplay", false, "Stop the recording or the replay in progress before starting a replay");
+            return false;
+        }
+
+        if (!ReadRecording(filePath))
+        {
+            return false;
+        }
+
+        AZ::ITime* time = AZ::Interface<AZ::ITime>::Get();
+        if (!time)
+        {
+            AZ_Warning("FrameReplay", false, "Replaying requires the time system");
+            return false;
+        }
+
+        m_filePath = filePath;
+        m_nextFrame = 0;
+        m_frameTimesMs.clear();
+        m_frameTimesMs.reserve(m_frames.size());
+        m_endedChannels.clear();
+        m_endingChannels.clear();
+        m_previousDeltaOverride = time->GetSimulationTickDeltaOverride();
+        m_mode = Mode::Replaying;
+        SetNextDeltaTime();
+
+        if (auto profiler = AZ::Debug::ProfilerSystemInterface::Get())
+        {
+            profiler->StartCapture(AZStd::string::format("%s.cpu.json", filePath));
+        }
+
+        if (auto console = AZ::Interface<AZ::IConsole>::Get())
+        {
+            // The GPU pass profiler keeps the whole replay in its window, so its trace covers all the replayed frames
+            console->PerformCommand(AZStd::string::format("r_gpuPassProfilerWindowSize %zu", m_frames.size()).c_str(), AZ::ConsoleSilentMode::Silent);
+            console->PerformCommand("r_gpuPassProfiler true", AZ::ConsoleSilentMode::Silent);
+        }
+
+        AZ_Printf("FrameReplay", "Replaying %zu frames from %s\n", m_frames.size(), filePath);
+        return true;
+    }
+
+    void FrameReplaySystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_quitCountdown > 0 && --m_quitCountdown == 0)
+        {
+            ApplicationRequests::Bus::Broadcast(&ApplicationRequests::ExitMainLoop);
+        }
+
+        if (m_mode == Mode::Recording)
+        {
+            RecordedFrame& frame = m_frames.emplace_back();
+            frame.m_deltaTimeUs = static_cast<int64_t>(AZ::GetSimulationTickDeltaTimeUs());
+            frame.m_firstEvent = static_cast<uint32_t>(m_events.size());
+        }
+        else if (m_mode == Mode::Replaying)
+        {
+            // The real time of the previous tick, which was the previous replayed frame
+            if (m_nextFrame > 0)
+            {
+                m_frameTimesMs.push_back(AZ::TimeUsToSeconds(AZ::Interface<AZ::ITime>::Get()->GetRealTickDeltaTimeUs()) * 1000.0f);
+            }
+
+            ReplayFrame(m_frames[m_nextFrame]);
+            if (++m_nextFrame == m_frames.size())
+            {
+                EndReplay();
+            }
+            else
+            {
+                SetNextDeltaTime();
+            }
+        }
+    }
+
+    bool FrameReplaySystemComponent::OnInputChannelEventFiltered(const InputChannel& inputChannel)
+    {
+        if (m_mode != Mode::Recording || m_frames.empty())
+        {
+            return false;
+        }
+
+        const InputChannelId& channelId = inputChannel.GetInputChannelId();
+        auto channelIndexIter = m_channelIndices.find(channelId);
+        if (channelIndexIter == m_channelIndices.end())
+        {
+            channelIndexIter = m_channelIndices.emplace(channelId, static_cast<uint32_t>(m_channels.size())).first;
+            m_channels.push_back(channelId);
+        }
+
+        RecordedEvent& event = m_events.emplace_back();
+        event.m_channelIndex = channelIndexIter->second;
+        event.m_deviceIndex = inputChannel.GetInputDevice().GetInputDeviceId().GetIndex();
+        event.m_value = inputChannel.GetValue();
+        if (const auto* positionData = inputChannel.GetCustomData<InputChannel::PositionData2D>())
+        {
+            event.m_hasPosition = true;
+            event.m_positionX = positionData->m_normalizedPosition.GetX();
+            event.m_positionY = positionData->m_normalizedPosition.GetY();
+        }
+        m_frames.back().m_eventCount++;
+
+        // Recording never consumes the events
+        return false;
+    }
+
+    void FrameReplaySystemComponent::ReplayFrame(const RecordedFrame& frame)
+    {
+        AZStd::swap(m_endedChannels, m_endingChannels);
+        m_endingChannels.clear();
+
+        for (uint32_t eventIndex = frame.m_firstEvent; eventIndex < frame.m_firstEvent + frame.m_eventCount; ++eventIndex)
+        {
+            const RecordedEvent& event = m_events[eventIndex];
+            const InputChannelRequests::BusIdType requestId(m_channels[event.m_channelIndex], event.m_deviceIndex);
+            if (event.m_hasPosition)
+            {
+                InputChannelRequestBus::Event(requestId, &InputChannelRequests::SimulateRawInputWithPosition2D,
+                    event.m_value, event.m_positionX, event.m_positionY);
+            }
+            else
+            {
+                InputChannelRequestBus::Event(requestId, &InputChannelRequests::SimulateRawInput, event.m_value);
+            }
+
+            const uint64_t channelKey = GetChannelKey(event.m_channelIndex, event.m_deviceIndex);
+            m_endedChannels.erase(channelKey);
+            if (event.m_value == 0.0f)
+            {
+                m_endingChannels.insert(channelKey);
+            }
+            else
+            {
+                m_endingChannels.erase(channelKey);
+            }
+        }
+
+        // The channels that ended on the previous frame without a new event return to idle, like the input devices do
+        for (uint64_t channelKey : m_endedChannels)
+        {
+            const InputChannelRequests::BusIdType requestId(m_channels[channelKey >> 32], static_cast<uint32_t>(channelKey));
+            InputChannelRequestBus::Event(requestId, &InputChannelRequests::SimulateRawInput, 0.0f);
+        }
+        m_endedChannels.clear();
+    }
+
+    void FrameReplaySystemComponent::SetNextDeltaTime()
+    {
+        // The tick delta override has a millisecond resolution, every replay of a recording uses the same rounded deltas
+        const int64_t deltaTimeUs = m_frames[m_nextFrame].m_deltaTimeUs;
+        const AZ::TimeMs deltaTimeMs = static_cast<AZ::TimeMs>(AZStd::max<int64_t>((deltaTimeUs + 500) / 1000, 1));
+        AZ::Interface<AZ::ITime>::Get()->SetSimulationTickDeltaOverride(deltaTimeMs);
+    }
+
+    void FrameReplaySystemComponent::EndReplay()
+    {
+        m_mode = Mode::Idle;
+        if (AZ::ITime* time = AZ::Interface<AZ::ITime>::Get())
+        {
+            time->SetSimulationTickDeltaOverride(m_previousDeltaOverride);
+        }
+
+        if (auto profiler = AZ::Debug::ProfilerSystemInterface::Get(); profiler && profiler->IsCaptureInProgress())
+        {
+            profiler->EndCapture();
+        }
+
+        if (auto console = AZ::Interface<AZ::IConsole>::Get())
+        {
+            console->PerformCommand(AZStd::string::format("r_gpuPassProfilerWriteTrace %s.gpu", m_filePath.c_str()).c_str(), AZ::ConsoleSilentMode::Silent);
+        }
+
+        const AZStd::string reportPath = AZStd::string::format("%s.report.json", m_filePath.c_str());
+        if (WriteReport(reportPath.c_str()))
+        {
+            AZ_Printf("FrameReplay", "Replayed %u of %zu frames, wrote the report to %s\n", m_nextFrame, m_frames.size(), reportPath.c_str());
+        }
+
+        if (replay_quitOnEnd)
+        {
+            m_quitCountdown = QuitDelayFrames;
+        }
+    }
+
+    bool FrameReplaySystemComponent::WriteRecording(const char* filePath) const
+    {
+        AZStd::vector<uint8_t> buffer;
+        Append(buffer, RecordingMagic);
+        Append(buffer, RecordingVersion);
+
+        Append(buffer, static_cast<uint32_t>(m_channels.size()));
+        for (const InputChannelId& channelId : m_channels)
+        {
+            const size_t nameLength = strlen(channelId.GetName());
+            Append(buffer, static_cast<uint32_t>(nameLength));
+            buffer.insert(buffer.end(), channelId.GetName(), channelId.GetName() + nameLength);
+        }
+
+        Append(buffer, static_cast<uint32_t>(m_events.size()));
+        for (const RecordedEvent& event : m_events)
+        {
+            Append(buffer, event.m_channelIndex);
+            Append(buffer, event.m_deviceIndex);
+            Append(buffer, event.m_value);
+            Append(buffer, static_cast<uint8_t>(event.m_hasPosition));
+            Append(buffer, event.m_positionX);
+            Append(buffer, event.m_positionY);
+        }
+
+        Append(buffer, static_cast<uint32_t>(m_frames.size()));
+        for (const RecordedFrame& frame : m_frames)
+        {
+            Append(buffer, frame.m_deltaTimeUs);
+            Append(buffer, frame.m_eventCount);
+        }
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("FrameReplay", false, "Failed to open the recording file '%s'", filePath);
+            return false;
+        }
+        const bool written = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        file.Close();
+        return written;
+    }
+
+    bool FrameReplaySystemComponent::ReadRecording(const char* filePath)
+    {
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Warning("FrameReplay", false, "Failed to open the recording file '%s'", filePath);
+            return false;
+        }
+        AZStd::vector<uint8_t> buffer(file.Length());
+        const bool read = file.Read(buffer.size(), buffer.data()) == buffer.size();
+        file.Close();
+
+        m_channels.clear();
+        m_channelIndices.clear();
+        m_events.clear();
+        m_frames.clear();
+
+        size_t offset = 0;
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        if (!read || !Extract(buffer, offset, magic) || !Extract(buffer, offset, version) || magic != RecordingMagic || version != RecordingVersion)
+        {
+            AZ_Warning("FrameReplay", false, "'%s' isn't a recording of this engine version", filePath);
+            return false;
+        }
+
+        bool valid = true;
+        uint32_t channelCount = 0;
+        valid = valid && Extract(buffer, offset, channelCount);
+        for (uint32_t channelIndex = 0; valid && channelIndex < channelCount; ++channelIndex)
+        {
+            uint32_t nameLength = 0;
+            valid = Extract(buffer, offset, nameLength) && offset + nameLength <= buffer.size();
+            if (valid)
+            {
+                m_channels.emplace_back(AZStd::string_view(reinterpret_cast<const char*>(buffer.data() + offset), nameLength));
+                offset += nameLength;
+            }
+        }
+
+        uint32_t eventCount = 0;
+        valid = valid && Extract(buffer, offset, eventCount);
+        for (uint32_t eventIndex = 0; valid && eventIndex < eventCount; ++eventIndex)
+        {
+            RecordedEvent& event = m_events.emplace_back();
+            uint8_t hasPosition = 0;
+            valid = Extract(buffer, offset, event.m_channelIndex) && Extract(buffer, offset, event.m_deviceIndex) &&
+                Extract(buffer, offset, event.m_value) && Extract(buffer, offset, hasPosition) &&
+                Extract(buffer, offset, event.m_positionX) && Extract(buffer, offset, event.m_positionY) &&
+                event.m_channelIndex < m_channels.size();
+            event.m_hasPosition = hasPosition != 0;
+        }
+
+        uint32_t frameCount = 0;
+        uint32_t firstEvent = 0;
+        valid = valid && Extract(buffer, offset, frameCount);
+        for (uint32_t frameIndex = 0; valid && frameIndex < frameCount; ++frameIndex)
+        {
+            RecordedFrame& frame = m_frames.emplace_back();
+            valid = Extract(buffer, offset, frame.m_deltaTimeUs) && Extract(buffer, offset, frame.m_eventCount) &&
+                firstEvent + frame.m_eventCount <= m_events.size();
+            frame.m_firstEvent = firstEvent;
+            firstEvent += frame.m_eventCount;
+        }
+
+        if (!valid || m_frames.empty())
+        {
+            AZ_Warning("FrameReplay", false, "The recording '%s' is truncated or empty", filePath);
+            m_frames.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool FrameReplaySystemComponent::WriteReport(const char* filePath) const
+    {
+        const size_t warmupFrames = AZStd::min<size_t>(replay_warmupFrames, m_frameTimesMs.size());
+        AZStd::vector<float> frameTimesMs(m_frameTimesMs.begin() + warmupFrames, m_frameTimesMs.end());
+        if (frameTimesMs.empty())
+        {
+            AZ_Warning("FrameReplay", false, "No frame got measured, the report isn't written");
+            return false;
+        }
+
+        uint32_t histogram[HistogramBinCount] = {};
+        double totalMs = 0.0;
+        for (float frameTimeMs : frameTimesMs)
+        {
+            histogram[AZStd::min(static_cast<uint32_t>(frameTimeMs / HistogramBinMs), HistogramBinCount - 1)]++;
+            totalMs += frameTimeMs;
+        }
+        AZStd::sort(frameTimesMs.begin(), frameTimesMs.end());
+
+        AZStd::string report = AZStd::string::format(
+            "{\n    \"recording\": \"%s\",\n    \"frameCount\": %zu,\n    \"warmupFrames\": %zu,\n"
+            "    \"frameTimeMs\": {\"average\": %.3f, \"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f},\n"
+            "    \"histogramBinMs\": %.1f,\n    \"histogram\": [",
+            m_filePath.c_str(), frameTimesMs.size(), warmupFrames,
+            totalMs / static_cast<double>(frameTimesMs.size()), frameTimesMs.front(), GetPercentile(frameTimesMs, 0.5f),
+            GetPercentile(frameTimesMs, 0.9f), GetPercentile(frameTimesMs, 0.99f), frameTimesMs.back(), HistogramBinMs);
+        for (uint32_t bin = 0; bin < HistogramBinCount; ++bin)
+        {
+            report += AZStd::string::format(bin == 0 ? "%u" : ", %u", histogram[bin]);
+        }
+        report += "]\n}\n";
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("FrameReplay", false, "Failed to open the report file '%s'", filePath);
+            return false;
+        }
+        const bool written = file.Write(report.data(), report.size()) == report.size();
+        file.Close();
+        return written;
+    }
+
+    void FrameReplaySystemComponent::ReplayRecord(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("FrameReplay", false, "ReplayRecord expects the path of the recording file to write");
+            return;
+        }
+        StartRecording(AZStd::string(arguments.front()).c_str());
+    }
+
+    void FrameReplaySystemComponent::ReplayStop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        Stop();
+    }
+
+    void FrameReplaySystemComponent::ReplayPlay(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("FrameReplay", false, "ReplayPlay expects the path of the recording file to replay");
+            return;
+        }
+        StartReplay(AZStd::string(arguments.front()).c_str());
+    }
+} // namespace AzFramework
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/Time/ITime.h>
+#include <AzFramework/Input/Channels/InputChannelId.h>
+#include <AzFramework/Input/Events/InputChannelEventListener.h>
+
+namespace AzFramework
+{
+    //! Records the simulation tick delta times and the input events of a session, and replays them with the same timing,
+    //! so that two builds can be profiled running the exact same workload.
+    //! While replaying, the delta time of every tick is forced to the recorded one through AZ::ITime, the recorded input
+    //! events are simulated on their channels, and a cpu profiler capture and the GPU pass profiler run for the whole replay.
+    //! At the end a report with the frame time percentiles and histogram is written next to the recording.
+    //!
+    //! Usage, typically from the launcher command line after the level got loaded:
+    //!     ReplayRecord <file>     Starts recording, ReplayStop writes the recording to the file.
+    //!     ReplayPlay <file>       Replays a recording and writes <file>.report.json, <file>.cpu.json and <file>.gpu.json.
+    //! Set replay_quitOnEnd to exit the application once the replay ended, for automated comparisons.
+    class FrameReplaySystemComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public InputChannelEventListener
+    {
+    public:
+        AZ_COMPONENT(FrameReplaySystemComponent, "{5B0F4A36-8F3E-4B6C-9C55-2E7A1B8D3C41}");
+
+        //! Width in milliseconds of the bins of the frame time histogram, the last bin holds all the slower frames.
+        static constexpr float HistogramBinMs = 1.0f;
+        static constexpr uint32_t HistogramBinCount = 100;
+
+        FrameReplaySystemComponent();
+        ~FrameReplaySystemComponent() override = default;
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
+
+        //! Starts recording to the file, which is written when the recording stops.
+        bool StartRecording(const char* filePath);
+        //! Stops the recording or the replay in progress.
+        void Stop();
+        //! Loads a recording and replays it from the next tick.
+        bool StartReplay(const char* filePath);
+
+        bool IsRecording() const;
+        bool IsReplaying() const;
+
+    protected:
+        // AZ::Component
+        void Activate() override;
+        void Deactivate() override;
+
+        // AZ::TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        // InputChannelEventListener
+        bool OnInputChannelEventFiltered(const InputChannel& inputChannel) override;
+
+    private:
+        struct RecordedEvent
+        {
+            uint32_t m_channelIndex = 0; //!< Index in m_channels
+            uint32_t m_deviceIndex = 0;
+            float m_value = 0.0f;
+            float m_positionX = 0.0f;
+            float m_positionY = 0.0f;
+            bool m_hasPosition = false;
+        };
+
+        struct RecordedFrame
+        {
+            int64_t m_deltaTimeUs = 0;
+            uint32_t m_firstEvent = 0; //!< Index in m_events of the first event of the frame
+            uint32_t m_eventCount = 0;
+        };
+
+        enum class Mode
+        {
+            Idle,
+            Recording,
+            Replaying
+        };
+
+        bool WriteRecording(const char* filePath) const;
+        bool ReadRecording(const char* filePath);
+        void ReplayFrame(const RecordedFrame& frame);
+        void SetNextDeltaTime();
+        void EndReplay();
+        bool WriteReport(const char* filePath) const;
+
+        void ReplayRecord(const AZ::ConsoleCommandContainer& arguments);
+        void ReplayStop(const AZ::ConsoleCommandContainer& arguments);
+        void ReplayPlay(const AZ::ConsoleCommandContainer& arguments);
+
+        AZ_CONSOLEFUNC(FrameReplaySystemComponent, ReplayRecord, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Records the tick delta times and the input events until ReplayStop: ReplayRecord <file>");
+        AZ_CONSOLEFUNC(FrameReplaySystemComponent, ReplayStop, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Stops the recording or the replay in progress");
+        AZ_CONSOLEFUNC(FrameReplaySystemComponent, ReplayPlay, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Replays a recording while profiling it, and writes the performance report next to it: ReplayPlay <file>");
+
+        Mode m_mode = Mode::Idle;
+        AZStd::string m_filePath;
+
+        AZStd::vector<InputChannelId> m_channels;
+        AZStd::unordered_map<InputChannelId, uint32_t> m_channelIndices;
+        AZStd::vector<RecordedEvent> m_events;
+        AZStd::vector<RecordedFrame> m_frames;
+
+        // Replay state
+        uint32_t m_nextFrame = 0;
+        AZ::TimeMs m_previousDeltaOverride = AZ::TimeMs{ 0 };
+        AZStd::vector<float> m_frameTimesMs;
+        // Channels that ended on the previous replayed frame, which the input devices would return to idle on the next one
+        AZStd::unordered_set<uint64_t> m_endedChannels;
+        AZStd::unordered_set<uint64_t> m_endingChannels;
+        uint32_t m_quitCountdown = 0;
+    };
+} // namespace AzFramework
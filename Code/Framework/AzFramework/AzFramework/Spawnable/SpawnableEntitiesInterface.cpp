@@ -366,6 +366,11 @@ namespace AzFramework
         return m_payload != nullptr;
     }
 
+    float EntitySpawnTicket::GetSpawnProgress() const
+    {
+        return IsValid() ? m_interface->GetSpawnProgressOnTicket(m_payload) : 1.0f;
+    }
+
     EntitySpawnTicket SpawnableEntitiesDefinition::InternalToExternalTicket(void* internalTicket, SpawnableEntitiesDefinition* owner)
     {
         EntitySpawnTicket result;
@@ -15,6 +15,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/functional.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
@@ -187,6 +188,9 @@ namespace AzFramework
         const AZ::Data::Asset<Spawnable>* GetSpawnable() const;
         //! Returns whether or not the ticket is in a usable state.
         bool IsValid() const;
+        //! Returns the progress of the spawn call that's currently being executed on the ticket in the range 0 to 1. Cloning entities
+        //! and adding them to the game each account for half of the progress. Returns 1 if no spawn call is in progress.
+        float GetSpawnProgress() const;
 
     private:
         void* m_payload{ nullptr };
@@ -216,6 +220,13 @@ namespace AzFramework
         AZ::SerializeContext* m_serializeContext { nullptr };
         //! The priority at which this call will be executed.
         SpawnablePriority m_priority { SpawnablePriority_Default };
+        //! The maximum amount of time spent on this call every time the queue is processed, which typically happens once per frame.
+        //!     When the budget runs out the remaining entities are cloned and added to the game in the following frames. Entities are
+        //!     added in the order they're stored in the spawnable, so parents are activated before their children. The completion
+        //!     callback is called once all entities have been added. If the budget is zero the default budget from the Settings
+        //!     Registry key "/O3DE/AzFramework/Spawnables/SpawnTimeBudgetUs" is used and if that's not set, all entities are spawned
+        //!     at once. Use EntitySpawnTicket::GetSpawnProgress to track the progress.
+        AZStd::chrono::microseconds m_timeBudget{ 0 };
     };
 
     struct SpawnEntitiesOptionalArgs final
@@ -419,6 +430,7 @@ namespace AzFramework
         virtual void DecrementTicketReference(void* ticket) = 0;
         [[nodiscard]] virtual EntitySpawnTicket::Id GetTicketId(void* ticket) = 0;
         [[nodiscard]] virtual const AZ::Data::Asset<Spawnable>& GetSpawnableOnTicket(void* ticket) = 0;
+        [[nodiscard]] virtual float GetSpawnProgressOnTicket(void* ticket) = 0;
 
         static EntitySpawnTicket InternalToExternalTicket(void* internalTicket, SpawnableEntitiesDefinition* owner);
         
@@ -43,6 +43,16 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 timeBudget = 0;
+            if (settingsRegistry->Get(timeBudget, "/O3DE/AzFramework/Spawnables/SpawnTimeBudgetUs"))
+            {
+                m_defaultSpawnTimeBudget = AZStd::chrono::microseconds(timeBudget);
+            }
+
+            AZ::u64 activationBatchSize = m_activationBatchSize;
+            settingsRegistry->Get(activationBatchSize, "/O3DE/AzFramework/Spawnables/ActivationBatchSize");
+            m_activationBatchSize = aznumeric_cast<size_t>(AZStd::max(activationBatchSize, 1llu));
         }
     }
 
@@ -61,6 +71,13 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_timeBudget =
+            optionalArgs.m_timeBudget.count() == 0 ? m_defaultSpawnTimeBudget : optionalArgs.m_timeBudget;
+        queueEntry.m_spawnedEntitiesInitialCount = 0;
+        queueEntry.m_nextEntityToInsert = 0;
+        queueEntry.m_nextEntityIndex = 0;
+        queueEntry.m_nextAliasIndex = 0;
+        queueEntry.m_stage = SpawnAllEntitiesCommand::Stage::NotStarted;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -341,6 +358,11 @@ namespace AzFramework
         return reinterpret_cast<Ticket*>(ticket)->m_spawnable;
     }
 
+    float SpawnableEntitiesManager::GetSpawnProgressOnTicket(void* ticket)
+    {
+        return reinterpret_cast<Ticket*>(ticket)->m_spawnProgress;
+    }
+
     AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
         EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
     {
@@ -451,47 +473,48 @@ namespace AzFramework
             if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
                 aliases.IsValid() && aliases.AreAllSpawnablesReady())
             {
+                // Without a time budget all entities are spawned in one go, otherwise spawning continues in the next call
+                // once the budget has been used up. At least one entity is processed per call so spawning always progresses.
+                using Clock = AZStd::chrono::system_clock;
+                const bool isTimeBudgeted = request.m_timeBudget.count() > 0;
+                const Clock::time_point deadline = isTimeBudgeted ? Clock::now() + request.m_timeBudget : Clock::time_point{};
+
                 AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
                 AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
 
-                // Keep track how many entities there were in the array initially
-                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
-
                 // These are 'prototype' entities we'll be cloning from
                 const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
                 uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
 
-                // Reserve buffers
-                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+                if (request.m_stage == SpawnAllEntitiesCommand::Stage::NotStarted)
+                {
+                    // Keep track how many entities there were in the array initially
+                    request.m_spawnedEntitiesInitialCount = spawnedEntities.size();
 
-                // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // Reserve buffers
+                    spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
+                    spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-                auto aliasIt = aliases.begin();
-                auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
-                {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
+                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                    // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity
+                    // reference in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated
+                    // batch, regardless of spawn order.  If we didn't clear out the map, it would be possible for some entities here
+                    // to have references to previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                        spawnedEntityIndices.push_back(i);
-                    }
+                    request.m_stage = SpawnAllEntitiesCommand::Stage::Cloning;
+                    ticket.m_spawnProgress = 0.0f;
                 }
-                else
+
+                if (request.m_stage == SpawnAllEntitiesCommand::Stage::Cloning)
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    auto aliasIt = aliases.begin() + request.m_nextAliasIndex;
+                    auto aliasEnd = aliases.end();
+                    while (request.m_nextEntityIndex < entitiesToSpawnSize)
                     {
+                        uint32_t i = request.m_nextEntityIndex++;
+
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(
                             entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
@@ -521,35 +544,68 @@ namespace AzFramework
                                 ++aliasIt;
                             } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
                         }
+
+                        if (isTimeBudgeted && request.m_nextEntityIndex < entitiesToSpawnSize && Clock::now() >= deadline)
+                        {
+                            request.m_nextAliasIndex = aznumeric_caster(AZStd::distance(aliases.begin(), aliasIt));
+                            ticket.m_spawnProgress = 0.5f * request.m_nextEntityIndex / entitiesToSpawnSize;
+                            return CommandResult::Requeue;
+                        }
                     }
-                }
 
-                // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
-                // a new set are not added so it no longer holds exactly the number of entities.
-                ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
+                    // There were no initial entities then the ticket now holds exactly all entities. If there were already entities
+                    // then a new set are not added so it no longer holds exactly the number of entities.
+                    ticket.m_loadAll = request.m_spawnedEntitiesInitialCount == 0;
 
-                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
-                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
-                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-                if (request.m_preInsertionCallback)
-                {
-                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+                    if (request.m_preInsertionCallback)
+                    {
+                        request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(
+                            ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                    }
+
+                    request.m_nextEntityToInsert = request.m_spawnedEntitiesInitialCount;
+                    request.m_stage = SpawnAllEntitiesCommand::Stage::Inserting;
+                    ticket.m_spawnProgress = 0.5f;
+
+                    if (isTimeBudgeted && Clock::now() >= deadline)
+                    {
+                        return CommandResult::Requeue;
+                    }
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
+                // Add to the game context, now the entities are active. Entities are stored in the spawnable with parents before
+                // their children, so adding them in order activates them in the order of the transform hierarchy. They're added in
+                // batches so the components that are safe to activate on any thread are activated in parallel.
+                const size_t spawnedEntitiesCount = ticket.m_spawnedEntities.size();
+                while (request.m_nextEntityToInsert < spawnedEntitiesCount)
                 {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    const size_t batchEnd = AZStd::min(spawnedEntitiesCount, request.m_nextEntityToInsert + m_activationBatchSize);
+                    AZStd::vector<AZ::Entity*> batch(
+                        ticket.m_spawnedEntities.begin() + request.m_nextEntityToInsert, ticket.m_spawnedEntities.begin() + batchEnd);
+                    for (AZ::Entity* clone : batch)
+                    {
+                        clone->SetEntitySpawnTicketId(request.m_ticketId);
+                    }
+                    request.m_nextEntityToInsert = batchEnd;
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntities, batch);
+
+                    if (isTimeBudgeted && request.m_nextEntityToInsert < spawnedEntitiesCount && Clock::now() >= deadline)
+                    {
+                        ticket.m_spawnProgress = 0.5f + 0.5f * (request.m_nextEntityToInsert - request.m_spawnedEntitiesInitialCount) /
+                            (spawnedEntitiesCount - request.m_spawnedEntitiesInitialCount);
+                        return CommandResult::Requeue;
+                    }
                 }
 
                 // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
                 if (request.m_completionCallback)
                 {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(
+                        ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
+                ticket.m_spawnProgress = 1.0f;
                 ticket.m_currentRequestId++;
                 return CommandResult::Executed;
             }
@@ -670,11 +726,18 @@ namespace AzFramework
                 }
 
                 // Add to the game context, now the entities are active
-                for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
+                for (auto batchBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
+                     batchBegin != ticket.m_spawnedEntities.end();)
                 {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
+                    auto batchEnd = batchBegin +
+                        AZStd::min(m_activationBatchSize, aznumeric_cast<size_t>(ticket.m_spawnedEntities.end() - batchBegin));
+                    AZStd::vector<AZ::Entity*> batch(batchBegin, batchEnd);
+                    for (AZ::Entity* clone : batch)
+                    {
+                        clone->SetEntitySpawnTicketId(request.m_ticketId);
+                    }
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntities, batch);
+                    batchBegin = batchEnd;
                 }
 
                 if (request.m_completionCallback)
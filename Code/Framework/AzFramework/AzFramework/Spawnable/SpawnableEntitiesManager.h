@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/variant.h>
@@ -123,17 +124,32 @@ namespace AzFramework
             uint32_t m_nextRequestId{ 0 }; //!< Next id to be handed out to command that's using this ticket..
             uint32_t m_currentRequestId { 0 }; //!< The id for the command that should be executed.
             uint32_t m_ticketId{ 0 }; //!< The unique id that identifies this ticket.
+            AZStd::atomic<float> m_spawnProgress{ 1.0f }; //!< Progress of the spawn call in flight, which can span multiple frames.
             bool m_loadAll{ true };
         };
 
         struct SpawnAllEntitiesCommand final
         {
+            enum class Stage : uint8_t
+            {
+                NotStarted,
+                Cloning,
+                Inserting
+            };
+
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
+            AZStd::chrono::microseconds m_timeBudget;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            // State to continue spawning in a later frame if the time budget ran out.
+            size_t m_spawnedEntitiesInitialCount; //!< Number of entities the ticket held before this call.
+            size_t m_nextEntityToInsert; //!< Index into the ticket's spawned entities of the next entity to add to the game.
+            uint32_t m_nextEntityIndex; //!< Index of the next prototype entity to clone.
+            uint32_t m_nextAliasIndex; //!< Index of the next entity alias to process.
+            Stage m_stage;
         };
         struct SpawnEntitiesCommand final
         {
@@ -261,6 +277,7 @@ namespace AzFramework
         void DecrementTicketReference(void* ticket) override;
         EntitySpawnTicket::Id GetTicketId(void* ticket) override;
         const AZ::Data::Asset<Spawnable>& GetSpawnableOnTicket(void* ticket) override;
+        float GetSpawnProgressOnTicket(void* ticket) override;
         
         CommandQueueStatus ProcessQueue(Queue& queue);
 
@@ -311,6 +328,13 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The time budget used for spawn calls that don't provide their own. Zero spawns all entities in a single call. This can be
+        //! configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/SpawnTimeBudgetUs".
+        AZStd::chrono::microseconds m_defaultSpawnTimeBudget{ 0 };
+        //! The number of spawned entities that are added to the game context together, so that their components can be activated in
+        //! parallel. The time budget is checked between batches. This can be configured through the Settings Registry under the key
+        //! "/O3DE/AzFramework/Spawnables/ActivationBatchSize".
+        size_t m_activationBatchSize{ 64 };
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
@@ -82,6 +82,12 @@ namespace UnitTest
         DrawPoints(vertices);
     }
 
+    void TestDebugDisplayRequests::DrawColoredTriangles(const AZStd::vector<AZ::Vector3>& vertices,
+        [[maybe_unused]] const AZStd::vector<AZ::Color>& colors)
+    {
+        DrawPoints(vertices);
+    }
+
     void TestDebugDisplayRequests::DrawLine(const AZ::Vector3& p1, const AZ::Vector3& p2)
     {
         DrawPoints({ p1, p2 });
@@ -98,6 +104,12 @@ namespace UnitTest
         DrawPoints(lines);
     }
 
+    void TestDebugDisplayRequests::DrawColoredLines(const AZStd::vector<AZ::Vector3>& lines,
+        [[maybe_unused]] const AZStd::vector<AZ::Color>& colors)
+    {
+        DrawPoints(lines);
+    }
+
     void TestDebugDisplayRequests::PushMatrix(const AZ::Transform& tm)
     {
         m_transforms.push(m_transforms.top() * tm);
@@ -42,9 +42,11 @@ namespace UnitTest
         void DrawQuad(float width, float height) override;
         void DrawTriangles(const AZStd::vector<AZ::Vector3>& vertices, const AZ::Color& color) override;
         void DrawTrianglesIndexed(const AZStd::vector<AZ::Vector3>& vertices, const AZStd::vector<AZ::u32>& indices, const AZ::Color& color) override;
+        void DrawColoredTriangles(const AZStd::vector<AZ::Vector3>& vertices, const AZStd::vector<AZ::Color>& colors) override;
         void DrawLine(const AZ::Vector3& p1, const AZ::Vector3& p2) override;
         void DrawLine(const AZ::Vector3& p1, const AZ::Vector3& p2, const AZ::Vector4& col1, const AZ::Vector4& col2) override;
         void DrawLines(const AZStd::vector<AZ::Vector3>& lines, const AZ::Color& color) override;
+        void DrawColoredLines(const AZStd::vector<AZ::Vector3>& lines, const AZStd::vector<AZ::Color>& colors) override;
         void PushMatrix(const AZ::Transform& tm) override;
         void PopMatrix() override;
     private:
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Viewport/ViewportDepthPicking.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector4.h>
+
+namespace AzFramework
+{
+    AZStd::optional<AZ::Vector3> ViewportDepthRegion::GetWorldPosition(const ScreenPoint& screenPoint, const ScreenSize& viewportSize) const
+    {
+        if (viewportSize.m_width <= 0 || viewportSize.m_height <= 0 || m_depthSize.m_width <= 0 || m_depthSize.m_height <= 0)
+        {
+            return AZStd::nullopt;
+        }
+
+        // the depth buffer may have a different resolution than the viewport
+        const float u = (aznumeric_cast<float>(screenPoint.m_x) + 0.5f) / viewportSize.Widthf();
+        const float v = (aznumeric_cast<float>(screenPoint.m_y) + 0.5f) / viewportSize.Heightf();
+        const int texelX = aznumeric_cast<int>(AZStd::floor(u * m_depthSize.Widthf())) - m_origin.m_x;
+        const int texelY = aznumeric_cast<int>(AZStd::floor(v * m_depthSize.Heightf())) - m_origin.m_y;
+        if (texelX < 0 || texelY < 0 || texelX >= m_size.m_width || texelY >= m_size.m_height ||
+            m_depths.size() < aznumeric_cast<size_t>(m_size.m_width * m_size.m_height))
+        {
+            return AZStd::nullopt;
+        }
+
+        const float depth = m_depths[texelY * m_size.m_width + texelX];
+        if (depth <= 0.0f)
+        {
+            return AZStd::nullopt;
+        }
+
+        // clip space has y up while the screen points have y down
+        const AZ::Vector4 worldPosition = m_clipToWorld * AZ::Vector4(u * 2.0f - 1.0f, 1.0f - v * 2.0f, depth, 1.0f);
+        if (AZ::IsClose(worldPosition.GetW(), 0.0f))
+        {
+            return AZStd::nullopt;
+        }
+
+        return worldPosition.GetAsVector3() / worldPosition.GetW();
+    }
+} // namespace AzFramework
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzFramework/Viewport/ScreenGeometry.h>
+#include <AzFramework/Viewport/ViewportId.h>
+
+namespace AzFramework
+{
+    //! A region of the depth buffer of a viewport, read back from the renderer.
+    struct ViewportDepthRegion
+    {
+        //! Returns the world position of the surface rendered at the screen point of the viewport, or nothing when the point is
+        //! outside of the region or nothing got rendered there.
+        AZStd::optional<AZ::Vector3> GetWorldPosition(const ScreenPoint& screenPoint, const ScreenSize& viewportSize) const;
+
+        //! Inverse of the world to clip transform of the view the depth got rendered with.
+        AZ::Matrix4x4 m_clipToWorld = AZ::Matrix4x4::CreateIdentity();
+        ScreenSize m_depthSize = ScreenSize(0, 0); //!< Size of the whole depth buffer, which covers the viewport.
+        ScreenPoint m_origin = ScreenPoint(0, 0); //!< Texel of the depth buffer of the first depth of the region.
+        ScreenSize m_size = ScreenSize(0, 0); //!< Size of the region in texels.
+        //! The depths of the region row by row. The depth is reversed, so 0 is the far plane where nothing got rendered.
+        AZStd::vector<float> m_depths;
+    };
+
+    //! Reads back the depth rendered around a point of a viewport, so that viewport picking knows the visible surface under
+    //! the cursor without intersecting the whole scene on the CPU. The readback is asynchronous, the region of a request
+    //! becomes available a few frames later and stays available until it is replaced by the one of the next request.
+    class ViewportDepthPickingInterface
+    {
+    public:
+        AZ_RTTI(ViewportDepthPickingInterface, "{A7D35B2E-64C1-4F0B-8E29-3C5F1D7B9A40}");
+
+        //! Side in texels of the square region read back around the requested point.
+        static constexpr int RegionSize = 32;
+
+        virtual ~ViewportDepthPickingInterface() = default;
+
+        //! Requests the depth around the screen point of the viewport to be read back, replacing a previous request that
+        //! wasn't started yet.
+        virtual void RequestDepthRegion(ViewportId viewportId, const ScreenPoint& screenPoint, const ScreenSize& viewportSize) = 0;
+
+        //! Gets the latest region read back for the viewport, returns false when none is available.
+        virtual bool GetDepthRegion(ViewportId viewportId, ViewportDepthRegion& region) const = 0;
+    };
+
+    using ViewportDepthPicking = AZ::Interface<ViewportDepthPickingInterface>;
+} // namespace AzFramework
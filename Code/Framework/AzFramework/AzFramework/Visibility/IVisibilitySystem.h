@@ -17,7 +17,9 @@
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/inplace_function.h>
 
 namespace AzFramework
 {
@@ -58,7 +60,15 @@ namespace AzFramework
             const AZ::Aabb m_bounds;
             const AZStd::vector<VisibilityEntry*>& m_entries;
         };
-        using EnumerateCallback = AZStd::function<void(const NodeData&)>;
+        //! The callbacks are stored inline so that the enumerations done every frame don't allocate,
+        //! they can capture up to AZStd::InplaceFunctionDefaultCapacity bytes.
+        using EnumerateCallback = AZStd::inplace_function<void(const NodeData&)>;
+
+        //! Callback for a shared enumeration of multiple frustums, the mask has a bit set for each frustum that overlaps the node.
+        using EnumerateFrustumsCallback = AZStd::inplace_function<void(const NodeData&, uint32_t frustumMask)>;
+
+        //! The maximum number of frustums that can be enumerated together in one call to EnumerateFrustums.
+        static constexpr size_t MaxSharedFrustums = 32;
 
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
@@ -94,6 +104,12 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects multiple frustums against the visibility system in a single traversal.
+        //! Each node is visited once and tested against every frustum that overlaps its parent node.
+        //! @param frustums the frustums to test against, at most MaxSharedFrustums
+        //! @param callback the callback to invoke when a node is visible to at least one of the frustums
+        virtual void EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const EnumerateFrustumsCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -16,6 +16,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeNodeLooseness,       1.0f, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "Scale applied to the node bounds used for entry placement and culling, values above 1 turn the visibility octrees into loose octrees so moving entries change nodes less often");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,14 +25,27 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    static AZ::Aabb GetLooseBounds(const AZ::Aabb& bounds)
+    {
+        const float looseness = AZ::GetMax(static_cast<float>(bg_octreeNodeLooseness), 1.0f);
+        if (looseness == 1.0f)
+        {
+            return bounds;
+        }
+        const AZ::Vector3 looseHalfExtent = bounds.GetExtents() * (0.5f * looseness);
+        return AZ::Aabb::CreateCenterHalfExtents(bounds.GetCenter(), looseHalfExtent);
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(GetLooseBounds(bounds))
     {
         ;
     }
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -46,6 +60,7 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -70,7 +85,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
+                if (AZ::ShapeIntersection::Contains(m_children[child].m_looseBounds, boundingVolume))
                 {
                     return m_children[child].Insert(octreeScene, entry);
                 }
@@ -98,7 +113,7 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
         const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume))
         {
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
@@ -114,7 +129,7 @@ namespace AzFramework
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
                 return insertCheck->Insert(octreeScene, entry);
@@ -147,7 +162,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
         {
             EnumerateHelper(aabb, callback);
         }
@@ -155,7 +170,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
         {
             EnumerateHelper(sphere, callback);
         }
@@ -163,18 +178,65 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
         {
             EnumerateHelper(frustum, callback);
         }
     }
 
+    void OctreeNode::EnumerateFrustums(
+        AZStd::span<const AZ::Frustum> frustums,
+        uint32_t frustumMask,
+        uint32_t containedMask,
+        const IVisibilityScene::EnumerateFrustumsCallback& callback) const
+    {
+        // Only the frustums that partially overlap the parent node need to be tested against this node
+        for (uint32_t frustumIndex = 0; frustumIndex < frustums.size(); ++frustumIndex)
+        {
+            const uint32_t frustumBit = 1u << frustumIndex;
+            if ((frustumMask & ~containedMask & frustumBit) == 0)
+            {
+                continue;
+            }
+
+            if (!AZ::ShapeIntersection::Overlaps(frustums[frustumIndex], m_looseBounds))
+            {
+                frustumMask &= ~frustumBit;
+            }
+            else if (AZ::ShapeIntersection::Contains(frustums[frustumIndex], m_looseBounds))
+            {
+                containedMask |= frustumBit;
+            }
+        }
+
+        if (frustumMask == 0)
+        {
+            return;
+        }
+
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({m_looseBounds, m_entries}, frustumMask);
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].EnumerateFrustums(frustums, frustumMask, containedMask, callback);
+            }
+        }
+    }
+
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -233,12 +295,12 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -247,7 +309,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -290,6 +352,7 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = GetLooseBounds(m_children[child].m_bounds);
                 m_children[child].m_parent = this;
             }
         }
@@ -390,6 +453,20 @@ namespace AzFramework
         m_root.Enumerate(frustum, callback);
     }
 
+    void OctreeScene::EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const IVisibilityScene::EnumerateFrustumsCallback& callback) const
+    {
+        AZ_Assert(frustums.size() <= IVisibilityScene::MaxSharedFrustums, "EnumerateFrustums supports at most %zu frustums", IVisibilityScene::MaxSharedFrustums);
+        const size_t frustumCount = AZStd::min(frustums.size(), IVisibilityScene::MaxSharedFrustums);
+        if (frustumCount == 0)
+        {
+            return;
+        }
+
+        const uint32_t frustumMask = (frustumCount == IVisibilityScene::MaxSharedFrustums) ? 0xFFFFFFFF : ((1u << frustumCount) - 1);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateFrustums(frustums.first(frustumCount), frustumMask, 0, callback);
+    }
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
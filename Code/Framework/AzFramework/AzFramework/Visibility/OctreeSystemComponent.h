@@ -23,6 +23,7 @@ namespace AzFramework
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! Containment and culling use the loose bounds of the node, which are scaled up from the node bounds by bg_octreeNodeLooseness.
     class OctreeNode
         : public VisibilityNode
     {
@@ -54,6 +55,15 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates any OctreeNodes and their children that intersect at least one of the provided frustums.
+        //! @param frustumMask the frustums that overlap the parent node
+        //! @param containedMask the frustums that fully contain the parent node, these are not tested again
+        void EnumerateFrustums(
+            AZStd::span<const AZ::Frustum> frustums,
+            uint32_t frustumMask,
+            uint32_t containedMask,
+            const IVisibilityScene::EnumerateFrustumsCallback& callback) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -81,6 +91,7 @@ namespace AzFramework
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        AZ::Aabb m_looseBounds; //< The bounds used for entry placement and culling, equal to m_bounds unless bg_octreeNodeLooseness is above 1
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
@@ -107,6 +118,7 @@ namespace AzFramework
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateFrustums(AZStd::span<const AZ::Frustum> frustums, const IVisibilityScene::EnumerateFrustumsCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -33,12 +33,14 @@ set(FILES
     Archive/ZipDirCacheFactory.cpp
     Archive/ZipDirFind.cpp
     Archive/ZipDirList.cpp
+    Archive/ZipDirMappedFile.cpp
     Archive/ZipDirStructures.cpp
     Archive/ZipDirTree.cpp
     Archive/ZipDirCache.h
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
     Archive/ZipDirList.h
+    Archive/ZipDirMappedFile.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
     Archive/ZipFileFormat.h
@@ -93,6 +95,8 @@ set(FILES
     Viewport/ViewportId.h
     Viewport/ViewportScreen.h
     Viewport/ViewportScreen.cpp
+    Viewport/ViewportDepthPicking.h
+    Viewport/ViewportDepthPicking.cpp
     Viewport/ScreenGeometry.h
     Viewport/ScreenGeometry.cpp
     Viewport/CameraState.h
@@ -127,6 +131,8 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformStorage.cpp
+    Components/TransformStorage.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -288,6 +294,8 @@ set(FILES
     Spawnable/SpawnableAssetBus.h
     Spawnable/SpawnableAssetHandler.h
     Spawnable/SpawnableAssetHandler.cpp
+    Replay/FrameReplaySystemComponent.h
+    Replay/FrameReplaySystemComponent.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+namespace AZ::IO::ZipDir
+{
+    bool MappedFile::Map(const char* nativePath)
+    {
+        int fileDescriptor = open(nativePath, O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        bool result = false;
+        struct stat fileStat;
+        if (fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            size_t size = static_cast<size_t>(fileStat.st_size);
+            void* address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+            if (address != MAP_FAILED)
+            {
+                m_data = reinterpret_cast<const AZStd::byte*>(address);
+                m_size = size;
+                result = true;
+            }
+        }
+
+        // The mapping holds its own reference to the file, so the descriptor isn't needed anymore.
+        close(fileDescriptor);
+        return result;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            munmap(const_cast<AZStd::byte*>(m_data), static_cast<size_t>(m_size));
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+namespace AZ::IO::ZipDir
+{
+    bool MappedFile::Map(const char* nativePath)
+    {
+        AZStd::wstring widePath;
+        AZStd::to_wstring(widePath, nativePath);
+        HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        bool result = false;
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (address != nullptr)
+                {
+                    m_data = reinterpret_cast<const AZStd::byte*>(address);
+                    m_size = static_cast<uint64_t>(fileSize.QuadPart);
+                    result = true;
+                }
+                // The view keeps the mapping and file alive, so the handles can be closed right away.
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+        return result;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+}
@@ -17,6 +17,7 @@
 #include <AzFramework/Archive/ArchiveFileIO.h>
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 
 namespace UnitTest
 {
@@ -462,4 +463,47 @@ namespace UnitTest
             std::tuple(AZ::IO::INestedArchive::FLAGS_READ_ONLY, AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_BEST, 1111, 10, 1),
             std::tuple(static_cast<AZ::IO::INestedArchive::EPakFlags>(0), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_BEST, 1111, 10, 1)
         ));
+
+    using ArchiveSeekableCompressionTests = ScopedAllocatorSetupFixture;
+
+    TEST_F(ArchiveSeekableCompressionTests, ZipRawCompressZSTDSeekable_PartialFrames_DecompressToMatchingData)
+    {
+        constexpr size_t frameSize = 4096;
+        constexpr size_t dataSize = frameSize * 3 + 1000;
+        AZStd::vector<uint8_t> data(dataSize);
+        for (size_t pos = 0; pos < dataSize; ++pos)
+        {
+            data[pos] = static_cast<uint8_t>((pos * 7) % 251);
+        }
+
+        size_t compressedSize = AZ::IO::ZipDir::ZipRawCompressZSTDSeekableBound(dataSize, frameSize);
+        AZStd::vector<uint8_t> compressed(compressedSize);
+        ASSERT_EQ(0, AZ::IO::ZipDir::ZipRawCompressZSTDSeekable(data.data(), &compressedSize, compressed.data(), dataSize, 1, frameSize));
+
+        // The frames and the seek table together still decompress as a single stream.
+        AZStd::vector<uint8_t> decompressed(dataSize);
+        size_t decompressedSize = dataSize;
+        ASSERT_EQ(0, AZ::IO::ZipDir::ZipRawUncompress(decompressed.data(), &decompressedSize, compressed.data(), compressedSize));
+        EXPECT_EQ(dataSize, decompressedSize);
+        EXPECT_EQ(data, decompressed);
+
+        const size_t seekTableSize =
+            AZ::IO::ZipDir::ZipGetZSTDSeekTableSize(compressed.data() + compressedSize - AZ::IO::ZipDir::ZstdSeekTableFooterSize);
+        ASSERT_NE(0, seekTableSize);
+        AZ::IO::CompressionFrames frames;
+        ASSERT_TRUE(AZ::IO::ZipDir::ZipReadZSTDSeekTable(
+            compressed.data() + compressedSize - seekTableSize, seekTableSize, compressedSize, dataSize, frames));
+        ASSERT_EQ(4, frames.size());
+        EXPECT_EQ(0, frames[0].m_compressedOffset);
+        EXPECT_EQ(0, frames[0].m_uncompressedOffset);
+        EXPECT_EQ(frameSize * 2, frames[2].m_uncompressedOffset);
+
+        // The second and third frames decompress on their own.
+        AZStd::vector<uint8_t> partial(frameSize * 2);
+        size_t partialSize = partial.size();
+        ASSERT_EQ(0, AZ::IO::ZipDir::ZipRawUncompress(partial.data(), &partialSize, compressed.data() + frames[1].m_compressedOffset,
+            frames[3].m_compressedOffset - frames[1].m_compressedOffset));
+        EXPECT_EQ(frameSize * 2, partialSize);
+        EXPECT_EQ(0, memcmp(partial.data(), data.data() + frameSize, partialSize));
+    }
 }
@@ -280,6 +280,104 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveMapFile_StoredFile_ProvidesViewOnArchiveData)
+    {
+        constexpr const char* storedFile = "levels\\mylevel\\stored.xml";
+        constexpr const char* compressedFile = "levels\\mylevel\\compressed.xml";
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* testArchivePath = "@usercache@/mapped.pak";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(storedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE, 0));
+        EXPECT_EQ(0, pArchive->UpdateFile(compressedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+        EXPECT_TRUE(IsPackValid(testArchivePath));
+
+        ASSERT_TRUE(archive->OpenPack("@products@", testArchivePath));
+
+        AZ::IO::MappedFileView view;
+        EXPECT_FALSE(archive->MapFile(compressedFile, view));
+        EXPECT_FALSE(view.IsValid());
+
+        ASSERT_TRUE(archive->MapFile(storedFile, view));
+        ASSERT_TRUE(view.IsValid());
+        ASSERT_EQ(dataString.size(), view.GetData().size());
+        EXPECT_EQ(0, memcmp(dataString.data(), view.GetData().data(), dataString.size()));
+
+        // The view keeps the mapping alive after the archive has been closed.
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        EXPECT_EQ(0, memcmp(dataString.data(), view.GetData().data(), dataString.size()));
+        view.Reset();
+
+        fileIo->Remove(testArchivePath);
+    }
+
+    TEST_F(ArchiveTestFixture, TestArchivePakIndex_IndexIsCreatedAndReused)
+    {
+        constexpr const char* fileInArchiveFile = "levels\\mylevel\\levelinfo.xml";
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        CVarIntValueScope oldPakIndex{ *console, "az_archive_pak_index" };
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("az_archive_pak_index", { "1" });
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::FileSearchPriority::PakOnly)) });
+
+        constexpr const char* testArchivePath = "@usercache@/indexed.pak";
+        constexpr const char* testIndexPath = "@usercache@/indexed.pak.index";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+        fileIo->Remove(testIndexPath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(fileInArchiveFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+        EXPECT_FALSE(fileIo->Exists(testIndexPath));
+
+        // The first time the pak is opened read-only the index is created.
+        ASSERT_TRUE(archive->OpenPack("@products@", testArchivePath));
+        EXPECT_TRUE(fileIo->Exists(testIndexPath));
+        AZ::u64 indexSize{};
+        EXPECT_TRUE(fileIo->Size(testIndexPath, indexSize));
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+
+        // The second time the data offsets come from the index, which needs to result in the same file data.
+        ASSERT_TRUE(archive->OpenPack("@products@", testArchivePath));
+        AZ::IO::HandleType fileHandle = archive->FOpen(fileInArchiveFile, "rb");
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+        char readBuffer[32]{};
+        EXPECT_EQ(dataString.size(), archive->FRead(readBuffer, dataString.size(), fileHandle));
+        EXPECT_EQ(dataString, AZStd::string_view(readBuffer, dataString.size()));
+        archive->FClose(fileHandle);
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+
+        AZ::u64 reusedIndexSize{};
+        EXPECT_TRUE(fileIo->Size(testIndexPath, reusedIndexSize));
+        EXPECT_EQ(indexSize, reusedIndexSize);
+
+        fileIo->Remove(testArchivePath);
+        fileIo->Remove(testIndexPath);
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
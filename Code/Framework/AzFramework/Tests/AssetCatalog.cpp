@@ -12,6 +12,7 @@
 #include <AzCore/Asset/AssetTypeInfoBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/Jobs/JobFunction.h>
@@ -27,6 +28,7 @@
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
+#include <AzFramework/Asset/AssetRegistry.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 #include <AzFramework/Application/Application.h>
@@ -840,6 +842,57 @@ namespace UnitTest
         CheckNoDependencies(asset1);
     }
 
+    using AssetRegistryPackedTest = AllocatorsFixture;
+
+    TEST_F(AssetRegistryPackedTest, SavePackedThenLoadPacked_RegistryRoundTrips)
+    {
+        using namespace AZ::Data;
+
+        AzFramework::AssetRegistry registry;
+        const AssetId firstAssetId(AZ::Uuid::CreateRandom(), 1);
+        const AssetId secondAssetId(AZ::Uuid::CreateRandom(), 2);
+        const AssetId legacyAssetId(AZ::Uuid::CreateRandom(), 3);
+
+        AssetInfo assetInfo;
+        assetInfo.m_assetId = firstAssetId;
+        assetInfo.m_assetType = AZ::Uuid::CreateRandom();
+        assetInfo.m_relativePath = "Foo/AssetA.txt";
+        assetInfo.m_sizeBytes = 1234;
+        registry.RegisterAsset(firstAssetId, assetInfo);
+        assetInfo.m_assetId = secondAssetId;
+        assetInfo.m_relativePath = "AssetB.txt";
+        registry.RegisterAsset(secondAssetId, assetInfo);
+        registry.RegisterLegacyAssetMapping(legacyAssetId, firstAssetId);
+        registry.RegisterAssetDependency(firstAssetId, ProductDependency(secondAssetId, AZStd::bitset<64>(5)));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        EXPECT_TRUE(registry.SavePacked(stream));
+        EXPECT_TRUE(AzFramework::AssetRegistry::IsPacked(buffer.data(), buffer.size()));
+
+        AzFramework::AssetRegistry loadedRegistry;
+        ASSERT_TRUE(loadedRegistry.LoadPacked(buffer.data(), buffer.size()));
+        ASSERT_EQ(loadedRegistry.m_assetIdToInfo.size(), 2);
+        const AssetInfo& loadedInfo = loadedRegistry.m_assetIdToInfo[firstAssetId];
+        EXPECT_EQ(loadedInfo.m_assetId, firstAssetId);
+        EXPECT_EQ(loadedInfo.m_assetType, assetInfo.m_assetType);
+        EXPECT_EQ(loadedInfo.m_relativePath, "Foo/AssetA.txt");
+        EXPECT_EQ(loadedInfo.m_sizeBytes, 1234);
+        EXPECT_EQ(loadedRegistry.GetAssetIdByPath("foo/asseta.txt"), firstAssetId);
+        EXPECT_EQ(loadedRegistry.GetAssetIdByLegacyAssetId(legacyAssetId), firstAssetId);
+
+        const AZStd::vector<ProductDependency> dependencies = loadedRegistry.GetAssetDependencies(firstAssetId);
+        ASSERT_EQ(dependencies.size(), 1);
+        EXPECT_EQ(dependencies[0].m_assetId, secondAssetId);
+        EXPECT_EQ(dependencies[0].m_flags.to_ullong(), 5);
+
+        // a truncated catalog leaves the registry empty
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(loadedRegistry.LoadPacked(buffer.data(), buffer.size() - 1));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_TRUE(loadedRegistry.m_assetIdToInfo.empty());
+    }
+
     class AssetCatalogAPITest
         : public AllocatorsFixture
     {
@@ -77,6 +77,7 @@ namespace AzFramework
         MOCK_METHOD1(DestroyTicket, void(void* ticket));
         MOCK_METHOD1(GetTicketId, EntitySpawnTicket::Id(void* ticket));
         MOCK_METHOD1(GetSpawnableOnTicket, const AZ::Data::Asset<Spawnable>&(void* ticket));
+        MOCK_METHOD1(GetSpawnProgressOnTicket, float(void* ticket));
 
         /** Installs some default result values for the above functions.
          *   Note that you can always override these in scope of your test by adding additional ON_CALL / EXPECT_CALL
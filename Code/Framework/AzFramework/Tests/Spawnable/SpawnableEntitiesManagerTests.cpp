@@ -629,6 +629,43 @@ namespace UnitTest
         ProcessQueueTillEmtpy();
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_WithTimeBudget_SpawnsAcrossMultipleCalls)
+    {
+        constexpr size_t NumEntities = 64;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceFirst);
+
+        size_t completionCount = 0;
+        auto callback = [this, &completionCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            completionCount++;
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceFirst, NumEntities, entities);
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        // Cloning a single entity takes longer than this, so only a single entity will be processed per call.
+        optionalArgs.m_timeBudget = AZStd::chrono::microseconds(1);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        size_t numCalls = 0;
+        float previousProgress = 0.0f;
+        while (m_ticket->GetSpawnProgress() < 1.0f || numCalls == 0)
+        {
+            ASSERT_LT(numCalls, 1000) << "Spawning didn't complete.";
+            m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+            numCalls++;
+
+            float progress = m_ticket->GetSpawnProgress();
+            EXPECT_GE(progress, previousProgress);
+            previousProgress = progress;
+            EXPECT_EQ(progress < 1.0f ? 0 : 1, completionCount);
+        }
+        ProcessQueueTillEmtpy();
+
+        EXPECT_GT(numCalls, 1);
+        EXPECT_EQ(1, completionCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllAliasesWithDisabled_NoEntitiesSpawned)
     {
         using namespace AzFramework;
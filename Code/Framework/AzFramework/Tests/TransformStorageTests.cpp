@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformStorage.h>
+
+namespace UnitTest
+{
+    using AzFramework::TransformStorage;
+
+    class TransformStorageTests
+        : public AllocatorsFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_storage = AZStd::make_unique<TransformStorage>();
+        }
+
+        void TearDown() override
+        {
+            m_storage.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        static AZ::Transform MakeTransform(float x, float angle, float scale)
+        {
+            return AZ::Transform(AZ::Vector3(x, 1.0f, 2.0f), AZ::Quaternion::CreateRotationZ(angle), scale);
+        }
+
+        static void ExpectTransformClose(const AZ::Transform& expected, const AZ::Transform& actual)
+        {
+            EXPECT_TRUE(expected.GetTranslation().IsClose(actual.GetTranslation()));
+            EXPECT_TRUE(expected.GetRotation().IsClose(actual.GetRotation()));
+            EXPECT_NEAR(expected.GetUniformScale(), actual.GetUniformScale(), AZ::Constants::Tolerance);
+        }
+
+        AZStd::unique_ptr<TransformStorage> m_storage;
+    };
+
+    TEST_F(TransformStorageTests, UpdateWorldTransforms_Hierarchy_ComposesParentWorldTransforms)
+    {
+        const AZ::EntityId rootId(1);
+        const AZ::EntityId childId(2);
+        const AZ::EntityId grandchildId(3);
+        const AZ::Transform rootTM = MakeTransform(1.0f, 0.5f, 2.0f);
+        const AZ::Transform childTM = MakeTransform(-3.0f, 1.0f, 0.5f);
+        const AZ::Transform grandchildTM = MakeTransform(4.0f, -0.25f, 3.0f);
+
+        // Children are added before their parents to exercise the ordering by depth
+        const TransformStorage::Index grandchild = m_storage->Add(grandchildId, grandchildTM, childId);
+        const TransformStorage::Index child = m_storage->Add(childId, childTM, rootId);
+        const TransformStorage::Index root = m_storage->Add(rootId, rootTM, AZ::EntityId());
+        EXPECT_EQ(3, m_storage->GetCount());
+        EXPECT_EQ(child, m_storage->FindIndex(childId));
+
+        m_storage->UpdateWorldTransforms();
+
+        ExpectTransformClose(rootTM, m_storage->GetWorldTM(root));
+        ExpectTransformClose(rootTM * childTM, m_storage->GetWorldTM(child));
+        ExpectTransformClose(rootTM * childTM * grandchildTM, m_storage->GetWorldTM(grandchild));
+    }
+
+    TEST_F(TransformStorageTests, SetLocalTM_AfterUpdate_PropagatesToDescendants)
+    {
+        const AZ::EntityId rootId(1);
+        const AZ::EntityId childId(2);
+        const AZ::Transform childTM = MakeTransform(-3.0f, 1.0f, 0.5f);
+
+        const TransformStorage::Index root = m_storage->Add(rootId, AZ::Transform::CreateIdentity(), AZ::EntityId());
+        const TransformStorage::Index child = m_storage->Add(childId, childTM, rootId);
+        m_storage->UpdateWorldTransforms();
+        ExpectTransformClose(childTM, m_storage->GetWorldTM(child));
+
+        const AZ::Transform movedRootTM = MakeTransform(10.0f, 2.0f, 1.5f);
+        m_storage->SetLocalTM(root, movedRootTM);
+        m_storage->UpdateWorldTransforms();
+
+        ExpectTransformClose(movedRootTM, m_storage->GetLocalTM(root));
+        ExpectTransformClose(movedRootTM * childTM, m_storage->GetWorldTM(child));
+    }
+
+    TEST_F(TransformStorageTests, RemoveParent_ChildBecomesRoot)
+    {
+        const AZ::EntityId rootId(1);
+        const AZ::EntityId childId(2);
+        const AZ::Transform childTM = MakeTransform(-3.0f, 1.0f, 0.5f);
+
+        const TransformStorage::Index root = m_storage->Add(rootId, MakeTransform(1.0f, 0.5f, 2.0f), AZ::EntityId());
+        const TransformStorage::Index child = m_storage->Add(childId, childTM, rootId);
+        m_storage->Remove(root);
+        EXPECT_EQ(TransformStorage::InvalidIndex, m_storage->FindIndex(rootId));
+
+        m_storage->UpdateWorldTransforms();
+        ExpectTransformClose(childTM, m_storage->GetWorldTM(child));
+
+        // The freed index is reused
+        EXPECT_EQ(root, m_storage->Add(AZ::EntityId(3), AZ::Transform::CreateIdentity(), AZ::EntityId()));
+    }
+
+    TEST_F(TransformStorageTests, SetParent_Reparent_UsesNewParent)
+    {
+        const AZ::EntityId firstId(1);
+        const AZ::EntityId secondId(2);
+        const AZ::EntityId childId(3);
+        const AZ::Transform firstTM = MakeTransform(1.0f, 0.5f, 2.0f);
+        const AZ::Transform secondTM = MakeTransform(-5.0f, -1.5f, 0.25f);
+        const AZ::Transform childTM = MakeTransform(-3.0f, 1.0f, 0.5f);
+
+        m_storage->Add(firstId, firstTM, AZ::EntityId());
+        m_storage->Add(secondId, secondTM, AZ::EntityId());
+        const TransformStorage::Index child = m_storage->Add(childId, childTM, firstId);
+        m_storage->UpdateWorldTransforms();
+        ExpectTransformClose(firstTM * childTM, m_storage->GetWorldTM(child));
+
+        m_storage->SetParent(child, secondId);
+        m_storage->UpdateWorldTransforms();
+        ExpectTransformClose(secondTM * childTM, m_storage->GetWorldTM(child));
+    }
+
+    TEST_F(TransformStorageTests, UpdateWorldTransforms_ManyChunks_AllEntriesUpdated)
+    {
+        // A chain that spans several chunks, each entry parented to the previous one
+        constexpr uint32_t count = TransformStorage::ChunkSize * 3 + 7;
+        const AZ::Transform stepTM(AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Quaternion::CreateIdentity(), 1.0f);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            m_storage->Add(AZ::EntityId(i + 1), stepTM, AZ::EntityId(i));
+        }
+
+        m_storage->UpdateWorldTransforms();
+
+        const TransformStorage::Index last = m_storage->FindIndex(AZ::EntityId(count));
+        EXPECT_NEAR(static_cast<float>(count), m_storage->GetWorldTM(last).GetTranslation().GetX(), 0.01f);
+    }
+} // namespace UnitTest
@@ -24,6 +24,7 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    TransformStorageTests.cpp
     AssetCatalog.cpp
     AssetProcessorConnection.cpp
     NativeWindow.cpp
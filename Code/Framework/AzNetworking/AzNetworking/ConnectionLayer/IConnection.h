@@ -95,6 +95,11 @@ namespace AzNetworking
         //! @return the max transmission unit for this connection
         virtual uint32_t GetConnectionMtu() const = 0;
 
+        //! Returns the number of bytes the connection's congestion control allows sending right now.
+        //! The budget is advisory, callers producing optional data use it to avoid building up queues along the network path
+        //! @return the number of bytes that can be sent right now, or the maximum uint32_t value if the connection is not rate limited
+        virtual uint32_t GetAvailableSendBytes() const;
+
         //! Returns the connection identifier for this connection instance.
         //! @return the connection identifier for this connection instance
         ConnectionId GetConnectionId() const;
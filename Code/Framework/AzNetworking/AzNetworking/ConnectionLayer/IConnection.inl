@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <AzCore/std/limits.h>
+
 namespace AzNetworking
 {
     inline ConnectionQuality::ConnectionQuality(int32_t lossPercentage, AZ::TimeMs latencyMs, AZ::TimeMs varianceMs)
@@ -60,6 +62,11 @@ namespace AzNetworking
         return m_connectionMetrics;
     }
 
+    inline uint32_t IConnection::GetAvailableSendBytes() const
+    {
+        return AZStd::numeric_limits<uint32_t>::max();
+    }
+
     inline const ConnectionQuality& IConnection::GetConnectionQuality() const
     {
         return m_connectionQuality;
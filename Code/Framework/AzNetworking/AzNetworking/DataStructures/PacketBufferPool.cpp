@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AzNetworking
+{
+    static constexpr uint32_t SizeClassCapacities[] = { PacketBufferPool::SmallBufferCapacity, PacketBufferPool::LargeBufferCapacity };
+
+    PacketBufferPool::~PacketBufferPool()
+    {
+        AZ_Assert(m_activeBufferCount == 0, "PacketBufferPool destroyed while %u buffers are still referenced", m_activeBufferCount);
+        for (AZStd::vector<PooledPacketBuffer::Block*>& freeBlocks : m_freeBlocks)
+        {
+            for (PooledPacketBuffer::Block* block : freeBlocks)
+            {
+                block->~Block();
+                azfree(block);
+            }
+            freeBlocks.clear();
+        }
+    }
+
+    PooledPacketBuffer PacketBufferPool::Acquire(uint32_t minCapacity)
+    {
+        AZ_Assert(minCapacity <= LargeBufferCapacity, "Requested packet buffer capacity %u exceeds the maximum of %u", minCapacity, LargeBufferCapacity);
+
+        const uint32_t sizeClass = (minCapacity <= SmallBufferCapacity) ? 0 : 1;
+        AZStd::vector<PooledPacketBuffer::Block*>& freeBlocks = m_freeBlocks[sizeClass];
+
+        PooledPacketBuffer::Block* block = nullptr;
+        if (!freeBlocks.empty())
+        {
+            block = freeBlocks.back();
+            freeBlocks.pop_back();
+        }
+        else
+        {
+            const uint32_t capacity = SizeClassCapacities[sizeClass];
+            void* memory = azmalloc(sizeof(PooledPacketBuffer::Block) + capacity, alignof(PooledPacketBuffer::Block));
+            block = new (memory) PooledPacketBuffer::Block();
+            block->m_pool = this;
+            block->m_capacity = capacity;
+            block->m_sizeClass = sizeClass;
+        }
+
+        block->m_size = 0;
+        ++m_activeBufferCount;
+        return PooledPacketBuffer(block);
+    }
+
+    void PacketBufferPool::Release(PooledPacketBuffer::Block* block)
+    {
+        AZ_Assert(m_activeBufferCount > 0, "Released more packet buffers than were acquired");
+        --m_activeBufferCount;
+        m_freeBlocks[block->m_sizeClass].push_back(block);
+    }
+}
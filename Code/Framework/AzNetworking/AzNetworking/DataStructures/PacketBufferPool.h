@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzNetworking
+{
+    class PacketBufferPool;
+
+    //! @class PooledPacketBuffer
+    //! @brief reference counted handle to a fixed capacity packet buffer owned by a PacketBufferPool.
+    //! Copying a handle shares the underlying buffer, the buffer is returned to its pool once the last handle referencing it is released.
+    class PooledPacketBuffer
+    {
+    public:
+
+        PooledPacketBuffer() = default;
+        PooledPacketBuffer(const PooledPacketBuffer& rhs);
+        PooledPacketBuffer(PooledPacketBuffer&& rhs);
+        ~PooledPacketBuffer();
+
+        PooledPacketBuffer& operator =(const PooledPacketBuffer& rhs);
+        PooledPacketBuffer& operator =(PooledPacketBuffer&& rhs);
+
+        //! Returns true if this handle references a buffer.
+        //! @return boolean true if this handle references a buffer
+        bool IsValid() const;
+
+        //! Releases this handle's reference to its buffer.
+        void Reset();
+
+        //! Returns a pointer to the start of the buffer.
+        //! @return pointer to the start of the buffer
+        uint8_t* GetBuffer();
+        const uint8_t* GetBuffer() const;
+
+        //! Returns the capacity of the buffer in bytes.
+        //! @return the capacity of the buffer in bytes
+        uint32_t GetCapacity() const;
+
+        //! Returns the number of bytes in use in the buffer.
+        //! @return the number of bytes in use in the buffer
+        uint32_t GetSize() const;
+
+        //! Sets the number of bytes in use in the buffer, this is shared by all handles referencing the buffer.
+        //! @param size the number of bytes in use, must not exceed the capacity of the buffer
+        void SetSize(uint32_t size);
+
+    private:
+
+        friend class PacketBufferPool;
+
+        struct Block
+        {
+            PacketBufferPool* m_pool = nullptr;
+            uint32_t m_refCount = 0;
+            uint32_t m_capacity = 0;
+            uint32_t m_size = 0;
+            uint32_t m_sizeClass = 0;
+        };
+
+        explicit PooledPacketBuffer(Block* block);
+
+        uint8_t* GetData() const;
+
+        Block* m_block = nullptr;
+    };
+
+    //! @class PacketBufferPool
+    //! @brief recycles fixed capacity packet buffers so that serializing and retaining packets doesn't allocate per packet.
+    //! Buffers come in two size classes, one sized for packets that fit within a single MTU and one sized for the largest possible packet.
+    //! The pool and its buffers are not thread safe, and the pool must outlive all buffers acquired from it.
+    class PacketBufferPool
+    {
+    public:
+
+        //! Capacity of buffers for packets that fit within a single MTU, with space left over for headers.
+        static constexpr uint32_t SmallBufferCapacity = MaxUdpTransmissionUnit * 2;
+
+        //! Capacity of buffers large enough for the largest possible packet, with space left over for headers.
+        static constexpr uint32_t LargeBufferCapacity = MaxPacketSize + MaxUdpTransmissionUnit;
+
+        PacketBufferPool() = default;
+        ~PacketBufferPool();
+
+        //! Returns a buffer with at least the requested capacity, reusing a released buffer if one is available.
+        //! @param minCapacity the minimum capacity of the returned buffer, must not exceed LargeBufferCapacity
+        //! @return handle to the acquired buffer, the size of the buffer is zero
+        PooledPacketBuffer Acquire(uint32_t minCapacity);
+
+        //! Returns the number of buffers currently referenced by at least one handle.
+        //! @return the number of buffers currently referenced by at least one handle
+        uint32_t GetActiveBufferCount() const;
+
+        //! Returns the number of released buffers available for reuse.
+        //! @return the number of released buffers available for reuse
+        uint32_t GetFreeBufferCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketBufferPool);
+
+        friend class PooledPacketBuffer;
+
+        static constexpr uint32_t SizeClassCount = 2;
+
+        void Release(PooledPacketBuffer::Block* block);
+
+        AZStd::vector<PooledPacketBuffer::Block*> m_freeBlocks[SizeClassCount];
+        uint32_t m_activeBufferCount = 0;
+    };
+}
+
+#include <AzNetworking/DataStructures/PacketBufferPool.inl>
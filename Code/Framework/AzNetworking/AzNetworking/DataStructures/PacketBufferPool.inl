@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline PooledPacketBuffer::PooledPacketBuffer(Block* block)
+        : m_block(block)
+    {
+        ++m_block->m_refCount;
+    }
+
+    inline PooledPacketBuffer::PooledPacketBuffer(const PooledPacketBuffer& rhs)
+        : m_block(rhs.m_block)
+    {
+        if (m_block != nullptr)
+        {
+            ++m_block->m_refCount;
+        }
+    }
+
+    inline PooledPacketBuffer::PooledPacketBuffer(PooledPacketBuffer&& rhs)
+        : m_block(rhs.m_block)
+    {
+        rhs.m_block = nullptr;
+    }
+
+    inline PooledPacketBuffer::~PooledPacketBuffer()
+    {
+        Reset();
+    }
+
+    inline PooledPacketBuffer& PooledPacketBuffer::operator =(const PooledPacketBuffer& rhs)
+    {
+        if (m_block != rhs.m_block)
+        {
+            Reset();
+            m_block = rhs.m_block;
+            if (m_block != nullptr)
+            {
+                ++m_block->m_refCount;
+            }
+        }
+        return *this;
+    }
+
+    inline PooledPacketBuffer& PooledPacketBuffer::operator =(PooledPacketBuffer&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Reset();
+            m_block = rhs.m_block;
+            rhs.m_block = nullptr;
+        }
+        return *this;
+    }
+
+    inline bool PooledPacketBuffer::IsValid() const
+    {
+        return m_block != nullptr;
+    }
+
+    inline void PooledPacketBuffer::Reset()
+    {
+        if (m_block != nullptr)
+        {
+            AZ_Assert(m_block->m_refCount > 0, "Pooled packet buffer reference count underflow");
+            if (--m_block->m_refCount == 0)
+            {
+                m_block->m_pool->Release(m_block);
+            }
+            m_block = nullptr;
+        }
+    }
+
+    inline uint8_t* PooledPacketBuffer::GetBuffer()
+    {
+        return GetData();
+    }
+
+    inline const uint8_t* PooledPacketBuffer::GetBuffer() const
+    {
+        return GetData();
+    }
+
+    inline uint32_t PooledPacketBuffer::GetCapacity() const
+    {
+        return (m_block != nullptr) ? m_block->m_capacity : 0;
+    }
+
+    inline uint32_t PooledPacketBuffer::GetSize() const
+    {
+        return (m_block != nullptr) ? m_block->m_size : 0;
+    }
+
+    inline void PooledPacketBuffer::SetSize(uint32_t size)
+    {
+        AZ_Assert(m_block != nullptr, "SetSize called on an invalid pooled packet buffer");
+        AZ_Assert(size <= m_block->m_capacity, "Pooled packet buffer size %u exceeds capacity %u", size, m_block->m_capacity);
+        m_block->m_size = size;
+    }
+
+    inline uint8_t* PooledPacketBuffer::GetData() const
+    {
+        // The buffer data immediately follows the block header in the same allocation
+        return (m_block != nullptr) ? reinterpret_cast<uint8_t*>(m_block + 1) : nullptr;
+    }
+
+    inline uint32_t PacketBufferPool::GetActiveBufferCount() const
+    {
+        return m_activeBufferCount;
+    }
+
+    inline uint32_t PacketBufferPool::GetFreeBufferCount() const
+    {
+        uint32_t freeCount = 0;
+        for (const AZStd::vector<PooledPacketBuffer::Block*>& freeBlocks : m_freeBlocks)
+        {
+            freeCount += aznumeric_cast<uint32_t>(freeBlocks.size());
+        }
+        return freeCount;
+    }
+}
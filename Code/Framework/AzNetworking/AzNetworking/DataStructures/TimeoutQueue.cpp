@@ -8,49 +8,87 @@
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 #include <climits>
 #include <cinttypes>
 
 namespace AzNetworking
 {
+    namespace
+    {
+        uint32_t NextGeneration(uint32_t generation, uint32_t generationMask)
+        {
+            // Generation zero is never handed out so that InvalidTimeoutId never matches an item
+            const uint32_t nextGeneration = (generation + 1) & generationMask;
+            return (nextGeneration != 0) ? nextGeneration : 1;
+        }
+    }
+
     void TimeoutQueue::Reset()
     {
-        m_timeoutItemMap.clear();
-        m_timeoutItemQueue = TimeoutItemQueue();
-        m_nextTimeoutId = TimeoutId{0};
+        // Keep the pool storage but invalidate every outstanding identifier
+        m_freeHead = InvalidIndex;
+        m_freeTail = InvalidIndex;
+        for (uint32_t nodeIndex = 0; nodeIndex < static_cast<uint32_t>(m_nodes.size()); ++nodeIndex)
+        {
+            TimeoutNode& node = m_nodes[nodeIndex];
+            node.m_slot = InvalidIndex;
+            node.m_prev = InvalidIndex;
+            FreeNode(nodeIndex);
+        }
+        AZStd::fill(m_slotHeads.begin(), m_slotHeads.end(), InvalidIndex);
+        AZStd::fill(AZStd::begin(m_levelSizes), AZStd::end(m_levelSizes), 0u);
+        m_wheelSize = 0;
+        m_expiredHead = InvalidIndex;
+        m_expiredTail = InvalidIndex;
     }
 
     TimeoutId TimeoutQueue::RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
     {
-        const TimeoutId timeoutId = m_nextTimeoutId;
-        const AZ::TimeMs timeoutTimeMs = AZ::GetElapsedTimeMs() + timeoutMs;
+        const uint32_t nodeIndex = AllocateNode();
+        if (nodeIndex == InvalidIndex)
+        {
+            AZLOG_ERROR("Timeout queue is full, failed to register an item with user data %" PRIu64, userData);
+            return InvalidTimeoutId;
+        }
+
+        TimeoutNode& node = m_nodes[nodeIndex];
+        node.m_item = TimeoutItem(userData, timeoutMs);
+        const TimeoutId timeoutId = TimeoutId{ (node.m_generation << IndexBits) | nodeIndex };
         AZLOG(TimeoutQueue, "Pushing timeoutid %u with user data %" PRIu64 " to expire at time %u",
             aznumeric_cast<uint32_t>(timeoutId),
             userData,
-            aznumeric_cast<uint32_t>(timeoutTimeMs)
+            aznumeric_cast<uint32_t>(node.m_item.m_nextTimeoutTimeMs)
         );
 
-        TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
-        m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
-        m_timeoutItemQueue.push(queueItem);
-        ++m_nextTimeoutId;
+        if (m_slotHeads.empty())
+        {
+            m_slotHeads.resize(WheelLevelCount * WheelSlotCount, InvalidIndex);
+        }
+        if (m_wheelSize == 0)
+        {
+            // Nothing to expire in between, skip ahead instead of stepping through the elapsed time on the next update
+            m_currentTimeMs = AZStd::max(m_currentTimeMs, static_cast<int64_t>(AZ::GetElapsedTimeMs()));
+        }
+        LinkNode(nodeIndex);
 
         return timeoutId;
     }
 
     TimeoutQueue::TimeoutItem *TimeoutQueue::RetrieveItem(TimeoutId timeoutId)
     {
-        TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
-        if (iter != m_timeoutItemMap.end())
-        {
-            return &(iter->second);
-        }
-        return nullptr;
+        TimeoutNode* node = FindNode(timeoutId);
+        return (node != nullptr) ? &(node->m_item) : nullptr;
     }
 
     void TimeoutQueue::RemoveItem(TimeoutId timeoutId)
     {
-        m_timeoutItemMap.erase(timeoutId);
+        if (FindNode(timeoutId) != nullptr)
+        {
+            const uint32_t nodeIndex = aznumeric_cast<uint32_t>(timeoutId) & IndexMask;
+            UnlinkNode(nodeIndex);
+            FreeNode(nodeIndex);
+        }
     }
 
     void TimeoutQueue::UpdateTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts)
@@ -61,18 +99,9 @@ namespace AzNetworking
             maxTimeouts = INT_MAX;
         }
         AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-        while (m_timeoutItemQueue.size() > 0)
+        AdvanceWheel(static_cast<int64_t>(currentTimeMs));
+        while (m_expiredHead != InvalidIndex)
         {
-            const TimeoutQueueItem queueItem = m_timeoutItemQueue.top();
-            const TimeoutId    itemTimeoutId = queueItem.m_timeoutId;
-            const AZ::TimeMs   itemTimeoutMs = queueItem.m_timeoutTimeMs;
-
-            // Head item has not timed out yet, we can terminate because we've run out of timed out items
-            if (itemTimeoutMs >= currentTimeMs)
-            {
-                break;
-            }
-
             ++numTimeouts;
 
             if (numTimeouts >= maxTimeouts)
@@ -81,45 +110,246 @@ namespace AzNetworking
                 break;
             }
 
-            // Pop the item, we're either going to time it out or reinsert it
-            m_timeoutItemQueue.pop();
+            // Unlink the item, we're either going to time it out or reinsert it
+            const uint32_t nodeIndex = m_expiredHead;
+            TimeoutNode& node = m_nodes[nodeIndex];
+            UnlinkNode(nodeIndex);
 
-            TimeoutItemMap::iterator iter = m_timeoutItemMap.find(itemTimeoutId);
-            if (iter == m_timeoutItemMap.end())
+            // Check to see if the item has been refreshed since it was inserted
+            if (node.m_item.m_nextTimeoutTimeMs > currentTimeMs)
             {
-                // Item has already been deleted, just continue
+                LinkNode(nodeIndex);
                 continue;
             }
 
-            TimeoutItem mapItem = iter->second;
+            // By this point, the item is definitely timed out
+            // Invoke the timeout function to see how to proceed
+            const uint32_t generation = node.m_generation;
+            const TimeoutResult result = timeoutHandler(node.m_item);
 
-            // Check to see if the item has been refreshed since it was inserted
-            if (mapItem.m_nextTimeoutTimeMs > currentTimeMs)
+            if (node.m_generation != generation)
             {
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                // The handler removed the item itself, just continue
                 continue;
             }
 
-            // By this point, the item is definitely timed out
-            // Invoke the timeout function to see how to proceed
-            const TimeoutResult result = timeoutHandler(mapItem);
-
             if (result == TimeoutResult::Refresh)
             {
-                mapItem.UpdateTimeoutTime(currentTimeMs);
-                // Re-insert into priority queue
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                node.m_item.UpdateTimeoutTime(currentTimeMs);
+                LinkNode(nodeIndex);
                 continue;
             }
 
             AZLOG(TimeoutQueue, "Popping timeoutid %u with user data %" PRIu64 ", expire time %d, current time %u",
-                aznumeric_cast<uint32_t>(itemTimeoutId),
-                mapItem.m_userData,
-                aznumeric_cast<uint32_t>(mapItem.m_nextTimeoutTimeMs),
+                (generation << IndexBits) | nodeIndex,
+                node.m_item.m_userData,
+                aznumeric_cast<uint32_t>(node.m_item.m_nextTimeoutTimeMs),
                 aznumeric_cast<uint32_t>(currentTimeMs));
-            m_timeoutItemMap.erase(itemTimeoutId);
+            FreeNode(nodeIndex);
+        }
+    }
+
+    TimeoutQueue::TimeoutNode* TimeoutQueue::FindNode(TimeoutId timeoutId)
+    {
+        const uint32_t nodeIndex = aznumeric_cast<uint32_t>(timeoutId) & IndexMask;
+        const uint32_t generation = aznumeric_cast<uint32_t>(timeoutId) >> IndexBits;
+        if ((generation == 0) || (nodeIndex >= m_nodes.size()) || (m_nodes[nodeIndex].m_generation != generation))
+        {
+            return nullptr;
+        }
+        return &m_nodes[nodeIndex];
+    }
+
+    uint32_t TimeoutQueue::AllocateNode()
+    {
+        if (m_freeHead != InvalidIndex)
+        {
+            // Hand out the oldest free node, so a generation takes as long as possible to come back around
+            const uint32_t nodeIndex = m_freeHead;
+            m_freeHead = m_nodes[nodeIndex].m_next;
+            if (m_freeHead == InvalidIndex)
+            {
+                m_freeTail = InvalidIndex;
+            }
+            m_nodes[nodeIndex].m_next = InvalidIndex;
+            return nodeIndex;
+        }
+
+        if (m_nodes.size() > IndexMask)
+        {
+            return InvalidIndex;
+        }
+        m_nodes.emplace_back();
+        m_nodes.back().m_generation = 1;
+        return static_cast<uint32_t>(m_nodes.size() - 1);
+    }
+
+    void TimeoutQueue::FreeNode(uint32_t nodeIndex)
+    {
+        TimeoutNode& node = m_nodes[nodeIndex];
+        node.m_generation = NextGeneration(node.m_generation, GenerationMask);
+        node.m_next = InvalidIndex;
+        if (m_freeTail != InvalidIndex)
+        {
+            m_nodes[m_freeTail].m_next = nodeIndex;
+        }
+        else
+        {
+            m_freeHead = nodeIndex;
+        }
+        m_freeTail = nodeIndex;
+    }
+
+    void TimeoutQueue::LinkNode(uint32_t nodeIndex)
+    {
+        TimeoutNode& node = m_nodes[nodeIndex];
+
+        // Items time out once the current time has passed their timeout time
+        const int64_t delayMs = static_cast<int64_t>(node.m_item.m_nextTimeoutTimeMs) + 1 - m_currentTimeMs;
+        if (delayMs <= 0)
+        {
+            node.m_slot = ExpiredSlot;
+            node.m_prev = m_expiredTail;
+            node.m_next = InvalidIndex;
+            if (m_expiredTail != InvalidIndex)
+            {
+                m_nodes[m_expiredTail].m_next = nodeIndex;
+            }
+            else
+            {
+                m_expiredHead = nodeIndex;
+            }
+            m_expiredTail = nodeIndex;
+            return;
+        }
+
+        // Timeouts further than the wheel range are placed at its end and rechecked from there as refreshed items
+        const int64_t clampedDelayMs = AZStd::min(delayMs, MaxWheelDelayMs);
+        const uint64_t timeoutTimeMs = static_cast<uint64_t>(m_currentTimeMs + clampedDelayMs);
+        uint32_t level = 0;
+        while (clampedDelayMs >= (int64_t(1) << (WheelSlotBits * (level + 1))))
+        {
+            ++level;
+        }
+        const uint32_t slot = level * WheelSlotCount + static_cast<uint32_t>((timeoutTimeMs >> (WheelSlotBits * level)) & WheelSlotMask);
+
+        node.m_slot = slot;
+        node.m_prev = InvalidIndex;
+        node.m_next = m_slotHeads[slot];
+        if (node.m_next != InvalidIndex)
+        {
+            m_nodes[node.m_next].m_prev = nodeIndex;
+        }
+        m_slotHeads[slot] = nodeIndex;
+        ++m_levelSizes[level];
+        ++m_wheelSize;
+    }
+
+    void TimeoutQueue::UnlinkNode(uint32_t nodeIndex)
+    {
+        TimeoutNode& node = m_nodes[nodeIndex];
+        if (node.m_slot == InvalidIndex)
+        {
+            // Not linked, the item is currently being handled
+            return;
+        }
+
+        uint32_t& head = (node.m_slot == ExpiredSlot) ? m_expiredHead : m_slotHeads[node.m_slot];
+        if (node.m_prev != InvalidIndex)
+        {
+            m_nodes[node.m_prev].m_next = node.m_next;
+        }
+        else
+        {
+            head = node.m_next;
+        }
+        if (node.m_next != InvalidIndex)
+        {
+            m_nodes[node.m_next].m_prev = node.m_prev;
+        }
+        else if (node.m_slot == ExpiredSlot)
+        {
+            m_expiredTail = node.m_prev;
+        }
+
+        if (node.m_slot != ExpiredSlot)
+        {
+            --m_levelSizes[node.m_slot / WheelSlotCount];
+            --m_wheelSize;
+        }
+        node.m_slot = InvalidIndex;
+        node.m_prev = InvalidIndex;
+        node.m_next = InvalidIndex;
+    }
+
+    void TimeoutQueue::AdvanceWheel(int64_t targetTimeMs)
+    {
+        while (m_currentTimeMs < targetTimeMs)
+        {
+            if (m_wheelSize == 0)
+            {
+                m_currentTimeMs = targetTimeMs;
+                break;
+            }
+
+            // Nothing times out before the next block of the lowest level holding items, skip to it
+            uint32_t emptyLevels = 0;
+            while ((emptyLevels < WheelLevelCount - 1) && (m_levelSizes[emptyLevels] == 0))
+            {
+                ++emptyLevels;
+            }
+            const uint32_t blockShift = WheelSlotBits * emptyLevels;
+            const int64_t timeMs = ((m_currentTimeMs >> blockShift) + 1) << blockShift;
+            if (timeMs > targetTimeMs)
+            {
+                m_currentTimeMs = targetTimeMs;
+                break;
+            }
+            m_currentTimeMs = timeMs;
+
+            const uint32_t slot = static_cast<uint32_t>(timeMs) & WheelSlotMask;
+            if (slot == 0)
+            {
+                // Move the items of the next block of the upper levels down, a level is only reached when all the lower ones wrapped
+                for (uint32_t level = 1; level < WheelLevelCount; ++level)
+                {
+                    const uint32_t levelSlot = static_cast<uint32_t>(timeMs >> (WheelSlotBits * level)) & WheelSlotMask;
+                    CascadeSlot(level, levelSlot);
+                    if (levelSlot != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            ExpireSlot(slot);
+        }
+    }
+
+    void TimeoutQueue::CascadeSlot(uint32_t level, uint32_t slot)
+    {
+        uint32_t nodeIndex = m_slotHeads[level * WheelSlotCount + slot];
+        m_slotHeads[level * WheelSlotCount + slot] = InvalidIndex;
+        while (nodeIndex != InvalidIndex)
+        {
+            const uint32_t nextIndex = m_nodes[nodeIndex].m_next;
+            --m_levelSizes[level];
+            --m_wheelSize;
+            LinkNode(nodeIndex);
+            nodeIndex = nextIndex;
+        }
+    }
+
+    void TimeoutQueue::ExpireSlot(uint32_t slot)
+    {
+        uint32_t nodeIndex = m_slotHeads[slot];
+        m_slotHeads[slot] = InvalidIndex;
+        while (nodeIndex != InvalidIndex)
+        {
+            const uint32_t nextIndex = m_nodes[nodeIndex].m_next;
+            --m_levelSizes[0];
+            --m_wheelSize;
+            LinkNode(nodeIndex);
+            nodeIndex = nextIndex;
         }
     }
 }
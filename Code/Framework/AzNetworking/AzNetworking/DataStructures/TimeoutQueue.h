@@ -10,12 +10,14 @@
 
 #include <AzCore/Time/ITime.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
-#include <AzCore/std/containers/map.h>
-#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
 
 namespace AzNetworking
 {
     AZ_TYPE_SAFE_INTEGRAL(TimeoutId, uint32_t);
+    static constexpr TimeoutId InvalidTimeoutId = TimeoutId{ 0 };
 
     enum class TimeoutResult
     {
@@ -25,6 +27,9 @@ namespace AzNetworking
 
     //! @class TimeoutQueue
     //! @brief class for managing timeout items.
+    //! Items are pooled and linked intrusively into a hierarchical timing wheel with a resolution of 1 ms, so registering
+    //! and removing an item are O(1) and do not allocate once the pool has grown to the peak number of items.
+    //! A TimeoutId holds the pool index of its item and a generation, so stale identifiers are safely rejected.
     class TimeoutQueue
     {
     public:
@@ -70,22 +75,44 @@ namespace AzNetworking
 
     private:
 
-        struct TimeoutQueueItem
+        static constexpr uint32_t IndexBits = 22;
+        static constexpr uint32_t IndexMask = (1 << IndexBits) - 1;
+        static constexpr uint32_t GenerationMask = (1 << (32 - IndexBits)) - 1;
+        static constexpr uint32_t WheelLevelCount = 5;
+        static constexpr uint32_t WheelSlotBits = 6;
+        static constexpr uint32_t WheelSlotCount = 1 << WheelSlotBits;
+        static constexpr uint32_t WheelSlotMask = WheelSlotCount - 1;
+        static constexpr int64_t MaxWheelDelayMs = (int64_t(1) << (WheelSlotBits * WheelLevelCount)) - 1;
+        static constexpr uint32_t ExpiredSlot = WheelLevelCount * WheelSlotCount;
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+        struct TimeoutNode
         {
-            TimeoutQueueItem(TimeoutId timeoutId, AZ::TimeMs timeoutTimeMs);
-
-            bool operator < (const TimeoutQueueItem &rhs) const;
-
-            TimeoutId m_timeoutId;
-            AZ::TimeMs m_timeoutTimeMs;
+            TimeoutItem m_item;
+            uint32_t m_generation = 0;
+            uint32_t m_slot = InvalidIndex; //< wheel slot holding this node, ExpiredSlot for the expired list
+            uint32_t m_prev = InvalidIndex;
+            uint32_t m_next = InvalidIndex; //< also links the free list
         };
 
-        using TimeoutItemMap   = AZStd::map<TimeoutId, TimeoutItem>;
-        using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
-
-        TimeoutId        m_nextTimeoutId = TimeoutId{ 0 };
-        TimeoutItemMap   m_timeoutItemMap;
-        TimeoutItemQueue m_timeoutItemQueue;
+        TimeoutNode* FindNode(TimeoutId timeoutId);
+        uint32_t AllocateNode();
+        void FreeNode(uint32_t nodeIndex);
+        void LinkNode(uint32_t nodeIndex);
+        void UnlinkNode(uint32_t nodeIndex);
+        void AdvanceWheel(int64_t targetTimeMs);
+        void CascadeSlot(uint32_t level, uint32_t slot);
+        void ExpireSlot(uint32_t slot);
+
+        AZStd::deque<TimeoutNode> m_nodes; //< a deque so items stay in place while a timeout handler registers new ones
+        AZStd::vector<uint32_t> m_slotHeads; //< allocated on first registration, many queues never hold an item
+        uint32_t m_levelSizes[WheelLevelCount] = {};
+        uint32_t m_wheelSize = 0;
+        uint32_t m_expiredHead = InvalidIndex;
+        uint32_t m_expiredTail = InvalidIndex;
+        uint32_t m_freeHead = InvalidIndex;
+        uint32_t m_freeTail = InvalidIndex;
+        int64_t m_currentTimeMs = 0;
     };
 }
 
@@ -83,76 +83,76 @@ namespace AzNetworking
         return SerializerMode::ReadFromObject;
     }
 
-    bool DeltaSerializerCreate::Serialize(bool& value, const char* name)
+    bool DeltaSerializerCreate::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        // Booleans are packed into the dirty bits, a changed value is followed by a bit holding the new value
+        bool different = false;
+        if (!CompareRecord(value, different))
+        {
+            return false;
+        }
+
+        if (different && !m_delta.InsertDirtyBit(value))
+        {
+            AZ_Assert(false, "Ran out of bits in DeltaSerializerCreate. You are probably trying to serialize an object with too many fields. Consider resizing the bitset in DeltaSerializerCreate");
+            return false;
+        }
+        return true;
     }
 
-    bool DeltaSerializerCreate::Serialize(char& value, const char* name, [[maybe_unused]] char minValue, [[maybe_unused]] char maxValue)
+    bool DeltaSerializerCreate::Serialize(char& value, const char* name, char minValue, char maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(int8_t& value, const char* name, [[maybe_unused]] int8_t minValue, [[maybe_unused]] int8_t maxValue)
+    bool DeltaSerializerCreate::Serialize(int8_t& value, const char* name, int8_t minValue, int8_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(int16_t& value, const char* name, [[maybe_unused]] int16_t minValue, [[maybe_unused]] int16_t maxValue)
+    bool DeltaSerializerCreate::Serialize(int16_t& value, const char* name, int16_t minValue, int16_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(int32_t& value, const char* name, [[maybe_unused]] int32_t minValue, [[maybe_unused]] int32_t maxValue)
+    bool DeltaSerializerCreate::Serialize(int32_t& value, const char* name, int32_t minValue, int32_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(int64_t& value, const char* name, [[maybe_unused]] int64_t minValue, [[maybe_unused]] int64_t maxValue)
+    bool DeltaSerializerCreate::Serialize(int64_t& value, const char* name, int64_t minValue, int64_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(uint8_t& value, const char* name, [[maybe_unused]] uint8_t minValue, [[maybe_unused]] uint8_t maxValue)
+    bool DeltaSerializerCreate::Serialize(uint8_t& value, const char* name, uint8_t minValue, uint8_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(uint16_t& value, const char* name, [[maybe_unused]] uint16_t minValue, [[maybe_unused]] uint16_t maxValue)
+    bool DeltaSerializerCreate::Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(uint32_t& value, const char* name, [[maybe_unused]] uint32_t minValue, [[maybe_unused]] uint32_t maxValue)
+    bool DeltaSerializerCreate::Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(uint64_t& value, const char* name, [[maybe_unused]] uint64_t minValue, [[maybe_unused]] uint64_t maxValue)
+    bool DeltaSerializerCreate::Serialize(uint64_t& value, const char* name, uint64_t minValue, uint64_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(float& value, const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    bool DeltaSerializerCreate::Serialize(float& value, const char* name, float minValue, float maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerCreate::Serialize(double& value, const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    bool DeltaSerializerCreate::Serialize(double& value, const char* name, double minValue, double maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
     bool DeltaSerializerCreate::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name)
@@ -186,12 +186,13 @@ namespace AzNetworking
     }
 
     template <typename T>
-    bool DeltaSerializerCreate::SerializeHelper(T& value, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name)
+    bool DeltaSerializerCreate::CompareRecord(T& value, bool& outDifferent)
     {
         typedef AbstractValue::ValueT<T> ValueType;
 
         AbstractValue::BaseValue* baseValue = m_records.size() > m_objectCounter ? m_records[m_objectCounter] : nullptr;
         ++m_objectCounter;
+        outDifferent = false;
 
         // If we are in the gather records phase, just save off the value records
         if (m_gatheringRecords)
@@ -199,44 +200,58 @@ namespace AzNetworking
             AZ_Assert(baseValue == nullptr, "Expected to create a new record but found a pre-existing one at index %d", m_objectCounter - 1);
             baseValue = new ValueType(value);
             m_records.push_back(baseValue);
+            return true;
         }
-        else // If we are not gathering records, then we are comparing them
+
+        // If we are not gathering records, then we are comparing them
+        if (baseValue)
         {
-            bool different = false;
-
-            if (baseValue)
-            {
-                // This record must match the same type that was pushed into the list during the gathering phase
-                ValueType* typedValue = static_cast<ValueType*>(baseValue);
-                // Are the two values different?
-                different = typedValue->GetValue() != value;
-            }
-            else
-            {
-                // No record? Then definitely different
-                different = true;
-            }
-
-            // Record a bit to track this information
-            if (!m_delta.InsertDirtyBit(different))
-            {
-                AZ_Assert(false, "Ran out of bits in DeltaSerializerCreate. You are probably trying to serialize an object with too many fields. Consider resizing the bitset in DeltaSerializerCreate");
-                return false;
-            }
-
-            // If different, also write the data into the delta's buffer
-            if (different)
-            {
-                if (!SerializeHelperImpl(value, bufferCapacity, isString, outSize, name))
-                {
-                    return false;
-                }
-            }
+            // This record must match the same type that was pushed into the list during the gathering phase
+            ValueType* typedValue = static_cast<ValueType*>(baseValue);
+            // Are the two values different?
+            outDifferent = typedValue->GetValue() != value;
+        }
+        else
+        {
+            // No record? Then definitely different
+            outDifferent = true;
         }
 
+        // Record a bit to track this information
+        if (!m_delta.InsertDirtyBit(outDifferent))
+        {
+            AZ_Assert(false, "Ran out of bits in DeltaSerializerCreate. You are probably trying to serialize an object with too many fields. Consider resizing the bitset in DeltaSerializerCreate");
+            return false;
+        }
         return true;
     }
 
+    template <typename T>
+    bool DeltaSerializerCreate::SerializeHelper(T& value, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name)
+    {
+        bool different = false;
+        if (!CompareRecord(value, different))
+        {
+            return false;
+        }
+
+        // If different, also write the data into the delta's buffer
+        return !different || SerializeHelperImpl(value, bufferCapacity, isString, outSize, name);
+    }
+
+    template <typename T>
+    bool DeltaSerializerCreate::SerializeBoundedHelper(T& value, T minValue, T maxValue, const char* name)
+    {
+        bool different = false;
+        if (!CompareRecord(value, different))
+        {
+            return false;
+        }
+
+        // Forward the bounds so the value is packed in as few bytes as its range needs
+        return !different || m_dataSerializer.Serialize(value, name, minValue, maxValue);
+    }
+
     template <typename T>
     bool DeltaSerializerCreate::SerializeHelperImpl(T& value, uint32_t, bool, uint32_t&, const char* name)
     {
@@ -262,76 +277,75 @@ namespace AzNetworking
         return SerializerMode::WriteToObject;
     }
 
-    bool DeltaSerializerApply::Serialize(bool& value, const char* name)
+    bool DeltaSerializerApply::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        // Booleans are packed into the dirty bits, a changed value is followed by a bit holding the new value
+        bool hasRecord = false;
+        if (!ReadDirtyBit(hasRecord))
+        {
+            return false;
+        }
+
+        if (hasRecord)
+        {
+            return ReadDirtyBit(value);
+        }
+        return true;
     }
 
-    bool DeltaSerializerApply::Serialize(char& value, const char* name, [[maybe_unused]] char minValue, [[maybe_unused]] char maxValue)
+    bool DeltaSerializerApply::Serialize(char& value, const char* name, char minValue, char maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(int8_t& value, const char* name, [[maybe_unused]] int8_t minValue, [[maybe_unused]] int8_t maxValue)
+    bool DeltaSerializerApply::Serialize(int8_t& value, const char* name, int8_t minValue, int8_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(int16_t& value, const char* name, [[maybe_unused]] int16_t minValue, [[maybe_unused]] int16_t maxValue)
+    bool DeltaSerializerApply::Serialize(int16_t& value, const char* name, int16_t minValue, int16_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(int32_t& value, const char* name, [[maybe_unused]] int32_t minValue, [[maybe_unused]] int32_t maxValue)
+    bool DeltaSerializerApply::Serialize(int32_t& value, const char* name, int32_t minValue, int32_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(int64_t& value, const char* name, [[maybe_unused]] int64_t minValue, [[maybe_unused]] int64_t maxValue)
+    bool DeltaSerializerApply::Serialize(int64_t& value, const char* name, int64_t minValue, int64_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(uint8_t& value, const char* name, [[maybe_unused]] uint8_t minValue, [[maybe_unused]] uint8_t maxValue)
+    bool DeltaSerializerApply::Serialize(uint8_t& value, const char* name, uint8_t minValue, uint8_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(uint16_t& value, const char* name, [[maybe_unused]] uint16_t minValue, [[maybe_unused]] uint16_t maxValue)
+    bool DeltaSerializerApply::Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(uint32_t& value, const char* name, [[maybe_unused]] uint32_t minValue, [[maybe_unused]] uint32_t maxValue)
+    bool DeltaSerializerApply::Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(uint64_t& value, const char* name, [[maybe_unused]] uint64_t minValue, [[maybe_unused]] uint64_t maxValue)
+    bool DeltaSerializerApply::Serialize(uint64_t& value, const char* name, uint64_t minValue, uint64_t maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(float& value, const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    bool DeltaSerializerApply::Serialize(float& value, const char* name, float minValue, float maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
-    bool DeltaSerializerApply::Serialize(double& value, const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    bool DeltaSerializerApply::Serialize(double& value, const char* name, double minValue, double maxValue)
     {
-        uint32_t unused = 0;
-        return SerializeHelper(value, 0, false, unused, name);
+        return SerializeBoundedHelper(value, minValue, maxValue, name);
     }
 
     bool DeltaSerializerApply::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name)
@@ -364,8 +378,7 @@ namespace AzNetworking
         return 0;
     }
 
-    template <typename T>
-    bool DeltaSerializerApply::SerializeHelper(T& value, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name)
+    bool DeltaSerializerApply::ReadDirtyBit(bool& outDirtyBit)
     {
         // If we have run out of delta records, something has gone wrong
         if (m_nextDirtyBit >= m_delta.GetNumDirtyBits())
@@ -373,17 +386,35 @@ namespace AzNetworking
             return false;
         }
 
-        const bool hasRecord = m_delta.GetDirtyBit(m_nextDirtyBit);
+        outDirtyBit = m_delta.GetDirtyBit(m_nextDirtyBit);
         ++m_nextDirtyBit;
+        return true;
+    }
 
-        // No record in the delta for this field, just skip it
-        if (!hasRecord)
+    template <typename T>
+    bool DeltaSerializerApply::SerializeHelper(T& value, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name)
+    {
+        bool hasRecord = false;
+        if (!ReadDirtyBit(hasRecord))
         {
-            return true; // This isn't an error
+            return false;
+        }
+
+        // No record in the delta for this field, just skip it, this isn't an error
+        // Otherwise there is a record, so serialize the value out of the delta
+        return !hasRecord || SerializeHelperImpl(value, bufferCapacity, isString, outSize, name);
+    }
+
+    template <typename T>
+    bool DeltaSerializerApply::SerializeBoundedHelper(T& value, T minValue, T maxValue, const char* name)
+    {
+        bool hasRecord = false;
+        if (!ReadDirtyBit(hasRecord))
+        {
+            return false;
         }
 
-        // There is a record, so serialize the value out of the delta
-        return SerializeHelperImpl(value, bufferCapacity, isString, outSize, name);
+        return !hasRecord || m_dataSerializer.Serialize(value, name, minValue, maxValue);
     }
 
     template <typename T>
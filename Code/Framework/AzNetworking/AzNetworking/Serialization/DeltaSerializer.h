@@ -48,6 +48,7 @@ namespace AzNetworking
     //! A serializer that is used to produce a SerializerDelta between two objects.
     //! This delta can be reapplied to the same base object to reconstruct the second object using 
     //! the DeltaSerializerApply serializer
+    //! Changed values are written with the bounds they are serialized with, and booleans are stored in the dirty bits themselves
     //! NOTE: The objects serialized must have a consistent serialization footprint i.e. no changes in branches during serialization
     class DeltaSerializerCreate
         : public ISerializer
@@ -90,9 +91,15 @@ namespace AzNetworking
         DeltaSerializerCreate(const DeltaSerializerCreate&) = delete;
         DeltaSerializerCreate& operator=(const DeltaSerializerCreate&) = delete;
 
+        template <typename T>
+        bool CompareRecord(T& value, bool& outDifferent);
+
         template <typename T>
         bool SerializeHelper(T& value, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name);
 
+        template <typename T>
+        bool SerializeBoundedHelper(T& value, T minValue, T maxValue, const char* name);
+
         template <typename T>
         bool SerializeHelperImpl(T& value, uint32_t, bool, uint32_t&, const char* name);
         bool SerializeHelperImpl(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name);
@@ -149,9 +156,14 @@ namespace AzNetworking
         DeltaSerializerApply(const DeltaSerializerApply&) = delete;
         DeltaSerializerApply& operator=(const DeltaSerializerApply&) = delete;
 
+        bool ReadDirtyBit(bool& outDirtyBit);
+
         template <typename T>
         bool SerializeHelper(T& value, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name);
 
+        template <typename T>
+        bool SerializeBoundedHelper(T& value, T minValue, T maxValue, const char* name);
+
         template <typename T>
         bool SerializeHelperImpl(T& value, uint32_t, bool, uint32_t&, const char* name);
         bool SerializeHelperImpl(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name);
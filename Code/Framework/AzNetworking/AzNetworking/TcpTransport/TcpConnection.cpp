@@ -36,7 +36,10 @@ namespace AzNetworking
         , m_connectionRole(ConnectionRole::Acceptor)
         , m_registeredSocketFd(InvalidSocketFd)
     {
-        ;
+        // Both endpoints need a compressor, compressors may keep per connection state
+        const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_TcpCompressor);
+        const AZ::Name compressorName = AZ::Name(compressor);
+        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
     }
 
     TcpConnection::TcpConnection
@@ -122,7 +125,25 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
-        // Read new data off the input socket
+        if (m_receiveThread != nullptr)
+        {
+            // The receive thread already read the socket, process what it buffered
+            const uint32_t receivedBytes = m_pendingRecvBytes.exchange(0);
+            m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
+            m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
+            ProcessReceivedPackets(startTimeMs);
+
+            const DisconnectReason disconnectReason = m_pendingDisconnectReason.exchange(DisconnectReason::MAX);
+            if (disconnectReason != DisconnectReason::MAX)
+            {
+                Disconnect(disconnectReason, TerminationEndpoint::Remote);
+            }
+            m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+            return true;
+        }
+
+        // Read new data off the input socket, edge triggered socket managers only signal again for new data so read until the socket would block
+        for (;;)
         {
             uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
             if (srcData == nullptr)
@@ -136,7 +157,7 @@ namespace AzNetworking
             if (receivedBytes == 0)
             {
                 // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
+                break;
             }
 
             const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
@@ -148,41 +169,53 @@ namespace AzNetworking
             m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
             m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
             m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
+
+            // Process received packets before reading more, so that the ring buffer only has to hold a chunk at a time
+            ProcessReceivedPackets(startTimeMs);
+
+            if ((receivedBytes < static_cast<int32_t>(MaxPacketSize)) || (m_state == ConnectionState::Disconnected))
+            {
+                // A short read drained the socket
+                break;
+            }
         }
 
-        // Process received packets
+        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        return true;
+    }
+
+    bool TcpConnection::ReceiveFromSocket()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_recvMutex);
         for (;;)
         {
-            TcpPacketHeader header(PacketType(0), 0);
-            TcpPacketEncodingBuffer buffer;
+            uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
+            if (srcData == nullptr)
+            {
+                // Leave the data on the socket until UpdateRecv frees up the ring buffer
+                return false;
+            }
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
+            if (receivedBytes == 0)
             {
-                break;
+                return true;
             }
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
-            if (m_state == ConnectionState::Connecting)
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
+            if (disconnectReason != DisconnectReason::MAX)
             {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
-                {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
-                }
-                else
-                {
-                    m_state = ConnectionState::Connected;
-                }
+                m_pendingDisconnectReason = disconnectReason;
+                return true;
             }
+            m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
+            m_pendingRecvBytes += aznumeric_cast<uint32_t>(receivedBytes);
 
-            if (m_state == ConnectionState::Connected)
+            if (receivedBytes < static_cast<int32_t>(MaxPacketSize))
             {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                return true;
             }
         }
-
-        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
-        return true;
     }
 
     bool TcpConnection::SendReliablePacket(const IPacket& packet)
@@ -325,6 +358,43 @@ namespace AzNetworking
         return true;
     }
 
+    void TcpConnection::ProcessReceivedPackets(AZ::TimeMs currentTimeMs)
+    {
+        for (;;)
+        {
+            TcpPacketHeader header(PacketType(0), 0);
+            TcpPacketEncodingBuffer buffer;
+
+            {
+                // Only contended while a receive thread is bound, the packet is dispatched without holding the lock
+                AZStd::lock_guard<AZStd::mutex> lock(m_recvMutex);
+                if (!ReceivePacketInternal(header, buffer, currentTimeMs))
+                {
+                    break;
+                }
+            }
+
+            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+            if (m_state == ConnectionState::Connecting)
+            {
+                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+                if (connectResult == ConnectResult::Rejected)
+                {
+                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                }
+                else
+                {
+                    m_state = ConnectionState::Connected;
+                }
+            }
+
+            if (m_state == ConnectionState::Connected)
+            {
+                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+            }
+        }
+    }
+
     bool TcpConnection::ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& outBuffer, AZ::TimeMs currentTimeMs)
     {
         NetworkOutputSerializer serializer(m_recvRingbuffer.GetReadBufferData(), m_recvRingbuffer.GetReadBufferSize());
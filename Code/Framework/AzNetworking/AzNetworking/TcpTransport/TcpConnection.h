@@ -17,10 +17,13 @@
 #include <AzNetworking/TcpTransport/TlsSocket.h>
 #include <AzNetworking/TcpTransport/TcpRingBuffer.h>
 #include <AzNetworking/TcpTransport/TcpPacketHeader.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AzNetworking
 {
     class TcpNetworkInterface;
+    class TcpReceiveThread;
     class ICompressor;
 
     // 20 byte IPv4 header + 20 byte TCP header
@@ -82,6 +85,11 @@ namespace AzNetworking
         //! @return boolean true if the socket is still active, false if it has been remotely terminated
         bool UpdateRecv();
 
+        //! Reads all the pending data off the socket into the receive buffer, invoked by the receive thread bound to this connection.
+        //! The received packets are processed by the next call to UpdateRecv.
+        //! @return boolean true if the socket was drained, false if the receive buffer filled up first
+        bool ReceiveFromSocket();
+
         //! IConnection interface.
         // @{
         bool SendReliablePacket(const IPacket& packet) override;
@@ -102,8 +110,20 @@ namespace AzNetworking
         //! @return the socket file descriptor for this TcpConnection in the associated ConnectionSet instance
         SocketFd GetRegisteredSocketFd() const;
 
+        //! Sets the receive thread reading the socket of this TcpConnection, nullptr if UpdateRecv reads it.
+        //! @param receiveThread the receive thread reading the socket of this TcpConnection
+        void SetReceiveThread(TcpReceiveThread* receiveThread);
+
+        //! Returns the receive thread reading the socket of this TcpConnection, nullptr if UpdateRecv reads it.
+        //! @return the receive thread reading the socket of this TcpConnection
+        TcpReceiveThread* GetReceiveThread() const;
+
     private:
 
+        //! Decodes and dispatches all the complete packets in the receive buffer.
+        //! @param currentTimeMs current process time in milliseconds
+        void ProcessReceivedPackets(AZ::TimeMs currentTimeMs);
+
         //! Transmits a packet to the connected connection.
         //! @param packetType     packet type of the buffer being transmitted
         //! @param payloadBuffer  packet buffer to transmit
@@ -136,12 +156,18 @@ namespace AzNetworking
         ConnectionState m_state = ConnectionState::Disconnected;
         ConnectionRole  m_connectionRole = ConnectionRole::Connector;
         SocketFd        m_registeredSocketFd;
+        TcpReceiveThread* m_receiveThread = nullptr;
 
         static const uint32_t SendRingbufferSize = 1024 * 1024; // 1 MB send buffer
         TcpRingBuffer<SendRingbufferSize> m_sendRingbuffer;
 
         static const uint32_t RecvRingbufferSize = 1024 * 1024; // 1 MB recv buffer
         TcpRingBuffer<RecvRingbufferSize> m_recvRingbuffer;
+
+        // State shared with the receive thread, if any
+        AZStd::mutex m_recvMutex; //< guards m_recvRingbuffer while a receive thread is bound
+        AZStd::atomic<DisconnectReason> m_pendingDisconnectReason{ DisconnectReason::MAX };
+        AZStd::atomic<uint32_t> m_pendingRecvBytes{ 0 };
     };
 }
 
@@ -29,4 +29,14 @@ namespace AzNetworking
     {
         return m_registeredSocketFd;
     }
+
+    inline void TcpConnection::SetReceiveThread(TcpReceiveThread* receiveThread)
+    {
+        m_receiveThread = receiveThread;
+    }
+
+    inline TcpReceiveThread* TcpConnection::GetReceiveThread() const
+    {
+        return m_receiveThread;
+    }
 }
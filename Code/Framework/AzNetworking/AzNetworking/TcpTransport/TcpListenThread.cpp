@@ -9,10 +9,13 @@
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
 #include <AzNetworking/TcpTransport/TcpSocketManager.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace AzNetworking
 {
+    AZ_CVAR(bool, net_TcpListenSharedPort, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Open Tcp listen sockets with SO_REUSEPORT so that multiple processes can accept connections on the same port, requires SO_REUSEPORT support");
+
     static constexpr AZ::TimeMs ListenThreadUpdateRateMs{ 10 };
 
     TcpListenThread::TcpListenThread()
@@ -124,7 +127,11 @@ namespace AzNetworking
             {
                 if (listenPort.m_listenSocket.GetSocketFd() == socketFd)
                 {
-                    HandleSocketAccept((void*)&newConnection, connectionLength, listenPort);
+                    // Listen sockets may be edge triggered, accept until the backlog is empty
+                    while (HandleSocketAccept((void*)&newConnection, connectionLength, listenPort))
+                    {
+                        ;
+                    }
                 }
             };
             m_listenPorts.Visit(visitor);
@@ -148,6 +155,7 @@ namespace AzNetworking
         {
             if (listenPort.m_tcpNetworkInterface && !listenPort.m_listenSocket.IsOpen())
             {
+                listenPort.m_listenSocket.SetSharedPort(net_TcpListenSharedPort);
                 if (!listenPort.m_listenSocket.Listen(listenPort.m_listenPort))
                 {
                     listenPort.m_listenSocket.Close();
@@ -174,6 +182,10 @@ namespace AzNetworking
         if (newSocketFd <= SocketFd{ 0 })
         {
             const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // Filter would block messages, the backlog is empty
+            {
+                return false;
+            }
             AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
             return false;
         }
@@ -186,6 +198,11 @@ namespace AzNetworking
             newConnectionSockAddrIn->sin_port,
             listenPort.m_listenPort
         );
+        if (listenPort.m_tcpNetworkInterface == nullptr)
+        {
+            CloseSocket(newSocketFd);
+            return true;
+        }
         listenPort.m_tcpNetworkInterface->QueueNewConnection(pendingConnection);
         return true;
     }
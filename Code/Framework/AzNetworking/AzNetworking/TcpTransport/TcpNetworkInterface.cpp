@@ -21,17 +21,37 @@ namespace AzNetworking
     static const bool net_TcpUseEncryption = false;
 #endif
 
+    AZ_CVAR(uint32_t, net_TcpReceiveThreadCount, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of threads reading the sockets of unencrypted Tcp connections, 0 reads them on the network interface update, requires epoll support");
+
     TcpNetworkInterface::TcpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThread& listenThread)
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
         , m_listenThread(listenThread)
     {
-        ;
+#if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
+        // The threads are started when the first connection is bound to them
+        const uint32_t receiveThreadCount = AZStd::min<uint32_t>(net_TcpReceiveThreadCount, MaxReceiveThreadCount);
+        for (uint32_t i = 0; i < receiveThreadCount; ++i)
+        {
+            m_receiveThreads.emplace_back(AZStd::make_unique<TcpReceiveThread>(*this));
+        }
+#else
+        if (net_TcpReceiveThreadCount > 0)
+        {
+            AZLOG_WARN("net_TcpReceiveThreadCount requires epoll support, Tcp sockets are read on the network interface update");
+        }
+#endif
     }
 
     TcpNetworkInterface::~TcpNetworkInterface()
     {
+        // Stop reading the sockets before deleting the connections
+        for (AZStd::unique_ptr<TcpReceiveThread>& receiveThread : m_receiveThreads)
+        {
+            receiveThread->Stop();
+            receiveThread->Join();
+        }
         FlushQueuedRemoves();
         m_listenThread.StopListening(*this);
     }
@@ -95,7 +115,9 @@ namespace AzNetworking
         AZLOG_INFO("Adding new socket %d", static_cast<int32_t>(tcpSocket->GetSocketFd()));
         connection->SendReliablePacket(CorePackets::InitiateConnectionPacket());
         m_connectionListener.OnConnect(connection.get());
+        TcpConnection* tcpConnection = connection.get();
         m_connectionSet.AddConnection(AZStd::move(connection));
+        BindReceiveThread(tcpConnection);
         return connectionId;
     }
 
@@ -109,6 +131,17 @@ namespace AzNetworking
         auto writeCallback = [this](SocketFd socketFd) { HandleConnectionSend(socketFd); };
         m_tcpSocketManager.ProcessEvents(AZ::Time::ZeroTimeMs, readCallback, writeCallback);
 
+        // Early out to avoid the deque below invoking a heap allocation
+        if (m_receivedSockets.Size() > 0)
+        {
+            AZ::ThreadSafeDeque<SocketFd>::DequeType receivedSockets;
+            m_receivedSockets.Swap(receivedSockets);
+            for (const SocketFd socketFd : receivedSockets)
+            {
+                HandleConnectionRecv(socketFd, startTimeMs);
+            }
+        }
+
         FlushQueuedRemoves();
 
         // Update metrics
@@ -177,6 +210,31 @@ namespace AzNetworking
         m_pendingConnections.PushBackItem(pendingConnection);
     }
 
+    void TcpNetworkInterface::QueueReceivedData(SocketFd socketFd)
+    {
+        m_receivedSockets.PushBackItem(socketFd);
+    }
+
+    void TcpNetworkInterface::BindReceiveThread(TcpConnection* connection)
+    {
+        // Tls sockets are left on the update thread, OpenSSL doesn't support reading and writing a session from different threads
+        if (m_receiveThreads.empty() || connection->GetTcpSocket()->IsEncrypted())
+        {
+            return;
+        }
+
+        TcpReceiveThread* receiveThread = m_receiveThreads[m_nextReceiveThread].get();
+        m_nextReceiveThread = (m_nextReceiveThread + 1) % aznumeric_cast<uint32_t>(m_receiveThreads.size());
+
+        // Bound before the thread can read the socket, so that UpdateRecv stops reading it
+        connection->SetReceiveThread(receiveThread);
+        if (!receiveThread->AddConnection(connection))
+        {
+            connection->SetReceiveThread(nullptr);
+            AZLOG_WARN("Failed to bind socket %d to a receive thread, reading it on the network interface update", static_cast<int32_t>(connection->GetRegisteredSocketFd()));
+        }
+    }
+
     bool TcpNetworkInterface::HandleConnectionRecv(SocketFd socketFd, [[maybe_unused]] AZ::TimeMs currentTimeMs)
     {
         TcpConnection* connection = m_connectionSet.GetConnection(socketFd);
@@ -248,7 +306,9 @@ namespace AzNetworking
         AZStd::unique_ptr<TcpConnection> connection = AZStd::make_unique<TcpConnection>(connectionId, remoteAddress, *this, tcpSocket);
         AZ_Assert(connection->GetConnectionRole() == ConnectionRole::Acceptor, "Invalid role for connection");
         GetConnectionListener().OnConnect(connection.get());
+        TcpConnection* tcpConnection = connection.get();
         m_connectionSet.AddConnection(AZStd::move(connection));
+        BindReceiveThread(tcpConnection);
     }
 
     void TcpNetworkInterface::FlushQueuedRemoves()
@@ -265,6 +325,11 @@ namespace AzNetworking
             }
 
             AZLOG_INFO("Removing socket %d due to %s", static_cast<int32_t>(socketFd), AZStd::string(ToString(reason)).c_str());
+            if (TcpReceiveThread* receiveThread = connection->GetReceiveThread())
+            {
+                receiveThread->RemoveConnection(connection);
+                connection->SetReceiveThread(nullptr);
+            }
             m_tcpSocketManager.ClearSocket(socketFd);
             m_connectionSet.DeleteConnection(socketFd);
         }
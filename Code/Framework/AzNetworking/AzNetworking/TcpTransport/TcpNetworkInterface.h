@@ -11,6 +11,7 @@
 #include <AzNetworking/TcpTransport/TcpPacketHeader.h>
 #include <AzNetworking/TcpTransport/TcpConnectionSet.h>
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
+#include <AzNetworking/TcpTransport/TcpReceiveThread.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
@@ -59,6 +60,11 @@ namespace AzNetworking
     //! 
     //! AzNetworking uses the [OpenSSL](https://www.openssl.org/) library to implement TLS encryption. If enabled,
     //! the O3DE network layer handles the OpenSSL handshake under the hood using provided certificates.
+    //!
+    //! ## Threading
+    //!
+    //! With epoll, the sockets of unencrypted connections can be read by a pool of receive threads, set by net_TcpReceiveThreadCount.
+    //! Packets are still decoded and dispatched on the thread updating the network interface.
     class TcpNetworkInterface final
         : public INetworkInterface
     {
@@ -107,8 +113,19 @@ namespace AzNetworking
         //! @param pendingConnection info on the new incoming connection
         void QueueNewConnection(const PendingConnection& pendingConnection);
 
+        //! Bounds the number of receive threads a network interface can use.
+        static constexpr uint32_t MaxReceiveThreadCount = 16;
+
     private:
 
+        //! Queues a connection whose receive thread buffered new data, to be processed on the next update.
+        //! @param socketFd socket descriptor of the connection with new incoming data
+        void QueueReceivedData(SocketFd socketFd);
+
+        //! Binds a new connection to one of the receive threads, if any.
+        //! @param connection pointer to the connection to bind
+        void BindReceiveThread(TcpConnection* connection);
+
         //! Performs connection receive updates for a single socket.
         //! @param socketFd      socket descriptor with new incoming data
         //! @param currentTimeMs current time in milliseconds for metrics management
@@ -151,9 +168,13 @@ namespace AzNetworking
         TcpConnectionSet m_connectionSet;
         TcpSocketManager m_tcpSocketManager;
         AZ::ThreadSafeDeque<PendingConnection> m_pendingConnections;
+        AZ::ThreadSafeDeque<SocketFd> m_receivedSockets;
         AZStd::vector<PendingRemove> m_pendingRemoves;
+        AZStd::vector<AZStd::unique_ptr<TcpReceiveThread>> m_receiveThreads;
+        uint32_t m_nextReceiveThread = 0;
         TcpListenThread& m_listenThread;
 
         friend class TcpConnection; // For access to private RequestDisconnect() method
+        friend class TcpReceiveThread; // For access to private QueueReceivedData() method
     };
 }
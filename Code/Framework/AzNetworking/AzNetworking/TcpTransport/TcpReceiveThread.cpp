@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/TcpTransport/TcpReceiveThread.h>
+#include <AzNetworking/TcpTransport/TcpConnection.h>
+#include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    // Bounds how long the thread blocks waiting on its sockets, and so how long stopping the thread can take
+    static constexpr AZ::TimeMs ReceiveThreadUpdateRateMs{ 10 };
+
+    TcpReceiveThread::TcpReceiveThread(TcpNetworkInterface& networkInterface)
+        : TimedThread("AzNetworking::TcpReceiveThread", ReceiveThreadUpdateRateMs)
+        , m_networkInterface(networkInterface)
+    {
+        ;
+    }
+
+    TcpReceiveThread::~TcpReceiveThread()
+    {
+        Stop();
+        Join();
+    }
+
+    bool TcpReceiveThread::AddConnection(TcpConnection* connection)
+    {
+        const SocketFd socketFd = connection->GetTcpSocket()->GetSocketFd();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_tcpSocketManager.AddSocket(socketFd))
+            {
+                return false;
+            }
+            m_connections[socketFd] = connection;
+        }
+
+        if (!IsRunning())
+        {
+            Start();
+        }
+        return true;
+    }
+
+    void TcpReceiveThread::RemoveConnection(TcpConnection* connection)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto iter = m_connections.find(connection->GetTcpSocket()->GetSocketFd());
+        if ((iter == m_connections.end()) || (iter->second != connection))
+        {
+            return;
+        }
+        m_tcpSocketManager.ClearSocket(iter->first);
+        m_connections.erase(iter);
+        m_starvedConnections.erase(AZStd::remove(m_starvedConnections.begin(), m_starvedConnections.end(), connection), m_starvedConnections.end());
+    }
+
+    uint32_t TcpReceiveThread::GetConnectionCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_connections.size());
+    }
+
+    AZ::TimeMs TcpReceiveThread::GetUpdateTimeMs() const
+    {
+        return m_updateTimeMs;
+    }
+
+    void TcpReceiveThread::OnStart()
+    {
+        AZLOG_INFO("Starting TcpReceiveThread");
+    }
+
+    void TcpReceiveThread::OnStop()
+    {
+        AZLOG_INFO("Stopping TcpReceiveThread");
+    }
+
+    void TcpReceiveThread::OnUpdate(AZ::TimeMs updateRateMs)
+    {
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+
+        auto receive = [this](TcpConnection* connection)
+        {
+            if (!connection->ReceiveFromSocket())
+            {
+                m_starvedConnections.push_back(connection);
+            }
+            m_networkInterface.QueueReceivedData(connection->GetRegisteredSocketFd());
+        };
+        auto readCallback = [this, &receive](SocketFd socketFd)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto iter = m_connections.find(socketFd);
+            if (iter != m_connections.end())
+            {
+                receive(iter->second);
+            }
+        };
+        auto writeCallback = [](SocketFd) {};
+
+        // Stay in the event loop for the whole update, returning early would make the timed thread sleep with data waiting
+        AZStd::vector<TcpConnection*> starvedConnections;
+        for (AZ::TimeMs elapsedTimeMs = AZ::Time::ZeroTimeMs; elapsedTimeMs < updateRateMs; elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs)
+        {
+            // Edge triggered sockets don't signal again for data already waiting, retry the connections whose receive buffer was full
+            bool hasStarvedConnections = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                starvedConnections.swap(m_starvedConnections);
+                for (TcpConnection* connection : starvedConnections)
+                {
+                    receive(connection);
+                }
+                starvedConnections.clear();
+                hasStarvedConnections = !m_starvedConnections.empty();
+            }
+
+            // Poll while connections are starved, their receive buffers are drained by the network interface update
+            const AZ::TimeMs maxBlockMs = hasStarvedConnections ? AZ::TimeMs{ 1 } : (updateRateMs - elapsedTimeMs);
+            m_tcpSocketManager.ProcessEvents(maxBlockMs, readCallback, writeCallback);
+        }
+
+        m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/TcpTransport/TcpSocketManager.h>
+#include <AzNetworking/Utilities/TimedThread.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AzNetworking
+{
+    class TcpConnection;
+    class TcpNetworkInterface;
+
+    //! @class TcpReceiveThread
+    //! @brief reads the incoming data of a set of TCP connections into their receive buffers for deferred processing.
+    //! Packets are still decoded and dispatched by the network interface on its own update, this only moves the socket reads off that thread.
+    class TcpReceiveThread final
+        : public TimedThread
+    {
+    public:
+
+        TcpReceiveThread(TcpNetworkInterface& networkInterface);
+        ~TcpReceiveThread() override;
+
+        //! Adds the provided connection to the receive thread for processing.
+        //! @param connection pointer to the TcpConnection to read incoming data for
+        //! @return boolean true on success, false for failure
+        bool AddConnection(TcpConnection* connection);
+
+        //! Removes the provided connection from the receive thread, once this returns the thread no longer accesses the connection.
+        //! @param connection pointer to the TcpConnection to stop reading incoming data for
+        void RemoveConnection(TcpConnection* connection);
+
+        //! Returns the number of connections bound to this thread.
+        //! @return the number of connections bound to this thread
+        uint32_t GetConnectionCount() const;
+
+        //! Gets the total elapsed time spent updating the background thread in milliseconds
+        //! @return the total elapsed time spent updating the background thread in milliseconds
+        AZ::TimeMs GetUpdateTimeMs() const;
+
+    private:
+
+        void OnStart() override;
+        void OnStop() override;
+        void OnUpdate(AZ::TimeMs updateRateMs) override;
+
+        AZ_DISABLE_COPY_MOVE(TcpReceiveThread);
+
+        TcpNetworkInterface& m_networkInterface;
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<SocketFd, TcpConnection*> m_connections;
+        AZStd::vector<TcpConnection*> m_starvedConnections; //< connections with a full receive buffer, read again on the next update
+        TcpSocketManager m_tcpSocketManager;
+        AZ::TimeMs m_updateTimeMs = AZ::Time::ZeroTimeMs;
+    };
+}
@@ -85,6 +85,12 @@ namespace AzNetworking
         m_socketFd = InvalidSocketFd;
     }
 
+    void TcpSocket::SetSharedPort(bool sharedPort)
+    {
+        AZ_Assert(!IsOpen(), "SetSharedPort must be called before the socket is opened");
+        m_sharedPort = sharedPort;
+    }
+
     int32_t TcpSocket::Send(const uint8_t* data, uint32_t size) const
     {
         AZ_Assert(size > 0, "Invalid data size for send");
@@ -148,6 +154,19 @@ namespace AzNetworking
 
     bool TcpSocket::BindSocketForListenInternal(uint16_t port)
     {
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        if (m_sharedPort)
+        {
+            const int32_t reusePort = 1;
+            if (setsockopt(static_cast<int32_t>(m_socketFd), SOL_SOCKET, SO_REUSEPORT, (const char*)&reusePort, sizeof(reusePort)) != SocketOpResultSuccess)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_ERROR("Failed to enable port sharing for TCP socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                return false;
+            }
+        }
+#endif
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -49,6 +49,11 @@ namespace AzNetworking
         //! Closes an open socket.
         virtual void Close();
 
+        //! Allows multiple listen sockets to be bound to the same port, incoming connections are distributed between them by the kernel.
+        //! Has no effect on platforms without SO_REUSEPORT support, and must be called before Listen.
+        //! @param sharedPort if true, the socket will listen on a port that can be shared with other sockets
+        void SetSharedPort(bool sharedPort);
+
         //! Returns true if the socket is currently in an open state.
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
@@ -85,6 +90,7 @@ namespace AzNetworking
         bool SocketCreateInternal();
 
         SocketFd m_socketFd;
+        bool m_sharedPort = false;
     };
 }
 
@@ -22,6 +22,7 @@ namespace AzNetworking
 {
     //! @class TcpSocketManager
     //! @brief internal helper implementation that manages basic details related to handling large numbers of TCP sockets efficiently.
+    //! With epoll the sockets are edge triggered, so the callbacks must read or write until the socket would block.
     class TcpSocketManager
     {
     public:
@@ -29,6 +30,7 @@ namespace AzNetworking
         using SocketEventCallback = AZStd::function<void(SocketFd)>;
 
         TcpSocketManager();
+        ~TcpSocketManager();
 
         //! Adds the provided socket to the internal socket management mechanism.
         //! @param socketFd the socket file descriptor to add
@@ -28,6 +28,11 @@ namespace AzNetworking
         }
     }
 
+    TcpSocketManager::~TcpSocketManager()
+    {
+        CloseSocket(m_epollFd);
+    }
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         if (socketFd < SocketFd{ 0 })
@@ -52,6 +57,9 @@ namespace AzNetworking
 
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
+        // Closing the socket removes it from the epoll set as well, but the socket may be shared with other socket managers
+        struct epoll_event fdEvents = {};
+        epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), &fdEvents);
         ClearSocketHelper(socketFd);
         return true;
     }
@@ -59,8 +67,8 @@ namespace AzNetworking
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
-        if (numEpollEvents < 0)
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
+        if ((numEpollEvents < 0) && (GetLastNetworkError() != EINTR))
         {
             const int32_t error = GetLastNetworkError();
             AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
@@ -71,7 +79,8 @@ namespace AzNetworking
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+                // Errors and hangups are surfaced through the read callback, the failed read disconnects the socket
+                if (socketEvents[event].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
                 {
                     readCallback(socketFd);
                 }
@@ -17,11 +17,38 @@
 #if AZ_TRAIT_USE_OPENSSL
 #   include <openssl/ssl.h>
 #   include <openssl/err.h>
+#   include <openssl/evp.h>
 #endif
 
 namespace AzNetworking
 {
     AZ_CVAR(bool, net_UseDtlsCookies, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables DTLS cookie exchange during the connection handshake");
+    AZ_CVAR(bool, net_DtlsDirectRecords, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Once the DTLS handshake completes, encrypt datagrams with AEAD keys exported from the session instead of through the OpenSSL record layer"); // WARN: both endpoints must use the same setting
+
+    static constexpr uint32_t DirectRecordKeySize = 32;
+    static constexpr uint32_t DirectRecordNonceSize = 12;
+    static constexpr int32_t DirectRecordSequenceSize = 8;
+    static constexpr int32_t DirectRecordTagSize = 16;
+    static constexpr char DirectRecordExportLabel[] = "EXPORTER-AzNetworking-DirectRecords";
+
+    static void WriteDirectRecordSequence(uint64_t sequence, uint8_t* outData)
+    {
+        for (int32_t i = DirectRecordSequenceSize - 1; i >= 0; --i)
+        {
+            outData[i] = static_cast<uint8_t>(sequence);
+            sequence >>= 8;
+        }
+    }
+
+    static uint64_t ReadDirectRecordSequence(const uint8_t* data)
+    {
+        uint64_t sequence = 0;
+        for (int32_t i = 0; i < DirectRecordSequenceSize; ++i)
+        {
+            sequence = (sequence << 8) | data[i];
+        }
+        return sequence;
+    }
 
     DtlsEndpoint::DtlsEndpoint()
         : m_state(HandshakeState::None)
@@ -34,6 +61,7 @@ namespace AzNetworking
 
     DtlsEndpoint::~DtlsEndpoint()
     {
+        ResetDirectRecordsInternal();
         Close(m_sslSocket); // Note this also closes any attached BIO instances
         m_readBio = nullptr;
         m_writeBio = nullptr;
@@ -115,6 +143,11 @@ namespace AzNetworking
             return encryptedData;
         }
 #if AZ_TRAIT_USE_OPENSSL
+        if (HasDirectRecords())
+        {
+            outDecodedSize = DecodeDirectRecord(encryptedData, encryptedSize, outDecodedData);
+            return outDecodedData;
+        }
 
         int32_t bioWriteSize = BIO_write(m_readBio, encryptedData, encryptedSize);
         if (m_state != HandshakeState::Failed)
@@ -129,8 +162,160 @@ namespace AzNetworking
         return outDecodedData;
     }
 
+    bool DtlsEndpoint::HasDirectRecords() const
+    {
+        return (m_sendCipher != nullptr) && (m_state == HandshakeState::Complete);
+    }
+
+    int32_t DtlsEndpoint::EncodeDirectRecord([[maybe_unused]] const uint8_t* data, [[maybe_unused]] int32_t size, [[maybe_unused]] uint8_t* outData)
+    {
+        int32_t recordSize = -1;
+#if AZ_TRAIT_USE_OPENSSL
+        uint8_t nonce[DirectRecordNonceSize];
+        memcpy(nonce, m_sendSalt, DirectRecordSaltSize);
+        WriteDirectRecordSequence(m_sendSequence, nonce + DirectRecordSaltSize);
+
+        // The sequence number is sent in the clear and authenticated as additional data
+        memcpy(outData, nonce + DirectRecordSaltSize, DirectRecordSequenceSize);
+        uint8_t* cipherText = outData + DirectRecordSequenceSize;
+        int32_t cipherTextSize = 0;
+        int32_t finalSize = 0;
+        if ((EVP_EncryptInit_ex(m_sendCipher, nullptr, nullptr, nullptr, nonce) == OpenSslResultSuccess)
+         && (EVP_EncryptUpdate(m_sendCipher, nullptr, &cipherTextSize, outData, DirectRecordSequenceSize) == OpenSslResultSuccess)
+         && (EVP_EncryptUpdate(m_sendCipher, cipherText, &cipherTextSize, data, size) == OpenSslResultSuccess)
+         && (EVP_EncryptFinal_ex(m_sendCipher, cipherText + cipherTextSize, &finalSize) == OpenSslResultSuccess)
+         && (EVP_CIPHER_CTX_ctrl(m_sendCipher, EVP_CTRL_AEAD_GET_TAG, DirectRecordTagSize, cipherText + cipherTextSize + finalSize) == OpenSslResultSuccess))
+        {
+            recordSize = DirectRecordSequenceSize + cipherTextSize + finalSize + DirectRecordTagSize;
+        }
+        else
+        {
+            AZLOG_ERROR("Failed to encrypt dtls direct record");
+            PrintSslErrorStack();
+        }
+        // Never reuse a nonce, even if encryption failed part way through
+        ++m_sendSequence;
+#endif
+        return recordSize;
+    }
+
+    int32_t DtlsEndpoint::DecodeDirectRecord([[maybe_unused]] const uint8_t* data, [[maybe_unused]] int32_t size, [[maybe_unused]] uint8_t* outData)
+    {
+#if AZ_TRAIT_USE_OPENSSL
+        if (size < DirectRecordOverhead)
+        {
+            return -1;
+        }
+
+        const uint64_t sequence = ReadDirectRecordSequence(data);
+        const bool isNewest = (m_recvWindow == 0) || (sequence > m_recvSequence);
+        if (!isNewest)
+        {
+            const uint64_t age = m_recvSequence - sequence;
+            if ((age >= 64) || (m_recvWindow & (uint64_t(1) << age)))
+            {
+                // Too old to tell apart from a replay, or a replay
+                return -1;
+            }
+        }
+
+        uint8_t nonce[DirectRecordNonceSize];
+        memcpy(nonce, m_recvSalt, DirectRecordSaltSize);
+        memcpy(nonce + DirectRecordSaltSize, data, DirectRecordSequenceSize);
+
+        const uint8_t* cipherText = data + DirectRecordSequenceSize;
+        const int32_t cipherTextSize = size - DirectRecordOverhead;
+        int32_t plainTextSize = 0;
+        int32_t finalSize = 0;
+        if ((EVP_DecryptInit_ex(m_recvCipher, nullptr, nullptr, nullptr, nonce) != OpenSslResultSuccess)
+         || (EVP_DecryptUpdate(m_recvCipher, nullptr, &plainTextSize, data, DirectRecordSequenceSize) != OpenSslResultSuccess)
+         || (EVP_DecryptUpdate(m_recvCipher, outData, &plainTextSize, cipherText, cipherTextSize) != OpenSslResultSuccess)
+         || (EVP_CIPHER_CTX_ctrl(m_recvCipher, EVP_CTRL_AEAD_SET_TAG, DirectRecordTagSize, const_cast<uint8_t*>(cipherText + cipherTextSize)) != OpenSslResultSuccess)
+         || (EVP_DecryptFinal_ex(m_recvCipher, outData + plainTextSize, &finalSize) != OpenSslResultSuccess))
+        {
+            // Authentication failed, garbage or a late packet from the record layer
+            return -1;
+        }
+
+        // Only authenticated records move the replay window
+        if (isNewest)
+        {
+            const uint64_t shift = (m_recvWindow == 0) ? 0 : (sequence - m_recvSequence);
+            m_recvWindow = (shift >= 64) ? 1 : ((m_recvWindow << shift) | 1);
+            m_recvSequence = sequence;
+        }
+        else
+        {
+            m_recvWindow |= uint64_t(1) << (m_recvSequence - sequence);
+        }
+        return plainTextSize + finalSize;
+#else
+        return -1;
+#endif
+    }
+
+    bool DtlsEndpoint::SetupDirectRecordsInternal([[maybe_unused]] bool isConnector)
+    {
+        ResetDirectRecordsInternal();
+#if AZ_TRAIT_USE_OPENSSL
+        // Both endpoints derive the same material from the session, the connector sends with the first key and salt
+        uint8_t keyMaterial[2 * (DirectRecordKeySize + DirectRecordSaltSize)];
+        if (SSL_export_keying_material(m_sslSocket, keyMaterial, sizeof(keyMaterial),
+            DirectRecordExportLabel, sizeof(DirectRecordExportLabel) - 1, nullptr, 0, 0) != OpenSslResultSuccess)
+        {
+            AZLOG_ERROR("Failed to export dtls direct record keys");
+            PrintSslErrorStack();
+            return false;
+        }
+        const uint8_t* connectorKey = keyMaterial;
+        const uint8_t* acceptorKey = connectorKey + DirectRecordKeySize;
+        const uint8_t* connectorSalt = acceptorKey + DirectRecordKeySize;
+        const uint8_t* acceptorSalt = connectorSalt + DirectRecordSaltSize;
+        memcpy(m_sendSalt, isConnector ? connectorSalt : acceptorSalt, DirectRecordSaltSize);
+        memcpy(m_recvSalt, isConnector ? acceptorSalt : connectorSalt, DirectRecordSaltSize);
+
+        // Follow the negotiated cipher suite, ChaCha20-Poly1305 is picked by peers without AES hardware support, AES-GCM uses AES-NI where available
+        const SSL_CIPHER* sslCipher = SSL_get_current_cipher(m_sslSocket);
+        const EVP_CIPHER* cipher = ((sslCipher != nullptr) && (SSL_CIPHER_get_cipher_nid(sslCipher) == NID_chacha20_poly1305))
+            ? EVP_chacha20_poly1305()
+            : EVP_aes_256_gcm();
+
+        m_sendCipher = EVP_CIPHER_CTX_new();
+        m_recvCipher = EVP_CIPHER_CTX_new();
+        const bool result = (m_sendCipher != nullptr) && (m_recvCipher != nullptr)
+            && (EVP_EncryptInit_ex(m_sendCipher, cipher, nullptr, isConnector ? connectorKey : acceptorKey, nullptr) == OpenSslResultSuccess)
+            && (EVP_DecryptInit_ex(m_recvCipher, cipher, nullptr, isConnector ? acceptorKey : connectorKey, nullptr) == OpenSslResultSuccess);
+        OPENSSL_cleanse(keyMaterial, sizeof(keyMaterial));
+        if (!result)
+        {
+            AZLOG_ERROR("Failed to initialize dtls direct record ciphers");
+            PrintSslErrorStack();
+            ResetDirectRecordsInternal();
+            return false;
+        }
+        AZLOG(NET_DebugDtls, "dtls direct records enabled with %s", EVP_CIPHER_name(cipher));
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void DtlsEndpoint::ResetDirectRecordsInternal()
+    {
+#if AZ_TRAIT_USE_OPENSSL
+        EVP_CIPHER_CTX_free(m_sendCipher);
+        EVP_CIPHER_CTX_free(m_recvCipher);
+#endif
+        m_sendCipher = nullptr;
+        m_recvCipher = nullptr;
+        m_sendSequence = 0;
+        m_recvSequence = 0;
+        m_recvWindow = 0;
+    }
+
     DtlsEndpoint::ConnectResult DtlsEndpoint::ConstructEndpointInternal([[maybe_unused]] const DtlsSocket& socket, [[maybe_unused]] const IpAddress& address)
     {
+        ResetDirectRecordsInternal();
         if (m_sslSocket != nullptr)
         {
             AZLOG_WARN("An existing SSL socket was open during a call to connect, closing old socket");
@@ -185,10 +370,18 @@ namespace AzNetworking
             }
         }
 
-        if (SSL_is_init_finished(m_sslSocket))
+        if ((m_sslSocket != nullptr) && SSL_is_init_finished(m_sslSocket))
         {
             const char* stateString = GetEnumString(m_state);
             AZLOG(NET_DebugDtls, "dtls handshake is completed, unblocking connection for game traffic, prior state: %s", stateString);
+            if (net_DtlsDirectRecords && (m_state != HandshakeState::Complete) && !SetupDirectRecordsInternal(m_state == HandshakeState::Connecting))
+            {
+                Close(m_sslSocket);
+                m_readBio = nullptr;
+                m_writeBio = nullptr;
+                m_state = HandshakeState::Failed;
+                return ConnectResult::Failed;
+            }
             m_state = HandshakeState::Complete;
             connectResult = ConnectResult::Complete;
         }
@@ -15,6 +15,7 @@
 typedef struct ssl_st SSL;
 typedef struct ssl_ctx_st SSL_CTX;
 typedef struct bio_st BIO;
+typedef struct evp_cipher_ctx_st EVP_CIPHER_CTX;
 
 namespace AzNetworking
 {
@@ -47,6 +48,9 @@ namespace AzNetworking
             Failed      // Handshake failed
         };
 
+        //! Bytes added to each datagram encrypted with direct records, the sequence number and the authentication tag.
+        static constexpr int32_t DirectRecordOverhead = 8 + 16;
+
         DtlsEndpoint();
         ~DtlsEndpoint();
 
@@ -83,6 +87,17 @@ namespace AzNetworking
         //! @return pointer to the decoded data
         const uint8_t* DecodePacket(UdpConnection& connection, const uint8_t* encryptedData, int32_t encryptedSize, uint8_t* outDecodedData, int32_t& outDecodedSize);
 
+        //! Returns whether datagrams are encrypted directly with keys exported from the dtls session, bypassing the OpenSSL record layer.
+        //! @return true if the handshake is complete and direct records are enabled
+        bool HasDirectRecords() const;
+
+        //! Encrypts and authenticates a datagram with the keys exported from the dtls session.
+        //! @param data    the data to encrypt
+        //! @param size    the size of the data to encrypt
+        //! @param outData an output buffer of at least size + DirectRecordOverhead bytes to store the encrypted record
+        //! @return the size of the encrypted record, negative on failure
+        int32_t EncodeDirectRecord(const uint8_t* data, int32_t size, uint8_t* outData);
+
     private:
 
         //! Performs internal common dtls endpoint setup.
@@ -96,11 +111,37 @@ namespace AzNetworking
         //! @return a connect result specifying whether the connection is still pending, failed, or complete
         ConnectResult PerformHandshakeInternal(UdpPacketEncodingBuffer& outHandshakeData);
 
+        //! Exports the direct record keys from the completed dtls session.
+        //! @param isConnector true if this endpoint initiated the connection
+        //! @return boolean true on success
+        bool SetupDirectRecordsInternal(bool isConnector);
+
+        //! Releases the direct record keys and resets the sequence numbers.
+        void ResetDirectRecordsInternal();
+
+        //! Authenticates and decrypts a datagram encrypted with EncodeDirectRecord by the remote endpoint.
+        //! @param data    the encrypted record
+        //! @param size    the size of the encrypted record
+        //! @param outData an output buffer of at least size bytes to store the decrypted data
+        //! @return the size of the decrypted data, negative if the record is invalid or replayed
+        int32_t DecodeDirectRecord(const uint8_t* data, int32_t size, uint8_t* outData);
+
+        static constexpr uint32_t DirectRecordSaltSize = 4;
+
         HandshakeState m_state;
         IpAddress m_address;
         SSL* m_sslSocket;
         BIO* m_readBio;
         BIO* m_writeBio;
+
+        // The AEAD contexts are keyed once, each record only sets its nonce, the salt followed by the sequence number
+        EVP_CIPHER_CTX* m_sendCipher = nullptr;
+        EVP_CIPHER_CTX* m_recvCipher = nullptr;
+        uint8_t m_sendSalt[DirectRecordSaltSize] = {};
+        uint8_t m_recvSalt[DirectRecordSaltSize] = {};
+        uint64_t m_sendSequence = 0;
+        uint64_t m_recvSequence = 0; //< highest sequence number received
+        uint64_t m_recvWindow = 0;   //< bit n is set if m_recvSequence - n was received, replayed records are discarded
     };
 
     const char* GetEnumString(DtlsEndpoint::HandshakeState value);
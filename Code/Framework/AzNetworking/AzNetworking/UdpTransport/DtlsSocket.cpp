@@ -84,6 +84,20 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
+        if (dtlsEndpoint.HasDirectRecords())
+        {
+            // Encrypted straight into the datagram, skipping the copies through the memory BIOs
+            uint8_t directSendBuffer[MaxUdpTransmissionUnit + DtlsEndpoint::DirectRecordOverhead];
+            const int32_t recordSize = dtlsEndpoint.EncodeDirectRecord(data, aznumeric_cast<int32_t>(size), directSendBuffer);
+            if (recordSize < 0)
+            {
+                return SocketOpResultError;
+            }
+            m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(recordSize - aznumeric_cast<int32_t>(size));
+            m_sentPacketsEncrypted++;
+            return UdpSocket::SendInternal(address, directSendBuffer, recordSize, encrypt, dtlsEndpoint);
+        }
+
         uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
         // Write out the packet we were requested to send
         SSL_write(dtlsEndpoint.m_sslSocket, data, size);
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpBbrCongestionController.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(AZ::TimeMs, net_UdpPacingBurstMs, AZ::TimeMs{ 33 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Milliseconds of send budget a paced Udp connection may accumulate, this should cover the interval between network updates");
+    AZ_CVAR(AZ::TimeMs, net_UdpMinRttWindowMs, AZ::TimeMs{ 10000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Milliseconds a minimum round trip time sample is trusted for before a paced Udp connection probes it again");
+    AZ_CVAR(AZ::TimeMs, net_UdpProbeRttDurationMs, AZ::TimeMs{ 200 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Milliseconds a paced Udp connection keeps its bytes in flight low while probing its minimum round trip time");
+
+    namespace
+    {
+        constexpr float HighGain = 2.885f; //< 2/ln(2), the smallest gain that doubles the delivery rate every round trip
+        constexpr float ProbeBandwidthCwndGain = 2.0f;
+        constexpr float ProbeBandwidthPacingGains[] = { 1.25f, 0.75f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+        constexpr uint32_t ProbeBandwidthCycleLength = AZ_ARRAY_SIZE(ProbeBandwidthPacingGains);
+        constexpr float FullBandwidthGrowth = 1.25f;
+        constexpr uint32_t FullBandwidthRounds = 3;
+        constexpr uint32_t InitialCongestionWindow = 10 * MaxUdpTransmissionUnit;
+        constexpr uint32_t MinCongestionWindow = 4 * MaxUdpTransmissionUnit;
+        constexpr AZ::TimeMs InitialRttMs = AZ::TimeMs{ 100 };
+
+        int64_t ToInt(AZ::TimeMs timeMs)
+        {
+            return static_cast<int64_t>(timeMs);
+        }
+    }
+
+    UdpBbrCongestionController::UdpBbrCongestionController()
+        : m_smoothedRttMs(InitialRttMs)
+    {
+        m_pacingTokens = static_cast<float>(InitialCongestionWindow);
+        SetMode(Mode::Startup, AZ::Time::ZeroTimeMs);
+    }
+
+    void UdpBbrCongestionController::OnPacketSent(PacketId packetId, uint32_t byteCount, AZ::TimeMs currentTimeMs)
+    {
+        SentPacket& sentPacket = m_sentPackets[static_cast<uint32_t>(packetId) % SentPacketCount];
+        if (sentPacket.m_packetId != InvalidPacketId)
+        {
+            // Too old to still be tracked, it will never contribute a sample so stop counting it as in flight
+            m_bytesInFlight -= AZStd::min(m_bytesInFlight, sentPacket.m_byteCount);
+        }
+
+        if (m_bytesInFlight == 0)
+        {
+            // Starting a new flight, don't let the idle time since the last delivery lower the delivery rate samples
+            m_deliveredTimeMs = currentTimeMs;
+        }
+
+        m_pacingTokens = AZStd::max(GetPacingTokens(currentTimeMs) - static_cast<float>(byteCount), -static_cast<float>(m_congestionWindow));
+        m_pacingTimeMs = currentTimeMs;
+        m_bytesInFlight += byteCount;
+
+        sentPacket.m_packetId = packetId;
+        sentPacket.m_byteCount = byteCount;
+        sentPacket.m_sendTimeMs = currentTimeMs;
+        sentPacket.m_deliveredTimeMs = m_deliveredTimeMs;
+        sentPacket.m_deliveredBytes = m_deliveredBytes;
+        sentPacket.m_isAppLimited = GetAvailableSendBytes(currentTimeMs) >= MaxUdpTransmissionUnit;
+    }
+
+    void UdpBbrCongestionController::OnPacketAcked(PacketId packetId, const ConnectionMetrics& metrics, AZ::TimeMs currentTimeMs)
+    {
+        SentPacket& sentPacket = m_sentPackets[static_cast<uint32_t>(packetId) % SentPacketCount];
+        if (sentPacket.m_packetId != packetId)
+        {
+            return;
+        }
+        sentPacket.m_packetId = InvalidPacketId;
+
+        m_smoothedRttMs = AZ::TimeMs{ AZStd::max<int64_t>(static_cast<int64_t>(metrics.m_connectionRtt.GetRoundTripTimeSeconds() * 1000.0f), 1) };
+        m_bytesInFlight -= AZStd::min(m_bytesInFlight, sentPacket.m_byteCount);
+        m_deliveredBytes += sentPacket.m_byteCount;
+        m_deliveredTimeMs = currentTimeMs;
+
+        // A round trip ends once a packet sent after the previous round started is acked
+        const bool isRoundStart = sentPacket.m_deliveredBytes >= m_nextRoundDeliveredBytes;
+        if (isRoundStart)
+        {
+            m_nextRoundDeliveredBytes = m_deliveredBytes;
+            ++m_roundCount;
+        }
+
+        UpdateMinRtt(AZ::TimeMs{ AZStd::max<int64_t>(ToInt(currentTimeMs - sentPacket.m_sendTimeMs), 1) }, currentTimeMs);
+
+        // Delivery rate over the interval the packet was in flight, which is never shorter than its round trip time
+        const int64_t intervalMs = AZStd::max<int64_t>(ToInt(currentTimeMs - sentPacket.m_deliveredTimeMs), 1);
+        const float deliveryRate = static_cast<float>(m_deliveredBytes - sentPacket.m_deliveredBytes) / static_cast<float>(intervalMs);
+        UpdateBandwidth(deliveryRate, sentPacket.m_isAppLimited, isRoundStart);
+
+        UpdateMode(isRoundStart, sentPacket.m_isAppLimited, currentTimeMs);
+        UpdateControlParameters();
+    }
+
+    void UdpBbrCongestionController::OnPacketLost(PacketId packetId, [[maybe_unused]] AZ::TimeMs currentTimeMs)
+    {
+        SentPacket& sentPacket = m_sentPackets[static_cast<uint32_t>(packetId) % SentPacketCount];
+        if (sentPacket.m_packetId == packetId)
+        {
+            sentPacket.m_packetId = InvalidPacketId;
+            m_bytesInFlight -= AZStd::min(m_bytesInFlight, sentPacket.m_byteCount);
+        }
+    }
+
+    uint32_t UdpBbrCongestionController::GetAvailableSendBytes(AZ::TimeMs currentTimeMs) const
+    {
+        const float pacingTokens = GetPacingTokens(currentTimeMs);
+        const uint32_t windowBytes = (m_congestionWindow > m_bytesInFlight) ? m_congestionWindow - m_bytesInFlight : 0;
+        return (pacingTokens > 0.0f) ? AZStd::min(static_cast<uint32_t>(pacingTokens), windowBytes) : 0;
+    }
+
+    float UdpBbrCongestionController::GetPacingRateBytesPerSecond() const
+    {
+        return m_pacingRate * 1000.0f;
+    }
+
+    float UdpBbrCongestionController::GetBandwidthEstimateBytesPerSecond() const
+    {
+        return GetBandwidth() * 1000.0f;
+    }
+
+    UdpBbrCongestionController::Mode UdpBbrCongestionController::GetMode() const
+    {
+        return m_mode;
+    }
+
+    uint32_t UdpBbrCongestionController::GetCongestionWindowBytes() const
+    {
+        return m_congestionWindow;
+    }
+
+    uint32_t UdpBbrCongestionController::GetBytesInFlight() const
+    {
+        return m_bytesInFlight;
+    }
+
+    AZ::TimeMs UdpBbrCongestionController::GetMinRttMs() const
+    {
+        return m_minRttMs;
+    }
+
+    float UdpBbrCongestionController::GetBandwidth() const
+    {
+        return AZStd::max(m_bandwidthWindows[0], m_bandwidthWindows[1]);
+    }
+
+    float UdpBbrCongestionController::GetPacingTokens(AZ::TimeMs currentTimeMs) const
+    {
+        const float elapsedMs = static_cast<float>(AZStd::max<int64_t>(ToInt(currentTimeMs - m_pacingTimeMs), 0));
+        const float burstBytes = AZStd::max(m_pacingRate * static_cast<float>(ToInt(net_UdpPacingBurstMs)), 2.0f * MaxUdpTransmissionUnit);
+        return AZStd::min(m_pacingTokens + m_pacingRate * elapsedMs, burstBytes);
+    }
+
+    void UdpBbrCongestionController::UpdateBandwidth(float deliveryRate, bool isAppLimited, bool isRoundStart)
+    {
+        if (isRoundStart && (m_roundCount - m_bandwidthWindowRound >= BandwidthWindowRounds))
+        {
+            m_bandwidthWindows[1] = m_bandwidthWindows[0];
+            m_bandwidthWindows[0] = 0.0f;
+            m_bandwidthWindowRound = m_roundCount;
+        }
+
+        // Samples taken while the application didn't use its whole budget underestimate the bandwidth, only keep them if they raise it
+        if (!isAppLimited || (deliveryRate > GetBandwidth()))
+        {
+            m_bandwidthWindows[0] = AZStd::max(m_bandwidthWindows[0], deliveryRate);
+        }
+    }
+
+    void UdpBbrCongestionController::UpdateMinRtt(AZ::TimeMs rttMs, AZ::TimeMs currentTimeMs)
+    {
+        const bool isExpired = (m_minRttMs != AZ::Time::ZeroTimeMs) && (currentTimeMs - m_minRttTimeMs > net_UdpMinRttWindowMs);
+        if ((m_minRttMs == AZ::Time::ZeroTimeMs) || (rttMs <= m_minRttMs) || isExpired)
+        {
+            m_minRttMs = rttMs;
+            m_minRttTimeMs = currentTimeMs;
+        }
+
+        if (isExpired && (m_mode != Mode::ProbeRtt))
+        {
+            SetMode(Mode::ProbeRtt, currentTimeMs);
+        }
+    }
+
+    void UdpBbrCongestionController::UpdateMode(bool isRoundStart, bool isAppLimited, AZ::TimeMs currentTimeMs)
+    {
+        // Startup ends once the bandwidth stopped growing by a quarter for a few rounds the application wasn't holding back in
+        if (!m_fullBandwidthReached && isRoundStart && !isAppLimited)
+        {
+            if (GetBandwidth() >= m_fullBandwidth * FullBandwidthGrowth)
+            {
+                m_fullBandwidth = GetBandwidth();
+                m_fullBandwidthRounds = 0;
+            }
+            else if (++m_fullBandwidthRounds >= FullBandwidthRounds)
+            {
+                m_fullBandwidthReached = true;
+            }
+        }
+
+        const float bandwidthDelayProduct = GetBandwidth() * static_cast<float>(ToInt(m_minRttMs));
+        switch (m_mode)
+        {
+        case Mode::Startup:
+            if (m_fullBandwidthReached)
+            {
+                SetMode(Mode::Drain, currentTimeMs);
+            }
+            break;
+
+        case Mode::Drain:
+            if (static_cast<float>(m_bytesInFlight) <= bandwidthDelayProduct)
+            {
+                SetMode(Mode::ProbeBandwidth, currentTimeMs);
+            }
+            break;
+
+        case Mode::ProbeBandwidth:
+            if (currentTimeMs - m_cycleStartTimeMs > m_minRttMs)
+            {
+                m_cycleIndex = (m_cycleIndex + 1) % ProbeBandwidthCycleLength;
+                m_cycleStartTimeMs = currentTimeMs;
+                m_pacingGain = ProbeBandwidthPacingGains[m_cycleIndex];
+            }
+            break;
+
+        case Mode::ProbeRtt:
+            if ((m_probeRttDoneTimeMs == AZ::Time::ZeroTimeMs) && (m_bytesInFlight <= MinCongestionWindow))
+            {
+                m_probeRttDoneTimeMs = currentTimeMs + net_UdpProbeRttDurationMs;
+            }
+            else if ((m_probeRttDoneTimeMs != AZ::Time::ZeroTimeMs) && (currentTimeMs >= m_probeRttDoneTimeMs))
+            {
+                m_minRttTimeMs = currentTimeMs;
+                SetMode(m_fullBandwidthReached ? Mode::ProbeBandwidth : Mode::Startup, currentTimeMs);
+            }
+            break;
+        }
+    }
+
+    void UdpBbrCongestionController::UpdateControlParameters()
+    {
+        const float bandwidth = GetBandwidth();
+        if (bandwidth <= 0.0f)
+        {
+            // No delivery rate measured yet, pace the initial window over the smoothed round trip time
+            m_pacingRate = m_pacingGain * static_cast<float>(InitialCongestionWindow) / static_cast<float>(AZStd::max<int64_t>(ToInt(m_smoothedRttMs), 1));
+            m_congestionWindow = (m_mode == Mode::ProbeRtt) ? MinCongestionWindow : InitialCongestionWindow;
+            return;
+        }
+
+        m_pacingRate = m_pacingGain * bandwidth;
+        const float bandwidthDelayProduct = bandwidth * static_cast<float>(AZStd::max<int64_t>(ToInt(m_minRttMs), 1));
+        m_congestionWindow = (m_mode == Mode::ProbeRtt)
+            ? MinCongestionWindow
+            : AZStd::max(static_cast<uint32_t>(m_cwndGain * bandwidthDelayProduct), MinCongestionWindow);
+    }
+
+    void UdpBbrCongestionController::SetMode(Mode mode, AZ::TimeMs currentTimeMs)
+    {
+        m_mode = mode;
+        switch (mode)
+        {
+        case Mode::Startup:
+            m_pacingGain = HighGain;
+            m_cwndGain = HighGain;
+            break;
+
+        case Mode::Drain:
+            m_pacingGain = 1.0f / HighGain;
+            m_cwndGain = HighGain;
+            break;
+
+        case Mode::ProbeBandwidth:
+            // Start in one of the cruising phases so that probing up and draining down alternate with steady sending
+            m_cycleIndex = 2;
+            m_cycleStartTimeMs = currentTimeMs;
+            m_pacingGain = ProbeBandwidthPacingGains[m_cycleIndex];
+            m_cwndGain = ProbeBandwidthCwndGain;
+            break;
+
+        case Mode::ProbeRtt:
+            m_pacingGain = 1.0f;
+            m_cwndGain = 1.0f;
+            m_probeRttDoneTimeMs = AZ::Time::ZeroTimeMs;
+            break;
+        }
+        UpdateControlParameters();
+    }
+}
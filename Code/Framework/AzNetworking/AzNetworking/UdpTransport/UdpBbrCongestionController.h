@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+
+namespace AzNetworking
+{
+    //! @class UdpBbrCongestionController
+    //! @brief congestion controller modeled after BBR, pacing the connection at its estimated bottleneck bandwidth.
+    //! The bottleneck bandwidth is the windowed maximum of the delivery rates measured from acks, and the minimum round trip
+    //! time is the windowed minimum of the round trip times of acked packets. Their product is the bandwidth delay product,
+    //! which bounds the bytes in flight so that queues along the path, and the latency they add, stay short.
+    //! Unlike loss based controllers, individual losses don't shrink the send budget, which suits lossy mobile links.
+    class UdpBbrCongestionController final
+        : public IUdpCongestionController
+    {
+    public:
+
+        enum class Mode
+        {
+            Startup,        //< Doubling the send rate every round trip until the bandwidth stops growing
+            Drain,          //< Draining the queue built up during startup
+            ProbeBandwidth, //< Cycling the send rate around the bandwidth estimate to discover more bandwidth
+            ProbeRtt        //< Briefly reducing the bytes in flight to remeasure the minimum round trip time
+        };
+
+        UdpBbrCongestionController();
+        ~UdpBbrCongestionController() override = default;
+
+        //! IUdpCongestionController interface.
+        // @{
+        void OnPacketSent(PacketId packetId, uint32_t byteCount, AZ::TimeMs currentTimeMs) override;
+        void OnPacketAcked(PacketId packetId, const ConnectionMetrics& metrics, AZ::TimeMs currentTimeMs) override;
+        void OnPacketLost(PacketId packetId, AZ::TimeMs currentTimeMs) override;
+        uint32_t GetAvailableSendBytes(AZ::TimeMs currentTimeMs) const override;
+        float GetPacingRateBytesPerSecond() const override;
+        float GetBandwidthEstimateBytesPerSecond() const override;
+        // @}
+
+        //! Returns the current mode of the controller.
+        //! @return the current mode of the controller
+        Mode GetMode() const;
+
+        //! Returns the maximum number of bytes allowed in flight.
+        //! @return the maximum number of bytes allowed in flight
+        uint32_t GetCongestionWindowBytes() const;
+
+        //! Returns the number of bytes sent and not yet acked or lost.
+        //! @return the number of bytes in flight
+        uint32_t GetBytesInFlight() const;
+
+        //! Returns the minimum round trip time measured, or zero if no packet has been acked yet.
+        //! @return the minimum round trip time in milliseconds
+        AZ::TimeMs GetMinRttMs() const;
+
+    private:
+
+        static constexpr uint32_t SentPacketCount = 256;
+        static constexpr uint32_t BandwidthWindowRounds = 5; //< The bandwidth estimate is the maximum over two windows of this many rounds
+
+        struct SentPacket
+        {
+            PacketId m_packetId = InvalidPacketId;
+            uint32_t m_byteCount = 0;
+            AZ::TimeMs m_sendTimeMs = AZ::Time::ZeroTimeMs;
+            AZ::TimeMs m_deliveredTimeMs = AZ::Time::ZeroTimeMs; //< Time the last packet was delivered when this one was sent
+            uint64_t m_deliveredBytes = 0;                       //< Bytes delivered when this packet was sent
+            bool m_isAppLimited = false;                         //< Whether the budget was left unused when this packet was sent
+        };
+
+        float GetBandwidth() const;
+        float GetPacingTokens(AZ::TimeMs currentTimeMs) const;
+        void UpdateBandwidth(float deliveryRate, bool isAppLimited, bool isRoundStart);
+        void UpdateMinRtt(AZ::TimeMs rttMs, AZ::TimeMs currentTimeMs);
+        void UpdateMode(bool isRoundStart, bool isAppLimited, AZ::TimeMs currentTimeMs);
+        void UpdateControlParameters();
+        void SetMode(Mode mode, AZ::TimeMs currentTimeMs);
+
+        SentPacket m_sentPackets[SentPacketCount];
+
+        Mode m_mode = Mode::Startup;
+        float m_pacingGain = 0.0f;
+        float m_cwndGain = 0.0f;
+        float m_pacingRate = 0.0f; //< Bytes per millisecond
+        uint32_t m_congestionWindow = 0;
+
+        float m_pacingTokens = 0.0f;
+        AZ::TimeMs m_pacingTimeMs = AZ::Time::ZeroTimeMs;
+
+        uint64_t m_deliveredBytes = 0;
+        AZ::TimeMs m_deliveredTimeMs = AZ::Time::ZeroTimeMs;
+        uint32_t m_bytesInFlight = 0;
+
+        uint64_t m_roundCount = 0;
+        uint64_t m_nextRoundDeliveredBytes = 0;
+        float m_bandwidthWindows[2] = {}; //< Maximum delivery rates of the current and previous windows, in bytes per millisecond
+        uint64_t m_bandwidthWindowRound = 0;
+
+        float m_fullBandwidth = 0.0f;
+        uint32_t m_fullBandwidthRounds = 0;
+        bool m_fullBandwidthReached = false;
+
+        AZ::TimeMs m_minRttMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_minRttTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_smoothedRttMs;
+        AZ::TimeMs m_probeRttDoneTimeMs = AZ::Time::ZeroTimeMs;
+
+        uint32_t m_cycleIndex = 0;
+        AZ::TimeMs m_cycleStartTimeMs = AZ::Time::ZeroTimeMs;
+    };
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzNetworking/UdpTransport/UdpBbrCongestionController.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/limits.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(AZ::CVarFixedString, net_UdpCongestionControl, "None", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Congestion controller used to pace the send budget of new Udp connections, None or Bbr");
+
+    void UdpNullCongestionController::OnPacketSent(PacketId, uint32_t, AZ::TimeMs)
+    {
+        ;
+    }
+
+    void UdpNullCongestionController::OnPacketAcked(PacketId, const ConnectionMetrics&, AZ::TimeMs)
+    {
+        ;
+    }
+
+    void UdpNullCongestionController::OnPacketLost(PacketId, AZ::TimeMs)
+    {
+        ;
+    }
+
+    uint32_t UdpNullCongestionController::GetAvailableSendBytes(AZ::TimeMs) const
+    {
+        return AZStd::numeric_limits<uint32_t>::max();
+    }
+
+    float UdpNullCongestionController::GetPacingRateBytesPerSecond() const
+    {
+        return 0.0f;
+    }
+
+    float UdpNullCongestionController::GetBandwidthEstimateBytesPerSecond() const
+    {
+        return 0.0f;
+    }
+
+    AZStd::unique_ptr<IUdpCongestionController> CreateUdpCongestionController()
+    {
+        const AZ::CVarFixedString congestionControl = static_cast<AZ::CVarFixedString>(net_UdpCongestionControl);
+        if (congestionControl == "Bbr")
+        {
+            return AZStd::make_unique<UdpBbrCongestionController>();
+        }
+        if (congestionControl != "None")
+        {
+            AZLOG_WARN("Unknown Udp congestion controller %s, connections will not be congestion controlled", congestionControl.c_str());
+        }
+        return AZStd::make_unique<UdpNullCongestionController>();
+    }
+}
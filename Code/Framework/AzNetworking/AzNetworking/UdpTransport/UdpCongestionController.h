@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/ConnectionMetrics.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    //! @class IUdpCongestionController
+    //! @brief interface for estimating how much a udp connection can send without building up queues along its network path.
+    //! The controller observes the packets sent, acked and lost on the connection and paces the send budget it reports
+    //! through GetAvailableSendBytes, which higher level systems use to decide how much data to produce each frame.
+    class IUdpCongestionController
+    {
+    public:
+
+        virtual ~IUdpCongestionController() = default;
+
+        //! Invoked whenever a packet is sent on the connection.
+        //! @param packetId      identifier of the sent packet
+        //! @param byteCount     size of the sent packet in bytes
+        //! @param currentTimeMs current process time in milliseconds
+        virtual void OnPacketSent(PacketId packetId, uint32_t byteCount, AZ::TimeMs currentTimeMs) = 0;
+
+        //! Invoked whenever a packet is acked by the remote endpoint.
+        //! @param packetId      identifier of the acked packet
+        //! @param metrics       metrics of the connection, providing its smoothed round trip time
+        //! @param currentTimeMs current process time in milliseconds
+        virtual void OnPacketAcked(PacketId packetId, const ConnectionMetrics& metrics, AZ::TimeMs currentTimeMs) = 0;
+
+        //! Invoked whenever a packet is determined to be lost.
+        //! @param packetId      identifier of the lost packet
+        //! @param currentTimeMs current process time in milliseconds
+        virtual void OnPacketLost(PacketId packetId, AZ::TimeMs currentTimeMs) = 0;
+
+        //! Returns the number of bytes the connection can send right now.
+        //! @param currentTimeMs current process time in milliseconds
+        //! @return the number of bytes the connection can send right now
+        virtual uint32_t GetAvailableSendBytes(AZ::TimeMs currentTimeMs) const = 0;
+
+        //! Returns the rate the connection is currently paced at in bytes per second, 0 for unlimited.
+        //! @return the pacing rate of the connection in bytes per second
+        virtual float GetPacingRateBytesPerSecond() const = 0;
+
+        //! Returns the estimated bottleneck bandwidth of the connection in bytes per second, 0 if unknown.
+        //! @return the estimated bottleneck bandwidth of the connection in bytes per second
+        virtual float GetBandwidthEstimateBytesPerSecond() const = 0;
+    };
+
+    //! @class UdpNullCongestionController
+    //! @brief congestion controller that never limits the connection, the application decides its own send rate.
+    class UdpNullCongestionController final
+        : public IUdpCongestionController
+    {
+    public:
+
+        //! IUdpCongestionController interface.
+        // @{
+        void OnPacketSent(PacketId packetId, uint32_t byteCount, AZ::TimeMs currentTimeMs) override;
+        void OnPacketAcked(PacketId packetId, const ConnectionMetrics& metrics, AZ::TimeMs currentTimeMs) override;
+        void OnPacketLost(PacketId packetId, AZ::TimeMs currentTimeMs) override;
+        uint32_t GetAvailableSendBytes(AZ::TimeMs currentTimeMs) const override;
+        float GetPacingRateBytesPerSecond() const override;
+        float GetBandwidthEstimateBytesPerSecond() const override;
+        // @}
+    };
+
+    //! Creates the congestion controller selected by net_UdpCongestionControl for a new connection.
+    //! @return the congestion controller to use for a new connection
+    AZStd::unique_ptr<IUdpCongestionController> CreateUdpCongestionController();
+}
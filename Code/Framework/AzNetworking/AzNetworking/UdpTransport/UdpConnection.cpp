@@ -48,6 +48,7 @@ namespace AzNetworking
     UdpConnection::UdpConnection(ConnectionId connectionId, const IpAddress& remoteAddress, UdpNetworkInterface& networkInterface, ConnectionRole connectionRole)
         : IConnection(connectionId, remoteAddress)
         , m_networkInterface(networkInterface)
+        , m_congestionController(CreateUdpCongestionController())
         , m_lastSentPacketMs(AZ::GetElapsedTimeMs())
         , m_connectionRole(connectionRole)
     {
@@ -151,6 +152,11 @@ namespace AzNetworking
         return m_connectionMtu;
     }
 
+    uint32_t UdpConnection::GetAvailableSendBytes() const
+    {
+        return m_congestionController->GetAvailableSendBytes(AZ::GetElapsedTimeMs());
+    }
+
     void UdpConnection::ProcessAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
     {
         GetMetrics().LogPacketAcked();
@@ -161,9 +167,10 @@ namespace AzNetworking
         {
             GetMetrics().m_connectionRtt.LogPacketAcked(packetId, currentTimeMs);
         }
+        m_congestionController->OnPacketAcked(packetId, GetMetrics(), currentTimeMs);
     }
 
-    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
+    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] PacketType packetType,
         uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
     {
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
@@ -174,19 +181,26 @@ namespace AzNetworking
         }
 
         GetMetrics().LogPacketSent(packetSize, currentTimeMs);
+        m_congestionController->OnPacketSent(packetId, packetSize, currentTimeMs);
         m_lastSentPacketMs = currentTimeMs;
         m_unackedPacketCount = 0;
     }
 
     PacketTimeoutResult UdpConnection::ProcessTimeout(PacketId packetId, ReliabilityType reliability)
     {
+        const PacketAckState ackState = m_packetTracker.GetPacketAckStatus(packetId);
+
+        if ((ackState == PacketAckState::Nacked) && (reliability == ReliabilityType::Reliable) && !m_reliableQueue.CanResend(packetId))
+        {
+            // Too many resends are already in flight, hold on to the lost packet and check it again on its next timeout
+            return PacketTimeoutResult::Pending;
+        }
+
         if (IncludePacketInRtt(packetId))
         {
             GetMetrics().m_connectionRtt.LogPacketTimeout(packetId);
         }
 
-        const PacketAckState ackState = m_packetTracker.GetPacketAckStatus(packetId);
-
         switch (ackState)
         {
         case PacketAckState::Acked:
@@ -194,6 +208,7 @@ namespace AzNetworking
 
         case PacketAckState::Nacked:
             GetMetrics().LogPacketLost();
+            m_congestionController->OnPacketLost(packetId, AZ::GetElapsedTimeMs());
             if (reliability == ReliabilityType::Reliable)
             {
                 m_reliableQueue.OnPacketLost(m_networkInterface, *this, packetId);
@@ -206,6 +221,12 @@ namespace AzNetworking
         case PacketAckState::Unknown_TooOld:
             // TODO: Disconnect?
             AZLOG_ERROR("PacketId %u timeout fell outside the ack history window", static_cast<uint32_t>(packetId));
+            m_congestionController->OnPacketLost(packetId, AZ::GetElapsedTimeMs());
+            if (reliability == ReliabilityType::Reliable)
+            {
+                // The ack can never be observed anymore, resend rather than leaving the packet pending forever
+                m_reliableQueue.OnPacketLost(m_networkInterface, *this, packetId);
+            }
             break;
 
         default:
@@ -11,6 +11,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpReliableQueue.h>
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
@@ -66,6 +67,7 @@ namespace AzNetworking
         bool Disconnect(DisconnectReason reason, TerminationEndpoint endpoint) override;
         void SetConnectionMtu(uint32_t connectionMtu) override;
         uint32_t GetConnectionMtu() const override;
+        uint32_t GetAvailableSendBytes() const override;
         // @}
 
         //! Returns a suitable encryption endpoint for this connection type.
@@ -84,6 +86,10 @@ namespace AzNetworking
         //! @return the number of unacked reliable messages still pending in the reliable queue
         uint32_t GetReliableQueueSize() const;
 
+        //! Retrieves the congestion controller pacing this connection.
+        //! @return reference to the congestion controller of this connection
+        const IUdpCongestionController& GetCongestionController() const;
+
         //! Acks a packetId.
         //! @param packetId      the PacketId of the packet being acked
         //! @param currentTimeMs current wall clock time in milliseconds
@@ -100,17 +106,19 @@ namespace AzNetworking
     protected:
 
         //! Prepare a reliable packet for transmission.
-        //! @param packetId identifier of the packet being sent
-        //! @param packet   reference to the packet being transmitted
+        //! @param packetId           identifier of the packet being sent
+        //! @param reliableSequenceId the reliable sequence identifier of the packet being sent
+        //! @param packetType         the type of the packet being sent
+        //! @param payload            the serialized payload of the packet being sent
         //! @return boolean true on success, false on failure
-        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PooledPacketBuffer& payload);
 
         //! Process a packet for sending.
         //! @param packetId   identifier of the packet being sent
-        //! @param packet     reference to the packet being transmitted
+        //! @param packetType the type of the packet being transmitted
         //! @param packetSize packet size in bytes
         //! @param reliability whether or not to guarantee delivery
-        void ProcessSent(PacketId packetId, const IPacket& packet, uint32_t packetSize, ReliabilityType reliability);
+        void ProcessSent(PacketId packetId, PacketType packetType, uint32_t packetSize, ReliabilityType reliability);
 
         //! Process a timed out packet header.
         //! @param packetId    identifier of the packet that timed out
@@ -139,6 +147,7 @@ namespace AzNetworking
         UdpPacketTracker m_packetTracker;
         UdpReliableQueue m_reliableQueue;
         UdpFragmentQueue m_fragmentQueue;
+        AZStd::unique_ptr<IUdpCongestionController> m_congestionController;
         ConnectionState  m_state = ConnectionState::Disconnected;
         ConnectionRole   m_connectionRole = ConnectionRole::Connector;
         DtlsEndpoint     m_dtlsEndpoint;
@@ -149,6 +158,7 @@ namespace AzNetworking
 
         TimeoutId m_timeoutId;
         uint32_t  m_timeoutCounter = 0;
+        uint32_t  m_shardIndex = 0; //!< Index of the network interface shard whose socket and timeout queues service this connection
     };
 }
 
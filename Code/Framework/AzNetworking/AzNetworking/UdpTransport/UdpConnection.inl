@@ -30,6 +30,11 @@ namespace AzNetworking
         return m_reliableQueue.GetQueueSize();
     }
 
+    inline const IUdpCongestionController& UdpConnection::GetCongestionController() const
+    {
+        return *m_congestionController;
+    }
+
     inline void UdpConnection::SetTimeoutId(TimeoutId timeoutId)
     {
         m_timeoutId = timeoutId;
@@ -40,8 +45,8 @@ namespace AzNetworking
         return m_timeoutId;
     }
 
-    inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
+    inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PooledPacketBuffer& payload)
     {
-        return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packet);
+        return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packetType, payload);
     }
 }
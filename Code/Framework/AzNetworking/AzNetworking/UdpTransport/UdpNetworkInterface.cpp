@@ -38,8 +38,11 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
+    AZ_CVAR(uint32_t, net_UdpListenShardCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of sockets and reader threads a listening Udp network interface partitions its connections across, requires SO_REUSEPORT support");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
+    static constexpr uint32_t MaxListenShardCount = 16;
+
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
         const uint64_t intConnectionId = aznumeric_cast<uint64_t>(connectionId);
@@ -60,10 +63,10 @@ namespace AzNetworking
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
-        , m_socket(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket())
-        , m_readerThread(readerThread)
         , m_timeoutMs(net_UdpDefaultTimeoutMs)
     {
+        AddShard(&readerThread);
+
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
@@ -71,7 +74,10 @@ namespace AzNetworking
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
-        m_readerThread.UnregisterSocket(m_socket.get());
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            shard->m_readerThread->UnregisterSocket(shard->m_socket.get());
+        }
     }
 
     AZ::Name UdpNetworkInterface::GetName() const
@@ -106,32 +112,60 @@ namespace AzNetworking
 
     bool UdpNetworkInterface::Listen(uint16_t port)
     {
-        if (m_socket->IsOpen())
+        if (IsOpen())
         {
             AZ_Assert(false, "Listen cannot be invoked on an already opened network interface");
             return false;
         }
 
-        m_port = port;
-        m_allowIncomingConnections = true;
-        if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+        // Sharding relies on every shard socket being bound to the same port, so it requires an explicit port
+        uint32_t shardCount = 1;
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        if (port != 0)
         {
-            m_readerThread.RegisterSocket(m_socket.get());
-            return true;
+            shardCount = AZStd::clamp(static_cast<uint32_t>(net_UdpListenShardCount), 1u, MaxListenShardCount);
         }
-        else
+#endif
+
+        // Shards are never removed so that connections can continue to reference their shard after StopListening
+        while (m_shards.size() < shardCount)
         {
-            return false;
+            AddShard(nullptr);
         }
+
+        m_port = port;
+        m_allowIncomingConnections = true;
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            Shard& shard = *m_shards[shardIndex];
+            shard.m_socket->SetSharedPort(shardCount > 1);
+            if (!shard.m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                // Close any shards that were already opened so the interface is left in a consistent state
+                for (uint32_t openedIndex = 0; openedIndex < shardIndex; ++openedIndex)
+                {
+                    m_shards[openedIndex]->m_readerThread->UnregisterSocket(m_shards[openedIndex]->m_socket.get());
+                    m_shards[openedIndex]->m_socket->Close();
+                }
+                m_port = 0;
+                m_allowIncomingConnections = false;
+                return false;
+            }
+            shard.m_readerThread->RegisterSocket(shard.m_socket.get());
+        }
+        return true;
     }
 
     ConnectionId UdpNetworkInterface::Connect(const IpAddress& remoteAddress)
     {
-        if (!m_socket->IsOpen())
+        // Outgoing connections are always serviced by the first shard
+        Shard& shard = *m_shards[0];
+        if (!shard.m_socket->IsOpen())
         {
-            if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone))
+            shard.m_socket->SetSharedPort(false);
+            if (shard.m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone))
             {
-                m_readerThread.RegisterSocket(m_socket.get());
+                shard.m_readerThread->RegisterSocket(shard.m_socket.get());
             }
             else
             {
@@ -141,11 +175,11 @@ namespace AzNetworking
 
         const ConnectionId connectionId = m_connectionSet.GetNextConnectionId();
         const AZ::TimeMs timeoutTimeMs = m_timeoutMs / static_cast<AZ::TimeMs>(static_cast<int32_t>(net_UdpUnackedHeartbeats));
-        const TimeoutId timeoutId = m_connectionTimeoutQueue.RegisterItem(aznumeric_cast<uint64_t>(connectionId), timeoutTimeMs);
+        const TimeoutId timeoutId = shard.m_connectionTimeoutQueue.RegisterItem(aznumeric_cast<uint64_t>(connectionId), timeoutTimeMs);
 
         AZStd::unique_ptr<UdpConnection> connection = AZStd::make_unique<UdpConnection>(connectionId, remoteAddress, *this, ConnectionRole::Connector);
         UdpPacketEncodingBuffer dtlsData;
-        m_socket->ConnectDtlsEndpoint(connection->GetDtlsEndpoint(), remoteAddress, dtlsData);
+        shard.m_socket->ConnectDtlsEndpoint(connection->GetDtlsEndpoint(), remoteAddress, dtlsData);
 
         // We're initiating this connection, so go to a connecting state until we receive some kind of response so that we know it's alive and valid
         connection->m_state = ConnectionState::Connecting;
@@ -164,13 +198,83 @@ namespace AzNetworking
 
     void UdpNetworkInterface::Update([[maybe_unused]] AZ::TimeMs deltaTimeMs)
     {
-        if (!m_socket->IsOpen())
+        if (!IsOpen())
         {
             return;
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
+
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            // The shared reader thread is swapped by the networking system component, reader threads owned by shards are swapped here
+            if (shard->m_ownedReaderThread != nullptr)
+            {
+                shard->m_ownedReaderThread->SwapBuffers();
+            }
+
+            // Send anything queued since the last update before processing received packets
+            shard->m_socket->FlushSendQueue();
+        }
+
+        for (uint32_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            ProcessReceivedPackets(shardIndex, startTimeMs);
+        }
+        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            // Time out any stale client connections
+            shard->m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
+
+            // Time out any packets that haven't been acked within our timeout window
+            shard->m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
+        }
+
+        // Delete any connections we've disconnected
+        for (RemovedConnection& removedConnection : m_removedConnections)
+        {
+            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
+            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
+        }
+        m_removedConnections.clear();
+
+        // Send everything queued during this update, such as acks, heartbeats and resends, in as few system calls as possible
+        uint32_t sentPackets = 0;
+        uint32_t sentBytes = 0;
+        uint32_t sentPacketsEncrypted = 0;
+        uint32_t sentBytesEncryptionInflation = 0;
+        uint32_t recvPackets = 0;
+        uint32_t recvBytes = 0;
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            const UdpSocket& socket = *shard->m_socket;
+            socket.FlushSendQueue();
+            sentPackets += socket.GetSentPackets();
+            sentBytes += socket.GetSentBytes();
+            sentPacketsEncrypted += socket.GetSentPacketsEncrypted();
+            sentBytesEncryptionInflation += socket.GetSentBytesEncryptionInflation();
+            recvPackets += socket.GetRecvPackets();
+            recvBytes += socket.GetRecvBytes();
+        }
+
+        // Update metrics
+        GetMetrics().m_sendPackets = sentPackets;
+        GetMetrics().m_sendBytes = sentBytes;
+        GetMetrics().m_sendPacketsEncrypted = sentPacketsEncrypted;
+        GetMetrics().m_sendBytesEncryptionInflation = sentBytesEncryptionInflation;
+        GetMetrics().m_recvTimeMs += receiveTimeMs;
+        GetMetrics().m_recvPackets = recvPackets;
+        GetMetrics().m_recvBytes = recvBytes;
+        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
+        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    void UdpNetworkInterface::ProcessReceivedPackets(uint32_t shardIndex, AZ::TimeMs startTimeMs)
+    {
+        Shard& shard = *m_shards[shardIndex];
+        const UdpReaderThread::ReceivedPackets* packets = shard.m_readerThread->GetReceivedPackets(shard.m_socket.get());
         if (packets == nullptr)
         {
             // Socket is not yet registered with the reader thread and is likely still pending, try again later
@@ -185,7 +289,7 @@ namespace AzNetworking
             // Don't exceed our timeslice, even if unprocessed data remains
             if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
             {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
+                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets on shard %u", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()), shardIndex);
                 GetMetrics().m_discardedPackets += packets->size() - i;
                 break;
             }
@@ -193,7 +297,7 @@ namespace AzNetworking
             UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
             if (connection == nullptr)
             {
-                AcceptConnection(packet);
+                AcceptConnection(packet, shardIndex);
                 continue;
             }
 
@@ -256,7 +360,7 @@ namespace AzNetworking
             }
             GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
-            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
+            TimeoutQueue::TimeoutItem* timeoutItem = GetShard(*connection).m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
             if (timeoutItem == nullptr)
             {
                 connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
@@ -300,7 +404,7 @@ namespace AzNetworking
                         connection->m_state = ConnectionState::Connected;
                     }
                 }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
+                else if (IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
                     !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
                 {
                     // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
@@ -319,32 +423,6 @@ namespace AzNetworking
                 }
             }
         }
-        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
-
-        // Time out any stale client connections
-        m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
-
-        // Time out any packets that haven't been acked within our timeout window
-        m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
-
-        // Delete any connections we've disconnected
-        for (RemovedConnection& removedConnection : m_removedConnections)
-        {
-            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
-            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
-        }
-        m_removedConnections.clear();
-
-        // Update metrics
-        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
-        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
-        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
-        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
-        GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
-        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
-        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
@@ -379,15 +457,18 @@ namespace AzNetworking
 
     bool UdpNetworkInterface::StopListening()
     {
-        if (!m_socket->IsOpen())
+        if (!IsOpen())
         {
             return false;
         }
 
         m_port = 0;
-        m_readerThread.UnregisterSocket(m_socket.get());
         m_allowIncomingConnections = false;
-        m_socket->Close();
+        for (AZStd::unique_ptr<Shard>& shard : m_shards)
+        {
+            shard->m_readerThread->UnregisterSocket(shard->m_socket.get());
+            shard->m_socket->Close();
+        }
         return true;
     }
 
@@ -413,21 +494,46 @@ namespace AzNetworking
 
     bool UdpNetworkInterface::IsEncrypted() const
     {
-        return m_socket->IsEncrypted();
+        return m_shards[0]->m_socket->IsEncrypted();
     }
 
     bool UdpNetworkInterface::IsOpen() const
     {
-        return m_socket->IsOpen();
+        return m_shards[0]->m_socket->IsOpen();
+    }
+
+    uint32_t UdpNetworkInterface::GetShardCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_shards.size());
     }
 
-    void UdpNetworkInterface::RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics)
+    void UdpNetworkInterface::AddShard(UdpReaderThread* readerThread)
     {
+        AZStd::unique_ptr<Shard> shard = AZStd::make_unique<Shard>();
+        shard->m_socket.reset(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket());
+        if (readerThread == nullptr)
+        {
+            shard->m_ownedReaderThread = AZStd::make_unique<UdpReaderThread>();
+            readerThread = shard->m_ownedReaderThread.get();
+        }
+        shard->m_readerThread = readerThread;
+        m_shards.push_back(AZStd::move(shard));
+    }
+
+    UdpNetworkInterface::Shard& UdpNetworkInterface::GetShard(const UdpConnection& connection)
+    {
+        AZ_Assert(connection.m_shardIndex < m_shards.size(), "Connection references an invalid shard");
+        return *m_shards[connection.m_shardIndex];
+    }
+
+    void UdpNetworkInterface::RegisterWithTimeoutQueue(UdpConnection& connection, PacketId packetId, ReliabilityType reliability)
+    {
+        const ConnectionMetrics& metrics = connection.GetMetrics();
         const float avgRtt = metrics.m_connectionRtt.GetRoundTripTimeSeconds(); // Time is in seconds, timeout times are in milliseconds
         const AZ::TimeMs expectedTimeoutMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(avgRtt * 1000.0f * net_RttFudgeScalar));
         const AZ::TimeMs packetTimeoutMs = AZStd::max<AZ::TimeMs>(expectedTimeoutMs, net_MinPacketTimeoutMs); // Consider packets lost after twice the current connection Rtt
         AZLOG(NET_Debug, "Registering packetId %u with timeout %u", aznumeric_cast<uint32_t>(packetId), aznumeric_cast<uint32_t>(packetTimeoutMs));
-        m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
+        GetShard(connection).m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connection.GetConnectionId(), packetId, reliability), packetTimeoutMs);
     }
 
     bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
@@ -461,12 +567,40 @@ namespace AzNetworking
 
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
-        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
+        // Serialize the payload straight into a pooled buffer, leaving headroom in front for the packet flags and header
+        // Most packets fit within a single MTU, so try a small buffer first and only fall back to a large buffer if serialization overflows
+        PooledPacketBuffer payload = m_packetBufferPool.Acquire(PacketBufferPool::SmallBufferCapacity);
+        for (;;)
+        {
+            const uint32_t payloadCapacity = AZStd::min(payload.GetCapacity() - UdpPacketHeaderHeadroom, MaxPacketSize);
+            NetworkInputSerializer networkSerializer(payload.GetBuffer() + UdpPacketHeaderHeadroom, payloadCapacity);
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            if (serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            {
+                payload.SetSize(UdpPacketHeaderHeadroom + serializer.GetSize());
+                break;
+            }
+
+            if (payload.GetCapacity() >= PacketBufferPool::LargeBufferCapacity)
+            {
+                AZLOG_ERROR("Packet type %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(packet.GetPacketType()));
+                return InvalidPacketId;
+            }
+            payload = m_packetBufferPool.Acquire(PacketBufferPool::LargeBufferCapacity);
+        }
+
+        return SendPacket(connection, packet.GetPacketType(), payload, reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, PacketType packetType, PooledPacketBuffer& payload, SequenceId reliableSequence)
+    {
+        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packetType), connection.GetRemoteAddress().GetString().c_str());
 
         // The ordering inside this function is incredibly important and fragile
         const IpAddress& address = connection.GetRemoteAddress();
         // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two
-        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        const bool shouldCompress = packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
         if (address.GetAddress(ByteOrder::Host) == 0)
         {
@@ -478,14 +612,14 @@ namespace AzNetworking
         // Check if we need to fragment this packet first
         // We don't ack aggregate packets that get fragmented, so we want to get this chunk out of the way before
         // we start throwing PacketId's and SequenceId's into our other tracking data structures below
-        UdpPacketHeader header(connection.GetPacketTracker(), packet.GetPacketType(), reliableSequence);
+        UdpPacketHeader header(connection.GetPacketTracker(), packetType, reliableSequence);
         const PacketId localPacketId = header.GetPacketId();
 
         // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
-        // not set up
+        // not set up, the reliable queue shares the pooled payload rather than copying the packet
         if (reliabilityType == ReliabilityType::Reliable)
         {
-            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packet))
+            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packetType, payload))
             {
                 connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
             }
@@ -494,21 +628,22 @@ namespace AzNetworking
         // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
         // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
         // Other large packets are simply queued before they are fragmented
-        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType()))
+        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType))
         {
             // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
-            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
+            RegisterWithTimeoutQueue(connection, localPacketId, reliabilityType);
             AZLOG(
                 NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
-                (int)packet.GetPacketType());
+                (int)packetType);
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer buffer;
+        // Serialize the flags and header into a scratch buffer, then place them directly in front of the payload
+        uint8_t* packetData = nullptr;
+        uint32_t packetSize = 0;
         {
-            buffer.Resize(buffer.GetCapacity());
-
-            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            uint8_t headerBuffer[UdpPacketHeaderHeadroom];
+            NetworkInputSerializer networkSerializer(headerBuffer, UdpPacketHeaderHeadroom);
             ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
 
             if (!header.SerializePacketFlags(serializer))
@@ -523,16 +658,18 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            const uint32_t headerSize = serializer.GetSize();
+            packetData = payload.GetBuffer() + UdpPacketHeaderHeadroom - headerSize;
+            packetSize = headerSize + payload.GetSize() - UdpPacketHeaderHeadroom;
+            memcpy(packetData, headerBuffer, headerSize);
+
+            if (packetSize > MaxPacketSize)
             {
-                AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
+                AZLOG_ERROR("PacketId %u exceeds the maximum packet size (%u > %u) and will not be sent", aznumeric_cast<uint32_t>(localPacketId), packetSize, MaxPacketSize);
                 return InvalidPacketId;
             }
-
-            buffer.Resize(serializer.GetSize());
         }
-        uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
-        uint8_t* packetData = buffer.GetBuffer();
+        const uint32_t uncompressedSize = packetSize;
 
         // If the packet doesn't fit within our MTU (minus potential SSL encryption overhead), break it up
         if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
@@ -544,12 +681,15 @@ namespace AzNetworking
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
-            ChunkBuffer chunkBuffer;
+            CorePackets::FragmentedPacket fragmentedPacket;
+            fragmentedPacket.SetUnfragmentedSequence(ToSequenceId(localPacketId));
+            fragmentedPacket.SetFragmentSequence(fragmentedSequence);
+            fragmentedPacket.SetChunkCount(aznumeric_cast<uint8_t>(numChunks));
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
-                chunkBuffer.CopyValues(chunkStart, nextChunkSize);
-                CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, aznumeric_cast<uint8_t>(chunkIndex), aznumeric_cast<uint8_t>(numChunks), chunkBuffer);
+                fragmentedPacket.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                fragmentedPacket.ModifyChunkBuffer().CopyValues(chunkStart, nextChunkSize);
                 const SequenceId chunkReliableId = (reliabilityType == ReliabilityType::Reliable) ? connection.m_reliableQueue.GetNextSequenceId() : InvalidSequenceId;
                 SendPacket(connection, fragmentedPacket, chunkReliableId);
                 bytesRemaining -= nextChunkSize;
@@ -576,11 +716,11 @@ namespace AzNetworking
             AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
 
             // Compress the packet, make sure to offset by the size of the flag which is now serialized
-            const uint32_t payloadSize = static_cast<uint32_t>(buffer.GetSize() - flagSize);
-            uint8_t* payload = buffer.GetBuffer() + flagSize;
+            const uint32_t payloadSize = packetSize - flagSize;
+            const uint8_t* payloadData = packetData + flagSize;
             const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
             AZStd::size_t compressionMemBytesUsed = 0;
-            CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+            CompressorError compErr = m_compressor->Compress(payloadData, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
 
             if (compErr != CompressorError::Ok)
             {
@@ -607,14 +747,14 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(header.GetSequenceWindow())
         );
 
-        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
+        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packetType));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
-        if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType);
+        if (GetShard(connection).m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
-            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
-            GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
+            RegisterWithTimeoutQueue(connection, localPacketId, reliabilityType);
+            connection.ProcessSent(localPacketId, packetType, packetSize + UdpPacketHeaderSize, reliabilityType);
+            GetMetrics().m_sendBytesUncompressed += uncompressedSize + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
         else
@@ -625,7 +765,7 @@ namespace AzNetworking
         return InvalidPacketId;
     }
 
-    void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket)
+    void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket, uint32_t shardIndex)
     {
         if (!m_allowIncomingConnections)
         {
@@ -679,11 +819,13 @@ namespace AzNetworking
 
         // How long should we sit in the timeout queue before heartbeating or disconnecting
         const ConnectionId connectionId = m_connectionSet.GetNextConnectionId();
-        const TimeoutId    timeoutId = m_connectionTimeoutQueue.RegisterItem(aznumeric_cast<uint64_t>(connectionId), m_timeoutMs);
+        Shard& shard = *m_shards[shardIndex];
+        const TimeoutId    timeoutId = shard.m_connectionTimeoutQueue.RegisterItem(aznumeric_cast<uint64_t>(connectionId), m_timeoutMs);
 
         AZLOG(Debug_UdpConnect, "Accepted new Udp Connection");
         AZStd::unique_ptr<UdpConnection> connection = AZStd::make_unique<UdpConnection>(connectionId, connectPacket.m_address, *this, ConnectionRole::Acceptor);
-        DtlsEndpoint::ConnectResult result = m_socket->AcceptDtlsEndpoint(connection->GetDtlsEndpoint(), connectPacket.m_address);
+        connection->m_shardIndex = shardIndex;
+        DtlsEndpoint::ConnectResult result = shard.m_socket->AcceptDtlsEndpoint(connection->GetDtlsEndpoint(), connectPacket.m_address);
 
         // Transition state based on our how our socket resolved
         connection->m_state = result == DtlsEndpoint::ConnectResult::Complete ? ConnectionState::Connected : ConnectionState::Connecting;
@@ -770,6 +912,7 @@ namespace AzNetworking
         case PacketTimeoutResult::Pending:
             // Packet timed out before we received any info about it's sequence from the remote endpoint
             // The connection latency may have increased, and our Rtt metrics may still be adjusting..
+            // Or the packet was lost but the connection is pacing its reliable resends
             // Just throw it back into the timeout queue
             return TimeoutResult::Refresh;
         case PacketTimeoutResult::Lost:
@@ -15,6 +15,7 @@
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
 
@@ -24,6 +25,7 @@ namespace AzNetworking
     class ICompressor;
 
     static const uint32_t UdpPacketHeaderSize = 20 + 8; //!< 20 byte IPv4 header + 8 byte UDP header
+    static const uint32_t UdpPacketHeaderHeadroom = 32; //!< Bytes reserved in front of pooled packet payloads for the serialized packet flags and UdpPacketHeader
     static const uint32_t DtlsPacketHeaderSize = 13; //!< DTLS1_RT_HEADER_LENGTH
 
     //! @class UdpNetworkInterface
@@ -116,14 +118,44 @@ namespace AzNetworking
         //! @return boolean true if this connection instance is in an open state
         bool IsOpen() const;
 
+        //! Returns the number of shards the connections of this network interface are partitioned across.
+        //! @return the number of shards the connections of this network interface are partitioned across
+        uint32_t GetShardCount() const;
+
     private:
 
+        //! A partition of the connections of this network interface.
+        //! Each shard has its own socket and reader thread, all bound to the listen port, so that reading off the sockets is
+        //! spread across threads and the kernel distributes remote endpoints between the shards. Each shard also has its own
+        //! timeout queues, so the timeouts of a shard only contain the connections that shard services.
+        struct Shard
+        {
+            AZStd::unique_ptr<UdpSocket> m_socket;
+            AZStd::unique_ptr<UdpReaderThread> m_ownedReaderThread; //!< Only set for additional shards, the first shard uses the shared reader thread
+            UdpReaderThread* m_readerThread = nullptr;
+            TimeoutQueue m_connectionTimeoutQueue;
+            TimeoutQueue m_packetTimeoutQueue;
+        };
+
+        //! Creates a new shard with a socket matching the encryption settings of this network interface.
+        //! @param readerThread the reader thread to use for the shard, or nullptr to create a reader thread owned by the shard
+        void AddShard(UdpReaderThread* readerThread);
+
+        //! Returns the shard that services the provided connection.
+        //! @param connection the connection to return the shard for
+        //! @return reference to the shard that services the connection
+        Shard& GetShard(const UdpConnection& connection);
+
+        //! Processes all packets received on a shard's socket since the last update.
+        //! @param shardIndex  index of the shard to process received packets for
+        //! @param startTimeMs time at which the update started, used to limit the total time spent processing packets
+        void ProcessReceivedPackets(uint32_t shardIndex, AZ::TimeMs startTimeMs);
+
         //! Registers a packet with a timeout queue on the provided connection.
-        //! @param connectionId identifier of the connection to register
-        //! @param packetId     packet id of the packet to register for the given connection
-        //! @param reliability  whether or not to guarantee delivery
-        //! @param metrics      reference to the connections metrics instance
-        void RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics);
+        //! @param connection  the connection to register the packet for
+        //! @param packetId    packet id of the packet to register for the given connection
+        //! @param reliability whether or not to guarantee delivery
+        void RegisterWithTimeoutQueue(UdpConnection& connection, PacketId packetId, ReliabilityType reliability);
 
         //! Decompresses an incoming packet data buffer.
         //! @param packetBuffer    the compressed packet buffer to decode
@@ -139,9 +171,19 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Sends an already serialized packet payload to the remote connection.
+        //! The packet header is written into the headroom reserved in front of the payload, so the payload is never copied before transmission.
+        //! @param connection         the UdpConnection instance to send the packet on
+        //! @param packetType         the type of the serialized packet
+        //! @param payload            pooled buffer holding the serialized payload after UdpPacketHeaderHeadroom bytes of headroom
+        //! @param reliableSequence   the reliable sequence number to use for this packet, providing InvalidSequenceId will cause the packet to be sent unreliably
+        //! @return packet id for the transmitted packet
+        PacketId SendPacket(UdpConnection& connection, PacketType packetType, PooledPacketBuffer& payload, SequenceId reliableSequence);
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
-        void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
+        //! @param shardIndex    index of the shard the connect packet was received on
+        void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket, uint32_t shardIndex);
 
         //! Internal helper to cleanly remove a connection from the network interface.
         //! @param connection pointer to the connection to disconnect
@@ -173,12 +215,10 @@ namespace AzNetworking
         bool m_allowIncomingConnections = false;
         AZ::TimeMs m_timeoutMs = AZ::Time::ZeroTimeMs;
         IConnectionListener& m_connectionListener;
+        PacketBufferPool m_packetBufferPool; // Declared before m_connectionSet so it outlives the payloads retained by reliable queues
         UdpConnectionSet m_connectionSet;
-        TimeoutQueue m_connectionTimeoutQueue;
-        TimeoutQueue m_packetTimeoutQueue;
-        AZStd::unique_ptr<UdpSocket> m_socket;
+        AZStd::vector<AZStd::unique_ptr<Shard>> m_shards;
         AZStd::unique_ptr<ICompressor> m_compressor;
-        UdpReaderThread& m_readerThread;
 
         struct RemovedConnection
         {
@@ -169,29 +169,45 @@ namespace AzNetworking
                 sequenceWindow
             );
 
-            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
             const SequenceId sequenceIdDelta = SequenceId(receivedSequenceId - m_headSequenceId);
             const PacketId   receivedPacketId = MakePacketId(m_sequenceRolloverCount, receivedSequenceId);
 
             m_headSequenceId = receivedSequenceId;
             m_headPacketId = receivedPacketId;
             m_ackWindow.PushBackBits(aznumeric_cast<uint32_t>(sequenceIdDelta));
+            ApplyRemoteAckBits(connection, sequenceWindow, 0);
+        }
+        else if (m_headPacketId != InvalidPacketId)
+        {
+            // An older or repeated remote sequence still carries acks we may be missing, for packets that arrived out of order or
+            // whose more recent ack vectors were lost, so merge all of them instead of resending packets the remote already has
+            const uint32_t headOffset = aznumeric_cast<uint32_t>(SequenceId(m_headSequenceId - receivedSequenceId));
+            if (headOffset < m_ackWindow.GetValidBitCount())
+            {
+                ApplyRemoteAckBits(connection, sequenceWindow, headOffset);
+            }
+        }
+    }
 
-            for (uint32_t bit = 0; bit < m_ackWindow.NumBitsetChunkedBits; ++bit)
+    void UdpPacketIdWindow::ApplyRemoteAckBits(UdpConnection* connection, BitsetChunk sequenceWindow, uint32_t headOffset)
+    {
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        const uint32_t bitCount = AZStd::min<uint32_t>(m_ackWindow.NumBitsetChunkedBits, m_ackWindow.GetValidBitCount() - headOffset);
+        for (uint32_t bit = 0; bit < bitCount; ++bit)
+        {
+            if (!GetBitHelper(sequenceWindow, bit))
             {
-                if (!GetBitHelper(sequenceWindow, bit))
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (!m_ackWindow.GetBit(bit))
+            const uint32_t ackBit = headOffset + bit;
+            if (!m_ackWindow.GetBit(ackBit))
+            {
+                m_ackWindow.SetBit(ackBit, true);
+                AZLOG(NET_DebugUdp, "Acking packet ID %u", aznumeric_cast<uint32_t>(m_headPacketId) - ackBit);
+                if (connection != nullptr)
                 {
-                    m_ackWindow.SetBit(bit, true);
-                    AZLOG(NET_DebugUdp, "Acking packet ID %u", aznumeric_cast<uint32_t>(receivedPacketId) - bit);
-                    if (connection != nullptr)
-                    {
-                        connection->ProcessAcked(receivedPacketId - aznumeric_cast<PacketId>(bit), currentTimeMs);
-                    }
+                    connection->ProcessAcked(m_headPacketId - aznumeric_cast<PacketId>(ackBit), currentTimeMs);
                 }
             }
         }
@@ -79,6 +79,12 @@ namespace AzNetworking
 
     private:
 
+        //! Acks the packets set in a remote ack vector that we haven't seen acked yet.
+        //! @param connection     the connection to notify of newly acked packets, may be nullptr
+        //! @param sequenceWindow the remote ack vector
+        //! @param headOffset     number of packets the newest packet of the ack vector lags behind our head packet
+        void ApplyRemoteAckBits(UdpConnection* connection, BitsetChunk sequenceWindow, uint32_t headOffset);
+
         SequenceId m_headSequenceId;
         PacketId   m_headPacketId;
         PacketAckContainer m_ackWindow;
@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +185,40 @@ namespace AzNetworking
                     break;
                 }
 
+                // Read as many packets as will fit in both the receive buffer and the received packet list in a single call
+                const uint32_t bufferSlots = aznumeric_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t packetSlots = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t maxPackets = AZStd::min(AZStd::min(bufferSlots, packetSlots), UdpSocket::MaxReceiveBatchCount);
+                if (maxPackets == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + maxPackets * MaxUdpTransmissionUnit);
+
+                AZStd::array<IpAddress, UdpSocket::MaxReceiveBatchCount> addresses;
+                AZStd::array<int32_t, UdpSocket::MaxReceiveBatchCount> receivedBytes;
+                const int32_t receivedCount = socket->ReceiveBatch(dstData, MaxUdpTransmissionUnit, maxPackets, addresses.data(), receivedBytes.data());
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                // Packets are received into fixed size slots, compact them so the buffer only holds received data
+                uint32_t writeOffset = bufferHead;
+                for (int32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    if (receivedBytes[i] <= 0)
+                    {
+                        continue;
+                    }
+                    uint8_t* packetData = receiveBuffer.GetBuffer() + writeOffset;
+                    memmove(packetData, dstData + i * MaxUdpTransmissionUnit, receivedBytes[i]);
+                    receivedPackets.push_back(ReceivedPacket(addresses[i], packetData, receivedBytes[i]));
+                    writeOffset += receivedBytes[i];
                 }
-                else
+                receiveBuffer.Resize(writeOffset);
+
+                if (receivedCount < static_cast<int32_t>(maxPackets))
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
@@ -18,6 +18,14 @@
 namespace AzNetworking
 {
     AZ_CVAR(uint32_t, net_MaxReliablePacketsInWindow, 16384, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of reliable packets to allow to be queued up before triggering a disconnect");
+    AZ_CVAR(uint32_t, net_ReliableResendWindowMin, 4, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum number of resent reliable packets a connection may have in flight while backing off from packet loss");
+    AZ_CVAR(uint32_t, net_ReliableResendWindowMax, 256, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of resent reliable packets a connection may have in flight, further resends wait until earlier ones are acked or lost");
+
+    UdpReliableQueue::UdpReliableQueue()
+        : m_resendWindow(static_cast<float>(AZStd::max<uint32_t>(net_ReliableResendWindowMax, 1)))
+    {
+        ;
+    }
 
     UdpReliableQueue::~UdpReliableQueue()
     {
@@ -31,27 +39,44 @@ namespace AzNetworking
 
     uint32_t UdpReliableQueue::GetQueueSize() const
     {
-        return static_cast<uint32_t>(m_packetWindow.size());
+        return m_pendingPacketCount;
     }
 
-    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
+    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PooledPacketBuffer& payload)
     {
         AZLOG(NET_ReliableQueueDebug, "Inserting packetId %u with reliable sequenceId %u", static_cast<uint32_t>(packetId), static_cast<uint32_t>(reliableSequenceId));
-        if (m_packetWindow.size() > net_MaxReliablePacketsInWindow)
+        if (m_pendingPacketCount > net_MaxReliablePacketsInWindow)
         {
             return false;
         }
 
-        PendingPacketMap::const_iterator iter = m_packetWindow.find(packetId);
-        if (iter != m_packetWindow.end())
+        if (FindPendingPacket(packetId) != nullptr)
         {
             AZ_Assert(false, "Attempted to reinsert an existing packetId into the reliable queue");
             return false;
         }
-        m_packetWindow[packetId] = { reliableSequenceId, packet.Clone() };
+
+        if (m_pendingPackets.empty())
+        {
+            m_pendingPackets.resize(InitialPendingPacketCapacity);
+        }
+        while (m_pendingPackets[static_cast<uint32_t>(packetId) & (m_pendingPackets.size() - 1)].m_packetId != InvalidPacketId)
+        {
+            if (!GrowPendingPackets())
+            {
+                return false;
+            }
+        }
+
+        PendingPacket& pendingPacket = m_pendingPackets[static_cast<uint32_t>(packetId) & (m_pendingPackets.size() - 1)];
+        pendingPacket.m_packetId = packetId;
+        pendingPacket.m_reliableSequenceId = reliableSequenceId;
+        pendingPacket.m_packetType = packetType;
+        pendingPacket.m_isResend = false;
+        pendingPacket.m_payload = payload;
+        ++m_pendingPacketCount;
         return true;
     }
-
     bool UdpReliableQueue::OnPacketReceived(const UdpPacketHeader& header)
     {
         const SequenceId receivedSequence = header.GetReliableSequenceId();
@@ -92,10 +117,16 @@ namespace AzNetworking
         [[maybe_unused]] UdpConnection& connection, PacketId packetId)
     {
         AZLOG(NET_ReliableQueueDebug, "Acked packetId %u", static_cast<uint32_t>(packetId));
-        PendingPacketMap::const_iterator iter = m_packetWindow.find(packetId);
-        if (iter != m_packetWindow.end())
+        PendingPacket* pendingPacket = FindPendingPacket(packetId);
+        if (pendingPacket != nullptr)
         {
-            m_packetWindow.erase(iter);
+            if (pendingPacket->m_isResend)
+            {
+                // A resend got through, open the resend window back up
+                --m_resendsInFlight;
+                m_resendWindow = AZStd::min(m_resendWindow + 1.0f, static_cast<float>(AZStd::max<uint32_t>(net_ReliableResendWindowMax, 1)));
+            }
+            RemovePendingPacket(*pendingPacket);
         }
     }
 
@@ -104,16 +135,24 @@ namespace AzNetworking
         AZLOG(NET_ReliableQueueDebug, "Lost packetId %u", static_cast<uint32_t>(packetId));
 
         bool result = false;
-        AZStd::unique_ptr<IPacket> lostPacket;
+        PooledPacketBuffer lostPayload;
+        PacketType lostPacketType = PacketType{ 0 };
         SequenceId lostReliableSequenceId = InvalidSequenceId;
 
-        PendingPacketMap::iterator iter = m_packetWindow.find(packetId);
-        if (iter != m_packetWindow.end())
+        PendingPacket* pendingPacket = FindPendingPacket(packetId);
+        if (pendingPacket != nullptr)
         {
-            AZ_Assert(iter->second.m_packet != nullptr, "Timed out reliable packet was nullptr");
-            lostPacket = AZStd::move(iter->second.m_packet); // This transfers ownership out of the pending packet to this local scoped alloc
-            lostReliableSequenceId = iter->second.m_reliableSequenceId;
-            m_packetWindow.erase(iter);
+            AZ_Assert(pendingPacket->m_payload.IsValid(), "Timed out reliable packet had no payload");
+            lostPayload = AZStd::move(pendingPacket->m_payload); // This transfers ownership out of the pending packet to this local scope
+            lostPacketType = pendingPacket->m_packetType;
+            lostReliableSequenceId = pendingPacket->m_reliableSequenceId;
+            if (pendingPacket->m_isResend)
+            {
+                // A resend was lost again, the link is congested so back off
+                --m_resendsInFlight;
+                m_resendWindow = AZStd::max(m_resendWindow * 0.5f, static_cast<float>(AZStd::max<uint32_t>(net_ReliableResendWindowMin, 1)));
+            }
+            RemovePendingPacket(*pendingPacket);
         }
         else
         {
@@ -124,19 +163,79 @@ namespace AzNetworking
         {
             AZLOG(NET_ReliableQueue, "Resending reliable packetId %u due to loss", static_cast<uint32_t>(lostReliableSequenceId));
 
-            // This punches down an abstraction layer purposefully to resend using the existing reliable SequenceId
-            // NOTE: This will call back into UdpReliableQueue::PrepareForSend!!
-            if (networkInterface.SendPacket(connection, *lostPacket, lostReliableSequenceId) == InvalidPacketId)
+            const PacketId resentPacketId = networkInterface.SendPacket(connection, lostPacketType, lostPayload, lostReliableSequenceId);
+            if (resentPacketId == InvalidPacketId)
             {
-                // Packet failed to retransmit, meaning no retry attempt was made
-                // Since we've lost a reliable packet, the appropriate response is to terminate the connection
                 connection.Disconnect(DisconnectReason::ReliableTransportFailure, TerminationEndpoint::Local);
                 result = true;
             }
+            else if (PendingPacket* resentPacket = FindPendingPacket(resentPacketId))
+            {
+                resentPacket->m_isResend = true;
+                ++m_resendsInFlight;
+            }
 
             networkInterface.GetMetrics().m_resentPackets++;
         }
 
         return result;
     }
+
+    bool UdpReliableQueue::CanResend(PacketId packetId) const
+    {
+        const PendingPacket* pendingPacket = FindPendingPacket(packetId);
+        if (pendingPacket == nullptr)
+        {
+            return true;
+        }
+
+        // Resending a lost resend frees its own place in the window
+        const uint32_t resendsInFlight = pendingPacket->m_isResend ? m_resendsInFlight - 1 : m_resendsInFlight;
+        return resendsInFlight < static_cast<uint32_t>(m_resendWindow);
+    }
+
+    const PendingPacket* UdpReliableQueue::FindPendingPacket(PacketId packetId) const
+    {
+        if (m_pendingPackets.empty() || (packetId == InvalidPacketId))
+        {
+            return nullptr;
+        }
+        const PendingPacket& pendingPacket = m_pendingPackets[static_cast<uint32_t>(packetId) & (m_pendingPackets.size() - 1)];
+        return (pendingPacket.m_packetId == packetId) ? &pendingPacket : nullptr;
+    }
+
+    PendingPacket* UdpReliableQueue::FindPendingPacket(PacketId packetId)
+    {
+        return const_cast<PendingPacket*>(static_cast<const UdpReliableQueue*>(this)->FindPendingPacket(packetId));
+    }
+
+    bool UdpReliableQueue::GrowPendingPackets()
+    {
+        // Packets further apart than the ack window can no longer be acked, so the ring never needs to be larger than it
+        const AZStd::size_t capacity = m_pendingPackets.size() * 2;
+        if (capacity > PacketWindowAckCount)
+        {
+            AZLOG_ERROR("Reliable packets in flight span more than %u packet ids", PacketWindowAckCount);
+            return false;
+        }
+
+        // Distinct slots of the smaller ring always map to distinct slots of the larger one
+        AZStd::vector<PendingPacket> pendingPackets(capacity);
+        for (PendingPacket& pendingPacket : m_pendingPackets)
+        {
+            if (pendingPacket.m_packetId != InvalidPacketId)
+            {
+                pendingPackets[static_cast<uint32_t>(pendingPacket.m_packetId) & (capacity - 1)] = AZStd::move(pendingPacket);
+            }
+        }
+        m_pendingPackets.swap(pendingPackets);
+        return true;
+    }
+
+    void UdpReliableQueue::RemovePendingPacket(PendingPacket& pendingPacket)
+    {
+        pendingPacket.m_packetId = InvalidPacketId;
+        pendingPacket.m_payload.Reset();
+        --m_pendingPacketCount;
+    }
 }
@@ -12,7 +12,8 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -23,8 +24,11 @@ namespace AzNetworking
 
     struct PendingPacket
     {
-        SequenceId m_reliableSequenceId;
-        AZStd::unique_ptr<IPacket> m_packet;
+        PacketId m_packetId = InvalidPacketId;
+        SequenceId m_reliableSequenceId = InvalidSequenceId;
+        PacketType m_packetType = PacketType{ 0 };
+        bool m_isResend = false;
+        PooledPacketBuffer m_payload; //< shared with the sent packet, the payload is never copied
     };
 
     //! @class UdpReliableQueue
@@ -33,7 +37,7 @@ namespace AzNetworking
     {
     public:
 
-        UdpReliableQueue() = default;
+        UdpReliableQueue();
         ~UdpReliableQueue();
 
         //! Returns the next sequence id for this generator instance.
@@ -47,9 +51,10 @@ namespace AzNetworking
         //! Called when we're going to transmit a packet that we want to be reliable.
         //! @param packetId           packet id of the packet we're sending
         //! @param reliableSequenceId the reliable sequence identifier of the packet we're sending
-        //! @param packet             reference to the packet being transmitted
+        //! @param packetType         the type of the packet we're sending
+        //! @param payload            the serialized payload of the packet we're sending, retained until the packet is acked
         //! @return boolean true on success, false on failure
-        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PooledPacketBuffer& payload);
 
         //! Called when a reliable packet has been received.
         //! @param header the header for the received reliable packet
@@ -68,16 +73,32 @@ namespace AzNetworking
         //! @return boolean true if the packet was lost and no retry attempt was made, false otherwise
         bool OnPacketLost(UdpNetworkInterface& networkInterface, UdpConnection& connection, PacketId packetId);
 
+        //! Returns whether a lost reliable packet can be resent now.
+        //! Resends are paced by a window of resent packets in flight, the window halves when a resent packet is lost again
+        //! and grows back as resent packets are acked, so a lossy link isn't flooded with resends on top of its regular traffic.
+        //! @param packetId the identifier of the lost packet
+        //! @return boolean true if the packet can be resent, false if it should be retried later
+        bool CanResend(PacketId packetId) const;
+
     private:
 
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
+        static constexpr uint32_t InitialPendingPacketCapacity = 64;
 
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
-        using PendingPacketMap = AZStd::unordered_map<PacketId, PendingPacket>;
+
+        // Pending packets are stored in a ring indexed by packet id, which grows when the ids in flight span beyond its size
+        const PendingPacket* FindPendingPacket(PacketId packetId) const;
+        PendingPacket* FindPendingPacket(PacketId packetId);
+        bool GrowPendingPackets();
+        void RemovePendingPacket(PendingPacket& pendingPacket);
 
         SequenceGenerator  m_reliableSequenceGenerator;
         SequenceId         m_lastReceivedReliableSequenceId = InvalidSequenceId;
         PacketAckContainer m_receivedSequenceHistory;
-        PendingPacketMap   m_packetWindow;
+        AZStd::vector<PendingPacket> m_pendingPackets;
+        uint32_t           m_pendingPacketCount = 0;
+        float              m_resendWindow = 0.0f;
+        uint32_t           m_resendsInFlight = 0;
     };
 }
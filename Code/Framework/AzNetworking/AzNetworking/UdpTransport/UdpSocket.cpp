@@ -18,11 +18,26 @@
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Interface/Interface.h>
 
+#if AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD
+#   include <netinet/udp.h>
+#   ifndef UDP_SEGMENT
+#       define UDP_SEGMENT 103
+#   endif
+#endif
+
 namespace AzNetworking
 {
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSends, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP payloads are queued and sent in batches once per network update instead of one system call per payload");
+    AZ_CVAR(bool, net_UdpUseSegmentationOffload, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, batched UDP sends will use UDP segmentation offload (GSO) where the kernel supports it");
+
+#if AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD
+    // Kernel limits on the number of segments and the total payload size of a single segmented send
+    static constexpr uint32_t MaxSegmentCount = 64;
+    static constexpr uint32_t MaxSegmentedPayloadSize = 65000;
+#endif
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +83,20 @@ namespace AzNetworking
             }
         }
 
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        if (m_sharedPort)
+        {
+            const int32_t reusePort = 1;
+            if (setsockopt(static_cast<int32_t>(m_socketFd), SOL_SOCKET, SO_REUSEPORT, (const char*)&reusePort, sizeof(reusePort)) != SocketOpResultSuccess)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_ERROR("Failed to enable port sharing for UDP socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                Close();
+                return false;
+            }
+        }
+#endif
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -91,15 +120,37 @@ namespace AzNetworking
             return false;
         }
 
+#if AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD
+        // Querying the segment size fails on kernels that don't support UDP segmentation offload
+        {
+            int32_t segmentSize = 0;
+            socklen_t segmentSizeLen = sizeof(segmentSize);
+            m_segmentationOffloadSupported = net_UdpUseSegmentationOffload
+                && (getsockopt(static_cast<int32_t>(m_socketFd), SOL_UDP, UDP_SEGMENT, &segmentSize, &segmentSizeLen) == 0);
+        }
+#endif
+
         return true;
     }
 
     void UdpSocket::Close()
     {
+        // Make sure anything queued, such as disconnect notifications, goes out before the socket is closed
+        FlushSendQueue();
+        m_sendQueue.clear();
+        m_sendQueueBuffer.clear();
+        m_segmentationOffloadSupported = false;
+
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
 
+    void UdpSocket::SetSharedPort(bool sharedPort)
+    {
+        AZ_Assert(!IsOpen(), "SetSharedPort must be called before the socket is opened");
+        m_sharedPort = sharedPort;
+    }
+
     int32_t UdpSocket::Send
     (
         const IpAddress& address,
@@ -224,8 +275,254 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(uint8_t* outData, uint32_t packetSize, uint32_t maxPackets, IpAddress* outAddresses, int32_t* outSizes) const
+    {
+        AZ_Assert(packetSize > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+        AZ_Assert(maxPackets <= MaxReceiveBatchCount, "Requested more packets than can be received in a single batch");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        maxPackets = AZStd::min(maxPackets, MaxReceiveBatchCount);
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxReceiveBatchCount];
+        iovec buffers[MaxReceiveBatchCount];
+        sockaddr_in fromAddresses[MaxReceiveBatchCount];
+        memset(messages, 0, sizeof(mmsghdr) * maxPackets);
+
+        for (uint32_t i = 0; i < maxPackets; ++i)
+        {
+            buffers[i].iov_base = outData + i * packetSize;
+            buffers[i].iov_len = packetSize;
+            messages[i].msg_hdr.msg_name = &fromAddresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int32_t receivedCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, maxPackets, MSG_DONTWAIT, nullptr);
+
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+
+            bool ignoreForciblyClosedError = false;
+            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            {
+                return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+            }
+
+            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return 0;
+        }
+
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            outAddresses[i] = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+            outSizes[i] = static_cast<int32_t>(messages[i].msg_len);
+            if (outSizes[i] > 0)
+            {
+                m_recvPackets++;
+                m_recvBytes += outSizes[i];
+            }
+        }
+        return receivedCount;
+#else
+        int32_t receivedCount = 0;
+        for (uint32_t i = 0; i < maxPackets; ++i)
+        {
+            const int32_t receivedBytes = Receive(outAddresses[i], outData + i * packetSize, packetSize);
+            if (receivedBytes <= 0)
+            {
+                return (receivedCount > 0) ? receivedCount : receivedBytes;
+            }
+            outSizes[i] = receivedBytes;
+            ++receivedCount;
+        }
+        return receivedCount;
+#endif
+    }
+
+    uint32_t UdpSocket::FlushSendQueue() const
+    {
+        if (m_sendQueue.empty())
+        {
+            return 0;
+        }
+
+        if (!IsOpen())
+        {
+            m_sendQueue.clear();
+            m_sendQueueBuffer.clear();
+            return 0;
+        }
+
+        const uint32_t queuedCount = aznumeric_cast<uint32_t>(m_sendQueue.size());
+        uint32_t sentCount = 0;
+        uint32_t fallbackIndex = queuedCount;
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxSendBatchCount];
+        iovec buffers[MaxSendBatchCount];
+        sockaddr_in destAddresses[MaxSendBatchCount];
+        uint32_t firstPacketIndices[MaxSendBatchCount];
+#if AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD
+        alignas(cmsghdr) char controlBuffers[MaxSendBatchCount][CMSG_SPACE(sizeof(uint16_t))];
+#endif
+
+        // Build one message per payload, or one per run of payloads that can be sent as a single segmented datagram
+        uint32_t messageCount = 0;
+        for (uint32_t packetIndex = 0; packetIndex < queuedCount; ++messageCount)
+        {
+            const QueuedSend& first = m_sendQueue[packetIndex];
+            uint32_t segmentCount = 1;
+            uint32_t messageSize = first.m_size;
+#if AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD
+            if (m_segmentationOffloadSupported)
+            {
+                // Payloads are stored contiguously in queue order, so a run of payloads to the same endpoint can be
+                // handed to the kernel as a single buffer. Only the last segment is allowed to be smaller than the rest.
+                while ((packetIndex + segmentCount < queuedCount) && (segmentCount < MaxSegmentCount))
+                {
+                    const QueuedSend& next = m_sendQueue[packetIndex + segmentCount];
+                    if ((next.m_address != first.m_address) || (next.m_size > first.m_size)
+                     || (messageSize + next.m_size > MaxSegmentedPayloadSize))
+                    {
+                        break;
+                    }
+                    messageSize += next.m_size;
+                    ++segmentCount;
+                    if (next.m_size < first.m_size)
+                    {
+                        break;
+                    }
+                }
+            }
+#endif
+
+            memset(&messages[messageCount], 0, sizeof(mmsghdr));
+            memset(&destAddresses[messageCount], 0, sizeof(sockaddr_in));
+            destAddresses[messageCount].sin_family = AF_INET;
+            destAddresses[messageCount].sin_addr.s_addr = first.m_address.GetAddress(ByteOrder::Network);
+            destAddresses[messageCount].sin_port = first.m_address.GetPort(ByteOrder::Network);
+            buffers[messageCount].iov_base = m_sendQueueBuffer.data() + first.m_offset;
+            buffers[messageCount].iov_len = messageSize;
+
+            msghdr& header = messages[messageCount].msg_hdr;
+            header.msg_name = &destAddresses[messageCount];
+            header.msg_namelen = sizeof(sockaddr_in);
+            header.msg_iov = &buffers[messageCount];
+            header.msg_iovlen = 1;
+#if AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD
+            if (segmentCount > 1)
+            {
+                header.msg_control = controlBuffers[messageCount];
+                header.msg_controllen = sizeof(controlBuffers[messageCount]);
+                cmsghdr* control = CMSG_FIRSTHDR(&header);
+                control->cmsg_level = SOL_UDP;
+                control->cmsg_type = UDP_SEGMENT;
+                control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                const uint16_t segmentSize = aznumeric_cast<uint16_t>(first.m_size);
+                memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+            }
+#endif
+            firstPacketIndices[messageCount] = packetIndex;
+            packetIndex += segmentCount;
+        }
+
+        uint32_t messageIndex = 0;
+        while (messageIndex < messageCount)
+        {
+            const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), &messages[messageIndex], messageCount - messageIndex, 0);
+            if (result < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+
+                if (ErrorIsWouldBlock(error)) // Filter would block messages, the remaining payloads are dropped like any unsent datagram
+                {
+                    break;
+                }
+
+#if AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD
+                if ((error == EIO) && m_segmentationOffloadSupported)
+                {
+                    // The kernel supports segmentation offload but the network device doesn't, send the remaining payloads individually
+                    AZLOG_WARN("UDP segmentation offload is not supported by the network device, disabling");
+                    m_segmentationOffloadSupported = false;
+                    fallbackIndex = firstPacketIndices[messageIndex];
+                    break;
+                }
+#endif
+
+                AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                break;
+            }
+
+            messageIndex += static_cast<uint32_t>(result);
+            sentCount = (messageIndex < messageCount) ? firstPacketIndices[messageIndex] : queuedCount;
+        }
+#else
+        fallbackIndex = 0;
+#endif
+
+        for (uint32_t packetIndex = fallbackIndex; packetIndex < queuedCount; ++packetIndex)
+        {
+            const QueuedSend& queued = m_sendQueue[packetIndex];
+            if (SendTo(queued.m_address, m_sendQueueBuffer.data() + queued.m_offset, queued.m_size) < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error))
+                {
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+                break;
+            }
+            ++sentCount;
+        }
+
+        m_sendQueue.clear();
+        m_sendQueueBuffer.clear();
+        return sentCount;
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+    {
+        if (net_UdpBatchSends)
+        {
+            return QueueSend(address, data, size);
+        }
+        return SendTo(address, data, size);
+    }
+
+    int32_t UdpSocket::QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const
+    {
+        if (m_sendQueue.size() >= MaxSendBatchCount)
+        {
+            FlushSendQueue();
+        }
+
+        if (m_sendQueue.capacity() < MaxSendBatchCount)
+        {
+            m_sendQueue.reserve(MaxSendBatchCount);
+            m_sendQueueBuffer.reserve(MaxSendBatchCount * MaxUdpTransmissionUnit);
+        }
+
+        m_sendQueue.push_back(QueuedSend{ address, aznumeric_cast<uint32_t>(m_sendQueueBuffer.size()), size });
+        m_sendQueueBuffer.insert(m_sendQueueBuffer.end(), data, data + size);
+        return static_cast<int32_t>(size);
+    }
+
+    int32_t UdpSocket::SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
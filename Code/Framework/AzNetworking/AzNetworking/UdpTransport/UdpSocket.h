@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +43,12 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of payloads that can be queued for send before the queue is flushed.
+        static constexpr uint32_t MaxSendBatchCount = 256;
+
+        //! Maximum number of payloads that can be read off the socket in a single call to ReceiveBatch.
+        static constexpr uint32_t MaxReceiveBatchCount = 64;
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -72,11 +79,17 @@ namespace AzNetworking
         //! Closes an open socket.
         virtual void Close();
 
+        //! Allows multiple sockets to be bound to the same port, incoming datagrams are distributed between them by the kernel based on the remote endpoint.
+        //! Has no effect on platforms without SO_REUSEPORT support, and must be called before Open.
+        //! @param sharedPort if true, the socket will be opened with a port that can be shared with other sockets
+        void SetSharedPort(bool sharedPort);
+
         //! Returns true if the UDP socket is currently in an open state.
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
 
         //! Sends a single payload over the UDP socket to the connected endpoint.
+        //! If send batching is enabled (net_UdpBatchSends), the payload is queued and transmitted on the next call to FlushSendQueue.
         //! @param address           the address to send the payload to
         //! @param data              pointer to the data to send
         //! @param size              size of the payload in bytes
@@ -93,6 +106,21 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param outData      on success, address to write the received data to, payload i is written at outData + i * packetSize
+        //! @param packetSize   maximum size of a single payload
+        //! @param maxPackets   maximum number of payloads to receive, at most MaxReceiveBatchCount
+        //! @param outAddresses on success, the address of the endpoint that sent each payload
+        //! @param outSizes     on success, the number of bytes received for each payload
+        //! @return number of payloads received, <= 0 on error or if there was no data to receive
+        int32_t ReceiveBatch(uint8_t* outData, uint32_t packetSize, uint32_t maxPackets, IpAddress* outAddresses, int32_t* outSizes) const;
+
+        //! Transmits all payloads queued by Send, using as few system calls as the platform supports.
+        //! Consecutive equally sized payloads to the same endpoint are sent as a single segmented datagram where UDP
+        //! segmentation offload is available.
+        //! @return number of payloads transmitted
+        uint32_t FlushSendQueue() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,7 +158,24 @@ namespace AzNetworking
 
     private:
 
+        //! Queues a payload for transmission on the next call to FlushSendQueue.
+        int32_t QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        //! Transmits a single payload directly on the socket.
+        int32_t SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        mutable AZStd::vector<QueuedSend> m_sendQueue;
+        mutable AZStd::vector<uint8_t> m_sendQueueBuffer;
+        mutable bool m_segmentationOffloadSupported = false;
+        bool m_sharedPort = false;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
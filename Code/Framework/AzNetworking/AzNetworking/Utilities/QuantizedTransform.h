@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! @class QuantizedQuaternion
+    //! @brief Serializes a unit quaternion as its three smallest components packed into 32 bits.
+    //! The largest component is dropped and reconstructed from the unit length constraint, and the quaternion is negated
+    //! if needed so the dropped component is always positive. The remaining components lie within +/- 1/sqrt(2) and are
+    //! stored with 10 bits each, alongside 2 bits identifying the dropped component.
+    class QuantizedQuaternion
+    {
+    public:
+
+        static constexpr uint32_t BitsPerComponent = 10;
+
+        //! Default constructor, initializes to the identity quaternion.
+        QuantizedQuaternion() = default;
+
+        //! Construct from a quaternion value.
+        //! @param value quaternion value to construct from
+        explicit QuantizedQuaternion(const AZ::Quaternion& value);
+
+        //! Assignment from quaternion value.
+        //! @param rhs value to assign from
+        QuantizedQuaternion& operator =(const AZ::Quaternion& rhs);
+
+        //! Const underlying type operator.
+        //! @return underlying value
+        operator AZ::Quaternion() const;
+
+        //! Packs a quaternion into its smallest three representation.
+        //! @param value the quaternion to pack, does not need to be normalized
+        //! @return the packed quaternion
+        static uint32_t Pack(const AZ::Quaternion& value);
+
+        //! Reconstructs a quaternion from its smallest three representation.
+        //! @param packed the packed quaternion
+        //! @return the unpacked, normalized quaternion
+        static AZ::Quaternion Unpack(uint32_t packed);
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        AZ::Quaternion m_value = AZ::Quaternion::CreateIdentity();
+    };
+
+    //! @class QuantizedTranslation
+    //! @brief Serializes a translation as fixed point values with a variable number of bytes per axis.
+    //! Each axis is quantized to 1 / UNITS_PER_METER and stored zig-zag encoded using only as many bytes as its magnitude
+    //! requires, preceded by a single header byte holding the byte count of each axis. Translations too large to be
+    //! represented in fixed point fall back to full precision floats.
+    template <uint32_t UNITS_PER_METER>
+    class QuantizedTranslation
+    {
+    public:
+
+        static_assert(UNITS_PER_METER > 0, "QuantizedTranslation requires a non-zero resolution");
+
+        //! The largest absolute axis value that is quantized, larger values are sent at full precision.
+        static constexpr float MaxQuantizedValue = static_cast<float>(1 << 30) / static_cast<float>(UNITS_PER_METER);
+
+        //! Default constructor, initializes to zero.
+        QuantizedTranslation() = default;
+
+        //! Construct from a vector value.
+        //! @param value vector value to construct from
+        explicit QuantizedTranslation(const AZ::Vector3& value);
+
+        //! Assignment from vector value.
+        //! @param rhs value to assign from
+        QuantizedTranslation& operator =(const AZ::Vector3& rhs);
+
+        //! Const underlying type operator.
+        //! @return underlying value
+        operator AZ::Vector3() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        // Header byte layout, two bits per axis holding (byte count - 1), and a flag for full precision values
+        static constexpr uint8_t FullPrecisionFlag = 0x80;
+        static constexpr uint32_t BitsPerAxis = 2;
+
+        AZ::Vector3 m_value = AZ::Vector3::CreateZero();
+    };
+}
+
+#include <AzNetworking/Utilities/QuantizedTransform.inl>
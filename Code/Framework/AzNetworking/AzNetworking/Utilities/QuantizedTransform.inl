@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    namespace QuantizedTransformInternal
+    {
+        // The three smallest components of a unit quaternion are bounded by +/- 1/sqrt(2)
+        static constexpr float MaxSmallestComponent = 0.70710678118f;
+        static constexpr uint32_t ComponentMask = (1 << QuantizedQuaternion::BitsPerComponent) - 1;
+        static constexpr float ComponentScale = static_cast<float>(ComponentMask);
+
+        inline uint32_t ZigZagEncode(int32_t value)
+        {
+            return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        }
+
+        inline int32_t ZigZagDecode(uint32_t value)
+        {
+            return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+        }
+
+        inline uint32_t GetByteCount(uint32_t value)
+        {
+            return (value < 0x100) ? 1 : (value < 0x10000) ? 2 : (value < 0x1000000) ? 3 : 4;
+        }
+    }
+
+    inline QuantizedQuaternion::QuantizedQuaternion(const AZ::Quaternion& value)
+        : m_value(value)
+    {
+        ;
+    }
+
+    inline QuantizedQuaternion& QuantizedQuaternion::operator =(const AZ::Quaternion& rhs)
+    {
+        m_value = rhs;
+        return *this;
+    }
+
+    inline QuantizedQuaternion::operator AZ::Quaternion() const
+    {
+        return m_value;
+    }
+
+    inline uint32_t QuantizedQuaternion::Pack(const AZ::Quaternion& value)
+    {
+        using namespace QuantizedTransformInternal;
+
+        const AZ::Quaternion normalized = (value.GetLengthSq() > AZ::Constants::FloatEpsilon) ? value.GetNormalized() : AZ::Quaternion::CreateIdentity();
+        float components[4];
+        normalized.StoreToFloat4(components);
+
+        uint32_t largest = 0;
+        for (uint32_t i = 1; i < 4; ++i)
+        {
+            if (fabsf(components[i]) > fabsf(components[largest]))
+            {
+                largest = i;
+            }
+        }
+
+        // q and -q represent the same rotation, so flip the quaternion to make the dropped component positive
+        const float sign = (components[largest] < 0.0f) ? -1.0f : 1.0f;
+        uint32_t packed = largest << (BitsPerComponent * 3);
+        uint32_t shift = BitsPerComponent * 2;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i != largest)
+            {
+                const float normalizedComponent = (sign * components[i] / MaxSmallestComponent + 1.0f) * 0.5f;
+                const float scaled = AZStd::clamp(normalizedComponent * ComponentScale + 0.5f, 0.0f, ComponentScale);
+                packed |= static_cast<uint32_t>(scaled) << shift;
+                shift -= BitsPerComponent;
+            }
+        }
+        return packed;
+    }
+
+    inline AZ::Quaternion QuantizedQuaternion::Unpack(uint32_t packed)
+    {
+        using namespace QuantizedTransformInternal;
+
+        const uint32_t largest = (packed >> (BitsPerComponent * 3)) & 0x03;
+        float components[4];
+        float sumOfSquares = 0.0f;
+        uint32_t shift = BitsPerComponent * 2;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i != largest)
+            {
+                const float normalizedComponent = static_cast<float>((packed >> shift) & ComponentMask) / ComponentScale;
+                components[i] = (normalizedComponent * 2.0f - 1.0f) * MaxSmallestComponent;
+                sumOfSquares += components[i] * components[i];
+                shift -= BitsPerComponent;
+            }
+        }
+        components[largest] = sqrtf(AZStd::max(0.0f, 1.0f - sumOfSquares));
+        return AZ::Quaternion::CreateFromFloat4(components).GetNormalized();
+    }
+
+    inline bool QuantizedQuaternion::Serialize(ISerializer& serializer)
+    {
+        uint32_t packed = Pack(m_value);
+        serializer.Serialize(packed, "SmallestThree");
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            m_value = Unpack(packed);
+        }
+        return serializer.IsValid();
+    }
+
+    template <uint32_t UNITS_PER_METER>
+    inline QuantizedTranslation<UNITS_PER_METER>::QuantizedTranslation(const AZ::Vector3& value)
+        : m_value(value)
+    {
+        ;
+    }
+
+    template <uint32_t UNITS_PER_METER>
+    inline QuantizedTranslation<UNITS_PER_METER>& QuantizedTranslation<UNITS_PER_METER>::operator =(const AZ::Vector3& rhs)
+    {
+        m_value = rhs;
+        return *this;
+    }
+
+    template <uint32_t UNITS_PER_METER>
+    inline QuantizedTranslation<UNITS_PER_METER>::operator AZ::Vector3() const
+    {
+        return m_value;
+    }
+
+    template <uint32_t UNITS_PER_METER>
+    inline bool QuantizedTranslation<UNITS_PER_METER>::Serialize(ISerializer& serializer)
+    {
+        using namespace QuantizedTransformInternal;
+        using SimdType = AZ::Simd::Vec3;
+
+        // Quantize all three axes at once, the fourth lane is only there to match the width of the simd store
+        int32_t quantized[4] = { 0, 0, 0, 0 };
+        uint8_t header = 0;
+        const SimdType::FloatType value = m_value.GetSimdValue();
+        if (SimdType::CmpAllLt(SimdType::Abs(value), SimdType::Splat(MaxQuantizedValue)))
+        {
+            const SimdType::FloatType scaled = SimdType::Mul(value, SimdType::Splat(static_cast<float>(UNITS_PER_METER)));
+            SimdType::StoreUnaligned(quantized, SimdType::ConvertToIntNearest(scaled));
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                header |= static_cast<uint8_t>((GetByteCount(ZigZagEncode(quantized[axis])) - 1) << (axis * BitsPerAxis));
+            }
+        }
+        else
+        {
+            header = FullPrecisionFlag;
+        }
+
+        serializer.Serialize(header, "Header");
+        const bool writeToObject = (serializer.GetSerializerMode() == SerializerMode::WriteToObject);
+        if ((header & FullPrecisionFlag) != 0)
+        {
+            float x = m_value.GetX();
+            float y = m_value.GetY();
+            float z = m_value.GetZ();
+            serializer.Serialize(x, "X");
+            serializer.Serialize(y, "Y");
+            serializer.Serialize(z, "Z");
+            if (writeToObject)
+            {
+                m_value.Set(x, y, z);
+            }
+            return serializer.IsValid();
+        }
+
+        for (uint32_t axis = 0; axis < 3; ++axis)
+        {
+            const uint32_t byteCount = ((header >> (axis * BitsPerAxis)) & 0x03) + 1;
+            const uint32_t encoded = ZigZagEncode(quantized[axis]);
+            uint32_t decoded = 0;
+            for (uint32_t byteIndex = 0; byteIndex < byteCount; ++byteIndex)
+            {
+                uint8_t byte = static_cast<uint8_t>(encoded >> (byteIndex * 8));
+                serializer.Serialize(byte, "Byte");
+                decoded |= static_cast<uint32_t>(byte) << (byteIndex * 8);
+            }
+            quantized[axis] = ZigZagDecode(decoded);
+        }
+
+        if (writeToObject)
+        {
+            const SimdType::FloatType dequantized = SimdType::ConvertToFloat(SimdType::LoadUnaligned(quantized));
+            m_value = AZ::Vector3(SimdType::Mul(dequantized, SimdType::Splat(1.0f / static_cast<float>(UNITS_PER_METER))));
+        }
+        return serializer.IsValid();
+    }
+}
@@ -34,6 +34,9 @@ set(FILES
     DataStructures/FixedSizeVectorBitset.h
     DataStructures/FixedSizeVectorBitset.inl
     DataStructures/IBitset.h
+    DataStructures/PacketBufferPool.cpp
+    DataStructures/PacketBufferPool.h
+    DataStructures/PacketBufferPool.inl
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
     DataStructures/TimeoutQueue.cpp
@@ -74,6 +77,8 @@ set(FILES
     TcpTransport/TcpPacketHeader.cpp
     TcpTransport/TcpPacketHeader.h
     TcpTransport/TcpPacketHeader.inl
+    TcpTransport/TcpReceiveThread.cpp
+    TcpTransport/TcpReceiveThread.h
     TcpTransport/TcpRingBuffer.h
     TcpTransport/TcpRingBuffer.inl
     TcpTransport/TcpRingBufferImpl.cpp
@@ -96,6 +101,10 @@ set(FILES
     UdpTransport/DtlsEndpoint.h
     UdpTransport/DtlsSocket.cpp
     UdpTransport/DtlsSocket.h
+    UdpTransport/UdpBbrCongestionController.cpp
+    UdpTransport/UdpBbrCongestionController.h
+    UdpTransport/UdpCongestionController.cpp
+    UdpTransport/UdpCongestionController.h
     UdpTransport/UdpConnection.cpp
     UdpTransport/UdpConnection.h
     UdpTransport/UdpConnection.inl
@@ -133,6 +142,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/QuantizedTransform.h
+    Utilities/QuantizedTransform.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -14,4 +14,7 @@
 #define AZ_TRAIT_USE_SOCKET_SERVER_SELECT 0
 #define AZ_TRAIT_USE_OPENSSL 0
 #define AZ_TRAIT_NEEDS_HTONLL 1
+#define AZ_TRAIT_USE_SOCKET_BATCHED_IO 1
+#define AZ_TRAIT_USE_SOCKET_REUSEPORT 1
+#define AZ_TRAIT_USE_UDP_SEGMENTATION_OFFLOAD 0
 
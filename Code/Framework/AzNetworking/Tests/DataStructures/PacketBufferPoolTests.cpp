@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using PacketBufferPoolTests = ScopedAllocatorSetupFixture;
+
+    TEST_F(PacketBufferPoolTests, AcquireSelectsSizeClass)
+    {
+        AzNetworking::PacketBufferPool pool;
+
+        AzNetworking::PooledPacketBuffer small = pool.Acquire(AzNetworking::MaxUdpTransmissionUnit);
+        AzNetworking::PooledPacketBuffer large = pool.Acquire(AzNetworking::MaxPacketSize);
+
+        EXPECT_TRUE(small.IsValid());
+        EXPECT_EQ(small.GetCapacity(), AzNetworking::PacketBufferPool::SmallBufferCapacity);
+        EXPECT_EQ(large.GetCapacity(), AzNetworking::PacketBufferPool::LargeBufferCapacity);
+        EXPECT_EQ(small.GetSize(), 0);
+        EXPECT_EQ(pool.GetActiveBufferCount(), 2);
+    }
+
+    TEST_F(PacketBufferPoolTests, SharedBufferReleasedWithLastReference)
+    {
+        AzNetworking::PacketBufferPool pool;
+
+        AzNetworking::PooledPacketBuffer buffer = pool.Acquire(64);
+        buffer.GetBuffer()[0] = 0xAB;
+        buffer.SetSize(1);
+
+        AzNetworking::PooledPacketBuffer copy = buffer;
+        EXPECT_EQ(copy.GetBuffer(), buffer.GetBuffer());
+        EXPECT_EQ(copy.GetSize(), 1);
+
+        buffer.Reset();
+        EXPECT_FALSE(buffer.IsValid());
+        EXPECT_EQ(pool.GetActiveBufferCount(), 1);
+        EXPECT_EQ(copy.GetBuffer()[0], 0xAB);
+
+        AzNetworking::PooledPacketBuffer moved = AZStd::move(copy);
+        EXPECT_FALSE(copy.IsValid());
+        EXPECT_EQ(pool.GetActiveBufferCount(), 1);
+
+        moved.Reset();
+        EXPECT_EQ(pool.GetActiveBufferCount(), 0);
+        EXPECT_EQ(pool.GetFreeBufferCount(), 1);
+    }
+
+    TEST_F(PacketBufferPoolTests, ReleasedBufferIsReused)
+    {
+        AzNetworking::PacketBufferPool pool;
+
+        const uint8_t* firstBuffer = nullptr;
+        {
+            AzNetworking::PooledPacketBuffer buffer = pool.Acquire(64);
+            buffer.SetSize(32);
+            firstBuffer = buffer.GetBuffer();
+        }
+
+        AzNetworking::PooledPacketBuffer buffer = pool.Acquire(128);
+        EXPECT_EQ(buffer.GetBuffer(), firstBuffer);
+        EXPECT_EQ(buffer.GetSize(), 0);
+        EXPECT_EQ(pool.GetFreeBufferCount(), 0);
+    }
+}
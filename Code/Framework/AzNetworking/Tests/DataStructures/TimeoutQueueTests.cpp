@@ -8,7 +8,245 @@
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Mocks/MockITime.h>
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    class TimeoutQueueTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            m_timeSystem = AZStd::make_unique<AZ::NiceTimeSystemMock>();
+            ON_CALL(*m_timeSystem, GetElapsedTimeMs()).WillByDefault([this]() { return m_currentTimeMs; });
+        }
+
+        void TearDown() override
+        {
+            m_timeSystem.reset();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZStd::vector<uint64_t> UpdateTimeouts(TimeoutQueue& timeoutQueue, TimeoutResult result, int32_t maxTimeouts = -1)
+        {
+            AZStd::vector<uint64_t> timedOut;
+            timeoutQueue.UpdateTimeouts([&timedOut, result](TimeoutQueue::TimeoutItem& item)
+            {
+                timedOut.push_back(item.m_userData);
+                return result;
+            }, maxTimeouts);
+            return timedOut;
+        }
+
+        AZ::TimeMs m_currentTimeMs = AZ::TimeMs{ 1000 };
+        AZStd::unique_ptr<AZ::NiceTimeSystemMock> m_timeSystem;
+    };
+
+    TEST_F(TimeoutQueueTests, TestItemTimesOutAfterTimeout)
+    {
+        TimeoutQueue timeoutQueue;
+        const TimeoutId timeoutId = timeoutQueue.RegisterItem(7, AZ::TimeMs{ 100 });
+        EXPECT_NE(timeoutId, InvalidTimeoutId);
+        ASSERT_NE(timeoutQueue.RetrieveItem(timeoutId), nullptr);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(timeoutId)->m_userData, 7);
+
+        m_currentTimeMs += AZ::TimeMs{ 100 };
+        EXPECT_TRUE(UpdateTimeouts(timeoutQueue, TimeoutResult::Delete).empty());
+
+        m_currentTimeMs += AZ::TimeMs{ 1 };
+        const AZStd::vector<uint64_t> timedOut = UpdateTimeouts(timeoutQueue, TimeoutResult::Delete);
+        ASSERT_EQ(timedOut.size(), 1);
+        EXPECT_EQ(timedOut[0], 7);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(timeoutId), nullptr);
+    }
+
+    TEST_F(TimeoutQueueTests, TestRemovedItemIsRejected)
+    {
+        TimeoutQueue timeoutQueue;
+        const TimeoutId removedId = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+        timeoutQueue.RemoveItem(removedId);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(removedId), nullptr);
+
+        // The pooled item is reused under a new generation, the stale identifier must not reach it
+        const TimeoutId reusedId = timeoutQueue.RegisterItem(2, AZ::TimeMs{ 10 });
+        EXPECT_NE(reusedId, removedId);
+        timeoutQueue.RemoveItem(removedId);
+        ASSERT_NE(timeoutQueue.RetrieveItem(reusedId), nullptr);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(InvalidTimeoutId), nullptr);
+
+        m_currentTimeMs += AZ::TimeMs{ 20 };
+        const AZStd::vector<uint64_t> timedOut = UpdateTimeouts(timeoutQueue, TimeoutResult::Delete);
+        ASSERT_EQ(timedOut.size(), 1);
+        EXPECT_EQ(timedOut[0], 2);
+    }
+
+    TEST_F(TimeoutQueueTests, TestRefreshedItemsTimeOutLater)
+    {
+        TimeoutQueue timeoutQueue;
+        const TimeoutId refreshedId = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 50 });
+        const TimeoutId handlerRefreshedId = timeoutQueue.RegisterItem(2, AZ::TimeMs{ 50 });
+
+        m_currentTimeMs += AZ::TimeMs{ 40 };
+        timeoutQueue.RetrieveItem(refreshedId)->UpdateTimeoutTime(m_currentTimeMs);
+
+        m_currentTimeMs += AZ::TimeMs{ 20 };
+        AZStd::vector<uint64_t> timedOut = UpdateTimeouts(timeoutQueue, TimeoutResult::Refresh);
+        ASSERT_EQ(timedOut.size(), 1);
+        EXPECT_EQ(timedOut[0], 2);
+        EXPECT_NE(timeoutQueue.RetrieveItem(handlerRefreshedId), nullptr);
+
+        m_currentTimeMs += AZ::TimeMs{ 40 };
+        timedOut = UpdateTimeouts(timeoutQueue, TimeoutResult::Delete);
+        ASSERT_EQ(timedOut.size(), 1);
+        EXPECT_EQ(timedOut[0], 1);
+
+        m_currentTimeMs += AZ::TimeMs{ 20 };
+        timedOut = UpdateTimeouts(timeoutQueue, TimeoutResult::Delete);
+        ASSERT_EQ(timedOut.size(), 1);
+        EXPECT_EQ(timedOut[0], 2);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(refreshedId), nullptr);
+        EXPECT_EQ(timeoutQueue.RetrieveItem(handlerRefreshedId), nullptr);
+    }
+
+    TEST_F(TimeoutQueueTests, TestLongTimeoutsCascade)
+    {
+        TimeoutQueue timeoutQueue;
+        const AZ::TimeMs timeouts[] = { AZ::TimeMs{ 1 }, AZ::TimeMs{ 63 }, AZ::TimeMs{ 64 }, AZ::TimeMs{ 5000 }, AZ::TimeMs{ 300000 }, AZ::TimeMs{ 90000000 } };
+        for (uint64_t index = 0; index < AZ_ARRAY_SIZE(timeouts); ++index)
+        {
+            timeoutQueue.RegisterItem(index, timeouts[index]);
+        }
+
+        const AZ::TimeMs startTimeMs = m_currentTimeMs;
+        for (uint64_t index = 0; index < AZ_ARRAY_SIZE(timeouts); ++index)
+        {
+            m_currentTimeMs = startTimeMs + timeouts[index];
+            EXPECT_TRUE(UpdateTimeouts(timeoutQueue, TimeoutResult::Delete).empty());
+
+            m_currentTimeMs += AZ::TimeMs{ 1 };
+            const AZStd::vector<uint64_t> timedOut = UpdateTimeouts(timeoutQueue, TimeoutResult::Delete);
+            ASSERT_EQ(timedOut.size(), 1);
+            EXPECT_EQ(timedOut[0], index);
+        }
+    }
+
+    TEST_F(TimeoutQueueTests, TestMaxTimeoutsDefersRemainingItems)
+    {
+        TimeoutQueue timeoutQueue;
+        for (uint64_t index = 0; index < 10; ++index)
+        {
+            timeoutQueue.RegisterItem(index, AZ::TimeMs{ 10 });
+        }
+
+        m_currentTimeMs += AZ::TimeMs{ 20 };
+        EXPECT_EQ(UpdateTimeouts(timeoutQueue, TimeoutResult::Delete, 5).size(), 4);
+        EXPECT_EQ(UpdateTimeouts(timeoutQueue, TimeoutResult::Delete).size(), 6);
+        EXPECT_TRUE(UpdateTimeouts(timeoutQueue, TimeoutResult::Delete).empty());
+    }
+
+    TEST_F(TimeoutQueueTests, TestResetInvalidatesItems)
+    {
+        TimeoutQueue timeoutQueue;
+        const TimeoutId timeoutId = timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+        timeoutQueue.Reset();
+        EXPECT_EQ(timeoutQueue.RetrieveItem(timeoutId), nullptr);
+
+        m_currentTimeMs += AZ::TimeMs{ 20 };
+        EXPECT_TRUE(UpdateTimeouts(timeoutQueue, TimeoutResult::Delete).empty());
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    static constexpr int32_t NumConnections = 10000;
+
+    class TimeoutQueueBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_timeSystem = AZStd::make_unique<AZ::NiceTimeSystemMock>();
+            ON_CALL(*m_timeSystem, GetElapsedTimeMs()).WillByDefault([this]() { return m_currentTimeMs; });
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_timeSystem.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+        AZ::TimeMs m_currentTimeMs = AZ::TimeMs{ 0 };
+        AZStd::unique_ptr<AZ::NiceTimeSystemMock> m_timeSystem;
+    };
+
+    // Models a server frame at 60hz: every connection refreshes its heartbeat timeout, acks its previous reliable packet
+    // and sends a new one, then the queue times out whatever expired
+    BENCHMARK_F(TimeoutQueueBenchmark, BM_TimeoutQueue_ConnectionFrame)(benchmark::State& state)
+    {
+        TimeoutQueue timeoutQueue;
+        AZStd::vector<TimeoutId> heartbeatIds;
+        AZStd::vector<TimeoutId> packetIds;
+        for (int32_t connection = 0; connection < NumConnections; ++connection)
+        {
+            heartbeatIds.push_back(timeoutQueue.RegisterItem(connection, AZ::TimeMs{ 5000 }));
+            packetIds.push_back(timeoutQueue.RegisterItem(connection, AZ::TimeMs{ 100 + connection % 200 }));
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_currentTimeMs += AZ::TimeMs{ 16 };
+            for (int32_t connection = 0; connection < NumConnections; ++connection)
+            {
+                if (TimeoutQueue::TimeoutItem* item = timeoutQueue.RetrieveItem(heartbeatIds[connection]))
+                {
+                    item->UpdateTimeoutTime(m_currentTimeMs);
+                }
+                timeoutQueue.RemoveItem(packetIds[connection]);
+                packetIds[connection] = timeoutQueue.RegisterItem(connection, AZ::TimeMs{ 100 + connection % 200 });
+            }
+            timeoutQueue.UpdateTimeouts([](TimeoutQueue::TimeoutItem&) { return TimeoutResult::Refresh; });
+        }
+        state.SetItemsProcessed(state.iterations() * NumConnections);
+    }
+
+    // Every reliable packet is lost and resent from the timeout handler, so the whole queue expires and is refilled
+    BENCHMARK_F(TimeoutQueueBenchmark, BM_TimeoutQueue_ExpireAll)(benchmark::State& state)
+    {
+        TimeoutQueue timeoutQueue;
+        for (int32_t connection = 0; connection < NumConnections; ++connection)
+        {
+            timeoutQueue.RegisterItem(connection, AZ::TimeMs{ 100 });
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_currentTimeMs += AZ::TimeMs{ 101 };
+            timeoutQueue.UpdateTimeouts([&timeoutQueue](TimeoutQueue::TimeoutItem& item)
+            {
+                timeoutQueue.RegisterItem(item.m_userData, item.m_timeoutMs);
+                return TimeoutResult::Delete;
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * NumConnections);
+    }
 }
+#endif // HAVE_BENCHMARK
@@ -7,7 +7,16 @@
  */
 
 #include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
 #include <AzTest/AzTest.h>
 
+#if defined(HAVE_BENCHMARK)
+
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV, UnitTest::ScopedAllocatorBenchmarkEnvironment)
+
+#else
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
 
+#endif // HAVE_BENCHMARK
+
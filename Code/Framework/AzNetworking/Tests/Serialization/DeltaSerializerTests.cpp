@@ -171,6 +171,58 @@ namespace UnitTest
         }
     }
 
+    struct DeltaButtonsElement
+    {
+        bool m_jump = false;
+        bool m_crouch = false;
+        bool m_fire = false;
+        uint16_t m_weaponIndex = 0;
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return serializer.Serialize(m_jump, "Jump")
+                && serializer.Serialize(m_crouch, "Crouch")
+                && serializer.Serialize(m_fire, "Fire")
+                && serializer.Serialize(m_weaponIndex, "WeaponIndex", uint16_t(0), uint16_t(15));
+        }
+    };
+
+    TEST_F(DeltaSerializerTests, DeltaBoolsAndBoundedValues)
+    {
+        DeltaButtonsElement base;
+        base.m_crouch = true;
+        base.m_weaponIndex = 3;
+
+        DeltaButtonsElement current = base;
+        current.m_jump = true;
+        current.m_crouch = false;
+        current.m_weaponIndex = 12;
+
+        AzNetworking::SerializerDelta createDelta;
+        AzNetworking::DeltaSerializerCreate createSerializer(createDelta);
+        EXPECT_TRUE(createSerializer.CreateDelta(base, current));
+
+        // Booleans only take dirty bits, the bounded value fits in a single byte
+        EXPECT_EQ(createDelta.GetNumDirtyBits(), 6);
+        EXPECT_EQ(createDelta.GetBufferSize(), 1);
+
+        AZStd::array<uint8_t, 64> buffer;
+        AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(createDelta.Serialize(inSerializer));
+
+        AzNetworking::SerializerDelta applyDelta;
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+        EXPECT_TRUE(applyDelta.Serialize(outSerializer));
+
+        DeltaButtonsElement output = base;
+        AzNetworking::DeltaSerializerApply applySerializer(applyDelta);
+        EXPECT_TRUE(applySerializer.ApplyDelta(output));
+        EXPECT_EQ(output.m_jump, current.m_jump);
+        EXPECT_EQ(output.m_crouch, current.m_crouch);
+        EXPECT_EQ(output.m_fire, current.m_fire);
+        EXPECT_EQ(output.m_weaponIndex, current.m_weaponIndex);
+    }
+
     TEST_F(DeltaSerializerTests, DeltaSerializerCreateUnused)
     {
         // Every function here should return a constant value regardless of inputs
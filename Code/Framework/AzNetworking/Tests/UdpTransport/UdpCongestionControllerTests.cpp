@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpBbrCongestionController.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class UdpCongestionControllerTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        // Sends as much as the controller allows over a link with a fixed bandwidth and propagation delay
+        void SimulateLink(IUdpCongestionController& controller, int64_t durationMs, int64_t bytesPerMs, int64_t delayMs)
+        {
+            constexpr uint32_t PacketSize = MaxUdpTransmissionUnit;
+            for (int64_t timeMs = 0; timeMs < durationMs; ++timeMs)
+            {
+                while (!m_pendingAcks.empty() && (m_pendingAcks.front().m_ackTimeMs <= timeMs))
+                {
+                    controller.OnPacketAcked(m_pendingAcks.front().m_packetId, m_metrics, AZ::TimeMs{ m_timeOffsetMs + timeMs });
+                    m_pendingAcks.pop_front();
+                }
+
+                while (controller.GetAvailableSendBytes(AZ::TimeMs{ m_timeOffsetMs + timeMs }) >= PacketSize)
+                {
+                    m_linkFreeTimeMs = AZStd::max(m_linkFreeTimeMs, timeMs) + PacketSize / bytesPerMs;
+                    m_pendingAcks.push_back({ m_linkFreeTimeMs + delayMs, m_nextPacketId });
+                    controller.OnPacketSent(m_nextPacketId, PacketSize, AZ::TimeMs{ m_timeOffsetMs + timeMs });
+                    m_nextPacketId = PacketId{ static_cast<uint32_t>(m_nextPacketId) + 1 };
+                }
+            }
+        }
+
+        struct PendingAck
+        {
+            int64_t m_ackTimeMs;
+            PacketId m_packetId;
+        };
+
+        ConnectionMetrics m_metrics;
+        AZStd::deque<PendingAck> m_pendingAcks;
+        PacketId m_nextPacketId = PacketId{ 0 };
+        int64_t m_linkFreeTimeMs = 0;
+        int64_t m_timeOffsetMs = 1000;
+    };
+
+    TEST_F(UdpCongestionControllerTests, TestNullControllerIsUnlimited)
+    {
+        UdpNullCongestionController controller;
+        controller.OnPacketSent(PacketId{ 0 }, MaxUdpTransmissionUnit, AZ::TimeMs{ 0 });
+        EXPECT_EQ(controller.GetAvailableSendBytes(AZ::TimeMs{ 0 }), AZStd::numeric_limits<uint32_t>::max());
+        EXPECT_EQ(controller.GetPacingRateBytesPerSecond(), 0.0f);
+    }
+
+    TEST_F(UdpCongestionControllerTests, TestBbrInitialWindow)
+    {
+        UdpBbrCongestionController controller;
+        EXPECT_EQ(controller.GetMode(), UdpBbrCongestionController::Mode::Startup);
+        EXPECT_EQ(controller.GetAvailableSendBytes(AZ::TimeMs{ 0 }), controller.GetCongestionWindowBytes());
+
+        controller.OnPacketSent(PacketId{ 0 }, MaxUdpTransmissionUnit, AZ::TimeMs{ 0 });
+        EXPECT_EQ(controller.GetBytesInFlight(), MaxUdpTransmissionUnit);
+        controller.OnPacketLost(PacketId{ 0 }, AZ::TimeMs{ 100 });
+        EXPECT_EQ(controller.GetBytesInFlight(), 0);
+    }
+
+    TEST_F(UdpCongestionControllerTests, TestBbrConvergesToBottleneckBandwidth)
+    {
+        UdpBbrCongestionController controller;
+        SimulateLink(controller, 5000, 100, 50);
+
+        EXPECT_EQ(controller.GetMode(), UdpBbrCongestionController::Mode::ProbeBandwidth);
+        EXPECT_NEAR(controller.GetBandwidthEstimateBytesPerSecond(), 100000.0f, 10000.0f);
+        EXPECT_GE(static_cast<int64_t>(controller.GetMinRttMs()), 50);
+        EXPECT_LE(static_cast<int64_t>(controller.GetMinRttMs()), 70);
+
+        // The bytes in flight stay around the bandwidth delay product rather than filling the queue of the link
+        EXPECT_LE(controller.GetBytesInFlight(), controller.GetCongestionWindowBytes());
+        EXPECT_LE(m_linkFreeTimeMs - 5000, 60);
+    }
+}
@@ -9,10 +9,12 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
@@ -105,6 +107,10 @@ namespace UnitTest
             SetupAllocator();
             AZ::NameDictionary::Create();
 
+            m_console.reset(aznew AZ::Console());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
             m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
             m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
             m_networkingSystemComponent = AZStd::make_unique<AzNetworking::NetworkingSystemComponent>();
@@ -116,10 +122,14 @@ namespace UnitTest
             m_timeSystem.reset();
             m_loggerComponent.reset();
 
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+
             AZ::NameDictionary::Destroy();
             TeardownAllocator();
         }
 
+        AZStd::unique_ptr<AZ::Console> m_console;
         AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
         AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
         AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_networkingSystemComponent;
@@ -321,4 +331,98 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestBatchedSendAndReceive)
+    {
+        m_console->PerformCommand("net_UdpBatchSends true");
+
+        constexpr uint16_t ReceiverPort = 12346;
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        // Mix full size and smaller payloads so both segmented and unsegmented sends are exercised where supported
+        constexpr uint32_t NumPackets = 40;
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        DtlsEndpoint dtlsEndpoint;
+        AZStd::array<uint8_t, MaxUdpTransmissionUnit> payload;
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            const uint32_t payloadSize = (i % 8 == 7) ? 100 : 512;
+            payload.fill(aznumeric_cast<uint8_t>(i));
+            EXPECT_EQ(sender.Send(receiverAddress, payload.data(), payloadSize, false, dtlsEndpoint, ConnectionQuality()), aznumeric_cast<int32_t>(payloadSize));
+        }
+        EXPECT_EQ(sender.FlushSendQueue(), NumPackets);
+        EXPECT_EQ(sender.FlushSendQueue(), 0);
+
+        AZStd::vector<uint8_t> receiveBuffer(UdpSocket::MaxReceiveBatchCount * MaxUdpTransmissionUnit);
+        AZStd::array<IpAddress, UdpSocket::MaxReceiveBatchCount> addresses;
+        AZStd::array<int32_t, UdpSocket::MaxReceiveBatchCount> receivedBytes;
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedCount < NumPackets) && (AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 }))
+        {
+            const int32_t result = receiver.ReceiveBatch(receiveBuffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxReceiveBatchCount, addresses.data(), receivedBytes.data());
+            for (int32_t i = 0; i < result; ++i)
+            {
+                const uint32_t packetIndex = receivedCount++;
+                EXPECT_EQ(receivedBytes[i], (packetIndex % 8 == 7) ? 100 : 512);
+                EXPECT_EQ(receiveBuffer[i * MaxUdpTransmissionUnit], aznumeric_cast<uint8_t>(packetIndex));
+            }
+            if (result <= 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+            }
+        }
+        EXPECT_EQ(receivedCount, NumPackets);
+        EXPECT_EQ(receiver.GetRecvPackets(), NumPackets);
+
+        m_console->PerformCommand("net_UdpBatchSends false");
+    }
+
+    TEST_F(UdpTransportTests, TestShardedListen)
+    {
+        constexpr uint32_t NumTestClients = 20;
+        [[maybe_unused]] constexpr uint32_t NumShards = 4;
+
+        m_console->PerformCommand("net_UdpListenShardCount 4");
+        TestUdpServer testServer;
+        TestUdpClient testClient[NumTestClients];
+        m_console->PerformCommand("net_UdpListenShardCount 1");
+
+        UdpNetworkInterface* serverInterface = static_cast<UdpNetworkInterface*>(testServer.m_serverNetworkInterface);
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        EXPECT_EQ(serverInterface->GetShardCount(), NumShards);
+#else
+        EXPECT_EQ(serverInterface->GetShardCount(), 1);
+#endif
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+            }
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+        for (uint32_t i = 0; i < NumTestClients; ++i)
+        {
+            EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+        }
+
+        EXPECT_TRUE(serverInterface->StopListening());
+        EXPECT_FALSE(serverInterface->IsOpen());
+    }
 }
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedTransform.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    template <typename TYPE, typename VALUE_TYPE>
+    VALUE_TYPE RoundTrip(const VALUE_TYPE& value, uint32_t& outSize)
+    {
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer  inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        TYPE testIn(value);
+        TYPE testOut;
+        EXPECT_TRUE(testIn.Serialize(inputSerializer));
+        outSize = inputSerializer.GetSize();
+        EXPECT_TRUE(testOut.Serialize(outputSerializer));
+        EXPECT_EQ(inputSerializer.GetSize(), outputSerializer.GetSize());
+        return static_cast<VALUE_TYPE>(testOut);
+    }
+
+    TEST(QuantizedTransform, QuaternionRoundTrip)
+    {
+        const AZ::Quaternion rotations[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationX(1.0f),
+            AZ::Quaternion::CreateRotationY(-2.5f),
+            AZ::Quaternion::CreateRotationZ(3.0f) * AZ::Quaternion::CreateRotationX(0.5f),
+            AZ::Quaternion(-0.5f, 0.5f, -0.5f, -0.5f),
+        };
+
+        for (const AZ::Quaternion& rotation : rotations)
+        {
+            uint32_t size = 0;
+            const AZ::Quaternion result = RoundTrip<AzNetworking::QuantizedQuaternion>(rotation, size);
+            EXPECT_EQ(size, sizeof(uint32_t));
+            // q and -q are the same rotation
+            EXPECT_NEAR(fabsf(result.Dot(rotation)), 1.0f, 0.0001f);
+        }
+    }
+
+    TEST(QuantizedTransform, TranslationRoundTrip)
+    {
+        using QuantizedTranslation = AzNetworking::QuantizedTranslation<1024>;
+
+        uint32_t size = 0;
+        AZ::Vector3 result = RoundTrip<QuantizedTranslation>(AZ::Vector3(0.1f, -0.05f, 0.0f), size);
+        EXPECT_EQ(size, 4);
+        EXPECT_TRUE(result.IsClose(AZ::Vector3(0.1f, -0.05f, 0.0f), 1.0f / 1024.0f));
+
+        result = RoundTrip<QuantizedTranslation>(AZ::Vector3(-1500.0f, 12.25f, 3000.5f), size);
+        EXPECT_EQ(size, 9);
+        EXPECT_TRUE(result.IsClose(AZ::Vector3(-1500.0f, 12.25f, 3000.5f), 1.0f / 1024.0f));
+    }
+
+    TEST(QuantizedTransform, TranslationOutOfRangeIsFullPrecision)
+    {
+        using QuantizedTranslation = AzNetworking::QuantizedTranslation<1024>;
+
+        const AZ::Vector3 translation(QuantizedTranslation::MaxQuantizedValue * 2.0f, 1.0f, -1.0f);
+        uint32_t size = 0;
+        const AZ::Vector3 result = RoundTrip<QuantizedTranslation>(translation, size);
+        EXPECT_EQ(size, 1 + 3 * sizeof(float));
+        EXPECT_EQ(result, translation);
+    }
+}
@@ -13,6 +13,7 @@ set(FILES
     DataStructures/FixedSizeBitsetTests.cpp
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
+    DataStructures/PacketBufferPoolTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
@@ -21,9 +22,11 @@ set(FILES
     Serialization/NetworkOutputSerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpCongestionControllerTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/QuantizedTransformTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
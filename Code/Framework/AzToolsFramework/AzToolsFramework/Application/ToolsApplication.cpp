@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Console/IConsole.h>
 
 #include <AzFramework/TargetManagement/TargetManagementComponent.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -91,6 +92,14 @@ AZ_POP_DISABLE_WARNING
 // For now we'll stick with the CRT new/delete in tools.
 //#include <AzCore/Memory/NewAndDelete.inl>
 
+AZ_CVAR(
+    uint32_t,
+    ed_undoHistoryMemoryBudgetMB,
+    512,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Memory in megabytes the undo history may use before its oldest steps are dropped, 0 for no limit");
+
 namespace AzToolsFramework
 {
     namespace Internal
@@ -1590,6 +1599,7 @@ namespace AzToolsFramework
             // record each undo batch
             if (m_undoStack && changed)
             {
+                m_undoStack->SetMemoryBudget(static_cast<size_t>(static_cast<uint32_t>(ed_undoHistoryMemoryBudgetMB)) * 1024 * 1024);
                 m_undoStack->Post(m_currentBatchUndo);
             }
             else
@@ -11,6 +11,8 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/StringFunc/StringFunc.h>
 
 #include <AzFramework/Archive/INestedArchive.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
@@ -24,7 +26,10 @@ namespace AzToolsFramework
     [[maybe_unused]] constexpr const char s_traceName[] = "ArchiveComponent";
     constexpr AZ::u32 s_compressionMethod = AZ::IO::INestedArchive::METHOD_DEFLATE;
     constexpr AZ::s32 s_compressionLevel = AZ::IO::INestedArchive::LEVEL_NORMAL;
-    constexpr CompressionCodec::Codec s_compressionCodec = CompressionCodec::Codec::ZLIB;
+    constexpr CompressionCodec::Codec s_defaultCompressionCodec = CompressionCodec::Codec::ZLIB;
+    // Codec used to compress the files added to archives, one of "zlib", "zstd" or "lz4".
+    // Large files compressed with zstd are split in frames, so reads of part of them only decompress the frames they need.
+    constexpr AZStd::string_view s_compressionCodecKey = "/O3DE/AzToolsFramework/Archive/CompressionCodec";
 
     namespace ArchiveUtils
     {
@@ -73,6 +78,28 @@ namespace AzToolsFramework
             }
         }
 
+        CompressionCodec::Codec GetCompressionCodec()
+        {
+            AZ::SettingsRegistryInterface::FixedValueString codecName;
+            auto settingsRegistry = AZ::SettingsRegistry::Get();
+            if (!settingsRegistry || !settingsRegistry->Get(codecName, s_compressionCodecKey))
+            {
+                return s_defaultCompressionCodec;
+            }
+
+            if (AZ::StringFunc::Equal(codecName, "zstd"))
+            {
+                return CompressionCodec::Codec::ZSTD;
+            }
+            if (AZ::StringFunc::Equal(codecName, "lz4"))
+            {
+                return CompressionCodec::Codec::LZ4;
+            }
+            AZ_Warning(s_traceName, AZ::StringFunc::Equal(codecName, "zlib"), "Unknown archive compression codec '%s', using zlib instead",
+                codecName.c_str());
+            return s_defaultCompressionCodec;
+        }
+
     } // namespace ArchiveUtils
 
     void ArchiveComponent::Activate()
@@ -171,7 +198,7 @@ namespace AzToolsFramework
                 {
                     int result = archive->UpdateFile(
                         relativePath.Native(), fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
+                        s_compressionLevel, ArchiveUtils::GetCompressionCodec());
 
                     thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                     AZ_Error(
@@ -428,7 +455,7 @@ namespace AzToolsFramework
             {
                 int result = archive->UpdateFile(
                     relativePath.Native(), fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                    s_compressionLevel, s_compressionCodec);
+                    s_compressionLevel, ArchiveUtils::GetCompressionCodec());
 
                 success = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                 AZ_Error(
@@ -490,7 +517,7 @@ namespace AzToolsFramework
                 {
                     int result = archive->UpdateFile(
                         filePathLine, fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
+                        s_compressionLevel, ArchiveUtils::GetCompressionCodec());
 
                     bool thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                     success = (success && thisSuccess);
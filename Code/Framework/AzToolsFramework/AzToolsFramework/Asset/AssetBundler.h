@@ -59,6 +59,7 @@ namespace AzToolsFramework
         int m_bundleVersion = AzFramework::AssetBundleManifest::CurrentBundleVersion;
         AZ::u64 m_maxBundleSizeInMB = MaxBundleSizeInMB;
         AZStd::string m_comment;
+        AZStd::string m_accessTracePath; // optional streamer access trace, the bundle stores the traced files in load order.
     };
 
    /*
@@ -10,10 +10,13 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/AccessTrace.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -44,6 +47,75 @@ namespace AzToolsFramework
         return ((totalFileSize + bundleSize + assetCatalogFileSizeBuffer + ManifestFileSizeBufferInBytes) > maxSizeInBytes);
     }
 
+    AZStd::string NormalizeTracedPath(AZStd::string_view path, AZStd::string_view assetRoot)
+    {
+        AZStd::string normalizedPath(path);
+        AZStd::replace(normalizedPath.begin(), normalizedPath.end(), AZ_WRONG_DATABASE_SEPARATOR, AZ_CORRECT_DATABASE_SEPARATOR);
+        AZStd::to_lower(normalizedPath.begin(), normalizedPath.end());
+        // The streamer traces paths through aliases such as @products@, or absolute paths into the asset cache
+        if (normalizedPath.starts_with('@'))
+        {
+            const size_t aliasEnd = normalizedPath.find('@', 1);
+            normalizedPath.erase(0, aliasEnd == AZStd::string::npos ? 0 : aliasEnd + 1);
+        }
+        else if (!assetRoot.empty() && normalizedPath.starts_with(assetRoot))
+        {
+            normalizedPath.erase(0, assetRoot.size());
+        }
+        while (normalizedPath.starts_with(AZ_CORRECT_DATABASE_SEPARATOR))
+        {
+            normalizedPath.erase(0, 1);
+        }
+        return normalizedPath;
+    }
+
+    //! Moves the files read in a recorded streamer access trace to the front of the list in the order they were first read,
+    //! so the archive stores them in load order and reading them at runtime seeks forward instead of back and forth.
+    //! The files missing from the trace keep their relative order after the traced ones.
+    bool OrderFilesByAccessTrace(const AZStd::string& accessTracePath, const AZStd::string& assetRoot, AZStd::vector<AssetFileInfo>& fileInfoList)
+    {
+        AZ::IO::Path tracePath(accessTracePath);
+        if (tracePath.IsRelative())
+        {
+            tracePath = AZ::IO::Path(AZStd::string_view{ AZ::Utils::GetEnginePath() }) / tracePath;
+        }
+
+        AZStd::vector<AZ::IO::AccessTrace::Entry> traceEntries;
+        if (!AZ::IO::AccessTrace::Load(tracePath.c_str(), traceEntries))
+        {
+            AZ_Error(logWindowName, false, "Unable to load the access trace file (%s).\n", tracePath.c_str());
+            return false;
+        }
+
+        const AZStd::string normalizedAssetRoot = NormalizeTracedPath(assetRoot, {});
+        AZStd::unordered_map<AZStd::string, size_t> accessOrder;
+        for (const AZ::IO::AccessTrace::Entry& traceEntry : traceEntries)
+        {
+            accessOrder.emplace(NormalizeTracedPath(traceEntry.m_path, normalizedAssetRoot), accessOrder.size());
+        }
+
+        const size_t untraced = accessOrder.size();
+        AZStd::vector<AZStd::pair<size_t, AssetFileInfo>> orderedFiles;
+        orderedFiles.reserve(fileInfoList.size());
+        size_t tracedCount = 0;
+        for (AssetFileInfo& assetFileInfo : fileInfoList)
+        {
+            auto accessIt = accessOrder.find(NormalizeTracedPath(assetFileInfo.m_assetRelativePath, {}));
+            tracedCount += accessIt != accessOrder.end() ? 1 : 0;
+            orderedFiles.emplace_back(accessIt != accessOrder.end() ? accessIt->second : untraced, AZStd::move(assetFileInfo));
+        }
+        AZStd::stable_sort(orderedFiles.begin(), orderedFiles.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        for (size_t i = 0; i < orderedFiles.size(); ++i)
+        {
+            fileInfoList[i] = AZStd::move(orderedFiles[i].second);
+        }
+
+        AZ_TracePrintf(logWindowName, "Ordered %zu of %zu files by the access trace (%s).\n", tracedCount, fileInfoList.size(), tracePath.c_str());
+        return true;
+    }
+
     bool MakePath(const AZStd::string& directory)
     {
         if (!AZ::IO::FileIOBase::GetInstance()->Exists(directory.c_str()))
@@ -297,7 +369,20 @@ namespace AzToolsFramework
         AzFramework::ApplicationRequests::Bus::BroadcastResult(
             usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
 
-        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        // Archive entries are written in list order, a recorded access trace lets them follow the load order instead
+        AZStd::vector<AssetFileInfo> orderedFileInfoList;
+        if (!assetBundleSettings.m_accessTracePath.empty())
+        {
+            orderedFileInfoList = assetFileInfoList.m_fileInfoList;
+            if (!OrderFilesByAccessTrace(assetBundleSettings.m_accessTracePath, assetAlias, orderedFileInfoList))
+            {
+                return false;
+            }
+        }
+        const AZStd::vector<AssetFileInfo>& fileInfoList =
+            assetBundleSettings.m_accessTracePath.empty() ? assetFileInfoList.m_fileInfoList : orderedFileInfoList;
+
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : fileInfoList)
         {
             AZ::u64 fileSize = 0;
             AZStd::string fullAssetFilePath;
@@ -52,6 +52,11 @@ namespace AzToolsFramework
     {
     }
 
+    size_t EntityStateCommand::GetMemoryUsage() const
+    {
+        return UndoSystem::URSequencePoint::GetMemoryUsage() + m_undoState.capacity() + m_redoState.capacity();
+    }
+
     void EntityStateCommand::Capture(AZ::Entity* pSourceEntity, bool captureUndo)
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
@@ -62,6 +62,7 @@ namespace AzToolsFramework
         AZ::EntityId GetEntityID() const { return m_entityID; }
 
         bool Changed() const override { return m_undoState != m_redoState; }
+        size_t GetMemoryUsage() const override;
 
     protected:
 
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityScrubber.h>
@@ -172,6 +173,16 @@ namespace AzToolsFramework
                 }
             }
 
+            // The entities whose DOM didn't change are taken out of the instance before it gets cleared, and put back once
+            // the changed entities are loaded, so that they are never destroyed and recreated.
+            Instance::AliasToEntityMap unchangedEntities;
+            AZStd::unique_ptr<AZ::Entity> unchangedContainerEntity;
+            AZStd::vector<AZStd::pair<AZ::EntityId, EntityAlias>> unchangedEntityAliases;
+            PrefabDom changedEntitiesDom;
+            const bool reuseUnchangedEntities = context.GetMetadata().Find<PrefabDomUtils::ReuseUnchangedEntitiesMetadata>() &&
+                TakeUnchangedEntities(instance, inputValue, unchangedEntities, unchangedContainerEntity, unchangedEntityAliases,
+                    changedEntitiesDom);
+
             // An already filled instance should be cleared if inputValue's Entities member is empty
             // The Json serializer will not do this by default as it will not attempt to load a missing member
             instance->ClearEntities();
@@ -186,6 +197,7 @@ namespace AzToolsFramework
                 (*idMapper)->SetLoadingInstance(*instance);
             }
 
+            if (!unchangedContainerEntity)
             {
                 JSR::ResultCode containerEntityResult = ContinueLoadingFromJsonObjectField(
                     &instance->m_containerEntity, azrtti_typeid<decltype(instance->m_containerEntity)>(), inputValue, "ContainerEntity", context);
@@ -194,12 +206,32 @@ namespace AzToolsFramework
             }
 
             {
-                JSR::ResultCode entitiesResult = ContinueLoadingFromJsonObjectField(
-                    &instance->m_entities, azrtti_typeid<Instance::AliasToEntityMap>(), inputValue, "Entities", context);
+                JSR::ResultCode entitiesResult = reuseUnchangedEntities
+                    ? ContinueLoading(&instance->m_entities, azrtti_typeid<Instance::AliasToEntityMap>(), changedEntitiesDom, context)
+                    : ContinueLoadingFromJsonObjectField(
+                        &instance->m_entities, azrtti_typeid<Instance::AliasToEntityMap>(), inputValue, "Entities", context);
                 AddEntitiesToScrub(instance, context);
                 result.Combine(entitiesResult);
             }
 
+            if (reuseUnchangedEntities)
+            {
+                if (unchangedContainerEntity)
+                {
+                    instance->m_containerEntity = AZStd::move(unchangedContainerEntity);
+                }
+                for (auto& [entityAlias, entity] : unchangedEntities)
+                {
+                    instance->m_entities.emplace(entityAlias, AZStd::move(entity));
+                }
+                // The unchanged entities stayed registered to the instance, only their aliases were cleared
+                for (const auto& [entityId, entityAlias] : unchangedEntityAliases)
+                {
+                    instance->m_instanceToTemplateEntityIdMap.emplace(entityId, entityAlias);
+                    instance->m_templateToInstanceEntityIdMap.emplace(entityAlias, entityId);
+                }
+            }
+
             {
                 result.Combine(ContinueLoadingFromJsonObjectField(&instance->m_linkId, azrtti_typeid<LinkId>(), inputValue, "LinkId", context));
             }
@@ -209,6 +241,68 @@ namespace AzToolsFramework
                 "Failed to load instance information for prefab");
         }
 
+        bool JsonInstanceSerializer::TakeUnchangedEntities(Instance* instance, const rapidjson::Value& inputValue,
+            Instance::AliasToEntityMap& unchangedEntities, AZStd::unique_ptr<AZ::Entity>& unchangedContainerEntity,
+            AZStd::vector<AZStd::pair<AZ::EntityId, EntityAlias>>& unchangedEntityAliases, PrefabDom& changedEntitiesDom)
+        {
+            if (instance->m_entities.empty() && !instance->m_containerEntity)
+            {
+                return false;
+            }
+
+            // Compares an entity of the instance with its DOM, stored the same way the templates store their entities
+            auto isEntityUnchanged = [instance](const AZ::Entity& entity, const rapidjson::Value& entityValue)
+            {
+                PrefabDom entityDom;
+                return PrefabDomUtils::StoreEntityInPrefabDomFormat(entity, *instance, entityDom) &&
+                    AZ::JsonSerialization::Compare(entityDom, entityValue) == AZ::JsonSerializerCompareResult::Equal;
+            };
+
+            auto getEntityAlias = [instance](const AZ::EntityId& entityId)
+            {
+                auto aliasIter = instance->m_instanceToTemplateEntityIdMap.find(entityId);
+                return aliasIter != instance->m_instanceToTemplateEntityIdMap.end() ? aliasIter->second : EntityAlias();
+            };
+
+            auto containerEntityIter = inputValue.FindMember("ContainerEntity");
+            if (instance->m_containerEntity && containerEntityIter != inputValue.MemberEnd() &&
+                isEntityUnchanged(*instance->m_containerEntity, containerEntityIter->value))
+            {
+                const AZ::EntityId containerEntityId = instance->m_containerEntity->GetId();
+                unchangedEntityAliases.emplace_back(containerEntityId, getEntityAlias(containerEntityId));
+                unchangedContainerEntity = AZStd::move(instance->m_containerEntity);
+            }
+
+            changedEntitiesDom.SetObject();
+            auto entitiesIter = inputValue.FindMember("Entities");
+            if (entitiesIter == inputValue.MemberEnd() || !entitiesIter->value.IsObject())
+            {
+                return unchangedContainerEntity != nullptr;
+            }
+
+            for (auto& entityMember : entitiesIter->value.GetObject())
+            {
+                const EntityAlias entityAlias(entityMember.name.GetString(), entityMember.name.GetStringLength());
+                auto entityIter = instance->m_entities.find(entityAlias);
+                if (entityIter != instance->m_entities.end() && entityIter->second &&
+                    isEntityUnchanged(*entityIter->second, entityMember.value))
+                {
+                    unchangedEntityAliases.emplace_back(entityIter->second->GetId(), entityAlias);
+                    unchangedEntities.emplace(entityAlias, AZStd::move(entityIter->second));
+                    // Taken out before ClearEntities, so the entity stays registered to the instance
+                    instance->m_entities.erase(entityIter);
+                }
+                else
+                {
+                    changedEntitiesDom.AddMember(
+                        rapidjson::Value(entityMember.name, changedEntitiesDom.GetAllocator()),
+                        rapidjson::Value(entityMember.value, changedEntitiesDom.GetAllocator()), changedEntitiesDom.GetAllocator());
+                }
+            }
+
+            return true;
+        }
+
         void JsonInstanceSerializer::AddEntitiesToScrub(const Instance* instance, AZ::JsonDeserializerContext& jsonDeserializerContext)
         {
             EntityList entitiesInInstance;
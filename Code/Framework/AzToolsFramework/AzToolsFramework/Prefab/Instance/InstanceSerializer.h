@@ -10,13 +10,13 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzToolsFramework/Prefab/Instance/Instance.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 
 namespace AzToolsFramework
 {
     namespace Prefab
     {
-        class Instance;
-
         class JsonInstanceSerializer
             : public AZ::BaseJsonSerializer
         {
@@ -32,6 +32,12 @@ namespace AzToolsFramework
                 AZ::JsonDeserializerContext& context) override;
 
         private:
+            //! Moves the entities of an already loaded instance whose DOM is the same in inputValue to unchangedEntities, and
+            //! copies the DOM of the other entities to changedEntitiesDom. Returns false when there is nothing to reuse.
+            static bool TakeUnchangedEntities(Instance* instance, const rapidjson::Value& inputValue,
+                Instance::AliasToEntityMap& unchangedEntities, AZStd::unique_ptr<AZ::Entity>& unchangedContainerEntity,
+                AZStd::vector<AZStd::pair<AZ::EntityId, EntityAlias>>& unchangedEntityAliases, PrefabDom& changedEntitiesDom);
+
             //! Adds the entities of an instance to a InstanceEntityScrubber object in the metadata of JsonDeserializerContext
             //! so that they can be scrubbed later.
             void AddEntitiesToScrub(const Instance* instance, AZ::JsonDeserializerContext& jsonDeserializercontext);
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
@@ -111,6 +112,34 @@ namespace AzToolsFramework
                     ToolsApplicationRequestBus::BroadcastResult(selectedEntityIds, &ToolsApplicationRequests::GetSelectedEntities);
                     PrefabDom instanceDomFromRootDocument;
 
+                    // The reloaded entities are added to the editor entity context in batches rather than per instance.
+                    // Reloading an instance recreates the entities of its nested instances, so the batch is added before
+                    // an instance that owns a pending instance gets reloaded, and only the entities still alive are added.
+                    EntityList pendingEntities;
+                    EntityIdList pendingEntityIds;
+                    AZStd::unordered_set<const Instance*> pendingInstancesAndAncestors;
+                    auto addPendingEntities = [&pendingEntities, &pendingEntityIds, &pendingInstancesAndAncestors]()
+                    {
+                        EntityList entitiesToAdd;
+                        entitiesToAdd.reserve(pendingEntities.size());
+                        for (size_t entityIndex = 0; entityIndex < pendingEntities.size(); ++entityIndex)
+                        {
+                            if (GetEntityById(pendingEntityIds[entityIndex]) == pendingEntities[entityIndex])
+                            {
+                                entitiesToAdd.push_back(pendingEntities[entityIndex]);
+                            }
+                        }
+
+                        if (!entitiesToAdd.empty())
+                        {
+                            AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
+                                &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, entitiesToAdd);
+                        }
+                        pendingEntities.clear();
+                        pendingEntityIds.clear();
+                        pendingInstancesAndAncestors.clear();
+                    };
+
                     // Process all instances in the queue, capped to the batch size.
                     // Even though we potentially initialized the batch size to the queue, it's possible for the queue size to shrink
                     // during instance processing if the instance gets deleted and it was queued multiple times.  To handle this, we
@@ -202,10 +231,16 @@ namespace AzToolsFramework
                             continue;
                         }
 
+                        if (pendingInstancesAndAncestors.find(instanceToUpdate) != pendingInstancesAndAncestors.end())
+                        {
+                            addPendingEntities();
+                        }
+
                         // If a link was created for a nested instance before the changes were propagated,
                         // then we associate it correctly here
                         instanceDomFromRootDocument.CopyFrom(instanceDomFromRoot->get(), instanceDomFromRootDocument.GetAllocator());
-                        if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDomFromRootDocument))
+                        if (PrefabDomUtils::LoadInstanceFromPrefabDom(
+                                *instanceToUpdate, newEntities, instanceDomFromRootDocument, PrefabDomUtils::LoadFlags::ReuseUnchangedEntities))
                         {
                             Template& currentTemplate = currentTemplateReference->get();
                             instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance) 
@@ -231,10 +266,20 @@ namespace AzToolsFramework
                                 }
                             });
 
-                            AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
-                                &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, newEntities);
+                            for (AZ::Entity* entity : newEntities)
+                            {
+                                pendingEntities.push_back(entity);
+                                pendingEntityIds.push_back(entity->GetId());
+                            }
+                            for (InstanceOptionalConstReference instanceInPath : pathOfInstances)
+                            {
+                                pendingInstancesAndAncestors.insert(&instanceInPath->get());
+                            }
+                            pendingInstancesAndAncestors.insert(&rootInstance->get());
                         }
                     }
+                    addPendingEntities();
+
                     for (auto entityIdIterator = selectedEntityIds.begin(); entityIdIterator != selectedEntityIds.end(); entityIdIterator++)
                     {
                         // Since entities get recreated during propagation, we need to check whether the entities
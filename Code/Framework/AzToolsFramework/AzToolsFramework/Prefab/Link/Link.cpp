@@ -164,8 +164,9 @@ namespace AzToolsFramework
             PrefabDom& sourceTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_sourceTemplateId);
 
             // Copy the source template dom so that the actual template DOM does not change and only the linked instance DOM does.
+            // The copy uses its own allocator, so the links of a source template can be updated concurrently.
             PrefabDom sourceTemplateDomCopy;
-            sourceTemplateDomCopy.CopyFrom(sourceTemplatePrefabDom, sourceTemplatePrefabDom.GetAllocator());
+            sourceTemplateDomCopy.CopyFrom(sourceTemplatePrefabDom, sourceTemplateDomCopy.GetAllocator());
 
             PrefabDomValueReference patchesReference = PrefabDomUtils::FindPrefabDomValue(m_linkDom, PrefabDomUtils::PatchesName);
             if (!patchesReference.has_value())
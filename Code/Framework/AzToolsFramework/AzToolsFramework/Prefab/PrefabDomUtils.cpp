@@ -155,6 +155,10 @@ namespace AzToolsFramework
                     settings.m_metadata.Add(static_cast<AZ::JsonEntityIdSerializer::JsonEntityIdMapper*>(&entityIdMapper));
                     settings.m_metadata.Add(&entityIdMapper);
                     settings.m_metadata.Add(tracker);
+                    if ((flags & LoadFlags::ReuseUnchangedEntities) == LoadFlags::ReuseUnchangedEntities)
+                    {
+                        settings.m_metadata.Create<ReuseUnchangedEntitiesMetadata>();
+                    }
 
                     AZ::JsonSerializationResult::ResultCode result = AZ::JsonSerialization::Load(instance, prefabDom, settings);
 
@@ -97,7 +97,10 @@ namespace AzToolsFramework
                 None = 0,
                 //! By default entities will get a stable id when they're deserialized. In cases where the new entities need to be kept
                 //! unique, e.g. when they are duplicates of live entities, this flag will assign them a random new id.
-                AssignRandomEntityId = 1 << 0
+                AssignRandomEntityId = 1 << 0,
+                //! When loading into an instance that already has entities, the entities whose DOM didn't change are kept as they are
+                //! instead of being destroyed and recreated. Only the changed and new entities are reported as newly added.
+                ReuseUnchangedEntities = 1 << 1
             };
             AZ_DEFINE_ENUM_BITWISE_OPERATORS(LoadFlags);
 
@@ -179,6 +182,15 @@ namespace AzToolsFramework
 
                 virtual ~LinkIdMetadata() {}
             };
+
+            //! An empty struct for passing to JsonDeserializerSettings.m_metadata that is consumed by InstanceSerializer::Load.
+            //! If present in metadata, the entities of the loaded instance whose DOM didn't change are kept, see LoadFlags.
+            struct ReuseUnchangedEntitiesMetadata
+            {
+                AZ_RTTI(ReuseUnchangedEntitiesMetadata, "{3C5D8E21-7A4B-4F0E-9B6D-1E2F3A4B5C6D}");
+
+                virtual ~ReuseUnchangedEntitiesMetadata() {}
+            };
         } // namespace PrefabDomUtils
     } // namespace Prefab
 } // namespace AzToolsFramework
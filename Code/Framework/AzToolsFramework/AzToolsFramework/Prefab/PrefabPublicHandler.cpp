@@ -728,6 +728,10 @@ namespace AzToolsFramework
             m_instanceToTemplateInterface->GeneratePatch(patch, beforeState, afterState);
             m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(patch, entityId);
 
+            // the after state is cached as the new state of the entity, unless the change was applied through another
+            // instance or the entity moved to another instance, which may change the entity again
+            bool isAfterStateCurrent = true;
+
             if (patch.IsArray() && !patch.Empty() && beforeState.IsObject())
             {
                 bool isInstanceContainerEntity = IsInstanceContainerEntity(entityId) && !IsLevelInstanceContainerEntity(entityId);
@@ -791,6 +795,7 @@ namespace AzToolsFramework
 
                 if (isInFocusTree && !isOwnedByFocusedPrefabInstance)
                 {
+                    isAfterStateCurrent = false;
                     if (isNewParentOwnedByDifferentInstance)
                     {
                         Internal_HandleInstanceChange(parentUndoBatch, entity, beforeParentId, afterParentId);
@@ -820,12 +825,21 @@ namespace AzToolsFramework
 
                     if (isNewParentOwnedByDifferentInstance)
                     {
+                        isAfterStateCurrent = false;
                         Internal_HandleInstanceChange(parentUndoBatch, entity, beforeParentId, afterParentId);
                     }
                 }
             }
 
-            m_prefabUndoCache.UpdateCache(entityId);
+            if (isAfterStateCurrent)
+            {
+                // avoids serializing the entity a second time
+                m_prefabUndoCache.Store(entityId, AZStd::move(afterState), afterParentId);
+            }
+            else
+            {
+                m_prefabUndoCache.UpdateCache(entityId);
+            }
 
             return AZ::Success();
         }
@@ -846,6 +860,23 @@ namespace AzToolsFramework
             UndoSystem::URSequencePoint* undoBatch, AZ::EntityId entityId, PrefabDom& beforeState,
             PrefabDom& afterState, InstanceOptionalReference instance)
         {
+            // Consecutive changes of the entity in the same batch, like the ones of a batch resumed for every step of a slider
+            // drag, are appended to its update. The updates of other entities in between touch other entities only.
+            const UndoSystem::URSequencePoint::ChildVec& batchChildren = undoBatch->GetChildren();
+            for (auto childIt = batchChildren.rbegin(); childIt != batchChildren.rend(); ++childIt)
+            {
+                PrefabUndoEntityUpdate* previousState = azrtti_cast<PrefabUndoEntityUpdate*>(*childIt);
+                if (!previousState)
+                {
+                    break;
+                }
+
+                if (previousState->AppendAndRedo(beforeState, afterState, entityId, instance->get()))
+                {
+                    return;
+                }
+            }
+
             // Update the state of the entity
             PrefabUndoEntityUpdate* state = aznew PrefabUndoEntityUpdate(AZStd::to_string(static_cast<AZ::u64>(entityId)));
             state->SetParent(undoBatch);
@@ -9,7 +9,11 @@
 #include <AzToolsFramework/Prefab/PrefabSystemComponent.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
@@ -25,6 +29,9 @@ namespace AzToolsFramework
 {
     namespace Prefab
     {
+        AZ_CVAR(bool, ed_prefabParallelPropagation, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Updates the linked instances of the different templates that nest a changed template concurrently.");
+
         void PrefabSystemComponent::Init()
         {
         }
@@ -209,11 +216,68 @@ namespace AzToolsFramework
                 TargetTemplateIdToLinkIdMap targetTemplateIdToLinkIdMap;
                 BucketLinkIdsByTargetTemplateId(LinkIdsToUpdate, targetTemplateIdToLinkIdMap);
 
-                // Update all the linked instances corresponding to the LinkIds before fetching the next set of linkIds.
+                // All the links of a list share the same source template, and the links of a target template only patch the DOM of
+                // that template, so the target templates are updated concurrently. The links of a target template stay sequential.
+                AZStd::vector<AZStd::pair<TemplateId, LinkIds>> linkIdsByTargetTemplate;
+                for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
+                {
+                    const TemplateId targetTemplateId = m_linkIdMap[linkIdToUpdate].GetTargetTemplateId();
+                    auto bucketIter = AZStd::find_if(linkIdsByTargetTemplate.begin(), linkIdsByTargetTemplate.end(),
+                        [targetTemplateId](const AZStd::pair<TemplateId, LinkIds>& bucket)
+                        {
+                            return bucket.first == targetTemplateId;
+                        });
+                    if (bucketIter == linkIdsByTargetTemplate.end())
+                    {
+                        linkIdsByTargetTemplate.emplace_back(targetTemplateId, LinkIds());
+                        bucketIter = linkIdsByTargetTemplate.end() - 1;
+                    }
+                    bucketIter->second.push_back(linkIdToUpdate);
+                }
+
+                auto updateTargetTemplate = [this, &targetTemplateIdToLinkIdMap](const AZStd::pair<TemplateId, LinkIds>& bucket)
+                {
+                    bool& isTemplateUpdated = targetTemplateIdToLinkIdMap.find(bucket.first)->second.second;
+                    for (const LinkId& linkIdToUpdate : bucket.second)
+                    {
+                        // If any of the templates links are already updated, we don't need to check whether the linkedInstance DOM
+                        // differs in content because the template is already marked to be sent for change propagation.
+                        isTemplateUpdated = UpdateLinkedInstance(linkIdToUpdate, !isTemplateUpdated) || isTemplateUpdated;
+                    }
+                };
+
+                AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+                if (ed_prefabParallelPropagation && jobContext && linkIdsByTargetTemplate.size() > 1)
+                {
+                    AZ::JobCompletion jobCompletion(jobContext);
+                    for (const AZStd::pair<TemplateId, LinkIds>& bucket : linkIdsByTargetTemplate)
+                    {
+                        AZ::Job* job = AZ::CreateJobFunction(
+                            [&updateTargetTemplate, &bucket]()
+                            {
+                                updateTargetTemplate(bucket);
+                            },
+                            true, jobContext);
+                        job->SetDependent(&jobCompletion);
+                        job->Start();
+                    }
+                    jobCompletion.StartAndWaitForCompletion();
+                }
+                else
+                {
+                    for (const AZStd::pair<TemplateId, LinkIds>& bucket : linkIdsByTargetTemplate)
+                    {
+                        updateTargetTemplate(bucket);
+                    }
+                }
+
+                // Queue the links of the updated target templates, in the order their last link was received.
                 // This will ensure that templates are updated with changes in the same order they are received.
                 for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
                 {
-                    UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue);
+                    const TemplateId targetTemplateId = m_linkIdMap[linkIdToUpdate].GetTargetTemplateId();
+                    targetTemplateIdToLinkIdMap[targetTemplateId].first.erase(linkIdToUpdate);
+                    UpdateTemplateChangePropagationQueue(targetTemplateIdToLinkIdMap, targetTemplateId, linkIdsQueue);
                 }
                 linkIdsQueue.pop();
             }
@@ -238,30 +302,22 @@ namespace AzToolsFramework
             }
         }
 
-        void PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate,
-            TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue)
+        bool PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate, bool compareLinkedInstanceDom)
         {
-            Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
-            TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
+            // Only finds existing entries, so this can run concurrently for the links of different target templates
+            Link& linkToUpdate = m_linkIdMap.find(linkIdToUpdate)->second;
+            if (!compareLinkedInstanceDom)
+            {
+                linkToUpdate.UpdateTarget();
+                return false;
+            }
+
             PrefabDomValue& linkdedInstanceDom = linkToUpdate.GetLinkedInstanceDom();
             PrefabDomValue linkDomBeforeUpdate;
-            linkDomBeforeUpdate.CopyFrom(linkdedInstanceDom, m_templateIdMap[targetTemplateId].GetPrefabDom().GetAllocator());
+            linkDomBeforeUpdate.CopyFrom(linkdedInstanceDom, FindTemplateDom(linkToUpdate.GetTargetTemplateId()).GetAllocator());
             linkToUpdate.UpdateTarget();
 
-            // If any of the templates links are already updated, we don't need to check whether the linkedInstance DOM differs
-            // in content because the template is already marked to be sent for change propagation.
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (isTemplateUpdated ||
-                AZ::JsonSerialization::Compare(linkDomBeforeUpdate, linkdedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
-            {
-                targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
-            }
-
-            if (targetTemplateIdToLinkIdMap.find(targetTemplateId) != targetTemplateIdToLinkIdMap.end())
-            {
-                targetTemplateIdToLinkIdMap[targetTemplateId].first.erase(linkIdToUpdate);
-                UpdateTemplateChangePropagationQueue(targetTemplateIdToLinkIdMap, targetTemplateId, linkIdsQueue);
-            }
+            return AZ::JsonSerialization::Compare(linkDomBeforeUpdate, linkdedInstanceDom) != AZ::JsonSerializerCompareResult::Equal;
         }
 
         void PrefabSystemComponent::UpdateTemplateChangePropagationQueue(
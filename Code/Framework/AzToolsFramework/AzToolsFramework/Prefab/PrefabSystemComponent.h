@@ -284,16 +284,14 @@ namespace AzToolsFramework
                 TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap);
 
             /**
-             * Updates a single linked instance corresponding to the given link Id and adds more linkIds to the
-             * template change propagation queue(linkIdsQueue) when necessary.
+             * Updates a single linked instance corresponding to the given link Id.
+             * The links of different target templates can be updated concurrently.
              *
              * @param linkIdToUpdate The id of the linked instance to update
-             * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
-             *                                    whether any of the instances of the target template were updated.
-             * @param linkIdsQueue A queue of vector of link-Ids to update.
+             * @param compareLinkedInstanceDom Whether to check if the content of the linked instance changed.
+             * @return True when compareLinkedInstanceDom is set and the content of the linked instance changed.
              */
-            void UpdateLinkedInstance(const LinkId linkIdToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
-                AZStd::queue<LinkIds>& linkIdsQueue);
+            bool UpdateLinkedInstance(const LinkId linkIdToUpdate, bool compareLinkedInstanceDom);
 
             /**
              * If all linked instances of a target template are updated and if the content of any of the linked instances changed,
@@ -15,6 +15,90 @@ namespace AzToolsFramework
 {
     namespace Prefab
     {
+        namespace Internal
+        {
+            static bool ArePatchPathsRelated(AZStd::string_view path, AZStd::string_view otherPath)
+            {
+                // one of the paths addresses a value inside of (or equal to) the value of the other
+                const AZStd::string_view& shorterPath = path.size() <= otherPath.size() ? path : otherPath;
+                const AZStd::string_view& longerPath = path.size() <= otherPath.size() ? otherPath : path;
+                return longerPath.starts_with(shorterPath) &&
+                    (longerPath.size() == shorterPath.size() || longerPath[shorterPath.size()] == '/');
+            }
+
+            static AZStd::string_view GetPatchOperationMember(const PrefabDomValue& operation, const char* memberName)
+            {
+                if (!operation.IsObject())
+                {
+                    return {};
+                }
+
+                auto memberIt = operation.FindMember(memberName);
+                if (memberIt == operation.MemberEnd() || !memberIt->value.IsString())
+                {
+                    return {};
+                }
+                return AZStd::string_view(memberIt->value.GetString(), memberIt->value.GetStringLength());
+            }
+
+            //! Removes the replace operations of a patch that a later replace of the same path overwrites, when no operation in
+            //! between touches that path. This keeps the patches of a continuous edit to the size of a single change.
+            static void RemoveSupersededReplaceOperations(PrefabDom& patch)
+            {
+                for (rapidjson::SizeType operationIndex = 0; operationIndex < patch.Size();)
+                {
+                    bool superseded = false;
+                    if (GetPatchOperationMember(patch[operationIndex], "op") == "replace")
+                    {
+                        const AZStd::string_view path = GetPatchOperationMember(patch[operationIndex], "path");
+                        for (rapidjson::SizeType laterIndex = operationIndex + 1; laterIndex < patch.Size(); ++laterIndex)
+                        {
+                            const AZStd::string_view laterOperation = GetPatchOperationMember(patch[laterIndex], "op");
+                            const AZStd::string_view laterPath = GetPatchOperationMember(patch[laterIndex], "path");
+                            if (laterOperation == "replace" && laterPath == path)
+                            {
+                                superseded = true;
+                                break;
+                            }
+
+                            if (laterOperation != "replace" || ArePatchPathsRelated(path, laterPath))
+                            {
+                                break;
+                            }
+                        }
+                    }
+
+                    if (superseded)
+                    {
+                        patch.Erase(patch.Begin() + operationIndex);
+                    }
+                    else
+                    {
+                        ++operationIndex;
+                    }
+                }
+            }
+
+            //! Appends a copy of the operations of appendedPatch at the end of patch.
+            static void AppendPatch(PrefabDom& patch, const PrefabDomValue& appendedPatch)
+            {
+                if (!patch.IsArray())
+                {
+                    patch.SetArray();
+                }
+
+                if (appendedPatch.IsArray())
+                {
+                    for (const PrefabDomValue& operation : appendedPatch.GetArray())
+                    {
+                        patch.PushBack(PrefabDomValue(operation, patch.GetAllocator()), patch.GetAllocator());
+                    }
+                }
+
+                RemoveSupersededReplaceOperations(patch);
+            }
+        } // namespace Internal
+
         PrefabUndoBase::PrefabUndoBase(const AZStd::string& undoOperationName)
             : UndoSystem::URSequencePoint(undoOperationName)
             , m_changed(true)
@@ -24,6 +108,17 @@ namespace AzToolsFramework
             AZ_Assert(m_instanceToTemplateInterface, "Failed to grab instance to template interface");
         }
 
+        size_t PrefabUndoBase::GetMemoryUsage() const
+        {
+            return UndoSystem::URSequencePoint::GetMemoryUsage() + GetDomMemoryUsage(m_redoPatch) + GetDomMemoryUsage(m_undoPatch);
+        }
+
+        size_t PrefabUndoBase::GetDomMemoryUsage(const PrefabDom& dom)
+        {
+            // the values of a dom live in the pool of its allocator, which rapidjson only exposes through the non-const document
+            return const_cast<PrefabDom&>(dom).GetAllocator().Size();
+        }
+
         //PrefabInstanceUndo
         PrefabUndoInstance::PrefabUndoInstance(const AZStd::string& undoOperationName)
             : PrefabUndoBase(undoOperationName)
@@ -84,6 +179,7 @@ namespace AzToolsFramework
             }
 
             m_entityAlias = aliasReference.value();
+            m_entityId = entityId;
 
             //generate undo/redo patches
             m_instanceToTemplateInterface->GeneratePatch(m_redoPatch, initialState, endState);
@@ -92,6 +188,40 @@ namespace AzToolsFramework
             m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(m_undoPatch, entityId);
         }
 
+        bool PrefabUndoEntityUpdate::AppendAndRedo(
+            const PrefabDom& initialState,
+            const PrefabDom& endState,
+            const AZ::EntityId& entityId,
+            InstanceOptionalConstReference instanceToExclude)
+        {
+            if (!m_entityId.IsValid() || entityId != m_entityId)
+            {
+                return false;
+            }
+
+            PrefabDom redoPatch;
+            m_instanceToTemplateInterface->GeneratePatch(redoPatch, initialState, endState);
+            m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(redoPatch, entityId);
+            PrefabDom undoPatch;
+            m_instanceToTemplateInterface->GeneratePatch(undoPatch, endState, initialState);
+            m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(undoPatch, entityId);
+
+            [[maybe_unused]] bool isPatchApplicationSuccessful =
+                m_instanceToTemplateInterface->PatchTemplate(redoPatch, m_templateId, instanceToExclude);
+
+            AZ_Error(
+                "Prefab", isPatchApplicationSuccessful,
+                "Applying the patch on the entity with alias '%s' in template with id '%llu' was unsuccessful", m_entityAlias.c_str(),
+                m_templateId);
+
+            // redo applies the new change after the previous ones, undo reverts it before them
+            Internal::AppendPatch(m_redoPatch, redoPatch);
+            PrefabDom previousUndoPatch = AZStd::move(m_undoPatch);
+            m_undoPatch = AZStd::move(undoPatch);
+            Internal::AppendPatch(m_undoPatch, previousUndoPatch);
+            return true;
+        }
+
         void PrefabUndoEntityUpdate::Undo()
         {
             [[maybe_unused]] bool isPatchApplicationSuccessful =
@@ -202,6 +332,11 @@ namespace AzToolsFramework
             m_prefabSystemComponentInterface->PropagateTemplateChanges(m_targetId);
         }
 
+        size_t PrefabUndoInstanceLink::GetMemoryUsage() const
+        {
+            return PrefabUndoBase::GetMemoryUsage() + GetDomMemoryUsage(m_linkPatches);
+        }
+
         LinkId PrefabUndoInstanceLink::GetLinkId()
         {
             return m_linkId;
@@ -317,6 +452,11 @@ namespace AzToolsFramework
             UpdateLink(m_linkDomNext, instanceToExclude);
         }
 
+        size_t PrefabUndoLinkUpdate::GetMemoryUsage() const
+        {
+            return PrefabUndoBase::GetMemoryUsage() + GetDomMemoryUsage(m_linkDomNext) + GetDomMemoryUsage(m_linkDomPrevious);
+        }
+
         void PrefabUndoLinkUpdate::UpdateLink(PrefabDom& linkDom, InstanceOptionalConstReference instanceToExclude)
         {
             LinkReference link = m_prefabSystemComponentInterface->FindLink(m_linkId);
@@ -27,8 +27,12 @@ namespace AzToolsFramework
             explicit PrefabUndoBase(const AZStd::string& undoOperationName);
 
             bool Changed() const override { return m_changed; }
+            size_t GetMemoryUsage() const override;
 
         protected:
+            //! Estimate of the memory used by the values of a dom, for GetMemoryUsage.
+            static size_t GetDomMemoryUsage(const PrefabDom& dom);
+
             TemplateId m_templateId;
 
             PrefabDom m_redoPatch;
@@ -70,6 +74,16 @@ namespace AzToolsFramework
                 PrefabDom& initialState,
                 PrefabDom& endState, const AZ::EntityId& entity);
 
+            //! Applies a further change of the captured entity from initialState to endState and appends it to this update,
+            //! so that the consecutive changes of a continuous edit, like dragging a slider, make a single update.
+            //! Only the new change is patched and propagated, instanceToExclude isn't refreshed.
+            //! Returns false without applying anything when the update is for another entity.
+            bool AppendAndRedo(
+                const PrefabDom& initialState,
+                const PrefabDom& endState,
+                const AZ::EntityId& entityId,
+                InstanceOptionalConstReference instanceToExclude);
+
             void Undo() override;
             void Redo() override;
             //! Overload to allow to apply the change, but prevent instanceToExclude from being refreshed.
@@ -78,6 +92,7 @@ namespace AzToolsFramework
         private:
             InstanceEntityMapperInterface* m_instanceEntityMapperInterface = nullptr;
             EntityAlias m_entityAlias;
+            AZ::EntityId m_entityId;
         };
 
         //! handles link changes on instances
@@ -104,6 +119,7 @@ namespace AzToolsFramework
 
             void Undo() override;
             void Redo() override;
+            size_t GetMemoryUsage() const override;
 
             LinkId GetLinkId();
 
@@ -139,6 +155,7 @@ namespace AzToolsFramework
             void Redo() override;
             //! Overload to allow to apply the change, but prevent instanceToExclude from being refreshed.
             void Redo(InstanceOptionalConstReference instanceToExclude);
+            size_t GetMemoryUsage() const override;
 
         private:
             void UpdateLink(PrefabDom& linkDom, InstanceOptionalConstReference instanceToExclude = AZStd::nullopt);
@@ -110,6 +110,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -220,27 +221,58 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+
+            // SQLite does not nest transactions, so the inner ones are savepoints within the outermost one.
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                sqlite3_exec(m_db, AZStd::string::format("SAVEPOINT nested_%d;", m_transactionDepth).c_str(), NULL, NULL, NULL);
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
         {
             AZ_Assert(m_db, "CommitTransaction:  Database is not open!");
-            if (!m_db)
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is in progress!");
+            if ((!m_db) || (m_transactionDepth == 0))
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                sqlite3_exec(m_db, AZStd::string::format("RELEASE nested_%d;", m_transactionDepth).c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::RollbackTransaction()
         {
             AZ_Assert(m_db, "RollbackTransaction:  Database is not open!");
-            if (!m_db)
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is in progress!");
+            if ((!m_db) || (m_transactionDepth == 0))
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // only undoes the changes made since the savepoint, the outer transaction carries on.
+                sqlite3_exec(m_db, AZStd::string::format("ROLLBACK TO nested_%d; RELEASE nested_%d;", m_transactionDepth, m_transactionDepth).c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::Vacuum()
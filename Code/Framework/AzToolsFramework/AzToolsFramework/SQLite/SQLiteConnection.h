@@ -46,6 +46,8 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested, the inner ones becoming savepoints of the outermost one.
+            //! Their changes are only written out once the outermost transaction commits.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -87,6 +89,7 @@ namespace AzToolsFramework
 
         private:
             sqlite3* m_db;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
@@ -1348,6 +1348,7 @@ namespace AzToolsFramework
     {
         emit EnableSelectionUpdates(false);
         beginResetModel();
+        ClearDescendantStates();
     }
 
     void EntityOutlinerListModel::OnEntityInfoResetEnd()
@@ -1379,9 +1380,9 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedAddChildEnd(AZ::EntityId parentId, AZ::EntityId childId)
     {
-        (void)parentId;
         AZ_PROFILE_FUNCTION(AzToolsFramework);
         endInsertRows();
+        InvalidateDescendantStates(parentId);
 
         //expand ancestors if a new descendant is already selected
         if ((IsSelected(childId) || HasSelectedDescendant(childId)) && !m_dropOperationInProgress)
@@ -1432,10 +1433,10 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedRemoveChildEnd(AZ::EntityId parentId, AZ::EntityId childId)
     {
-        (void)childId;
         AZ_PROFILE_FUNCTION(AzToolsFramework);
 
         endRemoveRows();
+        InvalidateDescendantStates(parentId);
 
         //must refresh partial lock/visibility of parents
         m_isFilterDirty = true;
@@ -1464,6 +1465,8 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedSelection(AZ::EntityId entityId, bool selected)
     {
+        InvalidateDescendantStates(entityId);
+
         //update all ancestors because they will show highlight if ancestor is selected
         QueueAncestorUpdate(entityId);
 
@@ -1479,6 +1482,8 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedLocked(AZ::EntityId entityId, bool /*locked*/)
     {
+        InvalidateDescendantStates(entityId);
+
         //update all ancestors because they will show partial state for descendants
         QueueEntityUpdate(entityId);
         QueueAncestorUpdate(entityId);
@@ -1486,6 +1491,8 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedVisibility(AZ::EntityId entityId, bool /*visible*/)
     {
+        InvalidateDescendantStates(entityId);
+
         //update all ancestors because they will show partial state for descendants
         QueueEntityUpdate(entityId);
         QueueAncestorUpdate(entityId);
@@ -1864,7 +1871,12 @@ namespace AzToolsFramework
 
     bool EntityOutlinerListModel::HasSelectedDescendant(const AZ::EntityId& entityId) const
     {
-        //TODO result can be cached in mutable map and cleared when any descendant changes to avoid recursion in deep hierarchies
+        if (auto cachedIt = m_hasSelectedDescendantCache.find(entityId); cachedIt != m_hasSelectedDescendantCache.end())
+        {
+            return cachedIt->second;
+        }
+
+        bool hasSelectedDescendant = false;
         EntityIdList children;
         EditorEntityInfoRequestBus::EventResult(children, entityId, &EditorEntityInfoRequestBus::Events::GetChildren);
         for (auto childId : children)
@@ -1873,16 +1885,24 @@ namespace AzToolsFramework
             EditorEntityInfoRequestBus::EventResult(isSelected, childId, &EditorEntityInfoRequestBus::Events::IsSelected);
             if (isSelected || HasSelectedDescendant(childId))
             {
-                return true;
+                hasSelectedDescendant = true;
+                break;
             }
         }
-        return false;
+
+        m_hasSelectedDescendantCache[entityId] = hasSelectedDescendant;
+        return hasSelectedDescendant;
     }
 
     bool EntityOutlinerListModel::AreAllDescendantsSameLockState(const AZ::EntityId& entityId) const
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
-        //TODO result can be cached in mutable map and cleared when any descendant changes to avoid recursion in deep hierarchies
+        if (auto cachedIt = m_allDescendantsSameLockStateCache.find(entityId); cachedIt != m_allDescendantsSameLockStateCache.end())
+        {
+            return cachedIt->second;
+        }
+
+        bool allSameLockState = true;
         bool isLocked = false;
         EditorEntityInfoRequestBus::EventResult(isLocked, entityId, &EditorEntityInfoRequestBus::Events::IsJustThisEntityLocked);
 
@@ -1894,17 +1914,24 @@ namespace AzToolsFramework
             EditorEntityInfoRequestBus::EventResult(isLockedChild, childId, &EditorEntityInfoRequestBus::Events::IsJustThisEntityLocked);
             if (isLocked != isLockedChild || !AreAllDescendantsSameLockState(childId))
             {
-                return false;
+                allSameLockState = false;
+                break;
             }
         }
-        return true;
+
+        m_allDescendantsSameLockStateCache[entityId] = allSameLockState;
+        return allSameLockState;
     }
 
     bool EntityOutlinerListModel::AreAllDescendantsSameVisibleState(const AZ::EntityId& entityId) const
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
-        //TODO result can be cached in mutable map and cleared when any descendant changes to avoid recursion in deep hierarchies
+        if (auto cachedIt = m_allDescendantsSameVisibleStateCache.find(entityId); cachedIt != m_allDescendantsSameVisibleStateCache.end())
+        {
+            return cachedIt->second;
+        }
 
+        bool allSameVisibleState = true;
         bool isVisible = IsEntitySetToBeVisible(entityId);
 
         EntityIdList children;
@@ -1914,10 +1941,35 @@ namespace AzToolsFramework
             bool isVisibleChild = IsEntitySetToBeVisible(childId);
             if (isVisible != isVisibleChild || !AreAllDescendantsSameVisibleState(childId))
             {
-                return false;
+                allSameVisibleState = false;
+                break;
             }
         }
-        return true;
+
+        m_allDescendantsSameVisibleStateCache[entityId] = allSameVisibleState;
+        return allSameVisibleState;
+    }
+
+    void EntityOutlinerListModel::InvalidateDescendantStates(AZ::EntityId entityId)
+    {
+        // the states of the entity depend on its own lock and visibility, the ones of its ancestors on all of its state
+        for (AZ::EntityId currentId = entityId; currentId.IsValid();)
+        {
+            m_hasSelectedDescendantCache.erase(currentId);
+            m_allDescendantsSameLockStateCache.erase(currentId);
+            m_allDescendantsSameVisibleStateCache.erase(currentId);
+
+            AZ::EntityId parentId;
+            EditorEntityInfoRequestBus::EventResult(parentId, currentId, &EditorEntityInfoRequestBus::Events::GetParent);
+            currentId = parentId;
+        }
+    }
+
+    void EntityOutlinerListModel::ClearDescendantStates()
+    {
+        m_hasSelectedDescendantCache.clear();
+        m_allDescendantsSameLockStateCache.clear();
+        m_allDescendantsSameVisibleStateCache.clear();
     }
 
     bool EntityOutlinerListModel::IsInLayerWithProperty(AZ::EntityId entityId, const LayerProperty& layerProperty) const
@@ -1990,6 +2042,8 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnContextReset()
     {
+        ClearDescendantStates();
+
         if (m_filterString.size() > 0 || m_componentFilters.size() > 0)
         {
             m_isFilterDirty = true;
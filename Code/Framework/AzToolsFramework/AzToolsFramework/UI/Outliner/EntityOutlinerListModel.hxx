@@ -267,6 +267,14 @@ namespace AzToolsFramework
         bool AreAllDescendantsSameLockState(const AZ::EntityId& entityId) const;
         bool AreAllDescendantsSameVisibleState(const AZ::EntityId& entityId) const;
 
+        //! The descendant states are queried for every painted row and each needs a walk of the hierarchy below the entity,
+        //! so they are cached until the state of the entity or of one of its descendants changes.
+        void InvalidateDescendantStates(AZ::EntityId entityId);
+        void ClearDescendantStates();
+        mutable AZStd::unordered_map<AZ::EntityId, bool> m_hasSelectedDescendantCache;
+        mutable AZStd::unordered_map<AZ::EntityId, bool> m_allDescendantsSameLockStateCache;
+        mutable AZStd::unordered_map<AZ::EntityId, bool> m_allDescendantsSameVisibleStateCache;
+
         enum LayerProperty
         {
             Locked,
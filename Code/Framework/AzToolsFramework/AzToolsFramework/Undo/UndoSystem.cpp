@@ -63,6 +63,16 @@ namespace AzToolsFramework
         {
         }
 
+        size_t URSequencePoint::GetMemoryUsage() const
+        {
+            size_t memoryUsage = sizeof(*this) + m_friendlyName.capacity() + m_children.capacity() * sizeof(URSequencePoint*);
+            for (const URSequencePoint* child : m_children)
+            {
+                memoryUsage += child->GetMemoryUsage();
+            }
+            return memoryUsage;
+        }
+
         void URSequencePoint::Redo()
         {
         }
@@ -187,7 +197,10 @@ namespace AzToolsFramework
             Slice();
 
             m_SequencePointsBuffer.push_back(cmd);
+            m_SequencePointSizes.push_back(cmd->GetMemoryUsage());
+            m_memoryUsage += m_SequencePointSizes.back();
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
+            TrimToMemoryBudget();
 #ifdef _DEBUG
             CleanCheck();
 #endif
@@ -217,6 +230,8 @@ namespace AzToolsFramework
 
             URSequencePoint* returned = m_SequencePointsBuffer[m_Cursor];
             m_SequencePointsBuffer.pop_back();
+            m_memoryUsage -= m_SequencePointSizes.back();
+            m_SequencePointSizes.pop_back();
             returned->m_isPosted = false;
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
 
@@ -252,6 +267,8 @@ namespace AzToolsFramework
                 }
             }
             m_SequencePointsBuffer.clear();
+            m_SequencePointSizes.clear();
+            m_memoryUsage = 0;
 
             if (m_notify)
             {
@@ -329,6 +346,8 @@ namespace AzToolsFramework
                 for (int idx = m_Cursor + 1; idx < int(m_SequencePointsBuffer.size()); )
                 {
                     m_SequencePointsBuffer.pop_back();
+                    m_memoryUsage -= m_SequencePointSizes.back();
+                    m_SequencePointSizes.pop_back();
                 }
 
                 if (m_CleanPoint > m_Cursor)
@@ -346,6 +365,34 @@ namespace AzToolsFramework
             }
         }
 
+        void UndoStack::SetMemoryBudget(size_t memoryBudget)
+        {
+            m_memoryBudget = memoryBudget;
+        }
+
+        void UndoStack::TrimToMemoryBudget()
+        {
+            if (m_memoryBudget == 0 || m_memoryUsage <= m_memoryBudget || m_Cursor <= 0)
+            {
+                return;
+            }
+
+            // drop the oldest commands, never the one at the cursor
+            int trimCount = 0;
+            while (trimCount < m_Cursor && m_memoryUsage > m_memoryBudget)
+            {
+                delete m_SequencePointsBuffer[trimCount];
+                m_memoryUsage -= m_SequencePointSizes[trimCount];
+                ++trimCount;
+            }
+
+            m_SequencePointsBuffer.erase(m_SequencePointsBuffer.begin(), m_SequencePointsBuffer.begin() + trimCount);
+            m_SequencePointSizes.erase(m_SequencePointSizes.begin(), m_SequencePointSizes.begin() + trimCount);
+            m_Cursor -= trimCount;
+            // the clean state is unreachable once the command leading to it got dropped, see Slice for the magic number
+            m_CleanPoint = m_CleanPoint >= trimCount - 1 ? m_CleanPoint - trimCount : -2;
+        }
+
         URSequencePoint* UndoStack::Find(URCommandID id, const AZ::Uuid& typeOfCommand)
         {
             for (int idx = 0; idx < int(m_SequencePointsBuffer.size()); ++idx)
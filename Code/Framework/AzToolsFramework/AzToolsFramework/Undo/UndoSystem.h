@@ -75,6 +75,12 @@ namespace AzToolsFramework
             */
             virtual bool Changed() const = 0;
 
+            /**
+            Usage: override to add the memory held by the class specific state, like serialized data or patches.
+            The undo stack uses it to cap its history by memory. The base implementation adds up all children.
+            */
+            virtual size_t GetMemoryUsage() const;
+
             /**
             Usage: return the first command in the parent/child tree with a matching id
             returns NULL on failure to make any match
@@ -167,6 +173,13 @@ namespace AzToolsFramework
 
             void Reset(); // clear everything
 
+            /**
+            Usage: caps the memory used by the history, the oldest commands are dropped when a new command exceeds it.
+            The command at the cursor is always kept. 0 removes the cap.
+            */
+            void SetMemoryBudget(size_t memoryBudget);
+            size_t GetMemoryUsage() const { return m_memoryUsage; }
+
             bool CanUndo() const;
             bool CanRedo() const;
 
@@ -195,9 +208,13 @@ namespace AzToolsFramework
             typedef AZStd::vector<URSequencePoint*> SequencePointBuffer;
 
             SequencePointBuffer m_SequencePointsBuffer;
+            AZStd::vector<size_t> m_SequencePointSizes; // GetMemoryUsage of each command of m_SequencePointsBuffer when posted
+            size_t m_memoryUsage = 0;
+            size_t m_memoryBudget = 0;
             IUndoNotify* m_notify;
 
         private:
+            void TrimToMemoryBudget();
 
             // undo operations are not reentrant
             volatile bool reentryGuard;
@@ -12,6 +12,7 @@
 #include <AzCore/Math/VectorConversions.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Viewport/CameraState.h>
+#include <AzFramework/Viewport/ViewportDepthPicking.h>
 #include <AzFramework/Viewport/ViewportScreen.h>
 #include <AzFramework/Visibility/BoundsBus.h>
 #include <AzToolsFramework/API/EditorViewportIconDisplayInterface.h>
@@ -52,6 +53,21 @@ AZ_CVAR(
     AZ::ConsoleFunctorFlags::Null,
     "Use a lock icon when the cursor is over entities that cannot be interacted with");
 
+AZ_CVAR(
+    bool,
+    ed_viewportDepthPicking,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Skip picking the entities that are behind the surface rendered under the cursor, using the depth read back from the renderer");
+AZ_CVAR(
+    float,
+    ed_viewportDepthPickingTolerance,
+    0.5f,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Distance behind the surface rendered under the cursor up to which entities are still picked");
+
 AZ_CVAR(float, ed_iconMinScale, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum scale for icons in the distance");
 AZ_CVAR(float, ed_iconMaxScale, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum scale for icons near the camera");
 AZ_CVAR(float, ed_iconCloseDist, 3.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Distance at which icons are at maximum scale");
@@ -149,6 +165,46 @@ namespace AzToolsFramework
         return m_containerAncestorEntityId;
     }
 
+    // returns the distance along the pick ray up to which entities can be visible under the cursor, from the depth
+    // the renderer read back around the cursor (the depth is a few frames old, so it is only used while it is still on the ray)
+    static float VisibleSurfacePickDistance(
+        const AzFramework::ViewportId viewportId,
+        const AzFramework::ScreenSize& viewportSize,
+        const ViewportInteraction::MousePick& mousePick)
+    {
+        AzFramework::ViewportDepthPickingInterface* depthPicking = AzFramework::ViewportDepthPicking::Get();
+        if (!ed_viewportDepthPicking || !depthPicking)
+        {
+            return AZStd::numeric_limits<float>::max();
+        }
+
+        // request the region around the cursor for the next picks
+        depthPicking->RequestDepthRegion(viewportId, mousePick.m_screenCoordinates, viewportSize);
+
+        AzFramework::ViewportDepthRegion region;
+        if (!depthPicking->GetDepthRegion(viewportId, region))
+        {
+            return AZStd::numeric_limits<float>::max();
+        }
+
+        const AZStd::optional<AZ::Vector3> surfacePosition = region.GetWorldPosition(mousePick.m_screenCoordinates, viewportSize);
+        if (!surfacePosition.has_value())
+        {
+            return AZStd::numeric_limits<float>::max();
+        }
+
+        const AZ::Vector3 toSurface = surfacePosition.value() - mousePick.m_rayOrigin;
+        const float surfaceDistance = toSurface.Dot(mousePick.m_rayDirection);
+        const float tolerance = ed_viewportDepthPickingTolerance;
+        // the camera or the cursor moved since the depth got rendered
+        if (surfaceDistance <= 0.0f || (toSurface - mousePick.m_rayDirection * surfaceDistance).GetLength() > tolerance)
+        {
+            return AZStd::numeric_limits<float>::max();
+        }
+
+        return surfaceDistance + tolerance;
+    }
+
     bool CursorEntityIdQuery::HasContainerAncestorEntityId() const
     {
         if (m_entityId.IsValid())
@@ -187,6 +243,10 @@ namespace AzToolsFramework
         const AZ::Matrix3x4 cameraView = AzFramework::CameraView(cameraState);
         const AZ::Matrix4x4 cameraProjection = AzFramework::CameraProjection(cameraState);
 
+        // entities behind the visible surface under the cursor can't be picked, so their components aren't intersected
+        const float maxPickDistance =
+            VisibleSurfacePickDistance(viewportId, cameraState.m_viewportSize, mouseInteraction.m_mouseInteraction.m_mousePick);
+
         // selecting new entities
         AZ::EntityId entityIdUnderCursor;
         float closestDistance = AZStd::numeric_limits<float>::max();
@@ -232,7 +292,7 @@ namespace AzToolsFramework
             }
 
             float closestBoundDifference;
-            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId))
+            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, maxPickDistance, closestBoundDifference, viewportId))
             {
                 if (closestBoundDifference < closestDistance)
                 {
@@ -82,8 +82,13 @@ namespace AzToolsFramework
         return AabbIntersectRay(mouseInteraction.m_mousePick.m_rayOrigin, mouseInteraction.m_mousePick.m_rayDirection, aabb, unused);
     }
 
-    bool PickEntity(
-        AZ::EntityId entityId, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, float& closestDistance, const int viewportId)
+    static bool PickEntity(
+        AZ::EntityId entityId,
+        const AZ::Vector3& rayOrigin,
+        const AZ::Vector3& rayDirection,
+        const float maxDistance,
+        float& closestDistance,
+        const int viewportId)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -98,8 +103,8 @@ namespace AzToolsFramework
         }
 
         // coarse grain check
-        float unused;
-        if (!AabbIntersectRay(rayOrigin, rayDirection, aabb, unused))
+        float aabbDistance;
+        if (!AabbIntersectRay(rayOrigin, rayDirection, aabb, aabbDistance) || aabbDistance > maxDistance)
         {
             return false;
         }
@@ -127,14 +132,35 @@ namespace AzToolsFramework
         return entityPicked;
     }
 
+    bool PickEntity(
+        AZ::EntityId entityId, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, float& closestDistance, const int viewportId)
+    {
+        return PickEntity(entityId, rayOrigin, rayDirection, AZStd::numeric_limits<float>::max(), closestDistance, viewportId);
+    }
+
     bool PickEntity(
         const AZ::EntityId entityId,
         const ViewportInteraction::MouseInteraction& mouseInteraction,
         float& closestDistance,
         const int viewportId)
+    {
+        return PickEntity(entityId, mouseInteraction, AZStd::numeric_limits<float>::max(), closestDistance, viewportId);
+    }
+
+    bool PickEntity(
+        const AZ::EntityId entityId,
+        const ViewportInteraction::MouseInteraction& mouseInteraction,
+        const float maxDistance,
+        float& closestDistance,
+        const int viewportId)
     {
         return PickEntity(
-            entityId, mouseInteraction.m_mousePick.m_rayOrigin, mouseInteraction.m_mousePick.m_rayDirection, closestDistance, viewportId);
+            entityId,
+            mouseInteraction.m_mousePick.m_rayOrigin,
+            mouseInteraction.m_mousePick.m_rayDirection,
+            maxDistance,
+            closestDistance,
+            viewportId);
     }
 
     AzFramework::CameraState GetCameraState(const int viewportId)
@@ -59,6 +59,37 @@ namespace UnitTest
 
     }
 
+    TEST_F(PrefabUpdateInstancesTest, UpdatePrefabInstances_UpdateEntityName_UnchangedEntitiesAreKept)
+    {
+        // Create a Template from an Instance owning two entities.
+        using namespace AzToolsFramework::Prefab;
+        AZ::Entity* entity1 = CreateEntity("Entity 1");
+        AZ::Entity* entity2 = CreateEntity("Entity 2");
+        AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
+            &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, AzToolsFramework::EntityList{ entity1, entity2 });
+        AZStd::unique_ptr<Instance> newInstance = m_prefabSystemComponent->CreatePrefab({ entity1, entity2 }, {}, PrefabMockFilePath);
+        ASSERT_TRUE(newInstance);
+        TemplateId newTemplateId = newInstance->GetTemplateId();
+        PrefabDom& newTemplateDom = m_prefabSystemComponent->FindTemplateDom(newTemplateId);
+        const EntityAlias unchangedEntityAlias = newInstance->GetEntityAlias(entity1->GetId())->get();
+        const EntityAlias changedEntityAlias = newInstance->GetEntityAlias(entity2->GetId())->get();
+
+        AZStd::unique_ptr<Instance> instantiatedInstance = m_prefabSystemComponent->InstantiatePrefab(newTemplateId);
+        ASSERT_TRUE(instantiatedInstance);
+        const AZ::Entity* unchangedEntityBeforeUpdate = &instantiatedInstance->GetEntity(unchangedEntityAlias)->get();
+
+        // Rename one of the entities in the Template and update the Template's Instances.
+        PrefabDomPath entityNamePath = PrefabTestDomUtils::GetPrefabDomEntityNamePath(changedEntityAlias);
+        entityNamePath.Set(newTemplateDom, "Updated Entity");
+        m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(newTemplateId);
+        EXPECT_TRUE(m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue());
+
+        // The renamed entity got reloaded, and the other one was kept as it was.
+        EXPECT_EQ(instantiatedInstance->GetEntity(changedEntityAlias)->get().GetName(), "Updated Entity");
+        EXPECT_EQ(&instantiatedInstance->GetEntity(unchangedEntityAlias)->get(), unchangedEntityBeforeUpdate);
+        EXPECT_EQ(instantiatedInstance->GetEntity(unchangedEntityAlias)->get().GetName(), "Entity 1");
+    }
+
     TEST_F(PrefabUpdateInstancesTest, UpdatePrefabInstances_AddEntity_UpdateSucceeds)
     {
         // Create a Template from an Instance owning a single entity.
@@ -534,4 +534,54 @@ namespace UnitTest
         EXPECT_EQ(numUndos, counter);
         EXPECT_EQ(tracker, numUndos);
     }
+
+    TEST(UndoStack, MemoryBudget_Exceeded_DropsOldestCommands)
+    {
+        UndoStack undoStack(nullptr);
+
+        int tracker = 0;
+        undoStack.Post(aznew UndoIntSetter(&tracker, 1));
+        const size_t commandMemoryUsage = undoStack.GetMemoryUsage();
+        EXPECT_GT(commandMemoryUsage, 0);
+
+        // room for three commands
+        undoStack.SetMemoryBudget(commandMemoryUsage * 3);
+        for (int i = 1; i < 10; i++)
+        {
+            undoStack.Post(aznew UndoIntSetter(&tracker, i + 1));
+        }
+
+        EXPECT_EQ(undoStack.GetMemoryUsage(), commandMemoryUsage * 3);
+
+        int counter = 0;
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            counter++;
+        }
+
+        EXPECT_EQ(counter, 3);
+        EXPECT_EQ(tracker, 7);
+    }
+
+    TEST(UndoStack, MemoryBudget_CleanCommandDropped_NeverClean)
+    {
+        UndoStack undoStack(nullptr);
+
+        int tracker = 0;
+        undoStack.Post(aznew UndoIntSetter(&tracker, 1));
+        undoStack.SetClean();
+        undoStack.SetMemoryBudget(undoStack.GetMemoryUsage());
+
+        undoStack.Post(aznew UndoIntSetter(&tracker, 2));
+        undoStack.Post(aznew UndoIntSetter(&tracker, 3));
+        EXPECT_FALSE(undoStack.IsClean());
+
+        // the state after the first command can't be reached anymore
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            EXPECT_FALSE(undoStack.IsClean());
+        }
+    }
 }
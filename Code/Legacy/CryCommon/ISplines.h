@@ -664,18 +664,40 @@ namespace spline
         float           m_rangeEnd;
 
         // Return key before or equal to this time.
+        // The key found last is checked first along with the one after it, so monotonic playback finds its key in
+        // constant time while seeks and reversed playback fall back to a binary search.
         inline int seek_key(float t)
         {
             assert(num_keys() < (1 << 15));
-            if ((m_curr >= num_keys()) || (time(m_curr) > t))
+            const int last = num_keys() - 1;
+            if ((m_curr <= last) && (time(m_curr) <= t))
             {
-                // Search from begining.
-                m_curr = 0;
+                if ((m_curr == last) || (time(m_curr + 1) > t))
+                {
+                    return m_curr;
+                }
+                if ((m_curr + 1 == last) || (time(m_curr + 2) > t))
+                {
+                    return ++m_curr;
+                }
             }
-            while ((m_curr < num_keys() - 1) && (time(m_curr + 1) <= t))
+
+            // Find the last key with a time before or equal to t.
+            int low = 0;
+            int high = last;
+            while (low < high)
             {
-                ++m_curr;
+                const int mid = (low + high + 1) / 2;
+                if (time(mid) <= t)
+                {
+                    low = mid;
+                }
+                else
+                {
+                    high = mid - 1;
+                }
             }
+            m_curr = static_cast<int16>(low);
             return m_curr;
         }
 
@@ -332,6 +332,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            AccessTraceArg,
             PlatformArg,
             PrintFlag,
             VerboseFlag,
@@ -1094,6 +1095,16 @@ namespace AssetBundler
             params.m_maxBundleSizeInMB = AZStd::stoi(parser->GetSwitchValue(MaxBundleSizeArg, 0));
         }
 
+        // Read in Access Trace arg
+        if (parser->HasSwitch(AccessTraceArg))
+        {
+            if (parser->GetNumSwitchValues(AccessTraceArg) != 1)
+            {
+                return AZ::Failure(AZStd::string::format("Invalid command: \"--%s\" must have exactly one value.", AccessTraceArg));
+            }
+            params.m_accessTracePath = parser->GetSwitchValue(AccessTraceArg, 0);
+        }
+
         // Read in Print flag
         params.m_print = parser->HasSwitch(PrintFlag);
 
@@ -2090,6 +2101,12 @@ namespace AssetBundler
                 bundleSettings.m_maxBundleSizeInMB = params.m_maxBundleSizeInMB;
             }
 
+            // Access Trace
+            if (!params.m_accessTracePath.empty())
+            {
+                bundleSettings.m_accessTracePath = params.m_accessTracePath;
+            }
+
             // Print
             if (params.m_print)
             {
@@ -2098,7 +2115,8 @@ namespace AssetBundler
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Asset List file: %s\n", bundleSettings.m_assetFileInfoListPath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Output Bundle path: %s\n", bundleSettings.m_bundleFilePath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Bundle Version: %i\n", bundleSettings.m_bundleVersion);
-                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Access Trace file: %s\n\n", bundleSettings.m_accessTracePath.c_str());
             }
 
             // Save
@@ -2824,6 +2842,8 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which version of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for a single Bundle (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Sets the streamer access trace used to store the Bundle files in load order.\n", AccessTraceArg);
+        AZ_Printf(AppWindowName, "%-31s---Record it in the runtime with streamer_StartAccessTrace and streamer_StopAccessTrace <file>.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) referenced by all Bundle Settings operations.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---Defaults to all enabled platforms. Platforms can be changed by modifying AssetProcessorPlatformConfig.setreg.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Outputs the contents of the Bundle Settings file after modifying any specified values.\n", PrintFlag);
@@ -125,6 +125,8 @@ namespace AssetBundler
         int m_bundleVersion = -1;
         int m_maxBundleSizeInMB = -1;
 
+        AZStd::string m_accessTracePath;
+
         bool m_print = false;
 
         AzFramework::PlatformFlags m_platformFlags = AzFramework::PlatformFlags::Platform_NONE;
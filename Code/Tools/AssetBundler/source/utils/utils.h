@@ -105,6 +105,7 @@ namespace AssetBundler
     extern const char* OutputBundlePathArg;
     extern const char* BundleVersionArg;
     extern const char* MaxBundleSizeArg;
+    extern const char* AccessTraceArg;
     ////////////////////////////////////////////////////////////////////////////////////////////
 
     ////////////////////////////////////////////////////////////////////////////////////////////
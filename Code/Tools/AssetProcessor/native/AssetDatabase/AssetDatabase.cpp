@@ -1341,6 +1341,22 @@ namespace AssetProcessor
         }
     }
 
+    void AssetDatabaseConnection::BeginBatchedWrites()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->BeginTransaction();
+        }
+    }
+
+    void AssetDatabaseConnection::CommitBatchedWrites()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->CommitTransaction();
+        }
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
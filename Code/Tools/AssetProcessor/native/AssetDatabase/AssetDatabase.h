@@ -44,6 +44,11 @@ namespace AssetProcessor
         } 
         void VacuumAndAnalyze();
 
+        //! Groups all the writes made until the matching CommitBatchedWrites into a single transaction, so they get written out
+        //! at once rather than each in its own transaction. Batches can be nested, only the outermost one writes out.
+        void BeginBatchedWrites();
+        void CommitBatchedWrites();
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase() override;
@@ -985,6 +985,9 @@ namespace AssetProcessor
                 continue;
             }
 
+            // write out the source, job, product and dependency records of the job at once, rather than each on its own
+            m_stateData->BeginBatchedWrites();
+
             if (m_stateData->GetSourcesBySourceNameScanFolderId(processedAsset.m_entry.m_databaseSourceName, scanFolder->ScanFolderID(), sources))
             {
                 AZ_Assert(sources.size() == 1, "Should have only found one source!!!");
@@ -1354,6 +1357,9 @@ namespace AssetProcessor
                 AddKnownFoldersRecursivelyForFile(fullProductPath, m_cacheRootDir.absolutePath());
             }
 
+            // the records need to be visible to the other database connections before the job is announced
+            m_stateData->CommitBatchedWrites();
+
             QString fullSourcePath = processedAsset.m_entry.GetAbsoluteSourcePath();
 
             // notify the system about inputs:
@@ -2832,6 +2838,9 @@ namespace AssetProcessor
     {
         int processedFileCount = 0;
 
+        // the mod times of the unchanged files get updated in a single transaction
+        m_stateData->BeginBatchedWrites();
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -2863,6 +2872,8 @@ namespace AssetProcessor
             AssessFileInternal(fileInfo.m_filePath, false, true);
         }
 
+        m_stateData->CommitBatchedWrites();
+
         if (m_allowModtimeSkippingFeature)
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
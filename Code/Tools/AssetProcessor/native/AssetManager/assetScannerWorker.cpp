@@ -27,6 +27,8 @@ void AssetScannerWorker::StartScan()
     m_folderList.clear();
     m_doScan = true;
 
+    AssetUtilities::ComputeProjectCacheRoot(m_projectCacheRoot);
+
     AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Scanning file system for changes...\n");
 
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
@@ -102,9 +104,7 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
 
         // Skip over the Cache folder if the file entry is the project cache root
-        QDir projectCacheRoot;
-        AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
-        QString relativeToProjectCacheRoot = projectCacheRoot.relativeFilePath(absPath);
+        QString relativeToProjectCacheRoot = m_projectCacheRoot.relativeFilePath(absPath);
         if (QDir::isRelativePath(relativeToProjectCacheRoot) && !relativeToProjectCacheRoot.startsWith(".."))
         {
             // The Cache folder should not be scanned
@@ -11,6 +11,7 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include <QDir>
 #include <QString>
 #include <QSet>
 #include <QObject>
@@ -53,6 +54,7 @@ Q_SIGNALS:
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
+        QDir m_projectCacheRoot; // computed once per scan rather than once per scanned entry
         PlatformConfiguration* m_platformConfiguration;
     };
 } // end namespace AssetProcessor
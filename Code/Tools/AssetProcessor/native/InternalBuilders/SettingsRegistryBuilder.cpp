@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Platform/PlatformDefaults.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -313,51 +314,55 @@ namespace AssetProcessor
 
                 using FixedValueString = AZ::SettingsRegistryInterface::FixedValueString;
 
-                AZ::SettingsRegistryImpl registry;
+                AZStd::array settingsToCopy{
+                    AZStd::string::format("%s/project_path", AZ::SettingsRegistryMergeUtils::BootstrapSettingsRootKey),
+                    AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_BinaryFolder},
+                    AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder},
+                    AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectPath},
+                    AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_CacheProjectRootFolder},
+                    AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_CacheRootFolder},
+                };
 
-                // Seed the local settings registry using the AssetProcessor Settings Registry
-                if (auto settingsRegistry = AZ::Interface<AZ::SettingsRegistryInterface>::Get(); settingsRegistry != nullptr)
+                auto SeedLocalRegistry = [&settingsToCopy](AZ::SettingsRegistryImpl& registry)
                 {
-                    AZStd::array settingsToCopy{
-                        AZStd::string::format("%s/project_path", AZ::SettingsRegistryMergeUtils::BootstrapSettingsRootKey),
-                        AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_BinaryFolder},
-                        AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder},
-                        AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectPath},
-                        AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_CacheProjectRootFolder},
-                        AZStd::string{AZ::SettingsRegistryMergeUtils::FilePathKey_CacheRootFolder},
-                    };
-
-                    for (const auto& settingsKey : settingsToCopy)
+                    // Seed the local settings registry using the AssetProcessor Settings Registry
+                    if (auto settingsRegistry = AZ::Interface<AZ::SettingsRegistryInterface>::Get(); settingsRegistry != nullptr)
                     {
-                        FixedValueString settingsValue;
-                        [[maybe_unused]] bool settingsCopied = settingsRegistry->Get(settingsValue, settingsKey)
-                            && registry.Set(settingsKey, settingsValue);
-                        AZ_Warning("Settings Registry Builder", settingsCopied, "Unable to copy setting %s from AssetProcessor settings registry"
-                            " to local settings registry", settingsKey.c_str());
+                        for (const auto& settingsKey : settingsToCopy)
+                        {
+                            FixedValueString settingsValue;
+                            [[maybe_unused]] bool settingsCopied = settingsRegistry->Get(settingsValue, settingsKey)
+                                && registry.Set(settingsKey, settingsValue);
+                            AZ_Warning("Settings Registry Builder", settingsCopied, "Unable to copy setting %s from AssetProcessor settings registry"
+                                " to local settings registry", settingsKey.c_str());
+                        }
+
+                        // The purpose of this section is to copy the active gems entry and manifest gems entries
+                        // to a local SettingsRegistry.
+                        // The reason this is needed is so that the call to
+                        // `MergeSettingsToRegistry_GemRegistries` below is able to locate each gems root directory
+                        // that will be merged into the bootstrap.game.<configuration>.setreg file
+                        // This is used by the GameLauncher applications to read from a single merged .setreg file
+                        // containing the settings needed to run a game/simulation without have access to the source code base registry
+                        auto CopySettingsToLocalRegistry = [&registry, settingsRegistry, copiedSettings = AZStd::string()]
+                        (AZStd::string_view copyFieldKey) mutable
+                        {
+                            // Copy Settings at the specified field key recursively to the local settings registry
+                            copiedSettings.clear();
+                            AZ::IO::ByteContainerStream copiedSettingsStream(&copiedSettings);
+                            AZ::SettingsRegistryMergeUtils::DumperSettings dumperSettings;
+                            AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(*settingsRegistry, copyFieldKey,
+                                copiedSettingsStream, dumperSettings);
+                            registry.MergeSettings(copiedSettings, AZ::SettingsRegistryInterface::Format::JsonMergePatch, copyFieldKey);
+                        };
+
+                        CopySettingsToLocalRegistry(AZ::SettingsRegistryMergeUtils::ActiveGemsRootKey);
+                        CopySettingsToLocalRegistry(AZ::SettingsRegistryMergeUtils::ManifestGemsRootKey);
                     }
+                };
 
-                    // The purpose of this section is to copy the active gems entry and manifest gems entries
-                    // to a local SettingsRegistry.
-                    // The reason this is needed is so that the call to
-                    // `MergeSettingsToRegistry_GemRegistries` below is able to locate each gems root directory
-                    // that will be merged into the bootstrap.game.<configuration>.setreg file
-                    // This is used by the GameLauncher applications to read from a single merged .setreg file
-                    // containing the settings needed to run a game/simulation without have access to the source code base registry
-                    auto CopySettingsToLocalRegistry = [&registry, settingsRegistry, copiedSettings = AZStd::string()]
-                    (AZStd::string_view copyFieldKey) mutable
-                    {
-                        // Copy Settings at the specified field key recursively to the local settings registry
-                        copiedSettings.clear();
-                        AZ::IO::ByteContainerStream copiedSettingsStream(&copiedSettings);
-                        AZ::SettingsRegistryMergeUtils::DumperSettings dumperSettings;
-                        AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(*settingsRegistry, copyFieldKey,
-                            copiedSettingsStream, dumperSettings);
-                        registry.MergeSettings(copiedSettings, AZ::SettingsRegistryInterface::Format::JsonMergePatch, copyFieldKey);
-                    };
-
-                    CopySettingsToLocalRegistry(AZ::SettingsRegistryMergeUtils::ActiveGemsRootKey);
-                    CopySettingsToLocalRegistry(AZ::SettingsRegistryMergeUtils::ManifestGemsRootKey);
-                }
+                AZ::SettingsRegistryImpl registry;
+                SeedLocalRegistry(registry);
 
                 AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, platform, specialization, &scratchBuffer);
                 AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, platform, specialization, &scratchBuffer);
@@ -424,6 +429,46 @@ namespace AssetProcessor
                     response.m_outputProducts.emplace_back(outputPath, m_assetType, hashedSpecialization);
                     response.m_outputProducts.back().m_dependenciesHandled = true;
 
+                    // Compile a snapshot of only the Engine, Gem and Project registry folders. Applications merge this
+                    // snapshot instead of the individual folders, for as long as the folders haven't changed.
+                    AZ::SettingsRegistryImpl snapshotRegistry;
+                    SeedLocalRegistry(snapshotRegistry);
+                    AZStd::vector<AZ::SettingsRegistrySnapshot::Input> snapshotInputs;
+                    AZ::SettingsRegistryMergeUtils::CollectRegistrySnapshotInputs(snapshotRegistry, platform, snapshotInputs, &scratchBuffer);
+                    AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(snapshotRegistry, platform, specialization, &scratchBuffer);
+                    AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(snapshotRegistry, platform, specialization, &scratchBuffer);
+                    AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(snapshotRegistry, platform, specialization, &scratchBuffer);
+
+                    // The seeded settings are provided by the application that merges the snapshot, so they're not stored.
+                    for (const auto& settingsKey : settingsToCopy)
+                    {
+                        snapshotRegistry.Remove(settingsKey);
+                    }
+                    snapshotRegistry.Remove(AZ::SettingsRegistryMergeUtils::ActiveGemsRootKey);
+                    snapshotRegistry.Remove(AZ::SettingsRegistryMergeUtils::ManifestGemsRootKey);
+                    snapshotRegistry.Remove(AZ_SETTINGS_REGISTRY_HISTORY_KEY);
+                    for (const AZStd::string& exclude : excludes)
+                    {
+                        snapshotRegistry.Remove(exclude);
+                    }
+
+                    outputPath.erase(extensionOffset + specializationString.size());
+                    outputPath += AZ::SettingsRegistrySnapshot::Extension;
+
+                    AZ::SettingsRegistrySnapshot snapshot;
+                    if (!snapshot.Create(snapshotRegistry,
+                        AZ::SettingsRegistryMergeUtils::GetRegistrySnapshotConfiguration(platform, specialization), snapshotInputs) ||
+                        !snapshot.Save(outputPath.c_str()))
+                    {
+                        AZ_Error("Settings Registry Builder", false, R"(Failed to write settings registry snapshot to file "%s".)", outputPath.c_str());
+                        return;
+                    }
+
+                    AZStd::string_view snapshotName = AZStd::string_view(outputPath).substr(extensionOffset);
+                    const AZ::u32 hashedSnapshot = static_cast<AZ::u32>(AZStd::hash<AZStd::string_view>{}(snapshotName));
+                    response.m_outputProducts.emplace_back(outputPath, m_assetType, hashedSnapshot);
+                    response.m_outputProducts.back().m_dependenciesHandled = true;
+
                     outputPath.erase(extensionOffset);
                 }
 
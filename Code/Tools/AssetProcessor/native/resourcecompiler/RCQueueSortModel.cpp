@@ -177,6 +177,14 @@ namespace AssetProcessor
             return leftJobEscalation > rightJobEscalation;
         }
 
+        // jobs that other queued jobs wait on take priority, so the dependent jobs don't hold back the queue at the end.
+        const int leftNumDependentJobs = GetNumDependentJobs(leftJob);
+        const int rightNumDependentJobs = GetNumDependentJobs(rightJob);
+        if (leftNumDependentJobs != rightNumDependentJobs)
+        {
+            return leftNumDependentJobs > rightNumDependentJobs;
+        }
+
         // arbitrarily, lets have PC get done first since pc-format assets are what the editor uses.
         if (leftJob->GetPlatformInfo().m_identifier != rightJob->GetPlatformInfo().m_identifier)
         {
@@ -239,12 +247,53 @@ namespace AssetProcessor
     }
     void RCQueueSortModel::AddJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
-        m_currentJobRunKeyToJobEntries[rcJob->GetJobEntry().m_jobRunKey] = rcJob;
+        auto insertResult = m_currentJobRunKeyToJobEntries.insert_key(rcJob->GetJobEntry().m_jobRunKey);
+        if (insertResult.second)
+        {
+            UpdateDependentJobCounts(rcJob, 1);
+        }
+        insertResult.first->second = rcJob;
     }
 
     void RCQueueSortModel::RemoveJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
-        m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
+        if (m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey) > 0)
+        {
+            UpdateDependentJobCounts(rcJob, -1);
+        }
+    }
+
+    void RCQueueSortModel::UpdateDependentJobCounts(AssetProcessor::RCJob* rcJob, int delta)
+    {
+        for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+        {
+            const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+            if (jobDependency.m_type != AssetBuilderSDK::JobDependencyType::Order && jobDependency.m_type != AssetBuilderSDK::JobDependencyType::OrderOnce)
+            {
+                continue;
+            }
+
+            QueueElementID elementId(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str());
+            auto found = m_numDependentJobs.find(elementId);
+            if (found == m_numDependentJobs.end())
+            {
+                found = m_numDependentJobs.insert(elementId, 0);
+            }
+
+            found.value() += delta;
+            if (found.value() <= 0)
+            {
+                m_numDependentJobs.erase(found);
+            }
+
+            // the order of the queued jobs depends on the counts, resort it before the next job gets pulled.
+            m_dirtyNeedsResort = true;
+        }
+    }
+
+    int RCQueueSortModel::GetNumDependentJobs(const AssetProcessor::RCJob* rcJob) const
+    {
+        return m_numDependentJobs.value(rcJob->GetElementID(), 0);
     }
 
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
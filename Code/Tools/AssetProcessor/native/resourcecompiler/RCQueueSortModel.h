@@ -10,6 +10,7 @@
 
 #if !defined(Q_MOC_RUN)
 #include <QSortFilterProxyModel>
+#include <QHash>
 #include <QSet>
 #include <QString>
 
@@ -17,6 +18,7 @@
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
 #include "native/assetprocessor.h"
+#include "native/resourcecompiler/RCCommon.h"
 #endif
 
 class RCcontrollerUnitTests;
@@ -33,6 +35,7 @@ namespace AssetProcessor
     //!  * Critical (currently Copy) jobs for currently connected platforms
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
+    //!  * Jobs that more queued jobs have an order dependency on, as finishing them unblocks those
     //!  * Remaining jobs in currently connected platforms, in priority order
     //!  (The same, repeated, for unconnected platforms).
     class RCQueueSortModel
@@ -69,6 +72,11 @@ namespace AssetProcessor
 
         JobRunKeyToRCJobMap m_currentJobRunKeyToJobEntries;
 
+        // The number of queued jobs with an order job dependency on each job, so the jobs blocking the most other jobs go first.
+        QHash<QueueElementID, int> m_numDependentJobs;
+        void UpdateDependentJobCounts(AssetProcessor::RCJob* rcJob, int delta);
+        int GetNumDependentJobs(const AssetProcessor::RCJob* rcJob) const;
+
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
@@ -522,7 +522,9 @@ namespace AssetProcessor
                     if (m_jobDetails.m_checkServer)
                     {
                         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
-                        builderParams.m_serverKey = QString("%1_%2_%3_%4").arg(fileInfo.completeBaseName(), builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(), builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str()).arg(builderParams.m_rcJob->GetOriginalFingerprint());
+                        // the products are addressed by their content fingerprint, which all the machines sharing the server agree on
+                        const AZStd::string serverFingerprint = AssetUtilities::GenerateServerFingerprint(m_jobDetails);
+                        builderParams.m_serverKey = QString("%1_%2_%3_%4").arg(fileInfo.completeBaseName(), builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(), builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str(), serverFingerprint.c_str());
                         bool operationResult = false;
                         if (AssetUtilities::InServerMode())
                         {
@@ -543,9 +545,9 @@ namespace AssetProcessor
 
                                 if (!operationResult)
                                 {
-                                    AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to save job (%s, %s, %s) with fingerprint (%u) to the server.\n",
+                                    AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to save job (%s, %s, %s) with fingerprint (%s) to the server.\n",
                                         builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
-                                        builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+                                        builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), serverFingerprint.c_str());
                                 }
                             }
                         }
@@ -561,9 +563,9 @@ namespace AssetProcessor
                             }
                             else
                             {
-                                AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to get job (%s, %s, %s) with fingerprint (%u) from the server. Processing locally.\n",
+                                AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to get job (%s, %s, %s) with fingerprint (%s) from the server. Processing locally.\n",
                                     builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
-                                    builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+                                    builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), serverFingerprint.c_str());
                             }
 
                             runProcessJob = !operationResult;
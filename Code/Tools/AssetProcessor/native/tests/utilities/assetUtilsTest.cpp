@@ -224,6 +224,35 @@ TEST_F(AssetUtilitiesTest, GenerateFingerprint_BasicTest)
     EXPECT_NE(result1, result2);
 }
 
+TEST_F(AssetUtilitiesTest, GenerateServerFingerprint_SameContents_SameFingerprint)
+{
+    QTemporaryDir dir;
+    QDir tempPath(dir.path());
+    QString canonicalTempDirPath = AssetUtilities::NormalizeDirectoryPath(tempPath.canonicalPath());
+    UnitTestUtils::ScopedDir changeDir(canonicalTempDirPath);
+    tempPath = QDir(canonicalTempDirPath);
+    QString absoluteTestFilePath = tempPath.absoluteFilePath("basicfile.txt");
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents"));
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_extraInformationForFingerprinting = "extra info";
+    jobDetail.m_fingerprintFiles.insert(AZStd::make_pair(absoluteTestFilePath.toUtf8().constData(), "basicfile.txt"));
+
+    // the full digest is used
+    AZStd::string result1 = AssetUtilities::GenerateServerFingerprint(jobDetail);
+    EXPECT_EQ(result1.size(), 40);
+
+    // writing the same contents again only changes the modification time, which the server fingerprint ignores
+    UnitTestUtils::SleepForMinimumFileSystemTime();
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents"));
+    AZStd::string result2 = AssetUtilities::GenerateServerFingerprint(jobDetail);
+    EXPECT_EQ(result1, result2);
+
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents new"));
+    result2 = AssetUtilities::GenerateServerFingerprint(jobDetail);
+    EXPECT_NE(result1, result2);
+}
+
 TEST_F(AssetUtilitiesTest, GenerateFingerprint_Empty_Asserts)
 {
     AssetProcessor::JobDetails jobDetail;
@@ -55,6 +55,7 @@ void RCcontrollerUnitTests::Reset()
     m_rcController.m_RCQueueSortModel.AttachToModel(nullptr);
     m_rcController.m_RCQueueSortModel.AttachToModel(&m_rcController.m_RCJobListModel);
     m_rcController.m_RCQueueSortModel.m_currentJobRunKeyToJobEntries.clear();
+    m_rcController.m_RCQueueSortModel.m_numDependentJobs.clear();
     m_rcController.m_RCQueueSortModel.m_currentlyConnectedPlatforms.clear();
 }
 
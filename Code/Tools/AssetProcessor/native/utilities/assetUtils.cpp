@@ -1081,10 +1081,10 @@ namespace AssetUtilities
         return ReadJobLogResult::Success;
     }
 
-    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    //! Builds the string that the job fingerprints are a hash of.
+    static AZStd::string BuildFingerprintString(const AssetProcessor::JobDetails& jobDetail, bool forceFileHashing)
     {
         // it is assumed that m_fingerprintFilesList contains the original file and all dependencies, and is in a stable order without duplicates
-        // CRC32 is not an effective hash for this purpose, so we will build a string and then use SHA1 on it.
 
         // to avoid resizing and copying repeatedly we will keep track of the largest reserved capacity ever needed for this function, and reserve that much data
         static size_t s_largestFingerprintCapacitySoFar = 1;
@@ -1100,7 +1100,7 @@ namespace AssetUtilities
         for (const auto& fingerprintFile : jobDetail.m_fingerprintFiles)
         {
             fingerprintString.append(":");
-            fingerprintString.append(GetFileFingerprint(fingerprintFile.first, fingerprintFile.second));
+            fingerprintString.append(GetFileFingerprint(fingerprintFile.first, fingerprintFile.second, forceFileHashing));
         }
         // now the other jobs, which this job depends on:
         for (const AssetProcessor::JobDependencyInternal& jobDependencyInternal : jobDetail.m_jobDependencyList)
@@ -1124,7 +1124,13 @@ namespace AssetUtilities
             }
         }
         s_largestFingerprintCapacitySoFar = AZStd::GetMax(fingerprintString.capacity(), s_largestFingerprintCapacitySoFar);
+        return fingerprintString;
+    }
 
+    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // CRC32 is not an effective hash for this purpose, so we will build a string and then use SHA1 on it.
+        const AZStd::string fingerprintString = BuildFingerprintString(jobDetail, false);
         if (fingerprintString.empty())
         {
             AZ_Assert(false, "GenerateFingerprint was called but no input files were requested for fingerprinting.");
@@ -1139,6 +1145,25 @@ namespace AssetUtilities
         return digest[0]; // we only currently use 32-bit hashes.  This could be extended if collisions still occur.
     }
 
+    AZStd::string GenerateServerFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // the file contents are always hashed, so that machines with different file modification times agree on the key.
+        const AZStd::string fingerprintString = BuildFingerprintString(jobDetail, true);
+        if (fingerprintString.empty())
+        {
+            AZ_Assert(false, "GenerateServerFingerprint was called but no input files were requested for fingerprinting.");
+            return AZStd::string();
+        }
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(fingerprintString.data(), fingerprintString.size());
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        // the whole digest is kept, as products get shared between all the machines using the server and a collision would hand out wrong products.
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
     std::uint64_t AdjustTimestamp(QDateTime timestamp, int overridePrecision)
     {
         if (timestamp.isDaylightTime())
@@ -1204,7 +1229,7 @@ namespace AssetUtilities
         return timeMilliseconds;
     }
 
-    AZStd::string GetFileFingerprint(const AZStd::string& absolutePath, const AZStd::string& nameToUse)
+    AZStd::string GetFileFingerprint(const AZStd::string& absolutePath, const AZStd::string& nameToUse, bool forceFileHashing)
     {
         bool fileFound = false;
         AssetProcessor::FileStateInfo fileStateInfo;
@@ -1231,6 +1256,11 @@ namespace AssetUtilities
             {
                 fileIdentifier = GetFileHash(absolutePath.c_str());
             }
+            else if (forceFileHashing)
+            {
+                // the file state cache only keeps hashes when file hashing is enabled, so hash the file directly.
+                fileIdentifier = AssetBuilderSDK::GetFileHash(absolutePath.c_str());
+            }
             else
             {
                 fileIdentifier = AdjustTimestamp(lastModifiedTime);
@@ -238,6 +238,10 @@ namespace AssetUtilities
     //! interrogate a given file, which is specified as a full path name, and generate a fingerprint for it.
     unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail);
 
+    //! Generates the content addressed key the products of a job are shared under through the asset server.
+    //! Unlike GenerateFingerprint, the file contents are always hashed, whatever the file hashing setting, and the full SHA1 digest is returned as a hex string.
+    AZStd::string GenerateServerFingerprint(const AssetProcessor::JobDetails& jobDetail);
+
     //! Returns a hash of the contents of the specified file
     // hashMsDelay is only for automated tests to test that writing to a file while it's hashing does not cause a crash.
     // hashMsDelay is not used in non-unit test builds.
@@ -249,7 +253,8 @@ namespace AssetUtilities
     // Generates a fingerprint string based on details of the file, will return the string "0" if the file does not exist.
     // note that the 'name to use' can be blank, but it used to disambiguate between files that have the same
     // modtime and size.
-    AZStd::string GetFileFingerprint(const AZStd::string& absolutePath, const AZStd::string& nameToUse);
+    // forceFileHashing hashes the file contents even when file hashing is disabled in the settings.
+    AZStd::string GetFileFingerprint(const AZStd::string& absolutePath, const AZStd::string& nameToUse, bool forceFileHashing = false);
 
     QString GuessProductNameInDatabase(QString path, QString platform, AssetProcessor::AssetDatabaseConnection* databaseConnection);
 
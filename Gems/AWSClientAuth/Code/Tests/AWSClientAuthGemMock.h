@@ -221,6 +221,17 @@ namespace AWSClientAuthUnitTest
             AZ_UNUSED(body);
             AZ_UNUSED(callback);
         }
+
+        void AddStreamRequest(const AZStd::string& URI, Aws::Http::HttpMethod method, const HttpRequestor::Headers& headers, const AZStd::string& body,
+            const HttpRequestor::ResponseStreamFactory& streamFactory, const HttpRequestor::StreamCallback& callback) override
+        {
+            AZ_UNUSED(URI);
+            AZ_UNUSED(method);
+            AZ_UNUSED(headers);
+            AZ_UNUSED(body);
+            AZ_UNUSED(streamFactory);
+            AZ_UNUSED(callback);
+        }
     };
 
     class CognitoIdentityProviderClientMock
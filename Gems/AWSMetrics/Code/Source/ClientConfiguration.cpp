@@ -11,6 +11,7 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -22,6 +23,9 @@ namespace AWSMetrics
         , m_queueFlushPeriodInSeconds(60)
         , m_offlineRecordingEnabled(false)
         , m_maxNumRetries(1)
+        , m_maxBufferedSizeInMb(3.0)
+        , m_maxInFlightRequests(4)
+        , m_spillToFileEnabled(true)
     {
     }
 
@@ -68,6 +72,17 @@ namespace AWSMetrics
             return false;
         }
 
+        // Settings for the backpressure, older configuration files don't have them
+        settingsRegistry->Get(
+            m_maxBufferedSizeInMb,
+            AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey, AWSMetricsMaxBufferedSizeInMbKey));
+        settingsRegistry->Get(
+            m_maxInFlightRequests,
+            AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey, AWSMetricsMaxInFlightRequestsKey));
+        settingsRegistry->Get(
+            m_spillToFileEnabled,
+            AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey, AWSMetricsSpillToFileEnabledKey));
+
         return ResolveMetricsFilePath();
     }
 
@@ -107,6 +122,21 @@ namespace AWSMetrics
         return m_queueFlushPeriodInSeconds;
     }
 
+    AZ::s64 ClientConfiguration::GetMaxBufferedSizeInBytes() const
+    {
+        return AZStd::max(static_cast<AZ::s64>(m_maxBufferedSizeInMb * 1000000), GetMaxQueueSizeInBytes());
+    }
+
+    AZ::s64 ClientConfiguration::GetMaxInFlightRequests() const
+    {
+        return AZStd::max(m_maxInFlightRequests, AZ::s64(1));
+    }
+
+    bool ClientConfiguration::SpillToFileEnabled() const
+    {
+        return m_spillToFileEnabled;
+    }
+
     bool ClientConfiguration::OfflineRecordingEnabled() const
     {
         return m_offlineRecordingEnabled;
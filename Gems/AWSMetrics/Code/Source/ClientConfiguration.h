@@ -23,6 +23,9 @@ namespace AWSMetrics
         static constexpr const char AWSMetricsQueueFlushPeriodInSecondsKey[] = "/Gems/AWSMetrics/QueueFlushPeriodInSeconds";
         static constexpr const char AWSMetricsOfflineRecordingEnabledKey[] = "/Gems/AWSMetrics/OfflineRecording";
         static constexpr const char AWSMetricsMaxNumRetriesKey[] = "/Gems/AWSMetrics/MaxNumRetries";
+        static constexpr const char AWSMetricsMaxBufferedSizeInMbKey[] = "/Gems/AWSMetrics/MaxBufferedSizeInMb";
+        static constexpr const char AWSMetricsMaxInFlightRequestsKey[] = "/Gems/AWSMetrics/MaxInFlightRequests";
+        static constexpr const char AWSMetricsSpillToFileEnabledKey[] = "/Gems/AWSMetrics/SpillToFile";
         
         ClientConfiguration();
 
@@ -46,6 +49,19 @@ namespace AWSMetrics
         //! @return Maximum number of retries.
         AZ::s64 GetMaxNumRetries() const;
 
+        //! Retrieve the maximum size of the metrics buffered while the backend can't keep up.
+        //! It is never lower than the max queue size.
+        //! @return Maximum buffered size in bytes.
+        AZ::s64 GetMaxBufferedSizeInBytes() const;
+
+        //! Retrieve the maximum number of requests sent to the backend concurrently.
+        //! @return Maximum number of in flight requests.
+        AZ::s64 GetMaxInFlightRequests() const;
+
+        //! Whether metrics exceeding the maximum buffered size are written to the local metrics file instead of being dropped.
+        //! @return Whether spilling to the local metrics file is enabled.
+        bool SpillToFileEnabled() const;
+
         //! Retrieve the directory of the local metrics file
         //! @return Directory of the local metrics file
         const char* GetMetricsFileDir() const;
@@ -65,6 +81,9 @@ namespace AWSMetrics
         AZ::s64 m_queueFlushPeriodInSeconds; //< Default to 60 seconds to guarantee the near real time data input.
         AZStd::atomic_bool m_offlineRecordingEnabled; //< Default to false to disable the offline recording.
         AZ::s64 m_maxNumRetries; //< Maximum number of retries for submission.
+        double m_maxBufferedSizeInMb; //< Default to 3MB, the optional settings keep their default when they are missing.
+        AZ::s64 m_maxInFlightRequests; //< Default to 4 requests, further metrics stay buffered until a response is received.
+        bool m_spillToFileEnabled; //< Default to true to keep the metrics the backend can't keep up with on disk.
 
         AZStd::string m_metricsDir;
         AZStd::string m_metricsFilePath;
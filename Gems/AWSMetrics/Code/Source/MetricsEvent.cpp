@@ -139,7 +139,25 @@ namespace AWSMetrics
         return true;
     }
 
+    AZStd::unique_ptr<rapidjson::SchemaDocument> MetricsEvent::CreateJsonSchema()
+    {
+        rapidjson::Document jsonSchemaDocument;
+        if (jsonSchemaDocument.Parse(AwsMetricsEventJsonSchema).HasParseError())
+        {
+            AZ_Error("AWSMetrics", false, "Invalid metrics event json schema.");
+            return nullptr;
+        }
+
+        return AZStd::make_unique<rapidjson::SchemaDocument>(jsonSchemaDocument);
+    }
+
     bool MetricsEvent::ValidateAgainstSchema()
+    {
+        AZStd::unique_ptr<rapidjson::SchemaDocument> jsonSchema = CreateJsonSchema();
+        return jsonSchema && ValidateAgainstSchema(*jsonSchema);
+    }
+
+    bool MetricsEvent::ValidateAgainstSchema(const rapidjson::SchemaDocument& jsonSchema)
     {
         std::stringstream stringStream;
         AWSCore::JsonOutputStream jsonStream{stringStream};
@@ -156,14 +174,6 @@ namespace AWSMetrics
             return false;
         }
 
-        rapidjson::Document jsonSchemaDocument;
-        if (jsonSchemaDocument.Parse(AwsMetricsEventJsonSchema).HasParseError())
-        {
-            AZ_Error("AWSMetrics", false, "Invalid metrics event json schema.");
-            return false;
-        }
-
-        auto jsonSchema = rapidjson::SchemaDocument(jsonSchemaDocument);
         rapidjson::SchemaValidator validator(jsonSchema);
 
         if (!result.GetValue().Accept(validator))
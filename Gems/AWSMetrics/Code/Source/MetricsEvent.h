@@ -10,7 +10,9 @@
 
 #include <MetricsAttribute.h>
 
+#include <AzCore/JSON/schema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AWSMetrics
 {
@@ -51,6 +53,16 @@ namespace AWSMetrics
         //! @return whether the metrics event match the JSON schema.
         bool ValidateAgainstSchema();
 
+        //! Validate the metrics event with a JSON schema created by CreateJsonSchema.
+        //! Parsing the schema and compiling its patterns costs more than validating the event, reuse it for each event.
+        //! @param jsonSchema JSON schema to validate against.
+        //! @return whether the metrics event match the JSON schema.
+        bool ValidateAgainstSchema(const rapidjson::SchemaDocument& jsonSchema);
+
+        //! Parse the predefined JSON schema of the metrics events.
+        //! @return The JSON schema, nullptr if it is invalid.
+        static AZStd::unique_ptr<rapidjson::SchemaDocument> CreateJsonSchema();
+
         //! Add the count of failures for sending the metrics event.
         void MarkFailedSubmission();
 
@@ -69,7 +69,7 @@ namespace AWSMetrics
             // The thread will wake up either when the metrics event queue is full (try_acquire_for call returns true),
             // or the flush period limit is hit (try_acquire_for call returns false).
             m_waitEvent.try_acquire_for(AZStd::chrono::seconds(m_clientConfiguration->GetQueueFlushPeriodInSeconds()));
-            FlushMetricsAsync();
+            FlushMetrics();
         }
     }
 
@@ -97,22 +97,50 @@ namespace AWSMetrics
             SetMetricsPriority(eventPriority).
             Build();
 
-        if (!metricsEvent.ValidateAgainstSchema())
+        if (!m_metricsEventSchema || !metricsEvent.ValidateAgainstSchema(*m_metricsEventSchema))
         {
             m_globalStats.m_numDropped++;
             return false;
         }
 
-        AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
-        m_metricsQueue.AddMetrics(metricsEvent);
+        BufferMetrics(metricsEvent);
+        return true;
+    }
 
-        if (m_metricsQueue.GetSizeInBytes() >= static_cast<size_t>(m_clientConfiguration->GetMaxQueueSizeInBytes()))
+    void MetricsManager::BufferMetrics(const MetricsEvent& metricsEvent)
+    {
+        AZStd::shared_ptr<MetricsQueue> metricsToSpill;
         {
-            // Flush the metrics queue when the accumulated metrics size hits the limit
-            m_waitEvent.release();
+            AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
+            m_metricsQueue.AddMetrics(metricsEvent);
+
+            const size_t maxBufferedSizeInBytes = static_cast<size_t>(m_clientConfiguration->GetMaxBufferedSizeInBytes());
+            if (m_metricsQueue.GetSizeInBytes() >= maxBufferedSizeInBytes && !m_clientConfiguration->OfflineRecordingEnabled())
+            {
+                // The backend can't keep up with the submitted metrics, stop growing the buffer
+                if (m_clientConfiguration->SpillToFileEnabled())
+                {
+                    metricsToSpill = AZStd::make_shared<MetricsQueue>();
+                    metricsToSpill->AppendMetrics(m_metricsQueue);
+                    m_metricsQueue.ClearMetrics();
+                }
+                else
+                {
+                    // Drop below the limit with some margin, so that the following submissions don't sort the buffer again
+                    m_globalStats.m_numDropped += m_metricsQueue.FilterMetricsByPriority(maxBufferedSizeInBytes / 4 * 3);
+                }
+            }
+            else if (m_metricsQueue.GetSizeInBytes() >= static_cast<size_t>(m_clientConfiguration->GetMaxQueueSizeInBytes()))
+            {
+                // Flush the metrics queue when the accumulated metrics size hits the limit
+                m_waitEvent.release();
+            }
         }
 
-        return true;
+        if (metricsToSpill)
+        {
+            SpillMetricsToLocalFileAsync(metricsToSpill);
+        }
     }
 
     bool MetricsManager::SendMetricsAsync(const AZStd::vector<MetricsAttribute>& metricsAttributes, int eventPriority, const AZStd::string & eventSourceOverride)
@@ -123,7 +151,7 @@ namespace AWSMetrics
             SetMetricsPriority(eventPriority).
             Build();
 
-        if (!metricsEvent.ValidateAgainstSchema())
+        if (!m_metricsEventSchema || !metricsEvent.ValidateAgainstSchema(*m_metricsEventSchema))
         {
             m_globalStats.m_numDropped++;
             return false;
@@ -205,14 +233,37 @@ namespace AWSMetrics
         job->Start();
     }
 
+    void MetricsManager::SpillMetricsToLocalFileAsync(AZStd::shared_ptr<MetricsQueue> metricsQueue)
+    {
+        AZ::Job* job{ nullptr };
+        job = AZ::CreateJobFunction(
+            [this, metricsQueue]()
+            {
+                // Spilled metrics aren't sent yet, they are resubmitted without any notification once the backend caught up
+                if (SendMetricsToFile(metricsQueue).IsSuccess())
+                {
+                    m_hasSpilledMetrics = true;
+                }
+                else
+                {
+                    m_globalStats.m_numDropped += metricsQueue->GetNumMetrics();
+                }
+            },
+            true, m_jobContext.get());
+
+        job->Start();
+    }
+
     void MetricsManager::SendMetricsToServiceApiAsync(const MetricsQueue& metricsQueue)
     {
         int requestId = ++m_sendMetricsId;
+        ++m_numInFlightRequests;
 
         ServiceAPI::PostMetricsEventsRequestJob* requestJob = ServiceAPI::PostMetricsEventsRequestJob::Create(
             [this, requestId](ServiceAPI::PostMetricsEventsRequestJob* successJob)
             {
                 OnResponseReceived(successJob->parameters.m_metricsQueue, successJob->result.m_responseEntries);
+                OnRequestCompleted();
 
                 AZ::TickBus::QueueFunction([requestId]()
                 {
@@ -222,6 +273,7 @@ namespace AWSMetrics
             [this, requestId](ServiceAPI::PostMetricsEventsRequestJob* failedJob)
             {
                 OnResponseReceived(failedJob->parameters.m_metricsQueue);
+                OnRequestCompleted();
 
                 AZStd::string errorMessage = failedJob->error.message;
                 AZ::TickBus::QueueFunction([requestId, errorMessage]()
@@ -283,6 +335,18 @@ namespace AWSMetrics
         PushMetricsForRetry(metricsEventsForRetry);
     }
 
+    void MetricsManager::OnRequestCompleted()
+    {
+        --m_numInFlightRequests;
+
+        // Send the metrics held back by the in flight requests limit without waiting for the next flush period
+        AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
+        if (m_hasSpilledMetrics || m_metricsQueue.GetSizeInBytes() >= static_cast<size_t>(m_clientConfiguration->GetMaxQueueSizeInBytes()))
+        {
+            m_waitEvent.release();
+        }
+    }
+
     void MetricsManager::PushMetricsForRetry(MetricsQueue& metricsEventsForRetry)
     {
         if (m_clientConfiguration->GetMaxNumRetries() == 0)
@@ -345,6 +409,32 @@ namespace AWSMetrics
 
     void MetricsManager::FlushMetricsAsync()
     {
+        if (!m_monitorTerminated)
+        {
+            // Keep the flush off the calling thread, which is usually the game thread
+            m_waitEvent.release();
+            return;
+        }
+
+        FlushMetrics();
+    }
+
+    void MetricsManager::FlushMetrics()
+    {
+        if (!m_clientConfiguration->OfflineRecordingEnabled())
+        {
+            if (m_numInFlightRequests >= m_clientConfiguration->GetMaxInFlightRequests())
+            {
+                // Keep buffering until the backend responds, the buffer size is bounded by the maximum buffered size
+                return;
+            }
+
+            if (m_numInFlightRequests == 0 && m_hasSpilledMetrics.exchange(false))
+            {
+                SubmitLocalMetricsAsync();
+            }
+        }
+
         AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
         if (m_metricsQueue.GetNumMetrics() == 0)
         {
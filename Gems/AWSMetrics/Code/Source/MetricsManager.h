@@ -64,6 +64,7 @@ namespace AWSMetrics
         void OnResponseReceived(const MetricsQueue& metricsEventsInRequest, const ServiceAPI::PostMetricsEventsResponseEntries& responseEntries = ServiceAPI::PostMetricsEventsResponseEntries());
 
         //! Implementation for flush all metrics buffered in memory.
+        //! The flush is handed to the monitor thread once the metrics are started.
         void FlushMetricsAsync();
 
         //! Get the total number of metrics buffered in the metrics queue.
@@ -105,6 +106,21 @@ namespace AWSMetrics
         //! Monitor the buffered metrics queue and consume metrics when the size or elapsed time limit is hit.
         void MonitorMetricsQueue();
 
+        //! Send the buffered metrics unless the maximum number of requests are already in flight.
+        //! Metrics spilled to the local metrics file are resubmitted once the backend caught up.
+        void FlushMetrics();
+
+        //! Add a metrics event to the buffer, spilling or dropping metrics when the buffer exceeds its maximum size.
+        //! @param metricsEvent Metrics event to buffer.
+        void BufferMetrics(const MetricsEvent& metricsEvent);
+
+        //! Write the metrics exceeding the buffer limit to the local metrics file asynchronously, to resubmit them later.
+        //! @param metricsQueue Metrics events to spill.
+        void SpillMetricsToLocalFileAsync(AZStd::shared_ptr<MetricsQueue> metricsQueue);
+
+        //! Track the completion of a service API request and wake up the monitor if metrics were held back.
+        void OnRequestCompleted();
+
         //! Send metrics to a local file or the backend service asynchronously.
         //! @param metricsQueue Metrics queue that stores the metrics.
         void SendMetricsAsync(AZStd::shared_ptr<MetricsQueue> metricsQueue);
@@ -129,6 +145,8 @@ namespace AWSMetrics
         AZStd::mutex m_metricsFileMutex; //!< Mutex to protect the local metrics file
 
         AZStd::atomic<int> m_sendMetricsId;//!< Request ID for sending metrics
+        AZStd::atomic<int> m_numInFlightRequests{ 0 }; //!< Number of service API requests waiting for a response
+        AZStd::atomic<bool> m_hasSpilledMetrics{ false }; //!< Whether metrics were spilled to the local metrics file for resubmission
 
         AZStd::thread m_monitorThread; //!< Thread to monitor and consume the metrics queue
         AZStd::atomic<bool> m_monitorTerminated;
@@ -144,6 +162,8 @@ namespace AWSMetrics
 
         AZStd::unique_ptr<IdentityProvider> m_clientIdProvider;
 
+        AZStd::unique_ptr<rapidjson::SchemaDocument> m_metricsEventSchema{ MetricsEvent::CreateJsonSchema() }; //!< Schema shared by the validation of all the submitted metrics events
+
         GlobalStatistics m_globalStats;
     };
 }
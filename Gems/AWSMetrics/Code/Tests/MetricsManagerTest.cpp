@@ -553,6 +553,58 @@ namespace AWSMetrics
         ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
     }
 
+    TEST_F(MetricsManagerTest, SubmitMetrics_MaxBufferedSize_SpillToLocalFile)
+    {
+        // Buffer up to four metrics events while the backend is unavailable.
+        m_settingsRegistry->Set(AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey,
+            ClientConfiguration::AWSMetricsMaxBufferedSizeInMbKey), (double)TestMetricsEventSizeInBytes * 4 / MbToBytes);
+        m_settingsRegistry->Set(AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey,
+            ClientConfiguration::AWSMetricsSpillToFileEnabledKey), true);
+        ResetClientConfig(false, (double)TestMetricsEventSizeInBytes * 2 / MbToBytes, DefaultFlushPeriodInSeconds, 0);
+
+        for (int index = 0; index < 4; ++index)
+        {
+            AZStd::vector<MetricsAttribute> metricsAttributes;
+            metricsAttributes.emplace_back(AZStd::move(MetricsAttribute(AwsMetricsAttributeKeyEventName, AttrValue)));
+
+            bool result = false;
+            AWSMetricsRequestBus::BroadcastResult(result, &AWSMetricsRequests::SubmitMetrics, metricsAttributes, 0, "", true);
+            ASSERT_TRUE(result);
+        }
+
+        // Wait for the spilled metrics to be written to the local file.
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(SleepTimeForProcessingInMs));
+
+        const GlobalStatistics& stats = m_metricsManager->GetGlobalStatistics();
+        EXPECT_EQ(stats.m_numDropped, 0);
+        ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+    }
+
+    TEST_F(MetricsManagerTest, SubmitMetrics_MaxBufferedSize_DropMetrics)
+    {
+        // Buffer up to four metrics events while the backend is unavailable.
+        m_settingsRegistry->Set(AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey,
+            ClientConfiguration::AWSMetricsMaxBufferedSizeInMbKey), (double)TestMetricsEventSizeInBytes * 4 / MbToBytes);
+        m_settingsRegistry->Set(AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey,
+            ClientConfiguration::AWSMetricsSpillToFileEnabledKey), false);
+        ResetClientConfig(false, (double)TestMetricsEventSizeInBytes * 2 / MbToBytes, DefaultFlushPeriodInSeconds, 0);
+
+        for (int index = 0; index < 4; ++index)
+        {
+            AZStd::vector<MetricsAttribute> metricsAttributes;
+            metricsAttributes.emplace_back(AZStd::move(MetricsAttribute(AwsMetricsAttributeKeyEventName, AttrValue)));
+
+            bool result = false;
+            AWSMetricsRequestBus::BroadcastResult(result, &AWSMetricsRequests::SubmitMetrics, metricsAttributes, 0, "", true);
+            ASSERT_TRUE(result);
+        }
+
+        // The buffer is reduced to three quarters of its maximum size.
+        const GlobalStatistics& stats = m_metricsManager->GetGlobalStatistics();
+        EXPECT_EQ(stats.m_numDropped, 1);
+        ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 3);
+    }
+
     class ClientConfigurationTest
         : public AWSMetricsGemAllocatorFixture
     {
@@ -7,11 +7,13 @@
  */
 
 
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
+#include <Processing/Utils.h>
 
 #include <Compressors/ISPCTextureCompressor.h>
 
@@ -19,6 +21,11 @@
 
 namespace ImageProcessingAtom
 {
+    // All the formats compressed with ISPC have 4x4 blocks
+    static constexpr uint32 BlockSize = 4;
+    // Number of pixel rows compressed by each parallel job, a multiple of the block size
+    static constexpr uint32 BandRowCount = 64;
+
     // Class used to store functions to specific quality profiles.
     class CompressionProfile
     {
@@ -185,64 +192,71 @@ namespace ImageProcessingAtom
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
-        // Compress the images per mip
+        // Get the settings of the destination format
+        bc6h_enc_settings bc6Settings = {};
+        bc7_enc_settings bc7Settings = {};
+        switch (destinationFormat)
+        {
+        case ePixelFormat_BC3:
+            break;
+        case ePixelFormat_BC6UH:
+            compressionProfile->GetBC6()(&bc6Settings);
+            break;
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+            compressionProfile->GetBC7(discardAlpha)(&bc7Settings);
+            break;
+        default:
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+
+        // Compress the images per mip, large mips are split into bands of block rows that are compressed in parallel
         const uint32 mipCount = destinationImage->GetMipCount();
         for (uint32_t mip = 0; mip < mipCount; mip++)
         {
-            // Create rgba_surface as input
             uint32 sourcePitch = 0;
             AZ::u8* sourceImageData = nullptr;
             sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
-            {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
-            }
+            const uint32 width = sourceImage->GetWidth(mip);
+            const uint32 height = sourceImage->GetHeight(mip);
 
             // Get the mip image destination pointer
             uint32_t destinationPitch = 0;
             AZ::u8* destinationImageData = nullptr;
             destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
 
-            // Compress with the correct function, depending on the destination format
-            switch (destinationFormat)
-            {
-            case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
-                break;
-            case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
-                // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
-
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            default:
-            {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
-            }
-            break;
-            }
+            const uint32 bandCount = AZ::DivideAndRoundUp(height, BandRowCount);
+            Utils::ParallelFor(bandCount, [&](AZ::u32 band)
+                {
+                    // Create rgba_surface as input
+                    const uint32 firstRow = band * BandRowCount;
+                    rgba_surface sourceSurface = {};
+                    sourceSurface.ptr = sourceImageData + firstRow * sourcePitch;
+                    sourceSurface.width = width;
+                    sourceSurface.height = AZStd::min(BandRowCount, height - firstRow);
+                    sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+
+                    // The destination pitch is the size of a row of blocks
+                    AZ::u8* bandDestinationData = destinationImageData + (firstRow / BlockSize) * destinationPitch;
+
+                    // Compress with the correct function, depending on the destination format
+                    switch (destinationFormat)
+                    {
+                    case ePixelFormat_BC3:
+                        CompressBlocksBC3(&sourceSurface, bandDestinationData);
+                        break;
+                    case ePixelFormat_BC6UH:
+                        // Compress with BC6 half precision
+                        CompressBlocksBC6H(&sourceSurface, bandDestinationData, &bc6Settings);
+                        break;
+                    default:
+                        // Compress with BC7
+                        CompressBlocksBC7(&sourceSurface, bandDestinationData, &bc7Settings);
+                        break;
+                    }
+                });
         }
 
         return destinationImage;
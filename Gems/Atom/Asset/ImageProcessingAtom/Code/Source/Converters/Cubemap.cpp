@@ -12,6 +12,7 @@
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/Utils.h>
 
 #include <Compressors/Compressor.h>
 #include <Converters/PixelOperation.h>
@@ -550,9 +551,10 @@ namespace ImageProcessingAtom
         IImageObjectPtr mippedSourceImage(IImageObject::CreateImage(outWidth, outHeight, maxMipCount, srcPixelFormat));
         mippedSourceImage->CopyPropertiesFrom(m_image->Get());
 
-        for (int iSide = 0; iSide < 6; ++iSide)
+        // the mips are filtered in parallel, each one writes its own mip of the faces
+        Utils::ParallelFor(maxMipCount, [&](AZ::u32 iMip)
         {
-            for (int iMip = 0; iMip < (int)maxMipCount; iMip++)
+            for (int iSide = 0; iSide < 6; ++iSide)
             {
                 QRect srcRect;
                 QRect dstRect;
@@ -572,7 +574,7 @@ namespace ImageProcessingAtom
                 MipGenType mipGenType = (iMip == 0 ? MipGenType::point : MipGenType::box);
                 FilterImage(mipGenType, MipGenEvalType::sum, 0, 0, m_image->Get(), 0, mippedSourceImage, iMip, &srcRect, &dstRect);
             }
-        }
+        });
 
         //replace the source cubemap with the mipped version
         delete srcCubemap;
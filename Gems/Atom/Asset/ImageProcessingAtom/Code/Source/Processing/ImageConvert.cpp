@@ -502,10 +502,11 @@ namespace ImageProcessingAtom
         float blurV = 0;
 
         // fill mipmap data for uncompressed output image
-        for (uint32 mip = 0; mip < outImage->GetMipCount(); mip++)
-        {
-            FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
-        }
+        // every mip is filtered from the source image, so the mips are filtered in parallel
+        Utils::ParallelFor(outImage->GetMipCount(), [&](AZ::u32 mip)
+            {
+                FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
+            });
 
         // transfer alpha coverage
         if (m_input->m_textureSetting.m_maintainAlphaCoverage)
@@ -10,6 +10,9 @@
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetHandler.h>
 #include <Atom/Utils/DdsFile.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/function/function_template.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
 #include <Processing/ImageToProcess.h>
@@ -392,6 +395,21 @@ namespace ImageProcessingAtom
                         || alphaContent == EAlphaContent::eAlphaContent_OnlyBlackAndWhite
                         || alphaContent == EAlphaContent::eAlphaContent_Greyscale);
         }
+
+        void ParallelFor(AZ::u32 count, const AZStd::function<void(AZ::u32)>& function)
+        {
+            if (count > 1 && AZ::JobContext::GetGlobalContext())
+            {
+                AZ::parallel_for(AZ::u32(0), count, function);
+            }
+            else
+            {
+                for (AZ::u32 index = 0; index < count; ++index)
+                {
+                    function(index);
+                }
+            }
+        }
     }
 
 } // namespace ImageProcessingAtom
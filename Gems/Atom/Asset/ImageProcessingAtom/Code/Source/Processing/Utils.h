@@ -9,7 +9,10 @@
 #pragma once
 
 #include <Atom/ImageProcessing/ImageObject.h>
+#include <Atom/RHI.Reflect/Format.h>
+#include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/function/function_fwd.h>
 
 namespace ImageProcessingAtom
 {
@@ -28,5 +31,9 @@ namespace ImageProcessingAtom
         bool SaveImageToDdsFile(IImageObjectPtr image, AZStd::string_view filePath);
 
         bool NeedAlphaChannel(EAlphaContent alphaContent);
+
+        //! Calls the function for every index of [0, count) as parallel jobs, or in order on the calling thread when there is
+        //! no job context. The calls must not depend on each other, like the filtering of different mips or image tiles.
+        void ParallelFor(AZ::u32 count, const AZStd::function<void(AZ::u32)>& function);
     }
 }
@@ -5,7 +5,10 @@
 
 #include "CCubeMapProcessor.h"
 
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/std/bind/bind.h>
+#include <AzCore/std/function/function_template.h>
 #include <AzCore/std/string/string.h>
 
 #define CP_PI   3.14159265358979323846f
@@ -1723,11 +1726,31 @@ namespace ImageProcessingAtom
        m_ThreadProgress[0].m_CurrentRow = 0;
        m_ThreadProgress[0].m_CurrentFace = 0;
        
+       //the faces only read the shared source surfaces and lookup tables, so they are filtered as parallel jobs
+       // when a job context is available
+       auto forEachTask = [](int32 a_TaskCount, const AZStd::function<void(int32)>& a_Task)
+       {
+          if (AZ::JobContext::GetGlobalContext())
+          {
+             AZ::parallel_for(0, a_TaskCount, a_Task);
+          }
+          else
+          {
+             for (int32 iTask = 0; iTask < a_TaskCount; iTask++)
+             {
+                a_Task(iTask);
+             }
+          }
+       };
+
        //Filter the top mip level (initial filtering used for diffuse or blurred specular lighting )
-       FilterCubeSurfaces(m_InputSurface[0], m_OutputSurface[0], a_BaseFilterAngle, a_FilterType, a_bUseSolidAngle, 
-            0,  //start at face 0 
-            5,  //end at face 5
-            0); //thread 0 is processing
+       forEachTask(6, [&](int32 iFace)
+       {
+          FilterCubeSurfaces(m_InputSurface[0], m_OutputSurface[0], a_BaseFilterAngle, a_FilterType, a_bUseSolidAngle, 
+               iFace,  //start at face
+               iFace,  //end at the same face
+               0);     //thread 0 is processing
+       });
 
        m_ThreadProgress[0].m_CurrentMipLevel = 1;
        m_ThreadProgress[0].m_CurrentRow = 0;
@@ -1739,6 +1762,21 @@ namespace ImageProcessingAtom
        //Cone angle start (for generating subsequent mip levels)
        coneAngle = a_InitialMipAngle;
 
+       //the GGX mips are all filtered from the input surfaces, so every face of every mip is filtered in parallel
+       if (a_FilterType == CP_FILTER_TYPE_GGX && m_NumMipLevels > 1)
+       {
+          forEachTask((m_NumMipLevels - 1) * 6, [&](int32 iTask)
+          {
+             const int32 iFace = iTask % 6;
+             FilterCubeSurfacesGGX(iTask / 6 + 1,
+               a_SampleCountGGX,
+               iFace,  //start at face
+               iFace,  //end at the same face
+               0       //thread 0 is processing
+               );
+          });
+       }
+
        //generate subsequent mip levels
        for(i=0; i<(m_NumMipLevels-1) && !m_shutdownWorkerThreadSignal; i++)
        {
@@ -1746,16 +1784,8 @@ namespace ImageProcessingAtom
           m_ThreadProgress[0].m_CurrentRow = 0;
           m_ThreadProgress[0].m_CurrentFace = 0;
 
-          if (a_FilterType == CP_FILTER_TYPE_GGX)
-          {
-            FilterCubeSurfacesGGX(i + 1,
-              a_SampleCountGGX,
-              0,  //start at face 0 
-              5,  //end at face 5
-              0   //thread 0 is processing
-              );
-          }
-          else
+          //the GGX mips were filtered above
+          if (a_FilterType != CP_FILTER_TYPE_GGX)
           {
             CImageSurface* srcCubeImage = m_OutputSurface[i];
             float specPow = 1.0f;
@@ -1779,11 +1809,14 @@ namespace ImageProcessingAtom
             PrecomputeFilterLookupTables(a_FilterType, srcCubeImage->m_Width, coneAngle);
 
             //filter cube surfaces
-            FilterCubeSurfaces(srcCubeImage, m_OutputSurface[i+1], coneAngle, a_FilterType, a_bUseSolidAngle,
-              0,  //start at face 0 
-              5,  //end at face 5
-              0,  //thread 0 is processing
-              specPow);
+            forEachTask(6, [&](int32 iFace)
+            {
+              FilterCubeSurfaces(srcCubeImage, m_OutputSurface[i+1], coneAngle, a_FilterType, a_bUseSolidAngle,
+                iFace,  //start at face
+                iFace,  //end at the same face
+                0,      //thread 0 is processing
+                specPow);
+            });
           }
 
           m_ThreadProgress[0].m_CurrentMipLevel = i+2;
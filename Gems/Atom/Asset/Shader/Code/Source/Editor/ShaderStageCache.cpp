@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ShaderStageCache.h"
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        namespace ShaderStageCache
+        {
+            [[maybe_unused]] static constexpr char ShaderStageCacheName[] = "ShaderStageCache";
+            static constexpr uint32_t FileMagic = 0x53535443; // "SSTC"
+
+            namespace
+            {
+                void HashString(Sha1& sha1, AZStd::string_view value)
+                {
+                    // The size is hashed as well, so that the boundaries between the strings are part of the key
+                    const AZ::u64 size = value.size();
+                    sha1.ProcessBytes(&size, sizeof(size));
+                    sha1.ProcessBytes(value.data(), value.size());
+                }
+
+                void HashValue(Sha1& sha1, AZ::u64 value)
+                {
+                    sha1.ProcessBytes(&value, sizeof(value));
+                }
+
+                AZ::IO::Path GetStagePath(const AZStd::string& cacheFolder, const AZStd::string& key)
+                {
+                    // Spread the files over sub folders named after the first two characters, to keep the folders small
+                    AZ::IO::Path stagePath(cacheFolder);
+                    stagePath /= key.substr(0, 2);
+                    stagePath /= key + ".stage";
+                    return stagePath;
+                }
+
+                void WriteValue(AZStd::string& buffer, uint32_t value)
+                {
+                    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+                }
+
+                void WriteBytes(AZStd::string& buffer, const void* data, size_t size)
+                {
+                    WriteValue(buffer, aznumeric_cast<uint32_t>(size));
+                    buffer.append(reinterpret_cast<const char*>(data), size);
+                }
+
+                bool ReadValue(const AZStd::vector<uint8_t>& buffer, size_t& offset, uint32_t& value)
+                {
+                    if (offset + sizeof(value) > buffer.size())
+                    {
+                        return false;
+                    }
+                    memcpy(&value, buffer.data() + offset, sizeof(value));
+                    offset += sizeof(value);
+                    return true;
+                }
+
+                template<typename Container>
+                bool ReadBytes(const AZStd::vector<uint8_t>& buffer, size_t& offset, Container& bytes)
+                {
+                    uint32_t size = 0;
+                    if (!ReadValue(buffer, offset, size) || offset + size > buffer.size())
+                    {
+                        return false;
+                    }
+                    bytes.resize(size);
+                    memcpy(bytes.data(), buffer.data() + offset, size);
+                    offset += size;
+                    return true;
+                }
+            } // namespace
+
+            AZStd::string GetCacheFolder()
+            {
+                auto settingsRegistry = AZ::SettingsRegistry::Get();
+                if (!settingsRegistry)
+                {
+                    return {};
+                }
+
+                AZStd::string cacheFolder;
+                if (settingsRegistry->Get(cacheFolder, CacheFolderRegistryKey))
+                {
+                    return cacheFolder;
+                }
+
+                AZ::IO::FixedMaxPath projectUserPath;
+                if (settingsRegistry->Get(projectUserPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath))
+                {
+                    return (projectUserPath / ShaderStageCacheName).String();
+                }
+                return {};
+            }
+
+            AZStd::string CalculateKey(
+                AZStd::string_view hlslSource,
+                AZStd::string_view entryFunctionName,
+                RHI::ShaderHardwareStage stageType,
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                const AssetBuilderSDK::PlatformInfo& platformInfo,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments)
+            {
+                Sha1 sha1;
+                HashValue(sha1, CacheVersion);
+                HashString(sha1, hlslSource);
+                HashString(sha1, entryFunctionName);
+                HashValue(sha1, static_cast<AZ::u64>(stageType));
+                HashString(sha1, shaderPlatformInterface.GetAPIName().GetStringView());
+                HashValue(sha1, shaderPlatformInterface.GetAPIUniqueIndex());
+                HashString(sha1, platformInfo.m_identifier);
+                HashString(sha1, shaderCompilerArguments.MakeAdditionalDxcCommandLineString());
+                HashString(sha1, shaderCompilerArguments.m_dxcAdditionalFreeArguments);
+                HashValue(sha1, shaderCompilerArguments.m_disableWarnings);
+                HashValue(sha1, shaderCompilerArguments.m_warningAsError);
+                HashValue(sha1, shaderCompilerArguments.m_disableOptimizations);
+                HashValue(sha1, shaderCompilerArguments.m_generateDebugInfo);
+                HashValue(sha1, shaderCompilerArguments.m_optimizationLevel);
+                HashValue(sha1, static_cast<AZ::u64>(shaderCompilerArguments.m_defaultMatrixOrder));
+
+                AZ::u32 digest[5];
+                sha1.GetDigest(digest);
+                return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+            }
+
+            bool Load(const AZStd::string& cacheFolder, const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+            {
+                const AZ::IO::Path stagePath = GetStagePath(cacheFolder, key);
+                if (!AZ::IO::SystemFile::Exists(stagePath.c_str()))
+                {
+                    return false;
+                }
+
+                auto readOutcome = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(stagePath.Native());
+                if (!readOutcome.IsSuccess())
+                {
+                    return false;
+                }
+                const AZStd::vector<uint8_t>& buffer = readOutcome.GetValue();
+
+                size_t offset = 0;
+                uint32_t magic = 0;
+                uint32_t version = 0;
+                uint32_t stageType = 0;
+                uint32_t dynamicBranchCount = 0;
+                RHI::ShaderPlatformInterface::StageDescriptor loadedDescriptor;
+                if (!ReadValue(buffer, offset, magic) || magic != FileMagic ||
+                    !ReadValue(buffer, offset, version) || version != CacheVersion ||
+                    !ReadValue(buffer, offset, stageType) ||
+                    !ReadBytes(buffer, offset, loadedDescriptor.m_entryFunctionName) ||
+                    !ReadBytes(buffer, offset, loadedDescriptor.m_byteCode) ||
+                    !ReadBytes(buffer, offset, loadedDescriptor.m_sourceCode) ||
+                    !ReadValue(buffer, offset, dynamicBranchCount))
+                {
+                    AZ_Warning(ShaderStageCacheName, false, "Ignoring the invalid cached shader stage \"%s\"", stagePath.c_str());
+                    return false;
+                }
+
+                loadedDescriptor.m_stageType = static_cast<RHI::ShaderHardwareStage>(stageType);
+                loadedDescriptor.m_byProducts.m_dynamicBranchCount = dynamicBranchCount;
+                descriptor = AZStd::move(loadedDescriptor);
+                return true;
+            }
+
+            bool Store(const AZStd::string& cacheFolder, const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+            {
+                const AZ::IO::Path stagePath = GetStagePath(cacheFolder, key);
+                const AZ::IO::Path stageFolder = stagePath.ParentPath();
+                if (!AZ::IO::SystemFile::Exists(stageFolder.c_str()) && !AZ::IO::SystemFile::CreateDir(stageFolder.c_str()))
+                {
+                    AZ_Warning(ShaderStageCacheName, false, "Failed to create the shader stage cache folder \"%s\"", stageFolder.c_str());
+                    return false;
+                }
+
+                AZStd::string buffer;
+                WriteValue(buffer, FileMagic);
+                WriteValue(buffer, CacheVersion);
+                WriteValue(buffer, static_cast<uint32_t>(descriptor.m_stageType));
+                WriteBytes(buffer, descriptor.m_entryFunctionName.data(), descriptor.m_entryFunctionName.size());
+                WriteBytes(buffer, descriptor.m_byteCode.data(), descriptor.m_byteCode.size());
+                WriteBytes(buffer, descriptor.m_sourceCode.data(), descriptor.m_sourceCode.size());
+                WriteValue(buffer, descriptor.m_byProducts.m_dynamicBranchCount);
+
+                // Another builder may be storing the same stage at the same time, each one writes its own temporary file
+                AZ::IO::Path temporaryPath = stagePath;
+                temporaryPath.ReplaceExtension(AZ::IO::PathView(
+                    AZStd::string::format(".%s.tmp", AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str())));
+                if (!AZ::Utils::WriteFile(buffer, temporaryPath.Native()).IsSuccess())
+                {
+                    AZ_Warning(ShaderStageCacheName, false, "Failed to write the shader stage cache file \"%s\"", temporaryPath.c_str());
+                    return false;
+                }
+
+                if (!AZ::IO::SystemFile::Rename(temporaryPath.c_str(), stagePath.c_str(), true))
+                {
+                    AZ::IO::SystemFile::Delete(temporaryPath.c_str());
+                    // The stage got stored by another builder in the meantime
+                    return AZ::IO::SystemFile::Exists(stagePath.c_str());
+                }
+                return true;
+            }
+        } // namespace ShaderStageCache
+    } // namespace ShaderBuilder
+} // namespace AZ
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        //! Content addressed cache of the compiled shader stages, shared by all the variants, platforms and the machines
+        //! that point to the same cache folder. Variants whose final HLSL is identical, like the ones with options
+        //! the entry points never read, are only compiled once.
+        //! The key is the hash of everything the output depends on: the HLSL source, the entry point, the stage, the RHI,
+        //! the platform and the compiler arguments. The compiler binaries are not part of it, so the folder should only be
+        //! shared by machines with the same compilers, and CacheVersion bumped whenever they get updated.
+        namespace ShaderStageCache
+        {
+            //! Settings registry key of the cache folder, an empty folder disables the cache.
+            //! It defaults to the ShaderStageCache folder of the project user folder.
+            static constexpr char CacheFolderRegistryKey[] = "/O3DE/Atom/Shaders/Build/StageCacheFolder";
+            static constexpr uint32_t CacheVersion = 1;
+
+            //! Returns the cache folder, empty when the cache is disabled.
+            AZStd::string GetCacheFolder();
+
+            //! Returns the key of a stage compilation, a hexadecimal SHA1 of all its inputs.
+            AZStd::string CalculateKey(
+                AZStd::string_view hlslSource,
+                AZStd::string_view entryFunctionName,
+                RHI::ShaderHardwareStage stageType,
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                const AssetBuilderSDK::PlatformInfo& platformInfo,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments);
+
+            //! Loads the stage compiled with this key, returns false when it isn't in the cache.
+            //! Only the dynamic branch count of the byproducts is cached, the intermediate files are not.
+            bool Load(const AZStd::string& cacheFolder, const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& descriptor);
+
+            //! Stores a compiled stage. The file is written under a temporary name first and renamed, so the builders that
+            //! share the cache never read a partially written stage.
+            bool Store(const AZStd::string& cacheFolder, const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor);
+        } // namespace ShaderStageCache
+    } // namespace ShaderBuilder
+} // namespace AZ
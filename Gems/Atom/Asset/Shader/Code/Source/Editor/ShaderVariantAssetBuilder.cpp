@@ -49,6 +49,7 @@
 
 #include "ShaderAssetBuilder.h"
 #include "ShaderBuilderUtility.h"
+#include "ShaderStageCache.h"
 #include "SrgLayoutUtility.h"
 #include "AzslData.h"
 #include "AzslCompiler.h"
@@ -1047,14 +1048,15 @@ namespace AZ
                     "#define %s_OPTION_DEF %s\n", optionCache.m_optionName.GetCStr(), optionCache.m_valueName.GetCStr());
             }
 
+            // Prepend any shader code prefix that we should apply to this variant
+            AZStd::string variantShaderSourceString(hlslCodeToPrependForVariant);
+            variantShaderSourceString += creationContext.m_hlslSourceContent;
+
             AZStd::string variantShaderSourcePath;
             // Check if we need to prepend any code prefix
             if (!hlslCodeToPrependForVariant.empty())
             {
-                // Prepend any shader code prefix that we should apply to this variant
-                // and save it back to a file.
-                AZStd::string variantShaderSourceString(hlslCodeToPrependForVariant);
-                variantShaderSourceString += creationContext.m_hlslSourceContent;
+                // Save the variant source back to a file.
 
                 AZStd::string shaderAssetName = AZStd::string::format(
                     "%s_%s_%u.hlsl", creationContext.m_shaderStemNamePrefix.c_str(),
@@ -1088,6 +1090,10 @@ namespace AZ
                 shaderOptions.IsFullySpecified());
             variantCreator.SetBuildTimestamp(creationContext.m_assetBuildTimestamp);
 
+            // The intermediate files written with the debug info are not cached, so those builds always compile
+            const AZStd::string stageCacheFolder =
+                creationContext.m_shaderCompilerArguments.m_generateDebugInfo ? AZStd::string() : ShaderStageCache::GetCacheFolder();
+
             const AZStd::unordered_map<AZStd::string, RPI::ShaderStageType>& shaderEntryPoints = creationContext.m_shaderEntryPoints;
             for (const auto& shaderEntryPoint : shaderEntryPoints)
             {
@@ -1100,14 +1106,37 @@ namespace AZ
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
                 // Compile HLSL to the platform specific shader.
+                // Variants whose final source is identical share the compiled stage through the cache.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
-                    creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
-                    creationContext.m_tempDirPath, descriptor, creationContext.m_shaderCompilerArguments);
+                AZStd::string stageCacheKey;
+                bool shaderWasCached = false;
+                if (!stageCacheFolder.empty())
+                {
+                    stageCacheKey = ShaderStageCache::CalculateKey(
+                        variantShaderSourceString, shaderEntryName, assetBuilderShaderType, creationContext.m_shaderPlatformInterface,
+                        creationContext.m_platformInfo, creationContext.m_shaderCompilerArguments);
+                    shaderWasCached = ShaderStageCache::Load(stageCacheFolder, stageCacheKey, descriptor);
+                }
 
-                if (!shaderWasCompiled)
+                if (shaderWasCached)
+                {
+                    AZ_TracePrintf(ShaderVariantAssetBuilderName, "Reusing the cached shader function %s", stageCacheKey.c_str());
+                }
+                else
                 {
-                    return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
+                        creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_tempDirPath, descriptor, creationContext.m_shaderCompilerArguments);
+
+                    if (!shaderWasCompiled)
+                    {
+                        return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    }
+
+                    if (!stageCacheFolder.empty())
+                    {
+                        ShaderStageCache::Store(stageCacheFolder, stageCacheKey, descriptor);
+                    }
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
                 outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
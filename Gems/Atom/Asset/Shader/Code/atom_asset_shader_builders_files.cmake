@@ -23,6 +23,8 @@ set(FILES
     Source/Editor/ShaderBuilderUtility.cpp
     Source/Editor/ShaderBuilderUtility.h
     Source/Editor/ShaderPlatformInterfaceRequest.h
+    Source/Editor/ShaderStageCache.cpp
+    Source/Editor/ShaderStageCache.h
     Source/Editor/AzslCompiler.cpp
     Source/Editor/AzslCompiler.h
     Source/Editor/ShaderVariantAssetBuilder.cpp
@@ -0,0 +1,15 @@
+{
+    "Source": "ImageMipFeedback.azsl",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
@@ -0,0 +1,15 @@
+{
+    "Source": "MeshGpuCulling.azsl",
+
+    "ProgramSettings":
+    {
+      "EntryPoints":
+      [
+        {
+          "name": "MainCS",
+          "type": "Compute"
+        }
+      ]
+    }
+
+}
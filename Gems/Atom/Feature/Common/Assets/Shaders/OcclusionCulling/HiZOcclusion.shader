@@ -0,0 +1,15 @@
+{
+    "Source": "HiZOcclusion.azsl",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
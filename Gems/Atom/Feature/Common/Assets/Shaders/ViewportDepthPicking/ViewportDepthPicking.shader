@@ -0,0 +1,15 @@
+{
+    "Source": "ViewportDepthPicking.azsl",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
@@ -147,6 +147,7 @@ set(FILES
     Passes/DownsampleLuminanceMinAvgMaxCS.pass
     Passes/DownsampleMinAvgMaxCS.pass
     Passes/DownsampleMipChain.pass
+    Passes/DynamicResolutionUpscale.pass
     Passes/EnvironmentCubeMapDepthMSAA.pass
     Passes/EnvironmentCubeMapForwardMSAA.pass
     Passes/EnvironmentCubeMapForwardSubsurfaceMSAA.pass
@@ -164,6 +165,8 @@ set(FILES
     Passes/FullscreenCopy.pass
     Passes/FullscreenOutputOnly.pass
     Passes/HDRColorGrading.pass
+    Passes/HiZOcclusion.pass
+    Passes/ImageMipFeedback.pass
     Passes/ImGui.pass
     Passes/KawaseShadowBlur.pass
     Passes/LightAdaptationParent.pass
@@ -181,6 +184,9 @@ set(FILES
     Passes/LutGeneration.pass
     Passes/MainPipeline.pass
     Passes/MainPipelineRenderToTexture.pass
+    Passes/MeshGpuCulling.pass
+    Passes/MeshGpuCullingTransition.pass
+    Passes/MeshletCulling.pass
     Passes/MeshMotionVector.pass
     Passes/ModulateTexture.pass
     Passes/MorphTarget.pass
@@ -236,14 +242,17 @@ set(FILES
     Passes/TransparentParent.pass
     Passes/UI.pass
     Passes/UIParent.pass
+    Passes/ViewportDepthPicking.pass
     Scripts/material_find_overrides_demo.lua
     Scripts/material_property_overrides_demo.lua
     ShaderLib/3rdParty/Features/PostProcessing/KelvinToRgb.azsli
     ShaderLib/3rdParty/Features/PostProcessing/PSstyleColorBlends_NonSeparable.azsli
     ShaderLib/3rdParty/Features/PostProcessing/PSstyleColorBlends_Separable.azsli
+    ShaderLib/Atom/Features/BindlessImages.azsli
     ShaderLib/Atom/Features/BlendUtility.azsli
     ShaderLib/Atom/Features/IndirectRendering.azsli
     ShaderLib/Atom/Features/MatrixUtility.azsli
+    ShaderLib/Atom/Features/MeshInstancing.azsli
     ShaderLib/Atom/Features/ParallaxMapping.azsli
     ShaderLib/Atom/Features/ShaderQualityOptions.azsli
     ShaderLib/Atom/Features/SphericalHarmonicsUtility.azsli
@@ -378,6 +387,8 @@ set(FILES
     Shaders/DiffuseGlobalIllumination/DiffuseProbeGridDownsample_nomsaa.azsl
     Shaders/ImGui/ImGui.azsl
     Shaders/ImGui/ImGui.shader
+    Shaders/ImageStreaming/ImageMipFeedback.azsl
+    Shaders/ImageStreaming/ImageMipFeedback.shader
     Shaders/LightCulling/LightCulling.azsl
     Shaders/LightCulling/LightCulling.shader
     Shaders/LightCulling/LightCullingHeatmap.azsl
@@ -386,6 +397,11 @@ set(FILES
     Shaders/LightCulling/LightCullingRemap.shader
     Shaders/LightCulling/LightCullingTilePrepare.azsl
     Shaders/LightCulling/LightCullingTilePrepare.shader
+    Shaders/MeshGpuCulling/MeshGpuCulling.azsl
+    Shaders/MeshGpuCulling/MeshGpuCulling.shader
+    Shaders/MeshGpuCulling/MeshGpuCullingCommon.azsli
+    Shaders/MeshGpuCulling/MeshletCulling.azsl
+    Shaders/MeshGpuCulling/MeshletCulling.shader
     Shaders/MorphTargets/MorphTargetCS.azsl
     Shaders/MorphTargets/MorphTargetCS.shader
     Shaders/MorphTargets/MorphTargetSRG.azsli
@@ -396,6 +412,8 @@ set(FILES
     Shaders/MotionVector/MeshMotionVectorCommon.azsli
     Shaders/MotionVector/MeshMotionVectorSkin.azsl
     Shaders/MotionVector/MeshMotionVectorSkin.shader
+    Shaders/OcclusionCulling/HiZOcclusion.azsl
+    Shaders/OcclusionCulling/HiZOcclusion.shader
     Shaders/PostProcessing/AcesOutputTransformLut.azsl
     Shaders/PostProcessing/AcesOutputTransformLut.shader
     Shaders/PostProcessing/ApplyShaperLookupTable.azsl
@@ -546,4 +564,6 @@ set(FILES
     Shaders/SkyBox/SkyBox.shader
     Shaders/SkyBox/SkyBox_TwoOutputs.azsl
     Shaders/SkyBox/SkyBox_TwoOutputs.shader
+    Shaders/ViewportDepthPicking/ViewportDepthPicking.azsl
+    Shaders/ViewportDepthPicking/ViewportDepthPicking.shader
 ) 
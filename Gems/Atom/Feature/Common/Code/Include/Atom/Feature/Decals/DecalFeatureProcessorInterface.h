@@ -39,9 +39,14 @@ namespace AZ
             // Decals with a larger sort key appear over top of smaller sort keys.
             uint8_t m_sortKey = 0;
             uint32_t m_textureArrayIndex = UnusedIndex;
+            // Index of the base color map in its texture array, or in the bindless image array for the bindless decals.
             uint32_t m_textureIndex = UnusedIndex;
+            // Index of the normal map in the bindless image array, only used by the bindless decals.
+            uint32_t m_normalMapTextureIndex = UnusedIndex;
 
             static constexpr uint32_t UnusedIndex = std::numeric_limits< uint32_t>::max();
+            // Texture array index of the decals sampling their maps from the bindless image array of the SceneSrg.
+            static constexpr uint32_t BindlessTextureArrayIndex = UnusedIndex - 1;
         };
 
         //! DecalFeatureProcessorInterface provides an interface to acquire, release, and update a decal. This is necessary for code outside of
@@ -130,6 +130,9 @@ namespace AZ
             virtual void SetVisualizationShowInactiveProbes(const DiffuseProbeGridHandle& probeGrid, bool visualizationShowInactiveProbes) = 0;
             virtual void SetVisualizationSphereRadius(const DiffuseProbeGridHandle& probeGrid, float visualizationSphereRadius) = 0;
 
+            // sets the minimum number of frames between two updates of the probes of a real-time grid, 1 updates it every frame
+            virtual void SetUpdateInterval(const DiffuseProbeGridHandle& probeGrid, uint32_t updateInterval) = 0;
+
             virtual void BakeTextures(
                 const DiffuseProbeGridHandle& probeGrid,
                 DiffuseProbeGridBakeTexturesCallback callback,
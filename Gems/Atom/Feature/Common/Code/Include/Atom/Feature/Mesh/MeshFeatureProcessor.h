@@ -16,6 +16,8 @@
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
+#include <Mesh/MeshGpuCulling.h>
+#include <Mesh/MeshInstanceManager.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
 #include <AzCore/Console/Console.h>
@@ -34,6 +36,7 @@ namespace AZ
         {
             friend class MeshFeatureProcessor;
             friend class MeshLoader;
+            friend class MeshInstanceManager;
 
         public:
             const Data::Instance<RPI::Model>& GetModel() { return m_model; }
@@ -74,6 +77,7 @@ namespace AZ
             void DeInit();
             void Init(Data::Instance<RPI::Model> model);
             void BuildDrawPacketList(size_t modelLodIndex);
+            void ReleaseGpuCullingSlots(size_t modelLodIndex);
             void SetRayTracingData();
             void RemoveRayTracingData();
             void SetSortKey(RHI::DrawItemSortKey sortKey);
@@ -91,6 +95,19 @@ namespace AZ
 
             AZStd::fixed_vector<DrawPacketList, RPI::ModelLodAsset::LodCountMax> m_drawPacketListsByLod;
             RPI::Cullable m_cullable;
+
+            //! GPU culling slots of the draw packets of each lod, only populated while mesh draws are culled on the GPU
+            AZStd::fixed_vector<AZStd::vector<uint32_t>, RPI::ModelLodAsset::LodCountMax> m_gpuCullingSlotsByLod;
+
+            //! The draw packet index and the GPU culling slot of the draw packets of each lod that are also culled per meshlet
+            AZStd::fixed_vector<AZStd::vector<AZStd::pair<size_t, uint32_t>>, RPI::ModelLodAsset::LodCountMax> m_meshletCullingSlotsByLod;
+            MeshGpuCulling* m_gpuCulling = nullptr;
+
+            //! The group drawing this mesh when it is merged with identical meshes into instanced draws, in which case the draw
+            //! packets and the cullable of this mesh aren't used
+            MeshInstanceManager* m_instanceManager = nullptr;
+            MeshInstanceGroup* m_instanceGroup = nullptr;
+            uint32_t m_instanceIndex = 0;
             MaterialAssignmentMap m_materialAssignments;
 
             MeshHandleDescriptor m_descriptor;
@@ -99,6 +116,13 @@ namespace AZ
             //! A reference to the original model asset in case it got cloned before creating the model instance.
             Data::Asset<RPI::ModelAsset> m_originalModelAsset;
 
+            //! Rebuilds the draws of the mesh when lods of a model streaming its lods are streamed in or evicted
+            RPI::Model::LodsChangedEvent::Handler m_lodsChangedHandler{ [this]()
+                                                                        {
+                                                                            RemoveRayTracingData();
+                                                                            Init(m_model);
+                                                                        } };
+
             //! List of object SRGs used by meshes in this model 
             AZStd::vector<Data::Instance<RPI::ShaderResourceGroup>> m_objectSrgList;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
@@ -115,6 +139,8 @@ namespace AZ
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_visible = true;
             bool m_hasForwardPassIblSpecularMaterial = false;
+            bool m_instancingUpdateQueued = false;
+            bool m_instanceBoundsChanged = false;
         };
 
         //! This feature processor handles static and dynamic non-skinned meshes.
@@ -164,6 +190,8 @@ namespace AZ
                 const AZ::Vector3& nonUniformScale = AZ::Vector3::CreateOne()) override;
             Transform GetTransform(const MeshHandle& meshHandle) override;
             Vector3 GetNonUniformScale(const MeshHandle& meshHandle) override;
+            void SetInstanceParameter(const MeshHandle& meshHandle, uint32_t parameterIndex, const Vector4& value) override;
+            Vector4 GetInstanceParameter(const MeshHandle& meshHandle, uint32_t parameterIndex) const override;
 
             void SetLocalAabb(const MeshHandle& meshHandle, const AZ::Aabb& localAabb) override;
             AZ::Aabb GetLocalAabb(const MeshHandle& meshHandle) const override;
@@ -182,6 +210,9 @@ namespace AZ
 
             // called when reflection probes are modified in the editor so that meshes can re-evaluate their probes
             void UpdateMeshReflectionProbes();
+
+            //! Returns the GPU culling of the mesh draws of the scene
+            MeshGpuCulling* GetGpuCulling();
         private:
             void ForceRebuildDrawPackets(const AZ::ConsoleCommandContainer& arguments);
             AZ_CONSOLEFUNC(MeshFeatureProcessor,
@@ -200,6 +231,8 @@ namespace AZ
             StableDynamicArray<ModelDataInstance> m_modelData;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
+            MeshGpuCulling m_gpuCulling;
+            MeshInstanceManager m_instanceManager;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             bool m_forceRebuildDrawPackets = false;
         };
@@ -89,6 +89,11 @@ namespace AZ
             virtual Transform GetTransform(const MeshHandle& meshHandle) = 0;
             //! Gets the non-uniform scale for a given mesh handle.
             virtual Vector3 GetNonUniformScale(const MeshHandle& meshHandle) = 0;
+            //! Sets a per-instance material parameter for a given mesh handle, read by the shaders from the SceneSrg with the object id.
+            //! Prefer it over unique material instances for values animated on many meshes sharing the same material.
+            virtual void SetInstanceParameter(const MeshHandle& meshHandle, uint32_t parameterIndex, const Vector4& value) = 0;
+            //! Gets a per-instance material parameter for a given mesh handle.
+            virtual Vector4 GetInstanceParameter(const MeshHandle& meshHandle, uint32_t parameterIndex) const = 0;
             //! Sets the local space bbox for a given mesh handle. You don't need to call this for static models, only skinned/animated models
             virtual void SetLocalAabb(const MeshHandle& meshHandle, const AZ::Aabb& localAabb) = 0;
             //! Gets the local space bbox for a given mesh handle. Unless SetLocalAabb has been called before, this will be the bbox of the model asset
@@ -52,6 +52,10 @@ namespace AZ
             virtual void ShowProbeVisualization(const ReflectionProbeHandle& probe, bool showVisualization) = 0;
             virtual void SetRenderExposure(const ReflectionProbeHandle& probe, float renderExposure) = 0;
             virtual void SetBakeExposure(const ReflectionProbeHandle& probe, float bakeExposure) = 0;
+
+            // queues a runtime refresh of the probe cubemap, e.g. after a time of day change
+            // the queued probes closest to the camera are refreshed first, and the probe keeps its current cubemap until the refresh completes
+            virtual void RefreshProbe(const ReflectionProbeHandle& probe) = 0;
         };
     } // namespace Render
 } // namespace AZ
@@ -29,6 +29,16 @@ namespace AZ
     {
         class SkinnedMeshOutputStreamAllocation;
 
+        //! Usage of the memory pool shared by all the skinned mesh outputs
+        struct SkinnedMeshOutputStreamMemoryStats
+        {
+            size_t m_capacityInBytes = 0;
+            size_t m_allocatedByteCount = 0;
+            size_t m_allocationCount = 0;
+            //! 0 when all the free memory is a single block, close to 1 when it is split into many small blocks
+            float m_fragmentation = 0.0f;
+        };
+
         //! A class for allocating memory for skinning buffers
         class SkinnedMeshOutputStreamManagerInterface
         {
@@ -69,6 +79,9 @@ namespace AZ
             //! without triggering new events indicating that new memory has been freed
             virtual void DeAllocateNoSignal(RHI::VirtualAddress allocation) = 0;
 
+            //! Returns the usage and fragmentation of the memory pool
+            virtual SkinnedMeshOutputStreamMemoryStats GetMemoryStats() = 0;
+
             // Note that you have to delete these for safety reasons, you will trip a static_assert if you do not
             AZ_DISABLE_COPY_MOVE(SkinnedMeshOutputStreamManagerInterface);
         };
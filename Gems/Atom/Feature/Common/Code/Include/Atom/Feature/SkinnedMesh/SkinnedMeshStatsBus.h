@@ -23,6 +23,14 @@ namespace AZ
             size_t writableBufferViewCount = 0;
             size_t boneCount = 0;
             size_t vertexCount = 0;
+            //! Render proxies skinned during the last frame, and those reusing the skinned vertices of a previous frame
+            //! because their update rate is reduced, see r_skinningUpdateRateReduction
+            size_t updatedRenderProxyCount = 0;
+            size_t skippedRenderProxyCount = 0;
+            //! Usage of the memory pool shared by the skinned mesh outputs of all scenes
+            size_t outputStreamAllocatedByteCount = 0;
+            size_t outputStreamCapacityInBytes = 0;
+            float outputStreamFragmentation = 0.0f;
         };
 
         //! Ebus for getting stats about the usage of skinned meshes in the current scene
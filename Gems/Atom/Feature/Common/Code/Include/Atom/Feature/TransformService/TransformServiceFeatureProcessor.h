@@ -49,6 +49,8 @@ namespace AZ
                 const AZ::Vector3& nonUniformScale = AZ::Vector3::CreateOne()) override;
             AZ::Transform GetTransformForId(ObjectId id) const override;
             AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const override;
+            void SetInstanceParameterForId(ObjectId id, uint32_t parameterIndex, const AZ::Vector4& value) override;
+            AZ::Vector4 GetInstanceParameterForId(ObjectId id, uint32_t parameterIndex) const override;
 
         private:
 
@@ -59,6 +61,12 @@ namespace AZ
                 uint32_t m_nextFreeSlot;
             };
 
+            // Per-object instance parameters, matching SceneSrg::ObjectInstanceParameters.
+            struct InstanceParameters
+            {
+                float m_parameters[InstanceParameterCount][4] = {};
+            };
+
             // Flag value for when the buffers have no empty spaces.
             static const uint32_t NoAvailableTransformIndices = std::numeric_limits<uint32_t>::max();
 
@@ -66,7 +74,18 @@ namespace AZ
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if the buffers were created or resized, which loses their content
+            bool PrepareBuffers();
+
+            // Prepares the GPU buffer of the instance parameters like PrepareBuffers()
+            bool PrepareInstanceParametersBuffer();
+
+            // Range of transform indices [first, second) uploaded to the buffers
+            using UploadRange = AZStd::pair<uint32_t, uint32_t>;
+
+            // Uploads the ranges of the elements to the buffer, or all of them when the ranges are empty
+            template<typename ElementType>
+            static void UploadElements(RPI::Buffer& buffer, const AZStd::vector<ElementType>& elements, const AZStd::vector<UploadRange>& ranges);
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -74,6 +93,7 @@ namespace AZ
             RHI::ShaderInputNameIndex m_objectToWorldBufferIndex = "m_objectToWorldBuffer";
             RHI::ShaderInputNameIndex m_objectToWorldInverseTransposeBufferIndex = "m_objectToWorldInverseTransposeBuffer";
             RHI::ShaderInputNameIndex m_objectToWorldHistoryBufferIndex = "m_objectToWorldHistoryBuffer";
+            RHI::ShaderInputNameIndex m_objectInstanceParametersBufferIndex = "m_objectInstanceParametersBuffer";
 
             // Stores transforms that are uploaded to a GPU buffer. Used slots have float12(matrix3x4) values, empty slots
             // have a uint32_t that points to the next empty slot like a linked list. m_firstAvailableMeshTransformIndex stores the first
@@ -86,13 +106,26 @@ namespace AZ
             static const size_t TransformValueSize = sizeof(decltype(m_objectToWorldTransforms)::value_type);
             static const size_t NormalValueSize = sizeof(decltype(m_objectToWorldInverseTransposeTransforms)::value_type);
 
+            // Instance parameters of the objects, indexed like the transforms
+            AZStd::vector<InstanceParameters> m_objectInstanceParameters;
+
             Data::Instance<RPI::Buffer> m_objectToWorldBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
+            Data::Instance<RPI::Buffer> m_objectInstanceParametersBuffer;
 
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
             bool m_deviceBufferNeedsUpdate = false;
             bool m_historyBufferNeedsUpdate = false;
+            bool m_instanceParametersBufferNeedsUpdate = false;
+
+            // Indices of the transforms set since the last upload, and of the ones set before the last upload,
+            // whose history still holds the transform of two frames ago (see r_transformServiceDeltaUploads)
+            AZStd::vector<uint32_t> m_dirtyTransformIndices;
+            AZStd::vector<uint32_t> m_previousDirtyTransformIndices;
+
+            // Indices of the instance parameters set since the last upload
+            AZStd::vector<uint32_t> m_dirtyInstanceParameterIndices;
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
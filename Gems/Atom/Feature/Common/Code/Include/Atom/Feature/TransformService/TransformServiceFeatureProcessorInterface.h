@@ -10,6 +10,7 @@
 
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
 
 namespace AZ
@@ -38,6 +39,17 @@ namespace AZ
             virtual AZ::Transform GetTransformForId(ObjectId) const = 0;
             //! Gets the non-uniform scale for a given id. Id must be one reserved earlier.
             virtual AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const = 0;
+
+            //! Number of per-object instance parameters, see SetInstanceParameterForId().
+            static constexpr uint32_t InstanceParameterCount = 4;
+
+            //! Sets a per-object instance parameter for a given id. Id must be one reserved earlier.
+            //! The parameters are read by shaders from the SceneSrg with GetObjectInstanceParameter(objectId, parameterIndex), so materials
+            //! shared by many objects can vary per object (dissolve, hit flashes...) without unique material instances or SRG compiles.
+            //! The parameters of a newly reserved id are zero.
+            virtual void SetInstanceParameterForId(ObjectId id, uint32_t parameterIndex, const AZ::Vector4& value) = 0;
+            //! Gets a per-object instance parameter for a given id. Id must be one reserved earlier.
+            virtual AZ::Vector4 GetInstanceParameterForId(ObjectId id, uint32_t parameterIndex) const = 0;
         };
     }
 }
@@ -29,6 +29,8 @@ namespace UnitTest
         MOCK_METHOD2(SetMaterialAssignmentMap, void(const MeshHandle&, const AZ::Render::MaterialAssignmentMap&));
         MOCK_METHOD1(GetTransform, AZ::Transform(const MeshHandle&));
         MOCK_METHOD1(GetNonUniformScale, AZ::Vector3(const MeshHandle&));
+        MOCK_METHOD3(SetInstanceParameter, void(const MeshHandle&, uint32_t, const AZ::Vector4&));
+        MOCK_CONST_METHOD2(GetInstanceParameter, AZ::Vector4(const MeshHandle&, uint32_t));
         MOCK_METHOD2(SetLocalAabb, void(const MeshHandle&, const AZ::Aabb&));
         MOCK_CONST_METHOD1(GetLocalAabb, AZ::Aabb(const MeshHandle&));
         MOCK_METHOD2(SetSortKey, void (const MeshHandle&, AZ::RHI::DrawItemSortKey));
@@ -22,6 +22,12 @@
 
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <Mesh/MeshGpuCullingPass.h>
+#include <Mesh/MeshGpuCullingTransitionPass.h>
+#include <Mesh/MeshletCullingPass.h>
+#include <OcclusionCulling/HiZOcclusionPass.h>
+#include <ViewportDepthPicking/ViewportDepthPickingPass.h>
+#include <ImageStreaming/ImageMipFeedbackPass.h>
 #include <Atom/Feature/LookupTable/LookupTableAsset.h>
 #include <ReflectionProbe/ReflectionProbeFeatureProcessor.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
@@ -109,6 +115,7 @@
 #include <ReflectionScreenSpace/ReflectionCopyFrameBufferPass.h>
 #include <OcclusionCullingPlane/OcclusionCullingPlaneFeatureProcessor.h>
 #include <Mesh/ModelReloaderSystem.h>
+#include <ViewportDepthPicking/ViewportDepthPickingSystem.h>
 
 namespace AZ
 {
@@ -274,6 +281,14 @@ namespace AZ
             passSystem->AddPassCreator(Name("BloomBlurPass"), &BloomBlurPass::Create);
             passSystem->AddPassCreator(Name("BloomCompositePass"), &BloomCompositePass::Create);
 
+            // Add mesh GPU culling passes
+            passSystem->AddPassCreator(Name("MeshGpuCullingPass"), &Render::MeshGpuCullingPass::Create);
+            passSystem->AddPassCreator(Name("MeshGpuCullingTransitionPass"), &Render::MeshGpuCullingTransitionPass::Create);
+            passSystem->AddPassCreator(Name("MeshletCullingPass"), &Render::MeshletCullingPass::Create);
+            passSystem->AddPassCreator(Name("HiZOcclusionPass"), &Render::HiZOcclusionPass::Create);
+            passSystem->AddPassCreator(Name("ViewportDepthPickingPass"), &Render::ViewportDepthPickingPass::Create);
+            passSystem->AddPassCreator(Name("ImageMipFeedbackPass"), &Render::ImageMipFeedbackPass::Create);
+
             // Add Diffuse Global Illumination passes
             passSystem->AddPassCreator(Name("RayTracingAccelerationStructurePass"), &Render::RayTracingAccelerationStructurePass::Create);
             passSystem->AddPassCreator(Name("DiffuseProbeGridPreparePass"), &Render::DiffuseProbeGridPreparePass::Create);
@@ -311,10 +326,12 @@ namespace AZ
             RPI::PassSystemInterface::Get()->ConnectEvent(m_loadTemplatesHandler);
             
             m_modelReloaderSystem = AZStd::make_unique<ModelReloaderSystem>();
+            m_viewportDepthPickingSystem = AZStd::make_unique<ViewportDepthPickingSystem>();
         }
 
         void CommonSystemComponent::Deactivate()
         {
+            m_viewportDepthPickingSystem.reset();
             m_modelReloaderSystem.reset();
             m_loadTemplatesHandler.Disconnect();
             AZ::RPI::FeatureProcessorFactory::Get()->UnregisterFeatureProcessor<RayTracingFeatureProcessor>();
@@ -17,6 +17,7 @@ namespace AZ
     namespace Render
     {
         class ModelReloaderSystem;
+        class ViewportDepthPickingSystem;
 
         class CommonSystemComponent
             : public AZ::Component
@@ -46,6 +47,7 @@ namespace AZ
             RPI::PassSystemInterface::OnReadyLoadTemplatesEvent::Handler m_loadTemplatesHandler;
 
             AZStd::unique_ptr<ModelReloaderSystem> m_modelReloaderSystem;
+            AZStd::unique_ptr<ViewportDepthPickingSystem> m_viewportDepthPickingSystem;
         };
     } // namespace Render
 } // namespace AZ
@@ -155,9 +155,64 @@ namespace AZ
             }
 
             UpdateShadowmapImageSize();
+
+            m_cachingEnabled = ShadowmapCache::IsCachingEnabled();
+            if (m_cachingEnabled)
+            {
+                m_cache.ImportShadowmapImage(*m_ownedAttachments.front());
+                for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+                {
+                    static_cast<ShadowmapPass*>(child.get())->InvalidateCache();
+                }
+            }
+            else
+            {
+                m_cache.Reset();
+            }
+
             Base::BuildInternal();
         }
 
+        void CascadedShadowmapsPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            if (m_cachingEnabled != ShadowmapCache::IsCachingEnabled())
+            {
+                // Switches between a transient and a persistent shadowmap image.
+                QueueForBuildAndInitialization();
+            }
+
+            UpdateCachedChildren();
+            Base::FrameBeginInternal(params);
+        }
+
+        void CascadedShadowmapsPass::UpdateCachedChildren()
+        {
+            const auto& children = GetChildren();
+            AZStd::vector<ShadowmapPass*> passes;
+            AZStd::vector<uint16_t> arraySlices;
+            passes.reserve(children.size());
+            arraySlices.reserve(children.size());
+            for (const RPI::Ptr<RPI::Pass>& child : children)
+            {
+                passes.push_back(static_cast<ShadowmapPass*>(child.get()));
+                arraySlices.push_back(aznumeric_cast<uint16_t>(arraySlices.size()));
+            }
+
+            const bool useCache = m_cachingEnabled && ShadowmapCache::IsCachingEnabled() &&
+                m_atlas.GetBaseShadowmapSize() != ShadowmapSize::None && children.size() <= m_atlas.GetArraySliceCount();
+            if (!useCache)
+            {
+                for (ShadowmapPass* pass : passes)
+                {
+                    pass->SetRenderingSkipped(false);
+                }
+                return;
+            }
+
+            // Each cascade has its own array slice, and a stale cascade is always rendered since the cascades follow the camera.
+            m_cache.UpdateShadowmapPasses(passes, arraySlices, m_atlas.GetArraySliceCount(), 0);
+        }
+
         void CascadedShadowmapsPass::GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const
         {
             for (size_t childIndex = 0; childIndex < m_numberOfCascades; ++childIndex)
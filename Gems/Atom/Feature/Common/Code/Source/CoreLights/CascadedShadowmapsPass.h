@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <CoreLights/ShadowmapAtlas.h>
+#include <CoreLights/ShadowmapCache.h>
 #include <CoreLights/ShadowmapPass.h>
 
 namespace AZ
@@ -50,6 +51,7 @@ namespace AZ
 
             // RPI::Pass overrides...
             void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
             void GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const override;
             void GetViewDrawListInfo(RHI::DrawListMask& outDrawListMask, RPI::PassesByDrawList& outPassesByDrawList, const RPI::PipelineViewTag& viewTag) const override;
 
@@ -60,6 +62,9 @@ namespace AZ
             void SetCascadesCount(uint16_t cascadesCount);
             void UpdateShadowmapImageSize();
 
+            // Skips the cascades whose shadowmaps are still cached
+            void UpdateCachedChildren();
+
             const Name m_slotName{ "Shadowmap" };
             Name m_drawListTagName;
             RHI::DrawListTag m_drawListTag;
@@ -76,10 +81,12 @@ namespace AZ
             uint16_t m_numberOfCascades = 0;
 
             ShadowmapAtlas m_atlas;
+            ShadowmapCache m_cache;
 
             ShadowmapSize m_shadowmapSize = ShadowmapSize::None;
             uint32_t m_arraySize = 1;
             bool m_updateChildren = true;
+            bool m_cachingEnabled = false;
         };
     } // namespace Render
 } // namespace AZ
@@ -18,6 +18,8 @@ namespace AZ
             const uint32_t TileDimX = 16;
             const uint32_t TileDimY = 16;
             const uint32_t NumBinsPerTile = 32;
+            // Froxel slices of each tile with clustered light culling, should match NVLC_MAX_CLUSTER_SLICES in NVLC.azsli
+            const uint32_t NumClusterSlices = 16;
         }
     }
 }
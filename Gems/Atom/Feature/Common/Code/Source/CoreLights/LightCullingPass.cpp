@@ -38,11 +38,15 @@
 #include <Atom/RPI.Public/Image/AttachmentImagePool.h>
 #include <Atom/RHI/ImagePool.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_lightCullingClusters, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to split the light lists of each tile into froxels, exponential slices of the view depth");
+
         enum PlaneType
         {
             PlaneLeft,
@@ -104,6 +108,42 @@ namespace AZ
             return AZStd::array<float, 4>{rightX - leftX, bottomY - topY, leftX, topY};
         }
 
+        bool LightCullingPass::IsClusteringEnabled()
+        {
+            return r_lightCullingClusters;
+        }
+
+        AZStd::array<float, 2> LightCullingPass::ComputeClusterSliceScaleBias(const AZ::Matrix4x4& viewToClip)
+        {
+            // Used when the planes can't be found from the projection, i.e. orthographic projections
+            const float DefaultNear = 0.1f;
+            const float DefaultFar = 1000.0f;
+            // Keeps the slices usable with an infinite far plane
+            const float MaxDepthRange = 100000.0f;
+
+            float nearDistance = DefaultNear;
+            float farDistance = DefaultFar;
+
+            // With a perspective projection the depth at a view distance d is m23 / d - m22, which gives the distances of the
+            // planes at depth 0 and 1. An infinite far plane divides by zero and is clamped to the max range.
+            const float m22 = viewToClip.GetElement(2, 2);
+            const float m23 = viewToClip.GetElement(2, 3);
+            if (viewToClip.GetElement(3, 2) != 0.0f && m23 != 0.0f)
+            {
+                const auto planeDistance = [m23](float divisor)
+                {
+                    return AZ::GetAbs(divisor) > FLT_MIN ? AZ::GetAbs(m23 / divisor) : FLT_MAX;
+                };
+                const float distance0 = planeDistance(m22);
+                const float distance1 = planeDistance(1.0f + m22);
+                nearDistance = AZStd::max(AZStd::min(distance0, distance1), FLT_MIN);
+                farDistance = AZStd::min(AZStd::max(distance0, distance1), nearDistance * MaxDepthRange);
+            }
+
+            const float scale = float(LightCulling::NumClusterSlices) / AZStd::max(log2f(farDistance / nearDistance), FLT_EPSILON);
+            return AZStd::array<float, 2>{ scale, -log2f(nearDistance) * scale };
+        }
+
         RPI::Ptr<LightCullingPass> LightCullingPass::Create(const RPI::PassDescriptor& descriptor)
         {
             RPI::Ptr<LightCullingPass> pass = aznew LightCullingPass(descriptor);
@@ -210,7 +250,9 @@ namespace AZ
                 AZStd::array<float, 2> m_gridPixel;
                 AZStd::array<float, 2> m_gridHalfPixel;
                 uint32_t             m_gridWidth;
-                uint32_t             m_padding[3];
+                float                m_clusterSliceScale;
+                float                m_clusterSliceBias;
+                uint32_t             m_clusterSliceCount;
             } cullingConstants{};
 
             RPI::ViewPtr view = m_pipeline->GetDefaultView();
@@ -221,6 +263,14 @@ namespace AZ
             cullingConstants.m_gridHalfPixel[1] = cullingConstants.m_gridPixel[1] * 0.5f;
             cullingConstants.m_gridWidth = GetTileDataBufferResolution().m_width;
 
+            if (IsClusteringEnabled())
+            {
+                const AZStd::array<float, 2> sliceScaleBias = ComputeClusterSliceScaleBias(view->GetViewToClipMatrix());
+                cullingConstants.m_clusterSliceScale = sliceScaleBias[0];
+                cullingConstants.m_clusterSliceBias = sliceScaleBias[1];
+                cullingConstants.m_clusterSliceCount = LightCulling::NumClusterSlices;
+            }
+
             m_shaderResourceGroup->SetConstant(m_constantDataIndex, cullingConstants);
         }
 
@@ -40,6 +40,14 @@ namespace AZ
                 return Name("LightCullingTemplate");
             }
 
+            //! Returns true when r_lightCullingClusters is set, the light lists of each tile are then split into froxels,
+            //! exponential slices of the view depth, instead of the bins of the tile depth range.
+            static bool IsClusteringEnabled();
+
+            //! Returns the scale and bias giving the froxel slice of a view distance d as log2(d) * scale + bias,
+            //! with LightCulling::NumClusterSlices slices between the near and the far plane of the projection.
+            static AZStd::array<float, 2> ComputeClusterSliceScaleBias(const AZ::Matrix4x4& viewToClip);
+
         private:
 
             LightCullingPass(const RPI::PassDescriptor& descriptor);
@@ -7,6 +7,8 @@
  */
 
 #include <CoreLights/LightCullingRemap.h>
+#include <CoreLights/LightCullingConstants.h>
+#include <CoreLights/LightCullingPass.h>
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/PipelineState.h>
@@ -29,6 +31,8 @@ namespace AZ
     {
         const size_t NumBins = 8;
         const size_t MaxLightsPerTile = 256;
+        // Counters, slice distribution and empty list at the start of the froxel lists, see NVLC_CLUSTER_HEADER_OFFSET
+        const uint32_t ClusterListHeaderSize = 5;
         // TODO convert this to R16_UINT. It just needs RHI support
         // ATOM-3975
         const RHI::Format LightListRemappedFormat = RHI::Format::R32_UINT;
@@ -65,6 +69,23 @@ namespace AZ
 
             m_shaderResourceGroup->SetConstant(m_tileWidthIndex, m_tileDim.m_width);
 
+            // The froxel lists are packed in the buffer of the tiled light lists, so switching modes doesn't rebuild the pass
+            uint32_t clusterListCapacity = 0;
+            AZStd::array<float, 2> sliceScaleBias = { 0.0f, 0.0f };
+            const uint32_t tileCount = m_tileDim.m_width * m_tileDim.m_height;
+            const uint32_t clusterListOffset = ClusterListHeaderSize + tileCount * LightCulling::NumClusterSlices;
+            if (LightCullingPass::IsClusteringEnabled())
+            {
+                const uint32_t bufferSize = aznumeric_cast<uint32_t>(tileCount * NumBins * MaxLightsPerTile);
+                clusterListCapacity = bufferSize > clusterListOffset ? bufferSize - clusterListOffset : 0;
+                sliceScaleBias = LightCullingPass::ComputeClusterSliceScaleBias(m_pipeline->GetDefaultView()->GetViewToClipMatrix());
+            }
+            m_shaderResourceGroup->SetConstant(m_clusterListCapacityIndex, clusterListCapacity);
+            m_shaderResourceGroup->SetConstant(m_clusterListOffsetIndex, clusterListOffset);
+            m_shaderResourceGroup->SetConstant(m_clusterSliceScaleIndex, sliceScaleBias[0]);
+            m_shaderResourceGroup->SetConstant(m_clusterSliceBiasIndex, sliceScaleBias[1]);
+            m_shaderResourceGroup->SetConstant(m_frameIndexIndex, m_frameIndex++);
+
             BindPassSrg(context, m_shaderResourceGroup);
 
             m_shaderResourceGroup->Compile();
@@ -89,6 +110,11 @@ namespace AZ
             m_lightListRemapped = nullptr;
             m_initialized = false;
             m_tileWidthIndex.Reset();
+            m_clusterListCapacityIndex.Reset();
+            m_clusterListOffsetIndex.Reset();
+            m_clusterSliceScaleIndex.Reset();
+            m_clusterSliceBiasIndex.Reset();
+            m_frameIndexIndex.Reset();
         }
 
         uint32_t LightCullingRemap::FindInputOutputBinding(const AZ::Name& name)
@@ -64,6 +64,14 @@ namespace AZ
             uint32_t FindInputOutputBinding(const AZ::Name& name);
 
             AZ::RHI::ShaderInputConstantIndex m_tileWidthIndex;
+
+            // Froxel lists written with clustered light culling, see LightCullingPass::IsClusteringEnabled
+            AZ::RHI::ShaderInputNameIndex m_clusterListCapacityIndex = "m_clusterListCapacity";
+            AZ::RHI::ShaderInputNameIndex m_clusterListOffsetIndex = "m_clusterListOffset";
+            AZ::RHI::ShaderInputNameIndex m_clusterSliceScaleIndex = "m_clusterSliceScale";
+            AZ::RHI::ShaderInputNameIndex m_clusterSliceBiasIndex = "m_clusterSliceBias";
+            AZ::RHI::ShaderInputNameIndex m_frameIndexIndex = "m_frameIndex";
+            uint32_t m_frameIndex = 0;
             Data::Instance<RPI::Buffer> m_lightListRemapped;
             AZ::RHI::Size m_tileDim;
             int m_tileDataIndex = -1;
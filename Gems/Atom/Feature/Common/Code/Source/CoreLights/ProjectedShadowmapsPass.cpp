@@ -173,9 +173,66 @@ namespace AZ
             imageDescriptor.m_size = RHI::Size(shadowmapWidth, shadowmapWidth, 1);
             imageDescriptor.m_arraySize = m_atlas.GetArraySliceCount();
 
+            m_cachingEnabled = ShadowmapCache::IsCachingEnabled();
+            if (m_cachingEnabled)
+            {
+                // The atlas layout may have changed, so nothing rendered before is reused.
+                m_cache.ImportShadowmapImage(*attachment);
+                for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+                {
+                    static_cast<ShadowmapPass*>(child.get())->InvalidateCache();
+                }
+            }
+            else
+            {
+                m_cache.Reset();
+            }
+
             Base::BuildInternal();
         }
 
+        void ProjectedShadowmapsPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            if (m_cachingEnabled != ShadowmapCache::IsCachingEnabled())
+            {
+                // Switches between a transient and a persistent shadowmap image.
+                QueueForBuildAndInitialization();
+            }
+
+            UpdateCachedChildren();
+            Base::FrameBeginInternal(params);
+        }
+
+        void ProjectedShadowmapsPass::UpdateCachedChildren()
+        {
+            const auto& children = GetChildren();
+            AZStd::vector<ShadowmapPass*> passes;
+            AZStd::vector<uint16_t> arraySlices;
+            passes.reserve(children.size());
+            arraySlices.reserve(children.size());
+            for (const RPI::Ptr<RPI::Pass>& child : children)
+            {
+                passes.push_back(static_cast<ShadowmapPass*>(child.get()));
+            }
+
+            const bool useCache = m_cachingEnabled && ShadowmapCache::IsCachingEnabled() &&
+                m_atlas.GetBaseShadowmapSize() != ShadowmapSize::None && children.size() == m_sizes.size();
+            if (!useCache)
+            {
+                for (ShadowmapPass* pass : passes)
+                {
+                    pass->SetRenderingSkipped(false);
+                }
+                return;
+            }
+
+            for (const auto& it : m_sizes)
+            {
+                arraySlices.push_back(m_atlas.GetOrigin(it.m_shadowIndexInSrg).m_arraySlice);
+            }
+            m_cache.UpdateShadowmapPasses(passes, arraySlices, m_atlas.GetArraySliceCount(), ShadowmapCache::GetUpdateBudget());
+        }
+
         void ProjectedShadowmapsPass::GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const
         {
             const size_t childrenCount = GetChildren().size();
@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <CoreLights/ShadowmapAtlas.h>
+#include <CoreLights/ShadowmapCache.h>
 #include <CoreLights/ShadowmapPass.h>
 
 
@@ -68,6 +69,7 @@ namespace AZ
 
             // RPI::Pass overrides...
             void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
             void GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const override;
             void GetViewDrawListInfo(RHI::DrawListMask& outDrawListMask, RPI::PassesByDrawList& outPassesByDrawList, const RPI::PipelineViewTag& viewTag) const override;
 
@@ -75,6 +77,9 @@ namespace AZ
 
             void UpdateChildren();
             void SetChildrenCount(size_t count);
+
+            // Skips the children whose shadowmaps are still cached
+            void UpdateCachedChildren();
             
             const Name m_slotName{ "Shadowmap" };
             Name m_pipelineViewTagBase;
@@ -84,7 +89,9 @@ namespace AZ
             AZStd::vector<ShadowmapSizeWithIndices> m_sizes;
 
             ShadowmapAtlas m_atlas;
+            ShadowmapCache m_cache;
             bool m_updateChildren = true;
+            bool m_cachingEnabled = false;
         };
     } // namespace Render
 } // namespace AZ
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/Pass/PassAttachment.h>
+#include <AzCore/Console/IConsole.h>
+#include <CoreLights/ShadowmapCache.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool, r_shadowmapCaching, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to keep the shadowmaps between frames and only render again the ones whose view or culled objects changed.");
+        AZ_CVAR(uint32_t, r_shadowmapCacheUpdateBudget, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum count of stale projected shadowmap atlas slices rendered in a frame when r_shadowmapCaching is enabled, 0 for no limit.");
+
+        bool ShadowmapCache::IsCachingEnabled()
+        {
+            return r_shadowmapCaching;
+        }
+
+        uint32_t ShadowmapCache::GetUpdateBudget()
+        {
+            return r_shadowmapCacheUpdateBudget;
+        }
+
+        bool ShadowmapCache::ImportShadowmapImage(RPI::PassAttachment& attachment)
+        {
+            RHI::ImageDescriptor imageDescriptor = attachment.m_descriptor.m_image;
+            imageDescriptor.m_bindFlags |= RHI::ImageBindFlags::DepthStencil | RHI::ImageBindFlags::ShaderRead;
+
+            bool created = false;
+            if (!m_image ||
+                m_image->GetDescriptor().m_size != imageDescriptor.m_size ||
+                m_image->GetDescriptor().m_arraySize != imageDescriptor.m_arraySize ||
+                m_image->GetDescriptor().m_format != imageDescriptor.m_format)
+            {
+                Data::Instance<RPI::AttachmentImagePool> pool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool();
+                const RHI::ClearValue clearValue = RHI::ClearValue::CreateDepth(1.f);
+                m_image = RPI::AttachmentImage::Create(*pool.get(), imageDescriptor, Name(attachment.m_path.GetCStr()), &clearValue, nullptr);
+                created = true;
+            }
+
+            if (m_image)
+            {
+                // change the lifetime since the shadowmaps have to live between frames
+                attachment.m_lifetime = RHI::AttachmentLifetimeType::Imported;
+                attachment.m_path = m_image->GetAttachmentId();
+                attachment.m_importedResource = m_image;
+            }
+            return created;
+        }
+
+        void ShadowmapCache::Reset()
+        {
+            m_image = nullptr;
+            m_nextStaleSlice = 0;
+        }
+
+        void ShadowmapCache::UpdateShadowmapPasses(
+            AZStd::span<ShadowmapPass* const> passes,
+            AZStd::span<const uint16_t> arraySlices,
+            uint16_t arraySliceCount,
+            uint32_t updateBudget)
+        {
+            AZ_Assert(passes.size() == arraySlices.size(), "There must be an array slice per shadowmap pass.");
+
+            // A slice is as stale as the stalest of its shadowmaps.
+            AZStd::vector<ShadowmapPass::CacheState> sliceStates(arraySliceCount, ShadowmapPass::CacheState::Cached);
+            for (size_t passIndex = 0; passIndex < passes.size(); ++passIndex)
+            {
+                ShadowmapPass::CacheState& sliceState = sliceStates[arraySlices[passIndex]];
+                sliceState = AZStd::max(sliceState, passes[passIndex]->GetCacheState());
+            }
+
+            const AZStd::vector<bool> renderedSlices = SelectArraySlicesToRender(sliceStates, updateBudget);
+            for (size_t passIndex = 0; passIndex < passes.size(); ++passIndex)
+            {
+                passes[passIndex]->SetRenderingSkipped(!renderedSlices[arraySlices[passIndex]]);
+            }
+        }
+
+        AZStd::vector<bool> ShadowmapCache::SelectArraySlicesToRender(AZStd::span<const ShadowmapPass::CacheState> sliceStates, uint32_t updateBudget)
+        {
+            const size_t sliceCount = sliceStates.size();
+            AZStd::vector<bool> renderedSlices(sliceCount, false);
+            if (sliceCount == 0)
+            {
+                return renderedSlices;
+            }
+
+            uint32_t renderedStaleCount = 0;
+            size_t lastRenderedStaleSlice = 0;
+            for (size_t offset = 0; offset < sliceCount; ++offset)
+            {
+                const size_t slice = (m_nextStaleSlice + offset) % sliceCount;
+                switch (sliceStates[slice])
+                {
+                case ShadowmapPass::CacheState::Empty:
+                    // The content of the slice is undefined, so it's rendered whatever the budget.
+                    renderedSlices[slice] = true;
+                    break;
+                case ShadowmapPass::CacheState::Stale:
+                    if (updateBudget == 0 || renderedStaleCount < updateBudget)
+                    {
+                        renderedSlices[slice] = true;
+                        lastRenderedStaleSlice = slice;
+                        ++renderedStaleCount;
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            if (renderedStaleCount > 0)
+            {
+                m_nextStaleSlice = aznumeric_cast<uint16_t>((lastRenderedStaleSlice + 1) % sliceCount);
+            }
+            return renderedSlices;
+        }
+    } // namespace Render
+} // namespace AZ
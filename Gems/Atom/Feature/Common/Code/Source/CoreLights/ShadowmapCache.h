@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <CoreLights/ShadowmapPass.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class PassAttachment;
+    }
+
+    namespace Render
+    {
+        //! ShadowmapCache keeps the shadowmap image of a shadowmap parent pass alive between frames when r_shadowmapCaching
+        //! is enabled, so the shadowmaps whose view and culled objects didn't change since they were last rendered are
+        //! not rendered again. The shadowmaps sharing an array slice are rendered together, since the first of them
+        //! clears the whole slice.
+        class ShadowmapCache final
+        {
+        public:
+            //! This returns true if r_shadowmapCaching is enabled.
+            static bool IsCachingEnabled();
+
+            //! This returns the maximum count of stale array slices rendered in a frame, 0 when there is no limit.
+            static uint32_t GetUpdateBudget();
+
+            //! This makes the shadowmap image attachment persistent, recreating the image only when its descriptor changed.
+            //! @return true if the image was created, in which case it holds no shadowmap yet.
+            bool ImportShadowmapImage(RPI::PassAttachment& attachment);
+
+            //! This releases the persistent image.
+            void Reset();
+
+            //! This chooses the children of a shadowmap parent pass rendering this frame.
+            //! @param passes the shadowmap passes.
+            //! @param arraySlices the array slice each pass renders into.
+            //! @param arraySliceCount the array slice count of the shadowmap image.
+            //! @param updateBudget the maximum count of stale array slices rendered, 0 when there is no limit.
+            void UpdateShadowmapPasses(
+                AZStd::span<ShadowmapPass* const> passes,
+                AZStd::span<const uint16_t> arraySlices,
+                uint16_t arraySliceCount,
+                uint32_t updateBudget);
+
+            //! This chooses the array slices rendering this frame from the state of their shadowmaps.
+            //! Empty slices are always rendered, and at most updateBudget stale slices are, starting after the last stale slice
+            //! rendered so every stale slice is eventually rendered.
+            //! @return per array slice, true if it renders.
+            AZStd::vector<bool> SelectArraySlicesToRender(AZStd::span<const ShadowmapPass::CacheState> sliceStates, uint32_t updateBudget);
+
+        private:
+            Data::Instance<RPI::AttachmentImage> m_image;
+            uint16_t m_nextStaleSlice = 0;
+        };
+    } // namespace Render
+} // namespace AZ
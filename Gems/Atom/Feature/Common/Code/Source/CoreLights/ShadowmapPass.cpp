@@ -9,6 +9,7 @@
 #include <CoreLights/ShadowmapPass.h>
 #include <Atom/RPI.Public/Pass/PassUtils.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/View.h>
 
 namespace AZ
 {
@@ -103,6 +104,49 @@ namespace AZ
             m_scissorState = scissor;
         }
 
+        ShadowmapPass::CacheState ShadowmapPass::GetCacheState() const
+        {
+            if (!m_hasCache)
+            {
+                return CacheState::Empty;
+            }
+
+            const RPI::ViewPtr view = GetView();
+            if (!view || view->GetWorldToClipMatrix() != m_cachedWorldToClip || view->GetVisibleObjectsHash() != m_cachedVisibleObjectsHash)
+            {
+                return CacheState::Stale;
+            }
+            return CacheState::Cached;
+        }
+
+        void ShadowmapPass::InvalidateCache()
+        {
+            m_hasCache = false;
+            m_renderingSkipped = false;
+        }
+
+        void ShadowmapPass::SetRenderingSkipped(bool skipped)
+        {
+            m_renderingSkipped = skipped;
+        }
+
+        bool ShadowmapPass::IsEnabled() const
+        {
+            return !m_renderingSkipped && Base::IsEnabled();
+        }
+
+        void ShadowmapPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            if (const RPI::ViewPtr view = GetView())
+            {
+                m_cachedWorldToClip = view->GetWorldToClipMatrix();
+                m_cachedVisibleObjectsHash = view->GetVisibleObjectsHash();
+                m_hasCache = true;
+            }
+
+            Base::FrameBeginInternal(params);
+        }
+
         void ShadowmapPass::BuildInternal()
         {
             RPI::Ptr<RPI::ParentPass> parentPass = GetParent();
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/Size.h>
+#include <AzCore/Math/Matrix4x4.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 
@@ -26,6 +27,14 @@ namespace AZ
             AZ_RTTI(ShadowmapPass, "FCBDDB8C-E565-4780-9E2E-B45F16203F77", Base);
             AZ_CLASS_ALLOCATOR(ShadowmapPass, SystemAllocator, 0);
 
+            //! What the shadowmap image holds for this pass when shadowmap caching is enabled.
+            enum class CacheState : uint8_t
+            {
+                Cached, //!< The shadowmap rendered last is still valid.
+                Stale,  //!< The view or the objects culled into it changed since the shadowmap was rendered.
+                Empty   //!< The shadowmap wasn't rendered since the last InvalidateCache.
+            };
+
             ~ShadowmapPass() = default;
 
             static RPI::Ptr<ShadowmapPass> Create(const RPI::PassDescriptor& descriptor);
@@ -49,15 +58,34 @@ namespace AZ
             //! This updates viewport and scissor for this shadowmap.
             void SetViewportScissor(const RHI::Viewport& viewport, const RHI::Scissor& scissor);
 
+            //! This compares the view and its culled objects with the ones the shadowmap was last rendered with.
+            CacheState GetCacheState() const;
+
+            //! This forgets the last rendered shadowmap, for instance when the shadowmap image was recreated.
+            void InvalidateCache();
+
+            //! This skips the rendering of the shadowmap for the current frame, leaving the last rendered one in the image.
+            void SetRenderingSkipped(bool skipped);
+
+            // RPI::Pass overrides...
+            bool IsEnabled() const override;
+
         private:
             ShadowmapPass() = delete;
             explicit ShadowmapPass(const RPI::PassDescriptor& descriptor);
 
             // RHI::Pass overrides...
             void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
 
             uint16_t m_arraySlice = 0;
             bool m_clearEnabled = true;
+
+            // The view and culled objects of the last rendered shadowmap, used when shadowmap caching is enabled
+            Matrix4x4 m_cachedWorldToClip = Matrix4x4::CreateIdentity();
+            size_t m_cachedVisibleObjectsHash = 0;
+            bool m_hasCache = false;
+            bool m_renderingSkipped = false;
         };
     } // namespace Render
 } // namespace AZ
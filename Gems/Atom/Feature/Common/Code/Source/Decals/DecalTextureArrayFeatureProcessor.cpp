@@ -18,6 +18,15 @@
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetHandler.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
+#include <Atom/RPI.Public/Image/BindlessImageRegistry.h>
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+#include <AzCore/Console/IConsole.h>
+
+AZ_CVAR(bool, r_decalBindlessTextures, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Samples the decal maps from the bindless image array when the platform supports it, instead of packing them in size matched texture arrays. Read when the decal feature processor activates.");
+
+AZ_CVAR(uint32_t, r_decalTextureMemoryBudgetMB, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Memory budget of the bindless decal maps in MB, their most detailed mips are dropped until they fit. 0 for no budget.");
 
 namespace AZ
 {
@@ -43,6 +52,38 @@ namespace AZ
                 return {};
             }
 
+            static Data::Instance<RPI::StreamingImage> GetDecalMapImage(AZ::RPI::MaterialAsset& materialAsset, const DecalMapType mapType)
+            {
+                static const AZStd::array<AZ::Name, DecalMapType_Num> MapNames = { AZ::Name("baseColor.textureMap"), AZ::Name("normal.textureMap") };
+
+                const AZ::RPI::MaterialPropertyIndex propertyIndex = materialAsset.GetMaterialPropertiesLayout()->FindPropertyIndex(MapNames[mapType]);
+                if (!propertyIndex.IsValid())
+                {
+                    return nullptr;
+                }
+
+                auto imageAsset = materialAsset.GetPropertyValues()[propertyIndex.GetIndex()].GetValue<Data::Asset<RPI::ImageAsset>>();
+                if (!imageAsset.GetId().IsValid())
+                {
+                    return nullptr;
+                }
+
+                imageAsset.QueueLoad();
+                imageAsset.BlockUntilLoadComplete();
+                return RPI::StreamingImage::FindOrCreate(Data::static_pointer_cast<RPI::StreamingImageAsset>(imageAsset));
+            }
+
+            // Size of the mip chain of the image starting at the given mip level
+            static uint64_t GetImageSizeFromMip(const RHI::ImageDescriptor& descriptor, uint16_t mipLevel)
+            {
+                uint64_t size = 0;
+                for (uint16_t mip = mipLevel; mip < descriptor.m_mipLevels; ++mip)
+                {
+                    size += uint64_t(RHI::GetImageSubresourceLayout(descriptor, RHI::ImageSubresource(mip, 0)).m_bytesPerImage) * descriptor.m_arraySize;
+                }
+                return size;
+            }
+
             static AZ::Data::Asset<AZ::RPI::MaterialAsset> QueueMaterialAssetLoad(const AZ::Data::AssetId material)
             {
                 auto asset = AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::MaterialAsset>(material, AZ::Data::AssetLoadBehavior::QueueLoad);
@@ -71,6 +112,11 @@ namespace AZ
 
             m_decalBufferHandler = GpuBufferHandler(desc);
 
+            // The decal shaders sample the bindless image array when the platform supports unbounded arrays, see Decals.azsli
+            const RHI::ShaderResourceGroupLayout* sceneSrgLayout = RPI::RPISystemInterface::Get()->GetSceneSrgLayout().get();
+            m_useBindlessTextures = r_decalBindlessTextures && sceneSrgLayout &&
+                sceneSrgLayout->FindShaderInputImageUnboundedArrayIndex(Name("m_bindlessImages")).IsValid();
+
             CacheShaderIndices();
         }
 
@@ -80,6 +126,19 @@ namespace AZ
 
             m_decalData.Clear();
             m_decalBufferHandler.Release();
+
+            if (RPI::ImageSystemInterface* imageSystem = RPI::ImageSystemInterface::Get())
+            {
+                for (const auto& materialIt : m_bindlessMaterials)
+                {
+                    for (uint32_t imageIndex : materialIt.second.m_imageIndices)
+                    {
+                        imageSystem->GetBindlessImageRegistry().ReleaseImage(imageIndex);
+                    }
+                }
+            }
+            m_bindlessMaterials.clear();
+            m_bindlessDecalMaterials.clear();
         }
 
         DecalTextureArrayFeatureProcessor::DecalHandle DecalTextureArrayFeatureProcessor::AcquireDecal()
@@ -108,10 +167,17 @@ namespace AZ
                     m_materialLoadTracker.RemoveHandle(decal);
                 }
 
-                DecalLocation decalLocation;
-                decalLocation.textureArrayIndex = m_decalData.GetData(decal.GetIndex()).m_textureArrayIndex;
-                decalLocation.textureIndex = m_decalData.GetData(decal.GetIndex()).m_textureIndex;
-                RemoveDecalFromTextureArrays(decalLocation);
+                if (m_decalData.GetData(decal.GetIndex()).m_textureArrayIndex == DecalData::BindlessTextureArrayIndex)
+                {
+                    RemoveDecalFromBindlessImages(decal.GetIndex());
+                }
+                else
+                {
+                    DecalLocation decalLocation;
+                    decalLocation.textureArrayIndex = m_decalData.GetData(decal.GetIndex()).m_textureArrayIndex;
+                    decalLocation.textureIndex = m_decalData.GetData(decal.GetIndex()).m_textureIndex;
+                    RemoveDecalFromTextureArrays(decalLocation);
+                }
 
                 m_decalData.RemoveIndex(decal.GetIndex());
                 m_deviceBufferNeedsUpdate = true;
@@ -129,7 +195,12 @@ namespace AZ
             {
                 m_decalData.GetData(decal.GetIndex()) = m_decalData.GetData(sourceDecal.GetIndex());
                 const auto materialAsset = GetMaterialUsedByDecal(sourceDecal);
-                if (materialAsset.IsValid())
+                if (materialAsset.IsValid() && m_useBindlessTextures)
+                {
+                    m_bindlessMaterials.at(materialAsset).m_useCount++;
+                    m_bindlessDecalMaterials[decal.GetIndex()] = materialAsset;
+                }
+                else if (materialAsset.IsValid())
                 {
                     m_materialToTextureArrayLookupTable.at(materialAsset).m_useCount++;
                 }
@@ -152,6 +223,11 @@ namespace AZ
                 m_decalBufferHandler.UpdateBuffer(m_decalData.GetDataVector());
                 m_deviceBufferNeedsUpdate = false;
             }
+
+            if (m_useBindlessTextures)
+            {
+                UpdateBindlessTextureBudget();
+            }
         }
 
         void DecalTextureArrayFeatureProcessor::Render(const RPI::FeatureProcessor::RenderPacket& packet)
@@ -334,6 +410,17 @@ namespace AZ
                 return;
             }
 
+            if (m_useBindlessTextures)
+            {
+                const auto bindlessIter = m_bindlessMaterials.find(material);
+                if (bindlessIter != m_bindlessMaterials.end())
+                {
+                    bindlessIter->second.m_useCount++;
+                    SetDecalBindlessMaterial(handle, material, bindlessIter->second);
+                    return;
+                }
+            }
+
             const auto iter = m_materialToTextureArrayLookupTable.find(material);
             if (iter != m_materialToTextureArrayLookupTable.end())
             {
@@ -351,13 +438,21 @@ namespace AZ
         {
             auto& decalData = m_decalData.GetData(decalIndex);
 
-            DecalLocation decalLocation;
-            decalLocation.textureArrayIndex = decalData.m_textureArrayIndex;
-            decalLocation.textureIndex = decalData.m_textureIndex;
-            RemoveDecalFromTextureArrays(decalLocation);
+            if (decalData.m_textureArrayIndex == DecalData::BindlessTextureArrayIndex)
+            {
+                RemoveDecalFromBindlessImages(decalIndex);
+            }
+            else
+            {
+                DecalLocation decalLocation;
+                decalLocation.textureArrayIndex = decalData.m_textureArrayIndex;
+                decalLocation.textureIndex = decalData.m_textureIndex;
+                RemoveDecalFromTextureArrays(decalLocation);
+            }
 
             decalData.m_textureArrayIndex = DecalData::UnusedIndex;
             decalData.m_textureIndex = DecalData::UnusedIndex;
+            decalData.m_normalMapTextureIndex = DecalData::UnusedIndex;
 
             m_deviceBufferNeedsUpdate = true;
         }
@@ -428,7 +523,19 @@ namespace AZ
             
             RPI::MaterialAsset* materialAsset = asset.GetAs<AZ::RPI::MaterialAsset>();
             const bool validDecalMaterial = materialAsset && DecalTextureArray::IsValidDecalMaterial(*materialAsset);
-            if (validDecalMaterial)
+            if (validDecalMaterial && m_useBindlessTextures)
+            {
+                if (AddMaterialToBindlessImages(assetId, materialAsset))
+                {
+                    BindlessDecalMaterial& bindlessMaterial = m_bindlessMaterials[assetId];
+                    for (const auto& decal : m_materialLoadTracker.GetHandlesByAsset(assetId))
+                    {
+                        bindlessMaterial.m_useCount++;
+                        SetDecalBindlessMaterial(decal, assetId, bindlessMaterial);
+                    }
+                }
+            }
+            else if (validDecalMaterial)
             {
                 const auto& decalsThatUseThisMaterial = m_materialLoadTracker.GetHandlesByAsset(asset.GetId());
                 const auto& decalLocation = AddMaterialToTextureArrays(materialAsset);
@@ -536,7 +643,11 @@ namespace AZ
             if (handle.IsValid())
             {
                 const DecalData& decalData = m_decalData.GetData(handle.GetIndex());
-                if (decalData.m_textureArrayIndex != DecalData::UnusedIndex)
+                if (decalData.m_textureArrayIndex == DecalData::BindlessTextureArrayIndex)
+                {
+                    material = m_bindlessDecalMaterials.at(handle.GetIndex());
+                }
+                else if (decalData.m_textureArrayIndex != DecalData::UnusedIndex)
                 {
                     const DecalTextureArray& textureArray = m_textureArrayList[decalData.m_textureArrayIndex].second;
                     material = textureArray.GetMaterialAssetId(decalData.m_textureIndex);
@@ -565,5 +676,127 @@ namespace AZ
             }
         }
 
+        bool DecalTextureArrayFeatureProcessor::IsUsingBindlessTextures() const
+        {
+            return m_useBindlessTextures;
+        }
+
+        uint16_t DecalTextureArrayFeatureProcessor::GetBindlessTextureMipBias() const
+        {
+            return m_bindlessTextureMipBias;
+        }
+
+        bool DecalTextureArrayFeatureProcessor::AddMaterialToBindlessImages(const Data::AssetId& materialAssetId, AZ::RPI::MaterialAsset* materialAsset)
+        {
+            if (m_bindlessMaterials.find(materialAssetId) != m_bindlessMaterials.end())
+            {
+                return true;
+            }
+
+            BindlessDecalMaterial bindlessMaterial;
+            for (int mapType = 0; mapType < DecalMapType_Num; ++mapType)
+            {
+                bindlessMaterial.m_images[mapType] = GetDecalMapImage(*materialAsset, aznumeric_cast<DecalMapType>(mapType));
+                if (!bindlessMaterial.m_images[mapType])
+                {
+                    AZ_Warning("DecalTextureArrayFeatureProcessor", false, "Unable to create the images of decal material %s.", materialAssetId.ToString<AZStd::string>().c_str());
+                    return false;
+                }
+            }
+
+            RPI::BindlessImageRegistry& registry = RPI::ImageSystemInterface::Get()->GetBindlessImageRegistry();
+            for (int mapType = 0; mapType < DecalMapType_Num; ++mapType)
+            {
+                bindlessMaterial.m_imageIndices[mapType] = registry.AcquireImage(bindlessMaterial.m_images[mapType]);
+            }
+
+            m_bindlessMaterials.emplace(materialAssetId, AZStd::move(bindlessMaterial));
+            m_bindlessTextureBudgetNeedsUpdate = true;
+            return true;
+        }
+
+        void DecalTextureArrayFeatureProcessor::SetDecalBindlessMaterial(
+            const DecalHandle& handle, const Data::AssetId& materialAssetId, const BindlessDecalMaterial& material)
+        {
+            AZ_Assert(handle.IsValid(), "SetDecalBindlessMaterial called with invalid handle");
+            DecalData& decalData = m_decalData.GetData(handle.GetIndex());
+            decalData.m_textureArrayIndex = DecalData::BindlessTextureArrayIndex;
+            decalData.m_textureIndex = material.m_imageIndices[DecalMapType_Diffuse];
+            decalData.m_normalMapTextureIndex = material.m_imageIndices[DecalMapType_Normal];
+            m_bindlessDecalMaterials[handle.GetIndex()] = materialAssetId;
+            m_deviceBufferNeedsUpdate = true;
+        }
+
+        void DecalTextureArrayFeatureProcessor::RemoveDecalFromBindlessImages(uint16_t decalIndex)
+        {
+            const auto decalIter = m_bindlessDecalMaterials.find(decalIndex);
+            if (decalIter == m_bindlessDecalMaterials.end())
+            {
+                return;
+            }
+
+            const auto materialIter = m_bindlessMaterials.find(decalIter->second);
+            m_bindlessDecalMaterials.erase(decalIter);
+            AZ_Assert(materialIter != m_bindlessMaterials.end(), "Bad state");
+
+            if (--materialIter->second.m_useCount == 0)
+            {
+                RPI::BindlessImageRegistry& registry = RPI::ImageSystemInterface::Get()->GetBindlessImageRegistry();
+                for (uint32_t imageIndex : materialIter->second.m_imageIndices)
+                {
+                    registry.ReleaseImage(imageIndex);
+                }
+                m_bindlessMaterials.erase(materialIter);
+                m_bindlessTextureBudgetNeedsUpdate = true;
+            }
+        }
+
+        void DecalTextureArrayFeatureProcessor::UpdateBindlessTextureBudget()
+        {
+            const uint64_t budgetBytes = uint64_t(static_cast<uint32_t>(r_decalTextureMemoryBudgetMB)) * 1024 * 1024;
+            if (!m_bindlessTextureBudgetNeedsUpdate && budgetBytes == m_bindlessTextureBudgetBytes)
+            {
+                return;
+            }
+            m_bindlessTextureBudgetNeedsUpdate = false;
+            m_bindlessTextureBudgetBytes = budgetBytes;
+
+            AZ_PROFILE_SCOPE(AzRender, "DecalTextureArrayFeatureProcessor: UpdateBindlessTextureBudget");
+
+            // The memory used by all the decal maps when streamed to each mip level, the smaller images keeping their last mip.
+            // A single mip bias is applied to every map, so the decals keep the same texel density relative to each other.
+            constexpr uint16_t MipCountMax = RHI::Limits::Image::MipCountMax;
+            AZStd::array<uint64_t, MipCountMax> sizeByMipBias = {};
+            for (const auto& materialIt : m_bindlessMaterials)
+            {
+                for (const auto& image : materialIt.second.m_images)
+                {
+                    const RHI::ImageDescriptor& descriptor = image->GetDescriptor();
+                    for (uint16_t mipBias = 0; mipBias < MipCountMax; ++mipBias)
+                    {
+                        sizeByMipBias[mipBias] += GetImageSizeFromMip(descriptor, AZStd::min<uint16_t>(mipBias, descriptor.m_mipLevels - 1));
+                    }
+                }
+            }
+
+            uint16_t mipBias = 0;
+            if (budgetBytes > 0)
+            {
+                while (mipBias + 1 < MipCountMax && sizeByMipBias[mipBias] > budgetBytes)
+                {
+                    ++mipBias;
+                }
+            }
+            m_bindlessTextureMipBias = mipBias;
+
+            for (const auto& materialIt : m_bindlessMaterials)
+            {
+                for (const auto& image : materialIt.second.m_images)
+                {
+                    image->SetTargetMip(AZStd::min<uint16_t>(mipBias, image->GetDescriptor().m_mipLevels - 1));
+                }
+            }
+        }
+
     } // namespace Render
 } // namespace AZ
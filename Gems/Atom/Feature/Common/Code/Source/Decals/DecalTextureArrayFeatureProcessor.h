@@ -89,6 +89,12 @@ namespace AZ
             //! Sets the material information for this decal
             void SetDecalMaterial(const DecalHandle handle, const AZ::Data::AssetId id) override;
 
+            //! Returns whether the decal maps are sampled from the bindless image array rather than from texture arrays.
+            bool IsUsingBindlessTextures() const;
+
+            //! Returns the mip level the bindless decal maps are streamed to for them to fit in the texture memory budget.
+            uint16_t GetBindlessTextureMipBias() const;
+
         private:
 
             // Number of size and format permutations
@@ -108,6 +114,14 @@ namespace AZ
                 int m_useCount = 0;
             };
 
+            // The maps of a material used by bindless decals, registered in the bindless image array whatever their size.
+            struct BindlessDecalMaterial
+            {
+                AZStd::array<Data::Instance<RPI::StreamingImage>, DecalMapType_Num> m_images;
+                AZStd::array<uint32_t, DecalMapType_Num> m_imageIndices = { { DecalData::UnusedIndex, DecalData::UnusedIndex } };
+                int m_useCount = 0;
+            };
+
             void OnAssetReady(Data::Asset<Data::AssetData> asset) override;
 
             void SetPackedTexturesToSrg(const RPI::ViewPtr& view);
@@ -124,6 +138,14 @@ namespace AZ
             AZ::Data::AssetId GetMaterialUsedByDecal(const DecalHandle handle) const;
             void PackTexureArrays();
 
+            // Bindless decals, used instead of the texture arrays when the SceneSrg has a bindless image array
+            bool AddMaterialToBindlessImages(const Data::AssetId& materialAssetId, AZ::RPI::MaterialAsset* materialAsset);
+            void SetDecalBindlessMaterial(const DecalHandle& handle, const Data::AssetId& materialAssetId, const BindlessDecalMaterial& material);
+            void RemoveDecalFromBindlessImages(uint16_t decalIndex);
+
+            // Drops the most detailed mips of the bindless decal maps until they fit in r_decalTextureMemoryBudgetMB.
+            void UpdateBindlessTextureBudget();
+
             IndexedDataVector<DecalData> m_decalData;
 
             // Texture arrays are organized one per texture size permutation.
@@ -139,6 +161,14 @@ namespace AZ
             AsyncLoadTracker<DecalHandle> m_materialLoadTracker;
             AZStd::unordered_map< AZ::Data::AssetId, DecalLocationAndUseCount> m_materialToTextureArrayLookupTable;
 
+            bool m_useBindlessTextures = false;
+            AZStd::unordered_map<AZ::Data::AssetId, BindlessDecalMaterial> m_bindlessMaterials;
+            // The material of each bindless decal, by decal index
+            AZStd::unordered_map<uint16_t, AZ::Data::AssetId> m_bindlessDecalMaterials;
+            bool m_bindlessTextureBudgetNeedsUpdate = false;
+            uint64_t m_bindlessTextureBudgetBytes = 0;
+            uint16_t m_bindlessTextureMipBias = 0;
+
             bool m_deviceBufferNeedsUpdate = false;
         };
     } // namespace Render
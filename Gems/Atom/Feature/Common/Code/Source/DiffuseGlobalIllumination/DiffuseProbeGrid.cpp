@@ -156,6 +156,12 @@ namespace AZ
             m_updateTextures = true;
         }
 
+        void DiffuseProbeGrid::OnUpdateScheduled()
+        {
+            m_framesSinceUpdate = 0;
+            m_remainingConvergenceUpdates = (m_remainingConvergenceUpdates > 0) ? m_remainingConvergenceUpdates - 1 : 0;
+        }
+
         void DiffuseProbeGrid::SetTransform(const AZ::Transform& transform)
         {
             m_transform = transform;
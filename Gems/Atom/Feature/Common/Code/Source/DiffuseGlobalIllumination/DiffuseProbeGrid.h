@@ -122,6 +122,17 @@ namespace AZ
             void ResetCullingVisibility();
             bool GetIsVisible() const;
 
+            // update scheduling, see DiffuseProbeGridFeatureProcessor::ScheduleProbeGridUpdates()
+            uint32_t GetUpdateInterval() const { return m_updateInterval; }
+            void SetUpdateInterval(uint32_t updateInterval) { m_updateInterval = AZStd::max(updateInterval, 1u); }
+            uint32_t GetFramesSinceUpdate() const { return m_framesSinceUpdate; }
+            void IncrementFramesSinceUpdate() { ++m_framesSinceUpdate; }
+
+            // the lighting of the grid is converged when it was updated enough times since its lighting inputs last changed
+            bool IsLightingConverged() const { return m_remainingConvergenceUpdates == 0; }
+            void InvalidateLighting(uint32_t convergenceUpdateCount) { m_remainingConvergenceUpdates = convergenceUpdateCount; }
+            void OnUpdateScheduled();
+
             // compute total number of probes in the grid
             uint32_t GetTotalProbeCount() const;
 
@@ -262,6 +273,11 @@ namespace AZ
             // probe relocation settings
             int32_t m_remainingRelocationIterations = DefaultNumRelocationIterations;
 
+            // update scheduling
+            uint32_t m_updateInterval = 1;
+            uint32_t m_framesSinceUpdate = 0;
+            uint32_t m_remainingConvergenceUpdates = AZStd::numeric_limits<uint32_t>::max();
+
             // render data
             DiffuseProbeGridRenderData* m_renderData = nullptr;
 
@@ -6,8 +6,11 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
@@ -15,6 +18,7 @@
 #include <Atom/RPI.Public/Pass/PassFilter.h>
 #include <DiffuseGlobalIllumination/DiffuseProbeGridFeatureProcessor.h>
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
+#include <RayTracing/RayTracingFeatureProcessor.h>
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/PipelineState.h>
@@ -27,6 +31,22 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_diffuseProbeGridUpdateBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of probes updated per frame over all the real-time diffuse probe grids, 0 updates every visible grid each frame. "
+            "Grids are updated whole, the most stale and nearest to the camera first, and at least one grid is updated each frame.");
+
+        AZ_CVAR(float, r_diffuseProbeGridProximityDistance, 20.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The distance from the camera at which a diffuse probe grid is updated half as often as the grids around the camera, when over budget.");
+
+        AZ_CVAR(bool, r_diffuseProbeGridSkipConverged, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to stop updating the diffuse probe grids whose lighting converged since their settings or the ray traced scene last changed.");
+
+        AZ_CVAR(uint32_t, r_diffuseProbeGridConvergenceUpdates, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of updates after which the lighting of a diffuse probe grid is considered converged, see r_diffuseProbeGridSkipConverged.");
+
+        AZ_CVAR(uint32_t, r_diffuseProbeGridConvergedRefreshInterval, 60, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of frames between the updates of the converged diffuse probe grids, so that light changes are eventually picked up. 0 never updates them.");
+
         void DiffuseProbeGridFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -266,6 +286,102 @@ namespace AZ
                     m_visibleDiffuseProbeGrids.push_back(diffuseProbeGrid);
                 }
             }
+
+            ScheduleProbeGridUpdates();
+        }
+
+        void DiffuseProbeGridFeatureProcessor::ScheduleProbeGridUpdates()
+        {
+            AZ_PROFILE_SCOPE(AzRender, "DiffuseProbeGridFeatureProcessor: ScheduleProbeGridUpdates");
+
+            // any change to the ray traced geometry changes the lighting of the grids
+            RayTracingFeatureProcessor* rayTracingFeatureProcessor = GetParentScene()->GetFeatureProcessor<RayTracingFeatureProcessor>();
+            const uint32_t rayTracingRevision = rayTracingFeatureProcessor ? rayTracingFeatureProcessor->GetRevision() : 0;
+            const bool rayTracingSceneChanged = (rayTracingRevision != m_rayTracingRevision);
+            m_rayTracingRevision = rayTracingRevision;
+
+            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+            RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetDefaultRenderPipeline();
+            if (renderPipeline && renderPipeline->GetDefaultView())
+            {
+                cameraPosition = renderPipeline->GetDefaultView()->GetCameraTransform().GetTranslation();
+            }
+
+            // prioritize the grids by the number of frames since their last update, scaled down by their distance to the camera
+            const float proximityDistance = AZStd::max(static_cast<float>(r_diffuseProbeGridProximityDistance), 0.001f);
+            const uint32_t convergedRefreshInterval = r_diffuseProbeGridConvergedRefreshInterval;
+            m_probeGridUpdateCandidates.clear();
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                if (rayTracingSceneChanged)
+                {
+                    diffuseProbeGrid->InvalidateLighting(r_diffuseProbeGridConvergenceUpdates);
+                }
+                diffuseProbeGrid->IncrementFramesSinceUpdate();
+                const uint32_t framesSinceUpdate = diffuseProbeGrid->GetFramesSinceUpdate();
+
+                // cleared textures must be updated before they are used to render
+                if (diffuseProbeGrid->GetTextureClearRequired())
+                {
+                    m_probeGridUpdateCandidates.emplace_back(AZStd::numeric_limits<float>::max(), diffuseProbeGrid.get());
+                    continue;
+                }
+
+                if (framesSinceUpdate < diffuseProbeGrid->GetUpdateInterval())
+                {
+                    continue;
+                }
+
+                if (r_diffuseProbeGridSkipConverged && diffuseProbeGrid->IsLightingConverged() &&
+                    (convergedRefreshInterval == 0 || framesSinceUpdate < convergedRefreshInterval))
+                {
+                    continue;
+                }
+
+                const float distance = diffuseProbeGrid->GetObbWs().GetDistance(cameraPosition);
+                const float priority = static_cast<float>(framesSinceUpdate) / (1.0f + distance / proximityDistance);
+                m_probeGridUpdateCandidates.emplace_back(priority, diffuseProbeGrid.get());
+            }
+
+            const uint32_t updateBudget = r_diffuseProbeGridUpdateBudget;
+            if (updateBudget > 0)
+            {
+                AZStd::stable_sort(m_probeGridUpdateCandidates.begin(), m_probeGridUpdateCandidates.end(),
+                    [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+                // take the grids in priority order while they fit in the budget, grids that must be cleared are always taken
+                uint32_t scheduledProbeCount = 0;
+                size_t scheduledCount = 0;
+                for (const auto& [priority, diffuseProbeGrid] : m_probeGridUpdateCandidates)
+                {
+                    const uint32_t probeCount = diffuseProbeGrid->GetTotalProbeCount();
+                    if (scheduledCount > 0 && priority != AZStd::numeric_limits<float>::max() && scheduledProbeCount + probeCount > updateBudget)
+                    {
+                        continue;
+                    }
+                    m_probeGridUpdateCandidates[scheduledCount++].second = diffuseProbeGrid;
+                    scheduledProbeCount += probeCount;
+                }
+                m_probeGridUpdateCandidates.resize(scheduledCount);
+            }
+
+            // keep the order of the visible list for the passes
+            m_scheduledRealTimeDiffuseProbeGrids.clear();
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                auto itCandidate = AZStd::find_if(m_probeGridUpdateCandidates.begin(), m_probeGridUpdateCandidates.end(),
+                    [&](const auto& candidate) { return candidate.second == diffuseProbeGrid.get(); });
+                if (itCandidate != m_probeGridUpdateCandidates.end())
+                {
+                    diffuseProbeGrid->OnUpdateScheduled();
+                    m_scheduledRealTimeDiffuseProbeGrids.push_back(diffuseProbeGrid);
+                }
+            }
+        }
+
+        void DiffuseProbeGridFeatureProcessor::InvalidateLighting(const DiffuseProbeGridHandle& probeGrid)
+        {
+            probeGrid->InvalidateLighting(r_diffuseProbeGridConvergenceUpdates);
         }
 
         DiffuseProbeGridHandle DiffuseProbeGridFeatureProcessor::AddProbeGrid(const AZ::Transform& transform, const AZ::Vector3& extents, const AZ::Vector3& probeSpacing)
@@ -275,6 +391,7 @@ namespace AZ
             diffuseProbeGrid->SetTransform(transform);
             diffuseProbeGrid->SetExtents(extents);
             diffuseProbeGrid->SetProbeSpacing(probeSpacing);
+            InvalidateLighting(diffuseProbeGrid);
             m_diffuseProbeGrids.push_back(diffuseProbeGrid);
 
             UpdateRealTimeList(diffuseProbeGrid);
@@ -330,6 +447,17 @@ namespace AZ
                 m_visibleRealTimeDiffuseProbeGrids.erase(itEntry);
             }
 
+            // remove from side list of scheduled real-time grids
+            itEntry = AZStd::find_if(m_scheduledRealTimeDiffuseProbeGrids.begin(), m_scheduledRealTimeDiffuseProbeGrids.end(), [&](AZStd::shared_ptr<DiffuseProbeGrid> const& entry)
+            {
+                return (entry == probeGrid);
+            });
+
+            if (itEntry != m_scheduledRealTimeDiffuseProbeGrids.end())
+            {
+                m_scheduledRealTimeDiffuseProbeGrids.erase(itEntry);
+            }
+
             probeGrid = nullptr;
         }
 
@@ -343,6 +471,7 @@ namespace AZ
         {
             AZ_Assert(probeGrid.get(), "SetExtents called with an invalid handle");
             probeGrid->SetExtents(extents);
+            InvalidateLighting(probeGrid);
             m_probeGridSortRequired = true;
         }
 
@@ -350,6 +479,7 @@ namespace AZ
         {
             AZ_Assert(probeGrid.get(), "SetTransform called with an invalid handle");
             probeGrid->SetTransform(transform);
+            InvalidateLighting(probeGrid);
             m_probeGridSortRequired = true;
         }
 
@@ -363,24 +493,28 @@ namespace AZ
         {
             AZ_Assert(probeGrid.get(), "SetProbeSpacing called with an invalid handle");
             probeGrid->SetProbeSpacing(probeSpacing);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::SetViewBias(const DiffuseProbeGridHandle& probeGrid, float viewBias)
         {
             AZ_Assert(probeGrid.get(), "SetViewBias called with an invalid handle");
             probeGrid->SetViewBias(viewBias);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::SetNormalBias(const DiffuseProbeGridHandle& probeGrid, float normalBias)
         {
             AZ_Assert(probeGrid.get(), "SetNormalBias called with an invalid handle");
             probeGrid->SetNormalBias(normalBias);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::SetNumRaysPerProbe(const DiffuseProbeGridHandle& probeGrid, const DiffuseProbeGridNumRaysPerProbe& numRaysPerProbe)
         {
             AZ_Assert(probeGrid.get(), "SetNumRaysPerProbe called with an invalid handle");
             probeGrid->SetNumRaysPerProbe(numRaysPerProbe);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::SetAmbientMultiplier(const DiffuseProbeGridHandle& probeGrid, float ambientMultiplier)
@@ -393,18 +527,21 @@ namespace AZ
         {
             AZ_Assert(probeGrid.get(), "Enable called with an invalid handle");
             probeGrid->Enable(enable);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::SetGIShadows(const DiffuseProbeGridHandle& probeGrid, bool giShadows)
         {
             AZ_Assert(probeGrid.get(), "SetGIShadows called with an invalid handle");
             probeGrid->SetGIShadows(giShadows);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::SetUseDiffuseIbl(const DiffuseProbeGridHandle& probeGrid, bool useDiffuseIbl)
         {
             AZ_Assert(probeGrid.get(), "SetUseDiffuseIbl called with an invalid handle");
             probeGrid->SetUseDiffuseIbl(useDiffuseIbl);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::BakeTextures(
@@ -519,6 +656,7 @@ namespace AZ
         {
             AZ_Assert(probeGrid.get(), "SetMode called with an invalid handle");
             probeGrid->SetMode(mode);
+            InvalidateLighting(probeGrid);
 
             UpdateRealTimeList(probeGrid);
 
@@ -529,6 +667,7 @@ namespace AZ
         {
             AZ_Assert(probeGrid.get(), "SetScrolling called with an invalid handle");
             probeGrid->SetScrolling(scrolling);
+            InvalidateLighting(probeGrid);
         }
 
         void DiffuseProbeGridFeatureProcessor::SetBakedTextures(const DiffuseProbeGridHandle& probeGrid, const DiffuseProbeGridBakedTextures& bakedTextures)
@@ -555,6 +694,12 @@ namespace AZ
             probeGrid->SetVisualizationSphereRadius(visualizationSphereRadius);
         }
 
+        void DiffuseProbeGridFeatureProcessor::SetUpdateInterval(const DiffuseProbeGridHandle& probeGrid, uint32_t updateInterval)
+        {
+            AZ_Assert(probeGrid.get(), "SetUpdateInterval called with an invalid handle");
+            probeGrid->SetUpdateInterval(updateInterval);
+        }
+
         uint32_t DiffuseProbeGridFeatureProcessor::AddIrradianceQuery(const AZ::Vector3& position, const AZ::Vector3& direction)
         {
             m_irradianceQueries.push_back({ position, direction });
@@ -53,6 +53,7 @@ namespace AZ
             void SetVisualizationEnabled(const DiffuseProbeGridHandle& probeGrid, bool visualizationEnabled) override;
             void SetVisualizationShowInactiveProbes(const DiffuseProbeGridHandle& probeGrid, bool visualizationShowInactiveProbes) override;
             void SetVisualizationSphereRadius(const DiffuseProbeGridHandle& probeGrid, float visualizationSphereRadius) override;
+            void SetUpdateInterval(const DiffuseProbeGridHandle& probeGrid, uint32_t updateInterval) override;
 
             void BakeTextures(
                 const DiffuseProbeGridHandle& probeGrid,
@@ -89,6 +90,9 @@ namespace AZ
             // retrieve the side list of probe grids that are real-time (raytraced) and visible (on screen)
             DiffuseProbeGridVector& GetVisibleRealTimeProbeGrids() { return m_visibleRealTimeDiffuseProbeGrids; }
 
+            // retrieve the side list of probe grids that are real-time (raytraced), visible, and scheduled to update their probes this frame
+            DiffuseProbeGridVector& GetScheduledRealTimeProbeGrids() { return m_scheduledRealTimeDiffuseProbeGrids; }
+
             // returns the RayTracingBufferPool used for the DiffuseProbeGrid visualization
             RHI::RayTracingBufferPools& GetVisualizationBufferPools() { return *m_visualizationBufferPools; }
 
@@ -137,6 +141,12 @@ namespace AZ
             void UpdatePipelineStates();
             void UpdatePasses();
 
+            // selects the visible real-time grids updated this frame, within the update budget
+            void ScheduleProbeGridUpdates();
+
+            // marks the lighting of a probe grid as changed, so that it updates until converged again
+            void InvalidateLighting(const DiffuseProbeGridHandle& probeGrid);
+
             // loads the probe visualization model and creates the BLAS
             void OnVisualizationModelAssetReady(Data::Asset<Data::AssetData> asset);
 
@@ -153,6 +163,15 @@ namespace AZ
             // side list of diffuse probe grids that are in real-time mode and visible (subset of m_realTimeDiffuseProbeGrids)
             DiffuseProbeGridVector m_visibleRealTimeDiffuseProbeGrids;
 
+            // side list of diffuse probe grids whose probes are updated this frame (subset of m_visibleRealTimeDiffuseProbeGrids)
+            DiffuseProbeGridVector m_scheduledRealTimeDiffuseProbeGrids;
+
+            // scratch list of the grids considered for an update with their priority, kept to reuse its memory
+            AZStd::vector<AZStd::pair<float, DiffuseProbeGrid*>> m_probeGridUpdateCandidates;
+
+            // revision of the ray tracing scene when the grid updates were last scheduled, a change invalidates the lighting of all grids
+            uint32_t m_rayTracingRevision = 0;
+
             // position structure for the box vertices
             struct Position
             {
@@ -129,9 +129,9 @@ namespace AZ
                 // probe irradiance image
                 {
                     RHI::AttachmentId attachmentId = diffuseProbeGrid->GetIrradianceImageAttachmentId();
-                    if (diffuseProbeGrid->GetMode() == DiffuseProbeGridMode::Baked && !frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+                    if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
                     {
-                        // import the irradiance image now, since it is baked and therefore was not imported during the raytracing pass
+                        // import the irradiance image now if it was not imported during the raytracing pass, since it is baked or its probes are not updated this frame
                         [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportImage(attachmentId, diffuseProbeGrid->GetIrradianceImage());
                         AZ_Assert(result == RHI::ResultCode::Success, "Failed to import probeIrradianceImage");
                     }
@@ -147,9 +147,9 @@ namespace AZ
                 // probe distance image
                 {
                     RHI::AttachmentId attachmentId = diffuseProbeGrid->GetDistanceImageAttachmentId();
-                    if (diffuseProbeGrid->GetMode() == DiffuseProbeGridMode::Baked && !frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+                    if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
                     {
-                        // import the distance image now, since it is baked and therefore was not imported during the raytracing pass
+                        // import the distance image now if it was not imported during the raytracing pass, since it is baked or its probes are not updated this frame
                         [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportImage(attachmentId, diffuseProbeGrid->GetDistanceImage());
                         AZ_Assert(result == RHI::ResultCode::Success, "Failed to import probeDistanceImage");
                     }
@@ -165,9 +165,9 @@ namespace AZ
                 // probe data image
                 {
                     RHI::AttachmentId attachmentId = diffuseProbeGrid->GetProbeDataImageAttachmentId();
-                    if (diffuseProbeGrid->GetMode() == DiffuseProbeGridMode::Baked && !frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+                    if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
                     {
-                        // import the probe data image now, since it is baked and therefore was not imported during the raytracing pass
+                        // import the probe data image now if it was not imported during the raytracing pass, since it is baked or its probes are not updated this frame
                         [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportImage(attachmentId, diffuseProbeGrid->GetProbeDataImage());
                         AZ_Assert(result == RHI::ResultCode::Success, "Failed to import ProbeDataImage");
                     }
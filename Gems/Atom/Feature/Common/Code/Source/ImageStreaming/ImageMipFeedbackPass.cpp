@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ImageStreaming/ImageMipFeedbackPass.h>
+
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/Image/BindlessImageRegistry.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+
+#include <AzCore/Console/IConsole.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<ImageMipFeedbackPass> ImageMipFeedbackPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<ImageMipFeedbackPass> pass = aznew ImageMipFeedbackPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        ImageMipFeedbackPass::ImageMipFeedbackPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+            , m_prepareSceneSrgHandler([this](RPI::ShaderResourceGroup* sceneSrg)
+                {
+                    // The shaders write the feedback whether it is read back or not, so it is always bound
+                    const RHI::ShaderInputBufferIndex feedbackIndex = sceneSrg->FindShaderInputBufferIndex(Name("m_bindlessImageMipFeedback"));
+                    if (feedbackIndex.IsValid() && m_feedback)
+                    {
+                        sceneSrg->SetBufferView(feedbackIndex, m_feedback->GetBufferView());
+                    }
+                })
+        {
+            m_readback = AZStd::make_shared<RPI::AttachmentReadback>(RHI::ScopeId{ "ImageMipFeedbackReadback" });
+        }
+
+        Data::Instance<RPI::Buffer> ImageMipFeedbackPass::CreateFeedbackBuffer(const char* bufferName) const
+        {
+            const AZStd::vector<uint32_t> initialData(MaxImageCount, RPI::BindlessImageRegistry::NoMipFeedback);
+
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+            desc.m_bufferName = bufferName;
+            desc.m_elementSize = sizeof(uint32_t);
+            desc.m_byteCount = MaxImageCount * sizeof(uint32_t);
+            desc.m_bufferData = initialData.data();
+            Data::Instance<RPI::Buffer> buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            AZ_Assert(buffer != nullptr, "Unable to allocate buffer %s", bufferName);
+            if (buffer)
+            {
+                buffer->SetAsStructured<uint32_t>();
+            }
+            return buffer;
+        }
+
+        void ImageMipFeedbackPass::BuildInternal()
+        {
+            if (!m_feedback)
+            {
+                m_feedback = CreateFeedbackBuffer("ImageMipFeedbackBuffer");
+                m_mipLevels = CreateFeedbackBuffer("ImageMipFeedbackReadbackBuffer");
+            }
+
+            if (m_feedback && m_mipLevels)
+            {
+                AttachBufferToSlot(Name("Feedback"), m_feedback);
+                AttachBufferToSlot(Name("Output"), m_mipLevels);
+            }
+        }
+
+        bool ImageMipFeedbackPass::IsFeedbackEnabled() const
+        {
+            // The cvar belongs to the DefaultStreamingImageController of the RPI
+            bool feedbackEnabled = false;
+            if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->GetCvarValue("r_streamingImageMipFeedback", feedbackEnabled);
+            }
+            return feedbackEnabled;
+        }
+
+        void ImageMipFeedbackPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            if (!m_prepareSceneSrgHandler.IsConnected() && m_pipeline && m_pipeline->GetScene())
+            {
+                m_pipeline->GetScene()->ConnectEvent(m_prepareSceneSrgHandler);
+            }
+
+            // keep a single readback in flight, the feedback is copied again only once the previous one was handed over
+            if (IsFeedbackEnabled() && m_readback->GetReadbackState() == RPI::AttachmentReadback::ReadbackState::Idle)
+            {
+                // the callback runs on another thread once the GPU is done
+                m_readback->SetCallback([](const RPI::AttachmentReadback::ReadbackResult& result)
+                    {
+                        if (result.m_state != RPI::AttachmentReadback::ReadbackState::Success || !result.m_dataBuffer)
+                        {
+                            return;
+                        }
+
+                        const AZStd::span<const uint32_t> mipLevels(
+                            reinterpret_cast<const uint32_t*>(result.m_dataBuffer->data()), result.m_dataBuffer->size() / sizeof(uint32_t));
+                        RPI::ImageSystemInterface::Get()->GetBindlessImageRegistry().SetMipFeedback(mipLevels);
+                    });
+                ReadbackAttachment(m_readback, Name("Output"));
+            }
+
+            ComputePass::FrameBeginInternal(params);
+        }
+
+        void ImageMipFeedbackPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            // without the readback the feedback isn't reset, it only keeps the most detailed mip levels ever sampled
+            if (IsFeedbackEnabled())
+            {
+                ComputePass::BuildCommandListInternal(context);
+            }
+        }
+    }   // namespace Render
+}   // namespace AZ
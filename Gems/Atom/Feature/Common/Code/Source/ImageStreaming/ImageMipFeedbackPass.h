@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+#include <Atom/RPI.Public/Scene.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Owns the buffer the shaders write the mip levels they sample from the bindless images to, see SampleBindlessImage(),
+        //! and binds it to the SceneSrg. Once the frame is rendered, the pass copies the feedback for a readback and resets it.
+        //! The read back mip levels are handed to the RPI::BindlessImageRegistry, which requests them to the streaming images,
+        //! so the DefaultStreamingImageController only streams the mips that are sampled. Enabled with r_streamingImageMipFeedback.
+        class ImageMipFeedbackPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(ImageMipFeedbackPass);
+
+        public:
+            AZ_RTTI(AZ::Render::ImageMipFeedbackPass, "{8E3B1F6A-52D4-4C7B-A0E9-3F6D15C2B784}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(ImageMipFeedbackPass, SystemAllocator, 0);
+
+            //! The number of bindless images with a feedback, the following images keep all their mips.
+            static constexpr uint32_t MaxImageCount = 16384;
+
+            //! Creates an ImageMipFeedbackPass
+            static RPI::Ptr<ImageMipFeedbackPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            explicit ImageMipFeedbackPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            // Scope producer functions...
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            Data::Instance<RPI::Buffer> CreateFeedbackBuffer(const char* bufferName) const;
+
+            bool IsFeedbackEnabled() const;
+
+            //! Written by the shaders during the frame and reset by the pass.
+            Data::Instance<RPI::Buffer> m_feedback;
+            //! The copy of the feedback that is read back.
+            Data::Instance<RPI::Buffer> m_mipLevels;
+
+            AZStd::shared_ptr<RPI::AttachmentReadback> m_readback;
+
+            RPI::Scene::PrepareSceneSrgEvent::Handler m_prepareSceneSrgHandler;
+        };
+    }   // namespace Render
+}   // namespace AZ
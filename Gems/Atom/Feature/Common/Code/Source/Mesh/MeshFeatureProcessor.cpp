@@ -53,6 +53,9 @@ namespace AZ
 
             m_rayTracingFeatureProcessor = GetParentScene()->GetFeatureProcessor<RayTracingFeatureProcessor>();
 
+            m_gpuCulling.Activate(GetParentScene());
+            m_instanceManager.Activate(GetParentScene(), m_transformService);
+
             m_handleGlobalShaderOptionUpdate = RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler
             {
                 [this](const AZ::Name&, RPI::ShaderOptionValue) { m_forceRebuildDrawPackets = true; }
@@ -69,6 +72,8 @@ namespace AZ
             AZ_Warning("MeshFeatureProcessor", m_modelData.size() == 0,
                 "Deactivaing the MeshFeatureProcessor, but there are still outstanding mesh handles.\n"
             );
+            m_instanceManager.Deactivate();
+            m_gpuCulling.Deactivate();
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
         }
@@ -80,6 +85,32 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
+            if (m_gpuCulling.UpdateEnabled())
+            {
+                // the draw packets are built with different draw arguments when culled on the GPU
+                for (ModelDataInstance& modelData : m_modelData)
+                {
+                    if (modelData.m_model)
+                    {
+                        const size_t modelLodCount = modelData.m_model->GetLodCount();
+                        for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
+                        {
+                            modelData.BuildDrawPacketList(modelLodIndex);
+                        }
+                        modelData.m_cullableNeedsRebuild = true;
+                    }
+                }
+            }
+
+            // instanced draws can't be culled on the GPU
+            if (m_instanceManager.UpdateEnabled(!m_gpuCulling.IsEnabled()))
+            {
+                for (ModelDataInstance& modelData : m_modelData)
+                {
+                    m_instanceManager.QueueUpdate(&modelData);
+                }
+            }
+
             const auto iteratorRanges = m_modelData.GetParallelRanges();
             AZ::JobCompletion jobCompletion;
             for (const auto& iteratorRange : iteratorRanges)
@@ -105,6 +136,16 @@ namespace AZ
                             meshDataIter->UpdateObjectSrg();
                         }
 
+                        // meshes merged into instanced draws are drawn by their group, only their bounds are still needed
+                        if (meshDataIter->m_instanceGroup)
+                        {
+                            if (meshDataIter->m_cullBoundsNeedsUpdate)
+                            {
+                                meshDataIter->UpdateCullBounds(m_transformService);
+                            }
+                            continue;
+                        }
+
                         // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
                         // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
                         // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
@@ -145,6 +186,8 @@ namespace AZ
                 }
             }
 
+            m_instanceManager.Update(m_forceRebuildDrawPackets);
+
             m_forceRebuildDrawPackets = false;
         }
 
@@ -155,6 +198,8 @@ namespace AZ
 
         void MeshFeatureProcessor::OnEndPrepareRender()
         {
+            // all views of the frame are known at this point
+            m_gpuCulling.UpdateFrameData();
             m_meshDataChecker.soft_unlock();
         }
 
@@ -169,6 +214,8 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_gpuCulling = &m_gpuCulling;
+            meshDataHandle->m_instanceManager = &m_instanceManager;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
@@ -353,11 +400,34 @@ namespace AZ
             }
         }
 
+        void MeshFeatureProcessor::SetInstanceParameter(const MeshHandle& meshHandle, uint32_t parameterIndex, const Vector4& value)
+        {
+            if (meshHandle.IsValid())
+            {
+                // The object srg holds the object id, only the instance parameters buffer changes
+                m_transformService->SetInstanceParameterForId(meshHandle->m_objectId, parameterIndex, value);
+            }
+        }
+
+        Vector4 MeshFeatureProcessor::GetInstanceParameter(const MeshHandle& meshHandle, uint32_t parameterIndex) const
+        {
+            if (meshHandle.IsValid())
+            {
+                return m_transformService->GetInstanceParameterForId(meshHandle->m_objectId, parameterIndex);
+            }
+            else
+            {
+                AZ_Assert(false, "Invalid mesh handle");
+                return Vector4::CreateZero();
+            }
+        }
+
         void MeshFeatureProcessor::SetSortKey(const MeshHandle& meshHandle, RHI::DrawItemSortKey sortKey)
         {
             if (meshHandle.IsValid())
             {
                 meshHandle->SetSortKey(sortKey);
+                m_instanceManager.QueueUpdate(&*meshHandle);
             }
         }
 
@@ -379,6 +449,7 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->SetMeshLodConfiguration(meshLodConfig);
+                m_instanceManager.QueueUpdate(&*meshHandle);
             }
         }
 
@@ -408,6 +479,7 @@ namespace AZ
                 {
                     meshHandle->m_cullable.m_cullData.m_hideFlags &= ~RPI::View::UsageReflectiveCubeMap;
                 }
+                m_instanceManager.QueueUpdate(&*meshHandle);
             }
         }
 
@@ -454,6 +526,7 @@ namespace AZ
             {
                 meshHandle->SetVisible(visible);
                 SetRayTracingEnabled(meshHandle, visible);
+                m_instanceManager.QueueUpdate(&*meshHandle);
             }
         }
 
@@ -472,6 +545,7 @@ namespace AZ
                         meshHandle->BuildDrawPacketList(modelLodIndex);
                     }
                 }
+                m_instanceManager.QueueUpdate(&*meshHandle);
             }
         }
 
@@ -490,6 +564,11 @@ namespace AZ
             m_forceRebuildDrawPackets = true;
         }
 
+        MeshGpuCulling* MeshFeatureProcessor::GetGpuCulling()
+        {
+            return &m_gpuCulling;
+        }
+
         void MeshFeatureProcessor::UpdateMeshReflectionProbes()
         {
             // we need to rebuild the Srg for any meshes that are using the forward pass IBL specular option
@@ -631,10 +710,24 @@ namespace AZ
 
         void ModelDataInstance::DeInit()
         {
+            if (m_instanceManager)
+            {
+                m_instanceManager->RemoveInstance(this);
+            }
+
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
 
             RemoveRayTracingData();
 
+            for (size_t modelLodIndex = 0; modelLodIndex < m_gpuCullingSlotsByLod.size(); ++modelLodIndex)
+            {
+                ReleaseGpuCullingSlots(modelLodIndex);
+            }
+            m_gpuCullingSlotsByLod.clear();
+            m_meshletCullingSlotsByLod.clear();
+
+            m_lodsChangedHandler.Disconnect();
+
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
             m_objectSrgList = {};
@@ -643,9 +736,26 @@ namespace AZ
 
         void ModelDataInstance::Init(Data::Instance<RPI::Model> model)
         {
+            // the model can be reloaded without being deinitialized first
+            if (m_instanceManager)
+            {
+                m_instanceManager->RemoveInstance(this);
+            }
+
+            if (m_model != model)
+            {
+                m_lodsChangedHandler.Disconnect();
+                if (model->IsLodStreamingEnabled())
+                {
+                    model->ConnectLodsChangedEvent(m_lodsChangedHandler);
+                }
+            }
+
             m_model = model;
             const size_t modelLodCount = m_model->GetLodCount();
             m_drawPacketListsByLod.resize(modelLodCount);
+            m_gpuCullingSlotsByLod.resize(modelLodCount);
+            m_meshletCullingSlotsByLod.resize(modelLodCount);
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
             {
                 BuildDrawPacketList(modelLodIndex);
@@ -669,6 +779,11 @@ namespace AZ
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
+
+            if (m_instanceManager)
+            {
+                m_instanceManager->QueueUpdate(this);
+            }
         }
 
         void ModelDataInstance::BuildDrawPacketList(size_t modelLodIndex)
@@ -680,6 +795,10 @@ namespace AZ
             drawPacketListOut.clear();
             drawPacketListOut.reserve(meshCount);
 
+            ReleaseGpuCullingSlots(modelLodIndex);
+            const bool useGpuCulling = m_gpuCulling && m_gpuCulling->IsEnabled();
+            const bool useMeshletCulling = useGpuCulling && m_gpuCulling->IsMeshletCullingEnabled();
+
             m_hasForwardPassIblSpecularMaterial = false;
 
             for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
@@ -754,11 +873,52 @@ namespace AZ
 
                 drawPacket.SetStencilRef(stencilRef);
                 drawPacket.SetSortKey(m_sortKey);
+
+                // draw through a command written by the GPU culling pass, non indexed draws are always culled on the CPU
+                uint32_t meshletCullingSlot = MeshGpuCulling::InvalidSlot;
+                if (useGpuCulling && mesh.m_drawArguments.m_type == RHI::DrawType::Indexed)
+                {
+                    // meshes built with meshlets draw the visible meshlets written to the meshlet index buffer by the culling pass
+                    uint32_t gpuCullingSlot = MeshGpuCulling::InvalidSlot;
+                    if (useMeshletCulling)
+                    {
+                        const RPI::ModelLodAsset::Mesh& meshAsset = modelLod.GetLodAsset()->GetMeshes()[meshIndex];
+                        gpuCullingSlot = m_gpuCulling->AcquireMeshletSlot(mesh.m_drawArguments.m_indexed, meshAsset);
+                        if (gpuCullingSlot != MeshGpuCulling::InvalidSlot)
+                        {
+                            drawPacket.SetIndexBufferView(m_gpuCulling->GetMeshletIndexBufferView());
+                            meshletCullingSlot = gpuCullingSlot;
+                        }
+                    }
+
+                    if (gpuCullingSlot == MeshGpuCulling::InvalidSlot)
+                    {
+                        gpuCullingSlot = m_gpuCulling->AcquireSlot(mesh.m_drawArguments.m_indexed);
+                    }
+                    drawPacket.SetIndirectArguments(m_gpuCulling->GetIndirectArguments(gpuCullingSlot));
+                    m_gpuCullingSlotsByLod[modelLodIndex].push_back(gpuCullingSlot);
+                }
+
                 drawPacket.Update(*m_scene, false);
+                if (meshletCullingSlot != MeshGpuCulling::InvalidSlot)
+                {
+                    m_gpuCulling->SetMeshletBackFaceCulled(meshletCullingSlot, drawPacket.IsBackFaceCulled());
+                    m_meshletCullingSlotsByLod[modelLodIndex].emplace_back(drawPacketListOut.size(), meshletCullingSlot);
+                }
                 drawPacketListOut.emplace_back(AZStd::move(drawPacket));
             }
         }
 
+        void ModelDataInstance::ReleaseGpuCullingSlots(size_t modelLodIndex)
+        {
+            for (uint32_t gpuCullingSlot : m_gpuCullingSlotsByLod[modelLodIndex])
+            {
+                m_gpuCulling->ReleaseSlot(gpuCullingSlot);
+            }
+            m_gpuCullingSlotsByLod[modelLodIndex].clear();
+            m_meshletCullingSlotsByLod[modelLodIndex].clear();
+        }
+
         void ModelDataInstance::SetRayTracingData()
         {
             if (!m_model)
@@ -1065,13 +1225,25 @@ namespace AZ
 
         void ModelDataInstance::UpdateDrawPackets(bool forceUpdate /*= false*/)
         {
-            for (auto& drawPacketList : m_drawPacketListsByLod)
+            for (size_t modelLodIndex = 0; modelLodIndex < m_drawPacketListsByLod.size(); ++modelLodIndex)
             {
+                DrawPacketList& drawPacketList = m_drawPacketListsByLod[modelLodIndex];
+                bool drawPacketsUpdated = false;
                 for (auto& drawPacket : drawPacketList)
                 {
                     if (drawPacket.Update(*m_scene, forceUpdate))
                     {
                         m_cullableNeedsRebuild = true;
+                        drawPacketsUpdated = true;
+                    }
+                }
+
+                // the rebuilt draw packets can use shaders with a different cull mode
+                if (drawPacketsUpdated && modelLodIndex < m_meshletCullingSlotsByLod.size())
+                {
+                    for (const auto& [drawPacketIndex, meshletCullingSlot] : m_meshletCullingSlotsByLod[modelLodIndex])
+                    {
+                        m_gpuCulling->SetMeshletBackFaceCulled(meshletCullingSlot, drawPacketList[drawPacketIndex].IsBackFaceCulled());
                     }
                 }
             }
@@ -1093,6 +1265,7 @@ namespace AZ
             AZ_Assert(lodAssets.size() == modelLodCount, "Number of asset lods must match number of model lods");
 
             lodData.m_lods.resize(modelLodCount);
+            lodData.m_streamingModel = m_model->IsLodStreamingEnabled() ? m_model.get() : nullptr;
             cullData.m_drawListMask.reset();
 
             const size_t lodCount = lodAssets.size();
@@ -1143,6 +1316,14 @@ namespace AZ
                 cullData.m_hideFlags |= RPI::View::UsageReflectiveCubeMap;
             }
 
+            // the fine grained frustum tests are only skipped if every draw of the cullable is culled on the GPU
+            bool isGpuCulled = !m_gpuCullingSlotsByLod.empty();
+            for (size_t lodIndex = 0; lodIndex < m_gpuCullingSlotsByLod.size(); ++lodIndex)
+            {
+                isGpuCulled &= !m_gpuCullingSlotsByLod[lodIndex].empty() && m_gpuCullingSlotsByLod[lodIndex].size() == m_drawPacketListsByLod[lodIndex].size();
+            }
+            m_cullable.m_isGpuCulled = isGpuCulled;
+
             cullData.m_scene = m_scene;     //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
 
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -1169,11 +1350,35 @@ namespace AZ
             localAabb.GetTransformedAabb(localToWorld).GetAsSphere(center, radius);
 
             m_cullable.m_cullData.m_boundingSphere = Sphere(center, radius);
+            for (const AZStd::vector<uint32_t>& gpuCullingSlots : m_gpuCullingSlotsByLod)
+            {
+                for (uint32_t gpuCullingSlot : gpuCullingSlots)
+                {
+                    m_gpuCulling->SetBounds(gpuCullingSlot, m_cullable.m_cullData.m_boundingSphere);
+                }
+            }
+            for (const auto& meshletCullingSlots : m_meshletCullingSlotsByLod)
+            {
+                for (const auto& meshletCullingSlot : meshletCullingSlots)
+                {
+                    m_gpuCulling->SetMeshletTransform(meshletCullingSlot.second, localToWorld, nonUniformScale);
+                }
+            }
             m_cullable.m_cullData.m_boundingObb = localAabb.GetTransformedObb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume = localAabb.GetTransformedAabb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_userData = &m_cullable;
             m_cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
-            m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
+
+            if (m_instanceGroup)
+            {
+                // the group bounds are updated once all meshes were simulated
+                m_instanceBoundsChanged = true;
+                m_instanceGroup->m_boundsChanged = true;
+            }
+            else
+            {
+                m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
+            }
 
             m_cullBoundsNeedsUpdate = false;
         }
@@ -0,0 +1,687 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshGpuCulling.h>
+
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/IndirectBufferWriter.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI.Reflect/IndirectBufferLayout.h>
+#include <Atom/RHI.Reflect/Limits.h>
+#include <Atom/RPI.Public/Pass/PassFilter.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/RPIUtils.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Matrix3x4.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool,
+            r_meshGpuCulling,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Culls the draws of static meshes against the view frustums on the GPU. Requires every render pipeline of the scene to contain a MeshGpuCullingPass."
+        );
+
+        AZ_CVAR(bool,
+            r_meshletCulling,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Also culls the meshlets of the GPU culled meshes built with meshlets, against the view frustums and by their normal cone. Requires r_meshGpuCulling and every render pipeline of the scene to contain a MeshletCullingPass."
+        );
+
+        AZ_CVAR(uint32_t,
+            r_meshletCullingIndexCount,
+            8 * 1024 * 1024,
+            nullptr,
+            ConsoleFunctorFlags::NeedsReload,
+            "The number of indices of the meshes that can be culled per meshlet at once, meshes that don't fit are only culled as a whole."
+        );
+
+        [[maybe_unused]] static const char* MeshGpuCullingName = "MeshGpuCulling";
+        static const char* MeshGpuCullingShaderFilePath = "Shaders/MeshGpuCulling/MeshGpuCulling.azshader";
+        static const char* MeshGpuCullingPassTemplateName = "MeshGpuCullingPassTemplate";
+        static const char* MeshletCullingPassTemplateName = "MeshletCullingPassTemplate";
+        static constexpr uint32_t MinIndirectArgumentsCapacity = 1024;
+
+        void MeshGpuCulling::Activate(RPI::Scene* scene)
+        {
+            m_scene = scene;
+
+            RHI::Ptr<RHI::Device> device = RHI::RHISystemInterface::Get()->GetDevice();
+            m_isSupported = device->GetFeatures().m_indirectDrawSupport;
+            if (!m_isSupported)
+            {
+                return;
+            }
+
+            m_cullingShader = RPI::LoadCriticalShader(MeshGpuCullingShaderFilePath);
+            if (!m_cullingShader)
+            {
+                m_isSupported = false;
+                return;
+            }
+
+            RHI::Ptr<RHI::ShaderResourceGroupLayout> passSrgLayout = m_cullingShader->FindShaderResourceGroupLayout(RPI::SrgBindingSlot::Pass);
+            if (!passSrgLayout)
+            {
+                AZ_Error(MeshGpuCullingName, false, "Failed to find the pass shader resource group of %s", MeshGpuCullingShaderFilePath);
+                m_isSupported = false;
+                return;
+            }
+
+            GpuBufferHandler::Descriptor desc;
+            desc.m_bufferName = "MeshGpuCullingSlotBuffer";
+            desc.m_bufferSrgName = "m_cullingSlots";
+            desc.m_elementCountSrgName = "m_slotCount";
+            desc.m_elementSize = sizeof(SlotData);
+            desc.m_srgLayout = passSrgLayout.get();
+            m_slotBufferHandler = GpuBufferHandler(desc);
+
+            // Each command sequence only holds a DrawIndexed command, everything else comes from the draw item
+            RHI::IndirectBufferSignatureDescriptor signatureDescriptor;
+            signatureDescriptor.m_layout.AddIndirectCommand(RHI::IndirectCommandDescriptor(RHI::IndirectCommandType::DrawIndexed));
+            signatureDescriptor.m_layout.Finalize();
+
+            m_indirectBufferSignature = RHI::Factory::Get().CreateIndirectBufferSignature();
+            RHI::ResultCode resultCode = m_indirectBufferSignature->Init(*device, signatureDescriptor);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error(MeshGpuCullingName, false, "Failed to initialize the indirect buffer signature");
+                m_isSupported = false;
+                return;
+            }
+
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::Indirect;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
+            bufferPoolDesc.m_hostMemoryAccess = RHI::HostMemoryAccess::Write;
+
+            m_indirectArgumentsBufferPool = RHI::Factory::Get().CreateBufferPool();
+            m_indirectArgumentsBufferPool->SetName(Name("MeshGpuCullingIndirectArgumentsPool"));
+            resultCode = m_indirectArgumentsBufferPool->Init(*device, bufferPoolDesc);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error(MeshGpuCullingName, false, "Failed to initialize the indirect arguments buffer pool");
+                m_isSupported = false;
+                return;
+            }
+
+            AZStd::string uuidString = Uuid::CreateRandom().ToString<AZStd::string>();
+            m_indirectArgumentsAttachmentId = AZStd::string::format("MeshGpuCullingIndirectArguments_%s", uuidString.c_str());
+
+            m_indirectArgumentsIndex = passSrgLayout->FindShaderInputBufferIndex(Name("m_indirectArguments"));
+            m_frustumPlanesIndex = passSrgLayout->FindShaderInputConstantIndex(Name("m_frustumPlanes"));
+            m_viewCountIndex = passSrgLayout->FindShaderInputConstantIndex(Name("m_viewCount"));
+
+            ResizeIndirectArgumentsBuffer(MinIndirectArgumentsCapacity);
+        }
+
+        void MeshGpuCulling::Deactivate()
+        {
+            AZ_Warning(MeshGpuCullingName, m_slots.size() == m_freeSlots.size(), "Deactivating MeshGpuCulling, but there are still outstanding slots.");
+
+            m_slotBufferHandler.Release();
+            m_indirectBufferView = {};
+            m_indirectArgumentsBuffer = nullptr;
+            m_indirectArgumentsBufferPool = nullptr;
+            m_indirectBufferSignature = nullptr;
+            m_cullingShader = nullptr;
+            m_indirectArgumentsCapacity = 0;
+            m_slots.clear();
+            m_freeSlots.clear();
+            m_viewCount = 0;
+            m_isSupported = false;
+            m_isEnabled = false;
+
+            m_meshletAllocations.clear();
+            m_meshletIndexAllocator.Shutdown();
+            m_meshletAllocator.Shutdown();
+            m_meshletSourceIndexBuffer = nullptr;
+            m_meshletIndexBuffer = nullptr;
+            m_meshletBuffer = nullptr;
+            m_meshletBufferPool = nullptr;
+            m_meshletIndexCapacity = 0;
+            m_meshletCapacity = 0;
+            m_meshletCount = 0;
+            m_isMeshletCullingEnabled = false;
+            m_meshletBuffersInitialized = false;
+            m_scene = nullptr;
+        }
+
+        bool MeshGpuCulling::IsEnabled() const
+        {
+            return m_isEnabled;
+        }
+
+        bool MeshGpuCulling::UpdateEnabled()
+        {
+            bool isEnabled = m_isSupported && r_meshGpuCulling && !m_scene->GetRenderPipelines().empty();
+            if (isEnabled)
+            {
+                // Draws culled on the GPU are only correct in pipelines running the culling pass
+                for (const RPI::RenderPipelinePtr& renderPipeline : m_scene->GetRenderPipelines())
+                {
+                    RPI::PassFilter passFilter = RPI::PassFilter::CreateWithTemplateName(Name(MeshGpuCullingPassTemplateName), renderPipeline.get());
+                    if (!RPI::PassSystemInterface::Get()->FindFirstPass(passFilter))
+                    {
+                        isEnabled = false;
+                        break;
+                    }
+                }
+            }
+
+            bool isMeshletCullingEnabled = isEnabled && r_meshletCulling;
+            if (isMeshletCullingEnabled)
+            {
+                for (const RPI::RenderPipelinePtr& renderPipeline : m_scene->GetRenderPipelines())
+                {
+                    RPI::PassFilter passFilter = RPI::PassFilter::CreateWithTemplateName(Name(MeshletCullingPassTemplateName), renderPipeline.get());
+                    if (!RPI::PassSystemInterface::Get()->FindFirstPass(passFilter))
+                    {
+                        isMeshletCullingEnabled = false;
+                        break;
+                    }
+                }
+            }
+
+            // The meshlet buffers are only created the first time they are needed, and kept until deactivation
+            if (isMeshletCullingEnabled && !m_meshletBuffersInitialized)
+            {
+                m_meshletBuffersInitialized = true;
+                if (!InitMeshletBuffers())
+                {
+                    m_meshletSourceIndexBuffer = nullptr;
+                    m_meshletIndexBuffer = nullptr;
+                    m_meshletBuffer = nullptr;
+                    m_meshletBufferPool = nullptr;
+                }
+            }
+            isMeshletCullingEnabled = isMeshletCullingEnabled && m_meshletBuffer;
+
+            const bool changed = (isEnabled != m_isEnabled) || (isMeshletCullingEnabled != m_isMeshletCullingEnabled);
+            m_isEnabled = isEnabled;
+            m_isMeshletCullingEnabled = isMeshletCullingEnabled;
+            return changed;
+        }
+
+        bool MeshGpuCulling::IsMeshletCullingEnabled() const
+        {
+            return m_isMeshletCullingEnabled;
+        }
+
+        uint32_t MeshGpuCulling::AcquireSlot(const RHI::DrawIndexed& drawArguments)
+        {
+            uint32_t slot = InvalidSlot;
+            if (m_freeSlots.empty())
+            {
+                slot = aznumeric_cast<uint32_t>(m_slots.size());
+                m_slots.emplace_back();
+            }
+            else
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+
+            if (m_meshletAllocations.size() < m_slots.size())
+            {
+                m_meshletAllocations.resize(m_slots.size());
+            }
+
+            SlotData& slotData = m_slots[slot];
+            slotData = SlotData{};
+            slotData.m_indexCount = drawArguments.m_indexCount;
+            slotData.m_instanceCount = drawArguments.m_instanceCount;
+            slotData.m_indexOffset = drawArguments.m_indexOffset;
+            slotData.m_vertexOffset = drawArguments.m_vertexOffset;
+
+            m_slotsDirty = true;
+            m_indirectArgumentsDirty = true;
+            return slot;
+        }
+
+        uint32_t MeshGpuCulling::AcquireMeshletSlot(const RHI::DrawIndexed& drawArguments, const RPI::ModelLodAsset::Mesh& meshAsset)
+        {
+            const AZStd::span<const RPI::ModelLodAsset::Mesh::Meshlet> meshlets = meshAsset.GetMeshlets();
+            if (!m_isMeshletCullingEnabled || meshlets.empty() || drawArguments.m_indexCount != meshAsset.GetIndexCount())
+            {
+                return InvalidSlot;
+            }
+
+            // The culling pass reads and writes 32 bit indices, whatever the format of the mesh
+            AZStd::vector<uint32_t> indices;
+            const uint32_t elementSize = meshAsset.GetIndexBufferAssetView().GetBufferViewDescriptor().m_elementSize;
+            if (elementSize == sizeof(uint32_t))
+            {
+                const AZStd::span<const uint32_t> meshIndices = meshAsset.GetIndexBufferTyped<uint32_t>();
+                indices.assign(meshIndices.begin(), meshIndices.end());
+            }
+            else if (elementSize == sizeof(uint16_t))
+            {
+                const AZStd::span<const uint16_t> meshIndices = meshAsset.GetIndexBufferTyped<uint16_t>();
+                indices.reserve(meshIndices.size());
+                for (uint16_t index : meshIndices)
+                {
+                    indices.push_back(index);
+                }
+            }
+
+            if (indices.size() != drawArguments.m_indexCount)
+            {
+                return InvalidSlot;
+            }
+
+            MeshletAllocation allocation;
+            allocation.m_indices = m_meshletIndexAllocator.Allocate(indices.size(), 1);
+            allocation.m_meshlets = m_meshletAllocator.Allocate(meshlets.size(), 1);
+            allocation.m_meshletCount = aznumeric_cast<uint32_t>(meshlets.size());
+            if (!allocation.m_indices.IsValid() || !allocation.m_meshlets.IsValid())
+            {
+                if (allocation.m_indices.IsValid())
+                {
+                    m_meshletIndexAllocator.DeAllocate(allocation.m_indices);
+                }
+                if (allocation.m_meshlets.IsValid())
+                {
+                    m_meshletAllocator.DeAllocate(allocation.m_meshlets);
+                }
+                return InvalidSlot;
+            }
+
+            const uint32_t indexOffset = aznumeric_cast<uint32_t>(allocation.m_indices.m_ptr);
+            const uint32_t meshletOffset = aznumeric_cast<uint32_t>(allocation.m_meshlets.m_ptr);
+
+            // The output range starts with all the triangles, so the draw is correct until the culling pass first runs
+            const size_t indexByteOffset = indexOffset * sizeof(uint32_t);
+            WriteMeshletBuffer(*m_meshletSourceIndexBuffer, indexByteOffset, indices.data(), indices.size() * sizeof(uint32_t));
+            WriteMeshletBuffer(*m_meshletIndexBuffer, indexByteOffset, indices.data(), indices.size() * sizeof(uint32_t));
+
+            const uint32_t slot = AcquireSlot(drawArguments);
+
+            AZStd::vector<MeshletData> meshletData(meshlets.size());
+            for (size_t meshletIndex = 0; meshletIndex < meshlets.size(); ++meshletIndex)
+            {
+                const RPI::ModelLodAsset::Mesh::Meshlet& meshlet = meshlets[meshletIndex];
+                MeshletData& data = meshletData[meshletIndex];
+                meshlet.m_boundsCenter.StoreToFloat3(data.m_boundsCenter);
+                data.m_boundsRadius = meshlet.m_boundsRadius;
+                meshlet.m_coneAxis.StoreToFloat3(data.m_coneAxis);
+                data.m_coneCutoff = meshlet.m_coneCutoff;
+                data.m_slot = slot;
+                data.m_indexOffset = meshlet.m_indexOffset;
+                data.m_indexCount = meshlet.m_indexCount;
+            }
+            WriteMeshletBuffer(*m_meshletBuffer, meshletOffset * sizeof(MeshletData), meshletData.data(), meshletData.size() * sizeof(MeshletData));
+            m_meshletCount = AZStd::max(m_meshletCount, meshletOffset + allocation.m_meshletCount);
+
+            SlotData& slotData = m_slots[slot];
+            slotData.m_indexOffset = indexOffset;
+            slotData.m_meshletCount = allocation.m_meshletCount;
+            m_meshletAllocations[slot] = allocation;
+            return slot;
+        }
+
+        void MeshGpuCulling::ReleaseSlot(uint32_t slot)
+        {
+            if (!m_scene)
+            {
+                // all slots were already discarded when deactivating
+                return;
+            }
+
+            AZ_Assert(slot < m_slots.size(), "Invalid MeshGpuCulling slot %u", slot);
+
+            MeshletAllocation& allocation = m_meshletAllocations[slot];
+            if (allocation.m_meshletCount > 0)
+            {
+                // The released meshlets stay in the range processed by the culling pass, so they are marked as not owned by any slot
+                const AZStd::vector<MeshletData> releasedMeshlets(allocation.m_meshletCount);
+                WriteMeshletBuffer(
+                    *m_meshletBuffer, allocation.m_meshlets.m_ptr * sizeof(MeshletData), releasedMeshlets.data(),
+                    releasedMeshlets.size() * sizeof(MeshletData));
+                m_meshletIndexAllocator.DeAllocate(allocation.m_indices);
+                m_meshletAllocator.DeAllocate(allocation.m_meshlets);
+                allocation = MeshletAllocation{};
+            }
+
+            // A released slot keeps its command, which draws nothing until the slot is acquired again
+            m_slots[slot] = SlotData{};
+            m_freeSlots.push_back(slot);
+
+            m_slotsDirty = true;
+            m_indirectArgumentsDirty = true;
+        }
+
+        void MeshGpuCulling::SetBounds(uint32_t slot, const Sphere& bounds)
+        {
+            AZ_Assert(slot < m_slots.size(), "Invalid MeshGpuCulling slot %u", slot);
+
+            SlotData& slotData = m_slots[slot];
+            bounds.GetCenter().StoreToFloat3(slotData.m_boundsCenter);
+            slotData.m_boundsRadius = bounds.GetRadius();
+
+            m_slotsDirty = true;
+        }
+
+        void MeshGpuCulling::SetMeshletTransform(uint32_t slot, const Transform& localToWorld, const Vector3& nonUniformScale)
+        {
+            AZ_Assert(slot < m_slots.size(), "Invalid MeshGpuCulling slot %u", slot);
+
+            SlotData& slotData = m_slots[slot];
+            const Matrix3x4 matrix = Matrix3x4::CreateFromTransform(localToWorld) * Matrix3x4::CreateScale(nonUniformScale);
+            matrix.StoreToRowMajorFloat12(slotData.m_localToWorld);
+            slotData.m_meshletRadiusScale = localToWorld.GetUniformScale() * nonUniformScale.GetAbs().GetMaxElement();
+
+            // The normal cones stay valid under a uniform scale only, a non uniform or mirroring scale skews or flips the normals
+            const bool isUniformScale = nonUniformScale.GetX() > 0.0f &&
+                IsClose(nonUniformScale.GetX(), nonUniformScale.GetY()) && IsClose(nonUniformScale.GetX(), nonUniformScale.GetZ());
+            if (isUniformScale)
+            {
+                slotData.m_meshletFlags |= MeshletFlagUniformScale;
+            }
+            else
+            {
+                slotData.m_meshletFlags &= ~MeshletFlagUniformScale;
+            }
+
+            m_slotsDirty = true;
+        }
+
+        void MeshGpuCulling::SetMeshletBackFaceCulled(uint32_t slot, bool isBackFaceCulled)
+        {
+            AZ_Assert(slot < m_slots.size(), "Invalid MeshGpuCulling slot %u", slot);
+
+            SlotData& slotData = m_slots[slot];
+            if (isBackFaceCulled)
+            {
+                slotData.m_meshletFlags |= MeshletFlagBackFaceCulled;
+            }
+            else
+            {
+                slotData.m_meshletFlags &= ~MeshletFlagBackFaceCulled;
+            }
+
+            m_slotsDirty = true;
+        }
+
+        RHI::DrawIndirect MeshGpuCulling::GetIndirectArguments(uint32_t slot) const
+        {
+            return RHI::DrawIndirect(1, m_indirectBufferView, slot * m_indirectBufferView.GetByteStride());
+        }
+
+        void MeshGpuCulling::UpdateFrameData()
+        {
+            if (!m_isEnabled)
+            {
+                return;
+            }
+
+            // Cull against all the views rendered this frame, a draw is visible if it is visible in any of them
+            m_viewCount = 0;
+            bool tooManyViews = false;
+            for (const RPI::RenderPipelinePtr& renderPipeline : m_scene->GetRenderPipelines())
+            {
+                for (const auto& pipelineViews : renderPipeline->GetPipelineViews())
+                {
+                    for (const RPI::ViewPtr& view : pipelineViews.second.m_views)
+                    {
+                        if (m_viewCount == MaxViews)
+                        {
+                            tooManyViews = true;
+                            break;
+                        }
+
+                        const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix(), Frustum::ReverseDepth::True);
+                        for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                        {
+                            m_frustumPlanes[m_viewCount * Frustum::PlaneId::MAX + planeId] = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+                        }
+
+                        // The meshlet normal cones are tested against the view position, or the view direction of orthographic views
+                        const Matrix4x4& viewToWorld = view->GetViewToWorldMatrix();
+                        const bool isOrthographic = view->GetViewToClipMatrix().GetElement(3, 3) == 1.0f;
+                        m_viewPositions[m_viewCount] = isOrthographic
+                            ? Vector4::CreateFromVector3AndFloat(-viewToWorld.GetBasisZAsVector3().GetNormalized(), 0.0f)
+                            : Vector4::CreateFromVector3AndFloat(viewToWorld.GetTranslation(), 1.0f);
+                        ++m_viewCount;
+                    }
+                }
+            }
+
+            // A view count of zero disables culling in the shader
+            if (tooManyViews)
+            {
+                m_viewCount = 0;
+            }
+
+            const uint32_t slotCount = GetSlotCount();
+            if (slotCount > m_indirectArgumentsCapacity)
+            {
+                ResizeIndirectArgumentsBuffer(slotCount);
+            }
+
+            if (m_indirectArgumentsDirty)
+            {
+                WriteDefaultCommands();
+                m_indirectArgumentsDirty = false;
+            }
+
+            if (m_slotsDirty)
+            {
+                m_slotBufferHandler.UpdateBuffer(m_slots);
+                m_slotsDirty = false;
+            }
+
+            if (m_meshletBuffer)
+            {
+                m_meshletIndexAllocator.GarbageCollect();
+                m_meshletAllocator.GarbageCollect();
+            }
+        }
+
+        uint32_t MeshGpuCulling::GetSlotCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_slots.size());
+        }
+
+        const RHI::AttachmentId& MeshGpuCulling::GetIndirectArgumentsAttachmentId() const
+        {
+            return m_indirectArgumentsAttachmentId;
+        }
+
+        const RHI::Ptr<RHI::Buffer>& MeshGpuCulling::GetIndirectArgumentsBuffer() const
+        {
+            return m_indirectArgumentsBuffer;
+        }
+
+        RHI::BufferViewDescriptor MeshGpuCulling::GetIndirectArgumentsBufferViewDescriptor() const
+        {
+            return RHI::BufferViewDescriptor::CreateStructured(0, m_indirectArgumentsCapacity, m_indirectBufferView.GetByteStride());
+        }
+
+        void MeshGpuCulling::UpdatePassSrg(RPI::ShaderResourceGroup& srg) const
+        {
+            m_slotBufferHandler.UpdateSrg(&srg);
+            srg.SetBufferView(m_indirectArgumentsIndex, m_indirectArgumentsBuffer->GetBufferView(GetIndirectArgumentsBufferViewDescriptor()).get());
+            srg.SetConstantArray(m_frustumPlanesIndex, m_frustumPlanes);
+            srg.SetConstant(m_viewCountIndex, m_viewCount);
+        }
+
+        uint32_t MeshGpuCulling::GetMeshletCount() const
+        {
+            return m_meshletCount;
+        }
+
+        RHI::IndexBufferView MeshGpuCulling::GetMeshletIndexBufferView() const
+        {
+            return RHI::IndexBufferView(*m_meshletIndexBuffer, 0, m_meshletIndexCapacity * sizeof(uint32_t), RHI::IndexFormat::Uint32);
+        }
+
+        const RHI::AttachmentId& MeshGpuCulling::GetMeshletIndexBufferAttachmentId() const
+        {
+            return m_meshletIndexBufferAttachmentId;
+        }
+
+        const RHI::Ptr<RHI::Buffer>& MeshGpuCulling::GetMeshletIndexBuffer() const
+        {
+            return m_meshletIndexBuffer;
+        }
+
+        RHI::BufferViewDescriptor MeshGpuCulling::GetMeshletIndexBufferViewDescriptor() const
+        {
+            return RHI::BufferViewDescriptor::CreateRaw(0, m_meshletIndexCapacity * sizeof(uint32_t));
+        }
+
+        void MeshGpuCulling::UpdateMeshletPassSrg(RPI::ShaderResourceGroup& srg)
+        {
+            if (m_slotBufferHandler.GetBuffer())
+            {
+                srg.SetBufferView(m_meshletSlotsIndex, m_slotBufferHandler.GetBuffer()->GetBufferView());
+            }
+            srg.SetBufferView(
+                m_meshletsIndex,
+                m_meshletBuffer->GetBufferView(RHI::BufferViewDescriptor::CreateStructured(0, m_meshletCapacity, sizeof(MeshletData))).get());
+            srg.SetBufferView(m_meshletSourceIndicesIndex, m_meshletSourceIndexBuffer->GetBufferView(GetMeshletIndexBufferViewDescriptor()).get());
+            srg.SetBufferView(m_meshletIndicesIndex, m_meshletIndexBuffer->GetBufferView(GetMeshletIndexBufferViewDescriptor()).get());
+            srg.SetBufferView(
+                m_meshletIndirectArgumentsIndex, m_indirectArgumentsBuffer->GetBufferView(GetIndirectArgumentsBufferViewDescriptor()).get());
+            srg.SetConstant(m_meshletCountIndex, m_meshletCount);
+            srg.SetConstantArray(m_meshletFrustumPlanesIndex, m_frustumPlanes);
+            srg.SetConstantArray(m_meshletViewPositionsIndex, m_viewPositions);
+            srg.SetConstant(m_meshletViewCountIndex, m_viewCount);
+        }
+
+        bool MeshGpuCulling::InitMeshletBuffers()
+        {
+            RHI::Ptr<RHI::Device> device = RHI::RHISystemInterface::Get()->GetDevice();
+
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::InputAssembly | RHI::BufferBindFlags::ShaderReadWrite;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
+            bufferPoolDesc.m_hostMemoryAccess = RHI::HostMemoryAccess::Write;
+
+            m_meshletBufferPool = RHI::Factory::Get().CreateBufferPool();
+            m_meshletBufferPool->SetName(Name("MeshletCullingPool"));
+            if (m_meshletBufferPool->Init(*device, bufferPoolDesc) != RHI::ResultCode::Success)
+            {
+                AZ_Error(MeshGpuCullingName, false, "Failed to initialize the meshlet culling buffer pool");
+                return false;
+            }
+
+            // Sized for meshlets holding an eighth of their maximum triangle count on average, most hold far more
+            m_meshletIndexCapacity = AZStd::max<uint32_t>(r_meshletCullingIndexCount, RPI::ModelLodAsset::Mesh::Meshlet::TriangleCountMax * 3);
+            m_meshletCapacity = m_meshletIndexCapacity / (RPI::ModelLodAsset::Mesh::Meshlet::TriangleCountMax * 3 / 8);
+
+            const auto createBuffer = [this](const char* name, size_t byteCount) -> RHI::Ptr<RHI::Buffer>
+            {
+                RHI::Ptr<RHI::Buffer> buffer = RHI::Factory::Get().CreateBuffer();
+                RHI::BufferInitRequest request;
+                request.m_buffer = buffer.get();
+                request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::InputAssembly | RHI::BufferBindFlags::ShaderReadWrite, byteCount };
+                if (m_meshletBufferPool->InitBuffer(request) != RHI::ResultCode::Success)
+                {
+                    AZ_Error(MeshGpuCullingName, false, "Failed to initialize the %s buffer with %zu bytes", name, byteCount);
+                    return nullptr;
+                }
+                buffer->SetName(Name(name));
+                return buffer;
+            };
+
+            m_meshletSourceIndexBuffer = createBuffer("MeshletCullingSourceIndices", m_meshletIndexCapacity * sizeof(uint32_t));
+            m_meshletIndexBuffer = createBuffer("MeshletCullingIndices", m_meshletIndexCapacity * sizeof(uint32_t));
+            m_meshletBuffer = createBuffer("MeshletCullingMeshlets", m_meshletCapacity * sizeof(MeshletData));
+            if (!m_meshletSourceIndexBuffer || !m_meshletIndexBuffer || !m_meshletBuffer)
+            {
+                return false;
+            }
+
+            // The allocators hand out ranges in elements rather than bytes, released ranges are reused once the GPU is done with them
+            RHI::FreeListAllocator::Descriptor allocatorDesc;
+            allocatorDesc.m_alignmentInBytes = 1;
+            allocatorDesc.m_garbageCollectLatency = RHI::Limits::Device::FrameCountMax;
+            allocatorDesc.m_capacityInBytes = m_meshletIndexCapacity;
+            m_meshletIndexAllocator.Init(allocatorDesc);
+            allocatorDesc.m_capacityInBytes = m_meshletCapacity;
+            m_meshletAllocator.Init(allocatorDesc);
+
+            AZStd::string uuidString = Uuid::CreateRandom().ToString<AZStd::string>();
+            m_meshletIndexBufferAttachmentId = AZStd::string::format("MeshletCullingIndices_%s", uuidString.c_str());
+            return true;
+        }
+
+        void MeshGpuCulling::WriteMeshletBuffer(RHI::Buffer& buffer, size_t byteOffset, const void* data, size_t byteCount)
+        {
+            RHI::BufferMapResponse response;
+            if (m_meshletBufferPool->MapBuffer(RHI::BufferMapRequest(buffer, byteOffset, byteCount), response) != RHI::ResultCode::Success)
+            {
+                AZ_Error(MeshGpuCullingName, false, "Failed to map the %s buffer", buffer.GetName().GetCStr());
+                return;
+            }
+            memcpy(response.m_data, data, byteCount);
+            m_meshletBufferPool->UnmapBuffer(buffer);
+        }
+
+        void MeshGpuCulling::ResizeIndirectArgumentsBuffer(uint32_t commandCount)
+        {
+            const uint32_t capacity = RHI::NextPowerOfTwo(AZStd::max(commandCount, MinIndirectArgumentsCapacity));
+            const uint32_t byteStride = m_indirectBufferSignature->GetByteStride();
+
+            RHI::Ptr<RHI::Buffer> buffer = RHI::Factory::Get().CreateBuffer();
+            RHI::BufferInitRequest request;
+            request.m_buffer = buffer.get();
+            request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::Indirect, capacity * byteStride };
+            const RHI::ResultCode resultCode = m_indirectArgumentsBufferPool->InitBuffer(request);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error(MeshGpuCullingName, false, "Failed to initialize the indirect arguments buffer with %u commands", capacity);
+                return;
+            }
+            buffer->SetName(Name("MeshGpuCullingIndirectArguments"));
+
+            m_indirectArgumentsBuffer = buffer;
+            m_indirectArgumentsCapacity = capacity;
+            m_indirectBufferView = RHI::IndirectBufferView(*m_indirectArgumentsBuffer, *m_indirectBufferSignature, 0, capacity * byteStride, byteStride);
+            m_indirectArgumentsDirty = true;
+        }
+
+        void MeshGpuCulling::WriteDefaultCommands()
+        {
+            const uint32_t slotCount = GetSlotCount();
+            if (slotCount == 0)
+            {
+                return;
+            }
+
+            RHI::Ptr<RHI::IndirectBufferWriter> writer = RHI::Factory::Get().CreateIndirectBufferWriter();
+            RHI::ResultCode resultCode = writer->Init(*m_indirectArgumentsBuffer, 0, m_indirectBufferView.GetByteStride(), slotCount, *m_indirectBufferSignature);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error(MeshGpuCullingName, false, "Failed to initialize the indirect buffer writer");
+                return;
+            }
+
+            for (uint32_t slot = 0; slot < slotCount; ++slot)
+            {
+                const SlotData& slotData = m_slots[slot];
+                writer->Seek(slot);
+                writer->DrawIndexed(RHI::DrawIndexed(slotData.m_instanceCount, 0, slotData.m_vertexOffset, slotData.m_indexCount, slotData.m_indexOffset));
+            }
+            writer->Shutdown();
+        }
+    } // namespace Render
+} // namespace AZ
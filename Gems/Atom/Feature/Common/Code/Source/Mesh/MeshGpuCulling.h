@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/Utils/GpuBufferHandler.h>
+#include <Atom/RHI/Buffer.h>
+#include <Atom/RHI/BufferPool.h>
+#include <Atom/RHI/DrawItem.h>
+#include <Atom/RHI/FreeListAllocator.h>
+#include <Atom/RHI/IndexBufferView.h>
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <Atom/RHI/IndirectBufferView.h>
+#include <Atom/RHI.Reflect/AttachmentId.h>
+#include <Atom/RHI.Reflect/ShaderInputNameIndex.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Scene;
+        class ShaderResourceGroup;
+    }
+
+    namespace Render
+    {
+        //! Culls mesh draws against the view frustums on the GPU.
+        //! Every GPU culled draw owns a slot holding its world space bounds and its draw arguments, and a DrawIndexed command
+        //! in the indirect arguments buffer. The draw items of the mesh are built with indirect draw arguments referencing that
+        //! command, and MeshGpuCullingPass rewrites all the commands every frame, setting the instance count to zero for draws
+        //! whose bounds are outside of all the views rendered by the scene.
+        //! The slot data lives in a persistent structured buffer and is only uploaded again when a slot changes.
+        //!
+        //! When r_meshletCulling is enabled as well, draws of meshes built with meshlets are also culled per meshlet. Their slot
+        //! owns a range of a shared index buffer, which MeshletCullingPass fills every frame with the triangles of the meshlets
+        //! that are inside a view and not facing away from all views, and the index count of their command is the number of
+        //! indices written.
+        class MeshGpuCulling
+        {
+        public:
+            static constexpr uint32_t InvalidSlot = static_cast<uint32_t>(-1);
+
+            //! The maximum number of views the draws are culled against, culling is skipped for frames rendering more views.
+            static constexpr uint32_t MaxViews = 16;
+
+            //! The number of meshlets in a row of the meshlet culling dispatch, must match MESHLETS_PER_ROW in MeshletCulling.azsl
+            static constexpr uint32_t MeshletsPerDispatchRow = 1024;
+
+            //! Meshlet culling flags of a slot, the meshlets are only culled by their normal cone when all flags are set.
+            //! Must match the MESHLET_FLAG defines in MeshletCulling.azsl
+            static constexpr uint32_t MeshletFlagBackFaceCulled = 1 << 0;
+            static constexpr uint32_t MeshletFlagUniformScale = 1 << 1;
+
+            //! Per slot data read by the culling shaders, must match MeshGpuCullingSlot in MeshGpuCulling.azsl and MeshletCulling.azsl
+            struct SlotData
+            {
+                float m_boundsCenter[3] = { 0.0f, 0.0f, 0.0f };
+                float m_boundsRadius = 0.0f;
+                uint32_t m_indexCount = 0;
+                uint32_t m_instanceCount = 0;
+                uint32_t m_indexOffset = 0;
+                uint32_t m_vertexOffset = 0;
+
+                //! Only used by slots culled per meshlet
+                float m_localToWorld[12] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+                float m_meshletRadiusScale = 1.0f;
+                uint32_t m_meshletCount = 0;
+                uint32_t m_meshletFlags = 0;
+                uint32_t m_padding = 0;
+            };
+
+            //! Per meshlet data read by the meshlet culling shader, must match MeshletCullingMeshlet in MeshletCulling.azsl
+            struct MeshletData
+            {
+                float m_boundsCenter[3] = { 0.0f, 0.0f, 0.0f };
+                float m_boundsRadius = 0.0f;
+                float m_coneAxis[3] = { 0.0f, 0.0f, 1.0f };
+                float m_coneCutoff = 1.0f;
+                uint32_t m_slot = InvalidSlot;
+                uint32_t m_indexOffset = 0;
+                uint32_t m_indexCount = 0;
+                uint32_t m_padding = 0;
+            };
+
+            void Activate(RPI::Scene* scene);
+            void Deactivate();
+
+            //! Returns true if mesh draws should be culled on the GPU. This requires r_meshGpuCulling to be enabled, the device to
+            //! support indirect draws and every render pipeline of the scene to contain a MeshGpuCullingPass.
+            bool IsEnabled() const;
+
+            //! Returns true if the draws of meshes built with meshlets should also be culled per meshlet. This requires GPU culling to
+            //! be enabled, r_meshletCulling to be enabled and every render pipeline of the scene to contain a MeshletCullingPass.
+            bool IsMeshletCullingEnabled() const;
+
+            //! Re-evaluates whether mesh draws should be culled on the GPU, and whether they should be culled per meshlet.
+            //! @return true if the value returned by IsEnabled() or IsMeshletCullingEnabled() changed
+            bool UpdateEnabled();
+
+            //! Acquires a slot for a draw. Slots must not be acquired or released while meshes are being simulated.
+            //! @param drawArguments the draw arguments of the mesh
+            //! @return the acquired slot
+            uint32_t AcquireSlot(const RHI::DrawIndexed& drawArguments);
+
+            //! Acquires a slot for a draw culled per meshlet. The draw must use the index buffer view returned by
+            //! GetMeshletIndexBufferView(), slots must not be acquired or released while meshes are being simulated.
+            //! @param drawArguments the draw arguments of the mesh
+            //! @param meshAsset the mesh asset providing the indices and the meshlets of the mesh
+            //! @return the acquired slot, or InvalidSlot if the mesh has no meshlets or the meshlet buffers are full
+            uint32_t AcquireMeshletSlot(const RHI::DrawIndexed& drawArguments, const RPI::ModelLodAsset::Mesh& meshAsset);
+
+            //! Releases a slot acquired with AcquireSlot or AcquireMeshletSlot, the draw referencing it will not draw anything anymore.
+            void ReleaseSlot(uint32_t slot);
+
+            //! Sets the world space bounds of the draw owning the slot. Different slots can be updated concurrently.
+            void SetBounds(uint32_t slot, const Sphere& bounds);
+
+            //! Sets the transform of the draw owning a slot acquired with AcquireMeshletSlot, since the meshlet bounds are in model space.
+            //! Different slots can be updated concurrently.
+            void SetMeshletTransform(uint32_t slot, const Transform& localToWorld, const Vector3& nonUniformScale);
+
+            //! Sets whether the draw owning a slot acquired with AcquireMeshletSlot culls back faces, in which case its meshlets facing
+            //! away from all views are culled as well.
+            void SetMeshletBackFaceCulled(uint32_t slot, bool isBackFaceCulled);
+
+            //! Returns the indirect arguments used to draw the command of the slot.
+            RHI::DrawIndirect GetIndirectArguments(uint32_t slot) const;
+
+            //! Gathers the frustums of the views rendered this frame and uploads the slots that changed.
+            //! Must be called once all the views of the frame were added to the scene.
+            void UpdateFrameData();
+
+            //! Returns the number of slots, including released slots, that the culling pass processes.
+            uint32_t GetSlotCount() const;
+
+            //! Returns the attachment id of the indirect arguments buffer used in the frame graph.
+            const RHI::AttachmentId& GetIndirectArgumentsAttachmentId() const;
+
+            //! Returns the indirect arguments buffer, written by the culling pass.
+            const RHI::Ptr<RHI::Buffer>& GetIndirectArgumentsBuffer() const;
+
+            //! Returns the buffer view descriptor the culling pass uses to write the indirect arguments buffer.
+            RHI::BufferViewDescriptor GetIndirectArgumentsBufferViewDescriptor() const;
+
+            //! Binds the slot data, the view frustums and the indirect arguments buffer to the culling pass shader resource group.
+            void UpdatePassSrg(RPI::ShaderResourceGroup& srg) const;
+
+            //! Returns the number of meshlets, including released meshlets, that the meshlet culling pass processes.
+            uint32_t GetMeshletCount() const;
+
+            //! Returns the index buffer view the draws culled per meshlet must use.
+            RHI::IndexBufferView GetMeshletIndexBufferView() const;
+
+            //! Returns the attachment id of the meshlet index buffer used in the frame graph.
+            const RHI::AttachmentId& GetMeshletIndexBufferAttachmentId() const;
+
+            //! Returns the meshlet index buffer, written by the meshlet culling pass.
+            const RHI::Ptr<RHI::Buffer>& GetMeshletIndexBuffer() const;
+
+            //! Returns the buffer view descriptor the meshlet culling pass uses to write the meshlet index buffer.
+            RHI::BufferViewDescriptor GetMeshletIndexBufferViewDescriptor() const;
+
+            //! Binds the slot data, the meshlets, the view frustums and positions, and the buffers written by the meshlet culling pass
+            //! to the meshlet culling pass shader resource group.
+            void UpdateMeshletPassSrg(RPI::ShaderResourceGroup& srg);
+
+        private:
+            //! Grows the indirect arguments buffer to hold the commands of all slots.
+            void ResizeIndirectArgumentsBuffer(uint32_t commandCount);
+
+            //! Writes the unculled command of every slot, so the draws are correct until the culling pass first runs.
+            void WriteDefaultCommands();
+
+            //! Creates the buffers holding the meshlets and their indices, sized from r_meshletCullingIndexCount.
+            bool InitMeshletBuffers();
+
+            //! Copies data to a range of one of the meshlet buffers.
+            void WriteMeshletBuffer(RHI::Buffer& buffer, size_t byteOffset, const void* data, size_t byteCount);
+
+            //! Ranges of the meshlet buffers owned by a slot culled per meshlet
+            struct MeshletAllocation
+            {
+                RHI::VirtualAddress m_indices;
+                RHI::VirtualAddress m_meshlets;
+                uint32_t m_meshletCount = 0;
+            };
+
+            RPI::Scene* m_scene = nullptr;
+            Data::Instance<RPI::Shader> m_cullingShader;
+            RHI::Ptr<RHI::IndirectBufferSignature> m_indirectBufferSignature;
+            RHI::Ptr<RHI::BufferPool> m_indirectArgumentsBufferPool;
+            RHI::Ptr<RHI::Buffer> m_indirectArgumentsBuffer;
+            RHI::AttachmentId m_indirectArgumentsAttachmentId;
+
+            //! View over the whole indirect arguments buffer. Draw items hold a pointer to this view, so it is updated in place
+            //! when the buffer is resized rather than replaced.
+            RHI::IndirectBufferView m_indirectBufferView;
+            uint32_t m_indirectArgumentsCapacity = 0;
+
+            GpuBufferHandler m_slotBufferHandler;
+            AZStd::vector<SlotData> m_slots;
+            AZStd::vector<uint32_t> m_freeSlots;
+            AZStd::atomic_bool m_slotsDirty{ false };
+            bool m_indirectArgumentsDirty = false;
+
+            AZStd::array<Vector4, MaxViews * Frustum::PlaneId::MAX> m_frustumPlanes;
+
+            //! The position of each perspective view with w set to 1, or the forward direction of each orthographic view with w set to 0
+            AZStd::array<Vector4, MaxViews> m_viewPositions;
+            uint32_t m_viewCount = 0;
+
+            //! The meshlet buffers share a pool that is both an index buffer and a shader resource.
+            //! The source indices hold the indices of every meshlet culled mesh, from which the culling pass copies the triangles of
+            //! the visible meshlets to the same range of the meshlet index buffer.
+            RHI::Ptr<RHI::BufferPool> m_meshletBufferPool;
+            RHI::Ptr<RHI::Buffer> m_meshletSourceIndexBuffer;
+            RHI::Ptr<RHI::Buffer> m_meshletIndexBuffer;
+            RHI::Ptr<RHI::Buffer> m_meshletBuffer;
+            RHI::AttachmentId m_meshletIndexBufferAttachmentId;
+            RHI::FreeListAllocator m_meshletIndexAllocator;
+            RHI::FreeListAllocator m_meshletAllocator;
+            uint32_t m_meshletIndexCapacity = 0;
+            uint32_t m_meshletCapacity = 0;
+
+            //! The end of the highest meshlet range ever allocated, the meshlet culling pass processes all meshlets below it.
+            uint32_t m_meshletCount = 0;
+
+            //! Meshlet ranges owned by each slot, empty for the slots that aren't culled per meshlet
+            AZStd::vector<MeshletAllocation> m_meshletAllocations;
+
+            RHI::ShaderInputNameIndex m_meshletSlotsIndex = "m_cullingSlots";
+            RHI::ShaderInputNameIndex m_meshletsIndex = "m_meshlets";
+            RHI::ShaderInputNameIndex m_meshletCountIndex = "m_meshletCount";
+            RHI::ShaderInputNameIndex m_meshletSourceIndicesIndex = "m_meshletSourceIndices";
+            RHI::ShaderInputNameIndex m_meshletIndicesIndex = "m_meshletIndices";
+            RHI::ShaderInputNameIndex m_meshletIndirectArgumentsIndex = "m_indirectArguments";
+            RHI::ShaderInputNameIndex m_meshletFrustumPlanesIndex = "m_frustumPlanes";
+            RHI::ShaderInputNameIndex m_meshletViewPositionsIndex = "m_viewPositions";
+            RHI::ShaderInputNameIndex m_meshletViewCountIndex = "m_viewCount";
+
+            RHI::ShaderInputBufferIndex m_indirectArgumentsIndex;
+            RHI::ShaderInputConstantIndex m_frustumPlanesIndex;
+            RHI::ShaderInputConstantIndex m_viewCountIndex;
+
+            bool m_isSupported = false;
+            bool m_isEnabled = false;
+            bool m_isMeshletCullingEnabled = false;
+            bool m_meshletBuffersInitialized = false;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshGpuCullingPass.h>
+#include <Mesh/MeshGpuCulling.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/FrameGraphAttachmentInterface.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<MeshGpuCullingPass> MeshGpuCullingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshGpuCullingPass> pass = aznew MeshGpuCullingPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        MeshGpuCullingPass::MeshGpuCullingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+        }
+
+        MeshGpuCulling* MeshGpuCullingPass::GetActiveGpuCulling() const
+        {
+            if (!m_pipeline || !m_pipeline->GetScene())
+            {
+                return nullptr;
+            }
+
+            MeshFeatureProcessor* meshFeatureProcessor = m_pipeline->GetScene()->GetFeatureProcessor<MeshFeatureProcessor>();
+            if (!meshFeatureProcessor)
+            {
+                return nullptr;
+            }
+
+            MeshGpuCulling* gpuCulling = meshFeatureProcessor->GetGpuCulling();
+            return (gpuCulling->IsEnabled() && gpuCulling->GetSlotCount() > 0) ? gpuCulling : nullptr;
+        }
+
+        void MeshGpuCullingPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            ComputePass::SetupFrameGraphDependencies(frameGraph);
+
+            MeshGpuCulling* gpuCulling = GetActiveGpuCulling();
+            if (!gpuCulling)
+            {
+                return;
+            }
+
+            // import and attach the indirect arguments buffer, the first pipeline using it this frame imports it
+            const RHI::AttachmentId& attachmentId = gpuCulling->GetIndirectArgumentsAttachmentId();
+            if (frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId) == false)
+            {
+                [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportBuffer(attachmentId, gpuCulling->GetIndirectArgumentsBuffer());
+                AZ_Assert(result == RHI::ResultCode::Success, "Failed to import mesh GPU culling indirect arguments buffer with error %d", result);
+            }
+
+            RHI::BufferScopeAttachmentDescriptor desc;
+            desc.m_attachmentId = attachmentId;
+            desc.m_bufferViewDescriptor = gpuCulling->GetIndirectArgumentsBufferViewDescriptor();
+            desc.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+            frameGraph.UseShaderAttachment(desc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+            SetTargetThreadCounts(gpuCulling->GetSlotCount(), 1, 1);
+        }
+
+        void MeshGpuCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (MeshGpuCulling* gpuCulling = GetActiveGpuCulling(); gpuCulling && m_shaderResourceGroup)
+            {
+                gpuCulling->UpdatePassSrg(*m_shaderResourceGroup);
+            }
+
+            ComputePass::CompileResources(context);
+        }
+
+        void MeshGpuCullingPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            if (GetActiveGpuCulling())
+            {
+                ComputePass::BuildCommandListInternal(context);
+            }
+        }
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class MeshGpuCulling;
+
+        //! Tests the bounds of every GPU culled mesh draw against the view frustums of the frame and writes the indirect
+        //! arguments of the draws, see MeshGpuCulling. Must run before any pass drawing meshes.
+        class MeshGpuCullingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(MeshGpuCullingPass);
+
+        public:
+            AZ_RTTI(AZ::Render::MeshGpuCullingPass, "{7320CF6B-83D9-4D7E-9470-AFF5BA35C22B}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(MeshGpuCullingPass, SystemAllocator, 0);
+
+            //! Creates a MeshGpuCullingPass
+            static RPI::Ptr<MeshGpuCullingPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            explicit MeshGpuCullingPass(const RPI::PassDescriptor& descriptor);
+
+            //! Returns the GPU culling of the scene if mesh draws are culled on the GPU, nullptr otherwise
+            MeshGpuCulling* GetActiveGpuCulling() const;
+
+            // Scope producer functions...
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+        };
+    }   // namespace Render
+}   // namespace AZ
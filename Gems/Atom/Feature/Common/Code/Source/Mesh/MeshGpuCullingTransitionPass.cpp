@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshGpuCullingTransitionPass.h>
+#include <Mesh/MeshGpuCulling.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+
+#include <Atom/RHI/FrameGraphAttachmentInterface.h>
+#include <Atom/RHI/FrameGraphBuilder.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<MeshGpuCullingTransitionPass> MeshGpuCullingTransitionPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshGpuCullingTransitionPass> pass = aznew MeshGpuCullingTransitionPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        MeshGpuCullingTransitionPass::MeshGpuCullingTransitionPass(const RPI::PassDescriptor& descriptor)
+            : Pass(descriptor)
+        {
+        }
+
+        void MeshGpuCullingTransitionPass::BuildInternal()
+        {
+            InitScope(RHI::ScopeId(GetPathName()));
+        }
+
+        void MeshGpuCullingTransitionPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            params.m_frameGraphBuilder->ImportScopeProducer(*this);
+        }
+
+        void MeshGpuCullingTransitionPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            MeshFeatureProcessor* meshFeatureProcessor = m_pipeline->GetScene()->GetFeatureProcessor<MeshFeatureProcessor>();
+            if (!meshFeatureProcessor)
+            {
+                return;
+            }
+
+            // the buffer is only imported when the culling pass ran this frame
+            const MeshGpuCulling* gpuCulling = meshFeatureProcessor->GetGpuCulling();
+            const RHI::AttachmentId& attachmentId = gpuCulling->GetIndirectArgumentsAttachmentId();
+            if (gpuCulling->IsEnabled() && frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+            {
+                RHI::BufferScopeAttachmentDescriptor desc;
+                desc.m_attachmentId = attachmentId;
+                desc.m_bufferViewDescriptor = gpuCulling->GetIndirectArgumentsBufferViewDescriptor();
+                desc.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+                frameGraph.UseAttachment(desc, RHI::ScopeAttachmentAccess::Read, RHI::ScopeAttachmentUsage::Indirect);
+            }
+
+            // the meshlet index buffer is only imported when the meshlet culling pass ran this frame
+            const RHI::AttachmentId& meshletAttachmentId = gpuCulling->GetMeshletIndexBufferAttachmentId();
+            if (gpuCulling->IsMeshletCullingEnabled() && frameGraph.GetAttachmentDatabase().IsAttachmentValid(meshletAttachmentId))
+            {
+                RHI::BufferScopeAttachmentDescriptor desc;
+                desc.m_attachmentId = meshletAttachmentId;
+                desc.m_bufferViewDescriptor = gpuCulling->GetMeshletIndexBufferViewDescriptor();
+                desc.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+                frameGraph.UseAttachment(desc, RHI::ScopeAttachmentAccess::Read, RHI::ScopeAttachmentUsage::InputAssembly);
+            }
+        }
+
+        void MeshGpuCullingTransitionPass::BuildCommandList([[maybe_unused]] const RHI::FrameGraphExecuteContext& context)
+        {
+        }
+    }   // namespace Render
+}   // namespace AZ
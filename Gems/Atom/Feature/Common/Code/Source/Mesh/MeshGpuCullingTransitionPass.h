@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/ScopeProducer.h>
+#include <Atom/RPI.Public/Pass/Pass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Uses the mesh GPU culling indirect arguments buffer as an indirect argument source without recording any work,
+        //! so the frame graph transitions the buffer written by MeshGpuCullingPass before the passes drawing meshes read it.
+        class MeshGpuCullingTransitionPass final
+            : public RPI::Pass
+            , public RHI::ScopeProducer
+        {
+        public:
+            AZ_RPI_PASS(MeshGpuCullingTransitionPass);
+
+            AZ_RTTI(MeshGpuCullingTransitionPass, "{172C2C02-FD1D-49E3-BFBE-E67B1F48C80A}", Pass);
+            AZ_CLASS_ALLOCATOR(MeshGpuCullingTransitionPass, SystemAllocator, 0);
+
+            //! Creates a MeshGpuCullingTransitionPass
+            static RPI::Ptr<MeshGpuCullingTransitionPass> Create(const RPI::PassDescriptor& descriptor);
+
+            ~MeshGpuCullingTransitionPass() = default;
+
+        private:
+            explicit MeshGpuCullingTransitionPass(const RPI::PassDescriptor& descriptor);
+
+            // Scope producer functions
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void BuildCommandList(const RHI::FrameGraphExecuteContext& context) override;
+
+            // Pass overrides
+            void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+        };
+    }   // namespace Render
+}   // namespace AZ
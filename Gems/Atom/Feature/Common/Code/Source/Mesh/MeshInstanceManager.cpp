@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshInstanceManager.h>
+
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <Atom/Feature/RenderCommon.h>
+#include <Atom/RHI.Reflect/Bits.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/hash.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool,
+            r_meshInstancing,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Merges identical static meshes into instanced draws. Only meshes whose material shaders support the o_meshInstancing option are merged."
+        );
+
+        AZ_CVAR(float,
+            r_meshInstancingCellSize,
+            32.0f,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Size in meters of the world space grid cells used to group the meshes merged into instanced draws. Only meshes within the same cell are merged."
+        );
+
+        static const char* MeshInstancingOptionName = "o_meshInstancing";
+        static const char* InstanceObjectIdsName = "m_instanceObjectIds";
+        static constexpr uint32_t MinInstanceObjectIdCapacity = 16;
+
+        namespace
+        {
+            const MaterialAssignment& GetMeshMaterialAssignment(const MaterialAssignmentMap& materials, size_t modelLodIndex, const RPI::ModelLod::Mesh& mesh)
+            {
+                return GetMaterialAssignmentFromMapWithFallback(materials, MaterialAssignmentId(modelLodIndex, mesh.m_materialSlotStableId));
+            }
+
+            Data::Instance<RPI::Material> GetMeshMaterial(const MaterialAssignment& materialAssignment, const RPI::ModelLod::Mesh& mesh)
+            {
+                return materialAssignment.m_materialInstance ? materialAssignment.m_materialInstance : mesh.m_material;
+            }
+        }
+
+        // MeshInstanceGroupKey...
+
+        bool MeshInstanceGroupKey::operator==(const MeshInstanceGroupKey& rhs) const
+        {
+            return m_model == rhs.m_model &&
+                m_materials == rhs.m_materials &&
+                m_sortKey == rhs.m_sortKey &&
+                m_lodConfiguration.m_lodType == rhs.m_lodConfiguration.m_lodType &&
+                m_lodConfiguration.m_lodOverride == rhs.m_lodConfiguration.m_lodOverride &&
+                m_lodConfiguration.m_minimumScreenCoverage == rhs.m_lodConfiguration.m_minimumScreenCoverage &&
+                m_lodConfiguration.m_qualityDecayRate == rhs.m_lodConfiguration.m_qualityDecayRate &&
+                m_excludeFromReflectionCubeMaps == rhs.m_excludeFromReflectionCubeMaps &&
+                m_cell == rhs.m_cell;
+        }
+
+        bool MeshInstanceGroupKey::operator!=(const MeshInstanceGroupKey& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        size_t MeshInstanceGroupKey::GetHash() const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(seed, m_model);
+            for (const RPI::Material* material : m_materials)
+            {
+                AZStd::hash_combine(seed, material);
+            }
+            AZStd::hash_combine(seed, m_sortKey);
+            AZStd::hash_combine(seed, static_cast<uint32_t>(m_lodConfiguration.m_lodType));
+            AZStd::hash_combine(seed, m_lodConfiguration.m_lodOverride);
+            AZStd::hash_combine(seed, m_lodConfiguration.m_minimumScreenCoverage);
+            AZStd::hash_combine(seed, m_lodConfiguration.m_qualityDecayRate);
+            AZStd::hash_combine(seed, m_excludeFromReflectionCubeMaps);
+            AZStd::hash_combine(seed, m_cell[0], m_cell[1], m_cell[2]);
+            return seed;
+        }
+
+        // MeshInstanceManager...
+
+        void MeshInstanceManager::Activate(RPI::Scene* scene, const TransformServiceFeatureProcessor* transformService)
+        {
+            m_scene = scene;
+            m_transformService = transformService;
+            m_isEnabled = false;
+        }
+
+        void MeshInstanceManager::Deactivate()
+        {
+            for (auto& groupIter : m_groups)
+            {
+                MeshInstanceGroup& group = *groupIter.second;
+                m_scene->GetCullingScene()->UnregisterCullable(group.m_cullable);
+                for (ModelDataInstance* instance : group.m_instances)
+                {
+                    instance->m_instanceGroup = nullptr;
+                }
+            }
+            m_groups.clear();
+
+            for (ModelDataInstance* instance : m_queuedInstances)
+            {
+                instance->m_instancingUpdateQueued = false;
+            }
+            m_queuedInstances.clear();
+
+            m_scene = nullptr;
+            m_transformService = nullptr;
+            m_isEnabled = false;
+        }
+
+        bool MeshInstanceManager::IsEnabled() const
+        {
+            return m_isEnabled;
+        }
+
+        bool MeshInstanceManager::UpdateEnabled(bool allowed)
+        {
+            const bool isEnabled = r_meshInstancing && allowed;
+            if (isEnabled == m_isEnabled)
+            {
+                return false;
+            }
+
+            m_isEnabled = isEnabled;
+            return true;
+        }
+
+        void MeshInstanceManager::QueueUpdate(ModelDataInstance* instance)
+        {
+            if (!instance->m_instancingUpdateQueued)
+            {
+                instance->m_instancingUpdateQueued = true;
+                m_queuedInstances.push_back(instance);
+            }
+        }
+
+        void MeshInstanceManager::RemoveInstance(ModelDataInstance* instance)
+        {
+            if (instance->m_instanceGroup)
+            {
+                RemoveFromGroup(instance, false);
+            }
+
+            if (instance->m_instancingUpdateQueued)
+            {
+                instance->m_instancingUpdateQueued = false;
+                m_queuedInstances.erase(AZStd::remove(m_queuedInstances.begin(), m_queuedInstances.end(), instance), m_queuedInstances.end());
+            }
+        }
+
+        void MeshInstanceManager::Update(bool forceRebuildDrawPackets)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshInstanceManager: Update");
+
+            // instances whose bounds changed may have moved to another cell
+            for (auto& groupIter : m_groups)
+            {
+                MeshInstanceGroup& group = *groupIter.second;
+                if (group.m_boundsChanged.exchange(false))
+                {
+                    group.m_cullBoundsNeedsUpdate = true;
+                    for (ModelDataInstance* instance : group.m_instances)
+                    {
+                        if (instance->m_instanceBoundsChanged)
+                        {
+                            instance->m_instanceBoundsChanged = false;
+                            QueueUpdate(instance);
+                        }
+                    }
+                }
+            }
+
+            AZStd::vector<ModelDataInstance*> deferredInstances;
+            for (ModelDataInstance* instance : m_queuedInstances)
+            {
+                const bool isInstanceable = IsInstanceable(*instance);
+
+                // the instance is grouped by its world space bounds, which are only known once it was simulated
+                if (isInstanceable && !instance->m_instanceGroup && (instance->m_cullableNeedsRebuild || instance->m_cullBoundsNeedsUpdate))
+                {
+                    deferredInstances.push_back(instance);
+                    continue;
+                }
+
+                instance->m_instancingUpdateQueued = false;
+                if (instance->m_instanceGroup)
+                {
+                    if (isInstanceable && MakeKey(*instance) == instance->m_instanceGroup->m_key)
+                    {
+                        continue;
+                    }
+                    RemoveFromGroup(instance, true);
+                }
+
+                if (isInstanceable)
+                {
+                    AddToGroup(instance);
+                }
+            }
+            m_queuedInstances = AZStd::move(deferredInstances);
+
+            for (auto groupIter = m_groups.begin(); groupIter != m_groups.end();)
+            {
+                MeshInstanceGroup& group = *groupIter->second;
+                if (group.m_instances.empty())
+                {
+                    m_scene->GetCullingScene()->UnregisterCullable(group.m_cullable);
+                    groupIter = m_groups.erase(groupIter);
+                    continue;
+                }
+
+                if (group.m_instancesChanged)
+                {
+                    UpdateInstanceObjectIds(group);
+                }
+
+                if (UpdateDrawPackets(group, forceRebuildDrawPackets))
+                {
+                    BuildCullable(group);
+                }
+
+                if (group.m_cullBoundsNeedsUpdate)
+                {
+                    UpdateCullBounds(group);
+                }
+
+                group.m_instancesChanged = false;
+                ++groupIter;
+            }
+        }
+
+        bool MeshInstanceManager::IsInstanceable(const ModelDataInstance& instance) const
+        {
+            if (!m_isEnabled || !instance.m_model || !instance.m_visible)
+            {
+                return false;
+            }
+
+            // the reflection probe used by forward pass IBL specular is stored in the object SRG of each mesh
+            if (instance.m_descriptor.m_useForwardPassIblSpecular || instance.m_hasForwardPassIblSpecularMaterial)
+            {
+                return false;
+            }
+
+            if (instance.m_objectSrgList.empty())
+            {
+                return false;
+            }
+
+            for (const Data::Instance<RPI::ShaderResourceGroup>& objectSrg : instance.m_objectSrgList)
+            {
+                if (!objectSrg->FindShaderInputBufferIndex(Name(InstanceObjectIdsName)).IsValid())
+                {
+                    return false;
+                }
+            }
+
+            const Name meshInstancingOptionName(MeshInstancingOptionName);
+            const size_t modelLodCount = instance.m_model->GetLodCount();
+            for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
+            {
+                for (const RPI::ModelLod::Mesh& mesh : instance.m_model->GetLods()[modelLodIndex]->GetMeshes())
+                {
+                    if (mesh.m_drawArguments.m_type != RHI::DrawType::Indexed)
+                    {
+                        return false;
+                    }
+
+                    const MaterialAssignment& materialAssignment = GetMeshMaterialAssignment(instance.m_materialAssignments, modelLodIndex, mesh);
+                    if (!materialAssignment.m_matModUvOverrides.empty())
+                    {
+                        return false;
+                    }
+
+                    Data::Instance<RPI::Material> material = GetMeshMaterial(materialAssignment, mesh);
+                    if (!material)
+                    {
+                        return false;
+                    }
+
+                    // every shader needs the option, including the disabled ones since material properties can enable them later
+                    for (const RPI::ShaderCollection::Item& shaderItem : material->GetShaderCollection())
+                    {
+                        const RPI::ShaderOptionIndex optionIndex =
+                            shaderItem.GetShaderOptions()->GetShaderOptionLayout()->FindShaderOptionIndex(meshInstancingOptionName);
+                        if (!optionIndex.IsValid() || shaderItem.MaterialOwnsShaderOption(optionIndex))
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        MeshInstanceGroupKey MeshInstanceManager::MakeKey(const ModelDataInstance& instance) const
+        {
+            MeshInstanceGroupKey key;
+            key.m_model = instance.m_model.get();
+
+            const size_t modelLodCount = instance.m_model->GetLodCount();
+            for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
+            {
+                for (const RPI::ModelLod::Mesh& mesh : instance.m_model->GetLods()[modelLodIndex]->GetMeshes())
+                {
+                    const MaterialAssignment& materialAssignment = GetMeshMaterialAssignment(instance.m_materialAssignments, modelLodIndex, mesh);
+                    key.m_materials.push_back(GetMeshMaterial(materialAssignment, mesh).get());
+                }
+            }
+
+            key.m_sortKey = instance.m_sortKey;
+            key.m_lodConfiguration = instance.m_cullable.m_lodData.m_lodConfiguration;
+            key.m_excludeFromReflectionCubeMaps = instance.m_excludeFromReflectionCubeMaps;
+
+            const float cellSize = AZStd::max(static_cast<float>(r_meshInstancingCellSize), 1.0f);
+            const Vector3 cell = (instance.m_cullable.m_cullData.m_boundingSphere.GetCenter() / cellSize).GetFloor();
+            key.m_cell = { static_cast<int32_t>(cell.GetX()), static_cast<int32_t>(cell.GetY()), static_cast<int32_t>(cell.GetZ()) };
+            return key;
+        }
+
+        void MeshInstanceManager::AddToGroup(ModelDataInstance* instance)
+        {
+            MeshInstanceGroupKey key = MakeKey(*instance);
+            AZStd::unique_ptr<MeshInstanceGroup>& group = m_groups[key];
+            if (!group)
+            {
+                group = AZStd::make_unique<MeshInstanceGroup>();
+                group->m_key = AZStd::move(key);
+                group->m_model = instance->m_model;
+                group->m_materialAssignments = instance->m_materialAssignments;
+            }
+
+            instance->m_instanceGroup = group.get();
+            instance->m_instanceIndex = aznumeric_cast<uint32_t>(group->m_instances.size());
+            instance->m_instanceBoundsChanged = false;
+            group->m_instances.push_back(instance);
+            group->m_instancesChanged = true;
+            group->m_cullBoundsNeedsUpdate = true;
+
+            // the group draws the instance from now on
+            m_scene->GetCullingScene()->UnregisterCullable(instance->m_cullable);
+        }
+
+        void MeshInstanceManager::RemoveFromGroup(ModelDataInstance* instance, bool drawInstance)
+        {
+            MeshInstanceGroup& group = *instance->m_instanceGroup;
+
+            ModelDataInstance* lastInstance = group.m_instances.back();
+            lastInstance->m_instanceIndex = instance->m_instanceIndex;
+            group.m_instances[instance->m_instanceIndex] = lastInstance;
+            group.m_instances.pop_back();
+            group.m_instancesChanged = true;
+            group.m_cullBoundsNeedsUpdate = true;
+
+            instance->m_instanceGroup = nullptr;
+            instance->m_instanceBoundsChanged = false;
+
+            if (drawInstance)
+            {
+                // the draw packets of the instance weren't updated while it was grouped
+                instance->UpdateDrawPackets(true);
+                instance->m_cullableNeedsRebuild = true;
+                instance->m_cullBoundsNeedsUpdate = true;
+
+                // register the cullable right away, the group stops drawing the instance this frame
+                if (instance->m_visible)
+                {
+                    instance->BuildCullable();
+                    instance->UpdateCullBounds(m_transformService);
+                }
+            }
+        }
+
+        void MeshInstanceManager::BuildDrawPacketList(MeshInstanceGroup& group, size_t modelLodIndex)
+        {
+            RPI::ModelLod& modelLod = *group.m_model->GetLods()[modelLodIndex];
+            const size_t meshCount = modelLod.GetMeshes().size();
+
+            MeshInstanceGroup::DrawPacketList& drawPacketListOut = group.m_drawPacketListsByLod[modelLodIndex];
+            drawPacketListOut.clear();
+            drawPacketListOut.reserve(meshCount);
+
+            for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
+            {
+                const RPI::ModelLod::Mesh& mesh = modelLod.GetMeshes()[meshIndex];
+                const MaterialAssignment& materialAssignment = GetMeshMaterialAssignment(group.m_materialAssignments, modelLodIndex, mesh);
+                Data::Instance<RPI::Material> material = GetMeshMaterial(materialAssignment, mesh);
+
+                auto& objectSrgLayout = material->GetAsset()->GetObjectSrgLayout();
+
+                Data::Instance<RPI::ShaderResourceGroup> meshObjectSrg;
+                for (auto& objectSrgIter : group.m_objectSrgList)
+                {
+                    if (objectSrgIter->GetLayout()->GetHash() == objectSrgLayout->GetHash())
+                    {
+                        meshObjectSrg = objectSrgIter;
+                    }
+                }
+
+                if (!meshObjectSrg)
+                {
+                    auto& shaderAsset = material->GetAsset()->GetMaterialTypeAsset()->GetShaderAssetForObjectSrg();
+                    meshObjectSrg = RPI::ShaderResourceGroup::Create(shaderAsset, objectSrgLayout->GetName());
+                    if (!meshObjectSrg)
+                    {
+                        AZ_Warning("MeshInstanceManager", false, "Failed to create a new shader resource group, skipping.");
+                        continue;
+                    }
+                    group.m_objectSrgList.push_back(meshObjectSrg);
+                }
+
+                RPI::MeshDrawPacket drawPacket(modelLod, meshIndex, material, meshObjectSrg);
+                drawPacket.SetShaderOption(AZ::Name("o_meshUseForwardPassIBLSpecular"), AZ::RPI::ShaderOptionValue{ false });
+                drawPacket.SetShaderOption(AZ::Name(MeshInstancingOptionName), AZ::RPI::ShaderOptionValue{ true });
+                drawPacket.SetStencilRef(Render::StencilRefs::UseIBLSpecularPass | Render::StencilRefs::UseDiffuseGIPass);
+                drawPacket.SetSortKey(group.m_key.m_sortKey);
+                drawPacket.SetInstanceCount(aznumeric_cast<uint32_t>(group.m_instances.size()));
+                drawPacketListOut.emplace_back(AZStd::move(drawPacket));
+            }
+        }
+
+        bool MeshInstanceManager::UpdateDrawPackets(MeshInstanceGroup& group, bool forceRebuildDrawPackets)
+        {
+            bool forceUpdate = forceRebuildDrawPackets;
+            if (group.m_drawPacketListsByLod.empty())
+            {
+                const size_t modelLodCount = group.m_model->GetLodCount();
+                group.m_drawPacketListsByLod.resize(modelLodCount);
+                for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
+                {
+                    BuildDrawPacketList(group, modelLodIndex);
+                }
+                UpdateInstanceObjectIds(group);
+                forceUpdate = true;
+            }
+            else if (group.m_instancesChanged)
+            {
+                // the instance count is baked into the draw items
+                for (auto& drawPacketList : group.m_drawPacketListsByLod)
+                {
+                    for (auto& drawPacket : drawPacketList)
+                    {
+                        drawPacket.SetInstanceCount(aznumeric_cast<uint32_t>(group.m_instances.size()));
+                    }
+                }
+                forceUpdate = true;
+            }
+
+            bool rebuilt = false;
+            for (auto& drawPacketList : group.m_drawPacketListsByLod)
+            {
+                for (auto& drawPacket : drawPacketList)
+                {
+                    rebuilt |= drawPacket.Update(*m_scene, forceUpdate);
+                }
+            }
+            return rebuilt;
+        }
+
+        void MeshInstanceManager::UpdateInstanceObjectIds(MeshInstanceGroup& group)
+        {
+            if (group.m_objectSrgList.empty())
+            {
+                return;
+            }
+
+            AZStd::vector<uint32_t> objectIds;
+            objectIds.reserve(group.m_instances.size());
+            for (const ModelDataInstance* instance : group.m_instances)
+            {
+                objectIds.push_back(instance->m_objectId.GetIndex());
+            }
+
+            const uint64_t byteCount = objectIds.size() * sizeof(uint32_t);
+            if (!group.m_instanceObjectIdBuffer || group.m_instanceObjectIdBuffer->GetBufferSize() < byteCount)
+            {
+                const uint32_t capacity = AZStd::max(RHI::NextPowerOfTwo(aznumeric_cast<uint32_t>(objectIds.size())), MinInstanceObjectIdCapacity);
+                if (group.m_instanceObjectIdBuffer)
+                {
+                    group.m_instanceObjectIdBuffer->Resize(capacity * sizeof(uint32_t));
+                }
+                else
+                {
+                    RPI::CommonBufferDescriptor desc;
+                    desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                    desc.m_bufferName = "MeshInstanceObjectIds";
+                    desc.m_byteCount = capacity * sizeof(uint32_t);
+                    desc.m_elementSize = sizeof(uint32_t);
+                    group.m_instanceObjectIdBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                    if (!group.m_instanceObjectIdBuffer)
+                    {
+                        AZ_Error("MeshInstanceManager", false, "Failed to create the instance object id buffer");
+                        return;
+                    }
+                }
+            }
+            group.m_instanceObjectIdBuffer->UpdateData(objectIds.data(), byteCount, 0);
+
+            for (auto& objectSrg : group.m_objectSrgList)
+            {
+                RHI::ShaderInputNameIndex objectIdIndex = "m_objectId";
+                objectSrg->SetConstant(objectIdIndex, objectIds.front());
+
+                RHI::ShaderInputNameIndex instanceObjectIdsIndex = InstanceObjectIdsName;
+                objectSrg->SetBufferView(instanceObjectIdsIndex, group.m_instanceObjectIdBuffer->GetBufferView());
+                objectSrg->Compile();
+            }
+        }
+
+        void MeshInstanceManager::BuildCullable(MeshInstanceGroup& group)
+        {
+            RPI::Cullable::CullData& cullData = group.m_cullable.m_cullData;
+            RPI::Cullable::LodData& lodData = group.m_cullable.m_lodData;
+
+            // lods are selected for the whole group, as if every instance was at the center of the group bounds
+            lodData.m_lodConfiguration = group.m_key.m_lodConfiguration;
+            lodData.m_lodSelectionRadius = 0.5f * group.m_instances.front()->m_aabb.GetExtents().GetMaxElement();
+
+            const size_t lodCount = group.m_drawPacketListsByLod.size();
+            lodData.m_lods.resize(lodCount);
+            cullData.m_drawListMask.reset();
+
+            for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+            {
+                RPI::Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
+                lod.m_screenCoverageMax = (lodIndex == 0)
+                    ? 1.0f
+                    : AZStd::GetMax(lodData.m_lods[lodIndex - 1].m_screenCoverageMin, lodData.m_lodConfiguration.m_minimumScreenCoverage);
+                lod.m_screenCoverageMin = (lodIndex < lodCount - 1)
+                    ? AZStd::GetMax(lodData.m_lodConfiguration.m_qualityDecayRate * lod.m_screenCoverageMax, lodData.m_lodConfiguration.m_minimumScreenCoverage)
+                    : lodData.m_lodConfiguration.m_minimumScreenCoverage;
+
+                lod.m_drawPackets.clear();
+                for (const RPI::MeshDrawPacket& meshDrawPacket : group.m_drawPacketListsByLod[lodIndex])
+                {
+                    const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
+                    if (rhiDrawPacket)
+                    {
+                        cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
+                        lod.m_drawPackets.push_back(rhiDrawPacket);
+                    }
+                }
+            }
+
+            cullData.m_hideFlags = group.m_key.m_excludeFromReflectionCubeMaps ? RPI::View::UsageReflectiveCubeMap : RPI::View::UsageNone;
+            cullData.m_scene = m_scene;
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            group.m_cullable.SetDebugName(AZ::Name(AZStd::string::format("%s - instanced", group.m_model->GetModelAsset()->GetName().GetCStr())));
+#endif
+
+            group.m_cullBoundsNeedsUpdate = true;
+        }
+
+        void MeshInstanceManager::UpdateCullBounds(MeshInstanceGroup& group)
+        {
+            Aabb bounds = Aabb::CreateNull();
+            for (const ModelDataInstance* instance : group.m_instances)
+            {
+                bounds.AddAabb(instance->m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume);
+            }
+
+            Vector3 center;
+            float radius;
+            bounds.GetAsSphere(center, radius);
+
+            RPI::Cullable::CullData& cullData = group.m_cullable.m_cullData;
+            cullData.m_boundingSphere = Sphere(center, radius);
+            cullData.m_boundingObb = Obb::CreateFromAabb(bounds);
+            cullData.m_visibilityEntry.m_boundingVolume = bounds;
+            cullData.m_visibilityEntry.m_userData = &group.m_cullable;
+            cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
+            m_scene->GetCullingScene()->RegisterOrUpdateCullable(group.m_cullable);
+
+            group.m_cullBoundsNeedsUpdate = false;
+        }
+    } // namespace Render
+} // namespace AZ
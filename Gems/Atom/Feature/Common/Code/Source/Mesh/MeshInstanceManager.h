@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/Model/Model.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Material;
+        class Scene;
+        class ShaderResourceGroup;
+    }
+
+    namespace Render
+    {
+        class ModelDataInstance;
+        class TransformServiceFeatureProcessor;
+
+        //! Identifies the meshes that can be merged into the same instanced draws. Meshes are only merged if they use the same model,
+        //! the same materials and the same draw settings, and if the centers of their bounds lie in the same cell of a world space grid,
+        //! so the bounds of each group stay tight enough for culling and lod selection.
+        struct MeshInstanceGroupKey
+        {
+            bool operator==(const MeshInstanceGroupKey& rhs) const;
+            bool operator!=(const MeshInstanceGroupKey& rhs) const;
+            size_t GetHash() const;
+
+            const RPI::Model* m_model = nullptr;
+            AZStd::vector<const RPI::Material*> m_materials; //!< the material of every sub mesh of every lod, in model order
+            RHI::DrawItemSortKey m_sortKey = 0;
+            RPI::Cullable::LodConfiguration m_lodConfiguration;
+            bool m_excludeFromReflectionCubeMaps = false;
+            AZStd::array<int32_t, 3> m_cell = { 0, 0, 0 };
+        };
+
+        struct MeshInstanceGroupKeyHasher
+        {
+            size_t operator()(const MeshInstanceGroupKey& key) const
+            {
+                return key.GetHash();
+            }
+        };
+
+        //! A set of identical meshes drawn with a single instanced draw per sub mesh.
+        //! The object ids of the instances are stored in a buffer bound to the object SRG of the group, which the shaders use to
+        //! fetch the transform of each instance from the transform service buffers.
+        struct MeshInstanceGroup
+        {
+            using DrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
+
+            MeshInstanceGroupKey m_key;
+            Data::Instance<RPI::Model> m_model;
+            MaterialAssignmentMap m_materialAssignments;
+            AZStd::vector<ModelDataInstance*> m_instances;
+
+            AZStd::fixed_vector<DrawPacketList, RPI::ModelLodAsset::LodCountMax> m_drawPacketListsByLod;
+            AZStd::vector<Data::Instance<RPI::ShaderResourceGroup>> m_objectSrgList;
+            Data::Instance<RPI::Buffer> m_instanceObjectIdBuffer;
+            RPI::Cullable m_cullable;
+
+            //! Set while simulating the meshes when the bounds of an instance changed
+            AZStd::atomic_bool m_boundsChanged{ false };
+            bool m_cullBoundsNeedsUpdate = false;
+            bool m_instancesChanged = false;
+        };
+
+        //! Merges identical static meshes of the MeshFeatureProcessor into instanced draws.
+        //! Meshes are only merged if every shader of their materials supports the o_meshInstancing option, see MeshInstancing.azsli.
+        //! A merged mesh keeps its transform, object id and object SRG, but its own draw packets and cullable aren't used anymore,
+        //! the group draws it instead. All functions must be called on the thread owning the MeshFeatureProcessor, outside of
+        //! the mesh simulation jobs.
+        class MeshInstanceManager
+        {
+        public:
+            void Activate(RPI::Scene* scene, const TransformServiceFeatureProcessor* transformService);
+            void Deactivate();
+
+            //! Returns true if meshes should be merged into instanced draws, requires r_meshInstancing to be enabled.
+            bool IsEnabled() const;
+
+            //! Re-evaluates whether meshes should be merged into instanced draws.
+            //! @param allowed false if another feature prevents instancing, like the GPU culling of the mesh draws
+            //! @return true if the value returned by IsEnabled() changed, in which case every mesh needs to be queued again
+            bool UpdateEnabled(bool allowed);
+
+            //! Queues a mesh to have its group re-evaluated during the next Update(), after anything affecting its draws changed.
+            void QueueUpdate(ModelDataInstance* instance);
+
+            //! Removes a mesh from its group and from the update queue, before it is released or re-initialized.
+            void RemoveInstance(ModelDataInstance* instance);
+
+            //! Moves the queued meshes between groups and rebuilds the groups that changed.
+            //! Must be called once the meshes were simulated, since grouping the meshes requires their world space bounds.
+            //! @param forceRebuildDrawPackets true to rebuild the draw packets of all groups
+            void Update(bool forceRebuildDrawPackets);
+
+        private:
+            using GroupMap = AZStd::unordered_map<MeshInstanceGroupKey, AZStd::unique_ptr<MeshInstanceGroup>, MeshInstanceGroupKeyHasher>;
+
+            //! Returns true if the draws of the mesh can be merged with the draws of identical meshes
+            bool IsInstanceable(const ModelDataInstance& instance) const;
+
+            MeshInstanceGroupKey MakeKey(const ModelDataInstance& instance) const;
+            void AddToGroup(ModelDataInstance* instance);
+
+            //! @param drawInstance true to draw the mesh through its own draw packets again
+            void RemoveFromGroup(ModelDataInstance* instance, bool drawInstance);
+
+            void BuildDrawPacketList(MeshInstanceGroup& group, size_t modelLodIndex);
+            //! @return true if any draw packet was rebuilt
+            bool UpdateDrawPackets(MeshInstanceGroup& group, bool forceRebuildDrawPackets);
+            void UpdateInstanceObjectIds(MeshInstanceGroup& group);
+            void BuildCullable(MeshInstanceGroup& group);
+            void UpdateCullBounds(MeshInstanceGroup& group);
+
+            RPI::Scene* m_scene = nullptr;
+            const TransformServiceFeatureProcessor* m_transformService = nullptr;
+            GroupMap m_groups;
+            AZStd::vector<ModelDataInstance*> m_queuedInstances;
+            bool m_isEnabled = false;
+        };
+    } // namespace Render
+} // namespace AZ
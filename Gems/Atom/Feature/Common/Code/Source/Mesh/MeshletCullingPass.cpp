@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshletCullingPass.h>
+#include <Mesh/MeshGpuCulling.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/FrameGraphAttachmentInterface.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<MeshletCullingPass> MeshletCullingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshletCullingPass> pass = aznew MeshletCullingPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        MeshletCullingPass::MeshletCullingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+        }
+
+        MeshGpuCulling* MeshletCullingPass::GetActiveGpuCulling() const
+        {
+            if (!m_pipeline || !m_pipeline->GetScene())
+            {
+                return nullptr;
+            }
+
+            MeshFeatureProcessor* meshFeatureProcessor = m_pipeline->GetScene()->GetFeatureProcessor<MeshFeatureProcessor>();
+            if (!meshFeatureProcessor)
+            {
+                return nullptr;
+            }
+
+            MeshGpuCulling* gpuCulling = meshFeatureProcessor->GetGpuCulling();
+            return (gpuCulling->IsMeshletCullingEnabled() && gpuCulling->GetSlotCount() > 0 && gpuCulling->GetMeshletCount() > 0)
+                ? gpuCulling
+                : nullptr;
+        }
+
+        void MeshletCullingPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            ComputePass::SetupFrameGraphDependencies(frameGraph);
+
+            MeshGpuCulling* gpuCulling = GetActiveGpuCulling();
+            if (!gpuCulling)
+            {
+                return;
+            }
+
+            // the indirect arguments buffer is normally imported by the MeshGpuCullingPass that runs first
+            const RHI::AttachmentId& indirectArgumentsAttachmentId = gpuCulling->GetIndirectArgumentsAttachmentId();
+            if (frameGraph.GetAttachmentDatabase().IsAttachmentValid(indirectArgumentsAttachmentId) == false)
+            {
+                [[maybe_unused]] RHI::ResultCode result =
+                    frameGraph.GetAttachmentDatabase().ImportBuffer(indirectArgumentsAttachmentId, gpuCulling->GetIndirectArgumentsBuffer());
+                AZ_Assert(result == RHI::ResultCode::Success, "Failed to import mesh GPU culling indirect arguments buffer with error %d", result);
+            }
+
+            const RHI::AttachmentId& indexBufferAttachmentId = gpuCulling->GetMeshletIndexBufferAttachmentId();
+            if (frameGraph.GetAttachmentDatabase().IsAttachmentValid(indexBufferAttachmentId) == false)
+            {
+                [[maybe_unused]] RHI::ResultCode result =
+                    frameGraph.GetAttachmentDatabase().ImportBuffer(indexBufferAttachmentId, gpuCulling->GetMeshletIndexBuffer());
+                AZ_Assert(result == RHI::ResultCode::Success, "Failed to import meshlet culling index buffer with error %d", result);
+            }
+
+            RHI::BufferScopeAttachmentDescriptor desc;
+            desc.m_attachmentId = indirectArgumentsAttachmentId;
+            desc.m_bufferViewDescriptor = gpuCulling->GetIndirectArgumentsBufferViewDescriptor();
+            desc.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+            frameGraph.UseShaderAttachment(desc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+            desc.m_attachmentId = indexBufferAttachmentId;
+            desc.m_bufferViewDescriptor = gpuCulling->GetMeshletIndexBufferViewDescriptor();
+            frameGraph.UseShaderAttachment(desc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+            // one group per meshlet, in rows of MeshletsPerDispatchRow groups
+            const uint32_t meshletCount = gpuCulling->GetMeshletCount();
+            const uint32_t rowCount = (meshletCount + MeshGpuCulling::MeshletsPerDispatchRow - 1) / MeshGpuCulling::MeshletsPerDispatchRow;
+            SetTargetThreadCounts(AZStd::min(meshletCount, MeshGpuCulling::MeshletsPerDispatchRow) * 64, rowCount, 1);
+        }
+
+        void MeshletCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (MeshGpuCulling* gpuCulling = GetActiveGpuCulling(); gpuCulling && m_shaderResourceGroup)
+            {
+                gpuCulling->UpdateMeshletPassSrg(*m_shaderResourceGroup);
+            }
+
+            ComputePass::CompileResources(context);
+        }
+
+        void MeshletCullingPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            if (GetActiveGpuCulling())
+            {
+                ComputePass::BuildCommandListInternal(context);
+            }
+        }
+    }   // namespace Render
+}   // namespace AZ
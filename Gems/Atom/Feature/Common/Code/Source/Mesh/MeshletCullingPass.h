@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class MeshGpuCulling;
+
+        //! Tests every meshlet of the meshes culled per meshlet against the view frustums and the view positions of the frame, and
+        //! writes the indices of the visible meshlets to the meshlet index buffer, see MeshGpuCulling.
+        //! Must run after the MeshGpuCullingPass and before any pass drawing meshes.
+        class MeshletCullingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(MeshletCullingPass);
+
+        public:
+            AZ_RTTI(AZ::Render::MeshletCullingPass, "{5C0B8E0F-3D52-4B8E-A5C4-62F9B2C7D7E1}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(MeshletCullingPass, SystemAllocator, 0);
+
+            //! Creates a MeshletCullingPass
+            static RPI::Ptr<MeshletCullingPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            explicit MeshletCullingPass(const RPI::PassDescriptor& descriptor);
+
+            //! Returns the GPU culling of the scene if mesh draws are culled per meshlet, nullptr otherwise
+            MeshGpuCulling* GetActiveGpuCulling() const;
+
+            // Scope producer functions...
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+        };
+    }   // namespace Render
+}   // namespace AZ
@@ -174,6 +174,11 @@ namespace AZ
             return m_rootConstantData.GetConstant<float>(m_weightIndex);
         }
 
+        bool MorphTargetDispatchItem::HasWeight() const
+        {
+            return AZ::GetAbs(GetWeight()) > AZ::Constants::FloatEpsilon;
+        }
+
         const RHI::DispatchItem& MorphTargetDispatchItem::GetRHIDispatchItem() const
         {
             return m_dispatchItem;
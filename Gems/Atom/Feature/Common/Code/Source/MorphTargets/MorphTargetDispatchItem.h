@@ -62,6 +62,9 @@ namespace AZ
 
             void SetWeight(float weight);
             float GetWeight() const;
+            //! Returns false when the weight is too close to zero for the morph target to have any effect, so it doesn't need to be dispatched.
+            //! Negative weights still need to be dispatched.
+            bool HasWeight() const;
         private:
             bool InitPerInstanceSRG();
             void InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout);
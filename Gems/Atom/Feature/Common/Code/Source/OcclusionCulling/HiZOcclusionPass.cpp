@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <OcclusionCulling/HiZOcclusionPass.h>
+
+#include <Atom/RPI.Public/HiZOcclusion.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Console/IConsole.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool,
+            r_hiZOcclusionCulling,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Culls the objects hidden behind the depth buffer of a previous frame, read back from the HiZOcclusionPass, instead of rasterizing the occlusion planes."
+        );
+
+        static const char* HiZOcclusionOutputSlotName = "Output";
+
+        RPI::Ptr<HiZOcclusionPass> HiZOcclusionPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<HiZOcclusionPass> pass = aznew HiZOcclusionPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        HiZOcclusionPass::HiZOcclusionPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+            m_readback = AZStd::make_shared<RPI::AttachmentReadback>(RHI::ScopeId{ "HiZOcclusionReadback" });
+        }
+
+        void HiZOcclusionPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            RPI::ViewPtr view = GetView();
+            if (!r_hiZOcclusionCulling || !view)
+            {
+                if (RPI::ViewPtr occludedView = m_occludedView.lock())
+                {
+                    occludedView->SetHiZOcclusion(nullptr);
+                }
+                // a readback still in flight would hand its depth to the view again
+                if (m_readback->GetReadbackState() == RPI::AttachmentReadback::ReadbackState::Idle)
+                {
+                    m_occludedView.reset();
+                }
+                ComputePass::FrameBeginInternal(params);
+                return;
+            }
+
+            if (RPI::ViewPtr occludedView = m_occludedView.lock(); occludedView && occludedView != view)
+            {
+                occludedView->SetHiZOcclusion(nullptr);
+            }
+            m_occludedView = view;
+
+            // keep a single readback in flight, the next one starts once the depth of the previous one was handed to the view
+            if (m_readback->GetReadbackState() == RPI::AttachmentReadback::ReadbackState::Idle)
+            {
+                // the callback runs on another thread once the GPU is done, it only keeps what it needs and not the pass
+                AZStd::weak_ptr<RPI::View> weakView = view;
+                const Matrix4x4 worldToClip = view->GetWorldToClipMatrix();
+                m_readback->SetCallback([weakView, worldToClip](const RPI::AttachmentReadback::ReadbackResult& result)
+                    {
+                        RPI::ViewPtr readbackView = weakView.lock();
+                        if (!readbackView || result.m_state != RPI::AttachmentReadback::ReadbackState::Success || !result.m_dataBuffer)
+                        {
+                            return;
+                        }
+
+                        const RHI::Size& size = result.m_imageDescriptor.m_size;
+                        const AZStd::span<const float> depth(
+                            reinterpret_cast<const float*>(result.m_dataBuffer->data()), result.m_dataBuffer->size() / sizeof(float));
+                        readbackView->SetHiZOcclusion(AZStd::make_shared<RPI::HiZOcclusion>(worldToClip, size.m_width, size.m_height, depth));
+                    });
+                ReadbackAttachment(m_readback, Name(HiZOcclusionOutputSlotName));
+            }
+
+            ComputePass::FrameBeginInternal(params);
+        }
+
+        void HiZOcclusionPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            if (r_hiZOcclusionCulling)
+            {
+                ComputePass::BuildCommandListInternal(context);
+            }
+        }
+    }   // namespace Render
+}   // namespace AZ
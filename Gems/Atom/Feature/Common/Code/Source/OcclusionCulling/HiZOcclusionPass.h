@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Reduces the depth buffer of the view to a small image holding the farthest depth of each block of pixels, and reads it
+        //! back to the CPU where it becomes the RPI::HiZOcclusion of the view. The CullingScene then skips the objects hidden behind
+        //! that depth, in place of rasterizing the occlusion planes with Masked Occlusion Culling.
+        //! The readback takes a few frames, so the depth is always from a previous frame and the objects are reprojected into
+        //! the view of that frame when tested. Enabled with r_hiZOcclusionCulling.
+        class HiZOcclusionPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(HiZOcclusionPass);
+
+        public:
+            AZ_RTTI(AZ::Render::HiZOcclusionPass, "{2C6A4E55-1B7F-4E0C-9D3A-6B48E1F0C2D7}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(HiZOcclusionPass, SystemAllocator, 0);
+
+            //! Creates a HiZOcclusionPass
+            static RPI::Ptr<HiZOcclusionPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            explicit HiZOcclusionPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            // Scope producer functions...
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            AZStd::shared_ptr<RPI::AttachmentReadback> m_readback;
+            //! The view that received the last read back depth, to clear it once the pass is disabled
+            AZStd::weak_ptr<RPI::View> m_occludedView;
+        };
+    }   // namespace Render
+}   // namespace AZ
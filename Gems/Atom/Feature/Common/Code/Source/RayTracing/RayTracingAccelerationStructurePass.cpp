@@ -16,11 +16,16 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <RayTracing/RayTracingAccelerationStructurePass.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_rayTracingBlasBuildBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Max number of sub-mesh BLAS objects built per frame, the meshes waiting for their BLAS are left out of the TLAS until it is built. "
+            "0 builds all of them on the frame the meshes are added");
+
         RPI::Ptr<RayTracingAccelerationStructurePass> RayTracingAccelerationStructurePass::Create(const RPI::PassDescriptor& descriptor)
         {
             RPI::Ptr<RayTracingAccelerationStructurePass> rayTracingAccelerationStructurePass = aznew RayTracingAccelerationStructurePass(descriptor);
@@ -57,12 +62,37 @@ namespace AZ
 
             if (rayTracingFeatureProcessor)
             {
-                if (rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision)
+                m_rebuildTlas = rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision || m_blasBuildsPending;
+                if (m_rebuildTlas)
                 {
                     RHI::RayTracingBufferPools& rayTracingBufferPools = rayTracingFeatureProcessor->GetBufferPools();
                     RayTracingFeatureProcessor::MeshMap& rayTracingMeshes = rayTracingFeatureProcessor->GetMeshes();
                     uint32_t rayTracingSubMeshCount = rayTracingFeatureProcessor->GetSubMeshCount();
 
+                    // pick the BLAS objects to build this frame, at least one model is built per frame so the builds always progress
+                    m_blasBuildAssetIds.clear();
+                    m_blasBuildsPending = false;
+                    const uint32_t blasBuildBudget = r_rayTracingBlasBuildBudget;
+                    uint32_t blasBuildCount = 0;
+                    for (const auto& blasInstance : rayTracingFeatureProcessor->GetBlasInstances())
+                    {
+                        if (blasInstance.second.m_blasBuilt)
+                        {
+                            continue;
+                        }
+
+                        const uint32_t subMeshCount = aznumeric_cast<uint32_t>(blasInstance.second.m_subMeshes.size());
+                        if (blasBuildBudget > 0 && blasBuildCount > 0 && blasBuildCount + subMeshCount > blasBuildBudget)
+                        {
+                            m_blasBuildsPending = true;
+                            continue;
+                        }
+
+                        m_blasBuildAssetIds.insert(blasInstance.first);
+                        blasBuildCount += subMeshCount;
+                    }
+                    const RayTracingFeatureProcessor::BlasInstanceMap& blasInstances = rayTracingFeatureProcessor->GetBlasInstances();
+
                     // create the TLAS descriptor
                     RHI::RayTracingTlasDescriptor tlasDescriptor;
                     RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build();
@@ -70,6 +100,16 @@ namespace AZ
                     uint32_t blasIndex = 0;
                     for (auto& rayTracingMesh : rayTracingMeshes)
                     {
+                        // the meshes waiting for their BLAS are left out, the instance IDs still match the ray tracing mesh data
+                        const auto blasInstanceIt = blasInstances.find(rayTracingMesh.second.m_assetId);
+                        const bool blasReady = blasInstanceIt == blasInstances.end() || blasInstanceIt->second.m_blasBuilt ||
+                            m_blasBuildAssetIds.contains(rayTracingMesh.second.m_assetId);
+                        if (!blasReady)
+                        {
+                            blasIndex++;
+                            continue;
+                        }
+
                         for (auto& rayTracingSubMesh : rayTracingMesh.second.m_subMeshes)
                         {
                             tlasDescriptorBuild->Instance()
@@ -134,7 +174,7 @@ namespace AZ
                 return;
             }
 
-            if (rayTracingFeatureProcessor->GetRevision() == m_rayTracingRevision)
+            if (!m_rebuildTlas)
             {
                 // TLAS is up to date
                 return;
@@ -149,11 +189,11 @@ namespace AZ
                 return;
             }
 
-            // build newly added BLAS objects
+            // build the newly added BLAS objects selected for this frame
             RayTracingFeatureProcessor::BlasInstanceMap& blasInstances = rayTracingFeatureProcessor->GetBlasInstances();
             for (auto& blasInstance : blasInstances)
             {
-                if (blasInstance.second.m_blasBuilt == false)
+                if (blasInstance.second.m_blasBuilt == false && m_blasBuildAssetIds.contains(blasInstance.first))
                 {
                     for (auto& blasInstanceSubMesh : blasInstance.second.m_subMeshes)
                     {
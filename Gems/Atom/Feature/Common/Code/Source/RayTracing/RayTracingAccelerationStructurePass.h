@@ -11,6 +11,8 @@
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 #include <Atom/RHI/RayTracingBufferPools.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_set.h>
 
 namespace AZ
 {
@@ -48,6 +50,15 @@ namespace AZ
 
             // revision number of the ray tracing data when the TLAS was built
             uint32_t m_rayTracingRevision = 0;
+
+            // set when the TLAS is rebuilt this frame, because the ray tracing data changed or BLAS objects were waiting to be built
+            bool m_rebuildTlas = false;
+
+            // set when the build budget left BLAS objects to build on the next frames
+            bool m_blasBuildsPending = false;
+
+            // models whose BLAS objects are built this frame, see r_rayTracingBlasBuildBudget
+            AZStd::unordered_set<AZ::Data::AssetId> m_blasBuildAssetIds;
         };
     }   // namespace RPI
 }   // namespace AZ
@@ -16,14 +16,120 @@
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Pass/EnvironmentCubeMapPassData.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImagePool.h>
+#include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
+#include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobFunction.h>
+
+AZ_CVAR(uint32_t, r_reflectionProbeRefreshFaceSize, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Face size of the reflection probe cubemaps refreshed at runtime, rounded down to a power of two. The faces are rendered at full size and downsampled while filtering.");
 
 namespace AZ
 {
     namespace Render
     {
+        namespace
+        {
+            // the specular lookup in GetRoughnessMip() expects the same number of mips as the baked cubemaps
+            static const uint32_t RefreshedCubeMapMipLevels = 6;
+
+            static float HalfToFloat(uint16_t half)
+            {
+                const uint32_t sign = uint32_t(half & 0x8000u) << 16;
+                uint32_t exponent = (half >> 10) & 0x1Fu;
+                uint32_t mantissa = half & 0x3FFu;
+                uint32_t bits = sign;
+                if (exponent == 0x1Fu)
+                {
+                    bits |= 0x7F800000u | (mantissa << 13);
+                }
+                else if (exponent != 0)
+                {
+                    bits |= ((exponent + 112) << 23) | (mantissa << 13);
+                }
+                else if (mantissa != 0)
+                {
+                    // denormal, normalize it
+                    exponent = 113;
+                    while ((mantissa & 0x400u) == 0)
+                    {
+                        mantissa <<= 1;
+                        --exponent;
+                    }
+                    bits |= (exponent << 23) | ((mantissa & 0x3FFu) << 13);
+                }
+
+                float result;
+                memcpy(&result, &bits, sizeof(result));
+                return result;
+            }
+
+            static uint16_t FloatToHalf(float value)
+            {
+                uint32_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+                const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+                const uint32_t floatExponent = (bits >> 23) & 0xFFu;
+                const int32_t exponent = static_cast<int32_t>(floatExponent) - 127 + 15;
+                uint32_t mantissa = bits & 0x7FFFFFu;
+
+                if (floatExponent == 0xFFu)
+                {
+                    // keep NaNs, clamp infinities to the largest half like any other overflow
+                    return mantissa ? static_cast<uint16_t>(sign | 0x7E00u) : static_cast<uint16_t>(sign | 0x7BFFu);
+                }
+                if (exponent >= 0x1F)
+                {
+                    return static_cast<uint16_t>(sign | 0x7BFFu);
+                }
+                if (exponent <= 0)
+                {
+                    if (exponent < -10)
+                    {
+                        return sign;
+                    }
+                    mantissa |= 0x800000u;
+                    const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+                    return static_cast<uint16_t>(sign | ((mantissa + (1u << (shift - 1))) >> shift));
+                }
+                return static_cast<uint16_t>(sign | ((static_cast<uint32_t>(exponent) << 10) + ((mantissa + 0x1000u) >> 13)));
+            }
+
+            // box filters an RGBA face to half its size
+            static void DownsampleFace(const AZStd::vector<float>& source, uint32_t sourceSize, AZStd::vector<float>& target)
+            {
+                const uint32_t targetSize = sourceSize / 2;
+                target.resize(targetSize * targetSize * 4);
+                for (uint32_t y = 0; y < targetSize; ++y)
+                {
+                    const float* row0 = &source[(2 * y) * sourceSize * 4];
+                    const float* row1 = row0 + sourceSize * 4;
+                    float* targetRow = &target[y * targetSize * 4];
+                    for (uint32_t x = 0; x < targetSize; ++x)
+                    {
+                        for (uint32_t channel = 0; channel < 4; ++channel)
+                        {
+                            const uint32_t offset = 8 * x + channel;
+                            targetRow[4 * x + channel] = 0.25f * (row0[offset] + row0[offset + 4] + row1[offset] + row1[offset + 4]);
+                        }
+                    }
+                }
+            }
+        }
+
         ReflectionProbe::~ReflectionProbe()
         {
             Data::AssetBus::MultiHandler::BusDisconnect();
+
+            if (m_environmentCubeMapPass)
+            {
+                // the probe was removed while its cubemap was being rendered
+                m_scene->RemoveRenderPipeline(m_environmentCubeMapPipelineId);
+            }
+
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
             m_meshFeatureProcessor->ReleaseMesh(m_visualizationMeshHandle);
         }
@@ -116,12 +222,15 @@ namespace AZ
                     m_callback(m_environmentCubeMapPass->GetTextureData(), m_environmentCubeMapPass->GetTextureFormat());
 
                     // restore exposures
-                    sceneSrg->SetConstant(m_globalIblExposureConstantIndex, m_previousGlobalIblExposure);
-                    sceneSrg->SetConstant(m_skyBoxExposureConstantIndex, m_previousSkyBoxExposure);
+                    if (m_overrideBakeExposure)
+                    {
+                        sceneSrg->SetConstant(m_globalIblExposureConstantIndex, m_previousGlobalIblExposure);
+                        sceneSrg->SetConstant(m_skyBoxExposureConstantIndex, m_previousSkyBoxExposure);
+                    }
 
                     m_buildingCubeMap = false;
                 }
-                else
+                else if (m_overrideBakeExposure)
                 {
                     // set exposures to the user specified value while baking the cubemap
                     sceneSrg->SetConstant(m_globalIblExposureConstantIndex, m_bakeExposure);
@@ -283,8 +392,165 @@ namespace AZ
                 return;
             }
 
+            StartCubeMapBuild(callback, true);
+        }
+
+        void ReflectionProbe::RefreshCubeMap()
+        {
+            if (m_buildingCubeMap || m_refreshingCubeMap)
+            {
+                return;
+            }
+
+            m_refreshingCubeMap = true;
+
+            // the scene exposures are left untouched, overriding them for the frames rendering the faces would change the lighting of the main view
+            StartCubeMapBuild(
+                [this]([[maybe_unused]] uint8_t* const* cubeMapTextureData, const RHI::Format cubeMapTextureFormat)
+                {
+                    if (cubeMapTextureFormat == RHI::Format::R16G16B16A16_FLOAT)
+                    {
+                        FilterRefreshedCubeMap();
+                    }
+                    else
+                    {
+                        AZ_Error("ReflectionProbe", false, "Unsupported cubemap format %s for a runtime refresh", RHI::ToString(cubeMapTextureFormat));
+                        m_refreshingCubeMap = false;
+                    }
+                },
+                false);
+        }
+
+        void ReflectionProbe::FilterRefreshedCubeMap()
+        {
+            AZStd::shared_ptr<RefreshedCubeMap> refreshedCubeMap = AZStd::make_shared<RefreshedCubeMap>();
+
+            // the pass owns the face data, keep it alive until the job is done with it
+            refreshedCubeMap->m_environmentCubeMapPass = m_environmentCubeMapPass;
+
+            uint32_t faceSize = AZStd::clamp<uint32_t>(r_reflectionProbeRefreshFaceSize, 1u << (RefreshedCubeMapMipLevels - 1), RPI::EnvironmentCubeMapPass::CubeMapFaceSize);
+            while ((faceSize & (faceSize - 1)) != 0)
+            {
+                faceSize &= faceSize - 1;
+            }
+            refreshedCubeMap->m_faceSize = faceSize;
+            m_refreshedCubeMap = refreshedCubeMap;
+
+            const auto filterJobLambda = [refreshedCubeMap]()
+            {
+                AZ_PROFILE_SCOPE(AzRender, "ReflectionProbe: FilterRefreshedCubeMap");
+
+                const uint32_t NumCubeMapFaces = RPI::EnvironmentCubeMapPass::NumCubeMapFaces;
+                const uint32_t sourceFaceSize = RPI::EnvironmentCubeMapPass::CubeMapFaceSize;
+                uint8_t* const* faceData = refreshedCubeMap->m_environmentCubeMapPass->GetTextureData();
+
+                // mip 0 is box filtered down from the rendered faces, and each following mip from the previous one, which
+                // approximates the roughness convolution of the baked cubemaps
+                refreshedCubeMap->m_mipFaceData.resize(RefreshedCubeMapMipLevels * NumCubeMapFaces);
+                AZStd::vector<float> source;
+                AZStd::vector<float> target;
+                for (uint32_t face = 0; face < NumCubeMapFaces; ++face)
+                {
+                    source.resize(sourceFaceSize * sourceFaceSize * 4);
+                    const uint16_t* halves = reinterpret_cast<const uint16_t*>(faceData[face]);
+                    for (size_t index = 0; index < source.size(); ++index)
+                    {
+                        source[index] = halves ? HalfToFloat(halves[index]) : 0.0f;
+                    }
+
+                    uint32_t size = sourceFaceSize;
+                    for (uint32_t mip = 0; mip < RefreshedCubeMapMipLevels; ++mip)
+                    {
+                        while (size > (refreshedCubeMap->m_faceSize >> mip))
+                        {
+                            DownsampleFace(source, size, target);
+                            source.swap(target);
+                            size /= 2;
+                        }
+
+                        AZStd::vector<uint16_t>& mipData = refreshedCubeMap->m_mipFaceData[mip * NumCubeMapFaces + face];
+                        mipData.resize(size * size * 4);
+                        for (size_t index = 0; index < mipData.size(); ++index)
+                        {
+                            mipData[index] = FloatToHalf(source[index]);
+                        }
+                    }
+                }
+
+                refreshedCubeMap->m_filterComplete = true;
+            };
+
+            AZ::Job* filterJob = AZ::CreateJobFunction(AZStd::move(filterJobLambda), true, nullptr); //auto-deletes
+            filterJob->Start();
+        }
+
+        bool ReflectionProbe::UpdateCubeMapRefresh()
+        {
+            if (!m_refreshedCubeMap || !m_refreshedCubeMap->m_filterComplete)
+            {
+                return false;
+            }
+
+            AZStd::shared_ptr<RefreshedCubeMap> refreshedCubeMap = AZStd::move(m_refreshedCubeMap);
+            m_refreshedCubeMap = nullptr;
+            m_refreshingCubeMap = false;
+
+            // release the pass and its face data here rather than on the job thread
+            refreshedCubeMap->m_environmentCubeMapPass = nullptr;
+
+            const uint32_t NumCubeMapFaces = RPI::EnvironmentCubeMapPass::NumCubeMapFaces;
+            const RHI::Format format = RHI::Format::R16G16B16A16_FLOAT;
+
+            RPI::ImageMipChainAssetCreator mipChainAssetCreator;
+            mipChainAssetCreator.Begin(Data::AssetId(Uuid::CreateRandom()), aznumeric_cast<uint16_t>(RefreshedCubeMapMipLevels), aznumeric_cast<uint16_t>(NumCubeMapFaces));
+            for (uint32_t mip = 0; mip < RefreshedCubeMapMipLevels; ++mip)
+            {
+                const uint32_t mipSize = refreshedCubeMap->m_faceSize >> mip;
+                mipChainAssetCreator.BeginMip(RHI::GetImageSubresourceLayout(RHI::Size(mipSize, mipSize, 1), format));
+                for (uint32_t face = 0; face < NumCubeMapFaces; ++face)
+                {
+                    const AZStd::vector<uint16_t>& mipData = refreshedCubeMap->m_mipFaceData[mip * NumCubeMapFaces + face];
+                    mipChainAssetCreator.AddSubImage(mipData.data(), mipData.size() * sizeof(uint16_t));
+                }
+                mipChainAssetCreator.EndMip();
+            }
+            Data::Asset<RPI::ImageMipChainAsset> mipChainAsset;
+            mipChainAssetCreator.End(mipChainAsset);
+
+            RHI::ImageDescriptor imageDescriptor = RHI::ImageDescriptor::CreateCubemap(RHI::ImageBindFlags::ShaderRead, refreshedCubeMap->m_faceSize, format);
+            imageDescriptor.m_mipLevels = aznumeric_cast<uint16_t>(RefreshedCubeMapMipLevels);
+
+            RPI::StreamingImageAssetCreator imageAssetCreator;
+            imageAssetCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
+            imageAssetCreator.SetPoolAssetId(RPI::ImageSystemInterface::Get()->GetSystemStreamingPool()->GetAssetId());
+            imageAssetCreator.SetFlags(RPI::StreamingImageFlags::None);
+            imageAssetCreator.SetImageDescriptor(imageDescriptor);
+            imageAssetCreator.SetImageViewDescriptor(RHI::ImageViewDescriptor::CreateCubemap());
+            imageAssetCreator.AddMipChainAsset(*mipChainAsset);
+            Data::Asset<RPI::StreamingImageAsset> imageAsset;
+            if (!imageAssetCreator.End(imageAsset))
+            {
+                AZ_Error("ReflectionProbe", false, "Failed to create the refreshed reflection probe cubemap");
+                return false;
+            }
+
+            Data::Instance<RPI::StreamingImage> cubeMapImage = RPI::StreamingImage::FindOrCreate(imageAsset);
+            if (!cubeMapImage)
+            {
+                AZ_Error("ReflectionProbe", false, "Failed to create the refreshed reflection probe cubemap");
+                return false;
+            }
+
+            // the previous cubemap was in use until now, swap in the refreshed one
+            SetCubeMapImage(cubeMapImage, m_cubeMapRelativePath);
+            return true;
+        }
+
+        void ReflectionProbe::StartCubeMapBuild(BuildCubeMapCallback callback, bool overrideExposure)
+        {
             m_buildingCubeMap = true;
             m_callback = callback;
+            m_overrideBakeExposure = overrideExposure;
 
             AZ::RPI::RenderPipelineDescriptor environmentCubeMapPipelineDesc;
             environmentCubeMapPipelineDesc.m_mainViewTagName = "MainCamera";
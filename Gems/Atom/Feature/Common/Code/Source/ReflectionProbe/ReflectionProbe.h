@@ -18,6 +18,7 @@
 #include <Atom/RPI.Public/PipelineState.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -102,6 +103,15 @@ namespace AZ
             void BuildCubeMap(BuildCubeMapCallback callback);
             bool IsBuildingCubeMap() { return m_buildingCubeMap; }
 
+            // initiates a runtime refresh of the cubemap, the faces are rendered one per frame and filtered on a job thread,
+            // and the current cubemap stays in use until the refreshed one is complete so the lighting never changes mid-refresh
+            void RefreshCubeMap();
+            bool IsRefreshingCubeMap() const { return m_refreshingCubeMap; }
+
+            // called by the feature processor every frame, swaps in the refreshed cubemap once it is filtered
+            // returns true if the cubemap image changed
+            bool UpdateCubeMapRefresh();
+
             // called by the feature processor so the probe can set the default view for the pipeline
             void OnRenderPipelinePassesChanged(RPI::RenderPipeline* renderPipeline);
 
@@ -128,6 +138,11 @@ namespace AZ
 
             void UpdateCulling();
 
+            void StartCubeMapBuild(BuildCubeMapCallback callback, bool overrideExposure);
+
+            // starts the job filtering the faces rendered for a runtime refresh
+            void FilterRefreshedCubeMap();
+
             // AZ::Data::AssetBus::Handler overrides...
             void OnAssetReady(Data::Asset<Data::AssetData> asset) override;
             void OnAssetError(Data::Asset<Data::AssetData> asset) override;
@@ -186,6 +201,18 @@ namespace AZ
             float m_previousGlobalIblExposure = 0.0f;
             float m_previousSkyBoxExposure = 0.0f;
             bool m_buildingCubeMap = false;
+            bool m_overrideBakeExposure = true;
+
+            // runtime cubemap refresh, the filter job fills the mip chain of all faces and then sets m_filterComplete
+            struct RefreshedCubeMap
+            {
+                RPI::Ptr<RPI::EnvironmentCubeMapPass> m_environmentCubeMapPass;
+                uint32_t m_faceSize = 0;
+                AZStd::vector<AZStd::vector<uint16_t>> m_mipFaceData; // [mip * NumCubeMapFaces + face]
+                AZStd::atomic_bool m_filterComplete{ false };
+            };
+            AZStd::shared_ptr<RefreshedCubeMap> m_refreshedCubeMap;
+            bool m_refreshingCubeMap = false;
         };
 
     } // namespace Render
@@ -18,6 +18,11 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <AzCore/Console/IConsole.h>
+AZ_CVAR(uint32_t, r_reflectionProbeMaxConcurrentRefreshes, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of reflection probes refreshing their cubemap at runtime at the same time, each one renders a cubemap face per frame.");
+
 namespace AZ
 {
     namespace Render
@@ -87,6 +92,8 @@ namespace AZ
 
             DisableSceneNotification();
 
+            m_refreshQueue.clear();
+
             if (m_bufferPool)
             {
                 m_bufferPool.reset();
@@ -156,6 +163,8 @@ namespace AZ
                 meshFeatureProcessor->UpdateMeshReflectionProbes();
             }
 
+            UpdateProbeRefreshes();
+
             // call Simulate on all reflection probes
             for (uint32_t probeIndex = 0; probeIndex < m_reflectionProbes.size(); ++probeIndex)
             {
@@ -166,6 +175,68 @@ namespace AZ
             }
         }
 
+        void ReflectionProbeFeatureProcessor::UpdateProbeRefreshes()
+        {
+            // swap in the cubemaps of the completed refreshes
+            bool cubeMapsChanged = false;
+            uint32_t refreshingProbeCount = 0;
+            for (auto& reflectionProbe : m_reflectionProbes)
+            {
+                cubeMapsChanged |= reflectionProbe->UpdateCubeMapRefresh();
+                refreshingProbeCount += reflectionProbe->IsRefreshingCubeMap() ? 1 : 0;
+            }
+
+            if (cubeMapsChanged)
+            {
+                // notify the MeshFeatureProcessor that the reflection probes changed
+                MeshFeatureProcessor* meshFeatureProcessor = GetParentScene()->GetFeatureProcessor<MeshFeatureProcessor>();
+                meshFeatureProcessor->UpdateMeshReflectionProbes();
+            }
+
+            if (m_refreshQueue.empty() || refreshingProbeCount >= r_reflectionProbeMaxConcurrentRefreshes)
+            {
+                return;
+            }
+
+            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+            RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetDefaultRenderPipeline();
+            if (renderPipeline && renderPipeline->GetDefaultView())
+            {
+                cameraPosition = renderPipeline->GetDefaultView()->GetCameraTransform().GetTranslation();
+            }
+
+            while (!m_refreshQueue.empty() && refreshingProbeCount < r_reflectionProbeMaxConcurrentRefreshes)
+            {
+                // the queue is small, find the closest probe instead of keeping it sorted while the camera moves
+                auto closestProbeIt = m_refreshQueue.end();
+                float closestDistanceSq = AZStd::numeric_limits<float>::max();
+                for (auto probeIt = m_refreshQueue.begin(); probeIt != m_refreshQueue.end(); ++probeIt)
+                {
+                    // a probe being baked is refreshed once the bake is done
+                    if ((*probeIt)->IsBuildingCubeMap())
+                    {
+                        continue;
+                    }
+
+                    const float distanceSq = (*probeIt)->GetPosition().GetDistanceSq(cameraPosition);
+                    if (distanceSq < closestDistanceSq)
+                    {
+                        closestDistanceSq = distanceSq;
+                        closestProbeIt = probeIt;
+                    }
+                }
+
+                if (closestProbeIt == m_refreshQueue.end())
+                {
+                    break;
+                }
+
+                (*closestProbeIt)->RefreshCubeMap();
+                m_refreshQueue.erase(closestProbeIt);
+                ++refreshingProbeCount;
+            }
+        }
+
         void ReflectionProbeFeatureProcessor::OnRenderEnd()
         {
             // call OnRenderEnd on all reflection probes
@@ -201,6 +272,12 @@ namespace AZ
 
             AZ_Assert(itEntry != m_reflectionProbes.end(), "RemoveProbe called with a probe that is not in the probe list");
             m_reflectionProbes.erase(itEntry);
+
+            auto itRefresh = AZStd::find(m_refreshQueue.begin(), m_refreshQueue.end(), probe);
+            if (itRefresh != m_refreshQueue.end())
+            {
+                m_refreshQueue.erase(itRefresh);
+            }
         }
 
         void ReflectionProbeFeatureProcessor::SetProbeOuterExtents(const ReflectionProbeHandle& probe, const Vector3& outerExtents)
@@ -306,6 +383,15 @@ namespace AZ
             probe->SetBakeExposure(bakeExposure);
         }
 
+        void ReflectionProbeFeatureProcessor::RefreshProbe(const ReflectionProbeHandle& probe)
+        {
+            AZ_Assert(probe.get(), "RefreshProbe called with an invalid handle");
+            if (AZStd::find(m_refreshQueue.begin(), m_refreshQueue.end(), probe) == m_refreshQueue.end())
+            {
+                m_refreshQueue.push_back(probe);
+            }
+        }
+
         void ReflectionProbeFeatureProcessor::FindReflectionProbes(const Vector3& position, ReflectionProbeVector& reflectionProbes)
         {
             reflectionProbes.clear();
@@ -41,6 +41,7 @@ namespace AZ
             void ShowProbeVisualization(const ReflectionProbeHandle& probe, bool showVisualization) override;
             void SetRenderExposure(const ReflectionProbeHandle& probe, float renderExposure) override;
             void SetBakeExposure(const ReflectionProbeHandle& probe, float bakeExposure) override;
+            void RefreshProbe(const ReflectionProbeHandle& probe) override;
 
             // FeatureProcessor overrides
             void Activate() override;
@@ -71,6 +72,9 @@ namespace AZ
 
             void UpdatePipelineStates();
 
+            // starts the refresh of the queued probes closest to the camera, up to r_reflectionProbeMaxConcurrentRefreshes at a time
+            void UpdateProbeRefreshes();
+
             // AssetBus::MultiHandler overrides...
             void OnAssetReady(Data::Asset<Data::AssetData> asset) override;
             void OnAssetError(Data::Asset<Data::AssetData> asset) override;
@@ -82,6 +86,9 @@ namespace AZ
             const size_t InitialProbeAllocationSize = 64;
             ReflectionProbeVector m_reflectionProbes;
 
+            // probes waiting for a runtime refresh of their cubemap
+            ReflectionProbeVector m_refreshQueue;
+
             // list of cubemap assets that we need to check during Simulate() to see if they are ready
             struct NotifyCubeMapAssetEntry
             {
@@ -25,6 +25,7 @@
 
 #include <Atom/RHI/CommandList.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
@@ -34,6 +35,13 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_skinningUpdateRateReduction, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to skin the meshes covering a small part of the screen every 2nd or 4th frame, reusing their skinned vertices in between");
+        AZ_CVAR(float, r_skinningHalfRateScreenPercentage, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Screen coverage below which skinned meshes are updated every 2nd frame when r_skinningUpdateRateReduction is set");
+        AZ_CVAR(float, r_skinningQuarterRateScreenPercentage, 0.03f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Screen coverage below which skinned meshes are updated every 4th frame when r_skinningUpdateRateReduction is set");
+
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
@@ -153,7 +161,7 @@ namespace AZ
                                             for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
                                             {
                                                 const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
+                                                if (dispatchItem && dispatchItem->HasWeight())
                                                 {
                                                     m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
                                                 }
@@ -172,6 +180,10 @@ namespace AZ
                 }
             }
 #else  //[GFX_TODO][ATOM-13564] This is a temporary implementation that submits all of the skinning compute shaders without any culling:
+            ++m_frameIndex;
+            m_updatedRenderProxyCount = 0;
+            m_skippedRenderProxyCount = 0;
+
             for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
             {
                 renderProxy.m_isQueuedForCompile = false;
@@ -189,6 +201,9 @@ namespace AZ
                 ModelDataInstance& modelDataInstance = **renderProxy.m_meshHandle;
                 const RPI::Cullable& cullable = modelDataInstance.GetCullable();
 
+                // Gather the lods used by any view, and the biggest screen coverage to pick the update rate
+                uint32_t lodMask = 0;
+                float maxScreenPercentage = 0.0f;
                 for (const RPI::ViewPtr& viewPtr : packet.m_views)
                 {
                     RPI::View* view = viewPtr.get();
@@ -208,17 +223,9 @@ namespace AZ
                     {
                     case RPI::Cullable::LodType::SpecificLod:
                     {
-                        AZStd::lock_guard lock(m_dispatchItemMutex);
-                        auto lodIndex = cullable.m_lodData.m_lodConfiguration.m_lodOverride;
-                        m_skinningDispatches.insert(&renderProxy.m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
-                        for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                        {
-                            const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                            if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                            {
-                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                            }
-                        }
+                        lodMask |= 1u << cullable.m_lodData.m_lodConfiguration.m_lodOverride;
+                        // The screen coverage is unknown, keep updating every frame
+                        maxScreenPercentage = FLT_MAX;
                     }
                     break;
                     case RPI::Cullable::LodType::ScreenCoverage:
@@ -233,6 +240,7 @@ namespace AZ
 
                         const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
                             pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                        maxScreenPercentage = AZStd::max(maxScreenPercentage, approxScreenPercentage);
 
                         for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
                         {
@@ -241,21 +249,36 @@ namespace AZ
                             //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                             if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                             {
-                                AZStd::lock_guard lock(m_dispatchItemMutex);
-                                m_skinningDispatches.insert(&renderProxy.m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
-                                for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                                {
-                                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                    if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                    {
-                                        m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
+                                lodMask |= 1u << lodIndex;
                             }
                         }
                         break;
                     }
                 }
+
+                if (lodMask == 0)
+                {
+                    continue;
+                }
+
+                // A lod that wasn't skinned last time has no valid skinned vertices to reuse
+                const uint32_t updateInterval = GetSkinningUpdateInterval(maxScreenPercentage);
+                const bool hasNewLods = (lodMask & ~renderProxy.m_skinnedLodMask) != 0;
+                if (!hasNewLods && (m_frameIndex + renderProxy.m_skinningUpdatePhase) % updateInterval != 0)
+                {
+                    ++m_skippedRenderProxyCount;
+                    continue;
+                }
+
+                renderProxy.m_skinnedLodMask = lodMask;
+                ++m_updatedRenderProxyCount;
+                for (size_t lodIndex = 0; lodIndex < renderProxy.m_dispatchItemsByLod.size(); ++lodIndex)
+                {
+                    if (lodMask & (1u << lodIndex))
+                    {
+                        QueueDispatchItems(renderProxy, lodIndex);
+                    }
+                }
             }
 #endif
         }
@@ -288,6 +311,37 @@ namespace AZ
             m_morphTargetDispatches.clear();
         }
 
+        uint32_t SkinnedMeshFeatureProcessor::GetSkinningUpdateInterval(float screenPercentage)
+        {
+            if (!r_skinningUpdateRateReduction)
+            {
+                return 1;
+            }
+            if (screenPercentage < r_skinningQuarterRateScreenPercentage)
+            {
+                return 4;
+            }
+            if (screenPercentage < r_skinningHalfRateScreenPercentage)
+            {
+                return 2;
+            }
+            return 1;
+        }
+
+        void SkinnedMeshFeatureProcessor::QueueDispatchItems(const SkinnedMeshRenderProxy& renderProxy, size_t lodIndex)
+        {
+            AZStd::lock_guard lock(m_dispatchItemMutex);
+            m_skinningDispatches.insert(&renderProxy.m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
+            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
+            {
+                const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
+                if (dispatchItem && dispatchItem->HasWeight())
+                {
+                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
+                }
+            }
+        }
+
         SkinnedMeshRenderProxyHandle SkinnedMeshFeatureProcessor::AcquireRenderProxy(const SkinnedMeshRenderProxyDesc& desc)
         {
             // don't need to check the concurrency during emplace() because the StableDynamicArray won't move the other elements during insertion
@@ -296,6 +350,11 @@ namespace AZ
             {
                 m_renderProxies.erase(handle);
             }
+            else
+            {
+                // Spread the updates of the meshes skinned at a reduced rate over the frames
+                handle->m_skinningUpdatePhase = m_nextSkinningUpdatePhase++;
+            }
             return handle;
         }
 
@@ -68,6 +68,12 @@ namespace AZ
 
             void InitSkinningAndMorphPass(RPI::RenderPipeline* renderPipeline);
 
+            //! Returns the number of frames between two updates of a skinned mesh covering the given part of the screen.
+            static uint32_t GetSkinningUpdateInterval(float screenPercentage);
+
+            //! Adds the skinning and morph target dispatch items of a lod to the dispatches of the frame.
+            void QueueDispatchItems(const SkinnedMeshRenderProxy& renderProxy, size_t lodIndex);
+
             SkinnedMeshRenderProxyInterfaceHandle AcquireRenderProxyInterface(const SkinnedMeshRenderProxyDesc& desc) override;
             bool ReleaseRenderProxyInterface(SkinnedMeshRenderProxyInterfaceHandle& handle) override;
 
@@ -87,6 +93,12 @@ namespace AZ
             AZStd::unordered_set<const RHI::DispatchItem*> m_morphTargetDispatches;
             AZStd::mutex m_dispatchItemMutex;
 
+            uint32_t m_frameIndex = 0;
+            uint32_t m_nextSkinningUpdatePhase = 0;
+            // Render proxies skinned during the last frame, and those reusing the skinned vertices of a previous frame
+            size_t m_updatedRenderProxyCount = 0;
+            size_t m_skippedRenderProxyCount = 0;
+
         };
     } // namespace Render
 } // namespace AZ
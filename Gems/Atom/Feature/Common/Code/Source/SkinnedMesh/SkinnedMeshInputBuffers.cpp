@@ -21,6 +21,7 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/PackedVector3.h>
 
 AZ_DECLARE_BUDGET(AzRender);
@@ -368,116 +369,88 @@ namespace AZ
             return viewDescriptor;
         }
 
-        static bool AllocateLodStream(
-            uint8_t outputStreamIndex,
-            size_t vertexCount,
-            AZStd::intrusive_ptr<SkinnedMeshInstance> instance,
-            AZStd::vector<uint32_t>& streamOffsetsFromBufferStart,
-            AZStd::vector<AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation>>& lodAllocations)
+        static size_t GetLodStreamSizeInBytes(uint8_t outputStreamIndex, size_t vertexCount)
         {
             const SkinnedMeshOutputVertexStreamInfo& outputStreamInfo = SkinnedMeshVertexStreamPropertyInterface::Get()->GetOutputStreamInfo(static_cast<SkinnedMeshOutputVertexStreams>(outputStreamIndex));
 
             // Positions use 2x the number of vertices to hold both the current frame and previous frame's data
             size_t positionMultiplier = static_cast<SkinnedMeshOutputVertexStreams>(outputStreamIndex) == SkinnedMeshOutputVertexStreams::Position ? 2u : 1u;
-            AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation> allocation = SkinnedMeshOutputStreamManagerInterface::Get()->Allocate(vertexCount * static_cast<size_t>(outputStreamInfo.m_elementSize) * positionMultiplier);
-            if (!allocation)
-            {
-                // Suppress the OnMemoryFreed signal when releasing the previous successful allocations
-                // The memory was already free before this function was called, so it's not really newly available memory
-                AZ_Error("SkinnedMeshInputBuffers", false, "Out of memory to create a skinned mesh instance. Consider increasing r_skinnedMeshInstanceMemoryPoolSize");
+            return vertexCount * static_cast<size_t>(outputStreamInfo.m_elementSize) * positionMultiplier;
+        }
 
-                instance->m_allocations.push_back(lodAllocations);
-                instance->SuppressSignalOnDeallocate();
-                return false;
+        static size_t GetMorphTargetDeltaSizeInBytes(const SkinnedMeshInputLod& lod, size_t vertexCount)
+        {
+            // If this skinned mesh lod has morph targets, it needs a buffer for the accumulated deltas that come from the morph target pass
+            if (lod.GetMorphTargetMetaDatas().empty())
+            {
+                return 0;
             }
-            lodAllocations.push_back(allocation);
-            streamOffsetsFromBufferStart.push_back(aznumeric_cast<uint32_t>(allocation->GetVirtualAddress().m_ptr));
 
-            return true;
+            // Naively, we're going to allocate enough memory to store the accumulated delta for every vertex.
+            // This makes it simple for the skinning shader to index into the buffer, but the memory cost
+            // could be reduced by keeping a buffer that maps from vertexId to morph target delta offset ATOM-14427
+
+            // We're also using the skinned mesh output buffer, since it gives us a read-write pool of memory that can be
+            // used for dependency tracking between passes. This can be switched to a transient memory pool so that the memory is free
+            // later in the frame once skinning is finished ATOM-14429
+
+            size_t perVertexSizeInBytes = static_cast<size_t>(MorphTargetConstants::s_unpackedMorphTargetDeltaSizeInBytes) * MorphTargetConstants::s_morphTargetDeltaTypeCount;
+            if (lod.HasDynamicColors())
+            {
+                // Naively, if colors are morphed by any of the morph targets,
+                // we'll allocate enough memory to store the accumulated color deltas for every vertex in the lod.
+                // This could be reduced by ATOM-14427
+          
+                // We assume that the model has been padded to include colors even for the meshes which don't use them
+                // this could be reduced by dispatching the skinning shade
+                // for one mesh at a time instead of the entire lod at once ATOM-15078
+
+                // Add four floats for colors
+                perVertexSizeInBytes += 4 * sizeof(float);
+            }
+            return vertexCount * perVertexSizeInBytes;
         }
 
-        static bool AllocateMorphTargetsForLod(const SkinnedMeshInputLod& lod, size_t vertexCount, AZStd::intrusive_ptr<SkinnedMeshInstance> instance, AZStd::vector<AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation>>& lodAllocations)
+        static void AddMorphTargetInstanceMetaData(const SkinnedMeshInputLod& lod, size_t vertexCount, size_t offsetInBytes, AZStd::intrusive_ptr<SkinnedMeshInstance> instance)
         {
-            // If this skinned mesh lod has morph targets, allocate a buffer for the accumulated deltas that come from the morph target pass
-            if (lod.GetMorphTargetMetaDatas().size() > 0)
+            if (lod.GetMorphTargetMetaDatas().empty())
             {
-                // Naively, we're going to allocate enough memory to store the accumulated delta for every vertex.
-                // This makes it simple for the skinning shader to index into the buffer, but the memory cost
-                // could be reduced by keeping a buffer that maps from vertexId to morph target delta offset ATOM-14427
+                // No morph targets for this lod
+                MorphTargetInstanceMetaData instanceMetaData{ MorphTargetConstants::s_invalidDeltaOffset, MorphTargetConstants::s_invalidDeltaOffset, MorphTargetConstants::s_invalidDeltaOffset, MorphTargetConstants::s_invalidDeltaOffset };
+                instance->m_morphTargetInstanceMetaData.push_back(instanceMetaData);
+                return;
+            }
 
-                // We're also using the skinned mesh output buffer, since it gives us a read-write pool of memory that can be
-                // used for dependency tracking between passes. This can be switched to a transient memory pool so that the memory is free
-                // later in the frame once skinning is finished ATOM-14429
+            // We're using an offset into a global buffer to be able to access the morph target offsets in a bindless manner.
+            // The offset can at most be a 32-bit uint until AZSL supports 64-bit uints. This gives us a 4GB limit for where the
+            // morph target deltas can live. In practice, the offsets could end up outside that range even if less that 4GB is used
+            // if the memory becomes fragmented. To address it, we can split morph target deltas into their own buffer, allocate
+            // memory in pages with a buffer for each page, or create and bind a buffer view
+            // so we are not doing an offset from the beginning of the buffer
+            AZ_Error("SkinnedMeshInputBuffers", offsetInBytes < static_cast<size_t>(std::numeric_limits<uint32_t>::max()), "Morph target deltas allocated from the skinned mesh memory pool are outside the range that can be accessed from the skinning shader");
 
-                size_t perVertexSizeInBytes = static_cast<size_t>(MorphTargetConstants::s_unpackedMorphTargetDeltaSizeInBytes) * MorphTargetConstants::s_morphTargetDeltaTypeCount;
-                if (lod.HasDynamicColors())
-                {
-                    // Naively, if colors are morphed by any of the morph targets,
-                    // we'll allocate enough memory to store the accumulated color deltas for every vertex in the lod.
-                    // This could be reduced by ATOM-14427
-          
-                    // We assume that the model has been padded to include colors even for the meshes which don't use them
-                    // this could be reduced by dispatching the skinning shade
-                    // for one mesh at a time instead of the entire lod at once ATOM-15078
+            MorphTargetInstanceMetaData instanceMetaData;
 
-                    // Add four floats for colors
-                    perVertexSizeInBytes += 4 * sizeof(float);
-                }
+            // Positions start at the beginning of the deltas
+            instanceMetaData.m_accumulatedPositionDeltaOffsetInBytes = static_cast<int32_t>(offsetInBytes);
+            uint32_t deltaStreamSizeInBytes = static_cast<uint32_t>(vertexCount * MorphTargetConstants::s_unpackedMorphTargetDeltaSizeInBytes);
 
-                AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation> allocation = SkinnedMeshOutputStreamManagerInterface::Get()->Allocate(vertexCount * perVertexSizeInBytes);
-                if (!allocation)
-                {
-                    // Suppress the OnMemoryFreed signal when releasing the previous successful allocations
-                    // The memory was already free before this function was called, so it's not really newly available memory
-                    AZ_Error("SkinnedMeshInputBuffers", false, "Out of memory to create a skinned mesh instance. Consider increasing r_skinnedMeshInstanceMemoryPoolSize");
-                    instance->m_allocations.push_back(lodAllocations);
-                    instance->SuppressSignalOnDeallocate();
-                    return false;
-                }
-                else
-                {
-                    // We're using an offset into a global buffer to be able to access the morph target offsets in a bindless manner.
-                    // The offset can at most be a 32-bit uint until AZSL supports 64-bit uints. This gives us a 4GB limit for where the
-                    // morph target deltas can live. In practice, the offsets could end up outside that range even if less that 4GB is used
-                    // if the memory becomes fragmented. To address it, we can split morph target deltas into their own buffer, allocate
-                    // memory in pages with a buffer for each page, or create and bind a buffer view
-                    // so we are not doing an offset from the beginning of the buffer
-                    AZ_Error("SkinnedMeshInputBuffers", allocation->GetVirtualAddress().m_ptr < static_cast<uintptr_t>(std::numeric_limits<uint32_t>::max()), "Morph target deltas allocated from the skinned mesh memory pool are outside the range that can be accessed from the skinning shader");
-
-                    MorphTargetInstanceMetaData instanceMetaData;
-
-                    // Positions start at the beginning of the allocation
-                    instanceMetaData.m_accumulatedPositionDeltaOffsetInBytes = static_cast<int32_t>(allocation->GetVirtualAddress().m_ptr);
-                    uint32_t deltaStreamSizeInBytes = static_cast<uint32_t>(vertexCount * MorphTargetConstants::s_unpackedMorphTargetDeltaSizeInBytes);
-
-                    // Followed by normals, tangents, and bitangents
-                    instanceMetaData.m_accumulatedNormalDeltaOffsetInBytes = instanceMetaData.m_accumulatedPositionDeltaOffsetInBytes + deltaStreamSizeInBytes;
-                    instanceMetaData.m_accumulatedTangentDeltaOffsetInBytes = instanceMetaData.m_accumulatedNormalDeltaOffsetInBytes + deltaStreamSizeInBytes;
-                    instanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes = instanceMetaData.m_accumulatedTangentDeltaOffsetInBytes + deltaStreamSizeInBytes;
-
-                    // Followed by colors
-                    if (lod.HasDynamicColors())
-                    {
-                        instanceMetaData.m_accumulatedColorDeltaOffsetInBytes = instanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes + deltaStreamSizeInBytes;
-                    }
-                    else
-                    {
-                        instanceMetaData.m_accumulatedColorDeltaOffsetInBytes = MorphTargetConstants::s_invalidDeltaOffset;
-                    }
+            // Followed by normals, tangents, and bitangents
+            instanceMetaData.m_accumulatedNormalDeltaOffsetInBytes = instanceMetaData.m_accumulatedPositionDeltaOffsetInBytes + deltaStreamSizeInBytes;
+            instanceMetaData.m_accumulatedTangentDeltaOffsetInBytes = instanceMetaData.m_accumulatedNormalDeltaOffsetInBytes + deltaStreamSizeInBytes;
+            instanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes = instanceMetaData.m_accumulatedTangentDeltaOffsetInBytes + deltaStreamSizeInBytes;
 
-                    // Track both the allocation and the metadata in the instance
-                    instance->m_morphTargetInstanceMetaData.push_back(instanceMetaData);
-                    lodAllocations.push_back(allocation);
-                }
+            // Followed by colors
+            if (lod.HasDynamicColors())
+            {
+                instanceMetaData.m_accumulatedColorDeltaOffsetInBytes = instanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes + deltaStreamSizeInBytes;
             }
             else
             {
-                // No morph targets for this lod
-                MorphTargetInstanceMetaData instanceMetaData{ MorphTargetConstants::s_invalidDeltaOffset, MorphTargetConstants::s_invalidDeltaOffset, MorphTargetConstants::s_invalidDeltaOffset, MorphTargetConstants::s_invalidDeltaOffset };
-                instance->m_morphTargetInstanceMetaData.push_back(instanceMetaData);
+                instanceMetaData.m_accumulatedColorDeltaOffsetInBytes = MorphTargetConstants::s_invalidDeltaOffset;
             }
 
-            return true;
+            instance->m_morphTargetInstanceMetaData.push_back(instanceMetaData);
         }
 
 
@@ -571,9 +544,11 @@ namespace AZ
                 // Only uv0 for now
                 modelLodCreator.AddLodStreamBuffer(lod.m_staticBufferAssets[static_cast<uint8_t>(SkinnedMeshStaticVertexStreams::UV_0)]);
 
-                // Track offsets for each stream, so that the sub-meshes know where to begin
-                AZStd::vector<uint32_t> streamOffsetsFromBufferStart;
-                AZStd::vector<AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation>> lodAllocations;
+                // All the streams of the lod and its morph target deltas are sub-allocated from a single block, instead of an allocation per stream.
+                // An instance that is released then frees a few large blocks that fit the next instances, rather than scattering holes the size of
+                // a single stream between the streams of other instances, which fragments the pool as actors stream in and out.
+                AZStd::vector<size_t> streamOffsetsFromLodStart;
+                size_t lodSizeInBytes = 0;
 
                 // The skinning shader doesn't differentiate between sub-meshes, it just writes all the vertices at once.
                 // So we want to pack all the positions for each sub-mesh together, all the normals together, etc.
@@ -585,17 +560,41 @@ namespace AZ
                         continue;
                     }
 
-                    if (!AllocateLodStream(outputStreamIndex, aznumeric_cast<size_t>(lod.m_vertexCount), instance, streamOffsetsFromBufferStart, lodAllocations))
-                    {
-                        return nullptr;
-                    }
+                    // The block is aligned to every element size, so aligning the offset within the block keeps the typed views valid
+                    const SkinnedMeshOutputVertexStreamInfo& outputStreamInfo = SkinnedMeshVertexStreamPropertyInterface::Get()->GetOutputStreamInfo(static_cast<SkinnedMeshOutputVertexStreams>(outputStreamIndex));
+                    const size_t streamOffset = RoundUpToMultiple(lodSizeInBytes, static_cast<size_t>(outputStreamInfo.m_elementSize));
+                    streamOffsetsFromLodStart.push_back(streamOffset);
+                    lodSizeInBytes = streamOffset + GetLodStreamSizeInBytes(outputStreamIndex, aznumeric_cast<size_t>(lod.m_vertexCount));
                 }
 
-                if (!AllocateMorphTargetsForLod(lod, lod.m_vertexCount, instance, lodAllocations))
+                const size_t morphTargetDeltaOffset = RoundUpToMultiple(lodSizeInBytes, 4 * sizeof(float));
+                const size_t morphTargetDeltaSizeInBytes = GetMorphTargetDeltaSizeInBytes(lod, lod.m_vertexCount);
+                if (morphTargetDeltaSizeInBytes > 0)
                 {
+                    lodSizeInBytes = morphTargetDeltaOffset + morphTargetDeltaSizeInBytes;
+                }
+
+                AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation> allocation = SkinnedMeshOutputStreamManagerInterface::Get()->Allocate(lodSizeInBytes);
+                if (!allocation)
+                {
+                    // Suppress the OnMemoryFreed signal when releasing the previous successful allocations
+                    // The memory was already free before this function was called, so it's not really newly available memory
+                    AZ_Error("SkinnedMeshInputBuffers", false, "Out of memory to create a skinned mesh instance. Consider increasing r_skinnedMeshInstanceMemoryPoolSize");
+                    instance->SuppressSignalOnDeallocate();
                     return nullptr;
                 }
 
+                // Track offsets for each stream, so that the sub-meshes know where to begin
+                const size_t lodOffsetInBytes = allocation->GetVirtualAddress().m_ptr;
+                AZStd::vector<uint32_t> streamOffsetsFromBufferStart;
+                for (size_t streamOffset : streamOffsetsFromLodStart)
+                {
+                    streamOffsetsFromBufferStart.push_back(aznumeric_cast<uint32_t>(lodOffsetInBytes + streamOffset));
+                }
+
+                AddMorphTargetInstanceMetaData(lod, lod.m_vertexCount, lodOffsetInBytes + morphTargetDeltaOffset, instance);
+
+                AZStd::vector<AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation>> lodAllocations{ allocation };
                 instance->m_outputStreamOffsetsInBytes.push_back(streamOffsetsFromBufferStart);
                 instance->m_allocations.push_back(lodAllocations);
 
@@ -121,6 +121,10 @@ namespace AZ
 
                 EnsureInit();
                 result = m_freeListAllocator.Allocate(byteCount, m_alignment);
+
+                AZ_Warning("SkinnedMeshOutputStreamManager", result.IsValid() || m_freeListAllocator.GetAllocatedByteCount() + byteCount > m_sizeInBytes,
+                    "Failed to allocate %zu bytes although the pool has %zu bytes free, the pool is %.0f%% fragmented",
+                    byteCount, m_sizeInBytes - m_freeListAllocator.GetAllocatedByteCount(), m_freeListAllocator.ComputeFragmentation() * 100.0f);
             }
 
             if (result.IsValid())
@@ -157,6 +161,21 @@ namespace AZ
             }
         }
 
+        SkinnedMeshOutputStreamMemoryStats SkinnedMeshOutputStreamManager::GetMemoryStats()
+        {
+            SkinnedMeshOutputStreamMemoryStats stats;
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_allocatorMutex);
+            if (!m_needsInit)
+            {
+                stats.m_capacityInBytes = m_sizeInBytes;
+                stats.m_allocatedByteCount = m_freeListAllocator.GetAllocatedByteCount();
+                stats.m_allocationCount = m_freeListAllocator.GetAllocationCount();
+                stats.m_fragmentation = m_freeListAllocator.ComputeFragmentation();
+            }
+            return stats;
+        }
+
         Data::Asset<RPI::BufferAsset> SkinnedMeshOutputStreamManager::GetBufferAsset()
         {
             EnsureInit();
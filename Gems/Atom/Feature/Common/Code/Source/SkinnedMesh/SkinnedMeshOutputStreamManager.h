@@ -39,6 +39,7 @@ namespace AZ
             AZStd::intrusive_ptr<SkinnedMeshOutputStreamAllocation> Allocate(size_t byteCount) override;
             void DeAllocate(RHI::VirtualAddress allocation) override;
             void DeAllocateNoSignal(RHI::VirtualAddress allocation) override;
+            SkinnedMeshOutputStreamMemoryStats GetMemoryStats() override;
             Data::Asset<RPI::BufferAsset> GetBufferAsset() override;
             Data::Instance<RPI::Buffer> GetBuffer() override;
 
@@ -66,8 +66,15 @@ namespace AZ
 
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
             bool m_isQueuedForCompile = false;
+
+            //! Lods skinned by the last dispatch, whose skinned vertices can be reused while the update rate is reduced.
+            uint32_t m_skinnedLodMask = 0;
+            //! Offsets the frames this proxy is skinned at when its update rate is reduced.
+            uint32_t m_skinningUpdatePhase = 0;
         };
 
+        static_assert(RPI::ModelLodAsset::LodCountMax <= 32, "SkinnedMeshRenderProxy::m_skinnedLodMask needs a bit per lod");
+
         using SkinnedMeshRenderProxyHandle = StableDynamicArrayHandle<SkinnedMeshRenderProxy>;
     } // namespace Render
 } // namespace AZ
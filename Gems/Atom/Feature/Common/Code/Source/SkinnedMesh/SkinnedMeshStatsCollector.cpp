@@ -8,6 +8,7 @@
 
 #include <SkinnedMesh/SkinnedMeshFeatureProcessor.h>
 #include <SkinnedMesh/SkinnedMeshStatsCollector.h>
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshOutputStreamManagerInterface.h>
 
 #include <Atom/RPI.Public/Scene.h>
 
@@ -27,6 +28,16 @@ namespace AZ
         SkinnedMeshSceneStats SkinnedMeshStatsCollector::GetSceneStats()
         {
             m_sceneStats.skinnedMeshRenderProxyCount = m_featureProcessor->m_renderProxies.size();
+            m_sceneStats.updatedRenderProxyCount = m_featureProcessor->m_updatedRenderProxyCount;
+            m_sceneStats.skippedRenderProxyCount = m_featureProcessor->m_skippedRenderProxyCount;
+
+            if (SkinnedMeshOutputStreamManagerInterface* outputStreamManager = SkinnedMeshOutputStreamManagerInterface::Get())
+            {
+                const SkinnedMeshOutputStreamMemoryStats memoryStats = outputStreamManager->GetMemoryStats();
+                m_sceneStats.outputStreamAllocatedByteCount = memoryStats.m_allocatedByteCount;
+                m_sceneStats.outputStreamCapacityInBytes = memoryStats.m_capacityInBytes;
+                m_sceneStats.outputStreamFragmentation = memoryStats.m_fragmentation;
+            }
 
             for (const SkinnedMeshRenderProxy& renderProxy : m_featureProcessor->m_renderProxies)
             {
@@ -14,14 +14,56 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/sort.h>
+
 #include <cinttypes>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_transformServiceDeltaUploads, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to upload only the object transforms that changed instead of the whole transform buffers");
+
         constexpr size_t BufferReserveCount = 1024;
 
+        // Each range is a separate staging copy, the closest ranges are merged to stay under this count
+        constexpr size_t MaxUploadRangeCount = 64;
+
+        // Merges sorted, unique transform indices into at most MaxUploadRangeCount ranges
+        static void MergeDirtyIndices(const AZStd::vector<uint32_t>& sortedIndices, AZStd::vector<AZStd::pair<uint32_t, uint32_t>>& ranges)
+        {
+            ranges.clear();
+            if (sortedIndices.empty())
+            {
+                return;
+            }
+
+            // Join the ranges separated by at most maxGap clean transforms, doubling the gap until there are few enough ranges
+            for (uint32_t maxGap = 0;; maxGap = maxGap * 2 + 1)
+            {
+                ranges.clear();
+                ranges.emplace_back(sortedIndices[0], sortedIndices[0] + 1);
+                for (size_t i = 1; i < sortedIndices.size(); ++i)
+                {
+                    if (sortedIndices[i] - ranges.back().second <= maxGap)
+                    {
+                        ranges.back().second = sortedIndices[i] + 1;
+                    }
+                    else
+                    {
+                        ranges.emplace_back(sortedIndices[i], sortedIndices[i] + 1);
+                    }
+                }
+
+                if (ranges.size() <= MaxUploadRangeCount)
+                {
+                    return;
+                }
+            }
+        }
+
         void TransformServiceFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -40,6 +82,8 @@ namespace AZ
             m_deviceBufferNeedsUpdate = true;
             m_objectToWorldTransforms.reserve(BufferReserveCount);
             m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
+            m_objectInstanceParameters.reserve(BufferReserveCount);
+            m_instanceParametersBufferNeedsUpdate = true;
 
             m_isWriteable = true;
 
@@ -50,16 +94,20 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectInstanceParameters = {};
+            m_dirtyInstanceParameterIndices = {};
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
             m_objectToWorldHistoryBuffer = nullptr;
+            m_objectInstanceParametersBuffer = nullptr;
 
             m_firstAvailableTransformIndex = NoAvailableTransformIndices;
 
             m_objectToWorldBufferIndex.Reset();
             m_objectToWorldInverseTransposeBufferIndex.Reset();
             m_objectToWorldHistoryBufferIndex.Reset();
+            m_objectInstanceParametersBufferIndex.Reset();
 
             m_isWriteable = false;
 
@@ -67,10 +115,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersRecreated = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +143,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
@@ -100,6 +151,7 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
@@ -120,15 +172,63 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
+
+            return buffersRecreated;
+        }
+
+        bool TransformServiceFeatureProcessor::PrepareInstanceParametersBuffer()
+        {
+            AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
+
+            const uint32_t elementCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(1, static_cast<uint32_t>(m_objectInstanceParameters.size())));
+            static const uint32_t elementSize = sizeof(InstanceParameters);
+            const uint32_t byteCount = elementCount * elementSize;
+
+            // Create or resize, grow by powers of two
+            if (!m_objectInstanceParametersBuffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = "m_objectInstanceParametersBuffer";
+                desc.m_byteCount = byteCount;
+                desc.m_elementSize = elementSize;
+
+                m_objectInstanceParametersBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                return true;
+            }
+
+            if (byteCount > m_objectInstanceParametersBuffer->GetBufferSize())
+            {
+                m_objectInstanceParametersBuffer->Resize(byteCount);
+                return true;
+            }
+            return false;
+        }
+
+        template<typename ElementType>
+        void TransformServiceFeatureProcessor::UploadElements(RPI::Buffer& buffer, const AZStd::vector<ElementType>& elements, const AZStd::vector<UploadRange>& ranges)
+        {
+            if (ranges.empty())
+            {
+                buffer.UpdateData(elements.data(), elements.size() * sizeof(ElementType));
+                return;
+            }
+
+            for (const UploadRange& range : ranges)
+            {
+                buffer.UpdateData(elements.data() + range.first, (range.second - range.first) * sizeof(ElementType), range.first * sizeof(ElementType));
+            }
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -136,6 +236,7 @@ namespace AZ
             sceneSrg->SetBufferView(m_objectToWorldBufferIndex, m_objectToWorldBuffer->GetBufferView());
             sceneSrg->SetBufferView(m_objectToWorldInverseTransposeBufferIndex, m_objectToWorldInverseTransposeBuffer->GetBufferView());
             sceneSrg->SetBufferView(m_objectToWorldHistoryBufferIndex, m_objectToWorldHistoryBuffer->GetBufferView());
+            sceneSrg->SetBufferView(m_objectInstanceParametersBufferIndex, m_objectInstanceParametersBuffer->GetBufferView());
         }
 
         void TransformServiceFeatureProcessor::OnBeginPrepareRender()
@@ -144,25 +245,77 @@ namespace AZ
 
             if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
             {
-                PrepareBuffers();
-                if (m_historyBufferNeedsUpdate)
+                const bool buffersRecreated = PrepareBuffers();
+
+                // With delta uploads, the history buffer only differs from the transforms of the last upload where they changed then,
+                // and the transform buffers only differ from the current transforms where they changed since. Empty ranges upload everything.
+                const bool deltaUploads = r_transformServiceDeltaUploads && !buffersRecreated;
+                AZStd::vector<UploadRange> historyRanges;
+                AZStd::vector<UploadRange> transformRanges;
+                AZStd::sort(m_dirtyTransformIndices.begin(), m_dirtyTransformIndices.end());
+                m_dirtyTransformIndices.erase(AZStd::unique(m_dirtyTransformIndices.begin(), m_dirtyTransformIndices.end()), m_dirtyTransformIndices.end());
+                if (deltaUploads)
+                {
+                    MergeDirtyIndices(m_previousDirtyTransformIndices, historyRanges);
+                    MergeDirtyIndices(m_dirtyTransformIndices, transformRanges);
+                }
+
+                if (m_historyBufferNeedsUpdate || buffersRecreated)
                 {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
+                    if (!deltaUploads || !historyRanges.empty())
+                    {
+                        UploadElements(*m_objectToWorldHistoryBuffer, m_objectToWorldHistoryTransforms, historyRanges);
+                    }
                     m_historyBufferNeedsUpdate = false;
                 }
 
                 if (m_deviceBufferNeedsUpdate)
                 {
                     // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+                    if (!deltaUploads || !transformRanges.empty())
+                    {
+                        UploadElements(*m_objectToWorldBuffer, m_objectToWorldTransforms, transformRanges);
+                        UploadElements(*m_objectToWorldInverseTransposeBuffer, m_objectToWorldInverseTransposeTransforms, transformRanges);
+                    }
 
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                    if (transformRanges.empty())
+                    {
+                        m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                    }
+                    else
+                    {
+                        for (const UploadRange& range : transformRanges)
+                        {
+                            AZStd::copy(m_objectToWorldTransforms.begin() + range.first, m_objectToWorldTransforms.begin() + range.second,
+                                m_objectToWorldHistoryTransforms.begin() + range.first);
+                        }
+                    }
 
                     m_deviceBufferNeedsUpdate = false;
                     m_historyBufferNeedsUpdate = true;
                 }
             }
+
+            m_previousDirtyTransformIndices.swap(m_dirtyTransformIndices);
+            m_dirtyTransformIndices.clear();
+
+            if (m_instanceParametersBufferNeedsUpdate)
+            {
+                // Instance parameters are typically animated on a few objects at a time, only upload the ones that changed
+                AZStd::vector<UploadRange> ranges;
+                if (!PrepareInstanceParametersBuffer())
+                {
+                    AZStd::sort(m_dirtyInstanceParameterIndices.begin(), m_dirtyInstanceParameterIndices.end());
+                    m_dirtyInstanceParameterIndices.erase(
+                        AZStd::unique(m_dirtyInstanceParameterIndices.begin(), m_dirtyInstanceParameterIndices.end()),
+                        m_dirtyInstanceParameterIndices.end());
+                    MergeDirtyIndices(m_dirtyInstanceParameterIndices, ranges);
+                }
+                UploadElements(*m_objectInstanceParametersBuffer, m_objectInstanceParameters, ranges);
+
+                m_dirtyInstanceParameterIndices.clear();
+                m_instanceParametersBufferNeedsUpdate = false;
+            }
         }
 
         void TransformServiceFeatureProcessor::OnEndPrepareRender()
@@ -178,6 +331,7 @@ namespace AZ
             {
                 modelIndex = m_firstAvailableTransformIndex;
                 m_firstAvailableTransformIndex = m_objectToWorldTransforms.at(m_firstAvailableTransformIndex).m_nextFreeSlot;
+                m_objectInstanceParameters.at(modelIndex) = {};
             }
             else
             {
@@ -185,7 +339,10 @@ namespace AZ
                 m_objectToWorldTransforms.push_back();
                 m_objectToWorldInverseTransposeTransforms.push_back();
                 m_objectToWorldHistoryTransforms.push_back();
+                m_objectInstanceParameters.push_back();
             }
+            m_instanceParametersBufferNeedsUpdate = true;
+            m_dirtyInstanceParameterIndices.push_back(modelIndex);
             return ObjectId(modelIndex);
         }
 
@@ -214,6 +371,7 @@ namespace AZ
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
                 m_deviceBufferNeedsUpdate = true;
+                m_dirtyTransformIndices.push_back(id.GetIndex());
             }
         }
 
@@ -232,5 +390,29 @@ namespace AZ
             AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromRowMajorFloat12(m_objectToWorldTransforms.at(id.GetIndex()).m_transform);
             return matrix3x4.RetrieveScale();
         }
+
+        void TransformServiceFeatureProcessor::SetInstanceParameterForId(ObjectId id, uint32_t parameterIndex, const AZ::Vector4& value)
+        {
+            AZ_Error("TransformServiceFeatureProcessor", m_isWriteable, "Instance parameters cannot be written to during this phase");
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to set an instance parameter for an invalid handle.");
+            AZ_Error("TransformServiceFeatureProcessor", parameterIndex < InstanceParameterCount, "Instance parameter index %u is out of range.", parameterIndex);
+            if (id.IsValid() && parameterIndex < InstanceParameterCount)
+            {
+                value.StoreToFloat4(m_objectInstanceParameters.at(id.GetIndex()).m_parameters[parameterIndex]);
+                m_instanceParametersBufferNeedsUpdate = true;
+                m_dirtyInstanceParameterIndices.push_back(id.GetIndex());
+            }
+        }
+
+        AZ::Vector4 TransformServiceFeatureProcessor::GetInstanceParameterForId(ObjectId id, uint32_t parameterIndex) const
+        {
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to get an instance parameter for an invalid handle.");
+            AZ_Error("TransformServiceFeatureProcessor", parameterIndex < InstanceParameterCount, "Instance parameter index %u is out of range.", parameterIndex);
+            if (!id.IsValid() || parameterIndex >= InstanceParameterCount)
+            {
+                return AZ::Vector4::CreateZero();
+            }
+            return AZ::Vector4::CreateFromFloat4(m_objectInstanceParameters.at(id.GetIndex()).m_parameters[parameterIndex]);
+        }
     }
 }
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ViewportDepthPicking/ViewportDepthPickingPass.h>
+#include <ViewportDepthPicking/ViewportDepthPickingSystem.h>
+
+#include <Atom/RPI.Public/Pass/PassAttachment.h>
+#include <Atom/RPI.Public/View.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        static const char* ViewportDepthPickingOutputSlotName = "Output";
+
+        RPI::Ptr<ViewportDepthPickingPass> ViewportDepthPickingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<ViewportDepthPickingPass> pass = aznew ViewportDepthPickingPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        ViewportDepthPickingPass::ViewportDepthPickingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+            m_readback = AZStd::make_shared<RPI::AttachmentReadback>(RHI::ScopeId{ "ViewportDepthPickingReadback" });
+        }
+
+        void ViewportDepthPickingPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            m_region.reset();
+
+            auto* depthPicking = azrtti_cast<ViewportDepthPickingSystem*>(AzFramework::ViewportDepthPicking::Get());
+            RPI::ViewPtr view = GetView();
+            ViewportDepthPickingSystem::Request request;
+            // keep a single readback in flight, the requests wait in the system until it's done
+            if (depthPicking && view && m_readback->GetReadbackState() == RPI::AttachmentReadback::ReadbackState::Idle &&
+                depthPicking->TakeRequest(view.get(), request))
+            {
+                m_region = AZStd::make_shared<AzFramework::ViewportDepthRegion>();
+                m_region->m_clipToWorld = view->GetWorldToClipMatrix().GetInverseFull();
+                m_screenPoint = request.m_screenPoint;
+                m_viewportSize = request.m_viewportSize;
+
+                // the callback runs on another thread once the GPU is done, it only keeps what it needs and not the pass
+                AZStd::shared_ptr<AzFramework::ViewportDepthRegion> region = m_region;
+                const AzFramework::ViewportId viewportId = request.m_viewportId;
+                m_readback->SetCallback([region, viewportId](const RPI::AttachmentReadback::ReadbackResult& result)
+                    {
+                        auto* depthPicking = azrtti_cast<ViewportDepthPickingSystem*>(AzFramework::ViewportDepthPicking::Get());
+                        if (!depthPicking || result.m_state != RPI::AttachmentReadback::ReadbackState::Success || !result.m_dataBuffer)
+                        {
+                            return;
+                        }
+
+                        const RHI::Size& size = result.m_imageDescriptor.m_size;
+                        const float* depths = reinterpret_cast<const float*>(result.m_dataBuffer->data());
+                        region->m_size = AzFramework::ScreenSize(aznumeric_cast<int>(size.m_width), aznumeric_cast<int>(size.m_height));
+                        region->m_depths.assign(depths, depths + AZStd::min<size_t>(result.m_dataBuffer->size() / sizeof(float), size.m_width * size.m_height));
+                        depthPicking->SetDepthRegion(viewportId, AZStd::move(*region));
+                    });
+                ReadbackAttachment(m_readback, Name(ViewportDepthPickingOutputSlotName));
+            }
+
+            ComputePass::FrameBeginInternal(params);
+        }
+
+        void ViewportDepthPickingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (m_region)
+            {
+                // the depth buffer may have a different resolution than the viewport, center the region on the texel under the point
+                const RHI::Size depthSize = GetInputBinding(0).GetAttachment()->m_descriptor.m_image.m_size;
+                const int regionHalfSize = AzFramework::ViewportDepthPickingInterface::RegionSize / 2;
+                const float u = (aznumeric_cast<float>(m_screenPoint.m_x) + 0.5f) / AZStd::max(m_viewportSize.Widthf(), 1.0f);
+                const float v = (aznumeric_cast<float>(m_screenPoint.m_y) + 0.5f) / AZStd::max(m_viewportSize.Heightf(), 1.0f);
+                m_region->m_depthSize = AzFramework::ScreenSize(aznumeric_cast<int>(depthSize.m_width), aznumeric_cast<int>(depthSize.m_height));
+                m_region->m_origin = AzFramework::ScreenPoint(
+                    aznumeric_cast<int>(AZStd::floor(u * aznumeric_cast<float>(depthSize.m_width))) - regionHalfSize,
+                    aznumeric_cast<int>(AZStd::floor(v * aznumeric_cast<float>(depthSize.m_height))) - regionHalfSize);
+
+                const AZStd::array<int32_t, 2> regionOrigin = { m_region->m_origin.m_x, m_region->m_origin.m_y };
+                m_shaderResourceGroup->SetConstant(m_regionOriginIndex, regionOrigin);
+            }
+
+            ComputePass::CompileResources(context);
+        }
+
+        void ViewportDepthPickingPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            if (m_region)
+            {
+                ComputePass::BuildCommandListInternal(context);
+            }
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+#include <AzFramework/Viewport/ViewportDepthPicking.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Copies the region of the depth buffer around the point requested through the AzFramework::ViewportDepthPicking
+        //! interface for the viewport of the view, and reads it back to the CPU for the viewport picking of the editor.
+        //! The pass only runs on the frames a request was taken, one readback at a time.
+        class ViewportDepthPickingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(ViewportDepthPickingPass);
+
+        public:
+            AZ_RTTI(AZ::Render::ViewportDepthPickingPass, "{B3F6D2A1-5C8E-4B7D-A0E4-91C7F3D25B68}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(ViewportDepthPickingPass, SystemAllocator, 0);
+
+            //! Creates a ViewportDepthPickingPass
+            static RPI::Ptr<ViewportDepthPickingPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            explicit ViewportDepthPickingPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            // Scope producer functions...
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            AZStd::shared_ptr<RPI::AttachmentReadback> m_readback;
+
+            //! The region being copied this frame, completed with the depths by the readback callback
+            AZStd::shared_ptr<AzFramework::ViewportDepthRegion> m_region;
+            AzFramework::ScreenPoint m_screenPoint = AzFramework::ScreenPoint(0, 0);
+            AzFramework::ScreenSize m_viewportSize = AzFramework::ScreenSize(0, 0);
+
+            RHI::ShaderInputNameIndex m_regionOriginIndex = "m_regionOrigin";
+        };
+    } // namespace Render
+} // namespace AZ
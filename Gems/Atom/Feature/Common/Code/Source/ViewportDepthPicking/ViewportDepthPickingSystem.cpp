@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ViewportDepthPicking/ViewportDepthPickingSystem.h>
+
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        ViewportDepthPickingSystem::ViewportDepthPickingSystem()
+        {
+            AzFramework::ViewportDepthPicking::Register(this);
+        }
+
+        ViewportDepthPickingSystem::~ViewportDepthPickingSystem()
+        {
+            AzFramework::ViewportDepthPicking::Unregister(this);
+        }
+
+        void ViewportDepthPickingSystem::RequestDepthRegion(
+            AzFramework::ViewportId viewportId, const AzFramework::ScreenPoint& screenPoint, const AzFramework::ScreenSize& viewportSize)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_requests[viewportId] = Request{ viewportId, screenPoint, viewportSize };
+        }
+
+        bool ViewportDepthPickingSystem::GetDepthRegion(AzFramework::ViewportId viewportId, AzFramework::ViewportDepthRegion& region) const
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            if (auto regionIt = m_regions.find(viewportId); regionIt != m_regions.end())
+            {
+                region = regionIt->second;
+                return true;
+            }
+            return false;
+        }
+
+        bool ViewportDepthPickingSystem::TakeRequest(const RPI::View* view, Request& request)
+        {
+            auto viewportContextManager = RPI::ViewportContextRequests::Get();
+            if (!view || !viewportContextManager)
+            {
+                return false;
+            }
+
+            AZStd::scoped_lock lock(m_mutex);
+            for (auto requestIt = m_requests.begin(); requestIt != m_requests.end(); ++requestIt)
+            {
+                RPI::ViewportContextPtr viewportContext = viewportContextManager->GetViewportContextById(requestIt->first);
+                if (!viewportContext)
+                {
+                    // the viewport got destroyed
+                    m_regions.erase(requestIt->first);
+                    m_requests.erase(requestIt);
+                    return false;
+                }
+
+                if (viewportContext->GetDefaultView().get() == view)
+                {
+                    request = requestIt->second;
+                    m_requests.erase(requestIt);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void ViewportDepthPickingSystem::SetDepthRegion(AzFramework::ViewportId viewportId, AzFramework::ViewportDepthRegion&& region)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_regions[viewportId] = AZStd::move(region);
+        }
+    } // namespace Render
+} // namespace AZ
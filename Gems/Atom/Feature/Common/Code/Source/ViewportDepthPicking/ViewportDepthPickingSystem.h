@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Base.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Viewport/ViewportDepthPicking.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Keeps the depth region requests of the viewports until a ViewportDepthPickingPass rendering the view of the viewport
+        //! takes them, and the regions it read back for them.
+        class ViewportDepthPickingSystem final
+            : public AzFramework::ViewportDepthPickingInterface
+        {
+        public:
+            AZ_RTTI(AZ::Render::ViewportDepthPickingSystem, "{4E8B1C7A-93D2-4A6F-B15E-7C2D0F8A6E39}", AzFramework::ViewportDepthPickingInterface);
+            AZ_CLASS_ALLOCATOR(ViewportDepthPickingSystem, SystemAllocator, 0);
+
+            struct Request
+            {
+                AzFramework::ViewportId m_viewportId = AzFramework::InvalidViewportId;
+                AzFramework::ScreenPoint m_screenPoint = AzFramework::ScreenPoint(0, 0);
+                AzFramework::ScreenSize m_viewportSize = AzFramework::ScreenSize(0, 0);
+            };
+
+            ViewportDepthPickingSystem();
+            ~ViewportDepthPickingSystem();
+
+            //! Takes the pending request of the viewport whose default view is the given view, returns false when there is none.
+            bool TakeRequest(const RPI::View* view, Request& request);
+
+            //! Stores the region read back for a request of the viewport.
+            void SetDepthRegion(AzFramework::ViewportId viewportId, AzFramework::ViewportDepthRegion&& region);
+
+            // AzFramework::ViewportDepthPickingInterface overrides...
+            void RequestDepthRegion(
+                AzFramework::ViewportId viewportId,
+                const AzFramework::ScreenPoint& screenPoint,
+                const AzFramework::ScreenSize& viewportSize) override;
+            bool GetDepthRegion(AzFramework::ViewportId viewportId, AzFramework::ViewportDepthRegion& region) const override;
+
+        private:
+            // the regions are set from the readback callbacks, which run on other threads
+            mutable AZStd::mutex m_mutex;
+            AZStd::unordered_map<AzFramework::ViewportId, Request> m_requests;
+            AZStd::unordered_map<AzFramework::ViewportId, AzFramework::ViewportDepthRegion> m_regions;
+        };
+    } // namespace Render
+} // namespace AZ
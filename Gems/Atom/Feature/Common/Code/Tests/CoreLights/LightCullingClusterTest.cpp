@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/MatrixUtils.h>
+#include <CoreLights/LightCullingConstants.h>
+#include <CoreLights/LightCullingPass.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class LightCullingClusterTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    protected:
+        static float GetSlice(const AZStd::array<float, 2>& sliceScaleBias, float viewDistance)
+        {
+            return log2f(viewDistance) * sliceScaleBias[0] + sliceScaleBias[1];
+        }
+    };
+
+    TEST_F(LightCullingClusterTests, ComputeClusterSliceScaleBias_ReversedDepth_SlicesSpanNearToFar)
+    {
+        Matrix4x4 viewToClip;
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.0f, 0.1f, 100.0f, true);
+
+        const AZStd::array<float, 2> sliceScaleBias = LightCullingPass::ComputeClusterSliceScaleBias(viewToClip);
+        EXPECT_NEAR(GetSlice(sliceScaleBias, 0.1f), 0.0f, 0.01f);
+        EXPECT_NEAR(GetSlice(sliceScaleBias, 100.0f), float(LightCulling::NumClusterSlices), 0.01f);
+    }
+
+    TEST_F(LightCullingClusterTests, ComputeClusterSliceScaleBias_ForwardDepth_SlicesSpanNearToFar)
+    {
+        Matrix4x4 viewToClip;
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.0f, 0.5f, 200.0f, false);
+
+        const AZStd::array<float, 2> sliceScaleBias = LightCullingPass::ComputeClusterSliceScaleBias(viewToClip);
+        EXPECT_NEAR(GetSlice(sliceScaleBias, 0.5f), 0.0f, 0.01f);
+        EXPECT_NEAR(GetSlice(sliceScaleBias, 200.0f), float(LightCulling::NumClusterSlices), 0.01f);
+    }
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <CoreLights/ShadowmapCache.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class ShadowmapCacheTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    using CacheState = ShadowmapPass::CacheState;
+
+    TEST_F(ShadowmapCacheTests, SelectArraySlicesToRender_NoBudget_RendersAllStaleSlices)
+    {
+        ShadowmapCache cache;
+        const AZStd::vector<CacheState> states = { CacheState::Cached, CacheState::Stale, CacheState::Empty, CacheState::Stale };
+
+        const AZStd::vector<bool> rendered = cache.SelectArraySlicesToRender(states, 0);
+        EXPECT_EQ(rendered, AZStd::vector<bool>({ false, true, true, true }));
+    }
+
+    TEST_F(ShadowmapCacheTests, SelectArraySlicesToRender_Budget_RendersEmptySlicesAndRotatesStaleSlices)
+    {
+        ShadowmapCache cache;
+        const AZStd::vector<CacheState> states = { CacheState::Stale, CacheState::Empty, CacheState::Stale, CacheState::Stale };
+
+        // The empty slice ignores the budget.
+        EXPECT_EQ(cache.SelectArraySlicesToRender(states, 1), AZStd::vector<bool>({ true, true, false, false }));
+
+        // The stale slices left behind are rendered on the following frames.
+        const AZStd::vector<CacheState> staleStates = { CacheState::Stale, CacheState::Cached, CacheState::Stale, CacheState::Stale };
+        EXPECT_EQ(cache.SelectArraySlicesToRender(staleStates, 1), AZStd::vector<bool>({ false, false, true, false }));
+        EXPECT_EQ(cache.SelectArraySlicesToRender(staleStates, 1), AZStd::vector<bool>({ false, false, false, true }));
+        EXPECT_EQ(cache.SelectArraySlicesToRender(staleStates, 1), AZStd::vector<bool>({ true, false, false, false }));
+    }
+}
@@ -98,6 +98,8 @@ set(FILES
     Source/CoreLights/Shadow.cpp
     Source/CoreLights/ShadowmapAtlas.h
     Source/CoreLights/ShadowmapAtlas.cpp
+    Source/CoreLights/ShadowmapCache.h
+    Source/CoreLights/ShadowmapCache.cpp
     Source/CoreLights/ShadowmapPass.h
     Source/CoreLights/ShadowmapPass.cpp
     Source/CoreLights/LightCullingPass.cpp
@@ -167,6 +169,8 @@ set(FILES
     Source/ImGui/ImGuiSystemComponent.cpp
     Source/ImGui/ImGuiSystemComponent.h
     Source/ImageBasedLights/ImageBasedLightFeatureProcessor.cpp
+    Source/ImageStreaming/ImageMipFeedbackPass.h
+    Source/ImageStreaming/ImageMipFeedbackPass.cpp
     Source/LookupTable/LookupTableAsset.cpp
     Source/Material/ConvertEmissiveUnitFunctor.cpp
     Source/Material/ConvertEmissiveUnitFunctor.h
@@ -184,6 +188,16 @@ set(FILES
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
     Source/Mesh/MeshFeatureProcessor.cpp
+    Source/Mesh/MeshGpuCulling.cpp
+    Source/Mesh/MeshGpuCulling.h
+    Source/Mesh/MeshGpuCullingPass.cpp
+    Source/Mesh/MeshGpuCullingPass.h
+    Source/Mesh/MeshGpuCullingTransitionPass.cpp
+    Source/Mesh/MeshGpuCullingTransitionPass.h
+    Source/Mesh/MeshletCullingPass.cpp
+    Source/Mesh/MeshletCullingPass.h
+    Source/Mesh/MeshInstanceManager.cpp
+    Source/Mesh/MeshInstanceManager.h
     Source/Mesh/ModelReloader.cpp
     Source/Mesh/ModelReloader.h
     Source/Mesh/ModelReloaderSystem.cpp
@@ -196,6 +210,8 @@ set(FILES
     Source/OcclusionCullingPlane/OcclusionCullingPlaneFeatureProcessor.cpp
     Source/OcclusionCullingPlane/OcclusionCullingPlane.h
     Source/OcclusionCullingPlane/OcclusionCullingPlane.cpp
+    Source/OcclusionCulling/HiZOcclusionPass.h
+    Source/OcclusionCulling/HiZOcclusionPass.cpp
     Source/PostProcess/PostProcessBase.cpp
     Source/PostProcess/PostProcessBase.h
     Source/PostProcess/PostProcessFeatureProcessor.cpp
@@ -328,6 +344,10 @@ set(FILES
     Source/SkyBox/SkyBoxFogSettings.cpp
     Source/TransformService/TransformServiceFeatureProcessor.cpp
     Source/Utils/GpuBufferHandler.cpp
+    Source/ViewportDepthPicking/ViewportDepthPickingPass.cpp
+    Source/ViewportDepthPicking/ViewportDepthPickingPass.h
+    Source/ViewportDepthPicking/ViewportDepthPickingSystem.cpp
+    Source/ViewportDepthPicking/ViewportDepthPickingSystem.h
 )
 
 set(SKIP_UNITY_BUILD_INCLUSION_FILES
@@ -9,7 +9,9 @@
 set(FILES
     Mocks/MockMeshFeatureProcessor.h
     Tests/CommonTest.cpp
+    Tests/CoreLights/LightCullingClusterTest.cpp
     Tests/CoreLights/ShadowmapAtlasTest.cpp
+    Tests/CoreLights/ShadowmapCacheTest.cpp
     Tests/IndexedDataVectorTests.cpp
     Tests/MultiIndexedDataVectorTests.cpp
     Tests/IndexableListTests.cpp
@@ -107,7 +107,10 @@ namespace AZ
             KeyThenDepth = 0,
             KeyThenReverseDepth,
             DepthThenKey,
-            ReverseDepthThenKey
+            ReverseDepthThenKey,
+            //! Sort key, then pipeline state and shader resource groups, then depth in coarse buckets.
+            //! Reduces state changes for lists that don't need a strict depth order, e.g. after a depth prepass
+            KeyThenStateThenDepth
         };
 
     }
@@ -96,6 +96,14 @@ namespace AZ
                 size_t m_rendertargetMemoryInBytes = 0;
             };
 
+            //! Peak memory of the attachments placed by the interval packing, compared with the first fit placement
+            //! the aliased heaps use otherwise. Summed over all allocators of the pool.
+            struct IntervalPacking
+            {
+                size_t m_firstFitPeakInBytes = 0;
+                size_t m_packedPeakInBytes = 0;
+            };
+
             AllocationPolicy m_allocationPolicy = AllocationPolicy::HeapPlacement;
 
             /// Flat array of scopes used last frame.
@@ -106,6 +114,9 @@ namespace AZ
 
             //! Reserved memory used by the transient pool.
             MemoryUsage m_reservedMemory;
+
+            //! Only filled when the pool is compiled with the IntervalPacking flag.
+            IntervalPacking m_intervalPacking;
         };
     }
 }
@@ -10,7 +10,9 @@
 #include <Atom/RHI/AliasedHeap.h>
 #include <Atom/RHI/DeviceObject.h>
 #include <Atom/RHI/FrameEventBus.h>
+#include <Atom/RHI/LifetimeHeapPacker.h>
 #include <Atom/RHI/ObjectCollector.h>
+#include <Atom/RHI/Scope.h>
 #include <Atom/RHI.Reflect/TransientBufferDescriptor.h>
 #include <Atom/RHI.Reflect/TransientImageDescriptor.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -63,6 +65,8 @@ namespace AZ
         //! This allocator use different allocation strategies described by the RHI::HeapAllocationStrategy enum.
         //! Depending on the strategy selected, the allocator can grow/shrink by allocating/deallocating heap pages.
         //! It can also compact a heap page if it is being underutilized.
+        //! With the TransientAttachmentPoolCompileFlags::IntervalPacking flag, the lifetimes of the attachments are recorded during the
+        //! DontAllocateResources pass and packed at its end. The next pass places all attachments at the packed offsets in a single page.
         //! We also use the template type so we can inherit the AliasedAttachmentAllocator::Descriptor from the
         //! Heap::Descriptor to pass implementation specific parameters during the heap initialization.
         template<class Heap>
@@ -135,6 +139,10 @@ namespace AZ
             //! Statistics will be added at the end of the provided vector.
             void GetStatistics(AZStd::vector<TransientAttachmentStatistics::Heap>& heapStatistics) const;
 
+            //! Adds the memory peaks computed by the last Begin/End cycle that used both the IntervalPacking
+            //! and the DontAllocateResources flags to the provided statistics.
+            void GetIntervalPackingStatistics(TransientAttachmentStatistics::IntervalPacking& statistics) const;
+
             //! Get allocator descriptor.
             const Descriptor& GetDescriptor() const { return m_descriptor; }
 
@@ -163,6 +171,14 @@ namespace AZ
             // Returns the heap scale factor depending on the strategy of the allocator.
             float GetHeapPageScaleFactor() const;
 
+            // Returns the smallest page that can hold all the attachments placed by the lifetime packer, adding one if needed.
+            AliasedHeap* FindOrAddPackedHeapPage(size_t sizeInBytes);
+
+            // Records the lifetimes of the attachments when the interval packing is enabled during a DontAllocateResources pass.
+            void RecordActivation(const AttachmentId& attachmentId, const ResourceMemoryRequirements& memRequirements, const Scope& scope);
+            void RecordDeactivation(const AttachmentId& attachmentId, const Scope& scope);
+            bool IsRecordingLifetimes() const;
+
             // Erase unused pages and replace pages with high unused space for a smaller one.
             // Deleted pages are garbage collect according to the garbage collect latency.
             void CompactHeapPages();
@@ -182,6 +198,14 @@ namespace AZ
 
             size_t m_memoryUsageHint = 0;
             TransientAttachmentPoolCompileFlags m_compileFlags = TransientAttachmentPoolCompileFlags::None;
+
+            // Places the attachments from the lifetimes recorded during the last DontAllocateResources pass.
+            LifetimeHeapPacker m_lifetimePacker;
+            // Request index in the lifetime packer of the attachments active during the recording.
+            AZStd::unordered_map<AttachmentId, uint32_t> m_lifetimeRequestLookup;
+            // The page holding the attachments placed by the lifetime packer for this cycle, if any.
+            AliasedHeap* m_packedHeap = nullptr;
+            TransientAttachmentStatistics::IntervalPacking m_intervalPackingStatistics;
         };
 
         template<class Heap>
@@ -296,9 +320,25 @@ namespace AZ
         {
             m_memoryUsageHint = memoryUsageHint;
             m_compileFlags = compileFlags;
-            ForEachHeap([&compileFlags](AliasedHeap& heap)
+            m_packedHeap = nullptr;
+            if (!CheckBitsAny(compileFlags, TransientAttachmentPoolCompileFlags::IntervalPacking))
+            {
+                m_lifetimePacker.Reset();
+                m_intervalPackingStatistics = {};
+            }
+            else if (IsRecordingLifetimes())
+            {
+                m_lifetimePacker.Reset();
+                m_lifetimeRequestLookup.clear();
+            }
+            else if (!m_lifetimePacker.IsEmpty())
+            {
+                m_packedHeap = FindOrAddPackedHeapPage(m_lifetimePacker.GetPeakInBytes());
+            }
+
+            ForEachHeap([this, &compileFlags](AliasedHeap& heap)
             {
-                heap.Begin(compileFlags);
+                heap.Begin(compileFlags, &heap == m_packedHeap ? &m_lifetimePacker.GetOffsets() : nullptr);
             });
 
             if (CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources))
@@ -313,12 +353,35 @@ namespace AZ
             Buffer* buffer = nullptr;
             AliasedHeap* heap = nullptr;
             ResultCode result = ResultCode::Fail;
+            if (IsRecordingLifetimes())
+            {
+                RecordActivation(descriptor.m_attachmentId, GetDevice().GetResourceMemoryRequirements(descriptor.m_bufferDescriptor), scope);
+            }
+            else if (m_packedHeap)
+            {
+                // The packed page only takes the attachments placed by the lifetime packer.
+                result = m_packedHeap->ActivateBuffer(descriptor, scope, &buffer);
+                if (result == ResultCode::Success)
+                {
+                    heap = m_packedHeap;
+                }
+            }
+
             // We first try to allocate from the current heap pages.
             // When running with the TransientAttachmentPoolCompileFlags::DontAllocateResources flag
             // the heaps will not create any resources but we need then to "allocate" the space needed.
             for (const HeapPage& page : m_heapPages)
             {
+                if (result == ResultCode::Success)
+                {
+                    break;
+                }
+
                 Ptr<AliasedHeap> aliasedHeap = page.m_heap;
+                if (aliasedHeap == m_packedHeap)
+                {
+                    continue;
+                }
                 result = aliasedHeap->ActivateBuffer(descriptor, scope, &buffer);
                 if (result == ResultCode::Success)
                 {
@@ -371,6 +434,11 @@ namespace AZ
 
             findIter->second->DeactivateBuffer(attachmentId, scope);
             m_attachmentToHeapMap.erase(findIter);
+
+            if (IsRecordingLifetimes())
+            {
+                RecordDeactivation(attachmentId, scope);
+            }
         }
 
         template<class Heap>
@@ -379,12 +447,35 @@ namespace AZ
             Image* image = nullptr;
             AliasedHeap* heap = nullptr;
             ResultCode result = ResultCode::Fail;
+            if (IsRecordingLifetimes())
+            {
+                RecordActivation(descriptor.m_attachmentId, GetDevice().GetResourceMemoryRequirements(descriptor.m_imageDescriptor), scope);
+            }
+            else if (m_packedHeap)
+            {
+                // The packed page only takes the attachments placed by the lifetime packer.
+                result = m_packedHeap->ActivateImage(descriptor, scope, &image);
+                if (result == ResultCode::Success)
+                {
+                    heap = m_packedHeap;
+                }
+            }
+
             // We first try to allocate from the current heap pages.
             // When running with the TransientAttachmentPoolCompileFlags::DontAllocateResources flag
             // the heaps will not create any resources but we need then to "allocate" the space needed.
             for (const HeapPage& page : m_heapPages)
             {
+                if (result == ResultCode::Success)
+                {
+                    break;
+                }
+
                 Ptr<AliasedHeap> aliasedHeap = page.m_heap;
+                if (aliasedHeap == m_packedHeap)
+                {
+                    continue;
+                }
                 result = aliasedHeap->ActivateImage(descriptor, scope, &image);
                 if (result == ResultCode::Success)
                 {
@@ -443,6 +534,11 @@ namespace AZ
 
             findIter->second->DeactivateImage(attachmentId, scope);
             m_attachmentToHeapMap.erase(findIter);
+
+            if (IsRecordingLifetimes())
+            {
+                RecordDeactivation(attachmentId, scope);
+            }
         }
 
         template<class Heap>
@@ -454,6 +550,15 @@ namespace AZ
             });
             m_noAllocationHeap.End();
 
+            if (IsRecordingLifetimes())
+            {
+                AZ_Assert(m_lifetimeRequestLookup.empty(), "There are still active attachments in aliased allocator %s", GetName().GetCStr());
+                m_lifetimePacker.Pack();
+                m_intervalPackingStatistics.m_firstFitPeakInBytes = m_lifetimePacker.GetFirstFitPeakInBytes();
+                m_intervalPackingStatistics.m_packedPeakInBytes = m_lifetimePacker.GetPeakInBytes();
+            }
+            m_packedHeap = nullptr;
+
             if (!CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources))
             {
                 CompactHeapPages();
@@ -476,6 +581,9 @@ namespace AZ
         void AliasedAttachmentAllocator<Heap>::Shutdown()
         {
             m_attachmentToHeapMap.clear();
+            m_lifetimeRequestLookup.clear();
+            m_lifetimePacker.Reset();
+            m_packedHeap = nullptr;
             m_heapPages.clear();
             m_garbageCollector.Shutdown();
             m_noAllocationHeap.Shutdown();
@@ -501,6 +609,64 @@ namespace AZ
             }
         }
 
+        template<class Heap>
+        void AliasedAttachmentAllocator<Heap>::GetIntervalPackingStatistics(TransientAttachmentStatistics::IntervalPacking& statistics) const
+        {
+            statistics.m_firstFitPeakInBytes += m_intervalPackingStatistics.m_firstFitPeakInBytes;
+            statistics.m_packedPeakInBytes += m_intervalPackingStatistics.m_packedPeakInBytes;
+        }
+
+        template<class Heap>
+        AliasedHeap* AliasedAttachmentAllocator<Heap>::FindOrAddPackedHeapPage(size_t sizeInBytes)
+        {
+            AliasedHeap* packedHeap = nullptr;
+            for (const HeapPage& page : m_heapPages)
+            {
+                const size_t heapSize = page.m_heap->GetDescriptor().m_budgetInBytes;
+                if (heapSize >= sizeInBytes && (!packedHeap || heapSize < packedHeap->GetDescriptor().m_budgetInBytes))
+                {
+                    packedHeap = page.m_heap.get();
+                }
+            }
+
+            // In a fixed strategy we never allocate new heap pages, the attachments use the first fit placement instead.
+            if (!packedHeap && m_descriptor.m_allocationParameters.m_type != HeapAllocationStrategy::Fixed)
+            {
+                packedHeap = AddAliasedHeapPage(sizeInBytes);
+            }
+            return packedHeap;
+        }
+
+        template<class Heap>
+        bool AliasedAttachmentAllocator<Heap>::IsRecordingLifetimes() const
+        {
+            return CheckBitsAll(m_compileFlags, TransientAttachmentPoolCompileFlags::IntervalPacking | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+        }
+
+        template<class Heap>
+        void AliasedAttachmentAllocator<Heap>::RecordActivation(
+            const AttachmentId& attachmentId, const ResourceMemoryRequirements& memRequirements, const Scope& scope)
+        {
+            LifetimeHeapPacker::Request request;
+            request.m_attachmentId = attachmentId;
+            request.m_sizeInBytes = memRequirements.m_sizeInBytes;
+            request.m_alignmentInBytes = AZStd::max(static_cast<size_t>(memRequirements.m_alignmentInBytes), m_descriptor.m_alignment);
+            request.m_scopeIndexFirst = scope.GetIndex();
+            request.m_scopeIndexLast = scope.GetIndex();
+            m_lifetimeRequestLookup.emplace(attachmentId, m_lifetimePacker.AddRequest(request));
+        }
+
+        template<class Heap>
+        void AliasedAttachmentAllocator<Heap>::RecordDeactivation(const AttachmentId& attachmentId, const Scope& scope)
+        {
+            auto findIter = m_lifetimeRequestLookup.find(attachmentId);
+            if (findIter != m_lifetimeRequestLookup.end())
+            {
+                m_lifetimePacker.SetScopeIndexLast(findIter->second, scope.GetIndex());
+                m_lifetimeRequestLookup.erase(findIter);
+            }
+        }
+
         template<class Heap>
         AliasedHeap* AliasedAttachmentAllocator<Heap>::AddAliasedHeapPage(size_t sizeInBytes)
         {
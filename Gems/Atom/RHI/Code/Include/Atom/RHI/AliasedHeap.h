@@ -13,6 +13,7 @@
 #include <Atom/RHI/BufferPool.h>
 #include <Atom/RHI/FreeListAllocator.h>
 #include <Atom/RHI/ImagePool.h>
+#include <Atom/RHI/LifetimeHeapPacker.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ResourcePool.h>
@@ -60,7 +61,9 @@ namespace AZ
 
             //! Begin the use of an Aliased Heap in a frame. Resets all previous resource uses.
             //! @param compileFlags Flags that modify behavior of the heap.
-            void Begin(const RHI::TransientAttachmentPoolCompileFlags compileFlags);
+            //! @param placedOffsets [Optional] Heap offsets computed ahead of the activations, used instead of the first fit placement.
+            //!                      Only the attachments in the map can be activated. The map must stay valid until End.
+            void Begin(const RHI::TransientAttachmentPoolCompileFlags compileFlags, const LifetimeHeapPacker::OffsetMap* placedOffsets = nullptr);
 
             //! Begin the use of a buffer resource.
             ResultCode ActivateBuffer(
@@ -118,6 +121,7 @@ namespace AZ
             //////////////////////////////////////////////////////////////////////////
 
         private:
+            ResultCode AllocateHeapOffset(const AttachmentId& attachmentId, const ResourceMemoryRequirements& memRequirements, size_t& heapOffsetInBytes);
             void DeactivateResourceInternal(const AttachmentId& attachmentId, Scope& scope, AliasedResourceType type);
 
             /// Descriptor of the heap.
@@ -126,6 +130,9 @@ namespace AZ
             /// First fit allocator used to allocate from placed heap.
             FreeListAllocator m_firstFitAllocator;
 
+            /// Offsets of the attachments placed ahead of their activation for this cycle, if any.
+            const LifetimeHeapPacker::OffsetMap* m_placedOffsets = nullptr;
+
             /// Cache of attachments.
             ObjectCache<Resource> m_cache;
 
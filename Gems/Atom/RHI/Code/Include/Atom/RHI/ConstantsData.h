@@ -94,6 +94,13 @@ namespace AZ
             //! other, these additional constants will be added to the end of the returned list.
             AZStd::vector<ShaderInputConstantIndex> GetIndicesOfDifferingConstants(const ConstantsData& other) const;
 
+            //! Returns the byte range of the constant data modified since the last call to ResetDirtyInterval().
+            //! The range is empty (m_min == m_max) if no constant was modified.
+            Interval GetDirtyInterval() const;
+
+            //! Clears the range of modified constant data, once the data was handed over for compilation.
+            void ResetDirtyInterval();
+
         private:
             enum class ValidateConstantAccessExpect : uint32_t
             {
@@ -116,8 +123,14 @@ namespace AZ
             template <typename T, uint32_t matrixSize>
             bool SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount);
 
+            //! Extends the dirty interval to include the given range of the constant data
+            void MarkDirty(size_t offsetInBytes, size_t sizeInBytes);
+
             ConstPtr<ConstantsLayout> m_layout;
             AZStd::vector<uint8_t> m_constantData;
+
+            //! Byte range of the constant data modified since the last call to ResetDirtyInterval()
+            Interval m_dirtyInterval;
         };
 
         template <typename T>
@@ -194,6 +207,7 @@ namespace AZ
                 {
                     value.GetRow(i).StoreToFloat4(row + i * 4);
                 }
+                MarkDirty(interval.m_min, sizeInBytes);
 
                 return true;
             }
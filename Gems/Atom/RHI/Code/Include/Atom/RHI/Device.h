@@ -17,6 +17,7 @@
 #include <Atom/RHI.Reflect/SwapChainDescriptor.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
 #include <Atom/RHI/PhysicalDevice.h>
+#include <Atom/RHI/ResidencyManager.h>
 #include <Atom/RHI/ResourcePoolDatabase.h>
 
 #include <AzCore/std/chrono/types.h>
@@ -111,6 +112,9 @@ namespace AZ
             //! Returns the mutable resource pool database.
             ResourcePoolDatabase& GetResourcePoolDatabase();
 
+            //! Returns the residency manager keeping the device memory under the budget reported by the platform.
+            ResidencyManager& GetResidencyManager();
+
             //! Returns a union of all capabilities of a specific format.
             FormatCapabilities GetFormatCapabilities(Format format) const;
 
@@ -185,6 +189,13 @@ namespace AZ
             //! Called when the device is reporting cpu timing statistics.
             virtual void UpdateCpuTimingStatisticsInternal() const = 0;
 
+            //! Called when the device is ending a frame, to report the device memory budget to the residency manager.
+            //! Platforms that don't report a budget keep the empty default one, which isn't enforced.
+            virtual DeviceMemoryBudget GetMemoryBudgetInternal() const
+            {
+                return {};
+            }
+
             //! Fills the capabilities for each format.
             virtual void FillFormatsCapabilitiesInternal(FormatCapabilitiesList& formatsCapabilities) = 0;
 
@@ -204,6 +215,8 @@ namespace AZ
             // Tracks whether the device is in the BeginFrame / EndFrame scope.
             bool m_isInFrame = false;
 
+            ResidencyManager m_residencyManager;
+
             AZStd::array<Format, static_cast<uint32_t>(Format::Count)> m_nearestSupportedFormats;
 
             FormatCapabilitiesList m_formatsCapabilities;
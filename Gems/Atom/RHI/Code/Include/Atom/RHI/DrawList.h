@@ -12,6 +12,7 @@
 #include <Atom/RHI.Reflect/Handle.h>
 
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/containers/bitset.h>
 
@@ -44,6 +45,23 @@ namespace AZ
         /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
+        /// Estimates the CPU cost of recording the draw list into command lists, in units of a draw item submitted without
+        /// any state change. Items switching to another pipeline state cost more, since the pipeline and its SRGs are bound again.
+        /// @param costPrefixSums Receives the cost of the items up to and including each item of the draw list.
+        /// @return The total cost of the draw list.
+        uint32_t GetDrawListCost(DrawListView drawList, AZStd::vector<uint32_t>& costPrefixSums);
+
+        /// Partitions the draw list into sub-lists of about the same recording cost and returns the sub-list
+        /// denoted by the provided index.
+        /// @param costPrefixSums The costs returned by GetDrawListCost for the same draw list.
+        DrawListView GetDrawListPartition(DrawListView drawList, AZStd::span<const uint32_t> costPrefixSums, size_t partitionIndex, size_t partitionCount);
+
+        /// Packs the state of a draw item into a 64 bit key: its pipeline state in the top 24 bits, a hash of its shader resource groups,
+        /// which include its material, in the next 24 bits, and its depth bucket in the low 16 bits. Buckets are logarithmic in depth.
+        uint64_t GetDrawItemStateSortKey(const DrawItemProperties& drawItemProperties);
+
+        /// Sorts the draw list with a parallel least significant digit radix sort over its packed keys, one key at a time
+        /// from the least significant. Items with equal keys keep their order.
         void SortDrawList(DrawList& drawList, DrawListSortType sortType);
     }
 }
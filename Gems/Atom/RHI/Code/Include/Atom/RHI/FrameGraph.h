@@ -116,6 +116,7 @@ namespace AZ
             ResultCode UseCopyAttachment(const ImageScopeAttachmentDescriptor& descriptor, ScopeAttachmentAccess access);
             ResultCode UseQueryPool(Ptr<QueryPool> queryPool, const RHI::Interval& interval, QueryPoolScopeAttachmentType type, ScopeAttachmentAccess access);
             void ExecuteAfter(const ScopeId& scopeId);
+            void ExecuteAfterAsSubpass(const ScopeId& scopeId);
             void ExecuteBefore(const ScopeId& scopeId);
             void SignalFence(Fence& fence);
             void SetEstimatedItemCount(uint32_t itemCount);
@@ -12,6 +12,7 @@
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -171,6 +172,9 @@ namespace AZ
             ObjectCache<ImageView> m_imageViewCache;
             ObjectCache<BufferView> m_bufferViewCache;
 
+            // Guards the local view caches, which are accessed by the attachments compiling their views in parallel
+            AZStd::mutex m_localViewCacheMutex;
+
         };
     }
 }
@@ -197,6 +197,14 @@ namespace AZ
             {
                 m_frameGraph.ExecuteAfter(producerScopeId);
             }
+
+            //! Declares that this scope executes right after the given scope id, as the next subpass of its render pass.
+            //! Both scopes must have built their pipeline states for the same RenderAttachmentLayout, using consecutive subpasses.
+            //! Platforms that don't support subpasses execute the scopes as separate render passes.
+            void ExecuteAfterAsSubpass(const ScopeId& producerScopeId)
+            {
+                m_frameGraph.ExecuteAfterAsSubpass(producerScopeId);
+            }
             
             //! Declares that the given scope at @param consumerScopeId depends on this scope, forcing this
             //! scope to execute first.
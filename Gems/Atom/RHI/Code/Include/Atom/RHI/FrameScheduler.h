@@ -16,6 +16,7 @@
 #include <Atom/RHI/RayTracingShaderTable.h>
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RHI/ScopeProducerEmpty.h>
+#include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -173,6 +174,10 @@ namespace AZ
             //! Returns memory statistics for the previous frame.
             const MemoryStatistics* GetMemoryStatistics() const;
 
+            //! Returns the statistics of the shader resource groups compiled since the previous frame, summed over all pools.
+            //! They're also pushed to the RHI metrics of the statistical profiler.
+            const ShaderResourceGroupCompileStatistics& GetShaderResourceGroupCompileStatistics() const;
+
             //! Returns the implicit root scope id.
             ScopeId GetRootScopeId() const;
 
@@ -221,6 +226,7 @@ namespace AZ
 
             AZStd::sys_time_t m_lastFrameEndTime{};
             MemoryStatistics m_memoryStatistics;
+            ShaderResourceGroupCompileStatistics m_shaderResourceGroupCompileStatistics;
 
             FrameSchedulerCompileRequest m_compileRequest;
 
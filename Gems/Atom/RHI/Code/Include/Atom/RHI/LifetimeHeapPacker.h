@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/AttachmentId.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        //! Places transient attachments on a heap from their whole lifetimes, known ahead of their activation.
+        //! The aliased heaps place each attachment at the first free offset when it is activated, so a small attachment
+        //! activated early can split the space a bigger attachment needs later. The packer instead places the biggest
+        //! attachments first, each one at the lowest offset that doesn't overlap an attachment alive during one of its scopes.
+        //! The placement done in activation order is computed as well, and the packer keeps whichever has the lowest peak.
+        class LifetimeHeapPacker
+        {
+        public:
+            //! Heap offset in bytes of each attachment.
+            using OffsetMap = AZStd::unordered_map<AttachmentId, size_t>;
+
+            struct Request
+            {
+                AttachmentId m_attachmentId;
+                size_t m_sizeInBytes = 0;
+                size_t m_alignmentInBytes = 1;
+
+                //! Index of the first scope using the attachment.
+                uint32_t m_scopeIndexFirst = 0;
+
+                //! Index of the last scope using the attachment. Attachments sharing a scope are never overlapped.
+                uint32_t m_scopeIndexLast = 0;
+            };
+
+            //! Removes all requests and placements.
+            void Reset();
+
+            //! Adds an attachment to place. Requests must be added in activation order, that is by increasing first scope.
+            //! @return the index of the request, to set its last scope once it is known.
+            uint32_t AddRequest(const Request& request);
+
+            //! Sets the last scope of a request added while its attachment was still active.
+            void SetScopeIndexLast(uint32_t requestIndex, uint32_t scopeIndexLast);
+
+            //! Places all requests added since the last Reset.
+            void Pack();
+
+            bool IsEmpty() const;
+
+            //! Returns the offsets computed by the last Pack.
+            const OffsetMap& GetOffsets() const;
+
+            //! Returns the heap size needed by the offsets of the last Pack.
+            size_t GetPeakInBytes() const;
+
+            //! Returns the heap size needed when placing the requests at the first free offset in activation order,
+            //! like the aliased heaps do.
+            size_t GetFirstFitPeakInBytes() const;
+
+            //! Returns the heap size needed when placing the biggest requests first.
+            size_t GetPackedPeakInBytes() const;
+
+        private:
+            //! Places the requests in the provided order and returns the resulting peak.
+            size_t Place(const AZStd::vector<uint32_t>& order, AZStd::vector<size_t>& offsets) const;
+
+            AZStd::vector<Request> m_requests;
+            OffsetMap m_offsets;
+            size_t m_firstFitPeakInBytes = 0;
+            size_t m_packedPeakInBytes = 0;
+        };
+    }
+}
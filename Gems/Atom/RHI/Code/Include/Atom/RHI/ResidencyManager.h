@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        //! Memory budget of the process on the device memory, as reported by the platform
+        //! (DXGI QueryVideoMemoryInfo, VK_EXT_memory_budget, ...).
+        struct DeviceMemoryBudget
+        {
+            //! The memory the process can use without oversubscribing the device, 0 if the platform doesn't report it.
+            size_t m_budgetInBytes = 0;
+
+            //! The memory currently used by the process.
+            size_t m_usageInBytes = 0;
+        };
+
+        //! Interface of the resource owners able to release device memory on request, like the streaming image
+        //! controllers dropping mips of their images.
+        class ResidencyEvictor
+        {
+        public:
+            virtual ~ResidencyEvictor() = default;
+
+            //! Returns the number of frames since the least recent use of the resources the evictor can release,
+            //! or false if it can't release any memory.
+            virtual bool GetLeastRecentUseAge(size_t& ageInFrames) const = 0;
+
+            //! Releases the memory of the resources unused for at least the given number of frames, the least recently
+            //! used ones first, until the requested size is released. Returns the size actually released.
+            virtual size_t Evict(size_t sizeInBytes, size_t minAgeInFrames) = 0;
+        };
+
+        //! Keeps the memory usage of a device under the budget reported by the platform. When the usage goes over a
+        //! fraction of the budget (see r_residencyEvictThreshold), the registered evictors are asked to release memory,
+        //! the ones holding the least recently used resources first, until the usage is back under the target fraction
+        //! (see r_residencyEvictTarget). The other pools and transient heaps aren't evictable, they are relieved by the
+        //! memory released from the streaming ones.
+        class ResidencyManager final
+        {
+        public:
+            ResidencyManager() = default;
+            ResidencyManager(const ResidencyManager&) = delete;
+
+            //! Registers an evictor, which must be unregistered before it is destroyed.
+            void RegisterEvictor(ResidencyEvictor& evictor);
+
+            //! Unregisters an evictor.
+            void UnregisterEvictor(ResidencyEvictor& evictor);
+
+            //! Evicts memory from the registered evictors if the usage is over the budget. Called by the device every frame.
+            void Update(const DeviceMemoryBudget& memoryBudget);
+
+            //! Returns the budget reported at the last update.
+            DeviceMemoryBudget GetMemoryBudget() const;
+
+            //! Returns whether the usage was over the target fraction of the budget at the last update. The evictors
+            //! shouldn't bring back the memory they released while the device is under pressure. It doesn't lock the
+            //! manager, so the evictors can call it while holding their own locks.
+            bool IsUnderPressure() const;
+
+        private:
+            mutable AZStd::mutex m_mutex;
+            AZStd::vector<ResidencyEvictor*> m_evictors;
+
+            struct EvictorAge
+            {
+                ResidencyEvictor* m_evictor = nullptr;
+                size_t m_ageInFrames = 0;
+            };
+
+            // Scratch list of the evictors sorted from the least recently used resources, kept to reuse its memory.
+            AZStd::vector<EvictorAge> m_evictorAges;
+
+            DeviceMemoryBudget m_memoryBudget;
+            AZStd::atomic_bool m_underPressure{ false };
+        };
+    }
+}
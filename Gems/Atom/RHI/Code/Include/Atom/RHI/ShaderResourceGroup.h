@@ -9,6 +9,7 @@
 
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AZ
 {
@@ -74,13 +75,22 @@ namespace AZ
 
             //! Update the view hash within m_viewHash
             void UpdateViewHash(const AZ::Name& viewName, const HashValue64 viewHash);
-            
+
+            //! Returns the byte range of the constant data modified since the copy of the compiled data at the given index was last
+            //! written, and clears it. The range may extend past the end of the constant data, and is empty if m_min >= m_max.
+            //! Backends cycling through up to RHI::Limits::Device::FrameCountMax copies of the compiled data use it to only
+            //! upload the constants that changed in the copy they are updating.
+            Interval ConsumeConstantDataDirtyInterval(uint32_t compiledDataIndex);
+
         protected:
             ShaderResourceGroup() = default;
 
         private:
             void SetData(const ShaderResourceGroupData& data);
 
+            //! Adds a range of modified constant data to the dirty interval of every copy of the compiled data
+            void MarkConstantDataDirty(const Interval& constantDataInterval);
+
             ShaderResourceGroupData m_data;
 
             // The binding slot cached from the layout.
@@ -98,6 +108,9 @@ namespace AZ
 
             // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
             AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
+
+            // Range of constant data modified since each copy of the compiled data was last written
+            AZStd::array<Interval, RHI::Limits::Device::FrameCountMax> m_constantDataDirtyIntervals;
         };
     }
 }
@@ -205,7 +205,7 @@ namespace AZ
                 SamplerMask = AZ_BIT(static_cast<uint32_t>(ResourceType::Sampler))
             };
 
-            //! Reset the update mask
+            //! Reset the update mask, along with the range of constant data modified since the last compile
             void ResetUpdateMask();
 
             //! Enable compilation for a resourceType specified by resourceTypeMask
@@ -213,6 +213,10 @@ namespace AZ
 
             //! Returns the mask that is suppose to indicate which resource type was updated
             uint32_t GetUpdateMask() const;
+
+            //! Returns the byte range of the constant data modified since the update mask was last reset.
+            //! Backends only upload this range of the constant buffer when recompiling the group.
+            Interval GetConstantDataDirtyInterval() const;
             
         private:
             static const ConstPtr<ImageView> s_nullImageView;
@@ -13,12 +13,31 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        //! Statistics of the shader resource group compiles of a pool, gathered since they were last reset.
+        struct ShaderResourceGroupCompileStatistics
+        {
+            //! Number of groups compiled by the platform
+            uint32_t m_compiledGroupCount = 0;
+
+            //! Number of groups queued for compile that were skipped since nothing changed
+            uint32_t m_skippedGroupCount = 0;
+
+            //! Bytes of constant data uploaded by the platform
+            size_t m_uploadedConstantBytes = 0;
+
+            //! Bytes of constant data of the compiled groups, which is what uploading all of their constants would cost
+            size_t m_totalConstantBytes = 0;
+
+            ShaderResourceGroupCompileStatistics& operator+=(const ShaderResourceGroupCompileStatistics& rhs);
+        };
+
          //! The platform-independent base class for ShaderResourceGroupPools. Platforms
          //! should inherit from this class to implement platform-dependent pooling of
          //! shader resource groups.
@@ -77,9 +96,18 @@ namespace AZ
             //! Returns whether groups in this pool have a sampler table.
             bool HasSamplerGroup() const;
 
+            //! Returns the compile statistics gathered since the last call to ResetCompileStatistics().
+            ShaderResourceGroupCompileStatistics GetCompileStatistics() const;
+
+            //! Resets the compile statistics, called by the frame scheduler at the end of the SRG compilation of each frame.
+            void ResetCompileStatistics();
+
         protected:
             ShaderResourceGroupPool();
 
+            //! Called by the platform from CompileGroupInternal with the number of bytes of constant data it uploaded.
+            void ReportConstantDataUpload(size_t uploadedBytes);
+
             //////////////////////////////////////////////////////////////////////////
             // ResourcePool overrides
             void ShutdownInternal() override;
@@ -155,6 +183,12 @@ namespace AZ
 
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
+
+            // Compile statistics, updated from the compile jobs
+            AZStd::atomic<uint32_t> m_compiledGroupCount{ 0 };
+            AZStd::atomic<uint32_t> m_skippedGroupCount{ 0 };
+            AZStd::atomic<size_t> m_uploadedConstantBytes{ 0 };
+            AZStd::atomic<size_t> m_totalConstantBytes{ 0 };
         };
     }
 }
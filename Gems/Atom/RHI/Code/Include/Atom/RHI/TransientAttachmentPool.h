@@ -50,7 +50,10 @@ namespace AZ
             //! Gathers memory statistics for this heap during its next Begin / End cycle.
             GatherStatistics = AZ_BIT(1),
             //! Doesn't allocate any resources. Used when doing a pass to calculate how much memory will be used.
-            DontAllocateResources = AZ_BIT(2)
+            DontAllocateResources = AZ_BIT(2),
+            //! Places the attachments from their lifetimes instead of at the first free offset when they are activated.
+            //! The lifetimes are recorded during a pass with the DontAllocateResources flag, and used by the next pass that allocates resources.
+            IntervalPacking = AZ_BIT(3)
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::TransientAttachmentPoolCompileFlags)
@@ -191,6 +191,7 @@ namespace AZ
                 ->Value("KeyThenReverseDepth", DrawListSortType::KeyThenReverseDepth)
                 ->Value("DepthThenKey", DrawListSortType::DepthThenKey)
                 ->Value("ReverseDepthThenKey", DrawListSortType::ReverseDepthThenKey)
+                ->Value("KeyThenStateThenDepth", DrawListSortType::KeyThenStateThenDepth)
                 ;
 
             serializeContext->Enum<ScopeAttachmentAccess>()
@@ -19,10 +19,11 @@ namespace AZ
 {
     namespace RHI
     {
-        void AliasedHeap::Begin(TransientAttachmentPoolCompileFlags compileFlags)
+        void AliasedHeap::Begin(TransientAttachmentPoolCompileFlags compileFlags, const LifetimeHeapPacker::OffsetMap* placedOffsets)
         {
             m_totalAllocations = 0;
             m_compileFlags = compileFlags;
+            m_placedOffsets = placedOffsets;
             m_heapStats.m_watermarkSize = 0;
             m_heapStats.m_attachments.clear();
             m_barrierTracker->Reset();
@@ -49,6 +50,7 @@ namespace AZ
             }
 
             m_barrierTracker->End();
+            m_placedOffsets = nullptr;
         }
 
         RHI::ResultCode AliasedHeap::Init(Device& device, const AliasedHeapDescriptor& descriptor)
@@ -110,15 +112,13 @@ namespace AZ
             Buffer** activatedBuffer)
         {
             ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_bufferDescriptor);
-            
-            const size_t alignmentInBytes = memRequirements.m_alignmentInBytes;
-            RHI::VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, alignmentInBytes);
-            if (address.IsNull())
+
+            size_t heapOffsetInBytes = 0;
+            if (AllocateHeapOffset(descriptor.m_attachmentId, memRequirements, heapOffsetInBytes) != ResultCode::Success)
             {
                 return ResultCode::OutOfMemory;
             }
 
-            const size_t heapOffsetInBytes = address.m_ptr;
             m_heapStats.m_watermarkSize = AZStd::max(m_heapStats.m_watermarkSize, heapOffsetInBytes + static_cast<size_t>(memRequirements.m_sizeInBytes));
 
             Buffer* buffer = nullptr;
@@ -182,6 +182,33 @@ namespace AZ
             return ResultCode::Success;
         }
 
+        ResultCode AliasedHeap::AllocateHeapOffset(
+            const AttachmentId& attachmentId,
+            const ResourceMemoryRequirements& memRequirements,
+            size_t& heapOffsetInBytes)
+        {
+            if (m_placedOffsets)
+            {
+                // The offsets were computed from the lifetimes of all the attachments of the frame, so they can't overlap
+                // an attachment that is still active.
+                auto findIter = m_placedOffsets->find(attachmentId);
+                if (findIter == m_placedOffsets->end() || findIter->second + memRequirements.m_sizeInBytes > m_descriptor.m_budgetInBytes)
+                {
+                    return ResultCode::OutOfMemory;
+                }
+                heapOffsetInBytes = findIter->second;
+                return ResultCode::Success;
+            }
+
+            VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
+            if (address.IsNull())
+            {
+                return ResultCode::OutOfMemory;
+            }
+            heapOffsetInBytes = address.m_ptr;
+            return ResultCode::Success;
+        }
+
         void AliasedHeap::DeactivateBuffer(const AttachmentId& bufferAttachment, Scope& scope)
         {
             DeactivateResourceInternal(bufferAttachment, scope, AliasedResourceType::Buffer);
@@ -215,9 +242,12 @@ namespace AZ
                 m_barrierTracker->AddResource(aliasedResource);
             }
             
-            const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
-            m_firstFitAllocator.DeAllocate(heapAddress);
-            m_firstFitAllocator.GarbageCollectForce();
+            if (!m_placedOffsets)
+            {
+                const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
+                m_firstFitAllocator.DeAllocate(heapAddress);
+                m_firstFitAllocator.GarbageCollectForce();
+            }
             m_activeAttachmentLookup.erase(findIter);
         }
 
@@ -225,13 +255,12 @@ namespace AZ
         {
             ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_imageDescriptor);
 
-            VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
-            if (address.IsNull())
+            size_t heapOffsetInBytes = 0;
+            if (AllocateHeapOffset(descriptor.m_attachmentId, memRequirements, heapOffsetInBytes) != ResultCode::Success)
             {
                 return ResultCode::OutOfMemory;
             }
 
-            const size_t heapOffsetInBytes = address.m_ptr;
             m_heapStats.m_watermarkSize = AZStd::max(m_heapStats.m_watermarkSize, heapOffsetInBytes + static_cast<size_t>(memRequirements.m_sizeInBytes));
 
             Image* image = nullptr;
@@ -19,6 +19,8 @@ namespace AZ
             if (m_layout->GetDataSize() > 0)
             {
                 m_constantData.resize(m_layout->GetDataSize());
+                // New constant data differs from whatever was uploaded before
+                MarkDirty(0, m_constantData.size());
             }
         }
 
@@ -105,6 +107,7 @@ namespace AZ
             {
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 memcpy(&m_constantData[interval.m_min + byteOffset], bytes, byteCount);
+                MarkDirty(interval.m_min + byteOffset, byteCount);
                 return true;
             }
             return false;
@@ -115,6 +118,7 @@ namespace AZ
             if (ValidateConstantBufferAccess(0, byteCount))
             {
                 memcpy(m_constantData.data(), bytes, byteCount);
+                MarkDirty(0, byteCount);
                 return true;
             }
             return false;
@@ -125,6 +129,7 @@ namespace AZ
             if (ValidateConstantBufferAccess(byteOffset, byteCount))
             {
                 memcpy(&m_constantData[byteOffset], bytes, byteCount);
+                MarkDirty(byteOffset, byteCount);
                 return true;
             }
             return false;
@@ -189,6 +194,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 transform.StoreToRowMajorFloat12(matrixValue);
+                MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
                 return true;
             }
@@ -205,6 +211,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToRowMajorFloat12(matrixValue);
+                MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
                 return true;
             }
@@ -221,6 +228,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToRowMajorFloat16(matrixValue);
+                MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
                 return true;
 
@@ -237,6 +245,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat2(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
                 return true;
             }
@@ -253,6 +262,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat3(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
                 return true;
             }
@@ -268,6 +278,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat4(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
                 return true;
             }
@@ -283,6 +294,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat4(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
                 return true;
             }
@@ -428,6 +440,36 @@ namespace AZ
             return m_constantData;
         }
 
+        Interval ConstantsData::GetDirtyInterval() const
+        {
+            return m_dirtyInterval;
+        }
+
+        void ConstantsData::ResetDirtyInterval()
+        {
+            m_dirtyInterval = Interval();
+        }
+
+        void ConstantsData::MarkDirty(size_t offsetInBytes, size_t sizeInBytes)
+        {
+            if (sizeInBytes == 0)
+            {
+                return;
+            }
+
+            const uint32_t minOffset = aznumeric_cast<uint32_t>(offsetInBytes);
+            const uint32_t maxOffset = aznumeric_cast<uint32_t>(offsetInBytes + sizeInBytes);
+            if (m_dirtyInterval.m_min == m_dirtyInterval.m_max)
+            {
+                m_dirtyInterval = Interval(minOffset, maxOffset);
+            }
+            else
+            {
+                m_dirtyInterval.m_min = AZStd::min(m_dirtyInterval.m_min, minOffset);
+                m_dirtyInterval.m_max = AZStd::max(m_dirtyInterval.m_max, maxOffset);
+            }
+        }
+
         const ConstantsLayout* ConstantsData::GetLayout() const
         {
             AZ_Assert(m_layout, "Constants layout is null");
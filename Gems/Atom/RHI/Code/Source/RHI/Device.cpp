@@ -128,6 +128,7 @@ namespace AZ
             {
                 AZ_PROFILE_SCOPE(RHI, "Device: EndFrame");
                 EndFrameInternal();
+                m_residencyManager.Update(GetMemoryBudgetInternal());
                 m_isInFrame = false;
                 return ResultCode::Success;
             }
@@ -199,6 +200,11 @@ namespace AZ
             return m_resourcePoolDatabase;
         }
 
+        ResidencyManager& Device::GetResidencyManager()
+        {
+            return m_residencyManager;
+        }
+
         FormatCapabilities Device::GetFormatCapabilities(Format format) const
         {
             return m_formatsCapabilities[static_cast<uint32_t>(format)];
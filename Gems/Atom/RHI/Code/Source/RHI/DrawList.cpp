@@ -7,75 +7,161 @@
  */
 #include <Atom/RHI/DrawList.h>
 
-#include <AzCore/std/sort.h>
+#include <AzCore/Task/TaskAlgorithms.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Relative CPU cost of the state changes when recording draw items, see GetDrawListCost
+            constexpr uint32_t DrawItemCost = 1;
+            constexpr uint32_t PipelineStateChangeCost = 4;
+
+            // Draw lists are sorted in parallel in blocks of this many items
+            constexpr uint32_t SortGrainSize = 2048;
+
+            // Maps a depth to an unsigned key of the same order
+            uint32_t GetDepthKey(float depth)
+            {
+                uint32_t bits;
+                memcpy(&bits, &depth, sizeof(bits));
+                return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            }
+
+            uint64_t GetSortKeyKey(DrawItemSortKey sortKey)
+            {
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t(1) << 63);
+            }
+
+            uint64_t HashPointer(const void* pointer)
+            {
+                return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)) * 0x9E3779B97F4A7C15ull;
+            }
+
+            template<typename KeyFunction>
+            void RadixSortDrawList(DrawList& drawList, const KeyFunction& keyFunction)
+            {
+                AZ::TaskAlgorithmDesc desc;
+                desc.m_taskDescriptor = { "SortDrawList", "Graphics" };
+                desc.m_grainSize = SortGrainSize;
+                AZ::TaskAlgorithms::parallel_radix_sort(drawList.begin(), drawList.end(), keyFunction, desc);
+            }
+        }
+
+        uint64_t GetDrawItemStateSortKey(const DrawItemProperties& drawItemProperties)
+        {
+            uint64_t pipelineStateHash = 0;
+            uint64_t shaderResourceGroupHash = 0;
+            if (const DrawItem* drawItem = drawItemProperties.m_item)
+            {
+                pipelineStateHash = HashPointer(drawItem->m_pipelineState);
+                for (uint8_t i = 0; i < drawItem->m_shaderResourceGroupCount; ++i)
+                {
+                    shaderResourceGroupHash = (shaderResourceGroupHash ^ HashPointer(drawItem->m_shaderResourceGroups[i])) * 0x100000001B3ull;
+                }
+            }
+
+            // The top bits of the depth key hold its sign, exponent and the first bits of its mantissa
+            const uint64_t depthBucket = GetDepthKey(drawItemProperties.m_depth) >> 16;
+            return ((pipelineStateHash >> 40) << 40) | ((shaderResourceGroupHash >> 40) << 16) | depthBucket;
+        }
+
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
         {
-            if (drawList.empty())
+            if (drawList.empty() || partitionIndex >= partitionCount)
             {
                 return DrawListView{};
             }
 
-            const size_t itemsPerPartition = AZ::DivideAndRoundUp(drawList.size(), partitionCount);
-            const size_t itemOffset = partitionIndex * itemsPerPartition;
-            const size_t itemCount = AZStd::min(drawList.size() - itemOffset, itemsPerPartition);
-            return DrawListView(&drawList[itemOffset], itemCount);
+            // spread the remainder over the partitions, rounding the size of every partition up could leave the last ones
+            // past the end of the list
+            const size_t itemBegin = partitionIndex * drawList.size() / partitionCount;
+            const size_t itemEnd = (partitionIndex + 1) * drawList.size() / partitionCount;
+            return drawList.subspan(itemBegin, itemEnd - itemBegin);
+        }
+
+        uint32_t GetDrawListCost(DrawListView drawList, AZStd::vector<uint32_t>& costPrefixSums)
+        {
+            costPrefixSums.resize(drawList.size());
+
+            uint32_t cost = 0;
+            const PipelineState* pipelineState = nullptr;
+            for (size_t i = 0; i < drawList.size(); ++i)
+            {
+                const DrawItem* drawItem = drawList[i].m_item;
+                cost += DrawItemCost;
+                if (drawItem && drawItem->m_pipelineState != pipelineState)
+                {
+                    cost += PipelineStateChangeCost;
+                    pipelineState = drawItem->m_pipelineState;
+                }
+                costPrefixSums[i] = cost;
+            }
+            return cost;
+        }
+
+        DrawListView GetDrawListPartition(DrawListView drawList, AZStd::span<const uint32_t> costPrefixSums, size_t partitionIndex, size_t partitionCount)
+        {
+            if (costPrefixSums.size() != drawList.size())
+            {
+                AZ_Assert(false, "The cost of the draw list doesn't match its size");
+                return GetDrawListPartition(drawList, partitionIndex, partitionCount);
+            }
+
+            if (drawList.empty() || partitionIndex >= partitionCount)
+            {
+                return DrawListView{};
+            }
+
+            // an item belongs to the partition its running cost ends in
+            const uint64_t totalCost = costPrefixSums.back();
+            const uint64_t costBegin = partitionIndex * totalCost / partitionCount;
+            const uint64_t costEnd = (partitionIndex + 1) * totalCost / partitionCount;
+            const auto findItem = [&costPrefixSums](uint64_t cost)
+            {
+                return static_cast<size_t>(AZStd::upper_bound(costPrefixSums.begin(), costPrefixSums.end(), cost,
+                    [](uint64_t lhs, uint32_t rhs) { return lhs < rhs; }) - costPrefixSums.begin());
+            };
+            const size_t itemBegin = findItem(costBegin);
+            const size_t itemEnd = (partitionIndex + 1 == partitionCount) ? drawList.size() : findItem(costEnd);
+            return drawList.subspan(itemBegin, itemEnd - itemBegin);
         }
 
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
+            // The least significant key is sorted first, the stable sort by the next key keeps that order for equal keys
+            const auto sortKey = [](const DrawItemProperties& item) { return GetSortKeyKey(item.m_sortKey); };
+            const auto depth = [](const DrawItemProperties& item) { return GetDepthKey(item.m_depth); };
+            const auto reverseDepth = [](const DrawItemProperties& item) { return ~GetDepthKey(item.m_depth); };
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                    {
-                        if (a.m_sortKey != b.m_sortKey)
-                        {
-                            return a.m_sortKey < b.m_sortKey;
-                        }
-                        return a.m_depth < b.m_depth;
-                    }
-                );
+                RadixSortDrawList(drawList, depth);
+                RadixSortDrawList(drawList, sortKey);
                 break;
 
             case DrawListSortType::KeyThenReverseDepth:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                    {
-                        if (a.m_sortKey != b.m_sortKey)
-                        {
-                            return a.m_sortKey < b.m_sortKey;
-                        }
-                        return a.m_depth > b.m_depth;
-                    }
-                );
+                RadixSortDrawList(drawList, reverseDepth);
+                RadixSortDrawList(drawList, sortKey);
                 break;
 
             case DrawListSortType::DepthThenKey:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                    {
-                        if (a.m_depth != b.m_depth)
-                        {
-                            return a.m_depth < b.m_depth;
-                        }
-                        return a.m_sortKey < b.m_sortKey;
-                    }
-                );
+                RadixSortDrawList(drawList, sortKey);
+                RadixSortDrawList(drawList, depth);
                 break;
 
             case DrawListSortType::ReverseDepthThenKey:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                    {
-                        if (a.m_depth != b.m_depth)
-                        {
-                            return a.m_depth > b.m_depth;
-                        }
-                        return a.m_sortKey < b.m_sortKey;
-                    }
-                );
+                RadixSortDrawList(drawList, sortKey);
+                RadixSortDrawList(drawList, reverseDepth);
+                break;
+
+            case DrawListSortType::KeyThenStateThenDepth:
+                RadixSortDrawList(drawList, GetDrawItemStateSortKey);
+                RadixSortDrawList(drawList, sortKey);
                 break;
             }
         }
@@ -418,6 +418,14 @@ namespace AZ
             }
         }
 
+        void FrameGraph::ExecuteAfterAsSubpass(const ScopeId& producerScopeId)
+        {
+            if (Scope* producer = FindScope(producerScopeId))
+            {
+                InsertEdge(*producer, *m_currentScope, GraphEdgeType::SameGroup);
+            }
+        }
+
         void FrameGraph::ExecuteBefore(const ScopeId& consumerScopeId)
         {
             if (Scope* consumer = FindScope(consumerScopeId))
@@ -444,23 +452,18 @@ namespace AZ
 
             // Build a list with the edges for each producer node.
             AZStd::vector<AZStd::list<uint32_t>> graphEdges(m_graphNodes.size());
-            for (uint32_t edgeIndex = 0; edgeIndex < m_graphEdges.size(); ++edgeIndex)
+            // Group edges go after the single ones, so their consumers are the last ones unblocked by a producer and
+            // the first ones popped from the unblocked nodes. We need this so nodes in the same group are together.
+            for (GraphEdgeType edgeType : { GraphEdgeType::DifferentGroup, GraphEdgeType::SameGroup })
             {
-                const GraphEdge& edge = m_graphEdges[edgeIndex];
-                AZStd::list<uint32_t>& edgeList = graphEdges[edge.m_producerIndex];
-                // Push group edges at the front so they are processed before the single ones.
-                // We need this so nodes in the same group are together.
-                switch (edge.m_type)
+                for (uint32_t edgeIndex = 0; edgeIndex < m_graphEdges.size(); ++edgeIndex)
                 {
-                case GraphEdgeType::DifferentGroup:
-                    edgeList.push_back(edgeIndex);
-                    break;
-                case GraphEdgeType::SameGroup:
-                    edgeList.push_front(edgeIndex);
-                    break;
-                default:
-                    AZ_Assert(false, "Invalid edge type %d", edge.m_type);
-                    break;
+                    const GraphEdge& edge = m_graphEdges[edgeIndex];
+                    AZ_Assert(edge.m_type == GraphEdgeType::DifferentGroup || edge.m_type == GraphEdgeType::SameGroup, "Invalid edge type %d", edge.m_type);
+                    if (edge.m_type == edgeType)
+                    {
+                        graphEdges[edge.m_producerIndex].push_back(edgeIndex);
+                    }
                 }
             }
 
@@ -17,7 +17,9 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Task/TaskAlgorithms.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
@@ -25,6 +27,27 @@ namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool, r_transientAttachmentIntervalPacking, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to place the transient attachments from their lifetimes in the frame instead of at the first free offset");
+
+        AZ_CVAR(bool, r_frameGraphParallelCompile, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to compile the resource views of the attachments and the platform scopes of the frame graph in parallel");
+
+        namespace
+        {
+            // Scopes and attachments are compiled in parallel in blocks of this many elements
+            constexpr uint32_t ScopeCompileGrainSize = 8;
+            constexpr uint32_t ResourceViewCompileGrainSize = 16;
+
+            TaskAlgorithmDesc GetCompileTaskDesc(const char* name, uint32_t grainSize)
+            {
+                TaskAlgorithmDesc desc;
+                desc.m_taskDescriptor = { name, "Graphics" };
+                desc.m_grainSize = grainSize;
+                return desc;
+            }
+        }
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -146,9 +169,23 @@ namespace AZ
             {
                 AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Scope Compile");
 
-                for (Scope* scope : frameGraph.GetScopes())
+                // Scopes only compile their own data at this point, the resource pool resolves all being queued on the root scope.
+                const AZStd::vector<Scope*>& scopes = frameGraph.GetScopes();
+                const auto compileScope = [this, &scopes](size_t scopeIndex)
                 {
-                    scope->Compile(GetDevice());
+                    scopes[scopeIndex]->Compile(GetDevice());
+                };
+
+                if (r_frameGraphParallelCompile)
+                {
+                    TaskAlgorithms::parallel_for(size_t(0), scopes.size(), compileScope, GetCompileTaskDesc("FrameGraphScopeCompile", ScopeCompileGrainSize));
+                }
+                else
+                {
+                    for (size_t scopeIndex = 0; scopeIndex < scopes.size(); ++scopeIndex)
+                    {
+                        compileScope(scopeIndex);
+                    }
                 }
             }
 
@@ -695,17 +732,28 @@ namespace AZ
                 transientAttachmentPool.End();
             };
 
+            // The interval packing needs the lifetimes of all attachments before placing them, which are recorded by the first pass.
+            // Without aliasing every attachment lives through the whole frame, so there is nothing to pack.
+            const bool intervalPacking = r_transientAttachmentIntervalPacking &&
+                !CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing);
+            const TransientAttachmentPoolCompileFlags packingCompileFlags =
+                intervalPacking ? TransientAttachmentPoolCompileFlags::IntervalPacking : TransientAttachmentPoolCompileFlags::None;
+
             AZStd::optional<TransientAttachmentStatistics::MemoryUsage> memoryUsage;
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
-            if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
+            const bool useMemoryHint = transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint;
+            if (useMemoryHint || intervalPacking)
             {
                 // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources | packingCompileFlags);
+                if (useMemoryHint)
+                {
+                    memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                }
             }
 
             // Second pass uses the information about memory usage
-            TransientAttachmentPoolCompileFlags poolCompileFlags = TransientAttachmentPoolCompileFlags::None;
+            TransientAttachmentPoolCompileFlags poolCompileFlags = packingCompileFlags;
             if (CheckBitsAny(statisticsFlags, FrameSchedulerStatisticsFlags::GatherTransientAttachmentStatistics))
             {
                 poolCompileFlags |= TransientAttachmentPoolCompileFlags::GatherStatistics;
@@ -720,15 +768,21 @@ namespace AZ
             const HashValue64 hash = imageViewDescriptor.GetHash(static_cast<HashValue64>(baseHash));
 
             // Attempt to find the image view in the cache.
-            ImageView* imageView = m_imageViewCache.Find(static_cast<uint64_t>(hash));
+            ImageView* imageView = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_localViewCacheMutex);
+                imageView = m_imageViewCache.Find(static_cast<uint64_t>(hash));
+            }
 
             if (!imageView)
             {
-                // Create a new image view instance and insert it into the cache.
+                // Create a new image view instance and insert it into the cache. The view is initialized outside of the lock,
+                // no other attachment can insert the same view as the hash includes the image of this attachment.
                 Ptr<ImageView> imageViewPtr = Factory::Get().CreateImageView();
                 if (imageViewPtr->Init(*image, imageViewDescriptor) == ResultCode::Success)
                 {
                     imageView = imageViewPtr.get();
+                    AZStd::lock_guard<AZStd::mutex> lock(m_localViewCacheMutex);
                     m_imageViewCache.Insert(static_cast<uint64_t>(hash), AZStd::move(imageViewPtr));
                 }
                 else
@@ -746,15 +800,21 @@ namespace AZ
             const HashValue64 hash = bufferViewDescriptor.GetHash(static_cast<HashValue64>(baseHash));
 
             // Attempt to find the buffer view in the cache.
-            BufferView* bufferView = m_bufferViewCache.Find(static_cast<uint64_t>(hash));
+            BufferView* bufferView = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_localViewCacheMutex);
+                bufferView = m_bufferViewCache.Find(static_cast<uint64_t>(hash));
+            }
 
             if (!bufferView)
             {
-                // Create a new buffer view instance and insert it into the cache.
+                // Create a new buffer view instance and insert it into the cache. The view is initialized outside of the lock,
+                // no other attachment can insert the same view as the hash includes the buffer of this attachment.
                 Ptr<BufferView> bufferViewPtr = Factory::Get().CreateBufferView();
                 if (bufferViewPtr->Init(*buffer, bufferViewDescriptor) == ResultCode::Success)
                 {
                     bufferView = bufferViewPtr.get();
+                    AZStd::lock_guard<AZStd::mutex> lock(m_localViewCacheMutex);
                     m_bufferViewCache.Insert(static_cast<uint64_t>(hash), AZStd::move(bufferViewPtr));
                 }
                 else
@@ -769,13 +829,16 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileResourceViews");
 
-            for (ImageFrameAttachment* imageAttachment : attachmentDatabase.GetImageAttachments())
+            // Every image and buffer belongs to a single attachment, so the attachments compile their views independently
+            const AZStd::vector<ImageFrameAttachment*>& imageAttachments = attachmentDatabase.GetImageAttachments();
+            const auto compileImageViews = [this, &imageAttachments](size_t attachmentIndex)
             {
+                ImageFrameAttachment* imageAttachment = imageAttachments[attachmentIndex];
                 Image* image = imageAttachment->GetImage();
 
                 if (!image)
                 {
-                    continue;
+                    return;
                 }
                 // Iterates through every usage of the image, pulls image views
                 // from image's cache or local cache, and assigns them to the scope attachments.
@@ -799,15 +862,17 @@ namespace AZ
                      
                     node->SetImageView(imageView);
                 }
-            }
+            };
 
-            for (BufferFrameAttachment* bufferAttachment : attachmentDatabase.GetBufferAttachments())
+            const AZStd::vector<BufferFrameAttachment*>& bufferAttachments = attachmentDatabase.GetBufferAttachments();
+            const auto compileBufferViews = [this, &bufferAttachments](size_t attachmentIndex)
             {
+                BufferFrameAttachment* bufferAttachment = bufferAttachments[attachmentIndex];
                 Buffer* buffer = bufferAttachment->GetBuffer();
 
                 if (!buffer)
                 {
-                    continue;
+                    return;
                 }
 
                 // Iterates through every usage of the buffer attachment, pulls buffer views
@@ -832,6 +897,25 @@ namespace AZ
 
                     node->SetBufferView(bufferView);
                 }
+            };
+
+            if (r_frameGraphParallelCompile)
+            {
+                TaskAlgorithms::parallel_for(size_t(0), imageAttachments.size(), compileImageViews,
+                    GetCompileTaskDesc("FrameGraphImageViewCompile", ResourceViewCompileGrainSize));
+                TaskAlgorithms::parallel_for(size_t(0), bufferAttachments.size(), compileBufferViews,
+                    GetCompileTaskDesc("FrameGraphBufferViewCompile", ResourceViewCompileGrainSize));
+            }
+            else
+            {
+                for (size_t attachmentIndex = 0; attachmentIndex < imageAttachments.size(); ++attachmentIndex)
+                {
+                    compileImageViews(attachmentIndex);
+                }
+                for (size_t attachmentIndex = 0; attachmentIndex < bufferAttachments.size(); ++attachmentIndex)
+                {
+                    compileBufferViews(attachmentIndex);
+                }
             }
         }
     }
@@ -36,6 +36,12 @@ namespace AZ
     {
         static constexpr const char* frameTimeMetricName = "Frame to Frame Time";
         static constexpr AZ::Crc32 frameTimeMetricId = AZ_CRC_CE(frameTimeMetricName);
+        static constexpr const char* srgCompiledGroupsMetricName = "SRG Compiled Groups";
+        static constexpr AZ::Crc32 srgCompiledGroupsMetricId = AZ_CRC_CE(srgCompiledGroupsMetricName);
+        static constexpr const char* srgSkippedGroupsMetricName = "SRG Skipped Groups";
+        static constexpr AZ::Crc32 srgSkippedGroupsMetricId = AZ_CRC_CE(srgSkippedGroupsMetricName);
+        static constexpr const char* srgUploadedConstantBytesMetricName = "SRG Uploaded Constant Bytes";
+        static constexpr AZ::Crc32 srgUploadedConstantBytesMetricId = AZ_CRC_CE(srgUploadedConstantBytesMetricName);
 
         ResultCode FrameScheduler::Init(Device& device, const FrameSchedulerDescriptor& descriptor)
         {
@@ -89,6 +95,9 @@ namespace AZ
 
                 auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
                 rhiMetrics.GetStatsManager().AddStatistic(frameTimeMetricId, frameTimeMetricName, /*units=*/"clocks", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgCompiledGroupsMetricId, srgCompiledGroupsMetricName, /*units=*/"groups", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgSkippedGroupsMetricId, srgSkippedGroupsMetricName, /*units=*/"groups", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(srgUploadedConstantBytesMetricId, srgUploadedConstantBytesMetricName, /*units=*/"bytes", /*failIfExist=*/false);
             }
 
             m_lastFrameEndTime = AZStd::GetTimeNowTicks();
@@ -380,6 +389,25 @@ namespace AZ
             //we try to compact and re-compile SRGs.
             [[maybe_unused]] RHI::ResultCode resultCode = m_device->CompactSRGMemory();
             AZ_Assert(resultCode == RHI::ResultCode::Success, "SRG compaction failed and this can lead to a gpu crash.");
+
+            m_shaderResourceGroupCompileStatistics = {};
+            const auto gatherStatisticsFunction = [this](ShaderResourceGroupPool* srgPool)
+            {
+                m_shaderResourceGroupCompileStatistics += srgPool->GetCompileStatistics();
+                srgPool->ResetCompileStatistics();
+            };
+            resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(gatherStatisticsFunction)>(gatherStatisticsFunction);
+
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                statsProfiler->PushSample(
+                    rhiMetricsId, srgCompiledGroupsMetricId, static_cast<double>(m_shaderResourceGroupCompileStatistics.m_compiledGroupCount));
+                statsProfiler->PushSample(
+                    rhiMetricsId, srgSkippedGroupsMetricId, static_cast<double>(m_shaderResourceGroupCompileStatistics.m_skippedGroupCount));
+                statsProfiler->PushSample(
+                    rhiMetricsId, srgUploadedConstantBytesMetricId,
+                    static_cast<double>(m_shaderResourceGroupCompileStatistics.m_uploadedConstantBytes));
+            }
         }
 
         void FrameScheduler::BuildRayTracingShaderTables()
@@ -594,6 +622,11 @@ namespace AZ
                 : nullptr;
         }
 
+        const ShaderResourceGroupCompileStatistics& FrameScheduler::GetShaderResourceGroupCompileStatistics() const
+        {
+            return m_shaderResourceGroupCompileStatistics;
+        }
+
         const TransientAttachmentStatistics* FrameScheduler::GetTransientAttachmentStatistics() const
         {
             return
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RHI/LifetimeHeapPacker.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        void LifetimeHeapPacker::Reset()
+        {
+            m_requests.clear();
+            m_offsets.clear();
+            m_firstFitPeakInBytes = 0;
+            m_packedPeakInBytes = 0;
+        }
+
+        uint32_t LifetimeHeapPacker::AddRequest(const Request& request)
+        {
+            AZ_Assert(m_requests.empty() || m_requests.back().m_scopeIndexFirst <= request.m_scopeIndexFirst,
+                "Attachment %s is not added in activation order", request.m_attachmentId.GetCStr());
+            m_requests.push_back(request);
+            return static_cast<uint32_t>(m_requests.size() - 1);
+        }
+
+        void LifetimeHeapPacker::SetScopeIndexLast(uint32_t requestIndex, uint32_t scopeIndexLast)
+        {
+            Request& request = m_requests[requestIndex];
+            AZ_Assert(request.m_scopeIndexFirst <= scopeIndexLast, "Invalid lifetime for attachment %s", request.m_attachmentId.GetCStr());
+            request.m_scopeIndexLast = scopeIndexLast;
+        }
+
+        void LifetimeHeapPacker::Pack()
+        {
+            m_offsets.clear();
+
+            AZStd::vector<uint32_t> order(m_requests.size());
+            for (uint32_t requestIndex = 0; requestIndex < order.size(); ++requestIndex)
+            {
+                order[requestIndex] = requestIndex;
+            }
+
+            AZStd::vector<size_t> firstFitOffsets;
+            m_firstFitPeakInBytes = Place(order, firstFitOffsets);
+
+            // Biggest first, then longest lived first, since they constrain the placement of everything else.
+            AZStd::sort(order.begin(), order.end(), [this](uint32_t lhs, uint32_t rhs)
+            {
+                const Request& lhsRequest = m_requests[lhs];
+                const Request& rhsRequest = m_requests[rhs];
+                if (lhsRequest.m_sizeInBytes != rhsRequest.m_sizeInBytes)
+                {
+                    return lhsRequest.m_sizeInBytes > rhsRequest.m_sizeInBytes;
+                }
+                const uint32_t lhsLifetime = lhsRequest.m_scopeIndexLast - lhsRequest.m_scopeIndexFirst;
+                const uint32_t rhsLifetime = rhsRequest.m_scopeIndexLast - rhsRequest.m_scopeIndexFirst;
+                if (lhsLifetime != rhsLifetime)
+                {
+                    return lhsLifetime > rhsLifetime;
+                }
+                return lhs < rhs;
+            });
+
+            AZStd::vector<size_t> packedOffsets;
+            m_packedPeakInBytes = Place(order, packedOffsets);
+
+            // Sorting by size is a heuristic, it can lose against the activation order on some frames.
+            const AZStd::vector<size_t>& offsets = m_packedPeakInBytes <= m_firstFitPeakInBytes ? packedOffsets : firstFitOffsets;
+            for (size_t requestIndex = 0; requestIndex < m_requests.size(); ++requestIndex)
+            {
+                m_offsets.emplace(m_requests[requestIndex].m_attachmentId, offsets[requestIndex]);
+            }
+        }
+
+        size_t LifetimeHeapPacker::Place(const AZStd::vector<uint32_t>& order, AZStd::vector<size_t>& offsets) const
+        {
+            struct Range
+            {
+                size_t m_begin = 0;
+                size_t m_end = 0;
+            };
+
+            offsets.assign(m_requests.size(), 0);
+            AZStd::vector<uint32_t> placed;
+            placed.reserve(order.size());
+            AZStd::vector<Range> conflicts;
+            size_t peakInBytes = 0;
+            for (uint32_t requestIndex : order)
+            {
+                const Request& request = m_requests[requestIndex];
+
+                // Gather the memory ranges of the placed attachments alive in any scope of this one.
+                conflicts.clear();
+                for (uint32_t placedIndex : placed)
+                {
+                    const Request& placedRequest = m_requests[placedIndex];
+                    if (placedRequest.m_scopeIndexFirst <= request.m_scopeIndexLast && request.m_scopeIndexFirst <= placedRequest.m_scopeIndexLast)
+                    {
+                        conflicts.push_back({ offsets[placedIndex], offsets[placedIndex] + placedRequest.m_sizeInBytes });
+                    }
+                }
+
+                AZStd::sort(conflicts.begin(), conflicts.end(), [](const Range& lhs, const Range& rhs)
+                {
+                    return lhs.m_begin < rhs.m_begin;
+                });
+
+                // Take the lowest gap between the conflicting ranges that fits the attachment.
+                const size_t alignment = AZStd::max<size_t>(request.m_alignmentInBytes, 1);
+                size_t offset = 0;
+                for (const Range& conflict : conflicts)
+                {
+                    if (offset + request.m_sizeInBytes <= conflict.m_begin)
+                    {
+                        break;
+                    }
+                    offset = AZStd::max(offset, AZ::RoundUpToMultiple(conflict.m_end, alignment));
+                }
+
+                offsets[requestIndex] = offset;
+                peakInBytes = AZStd::max(peakInBytes, offset + request.m_sizeInBytes);
+                placed.push_back(requestIndex);
+            }
+            return peakInBytes;
+        }
+
+        bool LifetimeHeapPacker::IsEmpty() const
+        {
+            return m_requests.empty();
+        }
+
+        const LifetimeHeapPacker::OffsetMap& LifetimeHeapPacker::GetOffsets() const
+        {
+            return m_offsets;
+        }
+
+        size_t LifetimeHeapPacker::GetPeakInBytes() const
+        {
+            return AZStd::min(m_firstFitPeakInBytes, m_packedPeakInBytes);
+        }
+
+        size_t LifetimeHeapPacker::GetFirstFitPeakInBytes() const
+        {
+            return m_firstFitPeakInBytes;
+        }
+
+        size_t LifetimeHeapPacker::GetPackedPeakInBytes() const
+        {
+            return m_packedPeakInBytes;
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RHI/ResidencyManager.h>
+#include <Atom/RHI.Reflect/Base.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        AZ_CVAR(bool, r_residencyManager, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Releases streamed memory, like the mips of the streaming images, when the device memory usage goes over the budget reported by the platform.");
+
+        AZ_CVAR(float, r_residencyEvictThreshold, 0.95f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The fraction of the device memory budget over which the residency manager starts releasing memory.");
+
+        AZ_CVAR(float, r_residencyEvictTarget, 0.9f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The fraction of the device memory budget the residency manager releases memory down to, and under which the evicted memory can be streamed back.");
+
+        void ResidencyManager::RegisterEvictor(ResidencyEvictor& evictor)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_evictors.push_back(&evictor);
+        }
+
+        void ResidencyManager::UnregisterEvictor(ResidencyEvictor& evictor)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto findIter = AZStd::find(m_evictors.begin(), m_evictors.end(), &evictor);
+            if (findIter != m_evictors.end())
+            {
+                m_evictors.erase(findIter);
+            }
+        }
+
+        void ResidencyManager::Update(const DeviceMemoryBudget& memoryBudget)
+        {
+            AZ_PROFILE_FUNCTION(RHI);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_memoryBudget = memoryBudget;
+
+            if (!r_residencyManager || memoryBudget.m_budgetInBytes == 0)
+            {
+                m_underPressure = false;
+                return;
+            }
+
+            const float budget = static_cast<float>(memoryBudget.m_budgetInBytes);
+            const size_t thresholdInBytes = static_cast<size_t>(budget * AZStd::clamp(static_cast<float>(r_residencyEvictThreshold), 0.0f, 1.0f));
+            const size_t targetInBytes = AZStd::min(thresholdInBytes, static_cast<size_t>(budget * AZStd::clamp(static_cast<float>(r_residencyEvictTarget), 0.0f, 1.0f)));
+
+            m_underPressure = memoryBudget.m_usageInBytes > targetInBytes;
+            if (memoryBudget.m_usageInBytes <= thresholdInBytes)
+            {
+                return;
+            }
+
+            m_evictorAges.clear();
+            for (ResidencyEvictor* evictor : m_evictors)
+            {
+                size_t ageInFrames = 0;
+                if (evictor->GetLeastRecentUseAge(ageInFrames))
+                {
+                    m_evictorAges.push_back({ evictor, ageInFrames });
+                }
+            }
+
+            // The evictor holding the least recently used resource releases the ones older than the least recently used
+            // resource of the next evictor, so that the resources are released from the least recently used across all evictors
+            size_t sizeToEvict = memoryBudget.m_usageInBytes - targetInBytes;
+            while (sizeToEvict > 0 && !m_evictorAges.empty())
+            {
+                AZStd::sort(m_evictorAges.begin(), m_evictorAges.end(), [](const EvictorAge& lhs, const EvictorAge& rhs)
+                {
+                    return lhs.m_ageInFrames > rhs.m_ageInFrames;
+                });
+
+                EvictorAge& oldest = m_evictorAges.front();
+                const size_t minAgeInFrames = m_evictorAges.size() > 1 ? m_evictorAges[1].m_ageInFrames : 0;
+                const size_t evictedSize = oldest.m_evictor->Evict(sizeToEvict, minAgeInFrames);
+                sizeToEvict -= AZStd::min(evictedSize, sizeToEvict);
+
+                // An evictor that couldn't release its least recently used resource is done for this update
+                if (evictedSize == 0 || !oldest.m_evictor->GetLeastRecentUseAge(oldest.m_ageInFrames))
+                {
+                    m_evictorAges.erase(m_evictorAges.begin());
+                }
+            }
+        }
+
+        DeviceMemoryBudget ResidencyManager::GetMemoryBudget() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_memoryBudget;
+        }
+
+        bool ResidencyManager::IsUnderPressure() const
+        {
+            return m_underPressure;
+        }
+    }
+}
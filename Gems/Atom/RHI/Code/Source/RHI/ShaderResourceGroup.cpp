@@ -9,6 +9,7 @@
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ
 {
@@ -62,6 +63,7 @@ namespace AZ
             
             //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
             m_rhiUpdateMask |= sourceUpdateMask;
+            MarkConstantDataDirty(data.GetConstantDataDirtyInterval());
             for (uint32_t i = 0; i < static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count); i++)
             {
                 if (RHI::CheckBit(sourceUpdateMask, static_cast<AZ::u8>(i)))
@@ -101,6 +103,41 @@ namespace AZ
         void ShaderResourceGroup::EnableRhiResourceTypeCompilation(const ShaderResourceGroupData::ResourceTypeMask resourceTypeMask)
         {
             m_rhiUpdateMask = AZ::RHI::SetBits(m_rhiUpdateMask, static_cast<uint32_t>(resourceTypeMask));
+
+            // Forcing the compilation of the constants, for instance when partial compilation is disabled, uploads all of them.
+            if (RHI::CheckBitsAny(static_cast<uint32_t>(resourceTypeMask), static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)))
+            {
+                MarkConstantDataDirty(Interval(0, AZStd::numeric_limits<uint32_t>::max()));
+            }
+        }
+
+        void ShaderResourceGroup::MarkConstantDataDirty(const Interval& constantDataInterval)
+        {
+            if (constantDataInterval.m_min >= constantDataInterval.m_max)
+            {
+                return;
+            }
+
+            for (Interval& interval : m_constantDataDirtyIntervals)
+            {
+                if (interval.m_min < interval.m_max)
+                {
+                    interval.m_min = AZStd::min(interval.m_min, constantDataInterval.m_min);
+                    interval.m_max = AZStd::max(interval.m_max, constantDataInterval.m_max);
+                }
+                else
+                {
+                    interval = constantDataInterval;
+                }
+            }
+        }
+
+        Interval ShaderResourceGroup::ConsumeConstantDataDirtyInterval(uint32_t compiledDataIndex)
+        {
+            AZ_Assert(compiledDataIndex < m_constantDataDirtyIntervals.size(), "Compiled data index %u is out of range", compiledDataIndex);
+            const Interval interval = m_constantDataDirtyIntervals[compiledDataIndex];
+            m_constantDataDirtyIntervals[compiledDataIndex] = Interval();
+            return interval;
         }
 
         void ShaderResourceGroup::ResetResourceTypeIteration(const ShaderResourceGroupData::ResourceType resourceType)
@@ -391,6 +391,12 @@ namespace AZ
         void ShaderResourceGroupData::ResetUpdateMask()
         {
             m_updateMask = 0;
+            m_constantsData.ResetDirtyInterval();
+        }
+
+        Interval ShaderResourceGroupData::GetConstantDataDirtyInterval() const
+        {
+            return m_constantsData.GetDirtyInterval();
         }
  
     } // namespace RHI
@@ -9,6 +9,7 @@
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ
 {
@@ -74,6 +75,9 @@ namespace AZ
 
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
+
+                // Nothing was written to the compiled data of the platform yet.
+                group.m_constantDataDirtyIntervals.fill(Interval(0, AZStd::numeric_limits<uint32_t>::max()));
             }
             return resultCode;
         }
@@ -352,10 +356,46 @@ namespace AZ
                 
                 //Reset update mask if the latency check has been fulfilled
                 shaderResourceGroup.DisableCompilationForAllResourceTypes();
+
+                m_compiledGroupCount.fetch_add(1, AZStd::memory_order_relaxed);
+                m_totalConstantBytes.fetch_add(shaderResourceGroupData.GetConstantData().size(), AZStd::memory_order_relaxed);
                 return resultCode;
             }
+            m_skippedGroupCount.fetch_add(1, AZStd::memory_order_relaxed);
             return ResultCode::Success;
         }
+
+        void ShaderResourceGroupPool::ReportConstantDataUpload(size_t uploadedBytes)
+        {
+            m_uploadedConstantBytes.fetch_add(uploadedBytes, AZStd::memory_order_relaxed);
+        }
+
+        ShaderResourceGroupCompileStatistics ShaderResourceGroupPool::GetCompileStatistics() const
+        {
+            ShaderResourceGroupCompileStatistics statistics;
+            statistics.m_compiledGroupCount = m_compiledGroupCount.load(AZStd::memory_order_relaxed);
+            statistics.m_skippedGroupCount = m_skippedGroupCount.load(AZStd::memory_order_relaxed);
+            statistics.m_uploadedConstantBytes = m_uploadedConstantBytes.load(AZStd::memory_order_relaxed);
+            statistics.m_totalConstantBytes = m_totalConstantBytes.load(AZStd::memory_order_relaxed);
+            return statistics;
+        }
+
+        void ShaderResourceGroupPool::ResetCompileStatistics()
+        {
+            m_compiledGroupCount = 0;
+            m_skippedGroupCount = 0;
+            m_uploadedConstantBytes = 0;
+            m_totalConstantBytes = 0;
+        }
+
+        ShaderResourceGroupCompileStatistics& ShaderResourceGroupCompileStatistics::operator+=(const ShaderResourceGroupCompileStatistics& rhs)
+        {
+            m_compiledGroupCount += rhs.m_compiledGroupCount;
+            m_skippedGroupCount += rhs.m_skippedGroupCount;
+            m_uploadedConstantBytes += rhs.m_uploadedConstantBytes;
+            m_totalConstantBytes += rhs.m_totalConstantBytes;
+            return *this;
+        }
     
         void ShaderResourceGroupPool::CompileGroupsForInterval(Interval interval)
         {
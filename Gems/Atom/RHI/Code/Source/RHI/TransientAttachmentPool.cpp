@@ -77,6 +77,7 @@ namespace AZ
             m_statistics.m_heaps.clear();
             m_statistics.m_scopes.clear();
             m_statistics.m_reservedMemory = {};
+            m_statistics.m_intervalPacking = {};
 
             m_currentScope = nullptr;
             BeginInternal(compileFlags, memoryHint);
@@ -9,6 +9,7 @@
 #include "RHITestFixture.h"
 #include <Atom/RHI/PoolAllocator.h>
 #include <Atom/RHI/FreeListAllocator.h>
+#include <Atom/RHI/LifetimeHeapPacker.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/time.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -314,4 +315,59 @@ namespace UnitTest
         // We've now occupied the last two blocks, so we once again expect 0 fragmentation
         ASSERT_EQ(allocator.ComputeFragmentation(), 0.f);
     }
+
+    TEST_F(AllocatorTest, LifetimeHeapPacker)
+    {
+        auto makeRequest = [](const char* name, size_t sizeInBytes, uint32_t scopeIndexFirst, uint32_t scopeIndexLast)
+        {
+            RHI::LifetimeHeapPacker::Request request;
+            request.m_attachmentId = RHI::AttachmentId{ name };
+            request.m_sizeInBytes = sizeInBytes;
+            request.m_alignmentInBytes = 256;
+            request.m_scopeIndexFirst = scopeIndexFirst;
+            request.m_scopeIndexLast = scopeIndexLast;
+            return request;
+        };
+
+        // In activation order, the small attachment that outlives the first big one splits the space the second big one needs.
+        const AZStd::vector<RHI::LifetimeHeapPacker::Request> requests = {
+            makeRequest("Big0", 512, 0, 0),
+            makeRequest("Small", 256, 0, 1),
+            makeRequest("Big1", 1024, 1, 1),
+        };
+
+        RHI::LifetimeHeapPacker packer;
+        EXPECT_TRUE(packer.IsEmpty());
+        for (const RHI::LifetimeHeapPacker::Request& request : requests)
+        {
+            packer.AddRequest(request);
+        }
+        packer.Pack();
+
+        EXPECT_EQ(packer.GetFirstFitPeakInBytes(), 1792);
+        EXPECT_EQ(packer.GetPackedPeakInBytes(), 1280);
+        EXPECT_EQ(packer.GetPeakInBytes(), 1280);
+
+        // Attachments alive in the same scope must never overlap.
+        const RHI::LifetimeHeapPacker::OffsetMap& offsets = packer.GetOffsets();
+        ASSERT_EQ(offsets.size(), requests.size());
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            const size_t offsetI = offsets.at(requests[i].m_attachmentId);
+            EXPECT_EQ(offsetI % 256, 0);
+            EXPECT_LE(offsetI + requests[i].m_sizeInBytes, packer.GetPeakInBytes());
+            for (size_t j = i + 1; j < requests.size(); ++j)
+            {
+                const bool sharesScope = requests[i].m_scopeIndexFirst <= requests[j].m_scopeIndexLast &&
+                    requests[j].m_scopeIndexFirst <= requests[i].m_scopeIndexLast;
+                const size_t offsetJ = offsets.at(requests[j].m_attachmentId);
+                const bool overlaps = offsetI < offsetJ + requests[j].m_sizeInBytes && offsetJ < offsetI + requests[i].m_sizeInBytes;
+                EXPECT_FALSE(sharesScope && overlaps);
+            }
+        }
+
+        packer.Reset();
+        EXPECT_TRUE(packer.IsEmpty());
+        EXPECT_EQ(packer.GetPeakInBytes(), 0);
+    }
 }
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <Atom/RHI/DrawList.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace Benchmark
+{
+    // Sorts draw lists the size of the lists of a view, with a few hundred distinct sort keys like the pipeline states of a scene
+    class DrawListSortBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t SortKeyCount = 256;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            GenerateDrawList(state.range(0));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            GenerateDrawList(state.range(0));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_drawList = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            m_drawList = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void GenerateDrawList(int64_t itemCount)
+        {
+            std::mt19937 randomEngine(1);
+            std::uniform_int_distribution<uint32_t> sortKeyDistribution(0, SortKeyCount - 1);
+            std::uniform_real_distribution<float> depthDistribution(0.0f, 1000.0f);
+
+            m_drawList.resize(itemCount);
+            for (AZ::RHI::DrawItemProperties& item : m_drawList)
+            {
+                item.m_sortKey = sortKeyDistribution(randomEngine);
+                item.m_depth = depthDistribution(randomEngine);
+            }
+        }
+
+        void RunSort(benchmark::State& state, AZ::RHI::DrawListSortType sortType)
+        {
+            AZ::RHI::DrawList drawList;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                drawList = m_drawList;
+                state.ResumeTiming();
+
+                AZ::RHI::SortDrawList(drawList, sortType);
+                benchmark::DoNotOptimize(drawList.data());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        AZ::RHI::DrawList m_drawList;
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenDepth)(benchmark::State& state)
+    {
+        RunSort(state, AZ::RHI::DrawListSortType::KeyThenDepth);
+    }
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenDepth)->RangeMultiplier(8)->Range(512, 32768);
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_SortDrawList_ReverseDepthThenKey)(benchmark::State& state)
+    {
+        RunSort(state, AZ::RHI::DrawListSortType::ReverseDepthThenKey);
+    }
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_SortDrawList_ReverseDepthThenKey)->RangeMultiplier(8)->Range(512, 32768);
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenStateThenDepth)(benchmark::State& state)
+    {
+        RunSort(state, AZ::RHI::DrawListSortType::KeyThenStateThenDepth);
+    }
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, BM_SortDrawList_KeyThenStateThenDepth)->RangeMultiplier(8)->Range(512, 32768);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
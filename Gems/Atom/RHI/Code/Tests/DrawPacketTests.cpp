@@ -418,6 +418,115 @@ namespace UnitTest
 
         delete drawPacket;
     }
+
+    TEST_F(DrawPacketTest, DrawListPartitionCoversList)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        DrawPacketData drawPacketData(random);
+
+        RHI::DrawPacketBuilder builder;
+        const RHI::DrawPacket* drawPacket = drawPacketData.Build(builder);
+
+        RHI::DrawList drawList;
+        for (size_t i = 0; i < drawPacket->GetDrawItemCount(); ++i)
+        {
+            drawList.push_back(drawPacket->GetDrawItem(i));
+        }
+
+        AZStd::vector<uint32_t> costPrefixSums;
+        const uint32_t cost = RHI::GetDrawListCost(drawList, costPrefixSums);
+        EXPECT_GE(cost, drawList.size());
+        EXPECT_EQ(costPrefixSums.size(), drawList.size());
+
+        // more partitions than items leaves some of them empty, but every item must be in exactly one partition
+        for (size_t partitionCount : { size_t(1), size_t(3), drawList.size(), drawList.size() + 5 })
+        {
+            size_t uniformItemCount = 0;
+            size_t costItemCount = 0;
+            for (size_t partitionIndex = 0; partitionIndex < partitionCount; ++partitionIndex)
+            {
+                const RHI::DrawListView uniformPartition = RHI::GetDrawListPartition(drawList, partitionIndex, partitionCount);
+                if (!uniformPartition.empty())
+                {
+                    EXPECT_EQ(uniformPartition.data(), drawList.data() + uniformItemCount);
+                }
+                uniformItemCount += uniformPartition.size();
+
+                const RHI::DrawListView costPartition = RHI::GetDrawListPartition(drawList, costPrefixSums, partitionIndex, partitionCount);
+                if (!costPartition.empty())
+                {
+                    EXPECT_EQ(costPartition.data(), drawList.data() + costItemCount);
+                }
+                costItemCount += costPartition.size();
+            }
+            EXPECT_EQ(uniformItemCount, drawList.size());
+            EXPECT_EQ(costItemCount, drawList.size());
+        }
+
+        delete drawPacket;
+    }
+
+    TEST_F(DrawPacketTest, SortDrawListMatchesComparisonSort)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        RHI::DrawList drawList(5000);
+        for (RHI::DrawItemProperties& item : drawList)
+        {
+            item.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 16) - 8;
+            item.m_depth = static_cast<float>(random.GetRandom() % 1000) * 0.25f - 100.0f;
+        }
+
+        const auto compareKeyThenDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return (a.m_sortKey != b.m_sortKey) ? (a.m_sortKey < b.m_sortKey) : (a.m_depth < b.m_depth);
+        };
+        const auto compareReverseDepthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return (a.m_depth != b.m_depth) ? (a.m_depth > b.m_depth) : (a.m_sortKey < b.m_sortKey);
+        };
+
+        RHI::DrawList sorted = drawList;
+        RHI::SortDrawList(sorted, RHI::DrawListSortType::KeyThenDepth);
+        EXPECT_TRUE(AZStd::is_sorted(sorted.begin(), sorted.end(), compareKeyThenDepth));
+
+        sorted = drawList;
+        RHI::SortDrawList(sorted, RHI::DrawListSortType::ReverseDepthThenKey);
+        EXPECT_TRUE(AZStd::is_sorted(sorted.begin(), sorted.end(), compareReverseDepthThenKey));
+    }
+
+    TEST_F(DrawPacketTest, SortDrawListByStateGroupsPipelineStates)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        constexpr size_t PipelineStateCount = 4;
+        AZStd::vector<RHI::Ptr<RHI::PipelineState>> pipelineStates;
+        AZStd::array<RHI::DrawItem, PipelineStateCount> drawItems;
+        for (size_t i = 0; i < PipelineStateCount; ++i)
+        {
+            pipelineStates.push_back(RHI::Factory::Get().CreatePipelineState());
+            drawItems[i].m_pipelineState = pipelineStates.back().get();
+        }
+
+        RHI::DrawList drawList(1000);
+        for (RHI::DrawItemProperties& item : drawList)
+        {
+            item.m_item = &drawItems[random.GetRandom() % PipelineStateCount];
+            item.m_sortKey = random.GetRandom() % 2;
+            item.m_depth = static_cast<float>(random.GetRandom() % 1000);
+        }
+        RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenStateThenDepth);
+
+        // The sort key still comes first, and each pipeline state is contiguous within a sort key
+        size_t pipelineStateChanges = 0;
+        for (size_t i = 1; i < drawList.size(); ++i)
+        {
+            EXPECT_LE(drawList[i - 1].m_sortKey, drawList[i].m_sortKey);
+            if (drawList[i - 1].m_item->m_pipelineState != drawList[i].m_item->m_pipelineState)
+            {
+                ++pipelineStateChanges;
+            }
+        }
+        EXPECT_LE(pipelineStateChanges, 2 * PipelineStateCount - 1);
+    }
 }
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
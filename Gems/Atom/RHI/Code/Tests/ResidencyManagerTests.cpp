@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <Atom/RHI/ResidencyManager.h>
+#include <AzCore/std/string/string.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class ResidencyManagerTests
+        : public RHITestFixture
+    {
+    protected:
+        // Evictor of resources of a given age and size, logging the resources it releases
+        class TestEvictor
+            : public RHI::ResidencyEvictor
+        {
+        public:
+            struct Resource
+            {
+                size_t m_ageInFrames = 0;
+                size_t m_sizeInBytes = 0;
+            };
+
+            TestEvictor(const char* name, AZStd::vector<AZStd::string>& evictionLog)
+                : m_name(name)
+                , m_evictionLog(evictionLog)
+            {}
+
+            // Resources must be added from the least recently used one
+            void AddResource(size_t ageInFrames, size_t sizeInBytes)
+            {
+                m_resources.push_back({ ageInFrames, sizeInBytes });
+            }
+
+            bool GetLeastRecentUseAge(size_t& ageInFrames) const override
+            {
+                if (m_resources.empty())
+                {
+                    return false;
+                }
+                ageInFrames = m_resources.front().m_ageInFrames;
+                return true;
+            }
+
+            size_t Evict(size_t sizeInBytes, size_t minAgeInFrames) override
+            {
+                size_t evictedSize = 0;
+                while (evictedSize < sizeInBytes && !m_resources.empty() && m_resources.front().m_ageInFrames >= minAgeInFrames)
+                {
+                    m_evictionLog.push_back(AZStd::string::format("%s%zu", m_name, m_resources.front().m_ageInFrames));
+                    evictedSize += m_resources.front().m_sizeInBytes;
+                    m_resources.erase(m_resources.begin());
+                }
+                return evictedSize;
+            }
+
+        private:
+            const char* m_name;
+            AZStd::vector<AZStd::string>& m_evictionLog;
+            AZStd::vector<Resource> m_resources;
+        };
+
+        AZStd::vector<AZStd::string> m_evictionLog;
+    };
+
+    TEST_F(ResidencyManagerTests, Update_OverBudget_EvictsLeastRecentlyUsedAcrossEvictors)
+    {
+        TestEvictor evictorA("A", m_evictionLog);
+        evictorA.AddResource(10, 40);
+        evictorA.AddResource(4, 40);
+
+        TestEvictor evictorB("B", m_evictionLog);
+        evictorB.AddResource(8, 40);
+        evictorB.AddResource(2, 40);
+
+        RHI::ResidencyManager residencyManager;
+        residencyManager.RegisterEvictor(evictorA);
+        residencyManager.RegisterEvictor(evictorB);
+
+        // The usage is released down to 90% of the budget
+        residencyManager.Update({ 1000, 1000 });
+        EXPECT_TRUE(residencyManager.IsUnderPressure());
+        ASSERT_EQ(m_evictionLog.size(), 3);
+        EXPECT_EQ(m_evictionLog[0], "A10");
+        EXPECT_EQ(m_evictionLog[1], "B8");
+        EXPECT_EQ(m_evictionLog[2], "A4");
+
+        residencyManager.UnregisterEvictor(evictorA);
+        residencyManager.UnregisterEvictor(evictorB);
+    }
+
+    TEST_F(ResidencyManagerTests, Update_UnderThresholdOrWithoutBudget_DoesNotEvict)
+    {
+        TestEvictor evictor("A", m_evictionLog);
+        evictor.AddResource(10, 40);
+
+        RHI::ResidencyManager residencyManager;
+        residencyManager.RegisterEvictor(evictor);
+
+        residencyManager.Update({ 1000, 940 });
+        EXPECT_TRUE(residencyManager.IsUnderPressure());
+        EXPECT_TRUE(m_evictionLog.empty());
+
+        residencyManager.Update({ 1000, 500 });
+        EXPECT_FALSE(residencyManager.IsUnderPressure());
+        EXPECT_TRUE(m_evictionLog.empty());
+
+        residencyManager.Update({ 0, 1000 });
+        EXPECT_FALSE(residencyManager.IsUnderPressure());
+        EXPECT_TRUE(m_evictionLog.empty());
+
+        residencyManager.UnregisterEvictor(evictor);
+    }
+}
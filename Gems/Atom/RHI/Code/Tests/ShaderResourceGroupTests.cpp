@@ -763,4 +763,42 @@ namespace UnitTest
             EXPECT_NE(otherLayout->GetHash(), layout->GetHash());
         }
     }
+
+    TEST_F(ShaderResourceGroupTests, SRGDataConstantDirtyInterval_TracksModifiedBytes)
+    {
+        RHI::Ptr<RHI::ShaderResourceGroupLayout> layout = RHI::ShaderResourceGroupLayout::Create();
+        layout->SetBindingSlot(0);
+        layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ Name("m_floatA"), 0, 4, 0 });
+        layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ Name("m_floatB"), 4, 4, 0 });
+        layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ Name("m_floatC"), 8, 4, 0 });
+        EXPECT_TRUE(layout->Finalize());
+
+        const RHI::ShaderInputConstantIndex floatAIndex = layout->FindShaderInputConstantIndex(Name("m_floatA"));
+        const RHI::ShaderInputConstantIndex floatCIndex = layout->FindShaderInputConstantIndex(Name("m_floatC"));
+
+        RHI::ShaderResourceGroupData srgData(layout.get());
+
+        // New data is entirely dirty
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval(), RHI::Interval(0, 12));
+
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval().m_min, srgData.GetConstantDataDirtyInterval().m_max);
+
+        EXPECT_TRUE(srgData.SetConstant(floatCIndex, 1.0f));
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval(), RHI::Interval(8, 12));
+
+        EXPECT_TRUE(srgData.SetConstant(floatAIndex, 2.0f));
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval(), RHI::Interval(0, 12));
+
+        srgData.ResetUpdateMask();
+        EXPECT_TRUE(srgData.SetConstant(floatAIndex, 3.0f));
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval(), RHI::Interval(0, 4));
+
+        // Invalid accesses don't dirty anything
+        srgData.ResetUpdateMask();
+        AZ_TEST_START_ASSERTTEST;
+        EXPECT_FALSE(srgData.SetConstant(floatCIndex, AZ::Vector4::CreateOne()));
+        AZ_TEST_STOP_ASSERTTEST(1);
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval().m_min, srgData.GetConstantDataDirtyInterval().m_max);
+    }
 }
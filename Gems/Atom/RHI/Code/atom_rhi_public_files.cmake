@@ -138,6 +138,8 @@ set(FILES
     Include/Atom/RHI/ResourcePoolDatabase.h
     Source/RHI/ResourcePool.cpp
     Source/RHI/ResourcePoolDatabase.cpp
+    Include/Atom/RHI/ResidencyManager.h
+    Source/RHI/ResidencyManager.cpp
     Include/Atom/RHI/MemoryAllocation.h
     Include/Atom/RHI/MemorySubAllocator.h
     Include/Atom/RHI/MemoryLinearSubAllocator.h
@@ -179,6 +181,8 @@ set(FILES
     Include/Atom/RHI/AliasedHeap.h
     Source/RHI/AliasedHeap.cpp
     Include/Atom/RHI/AliasedAttachmentAllocator.h
+    Include/Atom/RHI/LifetimeHeapPacker.h
+    Source/RHI/LifetimeHeapPacker.cpp
     Include/Atom/RHI/AliasingBarrierTracker.h
     Source/RHI/AliasingBarrierTracker.cpp
     Include/Atom/RHI/TransientAttachmentPool.h
@@ -10,6 +10,7 @@ set(FILES
     Tests/RHITestFixture.h
     Tests/AllocatorTests.cpp
     Tests/BufferTests.cpp
+    Tests/DrawListBenchmarks.cpp
     Tests/DrawPacketTests.cpp
     Tests/FrameGraphTests.cpp
     Tests/FrameSchedulerTests.cpp
@@ -50,6 +51,7 @@ set(FILES
     Tests/ImagePropertyTests.cpp
     Tests/BufferPropertyTests.cpp
     Tests/IntervalMapTests.cpp
+    Tests/ResidencyManagerTests.cpp
 )
 
 set(SKIP_UNITY_BUILD_INCLUSION_FILES
@@ -65,6 +65,18 @@ namespace AZ
                 }
             }
 
+            RHI::DeviceMemoryBudget DeviceGetMemoryBudgetInternal(IDXGIAdapterX* dxgiAdapter)
+            {
+                RHI::DeviceMemoryBudget memoryBudget;
+                DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo;
+                if (S_OK == dxgiAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memoryInfo))
+                {
+                    memoryBudget.m_budgetInBytes = memoryInfo.Budget;
+                    memoryBudget.m_usageInBytes = memoryInfo.CurrentUsage;
+                }
+                return memoryBudget;
+            }
+
             D3D12_RESOURCE_STATES GetRayTracingAccelerationStructureResourceState()
             {
                 return D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
@@ -27,6 +27,7 @@ namespace AZ
         {
             void DeviceShutdownInternal(ID3D12DeviceX* device);
             void DeviceCompileMemoryStatisticsInternal(RHI::MemoryStatisticsBuilder& builder, IDXGIAdapterX* dxgiAdapter);
+            RHI::DeviceMemoryBudget DeviceGetMemoryBudgetInternal(IDXGIAdapterX* dxgiAdapter);
         }
 
         Device::Device()
@@ -188,6 +189,11 @@ namespace AZ
             m_commandQueueContext.UpdateCpuTimingStatistics();
         }
 
+        RHI::DeviceMemoryBudget Device::GetMemoryBudgetInternal() const
+        {
+            return Platform::DeviceGetMemoryBudgetInternal(m_dxgiAdapter.get());
+        }
+
         void Device::EndFrameInternal()
         {
             AZ_PROFILE_FUNCTION(RHI);
@@ -148,6 +148,7 @@ namespace AZ
             void ShutdownInternal() override;
             void CompileMemoryStatisticsInternal(RHI::MemoryStatisticsBuilder& builder) override;
             void UpdateCpuTimingStatisticsInternal() const override;
+            RHI::DeviceMemoryBudget GetMemoryBudgetInternal() const override;
             void BeginFrameInternal() override;
             void EndFrameInternal() override;
             void WaitForIdleInternal() override;
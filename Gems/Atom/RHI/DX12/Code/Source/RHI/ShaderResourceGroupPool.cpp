@@ -200,15 +200,23 @@ namespace AZ
             RHI::ShaderResourceGroup& groupBase,
             const RHI::ShaderResourceGroupData& groupData)
         {
-            typedef AZ::RHI::ShaderResourceGroupData::ResourceTypeMask ResourceMask;
             ShaderResourceGroup& group = static_cast<ShaderResourceGroup&>(groupBase);
             auto& device = static_cast<Device&>(GetDevice());
 
             group.m_compiledDataIndex = (group.m_compiledDataIndex + 1) % RHI::Limits::Device::FrameCountMax;
-            
-            if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
+
+            // Only the constants modified since this copy of the compiled data was last written are uploaded.
+            const RHI::Interval constantDataDirtyInterval = groupBase.ConsumeConstantDataDirtyInterval(group.m_compiledDataIndex);
+            if (m_constantBufferSize)
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                const AZStd::span<const uint8_t> constantData = groupData.GetConstantData();
+                const uint32_t dirtyMin = constantDataDirtyInterval.m_min;
+                const uint32_t dirtyMax = AZStd::min(constantDataDirtyInterval.m_max, aznumeric_cast<uint32_t>(constantData.size()));
+                if (dirtyMin < dirtyMax)
+                {
+                    memcpy(group.GetCompiledData().m_cpuConstantAddress + dirtyMin, constantData.data() + dirtyMin, dirtyMax - dirtyMin);
+                    ReportConstantDataUpload(dirtyMax - dirtyMin);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
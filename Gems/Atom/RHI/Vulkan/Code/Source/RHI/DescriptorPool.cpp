@@ -39,7 +39,10 @@ namespace AZ
 
             ReleaseQueue::Descriptor collectorDescriptor;
             collectorDescriptor.m_collectLatency = m_descriptor.m_collectLatency;
-            collectorDescriptor.m_collectFunction = nullptr;
+            collectorDescriptor.m_collectFunction = [this](RHI::Object& object)
+            {
+                RecycleObject(static_cast<ObjectType&>(object));
+            };
             m_collector.Init(collectorDescriptor);
 
             SetName(GetName());
@@ -57,6 +60,7 @@ namespace AZ
         void DescriptorPool::Shutdown()
         {
             m_collector.Collect(true);
+            m_freeObjects.clear();
             if (m_nativeDescriptorPool != VK_NULL_HANDLE)
             {
                 auto& device = static_cast<Device&>(GetDevice());
@@ -68,6 +72,8 @@ namespace AZ
 
         void DescriptorPool::Reset()
         {
+            // The free descriptor sets must be released while their native sets are still valid
+            m_freeObjects.clear();
             if (m_nativeDescriptorPool != VK_NULL_HANDLE)
             {
                 auto& device = static_cast<Device&>(GetDevice());
@@ -103,6 +109,24 @@ namespace AZ
             return m_objects.size() + m_collector.GetObjectCount();
         }
 
+        size_t DescriptorPool::GetFreeObjectCount() const
+        {
+            return m_freeObjects.size();
+        }
+
+        void DescriptorPool::RecycleObject(ObjectType& object)
+        {
+            // Descriptor sets with an unbounded array are reallocated to the size of their array when updated, so they aren't reused
+            if (object.GetNativeDescriptorSet() == VK_NULL_HANDLE || object.GetDescriptor().m_descriptorSetLayout->GetHasUnboundedArray())
+            {
+                return;
+            }
+
+            // Drop any update that wasn't committed by the previous owner
+            object.m_updateData.clear();
+            m_freeObjects.emplace_back(&object);
+        }
+
         VkDescriptorPool DescriptorPool::GetNativeDescriptorPool() const
         {
             return m_nativeDescriptorPool;
@@ -110,6 +134,15 @@ namespace AZ
 
         DescriptorPool::AllocResult DescriptorPool::Allocate(const DescriptorSetLayout& descriptorSetLayout)
         {
+            // Reuse a released descriptor set of the same layout, it is written again when its new group is compiled
+            if (!m_freeObjects.empty() && m_freeObjects.back()->GetDescriptor().m_descriptorSetLayout == &descriptorSetLayout)
+            {
+                RHI::Ptr<ObjectType> descriptorSet = AZStd::move(m_freeObjects.back());
+                m_freeObjects.pop_back();
+                m_objects.insert(descriptorSet);
+                return AZStd::make_pair(VK_SUCCESS, descriptorSet);
+            }
+
             auto descriptorSets = DescriptorSet::Create();
             DescriptorSet::Descriptor descSetDesc;
             descSetDesc.m_device = static_cast<Device*>(&GetDevice());
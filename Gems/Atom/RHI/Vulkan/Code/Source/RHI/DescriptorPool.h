@@ -65,6 +65,10 @@ namespace AZ
             // Return the total number of objects in the pool. This include the pool objects +
             // the ones queued for deletion.
             size_t GetTotalObjectCount() const;
+
+            // Return the number of released objects kept for reuse. They still hold their native descriptor set,
+            // so they count towards the maximum number of sets of the pool.
+            size_t GetFreeObjectCount() const;
             void Collect();
 
         private:
@@ -75,6 +79,9 @@ namespace AZ
 
             RHI::ResultCode BuildNativeDescriptorPool();
 
+            // Keeps a released descriptor set for reuse, once the GPU has finished using it.
+            void RecycleObject(ObjectType& object);
+
             //////////////////////////////////////////////////////////////////////////
             // RHI::Object
             void SetNameInternal(const AZStd::string_view& name) override;
@@ -89,6 +96,8 @@ namespace AZ
             VkDescriptorPool m_nativeDescriptorPool = VK_NULL_HANDLE;
             ReleaseQueue m_collector;
             AZStd::unordered_set<RHI::Ptr<ObjectType>> m_objects;
+            // Released descriptor sets which are reused before allocating new ones, to avoid fragmenting the pool
+            AZStd::vector<RHI::Ptr<ObjectType>> m_freeObjects;
         };
     }
 }
@@ -189,15 +189,20 @@ namespace AZ
             m_updateData.push_back(AZStd::move(data));
         }
 
-        void DescriptorSet::UpdateConstantData(AZStd::span<const uint8_t> rawData)
+        uint32_t DescriptorSet::UpdateConstantData(AZStd::span<const uint8_t> rawData, const RHI::Interval& dirtyInterval)
         {
             AZ_Assert(m_constantDataBuffer, "Null constant buffer");
             const DescriptorSetLayout& layout = *m_descriptor.m_descriptorSetLayout;
 
             BufferMemoryView* memoryView = m_constantDataBuffer->GetBufferMemoryView();
-            uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
-            memcpy(mappedData, rawData.data(), rawData.size());
-            memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            const uint32_t dirtyMin = dirtyInterval.m_min;
+            const uint32_t dirtyMax = AZStd::min(dirtyInterval.m_max, aznumeric_cast<uint32_t>(rawData.size()));
+            if (dirtyMin < dirtyMax)
+            {
+                uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
+                memcpy(mappedData + dirtyMin, rawData.data() + dirtyMin, dirtyMax - dirtyMin);
+                memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            }
 
             WriteDescriptorData data;
             data.m_layoutIndex = layout.GetLayoutIndexFromGroupIndex(0, DescriptorSetLayout::ResourceType::ConstantData);
@@ -208,6 +213,8 @@ namespace AZ
             bufferInfo.range = rawData.size();
             data.m_bufferViewsInfo.push_back(bufferInfo);
             m_updateData.push_back(AZStd::move(data));
+
+            return dirtyMin < dirtyMax ? dirtyMax - dirtyMin : 0;
         }
 
         RHI::Ptr<DescriptorSet> DescriptorSet::Create()
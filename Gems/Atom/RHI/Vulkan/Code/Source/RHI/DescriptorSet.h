@@ -12,6 +12,7 @@
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/Image.h>
 #include <Atom/RHI/ImageView.h>
+#include <Atom/RHI.Reflect/Interval.h>
 #include <Atom/RHI.Reflect/SamplerState.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -63,7 +64,9 @@ namespace AZ
             void UpdateBufferViews(uint32_t index, const AZStd::span<const RHI::ConstPtr<RHI::BufferView>>& bufViews);
             void UpdateImageViews(uint32_t index, const AZStd::span<const RHI::ConstPtr<RHI::ImageView>>& imageViews, RHI::ShaderInputImageType imageType);
             void UpdateSamplers(uint32_t index, const AZStd::span<const RHI::SamplerState>& samplers);
-            void UpdateConstantData(AZStd::span<const uint8_t> data);
+            //! Uploads the given range of the constant data, which is clamped to the size of the data.
+            //! Returns the number of bytes uploaded.
+            uint32_t UpdateConstantData(AZStd::span<const uint8_t> data, const RHI::Interval& dirtyInterval);
 
             RHI::Ptr<BufferView> GetConstantDataBufferView() const;
 
@@ -72,10 +72,11 @@ namespace AZ
                 // Look for a pool that can allocate the descriptor set
                 for (DescriptorPool* pool : m_pools)
                 {
-                    // Check that we don't get over the max descriptor sets count.
+                    // Check that we don't get over the max descriptor sets count, unless a released set can be reused.
                     // In theory the pool would return a VK_ERROR_OUT_OF_POOL_MEMORY result but that would
                     // trigger a validation layer error that we want to avoid.
-                    if ((pool->GetTotalObjectCount() + 1) > m_poolDescriptor.m_maxSets)
+                    if (pool->GetFreeObjectCount() == 0 &&
+                        (pool->GetTotalObjectCount() + 1) > m_poolDescriptor.m_maxSets)
                     {
                         continue;
                     }
@@ -187,6 +188,8 @@ namespace AZ
 
         void DescriptorSetAllocator::Collect()
         {
+            // Collecting moves the released descriptor sets to the free lists of their pools
+            AZStd::lock_guard<AZStd::mutex> lock(m_subAllocatorMutex);
             m_subAllocator.Collect();
             m_poolAllocator.Collect();
         }
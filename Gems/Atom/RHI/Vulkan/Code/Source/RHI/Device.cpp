@@ -575,6 +575,12 @@ namespace AZ
             m_commandQueueContext.UpdateCpuTimingStatistics();
         }
 
+        RHI::DeviceMemoryBudget Device::GetMemoryBudgetInternal() const
+        {
+            const auto& physicalDevice = static_cast<const PhysicalDevice&>(GetPhysicalDevice());
+            return physicalDevice.GetMemoryBudget();
+        }
+
         AZStd::vector<RHI::Format> Device::GetValidSwapChainImageFormats(const RHI::WindowHandle& windowHandle) const
         {
             AZStd::vector<RHI::Format> formatsList;
@@ -318,6 +318,31 @@ namespace AZ
             }
         }
 
+        RHI::DeviceMemoryBudget PhysicalDevice::GetMemoryBudget() const
+        {
+            RHI::DeviceMemoryBudget memoryBudget;
+            if (VK_DEVICE_EXTENSION_SUPPORTED(KHR_get_physical_device_properties2) && VK_DEVICE_EXTENSION_SUPPORTED(EXT_memory_budget))
+            {
+                VkPhysicalDeviceMemoryBudgetPropertiesEXT budget = {};
+                budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+                VkPhysicalDeviceMemoryProperties2 properties = {};
+                properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+                properties.pNext = &budget;
+                vkGetPhysicalDeviceMemoryProperties2KHR(m_vkPhysicalDevice, &properties);
+
+                for (uint32_t i = 0; i < properties.memoryProperties.memoryHeapCount; ++i)
+                {
+                    if (RHI::CheckBitsAll(properties.memoryProperties.memoryHeaps[i].flags, static_cast<VkMemoryHeapFlags>(VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)))
+                    {
+                        memoryBudget.m_budgetInBytes += budget.heapBudget[i];
+                        memoryBudget.m_usageInBytes += budget.heapUsage[i];
+                    }
+                }
+            }
+            return memoryBudget;
+        }
+
         void PhysicalDevice::Init(VkPhysicalDevice vkPhysicalDevice)
         {
             m_vkPhysicalDevice = vkPhysicalDevice;
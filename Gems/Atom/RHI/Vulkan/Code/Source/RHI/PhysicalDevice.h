@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI/PhysicalDevice.h>
+#include <Atom/RHI/ResidencyManager.h>
 #include <AzCore/std/containers/bitset.h>
 #include <Atom/RHI.Reflect/Format.h>
 
@@ -93,6 +94,8 @@ namespace AZ
             //! Filter optional extensions based on what the physics device support.
             RawStringList FilterSupportedOptionalExtensions();
             void CompileMemoryStatistics(RHI::MemoryStatisticsBuilder& builder) const;
+            //! Returns the budget and usage of the device local heaps, empty without VK_EXT_memory_budget.
+            RHI::DeviceMemoryBudget GetMemoryBudget() const;
 
         private:
             PhysicalDevice() = default;
@@ -167,10 +167,13 @@ namespace AZ
                 descriptorSet.UpdateSamplers(layoutIndex, samplerArray);
             }
 
+            // Only the constants modified since this descriptor set was last written are uploaded.
+            const RHI::Interval constantDataDirtyInterval = group.ConsumeConstantDataDirtyInterval(group.GetCompileDataIndex());
             auto constantData = groupData.GetConstantData();
             if (!constantData.empty())
             {
-                descriptorSet.UpdateConstantData(constantData);
+                const uint32_t uploadedBytes = descriptorSet.UpdateConstantData(constantData, constantDataDirtyInterval);
+                ReportConstantDataUpload(uploadedBytes);
             }
             descriptorSet.CommitUpdates();
 
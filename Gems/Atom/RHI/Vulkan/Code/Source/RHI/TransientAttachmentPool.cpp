@@ -94,6 +94,7 @@ namespace AZ
                     size_t statsBegin = m_statistics.m_heaps.size();
                     allocator->GetStatistics(m_statistics.m_heaps);
                     CollectHeapStats(allocator->GetDescriptor().m_resourceTypeMask, { m_statistics.m_heaps.begin() + statsBegin, m_statistics.m_heaps.end() });
+                    allocator->GetIntervalPackingStatistics(m_statistics.m_intervalPacking);
                 }
             }
         }
@@ -14,6 +14,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 
@@ -48,6 +49,7 @@ namespace AZ
 
     namespace RPI
     {
+        class Model;
         class Scene;
 
         struct Cullable
@@ -106,6 +108,9 @@ namespace AZ
                 float m_lodSelectionRadius = 1.0f;
 
                 LodConfiguration m_lodConfiguration;
+
+                //! When set, the lods selected for a view are requested to the model for streaming, see Model::RequestLod()
+                Model* m_streamingModel = nullptr;
             };
             LodData m_lodData;
 
@@ -117,6 +122,10 @@ namespace AZ
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
 
+            //! Flag indicating that the draws of the object are culled against the view frustums on the GPU, so only the
+            //! coarse octree node culling is done for it on the CPU and the fine grained per object frustum tests are skipped
+            bool m_isGpuCulled = false;
+
             void SetDebugName([[maybe_unused]] const AZ::Name& debugName)
             {
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -147,6 +156,7 @@ namespace AZ
             bool m_enableStats = false;
             bool m_enableFrustumCulling = true;
             bool m_parallelOctreeTraversal = true;
+            bool m_sharedOctreeTraversal = true;
             bool m_freezeFrustums = false;
             bool m_debugDraw = false;
             bool m_drawViewFrustum = false;
@@ -266,6 +276,13 @@ namespace AZ
             //! Can be called in parallel (i.e. to perform culling on multiple views at the same time).
             void ProcessCullablesTG(const Scene& scene, View& view, AZ::TaskGraph& taskGraph);
 
+            //! Performs render culling and lod selection for multiple Views with a shared traversal of the visibility scene,
+            //! then adds the visible renderpackets to each View. Every visibility node is tested against all the view frustums in one pass,
+            //! which avoids walking the visibility scene once per view (e.g. for shadow cascades and cubemap faces).
+            //! Must be called between BeginCulling() and EndCulling(), each View must only be passed once per frame.
+            //! Will create child task graphs that signal the TaskGraphEvent to do the processing in parallel.
+            void ProcessCullablesTG(const Scene& scene, AZStd::span<const ViewPtr> views, AZ::TaskGraph& taskGraph);
+
             //! Adds a Cullable to the underlying visibility system(s).
             //! Must be called at least once on initialization and whenever a Cullable's position or bounds is changed.
             //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Reflect/Size.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Picks the render resolution scale of a render pipeline from its GPU frame time.
+        //! The scale lowers as soon as the smoothed frame time goes over the target, and only rises again once the frame time is
+        //! below the target by the configured headroom, so it doesn't oscillate around the target.
+        //! The scale only takes values that are multiples of the scale step and changes at most once every few frames. The
+        //! transient attachments sized from the scale then only take a handful of sizes, whose images the transient attachment
+        //! pools keep reusing instead of allocating new ones every frame.
+        class DynamicResolutionController
+        {
+        public:
+            struct Descriptor
+            {
+                //! The GPU frame time to stay under
+                float m_targetFrameTimeInMs = 16.6f;
+
+                //! The range of the scale applied to both the width and the height
+                float m_minScale = 0.5f;
+                float m_maxScale = 1.0f;
+
+                //! The scale is a multiple of this step
+                float m_scaleStep = 0.05f;
+
+                //! The scale only rises while the frame time is below the target by this fraction of the target
+                float m_headroom = 0.1f;
+
+                //! The number of frames to wait after a change of the scale, the frame time of the new scale is only measured a few
+                //! frames later
+                uint32_t m_framesBetweenChanges = 8;
+            };
+
+            void Init(const Descriptor& descriptor);
+
+            //! Resets the scale to the maximum scale and discards the measured frame times.
+            void Reset();
+
+            //! Updates the scale from the GPU time of the latest measured frame.
+            //! @return true if the scale changed
+            bool Update(float gpuFrameTimeInMs);
+
+            float GetScale() const;
+
+            //! Returns the size scaled by the current scale, never smaller than one pixel.
+            RHI::Size GetScaledSize(const RHI::Size& size) const;
+
+        private:
+            float QuantizeScale(float scale) const;
+
+            Descriptor m_descriptor;
+            float m_scale = 1.0f;
+            float m_smoothedFrameTimeInMs = 0.0f;
+            uint32_t m_framesSinceChange = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Reflect/Limits.h>
+#include <Atom/RPI.Public/GpuQuery/GpuQueryTypes.h>
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Pass;
+        class ParentPass;
+
+        //! Collects the GPU timestamps, and optionally the pipeline statistics, of every pass of a pass tree each frame, and keeps them
+        //! over a rolling window of frames to report per pass averages. The results are read from the pass queries without stalling,
+        //! so they are a few frames late; the passes are identified by their path so the stats survive pass tree rebuilds.
+        //! The window storage is allocated up front and reused, so collecting a frame has a fixed cost for a given pass tree.
+        //! The recorded frames can be written as a Chrome trace on the CPU profiler clock, see WriteChromeTrace().
+        class GpuPassProfiler
+        {
+        public:
+            static constexpr uint32_t DefaultWindowSize = 60;
+
+            struct PassStats
+            {
+                Name m_passPath;
+                uint32_t m_depth = 0; //!< The depth of the pass in the pass tree, the root pass is 0.
+                uint32_t m_frameCount = 0; //!< The number of frames of the window the pass got measured in.
+                float m_latestMs = 0.0f;
+                float m_averageMs = 0.0f;
+                float m_minMs = 0.0f;
+                float m_maxMs = 0.0f;
+                PipelineStatisticsResult m_averageStatistics; //!< Only set while the pipeline statistics are collected.
+            };
+
+            GpuPassProfiler();
+
+            //! Starts or stops collecting the results of the passes of the tree, enabling their queries as needed.
+            //! Queries that were enabled by something else are left enabled when the profiler stops.
+            void SetEnabled(ParentPass* rootPass, bool enabled, bool collectPipelineStatistics);
+            bool IsEnabled() const;
+
+            //! Sets the number of frames the stats are computed over, which forgets the recorded frames when it changes.
+            void SetWindowSize(uint32_t frameCount);
+            uint32_t GetWindowSize() const;
+
+            //! Records the latest results of all the passes of the tree, to call once per frame while enabled.
+            void Update(ParentPass* rootPass);
+
+            //! Gets the stats of a pass by its path, returns false when the pass wasn't measured in the window.
+            bool GetPassStats(const Name& passPath, PassStats& stats) const;
+
+            //! Gets the stats of every measured pass, in pass tree order.
+            void GetAllPassStats(AZStd::vector<PassStats>& outStats) const;
+
+            //! Returns the GPU time of the root pass averaged over the window, 0 when nothing got measured yet.
+            //! This is meant for controllers like the dynamic resolution or LOD selection that follow the GPU cost of the frame.
+            float GetAverageFrameTimeInMs() const;
+
+            //! Writes the recorded frames as Chrome trace events, one track per hardware queue. The GPU begin of each frame is
+            //! placed at the CPU time its commands started to be built, in microseconds of AZStd::GetTimeNowTicks(), so the trace
+            //! lines up with the cpu profiler captures converted to Chrome traces.
+            bool WriteChromeTrace(const char* filePath) const;
+
+            //! Forgets the recorded frames.
+            void Reset();
+
+        private:
+            struct PassSample
+            {
+                uint32_t m_passIndex = 0;
+                TimestampResult m_timestamp;
+                PipelineStatisticsResult m_statistics;
+            };
+
+            struct FrameSample
+            {
+                AZStd::sys_time_t m_cpuBeginTicks = 0;
+                AZStd::vector<PassSample> m_passSamples;
+            };
+
+            struct PassInfo
+            {
+                Name m_passPath;
+                uint32_t m_depth = 0;
+            };
+
+            void CollectPass(const Pass* pass, uint32_t depth, FrameSample& frame);
+            uint32_t GetPassIndex(const Name& passPath, uint32_t depth);
+            void CalculateStats(uint32_t passIndex, PassStats& stats) const;
+
+            // The queries are read back this many frames after they were recorded, see Query::BufferedFrames
+            static constexpr uint32_t ReadbackLatencyFrames = RHI::Limits::Device::FrameCountMax + 1u;
+
+            bool m_enabled = false;
+            bool m_collectPipelineStatistics = false;
+            bool m_enabledTimestamps = false;
+            bool m_enabledPipelineStatistics = false;
+
+            // Ring of the recorded frames, m_frameCount of the m_frames.size() entries are valid and m_nextFrame is the oldest one
+            AZStd::vector<FrameSample> m_frames;
+            uint32_t m_nextFrame = 0;
+            uint32_t m_frameCount = 0;
+
+            // CPU time of the latest frames, to place the GPU results of a frame read back ReadbackLatencyFrames later
+            AZStd::sys_time_t m_cpuFrameTicks[ReadbackLatencyFrames] = {};
+            uint32_t m_cpuFrameIndex = 0;
+
+            AZStd::vector<PassInfo> m_passes;
+            AZStd::unordered_map<Name, uint32_t> m_passIndices;
+        };
+    } // namespace RPI
+} // namespace AZ
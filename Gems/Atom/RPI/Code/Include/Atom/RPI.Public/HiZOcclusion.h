@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! CPU copy of a hierarchical depth buffer read back from the GPU, used by the CullingScene to skip the objects hidden
+        //! behind the depth rendered in a previous frame.
+        //! Each texel of the first mip holds the farthest depth of the screen pixels it covers, and each texel of the following
+        //! mips the farthest depth of 2x2 texels of the previous mip. Depth values use the reversed depth buffer of Atom, 1 at the
+        //! near plane and 0 at the far plane.
+        class HiZOcclusion
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(HiZOcclusion, SystemAllocator, 0);
+
+            //! @param worldToClip the world to clip matrix of the view the depth was rendered from
+            //! @param width the width of the first mip
+            //! @param height the height of the first mip
+            //! @param depth the texels of the first mip, row by row starting with the top row
+            HiZOcclusion(const Matrix4x4& worldToClip, uint32_t width, uint32_t height, AZStd::span<const float> depth);
+
+            //! Returns true if the bounds are entirely hidden behind the depth buffer.
+            //! The bounds are projected with the matrix of the view the depth was rendered from, so the test stays valid when the
+            //! view moved since. Bounds that aren't entirely inside that view are never occluded, since nothing is known about what
+            //! is outside of it, which keeps the objects coming into view visible.
+            bool IsOccluded(const Aabb& bounds) const;
+
+            uint32_t GetMipCount() const;
+
+        private:
+            struct Mip
+            {
+                uint32_t m_width = 0;
+                uint32_t m_height = 0;
+                size_t m_offset = 0;
+            };
+
+            float GetDepth(const Mip& mip, uint32_t x, uint32_t y) const;
+
+            Matrix4x4 m_worldToClip;
+            AZStd::vector<float> m_depth;
+            AZStd::vector<Mip> m_mips;
+        };
+    } // namespace RPI
+} // namespace AZ
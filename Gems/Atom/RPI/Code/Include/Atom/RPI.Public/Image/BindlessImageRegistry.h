@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/Image.h>
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class ImageView;
+    }
+
+    namespace RPI
+    {
+        //! Assigns the images accessed by index from the shaders a slot of the bindless image array of the SceneSrg,
+        //! see SceneSrg::m_bindlessImages. An image is registered once however many materials use it, so the SRGs of these
+        //! materials only hold the indices of their images as constants, and compiling them doesn't write any descriptor.
+        //! The first slot always holds a fallback image, used for the empty image properties.
+        class BindlessImageRegistry
+        {
+        public:
+            static constexpr uint32_t FallbackImageIndex = 0;
+
+            //! Mip feedback value of the images that weren't sampled, see SetMipFeedback().
+            static constexpr uint32_t NoMipFeedback = 0xFFFFFFFF;
+
+            //! Returns the index of the image in the bindless image array, registering the image on the first call.
+            //! Every call must be matched by a call to ReleaseImage() with the returned index.
+            //! Returns FallbackImageIndex for a null image, which doesn't need to be released.
+            uint32_t AcquireImage(const Data::Instance<Image>& image);
+
+            //! Releases an index returned by AcquireImage(), the slot is reused once every user of the image released it.
+            void ReleaseImage(uint32_t index);
+
+            //! Fills up the image views of the bindless image array, with the fallback image in the free slots.
+            void GetImageViews(AZStd::vector<const RHI::ImageView*>& imageViews) const;
+
+            //! Requests the mip levels sampled by the shaders to the streaming images, see StreamingImage::SetTargetMip().
+            //! @param mipLevels the most detailed mip level sampled from each slot, or NoMipFeedback. The feedback is read back
+            //! a few frames late, so a slot reused in between requests the mips of its previous image once.
+            void SetMipFeedback(AZStd::span<const uint32_t> mipLevels);
+
+            //! Returns the number of slots of the bindless image array, including the free ones.
+            uint32_t GetSlotCount() const;
+
+            //! Releases all the images.
+            void Reset();
+
+        private:
+            struct Slot
+            {
+                Data::Instance<Image> m_image;
+                uint32_t m_useCount = 0;
+            };
+
+            mutable AZStd::mutex m_mutex;
+
+            //! The slots of the bindless image array, the first one is the fallback image and is never used.
+            AZStd::vector<Slot> m_slots = { Slot{} };
+
+            AZStd::vector<uint32_t> m_freeSlots;
+
+            //! The slot of each registered image.
+            AZStd::unordered_map<const Image*, uint32_t> m_slotIndices;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -33,14 +33,51 @@ namespace AZ
             static Data::Instance<DefaultStreamingImageController> CreateInternal(Data::AssetData* assetData);
             RHI::ResultCode Init(DefaultStreamingImageControllerAsset& imageControllerAsset);
 
+            //! Context of an image streamed from the mip levels its shaders sampled, see r_streamingImageMipFeedback.
+            class MipFeedbackContext final
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(MipFeedbackContext, AZ::ThreadPoolAllocator, 0);
+
+                //! The most detailed mip level of the last feedback, kept until the next feedback since it is only read back
+                //! every few frames.
+                uint16_t m_feedbackMipLevel = RHI::Limits::Image::MipCountMax;
+
+                //! Timestamp of the controller when the image was attached.
+                size_t m_attachTimestamp = 0;
+
+                //! Whether the image was fully expanded after waiting for a feedback that never came.
+                bool m_expandedWithoutFeedback = false;
+            };
+
+            struct MipFeedbackRequest
+            {
+                StreamingImage* m_image = nullptr;
+                size_t m_mipChainIndex = 0;
+                size_t m_lastAccessTimestamp = 0;
+            };
+
             ///////////////////////////////////////////////////////////////////
             // StreamingImageController Overrides
             StreamingImageContextPtr CreateContextInternal() override;
             void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
             ///////////////////////////////////////////////////////////////////
 
+            //! Expands the recently attached images to all their mips.
+            void ExpandRecentlyAttachedImages();
+
+            //! Expands and trims the images to the mip levels of their feedback, keeping the pool under the budget.
+            void UpdateFromMipFeedback(size_t timestamp, const StreamingImageContextList& contexts);
+
             // A work queue for doing initial setup after an image is attached.
             AZStd::vector<StreamingImageContextPtr> m_recentlyAttachedContexts;
+
+            // Scratch lists of the images to expand and trim, kept to reuse their memory.
+            AZStd::vector<MipFeedbackRequest> m_expandRequests;
+            AZStd::vector<MipFeedbackRequest> m_trimRequests;
+
+            bool m_mipFeedbackEnabled = false;
         };
     }
 }
@@ -22,6 +22,7 @@
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/BindlessImageRegistry.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 
@@ -61,6 +62,7 @@ namespace AZ
             bool RegisterAttachmentImage(AttachmentImage* attachmentImage) override;
             void UnregisterAttachmentImage(AttachmentImage* attachmentImage) override;
             Data::Instance<AttachmentImage> FindRegisteredAttachmentImage(const Name& uniqueName) const override;
+            BindlessImageRegistry& GetBindlessImageRegistry() override;
             //////////////////////////////////////////////////////////////////////////
 
         private:
@@ -85,6 +87,8 @@ namespace AZ
             // a collections of regirested attachment images
             // Note: use AttachmentImage* instead of Data::Instance<AttachmentImage> so it can be released properly
             AZStd::unordered_map<RHI::AttachmentId, AttachmentImage*> m_registeredAttachmentImages;
+
+            BindlessImageRegistry m_bindlessImageRegistry;
         };
     }
 }
@@ -21,6 +21,7 @@ namespace AZ
         class Image;
         class AttachmentImage;
         class AttachmentImagePool;
+        class BindlessImageRegistry;
         class StreamingImagePool;
 
         enum class SystemImage : uint32_t
@@ -81,6 +82,9 @@ namespace AZ
             //! Note: only attachment image created with an uqniue name will be registered.
             virtual Data::Instance<AttachmentImage> FindRegisteredAttachmentImage(const Name& uniqueName) const = 0;
 
+            //! Returns the registry of the images accessed by index from the bindless image array of the SceneSrg.
+            virtual BindlessImageRegistry& GetBindlessImageRegistry() = 0;
+
             virtual void Update() = 0;
         };
     }
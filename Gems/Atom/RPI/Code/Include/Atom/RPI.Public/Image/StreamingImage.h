@@ -115,6 +115,14 @@ namespace AZ
             //! Returns the most detailed mip level currently resident in memory, where a value of 0 is the highest detailed mip.
             uint16_t GetResidentMipLevel();
 
+            //! Returns the index of the mip chain holding the mip level, the level is clamped to the last mip of the image.
+            size_t GetMipChainIndex(uint16_t mipLevel) const;
+
+            //! Returns the index of the most detailed mip chain that is either resident or being streamed in.
+            size_t GetStreamingMipChainIndex() const;
+
+            size_t GetMipChainCount() const;
+
         private:
             StreamingImage() = default;
 
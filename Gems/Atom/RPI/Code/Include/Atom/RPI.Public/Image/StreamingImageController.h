@@ -13,6 +13,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 
+#include <Atom/RHI/ResidencyManager.h>
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageControllerAsset.h>
 
@@ -29,8 +30,11 @@ namespace AZ
     {
         class StreamingImage;
 
+        //! The controllers are also the evictors of the device residency manager, trimming the least recently used
+        //! images of their pool by a mip chain at a time when the device memory goes over its budget.
         class StreamingImageController
             : public Data::InstanceData
+            , public RHI::ResidencyEvictor
         {
         public:
             AZ_INSTANCE_DATA(StreamingImageController, "{D3708719-6955-4D6E-8D4C-1EF782C51EAD}");
@@ -42,7 +46,7 @@ namespace AZ
             //! \param pool  The streaming image pool that the controller should use.
             static Data::Instance<StreamingImageController> Create(const Data::Asset<StreamingImageControllerAsset>& asset, RHI::StreamingImagePool& pool);
 
-            virtual ~StreamingImageController() = default;
+            virtual ~StreamingImageController();
 
             //! Attaches an instance of an image streaming asset to the controller.
             void AttachImage(StreamingImage* image);
@@ -69,6 +73,13 @@ namespace AZ
             void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Returns the RHI pool of the streamed images.
+            const RHI::StreamingImagePool* GetPool() const;
+
+            //! Returns whether the device memory is over the target of its residency manager, in which case the
+            //! images shouldn't be expanded.
+            bool IsDeviceMemoryUnderPressure() const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
@@ -85,10 +96,16 @@ namespace AZ
 
             ///////////////////////////////////////////////////////////////////
 
+            ///////////////////////////////////////////////////////////////////
+            // RHI::ResidencyEvictor
+            bool GetLeastRecentUseAge(size_t& ageInFrames) const override;
+            size_t Evict(size_t sizeInBytes, size_t minAgeInFrames) override;
+            ///////////////////////////////////////////////////////////////////
+
             RHI::StreamingImagePool* m_pool = nullptr;
 
-            // The mutex used to serialize attachment, detachment, and update; as they would otherwise stomp on each other.
-            AZStd::mutex m_mutex;
+            // The mutex used to serialize attachment, detachment, update and eviction; as they would otherwise stomp on each other.
+            mutable AZStd::mutex m_mutex;
             StreamingImageContextList m_contexts;
 
             // A work queue for performing StreamingImage::ExpandMipChain calls.
@@ -101,6 +118,15 @@ namespace AZ
 
             // A monotonically increasing counter used to track image mip requests. Useful for sorting contexts by LRU.
             size_t m_timestamp = 0;
+
+            struct EvictCandidate
+            {
+                StreamingImage* m_image = nullptr;
+                size_t m_ageInFrames = 0;
+            };
+
+            // Scratch list of the images to trim on eviction, kept to reuse its memory.
+            AZStd::vector<EvictCandidate> m_evictCandidates;
         };
     }
 }
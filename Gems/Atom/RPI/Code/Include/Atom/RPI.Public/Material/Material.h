@@ -23,6 +23,8 @@
 
 #include <AtomCore/Instance/InstanceData.h>
 
+#include <AzCore/std/containers/unordered_map.h>
+
 namespace AZ
 {
     namespace RHI
@@ -168,6 +170,12 @@ namespace AZ
             template<typename Type>
             bool SetShaderOption(ShaderOptionGroup& options, ShaderOptionIndex shaderOptionIndex, Type value);
 
+            //! Sets a shader constant to the index of the image in the bindless image array, registering the image if needed.
+            void SetBindlessImage(MaterialPropertyIndex propertyIndex, RHI::ShaderInputConstantIndex shaderInputIndex, const Data::Instance<Image>& image);
+
+            //! Releases the images registered in the bindless image array by SetBindlessImage().
+            void ReleaseBindlessImages();
+
             static const char* s_debugTraceName;
 
             //! The corresponding material asset that provides material type data and initial property values.
@@ -202,6 +210,15 @@ namespace AZ
             //! Records the m_currentChangeId when the material was last compiled.
             ChangeId m_compiledChangeId = DEFAULT_CHANGE_ID;
 
+            struct BindlessImage
+            {
+                Data::Instance<Image> m_image;
+                uint32_t m_index = 0;
+            };
+
+            //! The images registered in the bindless image array, by the index of their property.
+            AZStd::unordered_map<uint32_t, BindlessImage> m_bindlessImages;
+
             bool m_isInitializing = false;
                 
             MaterialPropertyPsoHandling m_psoHandling = MaterialPropertyPsoHandling::Warning;
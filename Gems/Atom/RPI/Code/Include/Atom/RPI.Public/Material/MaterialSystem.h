@@ -8,6 +8,15 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertyValue.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertyDescriptor.h>
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -15,15 +24,62 @@ namespace AZ
 
     namespace RPI
     {
+        class Material;
+
         //! Manages system-wide initialization and support for material classes
+        //! It also batches the property changes queued with QueuePropertyValue(). Each update applies the values queued since the
+        //! last one, keeping only the last value of each property, and compiles every changed material once. This avoids running
+        //! the functors and compiling the SRG of a material for every individual change, like when animating materials.
         class MaterialSystem
         {
         public:
+            AZ_RTTI(MaterialSystem, "{6F1E3A52-0C9B-4D7E-A8B4-3D5C2E91F047}");
+
+            //! Returns the material system of the RPISystem, null if it isn't initialized.
+            static MaterialSystem* Get();
+
+            virtual ~MaterialSystem() = default;
+
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
             void Init();
             void Shutdown();
+
+            //! Queues a property value to be set on a material by the next Update(), which also compiles the material.
+            //! A value queued for a property replaces the one queued before it in the same frame. Thread safe.
+            void QueuePropertyValue(const Data::Instance<Material>& material, MaterialPropertyIndex index, const MaterialPropertyValue& value);
+
+            //! Queues a material to be compiled by the next Update(), for property values set directly on the material. Thread safe.
+            void QueueCompile(const Data::Instance<Material>& material);
+
+            //! Applies the queued property values and compiles the changed materials, ticked by the RPISystem before rendering.
+            //! Materials that can't compile yet, having already been compiled this frame, are compiled by the following update.
+            void Update();
+
+            //! Returns the number of materials with queued changes.
+            size_t GetQueuedMaterialCount() const;
+
+        private:
+            using QueuedPropertyValue = AZStd::pair<MaterialPropertyIndex, MaterialPropertyValue>;
+
+            struct QueuedMaterial
+            {
+                Data::Instance<Material> m_material;
+                AZStd::vector<QueuedPropertyValue> m_propertyValues;
+            };
+
+            // Returns the queued entry of a material, adding it when it isn't queued yet. Must be called under the lock.
+            QueuedMaterial& FindOrAddQueuedMaterial(const Data::Instance<Material>& material);
+
+            mutable AZStd::mutex m_queueMutex;
+
+            // The materials in the order they were first queued, with the position of each one in the list
+            AZStd::vector<QueuedMaterial> m_queuedMaterials;
+            AZStd::unordered_map<const Material*, size_t> m_queuedMaterialIndices;
+
+            // Scratch list swapped with the queue on update, kept to reuse its memory
+            AZStd::vector<QueuedMaterial> m_updatingMaterials;
         };
 
     } // namespace RPI
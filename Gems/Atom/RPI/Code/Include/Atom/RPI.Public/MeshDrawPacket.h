@@ -48,6 +48,31 @@ namespace AZ
             void SetSortKey(RHI::DrawItemSortKey sortKey) { m_sortKey = sortKey; };
             bool SetShaderOption(const Name& shaderOptionName, RPI::ShaderOptionValue value);
 
+            //! Draws the mesh using indirect arguments instead of the draw arguments of the mesh, for example so the draw can be
+            //! culled on the GPU. The indirect buffer must hold a single DrawIndexed command matching the mesh.
+            //! The change takes effect the next time the draw packet is rebuilt.
+            void SetIndirectArguments(const RHI::DrawIndirect& indirectArguments);
+
+            //! Reverts to drawing the mesh using the draw arguments of the mesh.
+            //! The change takes effect the next time the draw packet is rebuilt.
+            void ClearIndirectArguments();
+
+            //! Draws the mesh using an index buffer other than the index buffer of the mesh, for example an index buffer holding
+            //! the triangles that survived culling on the GPU. The change takes effect the next time the draw packet is rebuilt.
+            void SetIndexBufferView(const RHI::IndexBufferView& indexBufferView);
+
+            //! Reverts to drawing the mesh using the index buffer of the mesh.
+            //! The change takes effect the next time the draw packet is rebuilt.
+            void ClearIndexBufferView();
+
+            //! Returns true if every draw item of the last built draw packet culls back faces, so faces pointing away from the
+            //! viewer can be skipped before rasterization without changing the result.
+            bool IsBackFaceCulled() const { return m_isBackFaceCulled; }
+
+            //! Draws the given number of instances of an indexed mesh, for draws merging several identical meshes.
+            //! The change takes effect the next time the draw packet is rebuilt.
+            void SetInstanceCount(uint32_t instanceCount) { m_instanceCount = instanceCount; }
+
             Data::Instance<Material> GetMaterial();
 
         private:
@@ -88,6 +113,20 @@ namespace AZ
             // Set the stencil value for this draw packet
             uint8_t m_stencilRef = 0;
 
+            // Indirect arguments used in place of the mesh draw arguments when m_useIndirectArguments is set
+            RHI::DrawIndirect m_indirectArguments;
+            bool m_useIndirectArguments = false;
+
+            // Index buffer used in place of the mesh index buffer when m_useIndexBufferView is set
+            RHI::IndexBufferView m_indexBufferView;
+            bool m_useIndexBufferView = false;
+
+            // Whether all draw items of m_drawPacket cull back faces
+            bool m_isBackFaceCulled = false;
+
+            // Instance count used in place of the instance count of the mesh draw arguments, 0 keeps the mesh value
+            uint32_t m_instanceCount = 0;
+
             //! A map matches the index of UV names of this material to the custom names from the model.
             MaterialModelUvOverrideMap m_materialModelUvMap;
 
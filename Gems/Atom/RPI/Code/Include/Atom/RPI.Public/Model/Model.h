@@ -17,8 +17,11 @@
 
 #include <AtomCore/Instance/InstanceData.h>
 
+#include <AzCore/EBus/Event.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -35,13 +38,16 @@ namespace AZ
             AZ_INSTANCE_DATA(Model, "{C30F5522-B381-4B38-BBAF-6E0B1885C8B9}");
             AZ_CLASS_ALLOCATOR(Model, AZ::SystemAllocator, 0);
 
+            //! Signaled on the main thread when streamed lods become resident or are evicted, see r_modelLodStreaming.
+            using LodsChangedEvent = AZ::Event<>;
+
             static Data::Instance<Model> FindOrCreate(const Data::Asset<ModelAsset>& modelAsset);
 
             //! Orphan the model, its lods, and all their buffers so that they can be replaced in the instance database
             //! This is a temporary function, that will be removed once the Model/ModelAsset classes no longer need it
             static void TEMPOrphanFromDatabase(const Data::Asset<ModelAsset>& modelAsset);
 
-            ~Model() = default;
+            ~Model();
 
             //! Blocks the CPU until the streaming upload is complete. Returns immediately if no
             //! streaming upload is currently pending.
@@ -51,8 +57,22 @@ namespace AZ
             size_t GetLodCount() const;
 
             //! Returns the full list of Lods, where index 0 is the most detailed, and N-1 is the least.
+            //! When the lods are streamed, the lods that aren't resident are replaced by the nearest less detailed resident lod.
             AZStd::span<const Data::Instance<ModelLod>> GetLods() const;
 
+            //! Returns whether the detailed lods are only made resident once requested, see RequestLod().
+            bool IsLodStreamingEnabled() const;
+
+            //! Returns whether the lod is resident, or whether it is replaced by a less detailed lod in GetLods().
+            bool IsLodResident(size_t lodIndex) const;
+
+            //! Requests a streamed lod to be resident, this has to be done every frame the lod is used. Called by the culling
+            //! for the lods it selects from the screen coverage. Thread safe.
+            void RequestLod(size_t lodIndex);
+
+            //! Connects a handler to the event signaled when streamed lods become resident or are evicted.
+            void ConnectLodsChangedEvent(LodsChangedEvent::Handler& handler);
+
             //! Returns whether a buffer upload is pending.
             bool IsUploadPending() const;
 
@@ -99,9 +119,38 @@ namespace AZ
             static Data::Instance<Model> CreateInternal(const Data::Asset<ModelAsset>& modelAsset);
             RHI::ResultCode Init(const Data::Asset<ModelAsset>& modelAsset);
 
+            //! Creates the instance of a streamed lod and puts it in place of its substitute.
+            //! @return false if the lod failed to be created
+            bool StreamInLod(size_t lodIndex);
+
+            //! Releases the instance of a streamed lod, a less detailed lod replaces it in m_lods.
+            void EvictLod(size_t lodIndex);
+
+            //! Points the non-resident lods of m_lods at the nearest less detailed resident lod.
+            void UpdateLodSubstitutes();
+
             AZStd::fixed_vector<Data::Instance<ModelLod>, ModelLodAsset::LodCountMax> m_lods;
             Data::Asset<ModelAsset> m_modelAsset;
 
+            //! The resident lods when the lods are streamed, null for the lods that aren't resident.
+            AZStd::fixed_vector<Data::Instance<ModelLod>, ModelLodAsset::LodCountMax> m_residentLods;
+
+            //! The lods requested since the last update of the ModelSystem, one bit per lod.
+            AZStd::atomic<uint32_t> m_requestedLodMask = { 0 };
+
+            //! The update of the ModelSystem when each lod was last requested.
+            AZStd::array<size_t, ModelLodAsset::LodCountMax> m_lodRequestUpdates = {};
+
+            //! The size of the buffers of each lod.
+            AZStd::array<size_t, ModelLodAsset::LodCountMax> m_lodSizesInBytes = {};
+
+            LodsChangedEvent m_lodsChangedEvent;
+
+            //! The number of detailed lods that are streamed, the following ones are always resident.
+            size_t m_streamedLodCount = 0;
+
+            bool m_isLodStreamingEnabled = false;
+
             AZStd::unordered_set<AZ::Name> m_uvNames;
 
             // Tracks whether buffers have all been streamed up to the GPU.
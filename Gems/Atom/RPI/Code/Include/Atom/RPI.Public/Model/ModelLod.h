@@ -94,6 +94,9 @@ namespace AZ
 
             AZStd::span<const Mesh> GetMeshes() const;
 
+            //! Returns the asset the lod was created from, its meshes match the meshes of the lod.
+            const Data::Asset<ModelLodAsset>& GetLodAsset() const;
+
             //! Compares a ShaderInputContract to the mesh's available streams, and if any of them are optional, sets the corresponding "*_isBound" shader option.
             //! Call this function to update the ShaderOptionKey before fetching a ShaderVariant, to find a variant that is compatible with this mesh's streams.
             // @param contract the contract that defines the expected inputs for a shader, used to determine which streams are optional.
@@ -163,6 +166,8 @@ namespace AZ
             // Provides buffer views backed by data in m_buffers;
             AZStd::vector<Mesh> m_meshes;
 
+            Data::Asset<ModelLodAsset> m_lodAsset;
+
             // The buffer instances loaded by this ModelLod
             AZStd::vector<Data::Instance<Buffer>> m_buffers;
 
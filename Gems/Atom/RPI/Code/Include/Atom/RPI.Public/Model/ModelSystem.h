@@ -9,21 +9,68 @@
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
 namespace AZ
 {
     class ReflectContext;
 
     namespace RPI
     {
+        class Model;
+
         //! Manages system-wide initialization and support for Model classes
+        //! It also streams the detailed lods of the models created with r_modelLodStreaming. Each update, the lods requested by
+        //! the culling are created and the lods that weren't requested for r_modelLodStreamingEvictUpdates are released, so they
+        //! only take GPU memory while they are used. The total size of the streamed lods is kept under r_modelLodStreamingBudgetMB
+        //! by skipping new lods and evicting the least recently used ones first.
         class ModelSystem
         {
         public:
+            AZ_RTTI(ModelSystem, "{2B5C0D6E-9A47-4F1B-8E3D-71C4A5F0B926}");
+
+            //! Returns the model system of the RPISystem, null if it isn't initialized.
+            static ModelSystem* Get();
+
+            virtual ~ModelSystem() = default;
+
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
             void Init();
             void Shutdown();
+
+            //! Creates the requested lods and evicts the unused ones, ticked by the RPISystem.
+            void Update();
+
+            //! Adds a model whose lods are streamed, called by the model.
+            void AddStreamingModel(Model* model);
+            void RemoveStreamingModel(Model* model);
+
+            //! Returns the GPU size of the lods that are currently streamed in.
+            size_t GetStreamedLodsSizeInBytes() const;
+
+        private:
+            struct StreamedLod
+            {
+                Model* m_model = nullptr;
+                size_t m_lodIndex = 0;
+                size_t m_lastRequestUpdate = 0;
+            };
+
+            // Recursive since the handlers of the lod events, called under the lock, can release their models
+            AZStd::recursive_mutex m_streamingModelsMutex;
+            AZStd::vector<Model*> m_streamingModels;
+
+            // Scratch lists, kept to reuse their memory
+            AZStd::vector<StreamedLod> m_lodsToStreamIn;
+            AZStd::vector<StreamedLod> m_lodsToEvict;
+            AZStd::vector<Model*> m_changedModels;
+
+            size_t m_updateIndex = 0;
+            size_t m_streamedLodsSizeInBytes = 0;
         };
     } // namespace RPI
 } // namespace AZ
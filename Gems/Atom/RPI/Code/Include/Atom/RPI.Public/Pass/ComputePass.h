@@ -79,6 +79,12 @@ namespace AZ
             void LoadShader();
             PassDescriptor m_passDescriptor;
 
+            // Whether the pass data asked to always run on the compute hardware queue
+            bool m_useAsyncCompute = false;
+
+            // Whether the pass data allows running on the compute hardware queue when r_asyncComputePasses is enabled
+            bool m_allowAsyncCompute = false;
+
         };
     }   // namespace RPI
 }   // namespace AZ
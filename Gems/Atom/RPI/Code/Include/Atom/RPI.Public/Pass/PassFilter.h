@@ -64,6 +64,7 @@ namespace AZ
 
             const Name& GetPassName() const;
             const Name& GetPassTemplateName() const;
+            const TypeId& GetPassClass() const;
 
             uint32_t GetEnabledFilterOptions() const;
 
@@ -16,6 +16,8 @@
 #include <Atom/RPI.Reflect/System/AssetAliases.h>
 
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -101,6 +103,9 @@ namespace AZ
 
         private:
 
+            // Rebuilds the list of all passes and the pass class to pass mapping if passes were added or removed since they were last built
+            void UpdatePassIndices();
+
             // Retrieves a template entry given a name, or nullptr if not found
             TemplateEntry* GetEntry(const Name& templateName);
             const TemplateEntry* GetEntry(const Name& templateName) const;
@@ -136,6 +141,12 @@ namespace AZ
             // Pass name to pass mapping for all pass instances
             AZStd::unordered_map<Name, AZStd::vector<Pass*>> m_passNameMapping;
 
+            // All pass instances, and pass class to pass mapping for all pass instances, see UpdatePassIndices
+            AZStd::vector<Pass*> m_passes;
+            AZStd::unordered_map<TypeId, AZStd::vector<Pass*>> m_passClassMapping;
+            AZStd::atomic_bool m_passIndicesDirty{ false };
+            AZStd::mutex m_passIndicesMutex;
+
             // Whether the pass library is shutting down. In this case we ignore removal functions
             bool m_isShuttingDown = false;
         };
@@ -73,6 +73,10 @@ namespace AZ
             // If there are more than one draw lists from different source: View, DynamicDrawSystem,
             // we need to creates a combined draw list which combines all the draw lists to one and cache it until they are submitted. 
             RHI::DrawList m_combinedDrawList;
+
+            // The recording cost of the draw list up to each of its items, used to split the draw list into command lists
+            // of about the same cost when the scope is recorded in parallel
+            AZStd::vector<uint32_t> m_drawItemCostPrefixSums;
             
             RHI::Scissor m_scissorState;
             RHI::Viewport m_viewportState;
@@ -23,6 +23,7 @@ namespace AZ
         class FrameGraph;
         class FrameGraphCompileContext;
         class FrameGraphExecuteContext;
+        class RenderAttachmentLayoutBuilder;
     }
 
     namespace RPI
@@ -49,6 +50,14 @@ namespace AZ
             //! This function usually need to be called after pass attachments rebuilt to reflect latest layout
             RHI::RenderAttachmentConfiguration GetRenderAttachmentConfiguration() const;
 
+            //! Returns the pass this pass runs as the next subpass of, or nullptr if this pass begins its own render pass.
+            //! With r_mergeRasterPassesAsSubpasses, consecutive raster passes drawing to the same render targets are merged
+            //! as subpasses of a single render pass, so that tile based GPUs keep these render targets in tile memory between them.
+            RenderPass* GetPreviousSubpass() const;
+
+            //! Returns the pass running as the next subpass of this pass, or nullptr if this pass ends its render pass.
+            RenderPass* GetNextSubpass() const;
+
             //! Get MultisampleState of this pass from its output attachments
             RHI::MultisampleState GetMultisampleState() const;
             
@@ -120,6 +129,12 @@ namespace AZ
             // Helper function that binds a single attachment to the pass shader resource group
             void BindAttachment(const RHI::FrameGraphCompileContext& context, PassAttachmentBinding& binding, int16_t& imageIndex, int16_t& bufferIndex);
 
+            // Whether this pass can run as the next subpass of the render pass of the previous pass
+            bool CanMergeAsSubpassOf(const RenderPass& previous) const;
+
+            // Adds the render attachments of this pass to the next subpass of a render attachment layout
+            void AddSubpassAttachmentLayout(RHI::RenderAttachmentLayoutBuilder& builder) const;
+
             // Helper function to get the query by the scope index and query type
             RHI::Ptr<Query> GetQuery(ScopeQueryType queryType);
 
@@ -157,6 +172,10 @@ namespace AZ
             
             // View tag used to associate a pipeline view for this pass.
             PipelineViewTag m_viewTag;
+
+            // Whether this pass may be merged as a subpass with the neighbouring passes, updated when the pass is initialized
+            // so that the render attachment layout only changes along with the pipeline states built from it
+            bool m_subpassMergeEnabled = false;
         };
     }   // namespace RPI
 }   // namespace AZ
@@ -20,6 +20,7 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/ShaderSystem.h>
 #include <Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h>
+#include <Atom/RPI.Public/Shader/Warmup/PipelineStateWarmupSystem.h>
 #include <Atom/RPI.Public/GpuQuery/GpuQuerySystem.h>
 #include <Atom/RPI.Public/ViewportContextManager.h>
 
@@ -109,6 +110,7 @@ namespace AZ
             ModelSystem m_modelSystem;
             ShaderSystem m_shaderSystem;
             ShaderMetricsSystem m_shaderMetricsSystem;
+            PipelineStateWarmupSystem m_pipelineStateWarmupSystem;
             BufferSystem m_bufferSystem;
             ImageSystem m_imageSystem;
             PassSystem m_passSystem;
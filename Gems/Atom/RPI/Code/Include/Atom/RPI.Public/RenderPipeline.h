@@ -11,6 +11,8 @@
 #include <Atom/RHI/DrawList.h>
 
 #include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Public/DynamicResolutionController.h>
+#include <Atom/RPI.Public/GpuQuery/GpuPassProfiler.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
 
 #include <Atom/RPI.Reflect/Pass/PassAsset.h>
@@ -165,6 +167,15 @@ namespace AZ
             //! Undoes runtime changes made to active render settings by reverting to original settings from the descriptor
             void RevertRenderSettings();
 
+            //! Returns the scale applied to the size of the render settings by the dynamic resolution, 1 when it is disabled.
+            //! When r_dynamicResolution is enabled, the size of the render settings of the pipelines rendering to a window follows
+            //! their GPU frame time. Only the attachments using the pipeline as their size source are scaled, and a pass like
+            //! DynamicResolutionUpscaleTemplate then upscales them to the size of the swap chain.
+            float GetDynamicResolutionScale() const;
+
+            //! Returns the per pass GPU times of the pipeline, collected over a rolling window while r_gpuPassProfiler is enabled.
+            const GpuPassProfiler& GetGpuPassProfiler() const;
+
             //! Add this RenderPipeline to the next RPI system's RenderTick and it will be rendered once.
             //! This function can be used for render a renderpipeline with desired frequence as its associated window/view
             //! is expecting.
@@ -240,6 +251,12 @@ namespace AZ
             // Build pipeline views from the pipeline pass tree. It's usually called when pass tree changed.
             void BuildPipelineViews();
 
+            // Scales the size of the active render settings from the GPU time of the pipeline when r_dynamicResolution is enabled
+            void UpdateDynamicResolution();
+
+            // Collects the GPU times of the passes when r_gpuPassProfiler is enabled
+            void UpdateGpuPassProfiler();
+
             //////////////////////////////////////////////////
             // Functions accessed by Scene class
             
@@ -295,6 +312,18 @@ namespace AZ
             // Render settings that can be queried by passes to setup things like render target resolution
             PipelineRenderSettings m_activeRenderSettings;
 
+            // Picks the scale of the render settings size while the dynamic resolution is enabled
+            DynamicResolutionController m_dynamicResolutionController;
+            DynamicResolutionController::Descriptor m_dynamicResolutionDescriptor;
+            bool m_dynamicResolutionEnabled = false;
+
+            // Whether the timestamp queries of the root pass were enabled to measure the GPU time for the dynamic resolution
+            bool m_dynamicResolutionEnabledTimestamps = false;
+
+            // Collects the GPU times of the passes while r_gpuPassProfiler is enabled
+            GpuPassProfiler m_gpuPassProfiler;
+            uint32_t m_gpuPassProfilerTraceRequest = 0;
+
             // A tag to filter draw items submitted by passes of this render pipeline.
             // This tag is allocated when it's added to a scene. It's set to invalid when it's removed to the scene.
             RHI::DrawFilterTag m_drawFilterTag;
@@ -241,6 +241,10 @@ namespace AZ
 
             AZ::RPI::CullingScene* m_cullingScene;
 
+            // Per-view culling task graphs used with parallel octree traversal. They are retained across frames
+            // so that rebuilding them every frame reuses the storage of the previous frame's graphs.
+            AZStd::vector<AZStd::unique_ptr<AZ::TaskGraph>> m_processCullablesTaskGraphs;
+
             // Cached views for current rendering frame. It gets re-built every frame.
             AZ::RPI::FeatureProcessor::SimulatePacket m_simulatePacket;
             AZ::RPI::FeatureProcessor::RenderPacket m_renderPacket;
@@ -272,6 +276,12 @@ namespace AZ
 
             RHI::ShaderInputConstantIndex m_timeInputIndex;
             float m_simulationTime;
+
+            // The bindless image array of the SceneSrg, defined on the platforms supporting unbounded arrays
+            RHI::ShaderInputImageUnboundedArrayIndex m_bindlessImagesInputIndex;
+            // The image views last set to the bindless image array, it's only set again when they change
+            AZStd::vector<const RHI::ImageView*> m_bindlessImageViews;
+            AZStd::vector<const RHI::ImageView*> m_bindlessImageViewsScratch;
         };
 
         // --- Template functions ---
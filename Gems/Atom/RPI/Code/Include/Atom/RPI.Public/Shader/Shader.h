@@ -162,6 +162,10 @@ namespace AZ
             void OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset, bool IsError) override;
             ///////////////////////////////////////////////////////////////////
 
+            //! Returns the StableId of the variant the descriptor was configured with, or an invalid StableId if the descriptor
+            //! doesn't use the shader stage functions of any loaded variant.
+            ShaderVariantStableId FindPipelineStateVariantStableId(const RHI::PipelineStateDescriptor& descriptor) const;
+
             //! A strong reference to the shader asset.
             Data::Asset<ShaderAsset> m_asset;
 
@@ -179,7 +183,7 @@ namespace AZ
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
             //! Used for thread safety for FindVariantStableId() and GetVariant().
-            AZStd::shared_mutex m_variantCacheMutex;
+            mutable AZStd::shared_mutex m_variantCacheMutex;
 
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
@@ -11,12 +11,16 @@
 #include <Atom/RPI.Reflect/Shader/ShaderVariantAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
 #include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantUsageLog.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/condition_variable.h>
 
+#include <AzFramework/Spawnable/RootSpawnableInterface.h>
+
 namespace AZ
 {
     class ReflectContext;
@@ -27,10 +31,17 @@ namespace AZ
          * A helper class used by ShaderSystem to manage asynchronous loading of ShaderVariantTreeAssets
          * and ShaderVariantAssets.
          * The notifications of assets being loaded & ready are dispatched via ShaderVariantFinderNotificationBus.
+         *
+         * When r_shaderVariantUsageLogRecord is enabled, the shader variants requested while a level is loaded are recorded
+         * into a usage log of that level, which is written to the user folder when the level is unloaded.
+         * When r_shaderVariantPrefetch is enabled, the shader variants of the usage log are queued for loading as soon as
+         * the level starts loading, the most requested ones first, and materials queue the shader variants of their shader
+         * options when they are initialized, so the variants are usually ready before the objects using them are drawn.
          */
         class ShaderVariantAsyncLoader final
             : public AZ::Interface<IShaderVariantFinder>::Registrar
             , public AZ::Data::AssetBus::MultiHandler
+            , public AzFramework::RootSpawnableNotificationBus::Handler
         {
         public:
             static constexpr char LogName[] = "ShaderVariantAsyncLoader";
@@ -39,6 +50,9 @@ namespace AZ
             void Init();
             void Shutdown();
 
+            //! Returns true if shader variants should be loaded before they are requested, see r_shaderVariantPrefetch.
+            static bool IsPrefetchEnabled();
+
             struct TupleShaderAssetAndShaderVariantId
             {
                 Data::Asset<ShaderAsset> m_shaderAsset;
@@ -83,6 +97,39 @@ namespace AZ
             void OnAssetError(Data::Asset<Data::AssetData> asset) override;
             ///////////////////////////////////////////////////////////////////////
 
+            ///////////////////////////////////////////////////////////////////////
+            // AzFramework::RootSpawnableNotificationBus::Handler overrides
+            void OnRootSpawnableAssigned(Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+            void OnRootSpawnableReleased(uint32_t generation) override;
+            ///////////////////////////////////////////////////////////////////////
+
+            //! A shader variant of the usage log waiting to be loaded.
+            struct PrefetchRequest
+            {
+                Data::AssetId m_shaderAssetId;
+                ShaderVariantStableId m_shaderVariantStableId;
+                SupervariantIndex m_supervariantIndex;
+            };
+
+            //! Records a request of a shader variant into the usage log of the current level.
+            void RecordShaderVariantUsage(
+                const ShaderAsset& shaderAsset, ShaderVariantStableId shaderVariantStableId, SupervariantIndex supervariantIndex);
+
+            //! Writes the usage log of the current level if anything was recorded, then reads the usage log of the given level,
+            //! or clears it if the level name is empty.
+            void SwitchUsageLog(const AZStd::string& levelName);
+
+            //! Queues the shader variants of the usage log for loading, the most requested ones first.
+            void QueuePrefetchRequests();
+
+            //! This is a helper method called from the service thread.
+            //! Returns true if the prefetch request is done, either because the load of the shader variant was queued
+            //! or because the shader has no shader variant tree.
+            bool TryToPrefetchShaderVariantAsset(
+                const PrefetchRequest& prefetchRequest,
+                AZStd::unordered_set<Data::AssetId>& shaderVariantTreePendingRequests,
+                AZStd::unordered_set<Data::AssetId>& shaderVariantPendingRequests);
+
             void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset);
             void OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset);
             void OnShaderVariantTreeAssetError(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset);
@@ -132,6 +179,22 @@ namespace AZ
             //! REMARK: To go the other way, you can use m_shaderVariantData.
             AZStd::unordered_map<Data::AssetId, Data::AssetId> m_shaderAssetIdToShaderVariantTreeAssetId;
 
+            //! The shader variants of the usage log waiting to be loaded, the most requested ones first.
+            AZStd::vector<PrefetchRequest> m_prefetchPendingRequests;
+
+            //! Lock for the usage log members below, which are accessed from the threads requesting shader variants.
+            AZStd::mutex m_usageLogMutex;
+
+            //! The name of the level the usage log belongs to, empty while no level is loaded.
+            AZStd::string m_usageLogLevelName;
+
+            ShaderVariantUsageLog m_usageLog;
+
+            //! The index of each entry of the usage log, by the hash of the entry.
+            AZStd::unordered_map<HashValue64, size_t> m_usageLogEntryIndices;
+
+            //! True once a shader variant was recorded since the usage log was read, the log is only written back in that case.
+            bool m_usageLogHasRecorded = false;
         };
 
 
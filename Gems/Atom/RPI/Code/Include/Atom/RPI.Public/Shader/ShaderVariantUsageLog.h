@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A shader variant requested while a level was loaded in a previous session.
+        struct ShaderVariantUsageLogEntry
+        {
+            AZ_TYPE_INFO(ShaderVariantUsageLogEntry, "{8C2E5A71-3F94-4D0B-B6E8-1A7C9D0E4F25}");
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! Returns a hash identifying the shader variant, which doesn't include the request count.
+            HashValue64 GetHash() const;
+
+            //! The ID of the shader.
+            AZ::Data::AssetId m_shaderId;
+
+            //! The name of the shader, only used to make the log readable.
+            Name m_shaderName;
+
+            //! The index of the supervariant of the shader.
+            uint32_t m_supervariantIndex = 0;
+
+            //! The index of the shader variant.
+            ShaderVariantStableId m_shaderVariantStableId;
+
+            //! The number of times the shader variant was requested, over all the recorded sessions.
+            //! Shader variants used by many objects are requested more often, so this is used as the priority of the prefetch.
+            uint32_t m_requestCount = 0;
+        };
+
+        //! The shader variants requested while a level was loaded, see ShaderVariantAsyncLoader.
+        struct ShaderVariantUsageLog
+        {
+            AZ_TYPE_INFO(ShaderVariantUsageLog, "{3D6F0B84-7A25-4C1E-9E53-B4F2A8C7160D}");
+            AZ_CLASS_ALLOCATOR(ShaderVariantUsageLog, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            AZStd::vector<ShaderVariantUsageLogEntry> m_entries;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A pipeline state used in a previous session, with everything needed to build its descriptor again.
+        //! The shader stage functions and the pipeline layout come from the shader variant, the other states are stored as is.
+        //! The input stream layout, render attachment configuration and render states are only used by draw pipeline states.
+        struct PipelineStateManifestEntry
+        {
+            AZ_TYPE_INFO(PipelineStateManifestEntry, "{5B0E7C93-2F0B-4AE4-9C51-0A7D3E2F8B64}");
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! Returns a hash identifying the pipeline state, which doesn't include the use count.
+            HashValue64 GetHash() const;
+
+            //! The ID of the shader.
+            AZ::Data::AssetId m_shaderId;
+
+            //! The name of the shader, only used to make the manifest readable.
+            Name m_shaderName;
+
+            //! The name of the supervariant of the shader.
+            Name m_supervariantName;
+
+            //! The index of the shader variant.
+            ShaderVariantStableId m_shaderVariantStableId;
+
+            RHI::InputStreamLayout m_inputStreamLayout;
+            RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+            RHI::RenderStates m_renderStates;
+
+            //! The number of times the pipeline state was acquired, over all the recorded sessions.
+            uint32_t m_useCount = 0;
+        };
+
+        //! The pipeline states used by the recorded sessions, see PipelineStateWarmupSystem.
+        struct PipelineStateManifest
+        {
+            AZ_TYPE_INFO(PipelineStateManifest, "{0F3C9A1E-6D47-4B8E-A25C-7E1B4D9F3A02}");
+            AZ_CLASS_ALLOCATOR(PipelineStateManifest, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            AZStd::vector<PipelineStateManifestEntry> m_entries;
+        };
+    } // namespace RPI
+} // namespace AZ
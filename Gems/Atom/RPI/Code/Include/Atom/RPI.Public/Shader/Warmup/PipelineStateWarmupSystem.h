@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Shader/Warmup/PipelineStateManifest.h>
+#include <Atom/RPI.Public/Shader/Warmup/PipelineStateWarmupSystemInterface.h>
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Shader;
+
+        //! Records the pipeline states acquired from shaders into a manifest when r_pipelineStateManifestRecord is enabled,
+        //! and compiles the pipeline states of the manifest at startup when r_pipelineStateWarmup is enabled.
+        //! The warmup compiles the pipeline states on the render thread within a time budget per frame, the most used ones first,
+        //! and keeps their shaders alive so the compiled pipeline states stay in the pipeline state cache.
+        class PipelineStateWarmupSystem final
+            : public PipelineStateWarmupSystemInterface
+        {
+        public:
+            AZ_TYPE_INFO(PipelineStateWarmupSystem, "{E4A17C52-9B3D-4E86-8F0A-2D6B5C1398E7}");
+            AZ_CLASS_ALLOCATOR(PipelineStateWarmupSystem, AZ::SystemAllocator, 0);
+
+            PipelineStateWarmupSystem() = default;
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            void Init();
+            void Shutdown();
+
+            //! Compiles the next pipeline states of the warmup, must be called once per frame before the scenes are rendered.
+            void Update();
+
+            // PipelineStateWarmupSystemInterface overrides...
+            void ReadManifest() override;
+            void WriteManifest() override;
+            const PipelineStateManifest& GetManifest() const override;
+            bool IsRecording() const override;
+            void RecordPipelineState(
+                const ShaderAsset& shaderAsset,
+                SupervariantIndex supervariantIndex,
+                ShaderVariantStableId shaderVariantStableId,
+                const RHI::PipelineStateDescriptor& descriptor) override;
+            void StartWarmup() override;
+            bool IsWarmingUp() const override;
+
+        private:
+            struct WarmupItem
+            {
+                PipelineStateManifestEntry m_entry;
+                Data::Asset<ShaderAsset> m_shaderAsset;
+                uint32_t m_pendingFrameCount = 0;
+            };
+
+            enum class WarmupResult
+            {
+                Compiled,
+                Pending,
+                Failed
+            };
+
+            //! Compiles the pipeline state of the item, or returns Pending if its shader or shader variant isn't loaded yet.
+            WarmupResult WarmupPipelineState(WarmupItem& item);
+
+            //! Builds the lookup of the manifest entries by hash.
+            void BuildEntryIndices();
+
+            //! Lock for m_manifest and m_entryIndices
+            AZStd::mutex m_manifestMutex;
+
+            PipelineStateManifest m_manifest;
+
+            //! The index of each entry of the manifest, by the hash of the entry.
+            AZStd::unordered_map<HashValue64, size_t> m_entryIndices;
+
+            //! True once a pipeline state was recorded in this session, the manifest is only written back in that case.
+            bool m_hasRecorded = false;
+
+            //! The pipeline states waiting to be compiled, the most used ones first.
+            AZStd::vector<WarmupItem> m_warmupQueue;
+
+            //! The shaders of the compiled pipeline states, by the hash of the shader ID and supervariant name.
+            AZStd::unordered_map<HashValue64, Data::Instance<Shader>> m_warmupShaders;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Shader/ShaderCommonTypes.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/RTTI/RTTI.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class PipelineStateDescriptor;
+    }
+
+    namespace RPI
+    {
+        class ShaderAsset;
+        struct PipelineStateManifest;
+
+        //! The PipelineStateWarmupSystem is the RPI interface that records the pipeline states used in a session into a manifest,
+        //! and compiles the pipeline states of the manifest at startup, before they are needed to draw.
+        class PipelineStateWarmupSystemInterface
+        {
+        public:
+            AZ_RTTI(PipelineStateWarmupSystemInterface, "{9D2B6E41-37A8-4F5C-B0E3-5C84A1F6D729}");
+
+            PipelineStateWarmupSystemInterface() = default;
+            virtual ~PipelineStateWarmupSystemInterface() = default;
+
+            static PipelineStateWarmupSystemInterface* Get();
+
+            AZ_DISABLE_COPY_MOVE(PipelineStateWarmupSystemInterface);
+
+            //! Reads the manifest from the user folder.
+            virtual void ReadManifest() = 0;
+
+            //! Writes the manifest to the user folder.
+            virtual void WriteManifest() = 0;
+
+            //! Gets the manifest, which contains the pipeline states of the previous sessions and the ones recorded in this session.
+            virtual const PipelineStateManifest& GetManifest() const = 0;
+
+            //! Returns a value indicating whether the acquired pipeline states are recorded into the manifest.
+            virtual bool IsRecording() const = 0;
+
+            //! Records a pipeline state acquired from a shader.
+            //! @param[in] shaderAsset The shader the pipeline state was acquired from.
+            //! @param[in] supervariantIndex The supervariant of the shader.
+            //! @param[in] shaderVariantStableId The shader variant the descriptor was configured with.
+            //! @param[in] descriptor The descriptor of the pipeline state.
+            virtual void RecordPipelineState(
+                const ShaderAsset& shaderAsset,
+                SupervariantIndex supervariantIndex,
+                ShaderVariantStableId shaderVariantStableId,
+                const RHI::PipelineStateDescriptor& descriptor) = 0;
+
+            //! Queues the pipeline states of the manifest to be compiled, the most used ones first.
+            virtual void StartWarmup() = 0;
+
+            //! Returns a value indicating whether pipeline states of the manifest are still waiting to be compiled.
+            virtual bool IsWarmingUp() const = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -18,6 +18,9 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/Name/Name.h>
 
 class MaskedOcclusionCulling;
@@ -35,6 +38,8 @@ namespace AZ
 
     namespace RPI
     {
+        class HiZOcclusion;
+
         //! Represents a view into a scene, and is the primary interface for adding DrawPackets to the draw queues.
         //! It encapsulates the world<->view<->clip transforms and the per-view shader constants.
         //! Use View::CreateView() to make new vew Objects to ensure that you have a shared ViewPtr to pass around the code.
@@ -138,6 +143,20 @@ namespace AZ
             //! Returns the masked occlusion culling interface
             MaskedOcclusionCulling* GetMaskedOcclusionCulling();
 
+            //! Sets the hierarchical depth buffer read back from a previous frame of this view, which replaces the occlusion
+            //! planes when culling the view. Can be called from any thread, pass nullptr to stop using it.
+            void SetHiZOcclusion(AZStd::shared_ptr<const HiZOcclusion> hiZOcclusion);
+
+            //! Returns the hierarchical depth buffer set with SetHiZOcclusion, if any
+            AZStd::shared_ptr<const HiZOcclusion> GetHiZOcclusion() const;
+
+            //! Adds an object to the hash of the objects culled into a shadow view. Thread safe, the order doesn't matter.
+            void AddToVisibleObjectsHash(size_t objectHash);
+
+            //! Returns a hash of the draw packets and object bounds culled into this view during its last culling.
+            //! It is only computed for shadow views, so cached shadowmaps can tell when a caster moved, appeared or disappeared.
+            size_t GetVisibleObjectsHash() const;
+
             //! This is called by RenderPipeline when this view is added to the pipeline.
             void OnAddToRenderPipeline();
 
@@ -208,6 +227,13 @@ namespace AZ
 
             // Masked Occlusion Culling interface
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
+
+            // Hierarchical depth buffer of a previous frame, replaced asynchronously once a newer one was read back
+            AZStd::shared_ptr<const HiZOcclusion> m_hiZOcclusion;
+            mutable AZStd::mutex m_hiZOcclusionMutex;
+
+            // Sum of the hashes of the objects culled into a shadow view, reset when the culling begins
+            AZStd::atomic<size_t> m_visibleObjectsHash{ 0 };
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(View::UsageFlags);
@@ -29,6 +29,7 @@ namespace AZ
         {
             ShaderInput,  //!< Maps to a ShaderResourceGroup input
             ShaderOption, //!< Maps to a shader variant option
+            BindlessImage, //!< Maps an image to a uint constant of the material ShaderResourceGroup, holding the index of the image in the bindless image array of the SceneSrg
             Invalid,
             Count = Invalid
         };
@@ -47,7 +48,7 @@ namespace AZ
             MaterialPropertyOutputType m_type = MaterialPropertyOutputType::Invalid;
 
             //! For m_type==ShaderOption, this is the index of a specific ShaderAsset (see MaterialTypeSourceData's ShaderCollection). 
-            //! For m_type==ShaderInput, this field is not used (because there is only one material ShaderResourceGroup in a MaterialAsset).
+            //! For m_type==ShaderInput or BindlessImage, this field is not used (because there is only one material ShaderResourceGroup in a MaterialAsset).
             RHI::Handle<uint32_t> m_containerIndex;
 
             //! Index to the specific setting that the material property maps to. 
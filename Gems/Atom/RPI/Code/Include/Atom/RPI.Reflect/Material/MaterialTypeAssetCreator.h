@@ -55,6 +55,10 @@ namespace AZ
             
             //! Adds an output mapping from the current material property to a ShaderResourceGroup input.
             void ConnectMaterialPropertyToShaderInput(const Name& shaderInputName);
+
+            //! Adds an output mapping from the current image material property to a uint constant of the ShaderResourceGroup,
+            //! which is set to the index of the image in the bindless image array of the SceneSrg.
+            void ConnectMaterialPropertyToBindlessImage(const Name& shaderInputName);
             
             //! Adds an output mapping from the current material property to a shader option in a specific shader.
             //! @param shaderIndex  Index to the material type's list of shader references, according to AddShader().
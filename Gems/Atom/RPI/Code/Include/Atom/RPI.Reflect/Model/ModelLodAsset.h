@@ -20,6 +20,7 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Name/Name.h>
 
 namespace AZ
@@ -79,6 +80,32 @@ namespace AZ
                     BufferAssetView m_bufferAssetView;
                 };
 
+                //! A cluster of consecutive triangles of the mesh, with the bounds used to cull it on the GPU.
+                struct Meshlet final
+                {
+                    AZ_TYPE_INFO(Meshlet, "{40625714-D511-46A9-8BEF-8CA4981E64E9}");
+
+                    static void Reflect(AZ::ReflectContext* context);
+
+                    //! Limits of the meshlets built by the model builder
+                    static constexpr uint32_t VertexCountMax = 64;
+                    static constexpr uint32_t TriangleCountMax = 124;
+
+                    //! Range of the meshlet in the indices of the mesh
+                    uint32_t m_indexOffset = 0;
+                    uint32_t m_indexCount = 0;
+
+                    //! Model space sphere bounding the triangles of the meshlet
+                    AZ::Vector3 m_boundsCenter = AZ::Vector3::CreateZero();
+                    float m_boundsRadius = 0.0f;
+
+                    //! Model space cone containing the normals of the triangles of the meshlet. The whole meshlet faces away from a
+                    //! viewer at position p when dot(m_boundsCenter - p, m_coneAxis) >= m_coneCutoff * length(m_boundsCenter - p) + m_boundsRadius.
+                    //! A cutoff of 1 is used for meshlets whose normals are too spread out to ever be culled this way.
+                    AZ::Vector3 m_coneAxis = AZ::Vector3::CreateAxisZ();
+                    float m_coneCutoff = 1.0f;
+                };
+
                 //! Returns the number of vertices in this mesh
                 uint32_t GetVertexCount() const;
 
@@ -103,6 +130,9 @@ namespace AZ
                 template<class T>
                 AZStd::span<const T> GetIndexBufferTyped() const;
 
+                //! Returns the meshlets covering all the triangles of the mesh, empty for meshes built without meshlets
+                AZStd::span<const Meshlet> GetMeshlets() const;
+
                 //! Return an array view of the list of all stream buffer info (not including the index buffer)
                 AZStd::span<const StreamBufferInfo> GetStreamBufferInfoList() const;
 
@@ -140,6 +170,8 @@ namespace AZ
                 // expected that the user calls GetStreamBufferInfo with the required semantics
                 // and pieces the layout together themselves.
                 AZStd::fixed_vector<StreamBufferInfo, RHI::Limits::Pipeline::StreamCountMax> m_streamBufferInfo;
+
+                AZStd::vector<Meshlet> m_meshlets;
             };
 
             //! Returns an array view into the collection of meshes owned by this lod
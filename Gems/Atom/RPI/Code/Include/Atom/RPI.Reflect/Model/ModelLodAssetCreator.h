@@ -54,6 +54,10 @@ namespace AZ
             //! Begin and BeginMesh must be called first
             void SetMeshIndexBuffer(const BufferAssetView& bufferAssetView);
 
+            //! Sets the meshlets of the current SubMesh, which must cover ranges of its index buffer.
+            //! Begin and BeginMesh must be called first
+            void SetMeshMeshlets(AZStd::vector<ModelLodAsset::Mesh::Meshlet>&& meshlets);
+
             //! Adds a BufferAssetView to the current SubMesh as a stream buffer that matches the given semantic name.
             //! Begin and BeginMesh must be called first
             bool AddMeshStreamBuffer(
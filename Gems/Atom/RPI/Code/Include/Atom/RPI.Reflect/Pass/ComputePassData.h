@@ -29,13 +29,14 @@ namespace AZ
                 if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
                 {
                     serializeContext->Class<ComputePassData, RenderPassData>()
-                        ->Version(2)
+                        ->Version(3)
                         ->Field("ShaderAsset", &ComputePassData::m_shaderReference)
                         ->Field("Target Thread Count X", &ComputePassData::m_totalNumberOfThreadsX)
                         ->Field("Target Thread Count Y", &ComputePassData::m_totalNumberOfThreadsY)
                         ->Field("Target Thread Count Z", &ComputePassData::m_totalNumberOfThreadsZ)
                         ->Field("Make Fullscreen Pass", &ComputePassData::m_makeFullscreenPass)
                         ->Field("Use Async Compute", &ComputePassData::m_useAsyncCompute)
+                        ->Field("Allow Async Compute", &ComputePassData::m_allowAsyncCompute)
                         ;
                 }
             }
@@ -50,6 +51,10 @@ namespace AZ
 
             // Whether the pass should use async compute and run on the compute hardware queue.
             bool m_useAsyncCompute = false;
+
+            // Whether the pass is independent enough of the graphics work around it to run on the compute hardware queue.
+            // The pass only moves to the compute queue when r_asyncComputePasses is enabled.
+            bool m_allowAsyncCompute = false;
         };
     } // namespace RPI
 } // namespace AZ
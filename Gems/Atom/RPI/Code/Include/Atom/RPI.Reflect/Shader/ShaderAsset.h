@@ -105,6 +105,10 @@ namespace AZ
             //! Note that this will append the system supervariant name from RPI::ShaderSystem when searching.
             SupervariantIndex GetSupervariantIndex(const AZ::Name& supervariantName) const;
 
+            //! Returns the name of the supervariant at the specified index, which includes the system supervariant name
+            //! when the supervariant was selected for it. Returns an empty name if the index is invalid.
+            const Name& GetSupervariantName(SupervariantIndex supervariantIndex) const;
+
             //! This function should be your one stop shop to get a ShaderVariantAsset.
             //! Finds and returns the best matching ShaderVariantAsset given a ShaderVariantId.
             //! If the ShaderVariantAsset is not fully loaded and ready at the moment, this function
@@ -16,6 +16,9 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Atom/RPI.Reflect/Buffer/BufferAssetCreator.h>
@@ -103,7 +106,7 @@ namespace AZ
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
             {
                 serialize->Class<ModelAssetBuilderComponent, SceneAPI::SceneCore::ExportingComponent>()
-                    ->Version(30);  // (updated to separate material slot ID from default material asset)
+                    ->Version(32);  // (updated to optimize the triangle and vertex order for the vertex cache)
             }
         }
 
@@ -408,6 +411,11 @@ namespace AZ
                         lodMeshes = MergeMeshesByMaterialUid(lodMeshes);
                     }
 
+                    for (ProductMeshContent& mesh : lodMeshes)
+                    {
+                        BuildMeshlets(mesh);
+                    }
+
 #if defined(AZ_RPI_MESHES_SHARE_COMMON_BUFFERS)
                     // We shouldn't need a mesh name for the buffer names since meshed are sharing common buffers
                     m_meshName = "";
@@ -675,20 +683,51 @@ namespace AZ
                         productMesh.m_indices.push_back(faceInfo.vertexIndex[2]);
                     }
 
+                    // Morph target deltas address the vertices by their source index, so the vertices of morphed meshes keep their
+                    // source order, the others are reordered for the vertex cache and then numbered in the order they are used.
+                    const bool optimizeVertexOrder = !sourceMesh.m_isMorphed;
+                    if (optimizeVertexOrder)
+                    {
+                        OptimizeVertexCache(productMesh.m_indices);
+                    }
+
                     // We need to both gather a collection of unique 
                     // indices so that we don't gather duplicate vertex data
                     // while also correcting the collection of indices 
                     // that we have so that they start at 0 and are contiguous. 
+                    constexpr uint32_t UnassignedIndex = AZStd::numeric_limits<uint32_t>::max();
                     AZStd::map<uint32_t, uint32_t> oldToNewIndices;
-                    uint32_t newIndex = 0;
-                    for (uint32_t& index : productMesh.m_indices)
+                    for (const uint32_t index : productMesh.m_indices)
+                    {
+                        oldToNewIndices.emplace(index, UnassignedIndex);
+                    }
+
+                    // The old index of each vertex of the product mesh, in the order of the new indices.
+                    AZStd::vector<uint32_t> newToOldIndices;
+                    newToOldIndices.reserve(oldToNewIndices.size());
+                    if (optimizeVertexOrder)
                     {
-                        if (oldToNewIndices.find(index) == oldToNewIndices.end())
+                        for (const uint32_t index : productMesh.m_indices)
                         {
-                            oldToNewIndices[index] = newIndex;
-                            newIndex++;
+                            uint32_t& newIndex = oldToNewIndices[index];
+                            if (newIndex == UnassignedIndex)
+                            {
+                                newIndex = aznumeric_cast<uint32_t>(newToOldIndices.size());
+                                newToOldIndices.push_back(index);
+                            }
                         }
+                    }
+                    else
+                    {
+                        for (auto& [oldIndex, newIndex] : oldToNewIndices)
+                        {
+                            newIndex = aznumeric_cast<uint32_t>(newToOldIndices.size());
+                            newToOldIndices.push_back(oldIndex);
+                        }
+                    }
 
+                    for (uint32_t& index : productMesh.m_indices)
+                    {
                         index = oldToNewIndices[index];
                     }
 
@@ -702,7 +741,7 @@ namespace AZ
                     AZStd::vector<AZ::Name>& colorNames = productMesh.m_colorCustomNames;
                     AZStd::vector<float>& clothData = productMesh.m_clothData;
 
-                    const size_t vertexCount = oldToNewIndices.size();
+                    const size_t vertexCount = newToOldIndices.size();
                     positions.reserve(vertexCount * PositionFloatsPerVert);
                     normals.reserve(vertexCount * NormalFloatsPerVert);
 
@@ -765,12 +804,11 @@ namespace AZ
                         }
                     }
 
-                    for (const auto& itr : oldToNewIndices)
+                    for (const uint32_t oldIndex : newToOldIndices)
                     {
                         // We use the 'old' index as that properly indexes 
-                        // into the old mesh data. The 'new' index is used for properly
+                        // into the old mesh data. The position in newToOldIndices is used for properly
                         // indexing into this new collection that we're building here.
-                        const uint32_t oldIndex = itr.first;
 
                         AZ::Vector3 pos = meshData->GetPosition(oldIndex);
                         AZ::Vector3 normal = meshData->GetNormal(oldIndex);
@@ -1006,6 +1044,300 @@ namespace AZ
             }
         }
 
+        void ModelAssetBuilderComponent::OptimizeVertexCache(AZStd::vector<uint32_t>& indices) const
+        {
+            // Size of the simulated FIFO/LRU cache, and the weights of the vertex scores, as suggested by Tom Forsyth
+            constexpr int32_t CacheSize = 32;
+            constexpr float CacheDecayPower = 1.5f;
+            constexpr float LastTriangleScore = 0.75f;
+            constexpr float ValenceBoostScale = 2.0f;
+            constexpr float ValenceBoostPower = 0.5f;
+
+            const uint32_t triangleCount = aznumeric_cast<uint32_t>(indices.size() / 3);
+            if (triangleCount < 2)
+            {
+                return;
+            }
+
+            const uint32_t vertexCount = *AZStd::max_element(indices.begin(), indices.begin() + triangleCount * 3) + 1;
+
+            // The triangles using each vertex, as ranges of vertexTriangles
+            AZStd::vector<uint32_t> vertexTriangleOffsets(vertexCount + 1, 0);
+            for (uint32_t index = 0; index < triangleCount * 3; ++index)
+            {
+                ++vertexTriangleOffsets[indices[index] + 1];
+            }
+            for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+            {
+                vertexTriangleOffsets[vertex + 1] += vertexTriangleOffsets[vertex];
+            }
+            // The triangles that weren't emitted yet come first in the range of each vertex
+            AZStd::vector<uint32_t> remainingTriangleCounts(vertexCount, 0);
+            AZStd::vector<uint32_t> vertexTriangles(triangleCount * 3);
+            for (uint32_t index = 0; index < triangleCount * 3; ++index)
+            {
+                const uint32_t vertex = indices[index];
+                vertexTriangles[vertexTriangleOffsets[vertex] + remainingTriangleCounts[vertex]++] = index / 3;
+            }
+
+            AZStd::vector<int32_t> cachePositions(vertexCount, -1);
+            const auto calculateVertexScore = [&cachePositions, &remainingTriangleCounts](uint32_t vertex)
+            {
+                if (remainingTriangleCounts[vertex] == 0)
+                {
+                    return -1.0f;
+                }
+
+                float score = 0.0f;
+                const int32_t cachePosition = cachePositions[vertex];
+                if (cachePosition >= 0)
+                {
+                    // The vertices of the last triangle get a fixed score, so that the same edge isn't favored over and over
+                    score = cachePosition < 3
+                        ? LastTriangleScore
+                        : powf(1.0f - static_cast<float>(cachePosition - 3) / static_cast<float>(CacheSize - 3), CacheDecayPower);
+                }
+
+                // Boost the vertices with few triangles left, to finish them and avoid leaving lone triangles behind
+                return score + ValenceBoostScale * powf(static_cast<float>(remainingTriangleCounts[vertex]), -ValenceBoostPower);
+            };
+
+            AZStd::vector<float> vertexScores(vertexCount);
+            for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+            {
+                vertexScores[vertex] = calculateVertexScore(vertex);
+            }
+
+            AZStd::vector<float> triangleScores(triangleCount);
+            AZStd::vector<bool> triangleEmitted(triangleCount, false);
+            uint32_t bestTriangle = 0;
+            for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+            {
+                triangleScores[triangle] =
+                    vertexScores[indices[triangle * 3]] + vertexScores[indices[triangle * 3 + 1]] + vertexScores[indices[triangle * 3 + 2]];
+                if (triangleScores[triangle] > triangleScores[bestTriangle])
+                {
+                    bestTriangle = triangle;
+                }
+            }
+
+            AZStd::vector<uint32_t> optimizedIndices;
+            optimizedIndices.reserve(indices.size());
+
+            // The cache holds up to CacheSize vertices, plus the 3 vertices of the new triangle while it gets updated
+            AZStd::fixed_vector<uint32_t, CacheSize + 3> cache;
+            AZStd::fixed_vector<uint32_t, CacheSize + 3> newCache;
+            uint32_t nextUnemittedTriangle = 0;
+            for (uint32_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+            {
+                const uint32_t* triangleVertices = &indices[bestTriangle * 3];
+                optimizedIndices.insert(optimizedIndices.end(), triangleVertices, triangleVertices + 3);
+                triangleEmitted[bestTriangle] = true;
+
+                // Move the emitted triangle past the remaining triangles of its vertices
+                for (uint32_t corner = 0; corner < 3; ++corner)
+                {
+                    const uint32_t vertex = triangleVertices[corner];
+                    uint32_t* triangles = &vertexTriangles[vertexTriangleOffsets[vertex]];
+                    uint32_t* triangle = AZStd::find(triangles, triangles + remainingTriangleCounts[vertex], bestTriangle);
+                    AZStd::swap(*triangle, triangles[--remainingTriangleCounts[vertex]]);
+                }
+
+                // The vertices of the emitted triangle are the most recent ones of the cache
+                newCache.assign(triangleVertices, triangleVertices + 3);
+                for (const uint32_t vertex : cache)
+                {
+                    if (vertex != triangleVertices[0] && vertex != triangleVertices[1] && vertex != triangleVertices[2])
+                    {
+                        newCache.push_back(vertex);
+                    }
+                }
+                for (int32_t cachePosition = 0; cachePosition < static_cast<int32_t>(newCache.size()); ++cachePosition)
+                {
+                    cachePositions[newCache[cachePosition]] = cachePosition < CacheSize ? cachePosition : -1;
+                }
+
+                // Update the scores of the vertices whose cache position changed, and of their triangles
+                float bestScore = -1.0f;
+                for (const uint32_t vertex : newCache)
+                {
+                    vertexScores[vertex] = calculateVertexScore(vertex);
+                }
+                for (const uint32_t vertex : newCache)
+                {
+                    const uint32_t* triangles = &vertexTriangles[vertexTriangleOffsets[vertex]];
+                    for (uint32_t triangleIndex = 0; triangleIndex < remainingTriangleCounts[vertex]; ++triangleIndex)
+                    {
+                        const uint32_t triangle = triangles[triangleIndex];
+                        triangleScores[triangle] = vertexScores[indices[triangle * 3]] + vertexScores[indices[triangle * 3 + 1]] +
+                            vertexScores[indices[triangle * 3 + 2]];
+                        if (triangleScores[triangle] > bestScore)
+                        {
+                            bestScore = triangleScores[triangle];
+                            bestTriangle = triangle;
+                        }
+                    }
+                }
+
+                if (newCache.size() > CacheSize)
+                {
+                    newCache.resize(CacheSize);
+                }
+                AZStd::swap(cache, newCache);
+
+                // When none of the cached vertices has triangles left, continue with the next triangle in the original order
+                if (bestScore < 0.0f)
+                {
+                    while (nextUnemittedTriangle < triangleCount && triangleEmitted[nextUnemittedTriangle])
+                    {
+                        ++nextUnemittedTriangle;
+                    }
+                    bestTriangle = nextUnemittedTriangle;
+                }
+            }
+
+            // Keep the indices of an incomplete last triangle, which won't be drawn
+            optimizedIndices.insert(optimizedIndices.end(), indices.begin() + triangleCount * 3, indices.end());
+            indices = AZStd::move(optimizedIndices);
+        }
+
+        void ModelAssetBuilderComponent::BuildMeshlets(ProductMeshContent& mesh) const
+        {
+            using Meshlet = ModelLodAsset::Mesh::Meshlet;
+
+            mesh.m_meshlets.clear();
+            if (mesh.m_positions.empty())
+            {
+                return;
+            }
+
+            const uint32_t indexCount = aznumeric_cast<uint32_t>(mesh.m_indices.size() - mesh.m_indices.size() % 3);
+            AZStd::fixed_vector<uint32_t, Meshlet::VertexCountMax> meshletVertices;
+            uint32_t meshletIndexOffset = 0;
+            for (uint32_t indexOffset = 0; indexOffset < indexCount; indexOffset += 3)
+            {
+                AZStd::fixed_vector<uint32_t, 3> newVertices;
+                for (uint32_t corner = 0; corner < 3; ++corner)
+                {
+                    const uint32_t vertex = mesh.m_indices[indexOffset + corner];
+                    if (AZStd::find(meshletVertices.begin(), meshletVertices.end(), vertex) == meshletVertices.end() &&
+                        AZStd::find(newVertices.begin(), newVertices.end(), vertex) == newVertices.end())
+                    {
+                        newVertices.push_back(vertex);
+                    }
+                }
+
+                // start a new meshlet when the triangle doesn't fit in the current one
+                const uint32_t meshletTriangleCount = (indexOffset - meshletIndexOffset) / 3;
+                if (meshletVertices.size() + newVertices.size() > Meshlet::VertexCountMax || meshletTriangleCount == Meshlet::TriangleCountMax)
+                {
+                    mesh.m_meshlets.push_back(CreateMeshlet(mesh, meshletIndexOffset, indexOffset - meshletIndexOffset));
+                    meshletIndexOffset = indexOffset;
+                    meshletVertices.clear();
+                    for (uint32_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t vertex = mesh.m_indices[indexOffset + corner];
+                        if (AZStd::find(meshletVertices.begin(), meshletVertices.end(), vertex) == meshletVertices.end())
+                        {
+                            meshletVertices.push_back(vertex);
+                        }
+                    }
+                }
+                else
+                {
+                    meshletVertices.insert(meshletVertices.end(), newVertices.begin(), newVertices.end());
+                }
+            }
+
+            if (meshletIndexOffset < indexCount)
+            {
+                mesh.m_meshlets.push_back(CreateMeshlet(mesh, meshletIndexOffset, indexCount - meshletIndexOffset));
+            }
+        }
+
+        ModelLodAsset::Mesh::Meshlet ModelAssetBuilderComponent::CreateMeshlet(
+            const ProductMeshContent& mesh, uint32_t indexOffset, uint32_t indexCount) const
+        {
+            const auto getPosition = [&mesh](uint32_t vertex)
+            {
+                return Vector3::CreateFromFloat3(&mesh.m_positions[vertex * PositionFloatsPerVert]);
+            };
+
+            ModelLodAsset::Mesh::Meshlet meshlet;
+            meshlet.m_indexOffset = indexOffset;
+            meshlet.m_indexCount = indexCount;
+
+            Aabb aabb = Aabb::CreateNull();
+            for (uint32_t index = indexOffset; index < indexOffset + indexCount; ++index)
+            {
+                aabb.AddPoint(getPosition(mesh.m_indices[index]));
+            }
+
+            meshlet.m_boundsCenter = aabb.GetCenter();
+            for (uint32_t index = indexOffset; index < indexOffset + indexCount; ++index)
+            {
+                meshlet.m_boundsRadius = AZStd::max(meshlet.m_boundsRadius, getPosition(mesh.m_indices[index]).GetDistance(meshlet.m_boundsCenter));
+            }
+
+            // The cone needs the front side of each face, which is taken from the vertex normals rather than from the winding
+            const bool hasNormals = mesh.m_normals.size() == mesh.m_positions.size();
+            if (!hasNormals)
+            {
+                return meshlet;
+            }
+
+            const auto getNormal = [&mesh](uint32_t vertex)
+            {
+                return Vector3::CreateFromFloat3(&mesh.m_normals[vertex * NormalFloatsPerVert]);
+            };
+
+            AZStd::fixed_vector<Vector3, ModelLodAsset::Mesh::Meshlet::TriangleCountMax> faceNormals;
+            Vector3 normalSum = Vector3::CreateZero();
+            for (uint32_t index = indexOffset; index < indexOffset + indexCount; index += 3)
+            {
+                const uint32_t vertex0 = mesh.m_indices[index];
+                const uint32_t vertex1 = mesh.m_indices[index + 1];
+                const uint32_t vertex2 = mesh.m_indices[index + 2];
+
+                Vector3 faceNormal = (getPosition(vertex1) - getPosition(vertex0)).Cross(getPosition(vertex2) - getPosition(vertex0));
+                if (faceNormal.GetLengthSq() < Constants::FloatEpsilon * Constants::FloatEpsilon)
+                {
+                    // degenerate triangles are never rasterized
+                    continue;
+                }
+
+                faceNormal.Normalize();
+                if (faceNormal.Dot(getNormal(vertex0) + getNormal(vertex1) + getNormal(vertex2)) < 0.0f)
+                {
+                    faceNormal = -faceNormal;
+                }
+
+                faceNormals.push_back(faceNormal);
+                normalSum += faceNormal;
+            }
+
+            if (faceNormals.empty() || normalSum.GetLengthSq() < Constants::FloatEpsilon)
+            {
+                return meshlet;
+            }
+
+            const Vector3 coneAxis = normalSum.GetNormalized();
+            float minimumDot = 1.0f;
+            for (const Vector3& faceNormal : faceNormals)
+            {
+                minimumDot = AZStd::min(minimumDot, faceNormal.Dot(coneAxis));
+            }
+
+            // a cone wider than a half space can't be facing away from any viewer
+            if (minimumDot > 0.0f)
+            {
+                meshlet.m_coneAxis = coneAxis;
+                meshlet.m_coneCutoff = AZStd::sqrt(1.0f - minimumDot * minimumDot);
+            }
+
+            return meshlet;
+        }
+
         ModelAssetBuilderComponent::ProductMeshContentList ModelAssetBuilderComponent::MergeMeshesByMaterialUid(const ProductMeshContentList& productMeshList)
         {
             ProductMeshContentList finalMeshList;
@@ -1210,6 +1542,7 @@ namespace AZ
                 meshView.m_clothDataView = RHI::BufferViewDescriptor::CreateTyped(0, meshClothDataCount, ClothDataFormat);
             }
 
+            meshView.m_meshlets = mesh.m_meshlets;
             meshView.m_materialUid = mesh.m_materialUid;
 
             return meshView;
@@ -1379,6 +1712,8 @@ namespace AZ
                     lodBufferInfo.m_morphTargetVertexDeltaCount += numNewVertexDeltas;
                 }
 
+                meshView.m_meshlets = mesh.m_meshlets;
+
                 meshViews.emplace_back(AZStd::move(meshView));
                 isFirstMesh = false;
             }
@@ -1829,6 +2164,9 @@ namespace AZ
 
             lodAssetCreator.SetMeshIndexBuffer(AZStd::move(indexBufferAssetView));
 
+            AZStd::vector<ModelLodAsset::Mesh::Meshlet> meshlets = meshView.m_meshlets;
+            lodAssetCreator.SetMeshMeshlets(AZStd::move(meshlets));
+
             {
                 // Build the mesh's Aabb
                 ModelLodAsset::Mesh::StreamBufferInfo positionStreamBufferInfo;
@@ -119,6 +119,9 @@ namespace AZ
                 // Morph targets
                 AZStd::vector<RPI::PackedCompressedMorphTargetDelta> m_morphTargetVertexData;
 
+                //! Meshlets covering the triangles of m_indices
+                AZStd::vector<ModelLodAsset::Mesh::Meshlet> m_meshlets;
+
                 MaterialUid m_materialUid;
                 bool CanBeMerged() const { return m_clothData.empty(); }
                 bool m_hasMorphedColors = false;
@@ -176,6 +179,9 @@ namespace AZ
 
                 RHI::BufferViewDescriptor m_clothDataView;
 
+                //! Meshlets of the mesh, relative to the start of m_indexView
+                AZStd::vector<ModelLodAsset::Mesh::Meshlet> m_meshlets;
+
                 MaterialUid m_materialUid;
             };
             using ProductMeshViewList = AZStd::vector<ProductMeshView>;
@@ -205,6 +211,18 @@ namespace AZ
             ProductMeshContentList MergeMeshesByMaterialUid(
                 const ProductMeshContentList& productMeshList);
 
+            //! Reorders the triangles of an index list for the post-transform vertex cache of the GPU, using Tom Forsyth's
+            //! linear-speed vertex cache optimization. The vertices themselves are renumbered in the order the reordered
+            //! triangles first use them by the caller, which keeps the vertex fetches mostly sequential.
+            void OptimizeVertexCache(AZStd::vector<uint32_t>& indices) const;
+
+            //! Splits the triangles of a mesh into meshlets of consecutive triangles, which are culled individually on the GPU.
+            //! The triangle order is kept, so the meshlets are only as compact as the triangle order is spatially coherent.
+            void BuildMeshlets(ProductMeshContent& mesh) const;
+
+            //! Computes the bounding sphere and normal cone of the meshlet covering the given range of the mesh indices.
+            ModelLodAsset::Mesh::Meshlet CreateMeshlet(const ProductMeshContent& mesh, uint32_t indexOffset, uint32_t indexCount) const;
+
             //! Simple helper to create a MeshView that views an entire given ProductMeshContent object as one mesh.
             ProductMeshView CreateViewToEntireMesh(const ProductMeshContent& mesh);
 
@@ -655,6 +655,13 @@ namespace AZ
                         materialTypeAssetCreator.ConnectMaterialPropertyToShaderInput(fieldName);
                         break;
                     }
+                    case MaterialPropertyOutputType::BindlessImage:
+                    {
+                        Name fieldName{output.m_fieldName};
+                        materialNameContext.ContextualizeSrgInput(fieldName);
+                        materialTypeAssetCreator.ConnectMaterialPropertyToBindlessImage(fieldName);
+                        break;
+                    }
                     case MaterialPropertyOutputType::ShaderOption:
                     {
                         Name fieldName{output.m_fieldName};
@@ -9,6 +9,8 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/HiZOcclusion.h>
+#include <Atom/RPI.Public/Model/Model.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -274,6 +276,7 @@ namespace AZ
             const Scene* m_scene = nullptr;
             View* m_view = nullptr;
             Frustum m_frustum;
+            AZStd::shared_ptr<const HiZOcclusion> m_hiZOcclusion;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
@@ -291,6 +294,7 @@ namespace AZ
             worklistData->m_scene = &scene;
             worklistData->m_view = &view;
             worklistData->m_frustum = frustum;
+            worklistData->m_hiZOcclusion = view.GetHiZOcclusion();
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             worklistData->m_maskedOcclusionCulling = static_cast<MaskedOcclusionCulling*>(maskedOcclusionCulling);
 #endif
@@ -306,12 +310,23 @@ namespace AZ
                     AzFramework::VisibilityEntry* visibleEntry);
 #endif
 
+        // Hashes the bounds of a visible object, so an object moving inside a shadow view changes the hash of its visible objects
+        static size_t HashVisibleBounds(const Aabb& bounds)
+        {
+            size_t hash = 0;
+            const Vector3& minBound = bounds.GetMin();
+            const Vector3& maxBound = bounds.GetMax();
+            AZStd::hash_combine(hash, minBound.GetX(), minBound.GetY(), minBound.GetZ(), maxBound.GetX(), maxBound.GetY(), maxBound.GetZ());
+            return hash;
+        }
+
         static void ProcessWorklist(const AZStd::shared_ptr<WorklistData>& worklistData, const WorkListType& worklist)
         {
             AZ_PROFILE_SCOPE(RPI, "AddObjectsToViewJob: Process");
 
             const View::UsageFlags viewFlags = worklistData->m_view->GetUsageFlags();
             const RHI::DrawListMask drawListMask = worklistData->m_view->GetDrawListMask();
+            const bool hashVisibleObjects = (viewFlags & View::UsageShadow) != 0;
             #ifdef AZ_CULL_DEBUG_ENABLED
                 // These variable are only used for the gathering of debug information.
                 uint32_t numDrawPackets = 0;
@@ -350,6 +365,11 @@ namespace AZ
                                     continue;
                                 }
 
+                                if (worklistData->m_hiZOcclusion && worklistData->m_hiZOcclusion->IsOccluded(visibleEntry->m_boundingVolume))
+                                {
+                                    continue;
+                                }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                 if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -363,6 +383,11 @@ namespace AZ
                                         numDrawPackets += drawPacketCount;
                                     #endif
 
+                                    if (hashVisibleObjects)
+                                    {
+                                        worklistData->m_view->AddToVisibleObjectsHash(HashVisibleBounds(visibleEntry->m_boundingVolume));
+                                    }
+
                                     c->m_isVisible = true;
                                 }
                             }
@@ -386,13 +411,19 @@ namespace AZ
                                 continue;
                             }
 
-                            IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
+                            // GPU culled objects are tested against the view frustums per draw on the GPU
+                            IntersectResult res = c->m_isGpuCulled ? IntersectResult::Interior : ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
                             if (res == IntersectResult::Exterior)
                             {
                                 continue;
                             }
                             else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb))
                             {
+                                if (worklistData->m_hiZOcclusion && worklistData->m_hiZOcclusion->IsOccluded(visibleEntry->m_boundingVolume))
+                                {
+                                    continue;
+                                }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                 if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -406,6 +437,11 @@ namespace AZ
                                         numDrawPackets += drawPacketCount;
                                     #endif
 
+                                    if (hashVisibleObjects)
+                                    {
+                                        worklistData->m_view->AddToVisibleObjectsHash(HashVisibleBounds(visibleEntry->m_boundingVolume));
+                                    }
+
                                     c->m_isVisible = true;
                                 }
                             }
@@ -578,8 +614,9 @@ namespace AZ
             }
 #endif //AZ_CULL_DEBUG_ENABLED
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-            // setup occlusion culling, if necessary
-            maskedOcclusionCulling = m_occlusionPlanes.empty() ? nullptr : view.GetMaskedOcclusionCulling();
+            // setup occlusion culling, if necessary. The occlusion planes aren't needed when the view is culled against the
+            // depth of a previous frame, which already contains every opaque occluder.
+            maskedOcclusionCulling = (m_occlusionPlanes.empty() || view.GetHiZOcclusion()) ? nullptr : view.GetMaskedOcclusionCulling();
             if (maskedOcclusionCulling)
             {
                 // frustum cull occlusion planes
@@ -746,6 +783,91 @@ namespace AZ
             }
         }
 
+        void CullingScene::ProcessCullablesTG(const Scene& scene, AZStd::span<const ViewPtr> views, AZ::TaskGraph& taskGraph)
+        {
+            AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesTG() - %zu views", views.size());
+
+            static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
+
+            // The views are culled in groups, as many as fit in the frustum mask of the visibility scene
+            constexpr size_t MaxSharedViews = AzFramework::IVisibilityScene::MaxSharedFrustums;
+            for (size_t firstView = 0; firstView < views.size(); firstView += MaxSharedViews)
+            {
+                const size_t viewCount = AZStd::min(views.size() - firstView, MaxSharedViews);
+
+                AZStd::fixed_vector<AZ::Frustum, MaxSharedViews> frustums;
+                AZStd::array<AZStd::shared_ptr<WorklistData>, MaxSharedViews> worklistDatas;
+                AZStd::array<AZStd::unique_ptr<WorkListType>, MaxSharedViews> worklists;
+                for (size_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+                {
+                    View& view = *views[firstView + viewIndex];
+                    AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view.GetWorldToClipMatrix());
+
+                    void* maskedOcclusionCulling = nullptr;
+                    ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
+
+                    frustums.push_back(frustum);
+                    worklistDatas[viewIndex] = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling);
+                    worklists[viewIndex] = AZStd::make_unique<WorkListType>();
+                }
+
+                auto nodeVisitorLambda = [viewCount, &worklistDatas, &taskGraph, &worklists](const AzFramework::IVisibilityScene::NodeData& nodeData, uint32_t frustumMask) -> void
+                {
+                    AZ_PROFILE_SCOPE(RPI, "nodeVisitorLambda()");
+                    AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
+
+                    // Queue the node on the worklist of every view that can see it
+                    for (size_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+                    {
+                        if ((frustumMask & (1u << viewIndex)) == 0)
+                        {
+                            continue;
+                        }
+
+                        AZStd::unique_ptr<WorkListType>& worklist = worklists[viewIndex];
+                        AZ_Assert(worklist->size() < worklist->capacity(), "we should always have room to push a node on the queue");
+                        worklist->emplace_back(nodeData);
+
+                        if (worklist->size() == worklist->capacity())
+                        {
+                            //Task takes ownership of the worklist unique ptr
+                            taskGraph.AddTask(descriptor, [worklistData = worklistDatas[viewIndex], worklist = AZStd::move(worklist)]()
+                            {
+                                ProcessWorklist(worklistData, *worklist.get());
+                                // allow worklist to go out of scope and be deleted
+                            });
+                            worklist = AZStd::make_unique<WorkListType>();
+                        }
+                    }
+                };
+
+                if (m_debugCtx.m_enableFrustumCulling)
+                {
+                    m_visScene->EnumerateFrustums(frustums, nodeVisitorLambda);
+                }
+                else
+                {
+                    const uint32_t allViewsMask = (viewCount == MaxSharedViews) ? 0xFFFFFFFF : ((1u << viewCount) - 1);
+                    m_visScene->EnumerateNoCull([&nodeVisitorLambda, allViewsMask](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        nodeVisitorLambda(nodeData, allViewsMask);
+                    });
+                }
+
+                for (size_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+                {
+                    if (worklists[viewIndex]->size() > 0)
+                    {
+                        //Task takes ownership of the worklist unique ptr
+                        taskGraph.AddTask(descriptor, [worklistData = worklistDatas[viewIndex], worklist = AZStd::move(worklists[viewIndex])]()
+                        {
+                            ProcessWorklist(worklistData, *worklist.get());
+                            // allow worklist to go out of scope and be deleted
+                        });
+                    }
+                }
+            }
+        }
 
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
         {
@@ -765,8 +887,13 @@ namespace AZ
 
             uint32_t numVisibleDrawPackets = 0;
 
-            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
+            auto addLodToDrawPacket = [&](size_t lodIndex)
             {
+                const Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
+                if (lodData.m_streamingModel)
+                {
+                    lodData.m_streamingModel->RequestLod(lodIndex);
+                }
 #ifdef AZ_CULL_PROFILE_VERBOSE
                 AZ_PROFILE_SCOPE(RPI, "add draw packets: %zu", lod.m_drawPackets.size());
 #endif
@@ -782,17 +909,18 @@ namespace AZ
                 case Cullable::LodType::SpecificLod:
                     if (lodData.m_lodConfiguration.m_lodOverride < lodData.m_lods.size())
                     {
-                        addLodToDrawPacket(lodData.m_lods.at(lodData.m_lodConfiguration.m_lodOverride));
+                        addLodToDrawPacket(lodData.m_lodConfiguration.m_lodOverride);
                     }
                     break;
                 case Cullable::LodType::ScreenCoverage:
                 default:
-                    for (const Cullable::LodData::Lod& lod : lodData.m_lods)
+                    for (size_t lodIndex = 0; lodIndex < lodData.m_lods.size(); ++lodIndex)
                     {
                         // Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
+                        const Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
                         if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                         {
-                            addLodToDrawPacket(lod);
+                            addLodToDrawPacket(lodIndex);
                         }
                     }
                     break;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/DynamicResolutionController.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        // weight of the latest frame in the smoothed frame time
+        static constexpr float FrameTimeSmoothing = 0.2f;
+
+        void DynamicResolutionController::Init(const Descriptor& descriptor)
+        {
+            m_descriptor = descriptor;
+            m_descriptor.m_scaleStep = AZStd::max(m_descriptor.m_scaleStep, 0.01f);
+            m_descriptor.m_maxScale = AZStd::clamp(m_descriptor.m_maxScale, m_descriptor.m_scaleStep, 1.0f);
+            m_descriptor.m_minScale = AZStd::clamp(m_descriptor.m_minScale, m_descriptor.m_scaleStep, m_descriptor.m_maxScale);
+            Reset();
+        }
+
+        void DynamicResolutionController::Reset()
+        {
+            m_scale = QuantizeScale(m_descriptor.m_maxScale);
+            m_smoothedFrameTimeInMs = 0.0f;
+            m_framesSinceChange = 0;
+        }
+
+        bool DynamicResolutionController::Update(float gpuFrameTimeInMs)
+        {
+            if (gpuFrameTimeInMs <= 0.0f || m_descriptor.m_targetFrameTimeInMs <= 0.0f)
+            {
+                return false;
+            }
+
+            m_smoothedFrameTimeInMs = (m_smoothedFrameTimeInMs == 0.0f)
+                ? gpuFrameTimeInMs
+                : AZ::Lerp(m_smoothedFrameTimeInMs, gpuFrameTimeInMs, FrameTimeSmoothing);
+
+            if (++m_framesSinceChange < m_descriptor.m_framesBetweenChanges)
+            {
+                return false;
+            }
+
+            const float target = m_descriptor.m_targetFrameTimeInMs;
+            const bool overTarget = m_smoothedFrameTimeInMs > target;
+            const bool underTarget = m_smoothedFrameTimeInMs < target * (1.0f - m_descriptor.m_headroom);
+            if (!overTarget && !underTarget)
+            {
+                return false;
+            }
+
+            // the GPU time is mostly proportional to the pixel count, which is proportional to the square of the scale
+            float scale = m_scale * sqrtf(target / m_smoothedFrameTimeInMs);
+            scale = QuantizeScale(scale);
+            if (overTarget)
+            {
+                // make sure the scale lowers by at least one step, the rounding can cancel out small changes
+                scale = AZStd::min(scale, QuantizeScale(m_scale - m_descriptor.m_scaleStep));
+            }
+            else
+            {
+                // rise one step at a time, the frame time of higher scales is only known once they are used
+                scale = AZStd::min(scale, QuantizeScale(m_scale + m_descriptor.m_scaleStep));
+                scale = AZStd::max(scale, m_scale);
+            }
+
+            if (scale == m_scale)
+            {
+                return false;
+            }
+
+            m_scale = scale;
+            m_framesSinceChange = 0;
+            return true;
+        }
+
+        float DynamicResolutionController::GetScale() const
+        {
+            return m_scale;
+        }
+
+        RHI::Size DynamicResolutionController::GetScaledSize(const RHI::Size& size) const
+        {
+            return RHI::Size(
+                AZStd::max(static_cast<uint32_t>(size.m_width * m_scale), 1u),
+                AZStd::max(static_cast<uint32_t>(size.m_height * m_scale), 1u),
+                size.m_depth);
+        }
+
+        float DynamicResolutionController::QuantizeScale(float scale) const
+        {
+            const float step = m_descriptor.m_scaleStep;
+            const float minScale = ceilf(m_descriptor.m_minScale / step - 0.001f) * step;
+            const float maxScale = floorf(m_descriptor.m_maxScale / step + 0.001f) * step;
+            const float quantized = floorf(scale / step + 0.001f) * step;
+            return AZStd::clamp(quantized, AZStd::min(minScale, maxScale), maxScale);
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/GpuQuery/GpuPassProfiler.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+
+#include <Atom/RHI/RHIUtils.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        GpuPassProfiler::GpuPassProfiler()
+        {
+            SetWindowSize(DefaultWindowSize);
+        }
+
+        void GpuPassProfiler::SetEnabled(ParentPass* rootPass, bool enabled, bool collectPipelineStatistics)
+        {
+            collectPipelineStatistics = enabled && collectPipelineStatistics;
+            if (rootPass)
+            {
+                // Only enable the queries that aren't already enabled, so that they are only disabled again by their owner
+                if (enabled && !rootPass->IsTimestampQueryEnabled())
+                {
+                    rootPass->SetTimestampQueryEnabled(true);
+                    m_enabledTimestamps = true;
+                }
+                else if (!enabled && m_enabledTimestamps)
+                {
+                    rootPass->SetTimestampQueryEnabled(false);
+                    m_enabledTimestamps = false;
+                }
+
+                if (collectPipelineStatistics && !rootPass->IsPipelineStatisticsQueryEnabled())
+                {
+                    rootPass->SetPipelineStatisticsQueryEnabled(true);
+                    m_enabledPipelineStatistics = true;
+                }
+                else if (!collectPipelineStatistics && m_enabledPipelineStatistics)
+                {
+                    rootPass->SetPipelineStatisticsQueryEnabled(false);
+                    m_enabledPipelineStatistics = false;
+                }
+            }
+
+            if (m_enabled != enabled || m_collectPipelineStatistics != collectPipelineStatistics)
+            {
+                Reset();
+            }
+            m_enabled = enabled;
+            m_collectPipelineStatistics = collectPipelineStatistics;
+        }
+
+        bool GpuPassProfiler::IsEnabled() const
+        {
+            return m_enabled;
+        }
+
+        void GpuPassProfiler::SetWindowSize(uint32_t frameCount)
+        {
+            frameCount = AZStd::max(frameCount, 1u);
+            if (frameCount != m_frames.size())
+            {
+                m_frames.clear();
+                m_frames.resize(frameCount);
+                Reset();
+            }
+        }
+
+        uint32_t GpuPassProfiler::GetWindowSize() const
+        {
+            return aznumeric_cast<uint32_t>(m_frames.size());
+        }
+
+        void GpuPassProfiler::Update(ParentPass* rootPass)
+        {
+            if (!m_enabled || !rootPass)
+            {
+                return;
+            }
+
+            // Another owner of the queries may have disabled them, in which case the profiler takes them over
+            if (!rootPass->IsTimestampQueryEnabled())
+            {
+                rootPass->SetTimestampQueryEnabled(true);
+                m_enabledTimestamps = true;
+            }
+            if (m_collectPipelineStatistics && !rootPass->IsPipelineStatisticsQueryEnabled())
+            {
+                rootPass->SetPipelineStatisticsQueryEnabled(true);
+                m_enabledPipelineStatistics = true;
+            }
+
+            // The results read this frame were recorded ReadbackLatencyFrames ago, whose CPU time is the oldest one of the ring
+            const AZStd::sys_time_t cpuFrameTicks = m_cpuFrameTicks[m_cpuFrameIndex];
+            m_cpuFrameTicks[m_cpuFrameIndex] = AZStd::GetTimeNowTicks();
+            m_cpuFrameIndex = (m_cpuFrameIndex + 1) % ReadbackLatencyFrames;
+            if (cpuFrameTicks == 0)
+            {
+                return;
+            }
+
+            FrameSample& frame = m_frames[m_nextFrame];
+            frame.m_cpuBeginTicks = cpuFrameTicks;
+            frame.m_passSamples.clear();
+            CollectPass(rootPass, 0, frame);
+
+            m_nextFrame = (m_nextFrame + 1) % aznumeric_cast<uint32_t>(m_frames.size());
+            m_frameCount = AZStd::min(m_frameCount + 1, aznumeric_cast<uint32_t>(m_frames.size()));
+        }
+
+        void GpuPassProfiler::CollectPass(const Pass* pass, uint32_t depth, FrameSample& frame)
+        {
+            if (!pass->IsEnabled() || !pass->IsTimestampQueryEnabled())
+            {
+                return;
+            }
+
+            const TimestampResult timestamp = pass->GetLatestTimestampResult();
+            if (timestamp.GetDurationInTicks() == 0)
+            {
+                // Passes without a result this frame, like the passes that don't record any scope
+                return;
+            }
+
+            PassSample& sample = frame.m_passSamples.emplace_back();
+            sample.m_passIndex = GetPassIndex(pass->GetPathName(), depth);
+            sample.m_timestamp = timestamp;
+            if (m_collectPipelineStatistics && pass->IsPipelineStatisticsQueryEnabled())
+            {
+                sample.m_statistics = pass->GetLatestPipelineStatisticsResult();
+            }
+
+            if (const ParentPass* parentPass = pass->AsParent())
+            {
+                for (const Ptr<Pass>& child : parentPass->GetChildren())
+                {
+                    CollectPass(child.get(), depth + 1, frame);
+                }
+            }
+        }
+
+        uint32_t GpuPassProfiler::GetPassIndex(const Name& passPath, uint32_t depth)
+        {
+            const auto [iter, inserted] = m_passIndices.emplace(passPath, aznumeric_cast<uint32_t>(m_passes.size()));
+            if (inserted)
+            {
+                m_passes.push_back({ passPath, depth });
+            }
+            else
+            {
+                m_passes[iter->second].m_depth = depth;
+            }
+            return iter->second;
+        }
+
+        void GpuPassProfiler::CalculateStats(uint32_t passIndex, PassStats& stats) const
+        {
+            stats = PassStats();
+            stats.m_passPath = m_passes[passIndex].m_passPath;
+            stats.m_depth = m_passes[passIndex].m_depth;
+
+            const uint32_t windowSize = aznumeric_cast<uint32_t>(m_frames.size());
+            double totalMs = 0.0;
+            PipelineStatisticsResult totalStatistics;
+
+            // Walk the frames from the oldest to the latest, so m_latestMs ends up being the latest measure
+            for (uint32_t frameOffset = windowSize - m_frameCount; frameOffset < windowSize; ++frameOffset)
+            {
+                const FrameSample& frame = m_frames[(m_nextFrame + frameOffset) % windowSize];
+                for (const PassSample& sample : frame.m_passSamples)
+                {
+                    if (sample.m_passIndex != passIndex)
+                    {
+                        continue;
+                    }
+
+                    const float sampleMs = static_cast<float>(sample.m_timestamp.GetDurationInNanoseconds()) / 1000000.0f;
+                    stats.m_minMs = (stats.m_frameCount == 0) ? sampleMs : AZStd::min(stats.m_minMs, sampleMs);
+                    stats.m_maxMs = AZStd::max(stats.m_maxMs, sampleMs);
+                    stats.m_latestMs = sampleMs;
+                    stats.m_frameCount++;
+                    totalMs += sampleMs;
+                    totalStatistics += sample.m_statistics;
+                    break;
+                }
+            }
+
+            if (stats.m_frameCount > 0)
+            {
+                const uint64_t frameCount = stats.m_frameCount;
+                stats.m_averageMs = static_cast<float>(totalMs / frameCount);
+                stats.m_averageStatistics.m_vertexCount = totalStatistics.m_vertexCount / frameCount;
+                stats.m_averageStatistics.m_primitiveCount = totalStatistics.m_primitiveCount / frameCount;
+                stats.m_averageStatistics.m_vertexShaderInvocationCount = totalStatistics.m_vertexShaderInvocationCount / frameCount;
+                stats.m_averageStatistics.m_rasterizedPrimitiveCount = totalStatistics.m_rasterizedPrimitiveCount / frameCount;
+                stats.m_averageStatistics.m_renderedPrimitiveCount = totalStatistics.m_renderedPrimitiveCount / frameCount;
+                stats.m_averageStatistics.m_pixelShaderInvocationCount = totalStatistics.m_pixelShaderInvocationCount / frameCount;
+                stats.m_averageStatistics.m_computeShaderInvocationCount = totalStatistics.m_computeShaderInvocationCount / frameCount;
+            }
+        }
+
+        bool GpuPassProfiler::GetPassStats(const Name& passPath, PassStats& stats) const
+        {
+            const auto iter = m_passIndices.find(passPath);
+            if (iter == m_passIndices.end())
+            {
+                return false;
+            }
+
+            CalculateStats(iter->second, stats);
+            return stats.m_frameCount > 0;
+        }
+
+        void GpuPassProfiler::GetAllPassStats(AZStd::vector<PassStats>& outStats) const
+        {
+            outStats.clear();
+            outStats.reserve(m_passes.size());
+            for (uint32_t passIndex = 0; passIndex < m_passes.size(); ++passIndex)
+            {
+                PassStats stats;
+                CalculateStats(passIndex, stats);
+                if (stats.m_frameCount > 0)
+                {
+                    outStats.push_back(AZStd::move(stats));
+                }
+            }
+        }
+
+        float GpuPassProfiler::GetAverageFrameTimeInMs() const
+        {
+            // The root pass is the first pass ever collected
+            if (m_passes.empty())
+            {
+                return 0.0f;
+            }
+
+            PassStats stats;
+            CalculateStats(0, stats);
+            return stats.m_averageMs;
+        }
+
+        bool GpuPassProfiler::WriteChromeTrace(const char* filePath) const
+        {
+            const RHI::Ptr<RHI::Device> device = RHI::GetRHIDevice();
+            if (!device)
+            {
+                return false;
+            }
+
+            const double ticksToMicroseconds = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+            AZStd::string trace = "{\"traceEvents\":[";
+            bool isFirstEvent = true;
+
+            const uint32_t windowSize = aznumeric_cast<uint32_t>(m_frames.size());
+            for (uint32_t frameOffset = windowSize - m_frameCount; frameOffset < windowSize; ++frameOffset)
+            {
+                const FrameSample& frame = m_frames[(m_nextFrame + frameOffset) % windowSize];
+
+                // Each hardware queue has its own clock, so the passes are placed relatively to the first pass of their queue
+                uint64_t queueBeginTicks[RHI::HardwareQueueClassCount];
+                AZStd::fill(AZStd::begin(queueBeginTicks), AZStd::end(queueBeginTicks), AZStd::numeric_limits<uint64_t>::max());
+                for (const PassSample& sample : frame.m_passSamples)
+                {
+                    uint64_t& beginTicks = queueBeginTicks[static_cast<uint32_t>(sample.m_timestamp.GetHardwareQueueClass())];
+                    beginTicks = AZStd::min(beginTicks, sample.m_timestamp.GetTimestampBeginInTicks());
+                }
+
+                const double frameBeginMicroseconds = static_cast<double>(frame.m_cpuBeginTicks) * ticksToMicroseconds;
+                for (const PassSample& sample : frame.m_passSamples)
+                {
+                    const RHI::HardwareQueueClass queueClass = sample.m_timestamp.GetHardwareQueueClass();
+                    const uint64_t offsetTicks =
+                        sample.m_timestamp.GetTimestampBeginInTicks() - queueBeginTicks[static_cast<uint32_t>(queueClass)];
+                    const auto offset = device->GpuTimestampToMicroseconds(offsetTicks, queueClass);
+                    const auto duration = device->GpuTimestampToMicroseconds(sample.m_timestamp.GetDurationInTicks(), queueClass);
+
+                    if (!isFirstEvent)
+                    {
+                        trace += ',';
+                    }
+                    isFirstEvent = false;
+
+                    trace += AZStd::string::format(
+                        "{\"name\":\"%s\",\"cat\":\"GPU\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%lld,\"pid\":1,\"tid\":\"GPU %s\"}",
+                        m_passes[sample.m_passIndex].m_passPath.GetCStr(),
+                        frameBeginMicroseconds + static_cast<double>(offset.count()),
+                        static_cast<long long>(duration.count()),
+                        RHI::GetHardwareQueueClassName(queueClass));
+                }
+            }
+
+            trace += "]}";
+
+            AZ::IO::SystemFile traceFile;
+            if (!traceFile.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Warning("GpuPassProfiler", false, "Failed to open the trace file '%s'", filePath);
+                return false;
+            }
+            const bool written = traceFile.Write(trace.data(), trace.size()) == trace.size();
+            traceFile.Close();
+            return written;
+        }
+
+        void GpuPassProfiler::Reset()
+        {
+            for (FrameSample& frame : m_frames)
+            {
+                frame.m_cpuBeginTicks = 0;
+                frame.m_passSamples.clear();
+            }
+            m_nextFrame = 0;
+            m_frameCount = 0;
+            AZStd::fill(AZStd::begin(m_cpuFrameTicks), AZStd::end(m_cpuFrameTicks), 0);
+            m_cpuFrameIndex = 0;
+        }
+    } // namespace RPI
+} // namespace AZ
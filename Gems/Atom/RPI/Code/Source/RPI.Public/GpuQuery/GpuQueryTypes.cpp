@@ -44,6 +44,11 @@ namespace AZ
             return m_begin;
         }
 
+        RHI::HardwareQueueClass TimestampResult::GetHardwareQueueClass() const
+        {
+            return m_hardwareQueueClass;
+        }
+
         void TimestampResult::Add(const TimestampResult& extent)
         {
             uint64_t end1 = m_begin + m_duration;
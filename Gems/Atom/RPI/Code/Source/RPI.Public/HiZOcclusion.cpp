@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/HiZOcclusion.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        HiZOcclusion::HiZOcclusion(const Matrix4x4& worldToClip, uint32_t width, uint32_t height, AZStd::span<const float> depth)
+            : m_worldToClip(worldToClip)
+        {
+            if (width == 0 || height == 0 || depth.size() < size_t(width) * height)
+            {
+                AZ_Error("HiZOcclusion", false, "The depth data doesn't match the %ux%u size of the first mip", width, height);
+                return;
+            }
+
+            // count the texels of the whole mip chain, down to a single texel
+            size_t texelCount = 0;
+            for (uint32_t mipWidth = width, mipHeight = height;; mipWidth = (mipWidth + 1) / 2, mipHeight = (mipHeight + 1) / 2)
+            {
+                m_mips.push_back({ mipWidth, mipHeight, texelCount });
+                texelCount += size_t(mipWidth) * mipHeight;
+                if (mipWidth == 1 && mipHeight == 1)
+                {
+                    break;
+                }
+            }
+
+            m_depth.reserve(texelCount);
+            m_depth.insert(m_depth.end(), depth.begin(), depth.begin() + size_t(width) * height);
+
+            for (size_t mipIndex = 1; mipIndex < m_mips.size(); ++mipIndex)
+            {
+                const Mip& source = m_mips[mipIndex - 1];
+                const Mip& mip = m_mips[mipIndex];
+                for (uint32_t y = 0; y < mip.m_height; ++y)
+                {
+                    const uint32_t y0 = y * 2;
+                    const uint32_t y1 = AZStd::min(y0 + 1, source.m_height - 1);
+                    for (uint32_t x = 0; x < mip.m_width; ++x)
+                    {
+                        const uint32_t x0 = x * 2;
+                        const uint32_t x1 = AZStd::min(x0 + 1, source.m_width - 1);
+                        m_depth.push_back(AZStd::min(
+                            AZStd::min(GetDepth(source, x0, y0), GetDepth(source, x1, y0)),
+                            AZStd::min(GetDepth(source, x0, y1), GetDepth(source, x1, y1))));
+                    }
+                }
+            }
+        }
+
+        bool HiZOcclusion::IsOccluded(const Aabb& bounds) const
+        {
+            if (m_mips.empty() || !bounds.IsValid())
+            {
+                return false;
+            }
+
+            const Vector3& minBound = bounds.GetMin();
+            const Vector3& maxBound = bounds.GetMax();
+
+            float ndcMinX = FLT_MAX;
+            float ndcMinY = FLT_MAX;
+            float ndcMaxX = -FLT_MAX;
+            float ndcMaxY = -FLT_MAX;
+            float nearestDepth = 0.0f;
+            for (uint32_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+            {
+                const Vector4 corner(
+                    (cornerIndex & 1) ? maxBound.GetX() : minBound.GetX(),
+                    (cornerIndex & 2) ? maxBound.GetY() : minBound.GetY(),
+                    (cornerIndex & 4) ? maxBound.GetZ() : minBound.GetZ(),
+                    1.0f);
+                const Vector4 clip = m_worldToClip * corner;
+                if (clip.GetW() < 0.00000001f)
+                {
+                    // the bounds cross the camera plane
+                    return false;
+                }
+
+                const float invW = 1.0f / clip.GetW();
+                ndcMinX = AZStd::min(ndcMinX, clip.GetX() * invW);
+                ndcMinY = AZStd::min(ndcMinY, clip.GetY() * invW);
+                ndcMaxX = AZStd::max(ndcMaxX, clip.GetX() * invW);
+                ndcMaxY = AZStd::max(ndcMaxY, clip.GetY() * invW);
+                nearestDepth = AZStd::max(nearestDepth, clip.GetZ() * invW);
+            }
+
+            if (ndcMinX < -1.0f || ndcMinY < -1.0f || ndcMaxX > 1.0f || ndcMaxY > 1.0f || nearestDepth >= 1.0f)
+            {
+                return false;
+            }
+
+            // find the covered texels of the first mip, with a one texel margin for the camera jitter and the rounding of the
+            // screen pixels into texels
+            const Mip& firstMip = m_mips.front();
+            const auto toTexel = [](float ndc, uint32_t size, int32_t margin)
+            {
+                const int32_t texel = static_cast<int32_t>((ndc * 0.5f + 0.5f) * size) + margin;
+                return static_cast<uint32_t>(AZStd::clamp(texel, 0, static_cast<int32_t>(size) - 1));
+            };
+            const uint32_t minX = toTexel(ndcMinX, firstMip.m_width, -1);
+            const uint32_t maxX = toTexel(ndcMaxX, firstMip.m_width, 1);
+            // the top row comes first
+            const uint32_t minY = toTexel(-ndcMaxY, firstMip.m_height, -1);
+            const uint32_t maxY = toTexel(-ndcMinY, firstMip.m_height, 1);
+
+            // pick the first mip where the bounds cover at most 2x2 texels
+            uint32_t mipIndex = 0;
+            while (mipIndex + 1 < m_mips.size() && ((maxX >> mipIndex) - (minX >> mipIndex) > 1 || (maxY >> mipIndex) - (minY >> mipIndex) > 1))
+            {
+                ++mipIndex;
+            }
+
+            const Mip& mip = m_mips[mipIndex];
+            float farthestDepth = 1.0f;
+            for (uint32_t y = minY >> mipIndex; y <= (maxY >> mipIndex); ++y)
+            {
+                for (uint32_t x = minX >> mipIndex; x <= (maxX >> mipIndex); ++x)
+                {
+                    farthestDepth = AZStd::min(farthestDepth, GetDepth(mip, x, y));
+                }
+            }
+
+            return nearestDepth < farthestDepth;
+        }
+
+        uint32_t HiZOcclusion::GetMipCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_mips.size());
+        }
+
+        float HiZOcclusion::GetDepth(const Mip& mip, uint32_t x, uint32_t y) const
+        {
+            return m_depth[mip.m_offset + size_t(y) * mip.m_width + x];
+        }
+    } // namespace RPI
+} // namespace AZ
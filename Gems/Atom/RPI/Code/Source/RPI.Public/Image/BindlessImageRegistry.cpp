@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/BindlessImageRegistry.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        uint32_t BindlessImageRegistry::AcquireImage(const Data::Instance<Image>& image)
+        {
+            if (!image)
+            {
+                return FallbackImageIndex;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            auto slotIndexIt = m_slotIndices.find(image.get());
+            if (slotIndexIt != m_slotIndices.end())
+            {
+                ++m_slots[slotIndexIt->second].m_useCount;
+                return slotIndexIt->second;
+            }
+
+            uint32_t slotIndex;
+            if (!m_freeSlots.empty())
+            {
+                slotIndex = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                slotIndex = aznumeric_cast<uint32_t>(m_slots.size());
+                m_slots.emplace_back();
+            }
+
+            m_slots[slotIndex].m_image = image;
+            m_slots[slotIndex].m_useCount = 1;
+            m_slotIndices.emplace(image.get(), slotIndex);
+            return slotIndex;
+        }
+
+        void BindlessImageRegistry::ReleaseImage(uint32_t index)
+        {
+            if (index == FallbackImageIndex)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            if (index >= m_slots.size())
+            {
+                // The registry was reset, when shutting down the image system before the materials
+                return;
+            }
+
+            if (m_slots[index].m_useCount == 0)
+            {
+                AZ_Assert(false, "Bindless image index %u isn't in use", index);
+                return;
+            }
+
+            Slot& slot = m_slots[index];
+            if (--slot.m_useCount == 0)
+            {
+                m_slotIndices.erase(slot.m_image.get());
+                slot.m_image = nullptr;
+                m_freeSlots.push_back(index);
+            }
+        }
+
+        void BindlessImageRegistry::GetImageViews(AZStd::vector<const RHI::ImageView*>& imageViews) const
+        {
+            const Data::Instance<Image>& fallbackImage = ImageSystemInterface::Get()->GetSystemImage(SystemImage::Magenta);
+            const RHI::ImageView* fallbackImageView = fallbackImage ? fallbackImage->GetImageView() : nullptr;
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            imageViews.resize(m_slots.size());
+            for (size_t slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex)
+            {
+                const Data::Instance<Image>& image = m_slots[slotIndex].m_image;
+                const RHI::ImageView* imageView = image ? image->GetImageView() : nullptr;
+                imageViews[slotIndex] = imageView ? imageView : fallbackImageView;
+            }
+        }
+
+        void BindlessImageRegistry::SetMipFeedback(AZStd::span<const uint32_t> mipLevels)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            const size_t slotCount = AZStd::min(mipLevels.size(), m_slots.size());
+            for (size_t slotIndex = FallbackImageIndex + 1; slotIndex < slotCount; ++slotIndex)
+            {
+                if (mipLevels[slotIndex] == NoMipFeedback)
+                {
+                    continue;
+                }
+
+                if (StreamingImage* streamingImage = azrtti_cast<StreamingImage*>(m_slots[slotIndex].m_image.get()))
+                {
+                    streamingImage->SetTargetMip(aznumeric_cast<uint16_t>(AZStd::min<uint32_t>(mipLevels[slotIndex], RHI::Limits::Image::MipCountMax - 1)));
+                }
+            }
+        }
+
+        uint32_t BindlessImageRegistry::GetSlotCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return aznumeric_cast<uint32_t>(m_slots.size());
+        }
+
+        void BindlessImageRegistry::Reset()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            m_slots.clear();
+            m_slots.emplace_back();
+            m_freeSlots.clear();
+            m_slotIndices.clear();
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -9,14 +9,30 @@
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI/StreamingImagePool.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_streamingImageMipFeedback, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to stream the images from the mip levels their shaders sampled, read back from the GPU, instead of streaming all their mips.");
+
+        AZ_CVAR(uint32_t, r_streamingImageMipFeedbackBudgetMB, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The memory budget for the mips streamed from the feedback, in megabytes. 0 uses the budget of the streaming image pool, and a pool without budget never trims its images.");
+
+        AZ_CVAR(uint32_t, r_streamingImageMipFeedbackWaitUpdates, 60, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of controller updates an image waits for its first feedback before streaming all its mips, for the images not sampled through the bindless image array.");
+
+        AZ_CVAR(uint32_t, r_streamingImageMipFeedbackEvictUpdates, 300, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of controller updates without feedback after which an image is the first to be trimmed down to its last mip chain.");
+
         Data::Instance<DefaultStreamingImageController> DefaultStreamingImageController::FindOrCreate(const Data::Asset<DefaultStreamingImageControllerAsset>& asset)
         {
             return azrtti_cast<DefaultStreamingImageController*>(
@@ -52,16 +68,38 @@ namespace AZ
 
         StreamingImageContextPtr DefaultStreamingImageController::CreateContextInternal()
         {
-            StreamingImageContextPtr context = aznew StreamingImageContext();
+            MipFeedbackContext* context = aznew MipFeedbackContext();
+            context->m_attachTimestamp = GetTimestamp();
             m_recentlyAttachedContexts.emplace_back(context);
             return context;
         }
 
         void DefaultStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
         {
-            AZ_UNUSED(timestamp);
-            AZ_UNUSED(contexts);
+            if (r_streamingImageMipFeedback)
+            {
+                m_mipFeedbackEnabled = true;
+                m_recentlyAttachedContexts.clear();
+                UpdateFromMipFeedback(timestamp, contexts);
+                return;
+            }
 
+            if (m_mipFeedbackEnabled)
+            {
+                // Bring back all the mips that the feedback didn't stream in
+                m_mipFeedbackEnabled = false;
+                m_recentlyAttachedContexts.clear();
+                for (const StreamingImageContext& context : contexts)
+                {
+                    m_recentlyAttachedContexts.emplace_back(const_cast<StreamingImageContext*>(&context));
+                }
+            }
+
+            ExpandRecentlyAttachedImages();
+        }
+
+        void DefaultStreamingImageController::ExpandRecentlyAttachedImages()
+        {
             const uint32_t maxExpandsCount = 20;
             uint32_t mipsExpandsPerUpdate = 0;
 
@@ -84,5 +122,104 @@ namespace AZ
                 m_recentlyAttachedContexts.erase(m_recentlyAttachedContexts.begin(), m_recentlyAttachedContexts.begin() + mipsExpandsPerUpdate);
             }
         }
+
+        void DefaultStreamingImageController::UpdateFromMipFeedback(size_t timestamp, const StreamingImageContextList& contexts)
+        {
+            const uint32_t maxExpandsCount = 20;
+
+            const RHI::HeapMemoryUsage& memoryUsage = GetPool()->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
+            const size_t budgetInBytes = r_streamingImageMipFeedbackBudgetMB > 0
+                ? static_cast<size_t>(r_streamingImageMipFeedbackBudgetMB) * 1024 * 1024
+                : memoryUsage.m_budgetInBytes;
+
+            m_expandRequests.clear();
+            m_trimRequests.clear();
+            for (const StreamingImageContext& context : contexts)
+            {
+                StreamingImage* image = context.TryGetImage();
+                if (!image || !image->IsStreamable())
+                {
+                    continue;
+                }
+
+                // The list is const so the contexts can't be added or removed, their own state belongs to the controller
+                MipFeedbackContext& feedbackContext = static_cast<MipFeedbackContext&>(const_cast<StreamingImageContext&>(context));
+                const uint16_t targetMipLevel = context.GetTargetMip();
+                if (targetMipLevel < RHI::Limits::Image::MipCountMax)
+                {
+                    feedbackContext.m_feedbackMipLevel = targetMipLevel;
+                }
+                else if (feedbackContext.m_feedbackMipLevel == RHI::Limits::Image::MipCountMax)
+                {
+                    // Images still without feedback aren't sampled by the shaders writing it, they keep all their mips
+                    if (!feedbackContext.m_expandedWithoutFeedback && timestamp - feedbackContext.m_attachTimestamp >= r_streamingImageMipFeedbackWaitUpdates)
+                    {
+                        QueueExpandToMipChainLevel(image, 0);
+                        feedbackContext.m_expandedWithoutFeedback = true;
+                    }
+                    continue;
+                }
+
+                // Images that weren't sampled for a while only keep their last mip chain
+                size_t mipChainIndex = image->GetMipChainIndex(feedbackContext.m_feedbackMipLevel);
+                if (timestamp - context.GetLastAccessTimestamp() >= r_streamingImageMipFeedbackEvictUpdates)
+                {
+                    mipChainIndex = image->GetMipChainCount() - 1;
+                }
+
+                const size_t streamingMipChainIndex = image->GetStreamingMipChainIndex();
+                if (mipChainIndex < streamingMipChainIndex)
+                {
+                    m_expandRequests.push_back({ image, mipChainIndex, context.GetLastAccessTimestamp() });
+                }
+                else if (mipChainIndex > streamingMipChainIndex)
+                {
+                    m_trimRequests.push_back({ image, mipChainIndex, context.GetLastAccessTimestamp() });
+                }
+            }
+
+            // The extra mips are only trimmed when the pool is over the budget, the least recently sampled images first.
+            // Trimming releases the GPU memory right away, so the resident size is up to date after each one.
+            if (budgetInBytes > 0 && memoryUsage.m_residentInBytes > budgetInBytes)
+            {
+                AZStd::sort(m_trimRequests.begin(), m_trimRequests.end(), [](const MipFeedbackRequest& lhs, const MipFeedbackRequest& rhs)
+                {
+                    return lhs.m_lastAccessTimestamp < rhs.m_lastAccessTimestamp;
+                });
+
+                for (const MipFeedbackRequest& request : m_trimRequests)
+                {
+                    if (memoryUsage.m_residentInBytes <= budgetInBytes)
+                    {
+                        break;
+                    }
+                    TrimToMipChainLevel(request.m_image, request.m_mipChainIndex);
+                }
+            }
+
+            // The most recently sampled images are expanded first, as long as the pool is under the budget and the device
+            // memory isn't under pressure. The streamed mips only become resident a few updates later, so the budget can be
+            // overshot by these.
+            if (IsDeviceMemoryUnderPressure())
+            {
+                return;
+            }
+
+            AZStd::sort(m_expandRequests.begin(), m_expandRequests.end(), [](const MipFeedbackRequest& lhs, const MipFeedbackRequest& rhs)
+            {
+                return lhs.m_lastAccessTimestamp > rhs.m_lastAccessTimestamp;
+            });
+
+            uint32_t expandCount = 0;
+            for (const MipFeedbackRequest& request : m_expandRequests)
+            {
+                if (expandCount >= maxExpandsCount || (budgetInBytes > 0 && memoryUsage.m_residentInBytes >= budgetInBytes))
+                {
+                    break;
+                }
+                QueueExpandToMipChainLevel(request.m_image, request.m_mipChainIndex);
+                ++expandCount;
+            }
+        }
     }
 }
@@ -154,6 +154,7 @@ namespace AZ
             Interface<ImageSystemInterface>::Unregister(this);
 
             m_defaultStreamingImageControllerAsset.Release();
+            m_bindlessImageRegistry.Reset();
             m_systemImages.clear();
             m_systemStreamingPool = nullptr;
             m_systemAttachmentPool = nullptr;
@@ -243,6 +244,11 @@ namespace AZ
             return nullptr;
         }
 
+        BindlessImageRegistry& ImageSystem::GetBindlessImageRegistry()
+        {
+            return m_bindlessImageRegistry;
+        }
+
         void ImageSystem::CreateDefaultResources(const ImageSystemDescriptor& desc)
         {
             struct SystemImageDescriptor
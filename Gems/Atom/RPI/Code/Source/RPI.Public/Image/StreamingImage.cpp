@@ -253,6 +253,22 @@ namespace AZ
             return static_cast<uint16_t>(m_image->GetResidentMipLevel());
         }
 
+        size_t StreamingImage::GetMipChainIndex(uint16_t mipLevel) const
+        {
+            const uint16_t lastMipLevel = static_cast<uint16_t>(m_imageAsset->GetImageDescriptor().m_mipLevels - 1);
+            return m_imageAsset->GetMipChainIndex(AZStd::min(mipLevel, lastMipLevel));
+        }
+
+        size_t StreamingImage::GetStreamingMipChainIndex() const
+        {
+            return m_state.m_streamingTarget;
+        }
+
+        size_t StreamingImage::GetMipChainCount() const
+        {
+            return m_mipChains.size();
+        }
+
         RHI::ResultCode StreamingImage::TrimToMipChainLevel(size_t mipChainIndex)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
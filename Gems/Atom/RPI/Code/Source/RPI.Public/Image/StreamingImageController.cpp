@@ -10,9 +10,13 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI/Device.h>
+#include <Atom/RHI/StreamingImagePool.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(RPI);
 
@@ -28,11 +32,20 @@ namespace AZ
             if (controller)
             {
                 controller->m_pool = &pool;
+                pool.GetDevice().GetResidencyManager().RegisterEvictor(*controller);
             }
 
             return controller;
         }
 
+        StreamingImageController::~StreamingImageController()
+        {
+            if (m_pool)
+            {
+                m_pool->GetDevice().GetResidencyManager().UnregisterEvictor(*this);
+            }
+        }
+
         void StreamingImageController::AttachImage(StreamingImage* image)
         {
             AZ_PROFILE_FUNCTION(RPI);
@@ -173,6 +186,76 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        const RHI::StreamingImagePool* StreamingImageController::GetPool() const
+        {
+            return m_pool;
+        }
+
+        bool StreamingImageController::IsDeviceMemoryUnderPressure() const
+        {
+            return m_pool && m_pool->GetDevice().GetResidencyManager().IsUnderPressure();
+        }
+
+        bool StreamingImageController::GetLeastRecentUseAge(size_t& ageInFrames) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            bool canEvict = false;
+            ageInFrames = 0;
+            for (const StreamingImageContext& context : m_contexts)
+            {
+                const StreamingImage* image = context.TryGetImage();
+                if (image && image->IsStreamable() && image->GetStreamingMipChainIndex() + 1 < image->GetMipChainCount())
+                {
+                    ageInFrames = AZStd::max(ageInFrames, m_timestamp - context.GetLastAccessTimestamp());
+                    canEvict = true;
+                }
+            }
+            return canEvict;
+        }
+
+        size_t StreamingImageController::Evict(size_t sizeInBytes, size_t minAgeInFrames)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            m_evictCandidates.clear();
+            for (const StreamingImageContext& context : m_contexts)
+            {
+                StreamingImage* image = context.TryGetImage();
+                const size_t ageInFrames = m_timestamp - context.GetLastAccessTimestamp();
+                if (image && image->IsStreamable() && image->GetStreamingMipChainIndex() + 1 < image->GetMipChainCount() &&
+                    ageInFrames >= minAgeInFrames)
+                {
+                    m_evictCandidates.push_back({ image, ageInFrames });
+                }
+            }
+
+            AZStd::sort(m_evictCandidates.begin(), m_evictCandidates.end(), [](const EvictCandidate& lhs, const EvictCandidate& rhs)
+            {
+                return lhs.m_ageInFrames > rhs.m_ageInFrames;
+            });
+
+            // Each image drops a single mip chain, the residency manager evicts again while the device is over its budget.
+            // Trimming releases the GPU memory right away, so the resident size is up to date after each one.
+            const RHI::HeapMemoryUsage& memoryUsage = m_pool->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
+            size_t evictedSize = 0;
+            for (const EvictCandidate& candidate : m_evictCandidates)
+            {
+                if (evictedSize >= sizeInBytes)
+                {
+                    break;
+                }
+
+                const size_t residentSizeBefore = memoryUsage.m_residentInBytes;
+                TrimToMipChainLevel(candidate.m_image, candidate.m_image->GetStreamingMipChainIndex() + 1);
+                const size_t residentSizeAfter = memoryUsage.m_residentInBytes;
+                evictedSize += residentSizeBefore > residentSizeAfter ? residentSizeBefore - residentSizeAfter : 0;
+            }
+            return evictedSize;
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
@@ -8,10 +8,13 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Image/BindlessImageRegistry.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
@@ -62,6 +65,9 @@ namespace AZ
 
             m_materialAsset = { &materialAsset, AZ::Data::AssetLoadBehavior::PreLoad };
 
+            // The properties might not be connected to the same shader inputs after a reload.
+            ReleaseBindlessImages();
+
             // Cache off pointers to some key data structures from the material type...
             auto srgLayout = m_materialAsset->GetMaterialSrgLayout();
             if (srgLayout)
@@ -155,6 +161,20 @@ namespace AZ
 
             Compile();
 
+            // Queue the load of the shader variants used by the shader options of the material before anything is drawn with it.
+            // The supervariant selected by the draws isn't known here, so only the default supervariant is loaded.
+            if (ShaderVariantAsyncLoader::IsPrefetchEnabled())
+            {
+                for (const auto& shaderItem : m_shaderCollection)
+                {
+                    Data::Asset<ShaderAsset> shaderAsset = shaderItem.GetShaderAsset();
+                    if (shaderItem.IsEnabled() && shaderAsset.IsReady())
+                    {
+                        shaderAsset->GetVariant(shaderItem.GetShaderVariantId());
+                    }
+                }
+            }
+
             Data::AssetBus::Handler::BusConnect(m_materialAsset.GetId());
             MaterialReloadNotificationBus::Handler::BusConnect(m_materialAsset.GetId());
 
@@ -163,6 +183,7 @@ namespace AZ
 
         Material::~Material()
         {
+            ReleaseBindlessImages();
             ShaderReloadNotificationBus::MultiHandler::BusDisconnect();
             MaterialReloadNotificationBus::Handler::BusDisconnect();
             Data::AssetBus::Handler::BusDisconnect();
@@ -521,6 +542,40 @@ namespace AZ
             return options.SetValue(shaderOptionIndex, ShaderOptionValue{ value });
         }
 
+        void Material::SetBindlessImage(
+            MaterialPropertyIndex propertyIndex, RHI::ShaderInputConstantIndex shaderInputIndex, const Data::Instance<Image>& image)
+        {
+            BindlessImage& bindlessImage = m_bindlessImages[propertyIndex.GetIndex()];
+            if (bindlessImage.m_image != image)
+            {
+                BindlessImageRegistry& registry = ImageSystemInterface::Get()->GetBindlessImageRegistry();
+                const uint32_t previousIndex = bindlessImage.m_index;
+                bindlessImage.m_index = registry.AcquireImage(image);
+                bindlessImage.m_image = image;
+                registry.ReleaseImage(previousIndex);
+            }
+
+            m_shaderResourceGroup->SetConstant(shaderInputIndex, bindlessImage.m_index);
+        }
+
+        void Material::ReleaseBindlessImages()
+        {
+            if (m_bindlessImages.empty())
+            {
+                return;
+            }
+
+            if (ImageSystemInterface* imageSystem = ImageSystemInterface::Get())
+            {
+                BindlessImageRegistry& registry = imageSystem->GetBindlessImageRegistry();
+                for (const auto& bindlessImageIt : m_bindlessImages)
+                {
+                    registry.ReleaseImage(bindlessImageIt.second.m_index);
+                }
+            }
+            m_bindlessImages.clear();
+        }
+
         template<typename Type>
         bool Material::SetPropertyValue(MaterialPropertyIndex index, const Type& value)
         {
@@ -566,6 +621,13 @@ namespace AZ
                         SetShaderConstant(shaderInputIndex, value);
                     }
                 }
+                else if (outputId.m_type == MaterialPropertyOutputType::BindlessImage)
+                {
+                    const Data::Instance<Image>& image = savedPropertyValue.GetValue<Data::Instance<Image>>();
+
+                    RHI::ShaderInputConstantIndex shaderInputIndex(outputId.m_itemIndex.GetIndex());
+                    SetBindlessImage(index, shaderInputIndex, image);
+                }
                 else if (outputId.m_type == MaterialPropertyOutputType::ShaderOption)
                 {
                     ShaderCollection::Item& shaderReference = m_shaderCollection[outputId.m_containerIndex.GetIndex()];
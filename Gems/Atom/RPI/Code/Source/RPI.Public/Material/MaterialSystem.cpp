@@ -16,10 +16,18 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        MaterialSystem* MaterialSystem::Get()
+        {
+            return Interface<MaterialSystem>::Get();
+        }
+
         void MaterialSystem::Reflect(AZ::ReflectContext* context)
         {
             MaterialPropertyValue::Reflect(context);
@@ -46,12 +54,101 @@ namespace AZ
                 return Material::CreateInternal(*(azrtti_cast<MaterialAsset*>(materialAsset)));
             };
             Data::InstanceDatabase<Material>::Create(azrtti_typeid<MaterialAsset>(), handler);
+
+            Interface<MaterialSystem>::Register(this);
         }
 
         void MaterialSystem::Shutdown()
         {
+            Interface<MaterialSystem>::Unregister(this);
+
+            // Release the queued materials before their instance database
+            m_queuedMaterials = {};
+            m_queuedMaterialIndices = {};
+            m_updatingMaterials = {};
+
             Data::InstanceDatabase<Material>::Destroy();
         }
 
+        MaterialSystem::QueuedMaterial& MaterialSystem::FindOrAddQueuedMaterial(const Data::Instance<Material>& material)
+        {
+            auto [it, inserted] = m_queuedMaterialIndices.emplace(material.get(), m_queuedMaterials.size());
+            if (inserted)
+            {
+                m_queuedMaterials.push_back({ material, {} });
+            }
+            return m_queuedMaterials[it->second];
+        }
+
+        void MaterialSystem::QueuePropertyValue(const Data::Instance<Material>& material, MaterialPropertyIndex index, const MaterialPropertyValue& value)
+        {
+            if (!material || !index.IsValid())
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+            AZStd::vector<QueuedPropertyValue>& propertyValues = FindOrAddQueuedMaterial(material).m_propertyValues;
+
+            // Materials only change a few properties at a time, a linear search is cheaper than a map
+            auto it = AZStd::find_if(propertyValues.begin(), propertyValues.end(),
+                [index](const QueuedPropertyValue& propertyValue) { return propertyValue.first == index; });
+            if (it != propertyValues.end())
+            {
+                it->second = value;
+            }
+            else
+            {
+                propertyValues.emplace_back(index, value);
+            }
+        }
+
+        void MaterialSystem::QueueCompile(const Data::Instance<Material>& material)
+        {
+            if (material)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+                FindOrAddQueuedMaterial(material);
+            }
+        }
+
+        void MaterialSystem::Update()
+        {
+            AZ_PROFILE_SCOPE(RPI, "MaterialSystem: Update");
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+                if (m_queuedMaterials.empty())
+                {
+                    return;
+                }
+                m_updatingMaterials.swap(m_queuedMaterials);
+                m_queuedMaterialIndices.clear();
+            }
+
+            for (QueuedMaterial& queuedMaterial : m_updatingMaterials)
+            {
+                Material& material = *queuedMaterial.m_material;
+                for (const QueuedPropertyValue& propertyValue : queuedMaterial.m_propertyValues)
+                {
+                    material.SetPropertyValue(propertyValue.first, propertyValue.second);
+                }
+
+                if (material.NeedsCompile() && !material.Compile())
+                {
+                    // The material was already compiled this frame, compile it with the changes queued for the next one
+                    AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+                    FindOrAddQueuedMaterial(queuedMaterial.m_material);
+                }
+            }
+            m_updatingMaterials.clear();
+        }
+
+        size_t MaterialSystem::GetQueuedMaterialCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+            return m_queuedMaterials.size();
+        }
+
     } // namespace RPI
 } // namespace AZ
@@ -96,6 +96,30 @@ namespace AZ
             return true;
         }
 
+        void MeshDrawPacket::SetIndirectArguments(const RHI::DrawIndirect& indirectArguments)
+        {
+            m_indirectArguments = indirectArguments;
+            m_useIndirectArguments = true;
+        }
+
+        void MeshDrawPacket::ClearIndirectArguments()
+        {
+            m_indirectArguments = {};
+            m_useIndirectArguments = false;
+        }
+
+        void MeshDrawPacket::SetIndexBufferView(const RHI::IndexBufferView& indexBufferView)
+        {
+            m_indexBufferView = indexBufferView;
+            m_useIndexBufferView = true;
+        }
+
+        void MeshDrawPacket::ClearIndexBufferView()
+        {
+            m_indexBufferView = {};
+            m_useIndexBufferView = false;
+        }
+
         bool MeshDrawPacket::Update(const Scene& parentScene, bool forceUpdate /*= false*/)
         {
             // Why we need to check "!m_material->NeedsCompile()"...
@@ -135,8 +159,21 @@ namespace AZ
             RHI::DrawPacketBuilder drawPacketBuilder;
             drawPacketBuilder.Begin(nullptr);
 
-            drawPacketBuilder.SetDrawArguments(mesh.m_drawArguments);
-            drawPacketBuilder.SetIndexBufferView(mesh.m_indexBufferView);
+            if (m_useIndirectArguments)
+            {
+                drawPacketBuilder.SetDrawArguments(RHI::DrawArguments(m_indirectArguments));
+            }
+            else if (m_instanceCount > 0 && mesh.m_drawArguments.m_type == RHI::DrawType::Indexed)
+            {
+                RHI::DrawIndexed drawIndexed = mesh.m_drawArguments.m_indexed;
+                drawIndexed.m_instanceCount = m_instanceCount;
+                drawPacketBuilder.SetDrawArguments(drawIndexed);
+            }
+            else
+            {
+                drawPacketBuilder.SetDrawArguments(mesh.m_drawArguments);
+            }
+            drawPacketBuilder.SetIndexBufferView(m_useIndexBufferView ? m_indexBufferView : mesh.m_indexBufferView);
             drawPacketBuilder.AddShaderResourceGroup(m_objectSrg->GetRHIShaderResourceGroup());
             drawPacketBuilder.AddShaderResourceGroup(m_material->GetRHIShaderResourceGroup());
 
@@ -152,6 +189,8 @@ namespace AZ
 
             m_perDrawSrgs.clear();
 
+            bool isBackFaceCulled = true;
+
             auto appendShader = [&](const ShaderCollection::Item& shaderItem)
             {
                 // Skip the shader item without creating the shader instance
@@ -231,6 +270,7 @@ namespace AZ
                 // This allows materials to customize the render states that the shader uses.
                 const RHI::RenderStates& renderStatesOverlay = *shaderItem.GetRenderStatesOverlay();
                 RHI::MergeStateInto(renderStatesOverlay, pipelineStateDescriptor.m_renderStates);
+                isBackFaceCulled &= (pipelineStateDescriptor.m_renderStates.m_rasterState.m_cullMode == RHI::CullMode::Back);
 
                 streamBufferViewsPerShader.push_back();
                 auto& streamBufferViews = streamBufferViewsPerShader.back();
@@ -335,6 +375,7 @@ namespace AZ
             {
                 m_activeShaders = shaderList;
                 m_materialSrg = m_material->GetRHIShaderResourceGroup();
+                m_isBackFaceCulled = isBackFaceCulled;
                 return true;
             }
             else
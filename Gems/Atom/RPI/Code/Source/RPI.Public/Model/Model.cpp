@@ -7,11 +7,13 @@
  */
 
 #include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelSystem.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 
 #include <Atom/RHI/Factory.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Timer.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/IntersectSegment.h>
@@ -23,6 +25,12 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_modelLodStreaming, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to only create the detailed lods of the models loaded afterwards once the culling selects them, instead of keeping the buffers of every lod on the GPU.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingResidentLodCount, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of least detailed lods of each model that are always resident when r_modelLodStreaming is enabled.");
+
         Data::Instance<Model> Model::FindOrCreate(const Data::Asset<ModelAsset>& modelAsset)
         {
             return Data::InstanceDatabase<Model>::Instance().FindOrCreate(
@@ -52,6 +60,17 @@ namespace AZ
                 Data::InstanceId::CreateFromAssetId(modelAsset.GetId()));
         }
 
+        Model::~Model()
+        {
+            if (m_isLodStreamingEnabled)
+            {
+                if (ModelSystem* modelSystem = ModelSystem::Get())
+                {
+                    modelSystem->RemoveStreamingModel(this);
+                }
+            }
+        }
+
         size_t Model::GetLodCount() const
         {
             return m_lods.size();
@@ -62,6 +81,29 @@ namespace AZ
             return m_lods;
         }
 
+        bool Model::IsLodStreamingEnabled() const
+        {
+            return m_isLodStreamingEnabled;
+        }
+
+        bool Model::IsLodResident(size_t lodIndex) const
+        {
+            return !m_isLodStreamingEnabled || (lodIndex < m_residentLods.size() && m_residentLods[lodIndex]);
+        }
+
+        void Model::RequestLod(size_t lodIndex)
+        {
+            if (m_isLodStreamingEnabled && lodIndex < m_streamedLodCount)
+            {
+                m_requestedLodMask.fetch_or(1u << lodIndex);
+            }
+        }
+
+        void Model::ConnectLodsChangedEvent(LodsChangedEvent::Handler& handler)
+        {
+            handler.Connect(m_lodsChangedEvent);
+        }
+
         Data::Instance<Model> Model::CreateInternal(const Data::Asset<ModelAsset>& modelAsset)
         {
             AZ_PROFILE_SCOPE(RPI, "Model: CreateInternal");
@@ -80,9 +122,16 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RPI, "Model: Init");
 
-            m_lods.resize(modelAsset->GetLodAssets().size());
+            const size_t lodCount = modelAsset->GetLodAssets().size();
+            m_lods.resize(lodCount);
 
-            for (size_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
+            // The least detailed lods are always resident, the other ones are only created once the culling requests them
+            ModelSystem* modelSystem = ModelSystem::Get();
+            const size_t residentLodCount = AZStd::max<size_t>(r_modelLodStreamingResidentLodCount, 1);
+            m_isLodStreamingEnabled = r_modelLodStreaming && modelSystem && lodCount > residentLodCount;
+            m_streamedLodCount = m_isLodStreamingEnabled ? lodCount - residentLodCount : 0;
+
+            for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
             {
                 const Data::Asset<ModelLodAsset>& lodAsset = modelAsset->GetLodAssets()[lodIndex];
 
@@ -92,15 +141,9 @@ namespace AZ
                     return RHI::ResultCode::Fail;
                 }
 
-                Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset, modelAsset);
-                if (lodInstance == nullptr)
-                {
-                    return RHI::ResultCode::Fail;
-                }
-
-                for (const AZ::RPI::ModelLod::Mesh& mesh : lodInstance->GetMeshes())
+                for (const ModelLodAsset::Mesh& mesh : lodAsset->GetMeshes())
                 {
-                    for (const AZ::RPI::ModelLod::StreamBufferInfo& stream : mesh.m_streamInfo)
+                    for (const ModelLodAsset::Mesh::StreamBufferInfo& stream : mesh.GetStreamBufferInfoList())
                     {
                         if (stream.m_semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
                         {
@@ -117,14 +160,90 @@ namespace AZ
                     }
                 }
 
+                if (lodIndex < m_streamedLodCount)
+                {
+                    continue;
+                }
+
+                Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset, modelAsset);
+                if (lodInstance == nullptr)
+                {
+                    return RHI::ResultCode::Fail;
+                }
+
                 m_lods[lodIndex] = AZStd::move(lodInstance);
             }
 
             m_modelAsset = modelAsset;
             m_isUploadPending = true;
+
+            if (m_isLodStreamingEnabled)
+            {
+                m_residentLods = m_lods;
+                for (size_t lodIndex = 0; lodIndex < m_streamedLodCount; ++lodIndex)
+                {
+                    // The buffers can be shared between the meshes of a lod
+                    AZStd::unordered_set<Data::AssetId> bufferAssetIds;
+                    for (const ModelLodAsset::Mesh& mesh : modelAsset->GetLodAssets()[lodIndex]->GetMeshes())
+                    {
+                        const Data::Asset<BufferAsset>& indexBufferAsset = mesh.GetIndexBufferAssetView().GetBufferAsset();
+                        if (indexBufferAsset && bufferAssetIds.insert(indexBufferAsset.GetId()).second)
+                        {
+                            m_lodSizesInBytes[lodIndex] += indexBufferAsset->GetBufferDescriptor().m_byteCount;
+                        }
+                        for (const ModelLodAsset::Mesh::StreamBufferInfo& stream : mesh.GetStreamBufferInfoList())
+                        {
+                            const Data::Asset<BufferAsset>& bufferAsset = stream.m_bufferAssetView.GetBufferAsset();
+                            if (bufferAsset && bufferAssetIds.insert(bufferAsset.GetId()).second)
+                            {
+                                m_lodSizesInBytes[lodIndex] += bufferAsset->GetBufferDescriptor().m_byteCount;
+                            }
+                        }
+                    }
+                }
+                UpdateLodSubstitutes();
+                modelSystem->AddStreamingModel(this);
+            }
+
             return RHI::ResultCode::Success;
         }
 
+        bool Model::StreamInLod(size_t lodIndex)
+        {
+            AZ_PROFILE_SCOPE(RPI, "Model: StreamInLod");
+
+            Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(m_modelAsset->GetLodAssets()[lodIndex], m_modelAsset);
+            if (!lodInstance)
+            {
+                return false;
+            }
+
+            m_residentLods[lodIndex] = AZStd::move(lodInstance);
+            m_isUploadPending = true;
+            UpdateLodSubstitutes();
+            return true;
+        }
+
+        void Model::EvictLod(size_t lodIndex)
+        {
+            m_residentLods[lodIndex] = nullptr;
+            UpdateLodSubstitutes();
+        }
+
+        void Model::UpdateLodSubstitutes()
+        {
+            // The least detailed lod is always resident
+            Data::Instance<ModelLod> substitute = m_residentLods.back();
+            for (size_t lodIndex = m_residentLods.size(); lodIndex-- > 0;)
+            {
+                if (m_residentLods[lodIndex])
+                {
+                    substitute = m_residentLods[lodIndex];
+                }
+                m_lods[lodIndex] = substitute;
+            }
+        }
+
         void Model::WaitForUpload()
         {
             if (m_isUploadPending)
@@ -33,6 +33,11 @@ namespace AZ
             return m_meshes;
         }
 
+        const Data::Asset<ModelLodAsset>& ModelLod::GetLodAsset() const
+        {
+            return m_lodAsset;
+        }
+
         Data::Instance<ModelLod> ModelLod::CreateInternal(const Data::Asset<ModelLodAsset>& lodAsset, const AZStd::any* modelAssetAny)
         {
             AZ_Assert(modelAssetAny != nullptr, "Invalid model asset param");
@@ -53,6 +58,8 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(RPI);
 
+            m_lodAsset = lodAsset;
+
             for (const ModelLodAsset::Mesh& mesh : lodAsset->GetMeshes())
             {
                 Mesh meshInstance;
@@ -18,10 +18,29 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_modelLodStreamingBudgetMB, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The GPU memory budget of the streamed model lods, in megabytes. 0 means no budget.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingEvictUpdates, 300, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of updates a streamed model lod stays resident after it was last selected by the culling.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingMaxLodsPerUpdate, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of model lods created in a single update, to spread the buffer uploads over several frames.");
+
+        ModelSystem* ModelSystem::Get()
+        {
+            return Interface<ModelSystem>::Get();
+        }
+
         void ModelSystem::Reflect(AZ::ReflectContext* context)
         {
             ModelLodAsset::Reflect(context);
@@ -56,12 +75,150 @@ namespace AZ
                 return Model::CreateInternal(Data::Asset<ModelAsset>{modelAsset, AZ::Data::AssetLoadBehavior::PreLoad});
             };
             Data::InstanceDatabase<Model>::Create(azrtti_typeid<ModelAsset>(), modelInstanceHandler);
+
+            Interface<ModelSystem>::Register(this);
         }
 
         void ModelSystem::Shutdown()
         {
+            Interface<ModelSystem>::Unregister(this);
+
             Data::InstanceDatabase<Model>::Destroy();
             Data::InstanceDatabase<ModelLod>::Destroy();
         }
+
+        void ModelSystem::Update()
+        {
+            AZ_PROFILE_SCOPE(RPI, "ModelSystem: Update");
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_streamingModelsMutex);
+            if (m_streamingModels.empty())
+            {
+                return;
+            }
+
+            ++m_updateIndex;
+            m_lodsToStreamIn.clear();
+            m_lodsToEvict.clear();
+            m_changedModels.clear();
+
+            for (Model* model : m_streamingModels)
+            {
+                const uint32_t requestedLodMask = model->m_requestedLodMask.exchange(0);
+                for (size_t lodIndex = 0; lodIndex < model->m_streamedLodCount; ++lodIndex)
+                {
+                    if (requestedLodMask & (1u << lodIndex))
+                    {
+                        model->m_lodRequestUpdates[lodIndex] = m_updateIndex;
+                        if (!model->m_residentLods[lodIndex])
+                        {
+                            m_lodsToStreamIn.push_back({ model, lodIndex, m_updateIndex });
+                        }
+                    }
+                    else if (model->m_residentLods[lodIndex])
+                    {
+                        m_lodsToEvict.push_back({ model, lodIndex, model->m_lodRequestUpdates[lodIndex] });
+                    }
+                }
+            }
+
+            const size_t budgetInBytes = static_cast<size_t>(r_modelLodStreamingBudgetMB) * 1024 * 1024;
+            const auto isOverBudget = [this, budgetInBytes](size_t extraSizeInBytes)
+            {
+                return budgetInBytes > 0 && m_streamedLodsSizeInBytes + extraSizeInBytes > budgetInBytes;
+            };
+            const auto addChangedModel = [this](Model* model)
+            {
+                if (AZStd::find(m_changedModels.begin(), m_changedModels.end(), model) == m_changedModels.end())
+                {
+                    m_changedModels.push_back(model);
+                }
+            };
+
+            // The lods unused for long enough are evicted, and then the least recently used ones as long as the budget is
+            // exceeded. The lods requested in this update are never evicted.
+            AZStd::sort(m_lodsToEvict.begin(), m_lodsToEvict.end(), [](const StreamedLod& lhs, const StreamedLod& rhs)
+            {
+                return lhs.m_lastRequestUpdate < rhs.m_lastRequestUpdate;
+            });
+            for (const StreamedLod& lod : m_lodsToEvict)
+            {
+                if (m_updateIndex - lod.m_lastRequestUpdate < r_modelLodStreamingEvictUpdates && !isOverBudget(0))
+                {
+                    break;
+                }
+                lod.m_model->EvictLod(lod.m_lodIndex);
+                m_streamedLodsSizeInBytes -= lod.m_model->m_lodSizesInBytes[lod.m_lodIndex];
+                addChangedModel(lod.m_model);
+            }
+
+            // The least detailed lods are created first, since they are the next substitutes of the more detailed ones
+            AZStd::sort(m_lodsToStreamIn.begin(), m_lodsToStreamIn.end(), [](const StreamedLod& lhs, const StreamedLod& rhs)
+            {
+                return lhs.m_lodIndex > rhs.m_lodIndex;
+            });
+            uint32_t streamedInCount = 0;
+            for (const StreamedLod& lod : m_lodsToStreamIn)
+            {
+                if (streamedInCount >= r_modelLodStreamingMaxLodsPerUpdate)
+                {
+                    break;
+                }
+
+                const size_t lodSizeInBytes = lod.m_model->m_lodSizesInBytes[lod.m_lodIndex];
+                if (isOverBudget(lodSizeInBytes))
+                {
+                    continue;
+                }
+
+                ++streamedInCount;
+                if (lod.m_model->StreamInLod(lod.m_lodIndex))
+                {
+                    m_streamedLodsSizeInBytes += lodSizeInBytes;
+                    addChangedModel(lod.m_model);
+                }
+            }
+
+            // A handler can release a model, which is then cleared from the list
+            for (size_t modelIndex = 0; modelIndex < m_changedModels.size(); ++modelIndex)
+            {
+                if (Model* model = m_changedModels[modelIndex])
+                {
+                    model->m_lodsChangedEvent.Signal();
+                }
+            }
+        }
+
+        void ModelSystem::AddStreamingModel(Model* model)
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_streamingModelsMutex);
+            m_streamingModels.push_back(model);
+        }
+
+        void ModelSystem::RemoveStreamingModel(Model* model)
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_streamingModelsMutex);
+
+            auto modelIt = AZStd::find(m_streamingModels.begin(), m_streamingModels.end(), model);
+            if (modelIt != m_streamingModels.end())
+            {
+                *modelIt = m_streamingModels.back();
+                m_streamingModels.pop_back();
+            }
+            AZStd::replace(m_changedModels.begin(), m_changedModels.end(), model, static_cast<Model*>(nullptr));
+
+            for (size_t lodIndex = 0; lodIndex < model->m_streamedLodCount; ++lodIndex)
+            {
+                if (model->m_residentLods[lodIndex])
+                {
+                    m_streamedLodsSizeInBytes -= model->m_lodSizesInBytes[lodIndex];
+                }
+            }
+        }
+
+        size_t ModelSystem::GetStreamedLodsSizeInBytes() const
+        {
+            return m_streamedLodsSizeInBytes;
+        }
     } // namespace RPI
 } // namespace AZ
@@ -8,6 +8,7 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Console/IConsole.h>
 
 #include <Atom/RHI/CommandList.h>
 #include <Atom/RHI/Factory.h>
@@ -29,6 +30,9 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_asyncComputePasses, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable this cvar to run the compute passes allowing async compute on the compute hardware queue");
+
         ComputePass::~ComputePass()
         {
             ShaderReloadNotificationBus::Handler::BusDisconnect();
@@ -59,7 +63,9 @@ namespace AZ
             }
 
             // Hardware Queue Class
-            if (passData->m_useAsyncCompute)
+            m_useAsyncCompute = passData->m_useAsyncCompute;
+            m_allowAsyncCompute = passData->m_allowAsyncCompute;
+            if (m_useAsyncCompute)
             {
                 m_hardwareQueueClass = RHI::HardwareQueueClass::Compute;
             }
@@ -141,6 +147,12 @@ namespace AZ
         {
             RenderPass::SetupFrameGraphDependencies(frameGraph);
             frameGraph.SetEstimatedItemCount(1);
+
+            // The scope goes back to the graphics queue every frame, so the queue is set again each frame, which also lets
+            // r_asyncComputePasses be toggled at runtime. The frame graph compiler adds the fences between the queues.
+            const bool useAsyncCompute = m_useAsyncCompute || (m_allowAsyncCompute && r_asyncComputePasses);
+            m_hardwareQueueClass = useAsyncCompute ? RHI::HardwareQueueClass::Compute : RHI::HardwareQueueClass::Graphics;
+            frameGraph.SetHardwareQueueClass(m_hardwareQueueClass);
         }
 
         void ComputePass::CompileResources(const RHI::FrameGraphCompileContext& context)
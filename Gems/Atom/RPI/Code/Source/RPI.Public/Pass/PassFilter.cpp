@@ -130,6 +130,11 @@ namespace AZ
             return m_templateName;
         }
 
+        const TypeId& PassFilter::GetPassClass() const
+        {
+            return m_passClassTypeId;
+        }
+
         uint32_t PassFilter::GetEnabledFilterOptions() const
         {
             return m_filterOptions;
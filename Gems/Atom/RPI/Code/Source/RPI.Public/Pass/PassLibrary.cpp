@@ -34,6 +34,8 @@ namespace AZ
         {
             m_isShuttingDown = true;
             m_passNameMapping.clear();
+            m_passes.clear();
+            m_passClassMapping.clear();
             m_templateEntries.clear();
             m_templateMappingAssets.clear();
             Data::AssetBus::MultiHandler::BusDisconnect();
@@ -90,7 +92,7 @@ namespace AZ
             uint32_t filterOptions = passFilter.GetEnabledFilterOptions();
 
             // A lambda function which visits each pass in a pass list, if the pass matches the pass filter, then call the pass function
-            auto visitList = [passFilter, passFunction](const AZStd::vector<Pass*>& passList, uint32_t options) -> PassFilterExecutionFlow
+            auto visitList = [&passFilter, &passFunction](const AZStd::vector<Pass*>& passList, uint32_t options) -> PassFilterExecutionFlow
             {
                 if (passList.size() == 0)
                 {
@@ -150,15 +152,52 @@ namespace AZ
                 return;
             }
 
+            UpdatePassIndices();
+
+            if (filterOptions & PassFilter::FilterOptions::PassClass)
+            {
+                const auto constItr = m_passClassMapping.find(passFilter.GetPassClass());
+                if (constItr == m_passClassMapping.end())
+                {
+                    return;
+                }
+
+                filterOptions &= ~(PassFilter::FilterOptions::PassClass);
+                visitList(constItr->second, filterOptions);
+                return;
+            }
+
             // check againest every passes. This might be slow 
             AZ_PROFILE_SCOPE(RPI, "PassLibrary::ForEachPass");
-            for (auto& namePasses : m_passNameMapping)
+            visitList(m_passes, filterOptions);
+        }
+
+        void PassLibrary::UpdatePassIndices()
+        {
+            if (!m_passIndicesDirty)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_passIndicesMutex);
+            if (!m_passIndicesDirty)
             {
-                if (visitList(namePasses.second, filterOptions) == PassFilterExecutionFlow::StopVisitingPasses)
+                return;
+            }
+
+            // The class of a pass is only known once it's constructed, after the pass registered itself with the library,
+            // so the indices are built when they are queried rather than when passes are added
+            m_passes.clear();
+            m_passClassMapping.clear();
+            for (const auto& namePasses : m_passNameMapping)
+            {
+                for (Pass* pass : namePasses.second)
                 {
-                    return;
+                    m_passes.push_back(pass);
+                    m_passClassMapping[pass->RTTI_GetType()].push_back(pass);
                 }
             }
+            m_passIndicesDirty = false;
         }
 
         // Add Functions...
@@ -175,6 +214,7 @@ namespace AZ
             }
 
             m_passNameMapping[pass->m_name].push_back(pass);
+            m_passIndicesDirty = true;
         }
 
         void PassLibrary::AddCoreTemplates()
@@ -273,6 +313,8 @@ namespace AZ
                 }
             }
 
+            m_passIndicesDirty = true;
+
             // Remove pass from pass name
             AZ_Assert(m_passNameMapping.find(pass->GetName()) != m_passNameMapping.end(),
                 "Pass [%s] is trying to be removed from PassLibrary but was not found in library",
@@ -212,7 +212,10 @@ namespace AZ
         void RasterPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
             RenderPass::SetupFrameGraphDependencies(frameGraph);
-            frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_drawListView.size()));
+
+            // the estimated cost decides how many command lists the scope is recorded into
+            const uint32_t drawListCost = RHI::GetDrawListCost(m_drawListView, m_drawItemCostPrefixSums);
+            frameGraph.SetEstimatedItemCount(drawListCost);
         }
 
         void RasterPass::CompileResources(const RHI::FrameGraphCompileContext& context)
@@ -231,7 +234,8 @@ namespace AZ
         {
             RHI::CommandList* commandList = context.GetCommandList();
 
-            const RHI::DrawListView drawListViewPartition = RHI::GetDrawListPartition(m_drawListView, context.GetCommandListIndex(), context.GetCommandListCount());
+            const RHI::DrawListView drawListViewPartition = RHI::GetDrawListPartition(
+                m_drawListView, m_drawItemCostPrefixSums, context.GetCommandListIndex(), context.GetCommandListCount());
 
             if (!drawListViewPartition.empty())
             {
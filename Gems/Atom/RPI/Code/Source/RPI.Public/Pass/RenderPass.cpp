@@ -12,6 +12,7 @@
 #include <Atom/RHI/FrameGraphBuilder.h>
 #include <Atom/RHI/FrameGraphCompileContext.h>
 #include <Atom/RHI/FrameGraphExecuteContext.h>
+#include <Atom/RHI/RHISystemInterface.h>
 
 #include <Atom/RHI.Reflect/ImageScopeAttachmentDescriptor.h>
 #include <Atom/RPI.Reflect/Pass/RenderPassData.h>
@@ -19,6 +20,7 @@
 #include <Atom/RHI.Reflect/Size.h>
 
 #include <Atom/RPI.Public/GpuQuery/Query.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <Atom/RPI.Public/Pass/PassUtils.h>
 #include <Atom/RPI.Public/Pass/RenderPass.h>
 #include <Atom/RPI.Public/Pass/Specific/ImageAttachmentPreviewPass.h>
@@ -26,10 +28,59 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
 
+#include <AzCore/Console/IConsole.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_mergeRasterPassesAsSubpasses, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Merges consecutive raster passes drawing to the same render targets as subpasses of a single render pass, on the platforms "
+            "supporting subpasses natively. Takes effect when the passes are initialized again.");
+
+        namespace
+        {
+            // Returns the render pass before (offset -1) or after (offset 1) a pass in the children of its parent
+            RenderPass* GetSiblingRenderPass(const Pass& pass, int offset)
+            {
+                const ParentPass* parent = pass.GetParent();
+                if (!parent)
+                {
+                    return nullptr;
+                }
+
+                AZStd::span<const Ptr<Pass>> children = parent->GetChildren();
+                auto findIter = AZStd::find_if(children.begin(), children.end(), [&pass](const Ptr<Pass>& child)
+                {
+                    return child.get() == &pass;
+                });
+                if (findIter == children.end())
+                {
+                    return nullptr;
+                }
+
+                const ptrdiff_t siblingIndex = (findIter - children.begin()) + offset;
+                if (siblingIndex < 0 || siblingIndex >= static_cast<ptrdiff_t>(children.size()))
+                {
+                    return nullptr;
+                }
+                return azrtti_cast<RenderPass*>(children[siblingIndex].get());
+            }
+
+            bool IsRenderAttachmentUsage(RHI::ScopeAttachmentUsage usage)
+            {
+                return usage == RHI::ScopeAttachmentUsage::RenderTarget || usage == RHI::ScopeAttachmentUsage::DepthStencil;
+            }
+
+            bool HasRenderAttachment(AZStd::span<const PassAttachmentBinding> bindings, const PassAttachment* attachment, RHI::ScopeAttachmentUsage usage)
+            {
+                return AZStd::any_of(bindings.begin(), bindings.end(), [=](const PassAttachmentBinding& binding)
+                {
+                    return binding.GetAttachment().get() == attachment && binding.m_scopeAttachmentUsage == usage;
+                });
+            }
+        }
+
         RenderPass::RenderPass(const PassDescriptor& descriptor)
             : Pass(descriptor)
         {
@@ -52,9 +103,32 @@ namespace AZ
 
         RHI::RenderAttachmentConfiguration RenderPass::GetRenderAttachmentConfiguration() const
         {
+            // Passes merged as subpasses share the layout of their render pass, each one using its own subpass of it
+            const RenderPass* firstSubpass = this;
+            uint32_t subpassIndex = 0;
+            while (const RenderPass* previousSubpass = firstSubpass->GetPreviousSubpass())
+            {
+                firstSubpass = previousSubpass;
+                ++subpassIndex;
+            }
+
             RHI::RenderAttachmentLayoutBuilder builder;
+            for (const RenderPass* subpass = firstSubpass; subpass; subpass = subpass->GetNextSubpass())
+            {
+                subpass->AddSubpassAttachmentLayout(builder);
+            }
+
+            RHI::RenderAttachmentLayout layout;
+            [[maybe_unused]] RHI::ResultCode result = builder.End(layout);
+            AZ_Assert(result == RHI::ResultCode::Success, "RenderPass [%s] failed to create render attachment layout", GetPathName().GetCStr());
+            return RHI::RenderAttachmentConfiguration{ layout, subpassIndex };
+        }
+
+        void RenderPass::AddSubpassAttachmentLayout(RHI::RenderAttachmentLayoutBuilder& builder) const
+        {
             auto* pass = builder.AddSubpass();
 
+            // The attachments are named after their id, so that the subpasses of a render pass share them
             for (size_t slotIndex = 0; slotIndex < m_attachmentBindings.size(); ++slotIndex)
             {
                 const PassAttachmentBinding& binding = m_attachmentBindings[slotIndex];
@@ -67,7 +141,7 @@ namespace AZ
                 // Handle the depth-stencil attachment. There should be only one.
                 if (binding.m_scopeAttachmentUsage == RHI::ScopeAttachmentUsage::DepthStencil)
                 {
-                    pass->DepthStencilAttachment(binding.GetAttachment()->m_descriptor.m_image.m_format);
+                    pass->DepthStencilAttachment(binding.GetAttachment()->m_descriptor.m_image.m_format, binding.GetAttachment()->GetAttachmentId());
                     continue;
                 }
 
@@ -80,14 +154,71 @@ namespace AZ
                 if (binding.m_scopeAttachmentUsage == RHI::ScopeAttachmentUsage::RenderTarget)
                 {
                     RHI::Format format = binding.GetAttachment()->m_descriptor.m_image.m_format;
-                    pass->RenderTargetAttachment(format);
+                    pass->RenderTargetAttachment(format, binding.GetAttachment()->GetAttachmentId());
                 }
             }
+        }
 
-            RHI::RenderAttachmentLayout layout;
-            [[maybe_unused]] RHI::ResultCode result = builder.End(layout);
-            AZ_Assert(result == RHI::ResultCode::Success, "RenderPass [%s] failed to create render attachment layout", GetPathName().GetCStr());
-            return RHI::RenderAttachmentConfiguration{ layout, 0 };
+        RenderPass* RenderPass::GetPreviousSubpass() const
+        {
+            RenderPass* previous = m_subpassMergeEnabled ? GetSiblingRenderPass(*this, -1) : nullptr;
+            return previous && CanMergeAsSubpassOf(*previous) ? previous : nullptr;
+        }
+
+        RenderPass* RenderPass::GetNextSubpass() const
+        {
+            RenderPass* next = m_subpassMergeEnabled ? GetSiblingRenderPass(*this, 1) : nullptr;
+            return next && next->CanMergeAsSubpassOf(*this) ? next : nullptr;
+        }
+
+        bool RenderPass::CanMergeAsSubpassOf(const RenderPass& previous) const
+        {
+            if (!m_subpassMergeEnabled || !previous.m_subpassMergeEnabled || m_hardwareQueueClass != previous.m_hardwareQueueClass)
+            {
+                return false;
+            }
+
+            // Every render attachment of this pass must be a render attachment of the previous pass, so that the render pass
+            // keeps the same size and multisample state
+            bool hasRenderAttachment = false;
+            for (const PassAttachmentBinding& binding : m_attachmentBindings)
+            {
+                const PassAttachment* attachment = binding.GetAttachment().get();
+                if (!attachment)
+                {
+                    continue;
+                }
+
+                if (binding.m_scopeAttachmentUsage == RHI::ScopeAttachmentUsage::Resolve)
+                {
+                    return false;
+                }
+
+                if (IsRenderAttachmentUsage(binding.m_scopeAttachmentUsage))
+                {
+                    // The render pass only clears its attachments when it begins
+                    const RHI::AttachmentLoadStoreAction& loadStoreAction = binding.m_unifiedScopeDesc.m_loadStoreAction;
+                    if (loadStoreAction.m_loadAction == RHI::AttachmentLoadAction::Clear ||
+                        loadStoreAction.m_loadActionStencil == RHI::AttachmentLoadAction::Clear ||
+                        !HasRenderAttachment(previous.m_attachmentBindings, attachment, binding.m_scopeAttachmentUsage))
+                    {
+                        return false;
+                    }
+                    hasRenderAttachment = true;
+                    continue;
+                }
+
+                // The render attachments of the render pass can't be read through any other usage while it is active
+                for (const RenderPass* subpass = &previous; subpass; subpass = subpass->GetPreviousSubpass())
+                {
+                    if (HasRenderAttachment(subpass->m_attachmentBindings, attachment, RHI::ScopeAttachmentUsage::RenderTarget) ||
+                        HasRenderAttachment(subpass->m_attachmentBindings, attachment, RHI::ScopeAttachmentUsage::DepthStencil))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return hasRenderAttachment;
         }
 
         RHI::MultisampleState RenderPass::GetMultisampleState() const
@@ -137,6 +268,10 @@ namespace AZ
 
         void RenderPass::InitializeInternal()
         {
+            RHI::Device* device = RHI::RHISystemInterface::Get() ? RHI::RHISystemInterface::Get()->GetDevice() : nullptr;
+            m_subpassMergeEnabled = r_mergeRasterPassesAsSubpasses && IsEnabled() && device &&
+                device->GetFeatures().m_renderTargetSubpassInputSupport == RHI::SubpassInputSupportType::Native;
+
             if (m_shaderResourceGroup != nullptr)
             {
                 Name autoBind = Name("AutoBind");
@@ -245,6 +380,10 @@ namespace AZ
 
         void RenderPass::DeclarePassDependenciesToFrameGraph(RHI::FrameGraphInterface frameGraph) const
         {
+            if (const RenderPass* previousSubpass = GetPreviousSubpass())
+            {
+                frameGraph.ExecuteAfterAsSubpass(previousSubpass->GetScopeId());
+            }
             for (Pass* pass : m_executeAfterPasses)
             {
                 RenderPass* renderPass = azrtti_cast<RenderPass*>(pass);
@@ -554,7 +693,7 @@ namespace AZ
                 const uint32_t TimestampResultQueryCount = 2u;
                 uint64_t timestampResult[TimestampResultQueryCount] = {0};
                 query->GetLatestResult(&timestampResult, sizeof(uint64_t) * TimestampResultQueryCount);
-                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], RHI::HardwareQueueClass::Graphics);
+                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], m_hardwareQueueClass);
             });
 
             ExecuteOnPipelineStatisticsQuery([this](RHI::Ptr<Query> query)
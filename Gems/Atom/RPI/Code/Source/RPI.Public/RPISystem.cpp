@@ -73,6 +73,7 @@ namespace AZ
             RPISystemDescriptor::Reflect(context);
             GpuQuerySystemDescriptor::Reflect(context);
             ShaderMetricsSystem::Reflect(context);
+            PipelineStateWarmupSystem::Reflect(context);
 
             PipelineStatisticsResult::Reflect(context);
         }
@@ -95,6 +96,7 @@ namespace AZ
             m_modelSystem.Init();
             m_shaderSystem.Init();
             m_shaderMetricsSystem.Init();
+            m_pipelineStateWarmupSystem.Init();
             m_passSystem.Init();
             m_featureProcessorFactory.Init();
             m_querySystem.Init(m_descriptor.m_gpuQuerySystemDescriptor);
@@ -127,6 +129,8 @@ namespace AZ
 
             Interface<RPISystemInterface>::Unregister(this);
 
+            // releases the shaders kept by the warmup, while the systems they depend on are still alive
+            m_pipelineStateWarmupSystem.Shutdown();
             m_featureProcessorFactory.Shutdown();
             m_passSystem.Shutdown();
             m_dynamicDraw.Shutdown();
@@ -260,6 +264,9 @@ namespace AZ
 
             // Image system update is using system tick but not game tick so it can stream images in background even game is pausing
             m_imageSystem.Update();
+
+            // Streamed model lods also use the system tick so they keep streaming while the game is paused
+            m_modelSystem.Update();
         }
 
         void RPISystem::SimulationTick()
@@ -298,6 +305,12 @@ namespace AZ
             // Query system update is to increment the frame count
             m_querySystem.Update();
 
+            // Compile the pipeline states of previous sessions before they are needed to draw
+            m_pipelineStateWarmupSystem.Update();
+
+            // Apply the batched material property changes before the feature processors read the material SRGs
+            m_materialSystem.Update();
+
             // Collect draw packets for each scene and prepare RPI system SRGs
             // [GFX TODO] We may parallel scenes' prepare render.
             for (auto& scenePtr : m_scenes)
@@ -399,6 +412,8 @@ namespace AZ
 
             m_passSystem.InitPassTemplates();
 
+            m_pipelineStateWarmupSystem.StartWarmup();
+
             m_systemAssetsInitialized = true;
             AZ_TracePrintf("RPI system", "System assets initialized\n");
         }
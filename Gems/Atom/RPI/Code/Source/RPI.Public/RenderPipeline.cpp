@@ -23,10 +23,49 @@
 
 #include <Atom/RPI.Reflect/System/AnyAsset.h>
 
+#include <AzCore/Console/IConsole.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_dynamicResolution, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Scales the render resolution of the pipelines rendering to a window to keep their GPU frame time under r_dynamicResolutionTargetFrameTimeMs. "
+            "Only affects the attachments sized from the pipeline render settings.");
+        AZ_CVAR(float, r_dynamicResolutionTargetFrameTimeMs, 16.6f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The GPU frame time the dynamic resolution keeps the pipelines under, in milliseconds.");
+        AZ_CVAR(float, r_dynamicResolutionMinScale, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The lowest scale of the width and height of the render resolution picked by the dynamic resolution.");
+        AZ_CVAR(float, r_dynamicResolutionMaxScale, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The highest scale of the width and height of the render resolution picked by the dynamic resolution.");
+
+        AZ_CVAR(bool, r_gpuPassProfiler, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Collects the GPU time of every pass of the render pipelines over a rolling window, see RenderPipeline::GetGpuPassProfiler.");
+        AZ_CVAR(bool, r_gpuPassProfilerPipelineStatistics, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Also collects the pipeline statistics of every pass while r_gpuPassProfiler is enabled.");
+        AZ_CVAR(uint32_t, r_gpuPassProfilerWindowSize, GpuPassProfiler::DefaultWindowSize, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of frames the GPU pass profiler averages the pass times over.");
+
+        namespace
+        {
+            // Set by r_gpuPassProfilerWriteTrace, each pipeline writes its trace on its next frame
+            AZStd::string s_gpuPassProfilerTracePath;
+            uint32_t s_gpuPassProfilerTraceRequest = 0;
+        }
+
+        static void r_gpuPassProfilerWriteTrace(const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (arguments.empty())
+            {
+                AZ_Warning("RenderPipeline", false, "r_gpuPassProfilerWriteTrace expects the path of the trace file to write, which gets suffixed by the render pipeline name");
+                return;
+            }
+            s_gpuPassProfilerTracePath = arguments.front();
+            s_gpuPassProfilerTraceRequest++;
+        }
+        AZ_CONSOLEFREEFUNC(r_gpuPassProfilerWriteTrace, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Writes the frames recorded by the GPU pass profiler of each render pipeline as a Chrome trace, to <path>_<pipeline name>.json");
+
         RenderPipelinePtr RenderPipeline::CreateRenderPipeline(const RenderPipelineDescriptor& desc)
         {
             PassSystemInterface* passSystem = PassSystemInterface::Get();
@@ -394,6 +433,9 @@ namespace AZ
 
             OnPassModified();
 
+            UpdateGpuPassProfiler();
+            UpdateDynamicResolution();
+
             for (auto& viewItr : m_pipelineViewsByTag)
             {
                 PipelineViews& pipelineViews = viewItr.second;
@@ -526,6 +568,105 @@ namespace AZ
             m_activeRenderSettings = m_descriptor.m_renderSettings;
         }
 
+        float RenderPipeline::GetDynamicResolutionScale() const
+        {
+            return m_dynamicResolutionEnabled ? m_dynamicResolutionController.GetScale() : 1.0f;
+        }
+
+        void RenderPipeline::UpdateDynamicResolution()
+        {
+            const bool enable = r_dynamicResolution && m_windowHandle && m_rootPass;
+            if (!enable)
+            {
+                if (m_dynamicResolutionEnabled)
+                {
+                    m_activeRenderSettings.m_size = m_descriptor.m_renderSettings.m_size;
+                    if (m_dynamicResolutionEnabledTimestamps && m_rootPass)
+                    {
+                        m_rootPass->SetTimestampQueryEnabled(false);
+                    }
+                    m_dynamicResolutionEnabledTimestamps = false;
+                    m_dynamicResolutionEnabled = false;
+                }
+                return;
+            }
+
+            // the full size is the size set in the descriptor, or the size of the swap chain when the descriptor doesn't set one
+            RHI::Size fullSize = m_descriptor.m_renderSettings.m_size;
+            if (fullSize.m_width == 0 || fullSize.m_height == 0)
+            {
+                const PipelineGlobalBinding* swapChainBinding = GetPipelineGlobalConnection(Name("SwapChainOutput"));
+                if (!swapChainBinding || !swapChainBinding->m_binding || !swapChainBinding->m_binding->GetAttachment())
+                {
+                    return;
+                }
+                fullSize = swapChainBinding->m_binding->GetAttachment()->m_descriptor.m_image.m_size;
+            }
+
+            DynamicResolutionController::Descriptor descriptor;
+            descriptor.m_targetFrameTimeInMs = r_dynamicResolutionTargetFrameTimeMs;
+            descriptor.m_minScale = r_dynamicResolutionMinScale;
+            descriptor.m_maxScale = r_dynamicResolutionMaxScale;
+            if (!m_dynamicResolutionEnabled ||
+                descriptor.m_targetFrameTimeInMs != m_dynamicResolutionDescriptor.m_targetFrameTimeInMs ||
+                descriptor.m_minScale != m_dynamicResolutionDescriptor.m_minScale ||
+                descriptor.m_maxScale != m_dynamicResolutionDescriptor.m_maxScale)
+            {
+                m_dynamicResolutionDescriptor = descriptor;
+                m_dynamicResolutionController.Init(descriptor);
+            }
+
+            if (!m_dynamicResolutionEnabled)
+            {
+                // the timestamps may already be enabled by a profiler, in which case they are left enabled
+                if (!m_rootPass->IsTimestampQueryEnabled())
+                {
+                    m_rootPass->SetTimestampQueryEnabled(true);
+                    m_dynamicResolutionEnabledTimestamps = true;
+                }
+                m_dynamicResolutionEnabled = true;
+            }
+
+            // the timestamps are read back a few frames late, the controller waits for the new scale to be measured between changes
+            const uint64_t gpuFrameTimeInNanoseconds = m_rootPass->GetLatestTimestampResult().GetDurationInNanoseconds();
+            m_dynamicResolutionController.Update(static_cast<float>(gpuFrameTimeInNanoseconds) / 1000000.0f);
+            m_activeRenderSettings.m_size = m_dynamicResolutionController.GetScaledSize(fullSize);
+        }
+
+        const GpuPassProfiler& RenderPipeline::GetGpuPassProfiler() const
+        {
+            return m_gpuPassProfiler;
+        }
+
+        void RenderPipeline::UpdateGpuPassProfiler()
+        {
+            const bool enable = r_gpuPassProfiler && m_rootPass;
+            if (enable || m_gpuPassProfiler.IsEnabled())
+            {
+                m_gpuPassProfiler.SetEnabled(m_rootPass.get(), enable, r_gpuPassProfilerPipelineStatistics);
+            }
+
+            if (enable)
+            {
+                m_gpuPassProfiler.SetWindowSize(r_gpuPassProfilerWindowSize);
+                m_gpuPassProfiler.Update(m_rootPass.get());
+            }
+
+            if (m_gpuPassProfilerTraceRequest != s_gpuPassProfilerTraceRequest)
+            {
+                m_gpuPassProfilerTraceRequest = s_gpuPassProfilerTraceRequest;
+                const AZStd::string tracePath = AZStd::string::format("%s_%s.json", s_gpuPassProfilerTracePath.c_str(), m_nameId.GetCStr());
+                if (!enable)
+                {
+                    AZ_Warning("RenderPipeline", false, "Enable r_gpuPassProfiler to record the frames written by r_gpuPassProfilerWriteTrace");
+                }
+                else if (m_gpuPassProfiler.WriteChromeTrace(tracePath.c_str()))
+                {
+                    AZ_Printf("RenderPipeline", "Wrote the GPU pass profiler trace to %s\n", tracePath.c_str());
+                }
+            }
+        }
+
         void RenderPipeline::AddToRenderTickOnce()
         {
             m_renderMode = RenderMode::RenderOnce;
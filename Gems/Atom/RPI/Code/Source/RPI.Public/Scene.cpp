@@ -10,6 +10,8 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicDrawSystem.h>
 #include <Atom/RPI.Public/FeatureProcessorFactory.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/Image/BindlessImageRegistry.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Pass/FullscreenTrianglePass.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -46,6 +48,9 @@ namespace AZ
                 
                 // Set value for constants defined in SceneTimeSrg.azsli
                 scene->m_timeInputIndex = scene->m_srg->FindShaderInputConstantIndex(Name{ "m_time" });
+
+                // Set the images defined in Bindless/SceneSrg.azsli
+                scene->m_bindlessImagesInputIndex = scene->m_srg->FindShaderInputImageUnboundedArrayIndex(Name{ "m_bindlessImages" });
             }
 
             scene->m_name = sceneDescriptor.m_nameId;
@@ -525,6 +530,17 @@ namespace AZ
                     m_srg->SetConstant(m_timeInputIndex, m_simulationTime);
                 }
 
+                if (m_bindlessImagesInputIndex.IsValid())
+                {
+                    // Setting the array writes the descriptors of all its images, so only do it when an image was added or removed
+                    ImageSystemInterface::Get()->GetBindlessImageRegistry().GetImageViews(m_bindlessImageViewsScratch);
+                    if (m_bindlessImageViewsScratch != m_bindlessImageViews)
+                    {
+                        m_bindlessImageViews.swap(m_bindlessImageViewsScratch);
+                        m_srg->SetImageViewUnboundedArray(m_bindlessImagesInputIndex, m_bindlessImageViews);
+                    }
+                }
+
                 // signal any handlers to update values for their partial scene srg
                 m_prepareSrgEvent.Signal(m_srg.get());
 
@@ -554,22 +570,54 @@ namespace AZ
 
             // Launch CullingSystem::ProcessCullables() jobs (will run concurrently with FeatureProcessor::Render() jobs if m_parallelOctreeTraversal)
             const bool parallelOctreeTraversal = m_cullingScene->GetDebugContext().m_parallelOctreeTraversal;
+            const bool sharedOctreeTraversal = m_cullingScene->GetDebugContext().m_sharedOctreeTraversal;
             m_cullingScene->BeginCulling(m_renderPacket.m_views);
             static const AZ::TaskDescriptor processCullablesDescriptor{"AZ::RPI::Scene::ProcessCullables", "Graphics"};
             AZ::TaskGraphEvent processCullablesTGEvent;
             AZ::TaskGraph processCullablesTG;
-            if (parallelOctreeTraversal)
+            const size_t viewCount = m_renderPacket.m_views.size();
+            if (sharedOctreeTraversal)
             {
-                for (ViewPtr& viewPtr : m_renderPacket.m_views)
+                // Walk the octree once for all the views, so shadow cascades and cubemap faces don't each repeat the traversal
+                if (parallelOctreeTraversal)
+                {
+                    if (m_processCullablesTaskGraphs.empty())
+                    {
+                        m_processCullablesTaskGraphs.emplace_back(AZStd::make_unique<AZ::TaskGraph>());
+                    }
+
+                    AZ::TaskGraph* viewsTaskGraph = m_processCullablesTaskGraphs[0].get();
+                    processCullablesTG.AddTask(processCullablesDescriptor, [this, viewsTaskGraph, &processCullablesTGEvent]()
+                        {
+                            m_cullingScene->ProcessCullablesTG(*this, m_renderPacket.m_views, *viewsTaskGraph);
+                            if (!viewsTaskGraph->IsEmpty())
+                            {
+                                viewsTaskGraph->Submit(&processCullablesTGEvent);
+                            }
+                        });
+                }
+                else
+                {
+                    m_cullingScene->ProcessCullablesTG(*this, m_renderPacket.m_views, processCullablesTG);
+                }
+            }
+            else if (parallelOctreeTraversal)
+            {
+                while (m_processCullablesTaskGraphs.size() < viewCount)
+                {
+                    m_processCullablesTaskGraphs.emplace_back(AZStd::make_unique<AZ::TaskGraph>());
+                }
+
+                for (size_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
                 {
-                    processCullablesTG.AddTask(processCullablesDescriptor, [this, &viewPtr, &processCullablesTGEvent]()
+                    ViewPtr& viewPtr = m_renderPacket.m_views[viewIndex];
+                    AZ::TaskGraph* viewTaskGraph = m_processCullablesTaskGraphs[viewIndex].get();
+                    processCullablesTG.AddTask(processCullablesDescriptor, [this, &viewPtr, viewTaskGraph, &processCullablesTGEvent]()
                         {
-                            AZ::TaskGraph subTaskGraph;
-                            m_cullingScene->ProcessCullablesTG(*this, *viewPtr, subTaskGraph);
-                            if (!subTaskGraph.IsEmpty())
+                            m_cullingScene->ProcessCullablesTG(*this, *viewPtr, *viewTaskGraph);
+                            if (!viewTaskGraph->IsEmpty())
                             {
-                                subTaskGraph.Detach();
-                                subTaskGraph.Submit(&processCullablesTGEvent);
+                                viewTaskGraph->Submit(&processCullablesTGEvent);
                             }
                         });
                 }
@@ -592,6 +640,16 @@ namespace AZ
             {
                 processCullablesTGEvent.Wait();
             }
+
+            if (parallelOctreeTraversal)
+            {
+                // Release the captured worklists now, the graph storage is kept for the next frame
+                const size_t usedTaskGraphCount = sharedOctreeTraversal ? m_processCullablesTaskGraphs.size() : viewCount;
+                for (size_t viewIndex = 0; viewIndex < usedTaskGraphCount; ++viewIndex)
+                {
+                    m_processCullablesTaskGraphs[viewIndex]->Reset();
+                }
+            }
         }
 
         void Scene::CollectDrawPacketsJobs()
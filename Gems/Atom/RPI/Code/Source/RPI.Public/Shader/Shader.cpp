@@ -13,6 +13,7 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+#include <Atom/RPI.Public/Shader/Warmup/PipelineStateWarmupSystemInterface.h>
 #include <AzCore/Interface/Interface.h>
 
 #include <AzCore/Component/TickBus.h>
@@ -504,9 +505,59 @@ namespace AZ
 
         const RHI::PipelineState* Shader::AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const
         {
+            if (PipelineStateWarmupSystemInterface* warmupSystem = PipelineStateWarmupSystemInterface::Get(); warmupSystem && warmupSystem->IsRecording())
+            {
+                warmupSystem->RecordPipelineState(*m_asset, m_supervariantIndex, FindPipelineStateVariantStableId(descriptor), descriptor);
+            }
+
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor);
         }
 
+        ShaderVariantStableId Shader::FindPipelineStateVariantStableId(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            RHI::ShaderStage shaderStage;
+            const RHI::ShaderStageFunction* shaderStageFunction = nullptr;
+            switch (descriptor.GetType())
+            {
+            case RHI::PipelineStateType::Draw:
+                shaderStage = RHI::ShaderStage::Vertex;
+                shaderStageFunction = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor).m_vertexFunction.get();
+                break;
+            case RHI::PipelineStateType::Dispatch:
+                shaderStage = RHI::ShaderStage::Compute;
+                shaderStageFunction = static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor).m_computeFunction.get();
+                break;
+            default:
+                return {};
+            }
+
+            const auto usesVariant = [shaderStage, shaderStageFunction](const ShaderVariant& shaderVariant)
+            {
+                return shaderVariant.GetShaderVariantAsset() &&
+                    shaderVariant.GetShaderVariantAsset()->GetShaderStageFunction(shaderStage) == shaderStageFunction;
+            };
+
+            if (!shaderStageFunction)
+            {
+                return {};
+            }
+
+            if (usesVariant(m_rootVariant))
+            {
+                return m_rootVariant.GetStableId();
+            }
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            for (const auto& [stableId, shaderVariant] : m_shaderVariants)
+            {
+                if (usesVariant(shaderVariant))
+                {
+                    return stableId;
+                }
+            }
+            return {};
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
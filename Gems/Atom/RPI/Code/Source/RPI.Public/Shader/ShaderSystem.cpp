@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroupPool.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantUsageLog.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
@@ -41,6 +42,8 @@ namespace AZ
             ShaderVariantTreeAsset::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
+            ShaderVariantUsageLogEntry::Reflect(context);
+            ShaderVariantUsageLog::Reflect(context);
         }
 
         ShaderSystemInterface* ShaderSystemInterface::Get()
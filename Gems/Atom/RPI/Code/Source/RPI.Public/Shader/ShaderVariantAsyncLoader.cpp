@@ -9,6 +9,12 @@
 #include <Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/sort.h>
+
+#include <AzFramework/IO/LocalFileIO.h>
 
 #include <Atom/RHI/Factory.h>
 
@@ -16,6 +22,35 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool,
+            r_shaderVariantUsageLogRecord,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Records the shader variants requested while a level is loaded into a usage log of that level, which is written to the user folder when the level is unloaded."
+        );
+
+        AZ_CVAR(bool,
+            r_shaderVariantPrefetch,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Loads the shader variants of the usage log of a level as soon as the level starts loading, and the shader variants of the materials when they are initialized, before they are needed to draw."
+        );
+
+        static AZ::IO::FixedMaxPath GetUsageLogFilePath(const AZStd::string& levelName)
+        {
+            AZ::IO::FixedMaxPath resolvedPath;
+            AZ::IO::LocalFileIO::GetInstance()->ResolvePath(
+                resolvedPath, AZStd::string::format("@user@/Atom/ShaderVariantUsage/%s.json", levelName.c_str()).c_str());
+            return resolvedPath;
+        }
+
+        bool ShaderVariantAsyncLoader::IsPrefetchEnabled()
+        {
+            return r_shaderVariantPrefetch;
+        }
+
         void ShaderVariantAsyncLoader::Init()
         {
             m_isServiceShutdown.store(false);
@@ -29,6 +64,8 @@ namespace AZ
                 {
                     this->ThreadServiceLoop();
                 });
+
+            AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
         }
 
         void ShaderVariantAsyncLoader::ThreadServiceLoop()
@@ -36,6 +73,7 @@ namespace AZ
             AZStd::unordered_set<ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId> newShaderVariantPendingRequests;
             AZStd::unordered_set<Data::AssetId> shaderVariantTreePendingRequests;
             AZStd::unordered_set<Data::AssetId> shaderVariantPendingRequests;
+            AZStd::vector<PrefetchRequest> prefetchPendingRequests;
             while (true)
             {
                 //We'll wait here until there's work to do or this service has been shutdown.
@@ -47,9 +85,11 @@ namespace AZ
                                 !m_newShaderVariantPendingRequests.empty() ||
                                 !m_shaderVariantTreePendingRequests.empty() ||
                                 !m_shaderVariantPendingRequests.empty() ||
+                                !m_prefetchPendingRequests.empty() ||
                                 !newShaderVariantPendingRequests.empty() ||
                                 !shaderVariantTreePendingRequests.empty() ||
-                                !shaderVariantPendingRequests.empty();
+                                !shaderVariantPendingRequests.empty() ||
+                                !prefetchPendingRequests.empty();
                         }
                     );
                 }
@@ -83,6 +123,13 @@ namespace AZ
                             shaderVariantPendingRequests.insert(assetId);
                         });
                     m_shaderVariantPendingRequests.clear();
+
+                    // The prefetch requests are kept in order, a new usage log replaces the requests of the previous one.
+                    if (!m_prefetchPendingRequests.empty())
+                    {
+                        prefetchPendingRequests = AZStd::move(m_prefetchPendingRequests);
+                        m_prefetchPendingRequests.clear();
+                    }
                 }
 
                 // Time to work hard.
@@ -104,6 +151,7 @@ namespace AZ
 
                         // Record the request for metrics.
                         ShaderMetricsSystem::Get()->RequestShaderVariant(tupleItor->m_shaderAsset.Get(),  tupleItor->m_shaderVariantId, searchResult);
+                        RecordShaderVariantUsage(*tupleItor->m_shaderAsset, searchResult.GetStableId(), tupleItor->m_supervariantIndex);
 
                         uint32_t shaderVariantProductSubId = ShaderVariantAsset::MakeAssetProductSubId(
                             RHI::Factory::Get().GetAPIUniqueIndex(), tupleItor->m_supervariantIndex.GetIndex(), searchResult.GetStableId());
@@ -132,6 +180,20 @@ namespace AZ
                     }
                 }
 
+                // The prefetch requests are processed in order, so the loads of the most requested shader variants are queued first.
+                auto prefetchItor = prefetchPendingRequests.begin();
+                while (prefetchItor != prefetchPendingRequests.end())
+                {
+                    if (TryToPrefetchShaderVariantAsset(*prefetchItor, shaderVariantTreePendingRequests, shaderVariantPendingRequests))
+                    {
+                        prefetchItor = prefetchPendingRequests.erase(prefetchItor);
+                    }
+                    else
+                    {
+                        prefetchItor++;
+                    }
+                }
+
                 auto variantItor = shaderVariantPendingRequests.begin();
                 while (variantItor != shaderVariantPendingRequests.end())
                 {
@@ -164,10 +226,27 @@ namespace AZ
             m_workCondition.notify_one();
             m_serviceThread.join();
             Data::AssetBus::MultiHandler::BusDisconnect();
+            AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
+
+            // Keep the usage log of the current level, in case the loader is restarted by Reset().
+            {
+                AZStd::unique_lock<decltype(m_usageLogMutex)> lock(m_usageLogMutex);
+                if (m_usageLogHasRecorded)
+                {
+                    const AZ::IO::FixedMaxPath usageLogFilePath = GetUsageLogFilePath(m_usageLogLevelName);
+                    auto saveResult = AZ::JsonSerializationUtils::SaveObjectToFile<ShaderVariantUsageLog>(&m_usageLog, usageLogFilePath.c_str());
+                    if (!saveResult.IsSuccess())
+                    {
+                        AZ_Error(LogName, false, "Unable to write %s file", usageLogFilePath.c_str());
+                    }
+                    m_usageLogHasRecorded = false;
+                }
+            }
 
             m_newShaderVariantPendingRequests.clear();
             m_shaderVariantTreePendingRequests.clear();
             m_shaderVariantPendingRequests.clear();
+            m_prefetchPendingRequests.clear();
             m_shaderVariantData.clear();
             m_shaderAssetIdToShaderVariantTreeAssetId.clear();
         }
@@ -247,6 +326,7 @@ namespace AZ
 
             // Record the request for metrics.
             ShaderMetricsSystem::Get()->RequestShaderVariant(shaderAsset.Get(), shaderVariantId, searchResult);
+            RecordShaderVariantUsage(*shaderAsset, searchResult.GetStableId(), supervariantIndex);
 
             return GetShaderVariantAsset(shaderVariantTreeAsset.GetId(), searchResult.GetStableId(), supervariantIndex);
         }
@@ -373,6 +453,196 @@ namespace AZ
         }
         ///////////////////////////////////////////////////////////////////////
 
+        ///////////////////////////////////////////////////////////////////////
+        // AzFramework::RootSpawnableNotificationBus::Handler overrides
+        void ShaderVariantAsyncLoader::OnRootSpawnableAssigned(Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+        {
+            // The usage logs are named after the level, which is the name of the root spawnable.
+            AZStd::string levelName(AZ::IO::PathView(rootSpawnable.GetHint()).Stem().Native());
+            if (levelName.empty())
+            {
+                levelName = rootSpawnable.GetId().m_guid.ToString<AZStd::string>(false);
+            }
+
+            SwitchUsageLog(levelName);
+            QueuePrefetchRequests();
+        }
+
+        void ShaderVariantAsyncLoader::OnRootSpawnableReleased([[maybe_unused]] uint32_t generation)
+        {
+            SwitchUsageLog({});
+        }
+        ///////////////////////////////////////////////////////////////////////
+
+        void ShaderVariantAsyncLoader::RecordShaderVariantUsage(
+            const ShaderAsset& shaderAsset, ShaderVariantStableId shaderVariantStableId, SupervariantIndex supervariantIndex)
+        {
+            if (!r_shaderVariantUsageLogRecord || !shaderVariantStableId.IsValid() || shaderVariantStableId == RootShaderVariantStableId)
+            {
+                return;
+            }
+
+            ShaderVariantUsageLogEntry entry;
+            entry.m_shaderId = shaderAsset.GetId();
+            entry.m_supervariantIndex = supervariantIndex.GetIndex();
+            entry.m_shaderVariantStableId = shaderVariantStableId;
+            const HashValue64 hash = entry.GetHash();
+
+            AZStd::unique_lock<decltype(m_usageLogMutex)> lock(m_usageLogMutex);
+            if (m_usageLogLevelName.empty())
+            {
+                return;
+            }
+
+            auto indexIt = m_usageLogEntryIndices.find(hash);
+            if (indexIt != m_usageLogEntryIndices.end())
+            {
+                ++m_usageLog.m_entries[indexIt->second].m_requestCount;
+            }
+            else
+            {
+                entry.m_shaderName = shaderAsset.GetName();
+                entry.m_requestCount = 1;
+                m_usageLogEntryIndices.emplace(hash, m_usageLog.m_entries.size());
+                m_usageLog.m_entries.push_back(AZStd::move(entry));
+            }
+            m_usageLogHasRecorded = true;
+        }
+
+        void ShaderVariantAsyncLoader::SwitchUsageLog(const AZStd::string& levelName)
+        {
+            AZStd::unique_lock<decltype(m_usageLogMutex)> lock(m_usageLogMutex);
+            if (m_usageLogLevelName == levelName)
+            {
+                return;
+            }
+
+            if (m_usageLogHasRecorded)
+            {
+                const AZ::IO::FixedMaxPath usageLogFilePath = GetUsageLogFilePath(m_usageLogLevelName);
+                auto saveResult = AZ::JsonSerializationUtils::SaveObjectToFile<ShaderVariantUsageLog>(&m_usageLog, usageLogFilePath.c_str());
+                if (!saveResult.IsSuccess())
+                {
+                    AZ_Error(LogName, false, "Unable to write %s file", usageLogFilePath.c_str());
+                }
+            }
+
+            m_usageLogLevelName = levelName;
+            m_usageLog.m_entries.clear();
+            m_usageLogEntryIndices.clear();
+            m_usageLogHasRecorded = false;
+
+            if (levelName.empty())
+            {
+                return;
+            }
+
+            const AZ::IO::FixedMaxPath usageLogFilePath = GetUsageLogFilePath(levelName);
+            if (AZ::IO::LocalFileIO::GetInstance()->Exists(usageLogFilePath.c_str()))
+            {
+                auto loadResult = AZ::JsonSerializationUtils::LoadObjectFromFile<ShaderVariantUsageLog>(m_usageLog, usageLogFilePath.c_str());
+                if (!loadResult.IsSuccess())
+                {
+                    AZ_Error(LogName, false, "Unable to read %s file", usageLogFilePath.c_str());
+                    m_usageLog.m_entries.clear();
+                }
+            }
+
+            for (size_t entryIndex = 0; entryIndex < m_usageLog.m_entries.size(); ++entryIndex)
+            {
+                m_usageLogEntryIndices.emplace(m_usageLog.m_entries[entryIndex].GetHash(), entryIndex);
+            }
+        }
+
+        void ShaderVariantAsyncLoader::QueuePrefetchRequests()
+        {
+            if (!r_shaderVariantPrefetch || m_isServiceShutdown.load())
+            {
+                return;
+            }
+
+            AZStd::vector<const ShaderVariantUsageLogEntry*> entries;
+            AZStd::vector<PrefetchRequest> prefetchRequests;
+            {
+                AZStd::unique_lock<decltype(m_usageLogMutex)> lock(m_usageLogMutex);
+                if (m_usageLog.m_entries.empty())
+                {
+                    return;
+                }
+
+                entries.reserve(m_usageLog.m_entries.size());
+                for (const ShaderVariantUsageLogEntry& entry : m_usageLog.m_entries)
+                {
+                    entries.push_back(&entry);
+                }
+                AZStd::stable_sort(entries.begin(), entries.end(),
+                    [](const ShaderVariantUsageLogEntry* lhs, const ShaderVariantUsageLogEntry* rhs)
+                    {
+                        return lhs->m_requestCount > rhs->m_requestCount;
+                    });
+
+                prefetchRequests.reserve(entries.size());
+                for (const ShaderVariantUsageLogEntry* entry : entries)
+                {
+                    prefetchRequests.push_back({ entry->m_shaderId, entry->m_shaderVariantStableId, SupervariantIndex{ entry->m_supervariantIndex } });
+                }
+            }
+
+            {
+                AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                m_prefetchPendingRequests = AZStd::move(prefetchRequests);
+            }
+            m_workCondition.notify_one();
+        }
+
+        bool ShaderVariantAsyncLoader::TryToPrefetchShaderVariantAsset(
+            const PrefetchRequest& prefetchRequest,
+            AZStd::unordered_set<Data::AssetId>& shaderVariantTreePendingRequests,
+            AZStd::unordered_set<Data::AssetId>& shaderVariantPendingRequests)
+        {
+            Data::AssetId shaderVariantTreeAssetId;
+            bool hasShaderVariantCollection = false;
+            {
+                AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                auto assetIdFindIt = m_shaderAssetIdToShaderVariantTreeAssetId.find(prefetchRequest.m_shaderAssetId);
+                if (assetIdFindIt != m_shaderAssetIdToShaderVariantTreeAssetId.end())
+                {
+                    shaderVariantTreeAssetId = assetIdFindIt->second;
+                    hasShaderVariantCollection = m_shaderVariantData.find(shaderVariantTreeAssetId) != m_shaderVariantData.end();
+                }
+            }
+
+            if (!shaderVariantTreeAssetId.IsValid())
+            {
+                if (!ShaderVariantTreeAsset::GetShaderVariantTreeAssetIdFromShaderAssetId(prefetchRequest.m_shaderAssetId).IsValid())
+                {
+                    // The shader doesn't have a shader variant tree anymore, there is nothing to prefetch.
+                    return true;
+                }
+
+                // The variants are loaded once the load of their shader variant tree is queued.
+                shaderVariantTreePendingRequests.insert(prefetchRequest.m_shaderAssetId);
+                return false;
+            }
+
+            if (!hasShaderVariantCollection)
+            {
+                // Wait while the load of the shader variant tree is retried, otherwise it failed to load.
+                return !shaderVariantTreePendingRequests.count(prefetchRequest.m_shaderAssetId);
+            }
+
+            uint32_t shaderVariantProductSubId = ShaderVariantAsset::MakeAssetProductSubId(
+                RHI::Factory::Get().GetAPIUniqueIndex(), prefetchRequest.m_supervariantIndex.GetIndex(),
+                prefetchRequest.m_shaderVariantStableId);
+            Data::AssetId shaderVariantAssetId(shaderVariantTreeAssetId.m_guid, shaderVariantProductSubId);
+            if (!TryToLoadShaderVariantAsset(shaderVariantAssetId))
+            {
+                // The shader variant isn't in the asset database yet, retry with the other pending requests.
+                shaderVariantPendingRequests.insert(shaderVariantAssetId);
+            }
+            return true;
+        }
+
         void ShaderVariantAsyncLoader::OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset)
         {
             // Will be used to address the notification bus.
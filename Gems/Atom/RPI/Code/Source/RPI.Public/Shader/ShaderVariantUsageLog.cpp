@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RPI.Public/Shader/ShaderVariantUsageLog.h>
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void ShaderVariantUsageLogEntry::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderVariantUsageLogEntry>()
+                    ->Version(1)
+                    ->Field("ShaderId", &ShaderVariantUsageLogEntry::m_shaderId)
+                    ->Field("ShaderName", &ShaderVariantUsageLogEntry::m_shaderName)
+                    ->Field("SupervariantIndex", &ShaderVariantUsageLogEntry::m_supervariantIndex)
+                    ->Field("ShaderVariantStableId", &ShaderVariantUsageLogEntry::m_shaderVariantStableId)
+                    ->Field("RequestCount", &ShaderVariantUsageLogEntry::m_requestCount)
+                    ;
+            }
+        }
+
+        HashValue64 ShaderVariantUsageLogEntry::GetHash() const
+        {
+            HashValue64 seed = TypeHash64(m_shaderId.m_guid);
+            seed = TypeHash64(m_shaderId.m_subId, seed);
+            seed = TypeHash64(m_supervariantIndex, seed);
+            return TypeHash64(m_shaderVariantStableId.GetIndex(), seed);
+        }
+
+        void ShaderVariantUsageLog::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderVariantUsageLog>()
+                    ->Version(1)
+                    ->Field("Entries", &ShaderVariantUsageLog::m_entries)
+                    ;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
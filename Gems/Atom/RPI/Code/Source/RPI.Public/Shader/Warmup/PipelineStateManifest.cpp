@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RPI.Public/Shader/Warmup/PipelineStateManifest.h>
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void PipelineStateManifestEntry::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateManifestEntry>()
+                    ->Version(1)
+                    ->Field("ShaderId", &PipelineStateManifestEntry::m_shaderId)
+                    ->Field("ShaderName", &PipelineStateManifestEntry::m_shaderName)
+                    ->Field("SupervariantName", &PipelineStateManifestEntry::m_supervariantName)
+                    ->Field("ShaderVariantStableId", &PipelineStateManifestEntry::m_shaderVariantStableId)
+                    ->Field("InputStreamLayout", &PipelineStateManifestEntry::m_inputStreamLayout)
+                    ->Field("RenderAttachmentConfiguration", &PipelineStateManifestEntry::m_renderAttachmentConfiguration)
+                    ->Field("RenderStates", &PipelineStateManifestEntry::m_renderStates)
+                    ->Field("UseCount", &PipelineStateManifestEntry::m_useCount)
+                    ;
+            }
+        }
+
+        HashValue64 PipelineStateManifestEntry::GetHash() const
+        {
+            HashValue64 seed = TypeHash64(m_shaderId.m_guid);
+            seed = TypeHash64(m_shaderId.m_subId, seed);
+            seed = TypeHash64(m_supervariantName.GetHash(), seed);
+            seed = TypeHash64(m_shaderVariantStableId.GetIndex(), seed);
+            seed = TypeHash64(m_inputStreamLayout.GetHash(), seed);
+            seed = TypeHash64(m_renderAttachmentConfiguration.GetHash(), seed);
+            return m_renderStates.GetHash(seed);
+        }
+
+        void PipelineStateManifest::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateManifest>()
+                    ->Version(1)
+                    ->Field("Entries", &PipelineStateManifest::m_entries)
+                    ;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
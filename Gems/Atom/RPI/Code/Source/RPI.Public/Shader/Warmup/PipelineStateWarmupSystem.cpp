@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/Warmup/PipelineStateWarmupSystem.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+
+#include <Atom/RHI/PipelineStateDescriptor.h>
+
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool,
+            r_pipelineStateManifestRecord,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Records the pipeline states acquired from shaders into the pipeline state manifest, which is written to the user folder on shutdown."
+        );
+
+        AZ_CVAR(bool,
+            r_pipelineStateWarmup,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Compiles the pipeline states of the pipeline state manifest at startup, the most used ones first, before they are needed to draw."
+        );
+
+        AZ_CVAR(float,
+            r_pipelineStateWarmupFrameBudgetMs,
+            8.0f,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "The time spent compiling the pipeline states of the warmup each frame, in milliseconds."
+        );
+
+        // Pipeline states whose shader variant is still not available after this many frames are skipped
+        static constexpr uint32_t MaxPendingFrameCount = 600;
+
+        // Set while the warmup compiles a pipeline state, so compiling it doesn't count as a use
+        static AZ_THREAD_LOCAL bool s_isWarmingUp = false;
+
+        static AZ::IO::FixedMaxPath GetPipelineStateManifestFilePath()
+        {
+            AZ::IO::FixedMaxPath resolvedPath;
+            AZ::IO::LocalFileIO::GetInstance()->ResolvePath(resolvedPath, "@user@/Atom/PipelineStateManifest.json");
+            return resolvedPath;
+        }
+
+        static HashValue64 GetShaderHash(const Data::AssetId& shaderId, const Name& supervariantName)
+        {
+            HashValue64 seed = TypeHash64(shaderId.m_guid);
+            seed = TypeHash64(shaderId.m_subId, seed);
+            return TypeHash64(supervariantName.GetHash(), seed);
+        }
+
+        PipelineStateWarmupSystemInterface* PipelineStateWarmupSystemInterface::Get()
+        {
+            return Interface<PipelineStateWarmupSystemInterface>::Get();
+        }
+
+        void PipelineStateWarmupSystem::Reflect(ReflectContext* context)
+        {
+            PipelineStateManifestEntry::Reflect(context);
+            PipelineStateManifest::Reflect(context);
+        }
+
+        void PipelineStateWarmupSystem::Init()
+        {
+            // Register the system to the interface.
+            Interface<PipelineStateWarmupSystemInterface>::Register(this);
+
+            ReadManifest();
+        }
+
+        void PipelineStateWarmupSystem::Shutdown()
+        {
+            if (m_hasRecorded)
+            {
+                WriteManifest();
+            }
+
+            m_warmupQueue.clear();
+            m_warmupShaders.clear();
+
+            // Unregister the system to the interface.
+            Interface<PipelineStateWarmupSystemInterface>::Unregister(this);
+        }
+
+        void PipelineStateWarmupSystem::ReadManifest()
+        {
+            const AZ::IO::FixedMaxPath manifestFilePath = GetPipelineStateManifestFilePath();
+
+            if (AZ::IO::LocalFileIO::GetInstance()->Exists(manifestFilePath.c_str()))
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_manifestMutex);
+
+                auto loadResult = AZ::JsonSerializationUtils::LoadObjectFromFile<PipelineStateManifest>(m_manifest, manifestFilePath.c_str());
+                if (!loadResult.IsSuccess())
+                {
+                    AZ_Error("PipelineStateWarmup", false, "Unable to read %s file", manifestFilePath.c_str());
+                    m_manifest.m_entries.clear();
+                }
+
+                BuildEntryIndices();
+            }
+        }
+
+        void PipelineStateWarmupSystem::WriteManifest()
+        {
+            const AZ::IO::FixedMaxPath manifestFilePath = GetPipelineStateManifestFilePath();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_manifestMutex);
+
+            auto saveResult = AZ::JsonSerializationUtils::SaveObjectToFile<PipelineStateManifest>(&m_manifest, manifestFilePath.c_str());
+            if (!saveResult.IsSuccess())
+            {
+                AZ_Error("PipelineStateWarmup", false, "Unable to write %s file", manifestFilePath.c_str());
+            }
+        }
+
+        const PipelineStateManifest& PipelineStateWarmupSystem::GetManifest() const
+        {
+            return m_manifest;
+        }
+
+        bool PipelineStateWarmupSystem::IsRecording() const
+        {
+            return r_pipelineStateManifestRecord && !s_isWarmingUp;
+        }
+
+        void PipelineStateWarmupSystem::RecordPipelineState(
+            const ShaderAsset& shaderAsset,
+            SupervariantIndex supervariantIndex,
+            ShaderVariantStableId shaderVariantStableId,
+            const RHI::PipelineStateDescriptor& descriptor)
+        {
+            if (!IsRecording() || !shaderVariantStableId.IsValid())
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "PipelineStateWarmupSystem: RecordPipelineState");
+
+            PipelineStateManifestEntry entry;
+            entry.m_shaderId = shaderAsset.GetId();
+            entry.m_shaderName = shaderAsset.GetName();
+            entry.m_supervariantName = shaderAsset.GetSupervariantName(supervariantIndex);
+            entry.m_shaderVariantStableId = shaderVariantStableId;
+            entry.m_useCount = 1;
+
+            switch (descriptor.GetType())
+            {
+            case RHI::PipelineStateType::Draw:
+            {
+                const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                entry.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                entry.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+                entry.m_renderStates = descriptorForDraw.m_renderStates;
+                break;
+            }
+            case RHI::PipelineStateType::Dispatch:
+                break;
+            default:
+                // ray tracing pipeline states are built from several shaders, which the manifest can't describe
+                return;
+            }
+
+            const HashValue64 hash = entry.GetHash();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_manifestMutex);
+            m_hasRecorded = true;
+
+            auto findIt = m_entryIndices.find(hash);
+            if (findIt != m_entryIndices.end())
+            {
+                m_manifest.m_entries[findIt->second].m_useCount++;
+                return;
+            }
+
+            m_entryIndices.emplace(hash, m_manifest.m_entries.size());
+            m_manifest.m_entries.push_back(AZStd::move(entry));
+        }
+
+        void PipelineStateWarmupSystem::StartWarmup()
+        {
+            if (!r_pipelineStateWarmup)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_manifestMutex);
+
+            m_warmupQueue.clear();
+            m_warmupQueue.reserve(m_manifest.m_entries.size());
+
+            AZStd::unordered_map<Data::AssetId, Data::Asset<ShaderAsset>> shaderAssets;
+            for (const PipelineStateManifestEntry& entry : m_manifest.m_entries)
+            {
+                // queue the shaders to load, the pipeline states are compiled once their shader is ready
+                auto shaderIt = shaderAssets.find(entry.m_shaderId);
+                if (shaderIt == shaderAssets.end())
+                {
+                    shaderIt = shaderAssets.emplace(
+                        entry.m_shaderId,
+                        Data::AssetManager::Instance().GetAsset<ShaderAsset>(entry.m_shaderId, AZ::Data::AssetLoadBehavior::PreLoad)).first;
+                }
+
+                WarmupItem item;
+                item.m_entry = entry;
+                item.m_shaderAsset = shaderIt->second;
+                m_warmupQueue.push_back(AZStd::move(item));
+            }
+
+            AZStd::stable_sort(m_warmupQueue.begin(), m_warmupQueue.end(), [](const WarmupItem& lhs, const WarmupItem& rhs)
+                {
+                    return lhs.m_entry.m_useCount > rhs.m_entry.m_useCount;
+                });
+        }
+
+        bool PipelineStateWarmupSystem::IsWarmingUp() const
+        {
+            return !m_warmupQueue.empty();
+        }
+
+        void PipelineStateWarmupSystem::Update()
+        {
+            if (m_warmupQueue.empty())
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "PipelineStateWarmupSystem: Update");
+
+            const AZStd::sys_time_t startTime = AZStd::GetTimeNowMicroSecond();
+            const AZStd::sys_time_t budget = static_cast<AZStd::sys_time_t>(static_cast<float>(r_pipelineStateWarmupFrameBudgetMs) * 1000.0f);
+
+            // keep the items that are still pending ahead of the ones that weren't processed, so the most used ones stay first
+            AZStd::vector<WarmupItem> remainingItems;
+            size_t itemIndex = 0;
+            for (; itemIndex < m_warmupQueue.size() && AZStd::GetTimeNowMicroSecond() - startTime < budget; ++itemIndex)
+            {
+                WarmupItem& item = m_warmupQueue[itemIndex];
+                if (WarmupPipelineState(item) == WarmupResult::Pending && ++item.m_pendingFrameCount < MaxPendingFrameCount)
+                {
+                    remainingItems.push_back(AZStd::move(item));
+                }
+            }
+
+            remainingItems.insert(
+                remainingItems.end(), AZStd::make_move_iterator(m_warmupQueue.begin() + itemIndex), AZStd::make_move_iterator(m_warmupQueue.end()));
+            m_warmupQueue = AZStd::move(remainingItems);
+
+            if (m_warmupQueue.empty())
+            {
+                AZ_TracePrintf("PipelineStateWarmup", "Pipeline state warmup finished\n");
+            }
+        }
+
+        PipelineStateWarmupSystem::WarmupResult PipelineStateWarmupSystem::WarmupPipelineState(WarmupItem& item)
+        {
+            if (item.m_shaderAsset.IsError())
+            {
+                return WarmupResult::Failed;
+            }
+            if (!item.m_shaderAsset.IsReady())
+            {
+                return WarmupResult::Pending;
+            }
+
+            const PipelineStateManifestEntry& entry = item.m_entry;
+            const HashValue64 shaderHash = GetShaderHash(entry.m_shaderId, entry.m_supervariantName);
+            auto shaderIt = m_warmupShaders.find(shaderHash);
+            if (shaderIt == m_warmupShaders.end())
+            {
+                Data::Instance<Shader> shader = Shader::FindOrCreate(item.m_shaderAsset, entry.m_supervariantName);
+                if (!shader)
+                {
+                    return WarmupResult::Failed;
+                }
+                shaderIt = m_warmupShaders.emplace(shaderHash, AZStd::move(shader)).first;
+            }
+            Shader& shader = *shaderIt->second;
+
+            // the root variant is returned until the requested variant is loaded
+            const ShaderVariant& shaderVariant = shader.GetVariant(entry.m_shaderVariantStableId);
+            if (shaderVariant.GetStableId() != entry.m_shaderVariantStableId)
+            {
+                return WarmupResult::Pending;
+            }
+
+            s_isWarmingUp = true;
+            const RHI::PipelineState* pipelineState = nullptr;
+            switch (shader.GetPipelineStateType())
+            {
+            case RHI::PipelineStateType::Draw:
+            {
+                RHI::PipelineStateDescriptorForDraw descriptor;
+                shaderVariant.ConfigurePipelineState(descriptor);
+                descriptor.m_inputStreamLayout = entry.m_inputStreamLayout;
+                descriptor.m_renderAttachmentConfiguration = entry.m_renderAttachmentConfiguration;
+                descriptor.m_renderStates = entry.m_renderStates;
+                pipelineState = shader.AcquirePipelineState(descriptor);
+                break;
+            }
+            case RHI::PipelineStateType::Dispatch:
+            {
+                RHI::PipelineStateDescriptorForDispatch descriptor;
+                shaderVariant.ConfigurePipelineState(descriptor);
+                pipelineState = shader.AcquirePipelineState(descriptor);
+                break;
+            }
+            default:
+                break;
+            }
+            s_isWarmingUp = false;
+
+            return pipelineState ? WarmupResult::Compiled : WarmupResult::Failed;
+        }
+
+        void PipelineStateWarmupSystem::BuildEntryIndices()
+        {
+            m_entryIndices.clear();
+            for (size_t i = 0; i < m_manifest.m_entries.size(); ++i)
+            {
+                m_entryIndices.emplace(m_manifest.m_entries[i].GetHash(), i);
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
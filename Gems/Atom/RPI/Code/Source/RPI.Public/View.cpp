@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/HiZOcclusion.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Pass/Specific/SwapChainPass.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
@@ -103,6 +104,11 @@ namespace AZ
         {
             // This function is thread safe since DrawListContent has storage per thread for draw item data.
             m_drawListContext.AddDrawPacket(drawPacket, depth);
+
+            if ((m_usageFlags & UsageShadow) && (drawPacket->GetDrawListMask() & m_drawListMask).any())
+            {
+                AddToVisibleObjectsHash(AZStd::hash<const RHI::DrawPacket*>{}(drawPacket));
+            }
         }        
 
         void View::AddDrawPacket(const RHI::DrawPacket* drawPacket, Vector3 worldPosition)
@@ -494,6 +500,21 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "View: ClearMaskedOcclusionBuffer");
             m_maskedOcclusionCulling->ClearBuffer();
 #endif
+            m_visibleObjectsHash = 0;
+        }
+
+        void View::AddToVisibleObjectsHash(size_t objectHash)
+        {
+            if (m_usageFlags & UsageShadow)
+            {
+                // a sum doesn't depend on the order the culling jobs add the objects in
+                m_visibleObjectsHash.fetch_add(objectHash, AZStd::memory_order_relaxed);
+            }
+        }
+
+        size_t View::GetVisibleObjectsHash() const
+        {
+            return m_visibleObjectsHash.load(AZStd::memory_order_relaxed);
         }
 
         MaskedOcclusionCulling* View::GetMaskedOcclusionCulling()
@@ -501,6 +522,18 @@ namespace AZ
             return m_maskedOcclusionCulling;
         }
 
+        void View::SetHiZOcclusion(AZStd::shared_ptr<const HiZOcclusion> hiZOcclusion)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_hiZOcclusionMutex);
+            m_hiZOcclusion = AZStd::move(hiZOcclusion);
+        }
+
+        AZStd::shared_ptr<const HiZOcclusion> View::GetHiZOcclusion() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_hiZOcclusionMutex);
+            return m_hiZOcclusion;
+        }
+
         void View::TryCreateShaderResourceGroup()
         {
             if (!m_shaderResourceGroup)
@@ -373,6 +373,45 @@ namespace AZ
             m_wipMaterialProperty.m_outputConnections.push_back(outputId);
         }
 
+        void MaterialTypeAssetCreator::ConnectMaterialPropertyToBindlessImage(const Name& shaderInputName)
+        {
+            if (!ValidateBeginMaterialProperty())
+            {
+                return;
+            }
+
+            if (!m_materialShaderResourceGroupLayout)
+            {
+                ReportError("Material property '%s': Could not map this property to shader input '%s' because there is no material ShaderResourceGroup.",
+                    m_wipMaterialProperty.GetName().GetCStr(), shaderInputName.GetCStr());
+                return;
+            }
+
+            if (m_wipMaterialProperty.GetDataType() != MaterialPropertyDataType::Image)
+            {
+                ReportError("Material property '%s': Only image properties can be mapped to a bindless image index.", m_wipMaterialProperty.GetName().GetCStr());
+                return;
+            }
+
+            const RHI::ShaderInputConstantIndex constantIndex = m_materialShaderResourceGroupLayout->FindShaderInputConstantIndex(shaderInputName);
+            if (!constantIndex.IsValid())
+            {
+                ReportError("Material property '%s': Could not find shader constant input '%s'.", m_wipMaterialProperty.GetName().GetCStr(), shaderInputName.GetCStr());
+                return;
+            }
+
+            if (m_materialShaderResourceGroupLayout->GetShaderInput(constantIndex).m_constantByteCount != sizeof(uint32_t))
+            {
+                ReportError("Material property '%s': Shader constant input '%s' must be a uint to hold a bindless image index.", m_wipMaterialProperty.GetName().GetCStr(), shaderInputName.GetCStr());
+                return;
+            }
+
+            MaterialPropertyOutputId outputId;
+            outputId.m_type = MaterialPropertyOutputType::BindlessImage;
+            outputId.m_itemIndex = RHI::Handle<uint32_t>{constantIndex.GetIndex()};
+            m_wipMaterialProperty.m_outputConnections.push_back(outputId);
+        }
+
         void MaterialTypeAssetCreator::ConnectMaterialPropertyToShaderOption(const Name& shaderOptionName, uint32_t shaderIndex)
         {
             if (!ValidateBeginMaterialProperty())
@@ -37,16 +37,34 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
                 serializeContext->Class<ModelLodAsset::Mesh>()
-                    ->Version(1)
+                    ->Version(2) // added the meshlets
                     ->Field("Name", &ModelLodAsset::Mesh::m_name)
                     ->Field("AABB", &ModelLodAsset::Mesh::m_aabb)
                     ->Field("MaterialSlotId", &ModelLodAsset::Mesh::m_materialSlotId)
                     ->Field("IndexBufferAssetView", &ModelLodAsset::Mesh::m_indexBufferAssetView)
                     ->Field("StreamBufferInfo", &ModelLodAsset::Mesh::m_streamBufferInfo)
+                    ->Field("Meshlets", &ModelLodAsset::Mesh::m_meshlets)
                     ;
             }
 
             StreamBufferInfo::Reflect(context);
+            Meshlet::Reflect(context);
+        }
+
+        void ModelLodAsset::Mesh::Meshlet::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<ModelLodAsset::Mesh::Meshlet>()
+                    ->Version(0)
+                    ->Field("IndexOffset", &ModelLodAsset::Mesh::Meshlet::m_indexOffset)
+                    ->Field("IndexCount", &ModelLodAsset::Mesh::Meshlet::m_indexCount)
+                    ->Field("BoundsCenter", &ModelLodAsset::Mesh::Meshlet::m_boundsCenter)
+                    ->Field("BoundsRadius", &ModelLodAsset::Mesh::Meshlet::m_boundsRadius)
+                    ->Field("ConeAxis", &ModelLodAsset::Mesh::Meshlet::m_coneAxis)
+                    ->Field("ConeCutoff", &ModelLodAsset::Mesh::Meshlet::m_coneCutoff)
+                    ;
+            }
         }
 
         void ModelLodAsset::Mesh::StreamBufferInfo::Reflect(AZ::ReflectContext* context)
@@ -95,6 +113,11 @@ namespace AZ
             return m_indexBufferAssetView;
         }
 
+        AZStd::span<const ModelLodAsset::Mesh::Meshlet> ModelLodAsset::Mesh::GetMeshlets() const
+        {
+            return AZStd::span<const ModelLodAsset::Mesh::Meshlet>(m_meshlets);
+        }
+
         AZStd::span<const ModelLodAsset::Mesh::StreamBufferInfo> ModelLodAsset::Mesh::GetStreamBufferInfoList() const
         {
             return AZStd::span<const ModelLodAsset::Mesh::StreamBufferInfo>(m_streamBufferInfo);
@@ -87,6 +87,14 @@ namespace AZ
             m_currentMesh.m_indexBufferAssetView = AZStd::move(bufferAssetView);
         }
 
+        void ModelLodAssetCreator::SetMeshMeshlets(AZStd::vector<ModelLodAsset::Mesh::Meshlet>&& meshlets)
+        {
+            if (ValidateIsMeshReady())
+            {
+                m_currentMesh.m_meshlets = AZStd::move(meshlets);
+            }
+        }
+
         bool ModelLodAssetCreator::AddMeshStreamBuffer(
             const RHI::ShaderSemantic& streamSemantic,
             const AZ::Name& customName,
@@ -238,6 +246,15 @@ namespace AZ
                 }
             }
 
+            for (const ModelLodAsset::Mesh::Meshlet& meshlet : mesh.m_meshlets)
+            {
+                if (meshlet.m_indexCount == 0 || meshlet.m_indexOffset + meshlet.m_indexCount > mesh.GetIndexCount())
+                {
+                    ReportError("Mesh has a meshlet outside of its indices");
+                    return false;
+                }
+            }
+
             return true;
         }
 
@@ -298,6 +315,8 @@ namespace AZ
                 BufferAssetView indexBufferAssetView(clonedIndexBufferAsset, sourceIndexBufferView.GetBufferViewDescriptor());
                 creator.SetMeshIndexBuffer(indexBufferAssetView);
 
+                // The meshlets aren't cloned, the clones are deformed at runtime so their meshlet bounds would be wrong
+
                 // Mesh stream buffer views
                 for (const AZ::RPI::ModelLodAsset::Mesh::StreamBufferInfo& streamBufferInfo : sourceMesh.GetStreamBufferInfoList())
                 {
@@ -169,6 +169,17 @@ namespace AZ
             return supervariantIndex;
         }
 
+        const Name& ShaderAsset::GetSupervariantName(SupervariantIndex supervariantIndex) const
+        {
+            static const Name EmptyName;
+            const auto& supervariants = GetCurrentShaderApiData().m_supervariants;
+            if (!supervariantIndex.IsValid() || supervariantIndex.GetIndex() >= supervariants.size())
+            {
+                return EmptyName;
+            }
+            return supervariants[supervariantIndex.GetIndex()].m_name;
+        }
+
         Data::Asset<ShaderVariantAsset> ShaderAsset::GetVariant(
             const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex)
         {
@@ -14,6 +14,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
@@ -336,6 +337,36 @@ namespace UnitTest
         EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 0.0f);
     }
 
+    TEST_F(MaterialTests, TestQueuedPropertyValuesAreCoalesced)
+    {
+        Data::Instance<Material> material = Material::FindOrCreate(m_testMaterialAsset);
+        const MaterialPropertyIndex floatIndex = material->FindPropertyIndex(Name{ "MyFloat" });
+
+        MaterialSystem* materialSystem = MaterialSystem::Get();
+        ASSERT_NE(materialSystem, nullptr);
+
+        materialSystem->QueuePropertyValue(material, floatIndex, 2.0f);
+        materialSystem->QueuePropertyValue(material, floatIndex, 2.5f);
+        EXPECT_EQ(materialSystem->GetQueuedMaterialCount(), 1);
+        EXPECT_EQ(material->GetPropertyValue<float>(floatIndex), 1.5f);
+
+        // The material SRG was compiled on creation and can't be compiled again until it's processed,
+        // the value is applied but the compile waits for the next update
+        materialSystem->Update();
+        EXPECT_EQ(material->GetPropertyValue<float>(floatIndex), 2.5f);
+        EXPECT_TRUE(material->NeedsCompile());
+        EXPECT_EQ(materialSystem->GetQueuedMaterialCount(), 1);
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        materialSystem->Update();
+        EXPECT_FALSE(material->NeedsCompile());
+        EXPECT_EQ(materialSystem->GetQueuedMaterialCount(), 0);
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        const RHI::ShaderResourceGroupData& srgData = material->GetRHIShaderResourceGroup()->GetData();
+        EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 2.5f);
+    }
+
     TEST_F(MaterialTests, TestImageNotProvided)
     {
         Data::Asset<MaterialAsset> materialAssetWithEmptyImage;
@@ -799,6 +799,41 @@ namespace UnitTest
         EXPECT_EQ(1, creator.GetErrorCount());
     }
 
+    TEST_F(MaterialTypeAssetTests, ImageMappedToBindlessImage)
+    {
+        Data::Asset<MaterialTypeAsset> materialTypeAsset;
+
+        MaterialTypeAssetCreator creator;
+        creator.Begin(Uuid::CreateRandom());
+        creator.AddShader(m_testShaderAsset);
+
+        creator.BeginMaterialProperty(Name{ "MyImage" }, MaterialPropertyDataType::Image);
+        creator.ConnectMaterialPropertyToBindlessImage(Name{ "m_uint" });
+        creator.EndMaterialProperty();
+
+        EXPECT_TRUE(creator.End(materialTypeAsset));
+
+        const MaterialPropertyDescriptor* imageDescriptor = materialTypeAsset->GetMaterialPropertiesLayout()->GetPropertyDescriptor(MaterialPropertyIndex{ 0 });
+        EXPECT_EQ(1, imageDescriptor->GetOutputConnections().size());
+        EXPECT_EQ(MaterialPropertyOutputType::BindlessImage, imageDescriptor->GetOutputConnections()[0].m_type);
+        EXPECT_EQ(m_testMaterialSrgLayout->FindShaderInputConstantIndex(Name{ "m_uint" }).GetIndex(), imageDescriptor->GetOutputConnections()[0].m_itemIndex.GetIndex());
+    }
+
+    TEST_F(MaterialTypeAssetTests, Error_BindlessImageMappedToWrongConstantSize)
+    {
+        MaterialTypeAssetCreator creator;
+        creator.Begin(Uuid::CreateRandom());
+        creator.AddShader(m_testShaderAsset);
+
+        creator.BeginMaterialProperty(Name{ "MyImage" }, MaterialPropertyDataType::Image);
+
+        AZ_TEST_START_ASSERTTEST;
+        creator.ConnectMaterialPropertyToBindlessImage(Name{ "m_float2" });
+        AZ_TEST_STOP_ASSERTTEST(1);
+
+        EXPECT_EQ(1, creator.GetErrorCount());
+    }
+
     TEST_F(MaterialTypeAssetTests, Error_StandardPropertyMappedToImage)
     {
         MaterialTypeAssetCreator creator;
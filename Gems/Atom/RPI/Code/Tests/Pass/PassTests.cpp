@@ -737,4 +737,36 @@ namespace UnitTest
         EXPECT_TRUE(count == 1);
 
     }
+
+    TEST_F(PassTests, ForEachPass_PassClassFilter_Success)
+    {
+        m_data->AddPassTemplatesToLibrary();
+
+        // create a pass tree
+        Ptr<Pass> pass = m_passSystem->CreatePassFromClass(Name("Pass"), Name("pass1"));
+        Ptr<Pass> parent1 = m_passSystem->CreatePassFromTemplate(Name("ParentPass"), Name("parent1"));
+        parent1->AsParent()->AddChild(pass);
+
+        PassFilter filter = PassFilter::CreateWithPassClass<Pass>();
+        const auto countPasses = [this, &filter]()
+        {
+            int count = 0;
+            m_passSystem->ForEachPass(filter, [&count](RPI::Pass* pass) -> PassFilterExecutionFlow
+                {
+                    EXPECT_TRUE(pass->RTTI_GetType() == Pass::RTTI_Type());
+                    count++;
+                    return PassFilterExecutionFlow::ContinueVisitingPasses;
+                });
+            return count;
+        };
+
+        EXPECT_EQ(countPasses(), 1);
+
+        // passes added or removed after a query are found by the next one
+        Ptr<Pass> pass2 = m_passSystem->CreatePassFromClass(Name("Pass"), Name("pass2"));
+        EXPECT_EQ(countPasses(), 2);
+
+        pass2 = nullptr;
+        EXPECT_EQ(countPasses(), 1);
+    }
 }
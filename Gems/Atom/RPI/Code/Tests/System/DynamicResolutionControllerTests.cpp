@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Atom/RPI.Public/DynamicResolutionController.h>
+
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class DynamicResolutionControllerTests
+        : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            DynamicResolutionController::Descriptor descriptor;
+            descriptor.m_targetFrameTimeInMs = 10.0f;
+            descriptor.m_minScale = 0.5f;
+            descriptor.m_maxScale = 1.0f;
+            descriptor.m_scaleStep = 0.05f;
+            descriptor.m_framesBetweenChanges = 4;
+            m_controller.Init(descriptor);
+        }
+
+        //! Feeds the same frame time for a number of frames and returns the number of scale changes
+        uint32_t UpdateFrames(float frameTimeInMs, uint32_t frameCount)
+        {
+            uint32_t changeCount = 0;
+            for (uint32_t frame = 0; frame < frameCount; ++frame)
+            {
+                changeCount += m_controller.Update(frameTimeInMs) ? 1 : 0;
+            }
+            return changeCount;
+        }
+
+        DynamicResolutionController m_controller;
+    };
+
+    TEST_F(DynamicResolutionControllerTests, Init_StartsAtMaxScale)
+    {
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 1.0f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_UnderTarget_KeepsMaxScale)
+    {
+        EXPECT_EQ(UpdateFrames(5.0f, 100), 0u);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 1.0f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_OverTarget_LowersScaleDownToMinScale)
+    {
+        UpdateFrames(15.0f, 4);
+        EXPECT_LT(m_controller.GetScale(), 1.0f);
+
+        UpdateFrames(100.0f, 100);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 0.5f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_ChangesAtMostOnceEveryFewFrames)
+    {
+        EXPECT_LE(UpdateFrames(100.0f, 16), 4u);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_WithinHeadroom_KeepsScale)
+    {
+        UpdateFrames(100.0f, 100);
+        EXPECT_EQ(UpdateFrames(9.5f, 100), 0u);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 0.5f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, Update_BackUnderTarget_RaisesScaleOneStepAtATime)
+    {
+        UpdateFrames(100.0f, 100);
+        UpdateFrames(2.0f, 4);
+        EXPECT_NEAR(m_controller.GetScale(), 0.55f, 0.001f);
+
+        UpdateFrames(2.0f, 100);
+        EXPECT_FLOAT_EQ(m_controller.GetScale(), 1.0f);
+    }
+
+    TEST_F(DynamicResolutionControllerTests, GetScaledSize_ScalesWidthAndHeight)
+    {
+        UpdateFrames(100.0f, 100);
+        const RHI::Size size = m_controller.GetScaledSize(RHI::Size(1920, 1080, 1));
+        EXPECT_EQ(size.m_width, 960u);
+        EXPECT_EQ(size.m_height, 540u);
+        EXPECT_EQ(size.m_depth, 1u);
+    }
+}
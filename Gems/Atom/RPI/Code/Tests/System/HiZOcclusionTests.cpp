@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Atom/RPI.Public/HiZOcclusion.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class HiZOcclusionTests
+        : public RPITestFixture
+    {
+    protected:
+        static constexpr uint32_t Size = 256;
+
+        //! Depth buffer seen through an identity world to clip matrix, with the same depth everywhere
+        AZStd::vector<float> MakeDepth(float depth) const
+        {
+            return AZStd::vector<float>(Size * Size, depth);
+        }
+    };
+
+    TEST_F(HiZOcclusionTests, GetMipCount_256x256_ChainDownToOneTexel)
+    {
+        const AZStd::vector<float> depth = MakeDepth(0.5f);
+        const HiZOcclusion hiZ(Matrix4x4::CreateIdentity(), Size, Size, depth);
+        EXPECT_EQ(hiZ.GetMipCount(), 9u);
+    }
+
+    TEST_F(HiZOcclusionTests, IsOccluded_BoundsBehindDepth_Occluded)
+    {
+        const AZStd::vector<float> depth = MakeDepth(0.5f);
+        const HiZOcclusion hiZ(Matrix4x4::CreateIdentity(), Size, Size, depth);
+        EXPECT_TRUE(hiZ.IsOccluded(Aabb::CreateFromMinMax(Vector3(-0.5f, -0.5f, 0.1f), Vector3(0.5f, 0.5f, 0.4f))));
+    }
+
+    TEST_F(HiZOcclusionTests, IsOccluded_BoundsInFrontOfDepth_NotOccluded)
+    {
+        const AZStd::vector<float> depth = MakeDepth(0.5f);
+        const HiZOcclusion hiZ(Matrix4x4::CreateIdentity(), Size, Size, depth);
+        EXPECT_FALSE(hiZ.IsOccluded(Aabb::CreateFromMinMax(Vector3(-0.5f, -0.5f, 0.1f), Vector3(0.5f, 0.5f, 0.6f))));
+    }
+
+    TEST_F(HiZOcclusionTests, IsOccluded_BoundsOutsideView_NotOccluded)
+    {
+        const AZStd::vector<float> depth = MakeDepth(0.5f);
+        const HiZOcclusion hiZ(Matrix4x4::CreateIdentity(), Size, Size, depth);
+        EXPECT_FALSE(hiZ.IsOccluded(Aabb::CreateFromMinMax(Vector3(0.5f, -0.5f, 0.1f), Vector3(1.5f, 0.5f, 0.4f))));
+    }
+
+    TEST_F(HiZOcclusionTests, IsOccluded_HoleInDepth_NotOccluded)
+    {
+        AZStd::vector<float> depth = MakeDepth(0.5f);
+        // a single texel at the far plane in the middle of the screen
+        depth[(Size / 2) * Size + Size / 2] = 0.0f;
+        const HiZOcclusion hiZ(Matrix4x4::CreateIdentity(), Size, Size, depth);
+        EXPECT_FALSE(hiZ.IsOccluded(Aabb::CreateFromMinMax(Vector3(-0.1f, -0.1f, 0.1f), Vector3(0.1f, 0.1f, 0.4f))));
+        EXPECT_TRUE(hiZ.IsOccluded(Aabb::CreateFromMinMax(Vector3(-0.9f, -0.9f, 0.1f), Vector3(-0.5f, -0.5f, 0.4f))));
+    }
+
+    TEST_F(HiZOcclusionTests, Construct_MissingDepth_NeverOccluded)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        const HiZOcclusion hiZ(Matrix4x4::CreateIdentity(), Size, Size, AZStd::span<const float>());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(hiZ.GetMipCount(), 0u);
+        EXPECT_FALSE(hiZ.IsOccluded(Aabb::CreateFromMinMax(Vector3(-0.5f, -0.5f, 0.1f), Vector3(0.5f, 0.5f, 0.4f))));
+    }
+}
@@ -10,8 +10,10 @@ set(FILES
     Include/Atom/RPI.Public/AssetInitBus.h
     Include/Atom/RPI.Public/Base.h
     Include/Atom/RPI.Public/Culling.h
+    Include/Atom/RPI.Public/DynamicResolutionController.h
     Include/Atom/RPI.Public/FeatureProcessor.h
     Include/Atom/RPI.Public/FeatureProcessorFactory.h
+    Include/Atom/RPI.Public/HiZOcclusion.h
     Include/Atom/RPI.Public/MeshDrawPacket.h
     Include/Atom/RPI.Public/PipelineState.h
     Include/Atom/RPI.Public/RenderPipeline.h
@@ -41,6 +43,7 @@ set(FILES
     Include/Atom/RPI.Public/DynamicDraw/DynamicDrawInterface.h
     Include/Atom/RPI.Public/Image/AttachmentImage.h
     Include/Atom/RPI.Public/Image/AttachmentImagePool.h
+    Include/Atom/RPI.Public/Image/BindlessImageRegistry.h
     Include/Atom/RPI.Public/Image/DefaultStreamingImageController.h
     Include/Atom/RPI.Public/Image/ImageSystem.h
     Include/Atom/RPI.Public/Image/ImageSystemInterface.h
@@ -92,7 +95,12 @@ set(FILES
     Include/Atom/RPI.Public/Shader/Metrics/ShaderMetrics.h
     Include/Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h
     Include/Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystemInterface.h
+    Include/Atom/RPI.Public/Shader/Warmup/PipelineStateManifest.h
+    Include/Atom/RPI.Public/Shader/Warmup/PipelineStateWarmupSystem.h
+    Include/Atom/RPI.Public/Shader/Warmup/PipelineStateWarmupSystemInterface.h
     Include/Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h
+    Include/Atom/RPI.Public/Shader/ShaderVariantUsageLog.h
+    Include/Atom/RPI.Public/GpuQuery/GpuPassProfiler.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystem.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystemInterface.h
     Include/Atom/RPI.Public/GpuQuery/GpuQueryTypes.h
@@ -100,8 +108,10 @@ set(FILES
     Include/Atom/RPI.Public/GpuQuery/QueryPool.h
     Include/Atom/RPI.Public/GpuQuery/TimestampQueryPool.h
     Source/RPI.Public/Culling.cpp
+    Source/RPI.Public/DynamicResolutionController.cpp
     Source/RPI.Public/FeatureProcessor.cpp
     Source/RPI.Public/FeatureProcessorFactory.cpp
+    Source/RPI.Public/HiZOcclusion.cpp
     Source/RPI.Public/MeshDrawPacket.cpp
     Source/RPI.Public/PipelineState.cpp
     Source/RPI.Public/RenderPipeline.cpp
@@ -122,6 +132,7 @@ set(FILES
     Source/RPI.Public/DynamicDraw/DynamicDrawSystem.cpp
     Source/RPI.Public/Image/AttachmentImage.cpp
     Source/RPI.Public/Image/AttachmentImagePool.cpp
+    Source/RPI.Public/Image/BindlessImageRegistry.cpp
     Source/RPI.Public/Image/DefaultStreamingImageController.cpp
     Source/RPI.Public/Image/ImageSystem.cpp
     Source/RPI.Public/Image/StreamingImage.cpp
@@ -166,12 +177,16 @@ set(FILES
     Source/RPI.Public/Shader/ShaderSystem.cpp
     Source/RPI.Public/Shader/Metrics/ShaderMetrics.cpp
     Source/RPI.Public/Shader/Metrics/ShaderMetricsSystem.cpp
+    Source/RPI.Public/Shader/Warmup/PipelineStateManifest.cpp
+    Source/RPI.Public/Shader/Warmup/PipelineStateWarmupSystem.cpp
     Source/RPI.Public/Shader/ShaderVariantAsyncLoader.cpp
+    Source/RPI.Public/Shader/ShaderVariantUsageLog.cpp
     Source/RPI.Public/ColorManagement/GeneratedTransforms/ColorConversionConstants.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/LinearSrgb_To_AcesCg.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/AcesCg_To_LinearSrgb.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/XYZ_To_AcesCg.inl
     Source/RPI.Public/ColorManagement/TransformColor.cpp
+    Source/RPI.Public/GpuQuery/GpuPassProfiler.cpp
     Source/RPI.Public/GpuQuery/GpuQuerySystem.cpp
     Source/RPI.Public/GpuQuery/GpuQueryTypes.cpp
     Source/RPI.Public/GpuQuery/Query.cpp
@@ -42,6 +42,7 @@ namespace AZ
 
                 ImGui::Checkbox("Enable Frustum Culling", &debugCtx.m_enableFrustumCulling);
                 ImGui::Checkbox("Enable Parallel Octree Traversal",  &debugCtx.m_parallelOctreeTraversal);
+                ImGui::Checkbox("Enable Shared Octree Traversal",  &debugCtx.m_sharedOctreeTraversal);
                 ImGui::Checkbox("Freeze Frustums", &debugCtx.m_freezeFrustums);
                 ImGui::Checkbox("Debug Draw", &debugCtx.m_debugDraw);
                 {
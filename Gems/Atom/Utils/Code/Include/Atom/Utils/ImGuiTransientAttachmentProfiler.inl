@@ -33,6 +33,11 @@ namespace AZ
                             stats.m_reservedMemory.m_imageMemoryInBytes +
                             stats.m_reservedMemory.m_rendertargetMemoryInBytes)
                         * BytesToMB));
+                    if (stats.m_intervalPacking.m_packedPeakInBytes)
+                    {
+                        ImGui::Text("First Fit Peak: %.1f MB", static_cast<double>(stats.m_intervalPacking.m_firstFitPeakInBytes * BytesToMB));
+                        ImGui::Text("Interval Packing Peak: %.1f MB", static_cast<double>(stats.m_intervalPacking.m_packedPeakInBytes * BytesToMB));
+                    }
                     ImGui::TreePop();
                 }
 
@@ -17,6 +17,7 @@
 
 #include <Profiler/ImGuiTreemap.h>
 
+#include <AzCore/std/optional.h>
 #include <AzCore/std/sort.h>
 
 #include <inttypes.h>
@@ -621,6 +622,43 @@ namespace AZ
                 gpuTimestamp.Add(sortedPassEntries.back()->m_timestampResult);
             }
 
+            // Calculate how long each hardware queue was busy, merging the overlapping passes of the same queue.
+            AZStd::array<uint64_t, RHI::HardwareQueueClassCount> queueBusyDurations = {};
+            {
+                AZStd::array<AZStd::optional<RPI::TimestampResult>, RHI::HardwareQueueClassCount> queueBusyRanges;
+                for (const PassEntry* passEntry : sortedPassEntries)
+                {
+                    if (passEntry->m_isParent)
+                    {
+                        continue;
+                    }
+
+                    const RPI::TimestampResult& timestamp = passEntry->m_timestampResult;
+                    const uint32_t queueIndex = static_cast<uint32_t>(timestamp.GetHardwareQueueClass());
+                    AZStd::optional<RPI::TimestampResult>& busyRange = queueBusyRanges[queueIndex];
+                    if (busyRange && timestamp.GetTimestampBeginInTicks() <= busyRange->GetTimestampBeginInTicks() + busyRange->GetDurationInTicks())
+                    {
+                        busyRange->Add(timestamp);
+                    }
+                    else
+                    {
+                        if (busyRange)
+                        {
+                            queueBusyDurations[queueIndex] += busyRange->GetDurationInNanoseconds();
+                        }
+                        busyRange = timestamp;
+                    }
+                }
+
+                for (uint32_t queueIndex = 0; queueIndex < RHI::HardwareQueueClassCount; ++queueIndex)
+                {
+                    if (queueBusyRanges[queueIndex])
+                    {
+                        queueBusyDurations[queueIndex] += queueBusyRanges[queueIndex]->GetDurationInNanoseconds();
+                    }
+                }
+            }
+
             // Add a pass to the pass grid which none of the pass's timestamp range won't overlap each other.
             // Search each row until the pass can be added to the end of row without overlap the previous one.
             for (auto& passEntry : sortedPassEntries)
@@ -688,6 +726,21 @@ namespace AZ
                     const AZStd::string headerFrameTime = AZStd::string::format("Total frame duration (GPU): %s", formattedTimestamp.c_str());
                     ImGui::Text("%s", headerFrameTime.c_str());
 
+                    // Draw the occupancy of each hardware queue over the frame.
+                    const uint64_t frameDuration = gpuTimestamp.GetDurationInNanoseconds();
+                    for (uint32_t queueIndex = 0; queueIndex < RHI::HardwareQueueClassCount; ++queueIndex)
+                    {
+                        if (queueBusyDurations[queueIndex] > 0 && frameDuration > 0)
+                        {
+                            const AZStd::string formattedBusyDuration = FormatTimestampLabel(queueBusyDurations[queueIndex]);
+                            ImGui::Text(
+                                "%s queue busy: %s (%.1f%%)",
+                                RHI::GetHardwareQueueClassName(static_cast<RHI::HardwareQueueClass>(queueIndex)),
+                                formattedBusyDuration.c_str(),
+                                100.0 * static_cast<double>(queueBusyDurations[queueIndex]) / static_cast<double>(frameDuration));
+                        }
+                    }
+
                     // Draw the viewing option.
                     ImGui::RadioButton("Hierarchical", reinterpret_cast<int32_t*>(&m_viewType), static_cast<int32_t>(ProfilerViewType::Hierarchical));
                     ImGui::SameLine();
@@ -9,6 +9,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Math/Aabb.h>
@@ -170,6 +171,13 @@ namespace // unnamed namespace to hold copies of Cry AuxGeom state enum's, this
         e_DepthTestOn                   = 0x0 << e_DepthTestShift,
         e_DepthTestOff              = 0x1 << e_DepthTestShift,
     };
+
+    // per vertex colored primitives are drawn translucent when any of their colors is
+    AZ::RPI::AuxGeomDraw::OpacityType GetOpacityType(const AZStd::vector<AZ::Color>& colors)
+    {
+        const bool isOpaque = AZStd::all_of(colors.begin(), colors.end(), [](const AZ::Color& color) { return color.GetA() >= 1.0f; });
+        return isOpaque ? AZ::RPI::AuxGeomDraw::OpacityType::Opaque : AZ::RPI::AuxGeomDraw::OpacityType::Translucent;
+    }
 };
 
 namespace AZ::AtomBridge
@@ -508,6 +516,25 @@ namespace AZ::AtomBridge
         }
     }
 
+    void AtomDebugDisplayViewportInterface::DrawColoredTriangles(const AZStd::vector<AZ::Vector3>& vertices, const AZStd::vector<AZ::Color>& colors)
+    {
+        AZ_Assert(vertices.size() == colors.size(), "DrawColoredTriangles: Expected one color per vertex.");
+        if (m_auxGeomPtr && vertices.size() >= 3 && vertices.size() == colors.size())
+        {
+            AZStd::vector<AZ::Vector3> transformedVertices = ToWorldSpacePosition(vertices);
+            AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
+            drawArgs.m_verts = transformedVertices.data();
+            drawArgs.m_vertCount = aznumeric_cast<uint32_t>(transformedVertices.size());
+            drawArgs.m_colors = colors.data();
+            drawArgs.m_colorCount = aznumeric_cast<uint32_t>(colors.size());
+            drawArgs.m_opacityType = GetOpacityType(colors);
+            drawArgs.m_depthTest = m_rendState.m_depthTest;
+            drawArgs.m_depthWrite = m_rendState.m_depthWrite;
+            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            m_auxGeomPtr->DrawTriangles(drawArgs);
+        }
+    }
+
     void AtomDebugDisplayViewportInterface::DrawTrianglesIndexed(
         const AZStd::vector<AZ::Vector3>& vertices, 
         const AZStd::vector<AZ::u32>& indices, 
@@ -687,6 +714,26 @@ namespace AZ::AtomBridge
         }
     }
 
+    void AtomDebugDisplayViewportInterface::DrawColoredLines(const AZStd::vector<AZ::Vector3>& lines, const AZStd::vector<AZ::Color>& colors)
+    {
+        AZ_Assert(lines.size() == colors.size(), "DrawColoredLines: Expected one color per vertex.");
+        if (m_auxGeomPtr && lines.size() >= 2 && lines.size() == colors.size())
+        {
+            AZStd::vector<AZ::Vector3> transformedLines = ToWorldSpacePosition(lines);
+            AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
+            drawArgs.m_verts = transformedLines.data();
+            drawArgs.m_vertCount = aznumeric_cast<uint32_t>(transformedLines.size());
+            drawArgs.m_colors = colors.data();
+            drawArgs.m_colorCount = aznumeric_cast<uint32_t>(colors.size());
+            drawArgs.m_size = m_rendState.m_lineWidth;
+            drawArgs.m_opacityType = GetOpacityType(colors);
+            drawArgs.m_depthTest = m_rendState.m_depthTest;
+            drawArgs.m_depthWrite = m_rendState.m_depthWrite;
+            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            m_auxGeomPtr->DrawLines(drawArgs);
+        }
+    }
+
     void AtomDebugDisplayViewportInterface::DrawPolyLine(const AZ::Vector3* pnts, int numPoints, bool cycled)
     {
         if (m_auxGeomPtr)
@@ -147,6 +147,7 @@ namespace AZ::AtomBridge
         void DrawTri(const AZ::Vector3& p1, const AZ::Vector3& p2, const AZ::Vector3& p3) override;
         void DrawTriangles(const AZStd::vector<AZ::Vector3>& vertices, const AZ::Color& color) override;
         void DrawTrianglesIndexed(const AZStd::vector<AZ::Vector3>& vertices, const AZStd::vector<AZ::u32>& indices, const AZ::Color& color) override;
+        void DrawColoredTriangles(const AZStd::vector<AZ::Vector3>& vertices, const AZStd::vector<AZ::Color>& colors) override;
         void DrawWireBox(const AZ::Vector3& min, const AZ::Vector3& max) override;
         void DrawSolidBox(const AZ::Vector3& min, const AZ::Vector3& max) override;
         void DrawWireOBB(const AZ::Vector3& center, const AZ::Vector3& axisX, const AZ::Vector3& axisY, const AZ::Vector3& axisZ, const AZ::Vector3& halfExtents) override;
@@ -155,6 +156,7 @@ namespace AZ::AtomBridge
         void DrawLine(const AZ::Vector3& p1, const AZ::Vector3& p2) override;
         void DrawLine(const AZ::Vector3& p1, const AZ::Vector3& p2, const AZ::Vector4& col1, const AZ::Vector4& col2) override;
         void DrawLines(const AZStd::vector<AZ::Vector3>& lines, const AZ::Color& color) override;
+        void DrawColoredLines(const AZStd::vector<AZ::Vector3>& lines, const AZStd::vector<AZ::Color>& colors) override;
         void DrawPolyLine(const AZ::Vector3* pnts, int numPoints, bool cycled = true) override;
         void DrawWireQuad2d(const AZ::Vector2& p1, const AZ::Vector2& p2, float z) override;
         void DrawLine2d(const AZ::Vector2& p1, const AZ::Vector2& p2, float z) override;
@@ -100,6 +100,12 @@ namespace AZ
 
         FONT_TEXTURE_TYPE* GetBuffer() { return m_buffer; }
 
+        //! Gets the range of buffer rows that changed since the last ClearDirtyRows, so only those need to be uploaded
+        //! \param top The first changed row
+        //! \param height The number of changed rows, 0 if nothing changed
+        void GetDirtyRows(int& top, int& height) const { top = m_dirtyTop; height = m_dirtyBottom - m_dirtyTop; }
+        void ClearDirtyRows() { m_dirtyTop = 0; m_dirtyBottom = 0; }
+
         uint32_t GetSlotChar(int slotIndex) const;
         TextureSlot* GetCharSlot(uint32_t character, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize);
         TextureSlot* GetGradientSlot();
@@ -185,6 +191,8 @@ namespace AZ
         //! \param sizeRatio A sizing scale that should be applied to the glyph before being stored within the font texture.
         //! \param glyphSize The size of the glyph to be rendered at within the font texture.
         //! \param glyphFlags Specifies hinting behavior that should be applied to the glyph when rendered to the font texture.
+        void MarkDirtyRows(int top, int height);
+
         int UpdateSlot(int slotIndex, uint16_t slotUsage, uint32_t character, float sizeRatio, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize, const FFont::FontHintParams& glyphFlags = FFont::FontHintParams());
 
         TextureSlotKey GetTextureSlotKey(uint32_t character, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize) const;
@@ -240,6 +248,8 @@ namespace AZ
         TextureSlotTable            m_slotIndexMap;
 
         FONT_TEXTURE_TYPE*          m_buffer;                           // [y*width * x] x=0..width-1, y=0..height-1
+        int                         m_dirtyTop;                         // first buffer row changed since the last upload
+        int                         m_dirtyBottom;                      // one past the last buffer row changed since the last upload
 
         uint16_t                    m_slotUsage;
     };
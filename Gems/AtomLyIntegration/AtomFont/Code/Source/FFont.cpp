@@ -1453,6 +1453,9 @@ bool AZ::FFont::InitTexture()
     m_fontImage = m_fontStreamingImage->GetRHIImage();
     m_fontImage->SetName(Name(m_name.c_str()));
 
+    // the image was created from the whole buffer
+    m_fontTexture->ClearDirtyRows();
+
     m_fontImageVersion = 0;
     return true;
 }
@@ -1480,13 +1483,28 @@ bool AZ::FFont::UpdateTexture()
     RHI::ImageSubresourceLayoutPlaced layout;
     m_fontImage->GetSubresourceLayouts(range, &layout, nullptr);
 
+    // Only upload the rows that new glyphs were rendered to rather than the whole texture
+    int dirtyTop = 0;
+    int dirtyHeight = 0;
+    m_fontTexture->GetDirtyRows(dirtyTop, dirtyHeight);
+    if (dirtyHeight == 0)
+    {
+        return true;
+    }
+
+    layout.m_size.m_height = static_cast<uint32_t>(dirtyHeight);
+    layout.m_rowCount = static_cast<uint32_t>(dirtyHeight);
+    layout.m_bytesPerImage = layout.m_bytesPerRow * layout.m_rowCount;
+
     RHI::ImageUpdateRequest imageUpdateReq;
     imageUpdateReq.m_image = m_fontImage.get();
     imageUpdateReq.m_imageSubresource = RHI::ImageSubresource{ 0, 0 };
-    imageUpdateReq.m_sourceData = m_fontTexture->GetBuffer();
+    imageUpdateReq.m_imageSubresourcePixelOffset = RHI::Origin(0, static_cast<uint32_t>(dirtyTop), 0);
+    imageUpdateReq.m_sourceData = m_fontTexture->GetBuffer() + dirtyTop * layout.m_bytesPerRow;
     imageUpdateReq.m_sourceSubresourceLayout = layout;
 
     m_fontStreamingImage->UpdateImageContents(imageUpdateReq);
+    m_fontTexture->ClearDirtyRows();
 
     return true;
 }
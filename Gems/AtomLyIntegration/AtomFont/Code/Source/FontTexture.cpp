@@ -32,6 +32,8 @@ AZ::FontTexture::FontTexture()
     , m_heightCellCount(0)
     , m_textureSlotCount(0)
     , m_buffer(0)
+    , m_dirtyTop(0)
+    , m_dirtyBottom(0)
     , m_smoothMethod(AZ::FontSmoothMethod::None)
     , m_smoothAmount(AZ::FontSmoothAmount::None)
 {
@@ -97,6 +99,8 @@ int AZ::FontTexture::Create(int width, int height, AZ::FontSmoothMethod smoothMe
 
     m_width = width;
     m_height = height;
+    m_dirtyTop = 0;
+    m_dirtyBottom = height;
     m_invWidth = 1.0f / (float)width;
     m_invHeight = 1.0f / (float)height;
 
@@ -508,10 +512,26 @@ int AZ::FontTexture::UpdateSlot(int slotIndex, uint16_t slotUsage, uint32_t char
 
     glyphBitmap->BlitTo8(m_buffer, 0, 0,
         blitWidth, blitHeight, x * m_cellWidth, y * m_cellHeight, m_width);
+    MarkDirtyRows(y * m_cellHeight, blitHeight);
 
     return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+void AZ::FontTexture::MarkDirtyRows(int top, int height)
+{
+    if (m_dirtyBottom == m_dirtyTop)
+    {
+        m_dirtyTop = top;
+        m_dirtyBottom = top + height;
+    }
+    else
+    {
+        m_dirtyTop = AZ::GetMin(m_dirtyTop, top);
+        m_dirtyBottom = AZ::GetMax(m_dirtyBottom, top + height);
+    }
+}
+
 //-------------------------------------------------------------------------------------------------
 void AZ::FontTexture::CreateGradientSlot()
 {
@@ -536,6 +556,7 @@ void AZ::FontTexture::CreateGradientSlot()
             buffer[dwX + dwY * m_width] = static_cast<uint8_t>(dwY * 255 / (slot->m_characterHeight - 1));
         }
     }
+    MarkDirtyRows(y * m_cellHeight, slot->m_characterHeight);
 }
 
 //-------------------------------------------------------------------------------------------------
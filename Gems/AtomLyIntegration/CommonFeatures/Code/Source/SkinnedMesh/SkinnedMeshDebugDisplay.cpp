@@ -89,8 +89,13 @@ namespace AZ
                     "  Read only buffer view count: %zu\n"
                     "  Writable buffer view count: %zu\n"
                     "  Bone count: %zu\n"
-                    "  Vertex count: %zu\n",
-                    stats.skinnedMeshRenderProxyCount, stats.dispatchItemCount, stats.readOnlyBufferViewCount, stats.writableBufferViewCount, stats.boneCount, stats.vertexCount
+                    "  Vertex count: %zu\n"
+                    "  Updated SkinnedMeshRenderProxy count: %zu\n"
+                    "  Skipped SkinnedMeshRenderProxy count: %zu\n"
+                    "  Output stream memory: %zu / %zu bytes, %.1f%% fragmented\n",
+                    stats.skinnedMeshRenderProxyCount, stats.dispatchItemCount, stats.readOnlyBufferViewCount, stats.writableBufferViewCount, stats.boneCount, stats.vertexCount,
+                    stats.updatedRenderProxyCount, stats.skippedRenderProxyCount,
+                    stats.outputStreamAllocatedByteCount, stats.outputStreamCapacityInBytes, stats.outputStreamFragmentation * 100.0f
                 );
 
                 debugDisplay.Draw2dTextLabel(x, y, size, debugString.c_str(), center);
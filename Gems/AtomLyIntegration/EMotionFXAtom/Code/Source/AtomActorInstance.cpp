@@ -537,6 +537,8 @@ namespace AZ::Render
             // Update the morph weights for every lod. This does not mean they will all be dispatched, but they will all have up to date weights
             // TODO: once culling is hooked up such that EMotionFX and Atom are always in sync about which lod to update, only update the currently visible lods [ATOM-13564]
             const auto lodCount = aznumeric_cast<uint32_t>(m_actorInstance->GetActor()->GetNumLODLevels());
+            m_morphTargetInstanceIndicesByLod.resize(lodCount);
+            EMotionFX::MorphSetupInstance* morphSetupInstance = m_actorInstance->GetMorphSetupInstance();
             for (uint32_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
             {
                 EMotionFX::MorphSetup* morphSetup = m_actorInstance->GetActor()->GetMorphSetup(lodIndex);
@@ -547,6 +549,19 @@ namespace AZ::Render
                     m_wrinkleMaskWeights.clear();
 
                     size_t morphTargetCount = morphSetup->GetNumMorphTargets();
+
+                    // Look up the morph setup instance targets by id once, instead of searching them for every morph target every frame
+                    AZStd::vector<size_t>& morphTargetInstanceIndices = m_morphTargetInstanceIndicesByLod[lodIndex];
+                    if (morphTargetInstanceIndices.size() != morphTargetCount)
+                    {
+                        morphTargetInstanceIndices.resize(morphTargetCount);
+                        for (size_t morphTargetIndex = 0; morphTargetIndex < morphTargetCount; ++morphTargetIndex)
+                        {
+                            morphTargetInstanceIndices[morphTargetIndex] =
+                                morphSetupInstance->FindMorphTargetIndexByID(morphSetup->GetMorphTarget(morphTargetIndex)->GetID());
+                        }
+                    }
+
                     m_morphTargetWeights.clear();
                     for (size_t morphTargetIndex = 0; morphTargetIndex < morphTargetCount; ++morphTargetIndex)
                     {
@@ -560,7 +575,7 @@ namespace AZ::Render
                         // down cast the morph target
                         EMotionFX::MorphTargetStandard* morphTargetStandard = static_cast<EMotionFX::MorphTargetStandard*>(morphTarget);
 
-                        EMotionFX::MorphSetupInstance::MorphTarget* morphTargetSetupInstance = m_actorInstance->GetMorphSetupInstance()->FindMorphTargetByID(morphTargetStandard->GetID());
+                        EMotionFX::MorphSetupInstance::MorphTarget* morphTargetSetupInstance = morphSetupInstance->GetMorphTarget(morphTargetInstanceIndices[morphTargetIndex]);
 
                         // Each morph target is split into several deform datas, all of which share the same weight but have unique min/max delta values
                         // and thus correspond with unique dispatches in the morph target pass
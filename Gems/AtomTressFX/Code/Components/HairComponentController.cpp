@@ -201,8 +201,8 @@ namespace AZ
                     float currentDeltaTime = AZStd::min(deltaTime, MAX_SIMULATION_TIME_STEP);
                     m_renderObject->UpdateSimulationParameters(&m_configuration.m_simulationSettings, currentDeltaTime);
 
-                    // [To Do] Hair - Allow update of the following settings to control dynamic LOD
-                    const float distanceFromCamera = 1.0f;
+                    // The distance is updated by the feature processor each frame, keep the current LOD until then
+                    const float distanceFromCamera = m_renderObject->GetViewDistance();
                     const float updateShadows = false;
                     m_renderObject->UpdateRenderingParameters(
                         &m_configuration.m_renderingSettings, RESERVED_PIXELS_FOR_OIT, distanceFromCamera, updateShadows);
@@ -270,6 +270,7 @@ namespace AZ
 
                 m_entityWorldMatrix = Matrix3x4::CreateFromTransform(actorInstance->GetWorldSpaceTransform().ToAZTransform());
                 m_renderObject->UpdateBoneMatrices(m_entityWorldMatrix, m_cachedHairBoneMatrices);
+                m_renderObject->SetWorldBounds(actorInstance->GetAabb());
                 return true;
             }
 
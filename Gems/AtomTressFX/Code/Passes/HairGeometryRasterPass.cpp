@@ -179,6 +179,15 @@ namespace AZ
                 m_newRenderObjects.insert(hairObject);
             }
 
+            bool HairGeometryRasterPass::RebuildDrawPacket(HairRenderObject* hairObject)
+            {
+                if (!m_initialized || !hairObject->GetGeometrylDrawPacket(m_shader.get()))
+                {
+                    return false;
+                }
+                return BuildDrawPacket(hairObject);
+            }
+
             bool HairGeometryRasterPass::BuildDrawPacket(HairRenderObject* hairObject)
             {
                 if (!m_initialized)
@@ -51,6 +51,10 @@ namespace AZ
                 //! The following will be called when an object was added or shader has been compiled
                 void SchedulePacketBuild(HairRenderObject* hairObject);
 
+                //! Rebuilds the DrawPacket of an object already rendered by the pass, for example when its strands LOD changed.
+                //! Objects whose DrawPacket wasn't built yet are skipped, the first build will reflect their latest state.
+                bool RebuildDrawPacket(HairRenderObject* hairObject);
+
                 Data::Instance<RPI::Shader> GetShader();
 
                 void SetFeatureProcessor(HairFeatureProcessor* featureProcessor)
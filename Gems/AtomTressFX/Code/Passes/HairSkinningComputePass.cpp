@@ -191,7 +191,8 @@ namespace AZ
 
                 for (auto& renderObject : hairRenderObjects)
                 {
-                    if (!renderObject->IsEnabled())
+                    // Objects skipped by the simulation LOD keep the state of their last simulation
+                    if (!renderObject->IsEnabled() || !renderObject->IsSimulatedThisFrame())
                     {
                         continue;
                     }
@@ -5,10 +5,14 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/RHIUtils.h>
 #include <Atom/RHI/ImagePool.h>
@@ -42,6 +46,19 @@ namespace AZ
     {
         namespace Hair
         {
+            AZ_CVAR(bool, r_hairSkipOffscreenSimulation, true, nullptr, ConsoleFunctorFlags::Null,
+                "Skip the simulation of the hair objects outside of all views, they resume from their last simulated state once seen again");
+
+            AZ_CVAR(float, r_hairReducedSimulationDistance, 10.0f, nullptr, ConsoleFunctorFlags::Null,
+                "Distance from the closest view beyond which hair objects are simulated at the reduced rate of r_hairReducedSimulationInterval, 0 to disable");
+
+            AZ_CVAR(uint32_t, r_hairReducedSimulationInterval, 3, nullptr, ConsoleFunctorFlags::Null,
+                "Number of frames between two simulations of the hair objects beyond r_hairReducedSimulationDistance");
+
+            AZ_CVAR(uint32_t, r_hairMaxSimulatedObjects, 0, nullptr, ConsoleFunctorFlags::Null,
+                "Maximum number of hair objects simulated in a frame, 0 for unlimited. Objects over the budget are simulated in later frames, "
+                "the objects waiting the longest and then the closest ones first");
+
             uint32_t HairFeatureProcessor::s_instanceCount = 0;
 
             HairFeatureProcessor::HairFeatureProcessor()
@@ -113,11 +130,11 @@ namespace AZ
 
             void HairFeatureProcessor::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
             {
-                const float MAX_SIMULATION_TIME_STEP = 0.033f;  // Assuming minimal of 30 fps
-                m_currentDeltaTime = AZStd::min(deltaTime, MAX_SIMULATION_TIME_STEP);
+                // The simulation time step of each object is set when it's selected for simulation, see SelectSimulatedObjects
+                m_currentDeltaTime = deltaTime;
                 for (auto& object : m_hairRenderObjects)
                 {
-                    object->SetFrameDeltaTime(m_currentDeltaTime);
+                    object->AccumulateSimulationTime(deltaTime);
                 }
             }
 
@@ -225,6 +242,8 @@ namespace AZ
                     m_addDispatchEnabled = true;
                 }
 
+                SelectSimulatedObjects();
+
                 // Prepare materials array for the per pass srg
                 std::vector<const AMD::TressFXRenderParams*> hairObjectsRenderMaterials;
                 uint32_t objectIndex = 0;
@@ -237,14 +256,14 @@ namespace AZ
 
                     renderObject->SetRenderIndex(objectIndex);
 
-                    // [To Do] Hair - update the following parameters for dynamic LOD control
-                    // should change or when parameters are being changed on the editor side.
-//                         float Distance = sqrtf( m_activeScene.scene->GetCameraPos().x * m_activeScene.scene->GetCameraPos().x +
-//                                                  m_activeScene.scene->GetCameraPos().y * m_activeScene.scene->GetCameraPos().y +
-//                                                  m_activeScene.scene->GetCameraPos().z * m_activeScene.scene->GetCameraPos().z);
-                    const float distanceFromCamera = 1.0f;      // fixed distance until LOD mechanism is worked on
-                    const float updateShadows = false;          // same here - currently cheap self shadow approx
+                    // The distance from the views is found when rendering, so the LOD follows the views of the previous frame
+                    const float distanceFromCamera = renderObject->GetViewDistance();
+                    const float updateShadows = false;          // currently cheap self shadow approx
                     renderObject->UpdateRenderingParameters( nullptr, RESERVED_PIXELS_FOR_OIT, distanceFromCamera, updateShadows);
+                    if (renderObject->HasLODHairDensityChanged())
+                    {
+                        RebuildDrawPackets(renderObject.get());
+                    }
 
                     // this will be used in the constant buffer to set the material array used by the resolve pass
                     hairObjectsRenderMaterials.push_back(renderObject->GetHairRenderParams());
@@ -277,6 +296,7 @@ namespace AZ
                 // [To Do] - no culling scheme applied yet.
                 // Possibly setup the hair culling work group to be re-used for each view.
                 // See SkinnedMeshFeatureProcessor::Render for more details
+                UpdateViewDistances(packet.m_views);
                 
                 // Add dispatch per hair object per Compute passes
                 for (auto& [passName, pass] : m_computePasses)
@@ -296,6 +316,103 @@ namespace AZ
                 }
             }
 
+            void HairFeatureProcessor::SelectSimulatedObjects()
+            {
+                const float MAX_SIMULATION_TIME_STEP = 0.033f;  // Assuming minimal of 30 fps
+                const uint32_t reducedSimulationInterval = AZStd::max<uint32_t>(r_hairReducedSimulationInterval, 1);
+                const float reducedSimulationDistance = r_hairReducedSimulationDistance;
+                const bool skipOffscreenSimulation = r_hairSkipOffscreenSimulation;
+
+                m_simulationCandidates.clear();
+                for (auto& renderObject : m_hairRenderObjects)
+                {
+                    renderObject->SetSimulatedThisFrame(false);
+                    if (!renderObject->IsEnabled() || (skipOffscreenSimulation && !renderObject->IsVisible()))
+                    {
+                        continue;
+                    }
+
+                    const bool reducedRate = reducedSimulationDistance > 0.0f && renderObject->GetViewDistance() > reducedSimulationDistance;
+                    const uint32_t simulationInterval = reducedRate ? reducedSimulationInterval : 1;
+                    if (renderObject->IsSimulationResetPending() || renderObject->GetFramesSinceSimulation() >= simulationInterval)
+                    {
+                        m_simulationCandidates.push_back(renderObject.get());
+                    }
+                }
+
+                const uint32_t maxSimulatedObjects = r_hairMaxSimulatedObjects;
+                if (maxSimulatedObjects > 0 && m_simulationCandidates.size() > maxSimulatedObjects)
+                {
+                    // Objects resetting their simulation can't wait, then the objects waiting the longest and the closest ones go first
+                    AZStd::sort(m_simulationCandidates.begin(), m_simulationCandidates.end(),
+                        [](const HairRenderObject* lhs, const HairRenderObject* rhs)
+                        {
+                            if (lhs->IsSimulationResetPending() != rhs->IsSimulationResetPending())
+                            {
+                                return lhs->IsSimulationResetPending();
+                            }
+                            if (lhs->GetFramesSinceSimulation() != rhs->GetFramesSinceSimulation())
+                            {
+                                return lhs->GetFramesSinceSimulation() > rhs->GetFramesSinceSimulation();
+                            }
+                            return lhs->GetViewDistance() < rhs->GetViewDistance();
+                        });
+                    m_simulationCandidates.resize(maxSimulatedObjects);
+                }
+
+                for (HairRenderObject* renderObject : m_simulationCandidates)
+                {
+                    // The skipped frames are simulated as a single step, clamped to keep the simulation stable
+                    renderObject->SetFrameDeltaTime(AZStd::min(renderObject->GetTimeSinceSimulation(), MAX_SIMULATION_TIME_STEP));
+                    renderObject->SetSimulatedThisFrame(true);
+                }
+            }
+
+            void HairFeatureProcessor::UpdateViewDistances(const AZStd::vector<RPI::ViewPtr>& views)
+            {
+                m_viewFrustums.clear();
+                for (const RPI::ViewPtr& view : views)
+                {
+                    m_viewFrustums.push_back(Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix(), Frustum::ReverseDepth::True));
+                }
+
+                for (auto& renderObject : m_hairRenderObjects)
+                {
+                    const Aabb& worldBounds = renderObject->GetWorldBounds();
+                    if (!worldBounds.IsValid() || views.empty())
+                    {
+                        // Without bounds or views the hair is kept at full detail
+                        renderObject->SetViewDistance(0.0f, true);
+                        continue;
+                    }
+
+                    float distance = AZStd::numeric_limits<float>::max();
+                    bool visible = false;
+                    for (size_t viewIndex = 0; viewIndex < views.size(); ++viewIndex)
+                    {
+                        distance = AZStd::min(distance, worldBounds.GetDistance(views[viewIndex]->GetCameraTransform().GetTranslation()));
+                        visible = visible || ShapeIntersection::Overlaps(m_viewFrustums[viewIndex], worldBounds);
+                    }
+                    renderObject->SetViewDistance(distance, visible);
+                }
+            }
+
+            void HairFeatureProcessor::RebuildDrawPackets(HairRenderObject* renderObject)
+            {
+                if (m_usePPLLRenderTechnique)
+                {
+                    if (m_hairPPLLRasterPass)
+                    {
+                        m_hairPPLLRasterPass->RebuildDrawPacket(renderObject);
+                    }
+                }
+                else if (m_hairShortCutGeometryDepthAlphaPass && m_hairShortCutGeometryShadingPass)
+                {
+                    m_hairShortCutGeometryDepthAlphaPass->RebuildDrawPacket(renderObject);
+                    m_hairShortCutGeometryShadingPass->RebuildDrawPacket(renderObject);
+                }
+            }
+
             void HairFeatureProcessor::ClearPasses()
             {
                 m_initialized = false;      // Avoid simulation or render
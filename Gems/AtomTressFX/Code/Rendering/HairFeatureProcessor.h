@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Frustum.h>
 
 #include <AtomCore/Instance/Instance.h>
 
@@ -164,6 +165,16 @@ namespace AZ
 
                 void BuildDispatchAndDrawItems(Data::Instance<HairRenderObject> renderObject);
 
+                //! Selects the hair objects simulated this frame from their visibility, their distance from the views and
+                //! the simulation budget, and sets their simulation time step.
+                void SelectSimulatedObjects();
+
+                //! Updates the distance of the hair objects from the closest view and whether any view sees them
+                void UpdateViewDistances(const AZStd::vector<RPI::ViewPtr>& views);
+
+                //! Rebuilds the DrawPackets of a hair object after its strands LOD changed
+                void RebuildDrawPackets(HairRenderObject* renderObject);
+
                 void EnablePasses(bool enable);
 
                 bool HasHairParentPass(RPI::RenderPipeline* renderPipeline);
@@ -215,6 +226,9 @@ namespace AZ
 
                 //! Per frame delta time for the physics simulation - updated every frame
                 float m_currentDeltaTime = 0.02f;
+                //! Scratch lists reused every frame, see SelectSimulatedObjects and UpdateViewDistances
+                AZStd::vector<HairRenderObject*> m_simulationCandidates;
+                AZStd::vector<Frustum> m_viewFrustums;
                 //! flag to disable/enable feature processor adding dispatch calls to compute passes.
                 bool m_addDispatchEnabled = true;
                 //! reload / pipeline changes force build dispatches and render items
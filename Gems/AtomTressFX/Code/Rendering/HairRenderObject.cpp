@@ -12,6 +12,8 @@
 
 #include <Atom/Utils/Utils.h>
 
+#include <AzCore/std/math.h>
+
 // Hair Specific
 #include <TressFX/TressFXAsset.h>
 #include <TressFX/TressFXSettings.h>
@@ -942,6 +944,11 @@ namespace AZ
 
                         // Lerp: x + s(y-x)
                         m_LODHairDensity = 1.f + (DistanceRatio * ((shadowUpdate ? parameters->m_ShadowLODPercent : parameters->m_LODPercent) - 1.f));
+
+                        // The number of strands to render is held by the DrawPackets, quantize the density so they are only
+                        // rebuilt when it changes noticeably while the distance changes
+                        const float LODHairDensitySteps = 16.0f;
+                        m_LODHairDensity = AZStd::ceil(m_LODHairDensity * LODHairDensitySteps) / LODHairDensitySteps;
                     }
                 }
 
@@ -1123,6 +1130,7 @@ namespace AZ
                 RHI::DrawIndexed drawIndexed;
 
                 uint32_t numPrimsToRender = m_TotalIndices;
+                m_drawPacketLODHairDensity = m_LODHairDensity;
                 if (m_LODHairDensity < 1.0f)
                 {
                     numPrimsToRender /= 3;
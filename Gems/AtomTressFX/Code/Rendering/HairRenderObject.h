@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 
 #include <Atom/RHI/BufferView.h>
@@ -288,6 +289,48 @@ namespace AZ
                 {
                     m_enabled = enable;
                 }
+
+                //! World bounds of the hair, used to find its distance from the views and whether any view sees it
+                void SetWorldBounds(const Aabb& worldBounds) { m_worldBounds = worldBounds; }
+                const Aabb& GetWorldBounds() const { return m_worldBounds; }
+
+                //! Distance of the hair from the closest view and whether any view sees it, as found when the
+                //! previous frame was rendered. These drive the strands LOD and the simulation rate of the hair.
+                void SetViewDistance(float distance, bool visible)
+                {
+                    m_viewDistance = distance;
+                    m_visible = visible;
+                }
+                float GetViewDistance() const { return m_viewDistance; }
+                bool IsVisible() const { return m_visible; }
+
+                //! Time and frames elapsed since the hair was last simulated
+                void AccumulateSimulationTime(float deltaTime)
+                {
+                    m_timeSinceSimulation += deltaTime;
+                    ++m_framesSinceSimulation;
+                }
+                float GetTimeSinceSimulation() const { return m_timeSinceSimulation; }
+                uint32_t GetFramesSinceSimulation() const { return m_framesSinceSimulation; }
+
+                //! Whether the simulation dispatches of the hair are added this frame. Selecting the hair for
+                //! simulation restarts the time accumulated since it was last simulated.
+                void SetSimulatedThisFrame(bool simulated)
+                {
+                    m_simulatedThisFrame = simulated;
+                    if (simulated)
+                    {
+                        m_timeSinceSimulation = 0.0f;
+                        m_framesSinceSimulation = 0;
+                    }
+                }
+                bool IsSimulatedThisFrame() const { return m_simulatedThisFrame; }
+
+                //! The first frames of the simulation reset the hair to its skinned pose and are never skipped
+                bool IsSimulationResetPending() const { return m_SimulationFrame < 2; }
+
+                //! Whether the strands LOD changed since the DrawPackets, which hold the number of strands to render, were built
+                bool HasLODHairDensityChanged() const { return m_LODHairDensity != m_drawPacketLODHairDensity; }
                 //!-----------------------------------------------------------------
 
             private:
@@ -335,6 +378,16 @@ namespace AZ
 
                 // LOD calculations factor
                 float m_LODHairDensity = 1.0f;
+                // LOD factor the DrawPackets were built with
+                float m_drawPacketLODHairDensity = 1.0f;
+
+                // View distance and simulation rate state, see SetViewDistance and SetSimulatedThisFrame
+                Aabb m_worldBounds = Aabb::CreateNull();
+                float m_viewDistance = 0.0f;
+                bool m_visible = true;
+                bool m_simulatedThisFrame = true;
+                float m_timeSinceSimulation = 0.0f;
+                uint32_t m_framesSinceSimulation = 0;
 
                 bool m_enabled = true;
 
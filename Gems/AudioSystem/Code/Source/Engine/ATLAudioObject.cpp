@@ -343,6 +343,7 @@ namespace Audio
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
         m_raycastProcessor.Reset();
+        m_hasSentObstOccData = false;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -439,6 +440,21 @@ namespace Audio
         data.fOcclusion = m_raycastProcessor.GetOcclusion();
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CATLAudioObject::UpdateSentObstOccData(const SATLSoundPropagationData& data)
+    {
+        if (m_hasSentObstOccData
+            && AZ::IsClose(data.fObstruction, m_sentObstOccData.fObstruction, RaycastProcessor::s_epsilon)
+            && AZ::IsClose(data.fOcclusion, m_sentObstOccData.fOcclusion, RaycastProcessor::s_epsilon))
+        {
+            return false;
+        }
+
+        m_sentObstOccData = data;
+        m_hasSentObstOccData = true;
+        return true;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CATLAudioObject::OnAudioRaycastResults(const AudioRaycastResult& result)
     {
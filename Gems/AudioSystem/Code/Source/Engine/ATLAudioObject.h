@@ -363,6 +363,7 @@ namespace Audio
             : CATLAudioObjectBase(nID, eADS_NONE, pImplData)
             , m_nFlags(eAOF_NONE)
             , m_fPreviousVelocity(0.0f)
+            , m_hasSentObstOccData(false)
             , m_raycastProcessor(nID, m_oPosition)
         {
         }
@@ -390,6 +391,9 @@ namespace Audio
         void RunRaycasts(const SATLWorldPosition& listenerPos);
         bool CanRunRaycasts() const;
         void GetObstOccData(SATLSoundPropagationData& data) const;
+        //! Records the obstruction and occlusion values as sent to the audio middleware.
+        //! Returns false when they match the values sent last, so sending them again can be skipped.
+        bool UpdateSentObstOccData(const SATLSoundPropagationData& data);
 
         // AudioRaycastNotificationBus::Handler
         void OnAudioRaycastResults(const AudioRaycastResult& result) override;
@@ -406,6 +410,8 @@ namespace Audio
         float m_fPreviousVelocity;
         SATLWorldPosition m_oPosition;
         SATLWorldPosition m_oPreviousPosition;
+        SATLSoundPropagationData m_sentObstOccData;
+        bool m_hasSentObstOccData;
 
         RaycastProcessor m_raycastProcessor;
 
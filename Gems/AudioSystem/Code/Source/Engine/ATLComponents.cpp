@@ -326,10 +326,14 @@ namespace Audio
                     SATLSoundPropagationData propData;
                     pObject->GetObstOccData(propData);
 
-                    AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::SetObstructionOcclusion,
-                        pObject->GetImplDataPtr(),
-                        propData.fObstruction,
-                        propData.fOcclusion);
+                    // Values settle once the raycast results stop changing, only send them to the middleware when they change.
+                    if (pObject->UpdateSentObstOccData(propData))
+                    {
+                        AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::SetObstructionOcclusion,
+                            pObject->GetImplDataPtr(),
+                            propData.fObstruction,
+                            propData.fOcclusion);
+                    }
                 }
 
                 if (bUpdateVelocity && pObject->GetVelocityTracking())
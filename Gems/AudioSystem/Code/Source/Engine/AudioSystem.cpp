@@ -107,6 +107,16 @@ namespace Audio
         AZ_Assert(0 == (request.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequest - called with flag THREAD_SAFE_PUSH!");
         AZ_Assert(0 == (request.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequest - called with flag EXECUTE_BLOCKING!");
 
+        if (IsCoalescablePositionRequest(request))
+        {
+            // Replaces any position that wasn't sent yet
+            m_pendingPositionRequests[request.nAudioObjectID] = request;
+            return;
+        }
+
+        // Keep the order of the requests for this audio object
+        FlushPendingPositionRequest(request.nAudioObjectID);
+
         AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, request);
     }
 
@@ -173,6 +183,9 @@ namespace Audio
         // Main Thread!
         AZ_Assert(g_mainThreadId == AZStd::this_thread::get_id(), "AudioSystem::ExternalUpdate - called from non-Main thread!");
 
+        // Send the last position of each audio object that moved this frame...
+        FlushPendingPositionRequests();
+
         // Notify callbacks on the pending callbacks queue...
         // These are requests that were completed then queued for callback processing to happen here.
         ExecuteRequestCompletionCallbacks(m_pendingCallbacksQueue, m_pendingCallbacksMutex);
@@ -283,6 +296,7 @@ namespace Audio
 
         m_apAudioProxies.clear();
         m_apAudioProxiesToBeFreed.clear();
+        m_pendingPositionRequests.clear();
 
         // Release the audio implementation...
         SAudioRequest request;
@@ -662,6 +676,47 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioSystem::IsCoalescablePositionRequest(const CAudioRequestInternal& request) const
+    {
+        if (request.nAudioObjectID == INVALID_AUDIO_OBJECT_ID
+            || (request.nFlags & (eARF_PRIORITY_HIGH | eARF_SYNC_CALLBACK | eARF_SYNC_FINISHED_CALLBACK)) != 0
+            || !request.pData || request.pData->eRequestType != eART_AUDIO_OBJECT_REQUEST)
+        {
+            return false;
+        }
+
+        auto const pObjectRequestData = static_cast<const SAudioObjectRequestDataInternalBase*>(request.pData.get());
+        return pObjectRequestData->eType == eAORT_SET_POSITION;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::FlushPendingPositionRequest(TAudioObjectID audioObjectId)
+    {
+        if (m_pendingPositionRequests.empty() || audioObjectId == INVALID_AUDIO_OBJECT_ID)
+        {
+            return;
+        }
+
+        auto iter = m_pendingPositionRequests.find(audioObjectId);
+        if (iter != m_pendingPositionRequests.end())
+        {
+            AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, iter->second);
+            m_pendingPositionRequests.erase(iter);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::FlushPendingPositionRequests()
+    {
+        for (const auto& pendingRequest : m_pendingPositionRequests)
+        {
+            AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, pendingRequest.second);
+        }
+
+        m_pendingPositionRequests.clear();
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     bool CAudioSystem::ProcessRequests(TAudioRequests& requestQueue)
     {
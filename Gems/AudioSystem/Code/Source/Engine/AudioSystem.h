@@ -15,6 +15,7 @@
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -132,6 +133,8 @@ namespace Audio
     private:
         using TAudioRequests = AZStd::deque<CAudioRequestInternal, Audio::AudioSystemStdAllocator>;
         using TAudioProxies = AZStd::vector<CAudioProxy*, Audio::AudioSystemStdAllocator>;
+        using TPendingPositionRequests = AZStd::unordered_map<TAudioObjectID, CAudioRequestInternal,
+            AZStd::hash<TAudioObjectID>, AZStd::equal_to<TAudioObjectID>, Audio::AudioSystemStdAllocator>;
 
         void InternalUpdate();
         bool ProcessRequests(TAudioRequests& rRequestQueue);
@@ -140,6 +143,10 @@ namespace Audio
         void ExecuteRequestCompletionCallbacks(TAudioRequests& requestQueue, AZStd::mutex& requestQueueMutex, bool bTryLock = false);
         void ExtractCompletedRequests(TAudioRequests& rRequestQueue, TAudioRequests& rSyncCallbacksQueue);
 
+        bool IsCoalescablePositionRequest(const CAudioRequestInternal& request) const;
+        void FlushPendingPositionRequest(TAudioObjectID audioObjectId);
+        void FlushPendingPositionRequests();
+
         bool m_bSystemInitialized;
 
         using duration_ms = AZStd::chrono::duration<float, AZStd::milli>;
@@ -157,6 +164,10 @@ namespace Audio
         AZStd::mutex m_threadSafeCallbacksMutex;
         AZStd::mutex m_pendingCallbacksMutex;
 
+        // Position requests pushed from the main thread are held back until the end of the frame, or until another request
+        // for the same audio object gets pushed, so repeated position updates of an audio object collapse into one request.
+        TPendingPositionRequests m_pendingPositionRequests;
+
 
         // Synchronization objects
         AZStd::binary_semaphore m_mainEvent;
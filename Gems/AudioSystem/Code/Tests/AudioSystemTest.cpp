@@ -323,6 +323,24 @@ TEST_F(ATLAudioObjectTest, OnAudioRaycastResults_MultiRaycastHit_NonZeroOcclusio
 }
 
 
+TEST_F(ATLAudioObjectTest, UpdateSentObstOccData_UnchangedValues_SkipsResend)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+
+    SATLSoundPropagationData data;
+    EXPECT_TRUE(audioObject.UpdateSentObstOccData(data));
+    EXPECT_FALSE(audioObject.UpdateSentObstOccData(data));
+
+    data.fObstruction = 0.5f;
+    EXPECT_TRUE(audioObject.UpdateSentObstOccData(data));
+    EXPECT_FALSE(audioObject.UpdateSentObstOccData(data));
+
+    // A cleared object gets reused for a new middleware object, which needs the values again.
+    audioObject.Clear();
+    EXPECT_TRUE(audioObject.UpdateSentObstOccData(data));
+}
+
+
 class AudioRaycastManager_Test
     : public AudioRaycastManager
 {
@@ -29,6 +29,21 @@ namespace Blast
     {
         AZ::Render::MaterialComponentRequestBus::EventResult(
             m_materialMap, entityId, &AZ::Render::MaterialComponentRequests::GetMaterialOverrides);
+
+        for (auto chunkId = 0u; chunkId < m_chunkCount; ++chunkId)
+        {
+            m_chunkMeshHandles[chunkId] =
+                m_meshFeatureProcessor->AcquireMesh(AZ::Render::MeshHandleDescriptor{ m_meshData->GetMeshAsset(chunkId) }, m_materialMap);
+            m_meshFeatureProcessor->SetVisible(m_chunkMeshHandles[chunkId], false);
+        }
+    }
+
+    ActorRenderManager::~ActorRenderManager()
+    {
+        for (auto& meshHandle : m_chunkMeshHandles)
+        {
+            m_meshFeatureProcessor->ReleaseMesh(meshHandle);
+        }
     }
 
     void ActorRenderManager::OnActorCreated(const BlastActor& actor)
@@ -40,8 +55,8 @@ namespace Blast
         for (uint32_t chunkId : chunkIndices)
         {
             m_chunkActors[chunkId] = &actor;
-            m_chunkMeshHandles[chunkId] =
-                m_meshFeatureProcessor->AcquireMesh(AZ::Render::MeshHandleDescriptor{ m_meshData->GetMeshAsset(chunkId) }, m_materialMap);
+            m_meshFeatureProcessor->SetTransform(m_chunkMeshHandles[chunkId], actor.GetSimulatedBody()->GetTransform(), m_scale);
+            m_meshFeatureProcessor->SetVisible(m_chunkMeshHandles[chunkId], true);
         }
     }
 
@@ -53,7 +68,7 @@ namespace Blast
 
         for (uint32_t chunkId : chunkIndices)
         {
-            m_meshFeatureProcessor->ReleaseMesh(m_chunkMeshHandles[chunkId]);
+            m_meshFeatureProcessor->SetVisible(m_chunkMeshHandles[chunkId], false);
             m_chunkActors[chunkId] = nullptr;
         }
     }
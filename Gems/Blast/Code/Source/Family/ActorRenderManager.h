@@ -24,16 +24,20 @@ namespace Blast
     class ActorRenderManager
     {
     public:
-        // Initializes the manager by creating an entity with a render mesh for each chunk.
-        // Initially all meshes are invisible.
+        // Initializes the manager by acquiring a render mesh for each chunk.
+        // Initially all meshes are invisible, so that fracturing the family only toggles the visibility of
+        // already loaded meshes instead of acquiring new ones in the frame they appear.
         ActorRenderManager(
             AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor, BlastMeshData* meshData,
             AZ::EntityId entityId, uint32_t chunkCount, const AZ::Vector3& scale);
 
+        // Releases the render meshes of all chunks.
+        ~ActorRenderManager();
+
         // Callback that makes meshes corresponding to the actor visible and follows it's transform.
         void OnActorCreated(const BlastActor& actor);
 
-        // Callback that makes meshes corresponding to the actor invisible.
+        // Callback that makes meshes corresponding to the actor invisible, keeping them for later actors.
         void OnActorDestroyed(const BlastActor& actor);
 
         // Update positions of entities with render meshes corresponding to their right dynamic bodies.
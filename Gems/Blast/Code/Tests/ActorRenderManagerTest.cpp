@@ -82,6 +82,12 @@ namespace Blast
         {
             AZ::Data::Asset<AZ::RPI::ModelAsset> asset{AZ::Data::AssetLoadBehavior::NoLoad};
             EXPECT_CALL(*m_mockMeshData, GetMeshAsset(_)).Times(m_chunkCount).WillRepeatedly(testing::ReturnRef(asset));
+            EXPECT_CALL(
+                *m_mockMeshFeatureProcessor, AcquireMesh(_, testing::A<const AZ::Render::MaterialAssignmentMap&>()))
+                .Times(m_chunkCount)
+                .WillOnce(Return(testing::ByMove(AZ::Render::MeshFeatureProcessorInterface::MeshHandle())))
+                .WillOnce(Return(testing::ByMove(AZ::Render::MeshFeatureProcessorInterface::MeshHandle())));
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, SetVisible(_, false)).Times(m_chunkCount);
 
             actorRenderManager = AZStd::make_unique<TestableActorRenderManager>(
                 m_mockMeshFeatureProcessor.get(), m_mockMeshData.get(), entityId, m_chunkCount,
@@ -91,11 +97,10 @@ namespace Blast
 
         // ActorRenderManager::OnActorCreated
         {
-            EXPECT_CALL(
-                *m_mockMeshFeatureProcessor, AcquireMesh(_, testing::A<const AZ::Render::MaterialAssignmentMap&>()))
-                .Times(aznumeric_cast<int>(m_actorFactory->m_mockActors[0]->GetChunkIndices().size()))
-                .WillOnce(Return(testing::ByMove(AZ::Render::MeshFeatureProcessorInterface::MeshHandle())))
-                .WillOnce(Return(testing::ByMove(AZ::Render::MeshFeatureProcessorInterface::MeshHandle())));
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, SetVisible(_, true))
+                .Times(aznumeric_cast<int>(m_actorFactory->m_mockActors[0]->GetChunkIndices().size()));
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, SetTransform(_, _, _))
+                .Times(aznumeric_cast<int>(m_actorFactory->m_mockActors[0]->GetChunkIndices().size()));
 
             actorRenderManager->OnActorCreated(*m_actorFactory->m_mockActors[0]);
             for (auto chunkId : m_actorFactory->m_mockActors[0]->m_chunkIndices)
@@ -115,9 +120,9 @@ namespace Blast
 
         // ActorRenderManager::OnActorDestroyed
         {
-            EXPECT_CALL(*m_mockMeshFeatureProcessor, ReleaseMesh(_))
-                .Times(aznumeric_cast<int>(m_actorFactory->m_mockActors[0]->GetChunkIndices().size()))
-                .WillRepeatedly(Return(true));
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, SetVisible(_, false))
+                .Times(aznumeric_cast<int>(m_actorFactory->m_mockActors[0]->GetChunkIndices().size()));
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, ReleaseMesh(_)).Times(0);
 
             actorRenderManager->OnActorDestroyed(*m_actorFactory->m_mockActors[0]);
             for (auto chunkId : m_actorFactory->m_mockActors[0]->m_chunkIndices)
@@ -125,5 +130,11 @@ namespace Blast
                 EXPECT_EQ(actorRenderManager->m_chunkActors[chunkId], nullptr);
             }
         }
+
+        // ActorRenderManager::~ActorRenderManager
+        {
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, ReleaseMesh(_)).Times(m_chunkCount).WillRepeatedly(Return(true));
+            actorRenderManager.reset();
+        }
     }
 } // namespace Blast
@@ -349,8 +349,16 @@ namespace DebugDraw
                     &AZ::TransformBus::Events::GetWorldTranslation);
             }
 
-            debugDisplay.SetColor(lineElement.m_color);
-            debugDisplay.DrawLine(lineElement.m_startWorldLocation, lineElement.m_endWorldLocation);
+            m_batchPoints.push_back(lineElement.m_startWorldLocation);
+            m_batchPoints.push_back(lineElement.m_endWorldLocation);
+            m_batchColors.push_back(lineElement.m_color);
+            m_batchColors.push_back(lineElement.m_color);
+        }
+
+        // Draw all lines with a single call
+        if (!m_batchPoints.empty())
+        {
+            debugDisplay.DrawColoredLines(m_batchPoints, m_batchColors);
         }
 
         removeExpiredDebugElementsFromVector(m_activeLines);
@@ -278,7 +278,14 @@ namespace EMotionFX
                 UpdateWorldTransform();
                 if (updateJointTransforms && sampleMotions)
                 {
-                    m_animGraphInstance->Output(m_transformData->GetCurrentPose());
+                    if (m_crowdInstancingEnabled)
+                    {
+                        GetActorManager().GetScheduler()->GetCrowdPoseCache().Output(m_animGraphInstance, m_transformData->GetCurrentPose());
+                    }
+                    else
+                    {
+                        m_animGraphInstance->Output(m_transformData->GetCurrentPose());
+                    }
 
                     if (m_ragdollInstance)
                     {
@@ -851,6 +851,15 @@ namespace EMotionFX
         AnimGraphPose* RequestPose(uint32 threadIndex);
         void FreePose(uint32 threadIndex, AnimGraphPose* pose);
 
+        /**
+         * Enable or disable crowd instancing, which lets the actor instance copy the anim graph output pose of an equal actor instance instead of evaluating its own.
+         * The anim graph keeps being updated for this actor instance, so that it keeps its own play times, events and root motion.
+         * See CrowdPoseCache for when actor instances are considered equal. Crowd instancing is disabled by default.
+         * @param enabled Set to true to enable crowd instancing.
+         */
+        void SetCrowdInstancingEnabled(bool enabled)                            { m_crowdInstancingEnabled = enabled; }
+        bool GetCrowdInstancingEnabled() const                                  { return m_crowdInstancingEnabled; }
+
         void SetMotionSamplingTimer(float timeInSeconds);
         void SetMotionSamplingRate(float updateRateInSeconds);
         float GetMotionSamplingTimer() const;
@@ -899,6 +908,7 @@ namespace EMotionFX
         uint32                  m_threadIndex;           /**< The thread index. This specifies the thread number this actor instance is being processed in. */
         EBoundsType             m_boundsUpdateType;      /**< The bounds update type (node based, mesh based or collision mesh based). */
         float m_boundsExpandBy = 0.25f; /**< Expand bounding box by normalized percentage. (Default: 25% greater than the calculated bounding box) */
+        bool m_crowdInstancingEnabled = false; /**< Share the anim graph output pose with equal actor instances? */
         uint8                   m_numAttachmentRefs;     /**< Specifies how many actor instances use this actor instance as attachment. */
         uint8                   m_boolFlags;             /**< Boolean flags. */
 
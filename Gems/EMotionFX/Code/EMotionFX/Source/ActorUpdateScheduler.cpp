@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "ActorUpdateScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "EMotionFXManager.h"
+#include <AzCore/std/sort.h>
+
+
+namespace EMotionFX
+{
+    // pick the actor instances that sample their motions this frame
+    void ActorUpdateScheduler::PrepareSamplingBudget(float timePassedInSeconds)
+    {
+        m_samplingBudgetExceeded = false;
+        if (m_maxSampledActorInstances == 0)
+        {
+            return;
+        }
+
+        // gather how long each visible actor instance that is due for sampling has been waiting for it
+        m_overdueSamplingTimes.clear();
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numActorInstances = actorManager.GetNumActorInstances();
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            const ActorInstance* actorInstance = actorManager.GetActorInstance(i);
+            if (!actorInstance->GetIsEnabled() || !actorInstance->GetIsVisible())
+            {
+                continue;
+            }
+
+            const float overdueTime = actorInstance->GetMotionSamplingTimer() + timePassedInSeconds - actorInstance->GetMotionSamplingRate();
+            if (overdueTime >= 0.0f)
+            {
+                m_overdueSamplingTimes.emplace_back(overdueTime);
+            }
+        }
+
+        if (m_overdueSamplingTimes.size() <= m_maxSampledActorInstances)
+        {
+            return;
+        }
+
+        // find the overdue time of the last actor instance that fits in the budget, sorting the longest waiting ones first
+        const auto lastSampled = m_overdueSamplingTimes.begin() + (m_maxSampledActorInstances - 1);
+        AZStd::partial_sort(m_overdueSamplingTimes.begin(), lastSampled + 1, m_overdueSamplingTimes.end(), AZStd::greater<float>());
+        m_minOverdueSamplingTime = *lastSampled;
+
+        // several actor instances can be overdue by exactly the same time, so only let the ones that still fit in the budget through
+        const size_t numAboveMinOverdue = AZStd::count_if(m_overdueSamplingTimes.begin(), m_overdueSamplingTimes.end(),
+            [this](float overdueTime) { return overdueTime > m_minOverdueSamplingTime; });
+        m_numSamplesLeftAtMinOverdue = m_maxSampledActorInstances - numAboveMinOverdue;
+        m_samplingBudgetExceeded = true;
+    }
+
+
+    // advance the sampling timer and check if we want to sample motions
+    bool ActorUpdateScheduler::UpdateMotionSamplingTimer(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const float samplingTimer = actorInstance->GetMotionSamplingTimer() + timePassedInSeconds;
+        actorInstance->SetMotionSamplingTimer(samplingTimer);
+        if (samplingTimer < actorInstance->GetMotionSamplingRate())
+        {
+            return false;
+        }
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible && m_samplingBudgetExceeded)
+        {
+            const float overdueTime = samplingTimer - actorInstance->GetMotionSamplingRate();
+            if (overdueTime < m_minOverdueSamplingTime)
+            {
+                return false;
+            }
+
+            if (overdueTime == m_minOverdueSamplingTime)
+            {
+                // claim one of the remaining samples, if there is any left
+                size_t numSamplesLeft = m_numSamplesLeftAtMinOverdue.load();
+                do
+                {
+                    if (numSamplesLeft == 0)
+                    {
+                        return false;
+                    }
+                } while (!m_numSamplesLeftAtMinOverdue.compare_exchange_weak(numSamplesLeft, numSamplesLeft - 1));
+            }
+        }
+
+        actorInstance->SetMotionSamplingTimer(0.0f);
+        if (isVisible)
+        {
+            m_numSampled.Increment();
+        }
+        return true;
+    }
+}   // namespace EMotionFX
@@ -11,6 +11,10 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "BaseObject.h"
+#include "CrowdPoseCache.h"
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <MCore/Source/MultiThreadManager.h>
 
 
 namespace EMotionFX
@@ -84,10 +88,44 @@ namespace EMotionFX
         size_t GetNumVisibleActorInstances() const                  { return m_numVisible.GetValue(); }
         size_t GetNumSampledActorInstances() const                  { return m_numSampled.GetValue(); }
 
+        /**
+         * Set the maximum number of visible actor instances that sample their motions within a single frame.
+         * The actor instances that are due beyond this budget keep their last sampled pose and get postponed to the next frames,
+         * the ones that waited the longest going first.
+         * @param maxSampledActorInstances The maximum number of sampled actor instances per frame, or 0 for no limit, which is the default.
+         */
+        void SetMaxSampledActorInstances(size_t maxSampledActorInstances)  { m_maxSampledActorInstances = maxSampledActorInstances; }
+        size_t GetMaxSampledActorInstances() const                  { return m_maxSampledActorInstances; }
+
+        /**
+         * Get the cache that the crowd instanced actor instances share their anim graph output poses through.
+         * The cache gets cleared at the start of every execution.
+         * @result The crowd pose cache.
+         */
+        CrowdPoseCache& GetCrowdPoseCache()                         { return m_crowdPoseCache; }
+        const CrowdPoseCache& GetCrowdPoseCache() const             { return m_crowdPoseCache; }
+
     protected:
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        CrowdPoseCache m_crowdPoseCache;
+
+        /**
+         * Decide up front which of the visible actor instances get to sample their motions this frame, based on the sampling budget.
+         * This has to be called once per execution, after the visibility has been propagated to the attachments.
+         * @param timePassedInSeconds The time passed since the last execution, in seconds.
+         */
+        void PrepareSamplingBudget(float timePassedInSeconds);
+
+        /**
+         * Advance the motion sampling timer of an actor instance and check if it samples its motions this frame.
+         * This is safe to call for different actor instances from multiple threads at once.
+         * @param actorInstance The actor instance to update the motion sampling timer for.
+         * @param timePassedInSeconds The time passed since the last execution, in seconds.
+         * @result Returns true when the actor instance should sample its motions.
+         */
+        bool UpdateMotionSamplingTimer(ActorInstance* actorInstance, float timePassedInSeconds);
 
         /**
          * The constructor.
@@ -99,5 +137,12 @@ namespace EMotionFX
          * The destructor.
          */
         virtual ~ActorUpdateScheduler() {}
+
+    private:
+        AZStd::vector<float> m_overdueSamplingTimes;   /**< Scratch buffer for the time each due actor instance is overdue by. */
+        size_t m_maxSampledActorInstances = 0;
+        float m_minOverdueSamplingTime = 0.0f;          /**< Actor instances overdue by less than this wait for the next frames. */
+        AZStd::atomic<size_t> m_numSamplesLeftAtMinOverdue{ 0 }; /**< Actor instances exactly at the minimum overdue time that can still sample. */
+        bool m_samplingBudgetExceeded = false;
     };
 }   // namespace EMotionFX
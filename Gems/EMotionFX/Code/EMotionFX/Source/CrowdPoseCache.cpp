@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "CrowdPoseCache.h"
+#include "ActorInstance.h"
+#include "AnimGraph.h"
+#include "AnimGraphInstance.h"
+#include "AnimGraphStateMachine.h"
+#include "AnimGraphStateTransition.h"
+#include "Pose.h"
+#include <AzCore/std/hash.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/lock.h>
+#include <MCore/Source/AttributeQuaternion.h>
+#include <MCore/Source/AttributeVector2.h>
+#include <MCore/Source/AttributeVector3.h>
+#include <MCore/Source/AttributeVector4.h>
+
+
+namespace EMotionFX
+{
+    // output the pose, sharing it with the equal actor instances
+    bool CrowdPoseCache::Output(AnimGraphInstance* animGraphInstance, Pose* outputPose)
+    {
+        AZStd::vector<AZ::s64> key;
+        if (!CalcKey(animGraphInstance, key))
+        {
+            animGraphInstance->Output(outputPose);
+            return false;
+        }
+
+        const size_t hash = AZStd::hash_range(key.begin(), key.end());
+
+        // copy the pose over in case an equal actor instance evaluated it already
+        bool isClaimed = false;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            const auto iterator = m_entriesByHash.find(hash);
+            if (iterator != m_entriesByHash.end())
+            {
+                const Entry* entry = iterator->second;
+                if (entry->m_isReady && entry->m_key == key)
+                {
+                    *outputPose = *entry->m_pose;
+                    m_numSharedPoses.Increment();
+                    return true;
+                }
+
+                // the pose is either still being evaluated or the hash collides
+                isClaimed = true;
+            }
+        }
+
+        // evaluate our own pose without waiting
+        if (isClaimed)
+        {
+            animGraphInstance->Output(outputPose);
+            return false;
+        }
+
+        // claim the entry, so that the equal actor instances that follow can copy our pose
+        Entry* claimedEntry = nullptr;
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (m_entriesByHash.find(hash) == m_entriesByHash.end())
+            {
+                if (m_numUsedEntries == m_entries.size())
+                {
+                    m_entries.emplace_back(AZStd::make_unique<Entry>());
+                    m_entries.back()->m_pose = AZStd::make_unique<Pose>();
+                }
+
+                claimedEntry = m_entries[m_numUsedEntries++].get();
+                claimedEntry->m_key = AZStd::move(key);
+                claimedEntry->m_isReady = false;
+                m_entriesByHash.emplace(hash, claimedEntry);
+            }
+        }
+
+        animGraphInstance->Output(outputPose);
+
+        if (claimedEntry)
+        {
+            // nobody reads the entry before it is ready, so the pose can be copied outside of the lock
+            claimedEntry->m_pose->LinkToActorInstance(animGraphInstance->GetActorInstance());
+            *claimedEntry->m_pose = *outputPose;
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            claimedEntry->m_isReady = true;
+        }
+
+        return false;
+    }
+
+
+    // forget the poses of the previous execution
+    void CrowdPoseCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_entriesByHash.clear();
+        m_numUsedEntries = 0;
+        m_numSharedPoses.SetValue(0);
+    }
+
+
+    // quantize a value to the given step
+    AZ::s64 CrowdPoseCache::Quantize(float value, float step) const
+    {
+        return static_cast<AZ::s64>(AZStd::llround(value / AZ::GetMax(step, AZ::Constants::FloatEpsilon)));
+    }
+
+
+    // build the key that equal actor instances share
+    bool CrowdPoseCache::CalcKey(AnimGraphInstance* animGraphInstance, AZStd::vector<AZ::s64>& outKey) const
+    {
+        // networked anim graph instances get restored from their snapshots, so they can't be shared
+        if (animGraphInstance->IsNetworkEnabled())
+        {
+            return false;
+        }
+
+        const ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
+        const AnimGraph* animGraph = animGraphInstance->GetAnimGraph();
+        outKey.emplace_back(reinterpret_cast<AZ::s64>(actorInstance->GetActor()));
+        outKey.emplace_back(reinterpret_cast<AZ::s64>(animGraph));
+        outKey.emplace_back(reinterpret_cast<AZ::s64>(animGraphInstance->GetMotionSet()));
+        outKey.emplace_back(static_cast<AZ::s64>(actorInstance->GetLODLevel()));
+
+        // the quantized parameter values
+        const size_t numParameters = animGraph->GetNumValueParameters();
+        for (size_t i = 0; i < numParameters; ++i)
+        {
+            const MCore::Attribute* attribute = animGraphInstance->GetParameterValue(i);
+            switch (attribute->GetType())
+            {
+            case MCore::AttributeVector2::TYPE_ID:
+            {
+                const AZ::Vector2& value = static_cast<const MCore::AttributeVector2*>(attribute)->GetValue();
+                outKey.emplace_back(Quantize(value.GetX(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetY(), m_parameterQuantization));
+                break;
+            }
+            case MCore::AttributeVector3::TYPE_ID:
+            {
+                const AZ::Vector3& value = static_cast<const MCore::AttributeVector3*>(attribute)->GetValue();
+                outKey.emplace_back(Quantize(value.GetX(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetY(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetZ(), m_parameterQuantization));
+                break;
+            }
+            case MCore::AttributeVector4::TYPE_ID:
+            {
+                const AZ::Vector4& value = static_cast<const MCore::AttributeVector4*>(attribute)->GetValue();
+                outKey.emplace_back(Quantize(value.GetX(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetY(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetZ(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetW(), m_parameterQuantization));
+                break;
+            }
+            case MCore::AttributeQuaternion::TYPE_ID:
+            {
+                const AZ::Quaternion& value = static_cast<const MCore::AttributeQuaternion*>(attribute)->GetValue();
+                outKey.emplace_back(Quantize(value.GetX(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetY(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetZ(), m_parameterQuantization));
+                outKey.emplace_back(Quantize(value.GetW(), m_parameterQuantization));
+                break;
+            }
+            default:
+            {
+                // float, int and bool parameters, actor instances with any other parameter type don't get shared
+                float value = 0.0f;
+                if (!animGraphInstance->GetParameterValueAsFloat(i, &value))
+                {
+                    return false;
+                }
+                outKey.emplace_back(Quantize(value, m_parameterQuantization));
+                break;
+            }
+            }
+        }
+
+        // the active root states with their quantized play times, and the active transitions with their quantized blend weights
+        const AnimGraphStateMachine* rootStateMachine = animGraph->GetRootStateMachine();
+        for (AnimGraphNode* state : rootStateMachine->GetActiveStates(animGraphInstance))
+        {
+            outKey.emplace_back(reinterpret_cast<AZ::s64>(state));
+            outKey.emplace_back(Quantize(state->GetCurrentPlayTime(animGraphInstance), m_timeQuantization));
+        }
+        for (AnimGraphStateTransition* transition : rootStateMachine->GetActiveTransitions(animGraphInstance))
+        {
+            outKey.emplace_back(reinterpret_cast<AZ::s64>(transition));
+            outKey.emplace_back(Quantize(transition->GetBlendWeight(animGraphInstance), m_parameterQuantization));
+        }
+
+        return true;
+    }
+}   // namespace EMotionFX
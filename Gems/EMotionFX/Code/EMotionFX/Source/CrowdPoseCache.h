@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class AnimGraphInstance;
+    class Pose;
+
+
+    /**
+     * The crowd pose cache, used by the actor update schedulers to share the anim graph output poses between crowd instanced actor instances.
+     * Actor instances running the same anim graph, with the same motion set and actor at the same LOD level, and with equal quantized parameter values,
+     * active root states and state play times, output the same pose. Only the first of them within a scheduler execution evaluates it, the others copy it over.
+     * The anim graphs still get updated per actor instance, so that every actor instance keeps its own play times, events and root motion.
+     * As nested state machines are not taken into account, crowd instancing should only be enabled on actor instances where the root state machine drives the output.
+     */
+    class EMFX_API CrowdPoseCache
+    {
+    public:
+        /**
+         * Set the time step the play times of the active root states are quantized with.
+         * Actor instances playing the same states with a time offset below this step share their poses.
+         * @param timeQuantization The quantization time step, in seconds. The default is 1/30th of a second.
+         */
+        void SetTimeQuantization(float timeQuantization)            { m_timeQuantization = timeQuantization; }
+        float GetTimeQuantization() const                           { return m_timeQuantization; }
+
+        /**
+         * Set the step the anim graph parameter values are quantized with.
+         * @param parameterQuantization The quantization step for the parameter values and their components. The default is 0.01.
+         */
+        void SetParameterQuantization(float parameterQuantization)  { m_parameterQuantization = parameterQuantization; }
+        float GetParameterQuantization() const                      { return m_parameterQuantization; }
+
+        /**
+         * Output the anim graph pose of an actor instance, either by copying the pose of an equal actor instance that got evaluated already, or by evaluating it.
+         * The anim graph instance has to be updated already. This is safe to call for different actor instances from multiple threads at once.
+         * @param animGraphInstance The updated anim graph instance to output the pose for.
+         * @param outputPose The pose to output to.
+         * @result Returns true when the pose got copied from another actor instance, false when it got evaluated.
+         */
+        bool Output(AnimGraphInstance* animGraphInstance, Pose* outputPose);
+
+        /**
+         * Forget the poses of the previous execution, while keeping their memory. This has to be called once at the start of each scheduler execution.
+         */
+        void Clear();
+
+        /**
+         * Get the number of actor instances that copied their pose instead of evaluating it since the last clear.
+         * @result The number of shared poses.
+         */
+        size_t GetNumSharedPoses() const                            { return m_numSharedPoses.GetValue(); }
+
+    private:
+        struct Entry
+        {
+            AZStd::vector<AZ::s64> m_key;
+            AZStd::unique_ptr<Pose> m_pose;
+            bool m_isReady = false;
+        };
+
+        bool CalcKey(AnimGraphInstance* animGraphInstance, AZStd::vector<AZ::s64>& outKey) const;
+        AZ::s64 Quantize(float value, float step) const;
+
+        AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<size_t, Entry*> m_entriesByHash;
+        AZStd::vector<AZStd::unique_ptr<Entry>> m_entries;     /**< All entries allocated so far, of which the first m_numUsedEntries are used. */
+        size_t m_numUsedEntries = 0;
+        MCore::AtomicSizeT m_numSharedPoses;
+        float m_timeQuantization = 1.0f / 30.0f;
+        float m_parameterQuantization = 0.01f;
+    };
+}   // namespace EMotionFX
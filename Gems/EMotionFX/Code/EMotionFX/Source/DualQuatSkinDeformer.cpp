@@ -71,6 +71,7 @@ namespace EMotionFX
 
         // copy the bone info (for precalc/optimization reasons)
         result->m_bones = m_bones;
+        result->m_influences = m_influences;
 
         // return the result
         return result;
@@ -113,7 +114,7 @@ namespace EMotionFX
                 AZ::JobContext* jobContext = nullptr;
                 AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRange(m_mesh, startVertex, endVertex, m_bones, m_influences);
                     }, /*isAutoDelete=*/true, jobContext);
 
                 job->SetDependent(&jobCompletion);
@@ -124,78 +125,59 @@ namespace EMotionFX
         }
     }
 
-    void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos)
+    void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const SkinInfluenceArrays& influences)
     {
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning layer.");
-
-        AZ::Vector3 newTangent;
-        AZ::Vector3 vtxPos, normal, tangent, bitangent;
-        AZ::u32 orgVertex;
-        float weight;
-
         AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
         AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
         AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
-        AZ::u32* orgVerts = static_cast<AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+
+        const uint16* boneNumbers = influences.GetBoneNumbers();
+        const float* weights = influences.GetWeights();
+
+        // Calculate the normalized weighted sum of the dual quaternions of the influences, returns false for a vertex without influences.
+        const auto calcSkinQuat = [&boneInfos, &influences, boneNumbers, weights](AZ::u32 vertexNr, MCore::DualQuaternion& skinQuat)
+        {
+            const AZ::u32 influenceBegin = influences.GetInfluenceBegin(vertexNr);
+            const AZ::u32 influenceEnd = influences.GetInfluenceEnd(vertexNr);
+            if (influenceBegin == influenceEnd)
+            {
+                return false;
+            }
+
+            // get the pivot quat, used for the dot product check
+            const AZ::Quaternion& pivotQuat = boneInfos[boneNumbers[influenceBegin]].m_dualQuat.m_real;
+
+            skinQuat = MCore::DualQuaternion(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
+            for (AZ::u32 i = influenceBegin; i < influenceEnd; ++i)
+            {
+                // invert the dual quat of the influence by negating its weight when it's in the opposite hemisphere
+                const MCore::DualQuaternion& influenceQuat = boneInfos[boneNumbers[i]].m_dualQuat;
+                const float weight = (influenceQuat.m_real.Dot(pivotQuat) < 0.0f) ? -weights[i] : weights[i];
+
+                // weighted sum
+                skinQuat += influenceQuat * weight;
+            }
+
+            // normalize the dual quaternion
+            skinQuat.Normalize();
+            return true;
+        };
+
+        // vertices without skinning influences keep their values
+        MCore::DualQuaternion skinQuat;
 
         // if there are tangents and bitangents to skin
         if (tangents && bitangents)
         {
             for (AZ::u32 v = startVertex; v < endVertex; ++v)
             {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-                bitangent = bitangents[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
+                if (calcSkinQuat(v, skinQuat))
                 {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = skinQuat.TransformVector(bitangent);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = bitangent;
+                    positions[v] = skinQuat.TransformPoint(positions[v]);
+                    normals[v] = skinQuat.TransformVector(normals[v]);
+                    tangents[v].Set(skinQuat.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+                    bitangents[v] = skinQuat.TransformVector(bitangents[v]);
                 }
             }
         }
@@ -203,54 +185,11 @@ namespace EMotionFX
         {
             for (AZ::u32 v = startVertex; v < endVertex; ++v)
             {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
+                if (calcSkinQuat(v, skinQuat))
                 {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
+                    positions[v] = skinQuat.TransformPoint(positions[v]);
+                    normals[v] = skinQuat.TransformVector(normals[v]);
+                    tangents[v].Set(skinQuat.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
                 }
             }
         }
@@ -258,48 +197,10 @@ namespace EMotionFX
         {
             for (AZ::u32 v = startVertex; v < endVertex; ++v)
             {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
+                if (calcSkinQuat(v, skinQuat))
                 {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
+                    positions[v] = skinQuat.TransformPoint(positions[v]);
+                    normals[v] = skinQuat.TransformVector(normals[v]);
                 }
             }
         }
@@ -314,6 +215,7 @@ namespace EMotionFX
 
         // clear the bone information array, but don't free the currently allocated/reserved memory
         m_bones.clear();
+        m_influences.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -353,8 +255,14 @@ namespace EMotionFX
             }
         }
 
+        const AZ::u32* orgVerts = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        m_influences.Init(skinningLayer, orgVerts, m_mesh->GetNumVertices());
+
         if (m_useTaskGraph)
         {
+            // Reinitializing rebuilds the batches from scratch
+            m_taskGraph.Reset();
+
             // Prepare the task graph
             // Split up the to be skinned vertices into batches. As the mesh does not change at runtime, the task graph can
             // be prepared at init time and be reused at runtime.
@@ -371,7 +279,7 @@ namespace EMotionFX
                     taskDescriptor,
                     [this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRange(m_mesh, startVertex, endVertex, m_bones, m_influences);
                     });
             }
         }
@@ -15,6 +15,7 @@
 #include <MCore/Source/DualQuaternion.h>
 #include "Mesh.h"
 #include "MeshDeformer.h"
+#include "SkinningInfoVertexAttributeLayer.h"
 
 namespace EMotionFX
 {
@@ -134,11 +135,13 @@ namespace EMotionFX
          * @param startVertex The start vertex index to start skinning.
          * @param endVertex The end vertex index for the range to be skinned.
          * @param boneInfos The pre-calculated skinning matrices shared across the skinning process.
+         * @param influences The skinning influences of the mesh vertices.
          */
-        static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
+        static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const SkinInfluenceArrays& influences);
 
         //! Number of vertices per batch/job used for multi-threaded software skinning.
         static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
+        SkinInfluenceArrays m_influences; //!< The influences of the mesh vertices, in the order of the vertices.
         AZ::TaskGraph m_taskGraph;
         bool m_useTaskGraph = true;
 
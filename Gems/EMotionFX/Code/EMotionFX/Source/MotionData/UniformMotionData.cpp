@@ -27,6 +27,23 @@
 
 namespace EMotionFX
 {
+    namespace UniformMotionDataInternal
+    {
+        AZ::Vector3 Lerp(const AZStd::vector<AZ::PackedVector3f>& values, size_t indexA, size_t indexB, float t)
+        {
+            return AZ::Vector3(values[indexA]).Lerp(AZ::Vector3(values[indexB]), t);
+        }
+
+        void SetSamples(AZStd::vector<AZ::PackedVector3f>& samples, const AZStd::vector<AZ::Vector3>& values)
+        {
+            samples.resize(values.size());
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                samples[i] = AZ::PackedVector3f(values[i]);
+            }
+        }
+    } // namespace UniformMotionDataInternal
+
     UniformMotionData::~UniformMotionData()
     {
         ClearAllData();
@@ -88,11 +105,11 @@ namespace EMotionFX
             {
                 const float keyTime = s * sampleSpacing;
                 const Transform transform = motionData->SampleJointTransform(keyTime, i);
-                if (posAnimated) m_jointData[i].m_positions[s] = transform.m_position;
+                if (posAnimated) m_jointData[i].m_positions[s] = AZ::PackedVector3f(transform.m_position);
                 if (rotAnimated) m_jointData[i].m_rotations[s] = transform.m_rotation.GetNormalized();
                 EMFX_SCALECODE
                 (
-                    if (scaleAnimated) m_jointData[i].m_scales[s] = transform.m_scale;
+                    if (scaleAnimated) m_jointData[i].m_scales[s] = AZ::PackedVector3f(transform.m_scale);
                 )
             }
         }
@@ -155,10 +172,10 @@ namespace EMotionFX
         {
             const StaticJointData& staticJointData = m_staticJointData[transformDataIndex];
             const JointData& jointData = m_jointData[transformDataIndex];
-            result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
+            result.m_position = !jointData.m_positions.empty() ? UniformMotionDataInternal::Lerp(jointData.m_positions, indexA, indexB, t) : staticJointData.m_staticTransform.m_position;
             result.m_rotation = !jointData.m_rotations.empty() ? jointData.m_rotations[indexA].ToQuaternion().NLerp(jointData.m_rotations[indexB].ToQuaternion(), t) : staticJointData.m_staticTransform.m_rotation;
 #ifndef EMFX_SCALE_DISABLED
-            result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
+            result.m_scale = !jointData.m_scales.empty() ? UniformMotionDataInternal::Lerp(jointData.m_scales, indexA, indexB, t) : staticJointData.m_staticTransform.m_scale;
 #endif
         }
         else
@@ -223,11 +240,11 @@ namespace EMotionFX
             {
                 const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
                 const JointData& jointData = m_jointData[jointDataIndex];
-                result.m_position = !jointData.m_positions.empty() ? jointData.m_positions[indexA].Lerp(jointData.m_positions[indexB], t) : staticJointData.m_staticTransform.m_position;
+                result.m_position = !jointData.m_positions.empty() ? UniformMotionDataInternal::Lerp(jointData.m_positions, indexA, indexB, t) : staticJointData.m_staticTransform.m_position;
                 result.m_rotation = !jointData.m_rotations.empty() ? jointData.m_rotations[indexA].ToQuaternion().NLerp(jointData.m_rotations[indexB].ToQuaternion(), t) : staticJointData.m_staticTransform.m_rotation;
 
 #ifndef EMFX_SCALE_DISABLED
-                result.m_scale = !jointData.m_scales.empty() ? jointData.m_scales[indexA].Lerp(jointData.m_scales[indexB], t) : staticJointData.m_staticTransform.m_scale;
+                result.m_scale = !jointData.m_scales.empty() ? UniformMotionDataInternal::Lerp(jointData.m_scales, indexA, indexB, t) : staticJointData.m_staticTransform.m_scale;
 #endif
             }
             else
@@ -429,7 +446,7 @@ namespace EMotionFX
 
     MotionData::Vector3Key UniformMotionData::GetJointPositionSample(size_t jointDataIndex, size_t sampleIndex) const
     {
-        return { static_cast<float>(m_sampleSpacing * sampleIndex), m_jointData[jointDataIndex].m_positions[sampleIndex] };
+        return { static_cast<float>(m_sampleSpacing * sampleIndex), AZ::Vector3(m_jointData[jointDataIndex].m_positions[sampleIndex]) };
     }
 
     MotionData::QuaternionKey UniformMotionData::GetJointRotationSample(size_t jointDataIndex, size_t sampleIndex) const
@@ -440,7 +457,7 @@ namespace EMotionFX
 #ifndef EMFX_SCALE_DISABLED
     MotionData::Vector3Key UniformMotionData::GetJointScaleSample(size_t jointDataIndex, size_t sampleIndex) const
     {
-        return { static_cast<float>(m_sampleSpacing * sampleIndex), m_jointData[jointDataIndex].m_scales[sampleIndex] };
+        return { static_cast<float>(m_sampleSpacing * sampleIndex), AZ::Vector3(m_jointData[jointDataIndex].m_scales[sampleIndex]) };
     }
 #endif
 
@@ -558,7 +575,7 @@ namespace EMotionFX
 
     void UniformMotionData::SetJointPositionSample(size_t jointDataIndex, size_t sampleIndex, const AZ::Vector3& position)
     {
-        m_jointData[jointDataIndex].m_positions[sampleIndex] = position;
+        m_jointData[jointDataIndex].m_positions[sampleIndex] = AZ::PackedVector3f(position);
     }
 
     void UniformMotionData::SetJointRotationSample(size_t jointDataIndex, size_t sampleIndex, const AZ::Quaternion& rotation)
@@ -569,7 +586,7 @@ namespace EMotionFX
 #ifndef EMFX_SCALE_DISABLED
     void UniformMotionData::SetJointScaleSample(size_t jointDataIndex, size_t sampleIndex, const AZ::Vector3& scale)
     {
-        m_jointData[jointDataIndex].m_scales[sampleIndex] = scale;
+        m_jointData[jointDataIndex].m_scales[sampleIndex] = AZ::PackedVector3f(scale);
     }
 #endif
 
@@ -588,7 +605,7 @@ namespace EMotionFX
         AZ_Error("EMotionFX", positions.size() == m_numSamples, "Expecting positions vector to be of size %d instead of %d.", m_numSamples, positions.size());
         if (positions.size() == m_numSamples)
         {
-            m_jointData[jointDataIndex].m_positions = positions;
+            UniformMotionDataInternal::SetSamples(m_jointData[jointDataIndex].m_positions, positions);
         }
     }
 
@@ -610,7 +627,7 @@ namespace EMotionFX
         AZ_Error("EMotionFX", scales.size() == m_numSamples, "Expecting scales vector to be of size %d instead of %d.", m_numSamples, scales.size());
         if (scales.size() == m_numSamples)
         {
-            m_jointData[jointDataIndex].m_scales = scales;
+            UniformMotionDataInternal::SetSamples(m_jointData[jointDataIndex].m_scales, scales);
         }
     }
 #endif
@@ -646,9 +663,9 @@ namespace EMotionFX
     {
         for (JointData& jointData : m_jointData)
         {
-            for (AZ::Vector3& pos : jointData.m_positions)
+            for (AZ::PackedVector3f& pos : jointData.m_positions)
             {
-                pos *= scaleFactor;
+                pos = AZ::PackedVector3f(AZ::Vector3(pos) * scaleFactor);
             }
         }
     }
@@ -660,8 +677,8 @@ namespace EMotionFX
         size_t indexB;
         CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
 
-        const AZStd::vector<AZ::Vector3>& values = m_jointData[jointDataIndex].m_positions;
-        return !values.empty() ? values[indexA].Lerp(values[indexB], t) : m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        const AZStd::vector<AZ::PackedVector3f>& values = m_jointData[jointDataIndex].m_positions;
+        return !values.empty() ? UniformMotionDataInternal::Lerp(values, indexA, indexB, t) : m_staticJointData[jointDataIndex].m_staticTransform.m_position;
     }
 
     AZ::Quaternion UniformMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
@@ -683,8 +700,8 @@ namespace EMotionFX
         size_t indexB;
         CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
 
-        const AZStd::vector<AZ::Vector3>& values = m_jointData[jointDataIndex].m_scales;
-        return !values.empty() ? values[indexA].Lerp(values[indexB], t) : m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        const AZStd::vector<AZ::PackedVector3f>& values = m_jointData[jointDataIndex].m_scales;
+        return !values.empty() ? UniformMotionDataInternal::Lerp(values, indexA, indexB, t) : m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
     }
 #endif
 
@@ -695,20 +712,20 @@ namespace EMotionFX
         size_t indexB;
         CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
 
-        const AZStd::vector<AZ::Vector3>& posValues = m_jointData[jointDataIndex].m_positions;
+        const AZStd::vector<AZ::PackedVector3f>& posValues = m_jointData[jointDataIndex].m_positions;
         const AZStd::vector<MCore::Compressed16BitQuaternion>& rotValues = m_jointData[jointDataIndex].m_rotations;
-        const AZStd::vector<AZ::Vector3>& scaleValues = m_jointData[jointDataIndex].m_scales;
 #ifndef EMFX_SCALE_DISABLED
-        const StaticJointData& staticData = m_staticJointData[jointDataIndex];
+        const AZStd::vector<AZ::PackedVector3f>& scaleValues = m_jointData[jointDataIndex].m_scales;
 #endif
+        const StaticJointData& staticData = m_staticJointData[jointDataIndex];
 
         return Transform
         (
-            !posValues.empty() ? posValues[indexA].Lerp(posValues[indexB], t) : staticData.m_staticTransform.m_scale,
+            !posValues.empty() ? UniformMotionDataInternal::Lerp(posValues, indexA, indexB, t) : staticData.m_staticTransform.m_position,
             !rotValues.empty() ? rotValues[indexA].ToQuaternion().NLerp(rotValues[indexB].ToQuaternion(), t) : staticData.m_staticTransform.m_rotation
 
 #ifndef EMFX_SCALE_DISABLED
-            ,!scaleValues.empty() ? scaleValues[indexA].Lerp(scaleValues[indexB], t) : staticData.m_staticTransform.m_scale
+            ,!scaleValues.empty() ? UniformMotionDataInternal::Lerp(scaleValues, indexA, indexB, t) : staticData.m_staticTransform.m_scale
 #endif
         );
     }
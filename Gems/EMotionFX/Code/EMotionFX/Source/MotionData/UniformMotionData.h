@@ -13,6 +13,7 @@
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/Transform.h>
 
+#include <AzCore/Math/PackedVector3.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/Memory.h>
@@ -112,12 +113,13 @@ namespace EMotionFX
         void UpdateDuration() override;
 
     private:
+        // The positions and scales are stored packed, as an AZ::Vector3 takes the size of four floats.
         struct EMFX_API JointData
         {
-            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::PackedVector3f> m_positions;
             AZStd::vector<MCore::Compressed16BitQuaternion> m_rotations;
 #ifndef EMFX_SCALE_DISABLED
-            AZStd::vector<AZ::Vector3> m_scales;
+            AZStd::vector<AZ::PackedVector3f> m_scales;
 #endif
         };
 
@@ -145,6 +145,9 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_crowdPoseCache.Clear();
+
+        PrepareSamplingBudget(timePassedInSeconds);
 
         for (const ScheduleStep& currentStep : m_steps)
         {
@@ -177,18 +180,7 @@ namespace EMotionFX
                     }
 
                     // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
+                    const bool sampleMotions = UpdateMotionSamplingTimer(actorInstance, timePassedInSeconds);
 
                     // update the actor instance
                     actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
@@ -15,9 +15,95 @@
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/TransformData.h>
+#include <AzCore/Math/SimdMath.h>
 
 namespace EMotionFX
 {
+    namespace PoseInternal
+    {
+        // Number of transforms blended together by BlendLocalSpaceTransforms().
+        constexpr size_t BlendBatchSize = 4;
+
+        // Blend the local space transforms of a set of nodes into the ones of the destination pose, like Transform::Blend() does.
+        // The quaternion interpolations of BlendBatchSize nodes are done together with one node per SIMD lane, so the dot products
+        // and the normalizations don't need any horizontal operations.
+        template<typename NodeIndexFunction>
+        void BlendLocalSpaceTransforms(Pose& pose, const Pose& destPose, size_t numNodes, const NodeIndexFunction& getNodeIndex, float weight)
+        {
+            using namespace AZ::Simd;
+
+            const Vec4::FloatType weights = Vec4::Splat(weight);
+            const Vec4::FloatType negatedWeights = Vec4::Splat(-weight);
+            const Vec4::FloatType oneMinusWeights = Vec4::Splat(1.0f - weight);
+
+            size_t i = 0;
+            for (; i + BlendBatchSize <= numNodes; i += BlendBatchSize)
+            {
+                Transform* transforms[BlendBatchSize];
+                const Transform* destTransforms[BlendBatchSize];
+                float fromValues[4][BlendBatchSize];
+                float toValues[4][BlendBatchSize];
+                for (size_t lane = 0; lane < BlendBatchSize; ++lane)
+                {
+                    const size_t nodeIndex = getNodeIndex(i + lane);
+                    pose.GetLocalSpaceTransform(nodeIndex);
+                    transforms[lane] = &pose.GetLocalSpaceTransformDirect(nodeIndex);
+                    destTransforms[lane] = &destPose.GetLocalSpaceTransform(nodeIndex);
+
+                    for (int element = 0; element < 4; ++element)
+                    {
+                        fromValues[element][lane] = transforms[lane]->m_rotation.GetElement(element);
+                        toValues[element][lane] = destTransforms[lane]->m_rotation.GetElement(element);
+                    }
+
+                    transforms[lane]->m_position = MCore::LinearInterpolate<AZ::Vector3>(transforms[lane]->m_position, destTransforms[lane]->m_position, weight);
+                    EMFX_SCALECODE
+                    (
+                        transforms[lane]->m_scale = MCore::LinearInterpolate<AZ::Vector3>(transforms[lane]->m_scale, destTransforms[lane]->m_scale, weight);
+                    )
+                }
+
+                Vec4::FloatType from[4];
+                Vec4::FloatType to[4];
+                Vec4::FloatType dot = Vec4::ZeroFloat();
+                for (int element = 0; element < 4; ++element)
+                {
+                    from[element] = Vec4::LoadUnaligned(fromValues[element]);
+                    to[element] = Vec4::LoadUnaligned(toValues[element]);
+                    dot = Vec4::Madd(from[element], to[element], dot);
+                }
+
+                // Take the shortest path, like MCore::NLerp() does.
+                const Vec4::FloatType toWeights = Vec4::Select(negatedWeights, weights, Vec4::CmpLt(dot, Vec4::ZeroFloat()));
+
+                Vec4::FloatType lengthSq = Vec4::ZeroFloat();
+                for (int element = 0; element < 4; ++element)
+                {
+                    from[element] = Vec4::Madd(to[element], toWeights, Vec4::Mul(from[element], oneMinusWeights));
+                    lengthSq = Vec4::Madd(from[element], from[element], lengthSq);
+                }
+
+                const Vec4::FloatType invLength = Vec4::SqrtInv(lengthSq);
+                for (int element = 0; element < 4; ++element)
+                {
+                    Vec4::StoreUnaligned(fromValues[element], Vec4::Mul(from[element], invLength));
+                }
+
+                for (size_t lane = 0; lane < BlendBatchSize; ++lane)
+                {
+                    transforms[lane]->m_rotation.Set(fromValues[0][lane], fromValues[1][lane], fromValues[2][lane], fromValues[3][lane]);
+                }
+            }
+
+            for (; i < numNodes; ++i)
+            {
+                const size_t nodeIndex = getNodeIndex(i);
+                Transform& curTransform = const_cast<Transform&>(pose.GetLocalSpaceTransform(nodeIndex));
+                curTransform.Blend(destPose.GetLocalSpaceTransform(nodeIndex), weight);
+            }
+        }
+    } // namespace PoseInternal
+
     // default constructor
     Pose::Pose()
     {
@@ -833,13 +919,9 @@ namespace EMotionFX
     {
         if (m_actorInstance)
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            PoseInternal::BlendLocalSpaceTransforms(*this, *destPose, enabledNodes.size(),
+                [&enabledNodes](size_t i) { return enabledNodes[i]; }, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -858,12 +940,8 @@ namespace EMotionFX
         }
         else
         {
-            const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
-            }
+            PoseInternal::BlendLocalSpaceTransforms(*this, *destPose, m_actor->GetSkeleton()->GetNumNodes(),
+                [](size_t i) { return i; }, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -142,6 +142,9 @@ namespace EMotionFX
             return;
         }
 
+        // Let the physics lower the fidelity of the ragdoll while the character is culled.
+        m_ragdoll->SetVisible(m_actorInstance->GetIsVisible());
+
         bool disableRagdollQueued = false;
 
         // Case 1: Ragdoll used this frame and was already used last frame.
@@ -48,6 +48,7 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_crowdPoseCache.Clear();
 
         // propagate root actor instance visibility to their attachments
         const size_t numRootActorInstances = GetActorManager().GetNumRootActorInstances();
@@ -62,6 +63,8 @@ namespace EMotionFX
             rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
         }
 
+        PrepareSamplingBudget(timePassedInSeconds);
+
         // process all root actor instances, and execute them and their attachments
         for (size_t i = 0; i < numRootActorInstances; ++i)
         {
@@ -86,18 +89,7 @@ namespace EMotionFX
         const bool isVisible = actorInstance->GetIsVisible();
 
         // check if we want to sample motions
-        bool sampleMotions = false;
-        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-        {
-            sampleMotions = true;
-            actorInstance->SetMotionSamplingTimer(0.0f);
-
-            if (isVisible)
-            {
-                m_numSampled.Increment();
-            }
-        }
+        const bool sampleMotions = UpdateMotionSamplingTimer(actorInstance, timePassedInSeconds);
 
         if (isVisible)
         {
@@ -329,4 +329,37 @@ namespace EMotionFX
 
         return result;
     }
+
+
+    void SkinInfluenceArrays::Init(SkinningInfoVertexAttributeLayer* layer, const uint32* orgVerts, uint32 numVertices)
+    {
+        Clear();
+        if (!layer || !orgVerts)
+        {
+            return;
+        }
+
+        m_influenceOffsets.resize_no_construct(numVertices + 1);
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            m_influenceOffsets[v] = static_cast<uint32>(m_weights.size());
+
+            const uint32 orgVertex = orgVerts[v];
+            const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+                m_boneNumbers.emplace_back(influence->GetBoneNr());
+                m_weights.emplace_back(influence->GetWeight());
+            }
+        }
+        m_influenceOffsets[numVertices] = static_cast<uint32>(m_weights.size());
+    }
+
+    void SkinInfluenceArrays::Clear()
+    {
+        m_influenceOffsets.clear();
+        m_boneNumbers.clear();
+        m_weights.clear();
+    }
 } // namespace EMotionFX
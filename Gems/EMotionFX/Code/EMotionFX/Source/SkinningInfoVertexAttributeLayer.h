@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include "EMotionFXConfig.h"
 #include "VertexAttributeLayer.h"
 #include <MCore/Source/Array2D.h>
@@ -265,4 +266,49 @@ namespace EMotionFX
          */
         ~SkinningInfoVertexAttributeLayer();
     };
+
+
+    /**
+     * The skinning influences of the vertices of a mesh, stored as flat arrays in the order of the mesh vertices.
+     * The CPU skinning deformers walk these linearly, rather than looking up the original vertex number and reading the
+     * jagged array of the skinning info layer for every vertex.
+     */
+    class EMFX_API SkinInfluenceArrays
+    {
+    public:
+        /**
+         * Build the arrays from the skinning info, using the bone numbers currently set in the influences.
+         * @param layer The skinning info layer of the mesh.
+         * @param orgVerts The original vertex numbers of the vertices of the mesh.
+         * @param numVertices The number of vertices of the mesh.
+         */
+        void Init(SkinningInfoVertexAttributeLayer* layer, const uint32* orgVerts, uint32 numVertices);
+
+        /**
+         * Release the arrays.
+         */
+        void Clear();
+
+        /**
+         * Get the number of vertices the arrays were built for.
+         * @result The number of vertices.
+         */
+        MCORE_INLINE uint32 GetNumVertices() const                          { return m_influenceOffsets.empty() ? 0 : static_cast<uint32>(m_influenceOffsets.size() - 1); }
+
+        /**
+         * Get the first influence of a vertex, its influences are in range of [GetInfluenceBegin(vertexNr)..GetInfluenceEnd(vertexNr)-1].
+         * @param vertexNr The vertex number.
+         * @result The index of the first influence of the vertex.
+         */
+        MCORE_INLINE uint32 GetInfluenceBegin(uint32 vertexNr) const        { return m_influenceOffsets[vertexNr]; }
+        MCORE_INLINE uint32 GetInfluenceEnd(uint32 vertexNr) const          { return m_influenceOffsets[vertexNr + 1]; }
+
+        MCORE_INLINE const uint16* GetBoneNumbers() const                   { return m_boneNumbers.data(); }
+        MCORE_INLINE const float* GetWeights() const                        { return m_weights.data(); }
+
+    private:
+        AZStd::vector<uint32>   m_influenceOffsets;     /**< The index of the first influence of every vertex, followed by the total number of influences. */
+        AZStd::vector<uint16>   m_boneNumbers;          /**< The local bone number of every influence. */
+        AZStd::vector<float>    m_weights;              /**< The weight of every influence. */
+    };
 } // namespace EMotionFX
@@ -18,6 +18,7 @@
 #include "ActorInstance.h"
 #include <EMotionFX/Source/Allocators.h>
 #include <MCore/Source/AzCoreConversions.h>
+#include <AzCore/Task/TaskAlgorithms.h>
 
 
 namespace EMotionFX
@@ -36,6 +37,7 @@ namespace EMotionFX
     {
         m_nodeNumbers.clear();
         m_boneMatrices.clear();
+        m_influences.Clear();
     }
 
 
@@ -69,6 +71,7 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->m_nodeNumbers    = m_nodeNumbers;
         result->m_boneMatrices   = m_boneMatrices;
+        result->m_influences     = m_influences;
 
         // return the result
         return result;
@@ -103,99 +106,78 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        if (m_influences.GetNumVertices() != numVertices)
+        {
+            m_influences.Init(layer, orgVerts, numVertices);
+        }
+
+        // Skin the batches of vertices simultaneously, small meshes are skinned on the calling thread.
+        AZ::TaskAlgorithmDesc taskDesc;
+        taskDesc.m_taskDescriptor = { "SoftSkinVertexRange", "Animation" };
+        taskDesc.m_grainSize = s_numVerticesPerBatch;
+        AZ::TaskAlgorithms::parallel_for_range(uint32(0), numVertices, [this, positions, normals, tangents, bitangents](uint32 startVertex, uint32 endVertex)
+            {
+                SkinVertexRange(startVertex, endVertex, positions, normals, tangents, bitangents);
+            }, taskDesc);
     }
 
 
-    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const
     {
-        AZ::Vector3 newPos, newNormal;
-        AZ::Vector3 vtxPos, normal;
-        AZ::Vector4 tangent, newTangent;
-        AZ::Vector3 bitangent, newBitangent;
+        const AZ::Matrix3x4* boneMatrices = m_boneMatrices.data();
+        const uint16* boneNumbers = m_influences.GetBoneNumbers();
+        const float* weights = m_influences.GetWeights();
+
+        // Blend the bone matrices of the influences first, so every vertex attribute is transformed only once.
+        // The matrix rows are SIMD vectors, this is a fused multiply-add of 3 vectors per influence.
+        const auto calcSkinningMatrix = [this, boneMatrices, boneNumbers, weights](uint32 vertexNr)
+        {
+            AZ::Matrix3x4 skinningMatrix = AZ::Matrix3x4::CreateZero();
+            const uint32 influenceEnd = m_influences.GetInfluenceEnd(vertexNr);
+            for (uint32 i = m_influences.GetInfluenceBegin(vertexNr); i < influenceEnd; ++i)
+            {
+                skinningMatrix += boneMatrices[boneNumbers[i]] * weights[i];
+            }
+            return skinningMatrix;
+        };
 
         // if there are tangents and bitangents to skin
         if (tangents && bitangents)
         {
             for (uint32 v = startVertex; v < endVertex; ++v)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-                newBitangent = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-                bitangent = bitangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &bitangent, &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
+                const AZ::Matrix3x4 skinningMatrix = calcSkinningMatrix(v);
 
                 // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-                bitangents[v]   = newBitangent;
+                positions[v]    = skinningMatrix * positions[v];
+                normals[v]      = skinningMatrix.TransformVector(normals[v]);
+                tangents[v].Set(skinningMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+                bitangents[v]   = skinningMatrix.TransformVector(bitangents[v]);
             }
         }
         else if (tangents) // only tangents but no bitangents
         {
             for (uint32 v = startVertex; v < endVertex; ++v)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &newPos, &newNormal, &newTangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
+                const AZ::Matrix3x4 skinningMatrix = calcSkinningMatrix(v);
 
                 // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
+                positions[v]    = skinningMatrix * positions[v];
+                normals[v]      = skinningMatrix.TransformVector(normals[v]);
+                tangents[v].Set(skinningMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
             }
         }
         else // there are no tangents and bitangents to skin
         {
             for (uint32 v = startVertex; v < endVertex; ++v)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-
-                // skin the vertex
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &newPos, &newNormal, influence->GetWeight());
-                }
+                const AZ::Matrix3x4 skinningMatrix = calcSkinningMatrix(v);
 
                 // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
+                positions[v]    = skinningMatrix * positions[v];
+                normals[v]      = skinningMatrix.TransformVector(normals[v]);
             }
         }
     }
@@ -211,6 +193,7 @@ namespace EMotionFX
         // clear the bone information array
         m_boneMatrices.clear();
         m_nodeNumbers.clear();
+        m_influences.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -252,5 +235,8 @@ namespace EMotionFX
                 influence->SetBoneNr(static_cast<uint16>(boneIndex));
             }
         }
+
+        const AZ::u32* orgVerts = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        m_influences.Init(skinningLayer, orgVerts, m_mesh->GetNumVertices());
     }
 } // namespace EMotionFX
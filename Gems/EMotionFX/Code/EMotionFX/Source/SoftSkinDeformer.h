@@ -13,6 +13,7 @@
 #include <AzCore/Math/Transform.h>
 #include "EMotionFXConfig.h"
 #include "MeshDeformer.h"
+#include "SkinningInfoVertexAttributeLayer.h"
 
 
 namespace EMotionFX
@@ -120,6 +121,10 @@ namespace EMotionFX
     protected:
         AZStd::vector<AZ::Matrix3x4>    m_boneMatrices;
         AZStd::vector<size_t>           m_nodeNumbers;
+        SkinInfluenceArrays             m_influences;       /**< The influences of the mesh vertices, in the order of the vertices. */
+
+        //! Minimum number of vertices per batch/task used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 4096;
 
         /**
          * Default constructor.
@@ -143,6 +148,6 @@ namespace EMotionFX
             return foundBoneIndex != end(m_nodeNumbers) ? AZStd::distance(begin(m_nodeNumbers), foundBoneIndex) : InvalidIndex;
         }
 
-        void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+        void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const;
     };
 } // namespace EMotionFX
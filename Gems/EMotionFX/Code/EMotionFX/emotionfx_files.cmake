@@ -15,6 +15,7 @@ set(FILES
     Source/ActorInstanceBus.h
     Source/ActorManager.cpp
     Source/ActorManager.h
+    Source/ActorUpdateScheduler.cpp
     Source/ActorUpdateScheduler.h
     Source/Algorithms.h
     Source/Allocators.cpp
@@ -32,6 +33,8 @@ set(FILES
     Source/ConstraintTransform.h
     Source/ConstraintTransformRotationAngles.h
     Source/ConstraintTransformRotationAngles.cpp
+    Source/CrowdPoseCache.cpp
+    Source/CrowdPoseCache.h
     Source/DebugDraw.h
     Source/DebugDraw.cpp
     Source/DualQuatSkinDeformer.cpp
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphBindPoseNode.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/CrowdPoseCache.h>
+#include <EMotionFX/Source/Parameter/FloatSliderParameter.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/AttributeFloat.h>
+#include <Tests/AnimGraphFixture.h>
+
+namespace EMotionFX
+{
+    class CrowdPoseCacheFixture
+        : public AnimGraphFixture
+    {
+    public:
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+
+            AnimGraphNode* state = aznew AnimGraphBindPoseNode();
+            m_rootStateMachine->AddChildNode(state);
+            m_rootStateMachine->SetEntryState(state);
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            AddValueParameter(azrtti_typeid<FloatSliderParameter>(), "speed");
+
+            m_otherActorInstance = ActorInstance::Create(m_actor.get());
+            m_otherAnimGraphInstance = AnimGraphInstance::Create(m_animGraph.get(), m_otherActorInstance, m_motionSet);
+            m_otherActorInstance->SetAnimGraphInstance(m_otherAnimGraphInstance);
+        }
+
+        void TearDown() override
+        {
+            m_otherActorInstance->Destroy();
+            AnimGraphFixture::TearDown();
+        }
+
+        bool Output(CrowdPoseCache& cache, AnimGraphInstance* animGraphInstance)
+        {
+            animGraphInstance->Update(0.0f);
+            return cache.Output(animGraphInstance, animGraphInstance->GetActorInstance()->GetTransformData()->GetCurrentPose());
+        }
+
+        ActorInstance* m_otherActorInstance = nullptr;
+        AnimGraphInstance* m_otherAnimGraphInstance = nullptr;
+    };
+
+    TEST_F(CrowdPoseCacheFixture, EqualInstancesShareTheirPose)
+    {
+        CrowdPoseCache cache;
+        ParamSetValue<MCore::AttributeFloat, float>("speed", 1.0f);
+        static_cast<MCore::AttributeFloat*>(m_otherAnimGraphInstance->GetParameterValue(0))->SetValue(1.001f);
+
+        EXPECT_FALSE(Output(cache, m_animGraphInstance));
+        EXPECT_TRUE(Output(cache, m_otherAnimGraphInstance));
+        EXPECT_EQ(cache.GetNumSharedPoses(), 1);
+
+        // Parameter values that differ by more than the quantization step don't get shared.
+        cache.Clear();
+        static_cast<MCore::AttributeFloat*>(m_otherAnimGraphInstance->GetParameterValue(0))->SetValue(2.0f);
+        EXPECT_FALSE(Output(cache, m_animGraphInstance));
+        EXPECT_FALSE(Output(cache, m_otherAnimGraphInstance));
+        EXPECT_EQ(cache.GetNumSharedPoses(), 0);
+    }
+} // namespace EMotionFX
@@ -44,4 +44,48 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, SampledActorInstancesStayWithinBudget)
+    {
+        ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            actorInstances.emplace_back(ActorInstance::Create(actor.get()));
+        }
+
+        auto findPostponed = [&actorInstances]()
+        {
+            return AZStd::find_if(actorInstances.begin(), actorInstances.end(), [](const ActorInstance* actorInstance)
+            {
+                return actorInstance->GetMotionSamplingTimer() > 0.0f;
+            });
+        };
+
+        // All the actor instances are due every frame, but only two of them can sample their motions.
+        scheduler->SetMaxSampledActorInstances(2);
+        scheduler->Execute(0.1f);
+        EXPECT_EQ(scheduler->GetNumSampledActorInstances(), 2);
+        const auto postponed = findPostponed();
+        ASSERT_NE(postponed, actorInstances.end()) << "Expected one of the actor instances to be postponed.";
+        const ActorInstance* postponedActorInstance = *postponed;
+
+        // The postponed actor instance waited the longest, so it gets to sample first on the next frame.
+        scheduler->Execute(0.1f);
+        EXPECT_EQ(scheduler->GetNumSampledActorInstances(), 2);
+        EXPECT_EQ(postponedActorInstance->GetMotionSamplingTimer(), 0.0f);
+
+        // Without a budget, every actor instance samples again.
+        scheduler->SetMaxSampledActorInstances(0);
+        scheduler->Execute(0.1f);
+        EXPECT_EQ(scheduler->GetNumSampledActorInstances(), 3);
+        EXPECT_EQ(findPostponed(), actorInstances.end());
+
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
 } // namespace EMotionFX
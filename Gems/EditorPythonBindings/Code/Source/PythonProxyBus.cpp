@@ -21,6 +21,7 @@
 #include <AzCore/std/optional.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzToolsFramework/API/EditorPythonConsoleBus.h>
+#include <AzToolsFramework/API/ToolsApplicationAPI.h>
 
 namespace EditorPythonBindings
 {
@@ -350,6 +351,97 @@ namespace EditorPythonBindings
         };
     }
 
+    namespace Internal
+    {
+        //! Records EBus calls from Python to invoke them all at once inside a single undo batch, so that bulk edits
+        //! make a single undo step and the editor only refreshes its views once the whole batch has run.
+        //! Used either by calling run() or as a context manager, running the recorded calls when the scope exits.
+        class PythonProxyBatch final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PythonProxyBatch, AZ::SystemAllocator, 0);
+
+            PythonProxyBatch(AZStd::string_view label)
+                : m_label(label)
+            {
+            }
+
+            void Add(AZStd::string_view busName, EventType eventType, AZStd::string_view eventName, pybind11::args pythonArgs)
+            {
+                AZ::BehaviorContext* behaviorContext(nullptr);
+                AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+                if (!behaviorContext)
+                {
+                    AZ_Error("python", false, "A behavior context is required to batch EBus calls!");
+                    return;
+                }
+
+                auto behaviorEBusEntry = behaviorContext->m_ebuses.find(busName);
+                if (behaviorEBusEntry == behaviorContext->m_ebuses.end() || !Scope::IsBehaviorFlaggedForEditor(behaviorEBusEntry->second->m_attributes))
+                {
+                    AZ_Warning("python", false, "EBus %.*s does not exist or is not exposed to Python, the call is not batched", aznumeric_cast<int>(busName.size()), busName.data());
+                    return;
+                }
+
+                m_calls.push_back({ behaviorEBusEntry->second, eventType, eventName, pythonArgs });
+            }
+
+            pybind11::list Run()
+            {
+                AzToolsFramework::ScopedUndoBatch undoBatch(m_label.c_str());
+
+                // the calls are swapped out first, so that a call failing with an exception leaves an empty batch behind
+                AZStd::vector<BatchedCall> calls;
+                calls.swap(m_calls);
+
+                pybind11::list results;
+                for (const BatchedCall& call : calls)
+                {
+                    results.append(InvokeEbus(*call.m_ebus, call.m_eventType, call.m_eventName, call.m_args));
+                }
+                return results;
+            }
+
+            size_t GetCallCount() const
+            {
+                return m_calls.size();
+            }
+
+            void Enter()
+            {
+                // direct EBus calls made inside the scope join the same undo batch as the recorded ones
+                m_scopedUndoBatch = AZStd::make_unique<AzToolsFramework::ScopedUndoBatch>(m_label.c_str());
+            }
+
+            void Exit(pybind11::object exceptionType)
+            {
+                // ends the undo batch of the scope even if one of the recorded calls raises an exception
+                AZStd::unique_ptr<AzToolsFramework::ScopedUndoBatch> scopedUndoBatch = AZStd::move(m_scopedUndoBatch);
+                if (exceptionType.is_none())
+                {
+                    Run();
+                }
+                else
+                {
+                    m_calls.clear();
+                }
+            }
+
+        private:
+            struct BatchedCall
+            {
+                AZ::BehaviorEBus* m_ebus = nullptr;
+                EventType m_eventType = EventType::Broadcast;
+                AZStd::string m_eventName;
+                pybind11::args m_args;
+            };
+
+            AZStd::string m_label;
+            AZStd::vector<BatchedCall> m_calls;
+            AZStd::unique_ptr<AzToolsFramework::ScopedUndoBatch> m_scopedUndoBatch;
+        };
+    }
+
     namespace PythonProxyBusManagement
     {
         void CreateSubmodule(pybind11::module baseModule)
@@ -424,6 +516,23 @@ namespace EditorPythonBindings
                 .def("disconnect", &Internal::PythonProxyNotificationHandler::Disconnect)
                 .def("add_callback", &Internal::PythonProxyNotificationHandler::AddCallback)
                 ;
+
+            // export a way to run many EBus calls in a single undo batch
+            pybind11::class_<Internal::PythonProxyBatch>(busModule, "Batch")
+                .def(pybind11::init<AZStd::string_view>(), pybind11::arg("label") = "Python Batch")
+                .def("add", &Internal::PythonProxyBatch::Add)
+                .def("run", &Internal::PythonProxyBatch::Run)
+                .def("__len__", &Internal::PythonProxyBatch::GetCallCount)
+                .def("__enter__", [](Internal::PythonProxyBatch& self) -> Internal::PythonProxyBatch&
+                    {
+                        self.Enter();
+                        return self;
+                    }, pybind11::return_value_policy::reference)
+                .def("__exit__", [](Internal::PythonProxyBatch& self, pybind11::object exceptionType, pybind11::object, pybind11::object)
+                    {
+                        self.Exit(exceptionType);
+                    })
+                ;
         }
     }
 }
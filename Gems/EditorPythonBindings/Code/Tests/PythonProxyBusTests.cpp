@@ -558,6 +558,47 @@ namespace UnitTest
         e.Deactivate();
     }
 
+    TEST_F(PythonBusProxyTests, BatchedRequests)
+    {
+        PythonTestBroadcastRequestsHandler pythonTestBroadcastRequestsHandler;
+        pythonTestBroadcastRequestsHandler.Reflect(m_app.GetBehaviorContext());
+
+        AZ::Entity e;
+        Activate(e);
+
+        SimulateEditorBecomingInitialized();
+
+        try
+        {
+            pybind11::exec(R"(
+                import azlmbr.bus
+                batch = azlmbr.bus.Batch('Ping Batch')
+                for i in range(100):
+                    batch.add('PythonTestBroadcastRequestBus', azlmbr.bus.Broadcast, 'Ping')
+                batch.add('PythonTestBroadcastRequestBus', azlmbr.bus.Broadcast, 'SetBits', 5)
+                batch.add('PythonTestBroadcastRequestBus', azlmbr.bus.Broadcast, 'GetBits')
+                if (len(batch) != 102):
+                    raise RuntimeError('calls were not recorded')
+                results = batch.run()
+                if (len(batch) != 0 or len(results) != 102 or results[-1] != 5):
+                    raise RuntimeError('calls did not run')
+                with azlmbr.bus.Batch() as scopedBatch:
+                    for i in range(10):
+                        scopedBatch.add('PythonTestBroadcastRequestBus', azlmbr.bus.Broadcast, 'Ping')
+            )");
+        }
+        catch ([[maybe_unused]] const std::exception& e)
+        {
+            AZ_Warning("UnitTest", false, "Failed on with Python exception: %s", e.what());
+            FAIL();
+        }
+
+        EXPECT_EQ(110, pythonTestBroadcastRequestsHandler.m_pingCount);
+        EXPECT_EQ(5, pythonTestBroadcastRequestsHandler.m_bits);
+
+        e.Deactivate();
+    }
+
     TEST_F(PythonBusProxyTests, EventRequests)
     {
         enum class LogTypes
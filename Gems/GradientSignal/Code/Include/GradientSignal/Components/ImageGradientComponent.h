@@ -13,6 +13,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Ebuses/ImageGradientRequestBus.h>
@@ -100,6 +101,7 @@ namespace GradientSignal
 
         void GetSubImageData();
         float GetValueFromImageData(const AZ::Vector3& uvw, float tilingX, float tilingY, float defaultValue) const;
+        float GetImageValue(AZ::u32 x, AZ::u32 y) const;
 
         // ImageGradientRequestBus overrides...
         AZStd::string GetImageAssetPath() const override;
@@ -116,6 +118,10 @@ namespace GradientSignal
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
         mutable AZStd::shared_mutex m_imageMutex;
         GradientTransform m_gradientTransform;
-        AZStd::span<const uint8_t> m_imageData;
+        //! First channel of the image converted to floats once, stored row by row from the bottom row of the image up,
+        //! so the samples don't go through the pixel format conversion each time.
+        AZStd::vector<float> m_imageValues;
+        AZ::u32 m_imageWidth = 0;
+        AZ::u32 m_imageHeight = 0;
     };
 }
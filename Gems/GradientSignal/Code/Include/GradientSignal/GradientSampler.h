@@ -190,21 +190,28 @@ namespace GradientSignal
             }
         }
 
-        // Perform any post-fetch transformations on the gradient values (invert, levels, opacity).
-        for (auto& outValue : outValues)
+        // Perform any post-fetch transformations on the gradient values (invert, levels, opacity), one pass over all the
+        // values per transformation so the checks aren't repeated for each value.
+        if (m_invertInput)
         {
-            if (m_invertInput)
+            for (auto& outValue : outValues)
             {
                 outValue = 1.0f - outValue;
             }
+        }
+
+        // apply levels if set
+        if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        {
+            GetLevels(outValues, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+        }
 
-            // apply levels if set
-            if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        if (m_opacity != 1.0f)
+        {
+            for (auto& outValue : outValues)
             {
-                outValue = GetLevels(outValue, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+                outValue = outValue * m_opacity;
             }
-
-            outValue = outValue * m_opacity;
         }
     }
 
@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -32,6 +34,14 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Creates the Perlin 'natural' noise factor values of a list of positions, several positions at a time.
+        * Gives the same values as calling GenerateOctaveNoise for each position.
+        */
+        void GenerateOctaveNoise(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence,
+            float initialFrequency = 1.0f);
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
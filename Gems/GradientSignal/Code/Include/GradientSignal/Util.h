@@ -93,11 +93,15 @@ namespace GradientSignal
             {
                 inOutValue = (AZ::GetClamp(inOutValue, 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
             }
+            return;
         }
 
         const float inputMidReciprocal = 1.0f / inputMid;
         const float inputExtentsReciprocal = 1.0f / (inputMax - inputMin);
 
+        // The default midpoint leaves the values uncorrected, so skip the powf() calls for it.
+        const bool correctMidpoint = (inputMidReciprocal != 1.0f);
+
         for (auto& inOutValue : inOutValues)
         {
             const float inputRemapped =
@@ -106,7 +110,7 @@ namespace GradientSignal
             // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
             // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
             // align with 1/mid since it appears to be the more prevalent of the two approaches.
-            const float inputCorrected = powf(inputRemapped, inputMidReciprocal);
+            const float inputCorrected = correctMidpoint ? powf(inputRemapped, inputMidReciprocal) : inputRemapped;
 
             inOutValue = AZ::Lerp(outputMin, outputMax, inputCorrected);
         }
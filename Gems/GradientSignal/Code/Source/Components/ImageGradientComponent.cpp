@@ -13,6 +13,7 @@
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -221,6 +222,10 @@ namespace GradientSignal
 
     void ImageGradientComponent::GetSubImageData()
     {
+        m_imageValues.clear();
+        m_imageWidth = 0;
+        m_imageHeight = 0;
+
         if (!m_configuration.m_imageAsset || !m_configuration.m_imageAsset.IsReady())
         {
             return;
@@ -229,7 +234,8 @@ namespace GradientSignal
         // If we have loaded in an old image asset with an unsupported pixel format,
         // don't try to access the image data because there will be spam of asserts,
         // so just log an error message and bail out
-        AZ::RHI::Format format = m_configuration.m_imageAsset->GetImageDescriptor().m_format;
+        const AZ::RHI::ImageDescriptor& imageDescriptor = m_configuration.m_imageAsset->GetImageDescriptor();
+        AZ::RHI::Format format = imageDescriptor.m_format;
         bool isFormatSupported = AZ::RPI::IsImageDataPixelAPISupported(format);
         if (!isFormatSupported)
         {
@@ -238,58 +244,74 @@ namespace GradientSignal
             return;
         }
 
-        m_imageData = m_configuration.m_imageAsset->GetSubImageData(0, 0);
+        AZStd::span<const uint8_t> imageData = m_configuration.m_imageAsset->GetSubImageData(0, 0);
+        const AZ::u32 width = imageDescriptor.m_size.m_width;
+        const AZ::u32 height = imageDescriptor.m_size.m_height;
+        if (imageData.empty() || width == 0 || height == 0)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Entity, "ImageGradientComponent::GetSubImageData");
+
+        // Convert the pixels once here rather than on every sample. The rows are flipped on the way, because images
+        // are stored in reverse of our world axes.
+        m_imageValues.resize_no_construct(static_cast<size_t>(width) * height);
+        for (AZ::u32 y = 0; y < height; ++y)
+        {
+            float* row = m_imageValues.data() + static_cast<size_t>(y) * width;
+            const AZ::u32 imageY = (height - 1) - y;
+            for (AZ::u32 x = 0; x < width; ++x)
+            {
+                row[x] = AZ::RPI::GetImageDataPixelValue<float>(imageData, imageDescriptor, x, imageY);
+            }
+        }
+
+        m_imageWidth = width;
+        m_imageHeight = height;
+    }
+
+    float ImageGradientComponent::GetImageValue(AZ::u32 x, AZ::u32 y) const
+    {
+        // UVs outside the 0-1 range are treated as infinitely tiling, so that we behave the same as the
+        // other gradient generators.
+        return m_imageValues[static_cast<size_t>(y % m_imageHeight) * m_imageWidth + (x % m_imageWidth)];
     }
 
     float ImageGradientComponent::GetValueFromImageData(const AZ::Vector3& uvw, float tilingX, float tilingY, float defaultValue) const
     {
-        if (!m_imageData.empty())
+        if (!m_imageValues.empty())
         {
-            const AZ::RHI::ImageDescriptor& imageDescriptor = m_configuration.m_imageAsset->GetImageDescriptor();
-            auto width = imageDescriptor.m_size.m_width;
-            auto height = imageDescriptor.m_size.m_height;
-
-            if (width > 0 && height > 0)
-            {
-                // When "rasterizing" from uvs, a range of 0-1 has slightly different meanings depending on the sampler state.
-                // For repeating states (Unbounded/None, Repeat), a uv value of 1 should wrap around back to our 0th pixel.
-                // For clamping states (Clamp to Zero, Clamp to Edge), a uv value of 1 should point to the last pixel.
-
-                // We assume here that the code handling sampler states has handled this for us in the clamping cases
-                // by reducing our uv by a small delta value such that anything that wants the last pixel has a value
-                // just slightly less than 1.
-
-                // Keeping that in mind, we scale our uv from 0-1 to 0-image size inclusive.  So a 4-pixel image will scale
-                // uv values of 0-1 to 0-4, not 0-3 as you might expect.  This is because we want the following range mappings:
-                // [0 - 1/4)   = pixel 0
-                // [1/4 - 1/2) = pixel 1
-                // [1/2 - 3/4) = pixel 2
-                // [3/4 - 1)   = pixel 3
-                // [1 - 1 1/4) = pixel 0
-                // ...
-
-                // Also, based on our tiling settings, we extend the size of our image virtually by a factor of tilingX and tilingY.  
-                // A 16x16 pixel image and tilingX = tilingY = 1  maps the uv range of 0-1 to 0-16 pixels.  
-                // A 16x16 pixel image and tilingX = tilingY = 1.5 maps the uv range of 0-1 to 0-24 pixels.
-
-                const AZ::Vector3 tiledDimensions((width * tilingX),
-                    (height * tilingY),
-                    0.0f);
-
-                // Convert from uv space back to pixel space
-                AZ::Vector3 pixelLookup = (uvw * tiledDimensions);
-
-                // UVs outside the 0-1 range are treated as infinitely tiling, so that we behave the same as the 
-                // other gradient generators.  As mentioned above, if clamping is desired, we expect it to be applied
-                // outside of this function.
-                auto x = aznumeric_cast<AZ::u32>(pixelLookup.GetX()) % width;
-                auto y = aznumeric_cast<AZ::u32>(pixelLookup.GetY()) % height;
-
-                // Flip the y because images are stored in reverse of our world axes
-                y = (height - 1) - y;
-
-                return AZ::RPI::GetImageDataPixelValue<float>(m_imageData, imageDescriptor, x, y);
-            }
+            // When "rasterizing" from uvs, a range of 0-1 has slightly different meanings depending on the sampler state.
+            // For repeating states (Unbounded/None, Repeat), a uv value of 1 should wrap around back to our 0th pixel.
+            // For clamping states (Clamp to Zero, Clamp to Edge), a uv value of 1 should point to the last pixel.
+
+            // We assume here that the code handling sampler states has handled this for us in the clamping cases
+            // by reducing our uv by a small delta value such that anything that wants the last pixel has a value
+            // just slightly less than 1.
+
+            // Keeping that in mind, we scale our uv from 0-1 to 0-image size inclusive.  So a 4-pixel image will scale
+            // uv values of 0-1 to 0-4, not 0-3 as you might expect.  This is because we want the following range mappings:
+            // [0 - 1/4)   = pixel 0
+            // [1/4 - 1/2) = pixel 1
+            // [1/2 - 3/4) = pixel 2
+            // [3/4 - 1)   = pixel 3
+            // [1 - 1 1/4) = pixel 0
+            // ...
+
+            // Also, based on our tiling settings, we extend the size of our image virtually by a factor of tilingX and tilingY.  
+            // A 16x16 pixel image and tilingX = tilingY = 1  maps the uv range of 0-1 to 0-16 pixels.  
+            // A 16x16 pixel image and tilingX = tilingY = 1.5 maps the uv range of 0-1 to 0-24 pixels.
+
+            const AZ::Vector3 tiledDimensions((m_imageWidth * tilingX),
+                (m_imageHeight * tilingY),
+                0.0f);
+
+            // Convert from uv space back to pixel space
+            AZ::Vector3 pixelLookup = (uvw * tiledDimensions);
+
+            // As mentioned above, if clamping is desired, we expect it to be applied outside of this function.
+            return GetImageValue(aznumeric_cast<AZ::u32>(pixelLookup.GetX()), aznumeric_cast<AZ::u32>(pixelLookup.GetY()));
         }
 
         return defaultValue;
@@ -307,7 +329,12 @@ namespace GradientSignal
 
         // Invoke the QueueLoad before connecting to the AssetBus, so that
         // if the asset is already ready, then OnAssetReady will be triggered immediately
-        m_imageData = AZStd::span<const uint8_t>();
+        {
+            AZStd::unique_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+            m_imageValues.clear();
+            m_imageWidth = 0;
+            m_imageHeight = 0;
+        }
         m_configuration.m_imageAsset.QueueLoad();
 
         AZ::Data::AssetBus::Handler::BusConnect(m_configuration.m_imageAsset.GetId());
@@ -324,6 +351,9 @@ namespace GradientSignal
 
         AZStd::unique_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
         m_configuration.m_imageAsset.Release();
+        m_imageValues = {};
+        m_imageWidth = 0;
+        m_imageHeight = 0;
     }
 
     bool ImageGradientComponent::ReadInConfig(const AZ::ComponentConfig* baseConfig)
@@ -381,22 +411,20 @@ namespace GradientSignal
         AZ::Vector3 uvw = sampleParams.m_position;
         bool wasPointRejected = false;
 
+        AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+
         // Return immediately if our cached image data hasn't been retrieved yet
-        if (m_imageData.empty())
+        if (m_imageValues.empty())
         {
             return 0.0f;
         }
 
-        {
-            AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
-
-            m_gradientTransform.TransformPositionToUVWNormalized(sampleParams.m_position, uvw, wasPointRejected);
+        m_gradientTransform.TransformPositionToUVWNormalized(sampleParams.m_position, uvw, wasPointRejected);
 
-            if (!wasPointRejected)
-            {
-                return GetValueFromImageData(
-                    uvw, m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
-            }
+        if (!wasPointRejected)
+        {
+            return GetValueFromImageData(
+                uvw, m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
         }
 
         return 0.0f;
@@ -410,29 +438,49 @@ namespace GradientSignal
             return;
         }
 
+        AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
+
         // Return immediately if our cached image data hasn't been retrieved yet
-        if (m_imageData.empty())
+        if (m_imageValues.empty())
         {
             return;
         }
 
+        // Same lookup as GetValueFromImageData, with the scaling to pixel space done four positions at a time.
+        const AZ::Simd::Vec4::FloatType tiledWidth = AZ::Simd::Vec4::Splat(m_imageWidth * m_configuration.m_tilingX);
+        const AZ::Simd::Vec4::FloatType tiledHeight = AZ::Simd::Vec4::Splat(m_imageHeight * m_configuration.m_tilingY);
+
+        constexpr size_t LaneCount = 4;
         AZ::Vector3 uvw;
         bool wasPointRejected = false;
 
-        AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
-
-        for (size_t index = 0; index < positions.size(); index++)
+        for (size_t index = 0; index < positions.size(); index += LaneCount)
         {
-            m_gradientTransform.TransformPositionToUVWNormalized(positions[index], uvw, wasPointRejected);
+            const size_t laneCount = AZStd::min(LaneCount, positions.size() - index);
 
-            if (!wasPointRejected)
+            float u[LaneCount] = {};
+            float v[LaneCount] = {};
+            bool rejected[LaneCount] = { true, true, true, true };
+            for (size_t lane = 0; lane < laneCount; ++lane)
             {
-                outValues[index] = GetValueFromImageData(
-                    uvw, m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
+                m_gradientTransform.TransformPositionToUVWNormalized(positions[index + lane], uvw, wasPointRejected);
+                u[lane] = uvw.GetX();
+                v[lane] = uvw.GetY();
+                rejected[lane] = wasPointRejected;
             }
-            else
+
+            int32_t pixelX[LaneCount];
+            int32_t pixelY[LaneCount];
+            AZ::Simd::Vec4::StoreUnaligned(
+                pixelX, AZ::Simd::Vec4::ConvertToInt(AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::LoadUnaligned(u), tiledWidth)));
+            AZ::Simd::Vec4::StoreUnaligned(
+                pixelY, AZ::Simd::Vec4::ConvertToInt(AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::LoadUnaligned(v), tiledHeight)));
+
+            for (size_t lane = 0; lane < laneCount; ++lane)
             {
-                outValues[index] = 0.0f;
+                outValues[index + lane] = rejected[lane]
+                    ? 0.0f
+                    : GetImageValue(static_cast<AZ::u32>(pixelX[lane]), static_cast<AZ::u32>(pixelY[lane]));
             }
         }
     }
@@ -469,7 +517,9 @@ namespace GradientSignal
                 AZStd::unique_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
 
                 // Clear our cached image data
-                m_imageData = AZStd::span<const uint8_t>();
+                m_imageValues.clear();
+                m_imageWidth = 0;
+                m_imageHeight = 0;
 
                 if (assetPath.empty())
                 {
@@ -8,12 +8,115 @@
 
 #include <GradientSignal/Components/MixedGradientComponent.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 namespace GradientSignal
 {
+    namespace MixedGradientInternal
+    {
+        // Blends the values of a layer into the accumulated values four values at a time, with the same math as
+        // PerformMixingOperation, so the operation is picked once per layer rather than once per position.
+        template<typename Operation>
+        void BlendLayerValues(
+            AZStd::span<float> inOutValues, AZStd::span<const float> layerValues, float opacity, float inverseOpacity, Operation operation)
+        {
+            const size_t laneCount = 4;
+            const AZ::Simd::Vec4::FloatType opacityLanes = AZ::Simd::Vec4::Splat(opacity);
+            const AZ::Simd::Vec4::FloatType inverseOpacityLanes = AZ::Simd::Vec4::Splat(inverseOpacity);
+
+            for (size_t index = 0; index < inOutValues.size(); index += laneCount)
+            {
+                // The last lanes are copied out so they can be loaded and stored like the others.
+                const size_t activeLanes = AZStd::min(laneCount, inOutValues.size() - index);
+                float prevLanes[laneCount] = {};
+                float layerLanes[laneCount] = {};
+                for (size_t lane = 0; lane < activeLanes; lane++)
+                {
+                    prevLanes[lane] = inOutValues[index + lane];
+                    layerLanes[lane] = layerValues[index + lane];
+                }
+
+                const AZ::Simd::Vec4::FloatType prevValue = AZ::Simd::Vec4::LoadUnaligned(prevLanes);
+                // unpremultiplied alpha (we clamp the end result)
+                const AZ::Simd::Vec4::FloatType currentUnpremultiplied =
+                    AZ::Simd::Vec4::Div(AZ::Simd::Vec4::LoadUnaligned(layerLanes), opacityLanes);
+                const AZ::Simd::Vec4::FloatType operationResult = operation(prevValue, currentUnpremultiplied);
+
+                // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
+                const AZ::Simd::Vec4::FloatType blended = AZ::Simd::Vec4::Add(
+                    AZ::Simd::Vec4::Mul(prevValue, inverseOpacityLanes), AZ::Simd::Vec4::Mul(operationResult, opacityLanes));
+
+                AZ::Simd::Vec4::StoreUnaligned(prevLanes, blended);
+                for (size_t lane = 0; lane < activeLanes; lane++)
+                {
+                    inOutValues[index + lane] = prevLanes[lane];
+                }
+            }
+        }
+
+        void BlendLayerValues(
+            MixedGradientLayer::MixingOperation operation, AZStd::span<float> inOutValues, AZStd::span<const float> layerValues,
+            float opacity, float inverseOpacity)
+        {
+            using FloatArgType = AZ::Simd::Vec4::FloatArgType;
+            using FloatType = AZ::Simd::Vec4::FloatType;
+
+            switch (operation)
+            {
+            case MixedGradientLayer::MixingOperation::Multiply:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    [](FloatArgType prev, FloatArgType current) { return AZ::Simd::Vec4::Mul(prev, current); });
+                break;
+            case MixedGradientLayer::MixingOperation::Add:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    [](FloatArgType prev, FloatArgType current) { return AZ::Simd::Vec4::Add(prev, current); });
+                break;
+            case MixedGradientLayer::MixingOperation::Subtract:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    [](FloatArgType prev, FloatArgType current) { return AZ::Simd::Vec4::Sub(prev, current); });
+                break;
+            case MixedGradientLayer::MixingOperation::Min:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    [](FloatArgType prev, FloatArgType current) { return AZ::Simd::Vec4::Min(prev, current); });
+                break;
+            case MixedGradientLayer::MixingOperation::Max:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    [](FloatArgType prev, FloatArgType current) { return AZ::Simd::Vec4::Max(prev, current); });
+                break;
+            case MixedGradientLayer::MixingOperation::Average:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    [](FloatArgType prev, FloatArgType current)
+                    {
+                        return AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Add(prev, current), AZ::Simd::Vec4::Splat(0.5f));
+                    });
+                break;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    [](FloatArgType prev, FloatArgType current)
+                    {
+                        const FloatType one = AZ::Simd::Vec4::Splat(1.0f);
+                        const FloatType two = AZ::Simd::Vec4::Splat(2.0f);
+                        const FloatType screen = AZ::Simd::Vec4::Sub(one,
+                            AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Mul(two, AZ::Simd::Vec4::Sub(one, prev)), AZ::Simd::Vec4::Sub(one, current)));
+                        const FloatType multiply = AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Mul(two, prev), current);
+                        return AZ::Simd::Vec4::Select(screen, multiply, AZ::Simd::Vec4::CmpGtEq(prev, AZ::Simd::Vec4::Splat(0.5f)));
+                    });
+                break;
+            case MixedGradientLayer::MixingOperation::Initialize:
+                [[fallthrough]];
+            case MixedGradientLayer::MixingOperation::Normal:
+                [[fallthrough]];
+            default:
+                BlendLayerValues(inOutValues, layerValues, opacity, inverseOpacity,
+                    []([[maybe_unused]] FloatArgType prev, FloatArgType current) { return current; });
+                break;
+            }
+        }
+    } // namespace MixedGradientInternal
+
     void MixedGradientLayer::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -312,14 +415,8 @@ namespace GradientSignal
                 // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
                 layer.m_gradientSampler.GetValues(positions, layerValues);
 
-                for (size_t index = 0; index < outValues.size(); index++)
-                {
-                    // unpremultiplied alpha (we clamp the end result)
-                    const float currentUnpremultiplied = layerValues[index] / layer.m_gradientSampler.m_opacity;
-                    const float operationResult = PerformMixingOperation(layer.m_operation, outValues[index], currentUnpremultiplied);
-                    // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
-                    outValues[index] = (outValues[index] * inverseOpacity) + (operationResult * layer.m_gradientSampler.m_opacity);
-                }
+                MixedGradientInternal::BlendLayerValues(
+                    layer.m_operation, outValues, layerValues, layer.m_gradientSampler.m_opacity, inverseOpacity);
             }
         }
 
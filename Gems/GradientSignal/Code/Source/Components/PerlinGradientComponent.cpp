@@ -12,6 +12,8 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -213,24 +215,39 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        if (!m_perlinImprovedNoise)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // The positions are transformed and handed to the batched noise a fixed number at a time, so the noise
+        // is generated several positions at once without allocating a uvw list as large as the input.
+        constexpr size_t BatchSize = 64;
+        AZStd::array<AZ::Vector3, BatchSize> uvws;
+        AZStd::array<bool, BatchSize> rejected;
 
         AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        for (size_t batchStart = 0; batchStart < positions.size(); batchStart += BatchSize)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
-
-            if (!wasPointRejected)
+            const size_t batchCount = AZStd::min(BatchSize, positions.size() - batchStart);
+            for (size_t index = 0; index < batchCount; index++)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
+                m_gradientTransform.TransformPositionToUVW(positions[batchStart + index], uvws[index], rejected[index]);
             }
-            else
+
+            AZStd::span<float> batchValues = outValues.subspan(batchStart, batchCount);
+            m_perlinImprovedNoise->GenerateOctaveNoise(
+                AZStd::span<const AZ::Vector3>(uvws.data(), batchCount), batchValues, m_configuration.m_octave,
+                m_configuration.m_amplitude, m_configuration.m_frequency);
+
+            for (size_t index = 0; index < batchCount; index++)
             {
-                outValues[index] = 0.0f;
+                if (rejected[index])
+                {
+                    batchValues[index] = 0.0f;
+                }
             }
         }
     }
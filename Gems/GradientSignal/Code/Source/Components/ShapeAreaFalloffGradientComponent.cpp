@@ -226,8 +226,21 @@ namespace GradientSignal
 
     void ShapeAreaFalloffGradientComponent::SetFalloffWidth(float falloffWidth)
     {
+        const float maxFalloffWidth = AZ::GetMax(m_configuration.m_falloffWidth, falloffWidth);
         m_configuration.m_falloffWidth = falloffWidth;
-        LmbrCentral::DependencyNotificationBus::Event(GetEntityId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionChanged);
+
+        // The falloff only affects the values outside of the shape up to the falloff width, so the gradient doesn't change anywhere
+        // else. Without a shape to bound it, the whole gradient is considered changed.
+        AZ::Aabb dirtyRegion = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(
+            dirtyRegion, m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::GetEncompassingAabb);
+        if (dirtyRegion.IsValid())
+        {
+            dirtyRegion.Expand(AZ::Vector3(AZ::GetMax(maxFalloffWidth, 0.0f)));
+        }
+
+        LmbrCentral::DependencyNotificationBus::Event(
+            GetEntityId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionRegionChanged, dirtyRegion);
     }
 
     FalloffType ShapeAreaFalloffGradientComponent::GetFalloffType() const
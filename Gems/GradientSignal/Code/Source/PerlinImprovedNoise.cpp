@@ -8,6 +8,8 @@
 
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -60,6 +62,98 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // Four wide versions of the above, written to round exactly like the scalar ones so both paths give the same values.
+        using namespace AZ::Simd;
+
+        AZ_FORCE_INLINE Vec4::FloatType Gradient4(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            // Same table as Gradient: the first term is x for the hashes below 8 and y otherwise, the second term is y below 4,
+            // x for 12 and 14 and z otherwise, and the first and second bits of the hash negate the first and second terms.
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType u = Vec4::Select(x, y, Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(8))));
+            const Vec4::Int32Type vUsesX = Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(0xC)), Vec4::CmpEq(h, Vec4::Splat(0xE)));
+            const Vec4::FloatType v = Vec4::Select(
+                y, Vec4::Select(x, z, Vec4::CastToFloat(vUsesX)), Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4))));
+
+            const Vec4::Int32Type signBit = Vec4::Splat(static_cast<int32_t>(0x80000000));
+            const Vec4::Int32Type one = Vec4::Splat(1);
+            const Vec4::Int32Type two = Vec4::Splat(2);
+            const Vec4::Int32Type uSign = Vec4::And(Vec4::CmpEq(Vec4::And(h, one), one), signBit);
+            const Vec4::Int32Type vSign = Vec4::And(Vec4::CmpEq(Vec4::And(h, two), two), signBit);
+            return Vec4::Add(Vec4::Xor(u, Vec4::CastToFloat(uSign)), Vec4::Xor(v, Vec4::CastToFloat(vSign)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade4(Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType t3 = Vec4::Mul(Vec4::Mul(t, t), t);
+            const Vec4::FloatType inner = Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f));
+            return Vec4::Mul(t3, Vec4::Add(Vec4::Mul(t, inner), Vec4::Splat(10.0f)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp4(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        Vec4::FloatType GenerateNoise4(
+            const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::Int32Type fx = Vec4::ConvertToInt(Vec4::Floor(x));
+            const Vec4::Int32Type fy = Vec4::ConvertToInt(Vec4::Floor(y));
+            const Vec4::Int32Type fz = Vec4::ConvertToInt(Vec4::Floor(z));
+            const Vec4::FloatType xf = Vec4::Sub(x, Vec4::ConvertToFloat(fx));
+            const Vec4::FloatType yf = Vec4::Sub(y, Vec4::ConvertToFloat(fy));
+            const Vec4::FloatType zf = Vec4::Sub(z, Vec4::ConvertToFloat(fz));
+
+            const Vec4::Int32Type mask = Vec4::Splat(255);
+            int32_t xi0[4];
+            int32_t yi0[4];
+            int32_t zi0[4];
+            Vec4::StoreUnaligned(xi0, Vec4::And(fx, mask));
+            Vec4::StoreUnaligned(yi0, Vec4::And(fy, mask));
+            Vec4::StoreUnaligned(zi0, Vec4::And(fz, mask));
+
+            // The permutation table lookups are gathers, so they're done one lane at a time.
+            int32_t hashes[8][4];
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const int xi1 = xi0[lane] + 1;
+                const int yi1 = yi0[lane] + 1;
+                const int zi1 = zi0[lane] + 1;
+                hashes[0][lane] = p[p[p[xi0[lane]] + yi0[lane]] + zi0[lane]];
+                hashes[1][lane] = p[p[p[xi1] + yi0[lane]] + zi0[lane]];
+                hashes[2][lane] = p[p[p[xi0[lane]] + yi1] + zi0[lane]];
+                hashes[3][lane] = p[p[p[xi1] + yi1] + zi0[lane]];
+                hashes[4][lane] = p[p[p[xi0[lane]] + yi0[lane]] + zi1];
+                hashes[5][lane] = p[p[p[xi1] + yi0[lane]] + zi1];
+                hashes[6][lane] = p[p[p[xi0[lane]] + yi1] + zi1];
+                hashes[7][lane] = p[p[p[xi1] + yi1] + zi1];
+            }
+
+            const Vec4::FloatType u = Fade4(xf);
+            const Vec4::FloatType v = Fade4(yf);
+            const Vec4::FloatType w = Fade4(zf);
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+            const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+            const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+            Vec4::FloatType x1 = Lerp4(
+                Gradient4(Vec4::LoadUnaligned(hashes[0]), xf, yf, zf), Gradient4(Vec4::LoadUnaligned(hashes[1]), xf1, yf, zf), u);
+            Vec4::FloatType x2 = Lerp4(
+                Gradient4(Vec4::LoadUnaligned(hashes[2]), xf, yf1, zf), Gradient4(Vec4::LoadUnaligned(hashes[3]), xf1, yf1, zf), u);
+            const Vec4::FloatType y1 = Lerp4(x1, x2, v);
+            x1 = Lerp4(
+                Gradient4(Vec4::LoadUnaligned(hashes[4]), xf, yf, zf1), Gradient4(Vec4::LoadUnaligned(hashes[5]), xf1, yf, zf1), u);
+            x2 = Lerp4(
+                Gradient4(Vec4::LoadUnaligned(hashes[6]), xf, yf1, zf1), Gradient4(Vec4::LoadUnaligned(hashes[7]), xf1, yf1, zf1), u);
+            const Vec4::FloatType y2 = Lerp4(x1, x2, v);
+
+            // For convenience we bound it to 0 - 1 (theoretical min/max before is -1 - 1)
+            return Vec4::Div(Vec4::Add(Lerp4(y1, y2, w), one), Vec4::Splat(2.0f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -87,6 +181,56 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency)
+    {
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        using AZ::Simd::Vec4;
+
+        const size_t positionCount = AZStd::min(positions.size(), outValues.size());
+        for (size_t index = 0; index < positionCount; index += 4)
+        {
+            const size_t laneCount = AZStd::min(size_t(4), positionCount - index);
+
+            float xs[4] = {};
+            float ys[4] = {};
+            float zs[4] = {};
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                xs[lane] = positions[index + lane].GetX();
+                ys[lane] = positions[index + lane].GetY();
+                zs[lane] = positions[index + lane].GetZ();
+            }
+            const Vec4::FloatType x = Vec4::LoadUnaligned(xs);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(ys);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(zs);
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            float maxValue = 0.0f;               // Used for normalizing result to 0.0 - 1.0
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencies = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise4(
+                    m_permutationTable, Vec4::Mul(x, frequencies), Vec4::Mul(y, frequencies), Vec4::Mul(z, frequencies));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                maxValue += amplitude;
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            float values[4];
+            Vec4::StoreUnaligned(values, maxValue <= 0.0f ? Vec4::ZeroFloat() : Vec4::Div(total, Vec4::Splat(maxValue)));
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                outValues[index + lane] = values[lane];
+            }
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -9,6 +9,7 @@
 
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
+#include <GradientSignal/Components/LevelsGradientComponent.h>
 #include <AzTest/AzTest.h>
 
 namespace UnitTest
@@ -75,6 +76,23 @@ namespace UnitTest
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
 
+    TEST_F(GradientSignalGetValuesTestsFixture, LevelsGradientComponentWithEqualInputMinAndMax_VerifyGetValueAndGetValuesMatch)
+    {
+        // An empty input range maps every value to either the output min or max instead of remapping it.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = CreateTestEntity(TestShapeHalfBounds);
+        GradientSignal::LevelsGradientConfig config;
+        config.m_gradientSampler.m_gradientId = baseEntity->GetId();
+        config.m_inputMin = 0.5f;
+        config.m_inputMax = 0.5f;
+        config.m_outputMin = 0.2f;
+        config.m_outputMax = 0.8f;
+        entity->CreateComponent<GradientSignal::LevelsGradientComponent>(config);
+        ActivateEntity(entity.get());
+
+        GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
     TEST_F(GradientSignalGetValuesTestsFixture, MixedGradientComponent_VerifyGetValueAndGetValuesMatch)
     {
         auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
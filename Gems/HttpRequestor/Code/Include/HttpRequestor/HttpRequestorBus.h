@@ -74,6 +74,22 @@ namespace HttpRequestor
             const Headers& headers,
             const AZStd::string& body,
             const TextCallback& callback) = 0;
+
+        //! Make a RESTful call to a HTTP(s) endpoint with customized headers and a body. Receive the response body in a stream created
+        //! by the caller, for example over a preallocated buffer, then the response code via the supplied callback.
+        //! @param URI The universal resource indicator representing the endpoint to make the request to.
+        //! @param method The HTTP method to use, for example HTTP_GET.
+        //! @param headers A map of header names and values to set on the request.
+        //! @param body Any HTTP request data to include in the request, no body is sent when empty.
+        //! @param streamFactory The factory creating the stream the response body is written to.
+        //! @param callback The callback method to receive the stream holding the response body.
+        virtual void AddStreamRequest(
+            const AZStd::string& URI,
+            Aws::Http::HttpMethod method,
+            const Headers& headers,
+            const AZStd::string& body,
+            const ResponseStreamFactory& streamFactory,
+            const StreamCallback& callback) = 0;
     };
 
     using HttpRequestorRequestBus = AZ::EBus<HttpRequestorRequests>;
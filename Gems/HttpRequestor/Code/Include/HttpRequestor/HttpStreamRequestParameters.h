@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "HttpTypes.h"
+#include <sstream>
+
+namespace HttpRequestor
+{
+    //! Models the parameters needed to make a HTTP call and then write the
+    //! returned body to a stream supplied by the caller.
+    class StreamParameters
+    {
+    public:
+        // Initializing ctor
+
+        //! @param URI A universal resource indicator representing an endpoint.
+        //! @param method The HTTP method to configure.
+        //! @param headers A map of header names and values to use.
+        //! @param body An data to associate with an HTTP call, no body is sent when empty.
+        //! @param streamFactory The factory creating the stream the response body is written to.
+        //! @param callback The callback method to receive a HTTP call's response.
+        StreamParameters(
+            const AZStd::string& URI,
+            Aws::Http::HttpMethod method,
+            const Headers& headers,
+            const AZStd::string& body,
+            const ResponseStreamFactory& streamFactory,
+            const StreamCallback& callback);
+
+        // Defaults
+        ~StreamParameters() = default;
+        StreamParameters(const StreamParameters&) = default;
+        StreamParameters& operator=(const StreamParameters&) = default;
+
+        StreamParameters(StreamParameters&&) = default;
+        StreamParameters& operator=(StreamParameters&&) = default;
+
+        //! Get the URI in string form as an recipient of the HTTP connection.
+        const Aws::String& GetURI() const
+        {
+            return m_URI;
+        }
+
+        //! Get the HTTP method configured to use for a request.
+        Aws::Http::HttpMethod GetMethod() const
+        {
+            return m_method;
+        }
+
+        //! Get the list of extra headers to send as part of a request.
+        //! @return A map of header-value pairs.
+        const Headers& GetHeaders() const
+        {
+            return m_headers;
+        }
+
+        //! Get an input stream that can be used to send the body of a request.
+        //! @return A string stream representing a request body, nullptr without any body.
+        const std::shared_ptr<std::stringstream>& GetBodyStream() const
+        {
+            return m_bodyStream;
+        }
+
+        //! Get the factory creating the stream the response body is written to.
+        //! @return The factory of the response stream.
+        const ResponseStreamFactory& GetStreamFactory() const
+        {
+            return m_streamFactory;
+        }
+
+        //! Get the callback function for processing the stream returned in an HTTP response.
+        //! Callback functions are responsible for correctly interpreting the HTTP response code, and should communicate any
+        //! failures.
+        //! @return The callback function to process endpoint responses with.
+        const StreamCallback& GetCallback() const
+        {
+            return m_callback;
+        }
+
+    private:
+        Aws::String m_URI;
+        Aws::Http::HttpMethod m_method;
+        Headers m_headers;
+        std::shared_ptr<std::stringstream> m_bodyStream;
+        ResponseStreamFactory m_streamFactory;
+        StreamCallback m_callback;
+    };
+
+    inline StreamParameters::StreamParameters(
+        const AZStd::string& URI,
+        Aws::Http::HttpMethod method,
+        const Headers& headers,
+        const AZStd::string& body,
+        const ResponseStreamFactory& streamFactory,
+        const StreamCallback& callback)
+        : m_URI(URI.c_str())
+        , m_method(method)
+        , m_headers(headers)
+        , m_bodyStream(body.empty() ? nullptr : std::make_shared<std::stringstream>(body.c_str()))
+        , m_streamFactory(streamFactory)
+        , m_callback(callback)
+    {
+    }
+} // namespace HttpRequestor
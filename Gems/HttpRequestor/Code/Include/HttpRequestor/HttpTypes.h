@@ -32,6 +32,15 @@ namespace HttpRequestor
     // responsible for parsing it.
     using TextCallback = AZStd::function<void(const AZStd::string&, Aws::Http::HttpResponseCode)>;
 
+    // A factory creating the stream an HTTP response body is written to. The response takes ownership of the stream, which must be
+    // allocated with Aws::New. A stream over a caller provided buffer, for example using an Aws::Utils::Stream::PreallocatedStreamBuf,
+    // receives the body without any intermediate copy.
+    using ResponseStreamFactory = AZStd::function<Aws::IOStream*()>;
+
+    // A callback function for processing an HTTP response written to the stream of a ResponseStreamFactory. This callback is responsible
+    // for correctly interpreting the HTTP response code, the stream holds the body as received even for error codes.
+    using StreamCallback = AZStd::function<void(Aws::IOStream&, Aws::Http::HttpResponseCode)>;
+
     // A map of REST headers.
     using Headers = AZStd::map<AZStd::string, AZStd::string>;
 
@@ -22,11 +22,16 @@ AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
 AZ_POP_DISABLE_WARNING
 
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/conversions.h>
 #include "HttpRequestManager.h"
 
 namespace HttpRequestor
 {
+    AZ_CVAR(uint32_t, http_MaxConcurrentRequests, 4, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of HTTP requests in flight at the same time, applied when the HttpRequestor gem activates. Requests complete in order with a single one");
+
     const char* Manager::s_loggingName = "GemHttpRequestManager";
 
     Manager::Manager()
@@ -36,42 +41,64 @@ namespace HttpRequestor
         desc.m_cpuId = AFFINITY_MASK_USERTHREADS;
         m_runThread = true;
         AWSNativeSDKInit::InitializationManager::InitAwsApi();
+
+        const uint32_t threadCount = AZStd::clamp(static_cast<uint32_t>(http_MaxConcurrentRequests), 1u, MaxConcurrentRequests);
+
+        // Creating a client for each request would close its connections, share one so that requests to the same host reuse them
+        Aws::Client::ClientConfiguration config;
+        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
+        config.maxConnections = threadCount;
+        m_httpClient = Aws::Http::CreateHttpClient(config);
+
         auto function = [this]
         {
             ThreadFunction();
         };
-        m_thread = AZStd::thread(desc, function);
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            m_threads.emplace_back(desc, function);
+        }
     }
 
     Manager::~Manager()
     {
         m_runThread = false;
         m_requestConditionVar.notify_all();
-        if (m_thread.joinable())
+        for (AZStd::thread& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
 
-        // Shutdown after background thread has closed.
+        // Shutdown after background threads have closed and the client is released.
+        m_httpClient.reset();
         AWSNativeSDKInit::InitializationManager::Shutdown();
     }
 
     void Manager::AddRequest(Parameters&& httpRequestParameters)
     {
-        {
-            AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-            m_requestsToHandle.push(AZStd::move(httpRequestParameters));
-        }
-        m_requestConditionVar.notify_all();
+        QueueRequest(Request(AZStd::move(httpRequestParameters)));
     }
 
     void Manager::AddTextRequest(TextParameters&& httpTextRequestParameters)
+    {
+        QueueRequest(Request(AZStd::move(httpTextRequestParameters)));
+    }
+
+    void Manager::AddStreamRequest(StreamParameters&& httpStreamRequestParameters)
+    {
+        QueueRequest(Request(AZStd::move(httpStreamRequestParameters)));
+    }
+
+    void Manager::QueueRequest(Request&& request)
     {
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-            m_textRequestsToHandle.push(AZStd::move(httpTextRequestParameters));
+            m_requestsToHandle.push(AZStd::move(request));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::ThreadFunction()
@@ -79,11 +106,11 @@ namespace HttpRequestor
         // Run the thread as long as directed
         while (m_runThread)
         {
-            HandleRequestBatch();
+            HandleNextRequest();
         }
     }
 
-    void Manager::HandleRequestBatch()
+    void Manager::HandleNextRequest()
     {
         // Lock mutex and wait for work to be signaled via the condition variable
         AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
@@ -91,56 +118,74 @@ namespace HttpRequestor
             lock,
             [&]
             {
-                return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty();
+                return !m_runThread || !m_requestsToHandle.empty();
             });
 
-        // Swap queues
-        AZStd::queue<Parameters> requestsToHandle;
-        requestsToHandle.swap(m_requestsToHandle);
+        if (m_requestsToHandle.empty())
+        {
+            return;
+        }
 
-        AZStd::queue<TextParameters> textRequestsToHandle;
-        textRequestsToHandle.swap(m_textRequestsToHandle);
+        // Take a single request, the other workers handle the next ones while this one waits for its response
+        Request request = AZStd::move(m_requestsToHandle.front());
+        m_requestsToHandle.pop();
 
         // Release lock
         lock.unlock();
 
-        // Handle requests
-        while (!requestsToHandle.empty())
+        if (const Parameters* parameters = AZStd::get_if<Parameters>(&request))
         {
-            HandleRequest(requestsToHandle.front());
-            requestsToHandle.pop();
+            HandleRequest(*parameters);
         }
-
-        while (!textRequestsToHandle.empty())
+        else if (const TextParameters* textParameters = AZStd::get_if<TextParameters>(&request))
+        {
+            HandleTextRequest(*textParameters);
+        }
+        else if (const StreamParameters* streamParameters = AZStd::get_if<StreamParameters>(&request))
         {
-            HandleTextRequest(textRequestsToHandle.front());
-            textRequestsToHandle.pop();
+            HandleStreamRequest(*streamParameters);
         }
     }
 
-    void Manager::HandleRequest(const Parameters& httpRequestParameters)
+    std::shared_ptr<Aws::Http::HttpRequest> Manager::CreateRequest(
+        const Aws::String& URI,
+        Aws::Http::HttpMethod method,
+        const Headers& headers,
+        const std::shared_ptr<std::stringstream>& bodyStream,
+        const ResponseStreamFactory& streamFactory) const
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
-
-        auto httpRequest = Aws::Http::CreateHttpRequest(
-            httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        std::shared_ptr<Aws::Http::HttpRequest> httpRequest;
+        if (streamFactory)
+        {
+            httpRequest = Aws::Http::CreateHttpRequest(URI, method, [streamFactory]() { return streamFactory(); });
+        }
+        else
+        {
+            httpRequest = Aws::Http::CreateHttpRequest(URI, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        }
 
         AZ_Assert(httpRequest, "HttpRequest not created!");
 
-        for (const auto& it : httpRequestParameters.GetHeaders())
+        for (const auto& it : headers)
         {
             httpRequest->SetHeaderValue(it.first.c_str(), it.second.c_str());
         }
 
-        if (httpRequestParameters.GetBodyStream() != nullptr)
+        if (bodyStream != nullptr)
         {
-            httpRequest->AddContentBody(httpRequestParameters.GetBodyStream());
-            httpRequest->SetContentLength(AZStd::to_string(httpRequestParameters.GetBodyStream()->str().length()).c_str());
+            httpRequest->AddContentBody(bodyStream);
+            httpRequest->SetContentLength(AZStd::to_string(bodyStream->str().length()).c_str());
         }
 
-        auto httpResponse = httpClient->MakeRequest(httpRequest);
+        return httpRequest;
+    }
+
+    void Manager::HandleRequest(const Parameters& httpRequestParameters)
+    {
+        auto httpRequest = CreateRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(),
+            httpRequestParameters.GetHeaders(), httpRequestParameters.GetBodyStream(), ResponseStreamFactory());
+
+        auto httpResponse = m_httpClient->MakeRequest(httpRequest);
 
         if (!httpResponse)
         {
@@ -167,24 +212,10 @@ namespace HttpRequestor
 
     void Manager::HandleTextRequest(const TextParameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
-
-        auto httpRequest = Aws::Http::CreateHttpRequest(
-            httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-
-        for (const auto& it : httpRequestParameters.GetHeaders())
-        {
-            httpRequest->SetHeaderValue(it.first.c_str(), it.second.c_str());
-        }
-
-        if (httpRequestParameters.GetBodyStream() != nullptr)
-        {
-            httpRequest->AddContentBody(httpRequestParameters.GetBodyStream());
-        }
+        auto httpRequest = CreateRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(),
+            httpRequestParameters.GetHeaders(), httpRequestParameters.GetBodyStream(), ResponseStreamFactory());
 
-        const auto httpResponse = httpClient->MakeRequest(httpRequest);
+        const auto httpResponse = m_httpClient->MakeRequest(httpRequest);
 
         if (!httpResponse)
         {
@@ -204,4 +235,22 @@ namespace HttpRequestor
         AZStd::string data(std::istreambuf_iterator<char>(httpResponse->GetResponseBody()), eos);
         httpRequestParameters.GetCallback()(AZStd::move(data), httpResponse->GetResponseCode());
     }
+
+    void Manager::HandleStreamRequest(const StreamParameters& httpRequestParameters)
+    {
+        auto httpRequest = CreateRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(),
+            httpRequestParameters.GetHeaders(), httpRequestParameters.GetBodyStream(), httpRequestParameters.GetStreamFactory());
+
+        const auto httpResponse = m_httpClient->MakeRequest(httpRequest);
+
+        if (!httpResponse)
+        {
+            Aws::StringStream emptyStream;
+            httpRequestParameters.GetCallback()(emptyStream, Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
+            return;
+        }
+
+        // the body was written to the stream of the caller as it was received
+        httpRequestParameters.GetCallback()(httpResponse->GetResponseBody(), httpResponse->GetResponseCode());
+    }
 } // namespace HttpRequestor
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/variant.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -16,13 +18,26 @@
 #include <AzCore/std/parallel/thread.h>
 
 #include <HttpRequestor/HttpRequestParameters.h>
+#include <HttpRequestor/HttpStreamRequestParameters.h>
 #include <HttpRequestor/HttpTextRequestParameters.h>
 
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpClient;
+        class HttpRequest;
+    }
+}
+
 namespace HttpRequestor
 {
     class Manager
     {
     public:
+        // Upper bound of the http_MaxConcurrentRequests cvar
+        static constexpr uint32_t MaxConcurrentRequests = 32;
+
         Manager();
         virtual ~Manager();
 
@@ -32,12 +47,28 @@ namespace HttpRequestor
         // Add these parameters to a queue of request parameters to send off as an HTTP TEXT request as soon as they reach the head of the queue
         void AddTextRequest(TextParameters && httpTextRequestParameters);
 
+        // Add these parameters to a queue of request parameters to send off as an HTTP request streaming its response as soon as they reach the head of the queue
+        void AddStreamRequest(StreamParameters && httpStreamRequestParameters);
+
     private:
-        // RequestManager thread loop.
+        using Request = AZStd::variant<Parameters, TextParameters, StreamParameters>;
+
+        // Queue a request of any kind and wake up a worker thread.
+        void QueueRequest(Request&& request);
+
+        // RequestManager worker thread loop.
         void ThreadFunction();
 
-        // Called by ThreadFunction. Waits for timeout or until notified and processes any requests queued up.
-        void HandleRequestBatch();
+        // Called by ThreadFunction. Waits until notified and processes the request at the head of the queue.
+        void HandleNextRequest();
+
+        // Create an HTTP request with the headers and body of the parameters, writing its response to the streams of the given factory.
+        std::shared_ptr<Aws::Http::HttpRequest> CreateRequest(
+            const Aws::String& URI,
+            Aws::Http::HttpMethod method,
+            const Headers& headers,
+            const std::shared_ptr<std::stringstream>& bodyStream,
+            const ResponseStreamFactory& streamFactory) const;
 
         // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
         void HandleRequest(const Parameters & httpRequestParameters);
@@ -45,13 +76,16 @@ namespace HttpRequestor
         // Perform an HTTP request, block until a response is received, then give the returned TEXT to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
         void HandleTextRequest(const TextParameters & httpTextRequestParameters);
 
+        // Perform an HTTP request, block until its response is written to the stream of the caller, then give the stream to the callback. Returns the HTTPResponseCode to the callback to handle any errors.
+        void HandleStreamRequest(const StreamParameters & httpStreamRequestParameters);
+
     private:
-        AZStd::queue<Parameters>                m_requestsToHandle;                 // Queue of requests that will be made in order of time received
-        AZStd::queue<TextParameters>            m_textRequestsToHandle;             // Queue of requests for TEXT blobs that will be made in order of time received
+        AZStd::queue<Request>                   m_requestsToHandle;                 // Queue of requests that will be made in order of time received
         AZStd::mutex                            m_requestMutex;                     // Member variables for synchronization
         AZStd::condition_variable               m_requestConditionVar;
-        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker thread
-        AZStd::thread                           m_thread;                           // This is the thread that will be used for all async operations
+        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker threads
+        AZStd::vector<AZStd::thread>            m_threads;                          // Worker threads, each one has a single request in flight at a time
+        std::shared_ptr<Aws::Http::HttpClient>  m_httpClient;                       // Client shared by all the requests, it keeps the connections alive between requests
         static const char*                      s_loggingName;                      // Name to use for log messages etc...
     };
 
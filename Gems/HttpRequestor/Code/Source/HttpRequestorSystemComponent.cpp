@@ -60,6 +60,14 @@ namespace HttpRequestor
             m_httpManager->AddTextRequest(TextParameters(URI, method, headers, body, callback));
         }
     }
+
+    void HttpRequestorSystemComponent::AddStreamRequest(const AZStd::string& URI, Aws::Http::HttpMethod method, const Headers& headers, const AZStd::string& body, const ResponseStreamFactory& streamFactory, const StreamCallback& callback)
+    {
+        if (m_httpManager != nullptr)
+        {
+            m_httpManager->AddStreamRequest(StreamParameters(URI, method, headers, body, streamFactory, callback));
+        }
+    }
     
     void HttpRequestorSystemComponent::Reflect(AZ::ReflectContext* context)
     {
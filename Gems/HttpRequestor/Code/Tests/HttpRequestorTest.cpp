@@ -52,4 +52,35 @@ TEST_F(HttpTest, HttpRequesterTest)
     EXPECT_NE(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE, resultCode);
 }
 
+TEST_F(HttpTest, HttpRequesterStreamTest)
+{
+    HttpRequestor::Manager httpRequestManager;
+
+    // to wait for test to complete
+    AZStd::mutex requestMutex;
+    AZStd::condition_variable requestConditionVar;
+
+    AZStd::atomic<Aws::Http::HttpResponseCode> resultCode = Aws::Http::HttpResponseCode::REQUEST_NOT_MADE;
+
+    httpRequestManager.AddStreamRequest(HttpRequestor::StreamParameters(
+        "https://httpbin.org/ip", Aws::Http::HttpMethod::HTTP_GET, HttpRequestor::Headers(), AZStd::string(),
+        []()
+        {
+            return Aws::New<Aws::StringStream>("HttpRequesterStreamTest");
+        },
+        [&resultCode, &requestConditionVar](Aws::IOStream& responseBody, Aws::Http::HttpResponseCode code)
+        {
+            AZ_UNUSED(responseBody);
+            resultCode = code;
+            requestConditionVar.notify_all();
+        }));
+
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(requestMutex);
+        requestConditionVar.wait_for(lock, AZStd::chrono::milliseconds(5000));
+    }
+
+    EXPECT_NE(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE, resultCode);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -12,6 +12,7 @@ set(FILES
     Include/HttpRequestor/HttpRequestorBus.h
     Include/HttpRequestor/HttpTextRequestParameters.h
     Include/HttpRequestor/HttpRequestParameters.h
+    Include/HttpRequestor/HttpStreamRequestParameters.h
     Include/HttpRequestor/HttpTypes.h
     Source/HttpRequestorSystemComponent.cpp
     Source/HttpRequestorSystemComponent.h
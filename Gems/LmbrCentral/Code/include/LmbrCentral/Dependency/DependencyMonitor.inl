@@ -78,6 +78,11 @@ namespace LmbrCentral
         SendNotification();
     }
 
+    inline void DependencyMonitor::OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion)
+    {
+        SendNotification(dirtyRegion);
+    }
+
     inline void DependencyMonitor::OnEntityActivated([[maybe_unused]] const AZ::EntityId& entityId)
     {
         SendNotification();
@@ -130,4 +135,17 @@ namespace LmbrCentral
             m_notificationInProgress = false;
         }
     }
+
+    inline void DependencyMonitor::SendNotification(const AZ::Aabb& dirtyRegion)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        //forward the region of a dependency change as is, so that the owner only refreshes what the change covers
+        if (!m_notificationInProgress)
+        {
+            m_notificationInProgress = true;
+            DependencyNotificationBus::Event(m_ownerId, &DependencyNotificationBus::Events::OnCompositionRegionChanged, dirtyRegion);
+            m_notificationInProgress = false;
+        }
+    }
 }
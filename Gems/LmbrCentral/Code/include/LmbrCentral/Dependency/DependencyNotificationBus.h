@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 
 namespace LmbrCentral
 {
@@ -22,6 +23,14 @@ namespace LmbrCentral
         using MutexType = AZStd::recursive_mutex;
 
         virtual void OnCompositionChanged() {}
+
+        //! Notifies that the composition only changed within the given world space region, so that listeners able to
+        //! refresh part of their data can leave the rest of it untouched. Listeners not overriding it refresh everything.
+        //! @param dirtyRegion The region affected by the change, a null region meaning the whole composition changed
+        virtual void OnCompositionRegionChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+        {
+            OnCompositionChanged();
+        }
     };
 
     typedef AZ::EBus<DependencyNotifications> DependencyNotificationBus;
@@ -148,19 +148,40 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] Combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        // Add all the indexed primitives of this node to the dynamic draw context with a single draw call
+        if (m_combinedIndices.size() != static_cast<size_t>(m_totalNumIndices))
+        {
+            BuildCombinedPrimitive();
+        }
+
+        if (!m_combinedIndices.empty())
         {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
+            dynamicDraw->DrawIndexed(m_combinedVertices.data(), m_totalNumVertices, m_combinedIndices.data(), m_totalNumIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
         }
 
         uiRenderer->SetBaseState(prevBaseState);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::BuildCombinedPrimitive()
+    {
+        m_combinedVertices.clear();
+        m_combinedIndices.clear();
+        m_combinedVertices.reserve(m_totalNumVertices);
+        m_combinedIndices.reserve(m_totalNumIndices);
+
+        // HasSpaceToAddPrimitive keeps the total number of vertices within the range of the 16 bit indices
+        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        {
+            const uint16 baseVertex = aznumeric_cast<uint16>(m_combinedVertices.size());
+            m_combinedVertices.insert(m_combinedVertices.end(), primitive.m_vertices, primitive.m_vertices + primitive.m_numVertices);
+            for (int i = 0; i < primitive.m_numIndices; ++i)
+            {
+                m_combinedIndices.push_back(static_cast<uint16>(primitive.m_indices[i] + baseVertex));
+            }
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void PrimitiveListRenderNode::AddPrimitive(LyShine::UiPrimitive* primitive)
     {
@@ -170,6 +191,10 @@ namespace LyShine
 
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
+
+        // the combined primitive gets rebuilt on the next render
+        m_combinedVertices.clear();
+        m_combinedIndices.clear();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -112,6 +113,10 @@ namespace LyShine
             bool                                m_isClampTextureMode;
         };
 
+    private: // functions
+        // Combine the vertices and indices of all primitives so that they can be drawn with a single draw call
+        void BuildCombinedPrimitive();
+
     private: // data
         TextureUsage    m_textures[MaxTextures];
         int             m_numTextures;
@@ -123,6 +128,11 @@ namespace LyShine
         int             m_totalNumIndices;
 
         LyShine::UiPrimitiveList   m_primitives;
+
+        // The combined vertices and indices of m_primitives. These are kept for the lifetime of the node since the
+        // render graph gets rebuilt whenever the geometry of any primitive changes
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_combinedVertices;
+        AZStd::vector<uint16> m_combinedIndices;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
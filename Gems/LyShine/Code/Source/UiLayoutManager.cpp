@@ -75,14 +75,20 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
 void UiLayoutManager::UnmarkAllLayouts()
 {
     m_elementsToRecomputeLayout.clear();
+    m_markedElements.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::RecomputeMarkedLayouts()
 {
-    for (auto element : m_elementsToRecomputeLayout)
+    // Computing a layout can mark more elements, so don't hold on to an iterator
+    for (size_t i = 0; i < m_elementsToRecomputeLayout.size(); ++i)
     {
-        ComputeLayoutForElementAndDescendants(element);
+        AZ::EntityId element = m_elementsToRecomputeLayout[i];
+        if (!HasMarkedAncestor(element))
+        {
+            ComputeLayoutForElementAndDescendants(element);
+        }
     }
 
     UnmarkAllLayouts();
@@ -120,53 +126,22 @@ void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityI
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
 {
-    // Check if element is already in the list
-    auto iter = AZStd::find(m_elementsToRecomputeLayout.begin(), m_elementsToRecomputeLayout.end(), entityId);
-    if (iter == m_elementsToRecomputeLayout.end())
+    // Marked descendants are not removed here since that would need to search the element's whole subtree.
+    // They get skipped when the layouts are recomputed instead
+    if (m_markedElements.insert(entityId).second)
     {
-        // Check if element's parent is already in the list
-        for (iter = m_elementsToRecomputeLayout.begin(); iter != m_elementsToRecomputeLayout.end(); ++iter)
-        {
-            if (IsParentOfElement(*iter, entityId))
-            {
-                // Don't need to add this element
-                return;
-            }
-        }
-
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity) { return true; },
-            descendants);
-
-        m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
-            {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
-            }
-            );
-
-        // Add element to list
         m_elementsToRecomputeLayout.push_back(entityId);
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity)
+bool UiLayoutManager::HasMarkedAncestor(AZ::EntityId entityId) const
 {
     AZ::EntityId parent;
-    EBUS_EVENT_ID_RESULT(parent, checkChildEntity, UiElementBus, GetParentEntityId);
+    EBUS_EVENT_ID_RESULT(parent, entityId, UiElementBus, GetParentEntityId);
     while (parent.IsValid())
     {
-        if (parent == checkParentEntity)
+        if (m_markedElements.count(parent) > 0)
         {
             return true;
         }
@@ -178,4 +153,3 @@ bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::Enti
 
     return false;
 }
-
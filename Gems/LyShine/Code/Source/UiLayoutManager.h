@@ -8,6 +8,8 @@
 #pragma once
 
 #include <LyShine/Bus/UiLayoutManagerBus.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiLayoutManager
@@ -33,10 +35,14 @@ private: // member functions
     AZ_DISABLE_COPY_MOVE(UiLayoutManager);
 
     void AddToRecomputeLayoutList(AZ::EntityId entityId);
-    bool IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity);
+    bool HasMarkedAncestor(AZ::EntityId entityId) const;
 
 private: // data
 
-    //! Elements that need to recompute their layouts. Parents should be ahead of their children
-    AZStd::list<AZ::EntityId> m_elementsToRecomputeLayout;
+    //! Elements that need to recompute their layouts, in the order they were marked.
+    //! Elements that have a marked ancestor are skipped since the ancestor recomputes their layouts too
+    AZStd::vector<AZ::EntityId> m_elementsToRecomputeLayout;
+
+    //! The same elements as m_elementsToRecomputeLayout for fast lookups
+    AZStd::unordered_set<AZ::EntityId> m_markedElements;
 };
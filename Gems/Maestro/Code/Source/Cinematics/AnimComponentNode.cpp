@@ -784,9 +784,72 @@ void CAnimComponentNode::InitializeTrackDefaultValue(IAnimTrack* pTrack, const C
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CAnimComponentNode::EvaluateTrackValues(const SAnimContext& ac)
+{
+    m_hasEvaluatedTrackValues = false;
+    if (m_skipComponentAnimationUpdates || ac.resetting)
+    {
+        return;
+    }
+
+    const int trackCount = NumTracks();
+    m_evaluatedTrackValues.resize(trackCount);
+    for (int paramIndex = 0; paramIndex < trackCount; paramIndex++)
+    {
+        IAnimTrack* pTrack = m_tracks[paramIndex].get();
+        EvaluatedTrackValue& evaluatedValue = m_evaluatedTrackValues[paramIndex];
+        evaluatedValue.m_evaluated = false;
+
+        if ((pTrack->HasKeys() == false) || (pTrack->GetFlags() & IAnimTrack::eAnimTrackFlags_Disabled) || pTrack->IsMasked(ac.trackMask))
+        {
+            continue;
+        }
+        if (m_paramTypeToBehaviorPropertyInfoMap.find(pTrack->GetParameterType()) == m_paramTypeToBehaviorPropertyInfoMap.end())
+        {
+            continue;
+        }
+
+        switch (pTrack->GetValueType())
+        {
+            case AnimValueType::Float:
+                pTrack->GetValue(ac.time, evaluatedValue.m_float, /*applyMultiplier= */ true);
+                evaluatedValue.m_evaluated = true;
+                break;
+            case AnimValueType::Vector:     // fall-through
+            case AnimValueType::RGB:
+                evaluatedValue.m_vector.Set(.0f, .0f, .0f);
+                pTrack->GetValue(ac.time, evaluatedValue.m_vector, /*applyMultiplier= */ true);
+                evaluatedValue.m_evaluated = true;
+                break;
+            case AnimValueType::Quat:
+                evaluatedValue.m_quaternion = AZ::Quaternion::CreateIdentity();
+                pTrack->GetValue(ac.time, evaluatedValue.m_quaternion);
+                evaluatedValue.m_evaluated = true;
+                break;
+            case AnimValueType::Bool:
+                evaluatedValue.m_bool = true;
+                pTrack->GetValue(ac.time, evaluatedValue.m_bool);
+                evaluatedValue.m_evaluated = true;
+                break;
+            default:
+                // Other value types are evaluated by Animate()
+                break;
+        }
+    }
+
+    m_evaluatedTime = ac.time;
+    m_hasEvaluatedTrackValues = true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CAnimComponentNode::Animate(SAnimContext& ac)
 {
+    // Values evaluated ahead of time are only used by the Animate() call they were evaluated for
+    const bool hasEvaluatedTrackValues = m_hasEvaluatedTrackValues && (m_evaluatedTime == ac.time) &&
+        (static_cast<int>(m_evaluatedTrackValues.size()) == NumTracks());
+    m_hasEvaluatedTrackValues = false;
+
     if (m_skipComponentAnimationUpdates)
     {
         return;
@@ -855,7 +918,14 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                             if (pTrack->HasKeys())
                             {
                                 float floatValue = .0f;
-                                pTrack->GetValue(ac.time, floatValue, /*applyMultiplier= */ true);
+                                if (hasEvaluatedTrackValues && m_evaluatedTrackValues[paramIndex].m_evaluated)
+                                {
+                                    floatValue = m_evaluatedTrackValues[paramIndex].m_float;
+                                }
+                                else
+                                {
+                                    pTrack->GetValue(ac.time, floatValue, /*applyMultiplier= */ true);
+                                }
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue value(floatValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue prevValue(floatValue);
@@ -873,7 +943,14 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                         {
                             float tolerance = AZ::Constants::FloatEpsilon;
                             Vec3 vec3Value(.0f, .0f, .0f);
-                            pTrack->GetValue(ac.time, vec3Value, /*applyMultiplier= */ true);
+                            if (hasEvaluatedTrackValues && m_evaluatedTrackValues[paramIndex].m_evaluated)
+                            {
+                                vec3Value = m_evaluatedTrackValues[paramIndex].m_vector;
+                            }
+                            else
+                            {
+                                pTrack->GetValue(ac.time, vec3Value, /*applyMultiplier= */ true);
+                            }
                             AZ::Vector3 vector3Value(vec3Value.x, vec3Value.y, vec3Value.z);
 
                             if (pTrack->GetValueType() == AnimValueType::RGB)
@@ -913,7 +990,14 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                                 float tolerance = AZ::Constants::FloatEpsilon;
 
                                 AZ::Quaternion quaternionValue(AZ::Quaternion::CreateIdentity());
-                                pTrack->GetValue(ac.time, quaternionValue);
+                                if (hasEvaluatedTrackValues && m_evaluatedTrackValues[paramIndex].m_evaluated)
+                                {
+                                    quaternionValue = m_evaluatedTrackValues[paramIndex].m_quaternion;
+                                }
+                                else
+                                {
+                                    pTrack->GetValue(ac.time, quaternionValue);
+                                }
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue value(quaternionValue);
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue prevValue(quaternionValue);
                                 Maestro::SequenceComponentRequestBus::Event(m_pSequence->GetSequenceEntityId(), &Maestro::SequenceComponentRequestBus::Events::GetAnimatedPropertyValue, prevValue, GetParentAzEntityId(), animatableAddress);
@@ -933,7 +1017,14 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                             if (pTrack->HasKeys())
                             {
                                 bool boolValue = true;
-                                pTrack->GetValue(ac.time, boolValue);
+                                if (hasEvaluatedTrackValues && m_evaluatedTrackValues[paramIndex].m_evaluated)
+                                {
+                                    boolValue = m_evaluatedTrackValues[paramIndex].m_bool;
+                                }
+                                else
+                                {
+                                    pTrack->GetValue(ac.time, boolValue);
+                                }
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue value(boolValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue prevValue(boolValue);
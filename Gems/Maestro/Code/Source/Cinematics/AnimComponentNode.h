@@ -98,6 +98,11 @@ public:
         m_skipComponentAnimationUpdates = skipAnimationUpdates;
     }
 
+    // Evaluates the property tracks of the node at the time of the context, the next Animate() at that time then applies
+    // the evaluated values instead of evaluating the tracks itself. Only the node's own tracks are touched, so different
+    // nodes can be evaluated concurrently.
+    void EvaluateTrackValues(const SAnimContext& ac);
+
     static void Reflect(AZ::ReflectContext* context);
 
 protected:
@@ -181,5 +186,18 @@ private:
     CCharacterTrackAnimator*   m_characterTrackAnimator = nullptr;
 
     bool m_skipComponentAnimationUpdates;
+
+    // track values evaluated by EvaluateTrackValues(), indexed like m_tracks
+    struct EvaluatedTrackValue
+    {
+        AZ::Quaternion m_quaternion = AZ::Quaternion::CreateIdentity();
+        Vec3 m_vector = Vec3(0.0f, 0.0f, 0.0f);
+        float m_float = 0.0f;
+        bool m_bool = false;
+        bool m_evaluated = false;
+    };
+    AZStd::vector<EvaluatedTrackValue> m_evaluatedTrackValues;
+    float m_evaluatedTime = 0.0f;
+    bool m_hasEvaluatedTrackValues = false;
 };
 #endif // CRYINCLUDE_CRYMOVIE_ANIMCOMPONENTNODE_H
@@ -33,6 +33,14 @@
 #include <Maestro/Types/SequenceType.h>
 #include <Maestro/Types/AnimParamType.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Task/TaskAlgorithms.h>
+
+AZ_CVAR(bool, mov_parallelEvaluation, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Evaluate the tracks of the component nodes of a sequence in parallel before applying their values.");
+AZ_CVAR(uint32_t, mov_parallelEvaluationMinNodes, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Minimum number of animated component nodes in a sequence to evaluate their tracks in parallel.");
+
 //////////////////////////////////////////////////////////////////////////
 CAnimSequence::CAnimSequence(IMovieSystem* pMovieSystem, uint32 id, SequenceType sequenceType)
     : m_refCount(0)
@@ -672,6 +680,8 @@ void CAnimSequence::Animate(const SAnimContext& ec)
         m_activeDirector->Animate(animContext);
     }
 
+    m_nodesToAnimate.clear();
+    m_componentNodesToEvaluate.clear();
     for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
     {
         // Make sure correct animation block is binded to node.
@@ -695,6 +705,31 @@ void CAnimSequence::Animate(const SAnimContext& ec)
             continue;
         }
 
+        m_nodesToAnimate.push_back(animNode);
+        if (animNode->GetType() == AnimNodeType::Component)
+        {
+            m_componentNodesToEvaluate.push_back(static_cast<CAnimComponentNode*>(animNode));
+        }
+    }
+
+    // The tracks of component nodes only depend on their own keys, evaluate them concurrently and leave the property
+    // updates, which go through the component buses, to the serial pass below.
+    if (mov_parallelEvaluation && !animContext.resetting && m_componentNodesToEvaluate.size() >= mov_parallelEvaluationMinNodes)
+    {
+        AZ::TaskAlgorithmDesc desc;
+        desc.m_taskDescriptor = { "MaestroEvaluateTracks", "Movie" };
+        desc.m_grainSize = 1;
+        AZ::TaskAlgorithms::parallel_for_each(
+            m_componentNodesToEvaluate.begin(), m_componentNodesToEvaluate.end(),
+            [&animContext](CAnimComponentNode* componentNode)
+            {
+                componentNode->EvaluateTrackValues(animContext);
+            },
+            desc);
+    }
+
+    for (IAnimNode* animNode : m_nodesToAnimate)
+    {
         // Animate node.
         animNode->Animate(animContext);
     }
@@ -20,6 +20,8 @@
 
 #include <list>
 
+class CAnimComponentNode;
+
 class CAnimSequence
     : public IAnimSequence
 {
@@ -174,6 +176,10 @@ private:
     AnimNodes m_nodes;
     AnimNodes m_nodesNeedToRender;
 
+    // Nodes animated by the current Animate() call, kept to reuse their memory between frames
+    AZStd::vector<IAnimNode*> m_nodesToAnimate;
+    AZStd::vector<CAnimComponentNode*> m_componentNodesToEvaluate;
+
     uint32 m_id;
     AZStd::string m_name;
     mutable AZStd::string m_fullNameHolder;
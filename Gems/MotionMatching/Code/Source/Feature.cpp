@@ -85,6 +85,15 @@ namespace EMotionFX::MotionMatching
         return 0.0f;
     }
 
+    void Feature::CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        AZ_Assert(frameIndices.size() == outCosts.size(), "The output costs need to be the same size as the frame indices.");
+        for (size_t i = 0; i < frameIndices.size(); ++i)
+        {
+            outCosts[i] = CalculateFrameCost(frameIndices[i], context);
+        }
+    }
+
     void Feature::SetRelativeToNodeIndex(size_t nodeIndex)
     {
         m_relativeToNodeIndex = nodeIndex;
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <EMotionFX/Source/Node.h>
@@ -100,6 +101,13 @@ namespace EMotionFX::MotionMatching
         };
         virtual float CalculateFrameCost(size_t frameIndex, const FrameCostContext& context) const;
 
+        //! Calculate the costs of a batch of frames at once, so that the query side of the comparison is only prepared once per search.
+        //! The default implementation calls CalculateFrameCost() for each of the frames.
+        //! @param[in] frameIndices The frames to calculate the costs for.
+        //! @param[in] context The frame cost context holding the input query.
+        //! @param[out] outCosts The unweighted feature cost for each of the frames, needs to be the same size as frameIndices.
+        virtual void CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const;
+
         //! Specifies how the feature value differences (residuals), between the input query values
         //! and the frames in the motion database that sum up the feature cost, are calculated.
         enum ResidualType
@@ -64,11 +64,25 @@ namespace EMotionFX::MotionMatching
 
     float FeaturePosition::CalculateFrameCost(size_t frameIndex, const FrameCostContext& context) const
     {
+        float cost = 0.0f;
+        CalculateFrameCosts(AZStd::span<const size_t>(&frameIndex, 1), context, AZStd::span<float>(&cost, 1));
+        return cost;
+    }
+
+    void FeaturePosition::CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        AZ_Assert(frameIndices.size() == outCosts.size(), "The output costs need to be the same size as the frame indices.");
+
+        // The input query position is the same for all frames.
         const Transform invRootTransform = context.m_currentPose.GetWorldSpaceTransform(m_relativeToNodeIndex).Inversed();
         const AZ::Vector3 worldInputPosition = context.m_currentPose.GetWorldSpaceTransform(m_jointIndex).m_position;
         const AZ::Vector3 relativeInputPosition = invRootTransform.TransformPoint(worldInputPosition);
-        const AZ::Vector3 framePosition = GetFeatureData(context.m_featureMatrix, frameIndex); // This is already relative to the root node
-        return CalcResidual(relativeInputPosition, framePosition);
+
+        for (size_t i = 0; i < frameIndices.size(); ++i)
+        {
+            const AZ::Vector3 framePosition = GetFeatureData(context.m_featureMatrix, frameIndices[i]); // This is already relative to the root node
+            outCosts[i] = CalcResidual(relativeInputPosition, framePosition);
+        }
     }
 
     void FeaturePosition::Reflect(AZ::ReflectContext* context)
@@ -42,6 +42,7 @@ namespace EMotionFX::MotionMatching
             size_t frameIndex) override;
 
         float CalculateFrameCost(size_t frameIndex, const FrameCostContext& context) const override;
+        void CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const override;
 
         void FillQueryFeatureValues(size_t startIndex, AZStd::vector<float>& queryFeatureValues, const FrameCostContext& context) override;
 
@@ -273,59 +273,87 @@ namespace EMotionFX::MotionMatching
         return CalcMidFrameIndex() + 1 + futureFrameIndex;
     }
 
-    float FeatureTrajectory::CalculateCost(const FeatureMatrix& featureMatrix,
-        size_t frameIndex,
+    void FeatureTrajectory::CalculateCosts(const FeatureMatrix& featureMatrix,
+        AZStd::span<const size_t> frameIndices,
         const Transform& invRootTransform,
         const AZStd::vector<TrajectoryQuery::ControlPoint>& controlPoints,
-        const SplineToFeatureMatrixIndex& splineToFeatureMatrixIndex) const
+        const SplineToFeatureMatrixIndex& splineToFeatureMatrixIndex,
+        AZStd::span<float> outCosts) const
     {
-        float cost = 0.0f;
-        AZ::Vector2 lastControlPoint, lastSamplePos;
+        AZ_Assert(frameIndices.size() == outCosts.size(), "The output costs need to be the same size as the frame indices.");
+
+        // The control points are the same for all frames, convert them so they are relative to where we are and pointing to only once.
+        // The facing direction from the control point (trajectory query) is in world space while the facing direction from the
+        // sample of this trajectory feature is in relative-to-frame-root-joint space.
+        const size_t numControlPoints = controlPoints.size();
+        AZStd::vector<AZ::Vector2> controlPointPositions(numControlPoints);
+        AZStd::vector<AZ::Vector2> controlPointFacingDirs(numControlPoints);
+        AZStd::vector<size_t> sampleIndices(numControlPoints);
+        for (size_t i = 0; i < numControlPoints; ++i)
+        {
+            controlPointPositions[i] = AZ::Vector2(invRootTransform.TransformPoint(controlPoints[i].m_position));
+            controlPointFacingDirs[i] = AZ::Vector2(invRootTransform.TransformVector(controlPoints[i].m_facingDirection));
+            sampleIndices[i] = splineToFeatureMatrixIndex(i);
+        }
 
-        for (size_t i = 0; i < controlPoints.size(); ++i)
+        for (size_t frame = 0; frame < frameIndices.size(); ++frame)
         {
-            const TrajectoryQuery::ControlPoint& controlPoint = controlPoints[i];
-            const Sample sample = GetFeatureData(featureMatrix, frameIndex, splineToFeatureMatrixIndex(i));
-            const AZ::Vector2& samplePos = sample.m_position;
-            const AZ::Vector2 controlPointPos = AZ::Vector2(invRootTransform.TransformPoint(controlPoint.m_position)); // Convert so it is relative to where we are and pointing to.
+            const size_t frameIndex = frameIndices[frame];
+            float cost = 0.0f;
+            AZ::Vector2 lastSamplePos;
 
-            if (i != 0)
+            for (size_t i = 0; i < numControlPoints; ++i)
             {
-                const AZ::Vector2 controlPointDelta = controlPointPos - lastControlPoint;
-                const AZ::Vector2 sampleDelta = samplePos - lastSamplePos;
+                const Sample sample = GetFeatureData(featureMatrix, frameIndex, sampleIndices[i]);
+                const AZ::Vector2& samplePos = sample.m_position;
+                const AZ::Vector2& controlPointPos = controlPointPositions[i];
 
-                const float posDistance = (samplePos - controlPointPos).GetLength();
-                const float posDeltaDistance = (controlPointDelta - sampleDelta).GetLength();
+                if (i != 0)
+                {
+                    const AZ::Vector2 controlPointDelta = controlPointPos - controlPointPositions[i - 1];
+                    const AZ::Vector2 sampleDelta = samplePos - lastSamplePos;
 
-                // The facing direction from the control point (trajectory query) is in world space while the facing direction from the
-                // sample of this trajectory feature is in relative-to-frame-root-joint space.
-                const AZ::Vector2 controlPointFacingDirRelativeSpace = AZ::Vector2(invRootTransform.TransformVector(controlPoint.m_facingDirection));
-                const float facingDirectionCost = GetNormalizedDirectionDifference(sample.m_facingDirection,
-                    controlPointFacingDirRelativeSpace);
+                    const float posDistance = (samplePos - controlPointPos).GetLength();
+                    const float posDeltaDistance = (controlPointDelta - sampleDelta).GetLength();
+                    const float facingDirectionCost = GetNormalizedDirectionDifference(sample.m_facingDirection, controlPointFacingDirs[i]);
 
-                // As we got two different costs for the position, double the cost of the facing direction to equal out the influence.
-                cost += CalcResidual(posDistance) + CalcResidual(posDeltaDistance) + CalcResidual(facingDirectionCost) * 2.0f;
+                    // As we got two different costs for the position, double the cost of the facing direction to equal out the influence.
+                    cost += CalcResidual(posDistance) + CalcResidual(posDeltaDistance) + CalcResidual(facingDirectionCost) * 2.0f;
+                }
+
+                lastSamplePos = samplePos;
             }
 
-            lastControlPoint = controlPointPos;
-            lastSamplePos = samplePos;
+            outCosts[frame] = cost;
         }
+    }
+
+    float FeatureTrajectory::CalculateFutureFrameCost(size_t frameIndex, const FrameCostContext& context) const
+    {
+        float cost = 0.0f;
+        CalculateFutureFrameCosts(AZStd::span<const size_t>(&frameIndex, 1), context, AZStd::span<float>(&cost, 1));
+        return cost;
+    }
 
+    float FeatureTrajectory::CalculatePastFrameCost(size_t frameIndex, const FrameCostContext& context) const
+    {
+        float cost = 0.0f;
+        CalculatePastFrameCosts(AZStd::span<const size_t>(&frameIndex, 1), context, AZStd::span<float>(&cost, 1));
         return cost;
     }
 
-    float FeatureTrajectory::CalculateFutureFrameCost(size_t frameIndex, const FrameCostContext& context) const
+    void FeatureTrajectory::CalculateFutureFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
     {
         AZ_Assert(context.m_trajectoryQuery->GetFutureControlPoints().size() == m_numFutureSamples, "Number of future control points from the trajectory query does not match the one from the trajectory feature.");
         const Transform invRootTransform = context.m_currentPose.GetWorldSpaceTransform(m_relativeToNodeIndex).Inversed();
-        return CalculateCost(context.m_featureMatrix, frameIndex, invRootTransform, context.m_trajectoryQuery->GetFutureControlPoints(), AZStd::bind(&FeatureTrajectory::CalcFutureFrameIndex, this, AZStd::placeholders::_1));
+        CalculateCosts(context.m_featureMatrix, frameIndices, invRootTransform, context.m_trajectoryQuery->GetFutureControlPoints(), AZStd::bind(&FeatureTrajectory::CalcFutureFrameIndex, this, AZStd::placeholders::_1), outCosts);
     }
 
-    float FeatureTrajectory::CalculatePastFrameCost(size_t frameIndex, const FrameCostContext& context) const
+    void FeatureTrajectory::CalculatePastFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
     {
         AZ_Assert(context.m_trajectoryQuery->GetPastControlPoints().size() == m_numPastSamples, "Number of past control points from the trajectory query does not match the one from the trajectory feature");
         const Transform invRootTransform = context.m_currentPose.GetWorldSpaceTransform(m_relativeToNodeIndex).Inversed();
-        return CalculateCost(context.m_featureMatrix, frameIndex, invRootTransform, context.m_trajectoryQuery->GetPastControlPoints(), AZStd::bind(&FeatureTrajectory::CalcPastFrameIndex, this, AZStd::placeholders::_1));
+        CalculateCosts(context.m_featureMatrix, frameIndices, invRootTransform, context.m_trajectoryQuery->GetPastControlPoints(), AZStd::bind(&FeatureTrajectory::CalcPastFrameIndex, this, AZStd::placeholders::_1), outCosts);
     }
 
     AZ::Crc32 FeatureTrajectory::GetCostFactorVisibility() const
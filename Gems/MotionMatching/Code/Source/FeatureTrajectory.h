@@ -68,6 +68,11 @@ namespace EMotionFX::MotionMatching
         float CalculateFutureFrameCost(size_t frameIndex, const FrameCostContext& context) const;
         float CalculatePastFrameCost(size_t frameIndex, const FrameCostContext& context) const;
 
+        //! Batched versions of CalculateFutureFrameCost() and CalculatePastFrameCost() that convert the trajectory query
+        //! control points into the relative space only once for all of the given frames.
+        void CalculateFutureFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const;
+        void CalculatePastFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const;
+
         void SetNumPastSamplesPerFrame(size_t numHistorySamples);
         void SetNumFutureSamplesPerFrame(size_t numFutureSamples);
         void SetPastTimeRange(float timeInSeconds);
@@ -103,11 +108,12 @@ namespace EMotionFX::MotionMatching
         size_t CalcNumSamplesPerFrame() const;
 
         using SplineToFeatureMatrixIndex = AZStd::function<size_t(size_t)>;
-        float CalculateCost(const FeatureMatrix& featureMatrix,
-            size_t frameIndex,
+        void CalculateCosts(const FeatureMatrix& featureMatrix,
+            AZStd::span<const size_t> frameIndices,
             const Transform& invRootTransform,
             const AZStd::vector<TrajectoryQuery::ControlPoint>& controlPoints,
-            const SplineToFeatureMatrixIndex& splineToFeatureMatrixIndex) const;
+            const SplineToFeatureMatrixIndex& splineToFeatureMatrixIndex,
+            AZStd::span<float> outCosts) const;
 
         //! Called for every sample in the past or future range to extract its information.
         //! @param[in] pose The sampled pose within the trajectory range [m_pastTimeRange, m_futureTimeRange].
@@ -78,21 +78,36 @@ namespace EMotionFX::MotionMatching
 
     float FeatureVelocity::CalculateFrameCost(size_t frameIndex, const FrameCostContext& context) const
     {
+        float cost = 0.0f;
+        CalculateFrameCosts(AZStd::span<const size_t>(&frameIndex, 1), context, AZStd::span<float>(&cost, 1));
+        return cost;
+    }
+
+    void FeatureVelocity::CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        AZ_Assert(frameIndices.size() == outCosts.size(), "The output costs need to be the same size as the frame indices.");
+
+        // Look up the input query velocity only once for all frames.
         PoseDataJointVelocities* velocityPoseData = static_cast<PoseDataJointVelocities*>(context.m_currentPose.GetPoseDataByType(azrtti_typeid<PoseDataJointVelocities>()));
         AZ_Assert(velocityPoseData, "Cannot calculate velocity feature cost without joint velocity pose data.");
         const AZ::Vector3 currentVelocity = velocityPoseData->GetVelocity(m_jointIndex);
+        const AZ::Vector3 currentDirection = currentVelocity.GetNormalized();
+        const float currentSpeed = currentVelocity.GetLength();
 
-        const AZ::Vector3 frameVelocity = GetFeatureData(context.m_featureMatrix, frameIndex);
+        for (size_t i = 0; i < frameIndices.size(); ++i)
+        {
+            const AZ::Vector3 frameVelocity = GetFeatureData(context.m_featureMatrix, frameIndices[i]);
 
-        // Direction difference
-        const float directionDifferenceCost = GetNormalizedDirectionDifference(frameVelocity.GetNormalized(), currentVelocity.GetNormalized());
+            // Direction difference
+            const float directionDifferenceCost = GetNormalizedDirectionDifference(frameVelocity.GetNormalized(), currentDirection);
 
-        // Speed difference
-        // TODO: This needs to be normalized later on, else wise it could be that the direction difference is weights
-        // too heavily or too less compared to what the speed values are
-        const float speedDifferenceCost = frameVelocity.GetLength() - currentVelocity.GetLength();
+            // Speed difference
+            // TODO: This needs to be normalized later on, else wise it could be that the direction difference is weights
+            // too heavily or too less compared to what the speed values are
+            const float speedDifferenceCost = frameVelocity.GetLength() - currentSpeed;
 
-        return CalcResidual(directionDifferenceCost) + CalcResidual(speedDifferenceCost);
+            outCosts[i] = CalcResidual(directionDifferenceCost) + CalcResidual(speedDifferenceCost);
+        }
     }
 
     void FeatureVelocity::Reflect(AZ::ReflectContext* context)
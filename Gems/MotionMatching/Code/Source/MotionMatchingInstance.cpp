@@ -8,6 +8,7 @@
 
 #include <AzCore/Debug/Timer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -450,14 +451,8 @@ namespace EMotionFX::MotionMatching
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
-        float minCost = FLT_MAX;
-        size_t minCostFrameIndex = 0;
-        m_tempCosts.resize(featureSchema.GetNumFeatures());
-        m_minCosts.resize(featureSchema.GetNumFeatures());
-        float minTrajectoryPastCost = 0.0f;
-        float minTrajectoryFutureCost = 0.0f;
-
-        // Iterate through the frames filtered by the broad-phase search.
+        // Gather the candidate frames first, so that every feature can calculate its costs for all of them in one go.
+        m_candidateFrames.clear();
 #ifdef SEARCH_THROUGH_WHOLE_MOTIONDATABASE
         for (size_t frameIndex = 0; frameIndex < frameDatabase.GetNumFrames(); ++frameIndex)
 #else
@@ -472,54 +467,92 @@ namespace EMotionFX::MotionMatching
                 continue;
             }
 
-            float frameCost = 0.0f;
+            m_candidateFrames.emplace_back(frameIndex);
+        }
 
-            // Calculate the frame cost by accumulating the weighted feature costs.
-            for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
-            {
-                Feature* feature = featureSchema.GetFeature(featureIndex);
-                if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                {
-                    const float featureCost = feature->CalculateFrameCost(frameIndex, context);
-                    const float featureCostFactor = feature->GetCostFactor();
-                    const float featureFinalCost = featureCost * featureCostFactor;
+        // One row of unweighted costs per feature, the trajectory feature using its row for the past and an extra row for the future costs.
+        // The rows are padded to a multiple of four candidates with zero costs, so that they can be accumulated four frames at a time.
+        const size_t numFeatures = featureSchema.GetNumFeatures();
+        const size_t numCandidates = m_candidateFrames.size();
+        const size_t rowSize = AZ::RoundUpToMultiple(numCandidates, static_cast<size_t>(4));
+        const size_t futureTrajectoryRow = numFeatures;
+        size_t pastTrajectoryRow = InvalidIndex;
+        m_featureCosts.assign((numFeatures + 1) * rowSize, 0.0f);
+        m_frameCosts.resize(rowSize);
+        m_costFactors.resize(numFeatures + 1);
+
+        const AZStd::span<const size_t> candidateFrames(m_candidateFrames.data(), numCandidates);
+        const auto GetCostRow = [this, rowSize, numCandidates](size_t row)
+        {
+            return AZStd::span<float>(m_featureCosts.data() + row * rowSize, numCandidates);
+        };
 
-                    frameCost += featureFinalCost;
-                    m_tempCosts[featureIndex] = featureFinalCost;
-                }
+        for (size_t featureIndex = 0; featureIndex < numFeatures; ++featureIndex)
+        {
+            const Feature* feature = featureSchema.GetFeature(featureIndex);
+            if (feature == trajectoryFeature)
+            {
+                pastTrajectoryRow = featureIndex;
+                trajectoryFeature->CalculatePastFrameCosts(candidateFrames, context, GetCostRow(featureIndex));
+                trajectoryFeature->CalculateFutureFrameCosts(candidateFrames, context, GetCostRow(futureTrajectoryRow));
+                m_costFactors[featureIndex] = trajectoryFeature->GetPastCostFactor();
+                m_costFactors[futureTrajectoryRow] = trajectoryFeature->GetFutureCostFactor();
             }
-
-            // Manually add the trajectory cost.
-            float trajectoryPastCost = 0.0f;
-            float trajectoryFutureCost = 0.0f;
-            if (trajectoryFeature)
+            else if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
             {
-                trajectoryPastCost = trajectoryFeature->CalculatePastFrameCost(frameIndex, context) * trajectoryFeature->GetPastCostFactor();
-                trajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(frameIndex, context) * trajectoryFeature->GetFutureCostFactor();
-                frameCost += trajectoryPastCost;
-                frameCost += trajectoryFutureCost;
+                feature->CalculateFrameCosts(candidateFrames, context, GetCostRow(featureIndex));
+                m_costFactors[featureIndex] = feature->GetCostFactor();
             }
-
-            // Track the minimum feature and frame costs.
-            if (frameCost < minCost)
+            else
             {
-                minCost = frameCost;
-                minCostFrameIndex = frameIndex;
+                m_costFactors[featureIndex] = 0.0f;
+            }
+        }
+        if (!trajectoryFeature)
+        {
+            m_costFactors[futureTrajectoryRow] = 0.0f;
+        }
 
-                for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+        // Calculate the frame costs by accumulating the weighted feature costs, four frames at a time.
+        {
+            using namespace AZ::Simd;
+            for (size_t i = 0; i < rowSize; i += 4)
+            {
+                Vec4::FloatType frameCosts = Vec4::ZeroFloat();
+                for (size_t row = 0; row <= numFeatures; ++row)
                 {
-                    Feature* feature = featureSchema.GetFeature(featureIndex);
-                    if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                    {
-                        m_minCosts[featureIndex] = m_tempCosts[featureIndex];
-                    }
+                    frameCosts = Vec4::Madd(Vec4::Splat(m_costFactors[row]), Vec4::LoadUnaligned(m_featureCosts.data() + row * rowSize + i), frameCosts);
                 }
+                Vec4::StoreUnaligned(m_frameCosts.data() + i, frameCosts);
+            }
+        }
 
-                minTrajectoryPastCost = trajectoryPastCost;
-                minTrajectoryFutureCost = trajectoryFutureCost;
+        // Find the frame with the minimum cost.
+        float minCost = FLT_MAX;
+        size_t minCostCandidate = InvalidIndex;
+        for (size_t i = 0; i < numCandidates; ++i)
+        {
+            if (m_frameCosts[i] < minCost)
+            {
+                minCost = m_frameCosts[i];
+                minCostCandidate = i;
             }
         }
 
+        // Track the weighted feature costs of the lowest cost frame.
+        const size_t minCostFrameIndex = minCostCandidate != InvalidIndex ? m_candidateFrames[minCostCandidate] : 0;
+        const auto GetMinCost = [this, rowSize, minCostCandidate](size_t row)
+        {
+            return minCostCandidate != InvalidIndex ? m_featureCosts[row * rowSize + minCostCandidate] * m_costFactors[row] : 0.0f;
+        };
+        m_minCosts.resize(numFeatures);
+        for (size_t featureIndex = 0; featureIndex < numFeatures; ++featureIndex)
+        {
+            m_minCosts[featureIndex] = GetMinCost(featureIndex);
+        }
+        const float minTrajectoryPastCost = pastTrajectoryRow != InvalidIndex ? GetMinCost(pastTrajectoryRow) : 0.0f;
+        const float minTrajectoryFutureCost = GetMinCost(futureTrajectoryRow);
+
         // 3. ImGui debug visualization
         {
             const float time = timer.GetDeltaTimeInSeconds();
@@ -118,7 +118,10 @@ namespace EMotionFX::MotionMatching
         float m_blendProgressTime = 0.0f; //< How long are we already blending? In seconds.
 
         /// Buffers used for FindLowestCostFrameIndex().
-        AZStd::vector<float> m_tempCosts;
+        AZStd::vector<size_t> m_candidateFrames; //< The frames from the broad-phase search that the narrow-phase calculates the costs for.
+        AZStd::vector<float> m_featureCosts; //< Unweighted feature costs for all candidate frames, one row per feature.
+        AZStd::vector<float> m_costFactors; //< Cost factor for each row of the feature costs.
+        AZStd::vector<float> m_frameCosts; //< Accumulated weighted cost per candidate frame.
         AZStd::vector<float> m_minCosts;
     };
 } // namespace EMotionFX::MotionMatching
@@ -29,6 +29,9 @@ namespace Multiplayer
     class NetBindComponent;
     class MultiplayerController;
 
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    class RewindableObject;
+
     class MultiplayerComponent
         : public AZ::Component
     {
@@ -155,6 +158,51 @@ namespace Multiplayer
         }
     }
 
+    //! Serializes a network property or input through an intermediate SERIALIZE_AS representation, such as a quantized type.
+    template <typename SERIALIZE_AS, typename TYPE>
+    struct NetworkPropertySerializeAs
+    {
+        TYPE& m_value;
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            SERIALIZE_AS value(m_value);
+            if (serializer.Serialize(value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+            {
+                m_value = static_cast<TYPE>(value);
+            }
+            return serializer.IsValid();
+        }
+    };
+
+    template <typename SERIALIZE_AS, typename TYPE, AZStd::size_t REWIND_SIZE>
+    struct NetworkPropertySerializeAs<SERIALIZE_AS, RewindableObject<TYPE, REWIND_SIZE>>
+    {
+        RewindableObject<TYPE, REWIND_SIZE>& m_value;
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return m_value.template SerializeAs<SERIALIZE_AS>(serializer);
+        }
+    };
+
+    template <typename SERIALIZE_AS, typename TYPE>
+    inline void SerializeNetworkPropertyHelperAs
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        const char* name,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        NetworkPropertySerializeAs<SERIALIZE_AS, TYPE> serializeAs{ value };
+        SerializeNetworkPropertyHelper(serializer, bitset, bitIndex, serializeAs, name, componentId, propertyIndex, stats);
+    }
+
     template <typename TYPE, AZStd::size_t SIZE>
     inline void SerializeNetworkPropertyHelperArray
     (
@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 
@@ -51,6 +52,9 @@ namespace Multiplayer
             const Physics::ShapeConfiguration* m_shapeConfig = nullptr;
             AZ::Transform m_colliderOffSetTransform;
             const AZ::u32 m_jointIndex = 0;
+
+            // Index of this volume in the hit volume history, InvalidVolumeIndex if the shape can't be tracked
+            uint32_t m_historyIndex = HitVolumeHistory::InvalidVolumeIndex;
         };
 
         AZ_MULTIPLAYER_COMPONENT(Multiplayer::NetworkHitVolumesComponent, s_networkHitVolumesComponentConcreteUuid, Multiplayer::NetworkHitVolumesComponentBase);
@@ -63,11 +67,21 @@ namespace Multiplayer
         void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
 
+        //! Returns the recorded history of hit volume poses, used for lag compensated queries that don't rewind the physics scene.
+        //! @return the hit volume history of this entity
+        const HitVolumeHistory& GetHitVolumeHistory() const;
+
+        //! Returns the name of the hit volume for a volume index reported by the hit volume history.
+        //! @param volumeIndex the history volume index
+        //! @return the name of the hit volume, or an empty string if the index is not valid
+        AZStd::string_view GetHitVolumeName(uint32_t volumeIndex) const;
+
     private:
         void OnPreRender(float deltaTime);
         void OnTransformUpdate(const AZ::Transform& transform);
         void OnSyncRewind();
 
+        void RecordHitVolumeHistory();
         void CreateHitVolumes();
         void DestroyHitVolumes();
 
@@ -83,6 +97,10 @@ namespace Multiplayer
 
         AZStd::vector<AnimatedHitVolume> m_animatedHitVolumes;
 
+        HitVolumeHistory m_hitVolumeHistory;
+        AZStd::vector<AZ::Transform> m_historyTransforms;
+        AZStd::vector<AZStd::string> m_historyVolumeNames;
+
         Multiplayer::EntitySyncRewindEvent::Handler m_syncRewindHandler;
         Multiplayer::EntityPreRenderEvent::Handler m_preRenderHandler;
         AZ::TransformChangedEvent::Handler m_transformChangedHandler;
@@ -42,6 +42,11 @@ namespace Multiplayer
         //! Creates and manages sending updates to the remote endpoint.
         virtual void Update() = 0;
 
+        //! Performs the main thread portion of Update() that runs before entity updates are gathered.
+        //! Used when the entity updates of multiple connections are gathered in parallel.
+        //! @return true if entity updates should be sent to the remote endpoint this frame
+        virtual bool PreUpdate() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
@@ -11,6 +11,7 @@
 #include <AzCore/Time/ITime.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace AzNetworking
@@ -59,6 +60,11 @@ namespace Multiplayer
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
+        //! Enables locking of the sent property metrics while entity updates are serialized on multiple threads.
+        void SetConcurrentRecording(bool concurrentRecording);
+        //! Returns true if handlers are connected to the serialization events, which must be signalled from a single thread.
+        bool HasSerializationEventHandlers() const;
+
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
         Metric CalculateComponentPropertyUpdateRecvMetrics(NetComponentId netComponentId) const;
         Metric CalculateComponentRpcsSentMetrics(NetComponentId netComponentId) const;
@@ -93,5 +99,9 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+    private:
+        AZStd::mutex m_recordMutex;
+        bool m_concurrentRecording = false;
     };
 }
@@ -10,6 +10,7 @@
 
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/SnapshotDeltaCodec.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -18,8 +19,10 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/limits.h>
@@ -61,6 +64,14 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates();
+
+        //! Gathers and serializes the entity updates to send this frame without sending them, the first half of SendUpdates().
+        //! Only touches state owned by this replication manager, so it may run concurrently with PrepareUpdates() of other managers.
+        void PrepareUpdates();
+
+        //! Sends the entity updates gathered by PrepareUpdates() along with any deferred RPCs, the second half of SendUpdates().
+        //! Must be called on the main thread.
+        void FlushUpdates();
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -91,6 +102,17 @@ namespace Multiplayer
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
+        //! Returns the compressor used to entropy code entity snapshot deltas, or nullptr if snapshot deltas aren't compressed.
+        AzNetworking::ICompressor* GetSnapshotCompressor() const;
+
+        //! Reads a snapshot delta for an entity and decodes it against the baseline it was encoded against.
+        //! The decoded snapshot is stored so later snapshot deltas for the entity can use it as their baseline.
+        //! @param netEntityId the entity the snapshot delta was received for
+        //! @param serializer  serializer positioned at the snapshot delta
+        //! @param outSnapshot receives the decoded snapshot
+        //! @return boolean true if the snapshot delta was decoded
+        bool DecodeSnapshotDelta(NetEntityId netEntityId, AzNetworking::ISerializer& serializer, SnapshotBuffer& outSnapshot);
+
         void SetMaxRemoteEntitiesPendingCreationCount(uint32_t maxPendingEntities);
         void SetEntityActivationTimeSliceMs(AZ::TimeMs timeSliceMs);
         void SetEntityPendingRemovalMs(AZ::TimeMs entityPendingRemovalMs);
@@ -120,7 +142,15 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        //! An entity update serialized by PrepareUpdates() that is waiting to be sent
+        struct PreparedEntityUpdate
+        {
+            EntityReplicator* m_replicator = nullptr;
+            NetworkEntityUpdateMessage m_updateMessage;
+        };
+        using PreparedEntityUpdateList = AZStd::deque<PreparedEntityUpdate>;
+
+        void SendEntityUpdateMessages(PreparedEntityUpdateList& updateList);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -184,6 +214,21 @@ namespace Multiplayer
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
 
+        //! Scheduling state for proxy replicators, priority accumulates every frame an update is pending but not sent
+        struct ReplicationPriorityState
+        {
+            float m_accumulatedPriority = 0.0f;
+            uint32_t m_lastUpdateSize = 0;
+        };
+        AZStd::unordered_map<NetEntityId, ReplicationPriorityState> m_replicationPriorities;
+
+        //! Snapshots received for entities replicated with snapshot deltas, used as baselines to decode later snapshot deltas
+        AZStd::unordered_map<NetEntityId, SnapshotBaselineRing> m_receivedSnapshots;
+        AZStd::unique_ptr<AzNetworking::ICompressor> m_snapshotCompressor;
+
+        //! Entity updates serialized by PrepareUpdates(), in send order
+        PreparedEntityUpdateList m_preparedUpdates;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzNetworking
+{
+    class ICompressor;
+    class ISerializer;
+}
+
+namespace Multiplayer
+{
+    using SnapshotSequence = uint16_t;
+    using SnapshotBuffer = AZStd::vector<uint8_t>;
+
+    //! The number of snapshots kept as baselines for each entity.
+    //! Senders never encode a snapshot against a baseline that is this many snapshots older than the snapshot being sent.
+    static constexpr uint32_t MaxSnapshotBaselines = 32;
+
+    //! @class SnapshotBaselineRing
+    //! @brief Ring of the most recently received entity snapshots, indexed by snapshot sequence.
+    class SnapshotBaselineRing
+    {
+    public:
+        //! Stores a decoded snapshot so later snapshot deltas can be decoded against it.
+        //! @param sequence the snapshot sequence of the snapshot
+        //! @param snapshot the decoded snapshot, moved into the ring
+        void Store(SnapshotSequence sequence, SnapshotBuffer&& snapshot);
+
+        //! Returns the snapshot stored for the provided sequence, or nullptr if it has been overwritten or was never received.
+        //! @param sequence the snapshot sequence to look up
+        //! @return pointer to the stored snapshot, or nullptr
+        const SnapshotBuffer* Find(SnapshotSequence sequence) const;
+
+        //! Discards all stored snapshots.
+        void Clear();
+
+    private:
+        struct Baseline
+        {
+            SnapshotBuffer m_snapshot;
+            SnapshotSequence m_sequence = 0;
+            bool m_isValid = false;
+        };
+        AZStd::array<Baseline, MaxSnapshotBaselines> m_baselines;
+    };
+
+    //! @struct SnapshotDeltaHeader
+    //! @brief Identifies a snapshot delta and the baseline it was encoded against.
+    struct SnapshotDeltaHeader
+    {
+        SnapshotSequence m_sequence = 0;
+        SnapshotSequence m_baselineSequence = 0;
+        bool m_hasBaseline = false;
+
+        bool Serialize(AzNetworking::ISerializer& serializer);
+    };
+
+    //! Encodes full entity snapshots as a delta against a baseline snapshot the remote endpoint has acknowledged.
+    //! The snapshot is XOR-ed against the baseline, so unchanged bytes become zero, and the result is packed as runs of zero
+    //! bytes and literal bytes. The packed delta is optionally entropy coded with an ICompressor when that makes it smaller.
+    namespace SnapshotDeltaCodec
+    {
+        //! Encodes a snapshot against an optional baseline.
+        //! @param snapshot   the serialized entity snapshot to encode
+        //! @param baseline   the baseline to encode against, or nullptr to encode against an empty baseline
+        //! @param compressor optional compressor used to entropy code the packed delta, may be nullptr
+        //! @param outEncoded receives the encoded delta
+        //! @return boolean true on success
+        bool Encode(const SnapshotBuffer& snapshot, const SnapshotBuffer* baseline, AzNetworking::ICompressor* compressor, SnapshotBuffer& outEncoded);
+
+        //! Decodes a snapshot delta produced by Encode.
+        //! @param encoded      the encoded delta
+        //! @param encodedSize  the size of the encoded delta in bytes
+        //! @param baseline     the baseline the delta was encoded against, or nullptr if it was encoded without one
+        //! @param compressor   compressor matching the one used to encode the delta, may be nullptr if the delta is uncompressed
+        //! @param outSnapshot  receives the decoded snapshot
+        //! @return boolean true on success, false if the delta is malformed or requires a compressor that isn't available
+        bool Decode(const uint8_t* encoded, uint32_t encodedSize, const SnapshotBuffer* baseline, AzNetworking::ICompressor* compressor, SnapshotBuffer& outSnapshot);
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Physics
+{
+    class ShapeConfiguration;
+}
+
+namespace Multiplayer
+{
+    //! @class HitVolumeHistory
+    //! @brief Fixed size history of world space hit volume poses, keyed by HostFrameId, for lag compensated hit detection.
+    //! Poses are stored as a structure of arrays, with all volumes of a frame stored contiguously, so queries against a
+    //! historical frame only touch the memory of that frame. Queries are resolved analytically against the recorded
+    //! spheres, capsules and boxes and never rewind or query the physics scene.
+    class HitVolumeHistory
+    {
+    public:
+
+        static constexpr uint32_t InvalidVolumeIndex = static_cast<uint32_t>(-1);
+
+        enum class VolumeShape : uint8_t
+        {
+            Sphere,  // m_dimensions.x holds the radius
+            Capsule, // m_dimensions.x holds the radius, m_dimensions.z holds the half height of the segment along the local z axis
+            Box      // m_dimensions holds the half extents
+        };
+
+        //! Result of a ray query against the history.
+        struct RayHit
+        {
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            float m_distance = 0.0f;
+            uint32_t m_volumeIndex = InvalidVolumeIndex;
+        };
+
+        HitVolumeHistory();
+
+        //! Removes all volumes and recorded frames.
+        void Clear();
+
+        //! Returns the number of volumes tracked by this history.
+        //! @return the number of volumes tracked by this history
+        uint32_t GetVolumeCount() const;
+
+        //! Adds a volume described by a physics shape configuration, discarding all recorded frames.
+        //! Only sphere, capsule and box shapes are supported.
+        //! @param shapeConfig the shape configuration of the volume
+        //! @return the index of the new volume, or InvalidVolumeIndex if the shape type is not supported
+        uint32_t AddVolume(const Physics::ShapeConfiguration& shapeConfig);
+
+        //! Adds a volume of the provided shape, discarding all recorded frames.
+        //! @param shape      the shape of the volume
+        //! @param dimensions the dimensions of the volume, see VolumeShape
+        //! @return the index of the new volume
+        uint32_t AddVolume(VolumeShape shape, const AZ::Vector3& dimensions);
+
+        //! Records the poses of all volumes for a host frame, replacing the oldest recorded frame if the history is full.
+        //! @param frameId         the host frame the poses belong to
+        //! @param worldTransform  the world transform of the entity owning the volumes
+        //! @param localTransforms the entity relative transform of each volume, in the order the volumes were added
+        //! The uniform scale of worldTransform is applied to the volume dimensions when querying the frame.
+        void Record(HostFrameId frameId, const AZ::Transform& worldTransform, AZStd::span<const AZ::Transform> localTransforms);
+
+        //! Returns true if poses have been recorded for the provided host frame.
+        //! @param frameId the host frame to check
+        //! @return boolean true if poses are available for the host frame
+        bool HasFrame(HostFrameId frameId) const;
+
+        //! Finds the closest volume intersected by a ray, as the volumes were posed at the provided host frame.
+        //! @param frameId     the host frame to test against
+        //! @param blendFactor blend factor between the previous frame and frameId, matching INetworkTime::GetHostBlendFactor
+        //! @param origin      the world space origin of the ray
+        //! @param direction   the normalized world space direction of the ray
+        //! @param maxDistance the maximum distance along the ray to test
+        //! @param outHit      receives the closest hit
+        //! @return boolean true if a volume was hit
+        bool Raycast(HostFrameId frameId, float blendFactor, const AZ::Vector3& origin, const AZ::Vector3& direction, float maxDistance, RayHit& outHit) const;
+
+        //! Finds all volumes overlapping a sphere, as the volumes were posed at the provided host frame.
+        //! @param frameId       the host frame to test against
+        //! @param blendFactor   blend factor between the previous frame and frameId, matching INetworkTime::GetHostBlendFactor
+        //! @param center        the world space center of the sphere
+        //! @param radius        the radius of the sphere
+        //! @param outVolumes    receives the indices of all overlapping volumes
+        //! @return boolean true if any volume overlaps the sphere
+        bool OverlapSphere(HostFrameId frameId, float blendFactor, const AZ::Vector3& center, float radius, AZStd::vector<uint32_t>& outVolumes) const;
+
+    private:
+
+        struct Pose
+        {
+            AZ::Vector3 m_position;
+            AZ::Quaternion m_rotation;
+        };
+
+        //! Returns the history slot holding the provided frame, or RewindHistorySize if the frame isn't recorded.
+        uint32_t FindSlot(HostFrameId frameId) const;
+
+        //! Computes the pose of a volume, blending between two recorded slots.
+        Pose GetPose(uint32_t slot, uint32_t previousSlot, float blendFactor, uint32_t volumeIndex) const;
+
+        //! Computes the uniform scale of the volumes, blending between two recorded slots.
+        float GetScale(uint32_t slot, uint32_t previousSlot, float blendFactor) const;
+
+        //! Computes a sphere bounding all volumes for any blend between two recorded slots, used to reject queries early.
+        void GetBounds(uint32_t slot, uint32_t previousSlot, AZ::Vector3& outCenter, float& outRadius) const;
+
+        // Per volume data
+        AZStd::vector<VolumeShape> m_shapes;
+        AZStd::vector<AZ::Vector3> m_dimensions;
+        float m_maxVolumeRadius = 0.0f;
+
+        // Per frame data
+        AZStd::array<HostFrameId, RewindHistorySize> m_frameIds;
+        AZStd::array<AZ::Vector3, RewindHistorySize> m_boundsCenters;
+        AZStd::array<float, RewindHistorySize> m_boundsRadii;
+        AZStd::array<float, RewindHistorySize> m_scales;
+
+        // Per frame, per volume data, indexed by slot * volume count + volume index
+        AZStd::vector<float> m_positionsX;
+        AZStd::vector<float> m_positionsY;
+        AZStd::vector<float> m_positionsZ;
+        AZStd::vector<AZ::Quaternion> m_rotations;
+    };
+}
@@ -87,6 +87,13 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serializes the current value through an intermediate representation, such as a quantized type.
+        //! SERIALIZE_AS must be constructible from BASE_TYPE, convertible back to BASE_TYPE and serializable.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        template <typename SERIALIZE_AS>
+        bool SerializeAs(AzNetworking::ISerializer& serializer);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
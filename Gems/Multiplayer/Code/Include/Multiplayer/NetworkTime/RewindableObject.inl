@@ -124,6 +124,23 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    template <typename SERIALIZE_AS>
+    inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::SerializeAs(AzNetworking::ISerializer& serializer)
+    {
+        const HostFrameId frameTime = GetCurrentTimeForProperty();
+        SERIALIZE_AS value(GetValueForTime(frameTime));
+        if (serializer.Serialize(value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        {
+            SetValueForTime(static_cast<BASE_TYPE>(value), frameTime);
+            if (m_headTime == frameTime && m_headTime > m_lastSerializedTime)
+            {
+                m_lastSerializedTime = m_headTime;
+            }
+        }
+        return serializer.IsValid();
+    }
+
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline HostFrameId RewindableObject<BASE_TYPE, REWIND_SIZE>::GetCurrentTimeForProperty() const
     {
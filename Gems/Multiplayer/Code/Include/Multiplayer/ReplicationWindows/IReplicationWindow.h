@@ -23,6 +23,8 @@ namespace Multiplayer
         EntityReplicationData() = default;
         NetEntityRole m_netEntityRole = NetEntityRole::InvalidRole;
         float m_priority = 0.0f;
+        //! Proxy updates for the entity are only sent every m_updateInterval host frames
+        uint32_t m_updateInterval = 1;
     };
     using ReplicationSet = AZStd::map<ConstNetworkEntityHandle, EntityReplicationData>;
     using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
@@ -37,6 +39,8 @@ namespace Multiplayer
         virtual const ReplicationSet& GetReplicationSet() const = 0;
         //! Max number of entities we can send updates for in one frame
         virtual uint32_t GetMaxProxyEntityReplicatorSendCount() const = 0;
+        //! Max number of bytes of proxy entity updates we can send in one frame, proxy updates are packed against this budget in priority order
+        virtual uint32_t GetMaxProxyEntityReplicatorSendBytes() const = 0;
         virtual bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const = 0;
         virtual void UpdateWindow() = 0;
         virtual AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) = 0;
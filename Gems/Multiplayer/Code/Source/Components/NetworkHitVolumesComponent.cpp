@@ -149,6 +149,37 @@ namespace Multiplayer
             m_actorComponent->GetJointTransformComponents(hitVolume.m_jointIndex, EMotionFX::Integration::Space::ModelSpace, position, rotation, scale);
             hitVolume.UpdateTransform(AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform);
         }
+
+        RecordHitVolumeHistory();
+    }
+
+    const HitVolumeHistory& NetworkHitVolumesComponent::GetHitVolumeHistory() const
+    {
+        return m_hitVolumeHistory;
+    }
+
+    AZStd::string_view NetworkHitVolumesComponent::GetHitVolumeName(uint32_t volumeIndex) const
+    {
+        return (volumeIndex < m_historyVolumeNames.size()) ? AZStd::string_view(m_historyVolumeNames[volumeIndex]) : AZStd::string_view();
+    }
+
+    void NetworkHitVolumesComponent::RecordHitVolumeHistory()
+    {
+        INetworkTime* networkTime = Multiplayer::GetNetworkTime();
+        if (m_hitVolumeHistory.GetVolumeCount() == 0 || networkTime->IsTimeRewound())
+        {
+            // Only record live poses, rewound poses are already in the history
+            return;
+        }
+
+        for (const AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        {
+            if (hitVolume.m_historyIndex != HitVolumeHistory::InvalidVolumeIndex)
+            {
+                m_historyTransforms[hitVolume.m_historyIndex] = hitVolume.m_transform.Get();
+            }
+        }
+        m_hitVolumeHistory.Record(networkTime->GetHostFrameId(), GetTransformComponent()->GetWorldTM(), m_historyTransforms);
     }
 
     void NetworkHitVolumesComponent::OnTransformUpdate([[maybe_unused]] const AZ::Transform& transform)
@@ -199,14 +230,23 @@ namespace Multiplayer
             {
                 const Physics::ColliderConfiguration* colliderConfig = coliderPair.first.get();
                 Physics::ShapeConfiguration* shapeConfig = coliderPair.second.get();
-                m_animatedHitVolumes.emplace_back(owningConnectionId, m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
+                AnimatedHitVolume& hitVolume = m_animatedHitVolumes.emplace_back(owningConnectionId, m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
+                hitVolume.m_historyIndex = m_hitVolumeHistory.AddVolume(*shapeConfig);
+                if (hitVolume.m_historyIndex != HitVolumeHistory::InvalidVolumeIndex)
+                {
+                    m_historyVolumeNames.emplace_back(nodeConfig.m_name);
+                }
             }
         }
+        m_historyTransforms.resize(m_hitVolumeHistory.GetVolumeCount(), AZ::Transform::CreateIdentity());
     }
 
     void NetworkHitVolumesComponent::DestroyHitVolumes()
     {
         m_animatedHitVolumes.clear();
+        m_hitVolumeHistory.Clear();
+        m_historyTransforms.clear();
+        m_historyVolumeNames.clear();
     }
 
     void NetworkHitVolumesComponent::OnActorInstanceCreated([[maybe_unused]] EMotionFX::ActorInstance* actorInstance)
@@ -51,8 +51,16 @@ namespace Multiplayer
     }
 
     void ClientToServerConnectionData::Update()
+    {
+        if (PreUpdate())
+        {
+            m_entityReplicationManager.SendUpdates();
+        }
+    }
+
+    bool ClientToServerConnectionData::PreUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates();
+        return true;
     }
 }
@@ -72,6 +72,14 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update()
+    {
+        if (PreUpdate())
+        {
+            m_entityReplicationManager.SendUpdates();
+        }
+    }
+
+    bool ServerToClientConnectionData::PreUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
 
@@ -79,11 +87,9 @@ namespace Multiplayer
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates();
-            }
+            return netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority);
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
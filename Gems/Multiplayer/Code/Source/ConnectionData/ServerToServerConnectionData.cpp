@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ConnectionData/ServerToServerConnectionData.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Source/EntityDomains/SpatialEntityDomain.h>
+#include <Source/ReplicationWindows/ServerToServerReplicationWindow.h>
+
+namespace Multiplayer
+{
+    ServerToServerConnectionData::ServerToServerConnectionData
+    (
+        AzNetworking::IConnection* connection,
+        AzNetworking::IConnectionListener& connectionListener
+    )
+        : m_entityReplicationManager(*connection, connectionListener, EntityReplicationManager::Mode::LocalServerToRemoteServer)
+        , m_sendMigrateEntityHandler([this](AzNetworking::IConnection& connection, const EntityMigrationMessage& message)
+            {
+                OnSendMigrateEntity(connection, message);
+            })
+        , m_connection(connection)
+    {
+        m_entityReplicationManager.AddSendMigrateEntityEventHandler(m_sendMigrateEntityHandler);
+    }
+
+    ServerToServerConnectionData::~ServerToServerConnectionData()
+    {
+        m_entityReplicationManager.Clear(false);
+        m_sendMigrateEntityHandler.Disconnect();
+    }
+
+    void ServerToServerConnectionData::SetRemoteDomain(const HostId& publicHostId, const AZ::Aabb& remoteDomainAabb)
+    {
+        m_publicHostId = publicHostId;
+        m_entityReplicationManager.SetRemoteEntityDomain(AZStd::make_unique<SpatialEntityDomain>(remoteDomainAabb));
+        m_entityReplicationManager.SetReplicationWindow(AZStd::make_unique<ServerToServerReplicationWindow>(m_connection, remoteDomainAabb));
+    }
+
+    ConnectionDataType ServerToServerConnectionData::GetConnectionDataType() const
+    {
+        return ConnectionDataType::ServerToServer;
+    }
+
+    AzNetworking::IConnection* ServerToServerConnectionData::GetConnection() const
+    {
+        return m_connection;
+    }
+
+    EntityReplicationManager& ServerToServerConnectionData::GetReplicationManager()
+    {
+        return m_entityReplicationManager;
+    }
+
+    void ServerToServerConnectionData::Update()
+    {
+        if (PreUpdate())
+        {
+            m_entityReplicationManager.SendUpdates();
+        }
+    }
+
+    bool ServerToServerConnectionData::PreUpdate()
+    {
+        m_entityReplicationManager.ActivatePendingEntities();
+        return CanSendUpdates();
+    }
+
+    void ServerToServerConnectionData::OnSendMigrateEntity(AzNetworking::IConnection& connection, const EntityMigrationMessage& message)
+    {
+        // Migration hands over authority, it can't be dropped like a regular entity update
+        connection.SendReliablePacket(MultiplayerPackets::EntityMigration(message));
+    }
+}
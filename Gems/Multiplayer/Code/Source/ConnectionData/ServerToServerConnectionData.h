@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/ConnectionData/IConnectionData.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer
+{
+    //! Connection data of a connection between two servers that own neighboring entity domains.
+    //! Entities near the boundary are replicated to the peer as server proxies, and entities crossing into the domain of the peer migrate to it.
+    class ServerToServerConnectionData final
+        : public IConnectionData
+    {
+    public:
+        ServerToServerConnectionData
+        (
+            AzNetworking::IConnection* connection,
+            AzNetworking::IConnectionListener& connectionListener
+        );
+        ~ServerToServerConnectionData() override;
+
+        //! Sets up replication and migration towards the peer once its domain is known from the handshake.
+        //! @param publicHostId     the address clients connect to the peer server with
+        //! @param remoteDomainAabb the region owned by the peer server
+        void SetRemoteDomain(const HostId& publicHostId, const AZ::Aabb& remoteDomainAabb);
+
+        //! Returns the address clients connect to the peer server with.
+        //! @return the public host id of the peer server
+        const HostId& GetPublicHostId() const;
+
+        //! IConnectionData interface
+        //! @{
+        ConnectionDataType GetConnectionDataType() const override;
+        AzNetworking::IConnection* GetConnection() const override;
+        EntityReplicationManager& GetReplicationManager() override;
+        void Update() override;
+        bool PreUpdate() override;
+        bool CanSendUpdates() const override;
+        void SetCanSendUpdates(bool canSendUpdates) override;
+        bool DidHandshake() const override;
+        void SetDidHandshake(bool didHandshake) override;
+        //! @}
+
+    private:
+        void OnSendMigrateEntity(AzNetworking::IConnection& connection, const EntityMigrationMessage& message);
+
+        EntityReplicationManager m_entityReplicationManager;
+        SendMigrateEntityEvent::Handler m_sendMigrateEntityHandler;
+        HostId m_publicHostId = InvalidHostId;
+        AzNetworking::IConnection* m_connection = nullptr;
+        bool m_canSendUpdates = false;
+        bool m_didHandshake = false;
+    };
+}
+
+#include <Source/ConnectionData/ServerToServerConnectionData.inl>
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/EntityDomains/SpatialEntityDomain.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Color.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+
+namespace Multiplayer 
+{
+    AZ_CVAR(float, sv_EntityDomainMigrationMargin, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Distance an entity has to move past the boundary of a spatial entity domain before it migrates to the neighboring server");
+
+    static bool GetEntityPosition(const ConstNetworkEntityHandle& entityHandle, AZ::Vector3& outPosition)
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        const AZ::TransformInterface* transform = (entity != nullptr) ? entity->GetTransform() : nullptr;
+        if (transform == nullptr)
+        {
+            return false;
+        }
+        outPosition = transform->GetWorldTranslation();
+        return true;
+    }
+
+    SpatialEntityDomain::SpatialEntityDomain(const AZ::Aabb& aabb)
+        : m_aabb(aabb)
+    {
+        ;
+    }
+
+    void SpatialEntityDomain::SetAabb(const AZ::Aabb& aabb)
+    {
+        m_aabb = aabb;
+    }
+
+    const AZ::Aabb& SpatialEntityDomain::GetAabb() const
+    {
+        return m_aabb;
+    }
+
+    bool SpatialEntityDomain::IsInDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        AZ::Vector3 position;
+        if (!m_aabb.IsValid() || !GetEntityPosition(entityHandle, position))
+        {
+            return false;
+        }
+
+        // A peer domain tests the same extended region, so the overlap lets the receiving server accept an entity the moment it leaves its owner
+        AZ::Aabb extendedAabb = m_aabb;
+        extendedAabb.Expand(AZ::Vector3(sv_EntityDomainMigrationMargin));
+        return extendedAabb.Contains(position);
+    }
+
+    void SpatialEntityDomain::HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle)
+    {
+        // Only the server whose region strictly contains the entity takes over, peers sharing the margin leave it to that server
+        AZ::Vector3 position;
+        if (m_aabb.IsValid() && GetEntityPosition(entityHandle, position) && m_aabb.Contains(position))
+        {
+            AZLOG_INFO("Assuming authority over entity id %llu after losing its authoritative replicator", aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()));
+            GetNetworkEntityManager()->ForceAssumeAuthority(entityHandle);
+        }
+    }
+
+    void SpatialEntityDomain::DebugDraw() const
+    {
+        if (!m_aabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        if (debugDisplay != nullptr)
+        {
+            debugDisplay->SetColor(AZ::Colors::Orange);
+            debugDisplay->DrawWireBox(m_aabb.GetMin(), m_aabb.GetMax());
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer 
+{
+    //! @class SpatialEntityDomain
+    //! @brief An entity domain owning the entities positioned inside a region of space.
+    //! Neighboring servers each own a region, an entity leaving the region of its server migrates to the peer server whose region it entered.
+    //! The region is extended by a margin so entities moving back and forth across a boundary don't keep migrating.
+    class SpatialEntityDomain
+        : public IEntityDomain
+    {
+    public:
+        SpatialEntityDomain() = default;
+        explicit SpatialEntityDomain(const AZ::Aabb& aabb);
+        SpatialEntityDomain(const SpatialEntityDomain& rhs) = default;
+
+        //! IEntityDomain overrides.
+        //! @{
+        void SetAabb(const AZ::Aabb& aabb) override;
+        const AZ::Aabb& GetAabb() const override;
+        bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
+        void HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle) override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+        AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+    };
+}
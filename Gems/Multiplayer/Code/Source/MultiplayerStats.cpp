@@ -46,6 +46,12 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        AZStd::unique_lock<AZStd::mutex> lock(m_recordMutex, AZStd::defer_lock);
+        if (m_concurrentRecording)
+        {
+            lock.lock();
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -220,4 +226,17 @@ namespace Multiplayer
         handlers.m_rpcSent.Connect(m_events.m_rpcSent);
         handlers.m_rpcReceived.Connect(m_events.m_rpcReceived);
     }
+
+    void MultiplayerStats::SetConcurrentRecording(bool concurrentRecording)
+    {
+        m_concurrentRecording = concurrentRecording;
+    }
+
+    bool MultiplayerStats::HasSerializationEventHandlers() const
+    {
+        return m_events.m_entitySerializeStart.HasHandlerConnected()
+            || m_events.m_componentSerializeEnd.HasHandlerConnected()
+            || m_events.m_entitySerializeStop.HasHandlerConnected()
+            || m_events.m_propertySent.HasHandlerConnected();
+    }
 }
@@ -13,8 +13,10 @@
 #include <MultiplayerSystemComponent.h>
 #include <ConnectionData/ClientToServerConnectionData.h>
 #include <ConnectionData/ServerToClientConnectionData.h>
+#include <ConnectionData/ServerToServerConnectionData.h>
 #include <EntityDomains/FullOwnershipEntityDomain.h>
 #include <EntityDomains/NullEntityDomain.h>
+#include <EntityDomains/SpatialEntityDomain.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
@@ -24,6 +26,8 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -91,7 +95,19 @@ namespace Multiplayer
     AZ_CVAR(float, cl_renderTickBlendBase, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The base used for blending between network updates, 0.1 will be quite linear, 0.2 or 0.3 will "
         "slow down quicker and may be better suited to connections with highly variable latency");
+    AZ_CVAR(AZ::Vector3, sv_EntityDomainMin, AZ::Vector3::CreateZero(), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Minimum corner of the region of the world this server owns, a server without a valid region owns the whole world");
+    AZ_CVAR(AZ::Vector3, sv_EntityDomainMax, AZ::Vector3::CreateZero(), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Maximum corner of the region of the world this server owns, a server without a valid region owns the whole world");
     AZ_CVAR(bool, bg_multiplayerDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables debug draw for the multiplayer gem");
+    AZ_CVAR(bool, net_ParallelReplicationUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, the entity updates of each connection are gathered and serialized as parallel jobs before being sent in connection order");
+    AZ_CVAR(bool, sv_AdaptiveServerSendRate, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, the host frame and network update rate slows down from sv_serverSendRateMs when the measured server frame time can't keep up");
+    AZ_CVAR(AZ::TimeMs, sv_MaxAdaptiveServerSendRateMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of milliseconds between each network update when sv_AdaptiveServerSendRate is enabled");
+    AZ_CVAR(float, sv_AdaptiveServerSendRateHeadroom, 1.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The adaptive network update interval is kept at this multiple of the average server frame time");
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -363,7 +379,7 @@ namespace Multiplayer
         }
 
         const AZ::TimeMs deltaTimeMs = aznumeric_cast<AZ::TimeMs>(static_cast<int32_t>(deltaTime * 1000.0f));
-        const AZ::TimeMs serverRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
+        const AZ::TimeMs serverRateMs = UpdateServerSendRate(deltaTime);
         const float serverRateSeconds = static_cast<float>(serverRateMs) / 1000.0f;
 
         TickVisibleNetworkEntities(deltaTime, serverRateSeconds);
@@ -401,12 +417,24 @@ namespace Multiplayer
         {            
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - SendOutGameStateUpdate");
 
-            auto sendNetworkUpdates = [&stats](IConnection& connection)
+            // Per entity serialization debug handlers expect to be signalled from a single thread, so they force the serial path
+            const bool parallelUpdates = net_ParallelReplicationUpdates && !stats.HasSerializationEventHandlers();
+            AZStd::vector<IConnectionData*> updatingConnections;
+
+            auto sendNetworkUpdates = [&stats, &updatingConnections, parallelUpdates](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update();
+                    if (!parallelUpdates)
+                    {
+                        connectionData->Update();
+                    }
+                    else if (connectionData->PreUpdate())
+                    {
+                        updatingConnections.push_back(connectionData);
+                    }
+
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -419,6 +447,36 @@ namespace Multiplayer
             };
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+
+            if (!updatingConnections.empty())
+            {
+                // Gathering and serializing updates for one connection is independent of every other connection
+                {
+                    AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - PrepareUpdates");
+                    stats.SetConcurrentRecording(true);
+                    AZ::JobCompletion jobCompletion;
+                    for (IConnectionData* connectionData : updatingConnections)
+                    {
+                        AZ::Job* job = AZ::CreateJobFunction([connectionData]()
+                        {
+                            connectionData->GetReplicationManager().PrepareUpdates();
+                        }, true);
+                        job->SetDependent(&jobCompletion);
+                        job->Start();
+                    }
+                    jobCompletion.StartAndWaitForCompletion();
+                    stats.SetConcurrentRecording(false);
+                }
+
+                // Packets are sent on the main thread in connection visit order, so packet ids are assigned deterministically
+                {
+                    AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - FlushUpdates");
+                    for (IConnectionData* connectionData : updatingConnections)
+                    {
+                        connectionData->GetReplicationManager().FlushUpdates();
+                    }
+                }
+            }
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -746,6 +804,119 @@ namespace Multiplayer
         return true;
     }
 
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::ServerConnect& packet
+    )
+    {
+        if (GetAgentType() != MultiplayerAgentType::DedicatedServer && GetAgentType() != MultiplayerAgentType::ClientServer)
+        {
+            return false;
+        }
+
+        // The connection was set up for a client when accepted, it turns out to be a peer server
+        delete reinterpret_cast<IConnectionData*>(connection->GetUserData());
+        ServerToServerConnectionData* connectionData = new ServerToServerConnectionData(connection, *this);
+        connection->SetUserData(connectionData);
+        connectionData->SetRemoteDomain(packet.GetPublicHostId(), packet.GetDomainAabb());
+
+        const AZ::Aabb& domainAabb = m_networkEntityManager.GetEntityDomain()->GetAabb();
+        if (connection->SendReliablePacket(MultiplayerPackets::ServerAccept(m_networkEntityManager.GetHostId(), domainAabb)))
+        {
+            AZLOG_INFO("Peer server %s connected", packet.GetPublicHostId().GetString().c_str());
+            connectionData->SetDidHandshake(true);
+            connectionData->SetCanSendUpdates(true);
+            return true;
+        }
+        return false;
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::ServerAccept& packet
+    )
+    {
+        IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection->GetUserData());
+        if (connectionData->GetConnectionDataType() != ConnectionDataType::ServerToServer)
+        {
+            return false;
+        }
+
+        ServerToServerConnectionData* serverConnectionData = reinterpret_cast<ServerToServerConnectionData*>(connectionData);
+        serverConnectionData->SetRemoteDomain(packet.GetPublicHostId(), packet.GetDomainAabb());
+        serverConnectionData->SetDidHandshake(true);
+        serverConnectionData->SetCanSendUpdates(true);
+        AZLOG_INFO("Connected to peer server %s", packet.GetPublicHostId().GetString().c_str());
+        return true;
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityMigration& packet
+    )
+    {
+        IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection->GetUserData());
+        if (connectionData->GetConnectionDataType() != ConnectionDataType::ServerToServer)
+        {
+            // Only peer servers are allowed to hand over authority
+            return false;
+        }
+        return connectionData->GetReplicationManager().HandleEntityMigration(connection, packet.ModifyEntityMigration());
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::NotifyClientMigration& packet
+    )
+    {
+        IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection->GetUserData());
+        if (connectionData->GetConnectionDataType() != ConnectionDataType::ServerToServer)
+        {
+            return false;
+        }
+
+        // Re-attach the migrating entity to the client when it connects with its temporary user identifier
+        RegisterPlayerIdentifierForRejoin(packet.GetTemporaryUserIdentifier(), packet.GetControlledEntityId());
+        return connection->SendReliablePacket(MultiplayerPackets::ClientMigrationReady
+        (
+            packet.GetTemporaryUserIdentifier(),
+            packet.GetClientConnectionId(),
+            packet.GetLastClientInputId()
+        ));
+    }
+
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::ClientMigrationReady& packet
+    )
+    {
+        IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection->GetUserData());
+        if (connectionData->GetConnectionDataType() != ConnectionDataType::ServerToServer)
+        {
+            return false;
+        }
+
+        const HostId& publicHostId = reinterpret_cast<ServerToServerConnectionData*>(connectionData)->GetPublicHostId();
+        CompleteClientMigration
+        (
+            packet.GetTemporaryUserIdentifier(),
+            AzNetworking::ConnectionId{ packet.GetClientConnectionId() },
+            publicHostId,
+            packet.GetLastClientInputId()
+        );
+        return true;
+    }
+
     ConnectResult MultiplayerSystemComponent::ValidateConnect
     (
         [[maybe_unused]] const IpAddress& remoteAddress,
@@ -767,7 +938,10 @@ namespace Multiplayer
                 providerTicket = m_pendingConnectionTickets.front();
                 m_pendingConnectionTickets.pop();
             }
-            connection->SendReliablePacket(MultiplayerPackets::Connect(0, m_temporaryUserIdentifier, providerTicket.c_str()));
+            if (GetAgentType() == MultiplayerAgentType::Client)
+            {
+                connection->SendReliablePacket(MultiplayerPackets::Connect(0, m_temporaryUserIdentifier, providerTicket.c_str()));
+            }
         }
         else
         {
@@ -783,7 +957,17 @@ namespace Multiplayer
         if (GetAgentType() == MultiplayerAgentType::ClientServer
          || GetAgentType() == MultiplayerAgentType::DedicatedServer)
         {
-            connection->SetUserData(new ServerToClientConnectionData(connection, *this));
+            if (connection->GetConnectionRole() == ConnectionRole::Connector)
+            {
+                // Outgoing connections of a server are always to peer servers
+                connection->SetUserData(new ServerToServerConnectionData(connection, *this));
+                const AZ::Aabb& domainAabb = m_networkEntityManager.GetEntityDomain()->GetAabb();
+                connection->SendReliablePacket(MultiplayerPackets::ServerConnect(0, m_networkEntityManager.GetHostId(), domainAabb));
+            }
+            else
+            {
+                connection->SetUserData(new ServerToClientConnectionData(connection, *this));
+            }
         }
         else
         {
@@ -818,7 +1002,9 @@ namespace Multiplayer
         else if (m_agentType == MultiplayerAgentType::DedicatedServer || m_agentType == MultiplayerAgentType::ClientServer)
         {
             // Signal to session management that a user has left the server
-            if (connection->GetConnectionRole() == ConnectionRole::Acceptor)
+            const IConnectionData* userData = reinterpret_cast<IConnectionData*>(connection->GetUserData());
+            if (connection->GetConnectionRole() == ConnectionRole::Acceptor
+             && userData != nullptr && userData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
             {
                 IMultiplayerSpawner* spawner = AZ::Interface<IMultiplayerSpawner>::Get();
                 if (spawner)
@@ -893,8 +1079,17 @@ namespace Multiplayer
                     const uint16_t serverPort = cl_serverport;
                     const AzNetworking::ProtocolType serverProtocol = sv_protocol;
                     const AzNetworking::IpAddress hostId = AzNetworking::IpAddress(serverAddr.c_str(), serverPort, serverProtocol);
-                    // Set up a full ownership domain if we didn't construct a domain during the initialize event
-                    m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
+                    // Set up a spatial domain if a region was configured, or a full ownership domain if we didn't construct a domain during the initialize event
+                    const AZ::Vector3 domainMin = sv_EntityDomainMin;
+                    const AZ::Vector3 domainMax = sv_EntityDomainMax;
+                    if (domainMin.IsLessThan(domainMax))
+                    {
+                        m_networkEntityManager.Initialize(hostId, AZStd::make_unique<SpatialEntityDomain>(AZ::Aabb::CreateFromMinMax(domainMin, domainMax)));
+                    }
+                    else
+                    {
+                        m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
+                    }
                 }
             }
             else if (multiplayerType == MultiplayerAgentType::Client)
@@ -978,6 +1173,24 @@ namespace Multiplayer
     void MultiplayerSystemComponent::SendNotifyClientMigrationEvent(AzNetworking::ConnectionId connectionId, const HostId& hostId, uint64_t userIdentifier, ClientInputId lastClientInputId, NetEntityId controlledEntityId)
     {
         m_notifyClientMigrationEvent.Signal(connectionId, hostId, userIdentifier, lastClientInputId, controlledEntityId);
+
+        // Let the peer server owning the domain the controlled entity moved into know the client is coming
+        m_networkInterface->GetConnectionSet().VisitConnections([&](IConnection& connection)
+        {
+            IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
+            if (connectionData != nullptr
+             && connectionData->GetConnectionDataType() == ConnectionDataType::ServerToServer
+             && connectionData->GetReplicationManager().GetRemoteHostId() == hostId)
+            {
+                connection.SendReliablePacket(MultiplayerPackets::NotifyClientMigration
+                (
+                    userIdentifier,
+                    controlledEntityId,
+                    aznumeric_cast<uint32_t>(connectionId),
+                    lastClientInputId
+                ));
+            }
+        });
     }
 
     void MultiplayerSystemComponent::SendNotifyEntityMigrationEvent(const ConstNetworkEntityHandle& entityHandle, const HostId& remoteHostId)
@@ -1047,6 +1260,41 @@ namespace Multiplayer
         return m_spawnNetboundEntities;
     }
 
+    bool MultiplayerSystemComponent::ConnectToPeerServer(const AZStd::string& remoteAddress, uint16_t port)
+    {
+        if (GetAgentType() != MultiplayerAgentType::DedicatedServer && GetAgentType() != MultiplayerAgentType::ClientServer)
+        {
+            AZLOG_WARN("Only a hosting server can connect to a peer server");
+            return false;
+        }
+
+        const IpAddress address(remoteAddress.c_str(), port, sv_protocol);
+        return m_networkInterface->Connect(address) != InvalidConnectionId;
+    }
+
+    void MultiplayerSystemComponent::ConnectPeerServer(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 1)
+        {
+            AZLOG_WARN("ConnectPeerServer requires the address of the peer server");
+            return;
+        }
+
+        AZStd::string remoteAddress{ arguments.front() };
+        uint16_t port = DefaultServerPort;
+        const AZStd::size_t portSeparator = remoteAddress.find_first_of(':');
+        if (portSeparator != AZStd::string::npos)
+        {
+            port = static_cast<uint16_t>(atol(remoteAddress.c_str() + portSeparator + 1));
+            remoteAddress.resize(portSeparator);
+        }
+
+        if (!ConnectToPeerServer(remoteAddress, port))
+        {
+            AZLOG_ERROR("Failed to connect to peer server %s:%u", remoteAddress.c_str(), aznumeric_cast<uint32_t>(port));
+        }
+    }
+
     void MultiplayerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
         const MultiplayerStats& stats = GetStats();
@@ -1070,6 +1318,50 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
     }
 
+    AZ::TimeMs MultiplayerSystemComponent::UpdateServerSendRate(float deltaTime)
+    {
+        const AZ::TimeMs configuredRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
+        const bool isHost = (GetAgentType() == MultiplayerAgentType::ClientServer) || (GetAgentType() == MultiplayerAgentType::DedicatedServer);
+        if (!sv_AdaptiveServerSendRate || !isHost)
+        {
+            if (isHost && (m_smoothedFrameTimeMs > 0.0f) && (m_adaptiveSendRateMs != configuredRateMs))
+            {
+                // Restore the configured rate on clients that were told about an adapted rate
+                m_cvarCommands.PushBackItem(AZStd::string::format("sv_serverSendRateMs %lld", static_cast<long long>(configuredRateMs)));
+            }
+            m_smoothedFrameTimeMs = 0.0f;
+            m_adaptiveSendRateMs = configuredRateMs;
+            return configuredRateMs;
+        }
+
+        // Exponential moving average, so a single hitch doesn't change the host frame rate
+        constexpr float FrameTimeSmoothing = 0.05f;
+        const float frameTimeMs = deltaTime * 1000.0f;
+        m_smoothedFrameTimeMs = (m_smoothedFrameTimeMs > 0.0f) ? AZ::Lerp(m_smoothedFrameTimeMs, frameTimeMs, FrameTimeSmoothing) : frameTimeMs;
+
+        const AZ::TimeMs maxRateMs = AZStd::max(configuredRateMs, static_cast<AZ::TimeMs>(sv_MaxAdaptiveServerSendRateMs));
+        const AZ::TimeMs targetRateMs = AZStd::clamp
+        (
+            static_cast<AZ::TimeMs>(static_cast<int64_t>(ceilf(m_smoothedFrameTimeMs * sv_AdaptiveServerSendRateHeadroom))),
+            configuredRateMs,
+            maxRateMs
+        );
+
+        // Only move in steps of at least 10% of the configured rate to avoid replicating a new rate every frame
+        const AZ::TimeMs stepMs = AZStd::max(static_cast<AZ::TimeMs>(static_cast<int64_t>(configuredRateMs) / 10), AZ::TimeMs{ 1 });
+        const AZ::TimeMs rateDeltaMs = (targetRateMs > m_adaptiveSendRateMs) ? targetRateMs - m_adaptiveSendRateMs : m_adaptiveSendRateMs - targetRateMs;
+        if (rateDeltaMs >= stepMs || targetRateMs == configuredRateMs)
+        {
+            if (targetRateMs != m_adaptiveSendRateMs)
+            {
+                // Clients blend between updates using sv_serverSendRateMs, so let them know about the effective rate
+                m_adaptiveSendRateMs = targetRateMs;
+                m_cvarCommands.PushBackItem(AZStd::string::format("sv_serverSendRateMs %lld", static_cast<long long>(targetRateMs)));
+            }
+        }
+        return m_adaptiveSendRateMs;
+    }
+
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
     {
         AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: TickVisibleNetworkEntities");
@@ -89,6 +89,11 @@ namespace Multiplayer
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ServerConnect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ServerAccept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::NotifyClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigrationReady& packet);
     
         //! IConnectionListener interface
         //! @{
@@ -134,13 +139,21 @@ namespace Multiplayer
         bool GetShouldSpawnNetworkEntities() const override;
         //! @}
 
+        //! Opens a connection to a peer server owning a neighboring entity domain.
+        //! @param remoteAddress the address of the peer server
+        //! @param port          the port of the peer server
+        //! @return true if the connection was started
+        bool ConnectToPeerServer(const AZStd::string& remoteAddress, uint16_t port);
+
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void ConnectPeerServer(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
     private:
 
+        AZ::TimeMs UpdateServerSendRate(float deltaTime);
         void TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds);
         void OnConsoleCommandInvoked(AZStd::string_view command, const AZ::ConsoleCommandContainer& args, AZ::ConsoleFunctorFlags flags, AZ::ConsoleInvokedFrom invokedFrom);
         void OnAutonomousEntityReplicatorCreated();
@@ -148,6 +161,7 @@ namespace Multiplayer
         void EnableAutonomousControl(NetworkEntityHandle entityHandle, AzNetworking::ConnectionId connectionId);
 
         AZ_CONSOLEFUNC(MultiplayerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for the current multiplayer session");
+        AZ_CONSOLEFUNC(MultiplayerSystemComponent, ConnectPeerServer, AZ::ConsoleFunctorFlags::DontReplicate, "Connects this server to the peer server <address:port> owning a neighboring entity domain");
 
         AzNetworking::INetworkInterface* m_networkInterface = nullptr;
         AZ::ConsoleCommandInvokedEvent::Handler m_consoleCommandHandler;
@@ -179,6 +193,8 @@ namespace Multiplayer
         uint64_t m_temporaryUserIdentifier = 0; // Used in the event of a migration or rejoin
 
         double m_serverSendAccumulator = 0.0;
+        float m_smoothedFrameTimeMs = 0.0f;
+        AZ::TimeMs m_adaptiveSendRateMs = AZ::Time::ZeroTimeMs;
         float m_renderBlendFactor = 0.0f;
         float m_tickFactor = 0.0f;
         bool m_spawnNetboundEntities = false;
@@ -16,9 +16,11 @@
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Framework/INetworking.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
@@ -28,6 +30,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -39,6 +42,8 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(AZ::CVarFixedString, net_EntityReplicationSnapshotCompressor, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Compressor used to entropy code entity snapshot deltas, empty to send them uncompressed. Must match on both endpoints.");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -62,6 +67,12 @@ namespace Multiplayer
         // Start window update events
         m_updateWindow.Enqueue(AZ::Time::ZeroTimeMs, true);
 
+        const AZ::CVarFixedString snapshotCompressor = static_cast<AZ::CVarFixedString>(net_EntityReplicationSnapshotCompressor);
+        if (!snapshotCompressor.empty())
+        {
+            m_snapshotCompressor = AZ::Interface<AzNetworking::INetworking>::Get()->CreateCompressor(AZ::Name(snapshotCompressor));
+        }
+
         INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
         if (networkEntityManager != nullptr)
         {
@@ -116,37 +127,58 @@ namespace Multiplayer
     }
 
     void EntityReplicationManager::SendUpdates()
+    {
+        PrepareUpdates();
+        FlushUpdates();
+    }
+
+    void EntityReplicationManager::PrepareUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
-        {
-            EntityReplicatorList toSendList = GenerateEntityUpdateList();
+        EntityReplicatorList toSendList = GenerateEntityUpdateList();
 
-            AZLOG
-            (
-                NET_ReplicationInfo,
-                "Sending %zd updates from %s to %s",
-                toSendList.size(),
-                GetNetworkEntityManager()->GetHostId().GetString().c_str(),
-                GetRemoteHostId().GetString().c_str()
-            );
+        AZLOG
+        (
+            NET_ReplicationInfo,
+            "Sending %zd updates from %s to %s",
+            toSendList.size(),
+            GetNetworkEntityManager()->GetHostId().GetString().c_str(),
+            GetRemoteHostId().GetString().c_str()
+        );
+
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: PrepareUpdates - PrepareSerialization");
+            // Prep a replication record for send, at this point, everything needs to be sent
+            for (EntityReplicator* replicator : toSendList)
+            {
+                replicator->GetPropertyPublisher()->PrepareSerialization();
+            }
+        }
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: PrepareUpdates - GenerateUpdatePackets");
+            for (EntityReplicator* replicator : toSendList)
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareSerialization");
-                // Prep a replication record for send, at this point, everything needs to be sent
-                for (EntityReplicator* replicator : toSendList)
+                m_preparedUpdates.push_back({ replicator, replicator->GenerateUpdatePacket() });
+
+                // Remember the size of this update, the next update for this entity is budgeted with it
+                if (auto priorityIter = m_replicationPriorities.find(replicator->GetEntityHandle().GetNetEntityId()); priorityIter != m_replicationPriorities.end())
                 {
-                    replicator->GetPropertyPublisher()->PrepareSerialization();
+                    priorityIter->second.m_lastUpdateSize = m_preparedUpdates.back().m_updateMessage.GetEstimatedSerializeSize();
                 }
             }
+        }
+    }
 
+    void EntityReplicationManager::FlushUpdates()
+    {
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: FlushUpdates - SendEntityUpdateMessages");
+            // While our prepared list is not empty, build up another packet to send
+            while (!m_preparedUpdates.empty())
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
-                // While our to send list is not empty, build up another packet to send
-                do
-                {
-                    SendEntityUpdateMessages(toSendList);
-                } while (!toSendList.empty());
+                SendEntityUpdateMessages(m_preparedUpdates);
             }
         }
 
@@ -180,11 +212,22 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
+        // Proxy updates are scheduled by priority, each pending update accumulates the priority assigned by the replication window
+        // every frame it waits, so nearby and relevant entities are sent first and distant entities are still sent eventually
+        struct ProxyCandidate
+        {
+            EntityReplicator* m_replicator;
+            ReplicationPriorityState* m_priorityState;
+        };
+        AZStd::vector<ProxyCandidate> proxyCandidates;
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        const uint32_t hostFrameId = static_cast<uint32_t>(GetNetworkTime()->GetHostFrameId());
+
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
-            if (EntityReplicator* replicator = GetEntityReplicator(*iter))
+            EntityReplicator* replicator = GetEntityReplicator(*iter);
+            if (replicator)
             {
                 NetEntityId entityId = replicator->GetEntityHandle().GetNetEntityId();
                 if (PropertyPublisher* propPublisher = replicator->GetPropertyPublisher())
@@ -218,10 +261,22 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            auto windowIter = replicationSet.find(replicator->GetEntityHandle());
+                            const float priority = (windowIter != replicationSet.end()) ? windowIter->second.m_priority : 1.0f;
+                            const uint32_t updateInterval = (windowIter != replicationSet.end()) ? windowIter->second.m_updateInterval : 1;
+                            ReplicationPriorityState& priorityState = m_replicationPriorities[entityId];
+                            priorityState.m_accumulatedPriority += priority;
+
+                            // Low frequency entities are bucketed by id so their updates are spread evenly across host frames
+                            // Skipped updates stay pending, so their changes are sent with the next update in their bucket
+                            const bool isUpdateFrame = (updateInterval <= 1) || !propPublisher->IsRemoteReplicatorEstablished()
+                                || (((hostFrameId + static_cast<uint32_t>(entityId)) % updateInterval) == 0);
+                            if (isUpdateFrame)
+                            {
+                                proxyCandidates.push_back({ replicator, &priorityState });
+                            }
                         }
                     }
                 }
@@ -229,6 +284,15 @@ namespace Multiplayer
 
             if (clearPendingSend)
             {
+                if (replicator == nullptr)
+                {
+                    m_replicationPriorities.erase(*iter);
+                }
+                else if (auto priorityIter = m_replicationPriorities.find(*iter); priorityIter != m_replicationPriorities.end())
+                {
+                    // Nothing is waiting to be sent, so there's no starvation to make up for
+                    priorityIter->second.m_accumulatedPriority = 0.0f;
+                }
                 m_remoteEntitiesPendingCreation.erase(*iter);
                 iter = m_replicatorsPendingSend.erase(iter);
             }
@@ -238,21 +302,54 @@ namespace Multiplayer
             }
         }
 
+        // Pack the highest accumulated priorities against the per frame proxy count and byte budgets
+        // Update sizes are estimated from the last update sent for each entity
+        AZStd::sort(proxyCandidates.begin(), proxyCandidates.end(), [](const ProxyCandidate& lhs, const ProxyCandidate& rhs)
+        {
+            return lhs.m_priorityState->m_accumulatedPriority > rhs.m_priorityState->m_accumulatedPriority;
+        });
+
+        const uint32_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        const uint32_t maxProxySendBytes = m_replicationWindow->GetMaxProxyEntityReplicatorSendBytes();
+        uint32_t proxySendCount = 0;
+        uint32_t proxySendBytes = 0;
+        for (ProxyCandidate& candidate : proxyCandidates)
+        {
+            if (proxySendCount >= maxProxySendCount)
+            {
+                break;
+            }
+
+            // Skip updates that would exceed the budget, but keep looking for smaller updates that still fit
+            // The first update is always allowed so that a single large entity can't stall replication
+            const uint32_t estimatedSize = candidate.m_priorityState->m_lastUpdateSize;
+            const uint32_t remainingBytes = (proxySendBytes < maxProxySendBytes) ? maxProxySendBytes - proxySendBytes : 0;
+            if ((proxySendCount > 0) && (estimatedSize > remainingBytes))
+            {
+                continue;
+            }
+
+            toSendList.push_back(candidate.m_replicator);
+            candidate.m_priorityState->m_accumulatedPriority = 0.0f;
+            proxySendBytes += estimatedSize;
+            ++proxySendCount;
+        }
+
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::SendEntityUpdateMessages(PreparedEntityUpdateList& updateList)
     {
         uint32_t pendingPacketSize = 0;
         EntityReplicatorList replicatorUpdatedList;
         NetworkEntityUpdateVector entityUpdates;
-        // Serialize everything
-        while (!replicatorList.empty())
+        // Pack as many prepared updates as fit into a single packet
+        while (!updateList.empty())
         {
-            EntityReplicator* replicator = replicatorList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            PreparedEntityUpdate& preparedUpdate = updateList.front();
+            EntityReplicator* replicator = preparedUpdate.m_replicator;
 
-            const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
+            const uint32_t nextMessageSize = preparedUpdate.m_updateMessage.GetEstimatedSerializeSize();
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > m_maxPayloadSize);
@@ -264,9 +361,9 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdates.push_back(updateMessage);
+            entityUpdates.push_back(AZStd::move(preparedUpdate.m_updateMessage));
             replicatorUpdatedList.push_back(replicator);
-            replicatorList.pop_front();
+            updateList.pop_front();
 
             if (largeEntityDetected)
             {
@@ -348,6 +445,9 @@ namespace Multiplayer
             m_replicatorsPendingSend.clear();
         }
 
+        m_preparedUpdates.clear();
+        m_replicationPriorities.clear();
+        m_receivedSnapshots.clear();
         m_entityReplicatorMap.clear();
     }
 
@@ -813,6 +913,18 @@ namespace Multiplayer
         case UpdateValidationResult::HandleMessage:
             break;
         case UpdateValidationResult::DropMessage:
+            if (!updateMessage.GetIsDelete() && updateMessage.GetData() != nullptr && updateMessage.GetData()->GetSize() > 0)
+            {
+                // Out of date snapshot deltas are not applied, but the remote endpoint may still use them as baselines once acked
+                AzNetworking::NetworkOutputSerializer droppedSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+                bool isSnapshotDelta = false;
+                droppedSerializer.Serialize(isSnapshotDelta, "IsSnapshotDelta");
+                if (isSnapshotDelta && m_receivedSnapshots.find(updateMessage.GetEntityId()) != m_receivedSnapshots.end())
+                {
+                    SnapshotBuffer droppedSnapshot;
+                    DecodeSnapshotDelta(updateMessage.GetEntityId(), droppedSerializer, droppedSnapshot);
+                }
+            }
             return true;
         case UpdateValidationResult::DropMessageAndDisconnect:
             return false;
@@ -893,6 +1005,48 @@ namespace Multiplayer
         return aznumeric_cast<AZ::TimeMs>(aznumeric_cast<uint32_t>(m_connection.GetMetrics().m_connectionRtt.GetRoundTripTimeSeconds()) * 1000 * 2);
     }
 
+    AzNetworking::ICompressor* EntityReplicationManager::GetSnapshotCompressor() const
+    {
+        return m_snapshotCompressor.get();
+    }
+
+    bool EntityReplicationManager::DecodeSnapshotDelta(NetEntityId netEntityId, AzNetworking::ISerializer& serializer, SnapshotBuffer& outSnapshot)
+    {
+        SnapshotDeltaHeader header;
+        SnapshotBuffer encoded;
+        encoded.resize_no_construct(AzNetworking::MaxPacketSize);
+        uint32_t encodedSize = 0;
+        header.Serialize(serializer);
+        serializer.SerializeBytes(encoded.data(), static_cast<uint32_t>(encoded.size()), false, encodedSize, "SnapshotDelta");
+        if (!serializer.IsValid())
+        {
+            return false;
+        }
+
+        SnapshotBaselineRing& receivedSnapshots = m_receivedSnapshots[netEntityId];
+        const SnapshotBuffer* baseline = nullptr;
+        if (header.m_hasBaseline)
+        {
+            baseline = receivedSnapshots.Find(header.m_baselineSequence);
+            if (baseline == nullptr)
+            {
+                AZLOG_ERROR("EntityReplicationManager: Missing snapshot baseline %u for entity id %llu from remote host %s",
+                    aznumeric_cast<uint32_t>(header.m_baselineSequence), aznumeric_cast<AZ::u64>(netEntityId), GetRemoteHostId().GetString().c_str());
+                return false;
+            }
+        }
+
+        if (!SnapshotDeltaCodec::Decode(encoded.data(), encodedSize, baseline, m_snapshotCompressor.get(), outSnapshot))
+        {
+            AZLOG_ERROR("EntityReplicationManager: Failed to decode snapshot delta for entity id %llu from remote host %s",
+                aznumeric_cast<AZ::u64>(netEntityId), GetRemoteHostId().GetString().c_str());
+            return false;
+        }
+
+        receivedSnapshots.Store(header.m_sequence, SnapshotBuffer(outSnapshot));
+        return true;
+    }
+
     void EntityReplicationManager::SetMaxRemoteEntitiesPendingCreationCount(uint32_t maxPendingEntities)
     {
         m_maxRemoteEntitiesPendingCreationCount = maxPendingEntities;
@@ -1287,6 +1441,8 @@ namespace Multiplayer
                 if (replicator->IsDeletionAcknowledged())
                 {
                     m_remoteEntitiesPendingCreation.erase(replicator->GetEntityHandle().GetNetEntityId());
+                    m_replicationPriorities.erase(*iter);
+                    m_receivedSnapshots.erase(*iter);
                     m_entityReplicatorMap.erase(*iter);
                     iter = m_replicatorsPendingRemoval.erase(iter);
                 }
@@ -147,7 +147,8 @@ namespace Multiplayer
                     GetRemoteNetworkRole(),
                     !RemoteManagerOwnsEntityLifetime() ? PropertyPublisher::OwnsLifetime::True : PropertyPublisher::OwnsLifetime::False,
                     m_netBindComponent,
-                    *m_connection
+                    *m_connection,
+                    m_replicationManager.GetSnapshotCompressor()
                 );
             m_onEntityDirtiedHandler.Disconnect();
             m_netBindComponent->AddEntityDirtiedEventHandler(m_onEntityDirtiedHandler);
@@ -8,19 +8,31 @@
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
-
-    PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, NetBindComponent* netBindComponent, AzNetworking::IConnection& connection)
+    AZ_CVAR(bool, net_EntityReplicationSnapshotDelta, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates are sent as full snapshots delta encoded against the newest snapshot acked by the remote endpoint");
+
+    PropertyPublisher::PropertyPublisher
+    (
+        NetEntityRole remoteNetworkRole,
+        OwnsLifetime ownsLifetime,
+        NetBindComponent* netBindComponent,
+        AzNetworking::IConnection& connection,
+        AzNetworking::ICompressor* snapshotCompressor
+    )
         : m_ownsLifetime(ownsLifetime)
         , m_netBindComponent(netBindComponent)
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_sentSnapshots(MaxSnapshotBaselines)
+        , m_snapshotCompressor(snapshotCompressor)
     {
         if ( ownsLifetime == OwnsLifetime::False )
         {
@@ -109,6 +121,7 @@ namespace Multiplayer
     bool PropertyPublisher::PrepareAddEntityRecord()
     {
         m_sentRecords.clear();
+        m_sentSnapshots.clear();
         m_netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         m_sentRecords.push_front(m_pendingRecord);
         return true;
@@ -120,6 +133,7 @@ namespace Multiplayer
 
         // This is basically an Add record, but we don't want to send back predictable values
         m_sentRecords.clear();
+        m_sentSnapshots.clear();
         m_netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         // Don't send predictable properties back to the Autonomous unless we correct them
         if (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
@@ -163,6 +177,7 @@ namespace Multiplayer
     bool PropertyPublisher::PrepareDeleteEntityRecord()
     {
         m_sentRecords.clear();
+        m_sentSnapshots.clear();
         m_pendingRecord.Clear();
         return !IsDeleted();
     }
@@ -170,12 +185,87 @@ namespace Multiplayer
     bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer &serializer)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
+        bool isSnapshotDelta = net_EntityReplicationSnapshotDelta;
+        serializer.Serialize(isSnapshotDelta, "IsSnapshotDelta");
+        if (isSnapshotDelta)
+        {
+            return SerializeSnapshotDeltaEntityRecord(serializer);
+        }
+
         m_pendingRecord.ResetConsumedBits();
         m_pendingRecord.Serialize(serializer);
         m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::SerializeSnapshotDeltaEntityRecord(AzNetworking::ISerializer& serializer)
+    {
+        // A snapshot that was serialized but never finalized with a packet id was not sent as an update, discard it
+        if (!m_sentSnapshots.empty() && m_sentSnapshots.front().m_sentPacketId == AzNetworking::InvalidPacketId)
+        {
+            m_sentSnapshots.pop_front();
+        }
+
+        // Serialize the full state the remote endpoint should have, independent of which properties changed since the last ack
+        ReplicationRecord snapshotRecord(m_pendingRecord.GetRemoteNetworkRole());
+        m_netBindComponent->FillTotalReplicationRecord(snapshotRecord);
+        if (snapshotRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
+        {
+            snapshotRecord.Subtract(m_netBindComponent->GetPredictableRecord());
+        }
+
+        SnapshotBaseline sentSnapshot;
+        sentSnapshot.m_snapshot.resize_no_construct(AzNetworking::MaxPacketSize);
+        AzNetworking::NetworkInputSerializer snapshotSerializer(sentSnapshot.m_snapshot.data(), static_cast<uint32_t>(sentSnapshot.m_snapshot.size()));
+        snapshotRecord.Serialize(snapshotSerializer);
+        m_netBindComponent->SerializeStateDeltaMessage(snapshotRecord, snapshotSerializer);
+        if (!snapshotSerializer.IsValid())
+        {
+            return false;
+        }
+        sentSnapshot.m_snapshot.resize(snapshotSerializer.GetSize());
+        sentSnapshot.m_sequence = m_nextSnapshotSequence++;
+
+        // Find the newest snapshot the remote endpoint has acked that is still within its baseline window
+        SnapshotDeltaHeader header;
+        header.m_sequence = sentSnapshot.m_sequence;
+        auto baselineIter = m_sentSnapshots.begin();
+        for (; baselineIter != m_sentSnapshots.end(); ++baselineIter)
+        {
+            if (static_cast<SnapshotSequence>(header.m_sequence - baselineIter->m_sequence) >= MaxSnapshotBaselines)
+            {
+                baselineIter = m_sentSnapshots.end();
+                break;
+            }
+            if (m_connection.WasPacketAcked(baselineIter->m_sentPacketId))
+            {
+                header.m_hasBaseline = true;
+                header.m_baselineSequence = baselineIter->m_sequence;
+                break;
+            }
+        }
+
+        SnapshotBuffer encoded;
+        const SnapshotBuffer* baseline = header.m_hasBaseline ? &baselineIter->m_snapshot : nullptr;
+        if (!SnapshotDeltaCodec::Encode(sentSnapshot.m_snapshot, baseline, m_snapshotCompressor, encoded))
+        {
+            return false;
+        }
+
+        uint32_t encodedSize = static_cast<uint32_t>(encoded.size());
+        header.Serialize(serializer);
+        serializer.SerializeBytes(encoded.data(), encodedSize, false, encodedSize, "SnapshotDelta");
+
+        // Snapshots older than the baseline will never be used again
+        if (baselineIter != m_sentSnapshots.end())
+        {
+            m_sentSnapshots.erase(baselineIter + 1, m_sentSnapshots.end());
+        }
+        m_sentSnapshots.push_front();
+        m_sentSnapshots.front() = AZStd::move(sentSnapshot);
+        return serializer.IsValid();
+    }
+
     bool PropertyPublisher::SerializeDeleteEntityRecord(AzNetworking::ISerializer &serializer)
     {
         return serializer.IsValid();
@@ -194,6 +284,10 @@ namespace Multiplayer
             m_sentRecords.pop_front();
             return;
         }
+        if (!m_sentSnapshots.empty() && m_sentSnapshots.front().m_sentPacketId == AzNetworking::InvalidPacketId)
+        {
+            m_sentSnapshots.front().m_sentPacketId = packetId;
+        }
         m_pendingRecord.Clear();
     }
 
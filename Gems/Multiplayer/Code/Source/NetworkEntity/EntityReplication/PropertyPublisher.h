@@ -9,10 +9,12 @@
 #pragma once
 
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/SnapshotDeltaCodec.h>
 #include <AzCore/std/containers/ring_buffer.h>
 
 namespace AzNetworking
 {
+    class ICompressor;
     class IConnection;
 }
 
@@ -27,7 +29,14 @@ namespace Multiplayer
             False,
         };
 
-        PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, NetBindComponent* netBindComponent, AzNetworking::IConnection& connection);
+        PropertyPublisher
+        (
+            NetEntityRole remoteNetworkRole,
+            OwnsLifetime ownsLifetime,
+            NetBindComponent* netBindComponent,
+            AzNetworking::IConnection& connection,
+            AzNetworking::ICompressor* snapshotCompressor = nullptr
+        );
 
         void SetRebasing();
 
@@ -77,6 +86,7 @@ namespace Multiplayer
         //! Phase 2, serialize the record
         //! No add, they share the update path
         bool SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer);
+        bool SerializeSnapshotDeltaEntityRecord(AzNetworking::ISerializer& serializer);
         bool SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer);
 
         //! Phase 3, finalize with the packet id
@@ -95,6 +105,19 @@ namespace Multiplayer
         //! List of sent records (history of m_currentRecord)
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
+
+        //! A full snapshot sent to the remote endpoint, usable as a baseline once the packet carrying it is acked
+        struct SnapshotBaseline
+        {
+            SnapshotBuffer m_snapshot;
+            SnapshotSequence m_sequence = 0;
+            AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
+        };
+
+        //! List of sent snapshots when replicating with snapshot deltas, newest first
+        AZStd::ring_buffer<SnapshotBaseline> m_sentSnapshots;
+        AzNetworking::ICompressor* m_snapshotCompressor = nullptr;
+        SnapshotSequence m_nextSnapshotSequence = 0;
         bool m_remoteReplicatorEstablished = false;
     };
 }
@@ -9,6 +9,8 @@
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/TrackChangedSerializer.h>
 
 namespace Multiplayer
 {
@@ -48,6 +50,20 @@ namespace Multiplayer
     {
         AZ_Assert(IsPacketIdValid(packetId), "Packet expected to be valid");
         m_lastReceivedPacketId = packetId;
-        return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
+
+        bool isSnapshotDelta = false;
+        serializer->Serialize(isSnapshotDelta, "IsSnapshotDelta");
+        if (!isSnapshotDelta)
+        {
+            return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
+        }
+
+        SnapshotBuffer snapshot;
+        if (!m_replicationManager.DecodeSnapshotDelta(m_netBindComponent->GetNetEntityId(), *serializer, snapshot))
+        {
+            return false;
+        }
+        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> snapshotSerializer(snapshot.data(), static_cast<uint32_t>(snapshot.size()));
+        return m_netBindComponent->HandlePropertyChangeMessage(snapshotSerializer, notifyChanges);
     }
 }
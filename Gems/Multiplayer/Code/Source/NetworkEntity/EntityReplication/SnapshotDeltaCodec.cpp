@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/SnapshotDeltaCodec.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace Multiplayer
+{
+    namespace
+    {
+        enum SnapshotDeltaFlags : uint8_t
+        {
+            SnapshotDeltaFlagCompressed = 0x01,
+        };
+
+        void WriteVarint(uint32_t value, SnapshotBuffer& outBuffer)
+        {
+            while (value >= 0x80)
+            {
+                outBuffer.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            outBuffer.push_back(static_cast<uint8_t>(value));
+        }
+
+        bool ReadVarint(const uint8_t*& cursor, const uint8_t* end, uint32_t& outValue)
+        {
+            outValue = 0;
+            for (uint32_t shift = 0; shift < 32; shift += 7)
+            {
+                if (cursor >= end)
+                {
+                    return false;
+                }
+                const uint8_t byte = *cursor++;
+                outValue |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        uint8_t GetBaselineByte(const SnapshotBuffer* baseline, uint32_t index)
+        {
+            return (baseline != nullptr && index < baseline->size()) ? (*baseline)[index] : 0;
+        }
+
+        // Packs the XOR of snapshot and baseline as alternating runs of zero bytes and literal bytes
+        void PackDelta(const SnapshotBuffer& snapshot, const SnapshotBuffer* baseline, SnapshotBuffer& outPacked)
+        {
+            const uint32_t snapshotSize = static_cast<uint32_t>(snapshot.size());
+            WriteVarint(snapshotSize, outPacked);
+
+            uint32_t index = 0;
+            while (index < snapshotSize)
+            {
+                const uint32_t zeroStart = index;
+                while (index < snapshotSize && (snapshot[index] ^ GetBaselineByte(baseline, index)) == 0)
+                {
+                    ++index;
+                }
+                const uint32_t literalStart = index;
+                while (index < snapshotSize && (snapshot[index] ^ GetBaselineByte(baseline, index)) != 0)
+                {
+                    ++index;
+                }
+                WriteVarint(literalStart - zeroStart, outPacked);
+                WriteVarint(index - literalStart, outPacked);
+                for (uint32_t literal = literalStart; literal < index; ++literal)
+                {
+                    outPacked.push_back(snapshot[literal] ^ GetBaselineByte(baseline, literal));
+                }
+            }
+        }
+
+        bool UnpackDelta(const uint8_t* packed, uint32_t packedSize, const SnapshotBuffer* baseline, SnapshotBuffer& outSnapshot)
+        {
+            const uint8_t* cursor = packed;
+            const uint8_t* end = packed + packedSize;
+
+            uint32_t snapshotSize = 0;
+            if (!ReadVarint(cursor, end, snapshotSize) || snapshotSize > AzNetworking::MaxPacketSize)
+            {
+                return false;
+            }
+
+            outSnapshot.resize_no_construct(snapshotSize);
+            uint32_t index = 0;
+            while (index < snapshotSize)
+            {
+                uint32_t zeroCount = 0;
+                uint32_t literalCount = 0;
+                if (!ReadVarint(cursor, end, zeroCount) || !ReadVarint(cursor, end, literalCount))
+                {
+                    return false;
+                }
+                if ((zeroCount > snapshotSize - index) || (literalCount > snapshotSize - index - zeroCount)
+                    || (literalCount > static_cast<uint32_t>(end - cursor)))
+                {
+                    return false;
+                }
+                for (const uint32_t zeroEnd = index + zeroCount; index < zeroEnd; ++index)
+                {
+                    outSnapshot[index] = GetBaselineByte(baseline, index);
+                }
+                for (const uint32_t literalEnd = index + literalCount; index < literalEnd; ++index)
+                {
+                    outSnapshot[index] = *cursor++ ^ GetBaselineByte(baseline, index);
+                }
+            }
+            return cursor == end;
+        }
+    }
+
+    void SnapshotBaselineRing::Store(SnapshotSequence sequence, SnapshotBuffer&& snapshot)
+    {
+        Baseline& baseline = m_baselines[sequence % MaxSnapshotBaselines];
+        baseline.m_snapshot = AZStd::move(snapshot);
+        baseline.m_sequence = sequence;
+        baseline.m_isValid = true;
+    }
+
+    const SnapshotBuffer* SnapshotBaselineRing::Find(SnapshotSequence sequence) const
+    {
+        const Baseline& baseline = m_baselines[sequence % MaxSnapshotBaselines];
+        return (baseline.m_isValid && baseline.m_sequence == sequence) ? &baseline.m_snapshot : nullptr;
+    }
+
+    void SnapshotBaselineRing::Clear()
+    {
+        for (Baseline& baseline : m_baselines)
+        {
+            baseline.m_snapshot.clear();
+            baseline.m_isValid = false;
+        }
+    }
+
+    bool SnapshotDeltaHeader::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        serializer.Serialize(m_sequence, "Sequence");
+        serializer.Serialize(m_hasBaseline, "HasBaseline");
+        if (m_hasBaseline)
+        {
+            serializer.Serialize(m_baselineSequence, "BaselineSequence");
+        }
+        return serializer.IsValid();
+    }
+
+    namespace SnapshotDeltaCodec
+    {
+        bool Encode(const SnapshotBuffer& snapshot, const SnapshotBuffer* baseline, AzNetworking::ICompressor* compressor, SnapshotBuffer& outEncoded)
+        {
+            if (snapshot.size() > AzNetworking::MaxPacketSize)
+            {
+                return false;
+            }
+
+            SnapshotBuffer packed;
+            PackDelta(snapshot, baseline, packed);
+
+            outEncoded.clear();
+            if (compressor != nullptr)
+            {
+                // Entropy code the packed delta, but only keep the result if it actually saves space
+                const AZStd::size_t maxCompressedSize = compressor->GetMaxCompressedBufferSize(packed.size());
+                SnapshotBuffer compressed;
+                compressed.resize_no_construct(maxCompressedSize);
+                AZStd::size_t compressedSize = 0;
+                if (compressor->Compress(packed.data(), packed.size(), compressed.data(), compressed.size(), compressedSize) == AzNetworking::CompressorError::Ok
+                    && compressedSize + sizeof(uint32_t) < packed.size())
+                {
+                    outEncoded.push_back(SnapshotDeltaFlagCompressed);
+                    WriteVarint(static_cast<uint32_t>(packed.size()), outEncoded);
+                    outEncoded.insert(outEncoded.end(), compressed.begin(), compressed.begin() + compressedSize);
+                    return true;
+                }
+            }
+
+            outEncoded.push_back(0);
+            outEncoded.insert(outEncoded.end(), packed.begin(), packed.end());
+            return true;
+        }
+
+        bool Decode(const uint8_t* encoded, uint32_t encodedSize, const SnapshotBuffer* baseline, AzNetworking::ICompressor* compressor, SnapshotBuffer& outSnapshot)
+        {
+            if (encodedSize < 1)
+            {
+                return false;
+            }
+
+            const uint8_t flags = encoded[0];
+            const uint8_t* cursor = encoded + 1;
+            const uint8_t* end = encoded + encodedSize;
+            if ((flags & SnapshotDeltaFlagCompressed) == 0)
+            {
+                return UnpackDelta(cursor, static_cast<uint32_t>(end - cursor), baseline, outSnapshot);
+            }
+
+            uint32_t packedSize = 0;
+            if (compressor == nullptr || !ReadVarint(cursor, end, packedSize) || packedSize > 2 * AzNetworking::MaxPacketSize)
+            {
+                return false;
+            }
+
+            SnapshotBuffer packed;
+            packed.resize_no_construct(packedSize);
+            AZStd::size_t consumedSize = 0;
+            AZStd::size_t uncompressedSize = 0;
+            const AzNetworking::CompressorError result = compressor->Decompress
+            (
+                cursor, static_cast<AZStd::size_t>(end - cursor), packed.data(), packed.size(), consumedSize, uncompressedSize
+            );
+            if (result != AzNetworking::CompressorError::Ok || uncompressedSize != packedSize)
+            {
+                return false;
+            }
+            return UnpackDelta(packed.data(), packedSize, baseline, outSnapshot);
+        }
+    }
+}
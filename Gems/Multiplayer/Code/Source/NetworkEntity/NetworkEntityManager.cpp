@@ -30,10 +30,14 @@ AZ_DECLARE_BUDGET(MULTIPLAYER);
 namespace Multiplayer
 {
     AZ_CVAR(bool, net_DebugCheckNetworkEntityManager, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables extra debug checks inside the NetworkEntityManager");
+    AZ_CVAR(AZ::TimeMs, sv_EntityDomainUpdateMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Rate at which a spatial entity domain checks for entities that left it and should migrate to a peer server");
 
     NetworkEntityManager::NetworkEntityManager()
         : m_networkEntityAuthorityTracker(*this)
+        , m_networkEntitySpatialGrid(m_networkEntityTracker)
         , m_removeEntitiesEvent([this] { RemoveEntities(); }, AZ::Name("NetworkEntityManager remove entities event"))
+        , m_updateEntityDomainEvent([this] { UpdateEntityDomain(); }, AZ::Name("NetworkEntityManager update entity domain event"))
     {
         AZ::Interface<INetworkEntityManager>::Register(this);
         AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
@@ -63,6 +67,13 @@ namespace Multiplayer
         }
 
         m_entityDomain = AZStd::move(entityDomain);
+
+        // Only domains covering a region of space can lose entities as they move
+        m_updateEntityDomainEvent.RemoveFromQueue();
+        if (m_entityDomain != nullptr && m_entityDomain->GetAabb().IsValid())
+        {
+            m_updateEntityDomainEvent.Enqueue(sv_EntityDomainUpdateMs, true);
+        }
     }
 
     bool NetworkEntityManager::IsInitialized() const
@@ -244,7 +255,7 @@ namespace Multiplayer
             {
                 for (auto remoteEntityId : m_removeList)
                 {
-                    if (remoteEntityId == remoteEntityId)
+                    if (remoteEntityId == exitingId)
                     {
                         safeToExit = false;
                     }
@@ -259,6 +270,27 @@ namespace Multiplayer
         }
     }
 
+    void NetworkEntityManager::UpdateEntityDomain()
+    {
+        NetEntityIdSet entitiesNotInDomain;
+        for (NetworkEntityTracker::const_iterator it = m_networkEntityTracker.begin(); it != m_networkEntityTracker.end(); ++it)
+        {
+            NetBindComponent* netBindComponent = m_networkEntityTracker.GetNetBindComponent(it->second);
+            if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
+            {
+                if (!m_entityDomain->IsInDomain(ConstNetworkEntityHandle(it->second, &m_networkEntityTracker)))
+                {
+                    entitiesNotInDomain.insert(it->first);
+                }
+            }
+        }
+
+        if (!entitiesNotInDomain.empty())
+        {
+            HandleEntitiesExitDomain(entitiesNotInDomain);
+        }
+    }
+
     void NetworkEntityManager::ForceAssumeAuthority(const ConstNetworkEntityHandle& entityHandle)
     {
         NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
@@ -362,7 +394,9 @@ namespace Multiplayer
     void NetworkEntityManager::Reset()
     {
         m_multiplayerComponentRegistry.Reset();
+        m_networkEntitySpatialGrid.Reset();
         m_removeList.clear();
+        m_updateEntityDomainEvent.RemoveFromQueue();
         m_entityDomain = nullptr;
         m_entityExitDomainEvent.DisconnectAllHandlers();
         m_onEntityMarkedDirty.DisconnectAllHandlers();
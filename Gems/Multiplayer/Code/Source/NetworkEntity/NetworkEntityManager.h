@@ -12,6 +12,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzFramework/Spawnable/RootSpawnableInterface.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
+#include <Source/NetworkEntity/NetworkEntitySpatialGrid.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/NetworkEntity/NetworkSpawnableLibrary.h>
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
@@ -108,17 +109,20 @@ namespace Multiplayer
 
     private:
         void RemoveEntities();
+        void UpdateEntityDomain();
         NetEntityId NextId();
         bool IsHierarchySafeToExit(NetworkEntityHandle& entityHandle, const NetEntityIdSet& entitiesNotInDomain);
 
         NetworkEntityTracker m_networkEntityTracker;
         NetworkEntityAuthorityTracker m_networkEntityAuthorityTracker;
+        NetworkEntitySpatialGrid m_networkEntitySpatialGrid;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
 
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToClients;
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToServers;
 
         AZ::ScheduledEvent m_removeEntitiesEvent;
+        AZ::ScheduledEvent m_updateEntityDomainEvent;
         AZStd::vector<NetEntityId> m_removeList;
         AZStd::unique_ptr<IEntityDomain> m_entityDomain;
 
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/NetworkEntitySpatialGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_SpatialGridCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The size in meters of the cells of the spatial grid used to find entities near clients, takes effect when the grid next starts tracking entities");
+
+    // Each cell coordinate is packed into 21 bits of the cell key
+    static constexpr int32_t CellCoordBits = 21;
+    static constexpr int32_t CellCoordBias = 1 << (CellCoordBits - 1);
+    static constexpr uint64_t CellCoordMask = (uint64_t{ 1 } << CellCoordBits) - 1;
+
+    static int32_t ToCellCoord(float position, float inverseCellSize)
+    {
+        const float cell = AZStd::floor(position * inverseCellSize);
+        return static_cast<int32_t>(AZ::GetClamp(cell, static_cast<float>(-CellCoordBias), static_cast<float>(CellCoordBias - 1)));
+    }
+
+    NetworkEntitySpatialGrid::View::View(NetworkEntitySpatialGrid& grid)
+        : m_grid(grid)
+        , m_cellChangedHandler([this](const CellChange& change) { OnCellChanged(change); })
+    {
+        m_grid.AddCellChangedHandler(m_cellChangedHandler);
+    }
+
+    void NetworkEntitySpatialGrid::View::Update(const AZ::Vector3& position, float radius)
+    {
+        const AZ::Vector3 extents(radius);
+        const CellCoord minCell = m_grid.GetCell(position - extents);
+        const CellCoord maxCell = m_grid.GetCell(position + extents);
+
+        if (m_hasCells
+            && (minCell.m_x == m_minCell.m_x) && (minCell.m_y == m_minCell.m_y) && (minCell.m_z == m_minCell.m_z)
+            && (maxCell.m_x == m_maxCell.m_x) && (maxCell.m_y == m_maxCell.m_y) && (maxCell.m_z == m_maxCell.m_z))
+        {
+            // Still covering the same cells, entity changes have already been applied as they happened
+            return;
+        }
+
+        const auto inBox = [](const CellCoord& cell, const CellCoord& boxMin, const CellCoord& boxMax)
+        {
+            return (cell.m_x >= boxMin.m_x) && (cell.m_x <= boxMax.m_x)
+                && (cell.m_y >= boxMin.m_y) && (cell.m_y <= boxMax.m_y)
+                && (cell.m_z >= boxMin.m_z) && (cell.m_z <= boxMax.m_z);
+        };
+
+        // Remove the entities of cells leaving the view
+        if (m_hasCells)
+        {
+            for (CellCoord cell{ 0, 0, m_minCell.m_z }; cell.m_z <= m_maxCell.m_z; ++cell.m_z)
+            {
+                for (cell.m_y = m_minCell.m_y; cell.m_y <= m_maxCell.m_y; ++cell.m_y)
+                {
+                    for (cell.m_x = m_minCell.m_x; cell.m_x <= m_maxCell.m_x; ++cell.m_x)
+                    {
+                        if (inBox(cell, minCell, maxCell))
+                        {
+                            continue;
+                        }
+                        if (const AZStd::vector<NetEntityId>* cellEntities = m_grid.GetEntitiesInCell(cell))
+                        {
+                            for (NetEntityId netEntityId : *cellEntities)
+                            {
+                                m_entities.erase(netEntityId);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Add the entities of cells entering the view
+        for (CellCoord cell{ 0, 0, minCell.m_z }; cell.m_z <= maxCell.m_z; ++cell.m_z)
+        {
+            for (cell.m_y = minCell.m_y; cell.m_y <= maxCell.m_y; ++cell.m_y)
+            {
+                for (cell.m_x = minCell.m_x; cell.m_x <= maxCell.m_x; ++cell.m_x)
+                {
+                    if (m_hasCells && inBox(cell, m_minCell, m_maxCell))
+                    {
+                        continue;
+                    }
+                    if (const AZStd::vector<NetEntityId>* cellEntities = m_grid.GetEntitiesInCell(cell))
+                    {
+                        m_entities.insert(cellEntities->begin(), cellEntities->end());
+                    }
+                }
+            }
+        }
+
+        m_minCell = minCell;
+        m_maxCell = maxCell;
+        m_hasCells = true;
+    }
+
+    const AZStd::unordered_set<NetEntityId>& NetworkEntitySpatialGrid::View::GetEntities() const
+    {
+        return m_entities;
+    }
+
+    bool NetworkEntitySpatialGrid::View::Contains(const CellCoord& cell) const
+    {
+        return m_hasCells
+            && (cell.m_x >= m_minCell.m_x) && (cell.m_x <= m_maxCell.m_x)
+            && (cell.m_y >= m_minCell.m_y) && (cell.m_y <= m_maxCell.m_y)
+            && (cell.m_z >= m_minCell.m_z) && (cell.m_z <= m_maxCell.m_z);
+    }
+
+    void NetworkEntitySpatialGrid::View::OnCellChanged(const CellChange& change)
+    {
+        const bool wasInView = (change.m_fromCell != InvalidCellKey) && Contains(GetCellCoord(change.m_fromCell));
+        const bool isInView = (change.m_toCell != InvalidCellKey) && Contains(GetCellCoord(change.m_toCell));
+        if (wasInView && !isInView)
+        {
+            m_entities.erase(change.m_netEntityId);
+        }
+        else if (isInView && !wasInView)
+        {
+            m_entities.insert(change.m_netEntityId);
+        }
+    }
+
+    NetworkEntitySpatialGrid::NetworkEntitySpatialGrid(NetworkEntityTracker& networkEntityTracker)
+        : m_networkEntityTracker(networkEntityTracker)
+        , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+    {
+        AZ::Interface<NetworkEntitySpatialGrid>::Register(this);
+    }
+
+    NetworkEntitySpatialGrid::~NetworkEntitySpatialGrid()
+    {
+        Reset();
+        AZ::Interface<NetworkEntitySpatialGrid>::Unregister(this);
+    }
+
+    void NetworkEntitySpatialGrid::Reset()
+    {
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+        m_cellChangedEvent.DisconnectAllHandlers();
+        m_entities.clear();
+        m_cells.clear();
+        m_isTracking = false;
+    }
+
+    void NetworkEntitySpatialGrid::AddCellChangedHandler(CellChangedEvent::Handler& handler)
+    {
+        if (!m_isTracking)
+        {
+            StartTracking();
+        }
+        handler.Connect(m_cellChangedEvent);
+    }
+
+    NetworkEntitySpatialGrid::CellCoord NetworkEntitySpatialGrid::GetCell(const AZ::Vector3& position) const
+    {
+        return CellCoord
+        {
+            ToCellCoord(position.GetX(), m_inverseCellSize),
+            ToCellCoord(position.GetY(), m_inverseCellSize),
+            ToCellCoord(position.GetZ(), m_inverseCellSize)
+        };
+    }
+
+    const AZStd::vector<NetEntityId>* NetworkEntitySpatialGrid::GetEntitiesInCell(const CellCoord& cell) const
+    {
+        auto iter = m_cells.find(GetCellKey(cell));
+        return (iter != m_cells.end()) ? &iter->second : nullptr;
+    }
+
+    NetworkEntitySpatialGrid::CellKey NetworkEntitySpatialGrid::GetCellKey(const CellCoord& cell)
+    {
+        const uint64_t x = static_cast<uint64_t>(cell.m_x + CellCoordBias) & CellCoordMask;
+        const uint64_t y = static_cast<uint64_t>(cell.m_y + CellCoordBias) & CellCoordMask;
+        const uint64_t z = static_cast<uint64_t>(cell.m_z + CellCoordBias) & CellCoordMask;
+        return x | (y << CellCoordBits) | (z << (CellCoordBits * 2));
+    }
+
+    NetworkEntitySpatialGrid::CellCoord NetworkEntitySpatialGrid::GetCellCoord(CellKey cellKey)
+    {
+        return CellCoord
+        {
+            static_cast<int32_t>(cellKey & CellCoordMask) - CellCoordBias,
+            static_cast<int32_t>((cellKey >> CellCoordBits) & CellCoordMask) - CellCoordBias,
+            static_cast<int32_t>((cellKey >> (CellCoordBits * 2)) & CellCoordMask) - CellCoordBias
+        };
+    }
+
+    void NetworkEntitySpatialGrid::StartTracking()
+    {
+        m_inverseCellSize = 1.0f / AZ::GetMax(static_cast<float>(sv_SpatialGridCellSize), 1.0f);
+        m_isTracking = true;
+
+        AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get();
+        if (componentApplication != nullptr)
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+
+        // Pick up all the networked entities that were activated before anyone needed the grid
+        for (auto& entityPair : m_networkEntityTracker)
+        {
+            AZ::Entity* entity = entityPair.second;
+            if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+            {
+                AddEntity(entity);
+            }
+        }
+    }
+
+    void NetworkEntitySpatialGrid::OnEntityActivated(AZ::Entity* entity)
+    {
+        AddEntity(entity);
+    }
+
+    void NetworkEntitySpatialGrid::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = m_networkEntityTracker.GetNetBindComponent(entity);
+        if (netBindComponent == nullptr)
+        {
+            return;
+        }
+
+        const NetEntityId netEntityId = netBindComponent->GetNetEntityId();
+        auto iter = m_entities.find(netEntityId);
+        if (iter != m_entities.end())
+        {
+            const CellKey fromCell = iter->second.m_cell;
+            m_entities.erase(iter);
+            MoveEntity(netEntityId, fromCell, InvalidCellKey);
+        }
+    }
+
+    void NetworkEntitySpatialGrid::AddEntity(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = m_networkEntityTracker.GetNetBindComponent(entity);
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if ((netBindComponent == nullptr) || (transformInterface == nullptr))
+        {
+            return;
+        }
+
+        const NetEntityId netEntityId = netBindComponent->GetNetEntityId();
+        if (m_entities.find(netEntityId) != m_entities.end())
+        {
+            return;
+        }
+
+        EntityRecord& record = m_entities[netEntityId];
+        record.m_transformChangedHandler = AZ::TransformChangedEvent::Handler([this, netEntityId](const AZ::Transform&, const AZ::Transform& worldTm)
+        {
+            OnEntityMoved(netEntityId, worldTm.GetTranslation());
+        });
+        transformInterface->BindTransformChangedEventHandler(record.m_transformChangedHandler);
+
+        record.m_cell = GetCellKey(GetCell(transformInterface->GetWorldTranslation()));
+        MoveEntity(netEntityId, InvalidCellKey, record.m_cell);
+    }
+
+    void NetworkEntitySpatialGrid::OnEntityMoved(NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        auto iter = m_entities.find(netEntityId);
+        if (iter == m_entities.end())
+        {
+            return;
+        }
+
+        const CellKey toCell = GetCellKey(GetCell(position));
+        const CellKey fromCell = iter->second.m_cell;
+        if (toCell != fromCell)
+        {
+            iter->second.m_cell = toCell;
+            MoveEntity(netEntityId, fromCell, toCell);
+        }
+    }
+
+    void NetworkEntitySpatialGrid::MoveEntity(NetEntityId netEntityId, CellKey fromCell, CellKey toCell)
+    {
+        if (fromCell != InvalidCellKey)
+        {
+            auto cellIter = m_cells.find(fromCell);
+            if (cellIter != m_cells.end())
+            {
+                AZStd::vector<NetEntityId>& cellEntities = cellIter->second;
+                auto entityIter = AZStd::find(cellEntities.begin(), cellEntities.end(), netEntityId);
+                if (entityIter != cellEntities.end())
+                {
+                    // Order within a cell doesn't matter, swap with the back to avoid shifting the remaining entities
+                    *entityIter = cellEntities.back();
+                    cellEntities.pop_back();
+                }
+                if (cellEntities.empty())
+                {
+                    m_cells.erase(cellIter);
+                }
+            }
+        }
+
+        if (toCell != InvalidCellKey)
+        {
+            m_cells[toCell].push_back(netEntityId);
+        }
+
+        m_cellChangedEvent.Signal(CellChange{ netEntityId, fromCell, toCell });
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class NetworkEntityTracker;
+
+    //! @class NetworkEntitySpatialGrid
+    //! @brief A uniform spatial hash of all active networked entities, shared by all replication windows.
+    //! The grid is updated incrementally from entity transform changes, and notifies listeners whenever an entity changes cell.
+    //! This allows each replication window to maintain its set of nearby entities by only processing cells and entities that changed,
+    //! rather than querying the visibility system for every connection on every update.
+    class NetworkEntitySpatialGrid
+    {
+    public:
+        AZ_RTTI(NetworkEntitySpatialGrid, "{0B8A4C1E-7E0F-4C62-9D5B-3A9E2F6C1D47}");
+
+        using CellKey = uint64_t;
+        static constexpr CellKey InvalidCellKey = AZStd::numeric_limits<CellKey>::max();
+
+        struct CellCoord
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+            int32_t m_z = 0;
+        };
+
+        //! Describes an entity moving between cells, an invalid cell key means the entity entered or left the grid.
+        struct CellChange
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            CellKey m_fromCell = InvalidCellKey;
+            CellKey m_toCell = InvalidCellKey;
+        };
+        using CellChangedEvent = AZ::Event<const CellChange&>;
+
+        //! @class View
+        //! @brief Maintains the set of entities within the cells overlapping a sphere.
+        //! Moving the sphere only visits the cells entering and leaving the view, and entity cell changes are applied as they happen.
+        class View
+        {
+        public:
+            explicit View(NetworkEntitySpatialGrid& grid);
+
+            //! Moves the view to cover the cells overlapping the provided sphere.
+            //! @param position the center of the view
+            //! @param radius   the radius of the view
+            void Update(const AZ::Vector3& position, float radius);
+
+            //! Returns the set of entities within the cells covered by the view.
+            //! @return the set of entities within the cells covered by the view
+            const AZStd::unordered_set<NetEntityId>& GetEntities() const;
+
+        private:
+            bool Contains(const CellCoord& cell) const;
+            void OnCellChanged(const CellChange& change);
+
+            NetworkEntitySpatialGrid& m_grid;
+            CellCoord m_minCell;
+            CellCoord m_maxCell;
+            bool m_hasCells = false;
+            AZStd::unordered_set<NetEntityId> m_entities;
+            CellChangedEvent::Handler m_cellChangedHandler;
+        };
+
+        explicit NetworkEntitySpatialGrid(NetworkEntityTracker& networkEntityTracker);
+        virtual ~NetworkEntitySpatialGrid();
+
+        //! Stops tracking entities and disconnects all listeners.
+        void Reset();
+
+        //! Adds a listener for entities changing cells, the grid starts tracking entities when the first listener is added.
+        //! @param handler the handler to connect
+        void AddCellChangedHandler(CellChangedEvent::Handler& handler);
+
+        //! Returns the cell containing the provided position.
+        //! @param position the world position to return the cell for
+        //! @return the cell containing the provided position
+        CellCoord GetCell(const AZ::Vector3& position) const;
+
+        //! Returns the networked entities inside the provided cell.
+        //! @param cell the cell to return the entities for
+        //! @return pointer to the entities inside the cell, nullptr if the cell is empty
+        const AZStd::vector<NetEntityId>* GetEntitiesInCell(const CellCoord& cell) const;
+
+        static CellKey GetCellKey(const CellCoord& cell);
+        static CellCoord GetCellCoord(CellKey cellKey);
+
+    private:
+        void StartTracking();
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+        void AddEntity(AZ::Entity* entity);
+        void OnEntityMoved(NetEntityId netEntityId, const AZ::Vector3& position);
+        void MoveEntity(NetEntityId netEntityId, CellKey fromCell, CellKey toCell);
+
+        struct EntityRecord
+        {
+            CellKey m_cell = InvalidCellKey;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+        };
+
+        NetworkEntityTracker& m_networkEntityTracker;
+        AZStd::unordered_map<NetEntityId, EntityRecord> m_entities;
+        AZStd::unordered_map<CellKey, AZStd::vector<NetEntityId>> m_cells;
+        CellChangedEvent m_cellChangedEvent;
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+        float m_inverseCellSize = 0.0f;
+        bool m_isTracking = false;
+    };
+}
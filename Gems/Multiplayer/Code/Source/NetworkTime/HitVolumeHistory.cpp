@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+namespace Multiplayer
+{
+    namespace
+    {
+        constexpr float RayEpsilon = 1.0e-6f;
+
+        // Returns the distance along the ray to the first intersection with the sphere, 0 if the origin is inside it
+        bool RaySphere(const AZ::Vector3& origin, const AZ::Vector3& direction, const AZ::Vector3& center, float radius, float maxDistance, float& outDistance)
+        {
+            const AZ::Vector3 offset = origin - center;
+            const float b = offset.Dot(direction);
+            const float c = offset.Dot(offset) - radius * radius;
+            if (c <= 0.0f)
+            {
+                outDistance = 0.0f;
+                return true;
+            }
+            const float discriminant = b * b - c;
+            if (b > 0.0f || discriminant < 0.0f)
+            {
+                return false;
+            }
+            outDistance = -b - sqrtf(discriminant);
+            return outDistance <= maxDistance;
+        }
+
+        // Capsule segment runs along the local z axis from -halfHeight to +halfHeight
+        bool RayCapsule(const AZ::Vector3& origin, const AZ::Vector3& direction, float radius, float halfHeight, float maxDistance, float& outDistance)
+        {
+            const float a = direction.GetX() * direction.GetX() + direction.GetY() * direction.GetY();
+            const float b = origin.GetX() * direction.GetX() + origin.GetY() * direction.GetY();
+            const float c = origin.GetX() * origin.GetX() + origin.GetY() * origin.GetY() - radius * radius;
+            if (c <= 0.0f && fabsf(origin.GetZ()) <= halfHeight)
+            {
+                outDistance = 0.0f;
+                return true;
+            }
+
+            bool hit = false;
+            float closest = maxDistance;
+            if (c > 0.0f && a > RayEpsilon)
+            {
+                const float discriminant = b * b - a * c;
+                if (discriminant >= 0.0f)
+                {
+                    const float distance = (-b - sqrtf(discriminant)) / a;
+                    if (distance >= 0.0f && distance <= closest && fabsf(origin.GetZ() + distance * direction.GetZ()) <= halfHeight)
+                    {
+                        closest = distance;
+                        hit = true;
+                    }
+                }
+            }
+
+            float distance = 0.0f;
+            if (RaySphere(origin, direction, AZ::Vector3(0.0f, 0.0f, halfHeight), radius, closest, distance))
+            {
+                closest = distance;
+                hit = true;
+            }
+            if (RaySphere(origin, direction, AZ::Vector3(0.0f, 0.0f, -halfHeight), radius, closest, distance))
+            {
+                closest = distance;
+                hit = true;
+            }
+            outDistance = closest;
+            return hit;
+        }
+
+        bool RayBox(const AZ::Vector3& origin, const AZ::Vector3& direction, const AZ::Vector3& halfExtents, float maxDistance, float& outDistance)
+        {
+            float nearDistance = 0.0f;
+            float farDistance = maxDistance;
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                const float axisOrigin = origin.GetElement(axis);
+                const float axisDirection = direction.GetElement(axis);
+                const float extent = halfExtents.GetElement(axis);
+                if (fabsf(axisDirection) < RayEpsilon)
+                {
+                    if (fabsf(axisOrigin) > extent)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                const float inverseDirection = 1.0f / axisDirection;
+                float entry = (-extent - axisOrigin) * inverseDirection;
+                float exit = (extent - axisOrigin) * inverseDirection;
+                if (entry > exit)
+                {
+                    AZStd::swap(entry, exit);
+                }
+                nearDistance = AZStd::max(nearDistance, entry);
+                farDistance = AZStd::min(farDistance, exit);
+                if (nearDistance > farDistance)
+                {
+                    return false;
+                }
+            }
+            outDistance = nearDistance;
+            return true;
+        }
+
+        // Squared distance from a local space point to the surface of a volume, zero if the point lies inside the volume
+        float DistanceSqToVolume(HitVolumeHistory::VolumeShape shape, const AZ::Vector3& dimensions, const AZ::Vector3& point)
+        {
+            switch (shape)
+            {
+            case HitVolumeHistory::VolumeShape::Sphere:
+            {
+                const float distance = AZStd::max(point.GetLength() - dimensions.GetX(), 0.0f);
+                return distance * distance;
+            }
+            case HitVolumeHistory::VolumeShape::Capsule:
+            {
+                const float segmentZ = AZ::GetClamp(point.GetZ(), -dimensions.GetZ(), dimensions.GetZ());
+                const float distance = AZStd::max((point - AZ::Vector3(0.0f, 0.0f, segmentZ)).GetLength() - dimensions.GetX(), 0.0f);
+                return distance * distance;
+            }
+            case HitVolumeHistory::VolumeShape::Box:
+                return (point - point.GetClamp(-dimensions, dimensions)).GetLengthSq();
+            }
+            return 0.0f;
+        }
+    }
+
+    HitVolumeHistory::HitVolumeHistory()
+    {
+        Clear();
+    }
+
+    void HitVolumeHistory::Clear()
+    {
+        m_shapes.clear();
+        m_dimensions.clear();
+        m_maxVolumeRadius = 0.0f;
+        m_frameIds.fill(InvalidHostFrameId);
+        m_positionsX.clear();
+        m_positionsY.clear();
+        m_positionsZ.clear();
+        m_rotations.clear();
+    }
+
+    uint32_t HitVolumeHistory::GetVolumeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_shapes.size());
+    }
+
+    uint32_t HitVolumeHistory::AddVolume(const Physics::ShapeConfiguration& shapeConfig)
+    {
+        const AZ::Vector3& scale = shapeConfig.m_scale;
+        switch (shapeConfig.GetShapeType())
+        {
+        case Physics::ShapeType::Sphere:
+        {
+            const float radius = static_cast<const Physics::SphereShapeConfiguration&>(shapeConfig).m_radius * scale.GetMaxElement();
+            return AddVolume(VolumeShape::Sphere, AZ::Vector3(radius));
+        }
+        case Physics::ShapeType::Capsule:
+        {
+            const Physics::CapsuleShapeConfiguration& capsuleConfig = static_cast<const Physics::CapsuleShapeConfiguration&>(shapeConfig);
+            const float radius = capsuleConfig.m_radius * AZStd::max(scale.GetX(), scale.GetY());
+            const float halfHeight = AZStd::max(0.5f * capsuleConfig.m_height * scale.GetZ() - radius, 0.0f);
+            return AddVolume(VolumeShape::Capsule, AZ::Vector3(radius, radius, halfHeight));
+        }
+        case Physics::ShapeType::Box:
+        {
+            const AZ::Vector3 halfExtents = 0.5f * static_cast<const Physics::BoxShapeConfiguration&>(shapeConfig).m_dimensions * scale;
+            return AddVolume(VolumeShape::Box, halfExtents);
+        }
+        default:
+            return InvalidVolumeIndex;
+        }
+    }
+
+    uint32_t HitVolumeHistory::AddVolume(VolumeShape shape, const AZ::Vector3& dimensions)
+    {
+        m_shapes.push_back(shape);
+        m_dimensions.push_back(dimensions);
+
+        switch (shape)
+        {
+        case VolumeShape::Sphere:
+            m_maxVolumeRadius = AZStd::max(m_maxVolumeRadius, dimensions.GetX());
+            break;
+        case VolumeShape::Capsule:
+            m_maxVolumeRadius = AZStd::max(m_maxVolumeRadius, dimensions.GetX() + dimensions.GetZ());
+            break;
+        case VolumeShape::Box:
+            m_maxVolumeRadius = AZStd::max(m_maxVolumeRadius, dimensions.GetLength());
+            break;
+        }
+
+        // The per frame layout depends on the volume count, so previously recorded frames are no longer valid
+        const AZStd::size_t historySize = static_cast<AZStd::size_t>(RewindHistorySize) * m_shapes.size();
+        m_frameIds.fill(InvalidHostFrameId);
+        m_positionsX.resize(historySize);
+        m_positionsY.resize(historySize);
+        m_positionsZ.resize(historySize);
+        m_rotations.resize(historySize);
+        return GetVolumeCount() - 1;
+    }
+
+    void HitVolumeHistory::Record(HostFrameId frameId, const AZ::Transform& worldTransform, AZStd::span<const AZ::Transform> localTransforms)
+    {
+        const uint32_t volumeCount = GetVolumeCount();
+        AZ_Assert(localTransforms.size() == volumeCount, "Recorded transform count does not match the hit volume count");
+        if (frameId == InvalidHostFrameId || volumeCount == 0 || localTransforms.size() != volumeCount)
+        {
+            return;
+        }
+
+        const uint32_t slot = static_cast<uint32_t>(frameId) % RewindHistorySize;
+        const uint32_t base = slot * volumeCount;
+        AZ::Vector3 boundsMin = AZ::Vector3(AZ::Constants::FloatMax);
+        AZ::Vector3 boundsMax = AZ::Vector3(-AZ::Constants::FloatMax);
+        for (uint32_t volumeIndex = 0; volumeIndex < volumeCount; ++volumeIndex)
+        {
+            const AZ::Transform volumeTransform = worldTransform * localTransforms[volumeIndex];
+            const AZ::Vector3 position = volumeTransform.GetTranslation();
+            m_positionsX[base + volumeIndex] = position.GetX();
+            m_positionsY[base + volumeIndex] = position.GetY();
+            m_positionsZ[base + volumeIndex] = position.GetZ();
+            m_rotations[base + volumeIndex] = volumeTransform.GetRotation();
+            boundsMin = boundsMin.GetMin(position);
+            boundsMax = boundsMax.GetMax(position);
+        }
+
+        m_frameIds[slot] = frameId;
+        m_scales[slot] = worldTransform.GetUniformScale();
+        m_boundsCenters[slot] = 0.5f * (boundsMin + boundsMax);
+        m_boundsRadii[slot] = 0.5f * (boundsMax - boundsMin).GetLength() + m_maxVolumeRadius * m_scales[slot];
+    }
+
+    bool HitVolumeHistory::HasFrame(HostFrameId frameId) const
+    {
+        return FindSlot(frameId) != RewindHistorySize;
+    }
+
+    bool HitVolumeHistory::Raycast
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        const AZ::Vector3& origin,
+        const AZ::Vector3& direction,
+        float maxDistance,
+        RayHit& outHit
+    ) const
+    {
+        const uint32_t slot = FindSlot(frameId);
+        if (slot == RewindHistorySize)
+        {
+            return false;
+        }
+        const uint32_t previousSlot = (blendFactor < 1.0f) ? FindSlot(HostFrameId{ static_cast<uint32_t>(frameId) - 1 }) : RewindHistorySize;
+
+        AZ::Vector3 boundsCenter;
+        float boundsRadius = 0.0f;
+        GetBounds(slot, previousSlot, boundsCenter, boundsRadius);
+        float boundsDistance = 0.0f;
+        if (!RaySphere(origin, direction, boundsCenter, boundsRadius, maxDistance, boundsDistance))
+        {
+            return false;
+        }
+
+        const float scale = GetScale(slot, previousSlot, blendFactor);
+        float closest = maxDistance;
+        bool hit = false;
+        const uint32_t volumeCount = GetVolumeCount();
+        for (uint32_t volumeIndex = 0; volumeIndex < volumeCount; ++volumeIndex)
+        {
+            // Test in the local space of the volume, where each shape is axis aligned and centered on the origin
+            const Pose pose = GetPose(slot, previousSlot, blendFactor, volumeIndex);
+            const AZ::Quaternion inverseRotation = pose.m_rotation.GetConjugate();
+            const AZ::Vector3 localOrigin = inverseRotation.TransformVector(origin - pose.m_position);
+            const AZ::Vector3 localDirection = inverseRotation.TransformVector(direction);
+            const AZ::Vector3 dimensions = m_dimensions[volumeIndex] * scale;
+
+            float distance = 0.0f;
+            bool volumeHit = false;
+            switch (m_shapes[volumeIndex])
+            {
+            case VolumeShape::Sphere:
+                volumeHit = RaySphere(localOrigin, localDirection, AZ::Vector3::CreateZero(), dimensions.GetX(), closest, distance);
+                break;
+            case VolumeShape::Capsule:
+                volumeHit = RayCapsule(localOrigin, localDirection, dimensions.GetX(), dimensions.GetZ(), closest, distance);
+                break;
+            case VolumeShape::Box:
+                volumeHit = RayBox(localOrigin, localDirection, dimensions, closest, distance);
+                break;
+            }
+
+            if (volumeHit && distance <= closest)
+            {
+                closest = distance;
+                outHit.m_volumeIndex = volumeIndex;
+                hit = true;
+            }
+        }
+
+        if (hit)
+        {
+            outHit.m_distance = closest;
+            outHit.m_position = origin + direction * closest;
+        }
+        return hit;
+    }
+
+    bool HitVolumeHistory::OverlapSphere
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        const AZ::Vector3& center,
+        float radius,
+        AZStd::vector<uint32_t>& outVolumes
+    ) const
+    {
+        outVolumes.clear();
+        const uint32_t slot = FindSlot(frameId);
+        if (slot == RewindHistorySize)
+        {
+            return false;
+        }
+        const uint32_t previousSlot = (blendFactor < 1.0f) ? FindSlot(HostFrameId{ static_cast<uint32_t>(frameId) - 1 }) : RewindHistorySize;
+
+        AZ::Vector3 boundsCenter;
+        float boundsRadius = 0.0f;
+        GetBounds(slot, previousSlot, boundsCenter, boundsRadius);
+        if (center.GetDistanceSq(boundsCenter) > (radius + boundsRadius) * (radius + boundsRadius))
+        {
+            return false;
+        }
+
+        const float scale = GetScale(slot, previousSlot, blendFactor);
+        const uint32_t volumeCount = GetVolumeCount();
+        for (uint32_t volumeIndex = 0; volumeIndex < volumeCount; ++volumeIndex)
+        {
+            const Pose pose = GetPose(slot, previousSlot, blendFactor, volumeIndex);
+            const AZ::Vector3 localCenter = pose.m_rotation.GetConjugate().TransformVector(center - pose.m_position);
+            if (DistanceSqToVolume(m_shapes[volumeIndex], m_dimensions[volumeIndex] * scale, localCenter) <= radius * radius)
+            {
+                outVolumes.push_back(volumeIndex);
+            }
+        }
+        return !outVolumes.empty();
+    }
+
+    uint32_t HitVolumeHistory::FindSlot(HostFrameId frameId) const
+    {
+        if (frameId == InvalidHostFrameId || m_shapes.empty())
+        {
+            return RewindHistorySize;
+        }
+        const uint32_t slot = static_cast<uint32_t>(frameId) % RewindHistorySize;
+        return (m_frameIds[slot] == frameId) ? slot : RewindHistorySize;
+    }
+
+    HitVolumeHistory::Pose HitVolumeHistory::GetPose(uint32_t slot, uint32_t previousSlot, float blendFactor, uint32_t volumeIndex) const
+    {
+        const uint32_t index = slot * GetVolumeCount() + volumeIndex;
+        Pose pose{ AZ::Vector3(m_positionsX[index], m_positionsY[index], m_positionsZ[index]), m_rotations[index] };
+        if (previousSlot != RewindHistorySize)
+        {
+            // Interpolate the same way AnimatedHitVolume::SyncToCurrentTransform does when rewinding the physics scene
+            const uint32_t previousIndex = previousSlot * GetVolumeCount() + volumeIndex;
+            const AZ::Vector3 previousPosition(m_positionsX[previousIndex], m_positionsY[previousIndex], m_positionsZ[previousIndex]);
+            pose.m_position = previousPosition.Lerp(pose.m_position, blendFactor);
+            pose.m_rotation = m_rotations[previousIndex].Slerp(pose.m_rotation, blendFactor);
+        }
+        return pose;
+    }
+
+    float HitVolumeHistory::GetScale(uint32_t slot, uint32_t previousSlot, float blendFactor) const
+    {
+        return (previousSlot != RewindHistorySize) ? AZ::Lerp(m_scales[previousSlot], m_scales[slot], blendFactor) : m_scales[slot];
+    }
+
+    void HitVolumeHistory::GetBounds(uint32_t slot, uint32_t previousSlot, AZ::Vector3& outCenter, float& outRadius) const
+    {
+        outCenter = m_boundsCenters[slot];
+        outRadius = m_boundsRadii[slot];
+        if (previousSlot != RewindHistorySize)
+        {
+            // Any blend of the two frames lies within the convex hull of both bounding spheres
+            const AZ::Vector3& previousCenter = m_boundsCenters[previousSlot];
+            const float halfSeparation = 0.5f * outCenter.GetDistance(previousCenter);
+            outRadius = halfSeparation + AZStd::max(outRadius, m_boundsRadii[previousSlot]);
+            outCenter = 0.5f * (outCenter + previousCenter);
+        }
+    }
+}
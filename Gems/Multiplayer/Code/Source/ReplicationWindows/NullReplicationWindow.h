@@ -24,6 +24,7 @@ namespace Multiplayer
         bool ReplicationSetUpdateReady() override;
         const ReplicationSet& GetReplicationSet() const override;
         uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendBytes() const override;
         bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
         void UpdateWindow() override;
         AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override;
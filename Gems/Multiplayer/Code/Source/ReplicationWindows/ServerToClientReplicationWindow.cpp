@@ -8,10 +8,13 @@
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Transform.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/sort.h>
 
@@ -25,6 +28,15 @@ namespace Multiplayer
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(bool, sv_ReplicationUseSpatialGrid, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Find entities near clients using the shared spatial grid instead of querying the visibility system for every client, takes effect for new connections");
+    AZ_CVAR(uint32_t, sv_MinBytesToReplicate, 4096, nullptr, AZ::ConsoleFunctorFlags::Null, "The default number of bytes of proxy entity updates to send to a poor client connection each frame, 0 for unlimited");
+    AZ_CVAR(uint32_t, sv_MaxBytesToReplicate, 16384, nullptr, AZ::ConsoleFunctorFlags::Null, "The default number of bytes of proxy entity updates to send to a client connection each frame, 0 for unlimited");
+    AZ_CVAR(float, sv_ReplicationPriorityBase, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum replication priority of every relevant entity, so distant entities are still updated eventually");
+    AZ_CVAR(float, sv_ReplicationPriorityDistanceScale, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Replication priority added to entities as they approach the client");
+    AZ_CVAR(float, sv_ReplicationPriorityViewScale, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null, "Replication priority added to entities as they align with the client's view direction");
+    AZ_CVAR(float, sv_ReplicationLodDistance, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Distance beyond which the proxy update interval of entities doubles with every further multiple of this distance, 0 to update all entities every frame");
+    AZ_CVAR(uint32_t, sv_ReplicationLodMaxInterval, 8, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of host frames between proxy updates of distant entities");
+    AZ_CVAR(float, sv_ReplicationPriorityAlwaysRelevant, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Replication priority of entities that are always relevant to clients");
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -66,6 +78,14 @@ namespace Multiplayer
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
 
+        if (sv_ReplicationUseSpatialGrid)
+        {
+            if (NetworkEntitySpatialGrid* spatialGrid = AZ::Interface<NetworkEntitySpatialGrid>::Get())
+            {
+                m_spatialGridView = AZStd::make_unique<NetworkEntitySpatialGrid::View>(*spatialGrid);
+            }
+        }
+
         m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
 
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
@@ -92,6 +112,14 @@ namespace Multiplayer
         return m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
     }
 
+    uint32_t ServerToClientReplicationWindow::GetMaxProxyEntityReplicatorSendBytes() const
+    {
+        const uint32_t maxBytes = m_isPoorConnection ? sv_MinBytesToReplicate : sv_MaxBytesToReplicate;
+        const uint32_t budgetBytes = (maxBytes > 0) ? maxBytes : AZStd::numeric_limits<uint32_t>::max();
+        // Don't produce more than the connection's congestion control is willing to send this frame
+        return AZStd::min(budgetBytes, m_connection->GetAvailableSendBytes());
+    }
+
     bool ServerToClientReplicationWindow::IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
     {
         AZ_Assert(false, "IsInWindow should not be called on the ServerToClientReplicationWindow");
@@ -119,8 +147,68 @@ namespace Multiplayer
         EvaluateConnection();
 
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
-        const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
+        const AZ::Transform controlledEntityTransform = transformInterface->GetWorldTM();
+        const AZ::Vector3 controlledEntityPosition = controlledEntityTransform.GetTranslation();
+        const AZ::Vector3 controlledEntityDirection = controlledEntityTransform.GetBasisY().GetNormalizedSafe();
+
+        if (m_spatialGridView != nullptr)
+        {
+            GatherEntitiesFromSpatialGrid(controlledEntityPosition, controlledEntityDirection);
+        }
+        else
+        {
+            GatherEntitiesFromVisibilitySystem(controlledEntityPosition, controlledEntityDirection);
+        }
+
+        // Add in all entities that have forced relevancy
+        for (const ConstNetworkEntityHandle& entityHandle : GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet())
+        {
+            if (entityHandle.Exists())
+            {
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, sv_ReplicationPriorityAlwaysRelevant };  // Always replicate entities with forced relevancy
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+        }
+    }
+
+    void ServerToClientReplicationWindow::GatherEntitiesFromSpatialGrid(const AZ::Vector3& controlledEntityPosition, const AZ::Vector3& controlledEntityDirection)
+    {
+        // The view only visits cells that entered or left since the last update, entities moving between cells have already been applied
+        m_spatialGridView->Update(controlledEntityPosition, sv_ClientAwarenessRadius);
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        const float awarenessRadiusSq = sv_ClientAwarenessRadius * sv_ClientAwarenessRadius;
+        for (NetEntityId netEntityId : m_spatialGridView->GetEntities())
+        {
+            AZ::Entity* entity = networkEntityTracker->GetRaw(netEntityId);
+            AZ::TransformInterface* transformInterface = (entity != nullptr) ? entity->GetTransform() : nullptr;
+            if (transformInterface == nullptr)
+            {
+                continue;
+            }
+
+            // Grid cells cover the awareness sphere conservatively, so trim entities in the corners of the covered cells
+            const AZ::Vector3 entityPosition = transformInterface->GetWorldTranslation();
+            if (controlledEntityPosition.GetDistanceSq(entityPosition) > awarenessRadiusSq)
+            {
+                continue;
+            }
 
+            AddCandidateEntity(entity, entityPosition, controlledEntityPosition, controlledEntityDirection);
+        }
+    }
+
+    void ServerToClientReplicationWindow::GatherEntitiesFromVisibilitySystem(const AZ::Vector3& controlledEntityPosition, const AZ::Vector3& controlledEntityDirection)
+    {
         AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
         AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
@@ -136,52 +224,35 @@ namespace Multiplayer
             }
         );
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
-        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
-
         // Add all the neighbours
         for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
-            {
-                // Entity does not have netbinding, skip this entity
-                continue;
-            }
-
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
-            {
-                continue;
-            }
-
             // We want to find the closest extent to the player and prioritize using that distance
             const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
             const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
-            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+            AddCandidateEntity(static_cast<AZ::Entity*>(visEntry->m_userData), closestPosition, controlledEntityPosition, controlledEntityDirection);
         }
+    }
 
-        // Add in all entities that have forced relevancy
-        for (const ConstNetworkEntityHandle& entityHandle : GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet())
+    void ServerToClientReplicationWindow::AddCandidateEntity(AZ::Entity* entity, const AZ::Vector3& closestPosition,
+        const AZ::Vector3& controlledEntityPosition, const AZ::Vector3& controlledEntityDirection)
+    {
+        NetworkEntityHandle entityHandle(entity, GetNetworkEntityTracker());
+        if (entityHandle.GetNetBindComponent() == nullptr)
         {
-            if (entityHandle.Exists())
-            {
-                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f };  // Always replicate entities with forced relevancy
-            }
+            // Entity does not have netbinding, skip this entity
+            return;
         }
 
-        // Add in Autonomous Entities
-        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
-        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
-
-        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
-        if (hierarchyComponent != nullptr)
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
         {
-            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+            return;
         }
+
+        const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
+        const float priority = CalculatePriority(controlledEntityPosition, controlledEntityDirection, closestPosition);
+        AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
     }
 
     AzNetworking::PacketId ServerToClientReplicationWindow::SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector)
@@ -249,13 +320,16 @@ namespace Multiplayer
                 AZ::TransformInterface* transformInterface = entity->GetTransform();
                 if (transformInterface != nullptr)
                 {
-                    const AZ::Vector3 clientPosition = m_controlledEntityTransform->GetWorldTranslation();
-                    float distSq = clientPosition.GetDistanceSq(transformInterface->GetWorldTranslation());
+                    const AZ::Transform clientTransform = m_controlledEntityTransform->GetWorldTM();
+                    const AZ::Vector3 clientPosition = clientTransform.GetTranslation();
+                    const AZ::Vector3 entityPosition = transformInterface->GetWorldTranslation();
+                    float distSq = clientPosition.GetDistanceSq(entityPosition);
                     float awarenessSq = sv_ClientAwarenessRadius * sv_ClientAwarenessRadius;
                     // Make sure we would be in the awareness radius
                     if (distSq < awarenessSq)
                     {
-                        AddEntityToReplicationSet(entityHandle, 1.0f, distSq);
+                        const float priority = CalculatePriority(clientPosition, clientTransform.GetBasisY().GetNormalizedSafe(), entityPosition);
+                        AddEntityToReplicationSet(entityHandle, priority, distSq);
                     }
                 }
             }
@@ -300,7 +374,36 @@ namespace Multiplayer
         }
     }
 
-    void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
+    float ServerToClientReplicationWindow::CalculatePriority(const AZ::Vector3& viewPosition, const AZ::Vector3& viewDirection, const AZ::Vector3& entityPosition) const
+    {
+        const AZ::Vector3 toEntity = entityPosition - viewPosition;
+        const float distance = toEntity.GetLength();
+        const float awarenessRadius = AZ::GetMax(static_cast<float>(sv_ClientAwarenessRadius), AZ::Constants::FloatEpsilon);
+
+        // Closer entities are more important, scale linearly from the edge of the awareness radius
+        const float proximity = 1.0f - AZ::GetClamp(distance / awarenessRadius, 0.0f, 1.0f);
+
+        // Entities in front of the client are more important than those behind it, entities overlapping the client are fully in view
+        const float alignment = (distance > AZ::Constants::FloatEpsilon) ? 0.5f * (1.0f + viewDirection.Dot(toEntity / distance)) : 1.0f;
+
+        return sv_ReplicationPriorityBase + sv_ReplicationPriorityDistanceScale * proximity + sv_ReplicationPriorityViewScale * alignment;
+    }
+
+    uint32_t ServerToClientReplicationWindow::CalculateUpdateInterval(float distanceSquared) const
+    {
+        const float lodDistance = sv_ReplicationLodDistance;
+        if (lodDistance <= 0.0f)
+        {
+            return 1;
+        }
+
+        // Every multiple of the lod distance doubles the interval, 1, 2, 4, 8...
+        const float lodLevel = AZ::GetMin(sqrtf(distanceSquared) / lodDistance, 31.0f);
+        const uint32_t interval = 1u << static_cast<uint32_t>(lodLevel);
+        return AZ::GetClamp(interval, 1u, AZ::GetMax(static_cast<uint32_t>(sv_ReplicationLodMaxInterval), 1u));
+    }
+
+    void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared)
     {
         // Assumption: the entity has been checked for filtering prior to this call.
         if (!sv_ReplicateServerProxies)
@@ -324,7 +427,7 @@ namespace Multiplayer
                 m_replicationSet.erase(removeEnt);
             }
             m_candidateQueue.push(PrioritizedReplicationCandidate(entityHandle, priority));
-            m_replicationSet[entityHandle] = { NetEntityRole::Client, priority };
+            m_replicationSet[entityHandle] = { NetEntityRole::Client, priority, CalculateUpdateInterval(distanceSquared) };
         }
     }
 
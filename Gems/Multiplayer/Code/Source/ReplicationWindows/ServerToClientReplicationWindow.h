@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/NetworkEntity/NetworkEntitySpatialGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -46,6 +47,7 @@ namespace Multiplayer
         bool ReplicationSetUpdateReady() override;
         const ReplicationSet& GetReplicationSet() const override;
         uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendBytes() const override;
         bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
         void UpdateWindow() override;
         AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override;
@@ -60,6 +62,18 @@ namespace Multiplayer
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
         void EvaluateConnection();
+        void GatherEntitiesFromSpatialGrid(const AZ::Vector3& controlledEntityPosition, const AZ::Vector3& controlledEntityDirection);
+        void GatherEntitiesFromVisibilitySystem(const AZ::Vector3& controlledEntityPosition, const AZ::Vector3& controlledEntityDirection);
+        void AddCandidateEntity(AZ::Entity* entity, const AZ::Vector3& closestPosition, const AZ::Vector3& controlledEntityPosition, const AZ::Vector3& controlledEntityDirection);
+
+        //! Calculates the per frame replication priority of an entity, which grows with proximity to the controlled entity
+        //! and alignment with the controlled entity's view direction.
+        //! @param viewPosition  the world position of the controlled entity
+        //! @param viewDirection the normalized world forward direction of the controlled entity
+        //! @param entityPosition the closest world position of the entity to the controlled entity
+        //! @return the replication priority of the entity
+        float CalculatePriority(const AZ::Vector3& viewPosition, const AZ::Vector3& viewDirection, const AZ::Vector3& entityPosition) const;
+        uint32_t CalculateUpdateInterval(float distanceSquared) const;
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
@@ -68,6 +82,9 @@ namespace Multiplayer
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
+        // Tracks the entities near the controlled entity when the shared spatial grid is available
+        AZStd::unique_ptr<NetworkEntitySpatialGrid::View> m_spatialGridView;
+
         AZ::ScheduledEvent m_updateWindowEvent;
 
         NetworkEntityHandle m_controlledEntity;
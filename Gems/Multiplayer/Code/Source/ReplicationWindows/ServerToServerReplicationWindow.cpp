@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ServerToServerReplicationWindow.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Color.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_ServerProxyMargin, 50.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Distance from the region of a peer server within which entities are replicated to it as server proxies, takes effect for new connections");
+    AZ_CVAR(AZ::TimeMs, sv_ServerReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Rate for server to server replication window updates.");
+    AZ_CVAR(uint32_t, sv_MaxEntitiesToReplicateToServer, 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The max number of proxy entities to send updates for to a peer server each frame");
+
+    ServerToServerReplicationWindow::ServerToServerReplicationWindow(AzNetworking::IConnection* connection, const AZ::Aabb& remoteDomainAabb)
+        : m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("Server to server replication window update event"))
+        , m_connection(connection)
+    {
+        if (remoteDomainAabb.IsValid())
+        {
+            m_proxyAabb = remoteDomainAabb;
+            m_proxyAabb.Expand(AZ::Vector3(sv_ServerProxyMargin));
+        }
+
+        UpdateWindow();
+        m_updateWindowEvent.Enqueue(sv_ServerReplicationWindowUpdateMs, true);
+    }
+
+    bool ServerToServerReplicationWindow::ReplicationSetUpdateReady()
+    {
+        return true;
+    }
+
+    const ReplicationSet& ServerToServerReplicationWindow::GetReplicationSet() const
+    {
+        return m_replicationSet;
+    }
+
+    uint32_t ServerToServerReplicationWindow::GetMaxProxyEntityReplicatorSendCount() const
+    {
+        return sv_MaxEntitiesToReplicateToServer;
+    }
+
+    uint32_t ServerToServerReplicationWindow::GetMaxProxyEntityReplicatorSendBytes() const
+    {
+        // Peer servers share a fast internal network, only the congestion control of the connection limits the updates
+        return m_connection->GetAvailableSendBytes();
+    }
+
+    bool ServerToServerReplicationWindow::IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
+    {
+        if (IsNearRemoteDomain(entityHandle) || GetNetworkEntityManager()->GetAlwaysRelevantToServersSet().contains(entityHandle))
+        {
+            outNetworkRole = NetEntityRole::Server;
+            return true;
+        }
+        outNetworkRole = NetEntityRole::InvalidRole;
+        return false;
+    }
+
+    void ServerToServerReplicationWindow::UpdateWindow()
+    {
+        m_replicationSet.clear();
+
+        // Only the authority replicates an entity, proxies of entities owned by a third server are replicated by that server
+        INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+        NetworkEntityTracker* networkEntityTracker = networkEntityManager->GetNetworkEntityTracker();
+        for (auto iter = networkEntityTracker->begin(); iter != networkEntityTracker->end(); ++iter)
+        {
+            ConstNetworkEntityHandle entityHandle(iter->second, networkEntityTracker);
+            NetBindComponent* netBindComponent = networkEntityTracker->GetNetBindComponent(iter->second);
+            if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
+            {
+                NetEntityRole networkRole = NetEntityRole::InvalidRole;
+                if (IsInWindow(entityHandle, networkRole))
+                {
+                    EntityReplicationData& replicationData = m_replicationSet[entityHandle];
+                    replicationData.m_netEntityRole = networkRole;
+                    replicationData.m_priority = 1.0f;
+                }
+            }
+        }
+    }
+
+    AzNetworking::PacketId ServerToServerReplicationWindow::SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector)
+    {
+        MultiplayerPackets::EntityUpdates entityUpdatePacket;
+        entityUpdatePacket.SetHostTimeMs(GetNetworkTime()->GetHostTimeMs());
+        entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
+        entityUpdatePacket.SetEntityMessages(entityUpdateVector);
+        return m_connection->SendUnreliablePacket(entityUpdatePacket);
+    }
+
+    void ServerToServerReplicationWindow::SendEntityRpcs(NetworkEntityRpcVector& entityRpcVector, bool reliable)
+    {
+        MultiplayerPackets::EntityRpcs entityRpcsPacket;
+        entityRpcsPacket.SetEntityRpcs(entityRpcVector);
+        if (reliable)
+        {
+            m_connection->SendReliablePacket(entityRpcsPacket);
+        }
+        else
+        {
+            m_connection->SendUnreliablePacket(entityRpcsPacket);
+        }
+    }
+
+    void ServerToServerReplicationWindow::DebugDraw() const
+    {
+        if (!m_proxyAabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        if (debugDisplay != nullptr)
+        {
+            debugDisplay->SetColor(AZ::Colors::Yellow);
+            debugDisplay->DrawWireBox(m_proxyAabb.GetMin(), m_proxyAabb.GetMax());
+        }
+    }
+
+    bool ServerToServerReplicationWindow::IsNearRemoteDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        const AZ::TransformInterface* transform = (entity != nullptr) ? entity->GetTransform() : nullptr;
+        return m_proxyAabb.IsValid() && (transform != nullptr) && m_proxyAabb.Contains(transform->GetWorldTranslation());
+    }
+}
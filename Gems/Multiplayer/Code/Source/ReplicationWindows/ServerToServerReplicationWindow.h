@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer
+{
+    //! @class ServerToServerReplicationWindow
+    //! @brief Replicates the entities this server has authority over near the region of a peer server.
+    //! The peer simulates them as server proxies, so entities on both sides of a boundary see each other and an entity
+    //! crossing the boundary already has a replicator on the peer it migrates to.
+    class ServerToServerReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        ServerToServerReplicationWindow(AzNetworking::IConnection* connection, const AZ::Aabb& remoteDomainAabb);
+
+        //! IReplicationWindow interface
+        //! @{
+        bool ReplicationSetUpdateReady() override;
+        const ReplicationSet& GetReplicationSet() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendBytes() const override;
+        bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
+        void UpdateWindow() override;
+        AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override;
+        void SendEntityRpcs(NetworkEntityRpcVector& entityRpcVector, bool reliable) override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+        bool IsNearRemoteDomain(const ConstNetworkEntityHandle& entityHandle) const;
+
+        ReplicationSet m_replicationSet;
+        AZ::Aabb m_proxyAabb = AZ::Aabb::CreateNull(); //< The remote domain extended by the proxy margin
+        AZ::ScheduledEvent m_updateWindowEvent;
+        AzNetworking::IConnection* m_connection = nullptr;
+    };
+}
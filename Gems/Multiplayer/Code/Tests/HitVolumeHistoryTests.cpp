@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/HitVolumeHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class HitVolumeHistoryTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_history.AddVolume(Multiplayer::HitVolumeHistory::VolumeShape::Sphere, AZ::Vector3(0.5f));
+            m_history.AddVolume(Multiplayer::HitVolumeHistory::VolumeShape::Box, AZ::Vector3(0.5f, 0.5f, 0.5f));
+            m_history.AddVolume(Multiplayer::HitVolumeHistory::VolumeShape::Capsule, AZ::Vector3(0.25f, 0.25f, 1.0f));
+        }
+
+        void TearDown() override
+        {
+            m_history.Clear();
+            AllocatorsFixture::TearDown();
+        }
+
+        // Sphere at x = 0, box at x = 5 and capsule at x = 10, all offset by the entity position
+        void RecordFrame(uint32_t frameId, const AZ::Vector3& entityPosition)
+        {
+            const AZ::Transform localTransforms[] =
+            {
+                AZ::Transform::CreateIdentity(),
+                AZ::Transform::CreateTranslation(AZ::Vector3(5.0f, 0.0f, 0.0f)),
+                AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 0.0f, 0.0f)),
+            };
+            m_history.Record(Multiplayer::HostFrameId{ frameId }, AZ::Transform::CreateTranslation(entityPosition), localTransforms);
+        }
+
+        Multiplayer::HitVolumeHistory m_history;
+    };
+
+    TEST_F(HitVolumeHistoryTests, Raycast_HitsVolumesAtRecordedFrame)
+    {
+        RecordFrame(10, AZ::Vector3::CreateZero());
+        RecordFrame(11, AZ::Vector3(0.0f, 100.0f, 0.0f));
+
+        Multiplayer::HitVolumeHistory::RayHit hit;
+        const AZ::Vector3 down = -AZ::Vector3::CreateAxisZ();
+        EXPECT_TRUE(m_history.Raycast(Multiplayer::HostFrameId{ 10 }, 1.0f, AZ::Vector3(0.0f, 0.0f, 10.0f), down, 100.0f, hit));
+        EXPECT_EQ(hit.m_volumeIndex, 0);
+        EXPECT_NEAR(hit.m_distance, 9.5f, 0.001f);
+
+        EXPECT_TRUE(m_history.Raycast(Multiplayer::HostFrameId{ 10 }, 1.0f, AZ::Vector3(5.0f, 0.0f, 10.0f), down, 100.0f, hit));
+        EXPECT_EQ(hit.m_volumeIndex, 1);
+        EXPECT_NEAR(hit.m_distance, 9.5f, 0.001f);
+
+        EXPECT_TRUE(m_history.Raycast(Multiplayer::HostFrameId{ 10 }, 1.0f, AZ::Vector3(10.0f, 0.0f, 10.0f), down, 100.0f, hit));
+        EXPECT_EQ(hit.m_volumeIndex, 2);
+        EXPECT_NEAR(hit.m_distance, 8.75f, 0.001f);
+
+        // The entity moved away on the next frame
+        EXPECT_FALSE(m_history.Raycast(Multiplayer::HostFrameId{ 11 }, 1.0f, AZ::Vector3(0.0f, 0.0f, 10.0f), down, 100.0f, hit));
+        EXPECT_FALSE(m_history.Raycast(Multiplayer::HostFrameId{ 12 }, 1.0f, AZ::Vector3(0.0f, 0.0f, 10.0f), down, 100.0f, hit));
+    }
+
+    TEST_F(HitVolumeHistoryTests, Raycast_BlendsBetweenFrames)
+    {
+        RecordFrame(10, AZ::Vector3::CreateZero());
+        RecordFrame(11, AZ::Vector3(2.0f, 0.0f, 0.0f));
+
+        Multiplayer::HitVolumeHistory::RayHit hit;
+        const AZ::Vector3 down = -AZ::Vector3::CreateAxisZ();
+        EXPECT_TRUE(m_history.Raycast(Multiplayer::HostFrameId{ 11 }, 0.5f, AZ::Vector3(1.0f, 0.0f, 10.0f), down, 100.0f, hit));
+        EXPECT_EQ(hit.m_volumeIndex, 0);
+        EXPECT_FALSE(m_history.Raycast(Multiplayer::HostFrameId{ 11 }, 1.0f, AZ::Vector3(0.4f, 0.0f, 10.0f), down, 100.0f, hit));
+    }
+
+    TEST_F(HitVolumeHistoryTests, OverlapSphere_ReturnsOverlappingVolumes)
+    {
+        RecordFrame(10, AZ::Vector3::CreateZero());
+
+        AZStd::vector<uint32_t> volumes;
+        EXPECT_TRUE(m_history.OverlapSphere(Multiplayer::HostFrameId{ 10 }, 1.0f, AZ::Vector3(2.5f, 0.0f, 0.0f), 2.1f, volumes));
+        ASSERT_EQ(volumes.size(), 2);
+        EXPECT_EQ(volumes[0], 0);
+        EXPECT_EQ(volumes[1], 1);
+
+        EXPECT_FALSE(m_history.OverlapSphere(Multiplayer::HostFrameId{ 10 }, 1.0f, AZ::Vector3(0.0f, 50.0f, 0.0f), 1.0f, volumes));
+        EXPECT_TRUE(volumes.empty());
+    }
+
+    TEST_F(HitVolumeHistoryTests, Record_OverwritesOldestFrame)
+    {
+        RecordFrame(10, AZ::Vector3::CreateZero());
+        EXPECT_TRUE(m_history.HasFrame(Multiplayer::HostFrameId{ 10 }));
+        RecordFrame(10 + Multiplayer::RewindHistorySize, AZ::Vector3::CreateZero());
+        EXPECT_FALSE(m_history.HasFrame(Multiplayer::HostFrameId{ 10 }));
+        EXPECT_TRUE(m_history.HasFrame(Multiplayer::HostFrameId{ 10 + Multiplayer::RewindHistorySize }));
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/SnapshotDeltaCodec.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class SnapshotDeltaCodecTests
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(SnapshotDeltaCodecTests, EncodeWithoutBaseline_RoundTrips)
+    {
+        const Multiplayer::SnapshotBuffer snapshot = { 1, 2, 0, 0, 0, 3, 4, 5, 0 };
+
+        Multiplayer::SnapshotBuffer encoded;
+        ASSERT_TRUE(Multiplayer::SnapshotDeltaCodec::Encode(snapshot, nullptr, nullptr, encoded));
+
+        Multiplayer::SnapshotBuffer decoded;
+        ASSERT_TRUE(Multiplayer::SnapshotDeltaCodec::Decode(encoded.data(), static_cast<uint32_t>(encoded.size()), nullptr, nullptr, decoded));
+        EXPECT_EQ(snapshot, decoded);
+    }
+
+    TEST_F(SnapshotDeltaCodecTests, EncodeAgainstBaseline_UnchangedBytesArePacked)
+    {
+        Multiplayer::SnapshotBuffer baseline(256);
+        for (uint32_t index = 0; index < baseline.size(); ++index)
+        {
+            baseline[index] = static_cast<uint8_t>(index * 7 + 1);
+        }
+        Multiplayer::SnapshotBuffer snapshot = baseline;
+        snapshot[100] ^= 0xFF;
+        snapshot.push_back(42);
+
+        Multiplayer::SnapshotBuffer encoded;
+        ASSERT_TRUE(Multiplayer::SnapshotDeltaCodec::Encode(snapshot, &baseline, nullptr, encoded));
+        EXPECT_LT(encoded.size(), 16);
+
+        Multiplayer::SnapshotBuffer decoded;
+        ASSERT_TRUE(Multiplayer::SnapshotDeltaCodec::Decode(encoded.data(), static_cast<uint32_t>(encoded.size()), &baseline, nullptr, decoded));
+        EXPECT_EQ(snapshot, decoded);
+
+        // A shorter snapshot than its baseline must also round trip
+        snapshot.resize(10);
+        ASSERT_TRUE(Multiplayer::SnapshotDeltaCodec::Encode(snapshot, &baseline, nullptr, encoded));
+        ASSERT_TRUE(Multiplayer::SnapshotDeltaCodec::Decode(encoded.data(), static_cast<uint32_t>(encoded.size()), &baseline, nullptr, decoded));
+        EXPECT_EQ(snapshot, decoded);
+    }
+
+    TEST_F(SnapshotDeltaCodecTests, DecodeTruncatedDelta_Fails)
+    {
+        const Multiplayer::SnapshotBuffer snapshot = { 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+        Multiplayer::SnapshotBuffer encoded;
+        ASSERT_TRUE(Multiplayer::SnapshotDeltaCodec::Encode(snapshot, nullptr, nullptr, encoded));
+
+        Multiplayer::SnapshotBuffer decoded;
+        EXPECT_FALSE(Multiplayer::SnapshotDeltaCodec::Decode(encoded.data(), static_cast<uint32_t>(encoded.size() - 1), nullptr, nullptr, decoded));
+    }
+
+    TEST_F(SnapshotDeltaCodecTests, BaselineRing_FindsOnlyStoredSequences)
+    {
+        Multiplayer::SnapshotBaselineRing ring;
+        ring.Store(5, Multiplayer::SnapshotBuffer{ 1, 2, 3 });
+        ASSERT_NE(nullptr, ring.Find(5));
+        EXPECT_EQ(3, ring.Find(5)->size());
+        EXPECT_EQ(nullptr, ring.Find(6));
+
+        // Storing a sequence that maps to the same slot overwrites the older baseline
+        ring.Store(5 + Multiplayer::MaxSnapshotBaselines, Multiplayer::SnapshotBuffer{ 4 });
+        EXPECT_EQ(nullptr, ring.Find(5));
+        EXPECT_NE(nullptr, ring.Find(5 + Multiplayer::MaxSnapshotBaselines));
+
+        ring.Clear();
+        EXPECT_EQ(nullptr, ring.Find(5 + Multiplayer::MaxSnapshotBaselines));
+    }
+}
@@ -41,6 +41,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.inl
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/SnapshotDeltaCodec.h
     Include/Multiplayer/NetworkEntity/IFilterEntityManager.h
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
     Include/Multiplayer/NetworkEntity/NetworkEntityHandle.h
@@ -53,6 +54,7 @@ set(FILES
     Include/Multiplayer/NetworkInput/NetworkInputChild.h
     Include/Multiplayer/NetworkInput/NetworkInputHistory.h
     Include/Multiplayer/NetworkInput/NetworkInputMigrationVector.h
+    Include/Multiplayer/NetworkTime/HitVolumeHistory.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
@@ -100,12 +102,17 @@ set(FILES
     Source/ConnectionData/ServerToClientConnectionData.cpp
     Source/ConnectionData/ServerToClientConnectionData.h
     Source/ConnectionData/ServerToClientConnectionData.inl
+    Source/ConnectionData/ServerToServerConnectionData.cpp
+    Source/ConnectionData/ServerToServerConnectionData.h
+    Source/ConnectionData/ServerToServerConnectionData.inl
     Source/Editor/MultiplayerEditorConnection.cpp
     Source/Editor/MultiplayerEditorConnection.h
     Source/EntityDomains/FullOwnershipEntityDomain.cpp
     Source/EntityDomains/FullOwnershipEntityDomain.h
     Source/EntityDomains/NullEntityDomain.cpp
     Source/EntityDomains/NullEntityDomain.h
+    Source/EntityDomains/SpatialEntityDomain.cpp
+    Source/EntityDomains/SpatialEntityDomain.h
     Source/MultiplayerStats.cpp
     Source/MultiplayerSystemComponent.cpp
     Source/MultiplayerSystemComponent.h
@@ -116,12 +123,15 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
+    Source/NetworkEntity/EntityReplication/SnapshotDeltaCodec.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.h
     Source/NetworkEntity/NetworkEntityHandle.cpp
     Source/NetworkEntity/NetworkEntityManager.cpp
     Source/NetworkEntity/NetworkEntityManager.h
     Source/NetworkEntity/NetworkEntityRpcMessage.cpp
+    Source/NetworkEntity/NetworkEntitySpatialGrid.cpp
+    Source/NetworkEntity/NetworkEntitySpatialGrid.h
     Source/NetworkEntity/NetworkEntityTracker.cpp
     Source/NetworkEntity/NetworkEntityTracker.h
     Source/NetworkEntity/NetworkEntityTracker.inl
@@ -133,6 +143,7 @@ set(FILES
     Source/NetworkInput/NetworkInputChild.cpp
     Source/NetworkInput/NetworkInputHistory.cpp
     Source/NetworkInput/NetworkInputMigrationVector.cpp
+    Source/NetworkTime/HitVolumeHistory.cpp
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
@@ -141,6 +152,8 @@ set(FILES
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
+    Source/ReplicationWindows/ServerToServerReplicationWindow.cpp
+    Source/ReplicationWindows/ServerToServerReplicationWindow.h
     Source/Session/MatchmakingRequests.cpp
     Source/Session/SessionRequests.cpp
     Source/Session/SessionConfig.cpp
@@ -17,6 +17,7 @@ set(FILES
     Tests/ServerHierarchyBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonBenchmarkSetup.h
+    Tests/HitVolumeHistoryTests.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
@@ -27,6 +28,7 @@ set(FILES
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp
+    Tests/SnapshotDeltaCodecTests.cpp
     Tests/TestMultiplayerComponent.h
     Tests/TestMultiplayerComponent.cpp
 )
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressionDictionary.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(bool, mp_CompressionCaptureSamples, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Records compressed packet payloads to build a compression dictionary with mp_CompressionSaveDictionary");
+    AZ_CVAR(uint32_t, mp_CompressionMaxSamples, 8192, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum number of packet payloads recorded while mp_CompressionCaptureSamples is enabled");
+
+    namespace
+    {
+        struct SampleCapture
+        {
+            AZStd::mutex m_mutex;
+            AZStd::vector<AZStd::vector<uint8_t>> m_samples;
+        };
+
+        SampleCapture& GetSampleCapture()
+        {
+            static SampleCapture sampleCapture;
+            return sampleCapture;
+        }
+    }
+
+    CompressionDictionary::CompressionDictionary(AZStd::vector<uint8_t> data)
+        : m_data(AZStd::move(data))
+    {
+        if (m_data.size() > MaxDictionarySize)
+        {
+            m_data.erase(m_data.begin(), m_data.end() - MaxDictionarySize);
+        }
+        m_version = AZ::Crc32(m_data.data(), m_data.size());
+        m_id = static_cast<uint8_t>(m_version);
+        m_id = (m_id != 0) ? m_id : 1;
+    }
+
+    AZStd::shared_ptr<const CompressionDictionary> CompressionDictionary::Load(AZStd::string_view filePath)
+    {
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(filePath);
+        if (!readResult.IsSuccess() || readResult.GetValue().empty())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to load compression dictionary %.*s", AZ_STRING_ARG(filePath));
+            return nullptr;
+        }
+        return AZStd::make_shared<const CompressionDictionary>(readResult.TakeValue());
+    }
+
+    AZStd::vector<uint8_t> CompressionDictionary::Build(const AZStd::vector<AZStd::vector<uint8_t>>& samples)
+    {
+        struct SampleCount
+        {
+            const AZStd::vector<uint8_t>* m_sample;
+            uint32_t m_count;
+        };
+
+        // Count the identical samples, periodic updates of the same components repeat the same payloads
+        AZStd::unordered_map<uint32_t, size_t> sampleIndices;
+        AZStd::vector<SampleCount> sampleCounts;
+        for (const AZStd::vector<uint8_t>& sample : samples)
+        {
+            const uint32_t sampleHash = AZ::Crc32(sample.data(), sample.size());
+            auto iter = sampleIndices.find(sampleHash);
+            if ((iter != sampleIndices.end()) && (*sampleCounts[iter->second].m_sample == sample))
+            {
+                ++sampleCounts[iter->second].m_count;
+            }
+            else
+            {
+                sampleIndices[sampleHash] = sampleCounts.size();
+                sampleCounts.push_back(SampleCount{ &sample, 1 });
+            }
+        }
+
+        // The most common samples go last, and survive the truncation to the dictionary size
+        AZStd::stable_sort(sampleCounts.begin(), sampleCounts.end(),
+            [](const SampleCount& lhs, const SampleCount& rhs) { return lhs.m_count < rhs.m_count; });
+
+        size_t dictionarySize = 0;
+        size_t firstSample = sampleCounts.size();
+        while ((firstSample > 0) && (dictionarySize + sampleCounts[firstSample - 1].m_sample->size() <= MaxDictionarySize))
+        {
+            --firstSample;
+            dictionarySize += sampleCounts[firstSample].m_sample->size();
+        }
+
+        AZStd::vector<uint8_t> dictionary;
+        dictionary.reserve(dictionarySize);
+        for (size_t i = firstSample; i < sampleCounts.size(); ++i)
+        {
+            dictionary.insert(dictionary.end(), sampleCounts[i].m_sample->begin(), sampleCounts[i].m_sample->end());
+        }
+        return dictionary;
+    }
+
+    void CaptureCompressionSample(const void* data, size_t size)
+    {
+        if (!mp_CompressionCaptureSamples || (size == 0))
+        {
+            return;
+        }
+
+        SampleCapture& sampleCapture = GetSampleCapture();
+        AZStd::lock_guard<AZStd::mutex> lock(sampleCapture.m_mutex);
+        if (sampleCapture.m_samples.size() < mp_CompressionMaxSamples)
+        {
+            const uint8_t* sampleData = reinterpret_cast<const uint8_t*>(data);
+            sampleCapture.m_samples.emplace_back(sampleData, sampleData + size);
+        }
+    }
+
+    static void mp_CompressionSaveDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "mp_CompressionSaveDictionary requires the path of the dictionary file to write");
+            return;
+        }
+
+        AZStd::vector<AZStd::vector<uint8_t>> samples;
+        {
+            SampleCapture& sampleCapture = GetSampleCapture();
+            AZStd::lock_guard<AZStd::mutex> lock(sampleCapture.m_mutex);
+            samples.swap(sampleCapture.m_samples);
+        }
+
+        const AZStd::vector<uint8_t> dictionary = CompressionDictionary::Build(samples);
+        const AZStd::string_view content(reinterpret_cast<const char*>(dictionary.data()), dictionary.size());
+        if (!AZ::Utils::WriteFile(content, arguments.front()).IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to write compression dictionary %.*s", AZ_STRING_ARG(arguments.front()));
+            return;
+        }
+        AZ_TracePrintf("Multiplayer Compressor", "Saved a %zu B compression dictionary built from %zu samples\n", dictionary.size(), samples.size());
+    }
+    AZ_CONSOLEFREEFUNC(mp_CompressionSaveDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Builds a compression dictionary from the samples recorded with mp_CompressionCaptureSamples and writes it to the given path");
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace MultiplayerCompression
+{
+    //! LZ4 only references the last 64 KB of history, so larger dictionaries don't help
+    static constexpr size_t MaxDictionarySize = 64 * 1024;
+
+    /**
+    * A compression dictionary, representative packet payloads that prime the compressor so that small packets
+    * can reference the content they have in common with typical traffic instead of encoding it again.
+    * Both endpoints must use the same dictionary, every compressed packet carries the dictionary id to detect mismatches.
+    */
+    struct CompressionDictionary
+    {
+        //! Creates a dictionary from its content, truncated to the last MaxDictionarySize bytes.
+        explicit CompressionDictionary(AZStd::vector<uint8_t> data);
+
+        //! Loads a dictionary saved by mp_CompressionSaveDictionary.
+        //! @param filePath path of the dictionary file
+        //! @return the dictionary, nullptr if the file couldn't be read
+        static AZStd::shared_ptr<const CompressionDictionary> Load(AZStd::string_view filePath);
+
+        //! Builds a dictionary from sample packet payloads.
+        //! Repeated samples are placed last, closest to the compressed data, where LZ4 encodes matches with the shortest offsets.
+        //! @param samples the sample payloads, typically captured with mp_CompressionCaptureSamples
+        //! @return the dictionary content
+        static AZStd::vector<uint8_t> Build(const AZStd::vector<AZStd::vector<uint8_t>>& samples);
+
+        AZStd::vector<uint8_t> m_data;
+        uint32_t m_version = 0; //< Crc32 of the content
+        uint8_t m_id = 0;       //< Id written in compressed packets, derived from the version and never 0
+    };
+
+    //! Records a packet payload for dictionary training while mp_CompressionCaptureSamples is enabled, invoked by the compressors.
+    //! @param data the uncompressed payload
+    //! @param size the size of the payload
+    void CaptureCompressionSample(const void* data, size_t size);
+}
@@ -7,6 +7,7 @@
  */
 
 #include "LZ4Compressor.h"
+#include "CompressionDictionary.h"
 
 #include <lz4.h>
 #include <lz4hc.h>
@@ -53,6 +54,8 @@ namespace MultiplayerCompression
             return AzNetworking::CompressorError::InsufficientBuffer;
         }
 
+        CaptureCompressionSample(uncompData, uncompSize);
+
         AZ_Warning("Multiplayer Compressor", compDataSize >= compWorstCaseSize, "Outbuffer size (%lu B) passed to Compress() is less than estimated worst case (%lu B)", compDataSize, compWorstCaseSize);
 
         // Note that this returns a non-negative int so we are narrowing into a size_t here
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LZ4DictionaryCompressor.h"
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Crc.h>
+
+#include <lz4.h>
+
+namespace MultiplayerCompression
+{
+    static const char* DictionaryCompressorName = "LZ4Dictionary";
+    static const char* StreamCompressorName = "LZ4Stream";
+
+    // Block boundaries of the compress and decompress histories don't need to match with these sizes, see LZ4_decompress_safe_continue
+    static constexpr size_t CompressHistorySize = 64 * 1024 + LZ4DictionaryCompressor::MaxStreamPacketSize;
+    static constexpr size_t DecompressHistorySize = LZ4_DECODER_RING_BUFFER_SIZE(LZ4DictionaryCompressor::MaxStreamPacketSize);
+
+    LZ4DictionaryCompressor::LZ4DictionaryCompressor(AZStd::shared_ptr<const CompressionDictionary> dictionary, bool streaming)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_streaming(streaming)
+    {
+        ;
+    }
+
+    LZ4DictionaryCompressor::~LZ4DictionaryCompressor()
+    {
+        LZ4_freeStream(m_dictionaryStream);
+        LZ4_freeStream(m_compressStream);
+        LZ4_freeStreamDecode(m_decompressStream);
+    }
+
+    const char* LZ4DictionaryCompressor::GetName() const
+    {
+        return m_streaming ? StreamCompressorName : DictionaryCompressorName;
+    }
+
+    AzNetworking::CompressorType LZ4DictionaryCompressor::GetType() const
+    {
+        return aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(GetName())));
+    }
+
+    bool LZ4DictionaryCompressor::Init()
+    {
+        const char* dictionaryData = m_dictionary ? reinterpret_cast<const char*>(m_dictionary->m_data.data()) : nullptr;
+        const int dictionarySize = m_dictionary ? aznumeric_cast<int>(m_dictionary->m_data.size()) : 0;
+
+        m_compressStream = LZ4_createStream();
+        m_decompressStream = LZ4_createStreamDecode();
+        if (m_streaming)
+        {
+            m_compressHistory.resize_no_construct(CompressHistorySize);
+            m_decompressHistory.resize_no_construct(DecompressHistorySize);
+            m_compressOffset = 0;
+            m_decompressOffset = 0;
+            if (m_compressStream != nullptr)
+            {
+                LZ4_loadDict(m_compressStream, dictionaryData, dictionarySize);
+            }
+            if (m_decompressStream != nullptr)
+            {
+                LZ4_setStreamDecode(m_decompressStream, dictionaryData, dictionarySize);
+            }
+        }
+        else
+        {
+            // Loading a dictionary hashes all of its content, do it once and copy the loaded stream for each packet
+            m_dictionaryStream = LZ4_createStream();
+            if (m_dictionaryStream != nullptr)
+            {
+                LZ4_loadDict(m_dictionaryStream, dictionaryData, dictionarySize);
+            }
+        }
+        return (m_compressStream != nullptr) && (m_decompressStream != nullptr) && (m_streaming || (m_dictionaryStream != nullptr));
+    }
+
+    size_t LZ4DictionaryCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t LZ4DictionaryCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return HeaderSize + LZ4_compressBound(static_cast<int>(uncompSize));
+    }
+
+    AzNetworking::CompressorError LZ4DictionaryCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if ((uncompData == nullptr) || (compData == nullptr))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Buffer passed to Compress() is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_compressStream == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compress() called before Init()");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if ((compDataSize <= HeaderSize) || (m_streaming && (uncompSize > MaxStreamPacketSize)) || (LZ4_compressBound(static_cast<int>(uncompSize)) == 0))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Buffer sizes passed to Compress() are invalid, uncompSize:(%zu B) compDataSize:(%zu B)", uncompSize, compDataSize);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
+        CaptureCompressionSample(uncompData, uncompSize);
+
+        const char* source = reinterpret_cast<const char*>(uncompData);
+        if (m_streaming)
+        {
+            // The packet must stay in place for the next packets to reference it
+            if (m_compressOffset + uncompSize > m_compressHistory.size())
+            {
+                m_compressOffset = 0;
+            }
+            char* history = m_compressHistory.data() + m_compressOffset;
+            memcpy(history, uncompData, uncompSize);
+            source = history;
+        }
+        else
+        {
+            memcpy(m_compressStream, m_dictionaryStream, sizeof(LZ4_stream_t));
+        }
+
+        char* dest = reinterpret_cast<char*>(compData);
+        dest[0] = static_cast<char>(m_dictionary ? m_dictionary->m_id : 0);
+        const int result = LZ4_compress_fast_continue(m_compressStream, source, dest + HeaderSize,
+            static_cast<int>(uncompSize), static_cast<int>(compDataSize - HeaderSize), 1);
+        if (result <= 0)
+        {
+            // The stream state is undefined after a failure, the stream can't recover
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B)", uncompSize, compDataSize);
+            if (m_streaming)
+            {
+                LZ4_freeStream(m_compressStream);
+                m_compressStream = nullptr;
+            }
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        m_compressOffset += m_streaming ? uncompSize : 0;
+        compSize = HeaderSize + static_cast<size_t>(result);
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError LZ4DictionaryCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if ((uncompData == nullptr) || (compData == nullptr))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Buffer passed to Decompress() is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_decompressStream == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompress() called before Init()");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compDataSize <= HeaderSize)
+        {
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        const char* source = reinterpret_cast<const char*>(compData);
+        const uint8_t dictionaryId = m_dictionary ? m_dictionary->m_id : 0;
+        if (static_cast<uint8_t>(source[0]) != dictionaryId)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Packet compressed with dictionary %u but dictionary %u is loaded, endpoints must use the same dictionary",
+                static_cast<uint8_t>(source[0]), dictionaryId);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        const int sourceSize = static_cast<int>(compDataSize - HeaderSize);
+        int uncompSize = -1;
+        if (m_streaming)
+        {
+            if (m_decompressOffset + MaxStreamPacketSize > m_decompressHistory.size())
+            {
+                m_decompressOffset = 0;
+            }
+            char* history = m_decompressHistory.data() + m_decompressOffset;
+            uncompSize = LZ4_decompress_safe_continue(m_decompressStream, source + HeaderSize, history, sourceSize, static_cast<int>(MaxStreamPacketSize));
+            if ((uncompSize >= 0) && (static_cast<size_t>(uncompSize) <= uncompDataSize))
+            {
+                memcpy(uncompData, history, uncompSize);
+                m_decompressOffset += uncompSize;
+            }
+            else
+            {
+                uncompSize = -1;
+            }
+        }
+        else
+        {
+            const char* dictionaryData = m_dictionary ? reinterpret_cast<const char*>(m_dictionary->m_data.data()) : nullptr;
+            const int dictionarySize = m_dictionary ? aznumeric_cast<int>(m_dictionary->m_data.size()) : 0;
+            uncompSize = LZ4_decompress_safe_usingDict(source + HeaderSize, reinterpret_cast<char*>(uncompData), sourceSize,
+                static_cast<int>(uncompDataSize), dictionaryData, dictionarySize);
+        }
+        consumedSizeOut = compDataSize;
+
+        if (uncompSize < 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B)", compDataSize, uncompDataSize);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+        uncompSizeOut = uncompSize;
+        return AzNetworking::CompressorError::Ok;
+    }
+}
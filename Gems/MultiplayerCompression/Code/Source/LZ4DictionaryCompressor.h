@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+#include "CompressionDictionary.h"
+
+// LZ4 forward declarations
+typedef union LZ4_stream_u LZ4_stream_t;
+typedef union LZ4_streamDecode_u LZ4_streamDecode_t;
+
+namespace MultiplayerCompression
+{
+    /**
+    * Implements an LZ4 Compressor primed with a compression dictionary, for the small packets LZ4 barely compresses on their own.
+    * In stream mode the packets also reference the packets compressed before them. This requires each packet to be
+    * decompressed exactly once and in order, so a stream compressor must only be used by a single reliable and ordered
+    * connection, such as a Tcp connection.
+    */
+    class LZ4DictionaryCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(LZ4DictionaryCompressor, AZ::SystemAllocator, 0);
+
+        //! Every compressed packet starts with the id of the dictionary, 0 if none
+        static constexpr size_t HeaderSize = 1;
+
+        //! Largest packet a stream compressor accepts
+        static constexpr size_t MaxStreamPacketSize = 64 * 1024;
+
+        //! @param dictionary the dictionary to prime the compressor with, may be nullptr
+        //! @param streaming  if true packets also reference the packets previously compressed
+        LZ4DictionaryCompressor(AZStd::shared_ptr<const CompressionDictionary> dictionary, bool streaming);
+        ~LZ4DictionaryCompressor() override;
+
+        const char* GetName() const;
+        AzNetworking::CompressorType GetType() const override;
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        AZStd::shared_ptr<const CompressionDictionary> m_dictionary;
+        bool m_streaming = false;
+
+        LZ4_stream_t* m_dictionaryStream = nullptr; //< stream with the dictionary loaded, copied to reset m_compressStream for each packet
+        LZ4_stream_t* m_compressStream = nullptr;
+        LZ4_streamDecode_t* m_decompressStream = nullptr;
+
+        // In stream mode the history of each direction, the last 64 KB of the packets must remain in place for the next packets to reference
+        AZStd::vector<char> m_compressHistory;
+        AZStd::vector<char> m_decompressHistory;
+        size_t m_compressOffset = 0;
+        size_t m_decompressOffset = 0;
+    };
+}
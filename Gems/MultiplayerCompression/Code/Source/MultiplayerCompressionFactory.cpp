@@ -8,11 +8,15 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "LZ4DictionaryCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, mp_CompressionDictionary, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path of the dictionary used by the MultiplayerDictionaryCompressor and MultiplayerStreamCompressor, built with mp_CompressionSaveDictionary"); // WARN: both endpoints must use the same dictionary
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +26,39 @@ namespace MultiplayerCompression
     {
         return m_name;
     }
+
+    MultiplayerDictionaryCompressionFactory::MultiplayerDictionaryCompressionFactory(bool streaming)
+        : m_name(streaming ? "MultiplayerStreamCompressor" : "MultiplayerDictionaryCompressor")
+        , m_streaming(streaming)
+    {
+        ;
+    }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerDictionaryCompressionFactory::Create()
+    {
+        AZStd::shared_ptr<const CompressionDictionary> dictionary;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_dictionaryMutex);
+            const AZ::CVarFixedString dictionaryPath = static_cast<AZ::CVarFixedString>(mp_CompressionDictionary);
+            if (dictionaryPath != m_dictionaryPath)
+            {
+                m_dictionaryPath = dictionaryPath;
+                m_dictionary = dictionaryPath.empty() ? nullptr : CompressionDictionary::Load(dictionaryPath);
+            }
+            dictionary = m_dictionary;
+        }
+
+        auto compressor = AZStd::make_unique<LZ4DictionaryCompressor>(AZStd::move(dictionary), m_streaming);
+        if (!compressor->Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to initialize %s compressor", compressor->GetName());
+            return nullptr;
+        }
+        return compressor;
+    }
+
+    AZ::Name MultiplayerDictionaryCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
 }
@@ -9,9 +9,14 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsoleTypes.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
+#include "CompressionDictionary.h"
+
 namespace MultiplayerCompression
 {
     class MultiplayerCompressionFactory
@@ -29,4 +34,30 @@ namespace MultiplayerCompression
     private:
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
     };
+
+    //! Creates LZ4 compressors primed with the dictionary set by mp_CompressionDictionary.
+    class MultiplayerDictionaryCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! @param streaming if true the compressors also reference the packets previously compressed, only valid for reliable and ordered connections with a compressor each
+        explicit MultiplayerDictionaryCompressionFactory(bool streaming);
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        const AZ::Name m_name;
+        const bool m_streaming;
+
+        // The dictionary is shared by all the compressors and reloaded when mp_CompressionDictionary changes
+        AZStd::mutex m_dictionaryMutex;
+        AZ::CVarFixedString m_dictionaryPath;
+        AZStd::shared_ptr<const CompressionDictionary> m_dictionary;
+    };
 }
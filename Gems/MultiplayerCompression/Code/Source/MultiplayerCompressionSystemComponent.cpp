@@ -50,12 +50,20 @@ namespace MultiplayerCompression
     MultiplayerCompressionSystemComponent::MultiplayerCompressionSystemComponent()
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
+        m_dictionaryCompressionFactory = new MultiplayerDictionaryCompressionFactory(false);
+        m_streamCompressionFactory = new MultiplayerDictionaryCompressionFactory(true);
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_dictionaryCompressionFactory);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_streamCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_dictionaryCompressionFactory->GetFactoryName());
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_streamCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
+        delete m_dictionaryCompressionFactory;
+        delete m_streamCompressionFactory;
     }
 }
@@ -41,5 +41,7 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        MultiplayerDictionaryCompressionFactory* m_dictionaryCompressionFactory;
+        MultiplayerDictionaryCompressionFactory* m_streamCompressionFactory;
     };
 }
@@ -10,6 +10,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <LZ4DictionaryCompressor.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/clocks.h>
@@ -126,4 +128,83 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryTest)
+{
+    // Small packets sharing most of their content with the samples the dictionary is built from
+    AZStd::vector<AZStd::vector<uint8_t>> samples;
+    for (uint8_t i = 0; i < 16; ++i)
+    {
+        AZStd::vector<uint8_t> sample(48);
+        for (size_t j = 0; j < sample.size(); ++j)
+        {
+            sample[j] = static_cast<uint8_t>(j * 7);
+        }
+        sample[5] = i;
+        samples.push_back(sample);
+    }
+    auto dictionary = AZStd::make_shared<const MultiplayerCompression::CompressionDictionary>(MultiplayerCompression::CompressionDictionary::Build(samples));
+    EXPECT_NE(dictionary->m_id, 0);
+
+    MultiplayerCompression::LZ4Compressor lz4Compressor;
+    MultiplayerCompression::LZ4DictionaryCompressor dictionaryCompressor(dictionary, false);
+    MultiplayerCompression::LZ4DictionaryCompressor noDictionaryCompressor(nullptr, false);
+    ASSERT_TRUE(dictionaryCompressor.Init());
+    ASSERT_TRUE(noDictionaryCompressor.Init());
+
+    AZStd::vector<uint8_t> packet = samples[3];
+    packet[20] = 255;
+    char compressedBuffer[256];
+    char decompressedBuffer[256];
+    size_t compressedSize = 0;
+    size_t lz4CompressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    EXPECT_EQ(lz4Compressor.Compress(packet.data(), packet.size(), compressedBuffer, sizeof(compressedBuffer), lz4CompressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressedBuffer, sizeof(compressedBuffer), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, lz4CompressedSize);
+
+    ASSERT_EQ(dictionaryCompressor.Decompress(compressedBuffer, compressedSize, decompressedBuffer, sizeof(decompressedBuffer), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, compressedSize);
+    ASSERT_EQ(uncompressedSize, packet.size());
+    EXPECT_EQ(memcmp(decompressedBuffer, packet.data(), packet.size()), 0);
+
+    // Packets compressed with a different dictionary are rejected
+    EXPECT_EQ(noDictionaryCompressor.Decompress(compressedBuffer, compressedSize, decompressedBuffer, sizeof(decompressedBuffer), consumedSize, uncompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_StreamTest)
+{
+    MultiplayerCompression::LZ4DictionaryCompressor sender(nullptr, true);
+    MultiplayerCompression::LZ4DictionaryCompressor receiver(nullptr, true);
+    ASSERT_TRUE(sender.Init());
+    ASSERT_TRUE(receiver.Init());
+
+    // Enough packets to wrap the histories several times, each repeating most of the previous one
+    uint8_t packet[1000];
+    for (size_t i = 0; i < sizeof(packet); ++i)
+    {
+        packet[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    char compressedBuffer[1100];
+    char decompressedBuffer[1000];
+    size_t totalCompressedSize = 0;
+    for (uint32_t i = 0; i < 512; ++i)
+    {
+        packet[i % sizeof(packet)] = static_cast<uint8_t>(i);
+        size_t compressedSize = 0;
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+        ASSERT_EQ(sender.Compress(packet, sizeof(packet), compressedBuffer, sizeof(compressedBuffer), compressedSize), AzNetworking::CompressorError::Ok);
+        totalCompressedSize += compressedSize;
+        ASSERT_EQ(receiver.Decompress(compressedBuffer, compressedSize, decompressedBuffer, sizeof(decompressedBuffer), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+        ASSERT_EQ(uncompressedSize, sizeof(packet));
+        ASSERT_EQ(memcmp(decompressedBuffer, packet, sizeof(packet)), 0);
+    }
+
+    // Each packet mostly references the previous one instead of being compressed on its own
+    EXPECT_LT(totalCompressedSize, 512 * sizeof(packet) / 10);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -7,8 +7,12 @@
 #
 
 set(FILES
+    Source/CompressionDictionary.cpp
+    Source/CompressionDictionary.h
     Source/LZ4Compressor.cpp
     Source/LZ4Compressor.h
+    Source/LZ4DictionaryCompressor.cpp
+    Source/LZ4DictionaryCompressor.h
     Source/MultiplayerCompressionFactory.cpp
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
@@ -10,6 +10,8 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/PackedVector3.h>
 
+#include <AzFramework/Components/CameraBus.h>
+
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
 #include <Atom/RHI/RHIUtils.h>
 
@@ -39,6 +41,18 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    AZ_CVAR(bool, cloth_LodEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Reduces the solver frequency of distant cloths and freezes the ones that are far away or out of the active camera view.");
+
+    AZ_CVAR(float, cloth_LodReducedDistance, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters from the active camera beyond which cloth is simulated at a reduced solver frequency.");
+
+    AZ_CVAR(float, cloth_LodReducedSolverFrequencyScale, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Scale applied to the solver frequency of the cloths beyond cloth_LodReducedDistance.");
+
+    AZ_CVAR(float, cloth_LodFrozenDistance, 40.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters from the active camera beyond which cloth is not simulated.");
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -160,6 +174,7 @@ namespace NvCloth
 
         m_entityId = entityId;
         m_config = config;
+        m_simulationLod = SimulationLod::Full;
 
         if (!CreateCloth())
         {
@@ -177,6 +192,7 @@ namespace NvCloth
             renderData.m_normals = m_meshClothInfo.m_normals;
         }
         UpdateRenderData(m_cloth->GetParticles());
+        m_renderDataChanged = true;
         // Copy the first initialized element to the rest of the buffer
         for (AZ::u32 i = 1; i < RenderDataBufferSize; ++i)
         {
@@ -276,6 +292,7 @@ namespace NvCloth
         m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
 
         UpdateRenderData(updatedParticles);
+        m_renderDataChanged = true;
     }
 
     void ClothComponentMesh::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
@@ -296,7 +313,116 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        CopyRenderDataToModel();
+        // The cloth was simulated earlier this frame, the new lod applies to the next simulation.
+        UpdateSimulationLod();
+
+        // Frozen cloths keep the render data already in the model.
+        if (m_renderDataChanged)
+        {
+            CopyRenderDataToModel();
+        }
+    }
+
+    ClothComponentMesh::SimulationLod ClothComponentMesh::GetSimulationLod() const
+    {
+        return m_simulationLod;
+    }
+
+    void ClothComponentMesh::UpdateSimulationLod()
+    {
+        if (m_simulationLod == SimulationLod::Frozen && m_actorClothSkinning)
+        {
+            // The visibility is otherwise updated before each simulation, which frozen cloths skip.
+            m_actorClothSkinning->UpdateActorVisibility();
+        }
+
+        const SimulationLod simulationLod = CalculateSimulationLod();
+        if (simulationLod == m_simulationLod)
+        {
+            return;
+        }
+
+        const SimulationLod previousSimulationLod = m_simulationLod;
+        m_simulationLod = simulationLod;
+
+        if (simulationLod == SimulationLod::Frozen)
+        {
+            AZ::Interface<IClothSystem>::Get()->RemoveCloth(m_cloth);
+            return;
+        }
+
+        m_cloth->GetClothConfigurator()->SetSolverFrequency(GetLodSolverFrequency());
+
+        if (previousSimulationLod == SimulationLod::Frozen)
+        {
+            AZ::Interface<IClothSystem>::Get()->AddCloth(m_cloth);
+
+            // The entity might have moved while frozen, avoid the sudden impulse and let skinned cloth snap to its current pose.
+            AZ::Transform transform = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(transform, m_entityId, &AZ::TransformInterface::GetWorldTM);
+            TeleportCloth(transform);
+            m_timeClothSkinningUpdates = 0.0f;
+        }
+    }
+
+    ClothComponentMesh::SimulationLod ClothComponentMesh::CalculateSimulationLod() const
+    {
+        if (!cloth_LodEnabled)
+        {
+            return SimulationLod::Full;
+        }
+
+        if (m_actorClothSkinning && !m_actorClothSkinning->IsActorVisible())
+        {
+            return SimulationLod::Frozen;
+        }
+
+        // Without an active camera the cloth is always fully simulated.
+        if (!Camera::ActiveCameraRequestBus::HasHandlers())
+        {
+            return SimulationLod::Full;
+        }
+
+        AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+        Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+        Camera::Configuration cameraConfiguration;
+        Camera::ActiveCameraRequestBus::BroadcastResult(cameraConfiguration, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraConfiguration);
+
+        const AZ::Vector3 toCloth = m_worldPosition - cameraTransform.GetTranslation();
+        const float distance = toCloth.GetLength();
+        const float surfaceDistance = distance - m_worldBoundingRadius;
+        if (surfaceDistance <= 0.0f)
+        {
+            return SimulationLod::Full;
+        }
+
+        if (surfaceDistance > cloth_LodFrozenDistance)
+        {
+            return SimulationLod::Frozen;
+        }
+
+        // Cone around the view direction containing the whole frustum, compared against the angular radius of the cloth.
+        if (cameraConfiguration.m_fovRadians > 0.0f && cameraConfiguration.m_frustumHeight > 0.0f)
+        {
+            const float aspectRatio = cameraConfiguration.m_frustumWidth / cameraConfiguration.m_frustumHeight;
+            const float halfFovTangent = AZStd::tan(0.5f * cameraConfiguration.m_fovRadians);
+            const float frustumHalfAngle = AZStd::atan(halfFovTangent * AZStd::sqrt(1.0f + aspectRatio * aspectRatio));
+            const float clothHalfAngle = AZStd::asin(AZStd::min(m_worldBoundingRadius / distance, 1.0f));
+            const float viewAngle = AZStd::acos(AZ::GetClamp(cameraTransform.GetBasisY().Dot(toCloth) / distance, -1.0f, 1.0f));
+            if (viewAngle > frustumHalfAngle + clothHalfAngle)
+            {
+                return SimulationLod::Frozen;
+            }
+        }
+
+        return (surfaceDistance > cloth_LodReducedDistance) ? SimulationLod::Reduced : SimulationLod::Full;
+    }
+
+    float ClothComponentMesh::GetLodSolverFrequency() const
+    {
+        return (m_simulationLod == SimulationLod::Reduced)
+            ? m_config.m_solverFrequency * AZ::GetClamp(static_cast<float>(cloth_LodReducedSolverFrequencyScale), 0.0f, 1.0f)
+            : m_config.m_solverFrequency;
     }
 
     int ClothComponentMesh::GetTickOrder()
@@ -594,6 +720,8 @@ namespace NvCloth
                 }
             }
         }
+
+        m_renderDataChanged = false;
     }
 
     bool ClothComponentMesh::CreateCloth()
@@ -641,6 +769,12 @@ namespace NvCloth
             return false;
         }
 
+        m_localBoundingRadius = 0.0f;
+        for (const SimParticleFormat& particle : meshSimplifiedParticles)
+        {
+            m_localBoundingRadius = AZStd::max(m_localBoundingRadius, particle.GetAsVector3().GetLength());
+        }
+
         // Set initial Position and Rotation
         AZ::Transform transform = AZ::Transform::CreateIdentity();
         AZ::TransformBus::EventResult(transform, m_entityId, &AZ::TransformInterface::GetWorldTM);
@@ -726,7 +860,7 @@ namespace NvCloth
         clothConfig->SetTetherConstraintScale(m_config.m_tetherConstraintScale);
 
         // Quality parameters
-        clothConfig->SetSolverFrequency(m_config.m_solverFrequency);
+        clothConfig->SetSolverFrequency(GetLodSolverFrequency());
         clothConfig->SetAcceleationFilterWidth(m_config.m_accelerationFilterIterations);
 
         // Fabric Phases
@@ -755,6 +889,7 @@ namespace NvCloth
     void ClothComponentMesh::MoveCloth(const AZ::Transform& worldTransform)
     {
         m_worldPosition = worldTransform.GetTranslation();
+        m_worldBoundingRadius = m_localBoundingRadius * worldTransform.GetUniformScale();
 
         m_cloth->GetClothConfigurator()->SetTransform(worldTransform);
 
@@ -57,6 +57,16 @@ namespace NvCloth
 
         void UpdateConfiguration(AZ::EntityId entityId, const ClothConfiguration& config);
 
+        //! Level of detail of the simulation, chosen every frame from the distance and visibility of the cloth.
+        enum class SimulationLod
+        {
+            Full,       //!< Simulated at the configured solver frequency.
+            Reduced,    //!< Simulated at a fraction of the configured solver frequency.
+            Frozen      //!< Removed from its solver, its render data is left untouched.
+        };
+
+        SimulationLod GetSimulationLod() const;
+
         void CopyRenderDataToModel();
 
     protected:
@@ -84,6 +94,9 @@ namespace NvCloth
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
         void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles);
+        void UpdateSimulationLod();
+        SimulationLod CalculateSimulationLod() const;
+        float GetLodSolverFrequency() const;
 
         bool CreateCloth();
         void ApplyConfigurationToCloth();
@@ -98,6 +111,15 @@ namespace NvCloth
         // Current position in world space
         AZ::Vector3 m_worldPosition;
 
+        // Radius of the sphere around the entity position bounding the cloth particles, in local and world space
+        float m_localBoundingRadius = 0.0f;
+        float m_worldBoundingRadius = 0.0f;
+
+        SimulationLod m_simulationLod = SimulationLod::Full;
+
+        // Whether the render data changed since it was last copied to the model
+        bool m_renderDataChanged = false;
+
         // Configuration parameters for cloth simulation
         ClothConfiguration m_config;
 
@@ -405,11 +405,19 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
+        // Start all the solvers before waiting for any of them, so their simulation jobs run in parallel.
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
+            }
+        }
+
+        for (auto& solverIt : m_solvers)
+        {
+            if (!solverIt->IsUserSimulated())
+            {
                 solverIt->FinishSimulation();
             }
         }
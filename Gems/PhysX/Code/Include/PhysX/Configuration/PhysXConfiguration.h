@@ -51,6 +51,17 @@ namespace PhysX
 
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
 
+        //! Starts the simulation of every enabled scene before waiting for any of them, so independent scenes are stepped
+        //! concurrently on the job threads rather than one after another.
+        bool m_simulateScenesConcurrently = false;
+
+        //! Leaves the last simulation step of each frame running on the job threads when PhysXSystem::Simulate returns, so the
+        //! main thread can keep doing gameplay work while the scenes simulate. The results are fetched by the next call to
+        //! PhysXSystem::FinishPendingSimulation, which the next Simulate call does first.
+        //! Gameplay code reads the results of the previous step until then, and changes made to the scenes meanwhile are applied
+        //! once the results are fetched.
+        bool m_deferSimulationResults = false;
+
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
     };
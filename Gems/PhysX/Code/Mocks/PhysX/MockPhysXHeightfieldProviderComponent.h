@@ -60,6 +60,7 @@ namespace UnitTest
         }
 
         MOCK_CONST_METHOD0(GetHeightsAndMaterials, AZStd::vector<Physics::HeightMaterialPoint>());
+        MOCK_CONST_METHOD4(GetHeightsAndMaterialsInRegion, AZStd::vector<Physics::HeightMaterialPoint>(int32_t, int32_t, int32_t, int32_t));
         MOCK_CONST_METHOD0(GetHeightfieldGridSpacing, AZ::Vector2());
         MOCK_CONST_METHOD2(GetHeightfieldGridSize, void(int32_t&, int32_t&));
         MOCK_CONST_METHOD2(GetHeightfieldHeightBounds, void(float&, float&));
@@ -92,6 +92,8 @@ namespace PhysX
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
                 ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("SimulateScenesConcurrently", &PhysXSystemConfiguration::m_simulateScenesConcurrently)
+                ->Field("DeferSimulationResults", &PhysXSystemConfiguration::m_deferSimulationResults)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -100,6 +102,12 @@ namespace PhysX
                 editContext->Class<PhysX::PhysXSystemConfiguration>("System Configuration", "PhysX system configuration")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &PhysXSystemConfiguration::m_simulateScenesConcurrently,
+                        "Simulate Scenes Concurrently", "Step all enabled scenes at the same time instead of one after another")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &PhysXSystemConfiguration::m_deferSimulationResults,
+                        "Defer Simulation Results",
+                        "Keep the last simulation step of each frame running while the rest of the frame is processed, "
+                        "and fetch its results at the next physics update")
                     ;
             }
         }
@@ -115,7 +123,9 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_simulateScenesConcurrently == other.m_simulateScenesConcurrently &&
+            m_deferSimulationResults == other.m_deferSimulationResults
             ;
     }
 
@@ -153,8 +153,15 @@ namespace PhysX
             { AZStd::make_shared<Physics::ColliderConfiguration>(m_colliderConfig), m_shapeConfig });
     }
 
-    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
+        // Terrain edits usually touch a small area, so try to refresh that area of the existing heightfield first.
+        if (Utils::RefreshHeightfieldRegion(GetEntityId(), *m_shapeConfig, GetSimulatedBody(), dirtyRegion))
+        {
+            Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+            return;
+        }
+
         RefreshHeightfield();
     }
 
@@ -86,8 +86,16 @@ namespace PhysX
         ClearHeightfield();
     }
 
-    void HeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void HeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
+        // Runtime deformations usually touch a small area, so try to refresh that area of the existing heightfield first.
+        Physics::HeightfieldShapeConfiguration& configuration = static_cast<Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+        if (Utils::RefreshHeightfieldRegion(GetEntityId(), configuration, GetSimulatedBody(), dirtyRegion))
+        {
+            Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+            return;
+        }
+
         RefreshHeightfield();
     }
 
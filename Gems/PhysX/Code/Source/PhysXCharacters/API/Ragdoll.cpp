@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -19,6 +20,11 @@
 #include <PhysX/MathConversion.h>
 #include <Scene/PhysXScene.h>
 
+AZ_CVAR(AZ::u32, physx_ragdollLodReducedPositionIterations, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of solver position iterations of the ragdolls below the full LOD tier.");
+AZ_CVAR(AZ::u32, physx_ragdollLodReducedVelocityIterations, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of solver velocity iterations of the ragdolls below the full LOD tier.");
+
 namespace PhysX
 {
     namespace Internal
@@ -34,6 +40,15 @@ namespace PhysX
             }
             return nullptr;
         }
+
+        PhysXScene* GetPhysXScene(AzPhysics::SceneHandle sceneHandle)
+        {
+            if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+            {
+                return azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(sceneHandle));
+            }
+            return nullptr;
+        }
     } // namespace Internal
 
     void Ragdoll::Reflect(AZ::ReflectContext* context)
@@ -116,6 +131,12 @@ namespace PhysX
     {
         m_sceneStartSimHandler.Disconnect();
 
+        if (m_lod)
+        {
+            m_lod->Unregister(*this);
+            m_lod = nullptr;
+        }
+
         m_nodes.clear(); //the nodes destructor will remove the simulated body from the scene.
     }
 
@@ -213,6 +234,12 @@ namespace PhysX
         }
 
         sceneInterface->EnableSimulationOfBody(m_sceneOwner, m_bodyHandle);
+
+        m_lod = GetSceneRagdollLod();
+        if (m_lod)
+        {
+            m_lod->Register(*this);
+        }
     }
 
     void Ragdoll::EnableSimulationQueued(const Physics::RagdollState& initialState)
@@ -243,6 +270,14 @@ namespace PhysX
 
         PHYSX_SCENE_WRITE_LOCK(pxScene);
 
+        if (m_lod)
+        {
+            m_lod->Unregister(*this);
+            m_lod = nullptr;
+        }
+        // The next simulation starts at full fidelity.
+        SetLodLevel(RagdollLodLevel::Full);
+
         for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
         {
             sceneInterface->DisableSimulationOfBody(m_sceneOwner, m_nodes[nodeIndex]->GetRigidBodyHandle());
@@ -291,6 +326,12 @@ namespace PhysX
             return;
         }
 
+        // New drive targets would wake the ragdoll up, keep it asleep while nobody looks at it closely.
+        if (m_lodLevel == RagdollLodLevel::Frozen && IsSleeping())
+        {
+            return;
+        }
+
         const size_t numNodes = m_nodes.size();
         for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
         {
@@ -343,7 +384,8 @@ namespace PhysX
 
         PHYSX_SCENE_WRITE_LOCK(actor->getScene());
 
-        if (nodeState.m_simulationType == Physics::SimulationType::Kinematic)
+        // At the kinematic LOD tier, all the nodes follow the poses they are given.
+        if (nodeState.m_simulationType == Physics::SimulationType::Kinematic || m_lodLevel == RagdollLodLevel::Kinematic)
         {
             actor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
             actor->setKinematicTarget(physx::PxTransform(
@@ -388,6 +430,114 @@ namespace PhysX
         return m_nodes.size();
     }
 
+    void Ragdoll::SetVisible(bool visible)
+    {
+        m_visible = visible;
+    }
+
+    bool Ragdoll::IsVisible() const
+    {
+        return m_visible;
+    }
+
+    SceneRagdollLod* Ragdoll::GetSceneRagdollLod() const
+    {
+        PhysXScene* scene = Internal::GetPhysXScene(m_sceneOwner);
+        return scene ? &scene->GetRagdollLod() : nullptr;
+    }
+
+    void Ragdoll::SetLodLevel(RagdollLodLevel level)
+    {
+        if (level == m_lodLevel || m_nodes.empty())
+        {
+            return;
+        }
+
+        physx::PxScene* pxScene = Internal::GetPxScene(m_sceneOwner);
+        PHYSX_SCENE_WRITE_LOCK(pxScene);
+
+        if (m_lodLevel == RagdollLodLevel::Full)
+        {
+            if (const physx::PxRigidDynamic* rootActor = GetPxRigidDynamic(0))
+            {
+                physx::PxU32 positionIterations = 0;
+                physx::PxU32 velocityIterations = 0;
+                rootActor->getSolverIterationCounts(positionIterations, velocityIterations);
+                m_fullPositionIterations = positionIterations;
+                m_fullVelocityIterations = velocityIterations;
+                m_fullCcdEnabled = rootActor->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eENABLE_CCD);
+            }
+        }
+
+        const AZ::u32 positionIterations = level == RagdollLodLevel::Full
+            ? m_fullPositionIterations
+            : AZStd::max(AZStd::min<AZ::u32>(m_fullPositionIterations, physx_ragdollLodReducedPositionIterations), 1u);
+        const AZ::u32 velocityIterations = level == RagdollLodLevel::Full
+            ? m_fullVelocityIterations
+            : AZStd::min<AZ::u32>(m_fullVelocityIterations, physx_ragdollLodReducedVelocityIterations);
+
+        for (size_t nodeIndex = 0; nodeIndex < m_nodes.size(); nodeIndex++)
+        {
+            physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex);
+            if (!pxActor)
+            {
+                continue;
+            }
+
+            pxActor->setSolverIterationCounts(positionIterations, velocityIterations);
+
+            // CCD is not supported on kinematic actors, so it is turned off before and back on after the kinematic flag.
+            if (level != RagdollLodLevel::Full)
+            {
+                pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eENABLE_CCD, false);
+            }
+            if (level == RagdollLodLevel::Kinematic)
+            {
+                pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
+            }
+            else if (m_lodLevel == RagdollLodLevel::Kinematic)
+            {
+                // The nodes meant to be kinematic are made kinematic again by the next state, which a sleeping
+                // frozen ragdoll would skip.
+                pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, false);
+                if (pxActor->getScene())
+                {
+                    pxActor->wakeUp();
+                }
+            }
+            if (level == RagdollLodLevel::Full && m_fullCcdEnabled)
+            {
+                pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eENABLE_CCD, true);
+            }
+        }
+
+        m_lodLevel = level;
+    }
+
+    RagdollLodLevel Ragdoll::GetLodLevel() const
+    {
+        return m_lodLevel;
+    }
+
+    bool Ragdoll::IsSleeping() const
+    {
+        for (size_t nodeIndex = 0; nodeIndex < m_nodes.size(); nodeIndex++)
+        {
+            const physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex);
+            if (!pxActor || !pxActor->getScene())
+            {
+                continue;
+            }
+
+            PHYSX_SCENE_READ_LOCK(pxActor->getScene());
+            if (!pxActor->isSleeping())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     AZ::EntityId Ragdoll::GetEntityId() const
     {
         AZ_Warning("PhysX Ragdoll", false, "Not yet supported.");
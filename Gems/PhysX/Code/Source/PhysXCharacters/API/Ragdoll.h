@@ -13,6 +13,7 @@
 #include <AzFramework/Physics/Ragdoll.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <PhysXCharacters/API/RagdollNode.h>
+#include <Scene/PhysXSceneRagdollLod.h>
 
 namespace PhysX
 {
@@ -38,6 +39,15 @@ namespace PhysX
         physx::PxRigidDynamic* GetPxRigidDynamic(size_t nodeIndex) const;
         physx::PxTransform GetRootPxTransform() const;
 
+        //! Sets the fidelity of the simulation, picked by the SceneRagdollLod of the scene while the ragdoll is simulated.
+        void SetLodLevel(RagdollLodLevel level);
+        RagdollLodLevel GetLodLevel() const;
+
+        bool IsVisible() const;
+
+        //! Returns true if all the nodes of the ragdoll are asleep.
+        bool IsSleeping() const;
+
         // Physics::Ragdoll
         void EnableSimulation(const Physics::RagdollState& initialState) override;
         void EnableSimulationQueued(const Physics::RagdollState& initialState) override;
@@ -51,6 +61,7 @@ namespace PhysX
         void SetNodeState(size_t nodeIndex, const Physics::RagdollNodeState& nodeState) override;
         Physics::RagdollNode* GetNode(size_t nodeIndex) const override;
         size_t GetNumNodes() const override;
+        void SetVisible(bool visible) override;
 
         // AzPhysics::SimulatedBody
         AZ::EntityId GetEntityId() const override;
@@ -68,6 +79,7 @@ namespace PhysX
         void ApplyQueuedEnableSimulation();
         void ApplyQueuedSetState();
         void ApplyQueuedDisableSimulation();
+        SceneRagdollLod* GetSceneRagdollLod() const;
 
         AZStd::vector<AZStd::unique_ptr<RagdollNode>> m_nodes;
         Physics::ParentIndices m_parentIndices;
@@ -81,5 +93,13 @@ namespace PhysX
         bool m_queuedDisableSimulation = false;
 
         AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneStartSimHandler;
+
+        SceneRagdollLod* m_lod = nullptr; //!< LOD of the scene the ragdoll is registered to while simulated.
+        RagdollLodLevel m_lodLevel = RagdollLodLevel::Full;
+        bool m_visible = true;
+        /// Solver iterations and CCD of the full simulation, saved when leaving the full tier.
+        AZ::u32 m_fullPositionIterations = 0;
+        AZ::u32 m_fullVelocityIterations = 0;
+        bool m_fullCcdEnabled = false;
     };
 } // namespace PhysX
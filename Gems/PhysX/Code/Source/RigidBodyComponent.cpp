@@ -19,6 +19,13 @@
 #include <Source/RigidBodyComponent.h>
 #include <Source/Shape.h>
 #include <Source/RigidBody.h>
+#include <Scene/PhysXScene.h>
+#include <Scene/PhysXSceneTransformSync.h>
+#include <System/PhysXSystem.h>
+#include <AzCore/Console/IConsole.h>
+
+AZ_CVAR(bool, physx_sceneTransformSync, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Write the poses of the rigid bodies without motion interpolation to their entities in one batch per scene after each simulation step (read when the rigid body is created)");
 
 namespace PhysX
 {
@@ -184,6 +191,14 @@ namespace PhysX
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
         m_sceneFinishSimHandler.Disconnect();
+        if (m_usesSceneTransformSync)
+        {
+            if (SceneTransformSync* transformSync = GetSceneTransformSync())
+            {
+                transformSync->Unregister(*this);
+            }
+            m_usesSceneTransformSync = false;
+        }
         AZ::TickBus::Handler::BusDisconnect();
     }
 
@@ -223,7 +238,7 @@ namespace PhysX
         //    User sets kinematic Target ---> Update transform
         //    User sets transform        ---> Update kinematic target
 
-        if (!IsPhysicsEnabled() || (IsKinematic() && !m_isLastMovementFromKinematicSource))
+        if (!NeedsTransformSync())
         {
             return;
         }
@@ -256,6 +271,28 @@ namespace PhysX
         m_isLastMovementFromKinematicSource = false;
     }
 
+    bool RigidBodyComponent::NeedsTransformSync() const
+    {
+        return IsPhysicsEnabled() && (!IsKinematic() || m_isLastMovementFromKinematicSource);
+    }
+
+    void RigidBodyComponent::OnTransformSynced()
+    {
+        m_isLastMovementFromKinematicSource = false;
+    }
+
+    SceneTransformSync* RigidBodyComponent::GetSceneTransformSync() const
+    {
+        if (auto* physXSystem = GetPhysXSystem())
+        {
+            if (auto* scene = azdynamic_cast<PhysXScene*>(physXSystem->GetScene(m_attachedSceneHandle)))
+            {
+                return &scene->GetTransformSync();
+            }
+        }
+        return nullptr;
+    }
+
     void RigidBodyComponent::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
     {
         // Note: OnTransformChanged is not safe at the moment due to TransformComponent design flaw.
@@ -299,7 +336,16 @@ namespace PhysX
         }
 
         // Listen to the PhysX system for events concerning this entity.
-        if (sceneInterface != nullptr)
+        // Interpolated bodies keep their own handler, they only record the pose and move the entity on tick.
+        if (physx_sceneTransformSync && !m_configuration.m_interpolateMotion)
+        {
+            if (SceneTransformSync* transformSync = GetSceneTransformSync())
+            {
+                transformSync->Register(*this);
+                m_usesSceneTransformSync = true;
+            }
+        }
+        if (sceneInterface != nullptr && !m_usesSceneTransformSync)
         {
             sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
         }
@@ -26,6 +26,7 @@ namespace AzPhysics
 namespace PhysX
 {
     class TransformForwardTimeInterpolator;
+    class SceneTransformSync;
 
     /// Component used to register an entity as a dynamic rigid body in the PhysX simulation.
     class RigidBodyComponent
@@ -144,11 +145,19 @@ namespace PhysX
         void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
 
     private:
+        friend class SceneTransformSync;
+
         void SetupConfiguration();
         void CreatePhysics();
         void InitPhysicsTickHandler();
         void PostPhysicsTick(float fixedDeltaTime);
 
+        //! Returns true if the pose of the rigid body must be written to the entity after a simulation step.
+        bool NeedsTransformSync() const;
+        //! Called once the pose of the rigid body was written to the entity.
+        void OnTransformSynced();
+        SceneTransformSync* GetSceneTransformSync() const;
+
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
         std::unique_ptr<TransformForwardTimeInterpolator> m_interpolator;
@@ -160,6 +169,7 @@ namespace PhysX
         bool m_staticTransformAtActivation = false; ///< Whether the transform was static when the component last activated.
         bool m_isLastMovementFromKinematicSource = false; ///< True when the source of the movement comes from SetKinematicTarget as opposed to coming from a Transform change
         bool m_rigidBodyTransformNeedsUpdateOnPhysReEnable = false; ///< True if rigid body transform needs to be synced to the entity's when physics is re-enabled
+        bool m_usesSceneTransformSync = false; ///< True when the scene writes the pose of the rigid body to the entity instead of PostPhysicsTick
 
         AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
     };
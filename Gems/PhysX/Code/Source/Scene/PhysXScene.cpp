@@ -538,6 +538,9 @@ namespace PhysX
             return;
         }
 
+        // Before the queued ragdoll states are applied, so they are applied at the new tiers.
+        m_ragdollLod.Update();
+
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationStartEvent::Signaled");
             m_sceneSimuationStartEvent.Signal(m_sceneHandle, deltatime);
@@ -588,6 +591,7 @@ namespace PhysX
 
             physx::PxU32 numActiveActors = 0;
             physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
+            const bool syncTransforms = !m_transformSync.IsEmpty();
             AzPhysics::SimulatedBodyHandleList activeBodyHandles;
             activeBodyHandles.reserve(numActiveActors);
             for (physx::PxU32 i = 0; i < numActiveActors; ++i)
@@ -595,14 +599,37 @@ namespace PhysX
                 if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
                 {
                     activeBodyHandles.emplace_back(actorData->GetBodyHandle());
+
+                    if (syncTransforms)
+                    {
+                        if (const auto* rigidActor = activeActors[i]->is<physx::PxRigidActor>())
+                        {
+                            m_transformSync.AddActivePose(actorData->GetEntityId(), rigidActor->getGlobalPose());
+                        }
+                    }
                 }
             }
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
+
+            InvalidateQueryCache(activeActors, numActiveActors);
+        }
+        else
+        {
+            if (!m_transformSync.IsEmpty())
+            {
+                m_transformSync.AddAllPoses();
+            }
+
+            // Without the active actors, nothing tells which cached results are still valid.
+            m_queryCache.Clear();
         }
 
         FlushQueuedEvents();
         ClearDeferedDeletions();
 
+        // Written right before the event the rigid body components would otherwise write their own pose from.
+        m_transformSync.Apply();
+
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
             m_sceneSimuationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
@@ -611,6 +638,36 @@ namespace PhysX
         UpdateAzProfilerDataPoints();
     }
 
+    void PhysXScene::InvalidateQueryCache(physx::PxActor** activeActors, physx::PxU32 numActiveActors)
+    {
+        if (m_queryCache.IsEmpty())
+        {
+            return;
+        }
+
+        // Testing every cached result against many actors costs more than casting again.
+        constexpr physx::PxU32 MaxMovedBounds = 256;
+        if (numActiveActors > MaxMovedBounds)
+        {
+            m_queryCache.Clear();
+            return;
+        }
+
+        m_movedBounds.clear();
+        for (physx::PxU32 i = 0; i < numActiveActors; ++i)
+        {
+            // The bounds at the start of the step are approximated from the velocity, to cover the region the actor left.
+            AZ::Aabb bounds = PxMathConvert(activeActors[i]->getWorldBounds());
+            if (const auto* rigidBody = activeActors[i]->is<physx::PxRigidBody>())
+            {
+                const AZ::Vector3 displacement = PxMathConvert(rigidBody->getLinearVelocity()) * m_currentDeltaTime;
+                bounds.AddAabb(bounds.GetTranslated(-displacement));
+            }
+            m_movedBounds.push_back(bounds);
+        }
+        m_queryCache.Invalidate(m_movedBounds);
+    }
+
     void PhysXScene::FlushQueuedEvents()
     {
         //send queued trigger events
@@ -923,6 +980,21 @@ namespace PhysX
             return {}; //return 0 hits
         }
 
+        if (SceneQueryCache::IsCacheable(*request))
+        {
+            AzPhysics::SceneQueryHits hits;
+            if (!m_queryCache.Find(*request, hits))
+            {
+                hits = QuerySceneUncached(request);
+                m_queryCache.Store(*request, hits);
+            }
+            return hits;
+        }
+        return QuerySceneUncached(request);
+    }
+
+    AzPhysics::SceneQueryHits PhysXScene::QuerySceneUncached(const AzPhysics::SceneQueryRequest* request)
+    {
         // Query flags.
         const physx::PxQueryFlags queryFlags = SceneQueryHelpers::GetPxQueryFlags(request->m_queryType);
         const physx::PxQueryFilterData queryData(queryFlags);
@@ -1029,6 +1101,7 @@ namespace PhysX
                 PHYSX_SCENE_WRITE_LOCK(m_pxScene);
                 m_pxScene->addActor(*pxActor);
             }
+            m_queryCache.Clear();
 
             if (azrtti_istypeof<PhysX::RigidBody>(body))
             {
@@ -1056,6 +1129,7 @@ namespace PhysX
                 PHYSX_SCENE_WRITE_LOCK(m_pxScene);
                 m_pxScene->removeActor(*pxActor);
             }
+            m_queryCache.Clear();
         }
         body.m_simulating = false;
     }
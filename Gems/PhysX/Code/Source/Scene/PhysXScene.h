@@ -15,6 +15,9 @@
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
+#include <Scene/PhysXSceneQueryCache.h>
+#include <Scene/PhysXSceneRagdollLod.h>
+#include <Scene/PhysXSceneTransformSync.h>
 
 namespace physx
 {
@@ -79,6 +82,15 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Returns the batch writing the poses of the rigid bodies back to their entities after each simulation step.
+        SceneTransformSync& GetTransformSync() { return m_transformSync; }
+
+        //! Returns the results of the casts allowing cached results, to invalidate them when static geometry changes.
+        SceneQueryCache& GetQueryCache() { return m_queryCache; }
+
+        //! Returns the tiers of the simulated ragdolls, picked before each simulation step.
+        SceneRagdollLod& GetRagdollLod() { return m_ragdollLod; }
+
     private:
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
@@ -90,6 +102,10 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        AzPhysics::SceneQueryHits QuerySceneUncached(const AzPhysics::SceneQueryRequest* request);
+        //! Drops the cached cast results made stale by the active actors of the last simulation step.
+        void InvalidateQueryCache(physx::PxActor** activeActors, physx::PxU32 numActiveActors);
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -114,6 +130,10 @@ namespace PhysX
 
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
+        SceneTransformSync m_transformSync; //!< Writes the poses of the registered rigid bodies to their entities.
+        SceneQueryCache m_queryCache; //!< Results of the casts allowing cached results.
+        SceneRagdollLod m_ragdollLod; //!< Fidelity tiers of the simulated ragdolls.
+        AZStd::vector<AZ::Aabb> m_movedBounds; //!< Bounds swept by the active actors during the last simulation step.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
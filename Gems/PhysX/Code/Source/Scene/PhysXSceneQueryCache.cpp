@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneQueryCache.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+AZ_CVAR(uint32_t, physx_sceneQueryCacheMaxEntries, 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of cast results kept per scene for the scene queries allowing cached results");
+AZ_CVAR(float, physx_sceneQueryCacheCellSize, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Size in meters of the cells the start, distance and shape dimensions of the cached casts are quantized to");
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        //! Steps the directions and rotations of the cached casts are quantized to.
+        static constexpr float DirectionSteps = 512.0f;
+
+        AZ::s32 Quantize(float value, float step)
+        {
+            return static_cast<AZ::s32>(AZStd::floor(value / step + 0.5f));
+        }
+
+        void QuantizeVector(const AZ::Vector3& vector, float step, AZ::s32* quantized)
+        {
+            quantized[0] = Quantize(vector.GetX(), step);
+            quantized[1] = Quantize(vector.GetY(), step);
+            quantized[2] = Quantize(vector.GetZ(), step);
+        }
+    } // namespace Internal
+
+    bool SceneQueryCache::Key::operator==(const Key& other) const
+    {
+        return m_quantized == other.m_quantized && m_collisionMask == other.m_collisionMask && m_maxResults == other.m_maxResults &&
+            m_flags == other.m_flags;
+    }
+
+    size_t SceneQueryCache::KeyHash::operator()(const Key& key) const
+    {
+        size_t hash = 0;
+        for (AZ::s32 value : key.m_quantized)
+        {
+            AZStd::hash_combine(hash, value);
+        }
+        AZStd::hash_combine(hash, key.m_collisionMask);
+        AZStd::hash_combine(hash, key.m_maxResults);
+        AZStd::hash_combine(hash, key.m_flags);
+        return hash;
+    }
+
+    bool SceneQueryCache::IsCacheable(const AzPhysics::SceneQueryRequest& request)
+    {
+        if (const auto* rayCast = azrtti_cast<const AzPhysics::RayCastRequest*>(&request))
+        {
+            return rayCast->m_allowCachedResults && !rayCast->m_filterCallback;
+        }
+        if (const auto* shapeCast = azrtti_cast<const AzPhysics::ShapeCastRequest*>(&request))
+        {
+            if (!shapeCast->m_allowCachedResults || shapeCast->m_filterCallback || !shapeCast->m_shapeConfiguration)
+            {
+                return false;
+            }
+            const Physics::ShapeType shapeType = shapeCast->m_shapeConfiguration->GetShapeType();
+            return shapeType == Physics::ShapeType::Sphere || shapeType == Physics::ShapeType::Box ||
+                shapeType == Physics::ShapeType::Capsule;
+        }
+        return false;
+    }
+
+    bool SceneQueryCache::MakeKey(const AzPhysics::SceneQueryRequest& request, Key& key, AZ::Aabb& region)
+    {
+        const float cellSize = AZStd::max(static_cast<float>(physx_sceneQueryCacheCellSize), 0.001f);
+        const float directionStep = 1.0f / Internal::DirectionSteps;
+
+        key.m_collisionMask = request.m_collisionGroup.GetMask();
+        key.m_maxResults = request.m_maxResults;
+        key.m_flags = static_cast<AZ::u32>(request.m_queryType);
+
+        if (const auto* rayCast = azrtti_cast<const AzPhysics::RayCastRequest*>(&request))
+        {
+            Internal::QuantizeVector(rayCast->m_start, cellSize, &key.m_quantized[0]);
+            Internal::QuantizeVector(rayCast->m_direction, directionStep, &key.m_quantized[3]);
+            key.m_quantized[6] = Internal::Quantize(rayCast->m_distance, cellSize);
+            key.m_flags |= static_cast<AZ::u32>(rayCast->m_hitFlags) << 8;
+            key.m_flags |= (rayCast->m_reportMultipleHits ? 1u : 0u) << 24;
+
+            const AZ::Vector3 end = rayCast->m_start + rayCast->m_direction * rayCast->m_distance;
+            region = AZ::Aabb::CreateFromPoint(rayCast->m_start);
+            region.AddPoint(end);
+            // Covers the rays quantized to this one.
+            region.Expand(AZ::Vector3(cellSize));
+            return true;
+        }
+
+        const auto* shapeCast = azrtti_cast<const AzPhysics::ShapeCastRequest*>(&request);
+        if (shapeCast == nullptr || !shapeCast->m_shapeConfiguration)
+        {
+            return false;
+        }
+
+        const Physics::ShapeConfiguration& shapeConfiguration = *shapeCast->m_shapeConfiguration;
+        const AZ::Quaternion rotation = shapeCast->m_start.GetRotation();
+        Internal::QuantizeVector(shapeCast->m_start.GetTranslation(), cellSize, &key.m_quantized[0]);
+        Internal::QuantizeVector(shapeCast->m_direction, directionStep, &key.m_quantized[3]);
+        key.m_quantized[6] = Internal::Quantize(shapeCast->m_distance, cellSize);
+        Internal::QuantizeVector(rotation.GetImaginary(), directionStep, &key.m_quantized[7]);
+        key.m_quantized[10] = Internal::Quantize(rotation.GetW(), directionStep);
+        key.m_flags |= static_cast<AZ::u32>(shapeCast->m_hitFlags) << 8;
+        key.m_flags |= (shapeCast->m_reportMultipleHits ? 1u : 0u) << 24;
+        key.m_flags |= static_cast<AZ::u32>(shapeConfiguration.GetShapeType()) << 25;
+
+        float boundingRadius = 0.0f;
+        AZ::Vector3 dimensions = AZ::Vector3::CreateZero();
+        switch (shapeConfiguration.GetShapeType())
+        {
+        case Physics::ShapeType::Sphere:
+            {
+                const auto& sphere = static_cast<const Physics::SphereShapeConfiguration&>(shapeConfiguration);
+                dimensions.SetX(sphere.m_radius);
+                boundingRadius = sphere.m_radius;
+                break;
+            }
+        case Physics::ShapeType::Box:
+            {
+                const auto& box = static_cast<const Physics::BoxShapeConfiguration&>(shapeConfiguration);
+                dimensions = box.m_dimensions;
+                boundingRadius = 0.5f * box.m_dimensions.GetLength();
+                break;
+            }
+        case Physics::ShapeType::Capsule:
+            {
+                const auto& capsule = static_cast<const Physics::CapsuleShapeConfiguration&>(shapeConfiguration);
+                dimensions.Set(capsule.m_radius, capsule.m_height, 0.0f);
+                boundingRadius = 0.5f * capsule.m_height;
+                break;
+            }
+        default:
+            return false;
+        }
+        dimensions *= shapeConfiguration.m_scale;
+        boundingRadius *= shapeConfiguration.m_scale.GetMaxElement();
+        Internal::QuantizeVector(dimensions, cellSize, &key.m_quantized[11]);
+
+        const AZ::Vector3 start = shapeCast->m_start.GetTranslation();
+        region = AZ::Aabb::CreateFromPoint(start);
+        region.AddPoint(start + shapeCast->m_direction * shapeCast->m_distance);
+        region.Expand(AZ::Vector3(boundingRadius + cellSize));
+        return true;
+    }
+
+    bool SceneQueryCache::Find(const AzPhysics::SceneQueryRequest& request, AzPhysics::SceneQueryHits& hits)
+    {
+        Key key;
+        AZ::Aabb region;
+        if (!MakeKey(request, key, region))
+        {
+            return false;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+        {
+            return false;
+        }
+        it->second.m_used = true;
+        hits = it->second.m_hits;
+        return true;
+    }
+
+    void SceneQueryCache::Store(const AzPhysics::SceneQueryRequest& request, const AzPhysics::SceneQueryHits& hits)
+    {
+        Key key;
+        AZ::Aabb region;
+        if (!MakeKey(request, key, region))
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_entries.size() >= physx_sceneQueryCacheMaxEntries)
+        {
+            return;
+        }
+        Entry& entry = m_entries[key];
+        entry.m_hits = hits;
+        entry.m_region = region;
+        entry.m_used = true;
+    }
+
+    void SceneQueryCache::Invalidate(AZStd::span<const AZ::Aabb> movedBounds)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            Entry& entry = it->second;
+            bool keep = entry.m_used;
+            for (size_t boundsIndex = 0; keep && boundsIndex < movedBounds.size(); ++boundsIndex)
+            {
+                keep = !entry.m_region.Overlaps(movedBounds[boundsIndex]);
+            }
+
+            if (keep)
+            {
+                entry.m_used = false;
+                ++it;
+            }
+            else
+            {
+                it = m_entries.erase(it);
+            }
+        }
+    }
+
+    void SceneQueryCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+    bool SceneQueryCache::IsEmpty()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_entries.empty();
+    }
+} // namespace PhysX
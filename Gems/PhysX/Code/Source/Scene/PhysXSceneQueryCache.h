@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+
+namespace PhysX
+{
+    //! Hits of the ray casts and shape casts of a scene opting into cached results, reused by the next matching casts.
+    //! Casts match when their start, direction, distance and shape are the same once quantized, and they share the collision
+    //! group, query type, flags and maximum number of results.
+    //! A result is dropped when the bounds of a simulated body moving during a simulation step overlap the region swept by its
+    //! cast, when it wasn't used during a whole step, and when bodies are added to or removed from the scene.
+    class SceneQueryCache
+    {
+    public:
+        //! Returns true if the request opted into cached results and can be cached.
+        static bool IsCacheable(const AzPhysics::SceneQueryRequest& request);
+
+        //! Returns true and copies the hits if the result of a matching cast is cached.
+        bool Find(const AzPhysics::SceneQueryRequest& request, AzPhysics::SceneQueryHits& hits);
+
+        //! Stores the hits of a cast, ignored when the cache is full.
+        void Store(const AzPhysics::SceneQueryRequest& request, const AzPhysics::SceneQueryHits& hits);
+
+        //! Drops the results swept regions overlapping one of the moved bounds, and the results not used since the last call.
+        void Invalidate(AZStd::span<const AZ::Aabb> movedBounds);
+
+        void Clear();
+        bool IsEmpty();
+
+    private:
+        struct Key
+        {
+            //! Quantized start, direction, distance, rotation and shape dimensions of the cast.
+            AZStd::array<AZ::s32, 14> m_quantized = {};
+            AZ::u64 m_collisionMask = 0;
+            AZ::u64 m_maxResults = 0;
+            AZ::u32 m_flags = 0;
+
+            bool operator==(const Key& other) const;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const;
+        };
+
+        struct Entry
+        {
+            AzPhysics::SceneQueryHits m_hits;
+            AZ::Aabb m_region; //!< Region swept by the cast.
+            bool m_used = true; //!< True if the entry was used since the last invalidation.
+        };
+
+        static bool MakeKey(const AzPhysics::SceneQueryRequest& request, Key& key, AZ::Aabb& region);
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<Key, Entry, KeyHash> m_entries;
+    };
+} // namespace PhysX
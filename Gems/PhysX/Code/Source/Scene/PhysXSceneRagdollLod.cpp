@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneRagdollLod.h>
+#include <PhysXCharacters/API/Ragdoll.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Components/CameraBus.h>
+
+AZ_CVAR(bool, physx_ragdollLod, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Lowers the simulation fidelity of the ragdolls far from the camera or hidden.");
+AZ_CVAR(float, physx_ragdollLodReducedDistance, 15.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Distance from the camera beyond which ragdolls are simulated with fewer solver iterations and no CCD.");
+AZ_CVAR(float, physx_ragdollLodFrozenDistance, 30.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Distance from the camera beyond which ragdolls are kept asleep once they fell asleep.");
+AZ_CVAR(float, physx_ragdollLodKinematicDistance, 60.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Distance from the camera beyond which ragdolls are no longer simulated and follow their pose kinematically.");
+AZ_CVAR(AZ::u32, physx_ragdollLodMaxSimulated, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of ragdolls simulated at once, the others being made kinematic, 0 for no limit.");
+
+namespace PhysX
+{
+    namespace RagdollLodInternal
+    {
+        //! Fraction of the distance thresholds a ragdoll has to come back by to return to a higher tier,
+        //! so ragdolls standing around a threshold don't switch tiers every frame.
+        constexpr float Hysteresis = 0.1f;
+
+        RagdollLodLevel PickLevel(float distance, RagdollLodLevel currentLevel)
+        {
+            const float thresholds[] = {
+                physx_ragdollLodReducedDistance, physx_ragdollLodFrozenDistance, physx_ragdollLodKinematicDistance };
+
+            RagdollLodLevel level = RagdollLodLevel::Full;
+            for (size_t thresholdIndex = 0; thresholdIndex < AZ_ARRAY_SIZE(thresholds); ++thresholdIndex)
+            {
+                const RagdollLodLevel thresholdLevel = static_cast<RagdollLodLevel>(thresholdIndex + 1);
+                const float threshold = currentLevel >= thresholdLevel ? thresholds[thresholdIndex] * (1.0f - Hysteresis)
+                                                                       : thresholds[thresholdIndex];
+                if (distance >= threshold)
+                {
+                    level = thresholdLevel;
+                }
+            }
+            return level;
+        }
+    } // namespace RagdollLodInternal
+
+    void SceneRagdollLod::Register(Ragdoll& ragdoll)
+    {
+        if (AZStd::find(m_ragdolls.begin(), m_ragdolls.end(), &ragdoll) == m_ragdolls.end())
+        {
+            m_ragdolls.push_back(&ragdoll);
+        }
+    }
+
+    void SceneRagdollLod::Unregister(const Ragdoll& ragdoll)
+    {
+        m_ragdolls.erase(AZStd::remove(m_ragdolls.begin(), m_ragdolls.end(), &ragdoll), m_ragdolls.end());
+    }
+
+    bool SceneRagdollLod::IsEmpty() const
+    {
+        return m_ragdolls.empty();
+    }
+
+    void SceneRagdollLod::SetViewerPosition(const AZ::Vector3& position)
+    {
+        m_viewerPosition = position;
+    }
+
+    void SceneRagdollLod::ClearViewerPosition()
+    {
+        m_viewerPosition.reset();
+    }
+
+    AZStd::optional<AZ::Vector3> SceneRagdollLod::GetViewerPosition() const
+    {
+        if (m_viewerPosition)
+        {
+            return m_viewerPosition;
+        }
+
+        if (Camera::ActiveCameraRequestBus::HasHandlers())
+        {
+            AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+            Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequests::GetActiveCameraTransform);
+            return cameraTransform.GetTranslation();
+        }
+        return AZStd::nullopt;
+    }
+
+    void SceneRagdollLod::Update()
+    {
+        m_levelCounts = {};
+        if (m_ragdolls.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Physics);
+
+        if (!physx_ragdollLod)
+        {
+            for (Ragdoll* ragdoll : m_ragdolls)
+            {
+                ragdoll->SetLodLevel(RagdollLodLevel::Full);
+            }
+            m_levelCounts[static_cast<size_t>(RagdollLodLevel::Full)] = aznumeric_cast<AZ::u32>(m_ragdolls.size());
+            return;
+        }
+
+        // Without a viewer, only the visibility and the cap on the simulated ragdolls lower the tiers.
+        const AZStd::optional<AZ::Vector3> viewerPosition = GetViewerPosition();
+
+        m_candidates.clear();
+        m_candidates.reserve(m_ragdolls.size());
+        for (Ragdoll* ragdoll : m_ragdolls)
+        {
+            Candidate& candidate = m_candidates.emplace_back();
+            candidate.m_ragdoll = ragdoll;
+            candidate.m_visible = ragdoll->IsVisible();
+            candidate.m_distance = viewerPosition ? ragdoll->GetPosition().GetDistance(*viewerPosition) : 0.0f;
+            candidate.m_level = RagdollLodInternal::PickLevel(candidate.m_distance, ragdoll->GetLodLevel());
+
+            // A hidden ragdoll is still simulated, as it may come back into view, but nobody sees it settle.
+            if (!candidate.m_visible && candidate.m_level < RagdollLodLevel::Frozen)
+            {
+                candidate.m_level = RagdollLodLevel::Frozen;
+            }
+        }
+
+        if (physx_ragdollLodMaxSimulated > 0)
+        {
+            EvictLowestPriority(physx_ragdollLodMaxSimulated);
+        }
+
+        for (const Candidate& candidate : m_candidates)
+        {
+            candidate.m_ragdoll->SetLodLevel(candidate.m_level);
+            ++m_levelCounts[static_cast<size_t>(candidate.m_level)];
+        }
+    }
+
+    void SceneRagdollLod::EvictLowestPriority(AZ::u32 maxSimulated)
+    {
+        const size_t simulatedCount = AZStd::count_if(m_candidates.begin(), m_candidates.end(), [](const Candidate& candidate)
+        {
+            return candidate.m_level != RagdollLodLevel::Kinematic;
+        });
+        if (simulatedCount <= maxSimulated)
+        {
+            return;
+        }
+
+        // Simulated ragdolls first, then visible ones, then nearest ones.
+        AZStd::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+        {
+            const bool lhsSimulated = lhs.m_level != RagdollLodLevel::Kinematic;
+            const bool rhsSimulated = rhs.m_level != RagdollLodLevel::Kinematic;
+            if (lhsSimulated != rhsSimulated)
+            {
+                return lhsSimulated;
+            }
+            if (lhs.m_visible != rhs.m_visible)
+            {
+                return lhs.m_visible;
+            }
+            return lhs.m_distance < rhs.m_distance;
+        });
+
+        for (size_t candidateIndex = maxSimulated; candidateIndex < simulatedCount; ++candidateIndex)
+        {
+            m_candidates[candidateIndex].m_level = RagdollLodLevel::Kinematic;
+        }
+    }
+
+    AZ::u32 SceneRagdollLod::GetRagdollCount(RagdollLodLevel level) const
+    {
+        return level < RagdollLodLevel::Count ? m_levelCounts[static_cast<size_t>(level)] : 0;
+    }
+} // namespace PhysX
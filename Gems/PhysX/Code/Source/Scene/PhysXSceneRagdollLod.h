@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+
+namespace PhysX
+{
+    class Ragdoll;
+
+    //! Fidelity tiers of the ragdoll simulation, from the most to the least expensive.
+    enum class RagdollLodLevel : AZ::u8
+    {
+        Full, //!< Configured solver iterations and CCD.
+        Reduced, //!< Fewer solver iterations and no CCD.
+        Frozen, //!< Reduced, and kept asleep once all its nodes fell asleep instead of being woken by the new drive targets.
+        Kinematic, //!< Not simulated, the nodes follow the poses of the states they are given.
+        Count
+    };
+
+    //! Picks the fidelity tier of the simulated ragdolls of a scene before each simulation step, from their distance
+    //! to the viewer and their visibility. The ragdolls nobody looks at closely get fewer solver iterations, stay asleep
+    //! once they fell asleep, and follow their pose kinematically when far away. When more ragdolls are simulated than
+    //! physx_ragdollLodMaxSimulated, the ones with the lowest priority, hidden first and then farthest, are made kinematic.
+    class SceneRagdollLod
+    {
+    public:
+        void Register(Ragdoll& ragdoll);
+        void Unregister(const Ragdoll& ragdoll);
+        bool IsEmpty() const;
+
+        //! Sets the position the distances are measured from, instead of the active camera.
+        void SetViewerPosition(const AZ::Vector3& position);
+        void ClearViewerPosition();
+
+        //! Applies the tier of each registered ragdoll.
+        void Update();
+
+        //! Returns the number of registered ragdolls at a tier after the last update.
+        AZ::u32 GetRagdollCount(RagdollLodLevel level) const;
+
+    private:
+        struct Candidate
+        {
+            Ragdoll* m_ragdoll = nullptr;
+            RagdollLodLevel m_level = RagdollLodLevel::Full;
+            float m_distance = 0.0f;
+            bool m_visible = true;
+        };
+
+        AZStd::optional<AZ::Vector3> GetViewerPosition() const;
+        void EvictLowestPriority(AZ::u32 maxSimulated);
+
+        AZStd::vector<Ragdoll*> m_ragdolls;
+        AZStd::vector<Candidate> m_candidates;
+        AZStd::optional<AZ::Vector3> m_viewerPosition;
+        AZStd::array<AZ::u32, static_cast<size_t>(RagdollLodLevel::Count)> m_levelCounts = {};
+    };
+} // namespace PhysX
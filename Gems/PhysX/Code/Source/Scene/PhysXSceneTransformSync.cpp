@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneTransformSync.h>
+#include <PhysX/MathConversion.h>
+#include <Source/RigidBodyComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
+
+namespace PhysX
+{
+    void SceneTransformSync::Register(RigidBodyComponent& component)
+    {
+        m_components[component.GetEntityId()] = &component;
+    }
+
+    void SceneTransformSync::Unregister(const RigidBodyComponent& component)
+    {
+        m_components.erase(component.GetEntityId());
+    }
+
+    bool SceneTransformSync::IsEmpty() const
+    {
+        return m_components.empty();
+    }
+
+    void SceneTransformSync::AddActivePose(AZ::EntityId entityId, const physx::PxTransform& pose)
+    {
+        if (auto it = m_components.find(entityId); it != m_components.end())
+        {
+            AddPose(*it->second, PxMathConvert(pose.p), PxMathConvert(pose.q));
+        }
+    }
+
+    void SceneTransformSync::AddAllPoses()
+    {
+        for (auto& [entityId, component] : m_components)
+        {
+            if (const AzPhysics::RigidBody* rigidBody = component->GetRigidBody())
+            {
+                const AZ::Transform pose = rigidBody->GetTransform();
+                AddPose(*component, pose.GetTranslation(), pose.GetRotation());
+            }
+        }
+    }
+
+    void SceneTransformSync::AddPose(RigidBodyComponent& component, const AZ::Vector3& position, const AZ::Quaternion& orientation)
+    {
+        if (!component.NeedsTransformSync())
+        {
+            return;
+        }
+
+        PendingPose& pendingPose = m_pendingPoses.emplace_back();
+        pendingPose.m_component = &component;
+        pendingPose.m_transform = component.GetEntity()->GetTransform();
+        pendingPose.m_position = position;
+        pendingPose.m_orientation = orientation;
+    }
+
+    void SceneTransformSync::Apply()
+    {
+        if (m_pendingPoses.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Physics);
+
+        SortParentsFirst();
+
+        for (const PendingPose& pendingPose : m_pendingPoses)
+        {
+            // The body has no scale, the entity keeps its own.
+            const float scale = pendingPose.m_transform->GetWorldUniformScale();
+            pendingPose.m_transform->SetWorldTM(AZ::Transform(pendingPose.m_position, pendingPose.m_orientation, scale));
+            pendingPose.m_component->OnTransformSynced();
+        }
+        m_pendingPoses.clear();
+    }
+
+    void SceneTransformSync::SortParentsFirst()
+    {
+        if (m_pendingPoses.size() < 2)
+        {
+            return;
+        }
+
+        m_pendingPoseIndices.clear();
+        for (uint32_t poseIndex = 0; poseIndex < m_pendingPoses.size(); ++poseIndex)
+        {
+            m_pendingPoseIndices.emplace(m_pendingPoses[poseIndex].m_component->GetEntityId(), poseIndex);
+        }
+
+        bool hasChildren = false;
+        for (PendingPose& pendingPose : m_pendingPoses)
+        {
+            // The depth is bounded by the pose count in case of a parenting loop.
+            AZ::EntityId parentId = pendingPose.m_transform->GetParentId();
+            while (parentId.IsValid() && pendingPose.m_depth < m_pendingPoses.size())
+            {
+                auto it = m_pendingPoseIndices.find(parentId);
+                if (it == m_pendingPoseIndices.end())
+                {
+                    break;
+                }
+                ++pendingPose.m_depth;
+                parentId = m_pendingPoses[it->second].m_transform->GetParentId();
+            }
+            hasChildren |= pendingPose.m_depth > 0;
+        }
+
+        if (hasChildren)
+        {
+            AZStd::stable_sort(m_pendingPoses.begin(), m_pendingPoses.end(), [](const PendingPose& lhs, const PendingPose& rhs)
+            {
+                return lhs.m_depth < rhs.m_depth;
+            });
+        }
+    }
+} // namespace PhysX
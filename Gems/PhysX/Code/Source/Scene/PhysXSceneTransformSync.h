@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class TransformInterface;
+}
+
+namespace physx
+{
+    class PxTransform;
+}
+
+namespace PhysX
+{
+    class RigidBodyComponent;
+
+    //! Writes the poses of the simulated rigid bodies of a scene back to their entities in one pass after each simulation step,
+    //! instead of every RigidBodyComponent handling the simulation finish event and going through the TransformBus on its own.
+    //! The poses are gathered in a contiguous array, from the active actors of the scene when it reports them, and written
+    //! straight to the transform of each entity. Parents are written before their children, so a child doesn't get moved by
+    //! its parent after its own pose was written.
+    class SceneTransformSync
+    {
+    public:
+        void Register(RigidBodyComponent& component);
+        void Unregister(const RigidBodyComponent& component);
+        bool IsEmpty() const;
+
+        //! Queues the pose of an active actor of the scene. Ignored if the entity has no registered component.
+        void AddActivePose(AZ::EntityId entityId, const physx::PxTransform& pose);
+
+        //! Queues the poses of all the registered components, for scenes not reporting their active actors.
+        void AddAllPoses();
+
+        //! Writes the queued poses to the transforms of their entities.
+        void Apply();
+
+    private:
+        struct PendingPose
+        {
+            RigidBodyComponent* m_component = nullptr;
+            AZ::TransformInterface* m_transform = nullptr;
+            AZ::Vector3 m_position;
+            AZ::Quaternion m_orientation;
+            uint32_t m_depth = 0; //!< Number of ancestors of the entity with a pending pose.
+        };
+
+        void AddPose(RigidBodyComponent& component, const AZ::Vector3& position, const AZ::Quaternion& orientation);
+        void SortParentsFirst();
+
+        AZStd::unordered_map<AZ::EntityId, RigidBodyComponent*> m_components;
+        AZStd::vector<PendingPose> m_pendingPoses;
+        AZStd::unordered_map<AZ::EntityId, uint32_t> m_pendingPoseIndices;
+    };
+} // namespace PhysX
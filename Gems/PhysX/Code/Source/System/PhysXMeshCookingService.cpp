@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXMeshCookingService.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/std/parallel/lock.h>
+
+#include <Source/Utils.h>
+
+#include <PxPhysicsAPI.h>
+
+AZ_CVAR(bool, physx_meshCookingDiskCache, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Keep the meshes cooked at runtime on disk, under @user@/PhysX/CookedMeshes, to reuse them in the next sessions");
+AZ_CVAR(uint32_t, physx_meshCookingMemoryCacheSize, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of cooked meshes kept in memory by the mesh cooking service");
+
+namespace PhysX
+{
+    namespace
+    {
+        constexpr const char* DiskCacheFolder = "@user@/PhysX/CookedMeshes";
+
+        struct MeshData
+        {
+            AZStd::vector<AZ::Vector3> m_vertices;
+            AZStd::vector<AZ::u32> m_indices;
+        };
+
+        template<typename T>
+        void ProcessValue(AZ::Sha1& sha1, const T& value)
+        {
+            sha1.ProcessBytes(&value, sizeof(T));
+        }
+    } // namespace
+
+    CookedMesh::CookedMesh(MeshType meshType)
+        : m_meshType(meshType)
+    {
+    }
+
+    CookedMesh::MeshType CookedMesh::GetMeshType() const
+    {
+        return m_meshType;
+    }
+
+    bool CookedMesh::IsReady() const
+    {
+        return m_ready.load(AZStd::memory_order_acquire);
+    }
+
+    void CookedMesh::Wait() const
+    {
+        if (IsReady())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        m_finished.wait(lock, [this]() { return IsReady(); });
+    }
+
+    bool CookedMesh::Succeeded() const
+    {
+        Wait();
+        return m_succeeded;
+    }
+
+    const AZStd::vector<AZ::u8>& CookedMesh::GetCookedData() const
+    {
+        Wait();
+        return m_cookedData;
+    }
+
+    void CookedMesh::Finish(AZStd::vector<AZ::u8>&& cookedData, bool succeeded)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_cookedData = AZStd::move(cookedData);
+            m_succeeded = succeeded;
+            m_ready.store(true, AZStd::memory_order_release);
+        }
+        m_finished.notify_all();
+    }
+
+    MeshCookingService::~MeshCookingService()
+    {
+        WaitForPendingCookings();
+    }
+
+    void MeshCookingService::SetCooking(physx::PxCooking* cooking)
+    {
+        if (m_cooking != cooking)
+        {
+            WaitForPendingCookings();
+            ClearMemoryCache();
+            m_cooking = cooking;
+        }
+    }
+
+    CookedMeshFuture MeshCookingService::CookConvexMeshAsync(AZStd::vector<AZ::Vector3> vertices)
+    {
+        return StartCooking(CookedMesh::MeshType::Convex, AZStd::move(vertices), {});
+    }
+
+    CookedMeshFuture MeshCookingService::CookTriangleMeshAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices)
+    {
+        return StartCooking(CookedMesh::MeshType::TriangleMesh, AZStd::move(vertices), AZStd::move(indices));
+    }
+
+    bool MeshCookingService::CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
+    {
+        return CookNow(CookedMesh::MeshType::Convex, vertices, vertexCount, nullptr, 0, result);
+    }
+
+    bool MeshCookingService::CookTriangleMesh(
+        const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
+    {
+        return CookNow(CookedMesh::MeshType::TriangleMesh, vertices, vertexCount, indices, indexCount, result);
+    }
+
+    CookedMeshFuture MeshCookingService::StartCooking(
+        CookedMesh::MeshType meshType, AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices)
+    {
+        const AZStd::string key = ComputeKey(meshType, vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()),
+            indices.data(), aznumeric_cast<AZ::u32>(indices.size()));
+
+        bool isNew = false;
+        AZStd::shared_ptr<CookedMesh> cookedMesh = FindOrAdd(key, meshType, isNew);
+        if (!isNew)
+        {
+            return cookedMesh;
+        }
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (!jobContext)
+        {
+            Cook(*cookedMesh, key, vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()),
+                indices.data(), aznumeric_cast<AZ::u32>(indices.size()));
+            return cookedMesh;
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+            ++m_pendingCount;
+        }
+
+        // The mesh data is shared with the job, so copying the job function doesn't copy the mesh.
+        auto meshData = AZStd::make_shared<MeshData>(MeshData{ AZStd::move(vertices), AZStd::move(indices) });
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, cookedMesh, key, meshData]()
+            {
+                Cook(*cookedMesh, key, meshData->m_vertices.data(), aznumeric_cast<AZ::u32>(meshData->m_vertices.size()),
+                    meshData->m_indices.data(), aznumeric_cast<AZ::u32>(meshData->m_indices.size()));
+
+                // Notify while holding the lock, the service may be destroyed as soon as it is released.
+                AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+                --m_pendingCount;
+                m_pendingFinished.notify_all();
+            },
+            true, jobContext);
+        job->Start();
+
+        return cookedMesh;
+    }
+
+    bool MeshCookingService::CookNow(
+        CookedMesh::MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount,
+        AZStd::vector<AZ::u8>& result)
+    {
+        const AZStd::string key = ComputeKey(meshType, vertices, vertexCount, indices, indexCount);
+
+        bool isNew = false;
+        AZStd::shared_ptr<CookedMesh> cookedMesh = FindOrAdd(key, meshType, isNew);
+        if (isNew)
+        {
+            Cook(*cookedMesh, key, vertices, vertexCount, indices, indexCount);
+        }
+
+        if (!cookedMesh->Succeeded())
+        {
+            return false;
+        }
+
+        const AZStd::vector<AZ::u8>& cookedData = cookedMesh->GetCookedData();
+        result.insert(result.end(), cookedData.begin(), cookedData.end());
+        return true;
+    }
+
+    void MeshCookingService::WaitForPendingCookings()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_pendingMutex);
+        m_pendingFinished.wait(lock, [this]() { return m_pendingCount == 0; });
+    }
+
+    void MeshCookingService::ClearMemoryCache()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        m_cache.clear();
+        m_cacheOrder.clear();
+    }
+
+    AZStd::string MeshCookingService::ComputeKey(
+        CookedMesh::MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount) const
+    {
+        AZ::Sha1 sha1;
+        ProcessValue(sha1, static_cast<AZ::u8>(meshType));
+        ProcessValue(sha1, static_cast<AZ::u32>(PX_PHYSICS_VERSION));
+
+        // Meshes cooked with other parameters, such as the ones of the Editor and of the game, must not share their results.
+        if (m_cooking)
+        {
+            const physx::PxCookingParams& params = m_cooking->getParams();
+            ProcessValue(sha1, static_cast<AZ::u32>(params.meshPreprocessParams));
+            ProcessValue(sha1, params.meshWeldTolerance);
+            ProcessValue(sha1, params.areaTestEpsilon);
+            ProcessValue(sha1, params.planeTolerance);
+            ProcessValue(sha1, params.gaussMapLimit);
+            ProcessValue(sha1, static_cast<AZ::u8>(params.buildTriangleAdjacencies));
+            ProcessValue(sha1, static_cast<AZ::u8>(params.suppressTriangleMeshRemapTable));
+            ProcessValue(sha1, static_cast<AZ::u32>(params.midphaseDesc.getType()));
+        }
+
+        // Only the x, y and z of the vertices are read by the cooking, the padding of AZ::Vector3 is left out.
+        ProcessValue(sha1, vertexCount);
+        for (AZ::u32 vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+        {
+            float xyz[3];
+            vertices[vertexIndex].StoreToFloat3(xyz);
+            sha1.ProcessBytes(xyz, sizeof(xyz));
+        }
+        ProcessValue(sha1, indexCount);
+        if (indexCount > 0)
+        {
+            sha1.ProcessBytes(indices, sizeof(AZ::u32) * indexCount);
+        }
+
+        AZ::u32 digest[5];
+        sha1.GetDigest(digest);
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
+    AZStd::shared_ptr<CookedMesh> MeshCookingService::FindOrAdd(const AZStd::string& key, CookedMesh::MeshType meshType, bool& isNew)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+
+        auto cacheIt = m_cache.find(key);
+        if (cacheIt != m_cache.end())
+        {
+            isNew = false;
+            return cacheIt->second;
+        }
+
+        // Evicted meshes stay alive as long as a caller or a cooking job holds them.
+        while (!m_cacheOrder.empty() && m_cache.size() >= AZStd::max(static_cast<uint32_t>(physx_meshCookingMemoryCacheSize), 1u))
+        {
+            m_cache.erase(m_cacheOrder.front());
+            m_cacheOrder.pop_front();
+        }
+
+        isNew = true;
+        auto cookedMesh = AZStd::make_shared<CookedMesh>(meshType);
+        m_cache.emplace(key, cookedMesh);
+        m_cacheOrder.push_back(key);
+        return cookedMesh;
+    }
+
+    void MeshCookingService::Cook(
+        CookedMesh& cookedMesh, const AZStd::string& key, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices,
+        AZ::u32 indexCount) const
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        AZStd::vector<AZ::u8> cookedData;
+        if (ReadFromDiskCache(key, cookedData))
+        {
+            cookedMesh.Finish(AZStd::move(cookedData), true);
+            return;
+        }
+
+        physx::PxDefaultMemoryOutputStream memoryStream;
+        const bool succeeded = cookedMesh.GetMeshType() == CookedMesh::MeshType::Convex
+            ? Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream, m_cooking)
+            : Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream, m_cooking);
+
+        if (succeeded)
+        {
+            cookedData.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            WriteToDiskCache(key, cookedData);
+        }
+        cookedMesh.Finish(AZStd::move(cookedData), succeeded);
+    }
+
+    bool MeshCookingService::ReadFromDiskCache(const AZStd::string& key, AZStd::vector<AZ::u8>& cookedData) const
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!physx_meshCookingDiskCache || !fileIO)
+        {
+            return false;
+        }
+
+        const AZStd::string filePath = AZStd::string::format("%s/%s.pxmesh", DiskCacheFolder, key.c_str());
+        if (!fileIO->Exists(filePath.c_str()))
+        {
+            return false;
+        }
+
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, file))
+        {
+            return false;
+        }
+
+        AZ::u64 fileSize = 0;
+        bool succeeded = fileIO->Size(file, fileSize) && fileSize > 0;
+        if (succeeded)
+        {
+            cookedData.resize(fileSize);
+            succeeded = fileIO->Read(file, cookedData.data(), fileSize, true);
+        }
+        fileIO->Close(file);
+
+        if (!succeeded)
+        {
+            cookedData.clear();
+        }
+        return succeeded;
+    }
+
+    void MeshCookingService::WriteToDiskCache(const AZStd::string& key, const AZStd::vector<AZ::u8>& cookedData) const
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!physx_meshCookingDiskCache || !fileIO)
+        {
+            return;
+        }
+
+        fileIO->CreatePath(DiskCacheFolder);
+
+        // Write to a temporary file first, so that other processes sharing the cache never read a partially written mesh.
+        const AZStd::string filePath = AZStd::string::format("%s/%s.pxmesh", DiskCacheFolder, key.c_str());
+        const AZStd::string tempFilePath = filePath + ".tmp";
+
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(tempFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, file))
+        {
+            AZ_Warning("PhysX", false, "Unable to write the cooked mesh cache file %s", tempFilePath.c_str());
+            return;
+        }
+
+        const bool succeeded = fileIO->Write(file, cookedData.data(), cookedData.size());
+        fileIO->Close(file);
+
+        if (!succeeded || !fileIO->Rename(tempFilePath.c_str(), filePath.c_str()))
+        {
+            fileIO->Remove(tempFilePath.c_str());
+        }
+    }
+} // namespace PhysX
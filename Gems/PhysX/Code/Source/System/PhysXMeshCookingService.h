@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+namespace physx
+{
+    class PxCooking;
+}
+
+namespace PhysX
+{
+    //! Cooked data of a mesh, filled by a cooking job and shared with everyone waiting for it.
+    class CookedMesh
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CookedMesh, AZ::SystemAllocator, 0);
+
+        using MeshType = Physics::CookedMeshShapeConfiguration::MeshType;
+
+        explicit CookedMesh(MeshType meshType);
+
+        MeshType GetMeshType() const;
+
+        //! Returns true once the cooking is over, whether it succeeded or not.
+        bool IsReady() const;
+
+        //! Blocks until the cooking is over.
+        void Wait() const;
+
+        //! Waits for the cooking and returns whether it succeeded.
+        bool Succeeded() const;
+
+        //! Waits for the cooking and returns the cooked data, empty if the cooking failed.
+        const AZStd::vector<AZ::u8>& GetCookedData() const;
+
+    private:
+        friend class MeshCookingService;
+
+        void Finish(AZStd::vector<AZ::u8>&& cookedData, bool succeeded);
+
+        const MeshType m_meshType;
+        mutable AZStd::mutex m_mutex;
+        mutable AZStd::condition_variable m_finished;
+        AZStd::atomic_bool m_ready{ false };
+        bool m_succeeded = false;
+        AZStd::vector<AZ::u8> m_cookedData;
+    };
+
+    //! Future of an asynchronous cooking, ready once the job cooking the mesh finished.
+    using CookedMeshFuture = AZStd::shared_ptr<const CookedMesh>;
+
+    //! Cooks the convex and triangle meshes created at runtime, such as procedural geometry or the shapes edited in the Editor.
+    //! Meshes are cooked on the job threads, and the results are cached by the hash of their vertices, indices and cooking
+    //! parameters, so cooking identical geometry again only waits for the first cooking. The cache lives in memory, and on disk
+    //! under @user@/PhysX/CookedMeshes when physx_meshCookingDiskCache is set, so the results are kept between sessions.
+    class MeshCookingService
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MeshCookingService, AZ::SystemAllocator, 0);
+
+        MeshCookingService() = default;
+        ~MeshCookingService();
+
+        //! Sets the cooking interface used by the cooking jobs, nullptr once PhysX is shut down.
+        //! Waits for the pending cookings and clears the memory cache when the interface changes.
+        void SetCooking(physx::PxCooking* cooking);
+
+        //! Starts cooking a convex mesh on the job threads.
+        CookedMeshFuture CookConvexMeshAsync(AZStd::vector<AZ::Vector3> vertices);
+
+        //! Starts cooking a triangle mesh on the job threads.
+        CookedMeshFuture CookTriangleMeshAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices);
+
+        //! Cooks a convex mesh on the calling thread, or waits for the cooking of the same mesh started earlier.
+        bool CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result);
+
+        //! Cooks a triangle mesh on the calling thread, or waits for the cooking of the same mesh started earlier.
+        bool CookTriangleMesh(
+            const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result);
+
+        //! Blocks until all the cooking jobs finished.
+        void WaitForPendingCookings();
+
+        //! Removes the cooked meshes from the memory cache. The disk cache is left untouched.
+        void ClearMemoryCache();
+
+    private:
+        CookedMeshFuture StartCooking(CookedMesh::MeshType meshType, AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices);
+        bool CookNow(
+            CookedMesh::MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount,
+            AZStd::vector<AZ::u8>& result);
+
+        //! Returns the hexadecimal SHA-1 of the mesh data and the cooking parameters.
+        AZStd::string ComputeKey(
+            CookedMesh::MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount) const;
+
+        //! Returns the cooked mesh cached for a key, or adds an empty one which the caller has to cook if isNew is set.
+        AZStd::shared_ptr<CookedMesh> FindOrAdd(const AZStd::string& key, CookedMesh::MeshType meshType, bool& isNew);
+
+        //! Cooks a mesh from the disk cache or with PhysX, and writes newly cooked meshes to the disk cache.
+        void Cook(
+            CookedMesh& cookedMesh, const AZStd::string& key, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices,
+            AZ::u32 indexCount) const;
+
+        bool ReadFromDiskCache(const AZStd::string& key, AZStd::vector<AZ::u8>& cookedData) const;
+        void WriteToDiskCache(const AZStd::string& key, const AZStd::vector<AZ::u8>& cookedData) const;
+
+        physx::PxCooking* m_cooking = nullptr;
+
+        AZStd::mutex m_cacheMutex;
+        AZStd::unordered_map<AZStd::string, AZStd::shared_ptr<CookedMesh>> m_cache;
+        AZStd::deque<AZStd::string> m_cacheOrder; //!< Keys of the cached meshes, oldest first.
+
+        AZStd::mutex m_pendingMutex;
+        AZStd::condition_variable m_pendingFinished;
+        AZ::u32 m_pendingCount = 0; //!< Number of cooking jobs started and not finished yet.
+    };
+} // namespace PhysX
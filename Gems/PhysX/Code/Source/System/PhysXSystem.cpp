@@ -12,6 +12,8 @@
 #include <Scene/PhysXScene.h>
 #include <System/PhysXAllocator.h>
 #include <System/PhysXCpuDispatcher.h>
+#include <System/PhysXTaskGraphCpuDispatcher.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
 #include <AzCore/Asset/AssetManager.h>
@@ -25,6 +27,11 @@
 #define ENABLE_PHYSX_TIMESTEP_WARNING
 #endif
 
+AZ_CVAR(bool, physx_taskGraphCpuDispatcher, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Run the PhysX tasks on the TaskGraph workers with the critical priority instead of as AZ jobs (read when the PhysX system is initialized)");
+AZ_CVAR(uint32_t, physx_taskGraphWorkerMask, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Bitmask of the TaskGraph workers allowed to run the PhysX tasks when physx_taskGraphCpuDispatcher is set, 0 to use all of them");
+
 namespace PhysX
 {
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator, 0);
@@ -101,6 +108,22 @@ namespace PhysX
             m_systemConfig = *physXConfig;
         }
 
+        // The task graph isn't active yet when the PhysX SDK is initialized, so the dispatcher is swapped here before any scene
+        // holds the previous one.
+        if (physx_taskGraphCpuDispatcher && !m_taskGraphCpuDispatcher && m_sceneList.empty())
+        {
+            if (PhysXTaskGraphCpuDispatcher* dispatcher = PhysXTaskGraphCpuDispatcherCreate(physx_taskGraphWorkerMask))
+            {
+                delete m_cpuDispatcher;
+                m_cpuDispatcher = dispatcher;
+                m_taskGraphCpuDispatcher = true;
+            }
+            else
+            {
+                AZ_Warning("PhysXSystem", false, "physx_taskGraphCpuDispatcher is set but the task graph is not active, PhysX tasks run as AZ jobs");
+            }
+        }
+
         // If the settings registry isn't available, something earlier in startup will report that failure.
         if (auto* settingsRegistry = AZ::SettingsRegistry::Get();
             settingsRegistry != nullptr)
@@ -133,6 +156,9 @@ namespace PhysX
 
         RemoveAllScenes();
 
+        // The cooking jobs run on the job manager, which is shut down along with the system components.
+        m_meshCookingService.WaitForPendingCookings();
+
         m_componentApplicationLifecycleHandler.Disconnect();
         m_materialLibraryAssetHelper.Disconnect();
         // Clear the asset reference in deactivate. The asset system is shut down before destructors are called
@@ -153,8 +179,31 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
+        // The results of the last frame are needed before the scenes can be stepped again.
+        FinishPendingSimulation();
+
+        auto simulateScenes = [this](float timeStep, bool lastStep)
         {
+            const bool deferResults = lastStep && m_systemConfig.m_deferSimulationResults;
+            if (m_systemConfig.m_simulateScenesConcurrently || deferResults)
+            {
+                // Start every scene before waiting for any of them, their tasks share the job threads of the CPU dispatcher.
+                for (auto& scenePtr : m_sceneList)
+                {
+                    if (scenePtr != nullptr && scenePtr->IsEnabled())
+                    {
+                        scenePtr->StartSimulation(timeStep);
+                        m_simulatingScenes.push_back(scenePtr.get());
+                    }
+                }
+
+                if (!deferResults)
+                {
+                    FinishSimulatingScenes();
+                }
+                return;
+            }
+
             for (auto& scenePtr : m_sceneList)
             {
                 if (scenePtr != nullptr && scenePtr->IsEnabled())
@@ -198,19 +247,48 @@ namespace PhysX
 
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
+                simulateScenes(m_systemConfig.m_fixedTimestep, m_accumulatedTime < m_systemConfig.m_fixedTimestep);
             }
         }
         else
         {
             m_preSimulateEvent.Signal(tickTime);
 
-            simulateScenes(tickTime);
+            simulateScenes(tickTime, true);
+        }
+
+        if (!m_simulatingScenes.empty())
+        {
+            // The last step is left running, the post simulate event is signaled once its results are fetched.
+            m_pendingPostSimulateTime = tickTime;
+            return;
         }
         m_postSimulateEvent.Signal(tickTime);
     }
 
+    void PhysXSystem::FinishPendingSimulation()
+    {
+        if (m_simulatingScenes.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Physics);
+
+        FinishSimulatingScenes();
+        m_postSimulateEvent.Signal(m_pendingPostSimulateTime);
+    }
+
+    void PhysXSystem::FinishSimulatingScenes()
+    {
+        for (AzPhysics::Scene* scene : m_simulatingScenes)
+        {
+            scene->FinishSimulation();
+        }
+        m_simulatingScenes.clear();
+    }
+
     AzPhysics::SceneHandle PhysXSystem::AddScene(const AzPhysics::SceneConfiguration& config)
     {
         if (config.m_sceneName.empty())
@@ -325,6 +403,7 @@ namespace PhysX
             {
                 if (scenePtr->GetId() == AZStd::get<AzPhysics::HandleTypeIndex::Crc>(handle))
                 {
+                    FinishPendingSimulation();
                     m_sceneRemovedEvent.Signal(handle);
                     m_sceneList[index].reset();
                     m_freeSceneSlots.push(static_cast<AzPhysics::SceneIndex>(index));
@@ -343,6 +422,7 @@ namespace PhysX
 
     void PhysXSystem::RemoveAllScenes()
     {
+        FinishPendingSimulation();
         m_sceneList.clear();
 
         //clear the free slots queue
@@ -396,6 +476,7 @@ namespace PhysX
         if (const auto* physXConfig = azdynamic_cast<const PhysXSystemConfiguration*>(newConfig);
             m_systemConfig != (*physXConfig))
         {
+            FinishPendingSimulation();
             const bool newMaterialLibrary = m_systemConfig.m_materialLibraryAsset != physXConfig->m_materialLibraryAsset;
             m_systemConfig = (*physXConfig);
             m_configChangeEvent.Signal(physXConfig);
@@ -428,6 +509,7 @@ namespace PhysX
 
         // set up cooking for height fields, meshes etc.
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
+        m_meshCookingService.SetCooking(m_physXSdk.m_cooking);
 
         // Set up CPU dispatcher
 #if defined(AZ_PLATFORM_LINUX)
@@ -446,6 +528,7 @@ namespace PhysX
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
 
+        m_meshCookingService.SetCooking(nullptr);
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
 
@@ -17,6 +17,7 @@
 #include <Debug/PhysXDebug.h>
 #include <Scene/PhysXSceneInterface.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXMeshCookingService.h>
 #include <System/PhysXSdkCallbacks.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
@@ -70,9 +71,16 @@ namespace PhysX
 
         void UpdateMaterialLibrary(const AZ::Data::Asset<Physics::MaterialLibraryAsset>& materialLibrary);
 
+        //! Waits for the scenes still simulating the last step of Simulate and fetches their results.
+        //! This only has an effect when PhysXSystemConfiguration::m_deferSimulationResults is set, and lets gameplay code pick
+        //! the point of the frame where the results are needed. It is called by the next Simulate otherwise.
+        void FinishPendingSimulation();
+
         //TEMP -- until these are fully moved over here
         physx::PxPhysics* GetPxPhysics() { return m_physXSdk.m_physics; }
         physx::PxCooking* GetPxCooking() { return m_physXSdk.m_cooking; }
+        //! Returns the service cooking the meshes created at runtime on the job threads, and caching the cooked results.
+        MeshCookingService& GetMeshCookingService() { return m_meshCookingService; }
         physx::PxCpuDispatcher* GetPxCpuDispathcher()
         {
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
@@ -88,6 +96,9 @@ namespace PhysX
         void InitializePhysXSdk(const physx::PxCookingParams& cookingParams);
         void ShutdownPhysXSdk();
 
+        //! Waits for all the scenes started since the last call and fetches their results.
+        void FinishSimulatingScenes();
+
         void InitializeMaterialLibrary();
         bool LoadMaterialLibrary();
 
@@ -98,6 +109,9 @@ namespace PhysX
 
         float m_accumulatedTime = 0.0f;
 
+        AZStd::vector<AzPhysics::Scene*> m_simulatingScenes; //!< Scenes started and not finished yet.
+        float m_pendingPostSimulateTime = 0.0f; //!< Time passed to the post simulate event once the deferred results are fetched.
+
         struct PhysXSdk
         {
             physx::PxFoundation* m_foundation = nullptr;
@@ -105,11 +119,13 @@ namespace PhysX
             physx::PxCooking* m_cooking = nullptr;
         };
         PhysXSdk m_physXSdk;
+        MeshCookingService m_meshCookingService;
         PxAzAllocatorCallback m_physXAllocatorCallback;
         PxAzErrorCallback m_physXErrorCallback;
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        bool m_taskGraphCpuDispatcher = false; //!< True once m_cpuDispatcher runs the PhysX tasks on the TaskGraph workers.
 
         enum class State : AZ::u8
         {
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXTaskGraphCpuDispatcher.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace PhysX
+{
+    PhysXTaskGraphCpuDispatcher* PhysXTaskGraphCpuDispatcherCreate(uint32_t workerMask)
+    {
+        const auto* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActive == nullptr || !taskGraphActive->IsTaskGraphActive())
+        {
+            return nullptr;
+        }
+        return aznew PhysXTaskGraphCpuDispatcher(AZ::TaskExecutor::Instance(), workerMask);
+    }
+
+    PhysXTaskGraphCpuDispatcher::PhysXTaskGraphCpuDispatcher(AZ::TaskExecutor& executor, uint32_t workerMask)
+        : m_executor(executor)
+        , m_taskDescriptor{ "PhysX Task", "Physics", AZ::TaskPriority::CRITICAL, workerMask }
+    {
+    }
+
+    PhysXTaskGraphCpuDispatcher::~PhysXTaskGraphCpuDispatcher()
+    {
+        // PhysX waits for its tasks to run, but a worker may still be releasing the graph of the last one.
+        for (auto& slot : m_slots)
+        {
+            while (slot->m_graph.IsInFlight())
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+    }
+
+    void PhysXTaskGraphCpuDispatcher::submitTask(physx::PxBaseTask& task)
+    {
+        TaskSlot* slot = AcquireSlot();
+        slot->m_pxTask = &task;
+        slot->m_graph.SubmitOnExecutor(m_executor);
+    }
+
+    physx::PxU32 PhysXTaskGraphCpuDispatcher::getWorkerCount() const
+    {
+        return m_executor.GetThreadCount();
+    }
+
+    PhysXTaskGraphCpuDispatcher::TaskSlot* PhysXTaskGraphCpuDispatcher::AcquireSlot()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_slotMutex);
+
+        // A slot is released at the end of its task, shortly before its graph is done. Skip the ones still finishing.
+        for (auto it = m_freeSlots.rbegin(); it != m_freeSlots.rend(); ++it)
+        {
+            TaskSlot* slot = *it;
+            if (!slot->m_graph.IsInFlight())
+            {
+                m_freeSlots.erase(AZStd::next(it).base());
+                return slot;
+            }
+        }
+
+        TaskSlot* slot = m_slots.emplace_back(AZStd::make_unique<TaskSlot>()).get();
+        slot->m_graph.AddTask(
+            m_taskDescriptor,
+            [this, slot]
+            {
+                physx::PxBaseTask* pxTask = slot->m_pxTask;
+                {
+                    AZ_PROFILE_SCOPE(Physics, pxTask->getName());
+                    pxTask->run();
+                }
+                pxTask->release();
+                ReleaseSlot(slot);
+            });
+        return slot;
+    }
+
+    void PhysXTaskGraphCpuDispatcher::ReleaseSlot(TaskSlot* slot)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_slotMutex);
+        m_freeSlots.push_back(slot);
+    }
+} // namespace PhysX
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <System/PhysXAllocator.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace PhysX
+{
+    //! CPU dispatcher which runs the tasks submitted by PhysX on the AzCore TaskExecutor.
+    //! PhysX tasks are submitted with the critical priority, so they are picked ahead of the tasks queued by the other
+    //! systems, such as the culling of the renderer, and can be restricted to a subset of the task workers.
+    //! Each task runs in a retained single task graph taken from a pool, so dispatching a task doesn't allocate once the pool
+    //! holds as many graphs as there are PhysX tasks in flight.
+    class PhysXTaskGraphCpuDispatcher
+        : public physx::PxCpuDispatcher
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXTaskGraphCpuDispatcher, PhysXAllocator, 0);
+
+        //! @param workerMask Bitmask of the task workers allowed to run PhysX tasks, 0 to use all of them.
+        PhysXTaskGraphCpuDispatcher(AZ::TaskExecutor& executor, uint32_t workerMask);
+        ~PhysXTaskGraphCpuDispatcher();
+
+    private:
+        struct TaskSlot
+        {
+            AZ::TaskGraph m_graph;
+            physx::PxBaseTask* m_pxTask = nullptr;
+        };
+
+        // PxCpuDispatcher implementation
+        void submitTask(physx::PxBaseTask& task) override;
+        physx::PxU32 getWorkerCount() const override;
+
+        TaskSlot* AcquireSlot();
+        void ReleaseSlot(TaskSlot* slot);
+
+        AZ::TaskExecutor& m_executor;
+        AZ::TaskDescriptor m_taskDescriptor;
+
+        AZStd::mutex m_slotMutex;
+        AZStd::vector<AZStd::unique_ptr<TaskSlot>> m_slots;
+        AZStd::vector<TaskSlot*> m_freeSlots;
+    };
+
+    //! Creates a CPU dispatcher which runs the tasks submitted by PhysX on the AzCore TaskExecutor.
+    //! Returns nullptr if the task graph system is not active.
+    PhysXTaskGraphCpuDispatcher* PhysXTaskGraphCpuDispatcherCreate(uint32_t workerMask);
+} // namespace PhysX
@@ -10,6 +10,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/NonUniformScaleBus.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -40,6 +41,8 @@
 #include <Source/StaticRigidBodyComponent.h>
 #include <Source/RigidBodyStatic.h>
 #include <Source/Utils.h>
+#include <Scene/PhysXScene.h>
+#include <System/PhysXSystem.h>
 #include <PhysX/PhysXLocks.h>
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
 #include <PhysX/MathConversion.h>
@@ -129,72 +132,62 @@ namespace PhysX
             return { materialIndex0, materialIndex1 };
         }
 
-        void CreatePxGeometryFromHeightfield(
-            Physics::HeightfieldShapeConfiguration& heightfieldConfig, physx::PxGeometryHolder& pxGeometry)
+        namespace
         {
-            physx::PxHeightField* heightfield = nullptr;
-
-            const AZ::Vector2& gridSpacing = heightfieldConfig.GetGridResolution();
-
-            const int32_t numCols = heightfieldConfig.GetNumColumns();
-            const int32_t numRows = heightfieldConfig.GetNumRows();
-
-            const float rowScale = gridSpacing.GetX();
-            const float colScale = gridSpacing.GetY();
-
-            const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
-            const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
-            const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
-
-            // We're making the assumption right now that the min/max bounds are centered around 0.
-            // If we ever want to allow off-center bounds, we'll need to fix up the float-to-int16 height math below
-            // to account for it.
-            AZ_Assert(
-                AZ::IsClose(-halfBounds, minHeightBounds) && AZ::IsClose(halfBounds, maxHeightBounds),
-                "Min/Max height bounds aren't centered around 0, the height conversions below will be incorrect.");
-
-            AZ_Assert(
-                maxHeightBounds >= minHeightBounds,
-                "Max height bounds is less than min height bounds, the height conversions below will be incorrect.");
-
             // To convert our floating-point heights to fixed-point representation inside of an int16, we need a scale factor
             // for the conversion.  The scale factor is used to map the most important bits of our floating-point height to the
             // full 16-bit range.
             // Note that the scaleFactor choice here affects overall precision.  For each bit that the integer part of our max
             // height uses, that's one less bit for the fractional part.
-            const float scaleFactor = (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
-            const float heightScale{ 1.0f / scaleFactor };
+            float GetHeightfieldScaleFactor(const Physics::HeightfieldShapeConfiguration& heightfieldConfig)
+            {
+                const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
+                const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
+                const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
 
-            [[maybe_unused]] constexpr uint8_t physxMaximumMaterialIndex = 0x7f;
+                // We're making the assumption right now that the min/max bounds are centered around 0.
+                // If we ever want to allow off-center bounds, we'll need to fix up the float-to-int16 height math below
+                // to account for it.
+                AZ_Assert(
+                    AZ::IsClose(-halfBounds, minHeightBounds) && AZ::IsClose(halfBounds, maxHeightBounds),
+                    "Min/Max height bounds aren't centered around 0, the height conversions below will be incorrect.");
 
-            // Delete the cached heightfield object if it is there, and create a new one and save in the shape configuration
-            heightfieldConfig.SetCachedNativeHeightfield(nullptr);
+                AZ_Assert(
+                    maxHeightBounds >= minHeightBounds,
+                    "Max height bounds is less than min height bounds, the height conversions below will be incorrect.");
 
-            const AZStd::vector<Physics::HeightMaterialPoint>& samples = heightfieldConfig.GetSamples();
-            AZ_Assert(samples.size() == numRows * numCols, "GetHeightsAndMaterials returned wrong sized heightfield");
+                return (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
+            }
 
-            if (!samples.empty())
+            // Converts the samples of a rectangle of the heightfield grid to the PhysX format, row by row.
+            void ConvertHeightfieldSamples(
+                const Physics::HeightfieldShapeConfiguration& heightfieldConfig, float scaleFactor,
+                int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows,
+                AZStd::vector<physx::PxHeightFieldSample>& physxSamples)
             {
-                AZStd::vector<physx::PxHeightFieldSample> physxSamples(samples.size());
+                [[maybe_unused]] constexpr uint8_t physxMaximumMaterialIndex = 0x7f;
 
-                for (int32_t row = 0; row < numRows; row++)
-                {
-                    for (int32_t col = 0; col < numCols; col++)
-                    {
-                        auto GetIndex = [numCols](int32_t row, int32_t col)
-                        {
-                            return (row * numCols) + col;
-                        };
+                const int32_t numCols = heightfieldConfig.GetNumColumns();
+                const int32_t numGridRows = heightfieldConfig.GetNumRows();
+                const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
+                const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
+                const AZStd::vector<Physics::HeightMaterialPoint>& samples = heightfieldConfig.GetSamples();
 
-                        const int32_t sampleIndex = GetIndex(row, col);
+                physxSamples.resize(numColumns * numRows);
 
-                        const Physics::HeightMaterialPoint& currentSample = samples[sampleIndex];
-                        physx::PxHeightFieldSample& currentPhysxSample = physxSamples[sampleIndex];
+                for (int32_t row = startRow; row < startRow + numRows; row++)
+                {
+                    for (int32_t col = startColumn; col < startColumn + numColumns; col++)
+                    {
+                        const Physics::HeightMaterialPoint& currentSample = samples[(row * numCols) + col];
+                        physx::PxHeightFieldSample& currentPhysxSample =
+                            physxSamples[((row - startRow) * numColumns) + (col - startColumn)];
                         AZ_Assert(currentSample.m_materialIndex < physxMaximumMaterialIndex, "MaterialIndex must be less than 128");
                         currentPhysxSample.height = azlossy_cast<physx::PxI16>(
                             AZ::GetClamp(currentSample.m_height, minHeightBounds, maxHeightBounds) * scaleFactor);
 
-                        auto [materialIndex0, materialIndex1] = GetPhysXMaterialIndicesFromHeightfieldSamples(samples, row, col, numRows, numCols);
+                        auto [materialIndex0, materialIndex1] =
+                            GetPhysXMaterialIndicesFromHeightfieldSamples(samples, row, col, numGridRows, numCols);
                         currentPhysxSample.materialIndex0 = materialIndex0;
                         currentPhysxSample.materialIndex1 = materialIndex1;
 
@@ -205,6 +198,35 @@ namespace PhysX
                         }
                     }
                 }
+            }
+        } // namespace
+
+        void CreatePxGeometryFromHeightfield(
+            Physics::HeightfieldShapeConfiguration& heightfieldConfig, physx::PxGeometryHolder& pxGeometry)
+        {
+            physx::PxHeightField* heightfield = nullptr;
+
+            const AZ::Vector2& gridSpacing = heightfieldConfig.GetGridResolution();
+
+            const int32_t numCols = heightfieldConfig.GetNumColumns();
+            const int32_t numRows = heightfieldConfig.GetNumRows();
+
+            const float rowScale = gridSpacing.GetX();
+            const float colScale = gridSpacing.GetY();
+
+            const float scaleFactor = GetHeightfieldScaleFactor(heightfieldConfig);
+            const float heightScale{ 1.0f / scaleFactor };
+
+            // Delete the cached heightfield object if it is there, and create a new one and save in the shape configuration
+            heightfieldConfig.SetCachedNativeHeightfield(nullptr);
+
+            const AZStd::vector<Physics::HeightMaterialPoint>& samples = heightfieldConfig.GetSamples();
+            AZ_Assert(samples.size() == numRows * numCols, "GetHeightsAndMaterials returned wrong sized heightfield");
+
+            if (!samples.empty())
+            {
+                AZStd::vector<physx::PxHeightFieldSample> physxSamples;
+                ConvertHeightfieldSamples(heightfieldConfig, scaleFactor, 0, 0, numCols, numRows, physxSamples);
 
                 SystemRequestsBus::BroadcastResult(heightfield, &SystemRequests::CreateHeightField, physxSamples.data(), numRows, numCols);
             }
@@ -218,6 +240,34 @@ namespace PhysX
             }
         }
 
+        bool ModifyNativeHeightfieldSamples(
+            Physics::HeightfieldShapeConfiguration& heightfieldConfig,
+            int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows)
+        {
+            auto* heightfield = static_cast<physx::PxHeightField*>(heightfieldConfig.GetCachedNativeHeightfield());
+            if (!heightfield || numColumns <= 0 || numRows <= 0 ||
+                heightfield->getNbColumns() != aznumeric_cast<physx::PxU32>(heightfieldConfig.GetNumColumns()) ||
+                heightfield->getNbRows() != aznumeric_cast<physx::PxU32>(heightfieldConfig.GetNumRows()) ||
+                startColumn < 0 || startRow < 0 ||
+                startColumn + numColumns > heightfieldConfig.GetNumColumns() || startRow + numRows > heightfieldConfig.GetNumRows())
+            {
+                return false;
+            }
+
+            AZStd::vector<physx::PxHeightFieldSample> physxSamples;
+            ConvertHeightfieldSamples(
+                heightfieldConfig, GetHeightfieldScaleFactor(heightfieldConfig), startColumn, startRow, numColumns, numRows, physxSamples);
+
+            physx::PxHeightFieldDesc desc;
+            desc.format = physx::PxHeightFieldFormat::eS16_TM;
+            desc.nbColumns = numColumns;
+            desc.nbRows = numRows;
+            desc.samples.data = physxSamples.data();
+            desc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+            return heightfield->modifySamples(startColumn, startRow, desc, true);
+        }
+
         bool CreatePxGeometryFromConfig(const Physics::ShapeConfiguration& shapeConfiguration, physx::PxGeometryHolder& pxGeometry)
         {
             if (!shapeConfiguration.m_scale.IsGreaterThan(AZ::Vector3::CreateZero()))
@@ -674,10 +724,13 @@ namespace PhysX
             return AZ::Utils::SaveObjectToFile(filePath, AZ::DataStream::ST_BINARY, &assetData, serializeContext);
         }
 
-        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream)
+        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream,
+            physx::PxCooking* cooking)
         {
-            physx::PxCooking* cooking = nullptr;
-            SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            if (!cooking)
+            {
+                SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            }
 
             physx::PxConvexMeshDesc convexDesc;
             convexDesc.points.count = vertexCount;
@@ -697,10 +750,12 @@ namespace PhysX
         }
 
         bool CookTriangleMeshToToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount,
-            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream)
+            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream, physx::PxCooking* cooking)
         {
-            physx::PxCooking* cooking = nullptr;
-            SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            if (!cooking)
+            {
+                SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            }
 
             // Validate indices size
             AZ_Error("PhysX", indexCount % 3 == 0, "Number of indices must be a multiple of 3.");
@@ -1596,6 +1651,118 @@ namespace PhysX
             return configuration;
         }
 
+        bool RefreshHeightfieldRegion(
+            AZ::EntityId entityId, Physics::HeightfieldShapeConfiguration& heightfieldConfig, AzPhysics::SimulatedBody* heightfieldBody,
+            const AZ::Aabb& dirtyRegion)
+        {
+            AZ_PROFILE_FUNCTION(Physics);
+
+            auto* staticBody = azdynamic_cast<StaticRigidBody*>(heightfieldBody);
+            if (!staticBody || staticBody->GetShapeCount() != 1 || !dirtyRegion.IsValid() || heightfieldConfig.GetSamples().empty())
+            {
+                return false;
+            }
+
+            // Anything changing the layout of the grid or its placement requires cooking a new heightfield.
+            AZ::Vector2 gridSpacing(1.0f);
+            Physics::HeightfieldProviderRequestsBus::EventResult(
+                gridSpacing, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSpacing);
+
+            int32_t numColumns = 0;
+            int32_t numRows = 0;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSize, numColumns, numRows);
+
+            float minHeightBounds = 0.0f;
+            float maxHeightBounds = 0.0f;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldHeightBounds, minHeightBounds, maxHeightBounds);
+
+            AZ::Transform transform = AZ::Transform::CreateIdentity();
+            Physics::HeightfieldProviderRequestsBus::EventResult(
+                transform, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+
+            AZ::Aabb heightfieldAabb = AZ::Aabb::CreateNull();
+            Physics::HeightfieldProviderRequestsBus::EventResult(
+                heightfieldAabb, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldAabb);
+
+            if (!gridSpacing.IsClose(heightfieldConfig.GetGridResolution()) || numColumns != heightfieldConfig.GetNumColumns() ||
+                numRows != heightfieldConfig.GetNumRows() || !AZ::IsClose(minHeightBounds, heightfieldConfig.GetMinHeightBounds()) ||
+                !AZ::IsClose(maxHeightBounds, heightfieldConfig.GetMaxHeightBounds()) || !transform.IsClose(staticBody->GetTransform()) ||
+                !heightfieldAabb.IsValid())
+            {
+                return false;
+            }
+
+            // The sample of a column and row lies at the minimum corner of the heightfield bounds, offset by that many grid spacings.
+            // The materials of a quad are stored on its upper left sample, so the row and column before the region are refreshed too.
+            const AZ::Vector2 gridMin = (AZ::Vector2(dirtyRegion.GetMin()) - AZ::Vector2(heightfieldAabb.GetMin())) / gridSpacing;
+            const AZ::Vector2 gridMax = (AZ::Vector2(dirtyRegion.GetMax()) - AZ::Vector2(heightfieldAabb.GetMin())) / gridSpacing;
+            const int32_t startColumn = AZStd::clamp(aznumeric_cast<int32_t>(floorf(gridMin.GetX())) - 1, 0, numColumns - 1);
+            const int32_t startRow = AZStd::clamp(aznumeric_cast<int32_t>(floorf(gridMin.GetY())) - 1, 0, numRows - 1);
+            const int32_t endColumn = AZStd::clamp(aznumeric_cast<int32_t>(ceilf(gridMax.GetX())), startColumn, numColumns - 1);
+            const int32_t endRow = AZStd::clamp(aznumeric_cast<int32_t>(ceilf(gridMax.GetY())), startRow, numRows - 1);
+            const int32_t regionColumns = endColumn - startColumn + 1;
+            const int32_t regionRows = endRow - startRow + 1;
+
+            AZStd::vector<Physics::HeightMaterialPoint> samples;
+            Physics::HeightfieldProviderRequestsBus::EventResult(
+                samples, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterialsInRegion,
+                startColumn, startRow, regionColumns, regionRows);
+
+            if (samples.size() != aznumeric_cast<size_t>(regionColumns * regionRows))
+            {
+                return false;
+            }
+
+            for (int32_t row = 0; row < regionRows; row++)
+            {
+                for (int32_t col = 0; col < regionColumns; col++)
+                {
+                    heightfieldConfig.ModifySample(startColumn + col, startRow + row, samples[(row * regionColumns) + col]);
+                }
+            }
+
+            // The heightfield can't be modified while a deferred simulation step might still be reading it.
+            auto* physXSystem = GetPhysXSystem();
+            if (physXSystem)
+            {
+                physXSystem->FinishPendingSimulation();
+            }
+
+            auto* pxActor = static_cast<physx::PxRigidActor*>(staticBody->GetNativePointer());
+            {
+                PHYSX_SCENE_WRITE_LOCK(pxActor->getScene());
+
+                if (!ModifyNativeHeightfieldSamples(heightfieldConfig, startColumn, startRow, regionColumns, regionRows))
+                {
+                    return false;
+                }
+
+                // PhysX only updates the bounds of the shapes using the heightfield once their geometry is set again.
+                auto* pxShape = static_cast<physx::PxShape*>(staticBody->GetShape(0)->GetNativePointer());
+                physx::PxHeightFieldGeometry geometry;
+                if (pxShape->getHeightFieldGeometry(geometry))
+                {
+                    pxShape->setGeometry(geometry);
+                }
+            }
+
+            // Drop the cached cast results that might have hit the previous samples.
+            if (physXSystem)
+            {
+                if (auto* scene = azdynamic_cast<PhysXScene*>(physXSystem->GetScene(staticBody->m_sceneOwner)))
+                {
+                    const AZ::Aabb refreshedRegion = AZ::Aabb::CreateFromMinMaxValues(
+                        dirtyRegion.GetMin().GetX(), dirtyRegion.GetMin().GetY(), heightfieldAabb.GetMin().GetZ(),
+                        dirtyRegion.GetMax().GetX(), dirtyRegion.GetMax().GetY(), heightfieldAabb.GetMax().GetZ());
+                    scene->GetQueryCache().Invalidate(AZStd::span<const AZ::Aabb>(&refreshedRegion, 1));
+                }
+            }
+
+            return true;
+        }
+
         void SetMaterialsFromHeightfieldProvider(const AZ::EntityId& heightfieldProviderId, Physics::MaterialSelection& materialSelection)
         {
             AZStd::vector<Physics::MaterialId> materialList;
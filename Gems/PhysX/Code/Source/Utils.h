@@ -26,6 +26,7 @@ namespace AzPhysics
     struct RigidBodyConfiguration;
     struct StaticRigidBodyConfiguration;
     struct StaticRigidBody;
+    struct SimulatedBody;
     class Scene;
 }
 
@@ -104,10 +105,16 @@ namespace PhysX
         bool WriteCookedMeshToFile(const AZStd::string& filePath, const AZStd::vector<AZ::u8>& physxData, 
             Physics::CookedMeshShapeConfiguration::MeshType meshType);
 
-        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream);
+        //! Cooks a convex mesh to a stream.
+        //! @param cooking The cooking interface to use, the one of the PhysX system component if nullptr. Worker threads should pass it,
+        //! rather than having it fetched from the system bus.
+        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream,
+            physx::PxCooking* cooking = nullptr);
 
+        //! Cooks a triangle mesh to a stream.
+        //! @param cooking The cooking interface to use, the one of the PhysX system component if nullptr.
         bool CookTriangleMeshToToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount,
-            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream);
+            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream, physx::PxCooking* cooking = nullptr);
 
         bool MeshDataToPxGeometry(physx::PxBase* meshData, physx::PxGeometryHolder &pxGeometry, const AZ::Vector3& scale);
 
@@ -198,6 +205,20 @@ namespace PhysX
 
         Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId);
 
+        //! Refreshes the samples of a heightfield body within a dirty region reported by its heightfield provider, in place.
+        //! @return false if the grid of the provider or its placement changed, in which case the heightfield must be recreated.
+        bool RefreshHeightfieldRegion(
+            AZ::EntityId entityId, Physics::HeightfieldShapeConfiguration& heightfieldConfig, AzPhysics::SimulatedBody* heightfieldBody,
+            const AZ::Aabb& dirtyRegion);
+
+        //! Writes a rectangle of the configuration samples to the cached native heightfield, without cooking a new one.
+        //! The samples of the rectangle must already be up to date in the configuration.
+        //! @return false if there is no cached native heightfield with the grid size of the configuration, or the rectangle is
+        //! outside of the grid.
+        bool ModifyNativeHeightfieldSamples(
+            Physics::HeightfieldShapeConfiguration& heightfieldConfig,
+            int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows);
+
         void SetMaterialsFromHeightfieldProvider(const AZ::EntityId& heightfieldProviderId, Physics::MaterialSelection& materialSelection);
 
         namespace Geometry
@@ -12,6 +12,7 @@
 #include <AzTest/AzTest.h>
 #include <AzTest/Utils.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
@@ -26,9 +27,13 @@
 #include <AzFramework/Physics/RagdollPhysicsBus.h>
 #include <PhysXCharacters/API/Ragdoll.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
+#include <Scene/PhysXScene.h>
 
 #include <PhysXTestCommon.h>
 
+AZ_CVAR_EXTERNED(bool, physx_ragdollLod);
+AZ_CVAR_EXTERNED(AZ::u32, physx_ragdollLodMaxSimulated);
+
 namespace PhysX::Benchmarks
 {
     namespace RagdollConstants
@@ -58,6 +63,15 @@ namespace PhysX::Benchmarks
             static const int NumIterations = 3;
         } // namespace BenchmarkSettings
 
+        //! Constants for the LOD test
+        namespace Lod
+        {
+            //! Distance between the ragdolls, lined up away from the viewer so they spread over all the LOD tiers.
+            static const float Spacing = 5.0f;
+            //! Maximum number of ragdolls simulated at once, the farther ones being made kinematic.
+            static const AZ::u32 MaxSimulated = 16;
+        } // namespace Lod
+
         //! Constants for setting up the washing machine
         namespace WashingMachine
         {
@@ -295,6 +309,74 @@ namespace PhysX::Benchmarks
         PhysX::Benchmarks::Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
     }
 
+    //! BM_Ragdoll_Lod - This test spawns the requested number of ragdolls in a line going away from the viewer, and drops them
+    //! on the terrain, with the ragdoll LOD either off or on with a cap on the number of simulated ragdolls.
+    //! The test will run the simulation for ~1800 game frames at 60fps.
+    BENCHMARK_DEFINE_F(PhysXCharactersRagdollBenchmarkFixture, BM_Ragdoll_Lod)(benchmark::State& state)
+    {
+        //setup some pieces for the test
+        const int numRagdolls = static_cast<const int>(state.range(0));
+        const bool lodEnabled = state.range(1) != 0;
+
+        const bool previousLodEnabled = physx_ragdollLod;
+        const AZ::u32 previousMaxSimulated = physx_ragdollLodMaxSimulated;
+        physx_ragdollLod = lodEnabled;
+        physx_ragdollLodMaxSimulated = RagdollConstants::Lod::MaxSimulated;
+
+        PhysX::PhysXScene* physXScene = azdynamic_cast<PhysX::PhysXScene*>(m_defaultScene);
+        physXScene->GetRagdollLod().SetViewerPosition(AZ::Vector3(0.0f, 0.0f, 2.0f));
+
+        //create, enable and position the ragdolls
+        AZStd::vector<PhysX::Ragdoll*> ragdolls;
+        ragdolls.reserve(numRagdolls);
+        for (int i = 0; i < numRagdolls; i++)
+        {
+            PhysX::Ragdoll* ragdoll = CreateRagdoll(m_testSceneHandle);
+            const float offset = RagdollConstants::Lod::Spacing * (i + 1);
+            const AZ::Vector3 rootSpawnPosition(offset, RagdollConstants::Lod::Spacing, 1.0f);
+            auto tPose = GetTPose(rootSpawnPosition, Physics::SimulationType::Dynamic);
+            ragdoll->EnableSimulation(tPose);
+            ragdoll->SetState(tPose);
+            ragdolls.emplace_back(ragdoll);
+        }
+
+        //setup the sub tick tracker
+        PhysX::Benchmarks::Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //setup the frame timer tracker
+        AZStd::vector<double> tickTimes;
+        tickTimes.reserve(RagdollConstants::GameFramesToSimulate);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RagdollConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = PhysX::Benchmarks::Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+
+        //report how many ragdolls ended at each tier
+        const SceneRagdollLod& ragdollLod = physXScene->GetRagdollLod();
+        state.counters["Full"] = ragdollLod.GetRagdollCount(RagdollLodLevel::Full);
+        state.counters["Reduced"] = ragdollLod.GetRagdollCount(RagdollLodLevel::Reduced);
+        state.counters["Frozen"] = ragdollLod.GetRagdollCount(RagdollLodLevel::Frozen);
+        state.counters["Kinematic"] = ragdollLod.GetRagdollCount(RagdollLodLevel::Kinematic);
+
+        physXScene->GetRagdollLod().ClearViewerPosition();
+        physx_ragdollLod = previousLodEnabled;
+        physx_ragdollLodMaxSimulated = previousMaxSimulated;
+
+        //get the P50, P90, P99 percentiles
+        PhysX::Benchmarks::Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        PhysX::Benchmarks::Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+    }
+
     BENCHMARK_REGISTER_F(PhysXCharactersRagdollBenchmarkFixture, BM_Ragdoll_AtRest)
         ->RangeMultiplier(RagdollConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({
@@ -311,6 +393,16 @@ namespace PhysX::Benchmarks
         ->Unit(benchmark::kMillisecond)
         ->Iterations(RagdollConstants::BenchmarkSettings::NumIterations)
         ;
+
+    BENCHMARK_REGISTER_F(PhysXCharactersRagdollBenchmarkFixture, BM_Ragdoll_Lod)
+        ->RangeMultiplier(RagdollConstants::BenchmarkSettings::RangeMultipler)
+        ->Ranges({
+            {RagdollConstants::BenchmarkSettings::StartRange, RagdollConstants::BenchmarkSettings::EndRange},
+            {0, 1}
+            })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RagdollConstants::BenchmarkSettings::NumIterations)
+        ;
 } // namespace PhysX::Benchmarks
 
 #endif // #ifdef HAVE_BENCHMARK
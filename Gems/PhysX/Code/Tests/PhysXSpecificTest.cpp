@@ -27,6 +27,7 @@
 
 #include <RigidBodyStatic.h>
 #include <SphereColliderComponent.h>
+#include <System/PhysXSystem.h>
 #include <Utils.h>
 
 #include <PhysX/MathConversion.h>
@@ -816,6 +817,36 @@ namespace PhysX
         EXPECT_NE(rigidBody->GetPosition(), initialPosition);
     }
 
+    TEST_F(PhysXSpecificTest, MeshCookingService_AsyncCooking_MatchesSynchronousCooking)
+    {
+        MeshCookingService& cookingService = GetPhysXSystem()->GetMeshCookingService();
+        cookingService.ClearMemoryCache();
+
+        VertexIndexData cubeMeshData = TestUtils::GenerateCubeMeshData(3.0f);
+        CookedMeshFuture future = cookingService.CookTriangleMeshAsync(cubeMeshData.first, cubeMeshData.second);
+        ASSERT_TRUE(future != nullptr);
+        EXPECT_TRUE(future->Succeeded());
+        EXPECT_TRUE(future->IsReady());
+        EXPECT_EQ(future->GetMeshType(), Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh);
+
+        // Cooking the same mesh again returns the cached result.
+        CookedMeshFuture cachedFuture = cookingService.CookTriangleMeshAsync(cubeMeshData.first, cubeMeshData.second);
+        EXPECT_EQ(cachedFuture, future);
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_TRUE(cookingService.CookTriangleMesh(
+            cubeMeshData.first.data(), static_cast<AZ::u32>(cubeMeshData.first.size()),
+            cubeMeshData.second.data(), static_cast<AZ::u32>(cubeMeshData.second.size()), cookedData));
+        EXPECT_EQ(cookedData, future->GetCookedData());
+
+        // The convex of the same vertices is cooked separately.
+        CookedMeshFuture convexFuture = cookingService.CookConvexMeshAsync(cubeMeshData.first);
+        EXPECT_NE(convexFuture, future);
+        EXPECT_TRUE(convexFuture->Succeeded());
+
+        cookingService.WaitForPendingCookings();
+    }
+
     TEST_F(PhysXSpecificTest, RigidBody_TriangleMeshRigidBodyCreatedFromCookedMesh_CachedMeshObjectCreated)
     {
         // Generate input data
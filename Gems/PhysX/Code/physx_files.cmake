@@ -122,6 +122,12 @@ set(FILES
     Source/Scene/PhysXSceneSimulationEventCallback.cpp
     Source/Scene/PhysXSceneSimulationFilterCallback.h
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
+    Source/Scene/PhysXSceneQueryCache.h
+    Source/Scene/PhysXSceneQueryCache.cpp
+    Source/Scene/PhysXSceneRagdollLod.h
+    Source/Scene/PhysXSceneRagdollLod.cpp
+    Source/Scene/PhysXSceneTransformSync.h
+    Source/Scene/PhysXSceneTransformSync.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
     Source/System/PhysXCookingParams.h
@@ -132,8 +138,12 @@ set(FILES
     Source/System/PhysXJob.h
     Source/System/PhysXJointInterface.h
     Source/System/PhysXJointInterface.cpp
+    Source/System/PhysXMeshCookingService.h
+    Source/System/PhysXMeshCookingService.cpp
     Source/System/PhysXSdkCallbacks.h
     Source/System/PhysXSdkCallbacks.cpp
     Source/System/PhysXSystem.h
     Source/System/PhysXSystem.cpp
+    Source/System/PhysXTaskGraphCpuDispatcher.h
+    Source/System/PhysXTaskGraphCpuDispatcher.cpp
 )
@@ -523,21 +523,12 @@ namespace PhysXDebug
                 if (!m_linePoints.empty())
                 {
                     AZ_Assert(m_linePoints.size() == m_lineColors.size(), "Lines: Expected an equal number of points to colors.");
-                    const size_t minLen = AZ::GetMin(m_linePoints.size(), m_lineColors.size());
-                    for (size_t i = 0; i < minLen; i += 2)
-                    {
-                        debugDisplay->DrawLine(m_linePoints[i], m_linePoints[i + 1], m_lineColors[i].GetAsVector4(), m_lineColors[i + 1].GetAsVector4());
-                    }
+                    debugDisplay->DrawColoredLines(m_linePoints, m_lineColors);
                 }
                 if (!m_trianglePoints.empty())
                 {
                     AZ_Assert(m_trianglePoints.size() == m_triangleColors.size(), "Triangles: Expected an equal number of points to colors.");
-                    const size_t minLen = AZ::GetMin(m_trianglePoints.size(), m_triangleColors.size());
-                    for (size_t i = 0; i < minLen; i += 3)
-                    {
-                        debugDisplay->SetColor(m_triangleColors[i]);
-                        debugDisplay->DrawTri(m_trianglePoints[i], m_trianglePoints[i + 1], m_trianglePoints[i + 2]);
-                    }
+                    debugDisplay->DrawColoredTriangles(m_trianglePoints, m_triangleColors);
                 }
             }
         }
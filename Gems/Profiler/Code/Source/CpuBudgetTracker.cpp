@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuBudgetTracker.h>
+
+#include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
+
+namespace Profiler
+{
+    CpuBudgetTracker::BudgetHistory::BudgetHistory()
+    {
+        m_frameMs.set_capacity(FrameHistorySize);
+    }
+
+    void CpuBudgetTracker::ProcessFrame(const TimeRegionMap& timeRegionMap)
+    {
+        // Sum the exclusive ticks per budget, by subtracting the time of each region from the time of its parent region
+        AZStd::unordered_map<AZStd::string, AZStd::sys_time_t> exclusiveTicks;
+        AZStd::vector<const CachedTimeRegion*> threadRegions;
+        AZStd::vector<const CachedTimeRegion*> regionStack;
+        for (const auto& [threadId, threadRegionMap] : timeRegionMap)
+        {
+            threadRegions.clear();
+            for (const auto& [regionName, regions] : threadRegionMap)
+            {
+                for (const CachedTimeRegion& region : regions)
+                {
+                    threadRegions.push_back(&region);
+                }
+            }
+
+            AZStd::sort(threadRegions.begin(), threadRegions.end(), [](const CachedTimeRegion* lhs, const CachedTimeRegion* rhs)
+            {
+                return (lhs->m_startTick != rhs->m_startTick) ? (lhs->m_startTick < rhs->m_startTick) : (lhs->m_stackDepth < rhs->m_stackDepth);
+            });
+
+            regionStack.clear();
+            for (const CachedTimeRegion* region : threadRegions)
+            {
+                while (!regionStack.empty() && regionStack.back()->m_stackDepth >= region->m_stackDepth)
+                {
+                    regionStack.pop_back();
+                }
+
+                const AZStd::sys_time_t regionTicks = region->m_endTick - region->m_startTick;
+                exclusiveTicks[region->m_groupRegionName.m_groupName] += regionTicks;
+                if (!regionStack.empty() && regionStack.back()->m_stackDepth + 1 == region->m_stackDepth)
+                {
+                    exclusiveTicks[regionStack.back()->m_groupRegionName.m_groupName] -= regionTicks;
+                }
+                regionStack.push_back(region);
+            }
+        }
+
+        struct ExceededBudget
+        {
+            AZStd::string m_budgetName;
+            float m_frameMs;
+            float m_limitMs;
+        };
+        AZStd::vector<ExceededBudget> exceededBudgets;
+
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+
+            for (const auto& [budgetName, ticks] : exclusiveTicks)
+            {
+                m_budgets.try_emplace(budgetName);
+            }
+
+            // Budgets without any regions this frame record a zero, so the history stays aligned across budgets
+            const float ticksToMs = 1000.0f / static_cast<float>(AZStd::GetTimeTicksPerSecond());
+            for (auto& [budgetName, history] : m_budgets)
+            {
+                const auto ticksIter = exclusiveTicks.find(budgetName);
+                const float frameMs = (ticksIter != exclusiveTicks.end()) ? static_cast<float>(ticksIter->second) * ticksToMs : 0.0f;
+                history.m_frameMs.push_back(frameMs);
+
+                // Only report the frame a budget goes over its limit, not every frame it stays over
+                const bool isOverLimit = history.m_limitMs > 0.0f && frameMs > history.m_limitMs;
+                if (isOverLimit && !history.m_isOverLimit)
+                {
+                    exceededBudgets.push_back({ budgetName, frameMs, history.m_limitMs });
+                }
+                history.m_isOverLimit = isOverLimit;
+            }
+        }
+
+        for (const ExceededBudget& exceededBudget : exceededBudgets)
+        {
+            AZ_Warning("Profiler", false, "Budget '%s' took %.2f ms this frame, over its limit of %.2f ms",
+                exceededBudget.m_budgetName.c_str(), exceededBudget.m_frameMs, exceededBudget.m_limitMs);
+            AZ::Debug::ProfilerNotificationBus::Broadcast(&AZ::Debug::ProfilerNotificationBus::Events::OnBudgetExceeded,
+                exceededBudget.m_budgetName, exceededBudget.m_frameMs, exceededBudget.m_limitMs);
+        }
+    }
+
+    void CpuBudgetTracker::SetBudgetLimit(const AZStd::string& budgetName, float limitMs)
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        BudgetHistory& history = m_budgets[budgetName];
+        history.m_limitMs = AZStd::max(limitMs, 0.0f);
+        history.m_isOverLimit = false;
+    }
+
+    bool CpuBudgetTracker::GetBudgetStats(const AZStd::string& budgetName, BudgetStats& stats) const
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        const auto iter = m_budgets.find(budgetName);
+        if (iter == m_budgets.end() || iter->second.m_frameMs.empty())
+        {
+            return false;
+        }
+
+        stats = CalculateStats(iter->second);
+        return true;
+    }
+
+    AZStd::unordered_map<AZStd::string, CpuBudgetTracker::BudgetStats> CpuBudgetTracker::GetAllBudgetStats() const
+    {
+        AZStd::unordered_map<AZStd::string, BudgetStats> allStats;
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        for (const auto& [budgetName, history] : m_budgets)
+        {
+            if (!history.m_frameMs.empty())
+            {
+                allStats.emplace(budgetName, CalculateStats(history));
+            }
+        }
+        return allStats;
+    }
+
+    void CpuBudgetTracker::Reset()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        for (auto& [budgetName, history] : m_budgets)
+        {
+            history.m_frameMs.clear();
+            history.m_isOverLimit = false;
+        }
+    }
+
+    CpuBudgetTracker::BudgetStats CpuBudgetTracker::CalculateStats(const BudgetHistory& history) const
+    {
+        AZStd::vector<float> sortedFrameMs(history.m_frameMs.begin(), history.m_frameMs.end());
+        AZStd::sort(sortedFrameMs.begin(), sortedFrameMs.end());
+
+        const auto percentile = [&sortedFrameMs](float fraction)
+        {
+            const size_t index = static_cast<size_t>(fraction * static_cast<float>(sortedFrameMs.size() - 1) + 0.5f);
+            return sortedFrameMs[index];
+        };
+
+        BudgetStats stats;
+        stats.m_lastFrameMs = history.m_frameMs.back();
+        stats.m_p50Ms = percentile(0.50f);
+        stats.m_p95Ms = percentile(0.95f);
+        stats.m_p99Ms = percentile(0.99f);
+        stats.m_limitMs = history.m_limitMs;
+        return stats;
+    }
+} // namespace Profiler
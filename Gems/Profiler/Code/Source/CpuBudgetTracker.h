@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <CpuProfiler.h>
+
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace Profiler
+{
+    //! Sums the exclusive time spent in each budget per frame from the profiled time regions, where the budget of a region is its group.
+    //! A rolling history of the last frames is kept per budget to report percentiles. When a budget has a limit configured and a frame
+    //! goes over it, a warning is logged and ProfilerNotifications::OnBudgetExceeded is broadcast, so the spike can be forwarded to metrics.
+    class CpuBudgetTracker
+    {
+    public:
+        //! Number of frames the percentiles are computed over.
+        static constexpr AZStd::size_t FrameHistorySize = 300;
+
+        struct BudgetStats
+        {
+            float m_lastFrameMs = 0.0f;
+            float m_p50Ms = 0.0f;
+            float m_p95Ms = 0.0f;
+            float m_p99Ms = 0.0f;
+            float m_limitMs = 0.0f;
+        };
+
+        //! Accounts the time regions of a frame, summed over all threads.
+        void ProcessFrame(const TimeRegionMap& timeRegionMap);
+
+        //! Sets the per frame limit of a budget, a limit of 0 or less removes it.
+        void SetBudgetLimit(const AZStd::string& budgetName, float limitMs);
+
+        //! Gets the stats of a budget, returns false when no region of the budget got profiled yet.
+        bool GetBudgetStats(const AZStd::string& budgetName, BudgetStats& stats) const;
+
+        //! Gets the stats of every budget that got profiled.
+        AZStd::unordered_map<AZStd::string, BudgetStats> GetAllBudgetStats() const;
+
+        //! Forgets the frame history, while keeping the limits.
+        void Reset();
+
+    private:
+        struct BudgetHistory
+        {
+            BudgetHistory();
+
+            AZStd::ring_buffer<float> m_frameMs;
+            float m_limitMs = 0.0f;
+            bool m_isOverLimit = false;
+        };
+
+        BudgetStats CalculateStats(const BudgetHistory& history) const;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZStd::string, BudgetHistory> m_budgets;
+    };
+} // namespace Profiler
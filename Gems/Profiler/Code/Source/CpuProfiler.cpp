@@ -7,6 +7,8 @@
  */
 
 #include <CpuProfiler.h>
+#include <CpuBudgetTracker.h>
+#include <CpuProfilerStream.h>
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -56,6 +58,13 @@ namespace Profiler
 
     // --- CpuProfiler ---
 
+    CpuProfiler::CpuProfiler()
+        : m_budgetTracker(AZStd::make_unique<CpuBudgetTracker>())
+    {
+    }
+
+    CpuProfiler::~CpuProfiler() = default;
+
     void CpuProfiler::Init()
     {
         AZ::Interface<AZ::Debug::Profiler>::Register(this);
@@ -78,6 +87,12 @@ namespace Profiler
         AZStd::unique_lock<AZStd::shared_mutex> shutdownLock(m_shutdownMutex);
 
         m_enabled = false;
+        m_streaming = false;
+        if (m_streamWriter)
+        {
+            m_streamWriter->Close();
+            m_streamWriter.reset();
+        }
 
         // Cleanup all TLS
         m_registeredThreads.clear();
@@ -93,7 +108,7 @@ namespace Profiler
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
-            if (m_enabled)
+            if (m_enabled || m_streaming)
             {
                 // Lazy initialization, creates an instance of the Thread local data if it's not created, and registers it
                 RegisterThreadStorage();
@@ -113,9 +128,11 @@ namespace Profiler
         if (m_shutdownMutex.try_lock_shared())
         {
             // guard against enabling mid-marker
-            if (m_enabled && ms_threadLocalStorage != nullptr)
+            const bool enabled = m_enabled;
+            const bool streaming = m_streaming;
+            if ((enabled || streaming) && ms_threadLocalStorage != nullptr)
             {
-                ms_threadLocalStorage->RegionStackPopBack();
+                ms_threadLocalStorage->RegionStackPopBack(enabled, streaming);
             }
 
             m_shutdownMutex.unlock_shared();
@@ -201,8 +218,82 @@ namespace Profiler
         return m_enabled;
     }
 
+    CpuBudgetTracker& CpuProfiler::GetBudgetTracker()
+    {
+        return *m_budgetTracker;
+    }
+
+    const CpuBudgetTracker& CpuProfiler::GetBudgetTracker() const
+    {
+        return *m_budgetTracker;
+    }
+
+    bool CpuProfiler::BeginStreaming(const char* streamFilePath)
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+        if (m_streaming)
+        {
+            AZ_TracePrintf("Profiler", "Attempting to start streaming while the profiler is already streaming\n");
+            return false;
+        }
+
+        auto streamWriter = AZStd::make_unique<CpuProfilerStreamWriter>();
+        if (!streamWriter->Open(streamFilePath))
+        {
+            return false;
+        }
+
+        // Skip the regions that got streamed by an earlier session
+        for (auto& threadLocal : m_registeredThreads)
+        {
+            threadLocal->m_streamRingRead = threadLocal->m_streamRingWrite.load();
+        }
+
+        m_streamWriter = AZStd::move(streamWriter);
+        m_streaming = true;
+        AZ_TracePrintf("Profiler", "Streaming started to '%s'\n", streamFilePath);
+        return true;
+    }
+
+    void CpuProfiler::EndStreaming()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+        if (!m_streaming)
+        {
+            return;
+        }
+
+        m_streaming = false;
+        for (auto& threadLocal : m_registeredThreads)
+        {
+            threadLocal->DrainStreamedRegions(*m_streamWriter);
+        }
+        m_streamWriter->Close();
+        m_streamWriter.reset();
+        AZ_TracePrintf("Profiler", "Streaming ended\n");
+    }
+
+    bool CpuProfiler::IsStreaming() const
+    {
+        return m_streaming;
+    }
+
     void CpuProfiler::OnSystemTick()
     {
+        if (m_streaming)
+        {
+            // Stream the regions that completed since the last tick
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+            if (m_streamWriter)
+            {
+                for (auto& threadLocal : m_registeredThreads)
+                {
+                    threadLocal->DrainStreamedRegions(*m_streamWriter);
+                }
+                m_streamWriter->Flush();
+            }
+        }
+
         if (!m_enabled)
         {
             return;
@@ -237,6 +328,9 @@ namespace Profiler
             return thread->m_deleteFlag.load();
         });
 
+        // Account the time of the collected frame per budget
+        m_budgetTracker->ProcessFrame(newMap);
+
         // Update our saved time regions to the last frame's collected data
         m_timeRegionMap = AZStd::move(newMap);
     }
@@ -288,7 +382,7 @@ namespace Profiler
         m_timeRegionStack.back().m_startTick = AZStd::GetTimeNowTicks();
     }
 
-    void CpuTimingLocalStorage::RegionStackPopBack()
+    void CpuTimingLocalStorage::RegionStackPopBack(bool cacheRegion, bool streamRegion)
     {
         // Early out when the stack is empty, this might happen when the profiler was enabled while the thread encountered profiling markers
         if (m_timeRegionStack.empty())
@@ -310,7 +404,46 @@ namespace Profiler
         m_stackLevel--;
 
         // Add an entry to the cached region
-        AddCachedRegion(back);
+        if (cacheRegion)
+        {
+            AddCachedRegion(back);
+        }
+
+        if (streamRegion)
+        {
+            PushStreamedRegion(back);
+        }
+    }
+
+    void CpuTimingLocalStorage::PushStreamedRegion(const CachedTimeRegion& timeRegion)
+    {
+        const uint32_t write = m_streamRingWrite.load(AZStd::memory_order_relaxed);
+        if (write - m_streamRingRead.load(AZStd::memory_order_acquire) >= StreamRingSize)
+        {
+            // The profiler's tick didn't drain the ring buffer in time, drop the region instead of blocking
+            m_droppedStreamedRegions.fetch_add(1, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        m_streamRing[write & (StreamRingSize - 1)] = timeRegion;
+        m_streamRingWrite.store(write + 1, AZStd::memory_order_release);
+    }
+
+    void CpuTimingLocalStorage::DrainStreamedRegions(CpuProfilerStreamWriter& streamWriter)
+    {
+        const size_t threadId = AZStd::hash<AZStd::thread_id>{}(m_executingThreadId);
+        const uint32_t write = m_streamRingWrite.load(AZStd::memory_order_acquire);
+        uint32_t read = m_streamRingRead.load(AZStd::memory_order_relaxed);
+        for (; read != write; ++read)
+        {
+            streamWriter.WriteRegion(threadId, m_streamRing[read & (StreamRingSize - 1)]);
+        }
+        m_streamRingRead.store(read, AZStd::memory_order_release);
+
+        if (const uint32_t droppedRegions = m_droppedStreamedRegions.exchange(0, AZStd::memory_order_relaxed); droppedRegions > 0)
+        {
+            AZ_Warning("Profiler", false, "%u streamed profiling regions of a thread were dropped, the ring buffer was full", droppedRegions);
+        }
     }
 
     // Gets called when region ends and all data is set
@@ -13,16 +13,21 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/ring_buffer.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_refcount.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 
 namespace Profiler
 {
+    class CpuBudgetTracker;
+    class CpuProfilerStreamWriter;
+
     //! Structure that is used to cache a timed region into the thread's local storage.
     struct CachedTimeRegion
     {
@@ -79,7 +84,13 @@ namespace Profiler
         void RegionStackPushBack(CachedTimeRegion& timeRegion);
 
         // Pops a region from the stack, gets called each time a region ends
-        void RegionStackPopBack();
+        void RegionStackPopBack(bool cacheRegion, bool streamRegion);
+
+        // Adds a completed region to the stream ring buffer, drops it when the ring buffer is full. Only called by the owning thread.
+        void PushStreamedRegion(const CachedTimeRegion& timeRegion);
+
+        // Writes the regions in the stream ring buffer to the stream writer. Only called by the CpuProfiler's tick.
+        void DrainStreamedRegions(CpuProfilerStreamWriter& streamWriter);
 
         // Add a new cached time region. If the stack is empty, flush all entries to the cached map
         void AddCachedRegion(const CachedTimeRegion& timeRegionCached);
@@ -118,6 +129,17 @@ namespace Profiler
 
         // Keeps track of the first time cached data limit was reached.
         bool m_cachedDataLimitReached = false;
+
+        // Size of the stream ring buffer, must be a power of two
+        static constexpr uint32_t StreamRingSize = 4096u;
+        static_assert((StreamRingSize & (StreamRingSize - 1)) == 0, "StreamRingSize must be a power of two");
+
+        // Completed regions of the always-on mode, written by the owning thread and read by the CpuProfiler's tick.
+        // The read and write positions only ever increase, so the ring buffer needs neither locks nor allocations.
+        AZStd::array<CachedTimeRegion, StreamRingSize> m_streamRing;
+        AZStd::atomic<uint32_t> m_streamRingWrite{ 0u };
+        AZStd::atomic<uint32_t> m_streamRingRead{ 0u };
+        AZStd::atomic<uint32_t> m_droppedStreamedRegions{ 0u };
     };
 
     //! CpuProfiler will keep track of the registered threads, and
@@ -133,8 +155,8 @@ namespace Profiler
         AZ_RTTI(CpuProfiler, "{10E9D394-FC83-4B45-B2B8-807C6BF07BF0}", AZ::Debug::Profiler);
         AZ_CLASS_ALLOCATOR(CpuProfiler, AZ::SystemAllocator, 0);
 
-        CpuProfiler() = default;
-        ~CpuProfiler() = default;
+        CpuProfiler();
+        ~CpuProfiler();
 
         //! Registers/un-registers the AZ::Debug::Profiler instance to the interface
         void Init();
@@ -159,6 +181,17 @@ namespace Profiler
         void SetProfilerEnabled(bool enabled);
         bool IsProfilerEnabled() const;
 
+        //! Get the per budget frame time accounting, which is updated each frame while the profiler is enabled
+        CpuBudgetTracker& GetBudgetTracker();
+        const CpuBudgetTracker& GetBudgetTracker() const;
+
+        //! Starting/ending the always-on mode, which streams the time regions to a file without locking or allocating on the profiled threads.
+        //! Each thread records its completed regions in a fixed size ring buffer, which the system tick drains into the stream file.
+        //! The always-on mode runs independently of the regular profiling and the continuous captures.
+        bool BeginStreaming(const char* streamFilePath);
+        void EndStreaming();
+        bool IsStreaming() const;
+
         //! AZ::SystemTickBus::Handler overrides
         //! When fired, the profiler collects all profiling data from registered threads and updates
         //! m_timeRegionMap so that the next frame has up-to-date profiling data.
@@ -185,6 +218,13 @@ namespace Profiler
         // Enable/Disables the threads from profiling
         AZStd::atomic_bool m_enabled = false;
 
+        // Enable/Disables the always-on mode
+        AZStd::atomic_bool m_streaming = false;
+        AZStd::unique_ptr<CpuProfilerStreamWriter> m_streamWriter;
+
+        // Sums the exclusive time per budget of each collected frame
+        AZStd::unique_ptr<CpuBudgetTracker> m_budgetTracker;
+
         // This lock will only be contested when the CpuProfiler's Shutdown() method has been called
         AZStd::shared_mutex m_shutdownMutex;
 
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuProfilerStream.h>
+
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+namespace Profiler
+{
+    // --- CpuProfilerStreamWriter ---
+
+    bool CpuProfilerStreamWriter::Open(const char* filePath)
+    {
+        Close();
+
+        if (!m_file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to open the cpu profiler stream file '%s'", filePath);
+            return false;
+        }
+
+        Append(StreamMagic);
+        Append(StreamVersion);
+        Append(static_cast<int64_t>(AZStd::GetTimeTicksPerSecond()));
+        Flush();
+        return true;
+    }
+
+    void CpuProfilerStreamWriter::Close()
+    {
+        if (m_file.IsOpen())
+        {
+            Flush();
+            m_file.Close();
+        }
+        m_buffer.clear();
+        m_nameIds.clear();
+    }
+
+    bool CpuProfilerStreamWriter::IsOpen() const
+    {
+        return m_file.IsOpen();
+    }
+
+    void CpuProfilerStreamWriter::WriteRegion(size_t threadId, const CachedTimeRegion& timeRegion)
+    {
+        const uint32_t groupId = GetNameId(timeRegion.m_groupRegionName.m_groupName);
+        const uint32_t regionId = GetNameId(timeRegion.m_groupRegionName.m_regionName);
+
+        Append(RecordType::Region);
+        Append(static_cast<uint64_t>(threadId));
+        Append(groupId);
+        Append(regionId);
+        Append(timeRegion.m_stackDepth);
+        Append(static_cast<int64_t>(timeRegion.m_startTick));
+        Append(static_cast<int64_t>(timeRegion.m_endTick));
+
+        if (m_buffer.size() >= FlushThreshold)
+        {
+            Flush();
+        }
+    }
+
+    void CpuProfilerStreamWriter::Flush()
+    {
+        if (m_file.IsOpen() && !m_buffer.empty())
+        {
+            m_file.Write(m_buffer.data(), m_buffer.size());
+            m_file.Flush();
+        }
+        m_buffer.clear();
+    }
+
+    uint32_t CpuProfilerStreamWriter::GetNameId(const char* name)
+    {
+        // Names are assumed to be global strings (see CachedTimeRegion::GroupRegionName), so they are identified by their address
+        const auto [iter, inserted] = m_nameIds.emplace(name, aznumeric_cast<uint32_t>(m_nameIds.size()));
+        if (inserted)
+        {
+            const size_t nameLength = name ? AZStd::min(strlen(name), static_cast<size_t>(AZStd::numeric_limits<uint16_t>::max())) : 0;
+            Append(RecordType::Name);
+            Append(iter->second);
+            Append(static_cast<uint16_t>(nameLength));
+            m_buffer.insert(m_buffer.end(), reinterpret_cast<const uint8_t*>(name), reinterpret_cast<const uint8_t*>(name) + nameLength);
+        }
+        return iter->second;
+    }
+
+    template<typename T>
+    void CpuProfilerStreamWriter::Append(const T& value)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    // --- Chrome trace conversion ---
+
+    namespace StreamInternal
+    {
+        class StreamReader
+        {
+        public:
+            explicit StreamReader(const AZStd::vector<uint8_t>& data)
+                : m_data(data)
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (m_offset + sizeof(T) > m_data.size())
+                {
+                    return false;
+                }
+                memcpy(&value, m_data.data() + m_offset, sizeof(T));
+                m_offset += sizeof(T);
+                return true;
+            }
+
+            bool ReadString(size_t length, AZStd::string& value)
+            {
+                if (m_offset + length > m_data.size())
+                {
+                    return false;
+                }
+                value.assign(reinterpret_cast<const char*>(m_data.data() + m_offset), length);
+                m_offset += length;
+                return true;
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_offset >= m_data.size();
+            }
+
+        private:
+            const AZStd::vector<uint8_t>& m_data;
+            size_t m_offset = 0;
+        };
+
+        void AppendEscapedJsonString(AZStd::string& output, const AZStd::string& value)
+        {
+            output += '"';
+            for (const char character : value)
+            {
+                switch (character)
+                {
+                case '"':
+                    output += "\\\"";
+                    break;
+                case '\\':
+                    output += "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(character) < 0x20)
+                    {
+                        output += AZStd::string::format("\\u%04x", static_cast<unsigned char>(character));
+                    }
+                    else
+                    {
+                        output += character;
+                    }
+                    break;
+                }
+            }
+            output += '"';
+        }
+    } // namespace StreamInternal
+
+    bool ConvertCpuProfilerStreamToChromeTrace(const char* streamFilePath, const char* traceFilePath)
+    {
+        const AZ::IO::SystemFile::SizeType streamSize = AZ::IO::SystemFile::Length(streamFilePath);
+        AZStd::vector<uint8_t> streamData(streamSize);
+        if (streamSize == 0 || AZ::IO::SystemFile::Read(streamFilePath, streamData.data()) != streamSize)
+        {
+            AZ_Warning("Profiler", false, "Failed to read the cpu profiler stream file '%s'", streamFilePath);
+            return false;
+        }
+
+        StreamInternal::StreamReader reader(streamData);
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        int64_t ticksPerSecond = 0;
+        if (!reader.Read(magic) || !reader.Read(version) || !reader.Read(ticksPerSecond) ||
+            magic != CpuProfilerStreamWriter::StreamMagic || version != CpuProfilerStreamWriter::StreamVersion || ticksPerSecond <= 0)
+        {
+            AZ_Warning("Profiler", false, "'%s' is not a valid cpu profiler stream file", streamFilePath);
+            return false;
+        }
+
+        // Chrome trace timestamps are in microseconds, the absolute ticks are kept so that other traces on the same clock line up,
+        // like the GPU pass profiler traces of the render pipelines
+        const double ticksToMicroseconds = 1000000.0 / static_cast<double>(ticksPerSecond);
+
+        AZStd::unordered_map<uint32_t, AZStd::string> names;
+        AZStd::string trace = "{\"traceEvents\":[";
+        bool isFirstEvent = true;
+
+        while (!reader.IsAtEnd())
+        {
+            CpuProfilerStreamWriter::RecordType recordType;
+            if (!reader.Read(recordType))
+            {
+                break;
+            }
+
+            if (recordType == CpuProfilerStreamWriter::RecordType::Name)
+            {
+                uint32_t nameId = 0;
+                uint16_t nameLength = 0;
+                AZStd::string name;
+                if (!reader.Read(nameId) || !reader.Read(nameLength) || !reader.ReadString(nameLength, name))
+                {
+                    break;
+                }
+                names[nameId] = AZStd::move(name);
+            }
+            else if (recordType == CpuProfilerStreamWriter::RecordType::Region)
+            {
+                uint64_t threadId = 0;
+                uint32_t groupId = 0;
+                uint32_t regionId = 0;
+                uint16_t stackDepth = 0;
+                int64_t startTick = 0;
+                int64_t endTick = 0;
+                if (!reader.Read(threadId) || !reader.Read(groupId) || !reader.Read(regionId) || !reader.Read(stackDepth) ||
+                    !reader.Read(startTick) || !reader.Read(endTick))
+                {
+                    break;
+                }
+
+                if (!isFirstEvent)
+                {
+                    trace += ',';
+                }
+                isFirstEvent = false;
+
+                trace += "{\"name\":";
+                StreamInternal::AppendEscapedJsonString(trace, names[regionId]);
+                trace += ",\"cat\":";
+                StreamInternal::AppendEscapedJsonString(trace, names[groupId]);
+                trace += AZStd::string::format(",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%llu}",
+                    static_cast<double>(startTick) * ticksToMicroseconds,
+                    static_cast<double>(endTick - startTick) * ticksToMicroseconds,
+                    static_cast<unsigned long long>(threadId));
+            }
+            else
+            {
+                AZ_Warning("Profiler", false, "Unknown record type %u in the cpu profiler stream file '%s', the rest of the stream is skipped",
+                    static_cast<uint32_t>(recordType), streamFilePath);
+                break;
+            }
+        }
+
+        trace += "]}";
+
+        AZ::IO::SystemFile traceFile;
+        if (!traceFile.Open(traceFilePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to open the trace file '%s'", traceFilePath);
+            return false;
+        }
+        const bool written = traceFile.Write(trace.data(), trace.size()) == trace.size();
+        traceFile.Close();
+        return written;
+    }
+} // namespace Profiler
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <CpuProfiler.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Profiler
+{
+    //! Writes the time regions recorded by the always-on mode of the CpuProfiler to a file, in a compact binary format.
+    //! The stream starts with a header (magic, version and tick frequency), followed by records that each start with a one byte type:
+    //! - Name records hold the id, length and characters of a group or region name, and are written the first time a name is used.
+    //! - Region records hold the thread id, the group and region name ids, the stack depth and the start and end ticks of a time region.
+    //! Use ConvertCpuProfilerStreamToChromeTrace to turn a stream into a trace that can be loaded by chrome://tracing or Perfetto.
+    class CpuProfilerStreamWriter
+    {
+    public:
+        static constexpr uint32_t StreamMagic = 0x5350434F; // 'OCPS'
+        static constexpr uint32_t StreamVersion = 1;
+
+        enum class RecordType : uint8_t
+        {
+            Name = 0,
+            Region = 1
+        };
+
+        //! Creates the stream file and writes the stream header.
+        bool Open(const char* filePath);
+        void Close();
+        bool IsOpen() const;
+
+        //! Buffers a completed time region of the given thread.
+        void WriteRegion(size_t threadId, const CachedTimeRegion& timeRegion);
+
+        //! Writes the buffered records to the file.
+        void Flush();
+
+    private:
+        static constexpr size_t FlushThreshold = 64 * 1024;
+
+        uint32_t GetNameId(const char* name);
+
+        template<typename T>
+        void Append(const T& value);
+
+        AZ::IO::SystemFile m_file;
+        AZStd::vector<uint8_t> m_buffer;
+        AZStd::unordered_map<const char*, uint32_t> m_nameIds;
+    };
+
+    //! Converts a stream written by the CpuProfilerStreamWriter to the Chrome trace event format, which Perfetto can load as well.
+    bool ConvertCpuProfilerStreamToChromeTrace(const char* streamFilePath, const char* traceFilePath);
+} // namespace Profiler
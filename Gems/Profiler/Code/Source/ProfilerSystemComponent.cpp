@@ -7,7 +7,10 @@
  */
 
 #include <ProfilerSystemComponent.h>
+#include <CpuBudgetTracker.h>
+#include <CpuProfilerStream.h>
 
+#include <AzCore/Console/ConsoleTypeHelpers.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
@@ -89,6 +92,23 @@ namespace Profiler
         return saveResult.IsSuccess();
     }
 
+    void ProfilerConvertStreamToChromeTrace(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() != 2)
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "Usage: ProfilerConvertStreamToChromeTrace <stream file> <trace file>");
+            return;
+        }
+
+        const AZStd::string streamFilePath(arguments[0]);
+        const AZStd::string traceFilePath(arguments[1]);
+        if (ConvertCpuProfilerStreamToChromeTrace(streamFilePath.c_str(), traceFilePath.c_str()))
+        {
+            AZ_Printf("ProfilerSystemComponent", "Cpu profiler stream was converted to the trace file [%s]\n", traceFilePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(ProfilerConvertStreamToChromeTrace, AZ::ConsoleFunctorFlags::Null, "Convert a cpu profiler stream file to a Chrome trace (and Perfetto) json file");
+
     void ProfilerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -250,4 +270,47 @@ namespace Profiler
     {
         return m_cpuProfiler.IsContinuousCaptureInProgress();
     }
+
+    void ProfilerSystemComponent::StartStreaming(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() != 1)
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "Usage: ProfilerSystemComponent.StartStreaming <stream file>");
+            return;
+        }
+
+        const AZStd::string streamFilePath(arguments[0]);
+        m_cpuProfiler.BeginStreaming(streamFilePath.c_str());
+    }
+
+    void ProfilerSystemComponent::EndStreaming([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        m_cpuProfiler.EndStreaming();
+    }
+
+    void ProfilerSystemComponent::SetBudgetLimit(const AZ::ConsoleCommandContainer& arguments)
+    {
+        float limitMs = 0.0f;
+        if (arguments.size() != 2 || !AZ::ConsoleTypeHelpers::StringToValue(limitMs, arguments[1]))
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "Usage: ProfilerSystemComponent.SetBudgetLimit <budget> <milliseconds>");
+            return;
+        }
+
+        m_cpuProfiler.GetBudgetTracker().SetBudgetLimit(AZStd::string(arguments[0]), limitMs);
+    }
+
+    void ProfilerSystemComponent::DumpBudgetStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (!m_cpuProfiler.IsProfilerEnabled())
+        {
+            AZ_Printf("ProfilerSystemComponent", "The profiler is not enabled, budgets are only accounted while it is\n");
+        }
+
+        for (const auto& [budgetName, stats] : m_cpuProfiler.GetBudgetTracker().GetAllBudgetStats())
+        {
+            AZ_Printf("ProfilerSystemComponent", "%s: last %.2f ms, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, limit %.2f ms\n",
+                budgetName.c_str(), stats.m_lastFrameMs, stats.m_p50Ms, stats.m_p95Ms, stats.m_p99Ms, stats.m_limitMs);
+        }
+    }
 } // namespace Profiler
@@ -11,6 +11,7 @@
 #include <CpuProfiler.h>
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/parallel/thread.h>
 
@@ -23,6 +24,14 @@ namespace Profiler
     public:
         AZ_COMPONENT(ProfilerSystemComponent, "{3f52c1d7-d920-4781-8ed7-88077ec4f305}");
 
+        // Bind the always-on profiler mode to the console as 'ProfilerSystemComponent.StartStreaming' and 'ProfilerSystemComponent.EndStreaming'
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, StartStreaming, AZ::ConsoleFunctorFlags::Null, "Start streaming the cpu profiling regions to the given file, with low enough overhead to stay on in production");
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, EndStreaming, AZ::ConsoleFunctorFlags::Null, "End streaming the cpu profiling regions");
+
+        // Bind the budget accounting to the console as 'ProfilerSystemComponent.SetBudgetLimit' and 'ProfilerSystemComponent.DumpBudgetStats'
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, SetBudgetLimit, AZ::ConsoleFunctorFlags::Null, "Set the per frame limit in milliseconds of a budget, a frame over the limit logs a warning and notifies the ProfilerNotificationBus");
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, DumpBudgetStats, AZ::ConsoleFunctorFlags::Null, "Dump the exclusive frame time percentiles of every profiled budget to the console window");
+
         static void Reflect(AZ::ReflectContext* context);
 
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
@@ -46,6 +55,11 @@ namespace Profiler
         bool EndCapture() override;
         bool IsCaptureInProgress() const override;
 
+        // Console commands
+        void StartStreaming(const AZ::ConsoleCommandContainer& arguments);
+        void EndStreaming(const AZ::ConsoleCommandContainer& arguments);
+        void SetBudgetLimit(const AZ::ConsoleCommandContainer& arguments);
+        void DumpBudgetStats(const AZ::ConsoleCommandContainer& arguments);
 
         AZStd::thread m_cpuDataSerializationThread;
         AZStd::atomic_bool m_cpuDataSerializationInProgress{ false };
@@ -8,8 +8,12 @@
 
 set(FILES
     Include/Profiler/ProfilerImGuiBus.h
+    Source/CpuBudgetTracker.h
+    Source/CpuBudgetTracker.cpp
     Source/CpuProfiler.h
     Source/CpuProfiler.cpp
+    Source/CpuProfilerStream.h
+    Source/CpuProfilerStream.cpp
     Source/ProfilerSystemComponent.cpp
     Source/ProfilerSystemComponent.h
 )
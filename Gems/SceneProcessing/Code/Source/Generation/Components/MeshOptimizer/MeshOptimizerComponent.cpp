@@ -9,6 +9,8 @@
 #include <Generation/Components/MeshOptimizer/MeshOptimizerComponent.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Trace.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/base.h>
@@ -16,6 +18,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/iterator.h>
 #include <AzCore/std/limits.h>
@@ -321,23 +324,31 @@ namespace AZ::SceneGenerationComponents
             return indexes;
         };
 
+        // The optimization of a mesh for a mesh group, the meshes are optimized in parallel while the graph is only read, and the
+        // optimized nodes are added to the graph afterwards in the order of the meshes.
+        struct MeshOptimization
+        {
+            const IMeshData* m_mesh = nullptr;
+            NodeIndex m_nodeIndex;
+            const IMeshGroup* m_meshGroup = nullptr;
+            AZStd::string m_name;
+            bool m_hasBlendShapes = false;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>> m_uvDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexTangentData>> m_tangentDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexBitangentData>> m_bitangentDatas;
+            AZStd::vector<AZStd::reference_wrapper<const ISkinWeightData>> m_skinWeightDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexColorData>> m_colorDatas;
+            AZStd::vector<NodeIndex> m_blendShapeNodeIndexes;
+
+            OptimizedMeshData<IMeshData> m_optimizedMesh;
+            AZStd::vector<OptimizedMeshData<IBlendShapeData>> m_optimizedBlendShapes;
+        };
+        AZStd::vector<MeshOptimization> optimizations;
+        AZStd::unordered_set<AZStd::string> optimizedMeshNames;
+
         // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
         for (const auto& [mesh, nodeIndex] : meshes)
         {
-            // A Mesh can have multiple child nodes that contain other data streams, like uvs and tangents
-
-            const auto uvDatasView = Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex));
-            const auto tangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex));
-            const auto bitangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex));
-            const auto skinWeightDatasView = Containers::MakeDerivedFilterView<ISkinWeightData>(childNodes(nodeIndex));
-            const auto colorDatasView = Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex));
-
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>> uvDatas(uvDatasView.begin(), uvDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexTangentData>> tangentDatas(tangentDatasView.begin(), tangentDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexBitangentData>> bitangentDatas(bitangentDatasView.begin(), bitangentDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const ISkinWeightData>> skinWeightDatas(skinWeightDatasView.begin(), skinWeightDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexColorData>> colorDatas(colorDatasView.begin(), colorDatasView.end());
-
             const AZStd::string_view nodePath(graph.GetNodeName(nodeIndex).GetPath(), graph.GetNodeName(nodeIndex).GetPathLength());
 
             for (const IMeshGroup& meshGroup : meshGroups)
@@ -348,90 +359,140 @@ namespace AZ::SceneGenerationComponents
                     continue;
                 }
 
-                const AZStd::string name =
+                AZStd::string name =
                     AZStd::string(graph.GetNodeName(nodeIndex).GetName(), graph.GetNodeName(nodeIndex).GetNameLength())
                         .append("_")
                         .append(meshGroup.GetName())
                         .append(SceneAPI::Utilities::OptimizedMeshSuffix);
-                if (graph.Find(name).IsValid())
+                if (graph.Find(name).IsValid() || optimizedMeshNames.contains(name))
                 {
                     AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh already exists at '%s', there must be multiple mesh groups that have selected this mesh. Skipping the additional ones.", name.c_str());
                     continue;
                 }
+                optimizedMeshNames.insert(name);
+
+                // A Mesh can have multiple child nodes that contain other data streams, like uvs and tangents
+                const auto uvDatasView = Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex));
+                const auto tangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex));
+                const auto bitangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex));
+                const auto skinWeightDatasView = Containers::MakeDerivedFilterView<ISkinWeightData>(childNodes(nodeIndex));
+                const auto colorDatasView = Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex));
+
+                MeshOptimization& optimization = optimizations.emplace_back();
+                optimization.m_mesh = mesh;
+                optimization.m_nodeIndex = nodeIndex;
+                optimization.m_meshGroup = &meshGroup;
+                optimization.m_name = AZStd::move(name);
+                optimization.m_hasBlendShapes = HasAnyBlendShapeChild(graph, nodeIndex);
+                optimization.m_uvDatas.assign(uvDatasView.begin(), uvDatasView.end());
+                optimization.m_tangentDatas.assign(tangentDatasView.begin(), tangentDatasView.end());
+                optimization.m_bitangentDatas.assign(bitangentDatasView.begin(), bitangentDatasView.end());
+                optimization.m_skinWeightDatas.assign(skinWeightDatasView.begin(), skinWeightDatasView.end());
+                optimization.m_colorDatas.assign(colorDatasView.begin(), colorDatasView.end());
+                optimization.m_blendShapeNodeIndexes = nodeIndexes(Containers::MakeDerivedFilterView<IBlendShapeData>(childNodes(nodeIndex)));
+            }
+        }
 
-                const bool hasBlendShapes = HasAnyBlendShapeChild(graph, nodeIndex);
-
-                auto [optimizedMesh, optimizedUVs, optimizedTangents, optimizedBitangents, optimizedVertexColors, optimizedSkinWeights] = OptimizeMesh(mesh, mesh, uvDatas, tangentDatas, bitangentDatas, colorDatas, skinWeightDatas, meshGroup, hasBlendShapes);
+        const auto optimize = [&graph, &optimizations](size_t optimizationIndex)
+        {
+            MeshOptimization& optimization = optimizations[optimizationIndex];
+            optimization.m_optimizedMesh = OptimizeMesh(optimization.m_mesh, optimization.m_mesh, optimization.m_uvDatas,
+                optimization.m_tangentDatas, optimization.m_bitangentDatas, optimization.m_colorDatas, optimization.m_skinWeightDatas,
+                *optimization.m_meshGroup, optimization.m_hasBlendShapes);
 
-                AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh '%s': Original: %zu vertices -> optimized: %zu vertices, %0.02f%% of the original (hasBlendShapes=%s)",
-                    graph.GetNodeName(nodeIndex).GetName(),
-                    mesh->GetUsedControlPointCount(),
-                    optimizedMesh->GetUsedControlPointCount(),
-                    ((float)optimizedMesh->GetUsedControlPointCount() / (float)mesh->GetUsedControlPointCount()) * 100.0f,
-                    hasBlendShapes ? "Yes" : "No"
-                );
+            for (const NodeIndex& blendShapeNodeIndex : optimization.m_blendShapeNodeIndexes)
+            {
+                const IBlendShapeData* blendShapeNode = static_cast<const IBlendShapeData*>(graph.GetNodeContent(blendShapeNodeIndex).get());
+                optimization.m_optimizedBlendShapes.emplace_back(
+                    OptimizeMesh(blendShapeNode, optimization.m_mesh, {}, {}, {}, {}, {}, *optimization.m_meshGroup, optimization.m_hasBlendShapes));
+            }
+        };
+        if (optimizations.size() > 1 && AZ::JobContext::GetGlobalContext())
+        {
+            AZ::parallel_for(size_t{ 0 }, optimizations.size(), optimize);
+        }
+        else
+        {
+            for (size_t optimizationIndex = 0; optimizationIndex < optimizations.size(); ++optimizationIndex)
+            {
+                optimize(optimizationIndex);
+            }
+        }
 
-                const NodeIndex optimizedMeshNodeIndex = graph.AddChild(graph.GetNodeParent(nodeIndex), name.c_str(), AZStd::move(optimizedMesh));
+        for (MeshOptimization& optimization : optimizations)
+        {
+            const NodeIndex nodeIndex = optimization.m_nodeIndex;
+            const IMeshData* mesh = optimization.m_mesh;
+            auto& [optimizedMesh, optimizedUVs, optimizedTangents, optimizedBitangents, optimizedVertexColors, optimizedSkinWeights] = optimization.m_optimizedMesh;
 
-                auto addOptimizedNodes = [&graph, &optimizedMeshNodeIndex](const auto& originalNodeIndexes, auto& optimizedNodes)
-                {
-                    AZ_PUSH_DISABLE_WARNING(, "-Wrange-loop-analysis") // remove when we upgrade from clang 6.0
-                    for (const auto& [originalNodeIndex, optimizedNode] : Containers::Views::MakePairView(originalNodeIndexes, optimizedNodes))
-                    AZ_POP_DISABLE_WARNING
-                    {
-                        const AZStd::string optimizedName {graph.GetNodeName(originalNodeIndex).GetName(), graph.GetNodeName(originalNodeIndex).GetNameLength()};
-                        const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedNode));
-                        if (graph.IsNodeEndPoint(originalNodeIndex))
-                        {
-                            graph.MakeEndPoint(optimizedNodeIndex);
-                        }
-                    }
-                };
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex))), optimizedUVs);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex))), optimizedTangents);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex))), optimizedBitangents);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex))), optimizedVertexColors);
+            AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh '%s': Original: %zu vertices -> optimized: %zu vertices, %0.02f%% of the original (hasBlendShapes=%s)",
+                graph.GetNodeName(nodeIndex).GetName(),
+                mesh->GetUsedControlPointCount(),
+                optimizedMesh->GetUsedControlPointCount(),
+                ((float)optimizedMesh->GetUsedControlPointCount() / (float)mesh->GetUsedControlPointCount()) * 100.0f,
+                optimization.m_hasBlendShapes ? "Yes" : "No"
+            );
 
-                if (optimizedSkinWeights)
-                {
-                    const NodeIndex optimizedSkinNodeIndex = graph.AddChild(optimizedMeshNodeIndex, "skinWeights", AZStd::move(optimizedSkinWeights));
-                    graph.MakeEndPoint(optimizedSkinNodeIndex);
-                }
+            const NodeIndex optimizedMeshNodeIndex = graph.AddChild(graph.GetNodeParent(nodeIndex), optimization.m_name.c_str(), AZStd::move(optimizedMesh));
 
-                for (const NodeIndex& blendShapeNodeIndex : nodeIndexes(Containers::MakeDerivedFilterView<IBlendShapeData>(childNodes(nodeIndex))))
+            auto addOptimizedNodes = [&graph, &optimizedMeshNodeIndex](const auto& originalNodeIndexes, auto& optimizedNodes)
+            {
+                AZ_PUSH_DISABLE_WARNING(, "-Wrange-loop-analysis") // remove when we upgrade from clang 6.0
+                for (const auto& [originalNodeIndex, optimizedNode] : Containers::Views::MakePairView(originalNodeIndexes, optimizedNodes))
+                AZ_POP_DISABLE_WARNING
                 {
-                    const IBlendShapeData* blendShapeNode = static_cast<IBlendShapeData*>(graph.GetNodeContent(blendShapeNodeIndex).get());
-                    auto [optimizedBlendShape, _1, _2, _3 , _4, _5] = OptimizeMesh(blendShapeNode, mesh, {}, {}, {}, {}, {}, meshGroup, hasBlendShapes);
-
-                    const AZStd::string optimizedName {graph.GetNodeName(blendShapeNodeIndex).GetName(), graph.GetNodeName(blendShapeNodeIndex).GetNameLength()};
-                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedBlendShape));
-                    if (graph.IsNodeEndPoint(blendShapeNodeIndex))
+                    const AZStd::string optimizedName {graph.GetNodeName(originalNodeIndex).GetName(), graph.GetNodeName(originalNodeIndex).GetNameLength()};
+                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedNode));
+                    if (graph.IsNodeEndPoint(originalNodeIndex))
                     {
                         graph.MakeEndPoint(optimizedNodeIndex);
                     }
                 }
+            };
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex))), optimizedUVs);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex))), optimizedTangents);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex))), optimizedBitangents);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex))), optimizedVertexColors);
+
+            if (optimizedSkinWeights)
+            {
+                const NodeIndex optimizedSkinNodeIndex = graph.AddChild(optimizedMeshNodeIndex, "skinWeights", AZStd::move(optimizedSkinWeights));
+                graph.MakeEndPoint(optimizedSkinNodeIndex);
+            }
+
+            for (size_t blendShapeIndex = 0; blendShapeIndex < optimization.m_blendShapeNodeIndexes.size(); ++blendShapeIndex)
+            {
+                const NodeIndex blendShapeNodeIndex = optimization.m_blendShapeNodeIndexes[blendShapeIndex];
+                auto& optimizedBlendShape = AZStd::get<0>(optimization.m_optimizedBlendShapes[blendShapeIndex]);
 
-                const AZStd::array optimizedChildTypes {
-                    azrtti_typeid<IMeshData>(),
-                    azrtti_typeid<IMeshVertexUVData>(),
-                    azrtti_typeid<IMeshVertexTangentData>(),
-                    azrtti_typeid<IMeshVertexBitangentData>(),
-                    azrtti_typeid<IMeshVertexColorData>(),
-                    azrtti_typeid<ISkinWeightData>(),
-                    azrtti_typeid<IBlendShapeData>(),
-                };
-                for (const NodeIndex& childNodeIndex : nodeIndexes(childNodes(nodeIndex)))
+                const AZStd::string optimizedName {graph.GetNodeName(blendShapeNodeIndex).GetName(), graph.GetNodeName(blendShapeNodeIndex).GetNameLength()};
+                const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedBlendShape));
+                if (graph.IsNodeEndPoint(blendShapeNodeIndex))
                 {
-                    const AZStd::shared_ptr<SceneAPI::DataTypes::IGraphObject>& childNode = graph.GetNodeContent(childNodeIndex);
+                    graph.MakeEndPoint(optimizedNodeIndex);
+                }
+            }
 
-                    if (!AZStd::any_of(optimizedChildTypes.begin(), optimizedChildTypes.end(), [&childNode](const AZ::Uuid& typeId) { return AZ::RttiIsTypeOf(typeId, childNode.get()); }))
+            const AZStd::array optimizedChildTypes {
+                azrtti_typeid<IMeshData>(),
+                azrtti_typeid<IMeshVertexUVData>(),
+                azrtti_typeid<IMeshVertexTangentData>(),
+                azrtti_typeid<IMeshVertexBitangentData>(),
+                azrtti_typeid<IMeshVertexColorData>(),
+                azrtti_typeid<ISkinWeightData>(),
+                azrtti_typeid<IBlendShapeData>(),
+            };
+            for (const NodeIndex& childNodeIndex : nodeIndexes(childNodes(nodeIndex)))
+            {
+                const AZStd::shared_ptr<SceneAPI::DataTypes::IGraphObject>& childNode = graph.GetNodeContent(childNodeIndex);
+
+                if (!AZStd::any_of(optimizedChildTypes.begin(), optimizedChildTypes.end(), [&childNode](const AZ::Uuid& typeId) { return AZ::RttiIsTypeOf(typeId, childNode.get()); }))
+                {
+                    const AZStd::string optimizedName {graph.GetNodeName(childNodeIndex).GetName(), graph.GetNodeName(childNodeIndex).GetNameLength()};
+                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), childNode);
+                    if (graph.IsNodeEndPoint(childNodeIndex))
                     {
-                        const AZStd::string optimizedName {graph.GetNodeName(childNodeIndex).GetName(), graph.GetNodeName(childNodeIndex).GetNameLength()};
-                        const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), childNode);
-                        if (graph.IsNodeEndPoint(childNodeIndex))
-                        {
-                            graph.MakeEndPoint(optimizedNodeIndex);
-                        }
+                        graph.MakeEndPoint(optimizedNodeIndex);
                     }
                 }
             }
@@ -487,14 +548,7 @@ namespace AZ::SceneGenerationComponents
     }
 
     template<class MeshDataType>
-    AZStd::tuple<
-        AZStd::unique_ptr<MeshDataType>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexUVData>>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexTangentData>>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexBitangentData>>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexColorData>>,
-        AZStd::unique_ptr<AZ::SceneAPI::DataTypes::ISkinWeightData>
-    > MeshOptimizerComponent::OptimizeMesh(
+    MeshOptimizerComponent::OptimizedMeshData<MeshDataType> MeshOptimizerComponent::OptimizeMesh(
         const MeshDataType* meshData,
         const IMeshData* baseMesh,
         const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>>& uvs,
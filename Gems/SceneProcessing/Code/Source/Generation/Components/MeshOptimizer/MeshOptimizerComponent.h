@@ -53,14 +53,17 @@ namespace AZ::SceneGenerationComponents
 
     private:
         template<class MeshDataType>
-        static AZStd::tuple<
+        using OptimizedMeshData = AZStd::tuple<
             AZStd::unique_ptr<MeshDataType>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexUVData>>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexTangentData>>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexBitangentData>>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexColorData>>,
             AZStd::unique_ptr<AZ::SceneAPI::DataTypes::ISkinWeightData>
-        > OptimizeMesh(
+        >;
+
+        template<class MeshDataType>
+        static OptimizedMeshData<MeshDataType> OptimizeMesh(
             const MeshDataType* meshData,
             const SceneAPI::DataTypes::IMeshData* baseMesh,
             const AZStd::vector<AZStd::reference_wrapper<const AZ::SceneAPI::DataTypes::IMeshVertexUVData>>& uvs,
@@ -27,8 +27,11 @@
 #include <SceneAPI/SceneData/GraphData/MeshVertexBitangentData.h>
 #include <SceneAPI/SceneData/GraphData/MeshVertexTangentData.h>
 
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Math/Vector4.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 
@@ -132,27 +135,54 @@ namespace AZ::SceneGenerationComponents
         }
 
         // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
+        // The missing tangent and bitangent layers are added to the graph first, after which the graph isn't modified anymore and
+        // the tangents of the meshes are generated in parallel.
+        AZStd::vector<MeshTangentGeneration> generations;
+        generations.reserve(meshes.size());
         for (auto& [mesh, nodeIndex] : meshes)
         {
-            // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh, generationMethod))
+            MeshTangentGeneration& generation = generations.emplace_back();
+            if (!PrepareTangentsForMesh(context.GetScene(), nodeIndex, mesh, generationMethod, generation))
             {
                 return AZ::SceneAPI::Events::ProcessingResult::Failure;
             }
+        }
+
+        AZStd::atomic_bool allSuccess{ true };
+        const auto generateMesh = [this, &graph, &generations, &allSuccess, generationMethod, debugBitangentFlip](size_t generationIndex)
+        {
+            const MeshTangentGeneration& generation = generations[generationIndex];
+
+            // Generate tangents for the mesh (if this is desired or needed).
+            if (!GenerateTangentsForMesh(generation))
+            {
+                allSuccess = false;
+                return;
+            }
 
             // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
             // But only do this if we are getting tangents from the source scene, because MikkT will provide us with a correct tangent.w already
             if (generationMethod == SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene)
             {
-                if (!UpdateFbxTangentWValues(graph, nodeIndex, mesh, debugBitangentFlip))
+                if (!UpdateFbxTangentWValues(graph, generation.m_nodeIndex, generation.m_meshData, debugBitangentFlip))
                 {
-                    return AZ::SceneAPI::Events::ProcessingResult::Failure;
+                    allSuccess = false;
                 }
             }
-            
+        };
+        if (generations.size() > 1 && AZ::JobContext::GetGlobalContext())
+        {
+            AZ::parallel_for(size_t{ 0 }, generations.size(), generateMesh);
+        }
+        else
+        {
+            for (size_t generationIndex = 0; generationIndex < generations.size(); ++generationIndex)
+            {
+                generateMesh(generationIndex);
+            }
         }
 
-        return AZ::SceneAPI::Events::ProcessingResult::Success;
+        return allSuccess ? AZ::SceneAPI::Events::ProcessingResult::Success : AZ::SceneAPI::Events::ProcessingResult::Failure;
     }
 
     bool TangentGenerateComponent::UpdateFbxTangentWValues(
@@ -250,12 +280,16 @@ namespace AZ::SceneGenerationComponents
         }
     }
 
-    bool TangentGenerateComponent::GenerateTangentsForMesh(
+    bool TangentGenerateComponent::PrepareTangentsForMesh(
         AZ::SceneAPI::Containers::Scene& scene,
         const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
         AZ::SceneAPI::DataTypes::IMeshData* meshData,
-        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod)
+        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod,
+        MeshTangentGeneration& outGeneration)
     {
+        outGeneration.m_nodeIndex = nodeIndex;
+        outGeneration.m_meshData = meshData;
+
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
 
         // Check if we have any UV data, if not, we cannot possibly generate the tangents.
@@ -268,9 +302,10 @@ namespace AZ::SceneGenerationComponents
 
         const AZ::SceneAPI::SceneData::TangentsRule* tangentsRule = GetTangentRule(scene);
 
+        outGeneration.m_tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+
         // Find all blend shape data under the mesh. We need to generate the tangent and bitangent for blend shape as well.
-        AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> blendShapes;
-        FindBlendShapes(graph, nodeIndex, blendShapes);
+        FindBlendShapes(graph, nodeIndex, outGeneration.m_blendShapes);
 
         // Generate tangents/bitangents for all uv sets.
         bool allSuccess = true;
@@ -335,17 +370,10 @@ namespace AZ::SceneGenerationComponents
 
             switch (generationMethod)
             {
-            // Generate using MikkT space.
+            // Generate using MikkT space, which is done by GenerateTangentsForMesh.
             case AZ::SceneAPI::DataTypes::TangentGenerationMethod::MikkT:
             {
-                const AZ::SceneAPI::DataTypes::MikkTSpaceMethod tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
-
-                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshData, uvData, tangentData, bitangentData, tSpaceMethod);
-
-                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
-                {
-                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex, tSpaceMethod);
-                }
+                outGeneration.m_uvSets.push_back({ uvSetIndex, uvData, tangentData, bitangentData });
             }
             break;
 
@@ -360,6 +388,23 @@ namespace AZ::SceneGenerationComponents
         return allSuccess;
     }
 
+    bool TangentGenerateComponent::GenerateTangentsForMesh(const MeshTangentGeneration& generation)
+    {
+        bool allSuccess = true;
+        for (const UvSetTangentGeneration& uvSet : generation.m_uvSets)
+        {
+            allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(
+                generation.m_meshData, uvSet.m_uvData, uvSet.m_tangentData, uvSet.m_bitangentData, generation.m_tSpaceMethod);
+
+            for (AZ::SceneData::GraphData::BlendShapeData* blendShape : generation.m_blendShapes)
+            {
+                allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSet.m_uvSetIndex, generation.m_tSpaceMethod);
+            }
+        }
+
+        return allSuccess;
+    }
+
     size_t TangentGenerateComponent::CalcUvSetCount(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex) const
     {
         const auto nameContentView = AZ::SceneAPI::Containers::Views::MakePairView(graph.GetNameStorage(), graph.GetContentStorage());
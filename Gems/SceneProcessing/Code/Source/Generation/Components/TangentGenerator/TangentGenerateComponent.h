@@ -12,6 +12,7 @@
 #include <SceneAPI/SceneCore/Containers/Scene.h>
 #include <SceneAPI/SceneData/Rules/TangentsRule.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ::SceneAPI::DataTypes { class IMeshData; }
 namespace AZ::SceneAPI::DataTypes { class IMeshVertexUVData; }
@@ -55,14 +56,37 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Events::ProcessingResult GenerateTangentData(TangentGenerateContext& context);
 
     private:
+        //! The MikkT generation of a uv set of a mesh, whose tangent and bitangent layers already got added to the graph.
+        struct UvSetTangentGeneration
+        {
+            size_t m_uvSetIndex = 0;
+            AZ::SceneAPI::DataTypes::IMeshVertexUVData* m_uvData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexTangentData* m_tangentData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexBitangentData* m_bitangentData = nullptr;
+        };
+
+        //! The tangent generation of a mesh, which only writes to the data of its own layers and blend shapes so that the meshes
+        //! can be processed in parallel once the graph isn't modified anymore.
+        struct MeshTangentGeneration
+        {
+            AZ::SceneAPI::Containers::SceneGraph::NodeIndex m_nodeIndex;
+            AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZ::SceneAPI::DataTypes::MikkTSpaceMethod m_tSpaceMethod = AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+            AZStd::vector<UvSetTangentGeneration> m_uvSets;
+            AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> m_blendShapes;
+        };
+
         void FindBlendShapes(
             AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*>& outBlendShapes) const;
-        bool GenerateTangentsForMesh(
+        //! Adds the missing tangent and bitangent layers of the mesh to the graph, and fills the uv sets that need to be generated.
+        bool PrepareTangentsForMesh(
             AZ::SceneAPI::Containers::Scene& scene,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZ::SceneAPI::DataTypes::IMeshData* meshData,
-            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod);
+            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod,
+            MeshTangentGeneration& outGeneration);
+        bool GenerateTangentsForMesh(const MeshTangentGeneration& generation);
         bool UpdateFbxTangentWValues(
             AZ::SceneAPI::Containers::SceneGraph& graph,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
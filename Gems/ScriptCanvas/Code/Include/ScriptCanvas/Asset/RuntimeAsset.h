@@ -74,6 +74,7 @@ namespace ScriptCanvas
         // populate all on initial load at run time
         AZStd::vector<Execution::CloneSource> m_cloneSources;
         AZStd::vector<AZ::BehaviorValueParameter> m_activationInputStorage;
+        AZStd::vector<AZ::LuaPushToStack> m_activationInputPushers;
         Execution::ActivationInputRange m_activationInputRange;
 
         // used to initialize statics only once, and not necessarily on the loading thread
@@ -33,6 +33,13 @@ namespace ExecutionContextCpp
         lhs.m_azRtti = rhs.m_azRtti;
         lhs.m_value = rhs.m_value;
     }
+
+    bool IsPushedAsString(const AZ::BehaviorValueParameter& parameter)
+    {
+        return parameter.m_typeId == azrtti_typeid<const char*>()
+            || parameter.m_typeId == azrtti_typeid<AZStd::string>()
+            || parameter.m_typeId == azrtti_typeid<AZStd::string_view>();
+    }
 }
 
 namespace ScriptCanvas
@@ -167,11 +174,33 @@ namespace ScriptCanvas
                 return;
             }
 
-            // \todo, the stack push functions could be retrieved here
             IntializeActivationInputs(runtimeData, *behaviorContext);
+            InitializeActivationPushers(runtimeData, *behaviorContext);
             IntializeStaticCloners(runtimeData, *behaviorContext);
         }
 
+        // The push functions only depend on the types of the inputs, so every activation of the asset can share them
+        void Context::InitializeActivationPushers(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext)
+        {
+            AZStd::vector<AZ::LuaPushToStack>& pushers = runtimeData.m_activationInputPushers;
+            pushers.clear();
+            pushers.reserve(runtimeData.m_activationInputStorage.size());
+
+            for (const AZ::BehaviorValueParameter& parameter : runtimeData.m_activationInputStorage)
+            {
+                AZ::LuaPushToStack pusher = nullptr;
+                if (!ExecutionContextCpp::IsPushedAsString(parameter))
+                {
+                    AZ::LuaPrepareValue unusedPrepareValue = nullptr;
+                    AZ::BehaviorClass* unusedClass = nullptr;
+                    pusher = AZ::ToLuaStack(&behaviorContext, &parameter, &unusedPrepareValue, unusedClass);
+                }
+                pushers.push_back(pusher);
+            }
+
+            runtimeData.m_activationInputRange.pushers = pushers.data();
+        }
+
         // This does not have to recursively initialize dependent assets, as this is called by asset handler
         void Context::IntializeStaticCloners(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext)
         {
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/Script/ScriptContext.h>
 #include <ScriptCanvas/Core/Core.h>
 
 namespace ScriptCanvas
@@ -35,6 +36,8 @@ namespace ScriptCanvas
         struct ActivationInputRange
         {
             AZ::BehaviorValueParameter* inputs = nullptr;
+            // the functions that push the inputs to Lua, looked up once per asset, null for the inputs that need the ScriptCanvas specific push
+            const AZ::LuaPushToStack* pushers = nullptr;
             bool requiresDependencyConstructionParameters = false;
             size_t nodeableCount = 0;
             size_t variableCount = 0;
@@ -54,6 +57,7 @@ namespace ScriptCanvas
 
         private:
             static void IntializeActivationInputs(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext);
+            static void InitializeActivationPushers(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext);
             static void IntializeStaticCloners(RuntimeData& runtimeData, AZ::BehaviorContext& behaviorContext);
         };
 
@@ -434,13 +434,20 @@ namespace ScriptCanvas
             return 1;
         }
 
-        void PushActivationArgs(lua_State* lua, AZ::BehaviorValueParameter* arguments, size_t numArguments)
+        void PushActivationArgs(lua_State* lua, const ActivationInputRange& range)
         {
             auto behaviorContext = AZ::ScriptContext::FromNativeContext(lua)->GetBoundContext();
 
-            for (size_t i = 0; i < numArguments; ++i)
+            for (size_t i = 0; i < range.totalCount; ++i)
             {
-                Execution::StackPush(lua, behaviorContext, arguments[i]);
+                if (range.pushers && range.pushers[i])
+                {
+                    range.pushers[i](lua, range.inputs[i]);
+                }
+                else
+                {
+                    Execution::StackPush(lua, behaviorContext, range.inputs[i]);
+                }
             }
         }
 
@@ -703,7 +710,7 @@ namespace ScriptCanvas
             ActivationInputArray storage;
             ActivationData data(args.runtimeOverrides, storage);
             ActivationInputRange range = Execution::Context::CreateActivateInputRange(data, args.executionState->GetEntityId());
-            PushActivationArgs(lua, range.inputs, range.totalCount);
+            PushActivationArgs(lua, range);
             return static_cast<int>(range.totalCount);
         }
 
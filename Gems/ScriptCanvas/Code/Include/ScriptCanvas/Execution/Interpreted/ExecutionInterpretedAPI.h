@@ -29,6 +29,8 @@ namespace ScriptCanvas
 
     namespace Execution
     {
+        struct ActivationInputRange;
+
         void ActivateInterpreted();
 
         AZ::BehaviorValueParameter BehaviorValueParameterFromTypeIdString(const char* string, AZ::BehaviorContext& behaviorContext);
@@ -49,7 +51,7 @@ namespace ScriptCanvas
 
         int OverrideNodeableMetatable(lua_State* lua);
 
-        void PushActivationArgs(lua_State* lua, AZ::BehaviorValueParameter* arguments, size_t numArguments);
+        void PushActivationArgs(lua_State* lua, const ActivationInputRange& range);
 
         void RegisterAPI(lua_State* lua);
 
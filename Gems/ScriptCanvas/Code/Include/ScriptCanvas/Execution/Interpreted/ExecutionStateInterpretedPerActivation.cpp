@@ -53,13 +53,13 @@ namespace ScriptCanvas
         {
             lua_pushlightuserdata(lua, const_cast<void*>(reinterpret_cast<const void*>(&data.variableOverrides.m_dependencies)));
             // Lua: graph_VM, graph_VM['new'], userdata<ExecutionState>, runtimeDataOverrides
-            Execution::PushActivationArgs(lua, range.inputs, range.totalCount);
+            Execution::PushActivationArgs(lua, range);
             // Lua: graph_VM, graph_VM['new'], userdata<ExecutionState>, runtimeDataOverrides, args...
             AZ::Internal::LuaSafeCall(lua, aznumeric_caster(2 + range.totalCount), 1);
         }
         else
         {
-            Execution::PushActivationArgs(lua, range.inputs, range.totalCount);
+            Execution::PushActivationArgs(lua, range);
             // Lua: graph_VM, graph_VM['new'], userdata<ExecutionState>, args...
             AZ::Internal::LuaSafeCall(lua, aznumeric_caster(1 + range.totalCount), 1);
         }
@@ -55,7 +55,7 @@ namespace ScriptCanvas
         Execution::ActivationInputArray storage;
         Execution::ActivationData data(m_component->GetRuntimeDataOverrides(), storage);
         Execution::ActivationInputRange range = Execution::Context::CreateActivateInputRange(data, m_component->GetEntityId());
-        Execution::PushActivationArgs(lua, range.inputs, range.totalCount);
+        Execution::PushActivationArgs(lua, range);
         // Lua: graph_VM, graph_VM['k_OnGraphStartFunctionName'], userdata<ExecutionState>, args...
         const int result = Execution::InterpretedSafeCall(lua, aznumeric_caster(1 + range.totalCount), 0);
         // Lua: graph_VM, ?
@@ -76,6 +76,8 @@ namespace ScriptCanvas
         constexpr const char* k_DebugVariableChangeName = "DEBUG_VARIABLE_CHANGE";
         constexpr const char* k_DebugVariableChangeSubgraphName = "DEBUG_VARIABLE_CHANGE_SUBGRAPH";
 
+        constexpr const char* k_CachedFunctionSuffix = "_fn";
+
         constexpr const char* k_DependencySuffix = "_dp";
 
         constexpr const char* k_GetRandomSwitchControlNumberName = "GetRandomSwitchControlNumber";
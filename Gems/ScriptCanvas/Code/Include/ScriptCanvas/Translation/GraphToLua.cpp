@@ -44,6 +44,8 @@ namespace ScriptCanvas
     namespace Translation
     {
         const static size_t k_DefaultLoopLimit = 1000;
+        // keeps the cached function lookups well below the Lua limit of 200 locals per function
+        const static size_t k_MaxCachedFunctions = 64;
 
         Configuration CreateLuaConfig([[maybe_unused]] const Grammar::AbstractCodeModel& source)
         {
@@ -125,14 +127,54 @@ namespace ScriptCanvas
 
             WriteHeader();
             TranslateDependencies();
+            const size_t cachedFunctionsPosition = m_dotLua.GetOutput().size();
             TranslateClassOpen();   
             TranslateBody(BuildConfiguration::Release);
             TranslateBody(BuildConfiguration::Performance);
             TranslateBody(BuildConfiguration::Debug);
             TranslateClassClose();
+            TranslateCachedFunctions(cachedFunctionsPosition);
             MarkTranslationStop();
         }
 
+        AZStd::string GraphToLua::CacheFunctionLookup(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name)
+        {
+            // only the native libraries are known to be declared as locals and to never change their functions
+            const Grammar::LexicalScope lexicalScope = execution->GetNameLexicalScope();
+            if ((lexicalScope.m_type != Grammar::LexicalScopeType::Class && lexicalScope.m_type != Grammar::LexicalScopeType::Namespace)
+                || lexicalScope.m_namespaces.empty()
+                || IsUserFunctionCall(execution))
+            {
+                return "";
+            }
+
+            const AZStd::string& abbreviation = FindAbbreviation(ResolveScope(lexicalScope.m_namespaces));
+            if (abbreviation.empty())
+            {
+                return "";
+            }
+
+            const AZStd::string identifier = Grammar::ToIdentifier(name);
+            AZStd::string lookup = AZStd::string::format("%s%.*s%s", abbreviation.c_str(),
+                aznumeric_cast<int>(m_configuration.m_lexicalScopeDelimiter.size()), m_configuration.m_lexicalScopeDelimiter.data(), identifier.c_str());
+
+            auto iter = m_cachedFunctions.find(lookup);
+            if (iter != m_cachedFunctions.end())
+            {
+                return iter->second;
+            }
+
+            if (m_cachedFunctions.size() >= k_MaxCachedFunctions)
+            {
+                return "";
+            }
+
+            AZStd::string cachedFunction = AZStd::string::format("%s_%s%s", abbreviation.c_str(), identifier.c_str(), Grammar::k_CachedFunctionSuffix);
+            m_cachedFunctionLookups.push_back(lookup);
+            m_cachedFunctions.emplace(AZStd::move(lookup), cachedFunction);
+            return cachedFunction;
+        }
+
         const AZStd::string& GraphToLua::FindAbbreviation(AZStd::string_view dependency) const
         {
             return m_context.FindAbbreviation(dependency);
@@ -294,6 +336,24 @@ namespace ScriptCanvas
             }
         }
 
+        void GraphToLua::TranslateCachedFunctions(size_t position)
+        {
+            if (m_cachedFunctionLookups.empty())
+            {
+                return;
+            }
+
+            // every call of a native library function would otherwise look it up in its library table again
+            Writer cachedFunctions;
+            for (const AZStd::string& lookup : m_cachedFunctionLookups)
+            {
+                cachedFunctions.WriteLine("local %s = %s", m_cachedFunctions[lookup].c_str(), lookup.c_str());
+            }
+            cachedFunctions.WriteNewLine();
+
+            m_dotLua.Insert(position, cachedFunctions.GetOutput());
+        }
+
         void GraphToLua::TranslateClassClose()
         {
             m_dotLua.WriteNewLine();
@@ -1567,7 +1627,11 @@ namespace ScriptCanvas
                 m_dotLua.Write("%s(", Grammar::k_TypeSafeEBusMultipleResultsName);
             }
 
-            WriteFunctionCallNamespace(execution);
+            const AZStd::string cachedFunction = execution->GetEventType() == ScriptCanvas::EventType::Count ? CacheFunctionLookup(execution, name) : "";
+            if (cachedFunction.empty())
+            {
+                WriteFunctionCallNamespace(execution);
+            }
 
             switch (execution->GetEventType())
             {
@@ -1584,7 +1648,7 @@ namespace ScriptCanvas
                 m_dotLua.Write("QueueEvent.%s(", Grammar::ToIdentifier(name).data());
                 break;
             case ScriptCanvas::EventType::Count:
-                m_dotLua.Write("%s(", Grammar::ToIdentifier(name).data());
+                m_dotLua.Write("%s(", cachedFunction.empty() ? Grammar::ToIdentifier(name).data() : cachedFunction.c_str());
                 break;
             default:
                 AddError(execution, aznew InvalidFunctionCallNameValidation(execution->GetId().m_node->GetEntityId(), execution->GetId().m_slot->GetId()));
@@ -10,6 +10,7 @@
 
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/Outcome/Outcome.h>
 
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
@@ -66,9 +67,13 @@ namespace ScriptCanvas
             AZStd::string m_tableName;
             Writer m_dotLua;
             SystemComponentConfiguration m_systemConfiguration;
+            // the names of the locals at the top of the file that cache native library function lookups, e.g. "v3.Add", by lookup
+            AZStd::unordered_map<AZStd::string, AZStd::string> m_cachedFunctions;
+            AZStd::vector<AZStd::string> m_cachedFunctionLookups;
                         
             GraphToLua(const Grammar::AbstractCodeModel& source);
 
+            AZStd::string CacheFunctionLookup(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name);
             const AZStd::string& FindAbbreviation(AZStd::string_view dependency) const;
             const AZStd::string& FindLibrary(AZStd::string_view dependency) const;
             AZStd::string_view GetOperatorString(Grammar::ExecutionTreeConstPtr execution);
@@ -86,6 +91,7 @@ namespace ScriptCanvas
             void OpenFunctionBlock(Writer& writer);
             void TranslateBody();
             void TranslateBody(BuildConfiguration configuration);
+            void TranslateCachedFunctions(size_t position);
             void TranslateClassClose();
             void TranslateClassOpen();
             void TranslateConstruction();
@@ -177,7 +177,12 @@ namespace ScriptCanvas
         {
             m_indent = AZStd::clamp(m_indent + tabs, size_t(0), TranslationUtilitiesCPP::k_maxTabs);
         }
-        
+
+        void Writer::Insert(size_t position, const AZStd::string_view& stringView)
+        {
+            m_output.insert(position, stringView.data(), stringView.size());
+        }
+
         const AZStd::string& Writer::GetOutput() const
         {
             return m_output;
@@ -56,6 +56,9 @@ namespace ScriptCanvas
 
             void Indent(size_t tabs = 1);
 
+            // inserts already formatted output, e.g. from another writer, at a position of the output written so far
+            void Insert(size_t position, const AZStd::string_view& stringView);
+
             const AZStd::string& GetOutput() const;
 
             size_t GetIndent() const;
@@ -169,6 +169,13 @@ namespace SurfaceData
         //! @return True if any of the tags is found, false if none are found.
         bool HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags) const;
 
+        //! Check to see if the collection contains any of the given tags, given in increasing CRC order.
+        //! Both lists being sorted, this only takes a single pass over each of them, which makes it the better choice
+        //! when the same tags are checked against many collections.
+        //! @param sortedSampleTags - The tags to look for, sorted by increasing CRC value.
+        //! @return True if any of the tags is found, false if none are found.
+        bool HasAnyMatchingSortedTags(AZStd::span<const SurfaceTag> sortedSampleTags) const;
+
         //! Check to see if the collection contains the given tag with the given weight range.
         //! The range check is inclusive on both sides of the range: [weightMin, weightMax]
         //! @param sampleTags - The tags to look for.
@@ -221,5 +221,9 @@ namespace SurfaceData
         AZStd::vector<AZ::Vector3> m_surfaceNormalList;
         AZStd::vector<SurfaceTagWeights> m_surfaceWeightsList;
         AZStd::vector<AZ::EntityId> m_surfaceCreatorIdList;
+
+        // Scratch buffers for FilterPoints(), kept around so that reusing a list for several queries doesn't reallocate them.
+        AZStd::vector<SurfaceTag> m_sortedFilterTags;
+        AZStd::vector<size_t> m_storageIndexRemap;
     };
 }
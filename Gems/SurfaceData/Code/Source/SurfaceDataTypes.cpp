@@ -130,6 +130,31 @@ namespace SurfaceData
         return false;
     }
 
+    bool SurfaceTagWeights::HasAnyMatchingSortedTags(AZStd::span<const SurfaceTag> sortedSampleTags) const
+    {
+        auto weightItr = m_weights.begin();
+        auto sampleTagItr = sortedSampleTags.begin();
+        while ((weightItr != m_weights.end()) && (sampleTagItr != sortedSampleTags.end()))
+        {
+            const AZ::u32 surfaceType = weightItr->m_surfaceType;
+            const AZ::u32 sampleTag = *sampleTagItr;
+            if (surfaceType == sampleTag)
+            {
+                return true;
+            }
+            else if (surfaceType < sampleTag)
+            {
+                ++weightItr;
+            }
+            else
+            {
+                ++sampleTagItr;
+            }
+        }
+
+        return false;
+    }
+
     bool SurfaceTagWeights::HasMatchingTag(AZ::Crc32 sampleTag, float weightMin, float weightMax) const
     {
         auto weightEntry = FindTag(sampleTag);
@@ -9,6 +9,8 @@
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <SurfaceData/SurfacePointList.h>
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
 
 namespace SurfaceData
 {
@@ -204,45 +206,63 @@ namespace SurfaceData
         // Filter out any points that don't match our search tags.
         // This has to be done after the Surface Modifiers have processed the points, not at point insertion time, because
         // Surface Modifiers add tags to existing points.
-        // The algorithm below is basically an "erase_if" that's operating across multiple storage vectors and using one level of
-        // indirection to keep our sorted indices valid.
-        // At some point we might want to consider modifying this to compact the final storage to the minimum needed.
-        for (size_t inputIndex = 0; (inputIndex < m_inputPositionSize); inputIndex++)
+
+        // Sort the search tags once, so that each point only needs a single pass over its own sorted tag weights to match them.
+        m_sortedFilterTags.assign(desiredTags.begin(), desiredTags.end());
+        AZStd::sort(m_sortedFilterTags.begin(), m_sortedFilterTags.end(),
+            [](const SurfaceTag& lhs, const SurfaceTag& rhs)
+            {
+                return static_cast<AZ::u32>(lhs) < static_cast<AZ::u32>(rhs);
+            });
+
+        // Compact the storage vectors down to the points that are kept, in creation order, while recording where each kept point
+        // moved to. Points only ever move towards the front, so this can be done in place.
+        constexpr size_t RemovedPoint = AZStd::numeric_limits<size_t>::max();
+        const size_t numStoredPoints = m_surfacePositionList.size();
+        m_storageIndexRemap.assign(numStoredPoints, RemovedPoint);
+
+        size_t numKeptPoints = 0;
+        for (size_t storageIndex = 0; storageIndex < numStoredPoints; storageIndex++)
         {
-            size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
-            size_t listSize = (surfacePointStartIndex + m_numSurfacePointsPerInput[inputIndex]);
-            size_t index = surfacePointStartIndex;
-            for (; index < listSize; index++)
+            if (!m_surfaceWeightsList[storageIndex].HasAnyMatchingSortedTags(m_sortedFilterTags))
             {
-                if (!m_surfaceWeightsList[m_sortedSurfacePointIndices[index]].HasAnyMatchingTags(desiredTags))
-                {
-                    break;
-                }
+                continue;
             }
 
-            if (index != listSize)
+            if (numKeptPoints != storageIndex)
             {
-                size_t next = index + 1;
-                for (; next < listSize; ++next)
+                m_surfacePositionList[numKeptPoints] = m_surfacePositionList[storageIndex];
+                m_surfaceNormalList[numKeptPoints] = m_surfaceNormalList[storageIndex];
+                m_surfaceWeightsList[numKeptPoints] = m_surfaceWeightsList[storageIndex];
+                m_surfaceCreatorIdList[numKeptPoints] = m_surfaceCreatorIdList[storageIndex];
+            }
+
+            m_storageIndexRemap[storageIndex] = numKeptPoints++;
+        }
+
+        m_surfacePositionList.resize(numKeptPoints);
+        m_surfaceNormalList.resize(numKeptPoints);
+        m_surfaceWeightsList.resize(numKeptPoints);
+        m_surfaceCreatorIdList.resize(numKeptPoints);
+
+        // Remove the filtered points from the sorted indices of each input position and point the remaining ones at the compacted
+        // storage. The relative order of the kept points doesn't change, so they stay sorted in decreasing Z order.
+        for (size_t inputIndex = 0; (inputIndex < m_inputPositionSize); inputIndex++)
+        {
+            const size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
+            const size_t surfacePointEndIndex = surfacePointStartIndex + m_numSurfacePointsPerInput[inputIndex];
+
+            size_t writeIndex = surfacePointStartIndex;
+            for (size_t readIndex = surfacePointStartIndex; readIndex < surfacePointEndIndex; readIndex++)
+            {
+                const size_t remappedIndex = m_storageIndexRemap[m_sortedSurfacePointIndices[readIndex]];
+                if (remappedIndex != RemovedPoint)
                 {
-                    if (m_surfaceWeightsList[m_sortedSurfacePointIndices[index]].HasAnyMatchingTags(desiredTags))
-                    {
-                        m_sortedSurfacePointIndices[index] = AZStd::move(m_sortedSurfacePointIndices[next]);
-                        m_surfaceCreatorIdList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceCreatorIdList[m_sortedSurfacePointIndices[next]]);
-                        m_surfacePositionList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfacePositionList[m_sortedSurfacePointIndices[next]]);
-                        m_surfaceNormalList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceNormalList[m_sortedSurfacePointIndices[next]]);
-                        m_surfaceWeightsList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceWeightsList[m_sortedSurfacePointIndices[next]]);
-
-                        m_numSurfacePointsPerInput[inputIndex]--;
-
-                        ++index;
-                    }
+                    m_sortedSurfacePointIndices[writeIndex++] = remappedIndex;
                 }
             }
+
+            m_numSurfacePointsPerInput[inputIndex] = writeIndex - surfacePointStartIndex;
         }
     }
 
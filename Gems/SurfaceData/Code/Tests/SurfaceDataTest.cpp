@@ -625,6 +625,49 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_ProviderModif
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_PartialMatchingMasksKeepSortOrder)
+{
+    // This test verifies that when only some of the points match the requested mask, the non-matching points get filtered out
+    // and the remaining points are still returned in decreasing Z order.
+
+    // Create a mock Surface Provider that covers from (0,0) - (8, 8) in space.
+    // It defines points spaced 1 apart, with heights of 0 and 4, and with the tag "test_surface1".
+    SurfaceData::SurfaceTagVector matchingTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider matchingProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, matchingTags,
+                                         AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Create a second mock Surface Provider over the same area with heights of 2 and 6, and with the tag "test_surface2".
+    // These points are interleaved with the first provider's points, but don't match the requested mask.
+    SurfaceData::SurfaceTagVector nonMatchingTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider nonMatchingProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, nonMatchingTags,
+                                            AZ::Vector3(0.0f, 0.0f, 2.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f),
+                                            AZ::EntityId(0x87654321));
+
+    // Query for all the surface points from (0, 0) - (4, 4) with a step size of 1, filtering to "test_surface1".
+    SurfaceData::SurfacePointList availablePointsPerPosition;
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, matchingTags, availablePointsPerPosition);
+
+    // We expect 16 input positions with two surface points each (with heights 4 and 0), and only the "test_surface1" tag.
+    EXPECT_EQ(availablePointsPerPosition.GetSize(), 32);
+    float expectedZ = 4.0f;
+    availablePointsPerPosition.EnumeratePoints(
+        [&availablePointsPerPosition, &expectedZ, this](size_t inPositionIndex, const AZ::Vector3& position,
+            [[maybe_unused]] const AZ::Vector3& normal, const SurfaceData::SurfaceTagWeights& masks) -> bool
+        {
+            EXPECT_EQ(availablePointsPerPosition.GetSize(inPositionIndex), 2);
+            EXPECT_EQ(position.GetZ(), expectedZ);
+            EXPECT_EQ(masks.GetSize(), 1);
+            EXPECT_TRUE(masks.HasMatchingTag(m_testSurface1Crc));
+            expectedZ = (expectedZ == 4.0f) ? 0.0f : 4.0f;
+            return true;
+        });
+}
+
 TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_SimilarPointsMergeTogether)
 {
     // This test verifies that if two separate providers create points at very similar heights, the
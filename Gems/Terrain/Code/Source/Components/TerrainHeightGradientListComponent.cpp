@@ -15,6 +15,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
@@ -209,11 +210,16 @@ namespace Terrain
             // Start by initializing all our terrainExists flags to false.
             AZStd::fill(terrainExistsList.begin(), terrainExistsList.end(), false);
 
+            // The max and height loops below run four positions at a time, so the temporary buffers are padded to whole lanes.
+            const size_t laneCount = 4;
+            const size_t paddedCount = (inOutPositionList.size() + laneCount - 1) / laneCount * laneCount;
+
             // Create a temporary buffer for storing all the gradient values for the currently-queried gradient.
-            AZStd::vector<float> curGradientSamples(inOutPositionList.size());
+            AZStd::vector<float> curGradientSamples(paddedCount);
 
             // Create a temporary buffer for storing all the max gradient values.
-            AZStd::vector<float> maxValueSamples(inOutPositionList.size());
+            AZStd::vector<float> maxValueSamples(paddedCount);
+            bool anyGradientQueried = false;
 
             // Right now, when the list contains multiple entries, we will use the highest point from each gradient.
             // This is needed in part because gradients don't really have world bounds, so they exist everywhere but generally have a
@@ -225,26 +231,49 @@ namespace Terrain
                 if (gradientId.IsValid())
                 {
                     GradientSignal::GradientRequestBus::Event(
-                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList,
+                        AZStd::span<float>(curGradientSamples.data(), inOutPositionList.size()));
 
-                    for (size_t index = 0; index < maxValueSamples.size(); index++)
+                    for (size_t index = 0; index < paddedCount; index += laneCount)
                     {
-                        maxValueSamples[index] = AZ::GetMax(maxValueSamples[index], curGradientSamples[index]);
-
-                        // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
-                        // terrain to *not* exist at a specific point.
-                        terrainExistsList[index] = true;
+                        AZ::Simd::Vec4::StoreUnaligned(
+                            &maxValueSamples[index],
+                            AZ::Simd::Vec4::Max(
+                                AZ::Simd::Vec4::LoadUnaligned(&maxValueSamples[index]),
+                                AZ::Simd::Vec4::LoadUnaligned(&curGradientSamples[index])));
                     }
+
+                    // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
+                    // terrain to *not* exist at a specific point.
+                    anyGradientQueried = true;
                 }
             }
 
-            for (size_t index = 0; index < inOutPositionList.size(); index++)
+            if (!anyGradientQueried)
+            {
+                return;
+            }
+
+            AZStd::fill(terrainExistsList.begin(), terrainExistsList.end(), true);
+
+            // Same math as AZ::Lerp and AZ::GetClamp, four positions at a time.
+            const AZ::Simd::Vec4::FloatType minBoundsHeight = AZ::Simd::Vec4::Splat(m_cachedShapeBounds.GetMin().GetZ());
+            const AZ::Simd::Vec4::FloatType boundsHeightRange =
+                AZ::Simd::Vec4::Splat(m_cachedShapeBounds.GetMax().GetZ() - m_cachedShapeBounds.GetMin().GetZ());
+            const AZ::Simd::Vec4::FloatType minWorldHeight = AZ::Simd::Vec4::Splat(m_cachedMinWorldHeight);
+            const AZ::Simd::Vec4::FloatType maxWorldHeight = AZ::Simd::Vec4::Splat(m_cachedMaxWorldHeight);
+            for (size_t index = 0; index < inOutPositionList.size(); index += laneCount)
             {
-                if (terrainExistsList[index])
+                const AZ::Simd::Vec4::FloatType height = AZ::Simd::Vec4::Add(
+                    minBoundsHeight, AZ::Simd::Vec4::Mul(boundsHeightRange, AZ::Simd::Vec4::LoadUnaligned(&maxValueSamples[index])));
+
+                float laneHeights[laneCount];
+                AZ::Simd::Vec4::StoreUnaligned(laneHeights, AZ::Simd::Vec4::Clamp(height, minWorldHeight, maxWorldHeight));
+
+                const size_t activeLanes = AZStd::min(laneCount, inOutPositionList.size() - index);
+                for (size_t lane = 0; lane < activeLanes; lane++)
                 {
-                    const float height =
-                        AZ::Lerp(m_cachedShapeBounds.GetMin().GetZ(), m_cachedShapeBounds.GetMax().GetZ(), maxValueSamples[index]);
-                    inOutPositionList[index].SetZ(AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight));
+                    inOutPositionList[index + lane].SetZ(laneHeights[lane]);
                 }
             }
         }
@@ -260,6 +289,15 @@ namespace Terrain
             AzFramework::Terrain::TerrainDataNotifications::HeightData);
     }
 
+    void TerrainHeightGradientListComponent::OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion)
+    {
+        // The bounds of the area are unchanged when only the gradients changed within a region, so only that region
+        // needs to be refreshed.
+        TerrainSystemServiceRequestBus::Broadcast(
+            &TerrainSystemServiceRequestBus::Events::RefreshAreaRegion, GetEntityId(), dirtyRegion,
+            AzFramework::Terrain::TerrainDataNotifications::HeightData);
+    }
+
     void TerrainHeightGradientListComponent::RefreshMinMaxHeights()
     {
         // Get the height range of our height provider based on the shape component.
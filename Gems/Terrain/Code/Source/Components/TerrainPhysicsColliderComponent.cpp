@@ -138,13 +138,29 @@ namespace Terrain
         return false;
     }
 
-    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange()
+    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion)
     {
         AZ::Aabb worldSize = AZ::Aabb::CreateNull();
 
         LmbrCentral::ShapeComponentRequestsBus::EventResult(
             worldSize, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::GetEncompassingAabb);
 
+        if (dirtyRegion.IsValid() && worldSize.IsValid())
+        {
+            // Only pass along the part of the dirty region covered by the heightfield, over its whole height range,
+            // so that the listeners can refresh the samples of that area alone.
+            const AZ::Vector3 regionMin = dirtyRegion.GetMin().GetMax(worldSize.GetMin());
+            const AZ::Vector3 regionMax = dirtyRegion.GetMax().GetMin(worldSize.GetMax());
+            if (regionMin.GetX() > regionMax.GetX() || regionMin.GetY() > regionMax.GetY())
+            {
+                return;
+            }
+
+            worldSize = AZ::Aabb::CreateFromMinMaxValues(
+                regionMin.GetX(), regionMin.GetY(), worldSize.GetMin().GetZ(),
+                regionMax.GetX(), regionMax.GetY(), worldSize.GetMax().GetZ());
+        }
+
         Physics::HeightfieldProviderNotificationBus::Broadcast(
             &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, worldSize);
     }
@@ -171,10 +187,17 @@ namespace Terrain
         NotifyListenersOfHeightfieldDataChange();
     }
 
-    void TerrainPhysicsColliderComponent::OnTerrainDataChanged(
-        [[maybe_unused]] const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
+    void TerrainPhysicsColliderComponent::OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
     {
-        NotifyListenersOfHeightfieldDataChange();
+        if (dataChangedMask & TerrainDataChangedMask::Settings)
+        {
+            // The query resolution or the world bounds might have changed, which changes the whole heightfield.
+            NotifyListenersOfHeightfieldDataChange();
+        }
+        else if (dataChangedMask & (TerrainDataChangedMask::HeightData | TerrainDataChangedMask::SurfaceData))
+        {
+            NotifyListenersOfHeightfieldDataChange(dirtyRegion);
+        }
     }
 
     AZ::Aabb TerrainPhysicsColliderComponent::GetHeightfieldAabb() const
@@ -297,9 +320,25 @@ namespace Terrain
 
     void TerrainPhysicsColliderComponent::GenerateHeightsAndMaterialsInBounds(
         AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const
+    {
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
+
+        GenerateHeightsAndMaterialsInBounds(heightMaterials, 0, 0, gridWidth, gridHeight);
+    }
+
+    void TerrainPhysicsColliderComponent::GenerateHeightsAndMaterialsInBounds(
+        AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials,
+        int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows) const
     {
         AZ_PROFILE_FUNCTION(Entity);
 
+        heightMaterials.clear();
+        if ((numColumns <= 0) || (numRows <= 0))
+        {
+            return;
+        }
+
         const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
 
         AZ::Aabb worldSize = GetHeightfieldAabb();
@@ -308,17 +347,28 @@ namespace Terrain
         const float worldHeightBoundsMin = worldSize.GetMin().GetZ();
         const float worldHeightBoundsMax = worldSize.GetMax().GetZ();
 
-        int32_t gridWidth, gridHeight;
-        GetHeightfieldGridSize(gridWidth, gridHeight);
+        // The samples are taken at the grid positions of the whole heightfield, so the region starts on the grid.
+        const AZ::Vector2 regionMin =
+            AZ::Vector2(worldSize.GetMin()) + AZ::Vector2(aznumeric_cast<float>(startColumn), aznumeric_cast<float>(startRow)) * gridResolution;
+        const AZ::Vector2 regionMax =
+            regionMin + AZ::Vector2(aznumeric_cast<float>(numColumns), aznumeric_cast<float>(numRows)) * gridResolution;
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(
+            regionMin.GetX(), regionMin.GetY(), worldHeightBoundsMin, regionMax.GetX(), regionMax.GetY(), worldHeightBoundsMax);
 
-        heightMaterials.clear();
-        heightMaterials.reserve(gridWidth * gridHeight);
+        heightMaterials.reserve(numColumns * numRows);
 
         AZStd::vector<Physics::MaterialId> materialList = GetMaterialList();
 
-        auto perPositionCallback = [&heightMaterials, &materialList, this, worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax]
-            ([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        auto perPositionCallback = [&heightMaterials, &materialList, this, worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax,
+            numColumns, numRows]
+            (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
         {
+            // Rounding of the region extents can add a column or a row past the requested ones.
+            if ((xIndex >= aznumeric_cast<size_t>(numColumns)) || (yIndex >= aznumeric_cast<size_t>(numRows)))
+            {
+                return;
+            }
+
             float height = surfacePoint.m_position.GetZ();
 
             // Any heights that fall outside the range of our bounding box will get turned into holes.
@@ -346,7 +396,7 @@ namespace Terrain
         };
 
         AzFramework::Terrain::TerrainDataRequestBus::Broadcast(&AzFramework::Terrain::TerrainDataRequests::ProcessSurfacePointsFromRegion,
-            worldSize, gridResolution, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+            region, gridResolution, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
     }
 
     AZ::Vector2 TerrainPhysicsColliderComponent::GetHeightfieldGridSpacing() const
@@ -419,4 +469,13 @@ namespace Terrain
 
         return heightMaterials;
     }
+
+    AZStd::vector<Physics::HeightMaterialPoint> TerrainPhysicsColliderComponent::GetHeightsAndMaterialsInRegion(
+        int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows) const
+    {
+        AZStd::vector<Physics::HeightMaterialPoint> heightMaterials;
+        GenerateHeightsAndMaterialsInBounds(heightMaterials, startColumn, startRow, numColumns, numRows);
+
+        return heightMaterials;
+    }
 }
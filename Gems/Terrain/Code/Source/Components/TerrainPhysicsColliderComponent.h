@@ -93,6 +93,8 @@ namespace Terrain
         AZStd::vector<Physics::MaterialId> GetMaterialList() const override;
         AZStd::vector<float> GetHeights() const override;
         AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const override;
+        AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterialsInRegion(
+            int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -107,8 +109,12 @@ namespace Terrain
 
         void GenerateHeightsInBounds(AZStd::vector<float>& heights) const;
         void GenerateHeightsAndMaterialsInBounds(AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const;
+        void GenerateHeightsAndMaterialsInBounds(
+            AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials,
+            int32_t startColumn, int32_t startRow, int32_t numColumns, int32_t numRows) const;
 
-        void NotifyListenersOfHeightfieldDataChange();
+        //! Notifies the listeners that the heightfield data changed within a region, or everywhere when the region is invalid.
+        void NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion = AZ::Aabb::CreateNull());
 
         // ShapeComponentNotificationsBus
         void OnShapeChanged(ShapeChangeReasons changeReason) override;
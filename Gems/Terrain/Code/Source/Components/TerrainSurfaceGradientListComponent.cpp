@@ -187,4 +187,13 @@ namespace Terrain
             AzFramework::Terrain::TerrainDataNotifications::SurfaceData);
     }
 
+    void TerrainSurfaceGradientListComponent::OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion)
+    {
+        // The bounds of the area are unchanged when only the gradients changed within a region, so only that region
+        // needs to be refreshed.
+        TerrainSystemServiceRequestBus::Broadcast(
+            &TerrainSystemServiceRequestBus::Events::RefreshAreaRegion, GetEntityId(), dirtyRegion,
+            AzFramework::Terrain::TerrainDataNotifications::SurfaceData);
+    }
+
 } // namespace Terrain
@@ -93,6 +93,15 @@ namespace Terrain
         "Turns on debugging for detail material update regions for terrain."
     );
 
+    AZ_CVAR(AZ::u32,
+        r_terrainDetailClipmapTexelsPerFrame,
+        0,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of detail material id texels refreshed per frame as the camera moves, the rest being refreshed on "
+        "the next frames. 0 refreshes all of them on the frame the camera moves."
+    );
+
     void TerrainDetailMaterialManager::Initialize(
         const AZStd::shared_ptr<AZ::Render::BindlessImageArrayHandler>& bindlessImageHandler,
         AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg)
@@ -227,6 +236,7 @@ namespace Terrain
         m_detailMaterialDataBuffer.Release();
 
         m_dirtyDetailRegion = AZ::Aabb::CreateNull();
+        m_pendingDetailRegions.clear();
 
         m_detailMaterialBufferNeedsUpdate = false;
         m_detailImageNeedsUpdate = false;
@@ -752,13 +762,14 @@ namespace Terrain
             {
                 UpdateDetailTexture(region.m_worldAabb, region.m_localAabb);
             }
+            m_pendingDetailRegions.clear();
         }
         else
         {
-            // Update the edge regions
+            // Queue the edge regions
             for (const auto& region : edgeUpdatedRegions)
             {
-                UpdateDetailTexture(region.m_worldAabb, region.m_localAabb);
+                m_pendingDetailRegions.push_back(region.m_worldAabb);
             }
 
             if (m_dirtyDetailRegion.IsValid())
@@ -766,15 +777,59 @@ namespace Terrain
                 m_dirtyDetailRegion = m_dirtyDetailRegion.GetClamped(untouchedRegion);
                 if (m_dirtyDetailRegion.IsValid())
                 {
-                    ClipmapBounds::ClipmapBoundsRegionList updateRegions = m_detailMaterialIdBounds.TransformRegion(m_dirtyDetailRegion);
-                    for (const auto& region : updateRegions)
-                    {
-                        UpdateDetailTexture(region.m_worldAabb, region.m_localAabb);
-                    }
+                    m_pendingDetailRegions.push_back(m_dirtyDetailRegion);
                 }
                 m_dirtyDetailRegion = AZ::Aabb::CreateNull();
             }
+
+            UpdatePendingDetailRegions();
+        }
+    }
+
+    void TerrainDetailMaterialManager::UpdatePendingDetailRegions()
+    {
+        const AZ::u32 texelBudget = r_terrainDetailClipmapTexelsPerFrame;
+        int64_t remainingTexels = (texelBudget > 0) ? aznumeric_cast<int64_t>(texelBudget) : AZStd::numeric_limits<int64_t>::max();
+
+        // Regions are transformed when they are filled rather than when they are queued, so the parts that left the
+        // clipmap as the camera kept moving are dropped, and the parts still in it go to their current texels.
+        AZStd::vector<AZ::Aabb> deferredRegions;
+        for (const AZ::Aabb& pendingRegion : m_pendingDetailRegions)
+        {
+            for (const auto& region : m_detailMaterialIdBounds.TransformRegion(pendingRegion))
+            {
+                if (remainingTexels <= 0)
+                {
+                    deferredRegions.push_back(region.m_worldAabb);
+                    continue;
+                }
+
+                const int64_t width = region.m_localAabb.m_max.m_x - region.m_localAabb.m_min.m_x;
+                const int64_t height = region.m_localAabb.m_max.m_y - region.m_localAabb.m_min.m_y;
+                if (width * height <= remainingTexels)
+                {
+                    UpdateDetailTexture(region.m_worldAabb, region.m_localAabb);
+                    remainingTexels -= width * height;
+                    continue;
+                }
+
+                // Fill the rows that fit in the budget, at least one so large regions always progress, and queue the rest.
+                const int64_t rows = AZStd::clamp<int64_t>(remainingTexels / width, 1, height - 1);
+                const float splitY = region.m_worldAabb.GetMin().GetY() + aznumeric_cast<float>(rows) * DetailTextureScale;
+
+                Aabb2i localRows = region.m_localAabb;
+                localRows.m_max.m_y = localRows.m_min.m_y + aznumeric_cast<int32_t>(rows);
+                AZ::Aabb worldRows = region.m_worldAabb;
+                worldRows.SetMax(AZ::Vector3(worldRows.GetMax().GetX(), splitY, worldRows.GetMax().GetZ()));
+                UpdateDetailTexture(worldRows, localRows);
+                remainingTexels -= width * rows;
+
+                AZ::Aabb worldRemainder = region.m_worldAabb;
+                worldRemainder.SetMin(AZ::Vector3(worldRemainder.GetMin().GetX(), splitY, worldRemainder.GetMin().GetZ()));
+                deferredRegions.push_back(worldRemainder);
+            }
         }
+        m_pendingDetailRegions = AZStd::move(deferredRegions);
     }
     
     void TerrainDetailMaterialManager::UpdateDetailTexture(const AZ::Aabb& worldUpdateAabb, const Aabb2i& textureUpdateAabb)
@@ -201,6 +201,9 @@ namespace Terrain
         //! required updates are then executed.
         void CheckUpdateDetailTexture(const AZ::Vector3& cameraPosition);
 
+        //! Fills the queued regions of the detail material id texture, up to r_terrainDetailClipmapTexelsPerFrame texels.
+        void UpdatePendingDetailRegions();
+
         //! Updates the detail texture in a given area
         void UpdateDetailTexture(const AZ::Aabb& worldUpdateAabb, const Aabb2i& textureUpdateAabb);
 
@@ -231,6 +234,8 @@ namespace Terrain
         uint8_t m_passthroughMaterialId = 0;
 
         AZ::Aabb m_dirtyDetailRegion{ AZ::Aabb::CreateNull() };
+        //! World regions of the detail material id texture left to fill, oldest first.
+        AZStd::vector<AZ::Aabb> m_pendingDetailRegions;
         ClipmapBounds m_detailMaterialIdBounds;
 
         AZ::RHI::ShaderInputImageIndex m_detailMaterialIdPropertyIndex;
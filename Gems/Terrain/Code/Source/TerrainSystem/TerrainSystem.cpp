@@ -7,6 +7,8 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -22,6 +24,9 @@
 
 using namespace Terrain;
 
+AZ_CVAR(bool, terrain_tileCache, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Keeps the terrain heights and surface weights of the grid points queried in memory, in tiles baked on demand.");
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/keylookup.
@@ -91,6 +96,7 @@ void TerrainSystem::Activate()
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
     }
+    m_tileCache.Clear();
 
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
 
@@ -132,6 +138,7 @@ void TerrainSystem::Deactivate()
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
     }
+    m_tileCache.Clear();
 
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainHeightDirty = true;
@@ -181,6 +188,40 @@ void TerrainSystem::ClampPosition(float x, float y, AZ::Vector2& outPosition, AZ
     outPosition = (normalizedPosition - normalizedDelta) * m_currentSettings.m_heightQueryResolution;
 }
 
+void TerrainSystem::ClampPositions(const AZStd::span<const AZ::Vector3>& inPositions, ClampedPositions& outPositions) const
+{
+    // Pad the arrays to whole lanes, so the last lanes can be loaded and stored like the others.
+    const size_t laneCount = 4;
+    const size_t paddedCount = (inPositions.size() + laneCount - 1) / laneCount * laneCount;
+    outPositions.m_x.resize(paddedCount);
+    outPositions.m_y.resize(paddedCount);
+    outPositions.m_deltaX.resize(paddedCount);
+    outPositions.m_deltaY.resize(paddedCount);
+
+    for (size_t i = 0; i < paddedCount; i++)
+    {
+        outPositions.m_x[i] = (i < inPositions.size()) ? inPositions[i].GetX() : 0.0f;
+        outPositions.m_y[i] = (i < inPositions.size()) ? inPositions[i].GetY() : 0.0f;
+    }
+
+    // Same math as ClampPosition, so both give the same results.
+    const AZ::Simd::Vec4::FloatType resolution = AZ::Simd::Vec4::Splat(m_currentSettings.m_heightQueryResolution);
+    for (size_t i = 0; i < paddedCount; i += laneCount)
+    {
+        const AZ::Simd::Vec4::FloatType normalizedX =
+            AZ::Simd::Vec4::Div(AZ::Simd::Vec4::LoadUnaligned(&outPositions.m_x[i]), resolution);
+        const AZ::Simd::Vec4::FloatType normalizedY =
+            AZ::Simd::Vec4::Div(AZ::Simd::Vec4::LoadUnaligned(&outPositions.m_y[i]), resolution);
+        const AZ::Simd::Vec4::FloatType flooredX = AZ::Simd::Vec4::Floor(normalizedX);
+        const AZ::Simd::Vec4::FloatType flooredY = AZ::Simd::Vec4::Floor(normalizedY);
+
+        AZ::Simd::Vec4::StoreUnaligned(&outPositions.m_deltaX[i], AZ::Simd::Vec4::Sub(normalizedX, flooredX));
+        AZ::Simd::Vec4::StoreUnaligned(&outPositions.m_deltaY[i], AZ::Simd::Vec4::Sub(normalizedY, flooredY));
+        AZ::Simd::Vec4::StoreUnaligned(&outPositions.m_x[i], AZ::Simd::Vec4::Mul(flooredX, resolution));
+        AZ::Simd::Vec4::StoreUnaligned(&outPositions.m_y[i], AZ::Simd::Vec4::Mul(flooredY, resolution));
+    }
+}
+
 bool TerrainSystem::InWorldBounds(float x, float y) const
 {
     const float zTestValue = m_currentSettings.m_worldBounds.GetMin().GetZ();
@@ -195,40 +236,46 @@ bool TerrainSystem::InWorldBounds(float x, float y) const
 // Generate positions to be queried based on the sampler type.
 void TerrainSystem::GenerateQueryPositions(const AZStd::span<const AZ::Vector3>& inPositions,
     AZStd::vector<AZ::Vector3>& outPositions,
-    Sampler sampler) const
+    Sampler sampler,
+    ClampedPositions& outClampedPositions) const
 {
     const float minHeight = m_currentSettings.m_worldBounds.GetMin().GetZ();
-    for (auto& position : inPositions)
+    switch(sampler)
     {
-        switch(sampler)
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
         {
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+            // The deltas are kept in outClampedPositions to interpolate the heights once they are queried.
+            ClampPositions(inPositions, outClampedPositions);
+            for (size_t i = 0; i < inPositions.size(); i++)
             {
-                AZ::Vector2 normalizedDelta;
-                AZ::Vector2 pos0;
-                ClampPosition(position.GetX(), position.GetY(), pos0, normalizedDelta);
-                const AZ::Vector2 pos1(pos0.GetX() + m_currentSettings.m_heightQueryResolution,
-                    pos0.GetY() + m_currentSettings.m_heightQueryResolution);
-                outPositions.emplace_back(AZ::Vector3(pos0.GetX(), pos0.GetY(), minHeight));
-                outPositions.emplace_back(AZ::Vector3(pos1.GetX(), pos0.GetY(), minHeight));
-                outPositions.emplace_back(AZ::Vector3(pos0.GetX(), pos1.GetY(), minHeight));
-                outPositions.emplace_back(AZ::Vector3(pos1.GetX(), pos1.GetY(), minHeight));
+                const float x0 = outClampedPositions.m_x[i];
+                const float y0 = outClampedPositions.m_y[i];
+                const float x1 = x0 + m_currentSettings.m_heightQueryResolution;
+                const float y1 = y0 + m_currentSettings.m_heightQueryResolution;
+                outPositions.emplace_back(AZ::Vector3(x0, y0, minHeight));
+                outPositions.emplace_back(AZ::Vector3(x1, y0, minHeight));
+                outPositions.emplace_back(AZ::Vector3(x0, y1, minHeight));
+                outPositions.emplace_back(AZ::Vector3(x1, y1, minHeight));
             }
-            break;
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+        }
+        break;
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+        {
+            ClampPositions(inPositions, outClampedPositions);
+            for (size_t i = 0; i < inPositions.size(); i++)
             {
-                AZ::Vector2 normalizedDelta;
-                AZ::Vector2 clampedPosition;
-                ClampPosition(position.GetX(), position.GetY(), clampedPosition, normalizedDelta);
-                outPositions.emplace_back(AZ::Vector3(clampedPosition.GetX(), clampedPosition.GetY(), minHeight));
+                outPositions.emplace_back(AZ::Vector3(outClampedPositions.m_x[i], outClampedPositions.m_y[i], minHeight));
             }
-            break;
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
-            [[fallthrough]];
-        default:
+        }
+        break;
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
+        [[fallthrough]];
+    default:
+        for (auto& position : inPositions)
+        {
             outPositions.emplace_back(AZ::Vector3(position.GetX(), position.GetY(), minHeight));
-            break;
         }
+        break;
     }
 }
 
@@ -274,6 +321,11 @@ void TerrainSystem::MakeBulkQueries(
     AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
     BulkQueriesCallback queryCallback) const
 {
+    if (inPositions.empty())
+    {
+        return;
+    }
+
     AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
 
     AZ::Aabb bounds;
@@ -284,47 +336,37 @@ void TerrainSystem::MakeBulkQueries(
     // than sorting the points into separate lists and handling putting them back together.
     // This may be sub optimal if the points are randomly distributed in the list as opposed
     // to points in the same area id being close to each other.
+    // The loop goes one past the last position to submit the last window, even when it holds a single position.
     size_t windowStart = 0;
-    size_t windowEnd = 0;
     const size_t numPositions = inPositions.size();
-    for(int i = 1; i < numPositions; i++)
+    for (size_t i = 1; i <= numPositions; i++)
     {
-        AZ::EntityId areaId = FindBestAreaEntityAtPosition(inPositions[i], bounds);
-        bool queryHeights = false;
-        if (areaId == prevAreaId)
+        AZ::EntityId areaId;
+        if (i < numPositions)
         {
-            // Update window end to current position.
-            // If it's the last position, submit the query.
-            windowEnd = i;
-            if (windowEnd == numPositions - 1)
+            areaId = FindBestAreaEntityAtPosition(inPositions[i], bounds);
+            if (areaId == prevAreaId)
             {
-                queryHeights = true;
+                continue;
             }
         }
-        else
-        {
-            queryHeights = true;
-        }
 
-        if (queryHeights)
+        // If the area id is a default entity id, it usually means the
+        // position is outside world bounds.
+        if (prevAreaId != AZ::EntityId())
         {
-            // If the area id is a default entity id, it usually means the
-            // position is outside world bounds.
-            if (prevAreaId != AZ::EntityId())
-            {
-                size_t spanLength = (windowEnd - windowStart) + 1;
-                queryCallback(AZStd::span<const AZ::Vector3>(inPositions.begin() + windowStart, spanLength),
-                    AZStd::span<AZ::Vector3>(outPositions.begin() + windowStart, spanLength),
-                    AZStd::span<bool>(outTerrainExists.begin() + windowStart, spanLength),
-                    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList>(outSurfaceWeights.begin() + windowStart, spanLength),
-                    prevAreaId);
-            }
+            const size_t spanLength = i - windowStart;
+            queryCallback(AZStd::span<const AZ::Vector3>(inPositions.begin() + windowStart, spanLength),
+                AZStd::span<AZ::Vector3>(outPositions.begin() + windowStart, spanLength),
+                AZStd::span<bool>(outTerrainExists.begin() + windowStart, spanLength),
+                AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList>(outSurfaceWeights.begin() + windowStart, spanLength),
+                prevAreaId);
+        }
 
-            // Reset the window to start at the current position. Set the new area
-            // id on which to run the next query.
-            windowStart = windowEnd = i;
-            prevAreaId = areaId;
-        }   
+        // Reset the window to start at the current position. Set the new area
+        // id on which to run the next query.
+        windowStart = i;
+        prevAreaId = areaId;
     }
 }
 
@@ -343,7 +385,8 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
     outPositions.reserve(inPositions.size() * indexStepSize);
     outTerrainExists.resize(inPositions.size() * indexStepSize);
 
-    GenerateQueryPositions(inPositions, outPositions, sampler);
+    ClampedPositions clampedPositions;
+    GenerateQueryPositions(inPositions, outPositions, sampler, clampedPositions);
 
     auto callback = []([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
                         AZStd::span<AZ::Vector3> outPositions,
@@ -359,38 +402,73 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+
+    // The clamp and bilinear samplers only query grid points, which the tile cache can always serve.
+    if (terrain_tileCache &&
+        (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT || m_tileCache.AreOnGrid(outPositions)))
+    {
+        m_tileCache.GetHeights(outPositions, outTerrainExists,
+            [this, &callback, &outSurfaceWeights](AZStd::span<AZ::Vector3> tilePositions, AZStd::span<bool> tileTerrainExists)
+            {
+                MakeBulkQueries(tilePositions, tilePositions, tileTerrainExists, outSurfaceWeights, callback);
+            });
+    }
+    else
+    {
+        MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    }
 
     // Compute/store the final result
-    for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
+    if (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR)
     {
-        switch(sampler)
+        // We now need to compute the final heights after all the bulk queries are done, four positions at a time,
+        // with the same math as AZ::Lerp.
+        const size_t laneCount = 4;
+        for (size_t i = 0; i < inPositions.size(); i += laneCount)
         {
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+            const size_t activeLanes = AZStd::min(laneCount, inPositions.size() - i);
+
+            // Gather each corner of the four positions into its own lanes.
+            float cornerHeights[4][laneCount] = {};
+            for (size_t lane = 0; lane < activeLanes; lane++)
             {
-                // We now need to compute the final height after all the bulk queries are done.
-                AZ::Vector2 normalizedDelta;
-                AZ::Vector2 clampedPosition;
-                ClampPosition(inPositions[i].GetX(), inPositions[i].GetY(), clampedPosition, normalizedDelta);
-                const float heightX0Y0 = outPositions[iteratorIndex].GetZ();
-                const float heightX1Y0 = outPositions[iteratorIndex + 1].GetZ();
-                const float heightX0Y1 = outPositions[iteratorIndex + 2].GetZ();
-                const float heightX1Y1 = outPositions[iteratorIndex + 3].GetZ();
-                const float heightXY0 = AZ::Lerp(heightX0Y0, heightX1Y0, normalizedDelta.GetX());
-                const float heightXY1 = AZ::Lerp(heightX0Y1, heightX1Y1, normalizedDelta.GetX());
-                heights[i] = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
-                terrainExists[i] = outTerrainExists[iteratorIndex];
+                const size_t iteratorIndex = (i + lane) * indexStepSize;
+                for (size_t corner = 0; corner < 4; corner++)
+                {
+                    cornerHeights[corner][lane] = outPositions[iteratorIndex + corner].GetZ();
+                }
+                terrainExists[i + lane] = outTerrainExists[iteratorIndex];
+            }
+
+            const AZ::Simd::Vec4::FloatType heightX0Y0 = AZ::Simd::Vec4::LoadUnaligned(cornerHeights[0]);
+            const AZ::Simd::Vec4::FloatType heightX1Y0 = AZ::Simd::Vec4::LoadUnaligned(cornerHeights[1]);
+            const AZ::Simd::Vec4::FloatType heightX0Y1 = AZ::Simd::Vec4::LoadUnaligned(cornerHeights[2]);
+            const AZ::Simd::Vec4::FloatType heightX1Y1 = AZ::Simd::Vec4::LoadUnaligned(cornerHeights[3]);
+            const AZ::Simd::Vec4::FloatType deltaX = AZ::Simd::Vec4::LoadUnaligned(&clampedPositions.m_deltaX[i]);
+            const AZ::Simd::Vec4::FloatType deltaY = AZ::Simd::Vec4::LoadUnaligned(&clampedPositions.m_deltaY[i]);
+
+            const AZ::Simd::Vec4::FloatType heightXY0 =
+                AZ::Simd::Vec4::Add(heightX0Y0, AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Sub(heightX1Y0, heightX0Y0), deltaX));
+            const AZ::Simd::Vec4::FloatType heightXY1 =
+                AZ::Simd::Vec4::Add(heightX0Y1, AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Sub(heightX1Y1, heightX0Y1), deltaX));
+            const AZ::Simd::Vec4::FloatType height =
+                AZ::Simd::Vec4::Add(heightXY0, AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Sub(heightXY1, heightXY0), deltaY));
+
+            float laneHeights[laneCount];
+            AZ::Simd::Vec4::StoreUnaligned(laneHeights, height);
+            for (size_t lane = 0; lane < activeLanes; lane++)
+            {
+                heights[i + lane] = laneHeights[lane];
             }
-            break;
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
-            [[fallthrough]];
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
-            [[fallthrough]];
-        default:
-            // For clamp and exact, we just need to store the results of the bulk query.
-            heights[i] = outPositions[iteratorIndex].GetZ();
-            terrainExists[i] = outTerrainExists[iteratorIndex];
-            break;
+        }
+    }
+    else
+    {
+        // For clamp and exact, we just need to store the results of the bulk query.
+        for (size_t i = 0; i < inPositions.size(); i++)
+        {
+            heights[i] = outPositions[i].GetZ();
+            terrainExists[i] = outTerrainExists[i];
         }
     }
 }
@@ -409,6 +487,20 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
         }
     }
 
+    // The grid points the clamp and bilinear samplers use are served by the tile cache when it's enabled.
+    if (terrain_tileCache && sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT)
+    {
+        const AZ::Vector3 position(x, y, 0.0f);
+        GetHeightsSynchronous(AZStd::span<const AZ::Vector3>(&position, 1), sampler, AZStd::span<float>(&height, 1),
+            AZStd::span<bool>(&terrainExists, 1));
+        if (terrainExistsPtr)
+        {
+            *terrainExistsPtr = terrainExists;
+        }
+        return AZ::GetClamp(
+            height, m_currentSettings.m_worldBounds.GetMin().GetZ(), m_currentSettings.m_worldBounds.GetMax().GetZ());
+    }
+
     AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
 
     switch (sampler)
@@ -875,7 +967,23 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     
     // This will be unused for surface weights. It's fine if it's empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(inPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+
+    // Surface weights are only ever queried at the exact positions, so the tile cache can only serve grid positions.
+    if (terrain_tileCache && m_tileCache.AreOnGrid(inPositions))
+    {
+        m_tileCache.GetSurfaceWeights(inPositions, outSurfaceWeightsList,
+            [this, &callback, &outPositions](
+                AZStd::span<const AZ::Vector3> tilePositions,
+                AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> tileSurfaceWeights)
+            {
+                AZStd::vector<bool> tileTerrainExists(tilePositions.size(), false);
+                MakeBulkQueries(tilePositions, outPositions, tileTerrainExists, tileSurfaceWeights, callback);
+            });
+    }
+    else
+    {
+        MakeBulkQueries(inPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1281,6 +1389,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    m_tileCache.Invalidate(aabb);
     m_terrainHeightDirty = true;
     m_terrainSurfacesDirty = true;
 }
@@ -1300,6 +1409,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                m_tileCache.Invalidate(areaData.m_areaBounds);
                 m_terrainHeightDirty = true;
                 m_terrainSurfacesDirty = true;
                 return true;
@@ -1325,6 +1435,7 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
     expandedAabb.AddAabb(newAabb);
 
     m_dirtyRegion.AddAabb(expandedAabb);
+    m_tileCache.Invalidate(expandedAabb);
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
 
@@ -1333,6 +1444,44 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
     m_terrainSurfacesDirty = m_terrainSurfacesDirty || ((changeMask & Terrain::SurfaceData) == Terrain::SurfaceData);
 }
 
+void TerrainSystem::RefreshAreaRegion(
+    AZ::EntityId areaId, const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
+{
+    using Terrain = AzFramework::Terrain::TerrainDataNotifications;
+
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
+
+    auto area = m_registeredAreas.find(areaId);
+    if (area == m_registeredAreas.end() || !area->second.m_areaBounds.IsValid() || !dirtyRegion.IsValid())
+    {
+        // Without known bounds to clip the region to, the whole area needs to be refreshed.
+        lock.unlock();
+        RefreshArea(areaId, changeMask);
+        return;
+    }
+
+    // Only the horizontal extent of the region is clipped to the area, its data covers the whole height range of the area.
+    const AZ::Aabb& areaBounds = area->second.m_areaBounds;
+    const AZ::Vector3 regionMin = dirtyRegion.GetMin().GetMax(areaBounds.GetMin());
+    const AZ::Vector3 regionMax = dirtyRegion.GetMax().GetMin(areaBounds.GetMax());
+    if (regionMin.GetX() > regionMax.GetX() || regionMin.GetY() > regionMax.GetY())
+    {
+        return;
+    }
+
+    const AZ::Aabb clippedRegion = AZ::Aabb::CreateFromMinMax(
+        AZ::Vector3(regionMin.GetX(), regionMin.GetY(), areaBounds.GetMin().GetZ()),
+        AZ::Vector3(regionMax.GetX(), regionMax.GetY(), areaBounds.GetMax().GetZ()));
+
+    // The dirty region is accumulated and sent out once on the next tick, along with the other refreshes of the frame.
+    m_dirtyRegion.AddAabb(clippedRegion);
+    m_tileCache.Invalidate(clippedRegion);
+
+    m_terrainHeightDirty = m_terrainHeightDirty || ((changeMask & Terrain::HeightData) == Terrain::HeightData);
+
+    m_terrainSurfacesDirty = m_terrainSurfacesDirty || ((changeMask & Terrain::SurfaceData) == Terrain::SurfaceData);
+}
+
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
 {
     using Terrain = AzFramework::Terrain::TerrainDataNotifications;
@@ -1363,6 +1512,7 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+        m_tileCache.Configure(m_currentSettings.m_heightQueryResolution, m_currentSettings.m_worldBounds.GetMin().GetZ());
     }
 
     if (terrainSettingsChanged || m_terrainHeightDirty || m_terrainSurfacesDirty)
@@ -1398,6 +1548,10 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
             &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged, dirtyRegion,
             changeMask);
+
+        // The terrain areas refresh their own cached data while handling the notification, so the tiles baked from the
+        // data they held until then are dropped as well.
+        m_tileCache.Invalidate(dirtyRegion);
     }
 
 }
@@ -26,6 +26,7 @@
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainTileCache.h>
 
 namespace Terrain
 {
@@ -52,6 +53,9 @@ namespace Terrain
         void UnregisterArea(AZ::EntityId areaId) override;
         void RefreshArea(
             AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
+        void RefreshAreaRegion(
+            AZ::EntityId areaId, const AZ::Aabb& dirtyRegion,
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
 
         ///////////////////////////////////////////
         // TerrainDataRequestBus::Handler Impl
@@ -277,6 +281,19 @@ namespace Terrain
             AZStd::shared_ptr<ProcessAsyncParams> params = nullptr) const;
 
         void ClampPosition(float x, float y, AZ::Vector2& outPosition, AZ::Vector2& normalizedDelta) const;
+
+        //! Grid positions and fractional deltas of a list of clamped positions, one array per component so they can be
+        //! computed and consumed in SIMD lanes. The arrays are padded to a multiple of the lane count.
+        struct ClampedPositions
+        {
+            AZStd::vector<float> m_x;
+            AZStd::vector<float> m_y;
+            AZStd::vector<float> m_deltaX;
+            AZStd::vector<float> m_deltaY;
+        };
+
+        //! Same as ClampPosition, for a list of positions evaluated four at a time.
+        void ClampPositions(const AZStd::span<const AZ::Vector3>& inPositions, ClampedPositions& outPositions) const;
         bool InWorldBounds(float x, float y) const;
 
         AZ::EntityId FindBestAreaEntityAtPosition(const AZ::Vector3& position, AZ::Aabb& bounds) const;
@@ -317,7 +334,8 @@ namespace Terrain
             BulkQueriesCallback queryCallback) const;
         void GenerateQueryPositions(const AZStd::span<const AZ::Vector3>& inPositions, 
             AZStd::vector<AZ::Vector3>& outPositions,
-            Sampler sampler) const;
+            Sampler sampler,
+            ClampedPositions& outClampedPositions) const;
         AZStd::vector<AZ::Vector3> GenerateInputPositionsFromRegion(
             const AZ::Aabb& inRegion,
             const AZ::Vector2& stepSize) const;
@@ -354,6 +372,9 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        //! Heights and surface weights of the grid points, used in place of the area queries when terrain_tileCache is set.
+        mutable TerrainTileCache m_tileCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
@@ -46,6 +46,11 @@ namespace Terrain
         virtual void RegisterArea(AZ::EntityId areaId) = 0;
         virtual void UnregisterArea(AZ::EntityId areaId) = 0;
         virtual void RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
+        //! Refresh only the part of an area overlapping the given region, when the data of the area changed within it
+        //! while its bounds stayed the same.
+        virtual void RefreshAreaRegion(
+            AZ::EntityId areaId, const AZ::Aabb& dirtyRegion,
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
     };
 
     using TerrainSystemServiceRequestBus = AZ::EBus<TerrainSystemServiceRequests>;
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainTileCache.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+AZ_CVAR(AZ::u32, terrain_tileCacheMaxTiles, 128, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of height tiles, and of surface weight tiles, kept by the terrain tile cache.");
+
+namespace Terrain
+{
+    void TerrainTileCache::Configure(float queryResolution, float minHeight)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (queryResolution != m_queryResolution || minHeight != m_minHeight)
+        {
+            m_queryResolution = queryResolution;
+            m_minHeight = minHeight;
+            m_heightTiles = {};
+            m_surfaceWeightsTiles = {};
+            ++m_generation;
+        }
+    }
+
+    void TerrainTileCache::Invalidate(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            Clear();
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        ++m_generation;
+
+        // Round outwards, so grid points right on the region edges are dropped too.
+        const GridPoint minGridPoint{ aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetX() / m_queryResolution)),
+                                      aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetY() / m_queryResolution)) };
+        const GridPoint maxGridPoint{ aznumeric_cast<int32_t>(AZStd::ceil(region.GetMax().GetX() / m_queryResolution)),
+                                      aznumeric_cast<int32_t>(AZStd::ceil(region.GetMax().GetY() / m_queryResolution)) };
+        const GridPoint minTile = ToTile(minGridPoint);
+        const GridPoint maxTile = ToTile(maxGridPoint);
+        EraseInRange(m_heightTiles, minTile, maxTile);
+        EraseInRange(m_surfaceWeightsTiles, minTile, maxTile);
+    }
+
+    void TerrainTileCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_heightTiles = {};
+        m_surfaceWeightsTiles = {};
+        ++m_generation;
+    }
+
+    bool TerrainTileCache::AreOnGrid(AZStd::span<const AZ::Vector3> positions) const
+    {
+        const float queryResolution = GetGridState().m_queryResolution;
+        for (const AZ::Vector3& position : positions)
+        {
+            const GridPoint gridPoint = ToGridPoint(position, queryResolution);
+            if (aznumeric_cast<float>(gridPoint.m_x) * queryResolution != position.GetX() ||
+                aznumeric_cast<float>(gridPoint.m_y) * queryResolution != position.GetY())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void TerrainTileCache::GetHeights(
+        AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> outTerrainExists, const BakeHeightsCallback& bake)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const GridState gridState = GetGridState();
+
+        // Consecutive positions are usually in the same tile, so the last tile is kept to skip most of the lookups.
+        AZStd::shared_ptr<const HeightTile> tile;
+        GridPoint tileIndex;
+        for (size_t i = 0; i < inOutPositions.size(); i++)
+        {
+            const GridPoint gridPoint = ToGridPoint(inOutPositions[i], gridState.m_queryResolution);
+            const GridPoint positionTile = ToTile(gridPoint);
+            if (!tile || positionTile.m_x != tileIndex.m_x || positionTile.m_y != tileIndex.m_y)
+            {
+                tile = FindOrBakeHeightTile(positionTile, gridState, bake);
+                tileIndex = positionTile;
+            }
+
+            const size_t index = GetIndexInTile(gridPoint, tileIndex);
+            inOutPositions[i].SetZ(tile->m_heights[index]);
+            outTerrainExists[i] = tile->m_terrainExists[index];
+        }
+    }
+
+    void TerrainTileCache::GetSurfaceWeights(
+        AZStd::span<const AZ::Vector3> inPositions,
+        AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
+        const BakeSurfaceWeightsCallback& bake)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const GridState gridState = GetGridState();
+
+        AZStd::shared_ptr<const SurfaceWeightsTile> tile;
+        GridPoint tileIndex;
+        for (size_t i = 0; i < inPositions.size(); i++)
+        {
+            const GridPoint gridPoint = ToGridPoint(inPositions[i], gridState.m_queryResolution);
+            const GridPoint positionTile = ToTile(gridPoint);
+            if (!tile || positionTile.m_x != tileIndex.m_x || positionTile.m_y != tileIndex.m_y)
+            {
+                tile = FindOrBakeSurfaceWeightsTile(positionTile, gridState, bake);
+                tileIndex = positionTile;
+            }
+
+            outSurfaceWeights[i] = tile->m_surfaceWeights[GetIndexInTile(gridPoint, tileIndex)];
+        }
+    }
+
+    size_t TerrainTileCache::GetTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_heightTiles.m_tiles.size() + m_surfaceWeightsTiles.m_tiles.size();
+    }
+
+    TerrainTileCache::GridState TerrainTileCache::GetGridState() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return { m_queryResolution, m_minHeight, m_generation };
+    }
+
+    TerrainTileCache::GridPoint TerrainTileCache::ToGridPoint(const AZ::Vector3& position, float queryResolution)
+    {
+        // Rounded rather than floored, as positions computed from the grid can land a hair below their grid point.
+        return { aznumeric_cast<int32_t>(AZStd::lround(position.GetX() / queryResolution)),
+                 aznumeric_cast<int32_t>(AZStd::lround(position.GetY() / queryResolution)) };
+    }
+
+    TerrainTileCache::GridPoint TerrainTileCache::ToTile(const GridPoint& gridPoint)
+    {
+        // Floored division, so negative grid points go to the tiles below zero.
+        auto floorDivide = [](int32_t value)
+        {
+            return (value >= 0) ? (value / TileSize) : ((value - TileSize + 1) / TileSize);
+        };
+        return { floorDivide(gridPoint.m_x), floorDivide(gridPoint.m_y) };
+    }
+
+    TerrainTileCache::TileKey TerrainTileCache::MakeTileKey(const GridPoint& tile)
+    {
+        return (static_cast<TileKey>(static_cast<AZ::u32>(tile.m_x)) << 32) | static_cast<AZ::u32>(tile.m_y);
+    }
+
+    size_t TerrainTileCache::GetIndexInTile(const GridPoint& gridPoint, const GridPoint& tile)
+    {
+        const size_t localX = aznumeric_cast<size_t>(gridPoint.m_x - (tile.m_x * TileSize));
+        const size_t localY = aznumeric_cast<size_t>(gridPoint.m_y - (tile.m_y * TileSize));
+        return (localY * TileSize) + localX;
+    }
+
+    void TerrainTileCache::GenerateTilePositions(
+        const GridPoint& tile, const GridState& gridState, AZStd::vector<AZ::Vector3>& outPositions)
+    {
+        // Same math as the clamped query positions, so the baked points are the ones the samplers ask for.
+        outPositions.clear();
+        outPositions.reserve(TileSize * TileSize);
+        for (int32_t y = 0; y < TileSize; y++)
+        {
+            const float fy = aznumeric_cast<float>((tile.m_y * TileSize) + y) * gridState.m_queryResolution;
+            for (int32_t x = 0; x < TileSize; x++)
+            {
+                const float fx = aznumeric_cast<float>((tile.m_x * TileSize) + x) * gridState.m_queryResolution;
+                outPositions.emplace_back(AZ::Vector3(fx, fy, gridState.m_minHeight));
+            }
+        }
+    }
+
+    AZStd::shared_ptr<const TerrainTileCache::HeightTile> TerrainTileCache::FindOrBakeHeightTile(
+        const GridPoint& tile, const GridState& gridState, const BakeHeightsCallback& bake)
+    {
+        const TileKey key = MakeTileKey(tile);
+        if (auto cachedTile = Find(m_heightTiles, key))
+        {
+            return cachedTile;
+        }
+
+        AZ_PROFILE_SCOPE(Entity, "TerrainTileCache::BakeHeightTile");
+
+        AZStd::vector<AZ::Vector3> positions;
+        GenerateTilePositions(tile, gridState, positions);
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        bake(positions, terrainExists);
+
+        auto bakedTile = AZStd::make_shared<HeightTile>();
+        bakedTile->m_heights.reserve(positions.size());
+        for (const AZ::Vector3& position : positions)
+        {
+            bakedTile->m_heights.push_back(position.GetZ());
+        }
+        bakedTile->m_terrainExists = AZStd::move(terrainExists);
+
+        return Insert<HeightTile>(m_heightTiles, key, AZStd::move(bakedTile), gridState.m_generation);
+    }
+
+    AZStd::shared_ptr<const TerrainTileCache::SurfaceWeightsTile> TerrainTileCache::FindOrBakeSurfaceWeightsTile(
+        const GridPoint& tile, const GridState& gridState, const BakeSurfaceWeightsCallback& bake)
+    {
+        const TileKey key = MakeTileKey(tile);
+        if (auto cachedTile = Find(m_surfaceWeightsTiles, key))
+        {
+            return cachedTile;
+        }
+
+        AZ_PROFILE_SCOPE(Entity, "TerrainTileCache::BakeSurfaceWeightsTile");
+
+        AZStd::vector<AZ::Vector3> positions;
+        GenerateTilePositions(tile, gridState, positions);
+
+        auto bakedTile = AZStd::make_shared<SurfaceWeightsTile>();
+        bakedTile->m_surfaceWeights.resize(positions.size());
+        bake(positions, bakedTile->m_surfaceWeights);
+
+        return Insert<SurfaceWeightsTile>(m_surfaceWeightsTiles, key, AZStd::move(bakedTile), gridState.m_generation);
+    }
+
+    template<typename TileType>
+    AZStd::shared_ptr<const TileType> TerrainTileCache::Find(const TileMap<TileType>& tileMap, TileKey key) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        auto tileIter = tileMap.m_tiles.find(key);
+        return (tileIter != tileMap.m_tiles.end()) ? tileIter->second : nullptr;
+    }
+
+    template<typename TileType>
+    AZStd::shared_ptr<const TileType> TerrainTileCache::Insert(
+        TileMap<TileType>& tileMap, TileKey key, AZStd::shared_ptr<const TileType> tile, AZ::u64 generation)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        // The terrain changed while the tile was baked, so it's still good for the query that baked it but not to keep.
+        if (generation != m_generation)
+        {
+            return tile;
+        }
+
+        // Another thread may have baked the same tile in the meantime.
+        auto [tileIter, inserted] = tileMap.m_tiles.emplace(key, tile);
+        if (!inserted)
+        {
+            return tileIter->second;
+        }
+
+        tileMap.m_insertionOrder.push_back(key);
+        const size_t maxTiles = AZStd::max<size_t>(terrain_tileCacheMaxTiles, 1);
+        while (tileMap.m_insertionOrder.size() > maxTiles)
+        {
+            const TileKey evictedKey = tileMap.m_insertionOrder.front();
+            tileMap.m_insertionOrder.pop_front();
+            if (evictedKey != key)
+            {
+                tileMap.m_tiles.erase(evictedKey);
+            }
+        }
+        return tile;
+    }
+
+    template<typename TileType>
+    void TerrainTileCache::EraseInRange(TileMap<TileType>& tileMap, const GridPoint& minTile, const GridPoint& maxTile)
+    {
+        // The keys stay in the insertion order, as they are skipped when evicted.
+        AZStd::erase_if(
+            tileMap.m_tiles,
+            [&minTile, &maxTile](const auto& item)
+            {
+                const int32_t tileX = static_cast<int32_t>(static_cast<AZ::u32>(item.first >> 32));
+                const int32_t tileY = static_cast<int32_t>(static_cast<AZ::u32>(item.first));
+                return tileX >= minTile.m_x && tileX <= maxTile.m_x && tileY >= minTile.m_y && tileY <= maxTile.m_y;
+            });
+    }
+} // namespace Terrain
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+#include <AzFramework/SurfaceData/SurfaceData.h>
+
+namespace Terrain
+{
+    //! Keeps the heights and surface weights of the terrain grid points in memory, baked on demand in square tiles of
+    //! grid points, so repeated queries over the same part of the terrain don't go back to the terrain areas each time.
+    //! Only positions lying on the terrain grid are served. Tiles are dropped when the terrain data of their region
+    //! changes, and the oldest tiles are evicted beyond terrain_tileCacheMaxTiles tiles of each kind.
+    //! All the methods are thread-safe, the tiles being baked outside of the cache lock.
+    class TerrainTileCache
+    {
+    public:
+        //! Number of grid points along each side of a tile.
+        static constexpr int32_t TileSize = 32;
+
+        //! Queries the terrain areas for the heights of grid positions, the position heights being set to the minimum
+        //! height where no area gives a height.
+        using BakeHeightsCallback = AZStd::function<void(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> outTerrainExists)>;
+
+        //! Queries the terrain areas for the weights of grid positions, sorted in decreasing weight order.
+        using BakeSurfaceWeightsCallback = AZStd::function<void(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights)>;
+
+        //! Sets the spacing of the terrain grid and the height given to the positions without terrain.
+        //! All the tiles are dropped when either changes.
+        void Configure(float queryResolution, float minHeight);
+
+        //! Drops the tiles with grid points in the region, or all of them for an invalid region.
+        void Invalidate(const AZ::Aabb& region);
+        void Clear();
+
+        //! Returns true if every position lies exactly on a grid point, so the cache can serve them.
+        bool AreOnGrid(AZStd::span<const AZ::Vector3> positions) const;
+
+        //! Sets the height and the terrain exists flag of each grid position from its tile, baking it first if needed.
+        void GetHeights(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> outTerrainExists, const BakeHeightsCallback& bake);
+
+        //! Sets the ordered surface weights of each grid position from its tile, baking it first if needed.
+        void GetSurfaceWeights(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
+            const BakeSurfaceWeightsCallback& bake);
+
+        //! Returns the number of tiles currently baked, heights and surface weights alike.
+        size_t GetTileCount() const;
+
+    private:
+        using TileKey = AZ::u64;
+
+        struct HeightTile
+        {
+            AZStd::vector<float> m_heights;
+            AZStd::vector<bool> m_terrainExists;
+        };
+
+        struct SurfaceWeightsTile
+        {
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceWeights;
+        };
+
+        template<typename TileType>
+        struct TileMap
+        {
+            AZStd::unordered_map<TileKey, AZStd::shared_ptr<const TileType>> m_tiles;
+            //! Insertion order of the tiles for the eviction, which can still hold the keys of dropped tiles.
+            AZStd::deque<TileKey> m_insertionOrder;
+        };
+
+        //! Grid settings read once per query, along with the generation they were read at.
+        struct GridState
+        {
+            float m_queryResolution = 1.0f;
+            float m_minHeight = 0.0f;
+            AZ::u64 m_generation = 0;
+        };
+
+        struct GridPoint
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+        };
+
+        GridState GetGridState() const;
+        static GridPoint ToGridPoint(const AZ::Vector3& position, float queryResolution);
+        static GridPoint ToTile(const GridPoint& gridPoint);
+        static TileKey MakeTileKey(const GridPoint& tile);
+        static size_t GetIndexInTile(const GridPoint& gridPoint, const GridPoint& tile);
+        static void GenerateTilePositions(const GridPoint& tile, const GridState& gridState, AZStd::vector<AZ::Vector3>& outPositions);
+
+        AZStd::shared_ptr<const HeightTile> FindOrBakeHeightTile(
+            const GridPoint& tile, const GridState& gridState, const BakeHeightsCallback& bake);
+        AZStd::shared_ptr<const SurfaceWeightsTile> FindOrBakeSurfaceWeightsTile(
+            const GridPoint& tile, const GridState& gridState, const BakeSurfaceWeightsCallback& bake);
+
+        template<typename TileType>
+        AZStd::shared_ptr<const TileType> Find(const TileMap<TileType>& tileMap, TileKey key) const;
+        template<typename TileType>
+        AZStd::shared_ptr<const TileType> Insert(
+            TileMap<TileType>& tileMap, TileKey key, AZStd::shared_ptr<const TileType> tile, AZ::u64 generation);
+        template<typename TileType>
+        void EraseInRange(TileMap<TileType>& tileMap, const GridPoint& minTile, const GridPoint& maxTile);
+
+        mutable AZStd::shared_mutex m_mutex;
+        TileMap<HeightTile> m_heightTiles;
+        TileMap<SurfaceWeightsTile> m_surfaceWeightsTiles;
+        float m_queryResolution = 1.0f;
+        float m_minHeight = 0.0f;
+        //! Incremented on each invalidation, so tiles baked from data read before it are not inserted afterwards.
+        AZ::u64 m_generation = 0;
+    };
+} // namespace Terrain
@@ -122,6 +122,31 @@ TEST_F(TerrainHeightGradientListComponentTest, TerrainHeightGradientRefreshesTer
     Mock::VerifyAndClearExpectations(&terrainSystem);
 }
 
+TEST_F(TerrainHeightGradientListComponentTest, TerrainHeightGradientRefreshesOnlyTheChangedRegion)
+{
+    // Check that the HeightGradientListComponent only refreshes the changed region when the composition changes within it.
+    auto entity = CreateEntity();
+
+    AddHeightGradientListToEntity(entity.get());
+
+    AddRequiredComponentsToEntity(entity.get());
+
+    entity->Activate();
+
+    NiceMock<UnitTest::MockTerrainSystemService> terrainSystem;
+
+    // The region is forwarded as is by the dependency monitor, so both notifications refresh that region alone.
+    const AZ::Aabb dirtyRegion = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f);
+    EXPECT_CALL(terrainSystem, RefreshAreaRegion(_, dirtyRegion, _)).Times(2);
+    EXPECT_CALL(terrainSystem, RefreshArea(_, _)).Times(0);
+
+    LmbrCentral::DependencyNotificationBus::Event(
+        entity->GetId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionRegionChanged, dirtyRegion);
+
+    // Stop the EXPECT_CALL check now, as OnCompositionChanged will get called twice again during the reset.
+    Mock::VerifyAndClearExpectations(&terrainSystem);
+}
+
 TEST_F(TerrainHeightGradientListComponentTest, TerrainHeightGradientListReturnsHeights)
 {
     // Check that the HeightGradientListComponent returns expected height values.
@@ -448,6 +448,50 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderGetHeightsAndM
     EXPECT_NEAR(heightsAndMaterials[256 * 128].m_height, expectedHeightValue, 0.01f);
 }
 
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderGetHeightsAndMaterialsInRegionReturnsCorrectly)
+{
+    // Check that the TerrainPhysicsCollider returns the samples of a rectangle of its grid with the same values as the whole grid.
+    AddTerrainPhysicsColliderToEntity(Terrain::TerrainPhysicsColliderConfig());
+
+    m_entity->Activate();
+
+    const AZ::Vector3 boundsMin = AZ::Vector3(0.0f);
+    const AZ::Vector3 boundsMax = AZ::Vector3(256.0f, 256.0f, 32768.0f);
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(boundsMin, boundsMax);
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    const float mockHeight = 32768.0f;
+    float mockHeightResolution = 1.0f;
+
+    AZ::Aabb requestedRegion = AZ::Aabb::CreateNull();
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
+    ON_CALL(terrainListener, ProcessSurfacePointsFromRegion).WillByDefault(
+        [this, mockHeight, &requestedRegion](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+        {
+            requestedRegion = inRegion;
+            ProcessRegionLoop(inRegion, stepSize, perPositionCallback, nullptr, mockHeight);
+        }
+    );
+
+    AZStd::vector<Physics::HeightMaterialPoint> heightsAndMaterials;
+
+    Physics::HeightfieldProviderRequestsBus::EventResult(
+        heightsAndMaterials, m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterialsInRegion,
+        16, 32, 8, 4);
+
+    EXPECT_EQ(heightsAndMaterials.size(), 8 * 4);
+    EXPECT_NEAR(heightsAndMaterials[0].m_height, 16384.0f, 0.01f);
+
+    // The region starts at the grid position of its first sample.
+    EXPECT_NEAR(requestedRegion.GetMin().GetX(), 16.0f, 0.01f);
+    EXPECT_NEAR(requestedRegion.GetMin().GetY(), 32.0f, 0.01f);
+}
+
 TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderDefaultMaterialAssignedWhenTagHasNoMapping)
 {
     // Create two SurfaceTag/Material mappings and add them to the collider.
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/std/parallel/semaphore.h>
@@ -31,6 +32,8 @@ using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::SetArgReferee;
 
+AZ_CVAR_EXTERNED(bool, terrain_tileCache);
+
 namespace UnitTest
 {
     class TerrainSystemTest : public ::testing::Test
@@ -923,6 +926,46 @@ namespace UnitTest
         terrainSystem->ProcessHeightsFromRegion(testRegionBox, stepSize, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
     }
 
+    TEST_F(TerrainSystemTest, TerrainTileCacheServesHeightsUntilTheAreaIsRefreshed)
+    {
+        // Heights served from the tile cache should match the area heights, and change once the area is refreshed.
+        terrain_tileCache = true;
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        float heightOffset = 0.0f;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() + position.GetY() + heightOffset);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        const AZ::Aabb testRegionBox = AZ::Aabb::CreateFromMinMaxValues(-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f);
+        const AZ::Vector2 stepSize(0.5f);
+        auto perPositionCallback = [&heightOffset]([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+            const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            constexpr float epsilon = 0.0001f;
+            const float expectedHeight = surfacePoint.m_position.GetX() + surfacePoint.m_position.GetY() + heightOffset;
+            EXPECT_NEAR(surfacePoint.m_position.GetZ(), expectedHeight, epsilon);
+            EXPECT_TRUE(terrainExists);
+        };
+
+        terrainSystem->ProcessHeightsFromRegion(
+            testRegionBox, stepSize, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+
+        // The cached tiles are dropped when the area tells the terrain system its heights changed.
+        heightOffset = 5.0f;
+        terrainSystem->RefreshArea(entity->GetId(), AzFramework::Terrain::TerrainDataNotifications::HeightData);
+        terrainSystem->ProcessHeightsFromRegion(
+            testRegionBox, stepSize, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+
+        terrain_tileCache = false;
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessNormalsFromRegionWithBilinearSamplers)
     {
         // This repeats the same test as TerrainHeightQueriesWithBilinearSamplersUseQueryGridToInterpolate
@@ -59,4 +59,6 @@ set(FILES
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
+    Source/TerrainSystem/TerrainTileCache.cpp
+    Source/TerrainSystem/TerrainTileCache.h
 )
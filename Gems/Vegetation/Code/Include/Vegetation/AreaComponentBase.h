@@ -77,6 +77,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // LmbrCentral::DependencyNotificationBus
         void OnCompositionChanged() override;
+        void OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion) override;
 
         //////////////////////////////////////////////////////////////////////////
         // AreaNotificationBus
@@ -45,6 +45,9 @@ namespace Vegetation
         virtual void RegisterArea(AZ::EntityId areaId, AZ::u32 layer, AZ::u32 priority, const AZ::Aabb& bounds) = 0;
         virtual void UnregisterArea(AZ::EntityId areaId) = 0;
         virtual void RefreshArea(AZ::EntityId areaId, AZ::u32 layer, AZ::u32 priority, const AZ::Aabb& bounds) = 0;
+        //! Refresh only the sectors of an area overlapping the given region, when the area changed within it while keeping
+        //! its bounds, layer and priority.
+        virtual void RefreshAreaRegion(AZ::EntityId areaId, const AZ::Aabb& dirtyRegion) = 0;
         virtual void RefreshAllAreas() = 0;
         virtual void ClearAllAreas() = 0;
 
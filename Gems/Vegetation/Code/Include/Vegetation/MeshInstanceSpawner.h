@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Vegetation/InstanceSpawner.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+
+namespace Vegetation
+{
+    /**
+    * Instance spawner of bare meshes.  Each instance is a mesh handle acquired straight from the mesh feature processor,
+    * without the entity, components and spawn ticket that a prefab instance needs, which makes it much lighter for
+    * dense vegetation such as grass that doesn't need any behavior on its instances.
+    */
+    class MeshInstanceSpawner
+        : public InstanceSpawner
+        , private AZ::Data::AssetBus::MultiHandler
+    {
+    public:
+        AZ_RTTI(MeshInstanceSpawner, "{1F2C5E31-6C7B-4F8E-9B5A-3E0F2D7C4A91}", InstanceSpawner);
+        AZ_CLASS_ALLOCATOR(MeshInstanceSpawner, AZ::SystemAllocator, 0);
+        static void Reflect(AZ::ReflectContext* context);
+
+        MeshInstanceSpawner();
+        virtual ~MeshInstanceSpawner();
+
+        //! Start loading any assets that the spawner will need.
+        void LoadAssets() override;
+
+        //! Unload any assets that the spawner loaded.
+        void UnloadAssets() override;
+
+        //! Perform any extra initialization needed at the point of registering with the vegetation system.
+        void OnRegisterUniqueDescriptor() override;
+
+        //! Perform any extra cleanup needed at the point of unregistering with the vegetation system.
+        void OnReleaseUniqueDescriptor() override;
+
+        //! Does this exist but have empty asset references?
+        bool HasEmptyAssetReferences() const override;
+
+        //! Has this finished loading any assets that are needed?
+        bool IsLoaded() const override;
+
+        //! Are the assets loaded, initialized, and spawnable?
+        bool IsSpawnable() const override;
+
+        //! Display name of the instances that will be spawned.
+        AZStd::string GetName() const override;
+
+        //! Create a single instance.
+        InstancePtr CreateInstance(const InstanceData& instanceData) override;
+
+        //! Destroy a single instance.
+        void DestroyInstance(InstanceId id, InstancePtr instance) override;
+
+        AZStd::string GetModelAssetPath() const;
+        void SetModelAssetPath(const AZStd::string& assetPath);
+
+        AZ::Data::AssetId GetModelAssetId() const;
+        void SetModelAssetId(const AZ::Data::AssetId& assetId);
+
+    private:
+        //! The opaque instance data handed to the vegetation system for each instance.
+        struct MeshInstance
+        {
+            AZ_CLASS_ALLOCATOR(MeshInstance, AZ::SystemAllocator, 0);
+
+            AZ::Render::MeshFeatureProcessorInterface* m_meshFeatureProcessor = nullptr;
+            AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
+        };
+
+        bool DataIsEquivalent(const InstanceSpawner& rhs) const override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::Data::AssetBus::Handler
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+
+        AZ::u32 ModelAssetChanged();
+        void ResetModelAsset();
+
+        void UpdateCachedValues();
+
+        //! Release the mesh handle of an instance, leaving the instance record for DestroyInstance to delete.
+        static void ReleaseMeshInstance(MeshInstance& meshInstance);
+
+        //! Cached values so that asset isn't accessed on other threads
+        bool m_assetLoadedAndSpawnable = false;
+
+        //! Collection of created instances, needed for releasing their meshes when the assets get unloaded.
+        AZStd::unordered_set<MeshInstance*> m_meshInstances;
+
+        //! asset data
+        AZ::Data::Asset<AZ::RPI::ModelAsset> m_modelAsset;
+    };
+
+} // namespace Vegetation
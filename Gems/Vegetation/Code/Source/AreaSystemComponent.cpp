@@ -18,10 +18,12 @@
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -37,6 +39,10 @@
 #include <ISystem.h>
 #include <cinttypes>
 
+AZ_CVAR(AZ::u32, veg_sectorPointJobs, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of sectors whose surface points are gathered in parallel on the job system ahead of filling them, "
+    "1 to gather them one sector at a time on the vegetation thread.");
+
 namespace Vegetation
 {
     namespace AreaSystemUtil
@@ -539,6 +545,39 @@ namespace Vegetation
             });
     }
 
+    void AreaSystemComponent::RefreshAreaRegion(AZ::EntityId areaId, const AZ::Aabb& dirtyRegion)
+    {
+        m_vegTasks.QueueVegetationTask([areaId, dirtyRegion](UpdateContext* context, PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+            {
+                auto itArea = threadData->m_globalVegetationAreaMap.find(areaId);
+                if (itArea != threadData->m_globalVegetationAreaMap.end())
+                {
+                    auto& area = itArea->second;
+                    const auto& cachedMainThreadData = context->GetCachedMainThreadData();
+
+                    // Sectors are only tracked in 2D, so only the horizontal extent of the region is clipped to the area
+                    AZ::Aabb sectorBounds = area.m_bounds;
+                    if (dirtyRegion.IsValid() && area.m_bounds.IsValid())
+                    {
+                        const AZ::Vector3 regionMin = dirtyRegion.GetMin().GetMax(area.m_bounds.GetMin());
+                        const AZ::Vector3 regionMax = dirtyRegion.GetMax().GetMin(area.m_bounds.GetMax());
+                        if (regionMin.GetX() > regionMax.GetX() || regionMin.GetY() > regionMax.GetY())
+                        {
+                            return;
+                        }
+                        sectorBounds = AZ::Aabb::CreateFromMinMax(
+                            AZ::Vector3(regionMin.GetX(), regionMin.GetY(), area.m_bounds.GetMin().GetZ()),
+                            AZ::Vector3(regionMax.GetX(), regionMax.GetY(), area.m_bounds.GetMax().GetZ()));
+                    }
+
+                    AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaRefreshed);
+
+                    vegTasks->MarkDirtySectors(sectorBounds, threadData->m_dirtySectorContents,
+                                                 cachedMainThreadData.m_worldToSector, cachedMainThreadData.m_currViewRect);
+                }
+            });
+    }
+
     void AreaSystemComponent::RefreshAllAreas()
     {
         m_vegTasks.QueueVegetationTask([](UpdateContext* context, PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
@@ -1070,14 +1109,22 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(
+        const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode, ClaimContext* preparedPoints)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
         SectorInfo sectorInfo;
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        if (preparedPoints)
+        {
+            SetSectorPoints(sectorInfo, AZStd::move(*preparedPoints));
+        }
+        else
+        {
+            UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        }
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1136,6 +1183,12 @@ namespace Vegetation
             });
     }
 
+    void AreaSystemComponent::VegetationThreadTasks::SetSectorPoints(SectorInfo& sectorInfo, ClaimContext&& preparedPoints)
+    {
+        sectorInfo.m_baseContext.m_masks = AZStd::move(preparedPoints.m_masks);
+        sectorInfo.m_baseContext.m_availablePoints = AZStd::move(preparedPoints.m_availablePoints);
+    }
+
     void AreaSystemComponent::VegetationThreadTasks::UpdateSectorCallbacks(SectorInfo& sectorInfo)
     {
         //setup callback to test if matching point is already claimed
@@ -1560,6 +1613,9 @@ namespace Vegetation
 
         bool deleteAllSectors = false;
 
+        // Any sector in the refreshed work lists may need different surface points than the ones gathered so far.
+        m_preparedSectorPoints.clear();
+
         // Early exit if no active areas, no sectors are marked as dirty or updating, and there
         // are no sectors left in our rolling window.
         // Until an area becomes active again, there's no work that sectors should need to do.
@@ -1778,6 +1834,11 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
+            if (m_updateWorkList.back().second != UpdateMode::Fill)
+            {
+                PrepareSectorPoints(vegTasks);
+            }
+
             auto& updateEntry = m_updateWorkList.back();
             SectorId sectorId = updateEntry.first;
             UpdateMode mode = updateEntry.second;
@@ -1796,7 +1857,15 @@ namespace Vegetation
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        ClaimContext preparedPoints;
+                        if (TakePreparedSectorPoints(sectorId, preparedPoints))
+                        {
+                            vegTasks->SetSectorPoints(*sectorInfo, AZStd::move(preparedPoints));
+                        }
+                        else
+                        {
+                            vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        }
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1812,7 +1881,10 @@ namespace Vegetation
                     case UpdateMode::Create:
                     {
                         AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        ClaimContext preparedPoints;
+                        const bool hasPreparedPoints = TakePreparedSectorPoints(sectorId, preparedPoints);
+                        auto sectorInfo = vegTasks->CreateSector(
+                            sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode, hasPreparedPoints ? &preparedPoints : nullptr);
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1826,4 +1898,70 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::PrepareSectorPoints(VegetationThreadTasks* vegTasks)
+    {
+        const size_t maxPreparedSectors = static_cast<AZ::u32>(veg_sectorPointJobs);
+        if (maxPreparedSectors <= 1 || m_preparedSectorPoints.contains(m_updateWorkList.back().first))
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Pick the sectors in the order they will be processed, which is from the back of the work list.
+        // Fill requests don't gather surface points, so they are skipped.
+        AZStd::vector<SectorInfo> sectorInfos;
+        for (auto workItr = m_updateWorkList.rbegin(); workItr != m_updateWorkList.rend() && sectorInfos.size() < maxPreparedSectors; ++workItr)
+        {
+            if ((workItr->second != UpdateMode::Fill) && !m_preparedSectorPoints.contains(workItr->first))
+            {
+                SectorInfo& sectorInfo = sectorInfos.emplace_back();
+                sectorInfo.m_id = workItr->first;
+                sectorInfo.m_bounds = vegTasks->GetSectorBounds(workItr->first, m_cachedMainThreadData.m_sectorSizeInMeters);
+            }
+        }
+
+        if (sectorInfos.size() <= 1)
+        {
+            return;
+        }
+
+        // Each job only writes to its own sector info, and gathering the points doesn't touch the sector rolling window,
+        // so the claims are still made one sector at a time in the same order as without the jobs.
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        AZ::JobCompletion jobCompletion;
+        for (SectorInfo& sectorInfo : sectorInfos)
+        {
+            AZ::Job* job = AZ::CreateJobFunction(
+                [vegTasks, &sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                {
+                    vegTasks->UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        for (SectorInfo& sectorInfo : sectorInfos)
+        {
+            m_preparedSectorPoints.emplace(sectorInfo.m_id, AZStd::move(sectorInfo.m_baseContext));
+        }
+    }
+
+    bool AreaSystemComponent::UpdateContext::TakePreparedSectorPoints(const SectorId& sectorId, ClaimContext& outPoints)
+    {
+        auto preparedItr = m_preparedSectorPoints.find(sectorId);
+        if (preparedItr == m_preparedSectorPoints.end())
+        {
+            return false;
+        }
+
+        outPoints = AZStd::move(preparedItr->second);
+        m_preparedSectorPoints.erase(preparedItr);
+        return true;
+    }
 }
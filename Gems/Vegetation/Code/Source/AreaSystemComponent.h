@@ -110,6 +110,7 @@ namespace Vegetation
         void RegisterArea(AZ::EntityId areaId, AZ::u32 layer, AZ::u32 priority, const AZ::Aabb& bounds) override;
         void UnregisterArea(AZ::EntityId areaId) override;
         void RefreshArea(AZ::EntityId areaId, AZ::u32 layer, AZ::u32 priority, const AZ::Aabb& bounds) override;
+        void RefreshAreaRegion(AZ::EntityId areaId, const AZ::Aabb& dirtyRegion) override;
         void RefreshAllAreas() override;
         void ClearAllAreas() override;
         void MuteArea(AZ::EntityId areaId) override;
@@ -287,8 +288,13 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Creates a sector, gathering its surface points unless they were prepared ahead of time.
+            SectorInfo* CreateSector(
+                const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode,
+                ClaimContext* preparedPoints = nullptr);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Replaces the surface points of a sector with points gathered by UpdateSectorPoints on another sector info.
+            static void SetSectorPoints(SectorInfo& sectorInfo, ClaimContext&& preparedPoints);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
@@ -427,6 +433,11 @@ namespace Vegetation
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
 
+            //! Gathers the surface points of the next sectors to create or rebuild in parallel on the job system,
+            //! up to veg_sectorPointJobs sectors, so the vegetation thread only has to fill them.
+            void PrepareSectorPoints(VegetationThreadTasks* vegTasks);
+            bool TakePreparedSectorPoints(const SectorId& sectorId, ClaimContext& outPoints);
+
             enum class UpdateMode
             {
                 Create,
@@ -447,6 +458,10 @@ namespace Vegetation
             // too many sectors active at any one point in time.
             size_t m_viewRectSectorCount = 0;
 
+            // Surface points gathered ahead of time for sectors still in the update work list.  These are dropped whenever
+            // the work lists are refreshed, since the surface data or the sector settings they came from may have changed.
+            AZStd::unordered_map<SectorId, ClaimContext> m_preparedSectorPoints;
+
             // Thread-local copy of the main thread's m_cachedMainThreadData.  This way we can read from it on the vegetation
             // thread without requiring mutexes.
             CachedMainThreadData m_cachedMainThreadData;
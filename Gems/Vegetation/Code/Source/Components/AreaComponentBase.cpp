@@ -263,6 +263,20 @@ namespace Vegetation
         ++m_changeIndex;
     }
 
+    void AreaComponentBase::OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion)
+    {
+        // The area keeps its bounds when only part of its content changed, so it is enough to refresh the sectors
+        // of the dirty region, instead of every sector of the area
+        if (!m_areaRegistered || !dirtyRegion.IsValid())
+        {
+            OnCompositionChanged();
+            return;
+        }
+
+        AreaSystemRequestBus::Broadcast(&AreaSystemRequestBus::Events::RefreshAreaRegion, GetEntityId(), dirtyRegion);
+        ++m_changeIndex;
+    }
+
     void AreaComponentBase::OnAreaConnect()
     {
         AreaRequestBus::Handler::BusConnect(GetEntityId());
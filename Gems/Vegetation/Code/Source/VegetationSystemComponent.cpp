@@ -20,6 +20,7 @@
 #include <Vegetation/InstanceSpawner.h>
 #include <Vegetation/EmptyInstanceSpawner.h>
 #include <Vegetation/DynamicSliceInstanceSpawner.h>
+#include <Vegetation/MeshInstanceSpawner.h>
 #include <Vegetation/PrefabInstanceSpawner.h>
 
 namespace Vegetation
@@ -73,6 +74,7 @@ namespace Vegetation
         EmptyInstanceSpawner::Reflect(context);
         DynamicSliceInstanceSpawner::Reflect(context);
         PrefabInstanceSpawner::Reflect(context);
+        MeshInstanceSpawner::Reflect(context);
         Descriptor::Reflect(context);
         AreaConfig::Reflect(context);
         AreaComponentBase::Reflect(context);
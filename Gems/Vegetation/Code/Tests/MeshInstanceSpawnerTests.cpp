@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "VegetationTest.h"
+#include "VegetationMocks.h"
+
+#include <AzCore/Component/Entity.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Vegetation/MeshInstanceSpawner.h>
+
+namespace UnitTest
+{
+    // Mock VegetationSystemComponent is needed to reflect only the MeshInstanceSpawner.
+    class MockMeshInstanceVegetationSystemComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MockMeshInstanceVegetationSystemComponent, "{6A0E9D57-2B3C-4E1F-8C7D-95B4F3A2E610}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflect)
+        {
+            Vegetation::InstanceSpawner::Reflect(reflect);
+            Vegetation::MeshInstanceSpawner::Reflect(reflect);
+        }
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC("VegetationSystemService", 0xa2322728));
+        }
+    };
+
+    class MeshInstanceSpawnerTests
+        : public VegetationComponentTests
+    {
+    public:
+        void RegisterComponentDescriptors() override
+        {
+            m_app.RegisterComponentDescriptor(MockMeshInstanceVegetationSystemComponent::CreateDescriptor());
+        }
+    };
+
+    TEST_F(MeshInstanceSpawnerTests, BasicInitializationTest)
+    {
+        // Basic test to make sure we can construct / destroy without errors.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DefaultSpawnersAreEqual)
+    {
+        // Two different instances of the default MeshInstanceSpawner should be considered data-equivalent.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner1;
+        Vegetation::MeshInstanceSpawner instanceSpawner2;
+
+        EXPECT_TRUE(instanceSpawner1 == instanceSpawner2);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DefaultSpawnerHasEmptyAssetReferences)
+    {
+        // Without a model asset, the spawner should report that it's expecting to spawn empty instances,
+        // and shouldn't be spawnable until a model has loaded.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        EXPECT_TRUE(instanceSpawner.HasEmptyAssetReferences());
+        EXPECT_FALSE(instanceSpawner.IsLoaded());
+        EXPECT_FALSE(instanceSpawner.IsSpawnable());
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, SpawnerRegisteredWithDescriptor)
+    {
+        // Validate that the Descriptor successfully gets MeshInstanceSpawner registered with it,
+        // as long as InstanceSpawner and MeshInstanceSpawner have been reflected.
+
+        MockMeshInstanceVegetationSystemComponent* component = nullptr;
+        auto entity = CreateEntity(&component);
+
+        Vegetation::Descriptor descriptor;
+        descriptor.RefreshSpawnerTypeList();
+        auto spawnerTypes = descriptor.GetSpawnerTypeList();
+        EXPECT_TRUE(spawnerTypes.size() == 1);
+        EXPECT_TRUE(spawnerTypes[0].first == Vegetation::MeshInstanceSpawner::RTTI_Type());
+    }
+}
@@ -65,6 +65,11 @@ namespace UnitTest
             ++m_count;
         }
 
+        void RefreshAreaRegion([[maybe_unused]] AZ::EntityId areaId, [[maybe_unused]] const AZ::Aabb& dirtyRegion) override
+        {
+            ++m_count;
+        }
+
         void RefreshAllAreas() override
         {
             ++m_count;
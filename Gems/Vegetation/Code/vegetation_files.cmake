@@ -13,6 +13,7 @@ set(FILES
     Include/Vegetation/InstanceSpawner.h
     Include/Vegetation/DynamicSliceInstanceSpawner.h
     Include/Vegetation/EmptyInstanceSpawner.h
+    Include/Vegetation/MeshInstanceSpawner.h
     Include/Vegetation/PrefabInstanceSpawner.h
     Include/Vegetation/AreaComponentBase.h
     Include/Vegetation/Ebuses/AreaSystemRequestBus.h
@@ -95,6 +96,7 @@ set(FILES
     Source/Descriptor.cpp
     Source/DynamicSliceInstanceSpawner.cpp
     Source/EmptyInstanceSpawner.cpp
+    Source/MeshInstanceSpawner.cpp
     Source/PrefabInstanceSpawner.cpp
     Source/VegetationSystemComponent.cpp
     Source/VegetationSystemComponent.h
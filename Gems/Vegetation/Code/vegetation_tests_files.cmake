@@ -14,6 +14,7 @@ set(FILES
     Tests/VegetationComponentFilterTests.cpp
     Tests/DynamicSliceInstanceSpawnerTests.cpp
     Tests/EmptyInstanceSpawnerTests.cpp
+    Tests/MeshInstanceSpawnerTests.cpp
     Tests/PrefabInstanceSpawnerTests.cpp
     Tests/VegetationAreaSystemComponentTest.cpp
     Tests/VegetationTest.cpp
@@ -0,0 +1,190 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Compares the Google Benchmark results of the benchmark suite against stored baselines and flags the regressions.
+
+The benchmark targets registered with ly_add_googlebenchmark are run with:
+    ctest --test-dir <build> -C <config> -L SUITE_benchmark
+which writes one Google Benchmark json file per target to <build>/BenchmarkResults.
+
+Usage:
+    # Store the current results as the baseline
+    python benchmark_compare.py --results <build>/BenchmarkResults --baseline <baseline_dir> --update-baseline
+    # Compare the current results against the baseline, exits with 1 when a benchmark regressed
+    python benchmark_compare.py --results <build>/BenchmarkResults --baseline <baseline_dir> --threshold 10
+"""
+import argparse
+import glob
+import json
+import os
+import sys
+
+# Conversion of the Google Benchmark time units to nanoseconds
+TIME_UNIT_TO_NANOSECONDS = {
+    'ns': 1.0,
+    'us': 1000.0,
+    'ms': 1000000.0,
+    's': 1000000000.0,
+}
+
+BASELINE_VERSION = 1
+
+
+def load_benchmark_results(results_path):
+    """
+    Loads the Google Benchmark json files of a directory, or a single file.
+    When the benchmarks were run with repetitions the median is used, otherwise the mean of the runs with the same name.
+    :param results_path: A Google Benchmark json file or a directory of them.
+    :return: Dictionary of '<result file name>/<benchmark name>' to {'real_time', 'cpu_time'} in nanoseconds.
+    """
+    if os.path.isdir(results_path):
+        result_files = sorted(glob.glob(os.path.join(results_path, '*.json')))
+    else:
+        result_files = [results_path]
+
+    results = {}
+    for result_file in result_files:
+        with open(result_file) as file:
+            try:
+                document = json.load(file)
+            except ValueError:
+                print(f'Skipping {result_file}, it is not a valid json file')
+                continue
+
+        suite_name = os.path.splitext(os.path.basename(result_file))[0]
+        runs = {}
+        medians = {}
+        for benchmark in document.get('benchmarks', []):
+            if benchmark.get('error_occurred'):
+                continue
+            scale = TIME_UNIT_TO_NANOSECONDS.get(benchmark.get('time_unit', 'ns'), 1.0)
+            times = {
+                'real_time': benchmark['real_time'] * scale,
+                'cpu_time': benchmark['cpu_time'] * scale,
+            }
+            run_type = benchmark.get('run_type', 'iteration')
+            if run_type == 'aggregate':
+                if benchmark.get('aggregate_name') == 'median':
+                    medians[benchmark.get('run_name', benchmark['name'])] = times
+            else:
+                runs.setdefault(benchmark.get('run_name', benchmark['name']), []).append(times)
+
+        for name, name_runs in runs.items():
+            if name in medians:
+                times = medians[name]
+            else:
+                times = {metric: sum(run[metric] for run in name_runs) / len(name_runs) for metric in ('real_time', 'cpu_time')}
+            results[f'{suite_name}/{name}'] = times
+
+    return results
+
+
+def load_baseline(baseline_path):
+    """
+    Loads the baselines stored by write_baseline.
+    :param baseline_path: The baseline directory.
+    :return: Dictionary of benchmark name to {'real_time', 'cpu_time'} in nanoseconds.
+    """
+    baseline_file = os.path.join(baseline_path, 'baseline.json')
+    if not os.path.exists(baseline_file):
+        return {}
+    with open(baseline_file) as file:
+        document = json.load(file)
+    if document.get('version') != BASELINE_VERSION:
+        raise ValueError(f'Unsupported baseline version {document.get("version")} in {baseline_file}')
+    return document['benchmarks']
+
+
+def write_json(file_path, document):
+    """
+    Writes a json document with sorted keys and a fixed indentation, so that stored baselines diff cleanly.
+    """
+    directory = os.path.dirname(file_path)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+    with open(file_path, 'w') as file:
+        json.dump(document, file, indent=4, sort_keys=True)
+        file.write('\n')
+
+
+def write_baseline(baseline_path, results):
+    write_json(os.path.join(baseline_path, 'baseline.json'), {'version': BASELINE_VERSION, 'benchmarks': results})
+
+
+def compare(baseline, results, metric, threshold_percent):
+    """
+    Compares the results against the baseline.
+    :param metric: 'real_time' or 'cpu_time'.
+    :param threshold_percent: A benchmark slower than its baseline by more than this percentage is a regression.
+    :return: Dictionary with the 'regressions', 'improvements', 'unchanged', 'new' and 'missing' benchmarks.
+    """
+    comparison = {'regressions': {}, 'improvements': {}, 'unchanged': {}, 'new': sorted(set(results) - set(baseline)),
+                  'missing': sorted(set(baseline) - set(results))}
+    for name in sorted(set(results) & set(baseline)):
+        baseline_time = baseline[name][metric]
+        current_time = results[name][metric]
+        change_percent = ((current_time - baseline_time) / baseline_time * 100.0) if baseline_time > 0 else 0.0
+        entry = {'baseline': baseline_time, 'current': current_time, 'change_percent': round(change_percent, 2)}
+        if change_percent > threshold_percent:
+            comparison['regressions'][name] = entry
+        elif change_percent < -threshold_percent:
+            comparison['improvements'][name] = entry
+        else:
+            comparison['unchanged'][name] = entry
+    return comparison
+
+
+def print_comparison(comparison, threshold_percent):
+    for category, title in (('regressions', 'Regressions'), ('improvements', 'Improvements')):
+        entries = comparison[category]
+        if entries:
+            print(f'{title} (more than {threshold_percent}% change):')
+            for name, entry in sorted(entries.items(), key=lambda item: -abs(item[1]['change_percent'])):
+                print(f'    {name}: {entry["baseline"]:.1f} ns -> {entry["current"]:.1f} ns ({entry["change_percent"]:+.2f}%)')
+    for category, title in (('new', 'New benchmarks without a baseline'), ('missing', 'Benchmarks of the baseline without results')):
+        if comparison[category]:
+            print(f'{title}:')
+            for name in comparison[category]:
+                print(f'    {name}')
+    print(f'{len(comparison["regressions"])} regressed, {len(comparison["improvements"])} improved, '
+          f'{len(comparison["unchanged"])} unchanged')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compares Google Benchmark results against stored baselines.')
+    parser.add_argument('-r', '--results', required=True, help='Google Benchmark json file, or directory of them like <build>/BenchmarkResults')
+    parser.add_argument('-b', '--baseline', required=True, help='Directory of the stored baseline')
+    parser.add_argument('-t', '--threshold', type=float, default=10.0, help='Slowdown in percent above which a benchmark regressed')
+    parser.add_argument('-m', '--metric', choices=['real_time', 'cpu_time'], default='cpu_time', help='The time compared')
+    parser.add_argument('-o', '--output', help='Writes the comparison to this json file')
+    parser.add_argument('--update-baseline', action='store_true', help='Stores the results as the new baseline instead of comparing')
+    args = parser.parse_args()
+
+    results = load_benchmark_results(args.results)
+    if not results:
+        print(f'No benchmark results found in {args.results}')
+        return 1
+
+    if args.update_baseline:
+        write_baseline(args.baseline, results)
+        print(f'Stored {len(results)} benchmark results as the baseline in {args.baseline}')
+        return 0
+
+    baseline = load_baseline(args.baseline)
+    if not baseline:
+        print(f'No baseline found in {args.baseline}, store one with --update-baseline')
+        return 1
+
+    comparison = compare(baseline, results, args.metric, args.threshold)
+    print_comparison(comparison, args.threshold)
+    if args.output:
+        write_json(args.output, comparison)
+
+    return 1 if comparison['regressions'] else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,68 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Self-tests for benchmark_compare.py.
+"""
+import json
+import os
+
+import benchmark_compare
+
+
+def _write_results(directory, name, benchmarks):
+    file_path = os.path.join(directory, f'{name}.json')
+    with open(file_path, 'w') as file:
+        json.dump({'context': {}, 'benchmarks': benchmarks}, file)
+    return file_path
+
+
+def _run(name, cpu_time, time_unit='ns', **kwargs):
+    benchmark = {'name': name, 'run_name': name, 'run_type': 'iteration', 'iterations': 100,
+                 'real_time': cpu_time, 'cpu_time': cpu_time, 'time_unit': time_unit}
+    benchmark.update(kwargs)
+    return benchmark
+
+
+def test_LoadResults_MixedUnits_ConvertedToNanoseconds(tmp_path):
+    _write_results(tmp_path, 'AzCore.Benchmarks', [_run('BM_A', 2.0, 'us'), _run('BM_B', 3.0, 'ms')])
+
+    results = benchmark_compare.load_benchmark_results(str(tmp_path))
+
+    assert results['AzCore.Benchmarks/BM_A']['cpu_time'] == 2000.0
+    assert results['AzCore.Benchmarks/BM_B']['cpu_time'] == 3000000.0
+
+
+def test_LoadResults_Repetitions_UsesMedian(tmp_path):
+    _write_results(tmp_path, 'Suite', [
+        _run('BM_A', 10.0), _run('BM_A', 30.0), _run('BM_A', 20.0),
+        _run('BM_A_median', 20.0, run_name='BM_A', run_type='aggregate', aggregate_name='median'),
+        _run('BM_A_mean', 25.0, run_name='BM_A', run_type='aggregate', aggregate_name='mean')])
+
+    results = benchmark_compare.load_benchmark_results(str(tmp_path))
+
+    assert list(results.keys()) == ['Suite/BM_A']
+    assert results['Suite/BM_A']['cpu_time'] == 20.0
+
+
+def test_Compare_SlowerThanThreshold_FlaggedAsRegression(tmp_path):
+    baseline_path = os.path.join(tmp_path, 'baseline')
+    baseline_results = os.path.join(tmp_path, 'baseline_results')
+    os.makedirs(baseline_results)
+    _write_results(baseline_results, 'Suite', [_run('BM_Fast', 100.0), _run('BM_Slow', 100.0), _run('BM_Removed', 100.0)])
+    benchmark_compare.write_baseline(baseline_path, benchmark_compare.load_benchmark_results(baseline_results))
+
+    current_results = os.path.join(tmp_path, 'current_results')
+    os.makedirs(current_results)
+    _write_results(current_results, 'Suite', [_run('BM_Fast', 50.0), _run('BM_Slow', 120.0), _run('BM_Added', 10.0)])
+
+    comparison = benchmark_compare.compare(
+        benchmark_compare.load_baseline(baseline_path), benchmark_compare.load_benchmark_results(current_results), 'cpu_time', 10.0)
+
+    assert list(comparison['regressions'].keys()) == ['Suite/BM_Slow']
+    assert comparison['regressions']['Suite/BM_Slow']['change_percent'] == 20.0
+    assert list(comparison['improvements'].keys()) == ['Suite/BM_Fast']
+    assert comparison['new'] == ['Suite/BM_Added']
+    assert comparison['missing'] == ['Suite/BM_Removed']